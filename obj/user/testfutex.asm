@@ -0,0 +1,8224 @@
+
+obj/user/testfutex:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b7 03 00 00       	call   8003da <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+        mutex_unlock(&sh->lock);
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    struct Shared *sh = SHARED;
+    int res;
+
+    if ((res = sys_alloc_region(0, sh, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  800036:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80003b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800040:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800045:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004a:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+  800056:	85 c0                	test   %eax,%eax
+  800058:	0f 88 7d 01 00 00    	js     8001db <umain+0x1b6>
+        panic("sys_alloc_region: %i", res);
+
+    res = sys_futex_wait(&sh->counter, 1, 0);
+  80005e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800063:	be 01 00 00 00       	mov    $0x1,%esi
+  800068:	bf 08 00 00 0a       	mov    $0xa000008,%edi
+  80006d:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+    if (res != -E_AGAIN) panic("futex_wait of changed value: %i", res);
+  800079:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  80007c:	0f 85 86 01 00 00    	jne    800208 <umain+0x1e3>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800082:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800084:	48 c1 e2 20          	shl    $0x20,%rdx
+  800088:	89 c0                	mov    %eax,%eax
+  80008a:	48 09 c2             	or     %rax,%rdx
+
+    uint64_t deadline = read_tsc() + DELAY;
+  80008d:	48 8d 9a 00 00 00 01 	lea    0x1000000(%rdx),%rbx
+    res = sys_futex_wait(&sh->counter, 0, deadline);
+  800094:	48 89 da             	mov    %rbx,%rdx
+  800097:	be 00 00 00 00       	mov    $0x0,%esi
+  80009c:	bf 08 00 00 0a       	mov    $0xa000008,%edi
+  8000a1:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+    if (res != -E_TIMEOUT) panic("futex_wait with timeout: %i", res);
+  8000ad:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8000b0:	0f 85 7f 01 00 00    	jne    800235 <umain+0x210>
+    asm volatile("rdtsc"
+  8000b6:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000b8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000bc:	89 c0                	mov    %eax,%eax
+  8000be:	48 09 c2             	or     %rax,%rdx
+    if (read_tsc() < deadline) panic("futex_wait timed out too early");
+  8000c1:	48 39 da             	cmp    %rbx,%rdx
+  8000c4:	0f 82 98 01 00 00    	jb     800262 <umain+0x23d>
+
+    res = sys_futex_wake(&sh->counter, 1);
+  8000ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8000cf:	bf 08 00 00 0a       	mov    $0xa000008,%edi
+  8000d4:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  8000db:	00 00 00 
+  8000de:	ff d0                	call   *%rax
+    if (res) panic("futex_wake without waiters: %i", res);
+  8000e0:	85 c0                	test   %eax,%eax
+  8000e2:	0f 85 a4 01 00 00    	jne    80028c <umain+0x267>
+  8000e8:	4c 8d 65 c0          	lea    -0x40(%rbp),%r12
+  8000ec:	4c 8d 75 d0          	lea    -0x30(%rbp),%r14
+  8000f0:	4d 89 e5             	mov    %r12,%r13
+
+    envid_t children[NCHILDREN];
+    for (int i = 0; i < NCHILDREN; i++) {
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+  8000f3:	49 bf 26 1d 80 00 00 	movabs $0x801d26,%r15
+  8000fa:	00 00 00 
+  8000fd:	41 ff d7             	call   *%r15
+  800100:	89 c3                	mov    %eax,%ebx
+  800102:	41 89 45 00          	mov    %eax,0x0(%r13)
+  800106:	85 c0                	test   %eax,%eax
+  800108:	0f 88 ab 01 00 00    	js     8002b9 <umain+0x294>
+        if (!children[i]) {
+  80010e:	0f 84 d2 01 00 00    	je     8002e6 <umain+0x2c1>
+    for (int i = 0; i < NCHILDREN; i++) {
+  800114:	49 83 c5 04          	add    $0x4,%r13
+  800118:	4d 39 f5             	cmp    %r14,%r13
+  80011b:	75 e0                	jne    8000fd <umain+0xd8>
+            return;
+        }
+    }
+
+    /* Start all children at once */
+    mutex_lock(&sh->lock);
+  80011d:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800122:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+    while (sh->started < NCHILDREN) cond_wait(&sh->cond, &sh->lock);
+  80012e:	83 3c 25 0c 00 00 0a 	cmpl   $0x3,0xa00000c
+  800135:	03 
+  800136:	77 20                	ja     800158 <umain+0x133>
+  800138:	48 bb cc 1f 80 00 00 	movabs $0x801fcc,%rbx
+  80013f:	00 00 00 
+  800142:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800147:	bf 04 00 00 0a       	mov    $0xa000004,%edi
+  80014c:	ff d3                	call   *%rbx
+  80014e:	83 3c 25 0c 00 00 0a 	cmpl   $0x3,0xa00000c
+  800155:	03 
+  800156:	76 ea                	jbe    800142 <umain+0x11d>
+    sh->go = 1;
+  800158:	c7 04 25 10 00 00 0a 	movl   $0x1,0xa000010
+  80015f:	01 00 00 00 
+    cond_broadcast(&sh->cond);
+  800163:	bf 04 00 00 0a       	mov    $0xa000004,%edi
+  800168:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+    mutex_unlock(&sh->lock);
+  800174:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800179:	48 b8 a8 1f 80 00 00 	movabs $0x801fa8,%rax
+  800180:	00 00 00 
+  800183:	ff d0                	call   *%rax
+
+    for (int i = 0; i < NCHILDREN; i++)
+        wait(children[i]);
+  800185:	48 bb 9c 3b 80 00 00 	movabs $0x803b9c,%rbx
+  80018c:	00 00 00 
+  80018f:	41 8b 3c 24          	mov    (%r12),%edi
+  800193:	ff d3                	call   *%rbx
+    for (int i = 0; i < NCHILDREN; i++)
+  800195:	49 83 c4 04          	add    $0x4,%r12
+  800199:	4d 39 f4             	cmp    %r14,%r12
+  80019c:	75 f1                	jne    80018f <umain+0x16a>
+
+    if (sh->counter != NCHILDREN * NITERS)
+  80019e:	8b 0c 25 08 00 00 0a 	mov    0xa000008,%ecx
+  8001a5:	81 f9 20 03 00 00    	cmp    $0x320,%ecx
+  8001ab:	0f 85 f8 01 00 00    	jne    8003a9 <umain+0x384>
+        panic("counter is %u instead of %u", sh->counter, NCHILDREN * NITERS);
+
+    cprintf("testfutex: OK\n");
+  8001b1:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  8001b8:	00 00 00 
+  8001bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c0:	48 ba 3a 06 80 00 00 	movabs $0x80063a,%rdx
+  8001c7:	00 00 00 
+  8001ca:	ff d2                	call   *%rdx
+}
+  8001cc:	48 83 c4 18          	add    $0x18,%rsp
+  8001d0:	5b                   	pop    %rbx
+  8001d1:	41 5c                	pop    %r12
+  8001d3:	41 5d                	pop    %r13
+  8001d5:	41 5e                	pop    %r14
+  8001d7:	41 5f                	pop    %r15
+  8001d9:	5d                   	pop    %rbp
+  8001da:	c3                   	ret
+        panic("sys_alloc_region: %i", res);
+  8001db:	89 c1                	mov    %eax,%ecx
+  8001dd:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8001e4:	00 00 00 
+  8001e7:	be 30 00 00 00       	mov    $0x30,%esi
+  8001ec:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8001f3:	00 00 00 
+  8001f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fb:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  800202:	00 00 00 
+  800205:	41 ff d0             	call   *%r8
+    if (res != -E_AGAIN) panic("futex_wait of changed value: %i", res);
+  800208:	89 c1                	mov    %eax,%ecx
+  80020a:	48 ba 78 50 80 00 00 	movabs $0x805078,%rdx
+  800211:	00 00 00 
+  800214:	be 33 00 00 00       	mov    $0x33,%esi
+  800219:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  800220:	00 00 00 
+  800223:	b8 00 00 00 00       	mov    $0x0,%eax
+  800228:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  80022f:	00 00 00 
+  800232:	41 ff d0             	call   *%r8
+    if (res != -E_TIMEOUT) panic("futex_wait with timeout: %i", res);
+  800235:	89 c1                	mov    %eax,%ecx
+  800237:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  80023e:	00 00 00 
+  800241:	be 37 00 00 00       	mov    $0x37,%esi
+  800246:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  80024d:	00 00 00 
+  800250:	b8 00 00 00 00       	mov    $0x0,%eax
+  800255:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  80025c:	00 00 00 
+  80025f:	41 ff d0             	call   *%r8
+    if (read_tsc() < deadline) panic("futex_wait timed out too early");
+  800262:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  800269:	00 00 00 
+  80026c:	be 38 00 00 00       	mov    $0x38,%esi
+  800271:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  800278:	00 00 00 
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	48 b9 ea 04 80 00 00 	movabs $0x8004ea,%rcx
+  800287:	00 00 00 
+  80028a:	ff d1                	call   *%rcx
+    if (res) panic("futex_wake without waiters: %i", res);
+  80028c:	89 c1                	mov    %eax,%ecx
+  80028e:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800295:	00 00 00 
+  800298:	be 3b 00 00 00       	mov    $0x3b,%esi
+  80029d:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8002a4:	00 00 00 
+  8002a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ac:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  8002b3:	00 00 00 
+  8002b6:	41 ff d0             	call   *%r8
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+  8002b9:	89 c1                	mov    %eax,%ecx
+  8002bb:	48 ba 42 50 80 00 00 	movabs $0x805042,%rdx
+  8002c2:	00 00 00 
+  8002c5:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8002ca:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8002d1:	00 00 00 
+  8002d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d9:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  8002e0:	00 00 00 
+  8002e3:	41 ff d0             	call   *%r8
+    mutex_lock(&sh->lock);
+  8002e6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8002eb:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    sh->started++;
+  8002f7:	83 04 25 0c 00 00 0a 	addl   $0x1,0xa00000c
+  8002fe:	01 
+    cond_broadcast(&sh->cond);
+  8002ff:	bf 04 00 00 0a       	mov    $0xa000004,%edi
+  800304:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+    while (!sh->go) cond_wait(&sh->cond, &sh->lock);
+  800310:	83 3c 25 10 00 00 0a 	cmpl   $0x0,0xa000010
+  800317:	00 
+  800318:	75 21                	jne    80033b <umain+0x316>
+  80031a:	49 bc cc 1f 80 00 00 	movabs $0x801fcc,%r12
+  800321:	00 00 00 
+  800324:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800329:	bf 04 00 00 0a       	mov    $0xa000004,%edi
+  80032e:	41 ff d4             	call   *%r12
+  800331:	83 3c 25 10 00 00 0a 	cmpl   $0x0,0xa000010
+  800338:	00 
+  800339:	74 e9                	je     800324 <umain+0x2ff>
+    mutex_unlock(&sh->lock);
+  80033b:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800340:	48 b8 a8 1f 80 00 00 	movabs $0x801fa8,%rax
+  800347:	00 00 00 
+  80034a:	ff d0                	call   *%rax
+        mutex_lock(&sh->lock);
+  80034c:	49 be 27 1f 80 00 00 	movabs $0x801f27,%r14
+  800353:	00 00 00 
+        if (!(i % 16)) sys_yield();
+  800356:	49 bf 80 14 80 00 00 	movabs $0x801480,%r15
+  80035d:	00 00 00 
+        mutex_unlock(&sh->lock);
+  800360:	49 bd a8 1f 80 00 00 	movabs $0x801fa8,%r13
+  800367:	00 00 00 
+  80036a:	eb 23                	jmp    80038f <umain+0x36a>
+        sh->counter = val + 1;
+  80036c:	41 83 c4 01          	add    $0x1,%r12d
+  800370:	44 89 24 25 08 00 00 	mov    %r12d,0xa000008
+  800377:	0a 
+        mutex_unlock(&sh->lock);
+  800378:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80037d:	41 ff d5             	call   *%r13
+    for (int i = 0; i < NITERS; i++) {
+  800380:	83 c3 01             	add    $0x1,%ebx
+  800383:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  800389:	0f 84 3d fe ff ff    	je     8001cc <umain+0x1a7>
+        mutex_lock(&sh->lock);
+  80038f:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800394:	41 ff d6             	call   *%r14
+        uint32_t val = sh->counter;
+  800397:	44 8b 24 25 08 00 00 	mov    0xa000008,%r12d
+  80039e:	0a 
+        if (!(i % 16)) sys_yield();
+  80039f:	f6 c3 0f             	test   $0xf,%bl
+  8003a2:	75 c8                	jne    80036c <umain+0x347>
+  8003a4:	41 ff d7             	call   *%r15
+  8003a7:	eb c3                	jmp    80036c <umain+0x347>
+        panic("counter is %u instead of %u", sh->counter, NCHILDREN * NITERS);
+  8003a9:	41 b8 20 03 00 00    	mov    $0x320,%r8d
+  8003af:	48 ba 4b 50 80 00 00 	movabs $0x80504b,%rdx
+  8003b6:	00 00 00 
+  8003b9:	be 51 00 00 00       	mov    $0x51,%esi
+  8003be:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8003c5:	00 00 00 
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8003d4:	00 00 00 
+  8003d7:	41 ff d1             	call   *%r9
+
+00000000008003da <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003da:	55                   	push   %rbp
+  8003db:	48 89 e5             	mov    %rsp,%rbp
+  8003de:	41 56                	push   %r14
+  8003e0:	41 55                	push   %r13
+  8003e2:	41 54                	push   %r12
+  8003e4:	53                   	push   %rbx
+  8003e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8003e9:	41 89 fd             	mov    %edi,%r13d
+  8003ec:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8003ef:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8003f6:	00 
+  8003f7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8003fe:	00 
+  8003ff:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800406:	00 
+  800407:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80040e:	00 
+  80040f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800413:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800417:	bf 00 00 00 00       	mov    $0x0,%edi
+  80041c:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800428:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80042f:	00 00 00 
+  800432:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800439:	00 00 00 
+  80043c:	48 39 c2             	cmp    %rax,%rdx
+  80043f:	73 17                	jae    800458 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800441:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800444:	49 89 c4             	mov    %rax,%r12
+  800447:	48 83 c3 08          	add    $0x8,%rbx
+  80044b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800450:	ff 53 f8             	call   *-0x8(%rbx)
+  800453:	4c 39 e3             	cmp    %r12,%rbx
+  800456:	72 ef                	jb     800447 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800458:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  80045f:	00 00 00 
+  800462:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800464:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80046b:	00 00 
+  80046d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800472:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800479:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800480:	00 00 00 
+  800483:	48 01 c8             	add    %rcx,%rax
+  800486:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80048a:	45 85 ed             	test   %r13d,%r13d
+  80048d:	7e 0d                	jle    80049c <libmain+0xc2>
+  80048f:	49 8b 06             	mov    (%r14),%rax
+  800492:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800499:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80049c:	4c 89 f6             	mov    %r14,%rsi
+  80049f:	44 89 ef             	mov    %r13d,%edi
+  8004a2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8004a9:	00 00 00 
+  8004ac:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004ae:	48 b8 c7 04 80 00 00 	movabs $0x8004c7,%rax
+  8004b5:	00 00 00 
+  8004b8:	ff d0                	call   *%rax
+#endif
+}
+  8004ba:	48 83 c4 30          	add    $0x30,%rsp
+  8004be:	5b                   	pop    %rbx
+  8004bf:	41 5c                	pop    %r12
+  8004c1:	41 5d                	pop    %r13
+  8004c3:	41 5e                	pop    %r14
+  8004c5:	5d                   	pop    %rbp
+  8004c6:	c3                   	ret
+
+00000000008004c7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004c7:	55                   	push   %rbp
+  8004c8:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004cb:	48 b8 83 22 80 00 00 	movabs $0x802283,%rax
+  8004d2:	00 00 00 
+  8004d5:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004dc:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  8004e3:	00 00 00 
+  8004e6:	ff d0                	call   *%rax
+}
+  8004e8:	5d                   	pop    %rbp
+  8004e9:	c3                   	ret
+
+00000000008004ea <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004ea:	55                   	push   %rbp
+  8004eb:	48 89 e5             	mov    %rsp,%rbp
+  8004ee:	41 56                	push   %r14
+  8004f0:	41 55                	push   %r13
+  8004f2:	41 54                	push   %r12
+  8004f4:	53                   	push   %rbx
+  8004f5:	48 83 ec 50          	sub    $0x50,%rsp
+  8004f9:	49 89 fc             	mov    %rdi,%r12
+  8004fc:	41 89 f5             	mov    %esi,%r13d
+  8004ff:	48 89 d3             	mov    %rdx,%rbx
+  800502:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800506:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80050a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80050e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800515:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800519:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80051d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800521:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800525:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80052c:	00 00 00 
+  80052f:	4c 8b 30             	mov    (%rax),%r14
+  800532:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  800539:	00 00 00 
+  80053c:	ff d0                	call   *%rax
+  80053e:	89 c6                	mov    %eax,%esi
+  800540:	45 89 e8             	mov    %r13d,%r8d
+  800543:	4c 89 e1             	mov    %r12,%rcx
+  800546:	4c 89 f2             	mov    %r14,%rdx
+  800549:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  800550:	00 00 00 
+  800553:	b8 00 00 00 00       	mov    $0x0,%eax
+  800558:	49 bc 3a 06 80 00 00 	movabs $0x80063a,%r12
+  80055f:	00 00 00 
+  800562:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800565:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800569:	48 89 df             	mov    %rbx,%rdi
+  80056c:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800573:	00 00 00 
+  800576:	ff d0                	call   *%rax
+    cprintf("\n");
+  800578:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  80057f:	00 00 00 
+  800582:	b8 00 00 00 00       	mov    $0x0,%eax
+  800587:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80058a:	cc                   	int3
+  80058b:	eb fd                	jmp    80058a <_panic+0xa0>
+
+000000000080058d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80058d:	55                   	push   %rbp
+  80058e:	48 89 e5             	mov    %rsp,%rbp
+  800591:	53                   	push   %rbx
+  800592:	48 83 ec 08          	sub    $0x8,%rsp
+  800596:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800599:	8b 06                	mov    (%rsi),%eax
+  80059b:	8d 50 01             	lea    0x1(%rax),%edx
+  80059e:	89 16                	mov    %edx,(%rsi)
+  8005a0:	48 98                	cltq
+  8005a2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005a7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005ad:	74 0a                	je     8005b9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005af:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005b7:	c9                   	leave
+  8005b8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005b9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005bd:	be ff 00 00 00       	mov    $0xff,%esi
+  8005c2:	48 b8 86 13 80 00 00 	movabs $0x801386,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005ce:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005d4:	eb d9                	jmp    8005af <putch+0x22>
+
+00000000008005d6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  8005da:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005e1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005e4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005eb:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005f8:	48 89 f1             	mov    %rsi,%rcx
+  8005fb:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800602:	48 bf 8d 05 80 00 00 	movabs $0x80058d,%rdi
+  800609:	00 00 00 
+  80060c:	48 b8 8a 07 80 00 00 	movabs $0x80078a,%rax
+  800613:	00 00 00 
+  800616:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800618:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80061f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800626:	48 b8 86 13 80 00 00 	movabs $0x801386,%rax
+  80062d:	00 00 00 
+  800630:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800632:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800638:	c9                   	leave
+  800639:	c3                   	ret
+
+000000000080063a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+  80063e:	48 83 ec 50          	sub    $0x50,%rsp
+  800642:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800646:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80064a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80064e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800652:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800656:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80065d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800661:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800665:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800669:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80066d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800671:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800678:	00 00 00 
+  80067b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80067d:	c9                   	leave
+  80067e:	c3                   	ret
+
+000000000080067f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80067f:	55                   	push   %rbp
+  800680:	48 89 e5             	mov    %rsp,%rbp
+  800683:	41 57                	push   %r15
+  800685:	41 56                	push   %r14
+  800687:	41 55                	push   %r13
+  800689:	41 54                	push   %r12
+  80068b:	53                   	push   %rbx
+  80068c:	48 83 ec 18          	sub    $0x18,%rsp
+  800690:	49 89 fc             	mov    %rdi,%r12
+  800693:	49 89 f5             	mov    %rsi,%r13
+  800696:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80069a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80069d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006a0:	41 89 cf             	mov    %ecx,%r15d
+  8006a3:	4c 39 fa             	cmp    %r15,%rdx
+  8006a6:	73 5b                	jae    800703 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006a8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006ac:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006b0:	85 db                	test   %ebx,%ebx
+  8006b2:	7e 0e                	jle    8006c2 <print_num+0x43>
+            putch(padc, put_arg);
+  8006b4:	4c 89 ee             	mov    %r13,%rsi
+  8006b7:	44 89 f7             	mov    %r14d,%edi
+  8006ba:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006bd:	83 eb 01             	sub    $0x1,%ebx
+  8006c0:	75 f2                	jne    8006b4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006c2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006c6:	48 b9 1c 51 80 00 00 	movabs $0x80511c,%rcx
+  8006cd:	00 00 00 
+  8006d0:	48 b8 0b 51 80 00 00 	movabs $0x80510b,%rax
+  8006d7:	00 00 00 
+  8006da:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e7:	49 f7 f7             	div    %r15
+  8006ea:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006ee:	4c 89 ee             	mov    %r13,%rsi
+  8006f1:	41 ff d4             	call   *%r12
+}
+  8006f4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006f8:	5b                   	pop    %rbx
+  8006f9:	41 5c                	pop    %r12
+  8006fb:	41 5d                	pop    %r13
+  8006fd:	41 5e                	pop    %r14
+  8006ff:	41 5f                	pop    %r15
+  800701:	5d                   	pop    %rbp
+  800702:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800703:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800707:	ba 00 00 00 00       	mov    $0x0,%edx
+  80070c:	49 f7 f7             	div    %r15
+  80070f:	48 83 ec 08          	sub    $0x8,%rsp
+  800713:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800717:	52                   	push   %rdx
+  800718:	45 0f be c9          	movsbl %r9b,%r9d
+  80071c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800720:	48 89 c2             	mov    %rax,%rdx
+  800723:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  80072a:	00 00 00 
+  80072d:	ff d0                	call   *%rax
+  80072f:	48 83 c4 10          	add    $0x10,%rsp
+  800733:	eb 8d                	jmp    8006c2 <print_num+0x43>
+
+0000000000800735 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800735:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800739:	48 8b 06             	mov    (%rsi),%rax
+  80073c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800740:	73 0a                	jae    80074c <sprintputch+0x17>
+        *state->start++ = ch;
+  800742:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800746:	48 89 16             	mov    %rdx,(%rsi)
+  800749:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80074c:	c3                   	ret
+
+000000000080074d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80074d:	55                   	push   %rbp
+  80074e:	48 89 e5             	mov    %rsp,%rbp
+  800751:	48 83 ec 50          	sub    $0x50,%rsp
+  800755:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800759:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80075d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800761:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800768:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80076c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800770:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800774:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800778:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80077c:	48 b8 8a 07 80 00 00 	movabs $0x80078a,%rax
+  800783:	00 00 00 
+  800786:	ff d0                	call   *%rax
+}
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+
+000000000080078a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80078a:	55                   	push   %rbp
+  80078b:	48 89 e5             	mov    %rsp,%rbp
+  80078e:	41 57                	push   %r15
+  800790:	41 56                	push   %r14
+  800792:	41 55                	push   %r13
+  800794:	41 54                	push   %r12
+  800796:	53                   	push   %rbx
+  800797:	48 83 ec 38          	sub    $0x38,%rsp
+  80079b:	49 89 fe             	mov    %rdi,%r14
+  80079e:	49 89 f5             	mov    %rsi,%r13
+  8007a1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007a4:	48 8b 01             	mov    (%rcx),%rax
+  8007a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007ab:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007bb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007bf:	0f b6 3b             	movzbl (%rbx),%edi
+  8007c2:	40 80 ff 25          	cmp    $0x25,%dil
+  8007c6:	74 18                	je     8007e0 <vprintfmt+0x56>
+            if (!ch) return;
+  8007c8:	40 84 ff             	test   %dil,%dil
+  8007cb:	0f 84 b1 06 00 00    	je     800e82 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007d1:	40 0f b6 ff          	movzbl %dil,%edi
+  8007d5:	4c 89 ee             	mov    %r13,%rsi
+  8007d8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007db:	4c 89 e3             	mov    %r12,%rbx
+  8007de:	eb db                	jmp    8007bb <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e5:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007e9:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007ee:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007f4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007fb:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007ff:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800804:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800809:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80080c:	83 e8 23             	sub    $0x23,%eax
+  80080f:	3c 57                	cmp    $0x57,%al
+  800811:	0f 87 51 06 00 00    	ja     800e68 <vprintfmt+0x6de>
+  800817:	0f b6 c0             	movzbl %al,%eax
+  80081a:	48 b9 c0 52 80 00 00 	movabs $0x8052c0,%rcx
+  800821:	00 00 00 
+  800824:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800827:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80082a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80082e:	eb cf                	jmp    8007ff <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800830:	49 89 dc             	mov    %rbx,%r12
+  800833:	be 01 00 00 00       	mov    $0x1,%esi
+  800838:	eb c5                	jmp    8007ff <vprintfmt+0x75>
+            padc = ch;
+  80083a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80083e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800841:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800844:	eb b9                	jmp    8007ff <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 24                	ja     800872 <vprintfmt+0xe8>
+  80084e:	89 c1                	mov    %eax,%ecx
+  800850:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80085d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800860:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800864:	79 99                	jns    8007ff <vprintfmt+0x75>
+                width = precision;
+  800866:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80086a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800870:	eb 8d                	jmp    8007ff <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800872:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800876:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80087a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087e:	eb da                	jmp    80085a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800880:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800885:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800889:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80088f:	3c 39                	cmp    $0x39,%al
+  800891:	77 1c                	ja     8008af <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800893:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800897:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80089b:	0f b6 c0             	movzbl %al,%eax
+  80089e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008a3:	0f b6 03             	movzbl (%rbx),%eax
+  8008a6:	3c 39                	cmp    $0x39,%al
+  8008a8:	76 e9                	jbe    800893 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008aa:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008ad:	eb b1                	jmp    800860 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008af:	49 89 dc             	mov    %rbx,%r12
+  8008b2:	eb ac                	jmp    800860 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008b4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008b7:	85 c9                	test   %ecx,%ecx
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008be:	0f 49 c1             	cmovns %ecx,%eax
+  8008c1:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008c4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008c7:	e9 33 ff ff ff       	jmp    8007ff <vprintfmt+0x75>
+            lflag++;
+  8008cc:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008cf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008d2:	e9 28 ff ff ff       	jmp    8007ff <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008da:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dd:	77 19                	ja     8008f8 <vprintfmt+0x16e>
+  8008df:	89 c2                	mov    %eax,%edx
+  8008e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e5:	83 c0 08             	add    $0x8,%eax
+  8008e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008eb:	8b 3a                	mov    (%rdx),%edi
+  8008ed:	4c 89 ee             	mov    %r13,%rsi
+  8008f0:	41 ff d6             	call   *%r14
+            break;
+  8008f3:	e9 c3 fe ff ff       	jmp    8007bb <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800900:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800904:	eb e5                	jmp    8008eb <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800906:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800909:	83 f8 2f             	cmp    $0x2f,%eax
+  80090c:	77 5a                	ja     800968 <vprintfmt+0x1de>
+  80090e:	89 c2                	mov    %eax,%edx
+  800910:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800914:	83 c0 08             	add    $0x8,%eax
+  800917:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80091a:	8b 02                	mov    (%rdx),%eax
+  80091c:	89 c1                	mov    %eax,%ecx
+  80091e:	f7 d9                	neg    %ecx
+  800920:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800923:	83 f9 16             	cmp    $0x16,%ecx
+  800926:	7f 4e                	jg     800976 <vprintfmt+0x1ec>
+  800928:	48 63 c1             	movslq %ecx,%rax
+  80092b:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  800932:	00 00 00 
+  800935:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800939:	48 85 c0             	test   %rax,%rax
+  80093c:	74 38                	je     800976 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80093e:	48 89 c1             	mov    %rax,%rcx
+  800941:	48 ba 79 57 80 00 00 	movabs $0x805779,%rdx
+  800948:	00 00 00 
+  80094b:	4c 89 ee             	mov    %r13,%rsi
+  80094e:	4c 89 f7             	mov    %r14,%rdi
+  800951:	b8 00 00 00 00       	mov    $0x0,%eax
+  800956:	49 b8 4d 07 80 00 00 	movabs $0x80074d,%r8
+  80095d:	00 00 00 
+  800960:	41 ff d0             	call   *%r8
+  800963:	e9 53 fe ff ff       	jmp    8007bb <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb a4                	jmp    80091a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800976:	48 ba 34 51 80 00 00 	movabs $0x805134,%rdx
+  80097d:	00 00 00 
+  800980:	4c 89 ee             	mov    %r13,%rsi
+  800983:	4c 89 f7             	mov    %r14,%rdi
+  800986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098b:	49 b8 4d 07 80 00 00 	movabs $0x80074d,%r8
+  800992:	00 00 00 
+  800995:	41 ff d0             	call   *%r8
+  800998:	e9 1e fe ff ff       	jmp    8007bb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80099d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 6c                	ja     800a11 <vprintfmt+0x287>
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ab:	83 c0 08             	add    $0x8,%eax
+  8009ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b1:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009b4:	48 85 d2             	test   %rdx,%rdx
+  8009b7:	48 b8 2d 51 80 00 00 	movabs $0x80512d,%rax
+  8009be:	00 00 00 
+  8009c1:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009c5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009c9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009cd:	7e 06                	jle    8009d5 <vprintfmt+0x24b>
+  8009cf:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009d3:	75 4a                	jne    800a1f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009d5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009d9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009dd:	0f b6 00             	movzbl (%rax),%eax
+  8009e0:	84 c0                	test   %al,%al
+  8009e2:	0f 85 9a 00 00 00    	jne    800a82 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009e8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009eb:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009ef:	85 c0                	test   %eax,%eax
+  8009f1:	0f 8e c4 fd ff ff    	jle    8007bb <vprintfmt+0x31>
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009ff:	41 ff d6             	call   *%r14
+  800a02:	41 83 ec 01          	sub    $0x1,%r12d
+  800a06:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a0a:	75 eb                	jne    8009f7 <vprintfmt+0x26d>
+  800a0c:	e9 aa fd ff ff       	jmp    8007bb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1d:	eb 92                	jmp    8009b1 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a1f:	49 63 f7             	movslq %r15d,%rsi
+  800a22:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a26:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  800a2d:	00 00 00 
+  800a30:	ff d0                	call   *%rax
+  800a32:	48 89 c2             	mov    %rax,%rdx
+  800a35:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a38:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a3a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a3d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a40:	85 c0                	test   %eax,%eax
+  800a42:	7e 91                	jle    8009d5 <vprintfmt+0x24b>
+  800a44:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a49:	4c 89 ee             	mov    %r13,%rsi
+  800a4c:	44 89 e7             	mov    %r12d,%edi
+  800a4f:	41 ff d6             	call   *%r14
+  800a52:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a56:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a59:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a5c:	75 eb                	jne    800a49 <vprintfmt+0x2bf>
+  800a5e:	e9 72 ff ff ff       	jmp    8009d5 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a63:	0f b6 f8             	movzbl %al,%edi
+  800a66:	4c 89 ee             	mov    %r13,%rsi
+  800a69:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a70:	49 83 c4 01          	add    $0x1,%r12
+  800a74:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a7a:	84 c0                	test   %al,%al
+  800a7c:	0f 84 66 ff ff ff    	je     8009e8 <vprintfmt+0x25e>
+  800a82:	45 85 ff             	test   %r15d,%r15d
+  800a85:	78 0a                	js     800a91 <vprintfmt+0x307>
+  800a87:	41 83 ef 01          	sub    $0x1,%r15d
+  800a8b:	0f 88 57 ff ff ff    	js     8009e8 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a91:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a95:	74 cc                	je     800a63 <vprintfmt+0x2d9>
+  800a97:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a9a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a9f:	80 fa 5e             	cmp    $0x5e,%dl
+  800aa2:	77 c2                	ja     800a66 <vprintfmt+0x2dc>
+  800aa4:	eb bd                	jmp    800a63 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa6:	40 84 f6             	test   %sil,%sil
+  800aa9:	75 26                	jne    800ad1 <vprintfmt+0x347>
+    switch (lflag) {
+  800aab:	85 d2                	test   %edx,%edx
+  800aad:	74 59                	je     800b08 <vprintfmt+0x37e>
+  800aaf:	83 fa 01             	cmp    $0x1,%edx
+  800ab2:	74 7b                	je     800b2f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ab4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aba:	0f 87 96 00 00 00    	ja     800b56 <vprintfmt+0x3cc>
+  800ac0:	89 c2                	mov    %eax,%edx
+  800ac2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac6:	83 c0 08             	add    $0x8,%eax
+  800ac9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acc:	4c 8b 22             	mov    (%rdx),%r12
+  800acf:	eb 17                	jmp    800ae8 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	77 21                	ja     800afa <vprintfmt+0x370>
+  800ad9:	89 c2                	mov    %eax,%edx
+  800adb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adf:	83 c0 08             	add    $0x8,%eax
+  800ae2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800ae8:	4d 85 e4             	test   %r12,%r12
+  800aeb:	78 7a                	js     800b67 <vprintfmt+0x3dd>
+            num = i;
+  800aed:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800af0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800af5:	e9 50 02 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b06:	eb dd                	jmp    800ae5 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0e:	77 11                	ja     800b21 <vprintfmt+0x397>
+  800b10:	89 c2                	mov    %eax,%edx
+  800b12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b16:	83 c0 08             	add    $0x8,%eax
+  800b19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1c:	4c 63 22             	movslq (%rdx),%r12
+  800b1f:	eb c7                	jmp    800ae8 <vprintfmt+0x35e>
+  800b21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2d:	eb ed                	jmp    800b1c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b32:	83 f8 2f             	cmp    $0x2f,%eax
+  800b35:	77 11                	ja     800b48 <vprintfmt+0x3be>
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3d:	83 c0 08             	add    $0x8,%eax
+  800b40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b43:	4c 8b 22             	mov    (%rdx),%r12
+  800b46:	eb a0                	jmp    800ae8 <vprintfmt+0x35e>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb ed                	jmp    800b43 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	e9 65 ff ff ff       	jmp    800acc <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b67:	4c 89 ee             	mov    %r13,%rsi
+  800b6a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b6f:	41 ff d6             	call   *%r14
+                i = -i;
+  800b72:	49 f7 dc             	neg    %r12
+  800b75:	e9 73 ff ff ff       	jmp    800aed <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7a:	40 84 f6             	test   %sil,%sil
+  800b7d:	75 32                	jne    800bb1 <vprintfmt+0x427>
+    switch (lflag) {
+  800b7f:	85 d2                	test   %edx,%edx
+  800b81:	74 5d                	je     800be0 <vprintfmt+0x456>
+  800b83:	83 fa 01             	cmp    $0x1,%edx
+  800b86:	0f 84 82 00 00 00    	je     800c0e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b92:	0f 87 a5 00 00 00    	ja     800c3d <vprintfmt+0x4b3>
+  800b98:	89 c2                	mov    %eax,%edx
+  800b9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9e:	83 c0 08             	add    $0x8,%eax
+  800ba1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bac:	e9 99 01 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb7:	77 19                	ja     800bd2 <vprintfmt+0x448>
+  800bb9:	89 c2                	mov    %eax,%edx
+  800bbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbf:	83 c0 08             	add    $0x8,%eax
+  800bc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bc8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bcd:	e9 78 01 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+  800bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bde:	eb e5                	jmp    800bc5 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800be0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be3:	83 f8 2f             	cmp    $0x2f,%eax
+  800be6:	77 18                	ja     800c00 <vprintfmt+0x476>
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bee:	83 c0 08             	add    $0x8,%eax
+  800bf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf4:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800bf6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bfb:	e9 4a 01 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+  800c00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0c:	eb e6                	jmp    800bf4 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c11:	83 f8 2f             	cmp    $0x2f,%eax
+  800c14:	77 19                	ja     800c2f <vprintfmt+0x4a5>
+  800c16:	89 c2                	mov    %eax,%edx
+  800c18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1c:	83 c0 08             	add    $0x8,%eax
+  800c1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c22:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c25:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c2a:	e9 1b 01 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+  800c2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3b:	eb e5                	jmp    800c22 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c49:	e9 56 ff ff ff       	jmp    800ba4 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4e:	40 84 f6             	test   %sil,%sil
+  800c51:	75 2e                	jne    800c81 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c53:	85 d2                	test   %edx,%edx
+  800c55:	74 59                	je     800cb0 <vprintfmt+0x526>
+  800c57:	83 fa 01             	cmp    $0x1,%edx
+  800c5a:	74 7f                	je     800cdb <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c62:	0f 87 9f 00 00 00    	ja     800d07 <vprintfmt+0x57d>
+  800c68:	89 c2                	mov    %eax,%edx
+  800c6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6e:	83 c0 08             	add    $0x8,%eax
+  800c71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c74:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c77:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c7c:	e9 c9 00 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c84:	83 f8 2f             	cmp    $0x2f,%eax
+  800c87:	77 19                	ja     800ca2 <vprintfmt+0x518>
+  800c89:	89 c2                	mov    %eax,%edx
+  800c8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8f:	83 c0 08             	add    $0x8,%eax
+  800c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c98:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c9d:	e9 a8 00 00 00       	jmp    800d4a <vprintfmt+0x5c0>
+  800ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cae:	eb e5                	jmp    800c95 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800cb0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb6:	77 15                	ja     800ccd <vprintfmt+0x543>
+  800cb8:	89 c2                	mov    %eax,%edx
+  800cba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbe:	83 c0 08             	add    $0x8,%eax
+  800cc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc4:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800cc6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ccb:	eb 7d                	jmp    800d4a <vprintfmt+0x5c0>
+  800ccd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd9:	eb e9                	jmp    800cc4 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800cdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cde:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce1:	77 16                	ja     800cf9 <vprintfmt+0x56f>
+  800ce3:	89 c2                	mov    %eax,%edx
+  800ce5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce9:	83 c0 08             	add    $0x8,%eax
+  800cec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cf2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cf7:	eb 51                	jmp    800d4a <vprintfmt+0x5c0>
+  800cf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d05:	eb e8                	jmp    800cef <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d13:	e9 5c ff ff ff       	jmp    800c74 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d18:	4c 89 ee             	mov    %r13,%rsi
+  800d1b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d20:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d23:	4c 89 ee             	mov    %r13,%rsi
+  800d26:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d2b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d31:	83 f8 2f             	cmp    $0x2f,%eax
+  800d34:	77 47                	ja     800d7d <vprintfmt+0x5f3>
+  800d36:	89 c2                	mov    %eax,%edx
+  800d38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3c:	83 c0 08             	add    $0x8,%eax
+  800d3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d45:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d4a:	48 83 ec 08          	sub    $0x8,%rsp
+  800d4e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d52:	0f 94 c0             	sete   %al
+  800d55:	0f b6 c0             	movzbl %al,%eax
+  800d58:	50                   	push   %rax
+  800d59:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d5e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d62:	4c 89 ee             	mov    %r13,%rsi
+  800d65:	4c 89 f7             	mov    %r14,%rdi
+  800d68:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+            break;
+  800d74:	48 83 c4 10          	add    $0x10,%rsp
+  800d78:	e9 3e fa ff ff       	jmp    8007bb <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d89:	eb b7                	jmp    800d42 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d8b:	40 84 f6             	test   %sil,%sil
+  800d8e:	75 2b                	jne    800dbb <vprintfmt+0x631>
+    switch (lflag) {
+  800d90:	85 d2                	test   %edx,%edx
+  800d92:	74 56                	je     800dea <vprintfmt+0x660>
+  800d94:	83 fa 01             	cmp    $0x1,%edx
+  800d97:	74 7f                	je     800e18 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9f:	0f 87 a2 00 00 00    	ja     800e47 <vprintfmt+0x6bd>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dab:	83 c0 08             	add    $0x8,%eax
+  800dae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800db4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800db9:	eb 8f                	jmp    800d4a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc1:	77 19                	ja     800ddc <vprintfmt+0x652>
+  800dc3:	89 c2                	mov    %eax,%edx
+  800dc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc9:	83 c0 08             	add    $0x8,%eax
+  800dcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dd2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dd7:	e9 6e ff ff ff       	jmp    800d4a <vprintfmt+0x5c0>
+  800ddc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de8:	eb e5                	jmp    800dcf <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800dea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ded:	83 f8 2f             	cmp    $0x2f,%eax
+  800df0:	77 18                	ja     800e0a <vprintfmt+0x680>
+  800df2:	89 c2                	mov    %eax,%edx
+  800df4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df8:	83 c0 08             	add    $0x8,%eax
+  800dfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfe:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e00:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e05:	e9 40 ff ff ff       	jmp    800d4a <vprintfmt+0x5c0>
+  800e0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e16:	eb e6                	jmp    800dfe <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1e:	77 19                	ja     800e39 <vprintfmt+0x6af>
+  800e20:	89 c2                	mov    %eax,%edx
+  800e22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e26:	83 c0 08             	add    $0x8,%eax
+  800e29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e34:	e9 11 ff ff ff       	jmp    800d4a <vprintfmt+0x5c0>
+  800e39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e45:	eb e5                	jmp    800e2c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e53:	e9 59 ff ff ff       	jmp    800db1 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e58:	4c 89 ee             	mov    %r13,%rsi
+  800e5b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e60:	41 ff d6             	call   *%r14
+            break;
+  800e63:	e9 53 f9 ff ff       	jmp    8007bb <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e68:	4c 89 ee             	mov    %r13,%rsi
+  800e6b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e70:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e73:	48 83 eb 01          	sub    $0x1,%rbx
+  800e77:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e7b:	75 f6                	jne    800e73 <vprintfmt+0x6e9>
+  800e7d:	e9 39 f9 ff ff       	jmp    8007bb <vprintfmt+0x31>
+}
+  800e82:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e86:	5b                   	pop    %rbx
+  800e87:	41 5c                	pop    %r12
+  800e89:	41 5d                	pop    %r13
+  800e8b:	41 5e                	pop    %r14
+  800e8d:	41 5f                	pop    %r15
+  800e8f:	5d                   	pop    %rbp
+  800e90:	c3                   	ret
+
+0000000000800e91 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e91:	55                   	push   %rbp
+  800e92:	48 89 e5             	mov    %rsp,%rbp
+  800e95:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e9d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ea2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ea6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ead:	48 85 ff             	test   %rdi,%rdi
+  800eb0:	74 2b                	je     800edd <vsnprintf+0x4c>
+  800eb2:	48 85 f6             	test   %rsi,%rsi
+  800eb5:	74 26                	je     800edd <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800eb7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ebb:	48 bf 35 07 80 00 00 	movabs $0x800735,%rdi
+  800ec2:	00 00 00 
+  800ec5:	48 b8 8a 07 80 00 00 	movabs $0x80078a,%rax
+  800ecc:	00 00 00 
+  800ecf:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ed1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ed5:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ed8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800edb:	c9                   	leave
+  800edc:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee2:	eb f7                	jmp    800edb <vsnprintf+0x4a>
+
+0000000000800ee4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ee4:	55                   	push   %rbp
+  800ee5:	48 89 e5             	mov    %rsp,%rbp
+  800ee8:	48 83 ec 50          	sub    $0x50,%rsp
+  800eec:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ef0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ef4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ef8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800eff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f07:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f0f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f13:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  800f1a:	00 00 00 
+  800f1d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f1f:	c9                   	leave
+  800f20:	c3                   	ret
+
+0000000000800f21 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f21:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f24:	74 10                	je     800f36 <strlen+0x15>
+    size_t n = 0;
+  800f26:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f2b:	48 83 c0 01          	add    $0x1,%rax
+  800f2f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f33:	75 f6                	jne    800f2b <strlen+0xa>
+  800f35:	c3                   	ret
+    size_t n = 0;
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f3b:	c3                   	ret
+
+0000000000800f3c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f3c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f44:	48 85 f6             	test   %rsi,%rsi
+  800f47:	74 11                	je     800f5a <strnlen+0x1e>
+  800f49:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f4d:	74 0c                	je     800f5b <strnlen+0x1f>
+  800f4f:	48 83 c2 01          	add    $0x1,%rdx
+  800f53:	48 39 d0             	cmp    %rdx,%rax
+  800f56:	75 f1                	jne    800f49 <strnlen+0xd>
+  800f58:	eb 04                	jmp    800f5e <strnlen+0x22>
+  800f5a:	c3                   	ret
+  800f5b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f5f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f67:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f6b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f6e:	48 83 c2 01          	add    $0x1,%rdx
+  800f72:	84 c9                	test   %cl,%cl
+  800f74:	75 f1                	jne    800f67 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f76:	c3                   	ret
+
+0000000000800f77 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f77:	55                   	push   %rbp
+  800f78:	48 89 e5             	mov    %rsp,%rbp
+  800f7b:	41 54                	push   %r12
+  800f7d:	53                   	push   %rbx
+  800f7e:	48 89 fb             	mov    %rdi,%rbx
+  800f81:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f84:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  800f8b:	00 00 00 
+  800f8e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f90:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f94:	4c 89 e6             	mov    %r12,%rsi
+  800f97:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  800f9e:	00 00 00 
+  800fa1:	ff d0                	call   *%rax
+    return dst;
+}
+  800fa3:	48 89 d8             	mov    %rbx,%rax
+  800fa6:	5b                   	pop    %rbx
+  800fa7:	41 5c                	pop    %r12
+  800fa9:	5d                   	pop    %rbp
+  800faa:	c3                   	ret
+
+0000000000800fab <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fab:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800fae:	48 85 d2             	test   %rdx,%rdx
+  800fb1:	74 1f                	je     800fd2 <strncpy+0x27>
+  800fb3:	48 01 fa             	add    %rdi,%rdx
+  800fb6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800fb9:	48 83 c1 01          	add    $0x1,%rcx
+  800fbd:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fc1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800fc5:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fc9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800fcd:	48 39 ca             	cmp    %rcx,%rdx
+  800fd0:	75 e7                	jne    800fb9 <strncpy+0xe>
+    }
+    return ret;
+}
+  800fd2:	c3                   	ret
+
+0000000000800fd3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fd3:	48 89 f8             	mov    %rdi,%rax
+  800fd6:	48 85 d2             	test   %rdx,%rdx
+  800fd9:	74 24                	je     800fff <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fdb:	48 83 ea 01          	sub    $0x1,%rdx
+  800fdf:	74 1b                	je     800ffc <strlcpy+0x29>
+  800fe1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fe5:	0f b6 16             	movzbl (%rsi),%edx
+  800fe8:	84 d2                	test   %dl,%dl
+  800fea:	74 10                	je     800ffc <strlcpy+0x29>
+            *dst++ = *src++;
+  800fec:	48 83 c6 01          	add    $0x1,%rsi
+  800ff0:	48 83 c0 01          	add    $0x1,%rax
+  800ff4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ff7:	48 39 c8             	cmp    %rcx,%rax
+  800ffa:	75 e9                	jne    800fe5 <strlcpy+0x12>
+        *dst = '\0';
+  800ffc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fff:	48 29 f8             	sub    %rdi,%rax
+}
+  801002:	c3                   	ret
+
+0000000000801003 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801003:	0f b6 07             	movzbl (%rdi),%eax
+  801006:	84 c0                	test   %al,%al
+  801008:	74 13                	je     80101d <strcmp+0x1a>
+  80100a:	38 06                	cmp    %al,(%rsi)
+  80100c:	75 0f                	jne    80101d <strcmp+0x1a>
+  80100e:	48 83 c7 01          	add    $0x1,%rdi
+  801012:	48 83 c6 01          	add    $0x1,%rsi
+  801016:	0f b6 07             	movzbl (%rdi),%eax
+  801019:	84 c0                	test   %al,%al
+  80101b:	75 ed                	jne    80100a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80101d:	0f b6 c0             	movzbl %al,%eax
+  801020:	0f b6 16             	movzbl (%rsi),%edx
+  801023:	29 d0                	sub    %edx,%eax
+}
+  801025:	c3                   	ret
+
+0000000000801026 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801026:	48 85 d2             	test   %rdx,%rdx
+  801029:	74 1f                	je     80104a <strncmp+0x24>
+  80102b:	0f b6 07             	movzbl (%rdi),%eax
+  80102e:	84 c0                	test   %al,%al
+  801030:	74 1e                	je     801050 <strncmp+0x2a>
+  801032:	3a 06                	cmp    (%rsi),%al
+  801034:	75 1a                	jne    801050 <strncmp+0x2a>
+  801036:	48 83 c7 01          	add    $0x1,%rdi
+  80103a:	48 83 c6 01          	add    $0x1,%rsi
+  80103e:	48 83 ea 01          	sub    $0x1,%rdx
+  801042:	75 e7                	jne    80102b <strncmp+0x5>
+
+    if (!n) return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+  801049:	c3                   	ret
+  80104a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104f:	c3                   	ret
+  801050:	48 85 d2             	test   %rdx,%rdx
+  801053:	74 09                	je     80105e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801055:	0f b6 07             	movzbl (%rdi),%eax
+  801058:	0f b6 16             	movzbl (%rsi),%edx
+  80105b:	29 d0                	sub    %edx,%eax
+  80105d:	c3                   	ret
+    if (!n) return 0;
+  80105e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801063:	c3                   	ret
+
+0000000000801064 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801064:	0f b6 17             	movzbl (%rdi),%edx
+  801067:	84 d2                	test   %dl,%dl
+  801069:	74 18                	je     801083 <strchr+0x1f>
+        if (*str == c) {
+  80106b:	0f be d2             	movsbl %dl,%edx
+  80106e:	39 f2                	cmp    %esi,%edx
+  801070:	74 17                	je     801089 <strchr+0x25>
+    for (; *str; str++) {
+  801072:	48 83 c7 01          	add    $0x1,%rdi
+  801076:	0f b6 17             	movzbl (%rdi),%edx
+  801079:	84 d2                	test   %dl,%dl
+  80107b:	75 ee                	jne    80106b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801082:	c3                   	ret
+  801083:	b8 00 00 00 00       	mov    $0x0,%eax
+  801088:	c3                   	ret
+  801089:	48 89 f8             	mov    %rdi,%rax
+}
+  80108c:	c3                   	ret
+
+000000000080108d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80108d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801090:	0f b6 17             	movzbl (%rdi),%edx
+  801093:	84 d2                	test   %dl,%dl
+  801095:	74 13                	je     8010aa <strfind+0x1d>
+  801097:	0f be d2             	movsbl %dl,%edx
+  80109a:	39 f2                	cmp    %esi,%edx
+  80109c:	74 0b                	je     8010a9 <strfind+0x1c>
+  80109e:	48 83 c0 01          	add    $0x1,%rax
+  8010a2:	0f b6 10             	movzbl (%rax),%edx
+  8010a5:	84 d2                	test   %dl,%dl
+  8010a7:	75 ee                	jne    801097 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8010a9:	c3                   	ret
+  8010aa:	c3                   	ret
+
+00000000008010ab <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010ab:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010ae:	48 89 f8             	mov    %rdi,%rax
+  8010b1:	48 f7 d8             	neg    %rax
+  8010b4:	83 e0 07             	and    $0x7,%eax
+  8010b7:	49 89 d1             	mov    %rdx,%r9
+  8010ba:	49 29 c1             	sub    %rax,%r9
+  8010bd:	78 36                	js     8010f5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010bf:	40 0f b6 c6          	movzbl %sil,%eax
+  8010c3:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010ca:	01 01 01 
+  8010cd:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010d1:	40 f6 c7 07          	test   $0x7,%dil
+  8010d5:	75 38                	jne    80110f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010d7:	4c 89 c9             	mov    %r9,%rcx
+  8010da:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010de:	74 0c                	je     8010ec <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010e0:	fc                   	cld
+  8010e1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010e4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010e8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010ec:	4d 85 c9             	test   %r9,%r9
+  8010ef:	75 45                	jne    801136 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010f1:	4c 89 c0             	mov    %r8,%rax
+  8010f4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010f5:	48 85 d2             	test   %rdx,%rdx
+  8010f8:	74 f7                	je     8010f1 <memset+0x46>
+  8010fa:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010fd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801100:	48 83 c0 01          	add    $0x1,%rax
+  801104:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801108:	48 39 c2             	cmp    %rax,%rdx
+  80110b:	75 f3                	jne    801100 <memset+0x55>
+  80110d:	eb e2                	jmp    8010f1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80110f:	40 f6 c7 01          	test   $0x1,%dil
+  801113:	74 06                	je     80111b <memset+0x70>
+  801115:	88 07                	mov    %al,(%rdi)
+  801117:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80111b:	40 f6 c7 02          	test   $0x2,%dil
+  80111f:	74 07                	je     801128 <memset+0x7d>
+  801121:	66 89 07             	mov    %ax,(%rdi)
+  801124:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801128:	40 f6 c7 04          	test   $0x4,%dil
+  80112c:	74 a9                	je     8010d7 <memset+0x2c>
+  80112e:	89 07                	mov    %eax,(%rdi)
+  801130:	48 83 c7 04          	add    $0x4,%rdi
+  801134:	eb a1                	jmp    8010d7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801136:	41 f6 c1 04          	test   $0x4,%r9b
+  80113a:	74 06                	je     801142 <memset+0x97>
+  80113c:	89 07                	mov    %eax,(%rdi)
+  80113e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801142:	41 f6 c1 02          	test   $0x2,%r9b
+  801146:	74 07                	je     80114f <memset+0xa4>
+  801148:	66 89 07             	mov    %ax,(%rdi)
+  80114b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80114f:	41 f6 c1 01          	test   $0x1,%r9b
+  801153:	74 9c                	je     8010f1 <memset+0x46>
+  801155:	88 07                	mov    %al,(%rdi)
+  801157:	eb 98                	jmp    8010f1 <memset+0x46>
+
+0000000000801159 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801159:	48 89 f8             	mov    %rdi,%rax
+  80115c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80115f:	48 39 fe             	cmp    %rdi,%rsi
+  801162:	73 3b                	jae    80119f <memmove+0x46>
+  801164:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801168:	48 39 d7             	cmp    %rdx,%rdi
+  80116b:	73 32                	jae    80119f <memmove+0x46>
+        s += n;
+        d += n;
+  80116d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801171:	48 89 d6             	mov    %rdx,%rsi
+  801174:	48 09 fe             	or     %rdi,%rsi
+  801177:	48 09 ce             	or     %rcx,%rsi
+  80117a:	40 f6 c6 07          	test   $0x7,%sil
+  80117e:	75 12                	jne    801192 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801180:	48 83 ef 08          	sub    $0x8,%rdi
+  801184:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801188:	48 c1 e9 03          	shr    $0x3,%rcx
+  80118c:	fd                   	std
+  80118d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801190:	fc                   	cld
+  801191:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801192:	48 83 ef 01          	sub    $0x1,%rdi
+  801196:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80119a:	fd                   	std
+  80119b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80119d:	eb f1                	jmp    801190 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80119f:	48 89 f2             	mov    %rsi,%rdx
+  8011a2:	48 09 c2             	or     %rax,%rdx
+  8011a5:	48 09 ca             	or     %rcx,%rdx
+  8011a8:	f6 c2 07             	test   $0x7,%dl
+  8011ab:	75 0c                	jne    8011b9 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011ad:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011b1:	48 89 c7             	mov    %rax,%rdi
+  8011b4:	fc                   	cld
+  8011b5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011b8:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011b9:	48 89 c7             	mov    %rax,%rdi
+  8011bc:	fc                   	cld
+  8011bd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011bf:	c3                   	ret
+
+00000000008011c0 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011c0:	55                   	push   %rbp
+  8011c1:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011c4:	48 b8 59 11 80 00 00 	movabs $0x801159,%rax
+  8011cb:	00 00 00 
+  8011ce:	ff d0                	call   *%rax
+}
+  8011d0:	5d                   	pop    %rbp
+  8011d1:	c3                   	ret
+
+00000000008011d2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011d2:	55                   	push   %rbp
+  8011d3:	48 89 e5             	mov    %rsp,%rbp
+  8011d6:	41 57                	push   %r15
+  8011d8:	41 56                	push   %r14
+  8011da:	41 55                	push   %r13
+  8011dc:	41 54                	push   %r12
+  8011de:	53                   	push   %rbx
+  8011df:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e3:	49 89 fe             	mov    %rdi,%r14
+  8011e6:	49 89 f7             	mov    %rsi,%r15
+  8011e9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011ec:	48 89 f7             	mov    %rsi,%rdi
+  8011ef:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  8011f6:	00 00 00 
+  8011f9:	ff d0                	call   *%rax
+  8011fb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011fe:	48 89 de             	mov    %rbx,%rsi
+  801201:	4c 89 f7             	mov    %r14,%rdi
+  801204:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+  801210:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801213:	48 39 c3             	cmp    %rax,%rbx
+  801216:	74 36                	je     80124e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801218:	48 89 d8             	mov    %rbx,%rax
+  80121b:	4c 29 e8             	sub    %r13,%rax
+  80121e:	49 39 c4             	cmp    %rax,%r12
+  801221:	73 31                	jae    801254 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801223:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801228:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80122c:	4c 89 fe             	mov    %r15,%rsi
+  80122f:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80123b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80123f:	48 83 c4 08          	add    $0x8,%rsp
+  801243:	5b                   	pop    %rbx
+  801244:	41 5c                	pop    %r12
+  801246:	41 5d                	pop    %r13
+  801248:	41 5e                	pop    %r14
+  80124a:	41 5f                	pop    %r15
+  80124c:	5d                   	pop    %rbp
+  80124d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80124e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801252:	eb eb                	jmp    80123f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801254:	48 83 eb 01          	sub    $0x1,%rbx
+  801258:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80125c:	48 89 da             	mov    %rbx,%rdx
+  80125f:	4c 89 fe             	mov    %r15,%rsi
+  801262:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  801269:	00 00 00 
+  80126c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80126e:	49 01 de             	add    %rbx,%r14
+  801271:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801276:	eb c3                	jmp    80123b <strlcat+0x69>
+
+0000000000801278 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801278:	48 85 d2             	test   %rdx,%rdx
+  80127b:	74 2d                	je     8012aa <memcmp+0x32>
+  80127d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801282:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801286:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80128b:	44 38 c1             	cmp    %r8b,%cl
+  80128e:	75 0f                	jne    80129f <memcmp+0x27>
+    while (n-- > 0) {
+  801290:	48 83 c0 01          	add    $0x1,%rax
+  801294:	48 39 c2             	cmp    %rax,%rdx
+  801297:	75 e9                	jne    801282 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80129f:	0f b6 c1             	movzbl %cl,%eax
+  8012a2:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012a6:	44 29 c0             	sub    %r8d,%eax
+  8012a9:	c3                   	ret
+    return 0;
+  8012aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012af:	c3                   	ret
+
+00000000008012b0 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012b0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012b4:	48 39 c7             	cmp    %rax,%rdi
+  8012b7:	73 0f                	jae    8012c8 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012b9:	40 38 37             	cmp    %sil,(%rdi)
+  8012bc:	74 0e                	je     8012cc <memfind+0x1c>
+    for (; src < end; src++) {
+  8012be:	48 83 c7 01          	add    $0x1,%rdi
+  8012c2:	48 39 f8             	cmp    %rdi,%rax
+  8012c5:	75 f2                	jne    8012b9 <memfind+0x9>
+  8012c7:	c3                   	ret
+  8012c8:	48 89 f8             	mov    %rdi,%rax
+  8012cb:	c3                   	ret
+  8012cc:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012cf:	c3                   	ret
+
+00000000008012d0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012d0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012d3:	0f b6 37             	movzbl (%rdi),%esi
+  8012d6:	40 80 fe 20          	cmp    $0x20,%sil
+  8012da:	74 06                	je     8012e2 <strtol+0x12>
+  8012dc:	40 80 fe 09          	cmp    $0x9,%sil
+  8012e0:	75 13                	jne    8012f5 <strtol+0x25>
+  8012e2:	48 83 c7 01          	add    $0x1,%rdi
+  8012e6:	0f b6 37             	movzbl (%rdi),%esi
+  8012e9:	40 80 fe 20          	cmp    $0x20,%sil
+  8012ed:	74 f3                	je     8012e2 <strtol+0x12>
+  8012ef:	40 80 fe 09          	cmp    $0x9,%sil
+  8012f3:	74 ed                	je     8012e2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012f5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012f8:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012fb:	3c 01                	cmp    $0x1,%al
+  8012fd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801301:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801307:	75 0f                	jne    801318 <strtol+0x48>
+  801309:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80130c:	74 14                	je     801322 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80130e:	85 d2                	test   %edx,%edx
+  801310:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801315:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801318:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80131d:	4c 63 ca             	movslq %edx,%r9
+  801320:	eb 36                	jmp    801358 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801322:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801326:	74 0f                	je     801337 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801328:	85 d2                	test   %edx,%edx
+  80132a:	75 ec                	jne    801318 <strtol+0x48>
+        s++;
+  80132c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801330:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801335:	eb e1                	jmp    801318 <strtol+0x48>
+        s += 2;
+  801337:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80133b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801340:	eb d6                	jmp    801318 <strtol+0x48>
+            dig -= '0';
+  801342:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801345:	44 0f b6 c1          	movzbl %cl,%r8d
+  801349:	41 39 d0             	cmp    %edx,%r8d
+  80134c:	7d 21                	jge    80136f <strtol+0x9f>
+        val = val * base + dig;
+  80134e:	49 0f af c1          	imul   %r9,%rax
+  801352:	0f b6 c9             	movzbl %cl,%ecx
+  801355:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801358:	48 83 c7 01          	add    $0x1,%rdi
+  80135c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801360:	80 f9 39             	cmp    $0x39,%cl
+  801363:	76 dd                	jbe    801342 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801365:	80 f9 7b             	cmp    $0x7b,%cl
+  801368:	77 05                	ja     80136f <strtol+0x9f>
+            dig -= 'a' - 10;
+  80136a:	83 e9 57             	sub    $0x57,%ecx
+  80136d:	eb d6                	jmp    801345 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80136f:	4d 85 d2             	test   %r10,%r10
+  801372:	74 03                	je     801377 <strtol+0xa7>
+  801374:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801377:	48 89 c2             	mov    %rax,%rdx
+  80137a:	48 f7 da             	neg    %rdx
+  80137d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801381:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801385:	c3                   	ret
+
+0000000000801386 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801386:	55                   	push   %rbp
+  801387:	48 89 e5             	mov    %rsp,%rbp
+  80138a:	53                   	push   %rbx
+  80138b:	48 89 fa             	mov    %rdi,%rdx
+  80138e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ab:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b1:	c9                   	leave
+  8013b2:	c3                   	ret
+
+00000000008013b3 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013b3:	55                   	push   %rbp
+  8013b4:	48 89 e5             	mov    %rsp,%rbp
+  8013b7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013dc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e2:	c9                   	leave
+  8013e3:	c3                   	ret
+
+00000000008013e4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8013e4:	55                   	push   %rbp
+  8013e5:	48 89 e5             	mov    %rsp,%rbp
+  8013e8:	53                   	push   %rbx
+  8013e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801404:	be 00 00 00 00       	mov    $0x0,%esi
+  801409:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801411:	48 85 c0             	test   %rax,%rax
+  801414:	7f 06                	jg     80141c <sys_env_destroy+0x38>
+}
+  801416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141a:	c9                   	leave
+  80141b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141c:	49 89 c0             	mov    %rax,%r8
+  80141f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801424:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80142b:	00 00 00 
+  80142e:	be 26 00 00 00       	mov    $0x26,%esi
+  801433:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80143a:	00 00 00 
+  80143d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801442:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  801449:	00 00 00 
+  80144c:	41 ff d1             	call   *%r9
+
+000000000080144f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+  801453:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801454:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801459:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801463:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801468:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146d:	be 00 00 00 00       	mov    $0x0,%esi
+  801472:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801478:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80147a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+
+0000000000801480 <sys_yield>:
+
+void
+sys_yield(void) {
+  801480:	55                   	push   %rbp
+  801481:	48 89 e5             	mov    %rsp,%rbp
+  801484:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801485:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80148a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a9:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+
+00000000008014b1 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014b1:	55                   	push   %rbp
+  8014b2:	48 89 e5             	mov    %rsp,%rbp
+  8014b5:	53                   	push   %rbx
+  8014b6:	48 89 fa             	mov    %rdi,%rdx
+  8014b9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bc:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c1:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014c8:	00 00 00 
+  8014cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014db:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+
+00000000008014e3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	53                   	push   %rbx
+  8014e8:	49 89 f8             	mov    %rdi,%r8
+  8014eb:	48 89 d3             	mov    %rdx,%rbx
+  8014ee:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014f1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f6:	4c 89 c2             	mov    %r8,%rdx
+  8014f9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801507:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801509:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150d:	c9                   	leave
+  80150e:	c3                   	ret
+
+000000000080150f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80150f:	55                   	push   %rbp
+  801510:	48 89 e5             	mov    %rsp,%rbp
+  801513:	53                   	push   %rbx
+  801514:	48 83 ec 08          	sub    $0x8,%rsp
+  801518:	89 f8                	mov    %edi,%eax
+  80151a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80151d:	48 63 f9             	movslq %ecx,%rdi
+  801520:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801523:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801528:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152b:	be 00 00 00 00       	mov    $0x0,%esi
+  801530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801536:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801538:	48 85 c0             	test   %rax,%rax
+  80153b:	7f 06                	jg     801543 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80153d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801543:	49 89 c0             	mov    %rax,%r8
+  801546:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80154b:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801552:	00 00 00 
+  801555:	be 26 00 00 00       	mov    $0x26,%esi
+  80155a:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801561:	00 00 00 
+  801564:	b8 00 00 00 00       	mov    $0x0,%eax
+  801569:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  801570:	00 00 00 
+  801573:	41 ff d1             	call   *%r9
+
+0000000000801576 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801576:	55                   	push   %rbp
+  801577:	48 89 e5             	mov    %rsp,%rbp
+  80157a:	53                   	push   %rbx
+  80157b:	48 83 ec 08          	sub    $0x8,%rsp
+  80157f:	89 f8                	mov    %edi,%eax
+  801581:	49 89 f2             	mov    %rsi,%r10
+  801584:	48 89 cf             	mov    %rcx,%rdi
+  801587:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80158a:	48 63 da             	movslq %edx,%rbx
+  80158d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801590:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801595:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801598:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80159b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159d:	48 85 c0             	test   %rax,%rax
+  8015a0:	7f 06                	jg     8015a8 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a6:	c9                   	leave
+  8015a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a8:	49 89 c0             	mov    %rax,%r8
+  8015ab:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015b0:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8015b7:	00 00 00 
+  8015ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8015bf:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8015c6:	00 00 00 
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ce:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8015d5:	00 00 00 
+  8015d8:	41 ff d1             	call   *%r9
+
+00000000008015db <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015db:	55                   	push   %rbp
+  8015dc:	48 89 e5             	mov    %rsp,%rbp
+  8015df:	53                   	push   %rbx
+  8015e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e4:	49 89 f9             	mov    %rdi,%r9
+  8015e7:	89 f0                	mov    %esi,%eax
+  8015e9:	48 89 d3             	mov    %rdx,%rbx
+  8015ec:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8015ef:	49 63 f0             	movslq %r8d,%rsi
+  8015f2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015fa:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801603:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801605:	48 85 c0             	test   %rax,%rax
+  801608:	7f 06                	jg     801610 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80160a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160e:	c9                   	leave
+  80160f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801610:	49 89 c0             	mov    %rax,%r8
+  801613:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801618:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80161f:	00 00 00 
+  801622:	be 26 00 00 00       	mov    $0x26,%esi
+  801627:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80162e:	00 00 00 
+  801631:	b8 00 00 00 00       	mov    $0x0,%eax
+  801636:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  80163d:	00 00 00 
+  801640:	41 ff d1             	call   *%r9
+
+0000000000801643 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801643:	55                   	push   %rbp
+  801644:	48 89 e5             	mov    %rsp,%rbp
+  801647:	53                   	push   %rbx
+  801648:	48 83 ec 08          	sub    $0x8,%rsp
+  80164c:	48 89 f1             	mov    %rsi,%rcx
+  80164f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801652:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801655:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165f:	be 00 00 00 00       	mov    $0x0,%esi
+  801664:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166c:	48 85 c0             	test   %rax,%rax
+  80166f:	7f 06                	jg     801677 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801671:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801677:	49 89 c0             	mov    %rax,%r8
+  80167a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80167f:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801686:	00 00 00 
+  801689:	be 26 00 00 00       	mov    $0x26,%esi
+  80168e:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801695:	00 00 00 
+  801698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169d:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8016a4:	00 00 00 
+  8016a7:	41 ff d1             	call   *%r9
+
+00000000008016aa <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+  8016ae:	53                   	push   %rbx
+  8016af:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d1:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+00000000008016d9 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8016d9:	55                   	push   %rbp
+  8016da:	48 89 e5             	mov    %rsp,%rbp
+  8016dd:	53                   	push   %rbx
+  8016de:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8016e5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801702:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801704:	48 85 c0             	test   %rax,%rax
+  801707:	7f 06                	jg     80170f <sys_env_set_tls+0x36>
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80170f:	49 89 c0             	mov    %rax,%r8
+  801712:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801717:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80171e:	00 00 00 
+  801721:	be 26 00 00 00       	mov    $0x26,%esi
+  801726:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80172d:	00 00 00 
+  801730:	b8 00 00 00 00       	mov    $0x0,%eax
+  801735:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  80173c:	00 00 00 
+  80173f:	41 ff d1             	call   *%r9
+
+0000000000801742 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801742:	55                   	push   %rbp
+  801743:	48 89 e5             	mov    %rsp,%rbp
+  801746:	53                   	push   %rbx
+  801747:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80174b:	48 63 ce             	movslq %esi,%rcx
+  80174e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801751:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176d:	48 85 c0             	test   %rax,%rax
+  801770:	7f 06                	jg     801778 <sys_env_set_status+0x36>
+}
+  801772:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801776:	c9                   	leave
+  801777:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801778:	49 89 c0             	mov    %rax,%r8
+  80177b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801780:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801787:	00 00 00 
+  80178a:	be 26 00 00 00       	mov    $0x26,%esi
+  80178f:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801796:	00 00 00 
+  801799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179e:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8017a5:	00 00 00 
+  8017a8:	41 ff d1             	call   *%r9
+
+00000000008017ab <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8017ab:	55                   	push   %rbp
+  8017ac:	48 89 e5             	mov    %rsp,%rbp
+  8017af:	53                   	push   %rbx
+  8017b0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8017b4:	48 63 da             	movslq %edx,%rbx
+  8017b7:	48 63 ce             	movslq %esi,%rcx
+  8017ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d4:	48 85 c0             	test   %rax,%rax
+  8017d7:	7f 06                	jg     8017df <sys_env_set_priority+0x34>
+}
+  8017d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017dd:	c9                   	leave
+  8017de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017df:	49 89 c0             	mov    %rax,%r8
+  8017e2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8017e7:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8017ee:	00 00 00 
+  8017f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8017f6:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8017fd:	00 00 00 
+  801800:	b8 00 00 00 00       	mov    $0x0,%eax
+  801805:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  80180c:	00 00 00 
+  80180f:	41 ff d1             	call   *%r9
+
+0000000000801812 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801812:	55                   	push   %rbp
+  801813:	48 89 e5             	mov    %rsp,%rbp
+  801816:	53                   	push   %rbx
+  801817:	48 83 ec 08          	sub    $0x8,%rsp
+  80181b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80181e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801821:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801826:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801830:	be 00 00 00 00       	mov    $0x0,%esi
+  801835:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80183d:	48 85 c0             	test   %rax,%rax
+  801840:	7f 06                	jg     801848 <sys_env_set_trapframe+0x36>
+}
+  801842:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801846:	c9                   	leave
+  801847:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801848:	49 89 c0             	mov    %rax,%r8
+  80184b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801850:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801857:	00 00 00 
+  80185a:	be 26 00 00 00       	mov    $0x26,%esi
+  80185f:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801866:	00 00 00 
+  801869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186e:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  801875:	00 00 00 
+  801878:	41 ff d1             	call   *%r9
+
+000000000080187b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80187b:	55                   	push   %rbp
+  80187c:	48 89 e5             	mov    %rsp,%rbp
+  80187f:	53                   	push   %rbx
+  801880:	48 83 ec 08          	sub    $0x8,%rsp
+  801884:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801887:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80188a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80188f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801894:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801899:	be 00 00 00 00       	mov    $0x0,%esi
+  80189e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018a6:	48 85 c0             	test   %rax,%rax
+  8018a9:	7f 06                	jg     8018b1 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018af:	c9                   	leave
+  8018b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b1:	49 89 c0             	mov    %rax,%r8
+  8018b4:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8018b9:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8018c0:	00 00 00 
+  8018c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8018c8:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8018cf:	00 00 00 
+  8018d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d7:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8018de:	00 00 00 
+  8018e1:	41 ff d1             	call   *%r9
+
+00000000008018e4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018e4:	55                   	push   %rbp
+  8018e5:	48 89 e5             	mov    %rsp,%rbp
+  8018e8:	53                   	push   %rbx
+  8018e9:	89 f8                	mov    %edi,%eax
+  8018eb:	49 89 f1             	mov    %rsi,%r9
+  8018ee:	48 89 d3             	mov    %rdx,%rbx
+  8018f1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018f4:	49 63 f0             	movslq %r8d,%rsi
+  8018f7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018ff:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801902:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801908:	cd 30                	int    $0x30
+}
+  80190a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+0000000000801910 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	41 55                	push   %r13
+  801916:	41 54                	push   %r12
+  801918:	53                   	push   %rbx
+  801919:	89 f8                	mov    %edi,%eax
+  80191b:	49 89 f2             	mov    %rsi,%r10
+  80191e:	48 89 d3             	mov    %rdx,%rbx
+  801921:	48 89 cf             	mov    %rcx,%rdi
+  801924:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801927:	49 63 f0             	movslq %r8d,%rsi
+  80192a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80192d:	4d 85 c9             	test   %r9,%r9
+  801930:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801937:	00 00 00 
+  80193a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80193e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801943:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80194c:	4d 8b 0b             	mov    (%r11),%r9
+  80194f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801953:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801957:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80195b:	cd 30                	int    $0x30
+}
+  80195d:	5b                   	pop    %rbx
+  80195e:	41 5c                	pop    %r12
+  801960:	41 5d                	pop    %r13
+  801962:	5d                   	pop    %rbp
+  801963:	c3                   	ret
+
+0000000000801964 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801964:	55                   	push   %rbp
+  801965:	48 89 e5             	mov    %rsp,%rbp
+  801968:	53                   	push   %rbx
+  801969:	48 89 fa             	mov    %rdi,%rdx
+  80196c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80196f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801979:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80197e:	be 00 00 00 00       	mov    $0x0,%esi
+  801983:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801989:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  80198b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80198f:	c9                   	leave
+  801990:	c3                   	ret
+
+0000000000801991 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801991:	55                   	push   %rbp
+  801992:	48 89 e5             	mov    %rsp,%rbp
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 08          	sub    $0x8,%rsp
+  80199a:	48 89 fa             	mov    %rdi,%rdx
+  80199d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019af:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019bc:	48 85 c0             	test   %rax,%rax
+  8019bf:	7f 06                	jg     8019c7 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019c7:	49 89 c0             	mov    %rax,%r8
+  8019ca:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8019cf:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8019d6:	00 00 00 
+  8019d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8019de:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8019e5:	00 00 00 
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ed:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  8019f4:	00 00 00 
+  8019f7:	41 ff d1             	call   *%r9
+
+00000000008019fa <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	41 55                	push   %r13
+  801a00:	41 54                	push   %r12
+  801a02:	53                   	push   %rbx
+  801a03:	89 f8                	mov    %edi,%eax
+  801a05:	49 89 f2             	mov    %rsi,%r10
+  801a08:	48 89 d3             	mov    %rdx,%rbx
+  801a0b:	48 89 cf             	mov    %rcx,%rdi
+  801a0e:	44 89 c6             	mov    %r8d,%esi
+  801a11:	4d 89 c8             	mov    %r9,%r8
+  801a14:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a18:	48 63 f6             	movslq %esi,%rsi
+  801a1b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a1e:	4d 85 db             	test   %r11,%r11
+  801a21:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801a28:	00 00 00 
+  801a2b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a2f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a34:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a37:	4d 8b 0b             	mov    (%r11),%r9
+  801a3a:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a3e:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a42:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a46:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a48:	5b                   	pop    %rbx
+  801a49:	41 5c                	pop    %r12
+  801a4b:	41 5d                	pop    %r13
+  801a4d:	5d                   	pop    %rbp
+  801a4e:	c3                   	ret
+
+0000000000801a4f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801a4f:	55                   	push   %rbp
+  801a50:	48 89 e5             	mov    %rsp,%rbp
+  801a53:	41 55                	push   %r13
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	89 f8                	mov    %edi,%eax
+  801a5a:	49 89 f2             	mov    %rsi,%r10
+  801a5d:	48 89 d3             	mov    %rdx,%rbx
+  801a60:	48 89 cf             	mov    %rcx,%rdi
+  801a63:	44 89 c6             	mov    %r8d,%esi
+  801a66:	4d 89 c8             	mov    %r9,%r8
+  801a69:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801a6d:	48 63 f6             	movslq %esi,%rsi
+  801a70:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a73:	4d 85 db             	test   %r11,%r11
+  801a76:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801a7d:	00 00 00 
+  801a80:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a84:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a89:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a8c:	4d 8b 0b             	mov    (%r11),%r9
+  801a8f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a93:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a97:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a9b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a9d:	5b                   	pop    %rbx
+  801a9e:	41 5c                	pop    %r12
+  801aa0:	41 5d                	pop    %r13
+  801aa2:	5d                   	pop    %rbp
+  801aa3:	c3                   	ret
+
+0000000000801aa4 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	53                   	push   %rbx
+  801aa9:	48 83 ec 08          	sub    $0x8,%rsp
+  801aad:	48 89 f1             	mov    %rsi,%rcx
+  801ab0:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ab8:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801abb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801acb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801acd:	48 85 c0             	test   %rax,%rax
+  801ad0:	7f 06                	jg     801ad8 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ad2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ad8:	49 89 c0             	mov    %rax,%r8
+  801adb:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801ae0:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801ae7:	00 00 00 
+  801aea:	be 26 00 00 00       	mov    $0x26,%esi
+  801aef:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801af6:	00 00 00 
+  801af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afe:	49 b9 ea 04 80 00 00 	movabs $0x8004ea,%r9
+  801b05:	00 00 00 
+  801b08:	41 ff d1             	call   *%r9
+
+0000000000801b0b <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801b0b:	55                   	push   %rbp
+  801b0c:	48 89 e5             	mov    %rsp,%rbp
+  801b0f:	53                   	push   %rbx
+  801b10:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b13:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b18:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b22:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b27:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b32:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801b34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b38:	c9                   	leave
+  801b39:	c3                   	ret
+
+0000000000801b3a <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801b3a:	55                   	push   %rbp
+  801b3b:	48 89 e5             	mov    %rsp,%rbp
+  801b3e:	53                   	push   %rbx
+  801b3f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801b42:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b44:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b53:	be 00 00 00 00       	mov    $0x0,%esi
+  801b58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b5e:	cd 30                	int    $0x30
+}
+  801b60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b64:	c9                   	leave
+  801b65:	c3                   	ret
+
+0000000000801b66 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801b66:	55                   	push   %rbp
+  801b67:	48 89 e5             	mov    %rsp,%rbp
+  801b6a:	53                   	push   %rbx
+  801b6b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801b6e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b71:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b80:	be 00 00 00 00       	mov    $0x0,%esi
+  801b85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b8b:	cd 30                	int    $0x30
+}
+  801b8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b91:	c9                   	leave
+  801b92:	c3                   	ret
+
+0000000000801b93 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	53                   	push   %rbx
+  801b98:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b9b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b9d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ba2:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801baa:	be 00 00 00 00       	mov    $0x0,%esi
+  801baf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb5:	cd 30                	int    $0x30
+}
+  801bb7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+
+0000000000801bbd <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801bc5:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bc8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801bdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be2:	cd 30                	int    $0x30
+}
+  801be4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+
+0000000000801bea <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801bea:	55                   	push   %rbp
+  801beb:	48 89 e5             	mov    %rsp,%rbp
+  801bee:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bef:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c03:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c08:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c13:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+0000000000801c1b <sys_monitor>:
+
+int sys_monitor(void) {
+  801c1b:	55                   	push   %rbp
+  801c1c:	48 89 e5             	mov    %rsp,%rbp
+  801c1f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c20:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c34:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c39:	be 00 00 00 00       	mov    $0x0,%esi
+  801c3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c44:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c4a:	c9                   	leave
+  801c4b:	c3                   	ret
+
+0000000000801c4c <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801c4c:	55                   	push   %rbp
+  801c4d:	48 89 e5             	mov    %rsp,%rbp
+  801c50:	41 55                	push   %r13
+  801c52:	41 54                	push   %r12
+  801c54:	53                   	push   %rbx
+  801c55:	48 83 ec 08          	sub    $0x8,%rsp
+  801c59:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801c5c:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801c5f:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  801c66:	00 00 00 
+  801c69:	ff d0                	call   *%rax
+  801c6b:	41 89 c5             	mov    %eax,%r13d
+  801c6e:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801c72:	a8 40                	test   $0x40,%al
+  801c74:	75 31                	jne    801ca7 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801c76:	a8 02                	test   $0x2,%al
+  801c78:	74 5f                	je     801cd9 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c7a:	45 89 e9             	mov    %r13d,%r9d
+  801c7d:	41 83 c9 40          	or     $0x40,%r9d
+  801c81:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c87:	48 89 d9             	mov    %rbx,%rcx
+  801c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8f:	48 89 de             	mov    %rbx,%rsi
+  801c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c97:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 27                	js     801cce <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801ca7:	45 89 e9             	mov    %r13d,%r9d
+  801caa:	41 83 c9 40          	or     $0x40,%r9d
+  801cae:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cb4:	48 89 d9             	mov    %rbx,%rcx
+  801cb7:	44 89 e2             	mov    %r12d,%edx
+  801cba:	48 89 de             	mov    %rbx,%rsi
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc2:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  801cc9:	00 00 00 
+  801ccc:	ff d0                	call   *%rax
+}
+  801cce:	48 83 c4 08          	add    $0x8,%rsp
+  801cd2:	5b                   	pop    %rbx
+  801cd3:	41 5c                	pop    %r12
+  801cd5:	41 5d                	pop    %r13
+  801cd7:	5d                   	pop    %rbp
+  801cd8:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801cd9:	83 e0 01             	and    $0x1,%eax
+  801cdc:	83 c8 06             	or     $0x6,%eax
+  801cdf:	41 89 c1             	mov    %eax,%r9d
+  801ce2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ce8:	48 89 d9             	mov    %rbx,%rcx
+  801ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf0:	48 89 de             	mov    %rbx,%rsi
+  801cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf8:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  801cff:	00 00 00 
+  801d02:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	0f 85 6e ff ff ff    	jne    801c7a <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801d0c:	48 89 df             	mov    %rbx,%rdi
+  801d0f:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	83 e0 5f             	and    $0x5f,%eax
+  801d1e:	41 89 c5             	mov    %eax,%r13d
+  801d21:	e9 54 ff ff ff       	jmp    801c7a <sfork_page+0x2e>
+
+0000000000801d26 <fork>:
+fork(void) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	41 54                	push   %r12
+  801d2c:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801d2d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d32:	cd 30                	int    $0x30
+  801d34:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	0f 88 81 00 00 00    	js     801dc0 <fork+0x9a>
+    if (envid == CURENVID) {
+  801d3f:	0f 84 83 00 00 00    	je     801dc8 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801d45:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d4b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801d52:	00 00 00 
+  801d55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d5a:	89 c2                	mov    %eax,%edx
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d66:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  801d6d:	00 00 00 
+  801d70:	ff d0                	call   *%rax
+  801d72:	85 c0                	test   %eax,%eax
+  801d74:	0f 85 82 00 00 00    	jne    801dfc <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801d7a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d81:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801d83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d87:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d8e:	44 89 e7             	mov    %r12d,%edi
+  801d91:	48 b8 7b 18 80 00 00 	movabs $0x80187b,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	75 63                	jne    801e04 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801da1:	be 02 00 00 00       	mov    $0x2,%esi
+  801da6:	44 89 e7             	mov    %r12d,%edi
+  801da9:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+        return -1;
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801dbc:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801dc0:	44 89 e0             	mov    %r12d,%eax
+  801dc3:	5b                   	pop    %rbx
+  801dc4:	41 5c                	pop    %r12
+  801dc6:	5d                   	pop    %rbp
+  801dc7:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801dc8:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  801dcf:	00 00 00 
+  801dd2:	ff d0                	call   *%rax
+  801dd4:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801ddb:	00 00 
+  801ddd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801de2:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801de9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801df0:	00 00 00 
+  801df3:	48 01 c8             	add    %rcx,%rax
+  801df6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801dfa:	eb c4                	jmp    801dc0 <fork+0x9a>
+        return -1;
+  801dfc:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e02:	eb bc                	jmp    801dc0 <fork+0x9a>
+  801e04:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e0a:	eb b4                	jmp    801dc0 <fork+0x9a>
+
+0000000000801e0c <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801e0c:	55                   	push   %rbp
+  801e0d:	48 89 e5             	mov    %rsp,%rbp
+  801e10:	53                   	push   %rbx
+  801e11:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801e15:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e1a:	cd 30                	int    $0x30
+  801e1c:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801e1e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 40                	js     801e65 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801e25:	74 46                	je     801e6d <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801e27:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801e2b:	48 ba 4c 1c 80 00 00 	movabs $0x801c4c,%rdx
+  801e32:	00 00 00 
+  801e35:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e3c:	00 00 00 
+  801e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e44:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+  801e50:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	79 4b                	jns    801ea1 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801e56:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e59:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  801e60:	00 00 00 
+  801e63:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801e65:	89 d8                	mov    %ebx,%eax
+  801e67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e6b:	c9                   	leave
+  801e6c:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e6d:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801e79:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801e80:	00 00 
+  801e82:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e87:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e8e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e95:	00 00 00 
+  801e98:	48 01 c8             	add    %rcx,%rax
+  801e9b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e9f:	eb c4                	jmp    801e65 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801ea1:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ea7:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801ead:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801eb4:	00 00 00 
+  801eb7:	48 89 f1             	mov    %rsi,%rcx
+  801eba:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801ebd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec2:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+  801ece:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 82                	js     801e56 <sfork+0x4a>
+  801ed4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801edb:	00 00 
+  801edd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ee1:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801ee8:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801eeb:	48 b8 7b 18 80 00 00 	movabs $0x80187b,%rax
+  801ef2:	00 00 00 
+  801ef5:	ff d0                	call   *%rax
+  801ef7:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	0f 88 55 ff ff ff    	js     801e56 <sfork+0x4a>
+  801f01:	be 02 00 00 00       	mov    $0x2,%esi
+  801f06:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801f09:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  801f10:	00 00 00 
+  801f13:	ff d0                	call   *%rax
+  801f15:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	0f 88 37 ff ff ff    	js     801e56 <sfork+0x4a>
+    return envid;
+  801f1f:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801f22:	e9 3e ff ff ff       	jmp    801e65 <sfork+0x59>
+
+0000000000801f27 <mutex_lock>:
+    MUTEX_CONTENDED, /* Locked, somebody might wait */
+};
+
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t expected, uint32_t desired) {
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f31:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+}
+
+void
+mutex_lock(struct Mutex *m) {
+    uint32_t state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED);
+    if (state == MUTEX_UNLOCKED) return;
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	74 5a                	je     801f93 <mutex_lock+0x6c>
+mutex_lock(struct Mutex *m) {
+  801f39:	55                   	push   %rbp
+  801f3a:	48 89 e5             	mov    %rsp,%rbp
+  801f3d:	41 54                	push   %r12
+  801f3f:	53                   	push   %rbx
+  801f40:	48 89 fb             	mov    %rdi,%rbx
+  801f43:	89 c2                	mov    %eax,%edx
+    /* Mark it contended before sleeping so that the owner wakes us,
+     * and keep it contended when taking it as others may still wait */
+    do {
+        if (state == MUTEX_CONTENDED ||
+            cmpxchg(&m->m_state, MUTEX_LOCKED, MUTEX_CONTENDED) != MUTEX_UNLOCKED)
+            sys_futex_wait(&m->m_state, MUTEX_CONTENDED, 0);
+  801f45:	49 bc 93 1b 80 00 00 	movabs $0x801b93,%r12
+  801f4c:	00 00 00 
+  801f4f:	eb 24                	jmp    801f75 <mutex_lock+0x4e>
+  801f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f56:	be 02 00 00 00       	mov    $0x2,%esi
+  801f5b:	48 89 df             	mov    %rbx,%rdi
+  801f5e:	41 ff d4             	call   *%r12
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f66:	ba 02 00 00 00       	mov    $0x2,%edx
+  801f6b:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+  801f6f:	89 c2                	mov    %eax,%edx
+    } while ((state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_CONTENDED)) != MUTEX_UNLOCKED);
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	74 19                	je     801f8e <mutex_lock+0x67>
+        if (state == MUTEX_CONTENDED ||
+  801f75:	83 fa 02             	cmp    $0x2,%edx
+  801f78:	74 d7                	je     801f51 <mutex_lock+0x2a>
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801f7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f7f:	ba 02 00 00 00       	mov    $0x2,%edx
+  801f84:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+        if (state == MUTEX_CONTENDED ||
+  801f88:	85 c0                	test   %eax,%eax
+  801f8a:	74 d5                	je     801f61 <mutex_lock+0x3a>
+  801f8c:	eb c3                	jmp    801f51 <mutex_lock+0x2a>
+}
+  801f8e:	5b                   	pop    %rbx
+  801f8f:	41 5c                	pop    %r12
+  801f91:	5d                   	pop    %rbp
+  801f92:	c3                   	ret
+  801f93:	c3                   	ret
+
+0000000000801f94 <mutex_trylock>:
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f99:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f9e:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+
+bool
+mutex_trylock(struct Mutex *m) {
+    return cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED) == MUTEX_UNLOCKED;
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	0f 94 c0             	sete   %al
+}
+  801fa7:	c3                   	ret
+
+0000000000801fa8 <mutex_unlock>:
+
+void
+mutex_unlock(struct Mutex *m) {
+    if (__atomic_exchange_n(&m->m_state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+  801fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fad:	87 07                	xchg   %eax,(%rdi)
+  801faf:	83 f8 02             	cmp    $0x2,%eax
+  801fb2:	74 01                	je     801fb5 <mutex_unlock+0xd>
+  801fb4:	c3                   	ret
+mutex_unlock(struct Mutex *m) {
+  801fb5:	55                   	push   %rbp
+  801fb6:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(&m->m_state, 1);
+  801fb9:	be 01 00 00 00       	mov    $0x1,%esi
+  801fbe:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+}
+  801fca:	5d                   	pop    %rbp
+  801fcb:	c3                   	ret
+
+0000000000801fcc <cond_wait>:
+
+/* Release 'm', wait until cond_signal() or cond_broadcast()
+ * and lock 'm' again.  Wakeups may be spurious */
+void
+cond_wait(struct Cond *c, struct Mutex *m) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	41 55                	push   %r13
+  801fd2:	41 54                	push   %r12
+  801fd4:	53                   	push   %rbx
+  801fd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd9:	49 89 fc             	mov    %rdi,%r12
+  801fdc:	48 89 f3             	mov    %rsi,%rbx
+    uint32_t seq = __atomic_load_n(&c->c_seq, __ATOMIC_RELAXED);
+  801fdf:	44 8b 2f             	mov    (%rdi),%r13d
+
+    mutex_unlock(m);
+  801fe2:	48 89 f7             	mov    %rsi,%rdi
+  801fe5:	48 b8 a8 1f 80 00 00 	movabs $0x801fa8,%rax
+  801fec:	00 00 00 
+  801fef:	ff d0                	call   *%rax
+    sys_futex_wait(&c->c_seq, seq, 0);
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	44 89 ee             	mov    %r13d,%esi
+  801ff9:	4c 89 e7             	mov    %r12,%rdi
+  801ffc:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  802003:	00 00 00 
+  802006:	ff d0                	call   *%rax
+    mutex_lock(m);
+  802008:	48 89 df             	mov    %rbx,%rdi
+  80200b:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802012:	00 00 00 
+  802015:	ff d0                	call   *%rax
+}
+  802017:	48 83 c4 08          	add    $0x8,%rsp
+  80201b:	5b                   	pop    %rbx
+  80201c:	41 5c                	pop    %r12
+  80201e:	41 5d                	pop    %r13
+  802020:	5d                   	pop    %rbp
+  802021:	c3                   	ret
+
+0000000000802022 <cond_signal>:
+
+void
+cond_signal(struct Cond *c) {
+  802022:	55                   	push   %rbp
+  802023:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  802026:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, 1);
+  80202a:	be 01 00 00 00       	mov    $0x1,%esi
+  80202f:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+}
+  80203b:	5d                   	pop    %rbp
+  80203c:	c3                   	ret
+
+000000000080203d <cond_broadcast>:
+
+void
+cond_broadcast(struct Cond *c) {
+  80203d:	55                   	push   %rbp
+  80203e:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  802041:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, NENV);
+  802045:	be 00 04 00 00       	mov    $0x400,%esi
+  80204a:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+}
+  802056:	5d                   	pop    %rbp
+  802057:	c3                   	ret
+
+0000000000802058 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802058:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80205f:	ff ff ff 
+  802062:	48 01 f8             	add    %rdi,%rax
+  802065:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802069:	c3                   	ret
+
+000000000080206a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80206a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802071:	ff ff ff 
+  802074:	48 01 f8             	add    %rdi,%rax
+  802077:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80207b:	48 c1 e0 12          	shl    $0x12,%rax
+  80207f:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802084:	48 01 d0             	add    %rdx,%rax
+}
+  802087:	c3                   	ret
+
+0000000000802088 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	41 57                	push   %r15
+  80208e:	41 56                	push   %r14
+  802090:	41 55                	push   %r13
+  802092:	41 54                	push   %r12
+  802094:	53                   	push   %rbx
+  802095:	48 83 ec 08          	sub    $0x8,%rsp
+  802099:	49 89 ff             	mov    %rdi,%r15
+  80209c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8020a1:	49 bd 39 3e 80 00 00 	movabs $0x803e39,%r13
+  8020a8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8020ab:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8020b1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8020b4:	48 89 df             	mov    %rbx,%rdi
+  8020b7:	41 ff d5             	call   *%r13
+  8020ba:	83 e0 04             	and    $0x4,%eax
+  8020bd:	74 17                	je     8020d6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8020bf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8020c6:	4c 39 f3             	cmp    %r14,%rbx
+  8020c9:	75 e6                	jne    8020b1 <fd_alloc+0x29>
+  8020cb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8020d1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8020d6:	4d 89 27             	mov    %r12,(%r15)
+}
+  8020d9:	48 83 c4 08          	add    $0x8,%rsp
+  8020dd:	5b                   	pop    %rbx
+  8020de:	41 5c                	pop    %r12
+  8020e0:	41 5d                	pop    %r13
+  8020e2:	41 5e                	pop    %r14
+  8020e4:	41 5f                	pop    %r15
+  8020e6:	5d                   	pop    %rbp
+  8020e7:	c3                   	ret
+
+00000000008020e8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8020e8:	83 ff 1f             	cmp    $0x1f,%edi
+  8020eb:	77 39                	ja     802126 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8020ed:	55                   	push   %rbp
+  8020ee:	48 89 e5             	mov    %rsp,%rbp
+  8020f1:	41 54                	push   %r12
+  8020f3:	53                   	push   %rbx
+  8020f4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8020f7:	48 63 df             	movslq %edi,%rbx
+  8020fa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802101:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802105:	48 89 df             	mov    %rbx,%rdi
+  802108:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	a8 04                	test   $0x4,%al
+  802116:	74 14                	je     80212c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802118:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80211c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802121:	5b                   	pop    %rbx
+  802122:	41 5c                	pop    %r12
+  802124:	5d                   	pop    %rbp
+  802125:	c3                   	ret
+        return -E_INVAL;
+  802126:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80212b:	c3                   	ret
+        return -E_INVAL;
+  80212c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802131:	eb ee                	jmp    802121 <fd_lookup+0x39>
+
+0000000000802133 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	41 54                	push   %r12
+  802139:	53                   	push   %rbx
+  80213a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80213d:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  802144:	00 00 00 
+  802147:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80214e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802151:	39 3b                	cmp    %edi,(%rbx)
+  802153:	74 4a                	je     80219f <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  802155:	48 83 c0 08          	add    $0x8,%rax
+  802159:	48 8b 18             	mov    (%rax),%rbx
+  80215c:	48 85 db             	test   %rbx,%rbx
+  80215f:	75 f0                	jne    802151 <dev_lookup+0x1e>
+  802161:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802168:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80216a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80216e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802174:	89 fa                	mov    %edi,%edx
+  802176:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  80217d:	00 00 00 
+  802180:	b8 00 00 00 00       	mov    $0x0,%eax
+  802185:	48 b9 3a 06 80 00 00 	movabs $0x80063a,%rcx
+  80218c:	00 00 00 
+  80218f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802191:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802196:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80219a:	5b                   	pop    %rbx
+  80219b:	41 5c                	pop    %r12
+  80219d:	5d                   	pop    %rbp
+  80219e:	c3                   	ret
+            return 0;
+  80219f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a4:	eb f0                	jmp    802196 <dev_lookup+0x63>
+
+00000000008021a6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	41 55                	push   %r13
+  8021ac:	41 54                	push   %r12
+  8021ae:	53                   	push   %rbx
+  8021af:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b3:	48 89 fb             	mov    %rdi,%rbx
+  8021b6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021b9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8021c0:	ff ff ff 
+  8021c3:	48 01 df             	add    %rbx,%rdi
+  8021c6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8021ca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021ce:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+  8021da:	41 89 c5             	mov    %eax,%r13d
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	78 06                	js     8021e7 <fd_close+0x41>
+  8021e1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8021e5:	74 1a                	je     802201 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8021e7:	45 84 e4             	test   %r12b,%r12b
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8021f3:	44 89 e8             	mov    %r13d,%eax
+  8021f6:	48 83 c4 18          	add    $0x18,%rsp
+  8021fa:	5b                   	pop    %rbx
+  8021fb:	41 5c                	pop    %r12
+  8021fd:	41 5d                	pop    %r13
+  8021ff:	5d                   	pop    %rbp
+  802200:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802201:	8b 3b                	mov    (%rbx),%edi
+  802203:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802207:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80220e:	00 00 00 
+  802211:	ff d0                	call   *%rax
+  802213:	41 89 c5             	mov    %eax,%r13d
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 1b                	js     802235 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80221a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80221e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802222:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802228:	48 85 c0             	test   %rax,%rax
+  80222b:	74 08                	je     802235 <fd_close+0x8f>
+  80222d:	48 89 df             	mov    %rbx,%rdi
+  802230:	ff d0                	call   *%rax
+  802232:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802235:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80223a:	48 89 de             	mov    %rbx,%rsi
+  80223d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802242:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  802249:	00 00 00 
+  80224c:	ff d0                	call   *%rax
+    return res;
+  80224e:	eb a3                	jmp    8021f3 <fd_close+0x4d>
+
+0000000000802250 <close>:
+
+int
+close(int fdnum) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802258:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80225c:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802263:	00 00 00 
+  802266:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	78 15                	js     802281 <close+0x31>
+
+    return fd_close(fd, 1);
+  80226c:	be 01 00 00 00       	mov    $0x1,%esi
+  802271:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802275:	48 b8 a6 21 80 00 00 	movabs $0x8021a6,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+}
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+
+0000000000802283 <close_all>:
+
+void
+close_all(void) {
+  802283:	55                   	push   %rbp
+  802284:	48 89 e5             	mov    %rsp,%rbp
+  802287:	41 54                	push   %r12
+  802289:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80228a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80228f:	49 bc 50 22 80 00 00 	movabs $0x802250,%r12
+  802296:	00 00 00 
+  802299:	89 df                	mov    %ebx,%edi
+  80229b:	41 ff d4             	call   *%r12
+  80229e:	83 c3 01             	add    $0x1,%ebx
+  8022a1:	83 fb 20             	cmp    $0x20,%ebx
+  8022a4:	75 f3                	jne    802299 <close_all+0x16>
+}
+  8022a6:	5b                   	pop    %rbx
+  8022a7:	41 5c                	pop    %r12
+  8022a9:	5d                   	pop    %rbp
+  8022aa:	c3                   	ret
+
+00000000008022ab <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	41 57                	push   %r15
+  8022b1:	41 56                	push   %r14
+  8022b3:	41 55                	push   %r13
+  8022b5:	41 54                	push   %r12
+  8022b7:	53                   	push   %rbx
+  8022b8:	48 83 ec 38          	sub    $0x38,%rsp
+  8022bc:	41 89 f7             	mov    %esi,%r15d
+  8022bf:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8022c2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8022c6:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+  8022d2:	89 c3                	mov    %eax,%ebx
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	0f 88 ec 00 00 00    	js     8023c8 <dup+0x11d>
+    close(newfdnum);
+  8022dc:	44 89 ff             	mov    %r15d,%edi
+  8022df:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8022eb:	49 63 c7             	movslq %r15d,%rax
+  8022ee:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8022f4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022f8:	49 89 c6             	mov    %rax,%r14
+  8022fb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8022ff:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802303:	4c 89 ff             	mov    %r15,%rdi
+  802306:	48 bb 6a 20 80 00 00 	movabs $0x80206a,%rbx
+  80230d:	00 00 00 
+  802310:	ff d3                	call   *%rbx
+  802312:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802315:	4c 89 f7             	mov    %r14,%rdi
+  802318:	ff d3                	call   *%rbx
+  80231a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80231e:	4c 89 e7             	mov    %r12,%rdi
+  802321:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802330:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802335:	49 be 39 3e 80 00 00 	movabs $0x803e39,%r14
+  80233c:	00 00 00 
+  80233f:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802343:	41 ff d6             	call   *%r14
+  802346:	44 39 e8             	cmp    %r13d,%eax
+  802349:	75 10                	jne    80235b <dup+0xb0>
+  80234b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802352:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802359:	75 e4                	jne    80233f <dup+0x94>
+    if (prot & PROT_R) {
+  80235b:	41 f6 c5 04          	test   $0x4,%r13b
+  80235f:	74 29                	je     80238a <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802361:	45 89 e9             	mov    %r13d,%r9d
+  802364:	49 89 d8             	mov    %rbx,%r8
+  802367:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80236b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802370:	4c 89 e6             	mov    %r12,%rsi
+  802373:	bf 00 00 00 00       	mov    $0x0,%edi
+  802378:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+  802384:	89 c3                	mov    %eax,%ebx
+  802386:	85 c0                	test   %eax,%eax
+  802388:	78 4f                	js     8023d9 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  80238a:	4c 89 ff             	mov    %r15,%rdi
+  80238d:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+  802399:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80239c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023a2:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8023a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ab:	4c 89 fe             	mov    %r15,%rsi
+  8023ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b3:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+  8023bf:	89 c3                	mov    %eax,%ebx
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 14                	js     8023d9 <dup+0x12e>
+
+    return newfdnum;
+  8023c5:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8023c8:	89 d8                	mov    %ebx,%eax
+  8023ca:	48 83 c4 38          	add    $0x38,%rsp
+  8023ce:	5b                   	pop    %rbx
+  8023cf:	41 5c                	pop    %r12
+  8023d1:	41 5d                	pop    %r13
+  8023d3:	41 5e                	pop    %r14
+  8023d5:	41 5f                	pop    %r15
+  8023d7:	5d                   	pop    %rbp
+  8023d8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8023d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023de:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8023e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e7:	49 bc 43 16 80 00 00 	movabs $0x801643,%r12
+  8023ee:	00 00 00 
+  8023f1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8023f4:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8023f9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8023fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802402:	41 ff d4             	call   *%r12
+    return res;
+  802405:	eb c1                	jmp    8023c8 <dup+0x11d>
+
+0000000000802407 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	41 56                	push   %r14
+  80240d:	41 55                	push   %r13
+  80240f:	41 54                	push   %r12
+  802411:	53                   	push   %rbx
+  802412:	48 83 ec 10          	sub    $0x10,%rsp
+  802416:	89 fb                	mov    %edi,%ebx
+  802418:	49 89 f4             	mov    %rsi,%r12
+  80241b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80241e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802422:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 4c                	js     80247e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802432:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802436:	41 8b 3e             	mov    (%r14),%edi
+  802439:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80243d:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 35                	js     802482 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80244d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802451:	83 e0 03             	and    $0x3,%eax
+  802454:	83 f8 01             	cmp    $0x1,%eax
+  802457:	74 2d                	je     802486 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802459:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80245d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802461:	48 85 c0             	test   %rax,%rax
+  802464:	74 59                	je     8024bf <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802466:	4c 89 ea             	mov    %r13,%rdx
+  802469:	4c 89 e6             	mov    %r12,%rsi
+  80246c:	4c 89 f7             	mov    %r14,%rdi
+  80246f:	ff d0                	call   *%rax
+}
+  802471:	48 83 c4 10          	add    $0x10,%rsp
+  802475:	5b                   	pop    %rbx
+  802476:	41 5c                	pop    %r12
+  802478:	41 5d                	pop    %r13
+  80247a:	41 5e                	pop    %r14
+  80247c:	5d                   	pop    %rbp
+  80247d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80247e:	48 98                	cltq
+  802480:	eb ef                	jmp    802471 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802482:	48 98                	cltq
+  802484:	eb eb                	jmp    802471 <read+0x6a>
+  802486:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80248d:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80248f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802493:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802499:	89 da                	mov    %ebx,%edx
+  80249b:	48 bf 01 57 80 00 00 	movabs $0x805701,%rdi
+  8024a2:	00 00 00 
+  8024a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024aa:	48 b9 3a 06 80 00 00 	movabs $0x80063a,%rcx
+  8024b1:	00 00 00 
+  8024b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024b6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024bd:	eb b2                	jmp    802471 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024bf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8024c6:	eb a9                	jmp    802471 <read+0x6a>
+
+00000000008024c8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	41 57                	push   %r15
+  8024ce:	41 56                	push   %r14
+  8024d0:	41 55                	push   %r13
+  8024d2:	41 54                	push   %r12
+  8024d4:	53                   	push   %rbx
+  8024d5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8024d9:	48 85 d2             	test   %rdx,%rdx
+  8024dc:	74 54                	je     802532 <readn+0x6a>
+  8024de:	41 89 fd             	mov    %edi,%r13d
+  8024e1:	49 89 f6             	mov    %rsi,%r14
+  8024e4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8024e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8024ec:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8024f1:	49 bf 07 24 80 00 00 	movabs $0x802407,%r15
+  8024f8:	00 00 00 
+  8024fb:	4c 89 e2             	mov    %r12,%rdx
+  8024fe:	48 29 f2             	sub    %rsi,%rdx
+  802501:	4c 01 f6             	add    %r14,%rsi
+  802504:	44 89 ef             	mov    %r13d,%edi
+  802507:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80250a:	85 c0                	test   %eax,%eax
+  80250c:	78 20                	js     80252e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80250e:	01 c3                	add    %eax,%ebx
+  802510:	85 c0                	test   %eax,%eax
+  802512:	74 08                	je     80251c <readn+0x54>
+  802514:	48 63 f3             	movslq %ebx,%rsi
+  802517:	4c 39 e6             	cmp    %r12,%rsi
+  80251a:	72 df                	jb     8024fb <readn+0x33>
+    }
+    return res;
+  80251c:	48 63 c3             	movslq %ebx,%rax
+}
+  80251f:	48 83 c4 08          	add    $0x8,%rsp
+  802523:	5b                   	pop    %rbx
+  802524:	41 5c                	pop    %r12
+  802526:	41 5d                	pop    %r13
+  802528:	41 5e                	pop    %r14
+  80252a:	41 5f                	pop    %r15
+  80252c:	5d                   	pop    %rbp
+  80252d:	c3                   	ret
+        if (inc < 0) return inc;
+  80252e:	48 98                	cltq
+  802530:	eb ed                	jmp    80251f <readn+0x57>
+    int inc = 1, res = 0;
+  802532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802537:	eb e3                	jmp    80251c <readn+0x54>
+
+0000000000802539 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	41 56                	push   %r14
+  80253f:	41 55                	push   %r13
+  802541:	41 54                	push   %r12
+  802543:	53                   	push   %rbx
+  802544:	48 83 ec 10          	sub    $0x10,%rsp
+  802548:	89 fb                	mov    %edi,%ebx
+  80254a:	49 89 f4             	mov    %rsi,%r12
+  80254d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802550:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802554:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+  802560:	85 c0                	test   %eax,%eax
+  802562:	78 47                	js     8025ab <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802564:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802568:	41 8b 3e             	mov    (%r14),%edi
+  80256b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80256f:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  802576:	00 00 00 
+  802579:	ff d0                	call   *%rax
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 30                	js     8025af <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80257f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802584:	74 2d                	je     8025b3 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802586:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80258a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80258e:	48 85 c0             	test   %rax,%rax
+  802591:	74 59                	je     8025ec <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802593:	4c 89 ea             	mov    %r13,%rdx
+  802596:	4c 89 e6             	mov    %r12,%rsi
+  802599:	4c 89 f7             	mov    %r14,%rdi
+  80259c:	ff d0                	call   *%rax
+}
+  80259e:	48 83 c4 10          	add    $0x10,%rsp
+  8025a2:	5b                   	pop    %rbx
+  8025a3:	41 5c                	pop    %r12
+  8025a5:	41 5d                	pop    %r13
+  8025a7:	41 5e                	pop    %r14
+  8025a9:	5d                   	pop    %rbp
+  8025aa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025ab:	48 98                	cltq
+  8025ad:	eb ef                	jmp    80259e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025af:	48 98                	cltq
+  8025b1:	eb eb                	jmp    80259e <write+0x65>
+  8025b3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8025ba:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025c0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025c6:	89 da                	mov    %ebx,%edx
+  8025c8:	48 bf 1d 57 80 00 00 	movabs $0x80571d,%rdi
+  8025cf:	00 00 00 
+  8025d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d7:	48 b9 3a 06 80 00 00 	movabs $0x80063a,%rcx
+  8025de:	00 00 00 
+  8025e1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025ea:	eb b2                	jmp    80259e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025ec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025f3:	eb a9                	jmp    80259e <write+0x65>
+
+00000000008025f5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8025f5:	55                   	push   %rbp
+  8025f6:	48 89 e5             	mov    %rsp,%rbp
+  8025f9:	53                   	push   %rbx
+  8025fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8025fe:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802600:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802604:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  80260b:	00 00 00 
+  80260e:	ff d0                	call   *%rax
+  802610:	85 c0                	test   %eax,%eax
+  802612:	78 0c                	js     802620 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802614:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802618:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80261b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802624:	c9                   	leave
+  802625:	c3                   	ret
+
+0000000000802626 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+  80262a:	41 55                	push   %r13
+  80262c:	41 54                	push   %r12
+  80262e:	53                   	push   %rbx
+  80262f:	48 83 ec 18          	sub    $0x18,%rsp
+  802633:	89 fb                	mov    %edi,%ebx
+  802635:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802638:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80263c:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802643:	00 00 00 
+  802646:	ff d0                	call   *%rax
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	78 38                	js     802684 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80264c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802650:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802654:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802658:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 1c                	js     802684 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802668:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80266d:	74 20                	je     80268f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80266f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802673:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802677:	48 85 c0             	test   %rax,%rax
+  80267a:	74 4a                	je     8026c6 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80267c:	44 89 e6             	mov    %r12d,%esi
+  80267f:	4c 89 ef             	mov    %r13,%rdi
+  802682:	ff d0                	call   *%rax
+}
+  802684:	48 83 c4 18          	add    $0x18,%rsp
+  802688:	5b                   	pop    %rbx
+  802689:	41 5c                	pop    %r12
+  80268b:	41 5d                	pop    %r13
+  80268d:	5d                   	pop    %rbp
+  80268e:	c3                   	ret
+  80268f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802696:	00 00 
+                thisenv->env_id, fdnum);
+  802698:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80269c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026a2:	89 da                	mov    %ebx,%edx
+  8026a4:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  8026ab:	00 00 00 
+  8026ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b3:	48 b9 3a 06 80 00 00 	movabs $0x80063a,%rcx
+  8026ba:	00 00 00 
+  8026bd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c4:	eb be                	jmp    802684 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026c6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026cb:	eb b7                	jmp    802684 <ftruncate+0x5e>
+
+00000000008026cd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8026cd:	55                   	push   %rbp
+  8026ce:	48 89 e5             	mov    %rsp,%rbp
+  8026d1:	41 54                	push   %r12
+  8026d3:	53                   	push   %rbx
+  8026d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026df:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	78 4e                	js     80273d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026ef:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8026f3:	41 8b 3c 24          	mov    (%r12),%edi
+  8026f7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8026fb:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  802702:	00 00 00 
+  802705:	ff d0                	call   *%rax
+  802707:	85 c0                	test   %eax,%eax
+  802709:	78 32                	js     80273d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80270b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80270f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802714:	74 30                	je     802746 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802716:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802719:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802720:	00 00 00 
+    stat->st_isdir = 0;
+  802723:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80272a:	00 00 00 
+    stat->st_dev = dev;
+  80272d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802734:	48 89 de             	mov    %rbx,%rsi
+  802737:	4c 89 e7             	mov    %r12,%rdi
+  80273a:	ff 50 28             	call   *0x28(%rax)
+}
+  80273d:	48 83 c4 10          	add    $0x10,%rsp
+  802741:	5b                   	pop    %rbx
+  802742:	41 5c                	pop    %r12
+  802744:	5d                   	pop    %rbp
+  802745:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802746:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80274b:	eb f0                	jmp    80273d <fstat+0x70>
+
+000000000080274d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80274d:	55                   	push   %rbp
+  80274e:	48 89 e5             	mov    %rsp,%rbp
+  802751:	41 54                	push   %r12
+  802753:	53                   	push   %rbx
+  802754:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802757:	be 00 00 00 00       	mov    $0x0,%esi
+  80275c:	48 b8 50 2d 80 00 00 	movabs $0x802d50,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+  802768:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	78 25                	js     802793 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80276e:	4c 89 e6             	mov    %r12,%rsi
+  802771:	89 c7                	mov    %eax,%edi
+  802773:	48 b8 cd 26 80 00 00 	movabs $0x8026cd,%rax
+  80277a:	00 00 00 
+  80277d:	ff d0                	call   *%rax
+  80277f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802782:	89 df                	mov    %ebx,%edi
+  802784:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+
+    return res;
+  802790:	44 89 e3             	mov    %r12d,%ebx
+}
+  802793:	89 d8                	mov    %ebx,%eax
+  802795:	5b                   	pop    %rbx
+  802796:	41 5c                	pop    %r12
+  802798:	5d                   	pop    %rbp
+  802799:	c3                   	ret
+
+000000000080279a <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80279a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8027a1:	00 00 00 
+  8027a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a9:	eb 0e                	jmp    8027b9 <mmap_lookup+0x1f>
+  8027ab:	48 83 c2 01          	add    $0x1,%rdx
+  8027af:	48 83 c0 20          	add    $0x20,%rax
+  8027b3:	48 83 fa 40          	cmp    $0x40,%rdx
+  8027b7:	74 2b                	je     8027e4 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8027b9:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8027bd:	48 85 c9             	test   %rcx,%rcx
+  8027c0:	74 e9                	je     8027ab <mmap_lookup+0x11>
+  8027c2:	48 8b 30             	mov    (%rax),%rsi
+  8027c5:	48 39 f7             	cmp    %rsi,%rdi
+  8027c8:	72 e1                	jb     8027ab <mmap_lookup+0x11>
+  8027ca:	48 01 f1             	add    %rsi,%rcx
+  8027cd:	48 39 cf             	cmp    %rcx,%rdi
+  8027d0:	73 d9                	jae    8027ab <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8027d2:	48 c1 e2 05          	shl    $0x5,%rdx
+  8027d6:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8027dd:	00 00 00 
+  8027e0:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8027e3:	c3                   	ret
+    return NULL;
+  8027e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e9:	c3                   	ret
+
+00000000008027ea <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8027ea:	55                   	push   %rbp
+  8027eb:	48 89 e5             	mov    %rsp,%rbp
+  8027ee:	41 54                	push   %r12
+  8027f0:	53                   	push   %rbx
+  8027f1:	89 fb                	mov    %edi,%ebx
+  8027f3:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027f6:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8027fd:	00 00 00 
+  802800:	83 38 00             	cmpl   $0x0,(%rax)
+  802803:	74 3d                	je     802842 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802805:	41 54                	push   %r12
+  802807:	6a 00                	push   $0x0
+  802809:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80280f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802815:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80281a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281f:	89 de                	mov    %ebx,%esi
+  802821:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802828:	00 00 00 
+  80282b:	8b 38                	mov    (%rax),%edi
+  80282d:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+}
+  802839:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80283d:	5b                   	pop    %rbx
+  80283e:	41 5c                	pop    %r12
+  802840:	5d                   	pop    %rbp
+  802841:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802842:	bf 03 00 00 00       	mov    $0x3,%edi
+  802847:	48 b8 04 47 80 00 00 	movabs $0x804704,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+  802853:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  80285a:	00 00 
+  80285c:	eb a7                	jmp    802805 <fsipc_words+0x1b>
+
+000000000080285e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80285e:	55                   	push   %rbp
+  80285f:	48 89 e5             	mov    %rsp,%rbp
+  802862:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802866:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80286d:	00 
+  80286e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802875:	00 
+  802876:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80287a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80287e:	48 63 f6             	movslq %esi,%rsi
+  802881:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802885:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802889:	bf 02 00 00 00       	mov    $0x2,%edi
+  80288e:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802895:	00 00 00 
+  802898:	ff d0                	call   *%rax
+}
+  80289a:	c9                   	leave
+  80289b:	c3                   	ret
+
+000000000080289c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80289c:	55                   	push   %rbp
+  80289d:	48 89 e5             	mov    %rsp,%rbp
+  8028a0:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8028a4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8028ab:	00 
+  8028ac:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8028b3:	00 
+  8028b4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8028bb:	00 
+  8028bc:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8028c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8028c4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028c8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8028cd:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+}
+  8028d9:	c9                   	leave
+  8028da:	c3                   	ret
+
+00000000008028db <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028db:	55                   	push   %rbp
+  8028dc:	48 89 e5             	mov    %rsp,%rbp
+  8028df:	41 54                	push   %r12
+  8028e1:	53                   	push   %rbx
+  8028e2:	89 fb                	mov    %edi,%ebx
+  8028e4:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028e7:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8028ee:	00 00 00 
+  8028f1:	83 38 00             	cmpl   $0x0,(%rax)
+  8028f4:	74 3f                	je     802935 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8028f6:	6a 00                	push   $0x0
+  8028f8:	6a 00                	push   $0x0
+  8028fa:	4d 89 e1             	mov    %r12,%r9
+  8028fd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802903:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802908:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80290f:	00 00 00 
+  802912:	89 de                	mov    %ebx,%esi
+  802914:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80291b:	00 00 00 
+  80291e:	8b 38                	mov    (%rax),%edi
+  802920:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+}
+  80292c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802930:	5b                   	pop    %rbx
+  802931:	41 5c                	pop    %r12
+  802933:	5d                   	pop    %rbp
+  802934:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802935:	bf 03 00 00 00       	mov    $0x3,%edi
+  80293a:	48 b8 04 47 80 00 00 	movabs $0x804704,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  80294d:	00 00 
+  80294f:	eb a5                	jmp    8028f6 <fsipc+0x1b>
+
+0000000000802951 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802951:	55                   	push   %rbp
+  802952:	48 89 e5             	mov    %rsp,%rbp
+  802955:	41 54                	push   %r12
+  802957:	53                   	push   %rbx
+  802958:	41 89 fc             	mov    %edi,%r12d
+  80295b:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80295e:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802965:	00 00 00 
+  802968:	83 38 00             	cmpl   $0x0,(%rax)
+  80296b:	74 46                	je     8029b3 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80296d:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802971:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802975:	6a 00                	push   $0x0
+  802977:	6a 00                	push   $0x0
+  802979:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80297f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802985:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80298c:	00 00 00 
+  80298f:	44 89 e6             	mov    %r12d,%esi
+  802992:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802999:	00 00 00 
+  80299c:	8b 38                	mov    (%rax),%edi
+  80299e:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+}
+  8029aa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8029ae:	5b                   	pop    %rbx
+  8029af:	41 5c                	pop    %r12
+  8029b1:	5d                   	pop    %rbp
+  8029b2:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029b3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029b8:	48 b8 04 47 80 00 00 	movabs $0x804704,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8029cb:	00 00 
+  8029cd:	eb 9e                	jmp    80296d <fsipcv+0x1c>
+
+00000000008029cf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	41 54                	push   %r12
+  8029d5:	53                   	push   %rbx
+  8029d6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029d9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8029dc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8029e3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8029e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ea:	bf 05 00 00 00       	mov    $0x5,%edi
+  8029ef:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	78 3d                	js     802a3c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8029ff:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802a06:	00 00 00 
+  802a09:	4c 89 e6             	mov    %r12,%rsi
+  802a0c:	48 89 df             	mov    %rbx,%rdi
+  802a0f:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  802a16:	00 00 00 
+  802a19:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a1b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a22:	00 
+  802a23:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a29:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a30:	00 
+  802a31:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a3c:	5b                   	pop    %rbx
+  802a3d:	41 5c                	pop    %r12
+  802a3f:	5d                   	pop    %rbp
+  802a40:	c3                   	ret
+
+0000000000802a41 <fsipcv_buf>:
+    return FSIPCV;
+  802a41:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802a48:	00 00 00 
+    if (!allocated) {
+  802a4b:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802a52:	00 00 00 
+  802a55:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802a58:	74 01                	je     802a5b <fsipcv_buf+0x1a>
+}
+  802a5a:	c3                   	ret
+fsipcv_buf(void) {
+  802a5b:	55                   	push   %rbp
+  802a5c:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802a5f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a64:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a69:	48 89 c6             	mov    %rax,%rsi
+  802a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a71:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+  802a7d:	85 c0                	test   %eax,%eax
+  802a7f:	78 19                	js     802a9a <fsipcv_buf+0x59>
+        allocated = 1;
+  802a81:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802a88:	00 00 00 
+  802a8b:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802a8e:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802a95:	00 00 00 
+}
+  802a98:	5d                   	pop    %rbp
+  802a99:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9f:	eb f7                	jmp    802a98 <fsipcv_buf+0x57>
+
+0000000000802aa1 <devfile_write>:
+    if (!fd || !buf) {
+  802aa1:	48 85 ff             	test   %rdi,%rdi
+  802aa4:	0f 84 46 01 00 00    	je     802bf0 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	41 57                	push   %r15
+  802ab0:	41 56                	push   %r14
+  802ab2:	41 55                	push   %r13
+  802ab4:	41 54                	push   %r12
+  802ab6:	53                   	push   %rbx
+  802ab7:	48 83 ec 18          	sub    $0x18,%rsp
+  802abb:	49 89 ff             	mov    %rdi,%r15
+  802abe:	49 89 f5             	mov    %rsi,%r13
+  802ac1:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802ac4:	48 85 f6             	test   %rsi,%rsi
+  802ac7:	0f 84 1a 01 00 00    	je     802be7 <devfile_write+0x146>
+    while (n) {
+  802acd:	48 85 d2             	test   %rdx,%rdx
+  802ad0:	0f 84 fc 00 00 00    	je     802bd2 <devfile_write+0x131>
+    size_t i = 0;
+  802ad6:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802adc:	eb 6c                	jmp    802b4a <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802ade:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802ae4:	4c 39 e3             	cmp    %r12,%rbx
+  802ae7:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802aeb:	4c 89 e2             	mov    %r12,%rdx
+  802aee:	4c 89 ee             	mov    %r13,%rsi
+  802af1:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802af8:	00 00 00 
+  802afb:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  802b02:	00 00 00 
+  802b05:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b07:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b0b:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802b12:	00 00 00 
+  802b15:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802b17:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802b1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b20:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b25:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  802b2c:	00 00 00 
+  802b2f:	ff d0                	call   *%rax
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	0f 88 95 00 00 00    	js     802bce <devfile_write+0x12d>
+        buf += ret;
+  802b39:	48 98                	cltq
+  802b3b:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802b3e:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802b41:	48 29 c3             	sub    %rax,%rbx
+  802b44:	0f 84 8b 00 00 00    	je     802bd5 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802b4a:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802b51:	76 8b                	jbe    802ade <devfile_write+0x3d>
+  802b53:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  802b5a:	00 00 00 
+  802b5d:	ff d0                	call   *%rax
+  802b5f:	49 89 c4             	mov    %rax,%r12
+  802b62:	48 85 c0             	test   %rax,%rax
+  802b65:	0f 84 73 ff ff ff    	je     802ade <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802b6b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b70:	48 39 c3             	cmp    %rax,%rbx
+  802b73:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802b77:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802b7e:	00 
+  802b7f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802b83:	48 89 c2             	mov    %rax,%rdx
+  802b86:	4c 89 ee             	mov    %r13,%rsi
+  802b89:	48 b9 c0 11 80 00 00 	movabs $0x8011c0,%rcx
+  802b90:	00 00 00 
+  802b93:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802b95:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b99:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802b9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba1:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802ba6:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802bad:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802bb1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802bb6:	48 b8 51 29 80 00 00 	movabs $0x802951,%rax
+  802bbd:	00 00 00 
+  802bc0:	ff d0                	call   *%rax
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	0f 89 6f ff ff ff    	jns    802b39 <devfile_write+0x98>
+                return ret;
+  802bca:	48 98                	cltq
+  802bcc:	eb 0a                	jmp    802bd8 <devfile_write+0x137>
+                return ret;
+  802bce:	48 98                	cltq
+  802bd0:	eb 06                	jmp    802bd8 <devfile_write+0x137>
+    size_t i = 0;
+  802bd2:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802bd5:	4c 89 f0             	mov    %r14,%rax
+}
+  802bd8:	48 83 c4 18          	add    $0x18,%rsp
+  802bdc:	5b                   	pop    %rbx
+  802bdd:	41 5c                	pop    %r12
+  802bdf:	41 5d                	pop    %r13
+  802be1:	41 5e                	pop    %r14
+  802be3:	41 5f                	pop    %r15
+  802be5:	5d                   	pop    %rbp
+  802be6:	c3                   	ret
+        return -E_INVAL;
+  802be7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802bee:	eb e8                	jmp    802bd8 <devfile_write+0x137>
+  802bf0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802bf7:	c3                   	ret
+
+0000000000802bf8 <devfile_read>:
+    if (!fd || !buf) {
+  802bf8:	48 85 ff             	test   %rdi,%rdi
+  802bfb:	0f 84 47 01 00 00    	je     802d48 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c01:	55                   	push   %rbp
+  802c02:	48 89 e5             	mov    %rsp,%rbp
+  802c05:	41 57                	push   %r15
+  802c07:	41 56                	push   %r14
+  802c09:	41 55                	push   %r13
+  802c0b:	41 54                	push   %r12
+  802c0d:	53                   	push   %rbx
+  802c0e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c12:	49 89 ff             	mov    %rdi,%r15
+  802c15:	49 89 f5             	mov    %rsi,%r13
+  802c18:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802c1b:	48 85 f6             	test   %rsi,%rsi
+  802c1e:	0f 84 1b 01 00 00    	je     802d3f <devfile_read+0x147>
+    while (n) {
+  802c24:	48 85 d2             	test   %rdx,%rdx
+  802c27:	0f 84 fb 00 00 00    	je     802d28 <devfile_read+0x130>
+    size_t i = 0;
+  802c2d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c34:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c35:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802c3c:	00 00 00 
+  802c3f:	eb 5f                	jmp    802ca0 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802c41:	48 98                	cltq
+  802c43:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802c48:	e9 e3 00 00 00       	jmp    802d30 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c4d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c51:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802c54:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802c58:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c62:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  802c69:	00 00 00 
+  802c6c:	ff d0                	call   *%rax
+  802c6e:	89 c3                	mov    %eax,%ebx
+  802c70:	85 c0                	test   %eax,%eax
+  802c72:	0f 8e a7 00 00 00    	jle    802d1f <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802c78:	48 63 d0             	movslq %eax,%rdx
+  802c7b:	4c 89 f6             	mov    %r14,%rsi
+  802c7e:	4c 89 ef             	mov    %r13,%rdi
+  802c81:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+        buf += ret;
+  802c8d:	48 63 db             	movslq %ebx,%rbx
+  802c90:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802c93:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802c97:	49 29 dc             	sub    %rbx,%r12
+  802c9a:	0f 84 8c 00 00 00    	je     802d2c <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ca0:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802ca7:	76 a4                	jbe    802c4d <devfile_read+0x55>
+  802ca9:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  802cb0:	00 00 00 
+  802cb3:	ff d0                	call   *%rax
+  802cb5:	48 89 c1             	mov    %rax,%rcx
+  802cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cbc:	48 85 c0             	test   %rax,%rax
+  802cbf:	74 8c                	je     802c4d <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802cc1:	be 00 00 04 00       	mov    $0x40000,%esi
+  802cc6:	49 39 f4             	cmp    %rsi,%r12
+  802cc9:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802ccd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cd1:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802cd3:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802cd7:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802cde:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802ce2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ce7:	48 b8 51 29 80 00 00 	movabs $0x802951,%rax
+  802cee:	00 00 00 
+  802cf1:	ff d0                	call   *%rax
+  802cf3:	89 c3                	mov    %eax,%ebx
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	0f 8e 44 ff ff ff    	jle    802c41 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802cfd:	48 63 d0             	movslq %eax,%rdx
+  802d00:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d04:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802d0b:	4c 89 ef             	mov    %r13,%rdi
+  802d0e:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802d1a:	e9 6e ff ff ff       	jmp    802c8d <devfile_read+0x95>
+                return ret ? ret : i;
+  802d1f:	48 98                	cltq
+  802d21:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802d26:	eb 08                	jmp    802d30 <devfile_read+0x138>
+    size_t i = 0;
+  802d28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802d2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802d30:	48 83 c4 18          	add    $0x18,%rsp
+  802d34:	5b                   	pop    %rbx
+  802d35:	41 5c                	pop    %r12
+  802d37:	41 5d                	pop    %r13
+  802d39:	41 5e                	pop    %r14
+  802d3b:	41 5f                	pop    %r15
+  802d3d:	5d                   	pop    %rbp
+  802d3e:	c3                   	ret
+        return -E_INVAL;
+  802d3f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d46:	eb e8                	jmp    802d30 <devfile_read+0x138>
+  802d48:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802d4f:	c3                   	ret
+
+0000000000802d50 <open>:
+open(const char *path, int mode) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	41 55                	push   %r13
+  802d56:	41 54                	push   %r12
+  802d58:	53                   	push   %rbx
+  802d59:	48 83 ec 18          	sub    $0x18,%rsp
+  802d5d:	49 89 fc             	mov    %rdi,%r12
+  802d60:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d63:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+  802d6f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d75:	0f 87 8a 00 00 00    	ja     802e05 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d7b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d7f:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+  802d8b:	89 c3                	mov    %eax,%ebx
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	78 50                	js     802de1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d91:	4c 89 e6             	mov    %r12,%rsi
+  802d94:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802d9b:	00 00 00 
+  802d9e:	48 89 df             	mov    %rbx,%rdi
+  802da1:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802dad:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802db4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802db8:	bf 01 00 00 00       	mov    $0x1,%edi
+  802dbd:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  802dc4:	00 00 00 
+  802dc7:	ff d0                	call   *%rax
+  802dc9:	89 c3                	mov    %eax,%ebx
+  802dcb:	85 c0                	test   %eax,%eax
+  802dcd:	78 1f                	js     802dee <open+0x9e>
+    return fd2num(fd);
+  802dcf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dd3:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+  802ddf:	89 c3                	mov    %eax,%ebx
+}
+  802de1:	89 d8                	mov    %ebx,%eax
+  802de3:	48 83 c4 18          	add    $0x18,%rsp
+  802de7:	5b                   	pop    %rbx
+  802de8:	41 5c                	pop    %r12
+  802dea:	41 5d                	pop    %r13
+  802dec:	5d                   	pop    %rbp
+  802ded:	c3                   	ret
+        fd_close(fd, 0);
+  802dee:	be 00 00 00 00       	mov    $0x0,%esi
+  802df3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df7:	48 b8 a6 21 80 00 00 	movabs $0x8021a6,%rax
+  802dfe:	00 00 00 
+  802e01:	ff d0                	call   *%rax
+        return res;
+  802e03:	eb dc                	jmp    802de1 <open+0x91>
+        return -E_BAD_PATH;
+  802e05:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e0a:	eb d5                	jmp    802de1 <open+0x91>
+
+0000000000802e0c <sync>:
+sync(void) {
+  802e0c:	55                   	push   %rbp
+  802e0d:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802e10:	be 00 00 00 00       	mov    $0x0,%esi
+  802e15:	bf 08 00 00 00       	mov    $0x8,%edi
+  802e1a:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  802e21:	00 00 00 
+  802e24:	ff d0                	call   *%rax
+}
+  802e26:	5d                   	pop    %rbp
+  802e27:	c3                   	ret
+
+0000000000802e28 <drop_cache>:
+drop_cache(int fdnum) {
+  802e28:	55                   	push   %rbp
+  802e29:	48 89 e5             	mov    %rsp,%rbp
+  802e2c:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e30:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e34:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+  802e40:	85 c0                	test   %eax,%eax
+  802e42:	78 51                	js     802e95 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802e44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e48:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802e4f:	00 00 00 
+  802e52:	8b 0a                	mov    (%rdx),%ecx
+  802e54:	39 08                	cmp    %ecx,(%rax)
+  802e56:	75 3f                	jne    802e97 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802e58:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802e5f:	00 
+  802e60:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802e67:	00 
+  802e68:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802e6f:	00 
+  802e70:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802e77:	00 
+  802e78:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802e7c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802e80:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e84:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802e89:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+}
+  802e95:	c9                   	leave
+  802e96:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802e97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e9c:	eb f7                	jmp    802e95 <drop_cache+0x6d>
+
+0000000000802e9e <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802e9e:	55                   	push   %rbp
+  802e9f:	48 89 e5             	mov    %rsp,%rbp
+  802ea2:	41 57                	push   %r15
+  802ea4:	41 56                	push   %r14
+  802ea6:	41 55                	push   %r13
+  802ea8:	41 54                	push   %r12
+  802eaa:	53                   	push   %rbx
+  802eab:	48 83 ec 58          	sub    $0x58,%rsp
+  802eaf:	41 89 f4             	mov    %esi,%r12d
+  802eb2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802eb6:	49 89 cd             	mov    %rcx,%r13
+  802eb9:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ebc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ec0:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+  802ecc:	48 63 d0             	movslq %eax,%rdx
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	0f 88 36 01 00 00    	js     80300d <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ed7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802edb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ee2:	00 00 00 
+  802ee5:	8b 32                	mov    (%rdx),%esi
+  802ee7:	39 31                	cmp    %esi,(%rcx)
+  802ee9:	0f 85 30 01 00 00    	jne    80301f <read_map+0x181>
+  802eef:	45 85 e4             	test   %r12d,%r12d
+  802ef2:	0f 88 27 01 00 00    	js     80301f <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802ef8:	49 63 cc             	movslq %r12d,%rcx
+  802efb:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802eff:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f06:	0f 85 1c 01 00 00    	jne    803028 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802f0c:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802f10:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802f17:	0f 85 14 01 00 00    	jne    803031 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802f1d:	48 63 cb             	movslq %ebx,%rcx
+  802f20:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f24:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802f2b:	00 00 00 
+    while (i < n) {
+  802f2e:	4d 85 ed             	test   %r13,%r13
+  802f31:	75 5c                	jne    802f8f <read_map+0xf1>
+  802f33:	e9 d2 00 00 00       	jmp    80300a <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802f38:	41 8b 3e             	mov    (%r14),%edi
+  802f3b:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802f3f:	50                   	push   %rax
+  802f40:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802f44:	50                   	push   %rax
+  802f45:	4d 89 f9             	mov    %r15,%r9
+  802f48:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f4e:	48 89 d9             	mov    %rbx,%rcx
+  802f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f56:	be 09 00 00 00       	mov    $0x9,%esi
+  802f5b:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  802f62:	00 00 00 
+  802f65:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802f67:	48 83 c4 10          	add    $0x10,%rsp
+  802f6b:	85 c0                	test   %eax,%eax
+  802f6d:	0f 8e 8f 00 00 00    	jle    803002 <read_map+0x164>
+        if (!mapped_perm) {
+  802f73:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802f77:	0f 84 80 00 00 00    	je     802ffd <read_map+0x15f>
+        i += res;
+  802f7d:	48 63 d0             	movslq %eax,%rdx
+  802f80:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802f83:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802f88:	75 78                	jne    803002 <read_map+0x164>
+    while (i < n) {
+  802f8a:	4d 39 ec             	cmp    %r13,%r12
+  802f8d:	73 73                	jae    803002 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802f8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f93:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802f97:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802f9b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802f9f:	4c 01 e0             	add    %r12,%rax
+  802fa2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802fa6:	4c 89 eb             	mov    %r13,%rbx
+  802fa9:	4c 29 e3             	sub    %r12,%rbx
+  802fac:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802fb0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802fb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802fb8:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802fbf:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802fc6:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802fcb:	48 39 c3             	cmp    %rax,%rbx
+  802fce:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802fd2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802fd6:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802fda:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802fde:	0f 85 54 ff ff ff    	jne    802f38 <read_map+0x9a>
+  802fe4:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fe9:	48 b8 04 47 80 00 00 	movabs $0x804704,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+  802ff5:	41 89 06             	mov    %eax,(%r14)
+  802ff8:	e9 3b ff ff ff       	jmp    802f38 <read_map+0x9a>
+            res = -E_INVAL;
+  802ffd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803002:	4c 89 e2             	mov    %r12,%rdx
+  803005:	4d 85 e4             	test   %r12,%r12
+  803008:	75 03                	jne    80300d <read_map+0x16f>
+  80300a:	48 63 d0             	movslq %eax,%rdx
+}
+  80300d:	48 89 d0             	mov    %rdx,%rax
+  803010:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803014:	5b                   	pop    %rbx
+  803015:	41 5c                	pop    %r12
+  803017:	41 5d                	pop    %r13
+  803019:	41 5e                	pop    %r14
+  80301b:	41 5f                	pop    %r15
+  80301d:	5d                   	pop    %rbp
+  80301e:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80301f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803026:	eb e5                	jmp    80300d <read_map+0x16f>
+  803028:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80302f:	eb dc                	jmp    80300d <read_map+0x16f>
+  803031:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803038:	eb d3                	jmp    80300d <read_map+0x16f>
+
+000000000080303a <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80303a:	55                   	push   %rbp
+  80303b:	48 89 e5             	mov    %rsp,%rbp
+  80303e:	41 57                	push   %r15
+  803040:	41 56                	push   %r14
+  803042:	41 55                	push   %r13
+  803044:	41 54                	push   %r12
+  803046:	53                   	push   %rbx
+  803047:	48 83 ec 38          	sub    $0x38,%rsp
+  80304b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80304e:	41 89 f6             	mov    %esi,%r14d
+  803051:	49 89 d5             	mov    %rdx,%r13
+  803054:	89 cb                	mov    %ecx,%ebx
+  803056:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803059:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80305d:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  803064:	00 00 00 
+  803067:	ff d0                	call   *%rax
+  803069:	85 c0                	test   %eax,%eax
+  80306b:	0f 88 33 02 00 00    	js     8032a4 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803071:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803076:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80307a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803081:	00 00 00 
+  803084:	8b 3a                	mov    (%rdx),%edi
+  803086:	39 39                	cmp    %edi,(%rcx)
+  803088:	0f 85 1b 02 00 00    	jne    8032a9 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  80308e:	4d 85 ed             	test   %r13,%r13
+  803091:	41 0f 94 c0          	sete   %r8b
+  803095:	44 89 f0             	mov    %r14d,%eax
+  803098:	c1 e8 1f             	shr    $0x1f,%eax
+  80309b:	41 08 c0             	or     %al,%r8b
+  80309e:	0f 85 14 02 00 00    	jne    8032b8 <mmap+0x27e>
+  8030a4:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8030ab:	0f 85 0e 02 00 00    	jne    8032bf <mmap+0x285>
+  8030b1:	83 fb 07             	cmp    $0x7,%ebx
+  8030b4:	0f 87 0c 02 00 00    	ja     8032c6 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8030ba:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8030bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8030c4:	83 fa 01             	cmp    $0x1,%edx
+  8030c7:	0f 87 dc 01 00 00    	ja     8032a9 <mmap+0x26f>
+  8030cd:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  8030d4:	00 00 00 
+  8030d7:	eb 0e                	jmp    8030e7 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8030d9:	48 83 c0 01          	add    $0x1,%rax
+  8030dd:	48 83 c2 20          	add    $0x20,%rdx
+  8030e1:	48 83 f8 40          	cmp    $0x40,%rax
+  8030e5:	74 44                	je     80312b <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8030e7:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8030eb:	75 ec                	jne    8030d9 <mmap+0x9f>
+  8030ed:	48 c1 e0 05          	shl    $0x5,%rax
+  8030f1:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8030f8:	00 00 00 
+  8030fb:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  8030ff:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803106:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80310d:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803110:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803117:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80311a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80311f:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  803126:	00 00 00 
+  803129:	eb 17                	jmp    803142 <mmap+0x108>
+  80312b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803130:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803136:	eb c7                	jmp    8030ff <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803138:	48 83 c0 01          	add    $0x1,%rax
+  80313c:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803140:	77 37                	ja     803179 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803142:	48 89 c2             	mov    %rax,%rdx
+  803145:	48 c1 e2 05          	shl    $0x5,%rdx
+  803149:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80314e:	48 85 d2             	test   %rdx,%rdx
+  803151:	74 e5                	je     803138 <mmap+0xfe>
+  803153:	48 89 c7             	mov    %rax,%rdi
+  803156:	48 c1 e7 05          	shl    $0x5,%rdi
+  80315a:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  80315e:	48 01 fa             	add    %rdi,%rdx
+  803161:	48 39 d6             	cmp    %rdx,%rsi
+  803164:	73 d2                	jae    803138 <mmap+0xfe>
+  803166:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  80316a:	4c 39 d7             	cmp    %r10,%rdi
+  80316d:	73 c9                	jae    803138 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  80316f:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803172:	b8 00 00 00 00       	mov    $0x0,%eax
+  803177:	eb c9                	jmp    803142 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803179:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  80317d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803182:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803189:	00 00 00 
+  80318c:	49 39 f9             	cmp    %rdi,%r9
+  80318f:	0f 82 14 01 00 00    	jb     8032a9 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803195:	48 85 f6             	test   %rsi,%rsi
+  803198:	0f 84 2f 01 00 00    	je     8032cd <mmap+0x293>
+  80319e:	45 84 c0             	test   %r8b,%r8b
+  8031a1:	0f 85 26 01 00 00    	jne    8032cd <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8031a7:	41 83 fc 01          	cmp    $0x1,%r12d
+  8031ab:	0f 94 c0             	sete   %al
+  8031ae:	0f b6 c0             	movzbl %al,%eax
+  8031b1:	c1 e0 06             	shl    $0x6,%eax
+  8031b4:	09 d8                	or     %ebx,%eax
+  8031b6:	89 c3                	mov    %eax,%ebx
+  8031b8:	83 cb 04             	or     $0x4,%ebx
+  8031bb:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8031be:	4d 85 ff             	test   %r15,%r15
+  8031c1:	0f 84 bd 00 00 00    	je     803284 <mmap+0x24a>
+  8031c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8031cc:	83 e0 bf             	and    $0xffffffbf,%eax
+  8031cf:	83 c8 04             	or     $0x4,%eax
+  8031d2:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8031d5:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8031d9:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8031dd:	49 89 f6             	mov    %rsi,%r14
+  8031e0:	eb 43                	jmp    803225 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8031e2:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8031e8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031ee:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8031f1:	eb 2d                	jmp    803220 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8031f3:	48 85 c0             	test   %rax,%rax
+  8031f6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8031fb:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8031ff:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803202:	4c 89 e2             	mov    %r12,%rdx
+  803205:	4c 89 ee             	mov    %r13,%rsi
+  803208:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320d:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	78 3e                	js     80325b <mmap+0x221>
+        i += n;
+  80321d:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803220:	4c 39 fb             	cmp    %r15,%rbx
+  803223:	73 54                	jae    803279 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803225:	4d 89 fc             	mov    %r15,%r12
+  803228:	49 29 dc             	sub    %rbx,%r12
+  80322b:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80322f:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803232:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803235:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803239:	4c 89 e1             	mov    %r12,%rcx
+  80323c:	4c 89 ea             	mov    %r13,%rdx
+  80323f:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803242:	48 b8 9e 2e 80 00 00 	movabs $0x802e9e,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+        if (res > 0) {
+  80324e:	48 85 c0             	test   %rax,%rax
+  803251:	7f 8f                	jg     8031e2 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803253:	74 9e                	je     8031f3 <mmap+0x1b9>
+  803255:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803259:	74 98                	je     8031f3 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  80325b:	4c 89 f6             	mov    %r14,%rsi
+  80325e:	4c 89 fa             	mov    %r15,%rdx
+  803261:	bf 00 00 00 00       	mov    $0x0,%edi
+  803266:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  80326d:	00 00 00 
+  803270:	ff d0                	call   *%rax
+    return NULL;
+  803272:	b8 00 00 00 00       	mov    $0x0,%eax
+  803277:	eb 30                	jmp    8032a9 <mmap+0x26f>
+  803279:	4c 89 f6             	mov    %r14,%rsi
+  80327c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803280:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803284:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803288:	8b 40 0c             	mov    0xc(%rax),%eax
+  80328b:	48 89 31             	mov    %rsi,(%rcx)
+  80328e:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803292:	89 41 10             	mov    %eax,0x10(%rcx)
+  803295:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803299:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80329c:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80329f:	48 89 f0             	mov    %rsi,%rax
+  8032a2:	eb 05                	jmp    8032a9 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a9:	48 83 c4 38          	add    $0x38,%rsp
+  8032ad:	5b                   	pop    %rbx
+  8032ae:	41 5c                	pop    %r12
+  8032b0:	41 5d                	pop    %r13
+  8032b2:	41 5e                	pop    %r14
+  8032b4:	41 5f                	pop    %r15
+  8032b6:	5d                   	pop    %rbp
+  8032b7:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bd:	eb ea                	jmp    8032a9 <mmap+0x26f>
+  8032bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c4:	eb e3                	jmp    8032a9 <mmap+0x26f>
+  8032c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cb:	eb dc                	jmp    8032a9 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8032cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d2:	eb d5                	jmp    8032a9 <mmap+0x26f>
+
+00000000008032d4 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	41 57                	push   %r15
+  8032da:	41 56                	push   %r14
+  8032dc:	41 55                	push   %r13
+  8032de:	41 54                	push   %r12
+  8032e0:	53                   	push   %rbx
+  8032e1:	48 83 ec 38          	sub    $0x38,%rsp
+  8032e5:	49 89 fc             	mov    %rdi,%r12
+  8032e8:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8032eb:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8032f7:	48 85 c0             	test   %rax,%rax
+  8032fa:	0f 84 2f 01 00 00    	je     80342f <msync+0x15b>
+  803300:	49 89 c7             	mov    %rax,%r15
+  803303:	4d 01 e5             	add    %r12,%r13
+  803306:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80330a:	49 03 07             	add    (%r15),%rax
+  80330d:	4c 39 e8             	cmp    %r13,%rax
+  803310:	0f 82 20 01 00 00    	jb     803436 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803316:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80331a:	83 e0 40             	and    $0x40,%eax
+  80331d:	0f 84 fd 00 00 00    	je     803420 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803323:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80332a:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803331:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803338:	4d 39 ec             	cmp    %r13,%r12
+  80333b:	0f 83 fc 00 00 00    	jae    80343d <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803341:	49 be 7f 3e 80 00 00 	movabs $0x803e7f,%r14
+  803348:	00 00 00 
+  80334b:	e9 b0 00 00 00       	jmp    803400 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803350:	4c 89 e3             	mov    %r12,%rbx
+  803353:	4d 39 ec             	cmp    %r13,%r12
+  803356:	73 16                	jae    80336e <msync+0x9a>
+  803358:	48 89 df             	mov    %rbx,%rdi
+  80335b:	41 ff d6             	call   *%r14
+  80335e:	84 c0                	test   %al,%al
+  803360:	74 0c                	je     80336e <msync+0x9a>
+  803362:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803369:	4c 39 eb             	cmp    %r13,%rbx
+  80336c:	72 ea                	jb     803358 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  80336e:	48 89 d8             	mov    %rbx,%rax
+  803371:	4c 29 e0             	sub    %r12,%rax
+  803374:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803378:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80337c:	49 89 c0             	mov    %rax,%r8
+  80337f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803383:	ba 00 00 00 00       	mov    $0x0,%edx
+  803388:	48 89 ce             	mov    %rcx,%rsi
+  80338b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803390:	49 ba 76 15 80 00 00 	movabs $0x801576,%r10
+  803397:	00 00 00 
+  80339a:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	78 7f                	js     803420 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8033a1:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8033a8:	00 
+  8033a9:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8033b0:	00 
+  8033b1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8033b8:	00 
+  8033b9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8033c0:	00 
+  8033c1:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8033c5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8033c9:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8033cd:	49 2b 07             	sub    (%r15),%rax
+  8033d0:	4c 01 e0             	add    %r12,%rax
+  8033d3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8033d7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8033db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8033df:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8033e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8033e8:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+  8033f4:	85 c0                	test   %eax,%eax
+  8033f6:	78 28                	js     803420 <msync+0x14c>
+  8033f8:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8033fb:	4d 39 ec             	cmp    %r13,%r12
+  8033fe:	73 1b                	jae    80341b <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803400:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803404:	4c 89 e7             	mov    %r12,%rdi
+  803407:	41 ff d6             	call   *%r14
+  80340a:	84 c0                	test   %al,%al
+  80340c:	0f 85 3e ff ff ff    	jne    803350 <msync+0x7c>
+            va += PAGE_SIZE;
+  803412:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803419:	eb e0                	jmp    8033fb <msync+0x127>
+    }
+
+    return 0;
+  80341b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803420:	48 83 c4 38          	add    $0x38,%rsp
+  803424:	5b                   	pop    %rbx
+  803425:	41 5c                	pop    %r12
+  803427:	41 5d                	pop    %r13
+  803429:	41 5e                	pop    %r14
+  80342b:	41 5f                	pop    %r15
+  80342d:	5d                   	pop    %rbp
+  80342e:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80342f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803434:	eb ea                	jmp    803420 <msync+0x14c>
+  803436:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80343b:	eb e3                	jmp    803420 <msync+0x14c>
+    return 0;
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803442:	eb dc                	jmp    803420 <msync+0x14c>
+
+0000000000803444 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803444:	55                   	push   %rbp
+  803445:	48 89 e5             	mov    %rsp,%rbp
+  803448:	41 55                	push   %r13
+  80344a:	41 54                	push   %r12
+  80344c:	53                   	push   %rbx
+  80344d:	48 83 ec 08          	sub    $0x8,%rsp
+  803451:	49 89 fc             	mov    %rdi,%r12
+  803454:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803457:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  80345e:	00 00 00 
+  803461:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803463:	48 85 c0             	test   %rax,%rax
+  803466:	74 58                	je     8034c0 <munmap+0x7c>
+  803468:	48 89 c3             	mov    %rax,%rbx
+  80346b:	4c 3b 20             	cmp    (%rax),%r12
+  80346e:	75 57                	jne    8034c7 <munmap+0x83>
+  803470:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803477:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80347d:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803481:	75 4b                	jne    8034ce <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803483:	4c 89 ee             	mov    %r13,%rsi
+  803486:	4c 89 e7             	mov    %r12,%rdi
+  803489:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803495:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803499:	4c 89 e6             	mov    %r12,%rsi
+  80349c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a1:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  8034a8:	00 00 00 
+  8034ab:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8034ad:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8034b4:	00 
+    return res;
+}
+  8034b5:	48 83 c4 08          	add    $0x8,%rsp
+  8034b9:	5b                   	pop    %rbx
+  8034ba:	41 5c                	pop    %r12
+  8034bc:	41 5d                	pop    %r13
+  8034be:	5d                   	pop    %rbp
+  8034bf:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8034c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c5:	eb ee                	jmp    8034b5 <munmap+0x71>
+  8034c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034cc:	eb e7                	jmp    8034b5 <munmap+0x71>
+  8034ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034d3:	eb e0                	jmp    8034b5 <munmap+0x71>
+
+00000000008034d5 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	41 54                	push   %r12
+  8034db:	53                   	push   %rbx
+  8034dc:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034df:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+  8034eb:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034ee:	48 be 60 57 80 00 00 	movabs $0x805760,%rsi
+  8034f5:	00 00 00 
+  8034f8:	48 89 df             	mov    %rbx,%rdi
+  8034fb:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  803502:	00 00 00 
+  803505:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803507:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80350c:	41 8b 14 24          	mov    (%r12),%edx
+  803510:	29 d0                	sub    %edx,%eax
+  803512:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803518:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80351f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803522:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803529:	00 00 00 
+  80352c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803533:	b8 00 00 00 00       	mov    $0x0,%eax
+  803538:	5b                   	pop    %rbx
+  803539:	41 5c                	pop    %r12
+  80353b:	5d                   	pop    %rbp
+  80353c:	c3                   	ret
+
+000000000080353d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80353d:	55                   	push   %rbp
+  80353e:	48 89 e5             	mov    %rsp,%rbp
+  803541:	41 55                	push   %r13
+  803543:	41 54                	push   %r12
+  803545:	53                   	push   %rbx
+  803546:	48 83 ec 08          	sub    $0x8,%rsp
+  80354a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80354d:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+  803559:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80355c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803561:	4c 89 e6             	mov    %r12,%rsi
+  803564:	bf 00 00 00 00       	mov    $0x0,%edi
+  803569:	49 bc 43 16 80 00 00 	movabs $0x801643,%r12
+  803570:	00 00 00 
+  803573:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803576:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80357c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803583:	bf 00 00 00 00       	mov    $0x0,%edi
+  803588:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  80358b:	be 00 04 00 00       	mov    $0x400,%esi
+  803590:	48 89 df             	mov    %rbx,%rdi
+  803593:	49 bd bd 1b 80 00 00 	movabs $0x801bbd,%r13
+  80359a:	00 00 00 
+  80359d:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8035a0:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8035a4:	be 00 04 00 00       	mov    $0x400,%esi
+  8035a9:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8035ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035b1:	48 89 de             	mov    %rbx,%rsi
+  8035b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b9:	41 ff d4             	call   *%r12
+}
+  8035bc:	48 83 c4 08          	add    $0x8,%rsp
+  8035c0:	5b                   	pop    %rbx
+  8035c1:	41 5c                	pop    %r12
+  8035c3:	41 5d                	pop    %r13
+  8035c5:	5d                   	pop    %rbp
+  8035c6:	c3                   	ret
+
+00000000008035c7 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8035c7:	55                   	push   %rbp
+  8035c8:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8035cb:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8035d1:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8035d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035dd:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  8035e4:	00 00 00 
+  8035e7:	ff d0                	call   *%rax
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	0f 94 c0             	sete   %al
+  8035ee:	0f b6 c0             	movzbl %al,%eax
+}
+  8035f1:	5d                   	pop    %rbp
+  8035f2:	c3                   	ret
+
+00000000008035f3 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8035f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035f8:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8035fa:	8b 07                	mov    (%rdi),%eax
+  8035fc:	39 f0                	cmp    %esi,%eax
+  8035fe:	74 01                	je     803601 <pipe_wait+0xe>
+  803600:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803601:	55                   	push   %rbp
+  803602:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803605:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803607:	48 c1 e2 20          	shl    $0x20,%rdx
+  80360b:	89 c0                	mov    %eax,%eax
+  80360d:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803610:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803617:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  80361e:	00 00 00 
+  803621:	ff d0                	call   *%rax
+}
+  803623:	5d                   	pop    %rbp
+  803624:	c3                   	ret
+
+0000000000803625 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362a:	87 06                	xchg   %eax,(%rsi)
+  80362c:	85 c0                	test   %eax,%eax
+  80362e:	75 01                	jne    803631 <pipe_wake+0xc>
+  803630:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803631:	55                   	push   %rbp
+  803632:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803635:	be 00 04 00 00       	mov    $0x400,%esi
+  80363a:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+}
+  803646:	5d                   	pop    %rbp
+  803647:	c3                   	ret
+
+0000000000803648 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803648:	55                   	push   %rbp
+  803649:	48 89 e5             	mov    %rsp,%rbp
+  80364c:	41 57                	push   %r15
+  80364e:	41 56                	push   %r14
+  803650:	41 55                	push   %r13
+  803652:	41 54                	push   %r12
+  803654:	53                   	push   %rbx
+  803655:	48 83 ec 28          	sub    $0x28,%rsp
+  803659:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80365d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803661:	48 89 d3             	mov    %rdx,%rbx
+  803664:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803668:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  80366f:	00 00 00 
+  803672:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803674:	48 85 db             	test   %rbx,%rbx
+  803677:	0f 84 0f 01 00 00    	je     80378c <devpipe_write+0x144>
+  80367d:	49 89 c4             	mov    %rax,%r12
+  803680:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803686:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80368d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803691:	eb 4f                	jmp    8036e2 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803693:	4c 89 e6             	mov    %r12,%rsi
+  803696:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80369a:	48 b8 c7 35 80 00 00 	movabs $0x8035c7,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	74 14                	je     8036be <devpipe_write+0x76>
+  8036aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036af:	48 83 c4 28          	add    $0x28,%rsp
+  8036b3:	5b                   	pop    %rbx
+  8036b4:	41 5c                	pop    %r12
+  8036b6:	41 5d                	pop    %r13
+  8036b8:	41 5e                	pop    %r14
+  8036ba:	41 5f                	pop    %r15
+  8036bc:	5d                   	pop    %rbp
+  8036bd:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8036be:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8036c3:	44 89 ee             	mov    %r13d,%esi
+  8036c6:	4c 89 e7             	mov    %r12,%rdi
+  8036c9:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  8036d0:	00 00 00 
+  8036d3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8036d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036d9:	49 39 c7             	cmp    %rax,%r15
+  8036dc:	0f 83 aa 00 00 00    	jae    80378c <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8036e2:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8036e7:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8036eb:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8036f2:	00 
+  8036f3:	44 89 f0             	mov    %r14d,%eax
+  8036f6:	44 29 e8             	sub    %r13d,%eax
+  8036f9:	39 d8                	cmp    %ebx,%eax
+  8036fb:	74 96                	je     803693 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8036fd:	89 d8                	mov    %ebx,%eax
+  8036ff:	44 29 f0             	sub    %r14d,%eax
+  803702:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803706:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80370a:	4c 29 f8             	sub    %r15,%rax
+  80370d:	49 39 c5             	cmp    %rax,%r13
+  803710:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803714:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803717:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80371a:	89 db                	mov    %ebx,%ebx
+  80371c:	48 29 c3             	sub    %rax,%rbx
+  80371f:	4c 39 eb             	cmp    %r13,%rbx
+  803722:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803726:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80372a:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80372e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803735:	00 
+  803736:	48 89 da             	mov    %rbx,%rdx
+  803739:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803745:	4c 89 ea             	mov    %r13,%rdx
+  803748:	48 29 da             	sub    %rbx,%rdx
+  80374b:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80374f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803753:	48 01 ce             	add    %rcx,%rsi
+  803756:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80375a:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  803761:	00 00 00 
+  803764:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803766:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80376b:	45 01 ee             	add    %r13d,%r14d
+  80376e:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803773:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803778:	48 b8 25 36 80 00 00 	movabs $0x803625,%rax
+  80377f:	00 00 00 
+  803782:	ff d0                	call   *%rax
+        i += chunk;
+  803784:	4d 01 ef             	add    %r13,%r15
+  803787:	e9 49 ff ff ff       	jmp    8036d5 <devpipe_write+0x8d>
+    return n;
+  80378c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803790:	e9 1a ff ff ff       	jmp    8036af <devpipe_write+0x67>
+
+0000000000803795 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803795:	55                   	push   %rbp
+  803796:	48 89 e5             	mov    %rsp,%rbp
+  803799:	41 57                	push   %r15
+  80379b:	41 56                	push   %r14
+  80379d:	41 55                	push   %r13
+  80379f:	41 54                	push   %r12
+  8037a1:	53                   	push   %rbx
+  8037a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8037a6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8037aa:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8037ae:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037b2:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  8037b9:	00 00 00 
+  8037bc:	ff d0                	call   *%rax
+  8037be:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8037c1:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8037c5:	49 bf c7 35 80 00 00 	movabs $0x8035c7,%r15
+  8037cc:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8037cf:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8037d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037d7:	eb 15                	jmp    8037ee <devpipe_read+0x59>
+  8037d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037dd:	89 de                	mov    %ebx,%esi
+  8037df:	4c 89 f7             	mov    %r14,%rdi
+  8037e2:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8037ee:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8037f2:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8037f5:	41 39 dd             	cmp    %ebx,%r13d
+  8037f8:	75 15                	jne    80380f <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8037fa:	4c 89 e6             	mov    %r12,%rsi
+  8037fd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803801:	41 ff d7             	call   *%r15
+  803804:	85 c0                	test   %eax,%eax
+  803806:	74 d1                	je     8037d9 <devpipe_read+0x44>
+  803808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380d:	eb 7c                	jmp    80388b <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80380f:	44 29 eb             	sub    %r13d,%ebx
+  803812:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803816:	48 39 c3             	cmp    %rax,%rbx
+  803819:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80381d:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803824:	00 
+  803825:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803829:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80382c:	45 89 f6             	mov    %r14d,%r14d
+  80382f:	49 29 c6             	sub    %rax,%r14
+  803832:	49 39 de             	cmp    %rbx,%r14
+  803835:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803839:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803840:	00 
+  803841:	4c 89 f2             	mov    %r14,%rdx
+  803844:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803848:	49 bf c0 11 80 00 00 	movabs $0x8011c0,%r15
+  80384f:	00 00 00 
+  803852:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803855:	48 89 da             	mov    %rbx,%rdx
+  803858:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80385b:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803862:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803863:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803867:	4c 01 f7             	add    %r14,%rdi
+  80386a:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80386d:	41 01 dd             	add    %ebx,%r13d
+  803870:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803874:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803879:	4c 89 e7             	mov    %r12,%rdi
+  80387c:	48 b8 25 36 80 00 00 	movabs $0x803625,%rax
+  803883:	00 00 00 
+  803886:	ff d0                	call   *%rax
+    return n;
+  803888:	48 89 d8             	mov    %rbx,%rax
+}
+  80388b:	48 83 c4 28          	add    $0x28,%rsp
+  80388f:	5b                   	pop    %rbx
+  803890:	41 5c                	pop    %r12
+  803892:	41 5d                	pop    %r13
+  803894:	41 5e                	pop    %r14
+  803896:	41 5f                	pop    %r15
+  803898:	5d                   	pop    %rbp
+  803899:	c3                   	ret
+
+000000000080389a <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  80389a:	55                   	push   %rbp
+  80389b:	48 89 e5             	mov    %rsp,%rbp
+  80389e:	41 57                	push   %r15
+  8038a0:	41 56                	push   %r14
+  8038a2:	41 55                	push   %r13
+  8038a4:	41 54                	push   %r12
+  8038a6:	53                   	push   %rbx
+  8038a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8038ab:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8038ae:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8038b5:	0f 86 96 01 00 00    	jbe    803a51 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8038bb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8038c0:	48 01 db             	add    %rbx,%rbx
+  8038c3:	48 39 f3             	cmp    %rsi,%rbx
+  8038c6:	72 f8                	jb     8038c0 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8038c8:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8038cf:	0f 87 18 02 00 00    	ja     803aed <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8038d5:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8038d9:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8038e0:	00 00 00 
+  8038e3:	ff d0                	call   *%rax
+  8038e5:	41 89 c4             	mov    %eax,%r12d
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	0f 88 b6 01 00 00    	js     803aa6 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8038f0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fa:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8038fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803903:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  80390a:	00 00 00 
+  80390d:	ff d0                	call   *%rax
+  80390f:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803912:	85 c0                	test   %eax,%eax
+  803914:	0f 88 8c 01 00 00    	js     803aa6 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80391a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80391e:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  803925:	00 00 00 
+  803928:	ff d0                	call   *%rax
+  80392a:	41 89 c4             	mov    %eax,%r12d
+  80392d:	85 c0                	test   %eax,%eax
+  80392f:	0f 88 57 01 00 00    	js     803a8c <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803935:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80393a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80393f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803943:	bf 00 00 00 00       	mov    $0x0,%edi
+  803948:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  80394f:	00 00 00 
+  803952:	ff d0                	call   *%rax
+  803954:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803957:	85 c0                	test   %eax,%eax
+  803959:	0f 88 2d 01 00 00    	js     803a8c <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80395f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803963:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+  80396f:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803972:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803979:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80397e:	4c 89 fa             	mov    %r15,%rdx
+  803981:	48 89 c6             	mov    %rax,%rsi
+  803984:	bf 00 00 00 00       	mov    $0x0,%edi
+  803989:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+  803995:	41 89 c4             	mov    %eax,%r12d
+  803998:	85 c0                	test   %eax,%eax
+  80399a:	0f 88 d2 00 00 00    	js     803a72 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8039a0:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8039a7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8039ab:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+  8039b7:	48 89 c1             	mov    %rax,%rcx
+  8039ba:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8039c0:	4d 89 f8             	mov    %r15,%r8
+  8039c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c8:	4c 89 f6             	mov    %r14,%rsi
+  8039cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d0:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+  8039dc:	41 89 c4             	mov    %eax,%r12d
+  8039df:	85 c0                	test   %eax,%eax
+  8039e1:	78 78                	js     803a5b <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8039e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039e8:	4c 89 f7             	mov    %r14,%rdi
+  8039eb:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  8039f2:	00 00 00 
+  8039f5:	ff d0                	call   *%rax
+  8039f7:	83 f8 02             	cmp    $0x2,%eax
+  8039fa:	0f 85 b8 00 00 00    	jne    803ab8 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a00:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a07:	00 00 
+  803a09:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a0d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a0f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a1e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a20:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a24:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a2b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a2f:	48 bb 58 20 80 00 00 	movabs $0x802058,%rbx
+  803a36:	00 00 00 
+  803a39:	ff d3                	call   *%rbx
+  803a3b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803a3f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803a43:	ff d3                	call   *%rbx
+  803a45:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803a49:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a4f:	eb 55                	jmp    803aa6 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803a51:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803a56:	e9 7a fe ff ff       	jmp    8038d5 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803a5b:	4c 89 fa             	mov    %r15,%rdx
+  803a5e:	4c 89 f6             	mov    %r14,%rsi
+  803a61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a66:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  803a6d:	00 00 00 
+  803a70:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803a72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a77:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a80:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  803a87:	00 00 00 
+  803a8a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803a8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a91:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a9a:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+}
+  803aa6:	44 89 e0             	mov    %r12d,%eax
+  803aa9:	48 83 c4 18          	add    $0x18,%rsp
+  803aad:	5b                   	pop    %rbx
+  803aae:	41 5c                	pop    %r12
+  803ab0:	41 5d                	pop    %r13
+  803ab2:	41 5e                	pop    %r14
+  803ab4:	41 5f                	pop    %r15
+  803ab6:	5d                   	pop    %rbp
+  803ab7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ab8:	48 b9 90 57 80 00 00 	movabs $0x805790,%rcx
+  803abf:	00 00 00 
+  803ac2:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  803ac9:	00 00 00 
+  803acc:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803ad1:	48 bf 7c 57 80 00 00 	movabs $0x80577c,%rdi
+  803ad8:	00 00 00 
+  803adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae0:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  803ae7:	00 00 00 
+  803aea:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803aed:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803af3:	eb b1                	jmp    803aa6 <pipe_sized+0x20c>
+
+0000000000803af5 <pipe>:
+pipe(int pfd[2]) {
+  803af5:	55                   	push   %rbp
+  803af6:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803af9:	be 00 00 01 00       	mov    $0x10000,%esi
+  803afe:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  803b05:	00 00 00 
+  803b08:	ff d0                	call   *%rax
+}
+  803b0a:	5d                   	pop    %rbp
+  803b0b:	c3                   	ret
+
+0000000000803b0c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b0c:	55                   	push   %rbp
+  803b0d:	48 89 e5             	mov    %rsp,%rbp
+  803b10:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b14:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b18:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  803b1f:	00 00 00 
+  803b22:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b24:	85 c0                	test   %eax,%eax
+  803b26:	78 23                	js     803b4b <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b28:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b2c:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  803b33:	00 00 00 
+  803b36:	ff d0                	call   *%rax
+  803b38:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b3b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b3f:	48 b8 c7 35 80 00 00 	movabs $0x8035c7,%rax
+  803b46:	00 00 00 
+  803b49:	ff d0                	call   *%rax
+}
+  803b4b:	c9                   	leave
+  803b4c:	c3                   	ret
+
+0000000000803b4d <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803b51:	8b 0f                	mov    (%rdi),%ecx
+  803b53:	8d 41 01             	lea    0x1(%rcx),%eax
+  803b56:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803b58:	83 f9 07             	cmp    $0x7,%ecx
+  803b5b:	76 31                	jbe    803b8e <backoff+0x41>
+    asm volatile("rdtsc"
+  803b5d:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803b5f:	83 c1 06             	add    $0x6,%ecx
+  803b62:	be 15 00 00 00       	mov    $0x15,%esi
+  803b67:	39 f1                	cmp    %esi,%ecx
+  803b69:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803b6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b71:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803b74:	48 c1 e2 20          	shl    $0x20,%rdx
+  803b78:	89 c0                	mov    %eax,%eax
+  803b7a:	48 09 c2             	or     %rax,%rdx
+  803b7d:	48 01 d7             	add    %rdx,%rdi
+  803b80:	48 b8 0b 1b 80 00 00 	movabs $0x801b0b,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+}
+  803b8c:	5d                   	pop    %rbp
+  803b8d:	c3                   	ret
+        sys_yield();
+  803b8e:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  803b95:	00 00 00 
+  803b98:	ff d0                	call   *%rax
+        return;
+  803b9a:	eb f0                	jmp    803b8c <backoff+0x3f>
+
+0000000000803b9c <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803b9c:	55                   	push   %rbp
+  803b9d:	48 89 e5             	mov    %rsp,%rbp
+  803ba0:	41 55                	push   %r13
+  803ba2:	41 54                	push   %r12
+  803ba4:	53                   	push   %rbx
+  803ba5:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803ba9:	85 ff                	test   %edi,%edi
+  803bab:	74 7e                	je     803c2b <wait+0x8f>
+  803bad:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803bb0:	89 f8                	mov    %edi,%eax
+  803bb2:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803bb7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803bbe:	89 f9                	mov    %edi,%ecx
+  803bc0:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803bc6:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803bcd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803bd4:	00 00 00 
+  803bd7:	48 01 ca             	add    %rcx,%rdx
+  803bda:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803be0:	39 d7                	cmp    %edx,%edi
+  803be2:	75 3c                	jne    803c20 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803be4:	48 98                	cltq
+  803be6:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803bed:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803bf4:	00 00 00 
+  803bf7:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803bfa:	49 bd 4d 3b 80 00 00 	movabs $0x803b4d,%r13
+  803c01:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803c04:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803c0a:	85 c0                	test   %eax,%eax
+  803c0c:	74 12                	je     803c20 <wait+0x84>
+        backoff(&attempt);
+  803c0e:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c12:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803c15:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803c1b:	44 39 e0             	cmp    %r12d,%eax
+  803c1e:	74 e4                	je     803c04 <wait+0x68>
+    }
+}
+  803c20:	48 83 c4 18          	add    $0x18,%rsp
+  803c24:	5b                   	pop    %rbx
+  803c25:	41 5c                	pop    %r12
+  803c27:	41 5d                	pop    %r13
+  803c29:	5d                   	pop    %rbp
+  803c2a:	c3                   	ret
+    assert(envid != 0);
+  803c2b:	48 b9 b4 57 80 00 00 	movabs $0x8057b4,%rcx
+  803c32:	00 00 00 
+  803c35:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  803c3c:	00 00 00 
+  803c3f:	be 22 00 00 00       	mov    $0x22,%esi
+  803c44:	48 bf bf 57 80 00 00 	movabs $0x8057bf,%rdi
+  803c4b:	00 00 00 
+  803c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c53:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  803c5a:	00 00 00 
+  803c5d:	41 ff d0             	call   *%r8
+
+0000000000803c60 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c60:	48 89 f8             	mov    %rdi,%rax
+  803c63:	48 c1 e8 27          	shr    $0x27,%rax
+  803c67:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c6e:	7f 00 00 
+  803c71:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c75:	f6 c2 01             	test   $0x1,%dl
+  803c78:	74 6d                	je     803ce7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c7a:	48 89 f8             	mov    %rdi,%rax
+  803c7d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c81:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c88:	7f 00 00 
+  803c8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c8f:	f6 c2 01             	test   $0x1,%dl
+  803c92:	74 62                	je     803cf6 <get_uvpt_entry+0x96>
+  803c94:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c9b:	7f 00 00 
+  803c9e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ca2:	f6 c2 80             	test   $0x80,%dl
+  803ca5:	75 4f                	jne    803cf6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ca7:	48 89 f8             	mov    %rdi,%rax
+  803caa:	48 c1 e8 15          	shr    $0x15,%rax
+  803cae:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803cb5:	7f 00 00 
+  803cb8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cbc:	f6 c2 01             	test   $0x1,%dl
+  803cbf:	74 44                	je     803d05 <get_uvpt_entry+0xa5>
+  803cc1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803cc8:	7f 00 00 
+  803ccb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ccf:	f6 c2 80             	test   $0x80,%dl
+  803cd2:	75 31                	jne    803d05 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803cd4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803cd8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cdf:	7f 00 00 
+  803ce2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ce6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ce7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803cee:	7f 00 00 
+  803cf1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cf5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803cf6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803cfd:	7f 00 00 
+  803d00:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d04:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d05:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d0c:	7f 00 00 
+  803d0f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d13:	c3                   	ret
+
+0000000000803d14 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803d14:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d17:	48 89 f9             	mov    %rdi,%rcx
+  803d1a:	48 c1 e9 27          	shr    $0x27,%rcx
+  803d1e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803d25:	7f 00 00 
+  803d28:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803d2c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d33:	f6 c1 01             	test   $0x1,%cl
+  803d36:	0f 84 b2 00 00 00    	je     803dee <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d3c:	48 89 f9             	mov    %rdi,%rcx
+  803d3f:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803d43:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d4a:	7f 00 00 
+  803d4d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d51:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d58:	40 f6 c6 01          	test   $0x1,%sil
+  803d5c:	0f 84 8c 00 00 00    	je     803dee <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803d62:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d69:	7f 00 00 
+  803d6c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d70:	a8 80                	test   $0x80,%al
+  803d72:	75 7b                	jne    803def <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d74:	48 89 f9             	mov    %rdi,%rcx
+  803d77:	48 c1 e9 15          	shr    $0x15,%rcx
+  803d7b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d82:	7f 00 00 
+  803d85:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d89:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d90:	40 f6 c6 01          	test   $0x1,%sil
+  803d94:	74 58                	je     803dee <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803d96:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d9d:	7f 00 00 
+  803da0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803da4:	a8 80                	test   $0x80,%al
+  803da6:	75 6c                	jne    803e14 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803da8:	48 89 f9             	mov    %rdi,%rcx
+  803dab:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803daf:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803db6:	7f 00 00 
+  803db9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dbd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803dc4:	40 f6 c6 01          	test   $0x1,%sil
+  803dc8:	74 24                	je     803dee <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803dca:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803dd1:	7f 00 00 
+  803dd4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803dd8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ddf:	ff ff 7f 
+  803de2:	48 21 c8             	and    %rcx,%rax
+  803de5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803deb:	48 09 d0             	or     %rdx,%rax
+}
+  803dee:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803def:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803df6:	7f 00 00 
+  803df9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803dfd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e04:	ff ff 7f 
+  803e07:	48 21 c8             	and    %rcx,%rax
+  803e0a:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803e10:	48 01 d0             	add    %rdx,%rax
+  803e13:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803e14:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e1b:	7f 00 00 
+  803e1e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e22:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e29:	ff ff 7f 
+  803e2c:	48 21 c8             	and    %rcx,%rax
+  803e2f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803e35:	48 01 d0             	add    %rdx,%rax
+  803e38:	c3                   	ret
+
+0000000000803e39 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e39:	55                   	push   %rbp
+  803e3a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e3d:	48 b8 60 3c 80 00 00 	movabs $0x803c60,%rax
+  803e44:	00 00 00 
+  803e47:	ff d0                	call   *%rax
+  803e49:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e4c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e51:	89 c1                	mov    %eax,%ecx
+  803e53:	83 c9 04             	or     $0x4,%ecx
+  803e56:	f6 c2 01             	test   $0x1,%dl
+  803e59:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e5c:	89 c1                	mov    %eax,%ecx
+  803e5e:	83 c9 02             	or     $0x2,%ecx
+  803e61:	f6 c2 02             	test   $0x2,%dl
+  803e64:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e67:	89 c1                	mov    %eax,%ecx
+  803e69:	83 c9 01             	or     $0x1,%ecx
+  803e6c:	48 85 d2             	test   %rdx,%rdx
+  803e6f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e72:	89 c1                	mov    %eax,%ecx
+  803e74:	83 c9 40             	or     $0x40,%ecx
+  803e77:	f6 c6 04             	test   $0x4,%dh
+  803e7a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e7d:	5d                   	pop    %rbp
+  803e7e:	c3                   	ret
+
+0000000000803e7f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e7f:	55                   	push   %rbp
+  803e80:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e83:	48 b8 60 3c 80 00 00 	movabs $0x803c60,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e8f:	48 c1 e8 06          	shr    $0x6,%rax
+  803e93:	83 e0 01             	and    $0x1,%eax
+}
+  803e96:	5d                   	pop    %rbp
+  803e97:	c3                   	ret
+
+0000000000803e98 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e98:	55                   	push   %rbp
+  803e99:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e9c:	48 b8 60 3c 80 00 00 	movabs $0x803c60,%rax
+  803ea3:	00 00 00 
+  803ea6:	ff d0                	call   *%rax
+  803ea8:	83 e0 01             	and    $0x1,%eax
+}
+  803eab:	5d                   	pop    %rbp
+  803eac:	c3                   	ret
+
+0000000000803ead <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803ead:	55                   	push   %rbp
+  803eae:	48 89 e5             	mov    %rsp,%rbp
+  803eb1:	41 57                	push   %r15
+  803eb3:	41 56                	push   %r14
+  803eb5:	41 55                	push   %r13
+  803eb7:	41 54                	push   %r12
+  803eb9:	53                   	push   %rbx
+  803eba:	48 83 ec 18          	sub    $0x18,%rsp
+  803ebe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ec2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803ec6:	48 39 f7             	cmp    %rsi,%rdi
+  803ec9:	0f 83 e4 00 00 00    	jae    803fb3 <foreach_present_page+0x106>
+  803ecf:	49 89 f4             	mov    %rsi,%r12
+  803ed2:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803ed5:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803edc:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803edf:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803ee6:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803ee9:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803ef0:	7f 00 00 
+  803ef3:	eb 27                	jmp    803f1c <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803ef5:	48 89 d8             	mov    %rbx,%rax
+  803ef8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803efc:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803f00:	f6 c2 01             	test   $0x1,%dl
+  803f03:	75 43                	jne    803f48 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803f05:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803f0c:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803f13:	4c 39 e3             	cmp    %r12,%rbx
+  803f16:	0f 83 83 00 00 00    	jae    803f9f <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803f1c:	48 89 d8             	mov    %rbx,%rax
+  803f1f:	48 c1 e8 27          	shr    $0x27,%rax
+  803f23:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f28:	a8 01                	test   $0x1,%al
+  803f2a:	75 c9                	jne    803ef5 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803f2c:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803f33:	ff ff ff 
+  803f36:	48 21 d8             	and    %rbx,%rax
+  803f39:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803f40:	00 00 00 
+  803f43:	48 01 c3             	add    %rax,%rbx
+  803f46:	eb cb                	jmp    803f13 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803f48:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803f4c:	a8 80                	test   $0x80,%al
+  803f4e:	75 1f                	jne    803f6f <foreach_present_page+0xc2>
+  803f50:	48 89 d8             	mov    %rbx,%rax
+  803f53:	48 c1 e8 15          	shr    $0x15,%rax
+  803f57:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803f5b:	a8 01                	test   $0x1,%al
+  803f5d:	75 10                	jne    803f6f <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803f5f:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803f66:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803f6d:	eb a4                	jmp    803f13 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803f6f:	48 89 df             	mov    %rbx,%rdi
+  803f72:	48 b8 60 3c 80 00 00 	movabs $0x803c60,%rax
+  803f79:	00 00 00 
+  803f7c:	ff d0                	call   *%rax
+  803f7e:	a8 01                	test   $0x1,%al
+  803f80:	74 11                	je     803f93 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803f82:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f86:	48 89 df             	mov    %rbx,%rdi
+  803f89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f8d:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803f8f:	85 c0                	test   %eax,%eax
+  803f91:	78 11                	js     803fa4 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803f93:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f9a:	e9 74 ff ff ff       	jmp    803f13 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa4:	48 83 c4 18          	add    $0x18,%rsp
+  803fa8:	5b                   	pop    %rbx
+  803fa9:	41 5c                	pop    %r12
+  803fab:	41 5d                	pop    %r13
+  803fad:	41 5e                	pop    %r14
+  803faf:	41 5f                	pop    %r15
+  803fb1:	5d                   	pop    %rbp
+  803fb2:	c3                   	ret
+    return 0;
+  803fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb8:	eb ea                	jmp    803fa4 <foreach_present_page+0xf7>
+
+0000000000803fba <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803fba:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803fc1:	7f 00 00 
+  803fc4:	a8 01                	test   $0x1,%al
+  803fc6:	75 06                	jne    803fce <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcd:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803fce:	55                   	push   %rbp
+  803fcf:	48 89 e5             	mov    %rsp,%rbp
+  803fd2:	41 57                	push   %r15
+  803fd4:	41 56                	push   %r14
+  803fd6:	41 55                	push   %r13
+  803fd8:	41 54                	push   %r12
+  803fda:	53                   	push   %rbx
+  803fdb:	48 83 ec 28          	sub    $0x28,%rsp
+  803fdf:	49 89 fe             	mov    %rdi,%r14
+  803fe2:	49 89 f7             	mov    %rsi,%r15
+  803fe5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803fec:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803fed:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803ff4:	7f 00 00 
+  803ff7:	e9 b0 00 00 00       	jmp    8040ac <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ffc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804003:	49 83 ec 01          	sub    $0x1,%r12
+  804007:	74 2d                	je     804036 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804009:	48 89 d8             	mov    %rbx,%rax
+  80400c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804010:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804015:	f6 c2 01             	test   $0x1,%dl
+  804018:	74 e2                	je     803ffc <foreach_shared_region+0x42>
+  80401a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80401f:	f6 c4 04             	test   $0x4,%ah
+  804022:	74 d8                	je     803ffc <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804024:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80402b:	4c 89 fa             	mov    %r15,%rdx
+  80402e:	48 89 df             	mov    %rbx,%rdi
+  804031:	41 ff d6             	call   *%r14
+  804034:	eb c6                	jmp    803ffc <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804036:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80403d:	00 
+  80403e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804043:	74 4c                	je     804091 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804045:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804049:	48 89 c8             	mov    %rcx,%rax
+  80404c:	48 c1 e8 15          	shr    $0x15,%rax
+  804050:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804057:	7f 00 00 
+  80405a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80405e:	a8 01                	test   $0x1,%al
+  804060:	74 d4                	je     804036 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804062:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804069:	48 39 c1             	cmp    %rax,%rcx
+  80406c:	73 c8                	jae    804036 <foreach_shared_region+0x7c>
+  80406e:	48 89 cb             	mov    %rcx,%rbx
+  804071:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804078:	48 39 d0             	cmp    %rdx,%rax
+  80407b:	4d 19 e4             	sbb    %r12,%r12
+  80407e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804085:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80408c:	e9 78 ff ff ff       	jmp    804009 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804091:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804098:	40 
+  804099:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80409d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040a4:	00 00 00 
+  8040a7:	48 39 c1             	cmp    %rax,%rcx
+  8040aa:	74 4f                	je     8040fb <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8040ac:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040b0:	48 89 c8             	mov    %rcx,%rax
+  8040b3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040b7:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8040be:	7f 00 00 
+  8040c1:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8040c5:	a8 01                	test   $0x1,%al
+  8040c7:	74 c8                	je     804091 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8040c9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8040d0:	48 39 c1             	cmp    %rax,%rcx
+  8040d3:	73 bc                	jae    804091 <foreach_shared_region+0xd7>
+  8040d5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8040dc:	48 39 d0             	cmp    %rdx,%rax
+  8040df:	48 19 c0             	sbb    %rax,%rax
+  8040e2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8040e8:	48 05 00 02 00 00    	add    $0x200,%rax
+  8040ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040f2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8040f6:	e9 4a ff ff ff       	jmp    804045 <foreach_shared_region+0x8b>
+}
+  8040fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804100:	48 83 c4 28          	add    $0x28,%rsp
+  804104:	5b                   	pop    %rbx
+  804105:	41 5c                	pop    %r12
+  804107:	41 5d                	pop    %r13
+  804109:	41 5e                	pop    %r14
+  80410b:	41 5f                	pop    %r15
+  80410d:	5d                   	pop    %rbp
+  80410e:	c3                   	ret
+
+000000000080410f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80410f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804114:	c3                   	ret
+
+0000000000804115 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804115:	55                   	push   %rbp
+  804116:	48 89 e5             	mov    %rsp,%rbp
+  804119:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80411c:	48 be ca 57 80 00 00 	movabs $0x8057ca,%rsi
+  804123:	00 00 00 
+  804126:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  80412d:	00 00 00 
+  804130:	ff d0                	call   *%rax
+    return 0;
+}
+  804132:	b8 00 00 00 00       	mov    $0x0,%eax
+  804137:	5d                   	pop    %rbp
+  804138:	c3                   	ret
+
+0000000000804139 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804139:	55                   	push   %rbp
+  80413a:	48 89 e5             	mov    %rsp,%rbp
+  80413d:	41 57                	push   %r15
+  80413f:	41 56                	push   %r14
+  804141:	41 55                	push   %r13
+  804143:	41 54                	push   %r12
+  804145:	53                   	push   %rbx
+  804146:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80414d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804154:	48 85 d2             	test   %rdx,%rdx
+  804157:	74 7a                	je     8041d3 <devcons_write+0x9a>
+  804159:	49 89 d6             	mov    %rdx,%r14
+  80415c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804162:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804167:	49 bf 59 11 80 00 00 	movabs $0x801159,%r15
+  80416e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804171:	4c 89 f3             	mov    %r14,%rbx
+  804174:	48 29 f3             	sub    %rsi,%rbx
+  804177:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80417c:	48 39 c3             	cmp    %rax,%rbx
+  80417f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804183:	4c 63 eb             	movslq %ebx,%r13
+  804186:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80418d:	48 01 c6             	add    %rax,%rsi
+  804190:	4c 89 ea             	mov    %r13,%rdx
+  804193:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80419a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80419d:	4c 89 ee             	mov    %r13,%rsi
+  8041a0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041a7:	48 b8 86 13 80 00 00 	movabs $0x801386,%rax
+  8041ae:	00 00 00 
+  8041b1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041b3:	41 01 dc             	add    %ebx,%r12d
+  8041b6:	49 63 f4             	movslq %r12d,%rsi
+  8041b9:	4c 39 f6             	cmp    %r14,%rsi
+  8041bc:	72 b3                	jb     804171 <devcons_write+0x38>
+    return res;
+  8041be:	49 63 c4             	movslq %r12d,%rax
+}
+  8041c1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041c8:	5b                   	pop    %rbx
+  8041c9:	41 5c                	pop    %r12
+  8041cb:	41 5d                	pop    %r13
+  8041cd:	41 5e                	pop    %r14
+  8041cf:	41 5f                	pop    %r15
+  8041d1:	5d                   	pop    %rbp
+  8041d2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8041d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041d9:	eb e3                	jmp    8041be <devcons_write+0x85>
+
+00000000008041db <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041db:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041e3:	48 85 c0             	test   %rax,%rax
+  8041e6:	74 60                	je     804248 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041e8:	55                   	push   %rbp
+  8041e9:	48 89 e5             	mov    %rsp,%rbp
+  8041ec:	41 55                	push   %r13
+  8041ee:	41 54                	push   %r12
+  8041f0:	53                   	push   %rbx
+  8041f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8041f5:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8041f8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8041ff:	48 bb b3 13 80 00 00 	movabs $0x8013b3,%rbx
+  804206:	00 00 00 
+  804209:	49 bc 4d 3b 80 00 00 	movabs $0x803b4d,%r12
+  804210:	00 00 00 
+  804213:	eb 07                	jmp    80421c <devcons_read+0x41>
+  804215:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804219:	41 ff d4             	call   *%r12
+  80421c:	ff d3                	call   *%rbx
+  80421e:	85 c0                	test   %eax,%eax
+  804220:	74 f3                	je     804215 <devcons_read+0x3a>
+    if (c < 0) return c;
+  804222:	48 63 d0             	movslq %eax,%rdx
+  804225:	78 13                	js     80423a <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80422c:	83 f8 04             	cmp    $0x4,%eax
+  80422f:	74 09                	je     80423a <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  804231:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804235:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80423a:	48 89 d0             	mov    %rdx,%rax
+  80423d:	48 83 c4 18          	add    $0x18,%rsp
+  804241:	5b                   	pop    %rbx
+  804242:	41 5c                	pop    %r12
+  804244:	41 5d                	pop    %r13
+  804246:	5d                   	pop    %rbp
+  804247:	c3                   	ret
+  804248:	48 89 d0             	mov    %rdx,%rax
+  80424b:	c3                   	ret
+
+000000000080424c <cputchar>:
+cputchar(int ch) {
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804254:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804258:	be 01 00 00 00       	mov    $0x1,%esi
+  80425d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804261:	48 b8 86 13 80 00 00 	movabs $0x801386,%rax
+  804268:	00 00 00 
+  80426b:	ff d0                	call   *%rax
+}
+  80426d:	c9                   	leave
+  80426e:	c3                   	ret
+
+000000000080426f <getchar>:
+getchar(void) {
+  80426f:	55                   	push   %rbp
+  804270:	48 89 e5             	mov    %rsp,%rbp
+  804273:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804277:	ba 01 00 00 00       	mov    $0x1,%edx
+  80427c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804280:	bf 00 00 00 00       	mov    $0x0,%edi
+  804285:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80428c:	00 00 00 
+  80428f:	ff d0                	call   *%rax
+  804291:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804293:	85 c0                	test   %eax,%eax
+  804295:	78 06                	js     80429d <getchar+0x2e>
+  804297:	74 08                	je     8042a1 <getchar+0x32>
+  804299:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80429d:	89 d0                	mov    %edx,%eax
+  80429f:	c9                   	leave
+  8042a0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042a1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042a6:	eb f5                	jmp    80429d <getchar+0x2e>
+
+00000000008042a8 <iscons>:
+iscons(int fdnum) {
+  8042a8:	55                   	push   %rbp
+  8042a9:	48 89 e5             	mov    %rsp,%rbp
+  8042ac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042b0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042b4:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  8042bb:	00 00 00 
+  8042be:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	78 18                	js     8042dc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042c8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042cf:	00 00 00 
+  8042d2:	8b 00                	mov    (%rax),%eax
+  8042d4:	39 02                	cmp    %eax,(%rdx)
+  8042d6:	0f 94 c0             	sete   %al
+  8042d9:	0f b6 c0             	movzbl %al,%eax
+}
+  8042dc:	c9                   	leave
+  8042dd:	c3                   	ret
+
+00000000008042de <opencons>:
+opencons(void) {
+  8042de:	55                   	push   %rbp
+  8042df:	48 89 e5             	mov    %rsp,%rbp
+  8042e2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042e6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042ea:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8042f1:	00 00 00 
+  8042f4:	ff d0                	call   *%rax
+  8042f6:	85 c0                	test   %eax,%eax
+  8042f8:	78 49                	js     804343 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8042fa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804304:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80430d:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+  804319:	85 c0                	test   %eax,%eax
+  80431b:	78 26                	js     804343 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80431d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804321:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804328:	00 00 
+  80432a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80432c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804330:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804337:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  80433e:	00 00 00 
+  804341:	ff d0                	call   *%rax
+}
+  804343:	c9                   	leave
+  804344:	c3                   	ret
+
+0000000000804345 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804345:	55                   	push   %rbp
+  804346:	48 89 e5             	mov    %rsp,%rbp
+  804349:	41 55                	push   %r13
+  80434b:	41 54                	push   %r12
+  80434d:	53                   	push   %rbx
+  80434e:	48 83 ec 08          	sub    $0x8,%rsp
+  804352:	49 89 fc             	mov    %rdi,%r12
+  804355:	48 89 f7             	mov    %rsi,%rdi
+  804358:	48 89 d3             	mov    %rdx,%rbx
+  80435b:	49 89 cd             	mov    %rcx,%r13
+  80435e:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804361:	48 85 f6             	test   %rsi,%rsi
+  804364:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80436b:	00 00 00 
+  80436e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804372:	be 00 00 00 00       	mov    $0x0,%esi
+  804377:	48 85 db             	test   %rbx,%rbx
+  80437a:	74 03                	je     80437f <ipc_recv_timeout+0x3a>
+  80437c:	48 8b 33             	mov    (%rbx),%rsi
+  80437f:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  804386:	00 00 00 
+  804389:	ff d0                	call   *%rax
+    if (res == 0) {
+  80438b:	85 c0                	test   %eax,%eax
+  80438d:	75 72                	jne    804401 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  80438f:	4d 85 e4             	test   %r12,%r12
+  804392:	74 17                	je     8043ab <ipc_recv_timeout+0x66>
+  804394:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80439b:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  80439d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043a1:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8043a7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  8043ab:	4d 85 ed             	test   %r13,%r13
+  8043ae:	74 17                	je     8043c7 <ipc_recv_timeout+0x82>
+  8043b0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043b7:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  8043b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043bd:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8043c3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  8043c7:	48 85 db             	test   %rbx,%rbx
+  8043ca:	74 17                	je     8043e3 <ipc_recv_timeout+0x9e>
+  8043cc:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043d3:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  8043d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043d9:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  8043e0:	48 89 03             	mov    %rax,(%rbx)
+  8043e3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8043ea:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8043ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043f0:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8043f6:	48 83 c4 08          	add    $0x8,%rsp
+  8043fa:	5b                   	pop    %rbx
+  8043fb:	41 5c                	pop    %r12
+  8043fd:	41 5d                	pop    %r13
+  8043ff:	5d                   	pop    %rbp
+  804400:	c3                   	ret
+        if (from_env_store) {
+  804401:	4d 85 e4             	test   %r12,%r12
+  804404:	74 08                	je     80440e <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804406:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80440d:	00 
+        if (perm_store) {
+  80440e:	4d 85 ed             	test   %r13,%r13
+  804411:	74 08                	je     80441b <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804413:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80441a:	00 
+        if (size) {
+  80441b:	48 85 db             	test   %rbx,%rbx
+  80441e:	74 d6                	je     8043f6 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804420:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804427:	eb cd                	jmp    8043f6 <ipc_recv_timeout+0xb1>
+
+0000000000804429 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804429:	55                   	push   %rbp
+  80442a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80442d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804433:	48 b8 45 43 80 00 00 	movabs $0x804345,%rax
+  80443a:	00 00 00 
+  80443d:	ff d0                	call   *%rax
+}
+  80443f:	5d                   	pop    %rbp
+  804440:	c3                   	ret
+
+0000000000804441 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804441:	55                   	push   %rbp
+  804442:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804445:	48 85 d2             	test   %rdx,%rdx
+  804448:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80444f:	00 00 00 
+  804452:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804456:	89 f6                	mov    %esi,%esi
+  804458:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80445e:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  804465:	00 00 00 
+  804468:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80446a:	85 c0                	test   %eax,%eax
+  80446c:	78 02                	js     804470 <ipc_send+0x2f>
+}
+  80446e:	5d                   	pop    %rbp
+  80446f:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804470:	89 c1                	mov    %eax,%ecx
+  804472:	48 ba d6 57 80 00 00 	movabs $0x8057d6,%rdx
+  804479:	00 00 00 
+  80447c:	be 51 00 00 00       	mov    $0x51,%esi
+  804481:	48 bf ed 57 80 00 00 	movabs $0x8057ed,%rdi
+  804488:	00 00 00 
+  80448b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804490:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  804497:	00 00 00 
+  80449a:	41 ff d0             	call   *%r8
+
+000000000080449d <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80449d:	55                   	push   %rbp
+  80449e:	48 89 e5             	mov    %rsp,%rbp
+  8044a1:	41 54                	push   %r12
+  8044a3:	53                   	push   %rbx
+  8044a4:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8044a8:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8044ac:	48 85 d2             	test   %rdx,%rdx
+  8044af:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044b6:	00 00 00 
+  8044b9:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8044bd:	4d 85 c9             	test   %r9,%r9
+  8044c0:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  8044c4:	89 f6                	mov    %esi,%esi
+  8044c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ca:	53                   	push   %rbx
+  8044cb:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  8044d2:	00 00 00 
+  8044d5:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8044d7:	48 83 c4 10          	add    $0x10,%rsp
+  8044db:	85 c0                	test   %eax,%eax
+  8044dd:	78 65                	js     804544 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8044df:	4d 85 e4             	test   %r12,%r12
+  8044e2:	74 17                	je     8044fb <ipc_call+0x5e>
+  8044e4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8044eb:	00 00 
+  8044ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044f1:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8044f7:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8044fb:	48 85 db             	test   %rbx,%rbx
+  8044fe:	74 28                	je     804528 <ipc_call+0x8b>
+  804500:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804507:	00 00 
+  804509:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80450d:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804514:	ba 20 00 00 00       	mov    $0x20,%edx
+  804519:	48 89 df             	mov    %rbx,%rdi
+  80451c:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  804523:	00 00 00 
+  804526:	ff d0                	call   *%rax
+  804528:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80452f:	00 00 
+    return thisenv->env_ipc_value;
+  804531:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804535:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80453b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80453f:	5b                   	pop    %rbx
+  804540:	41 5c                	pop    %r12
+  804542:	5d                   	pop    %rbp
+  804543:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804544:	89 c1                	mov    %eax,%ecx
+  804546:	48 ba f7 57 80 00 00 	movabs $0x8057f7,%rdx
+  80454d:	00 00 00 
+  804550:	be 62 00 00 00       	mov    $0x62,%esi
+  804555:	48 bf ed 57 80 00 00 	movabs $0x8057ed,%rdi
+  80455c:	00 00 00 
+  80455f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804564:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  80456b:	00 00 00 
+  80456e:	41 ff d0             	call   *%r8
+
+0000000000804571 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804571:	55                   	push   %rbp
+  804572:	48 89 e5             	mov    %rsp,%rbp
+  804575:	41 57                	push   %r15
+  804577:	41 56                	push   %r14
+  804579:	41 55                	push   %r13
+  80457b:	41 54                	push   %r12
+  80457d:	53                   	push   %rbx
+  80457e:	48 83 ec 20          	sub    $0x20,%rsp
+  804582:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804585:	48 89 d3             	mov    %rdx,%rbx
+  804588:	49 89 ce             	mov    %rcx,%r14
+  80458b:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80458f:	4d 89 cd             	mov    %r9,%r13
+  804592:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804596:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80459a:	48 85 d2             	test   %rdx,%rdx
+  80459d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045a4:	00 00 00 
+  8045a7:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8045ab:	4d 85 e4             	test   %r12,%r12
+  8045ae:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8045b2:	89 f0                	mov    %esi,%eax
+  8045b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8045b8:	41 57                	push   %r15
+  8045ba:	4d 89 e1             	mov    %r12,%r9
+  8045bd:	48 89 da             	mov    %rbx,%rdx
+  8045c0:	48 89 c6             	mov    %rax,%rsi
+  8045c3:	48 b8 4f 1a 80 00 00 	movabs $0x801a4f,%rax
+  8045ca:	00 00 00 
+  8045cd:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  8045cf:	48 83 c4 10          	add    $0x10,%rsp
+  8045d3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8045d6:	0f 84 93 00 00 00    	je     80466f <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8045dc:	85 c0                	test   %eax,%eax
+  8045de:	0f 88 f3 00 00 00    	js     8046d7 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8045e4:	4d 85 ed             	test   %r13,%r13
+  8045e7:	74 17                	je     804600 <ipc_reply_wait+0x8f>
+  8045e9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8045f0:	00 00 
+  8045f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045f6:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8045fc:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804600:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804605:	74 19                	je     804620 <ipc_reply_wait+0xaf>
+  804607:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80460e:	00 00 
+  804610:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804614:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80461a:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80461e:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804620:	4d 85 ff             	test   %r15,%r15
+  804623:	74 28                	je     80464d <ipc_reply_wait+0xdc>
+  804625:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80462c:	00 00 
+  80462e:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804632:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804639:	ba 20 00 00 00       	mov    $0x20,%edx
+  80463e:	4c 89 ff             	mov    %r15,%rdi
+  804641:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  804648:	00 00 00 
+  80464b:	ff d0                	call   *%rax
+  80464d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804654:	00 00 
+    return thisenv->env_ipc_value;
+  804656:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80465a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804660:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804664:	5b                   	pop    %rbx
+  804665:	41 5c                	pop    %r12
+  804667:	41 5d                	pop    %r13
+  804669:	41 5e                	pop    %r14
+  80466b:	41 5f                	pop    %r15
+  80466d:	5d                   	pop    %rbp
+  80466e:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80466f:	4d 89 f9             	mov    %r15,%r9
+  804672:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804676:	4c 89 f1             	mov    %r14,%rcx
+  804679:	48 89 da             	mov    %rbx,%rdx
+  80467c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804680:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804683:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  80468a:	00 00 00 
+  80468d:	ff d0                	call   *%rax
+  80468f:	85 c0                	test   %eax,%eax
+  804691:	78 17                	js     8046aa <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804693:	4c 89 f6             	mov    %r14,%rsi
+  804696:	4c 89 e7             	mov    %r12,%rdi
+  804699:	48 b8 91 19 80 00 00 	movabs $0x801991,%rax
+  8046a0:	00 00 00 
+  8046a3:	ff d0                	call   *%rax
+  8046a5:	e9 32 ff ff ff       	jmp    8045dc <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8046aa:	89 c1                	mov    %eax,%ecx
+  8046ac:	48 ba d6 57 80 00 00 	movabs $0x8057d6,%rdx
+  8046b3:	00 00 00 
+  8046b6:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8046bb:	48 bf ed 57 80 00 00 	movabs $0x8057ed,%rdi
+  8046c2:	00 00 00 
+  8046c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ca:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  8046d1:	00 00 00 
+  8046d4:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  8046d7:	89 c1                	mov    %eax,%ecx
+  8046d9:	48 ba 0e 58 80 00 00 	movabs $0x80580e,%rdx
+  8046e0:	00 00 00 
+  8046e3:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8046e8:	48 bf ed 57 80 00 00 	movabs $0x8057ed,%rdi
+  8046ef:	00 00 00 
+  8046f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046f7:	49 b8 ea 04 80 00 00 	movabs $0x8004ea,%r8
+  8046fe:	00 00 00 
+  804701:	41 ff d0             	call   *%r8
+
+0000000000804704 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804704:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804709:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804710:	00 00 00 
+  804713:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80471a:	48 01 ca             	add    %rcx,%rdx
+  80471d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804723:	39 fa                	cmp    %edi,%edx
+  804725:	74 12                	je     804739 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804727:	48 83 c0 01          	add    $0x1,%rax
+  80472b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804731:	75 e0                	jne    804713 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804733:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804738:	c3                   	ret
+            return envs[i].env_id;
+  804739:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804740:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804747:	00 00 00 
+  80474a:	48 01 d0             	add    %rdx,%rax
+  80474d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804753:	c3                   	ret
+
+0000000000804754 <__text_end>:
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
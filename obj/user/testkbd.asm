@@ -0,0 +1,8099 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 7c 03 00 00       	call   80039f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 8f 15 80 00 00 	movabs $0x80158f,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 38 03 80 00 00 	movabs $0x800338,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba 1c 50 80 00 00 	movabs $0x80501c,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc 3e 50 80 00 00 	movabs $0x80503e,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb 4b 13 80 00 00 	movabs $0x80134b,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be 50 50 80 00 00 	movabs $0x805050,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd ee 32 80 00 00 	movabs $0x8032ee,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba 36 50 80 00 00 	movabs $0x805036,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be 4c 50 80 00 00 	movabs $0x80504c,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be 68 50 80 00 00 	movabs $0x805068,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 24 0f 80 00 00 	movabs $0x800f24,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf 1e 11 80 00 00 	movabs $0x80111e,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 60                	je     8002a2 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 18          	sub    $0x18,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  800252:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  800259:	48 bb c2 14 80 00 00 	movabs $0x8014c2,%rbx
+  800260:	00 00 00 
+  800263:	49 bc f4 39 80 00 00 	movabs $0x8039f4,%r12
+  80026a:	00 00 00 
+  80026d:	eb 07                	jmp    800276 <devcons_read+0x41>
+  80026f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800273:	41 ff d4             	call   *%r12
+  800276:	ff d3                	call   *%rbx
+  800278:	85 c0                	test   %eax,%eax
+  80027a:	74 f3                	je     80026f <devcons_read+0x3a>
+    if (c < 0) return c;
+  80027c:	48 63 d0             	movslq %eax,%rdx
+  80027f:	78 13                	js     800294 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  800281:	ba 00 00 00 00       	mov    $0x0,%edx
+  800286:	83 f8 04             	cmp    $0x4,%eax
+  800289:	74 09                	je     800294 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80028b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80028f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800294:	48 89 d0             	mov    %rdx,%rax
+  800297:	48 83 c4 18          	add    $0x18,%rsp
+  80029b:	5b                   	pop    %rbx
+  80029c:	41 5c                	pop    %r12
+  80029e:	41 5d                	pop    %r13
+  8002a0:	5d                   	pop    %rbp
+  8002a1:	c3                   	ret
+  8002a2:	48 89 d0             	mov    %rdx,%rax
+  8002a5:	c3                   	ret
+
+00000000008002a6 <cputchar>:
+cputchar(int ch) {
+  8002a6:	55                   	push   %rbp
+  8002a7:	48 89 e5             	mov    %rsp,%rbp
+  8002aa:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002ae:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8002b7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002bb:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  8002c2:	00 00 00 
+  8002c5:	ff d0                	call   *%rax
+}
+  8002c7:	c9                   	leave
+  8002c8:	c3                   	ret
+
+00000000008002c9 <getchar>:
+getchar(void) {
+  8002c9:	55                   	push   %rbp
+  8002ca:	48 89 e5             	mov    %rsp,%rbp
+  8002cd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002d1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002d6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002df:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8002e6:	00 00 00 
+  8002e9:	ff d0                	call   *%rax
+  8002eb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002ed:	85 c0                	test   %eax,%eax
+  8002ef:	78 06                	js     8002f7 <getchar+0x2e>
+  8002f1:	74 08                	je     8002fb <getchar+0x32>
+  8002f3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002f7:	89 d0                	mov    %edx,%eax
+  8002f9:	c9                   	leave
+  8002fa:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002fb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800300:	eb f5                	jmp    8002f7 <getchar+0x2e>
+
+0000000000800302 <iscons>:
+iscons(int fdnum) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80030a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80030e:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  800315:	00 00 00 
+  800318:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80031a:	85 c0                	test   %eax,%eax
+  80031c:	78 18                	js     800336 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80031e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800322:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800329:	00 00 00 
+  80032c:	8b 00                	mov    (%rax),%eax
+  80032e:	39 02                	cmp    %eax,(%rdx)
+  800330:	0f 94 c0             	sete   %al
+  800333:	0f b6 c0             	movzbl %al,%eax
+}
+  800336:	c9                   	leave
+  800337:	c3                   	ret
+
+0000000000800338 <opencons>:
+opencons(void) {
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+  80033c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800340:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800344:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 49                	js     80039d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800354:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800359:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80035e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800362:	bf 00 00 00 00       	mov    $0x0,%edi
+  800367:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  80036e:	00 00 00 
+  800371:	ff d0                	call   *%rax
+  800373:	85 c0                	test   %eax,%eax
+  800375:	78 26                	js     80039d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800377:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80037b:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800382:	00 00 
+  800384:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800386:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80038a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800391:	48 b8 5b 1d 80 00 00 	movabs $0x801d5b,%rax
+  800398:	00 00 00 
+  80039b:	ff d0                	call   *%rax
+}
+  80039d:	c9                   	leave
+  80039e:	c3                   	ret
+
+000000000080039f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80039f:	55                   	push   %rbp
+  8003a0:	48 89 e5             	mov    %rsp,%rbp
+  8003a3:	41 56                	push   %r14
+  8003a5:	41 55                	push   %r13
+  8003a7:	41 54                	push   %r12
+  8003a9:	53                   	push   %rbx
+  8003aa:	48 83 ec 30          	sub    $0x30,%rsp
+  8003ae:	41 89 fd             	mov    %edi,%r13d
+  8003b1:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8003b4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8003bb:	00 
+  8003bc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8003c3:	00 
+  8003c4:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8003cb:	00 
+  8003cc:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8003d3:	00 
+  8003d4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003d8:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8003dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e1:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  8003e8:	00 00 00 
+  8003eb:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003ed:	48 ba b8 60 80 00 00 	movabs $0x8060b8,%rdx
+  8003f4:	00 00 00 
+  8003f7:	48 b8 b8 60 80 00 00 	movabs $0x8060b8,%rax
+  8003fe:	00 00 00 
+  800401:	48 39 c2             	cmp    %rax,%rdx
+  800404:	73 17                	jae    80041d <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800406:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800409:	49 89 c4             	mov    %rax,%r12
+  80040c:	48 83 c3 08          	add    $0x8,%rbx
+  800410:	b8 00 00 00 00       	mov    $0x0,%eax
+  800415:	ff 53 f8             	call   *-0x8(%rbx)
+  800418:	4c 39 e3             	cmp    %r12,%rbx
+  80041b:	72 ef                	jb     80040c <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80041d:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  800424:	00 00 00 
+  800427:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800429:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800430:	00 00 
+  800432:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800437:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80043e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800445:	00 00 00 
+  800448:	48 01 c8             	add    %rcx,%rax
+  80044b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80044f:	45 85 ed             	test   %r13d,%r13d
+  800452:	7e 0d                	jle    800461 <libmain+0xc2>
+  800454:	49 8b 06             	mov    (%r14),%rax
+  800457:	48 a3 38 60 80 00 00 	movabs %rax,0x806038
+  80045e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800461:	4c 89 f6             	mov    %r14,%rsi
+  800464:	44 89 ef             	mov    %r13d,%edi
+  800467:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800473:	48 b8 8c 04 80 00 00 	movabs $0x80048c,%rax
+  80047a:	00 00 00 
+  80047d:	ff d0                	call   *%rax
+#endif
+}
+  80047f:	48 83 c4 30          	add    $0x30,%rsp
+  800483:	5b                   	pop    %rbx
+  800484:	41 5c                	pop    %r12
+  800486:	41 5d                	pop    %r13
+  800488:	41 5e                	pop    %r14
+  80048a:	5d                   	pop    %rbp
+  80048b:	c3                   	ret
+
+000000000080048c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800490:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  800497:	00 00 00 
+  80049a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80049c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a1:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  8004a8:	00 00 00 
+  8004ab:	ff d0                	call   *%rax
+}
+  8004ad:	5d                   	pop    %rbp
+  8004ae:	c3                   	ret
+
+00000000008004af <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004af:	55                   	push   %rbp
+  8004b0:	48 89 e5             	mov    %rsp,%rbp
+  8004b3:	41 56                	push   %r14
+  8004b5:	41 55                	push   %r13
+  8004b7:	41 54                	push   %r12
+  8004b9:	53                   	push   %rbx
+  8004ba:	48 83 ec 50          	sub    $0x50,%rsp
+  8004be:	49 89 fc             	mov    %rdi,%r12
+  8004c1:	41 89 f5             	mov    %esi,%r13d
+  8004c4:	48 89 d3             	mov    %rdx,%rbx
+  8004c7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004cb:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004cf:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004d3:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8004da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004de:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8004e2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004e6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004ea:	48 b8 38 60 80 00 00 	movabs $0x806038,%rax
+  8004f1:	00 00 00 
+  8004f4:	4c 8b 30             	mov    (%rax),%r14
+  8004f7:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  8004fe:	00 00 00 
+  800501:	ff d0                	call   *%rax
+  800503:	89 c6                	mov    %eax,%esi
+  800505:	45 89 e8             	mov    %r13d,%r8d
+  800508:	4c 89 e1             	mov    %r12,%rcx
+  80050b:	4c 89 f2             	mov    %r14,%rdx
+  80050e:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  800515:	00 00 00 
+  800518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051d:	49 bc ff 05 80 00 00 	movabs $0x8005ff,%r12
+  800524:	00 00 00 
+  800527:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80052a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80052e:	48 89 df             	mov    %rbx,%rdi
+  800531:	48 b8 9b 05 80 00 00 	movabs $0x80059b,%rax
+  800538:	00 00 00 
+  80053b:	ff d0                	call   *%rax
+    cprintf("\n");
+  80053d:	48 bf 66 50 80 00 00 	movabs $0x805066,%rdi
+  800544:	00 00 00 
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80054f:	cc                   	int3
+  800550:	eb fd                	jmp    80054f <_panic+0xa0>
+
+0000000000800552 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800552:	55                   	push   %rbp
+  800553:	48 89 e5             	mov    %rsp,%rbp
+  800556:	53                   	push   %rbx
+  800557:	48 83 ec 08          	sub    $0x8,%rsp
+  80055b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80055e:	8b 06                	mov    (%rsi),%eax
+  800560:	8d 50 01             	lea    0x1(%rax),%edx
+  800563:	89 16                	mov    %edx,(%rsi)
+  800565:	48 98                	cltq
+  800567:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80056c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800572:	74 0a                	je     80057e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800574:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800578:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80057c:	c9                   	leave
+  80057d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80057e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800582:	be ff 00 00 00       	mov    $0xff,%esi
+  800587:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+        state->offset = 0;
+  800593:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800599:	eb d9                	jmp    800574 <putch+0x22>
+
+000000000080059b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80059b:	55                   	push   %rbp
+  80059c:	48 89 e5             	mov    %rsp,%rbp
+  80059f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005a6:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005a9:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005b0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ba:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005bd:	48 89 f1             	mov    %rsi,%rcx
+  8005c0:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005c7:	48 bf 52 05 80 00 00 	movabs $0x800552,%rdi
+  8005ce:	00 00 00 
+  8005d1:	48 b8 4f 07 80 00 00 	movabs $0x80074f,%rax
+  8005d8:	00 00 00 
+  8005db:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8005dd:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8005e4:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005eb:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  8005f2:	00 00 00 
+  8005f5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005f7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005fd:	c9                   	leave
+  8005fe:	c3                   	ret
+
+00000000008005ff <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005ff:	55                   	push   %rbp
+  800600:	48 89 e5             	mov    %rsp,%rbp
+  800603:	48 83 ec 50          	sub    $0x50,%rsp
+  800607:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80060b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80060f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800613:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800617:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80061b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800622:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800626:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80062e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800632:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800636:	48 b8 9b 05 80 00 00 	movabs $0x80059b,%rax
+  80063d:	00 00 00 
+  800640:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+0000000000800644 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800644:	55                   	push   %rbp
+  800645:	48 89 e5             	mov    %rsp,%rbp
+  800648:	41 57                	push   %r15
+  80064a:	41 56                	push   %r14
+  80064c:	41 55                	push   %r13
+  80064e:	41 54                	push   %r12
+  800650:	53                   	push   %rbx
+  800651:	48 83 ec 18          	sub    $0x18,%rsp
+  800655:	49 89 fc             	mov    %rdi,%r12
+  800658:	49 89 f5             	mov    %rsi,%r13
+  80065b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80065f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800662:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800665:	41 89 cf             	mov    %ecx,%r15d
+  800668:	4c 39 fa             	cmp    %r15,%rdx
+  80066b:	73 5b                	jae    8006c8 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80066d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800671:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800675:	85 db                	test   %ebx,%ebx
+  800677:	7e 0e                	jle    800687 <print_num+0x43>
+            putch(padc, put_arg);
+  800679:	4c 89 ee             	mov    %r13,%rsi
+  80067c:	44 89 f7             	mov    %r14d,%edi
+  80067f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800682:	83 eb 01             	sub    $0x1,%ebx
+  800685:	75 f2                	jne    800679 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800687:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80068b:	48 b9 b4 50 80 00 00 	movabs $0x8050b4,%rcx
+  800692:	00 00 00 
+  800695:	48 b8 a3 50 80 00 00 	movabs $0x8050a3,%rax
+  80069c:	00 00 00 
+  80069f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ac:	49 f7 f7             	div    %r15
+  8006af:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006b3:	4c 89 ee             	mov    %r13,%rsi
+  8006b6:	41 ff d4             	call   *%r12
+}
+  8006b9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006bd:	5b                   	pop    %rbx
+  8006be:	41 5c                	pop    %r12
+  8006c0:	41 5d                	pop    %r13
+  8006c2:	41 5e                	pop    %r14
+  8006c4:	41 5f                	pop    %r15
+  8006c6:	5d                   	pop    %rbp
+  8006c7:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d1:	49 f7 f7             	div    %r15
+  8006d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d8:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8006dc:	52                   	push   %rdx
+  8006dd:	45 0f be c9          	movsbl %r9b,%r9d
+  8006e1:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006e5:	48 89 c2             	mov    %rax,%rdx
+  8006e8:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  8006ef:	00 00 00 
+  8006f2:	ff d0                	call   *%rax
+  8006f4:	48 83 c4 10          	add    $0x10,%rsp
+  8006f8:	eb 8d                	jmp    800687 <print_num+0x43>
+
+00000000008006fa <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006fa:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006fe:	48 8b 06             	mov    (%rsi),%rax
+  800701:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800705:	73 0a                	jae    800711 <sprintputch+0x17>
+        *state->start++ = ch;
+  800707:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80070b:	48 89 16             	mov    %rdx,(%rsi)
+  80070e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800711:	c3                   	ret
+
+0000000000800712 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800712:	55                   	push   %rbp
+  800713:	48 89 e5             	mov    %rsp,%rbp
+  800716:	48 83 ec 50          	sub    $0x50,%rsp
+  80071a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80071e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800722:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800726:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80072d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800731:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800735:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800739:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80073d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800741:	48 b8 4f 07 80 00 00 	movabs $0x80074f,%rax
+  800748:	00 00 00 
+  80074b:	ff d0                	call   *%rax
+}
+  80074d:	c9                   	leave
+  80074e:	c3                   	ret
+
+000000000080074f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80074f:	55                   	push   %rbp
+  800750:	48 89 e5             	mov    %rsp,%rbp
+  800753:	41 57                	push   %r15
+  800755:	41 56                	push   %r14
+  800757:	41 55                	push   %r13
+  800759:	41 54                	push   %r12
+  80075b:	53                   	push   %rbx
+  80075c:	48 83 ec 38          	sub    $0x38,%rsp
+  800760:	49 89 fe             	mov    %rdi,%r14
+  800763:	49 89 f5             	mov    %rsi,%r13
+  800766:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800769:	48 8b 01             	mov    (%rcx),%rax
+  80076c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800770:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800778:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80077c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800780:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800784:	0f b6 3b             	movzbl (%rbx),%edi
+  800787:	40 80 ff 25          	cmp    $0x25,%dil
+  80078b:	74 18                	je     8007a5 <vprintfmt+0x56>
+            if (!ch) return;
+  80078d:	40 84 ff             	test   %dil,%dil
+  800790:	0f 84 b1 06 00 00    	je     800e47 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800796:	40 0f b6 ff          	movzbl %dil,%edi
+  80079a:	4c 89 ee             	mov    %r13,%rsi
+  80079d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007a0:	4c 89 e3             	mov    %r12,%rbx
+  8007a3:	eb db                	jmp    800780 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8007aa:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007ae:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007b3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007b9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007c0:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007c4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007c9:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007ce:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007d1:	83 e8 23             	sub    $0x23,%eax
+  8007d4:	3c 57                	cmp    $0x57,%al
+  8007d6:	0f 87 51 06 00 00    	ja     800e2d <vprintfmt+0x6de>
+  8007dc:	0f b6 c0             	movzbl %al,%eax
+  8007df:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  8007e6:	00 00 00 
+  8007e9:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007ec:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007ef:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007f3:	eb cf                	jmp    8007c4 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007f5:	49 89 dc             	mov    %rbx,%r12
+  8007f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8007fd:	eb c5                	jmp    8007c4 <vprintfmt+0x75>
+            padc = ch;
+  8007ff:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800803:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800806:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800809:	eb b9                	jmp    8007c4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 24                	ja     800837 <vprintfmt+0xe8>
+  800813:	89 c1                	mov    %eax,%ecx
+  800815:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800822:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800825:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800829:	79 99                	jns    8007c4 <vprintfmt+0x75>
+                width = precision;
+  80082b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80082f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800835:	eb 8d                	jmp    8007c4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800837:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80083b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80083f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800843:	eb da                	jmp    80081f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800845:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80084a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80084e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800854:	3c 39                	cmp    $0x39,%al
+  800856:	77 1c                	ja     800874 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800858:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80085c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800860:	0f b6 c0             	movzbl %al,%eax
+  800863:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800868:	0f b6 03             	movzbl (%rbx),%eax
+  80086b:	3c 39                	cmp    $0x39,%al
+  80086d:	76 e9                	jbe    800858 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80086f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800872:	eb b1                	jmp    800825 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800874:	49 89 dc             	mov    %rbx,%r12
+  800877:	eb ac                	jmp    800825 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800879:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80087c:	85 c9                	test   %ecx,%ecx
+  80087e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800883:	0f 49 c1             	cmovns %ecx,%eax
+  800886:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800889:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80088c:	e9 33 ff ff ff       	jmp    8007c4 <vprintfmt+0x75>
+            lflag++;
+  800891:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800894:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800897:	e9 28 ff ff ff       	jmp    8007c4 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80089c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089f:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a2:	77 19                	ja     8008bd <vprintfmt+0x16e>
+  8008a4:	89 c2                	mov    %eax,%edx
+  8008a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008aa:	83 c0 08             	add    $0x8,%eax
+  8008ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b0:	8b 3a                	mov    (%rdx),%edi
+  8008b2:	4c 89 ee             	mov    %r13,%rsi
+  8008b5:	41 ff d6             	call   *%r14
+            break;
+  8008b8:	e9 c3 fe ff ff       	jmp    800780 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c9:	eb e5                	jmp    8008b0 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 5a                	ja     80092d <vprintfmt+0x1de>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8008df:	8b 02                	mov    (%rdx),%eax
+  8008e1:	89 c1                	mov    %eax,%ecx
+  8008e3:	f7 d9                	neg    %ecx
+  8008e5:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008e8:	83 f9 16             	cmp    $0x16,%ecx
+  8008eb:	7f 4e                	jg     80093b <vprintfmt+0x1ec>
+  8008ed:	48 63 c1             	movslq %ecx,%rax
+  8008f0:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8008f7:	00 00 00 
+  8008fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008fe:	48 85 c0             	test   %rax,%rax
+  800901:	74 38                	je     80093b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800903:	48 89 c1             	mov    %rax,%rcx
+  800906:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  80090d:	00 00 00 
+  800910:	4c 89 ee             	mov    %r13,%rsi
+  800913:	4c 89 f7             	mov    %r14,%rdi
+  800916:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091b:	49 b8 12 07 80 00 00 	movabs $0x800712,%r8
+  800922:	00 00 00 
+  800925:	41 ff d0             	call   *%r8
+  800928:	e9 53 fe ff ff       	jmp    800780 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80092d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800931:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800939:	eb a4                	jmp    8008df <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80093b:	48 ba cc 50 80 00 00 	movabs $0x8050cc,%rdx
+  800942:	00 00 00 
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	4c 89 f7             	mov    %r14,%rdi
+  80094b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800950:	49 b8 12 07 80 00 00 	movabs $0x800712,%r8
+  800957:	00 00 00 
+  80095a:	41 ff d0             	call   *%r8
+  80095d:	e9 1e fe ff ff       	jmp    800780 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800962:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800965:	83 f8 2f             	cmp    $0x2f,%eax
+  800968:	77 6c                	ja     8009d6 <vprintfmt+0x287>
+  80096a:	89 c2                	mov    %eax,%edx
+  80096c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800970:	83 c0 08             	add    $0x8,%eax
+  800973:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800976:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800979:	48 85 d2             	test   %rdx,%rdx
+  80097c:	48 b8 c5 50 80 00 00 	movabs $0x8050c5,%rax
+  800983:	00 00 00 
+  800986:	48 0f 45 c2          	cmovne %rdx,%rax
+  80098a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80098e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800992:	7e 06                	jle    80099a <vprintfmt+0x24b>
+  800994:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800998:	75 4a                	jne    8009e4 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80099a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80099e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009a2:	0f b6 00             	movzbl (%rax),%eax
+  8009a5:	84 c0                	test   %al,%al
+  8009a7:	0f 85 9a 00 00 00    	jne    800a47 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009b4:	85 c0                	test   %eax,%eax
+  8009b6:	0f 8e c4 fd ff ff    	jle    800780 <vprintfmt+0x31>
+  8009bc:	4c 89 ee             	mov    %r13,%rsi
+  8009bf:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009c4:	41 ff d6             	call   *%r14
+  8009c7:	41 83 ec 01          	sub    $0x1,%r12d
+  8009cb:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009cf:	75 eb                	jne    8009bc <vprintfmt+0x26d>
+  8009d1:	e9 aa fd ff ff       	jmp    800780 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	eb 92                	jmp    800976 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8009e4:	49 63 f7             	movslq %r15d,%rsi
+  8009e7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009eb:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  8009f2:	00 00 00 
+  8009f5:	ff d0                	call   *%rax
+  8009f7:	48 89 c2             	mov    %rax,%rdx
+  8009fa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009fd:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009ff:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a02:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a05:	85 c0                	test   %eax,%eax
+  800a07:	7e 91                	jle    80099a <vprintfmt+0x24b>
+  800a09:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a0e:	4c 89 ee             	mov    %r13,%rsi
+  800a11:	44 89 e7             	mov    %r12d,%edi
+  800a14:	41 ff d6             	call   *%r14
+  800a17:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a1b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a1e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a21:	75 eb                	jne    800a0e <vprintfmt+0x2bf>
+  800a23:	e9 72 ff ff ff       	jmp    80099a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a28:	0f b6 f8             	movzbl %al,%edi
+  800a2b:	4c 89 ee             	mov    %r13,%rsi
+  800a2e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a31:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a35:	49 83 c4 01          	add    $0x1,%r12
+  800a39:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a3f:	84 c0                	test   %al,%al
+  800a41:	0f 84 66 ff ff ff    	je     8009ad <vprintfmt+0x25e>
+  800a47:	45 85 ff             	test   %r15d,%r15d
+  800a4a:	78 0a                	js     800a56 <vprintfmt+0x307>
+  800a4c:	41 83 ef 01          	sub    $0x1,%r15d
+  800a50:	0f 88 57 ff ff ff    	js     8009ad <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a56:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a5a:	74 cc                	je     800a28 <vprintfmt+0x2d9>
+  800a5c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a5f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a64:	80 fa 5e             	cmp    $0x5e,%dl
+  800a67:	77 c2                	ja     800a2b <vprintfmt+0x2dc>
+  800a69:	eb bd                	jmp    800a28 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6b:	40 84 f6             	test   %sil,%sil
+  800a6e:	75 26                	jne    800a96 <vprintfmt+0x347>
+    switch (lflag) {
+  800a70:	85 d2                	test   %edx,%edx
+  800a72:	74 59                	je     800acd <vprintfmt+0x37e>
+  800a74:	83 fa 01             	cmp    $0x1,%edx
+  800a77:	74 7b                	je     800af4 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7f:	0f 87 96 00 00 00    	ja     800b1b <vprintfmt+0x3cc>
+  800a85:	89 c2                	mov    %eax,%edx
+  800a87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8b:	83 c0 08             	add    $0x8,%eax
+  800a8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a91:	4c 8b 22             	mov    (%rdx),%r12
+  800a94:	eb 17                	jmp    800aad <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a99:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9c:	77 21                	ja     800abf <vprintfmt+0x370>
+  800a9e:	89 c2                	mov    %eax,%edx
+  800aa0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa4:	83 c0 08             	add    $0x8,%eax
+  800aa7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aaa:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800aad:	4d 85 e4             	test   %r12,%r12
+  800ab0:	78 7a                	js     800b2c <vprintfmt+0x3dd>
+            num = i;
+  800ab2:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800ab5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800aba:	e9 50 02 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800abf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acb:	eb dd                	jmp    800aaa <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800acd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad3:	77 11                	ja     800ae6 <vprintfmt+0x397>
+  800ad5:	89 c2                	mov    %eax,%edx
+  800ad7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adb:	83 c0 08             	add    $0x8,%eax
+  800ade:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae1:	4c 63 22             	movslq (%rdx),%r12
+  800ae4:	eb c7                	jmp    800aad <vprintfmt+0x35e>
+  800ae6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af2:	eb ed                	jmp    800ae1 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800af4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af7:	83 f8 2f             	cmp    $0x2f,%eax
+  800afa:	77 11                	ja     800b0d <vprintfmt+0x3be>
+  800afc:	89 c2                	mov    %eax,%edx
+  800afe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b02:	83 c0 08             	add    $0x8,%eax
+  800b05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b08:	4c 8b 22             	mov    (%rdx),%r12
+  800b0b:	eb a0                	jmp    800aad <vprintfmt+0x35e>
+  800b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b19:	eb ed                	jmp    800b08 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	e9 65 ff ff ff       	jmp    800a91 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b2c:	4c 89 ee             	mov    %r13,%rsi
+  800b2f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b34:	41 ff d6             	call   *%r14
+                i = -i;
+  800b37:	49 f7 dc             	neg    %r12
+  800b3a:	e9 73 ff ff ff       	jmp    800ab2 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3f:	40 84 f6             	test   %sil,%sil
+  800b42:	75 32                	jne    800b76 <vprintfmt+0x427>
+    switch (lflag) {
+  800b44:	85 d2                	test   %edx,%edx
+  800b46:	74 5d                	je     800ba5 <vprintfmt+0x456>
+  800b48:	83 fa 01             	cmp    $0x1,%edx
+  800b4b:	0f 84 82 00 00 00    	je     800bd3 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b54:	83 f8 2f             	cmp    $0x2f,%eax
+  800b57:	0f 87 a5 00 00 00    	ja     800c02 <vprintfmt+0x4b3>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b6c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b71:	e9 99 01 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b79:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7c:	77 19                	ja     800b97 <vprintfmt+0x448>
+  800b7e:	89 c2                	mov    %eax,%edx
+  800b80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b84:	83 c0 08             	add    $0x8,%eax
+  800b87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b8d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b92:	e9 78 01 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+  800b97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba3:	eb e5                	jmp    800b8a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ba5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bab:	77 18                	ja     800bc5 <vprintfmt+0x476>
+  800bad:	89 c2                	mov    %eax,%edx
+  800baf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb3:	83 c0 08             	add    $0x8,%eax
+  800bb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800bbb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bc0:	e9 4a 01 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+  800bc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd1:	eb e6                	jmp    800bb9 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800bd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd9:	77 19                	ja     800bf4 <vprintfmt+0x4a5>
+  800bdb:	89 c2                	mov    %eax,%edx
+  800bdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be1:	83 c0 08             	add    $0x8,%eax
+  800be4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800bef:	e9 1b 01 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+  800bf4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bfc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c00:	eb e5                	jmp    800be7 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0e:	e9 56 ff ff ff       	jmp    800b69 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c13:	40 84 f6             	test   %sil,%sil
+  800c16:	75 2e                	jne    800c46 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c18:	85 d2                	test   %edx,%edx
+  800c1a:	74 59                	je     800c75 <vprintfmt+0x526>
+  800c1c:	83 fa 01             	cmp    $0x1,%edx
+  800c1f:	74 7f                	je     800ca0 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c24:	83 f8 2f             	cmp    $0x2f,%eax
+  800c27:	0f 87 9f 00 00 00    	ja     800ccc <vprintfmt+0x57d>
+  800c2d:	89 c2                	mov    %eax,%edx
+  800c2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c33:	83 c0 08             	add    $0x8,%eax
+  800c36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c3c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c41:	e9 c9 00 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c49:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4c:	77 19                	ja     800c67 <vprintfmt+0x518>
+  800c4e:	89 c2                	mov    %eax,%edx
+  800c50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c54:	83 c0 08             	add    $0x8,%eax
+  800c57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c5d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c62:	e9 a8 00 00 00       	jmp    800d0f <vprintfmt+0x5c0>
+  800c67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c73:	eb e5                	jmp    800c5a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c78:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7b:	77 15                	ja     800c92 <vprintfmt+0x543>
+  800c7d:	89 c2                	mov    %eax,%edx
+  800c7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c83:	83 c0 08             	add    $0x8,%eax
+  800c86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c89:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c8b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c90:	eb 7d                	jmp    800d0f <vprintfmt+0x5c0>
+  800c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9e:	eb e9                	jmp    800c89 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ca0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca6:	77 16                	ja     800cbe <vprintfmt+0x56f>
+  800ca8:	89 c2                	mov    %eax,%edx
+  800caa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cae:	83 c0 08             	add    $0x8,%eax
+  800cb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cb7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cbc:	eb 51                	jmp    800d0f <vprintfmt+0x5c0>
+  800cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cca:	eb e8                	jmp    800cb4 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ccc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd8:	e9 5c ff ff ff       	jmp    800c39 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800cdd:	4c 89 ee             	mov    %r13,%rsi
+  800ce0:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ce5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ce8:	4c 89 ee             	mov    %r13,%rsi
+  800ceb:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cf0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf9:	77 47                	ja     800d42 <vprintfmt+0x5f3>
+  800cfb:	89 c2                	mov    %eax,%edx
+  800cfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d01:	83 c0 08             	add    $0x8,%eax
+  800d04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  800d13:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d17:	0f 94 c0             	sete   %al
+  800d1a:	0f b6 c0             	movzbl %al,%eax
+  800d1d:	50                   	push   %rax
+  800d1e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d23:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d27:	4c 89 ee             	mov    %r13,%rsi
+  800d2a:	4c 89 f7             	mov    %r14,%rdi
+  800d2d:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  800d34:	00 00 00 
+  800d37:	ff d0                	call   *%rax
+            break;
+  800d39:	48 83 c4 10          	add    $0x10,%rsp
+  800d3d:	e9 3e fa ff ff       	jmp    800780 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4e:	eb b7                	jmp    800d07 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d50:	40 84 f6             	test   %sil,%sil
+  800d53:	75 2b                	jne    800d80 <vprintfmt+0x631>
+    switch (lflag) {
+  800d55:	85 d2                	test   %edx,%edx
+  800d57:	74 56                	je     800daf <vprintfmt+0x660>
+  800d59:	83 fa 01             	cmp    $0x1,%edx
+  800d5c:	74 7f                	je     800ddd <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d61:	83 f8 2f             	cmp    $0x2f,%eax
+  800d64:	0f 87 a2 00 00 00    	ja     800e0c <vprintfmt+0x6bd>
+  800d6a:	89 c2                	mov    %eax,%edx
+  800d6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d70:	83 c0 08             	add    $0x8,%eax
+  800d73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d76:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d79:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d7e:	eb 8f                	jmp    800d0f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d83:	83 f8 2f             	cmp    $0x2f,%eax
+  800d86:	77 19                	ja     800da1 <vprintfmt+0x652>
+  800d88:	89 c2                	mov    %eax,%edx
+  800d8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d8e:	83 c0 08             	add    $0x8,%eax
+  800d91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d94:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d97:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d9c:	e9 6e ff ff ff       	jmp    800d0f <vprintfmt+0x5c0>
+  800da1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dad:	eb e5                	jmp    800d94 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800daf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db2:	83 f8 2f             	cmp    $0x2f,%eax
+  800db5:	77 18                	ja     800dcf <vprintfmt+0x680>
+  800db7:	89 c2                	mov    %eax,%edx
+  800db9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dbd:	83 c0 08             	add    $0x8,%eax
+  800dc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc3:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800dc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800dca:	e9 40 ff ff ff       	jmp    800d0f <vprintfmt+0x5c0>
+  800dcf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddb:	eb e6                	jmp    800dc3 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ddd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de0:	83 f8 2f             	cmp    $0x2f,%eax
+  800de3:	77 19                	ja     800dfe <vprintfmt+0x6af>
+  800de5:	89 c2                	mov    %eax,%edx
+  800de7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800deb:	83 c0 08             	add    $0x8,%eax
+  800dee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800df4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800df9:	e9 11 ff ff ff       	jmp    800d0f <vprintfmt+0x5c0>
+  800dfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0a:	eb e5                	jmp    800df1 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e18:	e9 59 ff ff ff       	jmp    800d76 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e1d:	4c 89 ee             	mov    %r13,%rsi
+  800e20:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e25:	41 ff d6             	call   *%r14
+            break;
+  800e28:	e9 53 f9 ff ff       	jmp    800780 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e2d:	4c 89 ee             	mov    %r13,%rsi
+  800e30:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e35:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e38:	48 83 eb 01          	sub    $0x1,%rbx
+  800e3c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e40:	75 f6                	jne    800e38 <vprintfmt+0x6e9>
+  800e42:	e9 39 f9 ff ff       	jmp    800780 <vprintfmt+0x31>
+}
+  800e47:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e4b:	5b                   	pop    %rbx
+  800e4c:	41 5c                	pop    %r12
+  800e4e:	41 5d                	pop    %r13
+  800e50:	41 5e                	pop    %r14
+  800e52:	41 5f                	pop    %r15
+  800e54:	5d                   	pop    %rbp
+  800e55:	c3                   	ret
+
+0000000000800e56 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e56:	55                   	push   %rbp
+  800e57:	48 89 e5             	mov    %rsp,%rbp
+  800e5a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e5e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e62:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e67:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e6b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e72:	48 85 ff             	test   %rdi,%rdi
+  800e75:	74 2b                	je     800ea2 <vsnprintf+0x4c>
+  800e77:	48 85 f6             	test   %rsi,%rsi
+  800e7a:	74 26                	je     800ea2 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e7c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e80:	48 bf fa 06 80 00 00 	movabs $0x8006fa,%rdi
+  800e87:	00 00 00 
+  800e8a:	48 b8 4f 07 80 00 00 	movabs $0x80074f,%rax
+  800e91:	00 00 00 
+  800e94:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e9a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e9d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ea0:	c9                   	leave
+  800ea1:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ea2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ea7:	eb f7                	jmp    800ea0 <vsnprintf+0x4a>
+
+0000000000800ea9 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ea9:	55                   	push   %rbp
+  800eaa:	48 89 e5             	mov    %rsp,%rbp
+  800ead:	48 83 ec 50          	sub    $0x50,%rsp
+  800eb1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800eb5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800eb9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ebd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ec4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ecc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ed0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ed4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ed8:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  800edf:	00 00 00 
+  800ee2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ee4:	c9                   	leave
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ee6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ee9:	74 10                	je     800efb <strlen+0x15>
+    size_t n = 0;
+  800eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ef0:	48 83 c0 01          	add    $0x1,%rax
+  800ef4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ef8:	75 f6                	jne    800ef0 <strlen+0xa>
+  800efa:	c3                   	ret
+    size_t n = 0;
+  800efb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f00:	c3                   	ret
+
+0000000000800f01 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f01:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f04:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f09:	48 85 f6             	test   %rsi,%rsi
+  800f0c:	74 11                	je     800f1f <strnlen+0x1e>
+  800f0e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f12:	74 0c                	je     800f20 <strnlen+0x1f>
+  800f14:	48 83 c2 01          	add    $0x1,%rdx
+  800f18:	48 39 d0             	cmp    %rdx,%rax
+  800f1b:	75 f1                	jne    800f0e <strnlen+0xd>
+  800f1d:	eb 04                	jmp    800f23 <strnlen+0x22>
+  800f1f:	c3                   	ret
+  800f20:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f23:	c3                   	ret
+
+0000000000800f24 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f24:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f30:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f33:	48 83 c2 01          	add    $0x1,%rdx
+  800f37:	84 c9                	test   %cl,%cl
+  800f39:	75 f1                	jne    800f2c <strcpy+0x8>
+        ;
+    return res;
+}
+  800f3b:	c3                   	ret
+
+0000000000800f3c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f3c:	55                   	push   %rbp
+  800f3d:	48 89 e5             	mov    %rsp,%rbp
+  800f40:	41 54                	push   %r12
+  800f42:	53                   	push   %rbx
+  800f43:	48 89 fb             	mov    %rdi,%rbx
+  800f46:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f49:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  800f50:	00 00 00 
+  800f53:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f55:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f59:	4c 89 e6             	mov    %r12,%rsi
+  800f5c:	48 b8 24 0f 80 00 00 	movabs $0x800f24,%rax
+  800f63:	00 00 00 
+  800f66:	ff d0                	call   *%rax
+    return dst;
+}
+  800f68:	48 89 d8             	mov    %rbx,%rax
+  800f6b:	5b                   	pop    %rbx
+  800f6c:	41 5c                	pop    %r12
+  800f6e:	5d                   	pop    %rbp
+  800f6f:	c3                   	ret
+
+0000000000800f70 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f70:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f73:	48 85 d2             	test   %rdx,%rdx
+  800f76:	74 1f                	je     800f97 <strncpy+0x27>
+  800f78:	48 01 fa             	add    %rdi,%rdx
+  800f7b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f7e:	48 83 c1 01          	add    $0x1,%rcx
+  800f82:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f86:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f8a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f8e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f92:	48 39 ca             	cmp    %rcx,%rdx
+  800f95:	75 e7                	jne    800f7e <strncpy+0xe>
+    }
+    return ret;
+}
+  800f97:	c3                   	ret
+
+0000000000800f98 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f98:	48 89 f8             	mov    %rdi,%rax
+  800f9b:	48 85 d2             	test   %rdx,%rdx
+  800f9e:	74 24                	je     800fc4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fa0:	48 83 ea 01          	sub    $0x1,%rdx
+  800fa4:	74 1b                	je     800fc1 <strlcpy+0x29>
+  800fa6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800faa:	0f b6 16             	movzbl (%rsi),%edx
+  800fad:	84 d2                	test   %dl,%dl
+  800faf:	74 10                	je     800fc1 <strlcpy+0x29>
+            *dst++ = *src++;
+  800fb1:	48 83 c6 01          	add    $0x1,%rsi
+  800fb5:	48 83 c0 01          	add    $0x1,%rax
+  800fb9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fbc:	48 39 c8             	cmp    %rcx,%rax
+  800fbf:	75 e9                	jne    800faa <strlcpy+0x12>
+        *dst = '\0';
+  800fc1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fc4:	48 29 f8             	sub    %rdi,%rax
+}
+  800fc7:	c3                   	ret
+
+0000000000800fc8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fc8:	0f b6 07             	movzbl (%rdi),%eax
+  800fcb:	84 c0                	test   %al,%al
+  800fcd:	74 13                	je     800fe2 <strcmp+0x1a>
+  800fcf:	38 06                	cmp    %al,(%rsi)
+  800fd1:	75 0f                	jne    800fe2 <strcmp+0x1a>
+  800fd3:	48 83 c7 01          	add    $0x1,%rdi
+  800fd7:	48 83 c6 01          	add    $0x1,%rsi
+  800fdb:	0f b6 07             	movzbl (%rdi),%eax
+  800fde:	84 c0                	test   %al,%al
+  800fe0:	75 ed                	jne    800fcf <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fe2:	0f b6 c0             	movzbl %al,%eax
+  800fe5:	0f b6 16             	movzbl (%rsi),%edx
+  800fe8:	29 d0                	sub    %edx,%eax
+}
+  800fea:	c3                   	ret
+
+0000000000800feb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800feb:	48 85 d2             	test   %rdx,%rdx
+  800fee:	74 1f                	je     80100f <strncmp+0x24>
+  800ff0:	0f b6 07             	movzbl (%rdi),%eax
+  800ff3:	84 c0                	test   %al,%al
+  800ff5:	74 1e                	je     801015 <strncmp+0x2a>
+  800ff7:	3a 06                	cmp    (%rsi),%al
+  800ff9:	75 1a                	jne    801015 <strncmp+0x2a>
+  800ffb:	48 83 c7 01          	add    $0x1,%rdi
+  800fff:	48 83 c6 01          	add    $0x1,%rsi
+  801003:	48 83 ea 01          	sub    $0x1,%rdx
+  801007:	75 e7                	jne    800ff0 <strncmp+0x5>
+
+    if (!n) return 0;
+  801009:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100e:	c3                   	ret
+  80100f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801014:	c3                   	ret
+  801015:	48 85 d2             	test   %rdx,%rdx
+  801018:	74 09                	je     801023 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80101a:	0f b6 07             	movzbl (%rdi),%eax
+  80101d:	0f b6 16             	movzbl (%rsi),%edx
+  801020:	29 d0                	sub    %edx,%eax
+  801022:	c3                   	ret
+    if (!n) return 0;
+  801023:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801028:	c3                   	ret
+
+0000000000801029 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801029:	0f b6 17             	movzbl (%rdi),%edx
+  80102c:	84 d2                	test   %dl,%dl
+  80102e:	74 18                	je     801048 <strchr+0x1f>
+        if (*str == c) {
+  801030:	0f be d2             	movsbl %dl,%edx
+  801033:	39 f2                	cmp    %esi,%edx
+  801035:	74 17                	je     80104e <strchr+0x25>
+    for (; *str; str++) {
+  801037:	48 83 c7 01          	add    $0x1,%rdi
+  80103b:	0f b6 17             	movzbl (%rdi),%edx
+  80103e:	84 d2                	test   %dl,%dl
+  801040:	75 ee                	jne    801030 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801042:	b8 00 00 00 00       	mov    $0x0,%eax
+  801047:	c3                   	ret
+  801048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104d:	c3                   	ret
+  80104e:	48 89 f8             	mov    %rdi,%rax
+}
+  801051:	c3                   	ret
+
+0000000000801052 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801052:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801055:	0f b6 17             	movzbl (%rdi),%edx
+  801058:	84 d2                	test   %dl,%dl
+  80105a:	74 13                	je     80106f <strfind+0x1d>
+  80105c:	0f be d2             	movsbl %dl,%edx
+  80105f:	39 f2                	cmp    %esi,%edx
+  801061:	74 0b                	je     80106e <strfind+0x1c>
+  801063:	48 83 c0 01          	add    $0x1,%rax
+  801067:	0f b6 10             	movzbl (%rax),%edx
+  80106a:	84 d2                	test   %dl,%dl
+  80106c:	75 ee                	jne    80105c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80106e:	c3                   	ret
+  80106f:	c3                   	ret
+
+0000000000801070 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801070:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801073:	48 89 f8             	mov    %rdi,%rax
+  801076:	48 f7 d8             	neg    %rax
+  801079:	83 e0 07             	and    $0x7,%eax
+  80107c:	49 89 d1             	mov    %rdx,%r9
+  80107f:	49 29 c1             	sub    %rax,%r9
+  801082:	78 36                	js     8010ba <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801084:	40 0f b6 c6          	movzbl %sil,%eax
+  801088:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80108f:	01 01 01 
+  801092:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801096:	40 f6 c7 07          	test   $0x7,%dil
+  80109a:	75 38                	jne    8010d4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80109c:	4c 89 c9             	mov    %r9,%rcx
+  80109f:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010a3:	74 0c                	je     8010b1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010a5:	fc                   	cld
+  8010a6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010a9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010ad:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010b1:	4d 85 c9             	test   %r9,%r9
+  8010b4:	75 45                	jne    8010fb <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010b6:	4c 89 c0             	mov    %r8,%rax
+  8010b9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010ba:	48 85 d2             	test   %rdx,%rdx
+  8010bd:	74 f7                	je     8010b6 <memset+0x46>
+  8010bf:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010c2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010c5:	48 83 c0 01          	add    $0x1,%rax
+  8010c9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010cd:	48 39 c2             	cmp    %rax,%rdx
+  8010d0:	75 f3                	jne    8010c5 <memset+0x55>
+  8010d2:	eb e2                	jmp    8010b6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010d4:	40 f6 c7 01          	test   $0x1,%dil
+  8010d8:	74 06                	je     8010e0 <memset+0x70>
+  8010da:	88 07                	mov    %al,(%rdi)
+  8010dc:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010e0:	40 f6 c7 02          	test   $0x2,%dil
+  8010e4:	74 07                	je     8010ed <memset+0x7d>
+  8010e6:	66 89 07             	mov    %ax,(%rdi)
+  8010e9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010ed:	40 f6 c7 04          	test   $0x4,%dil
+  8010f1:	74 a9                	je     80109c <memset+0x2c>
+  8010f3:	89 07                	mov    %eax,(%rdi)
+  8010f5:	48 83 c7 04          	add    $0x4,%rdi
+  8010f9:	eb a1                	jmp    80109c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010fb:	41 f6 c1 04          	test   $0x4,%r9b
+  8010ff:	74 06                	je     801107 <memset+0x97>
+  801101:	89 07                	mov    %eax,(%rdi)
+  801103:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801107:	41 f6 c1 02          	test   $0x2,%r9b
+  80110b:	74 07                	je     801114 <memset+0xa4>
+  80110d:	66 89 07             	mov    %ax,(%rdi)
+  801110:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801114:	41 f6 c1 01          	test   $0x1,%r9b
+  801118:	74 9c                	je     8010b6 <memset+0x46>
+  80111a:	88 07                	mov    %al,(%rdi)
+  80111c:	eb 98                	jmp    8010b6 <memset+0x46>
+
+000000000080111e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80111e:	48 89 f8             	mov    %rdi,%rax
+  801121:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801124:	48 39 fe             	cmp    %rdi,%rsi
+  801127:	73 3b                	jae    801164 <memmove+0x46>
+  801129:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80112d:	48 39 d7             	cmp    %rdx,%rdi
+  801130:	73 32                	jae    801164 <memmove+0x46>
+        s += n;
+        d += n;
+  801132:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801136:	48 89 d6             	mov    %rdx,%rsi
+  801139:	48 09 fe             	or     %rdi,%rsi
+  80113c:	48 09 ce             	or     %rcx,%rsi
+  80113f:	40 f6 c6 07          	test   $0x7,%sil
+  801143:	75 12                	jne    801157 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801145:	48 83 ef 08          	sub    $0x8,%rdi
+  801149:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80114d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801151:	fd                   	std
+  801152:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801155:	fc                   	cld
+  801156:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801157:	48 83 ef 01          	sub    $0x1,%rdi
+  80115b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80115f:	fd                   	std
+  801160:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801162:	eb f1                	jmp    801155 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801164:	48 89 f2             	mov    %rsi,%rdx
+  801167:	48 09 c2             	or     %rax,%rdx
+  80116a:	48 09 ca             	or     %rcx,%rdx
+  80116d:	f6 c2 07             	test   $0x7,%dl
+  801170:	75 0c                	jne    80117e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801172:	48 c1 e9 03          	shr    $0x3,%rcx
+  801176:	48 89 c7             	mov    %rax,%rdi
+  801179:	fc                   	cld
+  80117a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80117d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80117e:	48 89 c7             	mov    %rax,%rdi
+  801181:	fc                   	cld
+  801182:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801184:	c3                   	ret
+
+0000000000801185 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801189:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  801190:	00 00 00 
+  801193:	ff d0                	call   *%rax
+}
+  801195:	5d                   	pop    %rbp
+  801196:	c3                   	ret
+
+0000000000801197 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801197:	55                   	push   %rbp
+  801198:	48 89 e5             	mov    %rsp,%rbp
+  80119b:	41 57                	push   %r15
+  80119d:	41 56                	push   %r14
+  80119f:	41 55                	push   %r13
+  8011a1:	41 54                	push   %r12
+  8011a3:	53                   	push   %rbx
+  8011a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a8:	49 89 fe             	mov    %rdi,%r14
+  8011ab:	49 89 f7             	mov    %rsi,%r15
+  8011ae:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011b1:	48 89 f7             	mov    %rsi,%rdi
+  8011b4:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  8011bb:	00 00 00 
+  8011be:	ff d0                	call   *%rax
+  8011c0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011c3:	48 89 de             	mov    %rbx,%rsi
+  8011c6:	4c 89 f7             	mov    %r14,%rdi
+  8011c9:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  8011d0:	00 00 00 
+  8011d3:	ff d0                	call   *%rax
+  8011d5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011d8:	48 39 c3             	cmp    %rax,%rbx
+  8011db:	74 36                	je     801213 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011dd:	48 89 d8             	mov    %rbx,%rax
+  8011e0:	4c 29 e8             	sub    %r13,%rax
+  8011e3:	49 39 c4             	cmp    %rax,%r12
+  8011e6:	73 31                	jae    801219 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011e8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011ed:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011f1:	4c 89 fe             	mov    %r15,%rsi
+  8011f4:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801200:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801204:	48 83 c4 08          	add    $0x8,%rsp
+  801208:	5b                   	pop    %rbx
+  801209:	41 5c                	pop    %r12
+  80120b:	41 5d                	pop    %r13
+  80120d:	41 5e                	pop    %r14
+  80120f:	41 5f                	pop    %r15
+  801211:	5d                   	pop    %rbp
+  801212:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801213:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801217:	eb eb                	jmp    801204 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801219:	48 83 eb 01          	sub    $0x1,%rbx
+  80121d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801221:	48 89 da             	mov    %rbx,%rdx
+  801224:	4c 89 fe             	mov    %r15,%rsi
+  801227:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  80122e:	00 00 00 
+  801231:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801233:	49 01 de             	add    %rbx,%r14
+  801236:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80123b:	eb c3                	jmp    801200 <strlcat+0x69>
+
+000000000080123d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80123d:	48 85 d2             	test   %rdx,%rdx
+  801240:	74 2d                	je     80126f <memcmp+0x32>
+  801242:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801247:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80124b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801250:	44 38 c1             	cmp    %r8b,%cl
+  801253:	75 0f                	jne    801264 <memcmp+0x27>
+    while (n-- > 0) {
+  801255:	48 83 c0 01          	add    $0x1,%rax
+  801259:	48 39 c2             	cmp    %rax,%rdx
+  80125c:	75 e9                	jne    801247 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80125e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801263:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801264:	0f b6 c1             	movzbl %cl,%eax
+  801267:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80126b:	44 29 c0             	sub    %r8d,%eax
+  80126e:	c3                   	ret
+    return 0;
+  80126f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801274:	c3                   	ret
+
+0000000000801275 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801275:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801279:	48 39 c7             	cmp    %rax,%rdi
+  80127c:	73 0f                	jae    80128d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80127e:	40 38 37             	cmp    %sil,(%rdi)
+  801281:	74 0e                	je     801291 <memfind+0x1c>
+    for (; src < end; src++) {
+  801283:	48 83 c7 01          	add    $0x1,%rdi
+  801287:	48 39 f8             	cmp    %rdi,%rax
+  80128a:	75 f2                	jne    80127e <memfind+0x9>
+  80128c:	c3                   	ret
+  80128d:	48 89 f8             	mov    %rdi,%rax
+  801290:	c3                   	ret
+  801291:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801294:	c3                   	ret
+
+0000000000801295 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801295:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801298:	0f b6 37             	movzbl (%rdi),%esi
+  80129b:	40 80 fe 20          	cmp    $0x20,%sil
+  80129f:	74 06                	je     8012a7 <strtol+0x12>
+  8012a1:	40 80 fe 09          	cmp    $0x9,%sil
+  8012a5:	75 13                	jne    8012ba <strtol+0x25>
+  8012a7:	48 83 c7 01          	add    $0x1,%rdi
+  8012ab:	0f b6 37             	movzbl (%rdi),%esi
+  8012ae:	40 80 fe 20          	cmp    $0x20,%sil
+  8012b2:	74 f3                	je     8012a7 <strtol+0x12>
+  8012b4:	40 80 fe 09          	cmp    $0x9,%sil
+  8012b8:	74 ed                	je     8012a7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012ba:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012bd:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012c0:	3c 01                	cmp    $0x1,%al
+  8012c2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012c6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012cc:	75 0f                	jne    8012dd <strtol+0x48>
+  8012ce:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012d1:	74 14                	je     8012e7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012d3:	85 d2                	test   %edx,%edx
+  8012d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012da:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012dd:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012e2:	4c 63 ca             	movslq %edx,%r9
+  8012e5:	eb 36                	jmp    80131d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012e7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012eb:	74 0f                	je     8012fc <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012ed:	85 d2                	test   %edx,%edx
+  8012ef:	75 ec                	jne    8012dd <strtol+0x48>
+        s++;
+  8012f1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012f5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012fa:	eb e1                	jmp    8012dd <strtol+0x48>
+        s += 2;
+  8012fc:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801300:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801305:	eb d6                	jmp    8012dd <strtol+0x48>
+            dig -= '0';
+  801307:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80130a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80130e:	41 39 d0             	cmp    %edx,%r8d
+  801311:	7d 21                	jge    801334 <strtol+0x9f>
+        val = val * base + dig;
+  801313:	49 0f af c1          	imul   %r9,%rax
+  801317:	0f b6 c9             	movzbl %cl,%ecx
+  80131a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80131d:	48 83 c7 01          	add    $0x1,%rdi
+  801321:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801325:	80 f9 39             	cmp    $0x39,%cl
+  801328:	76 dd                	jbe    801307 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80132a:	80 f9 7b             	cmp    $0x7b,%cl
+  80132d:	77 05                	ja     801334 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80132f:	83 e9 57             	sub    $0x57,%ecx
+  801332:	eb d6                	jmp    80130a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801334:	4d 85 d2             	test   %r10,%r10
+  801337:	74 03                	je     80133c <strtol+0xa7>
+  801339:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80133c:	48 89 c2             	mov    %rax,%rdx
+  80133f:	48 f7 da             	neg    %rdx
+  801342:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801346:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80134a:	c3                   	ret
+
+000000000080134b <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  80134b:	55                   	push   %rbp
+  80134c:	48 89 e5             	mov    %rsp,%rbp
+  80134f:	41 57                	push   %r15
+  801351:	41 56                	push   %r14
+  801353:	41 55                	push   %r13
+  801355:	41 54                	push   %r12
+  801357:	53                   	push   %rbx
+  801358:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  80135c:	48 85 ff             	test   %rdi,%rdi
+  80135f:	74 23                	je     801384 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801361:	48 89 fa             	mov    %rdi,%rdx
+  801364:	48 be 19 57 80 00 00 	movabs $0x805719,%rsi
+  80136b:	00 00 00 
+  80136e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801373:	b8 00 00 00 00       	mov    $0x0,%eax
+  801378:	48 b9 ee 32 80 00 00 	movabs $0x8032ee,%rcx
+  80137f:	00 00 00 
+  801382:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801384:	bf 00 00 00 00       	mov    $0x0,%edi
+  801389:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  801390:	00 00 00 
+  801393:	ff d0                	call   *%rax
+  801395:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801398:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  80139e:	49 bd c9 02 80 00 00 	movabs $0x8002c9,%r13
+  8013a5:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  8013a8:	49 bf a6 02 80 00 00 	movabs $0x8002a6,%r15
+  8013af:	00 00 00 
+  8013b2:	eb 46                	jmp    8013fa <readline+0xaf>
+            return NULL;
+  8013b4:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  8013b9:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  8013bc:	75 0f                	jne    8013cd <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  8013be:	48 83 c4 08          	add    $0x8,%rsp
+  8013c2:	5b                   	pop    %rbx
+  8013c3:	41 5c                	pop    %r12
+  8013c5:	41 5d                	pop    %r13
+  8013c7:	41 5e                	pop    %r14
+  8013c9:	41 5f                	pop    %r15
+  8013cb:	5d                   	pop    %rbp
+  8013cc:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  8013cd:	89 de                	mov    %ebx,%esi
+  8013cf:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8013d6:	00 00 00 
+  8013d9:	48 ba ff 05 80 00 00 	movabs $0x8005ff,%rdx
+  8013e0:	00 00 00 
+  8013e3:	ff d2                	call   *%rdx
+            return NULL;
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	eb d2                	jmp    8013be <readline+0x73>
+            if (i) {
+  8013ec:	4d 85 e4             	test   %r12,%r12
+  8013ef:	74 09                	je     8013fa <readline+0xaf>
+                if (echo) {
+  8013f1:	45 85 f6             	test   %r14d,%r14d
+  8013f4:	75 3f                	jne    801435 <readline+0xea>
+                i--;
+  8013f6:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  8013fa:	41 ff d5             	call   *%r13
+  8013fd:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	78 b1                	js     8013b4 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801403:	83 f8 08             	cmp    $0x8,%eax
+  801406:	74 e4                	je     8013ec <readline+0xa1>
+  801408:	83 f8 7f             	cmp    $0x7f,%eax
+  80140b:	74 df                	je     8013ec <readline+0xa1>
+        } else if (c >= ' ') {
+  80140d:	83 f8 1f             	cmp    $0x1f,%eax
+  801410:	7e 4d                	jle    80145f <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801412:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801419:	77 df                	ja     8013fa <readline+0xaf>
+                if (echo) {
+  80141b:	45 85 f6             	test   %r14d,%r14d
+  80141e:	75 2f                	jne    80144f <readline+0x104>
+                buf[i++] = (char)c;
+  801420:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801427:	00 00 00 
+  80142a:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  80142e:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801433:	eb c5                	jmp    8013fa <readline+0xaf>
+                    cputchar('\b');
+  801435:	bf 08 00 00 00       	mov    $0x8,%edi
+  80143a:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  80143d:	bf 20 00 00 00       	mov    $0x20,%edi
+  801442:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801445:	bf 08 00 00 00       	mov    $0x8,%edi
+  80144a:	41 ff d7             	call   *%r15
+  80144d:	eb a7                	jmp    8013f6 <readline+0xab>
+                    cputchar(c);
+  80144f:	89 c7                	mov    %eax,%edi
+  801451:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  801458:	00 00 00 
+  80145b:	ff d0                	call   *%rax
+  80145d:	eb c1                	jmp    801420 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  80145f:	83 f8 0a             	cmp    $0xa,%eax
+  801462:	74 05                	je     801469 <readline+0x11e>
+  801464:	83 f8 0d             	cmp    $0xd,%eax
+  801467:	75 91                	jne    8013fa <readline+0xaf>
+            if (echo) {
+  801469:	45 85 f6             	test   %r14d,%r14d
+  80146c:	75 14                	jne    801482 <readline+0x137>
+            buf[i] = 0;
+  80146e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801475:	00 00 00 
+  801478:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  80147d:	e9 3c ff ff ff       	jmp    8013be <readline+0x73>
+                cputchar('\n');
+  801482:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801487:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  80148e:	00 00 00 
+  801491:	ff d0                	call   *%rax
+  801493:	eb d9                	jmp    80146e <readline+0x123>
+
+0000000000801495 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801495:	55                   	push   %rbp
+  801496:	48 89 e5             	mov    %rsp,%rbp
+  801499:	53                   	push   %rbx
+  80149a:	48 89 fa             	mov    %rdi,%rdx
+  80149d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a0:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014af:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ba:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+
+00000000008014c2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8014c2:	55                   	push   %rbp
+  8014c3:	48 89 e5             	mov    %rsp,%rbp
+  8014c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014eb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ff:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801504:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801513:	be 00 00 00 00       	mov    $0x0,%esi
+  801518:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801520:	48 85 c0             	test   %rax,%rax
+  801523:	7f 06                	jg     80152b <sys_env_destroy+0x38>
+}
+  801525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801529:	c9                   	leave
+  80152a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152b:	49 89 c0             	mov    %rax,%r8
+  80152e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801533:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  80153a:	00 00 00 
+  80153d:	be 26 00 00 00       	mov    $0x26,%esi
+  801542:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  801549:	00 00 00 
+  80154c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801551:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  801558:	00 00 00 
+  80155b:	41 ff d1             	call   *%r9
+
+000000000080155e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+  801562:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801563:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801568:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801577:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157c:	be 00 00 00 00       	mov    $0x0,%esi
+  801581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801587:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158d:	c9                   	leave
+  80158e:	c3                   	ret
+
+000000000080158f <sys_yield>:
+
+void
+sys_yield(void) {
+  80158f:	55                   	push   %rbp
+  801590:	48 89 e5             	mov    %rsp,%rbp
+  801593:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801594:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+
+00000000008015c0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8015c0:	55                   	push   %rbp
+  8015c1:	48 89 e5             	mov    %rsp,%rbp
+  8015c4:	53                   	push   %rbx
+  8015c5:	48 89 fa             	mov    %rdi,%rdx
+  8015c8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015cb:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8015d7:	00 00 00 
+  8015da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015df:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ea:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8015ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f0:	c9                   	leave
+  8015f1:	c3                   	ret
+
+00000000008015f2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015f2:	55                   	push   %rbp
+  8015f3:	48 89 e5             	mov    %rsp,%rbp
+  8015f6:	53                   	push   %rbx
+  8015f7:	49 89 f8             	mov    %rdi,%r8
+  8015fa:	48 89 d3             	mov    %rdx,%rbx
+  8015fd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801600:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801605:	4c 89 c2             	mov    %r8,%rdx
+  801608:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160b:	be 00 00 00 00       	mov    $0x0,%esi
+  801610:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801616:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801618:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+000000000080161e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	53                   	push   %rbx
+  801623:	48 83 ec 08          	sub    $0x8,%rsp
+  801627:	89 f8                	mov    %edi,%eax
+  801629:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80162c:	48 63 f9             	movslq %ecx,%rdi
+  80162f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801632:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801637:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163a:	be 00 00 00 00       	mov    $0x0,%esi
+  80163f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801645:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801647:	48 85 c0             	test   %rax,%rax
+  80164a:	7f 06                	jg     801652 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80164c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801652:	49 89 c0             	mov    %rax,%r8
+  801655:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80165a:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801661:	00 00 00 
+  801664:	be 26 00 00 00       	mov    $0x26,%esi
+  801669:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  801670:	00 00 00 
+  801673:	b8 00 00 00 00       	mov    $0x0,%eax
+  801678:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  80167f:	00 00 00 
+  801682:	41 ff d1             	call   *%r9
+
+0000000000801685 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801685:	55                   	push   %rbp
+  801686:	48 89 e5             	mov    %rsp,%rbp
+  801689:	53                   	push   %rbx
+  80168a:	48 83 ec 08          	sub    $0x8,%rsp
+  80168e:	89 f8                	mov    %edi,%eax
+  801690:	49 89 f2             	mov    %rsi,%r10
+  801693:	48 89 cf             	mov    %rcx,%rdi
+  801696:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801699:	48 63 da             	movslq %edx,%rbx
+  80169c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a7:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ac:	48 85 c0             	test   %rax,%rax
+  8016af:	7f 06                	jg     8016b7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b7:	49 89 c0             	mov    %rax,%r8
+  8016ba:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016bf:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  8016c6:	00 00 00 
+  8016c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ce:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  8016d5:	00 00 00 
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dd:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  8016e4:	00 00 00 
+  8016e7:	41 ff d1             	call   *%r9
+
+00000000008016ea <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	53                   	push   %rbx
+  8016ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f3:	49 89 f9             	mov    %rdi,%r9
+  8016f6:	89 f0                	mov    %esi,%eax
+  8016f8:	48 89 d3             	mov    %rdx,%rbx
+  8016fb:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8016fe:	49 63 f0             	movslq %r8d,%rsi
+  801701:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801704:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801709:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801712:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801714:	48 85 c0             	test   %rax,%rax
+  801717:	7f 06                	jg     80171f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801719:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171d:	c9                   	leave
+  80171e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171f:	49 89 c0             	mov    %rax,%r8
+  801722:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801727:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  80172e:	00 00 00 
+  801731:	be 26 00 00 00       	mov    $0x26,%esi
+  801736:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  80173d:	00 00 00 
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  80174c:	00 00 00 
+  80174f:	41 ff d1             	call   *%r9
+
+0000000000801752 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	53                   	push   %rbx
+  801757:	48 83 ec 08          	sub    $0x8,%rsp
+  80175b:	48 89 f1             	mov    %rsi,%rcx
+  80175e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801761:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801764:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801769:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176e:	be 00 00 00 00       	mov    $0x0,%esi
+  801773:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801779:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80177b:	48 85 c0             	test   %rax,%rax
+  80177e:	7f 06                	jg     801786 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801780:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801784:	c9                   	leave
+  801785:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801786:	49 89 c0             	mov    %rax,%r8
+  801789:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80178e:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801795:	00 00 00 
+  801798:	be 26 00 00 00       	mov    $0x26,%esi
+  80179d:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  8017a4:	00 00 00 
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ac:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  8017b3:	00 00 00 
+  8017b6:	41 ff d1             	call   *%r9
+
+00000000008017b9 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	53                   	push   %rbx
+  8017be:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e0:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8017e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+00000000008017e8 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8017e8:	55                   	push   %rbp
+  8017e9:	48 89 e5             	mov    %rsp,%rbp
+  8017ec:	53                   	push   %rbx
+  8017ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8017f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801801:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801806:	be 00 00 00 00       	mov    $0x0,%esi
+  80180b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801811:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801813:	48 85 c0             	test   %rax,%rax
+  801816:	7f 06                	jg     80181e <sys_env_set_tls+0x36>
+}
+  801818:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181c:	c9                   	leave
+  80181d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80181e:	49 89 c0             	mov    %rax,%r8
+  801821:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801826:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  80182d:	00 00 00 
+  801830:	be 26 00 00 00       	mov    $0x26,%esi
+  801835:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  80183c:	00 00 00 
+  80183f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801844:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  80184b:	00 00 00 
+  80184e:	41 ff d1             	call   *%r9
+
+0000000000801851 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	53                   	push   %rbx
+  801856:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80185a:	48 63 ce             	movslq %esi,%rcx
+  80185d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801860:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801865:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186f:	be 00 00 00 00       	mov    $0x0,%esi
+  801874:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80187c:	48 85 c0             	test   %rax,%rax
+  80187f:	7f 06                	jg     801887 <sys_env_set_status+0x36>
+}
+  801881:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801887:	49 89 c0             	mov    %rax,%r8
+  80188a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80188f:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801896:	00 00 00 
+  801899:	be 26 00 00 00       	mov    $0x26,%esi
+  80189e:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  8018a5:	00 00 00 
+  8018a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ad:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  8018b4:	00 00 00 
+  8018b7:	41 ff d1             	call   *%r9
+
+00000000008018ba <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8018ba:	55                   	push   %rbp
+  8018bb:	48 89 e5             	mov    %rsp,%rbp
+  8018be:	53                   	push   %rbx
+  8018bf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8018c3:	48 63 da             	movslq %edx,%rbx
+  8018c6:	48 63 ce             	movslq %esi,%rcx
+  8018c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018cc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018e3:	48 85 c0             	test   %rax,%rax
+  8018e6:	7f 06                	jg     8018ee <sys_env_set_priority+0x34>
+}
+  8018e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ec:	c9                   	leave
+  8018ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018ee:	49 89 c0             	mov    %rax,%r8
+  8018f1:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8018f6:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  8018fd:	00 00 00 
+  801900:	be 26 00 00 00       	mov    $0x26,%esi
+  801905:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  80190c:	00 00 00 
+  80190f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801914:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  80191b:	00 00 00 
+  80191e:	41 ff d1             	call   *%r9
+
+0000000000801921 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801921:	55                   	push   %rbp
+  801922:	48 89 e5             	mov    %rsp,%rbp
+  801925:	53                   	push   %rbx
+  801926:	48 83 ec 08          	sub    $0x8,%rsp
+  80192a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80192d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801930:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801935:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80193f:	be 00 00 00 00       	mov    $0x0,%esi
+  801944:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80194c:	48 85 c0             	test   %rax,%rax
+  80194f:	7f 06                	jg     801957 <sys_env_set_trapframe+0x36>
+}
+  801951:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801955:	c9                   	leave
+  801956:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801957:	49 89 c0             	mov    %rax,%r8
+  80195a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80195f:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801966:	00 00 00 
+  801969:	be 26 00 00 00       	mov    $0x26,%esi
+  80196e:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  801975:	00 00 00 
+  801978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197d:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  801984:	00 00 00 
+  801987:	41 ff d1             	call   *%r9
+
+000000000080198a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	53                   	push   %rbx
+  80198f:	48 83 ec 08          	sub    $0x8,%rsp
+  801993:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801996:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801999:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80199e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019b5:	48 85 c0             	test   %rax,%rax
+  8019b8:	7f 06                	jg     8019c0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8019ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019c0:	49 89 c0             	mov    %rax,%r8
+  8019c3:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8019c8:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  8019cf:	00 00 00 
+  8019d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8019d7:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  8019de:	00 00 00 
+  8019e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e6:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  8019ed:	00 00 00 
+  8019f0:	41 ff d1             	call   *%r9
+
+00000000008019f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019f3:	55                   	push   %rbp
+  8019f4:	48 89 e5             	mov    %rsp,%rbp
+  8019f7:	53                   	push   %rbx
+  8019f8:	89 f8                	mov    %edi,%eax
+  8019fa:	49 89 f1             	mov    %rsi,%r9
+  8019fd:	48 89 d3             	mov    %rdx,%rbx
+  801a00:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a03:	49 63 f0             	movslq %r8d,%rsi
+  801a06:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a09:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a0e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a17:	cd 30                	int    $0x30
+}
+  801a19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+0000000000801a1f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	41 55                	push   %r13
+  801a25:	41 54                	push   %r12
+  801a27:	53                   	push   %rbx
+  801a28:	89 f8                	mov    %edi,%eax
+  801a2a:	49 89 f2             	mov    %rsi,%r10
+  801a2d:	48 89 d3             	mov    %rdx,%rbx
+  801a30:	48 89 cf             	mov    %rcx,%rdi
+  801a33:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801a36:	49 63 f0             	movslq %r8d,%rsi
+  801a39:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a3c:	4d 85 c9             	test   %r9,%r9
+  801a3f:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801a46:	00 00 00 
+  801a49:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a4d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a52:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801a55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801a5b:	4d 8b 0b             	mov    (%r11),%r9
+  801a5e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a62:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a66:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a6a:	cd 30                	int    $0x30
+}
+  801a6c:	5b                   	pop    %rbx
+  801a6d:	41 5c                	pop    %r12
+  801a6f:	41 5d                	pop    %r13
+  801a71:	5d                   	pop    %rbp
+  801a72:	c3                   	ret
+
+0000000000801a73 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801a73:	55                   	push   %rbp
+  801a74:	48 89 e5             	mov    %rsp,%rbp
+  801a77:	53                   	push   %rbx
+  801a78:	48 89 fa             	mov    %rdi,%rdx
+  801a7b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a88:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a98:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801a9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a9e:	c9                   	leave
+  801a9f:	c3                   	ret
+
+0000000000801aa0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801aa0:	55                   	push   %rbp
+  801aa1:	48 89 e5             	mov    %rsp,%rbp
+  801aa4:	53                   	push   %rbx
+  801aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa9:	48 89 fa             	mov    %rdi,%rdx
+  801aac:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801aaf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801abe:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ac9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801acb:	48 85 c0             	test   %rax,%rax
+  801ace:	7f 06                	jg     801ad6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ad0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ad6:	49 89 c0             	mov    %rax,%r8
+  801ad9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801ade:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801ae5:	00 00 00 
+  801ae8:	be 26 00 00 00       	mov    $0x26,%esi
+  801aed:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  801af4:	00 00 00 
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afc:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  801b03:	00 00 00 
+  801b06:	41 ff d1             	call   *%r9
+
+0000000000801b09 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b09:	55                   	push   %rbp
+  801b0a:	48 89 e5             	mov    %rsp,%rbp
+  801b0d:	41 55                	push   %r13
+  801b0f:	41 54                	push   %r12
+  801b11:	53                   	push   %rbx
+  801b12:	89 f8                	mov    %edi,%eax
+  801b14:	49 89 f2             	mov    %rsi,%r10
+  801b17:	48 89 d3             	mov    %rdx,%rbx
+  801b1a:	48 89 cf             	mov    %rcx,%rdi
+  801b1d:	44 89 c6             	mov    %r8d,%esi
+  801b20:	4d 89 c8             	mov    %r9,%r8
+  801b23:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801b27:	48 63 f6             	movslq %esi,%rsi
+  801b2a:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801b2d:	4d 85 db             	test   %r11,%r11
+  801b30:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801b37:	00 00 00 
+  801b3a:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801b3e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b43:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801b46:	4d 8b 0b             	mov    (%r11),%r9
+  801b49:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801b4d:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801b51:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801b55:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b57:	5b                   	pop    %rbx
+  801b58:	41 5c                	pop    %r12
+  801b5a:	41 5d                	pop    %r13
+  801b5c:	5d                   	pop    %rbp
+  801b5d:	c3                   	ret
+
+0000000000801b5e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b5e:	55                   	push   %rbp
+  801b5f:	48 89 e5             	mov    %rsp,%rbp
+  801b62:	41 55                	push   %r13
+  801b64:	41 54                	push   %r12
+  801b66:	53                   	push   %rbx
+  801b67:	89 f8                	mov    %edi,%eax
+  801b69:	49 89 f2             	mov    %rsi,%r10
+  801b6c:	48 89 d3             	mov    %rdx,%rbx
+  801b6f:	48 89 cf             	mov    %rcx,%rdi
+  801b72:	44 89 c6             	mov    %r8d,%esi
+  801b75:	4d 89 c8             	mov    %r9,%r8
+  801b78:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801b7c:	48 63 f6             	movslq %esi,%rsi
+  801b7f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801b82:	4d 85 db             	test   %r11,%r11
+  801b85:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  801b8c:	00 00 00 
+  801b8f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801b93:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b98:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801b9b:	4d 8b 0b             	mov    (%r11),%r9
+  801b9e:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ba2:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ba6:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801baa:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bac:	5b                   	pop    %rbx
+  801bad:	41 5c                	pop    %r12
+  801baf:	41 5d                	pop    %r13
+  801bb1:	5d                   	pop    %rbp
+  801bb2:	c3                   	ret
+
+0000000000801bb3 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801bb3:	55                   	push   %rbp
+  801bb4:	48 89 e5             	mov    %rsp,%rbp
+  801bb7:	53                   	push   %rbx
+  801bb8:	48 83 ec 08          	sub    $0x8,%rsp
+  801bbc:	48 89 f1             	mov    %rsi,%rcx
+  801bbf:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bc2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bc7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bda:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bdc:	48 85 c0             	test   %rax,%rax
+  801bdf:	7f 06                	jg     801be7 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801be1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801be7:	49 89 c0             	mov    %rax,%r8
+  801bea:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801bef:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801bf6:	00 00 00 
+  801bf9:	be 26 00 00 00       	mov    $0x26,%esi
+  801bfe:	48 bf 27 56 80 00 00 	movabs $0x805627,%rdi
+  801c05:	00 00 00 
+  801c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0d:	49 b9 af 04 80 00 00 	movabs $0x8004af,%r9
+  801c14:	00 00 00 
+  801c17:	41 ff d1             	call   *%r9
+
+0000000000801c1a <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801c1a:	55                   	push   %rbp
+  801c1b:	48 89 e5             	mov    %rsp,%rbp
+  801c1e:	53                   	push   %rbx
+  801c1f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c22:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c36:	be 00 00 00 00       	mov    $0x0,%esi
+  801c3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c41:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801c43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+
+0000000000801c49 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801c49:	55                   	push   %rbp
+  801c4a:	48 89 e5             	mov    %rsp,%rbp
+  801c4d:	53                   	push   %rbx
+  801c4e:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801c51:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801c53:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c62:	be 00 00 00 00       	mov    $0x0,%esi
+  801c67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c6d:	cd 30                	int    $0x30
+}
+  801c6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c73:	c9                   	leave
+  801c74:	c3                   	ret
+
+0000000000801c75 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801c75:	55                   	push   %rbp
+  801c76:	48 89 e5             	mov    %rsp,%rbp
+  801c79:	53                   	push   %rbx
+  801c7a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801c7d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c80:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c9a:	cd 30                	int    $0x30
+}
+  801c9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ca0:	c9                   	leave
+  801ca1:	c3                   	ret
+
+0000000000801ca2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801ca2:	55                   	push   %rbp
+  801ca3:	48 89 e5             	mov    %rsp,%rbp
+  801ca6:	53                   	push   %rbx
+  801ca7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801caa:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb1:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc4:	cd 30                	int    $0x30
+}
+  801cc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+0000000000801ccc <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+  801cd0:	53                   	push   %rbx
+  801cd1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801cd4:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ceb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf1:	cd 30                	int    $0x30
+}
+  801cf3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf7:	c9                   	leave
+  801cf8:	c3                   	ret
+
+0000000000801cf9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cfe:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d17:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d22:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+
+0000000000801d2a <sys_monitor>:
+
+int sys_monitor(void) {
+  801d2a:	55                   	push   %rbp
+  801d2b:	48 89 e5             	mov    %rsp,%rbp
+  801d2e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d2f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d43:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d48:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d53:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+0000000000801d5b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d5b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d62:	ff ff ff 
+  801d65:	48 01 f8             	add    %rdi,%rax
+  801d68:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801d6c:	c3                   	ret
+
+0000000000801d6d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d6d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d74:	ff ff ff 
+  801d77:	48 01 f8             	add    %rdi,%rax
+  801d7a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801d7e:	48 c1 e0 12          	shl    $0x12,%rax
+  801d82:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801d87:	48 01 d0             	add    %rdx,%rax
+}
+  801d8a:	c3                   	ret
+
+0000000000801d8b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	41 57                	push   %r15
+  801d91:	41 56                	push   %r14
+  801d93:	41 55                	push   %r13
+  801d95:	41 54                	push   %r12
+  801d97:	53                   	push   %rbx
+  801d98:	48 83 ec 08          	sub    $0x8,%rsp
+  801d9c:	49 89 ff             	mov    %rdi,%r15
+  801d9f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801da4:	49 bd e0 3c 80 00 00 	movabs $0x803ce0,%r13
+  801dab:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801dae:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801db4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801db7:	48 89 df             	mov    %rbx,%rdi
+  801dba:	41 ff d5             	call   *%r13
+  801dbd:	83 e0 04             	and    $0x4,%eax
+  801dc0:	74 17                	je     801dd9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801dc2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801dc9:	4c 39 f3             	cmp    %r14,%rbx
+  801dcc:	75 e6                	jne    801db4 <fd_alloc+0x29>
+  801dce:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801dd4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801dd9:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ddc:	48 83 c4 08          	add    $0x8,%rsp
+  801de0:	5b                   	pop    %rbx
+  801de1:	41 5c                	pop    %r12
+  801de3:	41 5d                	pop    %r13
+  801de5:	41 5e                	pop    %r14
+  801de7:	41 5f                	pop    %r15
+  801de9:	5d                   	pop    %rbp
+  801dea:	c3                   	ret
+
+0000000000801deb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801deb:	83 ff 1f             	cmp    $0x1f,%edi
+  801dee:	77 39                	ja     801e29 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+  801df7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801dfa:	48 63 df             	movslq %edi,%rbx
+  801dfd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e04:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e08:	48 89 df             	mov    %rbx,%rdi
+  801e0b:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  801e12:	00 00 00 
+  801e15:	ff d0                	call   *%rax
+  801e17:	a8 04                	test   $0x4,%al
+  801e19:	74 14                	je     801e2f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e1b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e24:	5b                   	pop    %rbx
+  801e25:	41 5c                	pop    %r12
+  801e27:	5d                   	pop    %rbp
+  801e28:	c3                   	ret
+        return -E_INVAL;
+  801e29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e2e:	c3                   	ret
+        return -E_INVAL;
+  801e2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e34:	eb ee                	jmp    801e24 <fd_lookup+0x39>
+
+0000000000801e36 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  801e3a:	41 54                	push   %r12
+  801e3c:	53                   	push   %rbx
+  801e3d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801e40:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801e47:	00 00 00 
+  801e4a:	48 bb 40 60 80 00 00 	movabs $0x806040,%rbx
+  801e51:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801e54:	39 3b                	cmp    %edi,(%rbx)
+  801e56:	74 4a                	je     801ea2 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801e58:	48 83 c0 08          	add    $0x8,%rax
+  801e5c:	48 8b 18             	mov    (%rax),%rbx
+  801e5f:	48 85 db             	test   %rbx,%rbx
+  801e62:	75 f0                	jne    801e54 <dev_lookup+0x1e>
+  801e64:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e6b:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e6d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e71:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e77:	89 fa                	mov    %edi,%edx
+  801e79:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  801e80:	00 00 00 
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e88:	48 b9 ff 05 80 00 00 	movabs $0x8005ff,%rcx
+  801e8f:	00 00 00 
+  801e92:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801e94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e99:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e9d:	5b                   	pop    %rbx
+  801e9e:	41 5c                	pop    %r12
+  801ea0:	5d                   	pop    %rbp
+  801ea1:	c3                   	ret
+            return 0;
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea7:	eb f0                	jmp    801e99 <dev_lookup+0x63>
+
+0000000000801ea9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ea9:	55                   	push   %rbp
+  801eaa:	48 89 e5             	mov    %rsp,%rbp
+  801ead:	41 55                	push   %r13
+  801eaf:	41 54                	push   %r12
+  801eb1:	53                   	push   %rbx
+  801eb2:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb6:	48 89 fb             	mov    %rdi,%rbx
+  801eb9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ebc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ec3:	ff ff ff 
+  801ec6:	48 01 df             	add    %rbx,%rdi
+  801ec9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ecd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ed1:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+  801edd:	41 89 c5             	mov    %eax,%r13d
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	78 06                	js     801eea <fd_close+0x41>
+  801ee4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ee8:	74 1a                	je     801f04 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801eea:	45 84 e4             	test   %r12b,%r12b
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ef6:	44 89 e8             	mov    %r13d,%eax
+  801ef9:	48 83 c4 18          	add    $0x18,%rsp
+  801efd:	5b                   	pop    %rbx
+  801efe:	41 5c                	pop    %r12
+  801f00:	41 5d                	pop    %r13
+  801f02:	5d                   	pop    %rbp
+  801f03:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f04:	8b 3b                	mov    (%rbx),%edi
+  801f06:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f0a:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  801f11:	00 00 00 
+  801f14:	ff d0                	call   *%rax
+  801f16:	41 89 c5             	mov    %eax,%r13d
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	78 1b                	js     801f38 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f21:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f25:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f2b:	48 85 c0             	test   %rax,%rax
+  801f2e:	74 08                	je     801f38 <fd_close+0x8f>
+  801f30:	48 89 df             	mov    %rbx,%rdi
+  801f33:	ff d0                	call   *%rax
+  801f35:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f3d:	48 89 de             	mov    %rbx,%rsi
+  801f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f45:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+    return res;
+  801f51:	eb a3                	jmp    801ef6 <fd_close+0x4d>
+
+0000000000801f53 <close>:
+
+int
+close(int fdnum) {
+  801f53:	55                   	push   %rbp
+  801f54:	48 89 e5             	mov    %rsp,%rbp
+  801f57:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801f5b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f5f:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  801f66:	00 00 00 
+  801f69:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 15                	js     801f84 <close+0x31>
+
+    return fd_close(fd, 1);
+  801f6f:	be 01 00 00 00       	mov    $0x1,%esi
+  801f74:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801f78:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  801f7f:	00 00 00 
+  801f82:	ff d0                	call   *%rax
+}
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+
+0000000000801f86 <close_all>:
+
+void
+close_all(void) {
+  801f86:	55                   	push   %rbp
+  801f87:	48 89 e5             	mov    %rsp,%rbp
+  801f8a:	41 54                	push   %r12
+  801f8c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f92:	49 bc 53 1f 80 00 00 	movabs $0x801f53,%r12
+  801f99:	00 00 00 
+  801f9c:	89 df                	mov    %ebx,%edi
+  801f9e:	41 ff d4             	call   *%r12
+  801fa1:	83 c3 01             	add    $0x1,%ebx
+  801fa4:	83 fb 20             	cmp    $0x20,%ebx
+  801fa7:	75 f3                	jne    801f9c <close_all+0x16>
+}
+  801fa9:	5b                   	pop    %rbx
+  801faa:	41 5c                	pop    %r12
+  801fac:	5d                   	pop    %rbp
+  801fad:	c3                   	ret
+
+0000000000801fae <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801fae:	55                   	push   %rbp
+  801faf:	48 89 e5             	mov    %rsp,%rbp
+  801fb2:	41 57                	push   %r15
+  801fb4:	41 56                	push   %r14
+  801fb6:	41 55                	push   %r13
+  801fb8:	41 54                	push   %r12
+  801fba:	53                   	push   %rbx
+  801fbb:	48 83 ec 38          	sub    $0x38,%rsp
+  801fbf:	41 89 f7             	mov    %esi,%r15d
+  801fc2:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801fc5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801fc9:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	0f 88 ec 00 00 00    	js     8020cb <dup+0x11d>
+    close(newfdnum);
+  801fdf:	44 89 ff             	mov    %r15d,%edi
+  801fe2:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801fee:	49 63 c7             	movslq %r15d,%rax
+  801ff1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ff7:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ffb:	49 89 c6             	mov    %rax,%r14
+  801ffe:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802002:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802006:	4c 89 ff             	mov    %r15,%rdi
+  802009:	48 bb 6d 1d 80 00 00 	movabs $0x801d6d,%rbx
+  802010:	00 00 00 
+  802013:	ff d3                	call   *%rbx
+  802015:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802018:	4c 89 f7             	mov    %r14,%rdi
+  80201b:	ff d3                	call   *%rbx
+  80201d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802021:	4c 89 e7             	mov    %r12,%rdi
+  802024:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+  802030:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802033:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802038:	49 be e0 3c 80 00 00 	movabs $0x803ce0,%r14
+  80203f:	00 00 00 
+  802042:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802046:	41 ff d6             	call   *%r14
+  802049:	44 39 e8             	cmp    %r13d,%eax
+  80204c:	75 10                	jne    80205e <dup+0xb0>
+  80204e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802055:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  80205c:	75 e4                	jne    802042 <dup+0x94>
+    if (prot & PROT_R) {
+  80205e:	41 f6 c5 04          	test   $0x4,%r13b
+  802062:	74 29                	je     80208d <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802064:	45 89 e9             	mov    %r13d,%r9d
+  802067:	49 89 d8             	mov    %rbx,%r8
+  80206a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80206e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802073:	4c 89 e6             	mov    %r12,%rsi
+  802076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207b:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  802082:	00 00 00 
+  802085:	ff d0                	call   *%rax
+  802087:	89 c3                	mov    %eax,%ebx
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 4f                	js     8020dc <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  80208d:	4c 89 ff             	mov    %r15,%rdi
+  802090:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  802097:	00 00 00 
+  80209a:	ff d0                	call   *%rax
+  80209c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80209f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020a5:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8020a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ae:	4c 89 fe             	mov    %r15,%rsi
+  8020b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b6:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  8020bd:	00 00 00 
+  8020c0:	ff d0                	call   *%rax
+  8020c2:	89 c3                	mov    %eax,%ebx
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 14                	js     8020dc <dup+0x12e>
+
+    return newfdnum;
+  8020c8:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	48 83 c4 38          	add    $0x38,%rsp
+  8020d1:	5b                   	pop    %rbx
+  8020d2:	41 5c                	pop    %r12
+  8020d4:	41 5d                	pop    %r13
+  8020d6:	41 5e                	pop    %r14
+  8020d8:	41 5f                	pop    %r15
+  8020da:	5d                   	pop    %rbp
+  8020db:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8020dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8020e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ea:	49 bc 52 17 80 00 00 	movabs $0x801752,%r12
+  8020f1:	00 00 00 
+  8020f4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8020f7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8020fc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802100:	bf 00 00 00 00       	mov    $0x0,%edi
+  802105:	41 ff d4             	call   *%r12
+    return res;
+  802108:	eb c1                	jmp    8020cb <dup+0x11d>
+
+000000000080210a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80210a:	55                   	push   %rbp
+  80210b:	48 89 e5             	mov    %rsp,%rbp
+  80210e:	41 56                	push   %r14
+  802110:	41 55                	push   %r13
+  802112:	41 54                	push   %r12
+  802114:	53                   	push   %rbx
+  802115:	48 83 ec 10          	sub    $0x10,%rsp
+  802119:	89 fb                	mov    %edi,%ebx
+  80211b:	49 89 f4             	mov    %rsi,%r12
+  80211e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802121:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802125:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	85 c0                	test   %eax,%eax
+  802133:	78 4c                	js     802181 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802135:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802139:	41 8b 3e             	mov    (%r14),%edi
+  80213c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802140:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  802147:	00 00 00 
+  80214a:	ff d0                	call   *%rax
+  80214c:	85 c0                	test   %eax,%eax
+  80214e:	78 35                	js     802185 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802150:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802154:	83 e0 03             	and    $0x3,%eax
+  802157:	83 f8 01             	cmp    $0x1,%eax
+  80215a:	74 2d                	je     802189 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80215c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802160:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802164:	48 85 c0             	test   %rax,%rax
+  802167:	74 59                	je     8021c2 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802169:	4c 89 ea             	mov    %r13,%rdx
+  80216c:	4c 89 e6             	mov    %r12,%rsi
+  80216f:	4c 89 f7             	mov    %r14,%rdi
+  802172:	ff d0                	call   *%rax
+}
+  802174:	48 83 c4 10          	add    $0x10,%rsp
+  802178:	5b                   	pop    %rbx
+  802179:	41 5c                	pop    %r12
+  80217b:	41 5d                	pop    %r13
+  80217d:	41 5e                	pop    %r14
+  80217f:	5d                   	pop    %rbp
+  802180:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802181:	48 98                	cltq
+  802183:	eb ef                	jmp    802174 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802185:	48 98                	cltq
+  802187:	eb eb                	jmp    802174 <read+0x6a>
+  802189:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802190:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802192:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802196:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80219c:	89 da                	mov    %ebx,%edx
+  80219e:	48 bf a1 56 80 00 00 	movabs $0x8056a1,%rdi
+  8021a5:	00 00 00 
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ad:	48 b9 ff 05 80 00 00 	movabs $0x8005ff,%rcx
+  8021b4:	00 00 00 
+  8021b7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021b9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021c0:	eb b2                	jmp    802174 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021c2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021c9:	eb a9                	jmp    802174 <read+0x6a>
+
+00000000008021cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+  8021cf:	41 57                	push   %r15
+  8021d1:	41 56                	push   %r14
+  8021d3:	41 55                	push   %r13
+  8021d5:	41 54                	push   %r12
+  8021d7:	53                   	push   %rbx
+  8021d8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8021dc:	48 85 d2             	test   %rdx,%rdx
+  8021df:	74 54                	je     802235 <readn+0x6a>
+  8021e1:	41 89 fd             	mov    %edi,%r13d
+  8021e4:	49 89 f6             	mov    %rsi,%r14
+  8021e7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8021ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8021ef:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8021f4:	49 bf 0a 21 80 00 00 	movabs $0x80210a,%r15
+  8021fb:	00 00 00 
+  8021fe:	4c 89 e2             	mov    %r12,%rdx
+  802201:	48 29 f2             	sub    %rsi,%rdx
+  802204:	4c 01 f6             	add    %r14,%rsi
+  802207:	44 89 ef             	mov    %r13d,%edi
+  80220a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 20                	js     802231 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802211:	01 c3                	add    %eax,%ebx
+  802213:	85 c0                	test   %eax,%eax
+  802215:	74 08                	je     80221f <readn+0x54>
+  802217:	48 63 f3             	movslq %ebx,%rsi
+  80221a:	4c 39 e6             	cmp    %r12,%rsi
+  80221d:	72 df                	jb     8021fe <readn+0x33>
+    }
+    return res;
+  80221f:	48 63 c3             	movslq %ebx,%rax
+}
+  802222:	48 83 c4 08          	add    $0x8,%rsp
+  802226:	5b                   	pop    %rbx
+  802227:	41 5c                	pop    %r12
+  802229:	41 5d                	pop    %r13
+  80222b:	41 5e                	pop    %r14
+  80222d:	41 5f                	pop    %r15
+  80222f:	5d                   	pop    %rbp
+  802230:	c3                   	ret
+        if (inc < 0) return inc;
+  802231:	48 98                	cltq
+  802233:	eb ed                	jmp    802222 <readn+0x57>
+    int inc = 1, res = 0;
+  802235:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80223a:	eb e3                	jmp    80221f <readn+0x54>
+
+000000000080223c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	41 56                	push   %r14
+  802242:	41 55                	push   %r13
+  802244:	41 54                	push   %r12
+  802246:	53                   	push   %rbx
+  802247:	48 83 ec 10          	sub    $0x10,%rsp
+  80224b:	89 fb                	mov    %edi,%ebx
+  80224d:	49 89 f4             	mov    %rsi,%r12
+  802250:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802253:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802257:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  80225e:	00 00 00 
+  802261:	ff d0                	call   *%rax
+  802263:	85 c0                	test   %eax,%eax
+  802265:	78 47                	js     8022ae <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802267:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80226b:	41 8b 3e             	mov    (%r14),%edi
+  80226e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802272:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	78 30                	js     8022b2 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802282:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802287:	74 2d                	je     8022b6 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802289:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80228d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802291:	48 85 c0             	test   %rax,%rax
+  802294:	74 59                	je     8022ef <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802296:	4c 89 ea             	mov    %r13,%rdx
+  802299:	4c 89 e6             	mov    %r12,%rsi
+  80229c:	4c 89 f7             	mov    %r14,%rdi
+  80229f:	ff d0                	call   *%rax
+}
+  8022a1:	48 83 c4 10          	add    $0x10,%rsp
+  8022a5:	5b                   	pop    %rbx
+  8022a6:	41 5c                	pop    %r12
+  8022a8:	41 5d                	pop    %r13
+  8022aa:	41 5e                	pop    %r14
+  8022ac:	5d                   	pop    %rbp
+  8022ad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022ae:	48 98                	cltq
+  8022b0:	eb ef                	jmp    8022a1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022b2:	48 98                	cltq
+  8022b4:	eb eb                	jmp    8022a1 <write+0x65>
+  8022b6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8022bd:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022c9:	89 da                	mov    %ebx,%edx
+  8022cb:	48 bf bd 56 80 00 00 	movabs $0x8056bd,%rdi
+  8022d2:	00 00 00 
+  8022d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022da:	48 b9 ff 05 80 00 00 	movabs $0x8005ff,%rcx
+  8022e1:	00 00 00 
+  8022e4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022e6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022ed:	eb b2                	jmp    8022a1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022ef:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022f6:	eb a9                	jmp    8022a1 <write+0x65>
+
+00000000008022f8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8022f8:	55                   	push   %rbp
+  8022f9:	48 89 e5             	mov    %rsp,%rbp
+  8022fc:	53                   	push   %rbx
+  8022fd:	48 83 ec 18          	sub    $0x18,%rsp
+  802301:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802303:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802307:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+  802313:	85 c0                	test   %eax,%eax
+  802315:	78 0c                	js     802323 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80231b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80231e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+
+0000000000802329 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802329:	55                   	push   %rbp
+  80232a:	48 89 e5             	mov    %rsp,%rbp
+  80232d:	41 55                	push   %r13
+  80232f:	41 54                	push   %r12
+  802331:	53                   	push   %rbx
+  802332:	48 83 ec 18          	sub    $0x18,%rsp
+  802336:	89 fb                	mov    %edi,%ebx
+  802338:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80233b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80233f:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 38                	js     802387 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80234f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802353:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802357:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80235b:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 1c                	js     802387 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80236b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802370:	74 20                	je     802392 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802372:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802376:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80237a:	48 85 c0             	test   %rax,%rax
+  80237d:	74 4a                	je     8023c9 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80237f:	44 89 e6             	mov    %r12d,%esi
+  802382:	4c 89 ef             	mov    %r13,%rdi
+  802385:	ff d0                	call   *%rax
+}
+  802387:	48 83 c4 18          	add    $0x18,%rsp
+  80238b:	5b                   	pop    %rbx
+  80238c:	41 5c                	pop    %r12
+  80238e:	41 5d                	pop    %r13
+  802390:	5d                   	pop    %rbp
+  802391:	c3                   	ret
+  802392:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802399:	00 00 
+                thisenv->env_id, fdnum);
+  80239b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80239f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023a5:	89 da                	mov    %ebx,%edx
+  8023a7:	48 bf 80 56 80 00 00 	movabs $0x805680,%rdi
+  8023ae:	00 00 00 
+  8023b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b6:	48 b9 ff 05 80 00 00 	movabs $0x8005ff,%rcx
+  8023bd:	00 00 00 
+  8023c0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023c7:	eb be                	jmp    802387 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023c9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023ce:	eb b7                	jmp    802387 <ftruncate+0x5e>
+
+00000000008023d0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8023d0:	55                   	push   %rbp
+  8023d1:	48 89 e5             	mov    %rsp,%rbp
+  8023d4:	41 54                	push   %r12
+  8023d6:	53                   	push   %rbx
+  8023d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8023db:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023de:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023e2:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 4e                	js     802440 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023f2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8023f6:	41 8b 3c 24          	mov    (%r12),%edi
+  8023fa:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023fe:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  802405:	00 00 00 
+  802408:	ff d0                	call   *%rax
+  80240a:	85 c0                	test   %eax,%eax
+  80240c:	78 32                	js     802440 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80240e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802412:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802417:	74 30                	je     802449 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802419:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80241c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802423:	00 00 00 
+    stat->st_isdir = 0;
+  802426:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80242d:	00 00 00 
+    stat->st_dev = dev;
+  802430:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802437:	48 89 de             	mov    %rbx,%rsi
+  80243a:	4c 89 e7             	mov    %r12,%rdi
+  80243d:	ff 50 28             	call   *0x28(%rax)
+}
+  802440:	48 83 c4 10          	add    $0x10,%rsp
+  802444:	5b                   	pop    %rbx
+  802445:	41 5c                	pop    %r12
+  802447:	5d                   	pop    %rbp
+  802448:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802449:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80244e:	eb f0                	jmp    802440 <fstat+0x70>
+
+0000000000802450 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802450:	55                   	push   %rbp
+  802451:	48 89 e5             	mov    %rsp,%rbp
+  802454:	41 54                	push   %r12
+  802456:	53                   	push   %rbx
+  802457:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80245a:	be 00 00 00 00       	mov    $0x0,%esi
+  80245f:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  802466:	00 00 00 
+  802469:	ff d0                	call   *%rax
+  80246b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80246d:	85 c0                	test   %eax,%eax
+  80246f:	78 25                	js     802496 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802471:	4c 89 e6             	mov    %r12,%rsi
+  802474:	89 c7                	mov    %eax,%edi
+  802476:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+  802482:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802485:	89 df                	mov    %ebx,%edi
+  802487:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+
+    return res;
+  802493:	44 89 e3             	mov    %r12d,%ebx
+}
+  802496:	89 d8                	mov    %ebx,%eax
+  802498:	5b                   	pop    %rbx
+  802499:	41 5c                	pop    %r12
+  80249b:	5d                   	pop    %rbp
+  80249c:	c3                   	ret
+
+000000000080249d <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80249d:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8024a4:	00 00 00 
+  8024a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ac:	eb 0e                	jmp    8024bc <mmap_lookup+0x1f>
+  8024ae:	48 83 c2 01          	add    $0x1,%rdx
+  8024b2:	48 83 c0 20          	add    $0x20,%rax
+  8024b6:	48 83 fa 40          	cmp    $0x40,%rdx
+  8024ba:	74 2b                	je     8024e7 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8024bc:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8024c0:	48 85 c9             	test   %rcx,%rcx
+  8024c3:	74 e9                	je     8024ae <mmap_lookup+0x11>
+  8024c5:	48 8b 30             	mov    (%rax),%rsi
+  8024c8:	48 39 f7             	cmp    %rsi,%rdi
+  8024cb:	72 e1                	jb     8024ae <mmap_lookup+0x11>
+  8024cd:	48 01 f1             	add    %rsi,%rcx
+  8024d0:	48 39 cf             	cmp    %rcx,%rdi
+  8024d3:	73 d9                	jae    8024ae <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8024d5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8024d9:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8024e0:	00 00 00 
+  8024e3:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8024e6:	c3                   	ret
+    return NULL;
+  8024e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ec:	c3                   	ret
+
+00000000008024ed <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8024ed:	55                   	push   %rbp
+  8024ee:	48 89 e5             	mov    %rsp,%rbp
+  8024f1:	41 54                	push   %r12
+  8024f3:	53                   	push   %rbx
+  8024f4:	89 fb                	mov    %edi,%ebx
+  8024f6:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024f9:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802500:	00 00 00 
+  802503:	83 38 00             	cmpl   $0x0,(%rax)
+  802506:	74 3d                	je     802545 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802508:	41 54                	push   %r12
+  80250a:	6a 00                	push   $0x0
+  80250c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802512:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802518:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80251d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802522:	89 de                	mov    %ebx,%esi
+  802524:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80252b:	00 00 00 
+  80252e:	8b 38                	mov    (%rax),%edi
+  802530:	48 b8 0e 41 80 00 00 	movabs $0x80410e,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+}
+  80253c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802540:	5b                   	pop    %rbx
+  802541:	41 5c                	pop    %r12
+  802543:	5d                   	pop    %rbp
+  802544:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802545:	bf 03 00 00 00       	mov    $0x3,%edi
+  80254a:	48 b8 75 43 80 00 00 	movabs $0x804375,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  80255d:	00 00 
+  80255f:	eb a7                	jmp    802508 <fsipc_words+0x1b>
+
+0000000000802561 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802561:	55                   	push   %rbp
+  802562:	48 89 e5             	mov    %rsp,%rbp
+  802565:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802569:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802570:	00 
+  802571:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802578:	00 
+  802579:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80257d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802581:	48 63 f6             	movslq %esi,%rsi
+  802584:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802588:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80258c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802591:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8025a7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8025ae:	00 
+  8025af:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8025b6:	00 
+  8025b7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8025be:	00 
+  8025bf:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8025c3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8025c7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025cb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8025d0:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+}
+  8025dc:	c9                   	leave
+  8025dd:	c3                   	ret
+
+00000000008025de <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8025de:	55                   	push   %rbp
+  8025df:	48 89 e5             	mov    %rsp,%rbp
+  8025e2:	41 54                	push   %r12
+  8025e4:	53                   	push   %rbx
+  8025e5:	89 fb                	mov    %edi,%ebx
+  8025e7:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025ea:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  8025f1:	00 00 00 
+  8025f4:	83 38 00             	cmpl   $0x0,(%rax)
+  8025f7:	74 3f                	je     802638 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8025f9:	6a 00                	push   $0x0
+  8025fb:	6a 00                	push   $0x0
+  8025fd:	4d 89 e1             	mov    %r12,%r9
+  802600:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802606:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80260b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802612:	00 00 00 
+  802615:	89 de                	mov    %ebx,%esi
+  802617:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  80261e:	00 00 00 
+  802621:	8b 38                	mov    (%rax),%edi
+  802623:	48 b8 0e 41 80 00 00 	movabs $0x80410e,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+}
+  80262f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802633:	5b                   	pop    %rbx
+  802634:	41 5c                	pop    %r12
+  802636:	5d                   	pop    %rbp
+  802637:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802638:	bf 03 00 00 00       	mov    $0x3,%edi
+  80263d:	48 b8 75 43 80 00 00 	movabs $0x804375,%rax
+  802644:	00 00 00 
+  802647:	ff d0                	call   *%rax
+  802649:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802650:	00 00 
+  802652:	eb a5                	jmp    8025f9 <fsipc+0x1b>
+
+0000000000802654 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802654:	55                   	push   %rbp
+  802655:	48 89 e5             	mov    %rsp,%rbp
+  802658:	41 54                	push   %r12
+  80265a:	53                   	push   %rbx
+  80265b:	41 89 fc             	mov    %edi,%r12d
+  80265e:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802661:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802668:	00 00 00 
+  80266b:	83 38 00             	cmpl   $0x0,(%rax)
+  80266e:	74 46                	je     8026b6 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802670:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802674:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802678:	6a 00                	push   $0x0
+  80267a:	6a 00                	push   $0x0
+  80267c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802682:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802688:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  80268f:	00 00 00 
+  802692:	44 89 e6             	mov    %r12d,%esi
+  802695:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  80269c:	00 00 00 
+  80269f:	8b 38                	mov    (%rax),%edi
+  8026a1:	48 b8 0e 41 80 00 00 	movabs $0x80410e,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+}
+  8026ad:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8026b1:	5b                   	pop    %rbx
+  8026b2:	41 5c                	pop    %r12
+  8026b4:	5d                   	pop    %rbp
+  8026b5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026bb:	48 b8 75 43 80 00 00 	movabs $0x804375,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+  8026c7:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  8026ce:	00 00 
+  8026d0:	eb 9e                	jmp    802670 <fsipcv+0x1c>
+
+00000000008026d2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	41 54                	push   %r12
+  8026d8:	53                   	push   %rbx
+  8026d9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8026dc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8026df:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8026e6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8026e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ed:	bf 05 00 00 00       	mov    $0x5,%edi
+  8026f2:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	78 3d                	js     80273f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802702:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802709:	00 00 00 
+  80270c:	4c 89 e6             	mov    %r12,%rsi
+  80270f:	48 89 df             	mov    %rbx,%rdi
+  802712:	48 b8 24 0f 80 00 00 	movabs $0x800f24,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80271e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802725:	00 
+  802726:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80272c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802733:	00 
+  802734:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80273f:	5b                   	pop    %rbx
+  802740:	41 5c                	pop    %r12
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+
+0000000000802744 <fsipcv_buf>:
+    return FSIPCV;
+  802744:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80274b:	00 00 00 
+    if (!allocated) {
+  80274e:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802755:	00 00 00 
+  802758:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80275b:	74 01                	je     80275e <fsipcv_buf+0x1a>
+}
+  80275d:	c3                   	ret
+fsipcv_buf(void) {
+  80275e:	55                   	push   %rbp
+  80275f:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802762:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802767:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80276c:	48 89 c6             	mov    %rax,%rsi
+  80276f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802774:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  80277b:	00 00 00 
+  80277e:	ff d0                	call   *%rax
+  802780:	85 c0                	test   %eax,%eax
+  802782:	78 19                	js     80279d <fsipcv_buf+0x59>
+        allocated = 1;
+  802784:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80278b:	00 00 00 
+  80278e:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802791:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802798:	00 00 00 
+}
+  80279b:	5d                   	pop    %rbp
+  80279c:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80279d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a2:	eb f7                	jmp    80279b <fsipcv_buf+0x57>
+
+00000000008027a4 <devfile_write>:
+    if (!fd || !buf) {
+  8027a4:	48 85 ff             	test   %rdi,%rdi
+  8027a7:	0f 84 46 01 00 00    	je     8028f3 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8027ad:	55                   	push   %rbp
+  8027ae:	48 89 e5             	mov    %rsp,%rbp
+  8027b1:	41 57                	push   %r15
+  8027b3:	41 56                	push   %r14
+  8027b5:	41 55                	push   %r13
+  8027b7:	41 54                	push   %r12
+  8027b9:	53                   	push   %rbx
+  8027ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8027be:	49 89 ff             	mov    %rdi,%r15
+  8027c1:	49 89 f5             	mov    %rsi,%r13
+  8027c4:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8027c7:	48 85 f6             	test   %rsi,%rsi
+  8027ca:	0f 84 1a 01 00 00    	je     8028ea <devfile_write+0x146>
+    while (n) {
+  8027d0:	48 85 d2             	test   %rdx,%rdx
+  8027d3:	0f 84 fc 00 00 00    	je     8028d5 <devfile_write+0x131>
+    size_t i = 0;
+  8027d9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8027df:	eb 6c                	jmp    80284d <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8027e1:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8027e7:	4c 39 e3             	cmp    %r12,%rbx
+  8027ea:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8027ee:	4c 89 e2             	mov    %r12,%rdx
+  8027f1:	4c 89 ee             	mov    %r13,%rsi
+  8027f4:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8027fb:	00 00 00 
+  8027fe:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  802805:	00 00 00 
+  802808:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80280a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80280e:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802815:	00 00 00 
+  802818:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80281a:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  80281e:	be 00 00 00 00       	mov    $0x0,%esi
+  802823:	bf 04 00 00 00       	mov    $0x4,%edi
+  802828:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	85 c0                	test   %eax,%eax
+  802836:	0f 88 95 00 00 00    	js     8028d1 <devfile_write+0x12d>
+        buf += ret;
+  80283c:	48 98                	cltq
+  80283e:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802841:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802844:	48 29 c3             	sub    %rax,%rbx
+  802847:	0f 84 8b 00 00 00    	je     8028d8 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  80284d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802854:	76 8b                	jbe    8027e1 <devfile_write+0x3d>
+  802856:	48 b8 44 27 80 00 00 	movabs $0x802744,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	49 89 c4             	mov    %rax,%r12
+  802865:	48 85 c0             	test   %rax,%rax
+  802868:	0f 84 73 ff ff ff    	je     8027e1 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  80286e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802873:	48 39 c3             	cmp    %rax,%rbx
+  802876:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  80287a:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802881:	00 
+  802882:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802886:	48 89 c2             	mov    %rax,%rdx
+  802889:	4c 89 ee             	mov    %r13,%rsi
+  80288c:	48 b9 85 11 80 00 00 	movabs $0x801185,%rcx
+  802893:	00 00 00 
+  802896:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802898:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80289c:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8028a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a4:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  8028a9:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8028b0:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8028b4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8028b9:	48 b8 54 26 80 00 00 	movabs $0x802654,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	0f 89 6f ff ff ff    	jns    80283c <devfile_write+0x98>
+                return ret;
+  8028cd:	48 98                	cltq
+  8028cf:	eb 0a                	jmp    8028db <devfile_write+0x137>
+                return ret;
+  8028d1:	48 98                	cltq
+  8028d3:	eb 06                	jmp    8028db <devfile_write+0x137>
+    size_t i = 0;
+  8028d5:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8028d8:	4c 89 f0             	mov    %r14,%rax
+}
+  8028db:	48 83 c4 18          	add    $0x18,%rsp
+  8028df:	5b                   	pop    %rbx
+  8028e0:	41 5c                	pop    %r12
+  8028e2:	41 5d                	pop    %r13
+  8028e4:	41 5e                	pop    %r14
+  8028e6:	41 5f                	pop    %r15
+  8028e8:	5d                   	pop    %rbp
+  8028e9:	c3                   	ret
+        return -E_INVAL;
+  8028ea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028f1:	eb e8                	jmp    8028db <devfile_write+0x137>
+  8028f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8028fa:	c3                   	ret
+
+00000000008028fb <devfile_read>:
+    if (!fd || !buf) {
+  8028fb:	48 85 ff             	test   %rdi,%rdi
+  8028fe:	0f 84 47 01 00 00    	je     802a4b <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802904:	55                   	push   %rbp
+  802905:	48 89 e5             	mov    %rsp,%rbp
+  802908:	41 57                	push   %r15
+  80290a:	41 56                	push   %r14
+  80290c:	41 55                	push   %r13
+  80290e:	41 54                	push   %r12
+  802910:	53                   	push   %rbx
+  802911:	48 83 ec 18          	sub    $0x18,%rsp
+  802915:	49 89 ff             	mov    %rdi,%r15
+  802918:	49 89 f5             	mov    %rsi,%r13
+  80291b:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  80291e:	48 85 f6             	test   %rsi,%rsi
+  802921:	0f 84 1b 01 00 00    	je     802a42 <devfile_read+0x147>
+    while (n) {
+  802927:	48 85 d2             	test   %rdx,%rdx
+  80292a:	0f 84 fb 00 00 00    	je     802a2b <devfile_read+0x130>
+    size_t i = 0;
+  802930:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802937:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802938:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80293f:	00 00 00 
+  802942:	eb 5f                	jmp    8029a3 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802944:	48 98                	cltq
+  802946:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80294b:	e9 e3 00 00 00       	jmp    802a33 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802950:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802954:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802957:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  80295b:	be 00 00 00 00       	mov    $0x0,%esi
+  802960:	bf 03 00 00 00       	mov    $0x3,%edi
+  802965:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+  802971:	89 c3                	mov    %eax,%ebx
+  802973:	85 c0                	test   %eax,%eax
+  802975:	0f 8e a7 00 00 00    	jle    802a22 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  80297b:	48 63 d0             	movslq %eax,%rdx
+  80297e:	4c 89 f6             	mov    %r14,%rsi
+  802981:	4c 89 ef             	mov    %r13,%rdi
+  802984:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  80298b:	00 00 00 
+  80298e:	ff d0                	call   *%rax
+        buf += ret;
+  802990:	48 63 db             	movslq %ebx,%rbx
+  802993:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802996:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  80299a:	49 29 dc             	sub    %rbx,%r12
+  80299d:	0f 84 8c 00 00 00    	je     802a2f <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8029a3:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8029aa:	76 a4                	jbe    802950 <devfile_read+0x55>
+  8029ac:	48 b8 44 27 80 00 00 	movabs $0x802744,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	48 89 c1             	mov    %rax,%rcx
+  8029bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029bf:	48 85 c0             	test   %rax,%rax
+  8029c2:	74 8c                	je     802950 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8029c4:	be 00 00 04 00       	mov    $0x40000,%esi
+  8029c9:	49 39 f4             	cmp    %rsi,%r12
+  8029cc:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8029d0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029d4:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8029d6:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8029da:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8029e1:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8029e5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8029ea:	48 b8 54 26 80 00 00 	movabs $0x802654,%rax
+  8029f1:	00 00 00 
+  8029f4:	ff d0                	call   *%rax
+  8029f6:	89 c3                	mov    %eax,%ebx
+  8029f8:	85 c0                	test   %eax,%eax
+  8029fa:	0f 8e 44 ff ff ff    	jle    802944 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802a00:	48 63 d0             	movslq %eax,%rdx
+  802a03:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a07:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802a0e:	4c 89 ef             	mov    %r13,%rdi
+  802a11:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a1d:	e9 6e ff ff ff       	jmp    802990 <devfile_read+0x95>
+                return ret ? ret : i;
+  802a22:	48 98                	cltq
+  802a24:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a29:	eb 08                	jmp    802a33 <devfile_read+0x138>
+    size_t i = 0;
+  802a2b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802a2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802a33:	48 83 c4 18          	add    $0x18,%rsp
+  802a37:	5b                   	pop    %rbx
+  802a38:	41 5c                	pop    %r12
+  802a3a:	41 5d                	pop    %r13
+  802a3c:	41 5e                	pop    %r14
+  802a3e:	41 5f                	pop    %r15
+  802a40:	5d                   	pop    %rbp
+  802a41:	c3                   	ret
+        return -E_INVAL;
+  802a42:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a49:	eb e8                	jmp    802a33 <devfile_read+0x138>
+  802a4b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802a52:	c3                   	ret
+
+0000000000802a53 <open>:
+open(const char *path, int mode) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+  802a57:	41 55                	push   %r13
+  802a59:	41 54                	push   %r12
+  802a5b:	53                   	push   %rbx
+  802a5c:	48 83 ec 18          	sub    $0x18,%rsp
+  802a60:	49 89 fc             	mov    %rdi,%r12
+  802a63:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802a66:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  802a6d:	00 00 00 
+  802a70:	ff d0                	call   *%rax
+  802a72:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802a78:	0f 87 8a 00 00 00    	ja     802b08 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a7e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a82:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+  802a8e:	89 c3                	mov    %eax,%ebx
+  802a90:	85 c0                	test   %eax,%eax
+  802a92:	78 50                	js     802ae4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802a94:	4c 89 e6             	mov    %r12,%rsi
+  802a97:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802a9e:	00 00 00 
+  802aa1:	48 89 df             	mov    %rbx,%rdi
+  802aa4:	48 b8 24 0f 80 00 00 	movabs $0x800f24,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ab0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ab7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802abb:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ac0:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+  802acc:	89 c3                	mov    %eax,%ebx
+  802ace:	85 c0                	test   %eax,%eax
+  802ad0:	78 1f                	js     802af1 <open+0x9e>
+    return fd2num(fd);
+  802ad2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ad6:	48 b8 5b 1d 80 00 00 	movabs $0x801d5b,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+  802ae2:	89 c3                	mov    %eax,%ebx
+}
+  802ae4:	89 d8                	mov    %ebx,%eax
+  802ae6:	48 83 c4 18          	add    $0x18,%rsp
+  802aea:	5b                   	pop    %rbx
+  802aeb:	41 5c                	pop    %r12
+  802aed:	41 5d                	pop    %r13
+  802aef:	5d                   	pop    %rbp
+  802af0:	c3                   	ret
+        fd_close(fd, 0);
+  802af1:	be 00 00 00 00       	mov    $0x0,%esi
+  802af6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802afa:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+        return res;
+  802b06:	eb dc                	jmp    802ae4 <open+0x91>
+        return -E_BAD_PATH;
+  802b08:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b0d:	eb d5                	jmp    802ae4 <open+0x91>
+
+0000000000802b0f <sync>:
+sync(void) {
+  802b0f:	55                   	push   %rbp
+  802b10:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802b13:	be 00 00 00 00       	mov    $0x0,%esi
+  802b18:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b1d:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  802b24:	00 00 00 
+  802b27:	ff d0                	call   *%rax
+}
+  802b29:	5d                   	pop    %rbp
+  802b2a:	c3                   	ret
+
+0000000000802b2b <drop_cache>:
+drop_cache(int fdnum) {
+  802b2b:	55                   	push   %rbp
+  802b2c:	48 89 e5             	mov    %rsp,%rbp
+  802b2f:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b37:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 51                	js     802b98 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802b47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b4b:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802b52:	00 00 00 
+  802b55:	8b 0a                	mov    (%rdx),%ecx
+  802b57:	39 08                	cmp    %ecx,(%rax)
+  802b59:	75 3f                	jne    802b9a <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802b5b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802b62:	00 
+  802b63:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802b6a:	00 
+  802b6b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b72:	00 
+  802b73:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b7a:	00 
+  802b7b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802b7f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802b83:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802b87:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802b8c:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+}
+  802b98:	c9                   	leave
+  802b99:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802b9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b9f:	eb f7                	jmp    802b98 <drop_cache+0x6d>
+
+0000000000802ba1 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+  802ba5:	41 57                	push   %r15
+  802ba7:	41 56                	push   %r14
+  802ba9:	41 55                	push   %r13
+  802bab:	41 54                	push   %r12
+  802bad:	53                   	push   %rbx
+  802bae:	48 83 ec 58          	sub    $0x58,%rsp
+  802bb2:	41 89 f4             	mov    %esi,%r12d
+  802bb5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802bb9:	49 89 cd             	mov    %rcx,%r13
+  802bbc:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bbf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802bc3:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+  802bcf:	48 63 d0             	movslq %eax,%rdx
+  802bd2:	85 c0                	test   %eax,%eax
+  802bd4:	0f 88 36 01 00 00    	js     802d10 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802bda:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802bde:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802be5:	00 00 00 
+  802be8:	8b 32                	mov    (%rdx),%esi
+  802bea:	39 31                	cmp    %esi,(%rcx)
+  802bec:	0f 85 30 01 00 00    	jne    802d22 <read_map+0x181>
+  802bf2:	45 85 e4             	test   %r12d,%r12d
+  802bf5:	0f 88 27 01 00 00    	js     802d22 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802bfb:	49 63 cc             	movslq %r12d,%rcx
+  802bfe:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c02:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c09:	0f 85 1c 01 00 00    	jne    802d2b <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c0f:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802c13:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802c1a:	0f 85 14 01 00 00    	jne    802d34 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802c20:	48 63 cb             	movslq %ebx,%rcx
+  802c23:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c27:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  802c2e:	00 00 00 
+    while (i < n) {
+  802c31:	4d 85 ed             	test   %r13,%r13
+  802c34:	75 5c                	jne    802c92 <read_map+0xf1>
+  802c36:	e9 d2 00 00 00       	jmp    802d0d <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802c3b:	41 8b 3e             	mov    (%r14),%edi
+  802c3e:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802c42:	50                   	push   %rax
+  802c43:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802c47:	50                   	push   %rax
+  802c48:	4d 89 f9             	mov    %r15,%r9
+  802c4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c51:	48 89 d9             	mov    %rbx,%rcx
+  802c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c59:	be 09 00 00 00       	mov    $0x9,%esi
+  802c5e:	48 b8 0e 41 80 00 00 	movabs $0x80410e,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802c6a:	48 83 c4 10          	add    $0x10,%rsp
+  802c6e:	85 c0                	test   %eax,%eax
+  802c70:	0f 8e 8f 00 00 00    	jle    802d05 <read_map+0x164>
+        if (!mapped_perm) {
+  802c76:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802c7a:	0f 84 80 00 00 00    	je     802d00 <read_map+0x15f>
+        i += res;
+  802c80:	48 63 d0             	movslq %eax,%rdx
+  802c83:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802c86:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802c8b:	75 78                	jne    802d05 <read_map+0x164>
+    while (i < n) {
+  802c8d:	4d 39 ec             	cmp    %r13,%r12
+  802c90:	73 73                	jae    802d05 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802c92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c96:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802c9a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802c9e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802ca2:	4c 01 e0             	add    %r12,%rax
+  802ca5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ca9:	4c 89 eb             	mov    %r13,%rbx
+  802cac:	4c 29 e3             	sub    %r12,%rbx
+  802caf:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802cb3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802cb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802cbb:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802cc2:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802cc9:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802cce:	48 39 c3             	cmp    %rax,%rbx
+  802cd1:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802cd5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802cd9:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802cdd:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802ce1:	0f 85 54 ff ff ff    	jne    802c3b <read_map+0x9a>
+  802ce7:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cec:	48 b8 75 43 80 00 00 	movabs $0x804375,%rax
+  802cf3:	00 00 00 
+  802cf6:	ff d0                	call   *%rax
+  802cf8:	41 89 06             	mov    %eax,(%r14)
+  802cfb:	e9 3b ff ff ff       	jmp    802c3b <read_map+0x9a>
+            res = -E_INVAL;
+  802d00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802d05:	4c 89 e2             	mov    %r12,%rdx
+  802d08:	4d 85 e4             	test   %r12,%r12
+  802d0b:	75 03                	jne    802d10 <read_map+0x16f>
+  802d0d:	48 63 d0             	movslq %eax,%rdx
+}
+  802d10:	48 89 d0             	mov    %rdx,%rax
+  802d13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d17:	5b                   	pop    %rbx
+  802d18:	41 5c                	pop    %r12
+  802d1a:	41 5d                	pop    %r13
+  802d1c:	41 5e                	pop    %r14
+  802d1e:	41 5f                	pop    %r15
+  802d20:	5d                   	pop    %rbp
+  802d21:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d22:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d29:	eb e5                	jmp    802d10 <read_map+0x16f>
+  802d2b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d32:	eb dc                	jmp    802d10 <read_map+0x16f>
+  802d34:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d3b:	eb d3                	jmp    802d10 <read_map+0x16f>
+
+0000000000802d3d <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802d3d:	55                   	push   %rbp
+  802d3e:	48 89 e5             	mov    %rsp,%rbp
+  802d41:	41 57                	push   %r15
+  802d43:	41 56                	push   %r14
+  802d45:	41 55                	push   %r13
+  802d47:	41 54                	push   %r12
+  802d49:	53                   	push   %rbx
+  802d4a:	48 83 ec 38          	sub    $0x38,%rsp
+  802d4e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802d51:	41 89 f6             	mov    %esi,%r14d
+  802d54:	49 89 d5             	mov    %rdx,%r13
+  802d57:	89 cb                	mov    %ecx,%ebx
+  802d59:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802d5c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802d60:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  802d67:	00 00 00 
+  802d6a:	ff d0                	call   *%rax
+  802d6c:	85 c0                	test   %eax,%eax
+  802d6e:	0f 88 33 02 00 00    	js     802fa7 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d74:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802d79:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d7d:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802d84:	00 00 00 
+  802d87:	8b 3a                	mov    (%rdx),%edi
+  802d89:	39 39                	cmp    %edi,(%rcx)
+  802d8b:	0f 85 1b 02 00 00    	jne    802fac <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802d91:	4d 85 ed             	test   %r13,%r13
+  802d94:	41 0f 94 c0          	sete   %r8b
+  802d98:	44 89 f0             	mov    %r14d,%eax
+  802d9b:	c1 e8 1f             	shr    $0x1f,%eax
+  802d9e:	41 08 c0             	or     %al,%r8b
+  802da1:	0f 85 14 02 00 00    	jne    802fbb <mmap+0x27e>
+  802da7:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802dae:	0f 85 0e 02 00 00    	jne    802fc2 <mmap+0x285>
+  802db4:	83 fb 07             	cmp    $0x7,%ebx
+  802db7:	0f 87 0c 02 00 00    	ja     802fc9 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802dbd:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802dc7:	83 fa 01             	cmp    $0x1,%edx
+  802dca:	0f 87 dc 01 00 00    	ja     802fac <mmap+0x26f>
+  802dd0:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  802dd7:	00 00 00 
+  802dda:	eb 0e                	jmp    802dea <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ddc:	48 83 c0 01          	add    $0x1,%rax
+  802de0:	48 83 c2 20          	add    $0x20,%rdx
+  802de4:	48 83 f8 40          	cmp    $0x40,%rax
+  802de8:	74 44                	je     802e2e <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802dea:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802dee:	75 ec                	jne    802ddc <mmap+0x9f>
+  802df0:	48 c1 e0 05          	shl    $0x5,%rax
+  802df4:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  802dfb:	00 00 00 
+  802dfe:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802e02:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802e09:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e10:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802e13:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802e1a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802e22:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  802e29:	00 00 00 
+  802e2c:	eb 17                	jmp    802e45 <mmap+0x108>
+  802e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e33:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802e39:	eb c7                	jmp    802e02 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e3b:	48 83 c0 01          	add    $0x1,%rax
+  802e3f:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802e43:	77 37                	ja     802e7c <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802e45:	48 89 c2             	mov    %rax,%rdx
+  802e48:	48 c1 e2 05          	shl    $0x5,%rdx
+  802e4c:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802e51:	48 85 d2             	test   %rdx,%rdx
+  802e54:	74 e5                	je     802e3b <mmap+0xfe>
+  802e56:	48 89 c7             	mov    %rax,%rdi
+  802e59:	48 c1 e7 05          	shl    $0x5,%rdi
+  802e5d:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802e61:	48 01 fa             	add    %rdi,%rdx
+  802e64:	48 39 d6             	cmp    %rdx,%rsi
+  802e67:	73 d2                	jae    802e3b <mmap+0xfe>
+  802e69:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802e6d:	4c 39 d7             	cmp    %r10,%rdi
+  802e70:	73 c9                	jae    802e3b <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802e72:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7a:	eb c9                	jmp    802e45 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802e7c:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802e80:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802e85:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802e8c:	00 00 00 
+  802e8f:	49 39 f9             	cmp    %rdi,%r9
+  802e92:	0f 82 14 01 00 00    	jb     802fac <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802e98:	48 85 f6             	test   %rsi,%rsi
+  802e9b:	0f 84 2f 01 00 00    	je     802fd0 <mmap+0x293>
+  802ea1:	45 84 c0             	test   %r8b,%r8b
+  802ea4:	0f 85 26 01 00 00    	jne    802fd0 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802eaa:	41 83 fc 01          	cmp    $0x1,%r12d
+  802eae:	0f 94 c0             	sete   %al
+  802eb1:	0f b6 c0             	movzbl %al,%eax
+  802eb4:	c1 e0 06             	shl    $0x6,%eax
+  802eb7:	09 d8                	or     %ebx,%eax
+  802eb9:	89 c3                	mov    %eax,%ebx
+  802ebb:	83 cb 04             	or     $0x4,%ebx
+  802ebe:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802ec1:	4d 85 ff             	test   %r15,%r15
+  802ec4:	0f 84 bd 00 00 00    	je     802f87 <mmap+0x24a>
+  802eca:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802ecf:	83 e0 bf             	and    $0xffffffbf,%eax
+  802ed2:	83 c8 04             	or     $0x4,%eax
+  802ed5:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802ed8:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802edc:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802ee0:	49 89 f6             	mov    %rsi,%r14
+  802ee3:	eb 43                	jmp    802f28 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802ee5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802eeb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ef1:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802ef4:	eb 2d                	jmp    802f23 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802ef6:	48 85 c0             	test   %rax,%rax
+  802ef9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802efe:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f02:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802f05:	4c 89 e2             	mov    %r12,%rdx
+  802f08:	4c 89 ee             	mov    %r13,%rsi
+  802f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f10:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	78 3e                	js     802f5e <mmap+0x221>
+        i += n;
+  802f20:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802f23:	4c 39 fb             	cmp    %r15,%rbx
+  802f26:	73 54                	jae    802f7c <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802f28:	4d 89 fc             	mov    %r15,%r12
+  802f2b:	49 29 dc             	sub    %rbx,%r12
+  802f2e:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802f32:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802f35:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802f38:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802f3c:	4c 89 e1             	mov    %r12,%rcx
+  802f3f:	4c 89 ea             	mov    %r13,%rdx
+  802f42:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802f45:	48 b8 a1 2b 80 00 00 	movabs $0x802ba1,%rax
+  802f4c:	00 00 00 
+  802f4f:	ff d0                	call   *%rax
+        if (res > 0) {
+  802f51:	48 85 c0             	test   %rax,%rax
+  802f54:	7f 8f                	jg     802ee5 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802f56:	74 9e                	je     802ef6 <mmap+0x1b9>
+  802f58:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802f5c:	74 98                	je     802ef6 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802f5e:	4c 89 f6             	mov    %r14,%rsi
+  802f61:	4c 89 fa             	mov    %r15,%rdx
+  802f64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f69:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  802f70:	00 00 00 
+  802f73:	ff d0                	call   *%rax
+    return NULL;
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7a:	eb 30                	jmp    802fac <mmap+0x26f>
+  802f7c:	4c 89 f6             	mov    %r14,%rsi
+  802f7f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802f83:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802f87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f8b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f8e:	48 89 31             	mov    %rsi,(%rcx)
+  802f91:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802f95:	89 41 10             	mov    %eax,0x10(%rcx)
+  802f98:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802f9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f9f:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802fa2:	48 89 f0             	mov    %rsi,%rax
+  802fa5:	eb 05                	jmp    802fac <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fac:	48 83 c4 38          	add    $0x38,%rsp
+  802fb0:	5b                   	pop    %rbx
+  802fb1:	41 5c                	pop    %r12
+  802fb3:	41 5d                	pop    %r13
+  802fb5:	41 5e                	pop    %r14
+  802fb7:	41 5f                	pop    %r15
+  802fb9:	5d                   	pop    %rbp
+  802fba:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc0:	eb ea                	jmp    802fac <mmap+0x26f>
+  802fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc7:	eb e3                	jmp    802fac <mmap+0x26f>
+  802fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fce:	eb dc                	jmp    802fac <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd5:	eb d5                	jmp    802fac <mmap+0x26f>
+
+0000000000802fd7 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802fd7:	55                   	push   %rbp
+  802fd8:	48 89 e5             	mov    %rsp,%rbp
+  802fdb:	41 57                	push   %r15
+  802fdd:	41 56                	push   %r14
+  802fdf:	41 55                	push   %r13
+  802fe1:	41 54                	push   %r12
+  802fe3:	53                   	push   %rbx
+  802fe4:	48 83 ec 38          	sub    $0x38,%rsp
+  802fe8:	49 89 fc             	mov    %rdi,%r12
+  802feb:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802fee:	48 b8 9d 24 80 00 00 	movabs $0x80249d,%rax
+  802ff5:	00 00 00 
+  802ff8:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802ffa:	48 85 c0             	test   %rax,%rax
+  802ffd:	0f 84 2f 01 00 00    	je     803132 <msync+0x15b>
+  803003:	49 89 c7             	mov    %rax,%r15
+  803006:	4d 01 e5             	add    %r12,%r13
+  803009:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80300d:	49 03 07             	add    (%r15),%rax
+  803010:	4c 39 e8             	cmp    %r13,%rax
+  803013:	0f 82 20 01 00 00    	jb     803139 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803019:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80301d:	83 e0 40             	and    $0x40,%eax
+  803020:	0f 84 fd 00 00 00    	je     803123 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803026:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80302d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803034:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  80303b:	4d 39 ec             	cmp    %r13,%r12
+  80303e:	0f 83 fc 00 00 00    	jae    803140 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803044:	49 be 26 3d 80 00 00 	movabs $0x803d26,%r14
+  80304b:	00 00 00 
+  80304e:	e9 b0 00 00 00       	jmp    803103 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803053:	4c 89 e3             	mov    %r12,%rbx
+  803056:	4d 39 ec             	cmp    %r13,%r12
+  803059:	73 16                	jae    803071 <msync+0x9a>
+  80305b:	48 89 df             	mov    %rbx,%rdi
+  80305e:	41 ff d6             	call   *%r14
+  803061:	84 c0                	test   %al,%al
+  803063:	74 0c                	je     803071 <msync+0x9a>
+  803065:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80306c:	4c 39 eb             	cmp    %r13,%rbx
+  80306f:	72 ea                	jb     80305b <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803071:	48 89 d8             	mov    %rbx,%rax
+  803074:	4c 29 e0             	sub    %r12,%rax
+  803077:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  80307b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80307f:	49 89 c0             	mov    %rax,%r8
+  803082:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803086:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308b:	48 89 ce             	mov    %rcx,%rsi
+  80308e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803093:	49 ba 85 16 80 00 00 	movabs $0x801685,%r10
+  80309a:	00 00 00 
+  80309d:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8030a0:	85 c0                	test   %eax,%eax
+  8030a2:	78 7f                	js     803123 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8030a4:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8030ab:	00 
+  8030ac:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8030b3:	00 
+  8030b4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8030bb:	00 
+  8030bc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8030c3:	00 
+  8030c4:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8030c8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8030cc:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8030d0:	49 2b 07             	sub    (%r15),%rax
+  8030d3:	4c 01 e0             	add    %r12,%rax
+  8030d6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8030da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8030de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8030e2:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8030e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8030eb:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+  8030f7:	85 c0                	test   %eax,%eax
+  8030f9:	78 28                	js     803123 <msync+0x14c>
+  8030fb:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8030fe:	4d 39 ec             	cmp    %r13,%r12
+  803101:	73 1b                	jae    80311e <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803103:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803107:	4c 89 e7             	mov    %r12,%rdi
+  80310a:	41 ff d6             	call   *%r14
+  80310d:	84 c0                	test   %al,%al
+  80310f:	0f 85 3e ff ff ff    	jne    803053 <msync+0x7c>
+            va += PAGE_SIZE;
+  803115:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80311c:	eb e0                	jmp    8030fe <msync+0x127>
+    }
+
+    return 0;
+  80311e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803123:	48 83 c4 38          	add    $0x38,%rsp
+  803127:	5b                   	pop    %rbx
+  803128:	41 5c                	pop    %r12
+  80312a:	41 5d                	pop    %r13
+  80312c:	41 5e                	pop    %r14
+  80312e:	41 5f                	pop    %r15
+  803130:	5d                   	pop    %rbp
+  803131:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803132:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803137:	eb ea                	jmp    803123 <msync+0x14c>
+  803139:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80313e:	eb e3                	jmp    803123 <msync+0x14c>
+    return 0;
+  803140:	b8 00 00 00 00       	mov    $0x0,%eax
+  803145:	eb dc                	jmp    803123 <msync+0x14c>
+
+0000000000803147 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803147:	55                   	push   %rbp
+  803148:	48 89 e5             	mov    %rsp,%rbp
+  80314b:	41 55                	push   %r13
+  80314d:	41 54                	push   %r12
+  80314f:	53                   	push   %rbx
+  803150:	48 83 ec 08          	sub    $0x8,%rsp
+  803154:	49 89 fc             	mov    %rdi,%r12
+  803157:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80315a:	48 b8 9d 24 80 00 00 	movabs $0x80249d,%rax
+  803161:	00 00 00 
+  803164:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803166:	48 85 c0             	test   %rax,%rax
+  803169:	74 58                	je     8031c3 <munmap+0x7c>
+  80316b:	48 89 c3             	mov    %rax,%rbx
+  80316e:	4c 3b 20             	cmp    (%rax),%r12
+  803171:	75 57                	jne    8031ca <munmap+0x83>
+  803173:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80317a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803180:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803184:	75 4b                	jne    8031d1 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803186:	4c 89 ee             	mov    %r13,%rsi
+  803189:	4c 89 e7             	mov    %r12,%rdi
+  80318c:	48 b8 d7 2f 80 00 00 	movabs $0x802fd7,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803198:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80319c:	4c 89 e6             	mov    %r12,%rsi
+  80319f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a4:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8031b0:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8031b7:	00 
+    return res;
+}
+  8031b8:	48 83 c4 08          	add    $0x8,%rsp
+  8031bc:	5b                   	pop    %rbx
+  8031bd:	41 5c                	pop    %r12
+  8031bf:	41 5d                	pop    %r13
+  8031c1:	5d                   	pop    %rbp
+  8031c2:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8031c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031c8:	eb ee                	jmp    8031b8 <munmap+0x71>
+  8031ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031cf:	eb e7                	jmp    8031b8 <munmap+0x71>
+  8031d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031d6:	eb e0                	jmp    8031b8 <munmap+0x71>
+
+00000000008031d8 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8031d8:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8031dc:	7f 01                	jg     8031df <writebuf+0x7>
+  8031de:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8031df:	55                   	push   %rbp
+  8031e0:	48 89 e5             	mov    %rsp,%rbp
+  8031e3:	53                   	push   %rbx
+  8031e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e8:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8031eb:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8031ef:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8031f3:	8b 3f                	mov    (%rdi),%edi
+  8031f5:	48 b8 3c 22 80 00 00 	movabs $0x80223c,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803201:	48 85 c0             	test   %rax,%rax
+  803204:	7e 04                	jle    80320a <writebuf+0x32>
+  803206:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80320a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80320e:	48 39 c2             	cmp    %rax,%rdx
+  803211:	74 0f                	je     803222 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803213:	48 85 c0             	test   %rax,%rax
+  803216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80321b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80321f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803226:	c9                   	leave
+  803227:	c3                   	ret
+
+0000000000803228 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803228:	8b 46 04             	mov    0x4(%rsi),%eax
+  80322b:	8d 50 01             	lea    0x1(%rax),%edx
+  80322e:	89 56 04             	mov    %edx,0x4(%rsi)
+  803231:	48 98                	cltq
+  803233:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803238:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80323e:	74 01                	je     803241 <putch+0x19>
+  803240:	c3                   	ret
+putch(int ch, void *arg) {
+  803241:	55                   	push   %rbp
+  803242:	48 89 e5             	mov    %rsp,%rbp
+  803245:	53                   	push   %rbx
+  803246:	48 83 ec 08          	sub    $0x8,%rsp
+  80324a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80324d:	48 89 f7             	mov    %rsi,%rdi
+  803250:	48 b8 d8 31 80 00 00 	movabs $0x8031d8,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80325c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803263:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803267:	c9                   	leave
+  803268:	c3                   	ret
+
+0000000000803269 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803274:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803277:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80327d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803284:	00 00 00 
+    state.result = 0;
+  803287:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80328e:	00 00 00 00 
+    state.error = 1;
+  803292:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803299:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80329c:	48 89 f2             	mov    %rsi,%rdx
+  80329f:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8032a6:	48 bf 28 32 80 00 00 	movabs $0x803228,%rdi
+  8032ad:	00 00 00 
+  8032b0:	48 b8 4f 07 80 00 00 	movabs $0x80074f,%rax
+  8032b7:	00 00 00 
+  8032ba:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8032bc:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8032c3:	7f 14                	jg     8032d9 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8032c5:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8032cc:	48 85 c0             	test   %rax,%rax
+  8032cf:	75 06                	jne    8032d7 <vfprintf+0x6e>
+  8032d1:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8032d7:	c9                   	leave
+  8032d8:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8032d9:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8032e0:	48 b8 d8 31 80 00 00 	movabs $0x8031d8,%rax
+  8032e7:	00 00 00 
+  8032ea:	ff d0                	call   *%rax
+  8032ec:	eb d7                	jmp    8032c5 <vfprintf+0x5c>
+
+00000000008032ee <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8032ee:	55                   	push   %rbp
+  8032ef:	48 89 e5             	mov    %rsp,%rbp
+  8032f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8032f6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8032fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8032fe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803302:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803306:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80330d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803311:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803315:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803319:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80331d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803321:	48 b8 69 32 80 00 00 	movabs $0x803269,%rax
+  803328:	00 00 00 
+  80332b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80332d:	c9                   	leave
+  80332e:	c3                   	ret
+
+000000000080332f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80332f:	55                   	push   %rbp
+  803330:	48 89 e5             	mov    %rsp,%rbp
+  803333:	48 83 ec 50          	sub    $0x50,%rsp
+  803337:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80333b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80333f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803343:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803347:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80334b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803352:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803356:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80335a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80335e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803362:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803366:	48 89 fe             	mov    %rdi,%rsi
+  803369:	bf 01 00 00 00       	mov    $0x1,%edi
+  80336e:	48 b8 69 32 80 00 00 	movabs $0x803269,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80337a:	c9                   	leave
+  80337b:	c3                   	ret
+
+000000000080337c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80337c:	55                   	push   %rbp
+  80337d:	48 89 e5             	mov    %rsp,%rbp
+  803380:	41 54                	push   %r12
+  803382:	53                   	push   %rbx
+  803383:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803386:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  80338d:	00 00 00 
+  803390:	ff d0                	call   *%rax
+  803392:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803395:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  80339c:	00 00 00 
+  80339f:	48 89 df             	mov    %rbx,%rdi
+  8033a2:	48 b8 24 0f 80 00 00 	movabs $0x800f24,%rax
+  8033a9:	00 00 00 
+  8033ac:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8033ae:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8033b3:	41 8b 14 24          	mov    (%r12),%edx
+  8033b7:	29 d0                	sub    %edx,%eax
+  8033b9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8033bf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8033c6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8033c9:	48 b8 80 60 80 00 00 	movabs $0x806080,%rax
+  8033d0:	00 00 00 
+  8033d3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8033da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033df:	5b                   	pop    %rbx
+  8033e0:	41 5c                	pop    %r12
+  8033e2:	5d                   	pop    %rbp
+  8033e3:	c3                   	ret
+
+00000000008033e4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8033e4:	55                   	push   %rbp
+  8033e5:	48 89 e5             	mov    %rsp,%rbp
+  8033e8:	41 55                	push   %r13
+  8033ea:	41 54                	push   %r12
+  8033ec:	53                   	push   %rbx
+  8033ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f1:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033f4:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+  803400:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803403:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803408:	4c 89 e6             	mov    %r12,%rsi
+  80340b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803410:	49 bc 52 17 80 00 00 	movabs $0x801752,%r12
+  803417:	00 00 00 
+  80341a:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80341d:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803423:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80342a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80342f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803432:	be 00 04 00 00       	mov    $0x400,%esi
+  803437:	48 89 df             	mov    %rbx,%rdi
+  80343a:	49 bd cc 1c 80 00 00 	movabs $0x801ccc,%r13
+  803441:	00 00 00 
+  803444:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803447:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80344b:	be 00 04 00 00       	mov    $0x400,%esi
+  803450:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803453:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803458:	48 89 de             	mov    %rbx,%rsi
+  80345b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803460:	41 ff d4             	call   *%r12
+}
+  803463:	48 83 c4 08          	add    $0x8,%rsp
+  803467:	5b                   	pop    %rbx
+  803468:	41 5c                	pop    %r12
+  80346a:	41 5d                	pop    %r13
+  80346c:	5d                   	pop    %rbp
+  80346d:	c3                   	ret
+
+000000000080346e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80346e:	55                   	push   %rbp
+  80346f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803472:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803478:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80347f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803484:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	85 c0                	test   %eax,%eax
+  803492:	0f 94 c0             	sete   %al
+  803495:	0f b6 c0             	movzbl %al,%eax
+}
+  803498:	5d                   	pop    %rbp
+  803499:	c3                   	ret
+
+000000000080349a <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80349a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80349f:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8034a1:	8b 07                	mov    (%rdi),%eax
+  8034a3:	39 f0                	cmp    %esi,%eax
+  8034a5:	74 01                	je     8034a8 <pipe_wait+0xe>
+  8034a7:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8034ac:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8034ae:	48 c1 e2 20          	shl    $0x20,%rdx
+  8034b2:	89 c0                	mov    %eax,%eax
+  8034b4:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8034b7:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8034be:	48 b8 a2 1c 80 00 00 	movabs $0x801ca2,%rax
+  8034c5:	00 00 00 
+  8034c8:	ff d0                	call   *%rax
+}
+  8034ca:	5d                   	pop    %rbp
+  8034cb:	c3                   	ret
+
+00000000008034cc <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8034cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d1:	87 06                	xchg   %eax,(%rsi)
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	75 01                	jne    8034d8 <pipe_wake+0xc>
+  8034d7:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8034d8:	55                   	push   %rbp
+  8034d9:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8034dc:	be 00 04 00 00       	mov    $0x400,%esi
+  8034e1:	48 b8 cc 1c 80 00 00 	movabs $0x801ccc,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+}
+  8034ed:	5d                   	pop    %rbp
+  8034ee:	c3                   	ret
+
+00000000008034ef <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+  8034f3:	41 57                	push   %r15
+  8034f5:	41 56                	push   %r14
+  8034f7:	41 55                	push   %r13
+  8034f9:	41 54                	push   %r12
+  8034fb:	53                   	push   %rbx
+  8034fc:	48 83 ec 28          	sub    $0x28,%rsp
+  803500:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803504:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803508:	48 89 d3             	mov    %rdx,%rbx
+  80350b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80350f:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  803516:	00 00 00 
+  803519:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80351b:	48 85 db             	test   %rbx,%rbx
+  80351e:	0f 84 0f 01 00 00    	je     803633 <devpipe_write+0x144>
+  803524:	49 89 c4             	mov    %rax,%r12
+  803527:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80352d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803534:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803538:	eb 4f                	jmp    803589 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80353a:	4c 89 e6             	mov    %r12,%rsi
+  80353d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803541:	48 b8 6e 34 80 00 00 	movabs $0x80346e,%rax
+  803548:	00 00 00 
+  80354b:	ff d0                	call   *%rax
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	74 14                	je     803565 <devpipe_write+0x76>
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803556:	48 83 c4 28          	add    $0x28,%rsp
+  80355a:	5b                   	pop    %rbx
+  80355b:	41 5c                	pop    %r12
+  80355d:	41 5d                	pop    %r13
+  80355f:	41 5e                	pop    %r14
+  803561:	41 5f                	pop    %r15
+  803563:	5d                   	pop    %rbp
+  803564:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803565:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80356a:	44 89 ee             	mov    %r13d,%esi
+  80356d:	4c 89 e7             	mov    %r12,%rdi
+  803570:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80357c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803580:	49 39 c7             	cmp    %rax,%r15
+  803583:	0f 83 aa 00 00 00    	jae    803633 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803589:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80358e:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803592:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803599:	00 
+  80359a:	44 89 f0             	mov    %r14d,%eax
+  80359d:	44 29 e8             	sub    %r13d,%eax
+  8035a0:	39 d8                	cmp    %ebx,%eax
+  8035a2:	74 96                	je     80353a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8035a4:	89 d8                	mov    %ebx,%eax
+  8035a6:	44 29 f0             	sub    %r14d,%eax
+  8035a9:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8035ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035b1:	4c 29 f8             	sub    %r15,%rax
+  8035b4:	49 39 c5             	cmp    %rax,%r13
+  8035b7:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8035bb:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8035be:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8035c1:	89 db                	mov    %ebx,%ebx
+  8035c3:	48 29 c3             	sub    %rax,%rbx
+  8035c6:	4c 39 eb             	cmp    %r13,%rbx
+  8035c9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8035cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035d1:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8035d5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8035dc:	00 
+  8035dd:	48 89 da             	mov    %rbx,%rdx
+  8035e0:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  8035e7:	00 00 00 
+  8035ea:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8035ec:	4c 89 ea             	mov    %r13,%rdx
+  8035ef:	48 29 da             	sub    %rbx,%rdx
+  8035f2:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8035f6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035fa:	48 01 ce             	add    %rcx,%rsi
+  8035fd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803601:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80360d:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803612:	45 01 ee             	add    %r13d,%r14d
+  803615:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80361a:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80361f:	48 b8 cc 34 80 00 00 	movabs $0x8034cc,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+        i += chunk;
+  80362b:	4d 01 ef             	add    %r13,%r15
+  80362e:	e9 49 ff ff ff       	jmp    80357c <devpipe_write+0x8d>
+    return n;
+  803633:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803637:	e9 1a ff ff ff       	jmp    803556 <devpipe_write+0x67>
+
+000000000080363c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80363c:	55                   	push   %rbp
+  80363d:	48 89 e5             	mov    %rsp,%rbp
+  803640:	41 57                	push   %r15
+  803642:	41 56                	push   %r14
+  803644:	41 55                	push   %r13
+  803646:	41 54                	push   %r12
+  803648:	53                   	push   %rbx
+  803649:	48 83 ec 28          	sub    $0x28,%rsp
+  80364d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803651:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803655:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803659:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  803660:	00 00 00 
+  803663:	ff d0                	call   *%rax
+  803665:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803668:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80366c:	49 bf 6e 34 80 00 00 	movabs $0x80346e,%r15
+  803673:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803676:	48 8d 40 04          	lea    0x4(%rax),%rax
+  80367a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80367e:	eb 15                	jmp    803695 <devpipe_read+0x59>
+  803680:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803684:	89 de                	mov    %ebx,%esi
+  803686:	4c 89 f7             	mov    %r14,%rdi
+  803689:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803695:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803699:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80369c:	41 39 dd             	cmp    %ebx,%r13d
+  80369f:	75 15                	jne    8036b6 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8036a1:	4c 89 e6             	mov    %r12,%rsi
+  8036a4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036a8:	41 ff d7             	call   *%r15
+  8036ab:	85 c0                	test   %eax,%eax
+  8036ad:	74 d1                	je     803680 <devpipe_read+0x44>
+  8036af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b4:	eb 7c                	jmp    803732 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8036b6:	44 29 eb             	sub    %r13d,%ebx
+  8036b9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8036bd:	48 39 c3             	cmp    %rax,%rbx
+  8036c0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8036c4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8036cb:	00 
+  8036cc:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8036d0:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8036d3:	45 89 f6             	mov    %r14d,%r14d
+  8036d6:	49 29 c6             	sub    %rax,%r14
+  8036d9:	49 39 de             	cmp    %rbx,%r14
+  8036dc:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  8036e0:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8036e7:	00 
+  8036e8:	4c 89 f2             	mov    %r14,%rdx
+  8036eb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8036ef:	49 bf 85 11 80 00 00 	movabs $0x801185,%r15
+  8036f6:	00 00 00 
+  8036f9:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8036fc:	48 89 da             	mov    %rbx,%rdx
+  8036ff:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803702:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803709:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80370a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80370e:	4c 01 f7             	add    %r14,%rdi
+  803711:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803714:	41 01 dd             	add    %ebx,%r13d
+  803717:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80371b:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803720:	4c 89 e7             	mov    %r12,%rdi
+  803723:	48 b8 cc 34 80 00 00 	movabs $0x8034cc,%rax
+  80372a:	00 00 00 
+  80372d:	ff d0                	call   *%rax
+    return n;
+  80372f:	48 89 d8             	mov    %rbx,%rax
+}
+  803732:	48 83 c4 28          	add    $0x28,%rsp
+  803736:	5b                   	pop    %rbx
+  803737:	41 5c                	pop    %r12
+  803739:	41 5d                	pop    %r13
+  80373b:	41 5e                	pop    %r14
+  80373d:	41 5f                	pop    %r15
+  80373f:	5d                   	pop    %rbp
+  803740:	c3                   	ret
+
+0000000000803741 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803741:	55                   	push   %rbp
+  803742:	48 89 e5             	mov    %rsp,%rbp
+  803745:	41 57                	push   %r15
+  803747:	41 56                	push   %r14
+  803749:	41 55                	push   %r13
+  80374b:	41 54                	push   %r12
+  80374d:	53                   	push   %rbx
+  80374e:	48 83 ec 18          	sub    $0x18,%rsp
+  803752:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803755:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80375c:	0f 86 96 01 00 00    	jbe    8038f8 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803762:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803767:	48 01 db             	add    %rbx,%rbx
+  80376a:	48 39 f3             	cmp    %rsi,%rbx
+  80376d:	72 f8                	jb     803767 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80376f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803776:	0f 87 18 02 00 00    	ja     803994 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80377c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803780:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  803787:	00 00 00 
+  80378a:	ff d0                	call   *%rax
+  80378c:	41 89 c4             	mov    %eax,%r12d
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	0f 88 b6 01 00 00    	js     80394d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803797:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80379c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037a1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8037a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037aa:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  8037b1:	00 00 00 
+  8037b4:	ff d0                	call   *%rax
+  8037b6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037b9:	85 c0                	test   %eax,%eax
+  8037bb:	0f 88 8c 01 00 00    	js     80394d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037c1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8037c5:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  8037cc:	00 00 00 
+  8037cf:	ff d0                	call   *%rax
+  8037d1:	41 89 c4             	mov    %eax,%r12d
+  8037d4:	85 c0                	test   %eax,%eax
+  8037d6:	0f 88 57 01 00 00    	js     803933 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037dc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ef:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  8037f6:	00 00 00 
+  8037f9:	ff d0                	call   *%rax
+  8037fb:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037fe:	85 c0                	test   %eax,%eax
+  803800:	0f 88 2d 01 00 00    	js     803933 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803806:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80380a:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  803811:	00 00 00 
+  803814:	ff d0                	call   *%rax
+  803816:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803819:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803820:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803825:	4c 89 fa             	mov    %r15,%rdx
+  803828:	48 89 c6             	mov    %rax,%rsi
+  80382b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803830:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+  80383c:	41 89 c4             	mov    %eax,%r12d
+  80383f:	85 c0                	test   %eax,%eax
+  803841:	0f 88 d2 00 00 00    	js     803919 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803847:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80384e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803852:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+  80385e:	48 89 c1             	mov    %rax,%rcx
+  803861:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803867:	4d 89 f8             	mov    %r15,%r8
+  80386a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80386f:	4c 89 f6             	mov    %r14,%rsi
+  803872:	bf 00 00 00 00       	mov    $0x0,%edi
+  803877:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  80387e:	00 00 00 
+  803881:	ff d0                	call   *%rax
+  803883:	41 89 c4             	mov    %eax,%r12d
+  803886:	85 c0                	test   %eax,%eax
+  803888:	78 78                	js     803902 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80388a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80388f:	4c 89 f7             	mov    %r14,%rdi
+  803892:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  803899:	00 00 00 
+  80389c:	ff d0                	call   *%rax
+  80389e:	83 f8 02             	cmp    $0x2,%eax
+  8038a1:	0f 85 b8 00 00 00    	jne    80395f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8038a7:	a1 80 60 80 00 00 00 	movabs 0x806080,%eax
+  8038ae:	00 00 
+  8038b0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8038b4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8038b6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8038ba:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038c5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038c7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038cb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038d2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038d6:	48 bb 5b 1d 80 00 00 	movabs $0x801d5b,%rbx
+  8038dd:	00 00 00 
+  8038e0:	ff d3                	call   *%rbx
+  8038e2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8038e6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8038ea:	ff d3                	call   *%rbx
+  8038ec:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8038f0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038f6:	eb 55                	jmp    80394d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8038f8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8038fd:	e9 7a fe ff ff       	jmp    80377c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803902:	4c 89 fa             	mov    %r15,%rdx
+  803905:	4c 89 f6             	mov    %r14,%rsi
+  803908:	bf 00 00 00 00       	mov    $0x0,%edi
+  80390d:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  803914:	00 00 00 
+  803917:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803919:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80391e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803922:	bf 00 00 00 00       	mov    $0x0,%edi
+  803927:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  80392e:	00 00 00 
+  803931:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803933:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803938:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80393c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803941:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+}
+  80394d:	44 89 e0             	mov    %r12d,%eax
+  803950:	48 83 c4 18          	add    $0x18,%rsp
+  803954:	5b                   	pop    %rbx
+  803955:	41 5c                	pop    %r12
+  803957:	41 5d                	pop    %r13
+  803959:	41 5e                	pop    %r14
+  80395b:	41 5f                	pop    %r15
+  80395d:	5d                   	pop    %rbp
+  80395e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80395f:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803966:	00 00 00 
+  803969:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803970:	00 00 00 
+  803973:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803978:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  80397f:	00 00 00 
+  803982:	b8 00 00 00 00       	mov    $0x0,%eax
+  803987:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  80398e:	00 00 00 
+  803991:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803994:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80399a:	eb b1                	jmp    80394d <pipe_sized+0x20c>
+
+000000000080399c <pipe>:
+pipe(int pfd[2]) {
+  80399c:	55                   	push   %rbp
+  80399d:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8039a0:	be 00 00 01 00       	mov    $0x10000,%esi
+  8039a5:	48 b8 41 37 80 00 00 	movabs $0x803741,%rax
+  8039ac:	00 00 00 
+  8039af:	ff d0                	call   *%rax
+}
+  8039b1:	5d                   	pop    %rbp
+  8039b2:	c3                   	ret
+
+00000000008039b3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8039b3:	55                   	push   %rbp
+  8039b4:	48 89 e5             	mov    %rsp,%rbp
+  8039b7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8039bb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8039bf:	48 b8 eb 1d 80 00 00 	movabs $0x801deb,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	78 23                	js     8039f2 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8039cf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039d3:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  8039da:	00 00 00 
+  8039dd:	ff d0                	call   *%rax
+  8039df:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8039e2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039e6:	48 b8 6e 34 80 00 00 	movabs $0x80346e,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+}
+  8039f2:	c9                   	leave
+  8039f3:	c3                   	ret
+
+00000000008039f4 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8039f4:	55                   	push   %rbp
+  8039f5:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8039f8:	8b 0f                	mov    (%rdi),%ecx
+  8039fa:	8d 41 01             	lea    0x1(%rcx),%eax
+  8039fd:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8039ff:	83 f9 07             	cmp    $0x7,%ecx
+  803a02:	76 31                	jbe    803a35 <backoff+0x41>
+    asm volatile("rdtsc"
+  803a04:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803a06:	83 c1 06             	add    $0x6,%ecx
+  803a09:	be 15 00 00 00       	mov    $0x15,%esi
+  803a0e:	39 f1                	cmp    %esi,%ecx
+  803a10:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803a13:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a18:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803a1b:	48 c1 e2 20          	shl    $0x20,%rdx
+  803a1f:	89 c0                	mov    %eax,%eax
+  803a21:	48 09 c2             	or     %rax,%rdx
+  803a24:	48 01 d7             	add    %rdx,%rdi
+  803a27:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  803a2e:	00 00 00 
+  803a31:	ff d0                	call   *%rax
+}
+  803a33:	5d                   	pop    %rbp
+  803a34:	c3                   	ret
+        sys_yield();
+  803a35:	48 b8 8f 15 80 00 00 	movabs $0x80158f,%rax
+  803a3c:	00 00 00 
+  803a3f:	ff d0                	call   *%rax
+        return;
+  803a41:	eb f0                	jmp    803a33 <backoff+0x3f>
+
+0000000000803a43 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803a43:	55                   	push   %rbp
+  803a44:	48 89 e5             	mov    %rsp,%rbp
+  803a47:	41 55                	push   %r13
+  803a49:	41 54                	push   %r12
+  803a4b:	53                   	push   %rbx
+  803a4c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803a50:	85 ff                	test   %edi,%edi
+  803a52:	74 7e                	je     803ad2 <wait+0x8f>
+  803a54:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803a57:	89 f8                	mov    %edi,%eax
+  803a59:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803a5e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803a65:	89 f9                	mov    %edi,%ecx
+  803a67:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803a6d:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803a74:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803a7b:	00 00 00 
+  803a7e:	48 01 ca             	add    %rcx,%rdx
+  803a81:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803a87:	39 d7                	cmp    %edx,%edi
+  803a89:	75 3c                	jne    803ac7 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803a8b:	48 98                	cltq
+  803a8d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803a94:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803a9b:	00 00 00 
+  803a9e:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803aa1:	49 bd f4 39 80 00 00 	movabs $0x8039f4,%r13
+  803aa8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803aab:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803ab1:	85 c0                	test   %eax,%eax
+  803ab3:	74 12                	je     803ac7 <wait+0x84>
+        backoff(&attempt);
+  803ab5:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803ab9:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803abc:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803ac2:	44 39 e0             	cmp    %r12d,%eax
+  803ac5:	74 e4                	je     803aab <wait+0x68>
+    }
+}
+  803ac7:	48 83 c4 18          	add    $0x18,%rsp
+  803acb:	5b                   	pop    %rbx
+  803acc:	41 5c                	pop    %r12
+  803ace:	41 5d                	pop    %r13
+  803ad0:	5d                   	pop    %rbp
+  803ad1:	c3                   	ret
+    assert(envid != 0);
+  803ad2:	48 b9 54 57 80 00 00 	movabs $0x805754,%rcx
+  803ad9:	00 00 00 
+  803adc:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803ae3:	00 00 00 
+  803ae6:	be 22 00 00 00       	mov    $0x22,%esi
+  803aeb:	48 bf 5f 57 80 00 00 	movabs $0x80575f,%rdi
+  803af2:	00 00 00 
+  803af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afa:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  803b01:	00 00 00 
+  803b04:	41 ff d0             	call   *%r8
+
+0000000000803b07 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b07:	48 89 f8             	mov    %rdi,%rax
+  803b0a:	48 c1 e8 27          	shr    $0x27,%rax
+  803b0e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803b15:	7f 00 00 
+  803b18:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b1c:	f6 c2 01             	test   $0x1,%dl
+  803b1f:	74 6d                	je     803b8e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b21:	48 89 f8             	mov    %rdi,%rax
+  803b24:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b28:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b2f:	7f 00 00 
+  803b32:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b36:	f6 c2 01             	test   $0x1,%dl
+  803b39:	74 62                	je     803b9d <get_uvpt_entry+0x96>
+  803b3b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b42:	7f 00 00 
+  803b45:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b49:	f6 c2 80             	test   $0x80,%dl
+  803b4c:	75 4f                	jne    803b9d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803b4e:	48 89 f8             	mov    %rdi,%rax
+  803b51:	48 c1 e8 15          	shr    $0x15,%rax
+  803b55:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b5c:	7f 00 00 
+  803b5f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b63:	f6 c2 01             	test   $0x1,%dl
+  803b66:	74 44                	je     803bac <get_uvpt_entry+0xa5>
+  803b68:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b6f:	7f 00 00 
+  803b72:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b76:	f6 c2 80             	test   $0x80,%dl
+  803b79:	75 31                	jne    803bac <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803b7b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803b7f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b86:	7f 00 00 
+  803b89:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803b8d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b8e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803b95:	7f 00 00 
+  803b98:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b9c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b9d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ba4:	7f 00 00 
+  803ba7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bab:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bac:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bb3:	7f 00 00 
+  803bb6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bba:	c3                   	ret
+
+0000000000803bbb <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803bbb:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803bbe:	48 89 f9             	mov    %rdi,%rcx
+  803bc1:	48 c1 e9 27          	shr    $0x27,%rcx
+  803bc5:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803bcc:	7f 00 00 
+  803bcf:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803bd3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803bda:	f6 c1 01             	test   $0x1,%cl
+  803bdd:	0f 84 b2 00 00 00    	je     803c95 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803be3:	48 89 f9             	mov    %rdi,%rcx
+  803be6:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803bea:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803bf1:	7f 00 00 
+  803bf4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803bf8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803bff:	40 f6 c6 01          	test   $0x1,%sil
+  803c03:	0f 84 8c 00 00 00    	je     803c95 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803c09:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c10:	7f 00 00 
+  803c13:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c17:	a8 80                	test   $0x80,%al
+  803c19:	75 7b                	jne    803c96 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c1b:	48 89 f9             	mov    %rdi,%rcx
+  803c1e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c22:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c29:	7f 00 00 
+  803c2c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c30:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c37:	40 f6 c6 01          	test   $0x1,%sil
+  803c3b:	74 58                	je     803c95 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803c3d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c44:	7f 00 00 
+  803c47:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c4b:	a8 80                	test   $0x80,%al
+  803c4d:	75 6c                	jne    803cbb <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803c4f:	48 89 f9             	mov    %rdi,%rcx
+  803c52:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803c56:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c5d:	7f 00 00 
+  803c60:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c64:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803c6b:	40 f6 c6 01          	test   $0x1,%sil
+  803c6f:	74 24                	je     803c95 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803c71:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c78:	7f 00 00 
+  803c7b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c7f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c86:	ff ff 7f 
+  803c89:	48 21 c8             	and    %rcx,%rax
+  803c8c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803c92:	48 09 d0             	or     %rdx,%rax
+}
+  803c95:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803c96:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c9d:	7f 00 00 
+  803ca0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ca4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803cab:	ff ff 7f 
+  803cae:	48 21 c8             	and    %rcx,%rax
+  803cb1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803cb7:	48 01 d0             	add    %rdx,%rax
+  803cba:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803cbb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cc2:	7f 00 00 
+  803cc5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cc9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803cd0:	ff ff 7f 
+  803cd3:	48 21 c8             	and    %rcx,%rax
+  803cd6:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803cdc:	48 01 d0             	add    %rdx,%rax
+  803cdf:	c3                   	ret
+
+0000000000803ce0 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ce0:	55                   	push   %rbp
+  803ce1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ce4:	48 b8 07 3b 80 00 00 	movabs $0x803b07,%rax
+  803ceb:	00 00 00 
+  803cee:	ff d0                	call   *%rax
+  803cf0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803cf3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803cf8:	89 c1                	mov    %eax,%ecx
+  803cfa:	83 c9 04             	or     $0x4,%ecx
+  803cfd:	f6 c2 01             	test   $0x1,%dl
+  803d00:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803d03:	89 c1                	mov    %eax,%ecx
+  803d05:	83 c9 02             	or     $0x2,%ecx
+  803d08:	f6 c2 02             	test   $0x2,%dl
+  803d0b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803d0e:	89 c1                	mov    %eax,%ecx
+  803d10:	83 c9 01             	or     $0x1,%ecx
+  803d13:	48 85 d2             	test   %rdx,%rdx
+  803d16:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803d19:	89 c1                	mov    %eax,%ecx
+  803d1b:	83 c9 40             	or     $0x40,%ecx
+  803d1e:	f6 c6 04             	test   $0x4,%dh
+  803d21:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803d24:	5d                   	pop    %rbp
+  803d25:	c3                   	ret
+
+0000000000803d26 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803d26:	55                   	push   %rbp
+  803d27:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d2a:	48 b8 07 3b 80 00 00 	movabs $0x803b07,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803d36:	48 c1 e8 06          	shr    $0x6,%rax
+  803d3a:	83 e0 01             	and    $0x1,%eax
+}
+  803d3d:	5d                   	pop    %rbp
+  803d3e:	c3                   	ret
+
+0000000000803d3f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803d3f:	55                   	push   %rbp
+  803d40:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803d43:	48 b8 07 3b 80 00 00 	movabs $0x803b07,%rax
+  803d4a:	00 00 00 
+  803d4d:	ff d0                	call   *%rax
+  803d4f:	83 e0 01             	and    $0x1,%eax
+}
+  803d52:	5d                   	pop    %rbp
+  803d53:	c3                   	ret
+
+0000000000803d54 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803d54:	55                   	push   %rbp
+  803d55:	48 89 e5             	mov    %rsp,%rbp
+  803d58:	41 57                	push   %r15
+  803d5a:	41 56                	push   %r14
+  803d5c:	41 55                	push   %r13
+  803d5e:	41 54                	push   %r12
+  803d60:	53                   	push   %rbx
+  803d61:	48 83 ec 18          	sub    $0x18,%rsp
+  803d65:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803d69:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803d6d:	48 39 f7             	cmp    %rsi,%rdi
+  803d70:	0f 83 e4 00 00 00    	jae    803e5a <foreach_present_page+0x106>
+  803d76:	49 89 f4             	mov    %rsi,%r12
+  803d79:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803d7c:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803d83:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803d86:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803d8d:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803d90:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803d97:	7f 00 00 
+  803d9a:	eb 27                	jmp    803dc3 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803d9c:	48 89 d8             	mov    %rbx,%rax
+  803d9f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803da3:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803da7:	f6 c2 01             	test   $0x1,%dl
+  803daa:	75 43                	jne    803def <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803dac:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803db3:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803dba:	4c 39 e3             	cmp    %r12,%rbx
+  803dbd:	0f 83 83 00 00 00    	jae    803e46 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803dc3:	48 89 d8             	mov    %rbx,%rax
+  803dc6:	48 c1 e8 27          	shr    $0x27,%rax
+  803dca:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803dcf:	a8 01                	test   $0x1,%al
+  803dd1:	75 c9                	jne    803d9c <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803dd3:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803dda:	ff ff ff 
+  803ddd:	48 21 d8             	and    %rbx,%rax
+  803de0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803de7:	00 00 00 
+  803dea:	48 01 c3             	add    %rax,%rbx
+  803ded:	eb cb                	jmp    803dba <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803def:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803df3:	a8 80                	test   $0x80,%al
+  803df5:	75 1f                	jne    803e16 <foreach_present_page+0xc2>
+  803df7:	48 89 d8             	mov    %rbx,%rax
+  803dfa:	48 c1 e8 15          	shr    $0x15,%rax
+  803dfe:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803e02:	a8 01                	test   $0x1,%al
+  803e04:	75 10                	jne    803e16 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803e06:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803e0d:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803e14:	eb a4                	jmp    803dba <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803e16:	48 89 df             	mov    %rbx,%rdi
+  803e19:	48 b8 07 3b 80 00 00 	movabs $0x803b07,%rax
+  803e20:	00 00 00 
+  803e23:	ff d0                	call   *%rax
+  803e25:	a8 01                	test   $0x1,%al
+  803e27:	74 11                	je     803e3a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803e29:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803e2d:	48 89 df             	mov    %rbx,%rdi
+  803e30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e34:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803e36:	85 c0                	test   %eax,%eax
+  803e38:	78 11                	js     803e4b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803e3a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e41:	e9 74 ff ff ff       	jmp    803dba <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803e46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4b:	48 83 c4 18          	add    $0x18,%rsp
+  803e4f:	5b                   	pop    %rbx
+  803e50:	41 5c                	pop    %r12
+  803e52:	41 5d                	pop    %r13
+  803e54:	41 5e                	pop    %r14
+  803e56:	41 5f                	pop    %r15
+  803e58:	5d                   	pop    %rbp
+  803e59:	c3                   	ret
+    return 0;
+  803e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5f:	eb ea                	jmp    803e4b <foreach_present_page+0xf7>
+
+0000000000803e61 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803e61:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803e68:	7f 00 00 
+  803e6b:	a8 01                	test   $0x1,%al
+  803e6d:	75 06                	jne    803e75 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e74:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e75:	55                   	push   %rbp
+  803e76:	48 89 e5             	mov    %rsp,%rbp
+  803e79:	41 57                	push   %r15
+  803e7b:	41 56                	push   %r14
+  803e7d:	41 55                	push   %r13
+  803e7f:	41 54                	push   %r12
+  803e81:	53                   	push   %rbx
+  803e82:	48 83 ec 28          	sub    $0x28,%rsp
+  803e86:	49 89 fe             	mov    %rdi,%r14
+  803e89:	49 89 f7             	mov    %rsi,%r15
+  803e8c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803e93:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803e94:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803e9b:	7f 00 00 
+  803e9e:	e9 b0 00 00 00       	jmp    803f53 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803ea3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803eaa:	49 83 ec 01          	sub    $0x1,%r12
+  803eae:	74 2d                	je     803edd <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803eb0:	48 89 d8             	mov    %rbx,%rax
+  803eb3:	48 c1 e8 0c          	shr    $0xc,%rax
+  803eb7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803ebc:	f6 c2 01             	test   $0x1,%dl
+  803ebf:	74 e2                	je     803ea3 <foreach_shared_region+0x42>
+  803ec1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803ec6:	f6 c4 04             	test   $0x4,%ah
+  803ec9:	74 d8                	je     803ea3 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803ecb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803ed2:	4c 89 fa             	mov    %r15,%rdx
+  803ed5:	48 89 df             	mov    %rbx,%rdi
+  803ed8:	41 ff d6             	call   *%r14
+  803edb:	eb c6                	jmp    803ea3 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803edd:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803ee4:	00 
+  803ee5:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803eea:	74 4c                	je     803f38 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803eec:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803ef0:	48 89 c8             	mov    %rcx,%rax
+  803ef3:	48 c1 e8 15          	shr    $0x15,%rax
+  803ef7:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803efe:	7f 00 00 
+  803f01:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803f05:	a8 01                	test   $0x1,%al
+  803f07:	74 d4                	je     803edd <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803f09:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803f10:	48 39 c1             	cmp    %rax,%rcx
+  803f13:	73 c8                	jae    803edd <foreach_shared_region+0x7c>
+  803f15:	48 89 cb             	mov    %rcx,%rbx
+  803f18:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803f1f:	48 39 d0             	cmp    %rdx,%rax
+  803f22:	4d 19 e4             	sbb    %r12,%r12
+  803f25:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f2c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f33:	e9 78 ff ff ff       	jmp    803eb0 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803f38:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f3f:	40 
+  803f40:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f44:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f4b:	00 00 00 
+  803f4e:	48 39 c1             	cmp    %rax,%rcx
+  803f51:	74 4f                	je     803fa2 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803f53:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f57:	48 89 c8             	mov    %rcx,%rax
+  803f5a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f5e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803f65:	7f 00 00 
+  803f68:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803f6c:	a8 01                	test   $0x1,%al
+  803f6e:	74 c8                	je     803f38 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803f70:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803f77:	48 39 c1             	cmp    %rax,%rcx
+  803f7a:	73 bc                	jae    803f38 <foreach_shared_region+0xd7>
+  803f7c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803f83:	48 39 d0             	cmp    %rdx,%rax
+  803f86:	48 19 c0             	sbb    %rax,%rax
+  803f89:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803f8f:	48 05 00 02 00 00    	add    $0x200,%rax
+  803f95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f99:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f9d:	e9 4a ff ff ff       	jmp    803eec <foreach_shared_region+0x8b>
+}
+  803fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa7:	48 83 c4 28          	add    $0x28,%rsp
+  803fab:	5b                   	pop    %rbx
+  803fac:	41 5c                	pop    %r12
+  803fae:	41 5d                	pop    %r13
+  803fb0:	41 5e                	pop    %r14
+  803fb2:	41 5f                	pop    %r15
+  803fb4:	5d                   	pop    %rbp
+  803fb5:	c3                   	ret
+
+0000000000803fb6 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803fb6:	55                   	push   %rbp
+  803fb7:	48 89 e5             	mov    %rsp,%rbp
+  803fba:	41 55                	push   %r13
+  803fbc:	41 54                	push   %r12
+  803fbe:	53                   	push   %rbx
+  803fbf:	48 83 ec 08          	sub    $0x8,%rsp
+  803fc3:	49 89 fc             	mov    %rdi,%r12
+  803fc6:	48 89 f7             	mov    %rsi,%rdi
+  803fc9:	48 89 d3             	mov    %rdx,%rbx
+  803fcc:	49 89 cd             	mov    %rcx,%r13
+  803fcf:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803fd2:	48 85 f6             	test   %rsi,%rsi
+  803fd5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fdc:	00 00 00 
+  803fdf:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  803fe8:	48 85 db             	test   %rbx,%rbx
+  803feb:	74 03                	je     803ff0 <ipc_recv_timeout+0x3a>
+  803fed:	48 8b 33             	mov    (%rbx),%rsi
+  803ff0:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+    if (res == 0) {
+  803ffc:	85 c0                	test   %eax,%eax
+  803ffe:	75 72                	jne    804072 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804000:	4d 85 e4             	test   %r12,%r12
+  804003:	74 17                	je     80401c <ipc_recv_timeout+0x66>
+  804005:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80400c:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  80400e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804012:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804018:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  80401c:	4d 85 ed             	test   %r13,%r13
+  80401f:	74 17                	je     804038 <ipc_recv_timeout+0x82>
+  804021:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804028:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  80402a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80402e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804034:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804038:	48 85 db             	test   %rbx,%rbx
+  80403b:	74 17                	je     804054 <ipc_recv_timeout+0x9e>
+  80403d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804044:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804046:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80404a:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804051:	48 89 03             	mov    %rax,(%rbx)
+  804054:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80405b:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  80405d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804061:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804067:	48 83 c4 08          	add    $0x8,%rsp
+  80406b:	5b                   	pop    %rbx
+  80406c:	41 5c                	pop    %r12
+  80406e:	41 5d                	pop    %r13
+  804070:	5d                   	pop    %rbp
+  804071:	c3                   	ret
+        if (from_env_store) {
+  804072:	4d 85 e4             	test   %r12,%r12
+  804075:	74 08                	je     80407f <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804077:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80407e:	00 
+        if (perm_store) {
+  80407f:	4d 85 ed             	test   %r13,%r13
+  804082:	74 08                	je     80408c <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804084:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80408b:	00 
+        if (size) {
+  80408c:	48 85 db             	test   %rbx,%rbx
+  80408f:	74 d6                	je     804067 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804091:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804098:	eb cd                	jmp    804067 <ipc_recv_timeout+0xb1>
+
+000000000080409a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80409a:	55                   	push   %rbp
+  80409b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  80409e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8040a4:	48 b8 b6 3f 80 00 00 	movabs $0x803fb6,%rax
+  8040ab:	00 00 00 
+  8040ae:	ff d0                	call   *%rax
+}
+  8040b0:	5d                   	pop    %rbp
+  8040b1:	c3                   	ret
+
+00000000008040b2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8040b2:	55                   	push   %rbp
+  8040b3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8040b6:	48 85 d2             	test   %rdx,%rdx
+  8040b9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040c0:	00 00 00 
+  8040c3:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8040c7:	89 f6                	mov    %esi,%esi
+  8040c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8040cf:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  8040d6:	00 00 00 
+  8040d9:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8040db:	85 c0                	test   %eax,%eax
+  8040dd:	78 02                	js     8040e1 <ipc_send+0x2f>
+}
+  8040df:	5d                   	pop    %rbp
+  8040e0:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8040e1:	89 c1                	mov    %eax,%ecx
+  8040e3:	48 ba 6a 57 80 00 00 	movabs $0x80576a,%rdx
+  8040ea:	00 00 00 
+  8040ed:	be 51 00 00 00       	mov    $0x51,%esi
+  8040f2:	48 bf 81 57 80 00 00 	movabs $0x805781,%rdi
+  8040f9:	00 00 00 
+  8040fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804101:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  804108:	00 00 00 
+  80410b:	41 ff d0             	call   *%r8
+
+000000000080410e <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80410e:	55                   	push   %rbp
+  80410f:	48 89 e5             	mov    %rsp,%rbp
+  804112:	41 54                	push   %r12
+  804114:	53                   	push   %rbx
+  804115:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804119:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80411d:	48 85 d2             	test   %rdx,%rdx
+  804120:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804127:	00 00 00 
+  80412a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80412e:	4d 85 c9             	test   %r9,%r9
+  804131:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804135:	89 f6                	mov    %esi,%esi
+  804137:	48 83 ec 08          	sub    $0x8,%rsp
+  80413b:	53                   	push   %rbx
+  80413c:	48 b8 09 1b 80 00 00 	movabs $0x801b09,%rax
+  804143:	00 00 00 
+  804146:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804148:	48 83 c4 10          	add    $0x10,%rsp
+  80414c:	85 c0                	test   %eax,%eax
+  80414e:	78 65                	js     8041b5 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804150:	4d 85 e4             	test   %r12,%r12
+  804153:	74 17                	je     80416c <ipc_call+0x5e>
+  804155:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80415c:	00 00 
+  80415e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804162:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804168:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80416c:	48 85 db             	test   %rbx,%rbx
+  80416f:	74 28                	je     804199 <ipc_call+0x8b>
+  804171:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804178:	00 00 
+  80417a:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80417e:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804185:	ba 20 00 00 00       	mov    $0x20,%edx
+  80418a:	48 89 df             	mov    %rbx,%rdi
+  80418d:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  804194:	00 00 00 
+  804197:	ff d0                	call   *%rax
+  804199:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041a0:	00 00 
+    return thisenv->env_ipc_value;
+  8041a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041a6:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8041ac:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8041b0:	5b                   	pop    %rbx
+  8041b1:	41 5c                	pop    %r12
+  8041b3:	5d                   	pop    %rbp
+  8041b4:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8041b5:	89 c1                	mov    %eax,%ecx
+  8041b7:	48 ba 8b 57 80 00 00 	movabs $0x80578b,%rdx
+  8041be:	00 00 00 
+  8041c1:	be 62 00 00 00       	mov    $0x62,%esi
+  8041c6:	48 bf 81 57 80 00 00 	movabs $0x805781,%rdi
+  8041cd:	00 00 00 
+  8041d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d5:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  8041dc:	00 00 00 
+  8041df:	41 ff d0             	call   *%r8
+
+00000000008041e2 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8041e2:	55                   	push   %rbp
+  8041e3:	48 89 e5             	mov    %rsp,%rbp
+  8041e6:	41 57                	push   %r15
+  8041e8:	41 56                	push   %r14
+  8041ea:	41 55                	push   %r13
+  8041ec:	41 54                	push   %r12
+  8041ee:	53                   	push   %rbx
+  8041ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8041f3:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8041f6:	48 89 d3             	mov    %rdx,%rbx
+  8041f9:	49 89 ce             	mov    %rcx,%r14
+  8041fc:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804200:	4d 89 cd             	mov    %r9,%r13
+  804203:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804207:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80420b:	48 85 d2             	test   %rdx,%rdx
+  80420e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804215:	00 00 00 
+  804218:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80421c:	4d 85 e4             	test   %r12,%r12
+  80421f:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804223:	89 f0                	mov    %esi,%eax
+  804225:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804229:	41 57                	push   %r15
+  80422b:	4d 89 e1             	mov    %r12,%r9
+  80422e:	48 89 da             	mov    %rbx,%rdx
+  804231:	48 89 c6             	mov    %rax,%rsi
+  804234:	48 b8 5e 1b 80 00 00 	movabs $0x801b5e,%rax
+  80423b:	00 00 00 
+  80423e:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804240:	48 83 c4 10          	add    $0x10,%rsp
+  804244:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804247:	0f 84 93 00 00 00    	je     8042e0 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80424d:	85 c0                	test   %eax,%eax
+  80424f:	0f 88 f3 00 00 00    	js     804348 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804255:	4d 85 ed             	test   %r13,%r13
+  804258:	74 17                	je     804271 <ipc_reply_wait+0x8f>
+  80425a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804261:	00 00 
+  804263:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804267:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80426d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804271:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804276:	74 19                	je     804291 <ipc_reply_wait+0xaf>
+  804278:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80427f:	00 00 
+  804281:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804285:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80428b:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  80428f:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804291:	4d 85 ff             	test   %r15,%r15
+  804294:	74 28                	je     8042be <ipc_reply_wait+0xdc>
+  804296:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80429d:	00 00 
+  80429f:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8042a3:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8042aa:	ba 20 00 00 00       	mov    $0x20,%edx
+  8042af:	4c 89 ff             	mov    %r15,%rdi
+  8042b2:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+  8042be:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042c5:	00 00 
+    return thisenv->env_ipc_value;
+  8042c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042cb:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8042d1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8042d5:	5b                   	pop    %rbx
+  8042d6:	41 5c                	pop    %r12
+  8042d8:	41 5d                	pop    %r13
+  8042da:	41 5e                	pop    %r14
+  8042dc:	41 5f                	pop    %r15
+  8042de:	5d                   	pop    %rbp
+  8042df:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8042e0:	4d 89 f9             	mov    %r15,%r9
+  8042e3:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8042e7:	4c 89 f1             	mov    %r14,%rcx
+  8042ea:	48 89 da             	mov    %rbx,%rdx
+  8042ed:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8042f1:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8042f4:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  8042fb:	00 00 00 
+  8042fe:	ff d0                	call   *%rax
+  804300:	85 c0                	test   %eax,%eax
+  804302:	78 17                	js     80431b <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804304:	4c 89 f6             	mov    %r14,%rsi
+  804307:	4c 89 e7             	mov    %r12,%rdi
+  80430a:	48 b8 a0 1a 80 00 00 	movabs $0x801aa0,%rax
+  804311:	00 00 00 
+  804314:	ff d0                	call   *%rax
+  804316:	e9 32 ff ff ff       	jmp    80424d <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  80431b:	89 c1                	mov    %eax,%ecx
+  80431d:	48 ba 6a 57 80 00 00 	movabs $0x80576a,%rdx
+  804324:	00 00 00 
+  804327:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80432c:	48 bf 81 57 80 00 00 	movabs $0x805781,%rdi
+  804333:	00 00 00 
+  804336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433b:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  804342:	00 00 00 
+  804345:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804348:	89 c1                	mov    %eax,%ecx
+  80434a:	48 ba a2 57 80 00 00 	movabs $0x8057a2,%rdx
+  804351:	00 00 00 
+  804354:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804359:	48 bf 81 57 80 00 00 	movabs $0x805781,%rdi
+  804360:	00 00 00 
+  804363:	b8 00 00 00 00       	mov    $0x0,%eax
+  804368:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  80436f:	00 00 00 
+  804372:	41 ff d0             	call   *%r8
+
+0000000000804375 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804375:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80437a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804381:	00 00 00 
+  804384:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80438b:	48 01 ca             	add    %rcx,%rdx
+  80438e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804394:	39 fa                	cmp    %edi,%edx
+  804396:	74 12                	je     8043aa <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804398:	48 83 c0 01          	add    $0x1,%rax
+  80439c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8043a2:	75 e0                	jne    804384 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8043a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043a9:	c3                   	ret
+            return envs[i].env_id;
+  8043aa:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8043b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8043b8:	00 00 00 
+  8043bb:	48 01 d0             	add    %rdx,%rax
+  8043be:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8043c4:	c3                   	ret
+
+00000000008043c5 <__text_end>:
+  8043c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cc:	00 00 00 
+  8043cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d6:	00 00 00 
+  8043d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e0:	00 00 00 
+  8043e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ea:	00 00 00 
+  8043ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f4:	00 00 00 
+  8043f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fe:	00 00 00 
+  804401:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804408:	00 00 00 
+  80440b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804412:	00 00 00 
+  804415:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441c:	00 00 00 
+  80441f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804426:	00 00 00 
+  804429:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804430:	00 00 00 
+  804433:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443a:	00 00 00 
+  80443d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804444:	00 00 00 
+  804447:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444e:	00 00 00 
+  804451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804458:	00 00 00 
+  80445b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804462:	00 00 00 
+  804465:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446c:	00 00 00 
+  80446f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804476:	00 00 00 
+  804479:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804480:	00 00 00 
+  804483:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448a:	00 00 00 
+  80448d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804494:	00 00 00 
+  804497:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449e:	00 00 00 
+  8044a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a8:	00 00 00 
+  8044ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b2:	00 00 00 
+  8044b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bc:	00 00 00 
+  8044bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c6:	00 00 00 
+  8044c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d0:	00 00 00 
+  8044d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044da:	00 00 00 
+  8044dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e4:	00 00 00 
+  8044e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ee:	00 00 00 
+  8044f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f8:	00 00 00 
+  8044fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804502:	00 00 00 
+  804505:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450c:	00 00 00 
+  80450f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804516:	00 00 00 
+  804519:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804520:	00 00 00 
+  804523:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452a:	00 00 00 
+  80452d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804534:	00 00 00 
+  804537:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453e:	00 00 00 
+  804541:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804548:	00 00 00 
+  80454b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804552:	00 00 00 
+  804555:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455c:	00 00 00 
+  80455f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804566:	00 00 00 
+  804569:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804570:	00 00 00 
+  804573:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457a:	00 00 00 
+  80457d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804584:	00 00 00 
+  804587:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458e:	00 00 00 
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
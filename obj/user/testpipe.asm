@@ -0,0 +1,8195 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4a 07 00 00       	call   80076d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+    cprintf("pipe throughput: %d MB in %lu cycles, %lu MB/s\n",
+            THROUGHPUT_BYTES >> 20, (unsigned long)cycles, (unsigned long)(bytes_per_ms / 1000));
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+  800039:	83 ff 01             	cmp    $0x1,%edi
+  80003c:	7e 22                	jle    800060 <umain+0x3b>
+  80003e:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  800042:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  800049:	00 00 00 
+  80004c:	48 b8 96 13 80 00 00 	movabs $0x801396,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+  800058:	85 c0                	test   %eax,%eax
+  80005a:	0f 84 e7 01 00 00    	je     800247 <umain+0x222>
+        throughput();
+        return;
+    }
+
+    binaryname = "pipereadeof";
+  800060:	48 b8 64 50 80 00 00 	movabs $0x805064,%rax
+  800067:	00 00 00 
+  80006a:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800071:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  800074:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  80007b:	48 b8 57 3d 80 00 00 	movabs $0x803d57,%rax
+  800082:	00 00 00 
+  800085:	ff d0                	call   *%rax
+  800087:	41 89 c4             	mov    %eax,%r12d
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 4f 04 00 00    	js     8004e1 <umain+0x4bc>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800092:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c3                	mov    %eax,%ebx
+  8000a0:	85 c0                	test   %eax,%eax
+  8000a2:	0f 88 66 04 00 00    	js     80050e <umain+0x4e9>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8000a8:	0f 85 e5 04 00 00    	jne    800593 <umain+0x56e>
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000ae:	64 4c 8b 2c 25 00 00 	mov    %fs:0x0,%r13
+  8000b5:	00 00 
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  8000b7:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8000bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000c1:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  8000c7:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8000ce:	00 00 00 
+  8000d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d6:	49 bc cd 09 80 00 00 	movabs $0x8009cd,%r12
+  8000dd:	00 00 00 
+  8000e0:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000e3:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000e9:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000f5:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8000f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000ff:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  800105:	48 bf 8d 50 80 00 00 	movabs $0x80508d,%rdi
+  80010c:	00 00 00 
+  80010f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800114:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  800117:	ba 63 00 00 00       	mov    $0x63,%edx
+  80011c:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  800123:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800129:	48 b8 2a 27 80 00 00 	movabs $0x80272a,%rax
+  800130:	00 00 00 
+  800133:	ff d0                	call   *%rax
+  800135:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  800138:	85 c0                	test   %eax,%eax
+  80013a:	0f 88 fc 03 00 00    	js     80053c <umain+0x517>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800140:	48 98                	cltq
+  800142:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800149:	00 
+        if (strcmp(buf, msg) == 0)
+  80014a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800151:	00 00 00 
+  800154:	48 8b 30             	mov    (%rax),%rsi
+  800157:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  80015e:	48 b8 96 13 80 00 00 	movabs $0x801396,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+  80016a:	85 c0                	test   %eax,%eax
+  80016c:	0f 85 f7 03 00 00    	jne    800569 <umain+0x544>
+            cprintf("\npipe read closed properly\n");
+  800172:	48 bf aa 50 80 00 00 	movabs $0x8050aa,%rdi
+  800179:	00 00 00 
+  80017c:	48 ba cd 09 80 00 00 	movabs $0x8009cd,%rdx
+  800183:	00 00 00 
+  800186:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  800188:	48 b8 5a 08 80 00 00 	movabs $0x80085a,%rax
+  80018f:	00 00 00 
+  800192:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  800194:	89 df                	mov    %ebx,%edi
+  800196:	48 b8 fe 3d 80 00 00 	movabs $0x803dfe,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  8001a2:	48 b8 f6 50 80 00 00 	movabs $0x8050f6,%rax
+  8001a9:	00 00 00 
+  8001ac:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8001b3:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  8001b6:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  8001bd:	48 b8 57 3d 80 00 00 	movabs $0x803d57,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+  8001c9:	41 89 c4             	mov    %eax,%r12d
+  8001cc:	85 c0                	test   %eax,%eax
+  8001ce:	0f 88 b6 04 00 00    	js     80068a <umain+0x665>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001d4:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+  8001e0:	89 c3                	mov    %eax,%ebx
+  8001e2:	85 c0                	test   %eax,%eax
+  8001e4:	0f 88 cd 04 00 00    	js     8006b7 <umain+0x692>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001ea:	0f 84 f5 04 00 00    	je     8006e5 <umain+0x6c0>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001f0:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001f6:	49 bc b2 24 80 00 00 	movabs $0x8024b2,%r12
+  8001fd:	00 00 00 
+  800200:	41 ff d4             	call   *%r12
+    close(p[1]);
+  800203:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800209:	41 ff d4             	call   *%r12
+    wait(pid);
+  80020c:	89 df                	mov    %ebx,%edi
+  80020e:	48 b8 fe 3d 80 00 00 	movabs $0x803dfe,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  80021a:	48 bf 24 51 80 00 00 	movabs $0x805124,%rdi
+  800221:	00 00 00 
+  800224:	b8 00 00 00 00       	mov    $0x0,%eax
+  800229:	48 ba cd 09 80 00 00 	movabs $0x8009cd,%rdx
+  800230:	00 00 00 
+  800233:	ff d2                	call   *%rdx
+}
+  800235:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  80023c:	5b                   	pop    %rbx
+  80023d:	41 5c                	pop    %r12
+  80023f:	41 5d                	pop    %r13
+  800241:	41 5e                	pop    %r14
+  800243:	41 5f                	pop    %r15
+  800245:	5d                   	pop    %rbp
+  800246:	c3                   	ret
+    binaryname = "pipethroughput";
+  800247:	48 b8 03 50 80 00 00 	movabs $0x805003,%rax
+  80024e:	00 00 00 
+  800251:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800258:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80025b:	48 8d bd 5c ff ff ff 	lea    -0xa4(%rbp),%rdi
+  800262:	48 b8 57 3d 80 00 00 	movabs $0x803d57,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+  80026e:	85 c0                	test   %eax,%eax
+  800270:	78 46                	js     8002b8 <umain+0x293>
+    if ((pid = fork()) < 0)
+  800272:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+  80027e:	41 89 c6             	mov    %eax,%r14d
+  800281:	85 c0                	test   %eax,%eax
+  800283:	78 60                	js     8002e5 <umain+0x2c0>
+    if (pid == 0) {
+  800285:	0f 85 c2 00 00 00    	jne    80034d <umain+0x328>
+        close(p[1]);
+  80028b:	8b bd 60 ff ff ff    	mov    -0xa0(%rbp),%edi
+  800291:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+        size_t total = 0;
+  80029d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        while ((i = read(p[0], buf, sizeof(buf))) > 0)
+  8002a2:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8002a9:	00 00 00 
+  8002ac:	49 bc 69 26 80 00 00 	movabs $0x802669,%r12
+  8002b3:	00 00 00 
+  8002b6:	eb 5f                	jmp    800317 <umain+0x2f2>
+        panic("pipe: %i", i);
+  8002b8:	89 c1                	mov    %eax,%ecx
+  8002ba:	48 ba 12 50 80 00 00 	movabs $0x805012,%rdx
+  8002c1:	00 00 00 
+  8002c4:	be 12 00 00 00       	mov    $0x12,%esi
+  8002c9:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8002d0:	00 00 00 
+  8002d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d8:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  8002df:	00 00 00 
+  8002e2:	41 ff d0             	call   *%r8
+        panic("fork: %i", pid);
+  8002e5:	89 c1                	mov    %eax,%ecx
+  8002e7:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  8002ee:	00 00 00 
+  8002f1:	be 15 00 00 00       	mov    $0x15,%esi
+  8002f6:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8002fd:	00 00 00 
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  80030c:	00 00 00 
+  80030f:	41 ff d0             	call   *%r8
+            total += i;
+  800312:	48 98                	cltq
+  800314:	48 01 c3             	add    %rax,%rbx
+        while ((i = read(p[0], buf, sizeof(buf))) > 0)
+  800317:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80031c:	4c 89 ee             	mov    %r13,%rsi
+  80031f:	8b bd 5c ff ff ff    	mov    -0xa4(%rbp),%edi
+  800325:	41 ff d4             	call   *%r12
+  800328:	89 c1                	mov    %eax,%ecx
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	7f e4                	jg     800312 <umain+0x2ed>
+        if (i < 0) panic("read: %i", i);
+  80032e:	0f 88 23 01 00 00    	js     800457 <umain+0x432>
+        if (total != THROUGHPUT_BYTES)
+  800334:	48 81 fb 00 00 00 01 	cmp    $0x1000000,%rbx
+  80033b:	0f 85 41 01 00 00    	jne    800482 <umain+0x45d>
+        exit();
+  800341:	48 b8 5a 08 80 00 00 	movabs $0x80085a,%rax
+  800348:	00 00 00 
+  80034b:	ff d0                	call   *%rax
+    close(p[0]);
+  80034d:	8b bd 5c ff ff ff    	mov    -0xa4(%rbp),%edi
+  800353:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  80035a:	00 00 00 
+  80035d:	ff d0                	call   *%rax
+    memset(buf, 'x', sizeof(buf));
+  80035f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  800364:	be 78 00 00 00       	mov    $0x78,%esi
+  800369:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  800370:	00 00 00 
+  800373:	48 b8 3e 14 80 00 00 	movabs $0x80143e,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80037f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800381:	48 c1 e2 20          	shl    $0x20,%rdx
+  800385:	89 c0                	mov    %eax,%eax
+  800387:	48 09 c2             	or     %rax,%rdx
+  80038a:	49 89 d7             	mov    %rdx,%r15
+  80038d:	bb 00 04 00 00       	mov    $0x400,%ebx
+        if ((i = write(p[1], buf, sizeof(buf))) != sizeof(buf))
+  800392:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  800399:	00 00 00 
+  80039c:	49 bc 9b 27 80 00 00 	movabs $0x80279b,%r12
+  8003a3:	00 00 00 
+  8003a6:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8003ab:	4c 89 ee             	mov    %r13,%rsi
+  8003ae:	8b bd 60 ff ff ff    	mov    -0xa0(%rbp),%edi
+  8003b4:	41 ff d4             	call   *%r12
+  8003b7:	89 c1                	mov    %eax,%ecx
+  8003b9:	3d 00 40 00 00       	cmp    $0x4000,%eax
+  8003be:	0f 85 f2 00 00 00    	jne    8004b6 <umain+0x491>
+    for (size_t total = 0; total < THROUGHPUT_BYTES; total += sizeof(buf))
+  8003c4:	48 83 eb 01          	sub    $0x1,%rbx
+  8003c8:	75 dc                	jne    8003a6 <umain+0x381>
+    close(p[1]);
+  8003ca:	8b bd 60 ff ff ff    	mov    -0xa0(%rbp),%edi
+  8003d0:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8003d7:	00 00 00 
+  8003da:	ff d0                	call   *%rax
+    wait(pid);
+  8003dc:	44 89 f7             	mov    %r14d,%edi
+  8003df:	48 b8 fe 3d 80 00 00 	movabs $0x803dfe,%rax
+  8003e6:	00 00 00 
+  8003e9:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  8003eb:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003ed:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003f1:	89 c0                	mov    %eax,%eax
+  8003f3:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8003f6:	48 89 d3             	mov    %rdx,%rbx
+  8003f9:	4c 29 fb             	sub    %r15,%rbx
+    uint64_t bytes_per_ms = (uint64_t)THROUGHPUT_BYTES * vsys_tsc_khz() / cycles;
+  8003fc:	48 b8 7b 43 80 00 00 	movabs $0x80437b,%rax
+  800403:	00 00 00 
+  800406:	ff d0                	call   *%rax
+  800408:	48 98                	cltq
+  80040a:	48 c1 e0 18          	shl    $0x18,%rax
+  80040e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800413:	48 f7 f3             	div    %rbx
+            THROUGHPUT_BYTES >> 20, (unsigned long)cycles, (unsigned long)(bytes_per_ms / 1000));
+  800416:	48 c1 e8 03          	shr    $0x3,%rax
+  80041a:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800421:	9b c4 20 
+  800424:	48 f7 e2             	mul    %rdx
+  800427:	48 89 d1             	mov    %rdx,%rcx
+  80042a:	48 c1 e9 04          	shr    $0x4,%rcx
+    cprintf("pipe throughput: %d MB in %lu cycles, %lu MB/s\n",
+  80042e:	48 89 da             	mov    %rbx,%rdx
+  800431:	be 10 00 00 00       	mov    $0x10,%esi
+  800436:	48 bf 38 51 80 00 00 	movabs $0x805138,%rdi
+  80043d:	00 00 00 
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	49 b8 cd 09 80 00 00 	movabs $0x8009cd,%r8
+  80044c:	00 00 00 
+  80044f:	41 ff d0             	call   *%r8
+        return;
+  800452:	e9 de fd ff ff       	jmp    800235 <umain+0x210>
+        if (i < 0) panic("read: %i", i);
+  800457:	48 ba 34 50 80 00 00 	movabs $0x805034,%rdx
+  80045e:	00 00 00 
+  800461:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800466:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  80046d:	00 00 00 
+  800470:	b8 00 00 00 00       	mov    $0x0,%eax
+  800475:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  80047c:	00 00 00 
+  80047f:	41 ff d0             	call   *%r8
+            panic("read %zu bytes instead of %d", total, THROUGHPUT_BYTES);
+  800482:	41 b8 00 00 00 01    	mov    $0x1000000,%r8d
+  800488:	48 89 d9             	mov    %rbx,%rcx
+  80048b:	48 ba 3d 50 80 00 00 	movabs $0x80503d,%rdx
+  800492:	00 00 00 
+  800495:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80049a:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8004a1:	00 00 00 
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a9:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  8004b0:	00 00 00 
+  8004b3:	41 ff d1             	call   *%r9
+            panic("write: %i", i);
+  8004b6:	48 ba 5a 50 80 00 00 	movabs $0x80505a,%rdx
+  8004bd:	00 00 00 
+  8004c0:	be 27 00 00 00       	mov    $0x27,%esi
+  8004c5:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8004cc:	00 00 00 
+  8004cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d4:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  8004db:	00 00 00 
+  8004de:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8004e1:	89 c1                	mov    %eax,%ecx
+  8004e3:	48 ba 12 50 80 00 00 	movabs $0x805012,%rdx
+  8004ea:	00 00 00 
+  8004ed:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8004f2:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8004f9:	00 00 00 
+  8004fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800501:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  800508:	00 00 00 
+  80050b:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  80050e:	44 89 e1             	mov    %r12d,%ecx
+  800511:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  800518:	00 00 00 
+  80051b:	be 41 00 00 00       	mov    $0x41,%esi
+  800520:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800527:	00 00 00 
+  80052a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052f:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  800536:	00 00 00 
+  800539:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  80053c:	89 c1                	mov    %eax,%ecx
+  80053e:	48 ba 34 50 80 00 00 	movabs $0x805034,%rdx
+  800545:	00 00 00 
+  800548:	be 49 00 00 00       	mov    $0x49,%esi
+  80054d:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800554:	00 00 00 
+  800557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055c:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  800563:	00 00 00 
+  800566:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  800569:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  800570:	44 89 e6             	mov    %r12d,%esi
+  800573:	48 bf c6 50 80 00 00 	movabs $0x8050c6,%rdi
+  80057a:	00 00 00 
+  80057d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800582:	48 b9 cd 09 80 00 00 	movabs $0x8009cd,%rcx
+  800589:	00 00 00 
+  80058c:	ff d1                	call   *%rcx
+  80058e:	e9 f5 fb ff ff       	jmp    800188 <umain+0x163>
+  800593:	64 4c 8b 2c 25 00 00 	mov    %fs:0x0,%r13
+  80059a:	00 00 
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  80059c:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8005a0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8005a6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8005ac:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8005b3:	00 00 00 
+  8005b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bb:	49 bc cd 09 80 00 00 	movabs $0x8009cd,%r12
+  8005c2:	00 00 00 
+  8005c5:	41 ff d4             	call   *%r12
+        close(p[0]);
+  8005c8:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8005ce:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8005d5:	00 00 00 
+  8005d8:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8005da:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8005de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8005e4:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  8005ea:	48 bf d9 50 80 00 00 	movabs $0x8050d9,%rdi
+  8005f1:	00 00 00 
+  8005f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f9:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  8005fc:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800603:	00 00 00 
+  800606:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  80060a:	49 bf b4 12 80 00 00 	movabs $0x8012b4,%r15
+  800611:	00 00 00 
+  800614:	41 ff d7             	call   *%r15
+  800617:	48 89 c2             	mov    %rax,%rdx
+  80061a:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  80061e:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800624:	48 b8 9b 27 80 00 00 	movabs $0x80279b,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+  800630:	49 89 c4             	mov    %rax,%r12
+  800633:	41 89 c6             	mov    %eax,%r14d
+  800636:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  80063a:	41 ff d7             	call   *%r15
+  80063d:	4d 63 e4             	movslq %r12d,%r12
+  800640:	49 39 c4             	cmp    %rax,%r12
+  800643:	75 17                	jne    80065c <umain+0x637>
+        close(p[1]);
+  800645:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80064b:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  800652:	00 00 00 
+  800655:	ff d0                	call   *%rax
+  800657:	e9 38 fb ff ff       	jmp    800194 <umain+0x16f>
+            panic("write: %i", i);
+  80065c:	44 89 f1             	mov    %r14d,%ecx
+  80065f:	48 ba 5a 50 80 00 00 	movabs $0x80505a,%rdx
+  800666:	00 00 00 
+  800669:	be 55 00 00 00       	mov    $0x55,%esi
+  80066e:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  800684:	00 00 00 
+  800687:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  80068a:	89 c1                	mov    %eax,%ecx
+  80068c:	48 ba 12 50 80 00 00 	movabs $0x805012,%rdx
+  800693:	00 00 00 
+  800696:	be 5c 00 00 00       	mov    $0x5c,%esi
+  80069b:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8006a2:	00 00 00 
+  8006a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006aa:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  8006b1:	00 00 00 
+  8006b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8006b7:	44 89 e1             	mov    %r12d,%ecx
+  8006ba:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  8006c1:	00 00 00 
+  8006c4:	be 5f 00 00 00       	mov    $0x5f,%esi
+  8006c9:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8006d0:	00 00 00 
+  8006d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d8:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  8006df:	00 00 00 
+  8006e2:	41 ff d0             	call   *%r8
+        close(p[0]);
+  8006e5:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8006eb:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8006f2:	00 00 00 
+  8006f5:	ff d0                	call   *%rax
+            cprintf(".");
+  8006f7:	49 bf 03 51 80 00 00 	movabs $0x805103,%r15
+  8006fe:	00 00 00 
+  800701:	49 be cd 09 80 00 00 	movabs $0x8009cd,%r14
+  800708:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  80070b:	49 bd 05 51 80 00 00 	movabs $0x805105,%r13
+  800712:	00 00 00 
+  800715:	49 bc 9b 27 80 00 00 	movabs $0x80279b,%r12
+  80071c:	00 00 00 
+            cprintf(".");
+  80071f:	4c 89 ff             	mov    %r15,%rdi
+  800722:	b8 00 00 00 00       	mov    $0x0,%eax
+  800727:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  80072a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80072f:	4c 89 ee             	mov    %r13,%rsi
+  800732:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800738:	41 ff d4             	call   *%r12
+  80073b:	48 83 f8 01          	cmp    $0x1,%rax
+  80073f:	74 de                	je     80071f <umain+0x6fa>
+        cprintf("\npipe write closed properly\n");
+  800741:	48 bf 07 51 80 00 00 	movabs $0x805107,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba cd 09 80 00 00 	movabs $0x8009cd,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+        exit();
+  80075c:	48 b8 5a 08 80 00 00 	movabs $0x80085a,%rax
+  800763:	00 00 00 
+  800766:	ff d0                	call   *%rax
+  800768:	e9 83 fa ff ff       	jmp    8001f0 <umain+0x1cb>
+
+000000000080076d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	41 56                	push   %r14
+  800773:	41 55                	push   %r13
+  800775:	41 54                	push   %r12
+  800777:	53                   	push   %rbx
+  800778:	48 83 ec 30          	sub    $0x30,%rsp
+  80077c:	41 89 fd             	mov    %edi,%r13d
+  80077f:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800782:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800789:	00 
+  80078a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800791:	00 
+  800792:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800799:	00 
+  80079a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8007a1:	00 
+  8007a2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007a6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8007aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007af:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  8007b6:	00 00 00 
+  8007b9:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8007bb:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8007c2:	00 00 00 
+  8007c5:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8007cc:	00 00 00 
+  8007cf:	48 39 c2             	cmp    %rax,%rdx
+  8007d2:	73 17                	jae    8007eb <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8007d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8007d7:	49 89 c4             	mov    %rax,%r12
+  8007da:	48 83 c3 08          	add    $0x8,%rbx
+  8007de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8007e6:	4c 39 e3             	cmp    %r12,%rbx
+  8007e9:	72 ef                	jb     8007da <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8007eb:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+  8007f7:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8007fe:	00 00 
+  800800:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800805:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80080c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800813:	00 00 00 
+  800816:	48 01 c8             	add    %rcx,%rax
+  800819:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80081d:	45 85 ed             	test   %r13d,%r13d
+  800820:	7e 0d                	jle    80082f <libmain+0xc2>
+  800822:	49 8b 06             	mov    (%r14),%rax
+  800825:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  80082c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80082f:	4c 89 f6             	mov    %r14,%rsi
+  800832:	44 89 ef             	mov    %r13d,%edi
+  800835:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80083c:	00 00 00 
+  80083f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800841:	48 b8 5a 08 80 00 00 	movabs $0x80085a,%rax
+  800848:	00 00 00 
+  80084b:	ff d0                	call   *%rax
+#endif
+}
+  80084d:	48 83 c4 30          	add    $0x30,%rsp
+  800851:	5b                   	pop    %rbx
+  800852:	41 5c                	pop    %r12
+  800854:	41 5d                	pop    %r13
+  800856:	41 5e                	pop    %r14
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80085e:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  800865:	00 00 00 
+  800868:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80086a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80086f:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  800876:	00 00 00 
+  800879:	ff d0                	call   *%rax
+}
+  80087b:	5d                   	pop    %rbp
+  80087c:	c3                   	ret
+
+000000000080087d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80087d:	55                   	push   %rbp
+  80087e:	48 89 e5             	mov    %rsp,%rbp
+  800881:	41 56                	push   %r14
+  800883:	41 55                	push   %r13
+  800885:	41 54                	push   %r12
+  800887:	53                   	push   %rbx
+  800888:	48 83 ec 50          	sub    $0x50,%rsp
+  80088c:	49 89 fc             	mov    %rdi,%r12
+  80088f:	41 89 f5             	mov    %esi,%r13d
+  800892:	48 89 d3             	mov    %rdx,%rbx
+  800895:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800899:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80089d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8008a1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8008a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008ac:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8008b0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8008b4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8008b8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8008bf:	00 00 00 
+  8008c2:	4c 8b 30             	mov    (%rax),%r14
+  8008c5:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  8008cc:	00 00 00 
+  8008cf:	ff d0                	call   *%rax
+  8008d1:	89 c6                	mov    %eax,%esi
+  8008d3:	45 89 e8             	mov    %r13d,%r8d
+  8008d6:	4c 89 e1             	mov    %r12,%rcx
+  8008d9:	4c 89 f2             	mov    %r14,%rdx
+  8008dc:	48 bf b8 51 80 00 00 	movabs $0x8051b8,%rdi
+  8008e3:	00 00 00 
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	49 bc cd 09 80 00 00 	movabs $0x8009cd,%r12
+  8008f2:	00 00 00 
+  8008f5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8008f8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8008fc:	48 89 df             	mov    %rbx,%rdi
+  8008ff:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  800906:	00 00 00 
+  800909:	ff d0                	call   *%rax
+    cprintf("\n");
+  80090b:	48 bf 8b 50 80 00 00 	movabs $0x80508b,%rdi
+  800912:	00 00 00 
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80091d:	cc                   	int3
+  80091e:	eb fd                	jmp    80091d <_panic+0xa0>
+
+0000000000800920 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800920:	55                   	push   %rbp
+  800921:	48 89 e5             	mov    %rsp,%rbp
+  800924:	53                   	push   %rbx
+  800925:	48 83 ec 08          	sub    $0x8,%rsp
+  800929:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80092c:	8b 06                	mov    (%rsi),%eax
+  80092e:	8d 50 01             	lea    0x1(%rax),%edx
+  800931:	89 16                	mov    %edx,(%rsi)
+  800933:	48 98                	cltq
+  800935:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80093a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800940:	74 0a                	je     80094c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800942:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800946:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80094c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800950:	be ff 00 00 00       	mov    $0xff,%esi
+  800955:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  80095c:	00 00 00 
+  80095f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800961:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800967:	eb d9                	jmp    800942 <putch+0x22>
+
+0000000000800969 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800969:	55                   	push   %rbp
+  80096a:	48 89 e5             	mov    %rsp,%rbp
+  80096d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800974:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800977:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80097e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+  800988:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80098b:	48 89 f1             	mov    %rsi,%rcx
+  80098e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800995:	48 bf 20 09 80 00 00 	movabs $0x800920,%rdi
+  80099c:	00 00 00 
+  80099f:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  8009a6:	00 00 00 
+  8009a9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8009ab:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8009b2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8009b9:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8009c0:	00 00 00 
+  8009c3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8009c5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+00000000008009cd <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8009cd:	55                   	push   %rbp
+  8009ce:	48 89 e5             	mov    %rsp,%rbp
+  8009d1:	48 83 ec 50          	sub    $0x50,%rsp
+  8009d5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8009d9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8009dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8009e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8009e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8009e9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8009f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8009fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800a00:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800a04:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  800a0b:	00 00 00 
+  800a0e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800a10:	c9                   	leave
+  800a11:	c3                   	ret
+
+0000000000800a12 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800a12:	55                   	push   %rbp
+  800a13:	48 89 e5             	mov    %rsp,%rbp
+  800a16:	41 57                	push   %r15
+  800a18:	41 56                	push   %r14
+  800a1a:	41 55                	push   %r13
+  800a1c:	41 54                	push   %r12
+  800a1e:	53                   	push   %rbx
+  800a1f:	48 83 ec 18          	sub    $0x18,%rsp
+  800a23:	49 89 fc             	mov    %rdi,%r12
+  800a26:	49 89 f5             	mov    %rsi,%r13
+  800a29:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800a2d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800a30:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800a33:	41 89 cf             	mov    %ecx,%r15d
+  800a36:	4c 39 fa             	cmp    %r15,%rdx
+  800a39:	73 5b                	jae    800a96 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800a3b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800a3f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800a43:	85 db                	test   %ebx,%ebx
+  800a45:	7e 0e                	jle    800a55 <print_num+0x43>
+            putch(padc, put_arg);
+  800a47:	4c 89 ee             	mov    %r13,%rsi
+  800a4a:	44 89 f7             	mov    %r14d,%edi
+  800a4d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800a50:	83 eb 01             	sub    $0x1,%ebx
+  800a53:	75 f2                	jne    800a47 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800a55:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800a59:	48 b9 ec 51 80 00 00 	movabs $0x8051ec,%rcx
+  800a60:	00 00 00 
+  800a63:	48 b8 db 51 80 00 00 	movabs $0x8051db,%rax
+  800a6a:	00 00 00 
+  800a6d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800a71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7a:	49 f7 f7             	div    %r15
+  800a7d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800a81:	4c 89 ee             	mov    %r13,%rsi
+  800a84:	41 ff d4             	call   *%r12
+}
+  800a87:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a8b:	5b                   	pop    %rbx
+  800a8c:	41 5c                	pop    %r12
+  800a8e:	41 5d                	pop    %r13
+  800a90:	41 5e                	pop    %r14
+  800a92:	41 5f                	pop    %r15
+  800a94:	5d                   	pop    %rbp
+  800a95:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800a96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9f:	49 f7 f7             	div    %r15
+  800aa2:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800aaa:	52                   	push   %rdx
+  800aab:	45 0f be c9          	movsbl %r9b,%r9d
+  800aaf:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800ab3:	48 89 c2             	mov    %rax,%rdx
+  800ab6:	48 b8 12 0a 80 00 00 	movabs $0x800a12,%rax
+  800abd:	00 00 00 
+  800ac0:	ff d0                	call   *%rax
+  800ac2:	48 83 c4 10          	add    $0x10,%rsp
+  800ac6:	eb 8d                	jmp    800a55 <print_num+0x43>
+
+0000000000800ac8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ac8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800acc:	48 8b 06             	mov    (%rsi),%rax
+  800acf:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800ad3:	73 0a                	jae    800adf <sprintputch+0x17>
+        *state->start++ = ch;
+  800ad5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ad9:	48 89 16             	mov    %rdx,(%rsi)
+  800adc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800adf:	c3                   	ret
+
+0000000000800ae0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ae0:	55                   	push   %rbp
+  800ae1:	48 89 e5             	mov    %rsp,%rbp
+  800ae4:	48 83 ec 50          	sub    $0x50,%rsp
+  800ae8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800aec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800af0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800af4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800afb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b03:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800b0b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b0f:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  800b16:	00 00 00 
+  800b19:	ff d0                	call   *%rax
+}
+  800b1b:	c9                   	leave
+  800b1c:	c3                   	ret
+
+0000000000800b1d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800b1d:	55                   	push   %rbp
+  800b1e:	48 89 e5             	mov    %rsp,%rbp
+  800b21:	41 57                	push   %r15
+  800b23:	41 56                	push   %r14
+  800b25:	41 55                	push   %r13
+  800b27:	41 54                	push   %r12
+  800b29:	53                   	push   %rbx
+  800b2a:	48 83 ec 38          	sub    $0x38,%rsp
+  800b2e:	49 89 fe             	mov    %rdi,%r14
+  800b31:	49 89 f5             	mov    %rsi,%r13
+  800b34:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800b37:	48 8b 01             	mov    (%rcx),%rax
+  800b3a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800b3e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800b42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b46:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800b4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800b4e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800b52:	0f b6 3b             	movzbl (%rbx),%edi
+  800b55:	40 80 ff 25          	cmp    $0x25,%dil
+  800b59:	74 18                	je     800b73 <vprintfmt+0x56>
+            if (!ch) return;
+  800b5b:	40 84 ff             	test   %dil,%dil
+  800b5e:	0f 84 b1 06 00 00    	je     801215 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800b64:	40 0f b6 ff          	movzbl %dil,%edi
+  800b68:	4c 89 ee             	mov    %r13,%rsi
+  800b6b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800b6e:	4c 89 e3             	mov    %r12,%rbx
+  800b71:	eb db                	jmp    800b4e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800b73:	be 00 00 00 00       	mov    $0x0,%esi
+  800b78:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800b81:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b87:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800b8e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b92:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800b97:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800b9c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b9f:	83 e8 23             	sub    $0x23,%eax
+  800ba2:	3c 57                	cmp    $0x57,%al
+  800ba4:	0f 87 51 06 00 00    	ja     8011fb <vprintfmt+0x6de>
+  800baa:	0f b6 c0             	movzbl %al,%eax
+  800bad:	48 b9 a0 53 80 00 00 	movabs $0x8053a0,%rcx
+  800bb4:	00 00 00 
+  800bb7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800bba:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800bbd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800bc1:	eb cf                	jmp    800b92 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800bc3:	49 89 dc             	mov    %rbx,%r12
+  800bc6:	be 01 00 00 00       	mov    $0x1,%esi
+  800bcb:	eb c5                	jmp    800b92 <vprintfmt+0x75>
+            padc = ch;
+  800bcd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800bd1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800bd4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bd7:	eb b9                	jmp    800b92 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 24                	ja     800c05 <vprintfmt+0xe8>
+  800be1:	89 c1                	mov    %eax,%ecx
+  800be3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800be7:	83 c0 08             	add    $0x8,%eax
+  800bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bed:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800bf0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800bf3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800bf7:	79 99                	jns    800b92 <vprintfmt+0x75>
+                width = precision;
+  800bf9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800bfd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800c03:	eb 8d                	jmp    800b92 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800c05:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800c09:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c11:	eb da                	jmp    800bed <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800c13:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800c18:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800c1c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800c22:	3c 39                	cmp    $0x39,%al
+  800c24:	77 1c                	ja     800c42 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800c26:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800c2a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800c2e:	0f b6 c0             	movzbl %al,%eax
+  800c31:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800c36:	0f b6 03             	movzbl (%rbx),%eax
+  800c39:	3c 39                	cmp    $0x39,%al
+  800c3b:	76 e9                	jbe    800c26 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800c3d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800c40:	eb b1                	jmp    800bf3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800c42:	49 89 dc             	mov    %rbx,%r12
+  800c45:	eb ac                	jmp    800bf3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800c47:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800c4a:	85 c9                	test   %ecx,%ecx
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c51:	0f 49 c1             	cmovns %ecx,%eax
+  800c54:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800c57:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c5a:	e9 33 ff ff ff       	jmp    800b92 <vprintfmt+0x75>
+            lflag++;
+  800c5f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800c62:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c65:	e9 28 ff ff ff       	jmp    800b92 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800c6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c70:	77 19                	ja     800c8b <vprintfmt+0x16e>
+  800c72:	89 c2                	mov    %eax,%edx
+  800c74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c78:	83 c0 08             	add    $0x8,%eax
+  800c7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7e:	8b 3a                	mov    (%rdx),%edi
+  800c80:	4c 89 ee             	mov    %r13,%rsi
+  800c83:	41 ff d6             	call   *%r14
+            break;
+  800c86:	e9 c3 fe ff ff       	jmp    800b4e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800c8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c97:	eb e5                	jmp    800c7e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800c99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9f:	77 5a                	ja     800cfb <vprintfmt+0x1de>
+  800ca1:	89 c2                	mov    %eax,%edx
+  800ca3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca7:	83 c0 08             	add    $0x8,%eax
+  800caa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800cad:	8b 02                	mov    (%rdx),%eax
+  800caf:	89 c1                	mov    %eax,%ecx
+  800cb1:	f7 d9                	neg    %ecx
+  800cb3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800cb6:	83 f9 16             	cmp    $0x16,%ecx
+  800cb9:	7f 4e                	jg     800d09 <vprintfmt+0x1ec>
+  800cbb:	48 63 c1             	movslq %ecx,%rax
+  800cbe:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  800cc5:	00 00 00 
+  800cc8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ccc:	48 85 c0             	test   %rax,%rax
+  800ccf:	74 38                	je     800d09 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800cd1:	48 89 c1             	mov    %rax,%rcx
+  800cd4:	48 ba 59 58 80 00 00 	movabs $0x805859,%rdx
+  800cdb:	00 00 00 
+  800cde:	4c 89 ee             	mov    %r13,%rsi
+  800ce1:	4c 89 f7             	mov    %r14,%rdi
+  800ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce9:	49 b8 e0 0a 80 00 00 	movabs $0x800ae0,%r8
+  800cf0:	00 00 00 
+  800cf3:	41 ff d0             	call   *%r8
+  800cf6:	e9 53 fe ff ff       	jmp    800b4e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800cfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d07:	eb a4                	jmp    800cad <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800d09:	48 ba 04 52 80 00 00 	movabs $0x805204,%rdx
+  800d10:	00 00 00 
+  800d13:	4c 89 ee             	mov    %r13,%rsi
+  800d16:	4c 89 f7             	mov    %r14,%rdi
+  800d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1e:	49 b8 e0 0a 80 00 00 	movabs $0x800ae0,%r8
+  800d25:	00 00 00 
+  800d28:	41 ff d0             	call   *%r8
+  800d2b:	e9 1e fe ff ff       	jmp    800b4e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d33:	83 f8 2f             	cmp    $0x2f,%eax
+  800d36:	77 6c                	ja     800da4 <vprintfmt+0x287>
+  800d38:	89 c2                	mov    %eax,%edx
+  800d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3e:	83 c0 08             	add    $0x8,%eax
+  800d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d44:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800d47:	48 85 d2             	test   %rdx,%rdx
+  800d4a:	48 b8 fd 51 80 00 00 	movabs $0x8051fd,%rax
+  800d51:	00 00 00 
+  800d54:	48 0f 45 c2          	cmovne %rdx,%rax
+  800d58:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800d5c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800d60:	7e 06                	jle    800d68 <vprintfmt+0x24b>
+  800d62:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800d66:	75 4a                	jne    800db2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d68:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d6c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d70:	0f b6 00             	movzbl (%rax),%eax
+  800d73:	84 c0                	test   %al,%al
+  800d75:	0f 85 9a 00 00 00    	jne    800e15 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800d7b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d7e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d82:	85 c0                	test   %eax,%eax
+  800d84:	0f 8e c4 fd ff ff    	jle    800b4e <vprintfmt+0x31>
+  800d8a:	4c 89 ee             	mov    %r13,%rsi
+  800d8d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d92:	41 ff d6             	call   *%r14
+  800d95:	41 83 ec 01          	sub    $0x1,%r12d
+  800d99:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d9d:	75 eb                	jne    800d8a <vprintfmt+0x26d>
+  800d9f:	e9 aa fd ff ff       	jmp    800b4e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800da4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db0:	eb 92                	jmp    800d44 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800db2:	49 63 f7             	movslq %r15d,%rsi
+  800db5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800db9:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  800dc0:	00 00 00 
+  800dc3:	ff d0                	call   *%rax
+  800dc5:	48 89 c2             	mov    %rax,%rdx
+  800dc8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800dcb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800dcd:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800dd0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	7e 91                	jle    800d68 <vprintfmt+0x24b>
+  800dd7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ddc:	4c 89 ee             	mov    %r13,%rsi
+  800ddf:	44 89 e7             	mov    %r12d,%edi
+  800de2:	41 ff d6             	call   *%r14
+  800de5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800de9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800dec:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800def:	75 eb                	jne    800ddc <vprintfmt+0x2bf>
+  800df1:	e9 72 ff ff ff       	jmp    800d68 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800df6:	0f b6 f8             	movzbl %al,%edi
+  800df9:	4c 89 ee             	mov    %r13,%rsi
+  800dfc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800dff:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800e03:	49 83 c4 01          	add    $0x1,%r12
+  800e07:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800e0d:	84 c0                	test   %al,%al
+  800e0f:	0f 84 66 ff ff ff    	je     800d7b <vprintfmt+0x25e>
+  800e15:	45 85 ff             	test   %r15d,%r15d
+  800e18:	78 0a                	js     800e24 <vprintfmt+0x307>
+  800e1a:	41 83 ef 01          	sub    $0x1,%r15d
+  800e1e:	0f 88 57 ff ff ff    	js     800d7b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800e24:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800e28:	74 cc                	je     800df6 <vprintfmt+0x2d9>
+  800e2a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800e2d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e32:	80 fa 5e             	cmp    $0x5e,%dl
+  800e35:	77 c2                	ja     800df9 <vprintfmt+0x2dc>
+  800e37:	eb bd                	jmp    800df6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800e39:	40 84 f6             	test   %sil,%sil
+  800e3c:	75 26                	jne    800e64 <vprintfmt+0x347>
+    switch (lflag) {
+  800e3e:	85 d2                	test   %edx,%edx
+  800e40:	74 59                	je     800e9b <vprintfmt+0x37e>
+  800e42:	83 fa 01             	cmp    $0x1,%edx
+  800e45:	74 7b                	je     800ec2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800e47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4d:	0f 87 96 00 00 00    	ja     800ee9 <vprintfmt+0x3cc>
+  800e53:	89 c2                	mov    %eax,%edx
+  800e55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e59:	83 c0 08             	add    $0x8,%eax
+  800e5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5f:	4c 8b 22             	mov    (%rdx),%r12
+  800e62:	eb 17                	jmp    800e7b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800e64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e67:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6a:	77 21                	ja     800e8d <vprintfmt+0x370>
+  800e6c:	89 c2                	mov    %eax,%edx
+  800e6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e72:	83 c0 08             	add    $0x8,%eax
+  800e75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e78:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800e7b:	4d 85 e4             	test   %r12,%r12
+  800e7e:	78 7a                	js     800efa <vprintfmt+0x3dd>
+            num = i;
+  800e80:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800e83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800e88:	e9 50 02 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e99:	eb dd                	jmp    800e78 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800e9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea1:	77 11                	ja     800eb4 <vprintfmt+0x397>
+  800ea3:	89 c2                	mov    %eax,%edx
+  800ea5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea9:	83 c0 08             	add    $0x8,%eax
+  800eac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eaf:	4c 63 22             	movslq (%rdx),%r12
+  800eb2:	eb c7                	jmp    800e7b <vprintfmt+0x35e>
+  800eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec0:	eb ed                	jmp    800eaf <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800ec2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ec8:	77 11                	ja     800edb <vprintfmt+0x3be>
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed0:	83 c0 08             	add    $0x8,%eax
+  800ed3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ed6:	4c 8b 22             	mov    (%rdx),%r12
+  800ed9:	eb a0                	jmp    800e7b <vprintfmt+0x35e>
+  800edb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800edf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee7:	eb ed                	jmp    800ed6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ee9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef5:	e9 65 ff ff ff       	jmp    800e5f <vprintfmt+0x342>
+                putch('-', put_arg);
+  800efa:	4c 89 ee             	mov    %r13,%rsi
+  800efd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f02:	41 ff d6             	call   *%r14
+                i = -i;
+  800f05:	49 f7 dc             	neg    %r12
+  800f08:	e9 73 ff ff ff       	jmp    800e80 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800f0d:	40 84 f6             	test   %sil,%sil
+  800f10:	75 32                	jne    800f44 <vprintfmt+0x427>
+    switch (lflag) {
+  800f12:	85 d2                	test   %edx,%edx
+  800f14:	74 5d                	je     800f73 <vprintfmt+0x456>
+  800f16:	83 fa 01             	cmp    $0x1,%edx
+  800f19:	0f 84 82 00 00 00    	je     800fa1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800f1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f22:	83 f8 2f             	cmp    $0x2f,%eax
+  800f25:	0f 87 a5 00 00 00    	ja     800fd0 <vprintfmt+0x4b3>
+  800f2b:	89 c2                	mov    %eax,%edx
+  800f2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f31:	83 c0 08             	add    $0x8,%eax
+  800f34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f37:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f3a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f3f:	e9 99 01 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f47:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4a:	77 19                	ja     800f65 <vprintfmt+0x448>
+  800f4c:	89 c2                	mov    %eax,%edx
+  800f4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f52:	83 c0 08             	add    $0x8,%eax
+  800f55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f58:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f5b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f60:	e9 78 01 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+  800f65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f71:	eb e5                	jmp    800f58 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800f73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f76:	83 f8 2f             	cmp    $0x2f,%eax
+  800f79:	77 18                	ja     800f93 <vprintfmt+0x476>
+  800f7b:	89 c2                	mov    %eax,%edx
+  800f7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f81:	83 c0 08             	add    $0x8,%eax
+  800f84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f87:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800f89:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800f8e:	e9 4a 01 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+  800f93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9f:	eb e6                	jmp    800f87 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800fa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa7:	77 19                	ja     800fc2 <vprintfmt+0x4a5>
+  800fa9:	89 c2                	mov    %eax,%edx
+  800fab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800faf:	83 c0 08             	add    $0x8,%eax
+  800fb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fb5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800fb8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800fbd:	e9 1b 01 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+  800fc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fce:	eb e5                	jmp    800fb5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800fd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fdc:	e9 56 ff ff ff       	jmp    800f37 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800fe1:	40 84 f6             	test   %sil,%sil
+  800fe4:	75 2e                	jne    801014 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800fe6:	85 d2                	test   %edx,%edx
+  800fe8:	74 59                	je     801043 <vprintfmt+0x526>
+  800fea:	83 fa 01             	cmp    $0x1,%edx
+  800fed:	74 7f                	je     80106e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800fef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ff2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ff5:	0f 87 9f 00 00 00    	ja     80109a <vprintfmt+0x57d>
+  800ffb:	89 c2                	mov    %eax,%edx
+  800ffd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801001:	83 c0 08             	add    $0x8,%eax
+  801004:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801007:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80100a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80100f:	e9 c9 00 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801014:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801017:	83 f8 2f             	cmp    $0x2f,%eax
+  80101a:	77 19                	ja     801035 <vprintfmt+0x518>
+  80101c:	89 c2                	mov    %eax,%edx
+  80101e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801022:	83 c0 08             	add    $0x8,%eax
+  801025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801028:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80102b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801030:	e9 a8 00 00 00       	jmp    8010dd <vprintfmt+0x5c0>
+  801035:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801039:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801041:	eb e5                	jmp    801028 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801043:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801046:	83 f8 2f             	cmp    $0x2f,%eax
+  801049:	77 15                	ja     801060 <vprintfmt+0x543>
+  80104b:	89 c2                	mov    %eax,%edx
+  80104d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801051:	83 c0 08             	add    $0x8,%eax
+  801054:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801057:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801059:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80105e:	eb 7d                	jmp    8010dd <vprintfmt+0x5c0>
+  801060:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801064:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801068:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80106c:	eb e9                	jmp    801057 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80106e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801071:	83 f8 2f             	cmp    $0x2f,%eax
+  801074:	77 16                	ja     80108c <vprintfmt+0x56f>
+  801076:	89 c2                	mov    %eax,%edx
+  801078:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80107c:	83 c0 08             	add    $0x8,%eax
+  80107f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801082:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801085:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80108a:	eb 51                	jmp    8010dd <vprintfmt+0x5c0>
+  80108c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801090:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801094:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801098:	eb e8                	jmp    801082 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80109a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80109e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a6:	e9 5c ff ff ff       	jmp    801007 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8010ab:	4c 89 ee             	mov    %r13,%rsi
+  8010ae:	bf 30 00 00 00       	mov    $0x30,%edi
+  8010b3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8010b6:	4c 89 ee             	mov    %r13,%rsi
+  8010b9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8010be:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8010c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8010c7:	77 47                	ja     801110 <vprintfmt+0x5f3>
+  8010c9:	89 c2                	mov    %eax,%edx
+  8010cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010cf:	83 c0 08             	add    $0x8,%eax
+  8010d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8010dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8010e5:	0f 94 c0             	sete   %al
+  8010e8:	0f b6 c0             	movzbl %al,%eax
+  8010eb:	50                   	push   %rax
+  8010ec:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8010f1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8010f5:	4c 89 ee             	mov    %r13,%rsi
+  8010f8:	4c 89 f7             	mov    %r14,%rdi
+  8010fb:	48 b8 12 0a 80 00 00 	movabs $0x800a12,%rax
+  801102:	00 00 00 
+  801105:	ff d0                	call   *%rax
+            break;
+  801107:	48 83 c4 10          	add    $0x10,%rsp
+  80110b:	e9 3e fa ff ff       	jmp    800b4e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801110:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801114:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801118:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80111c:	eb b7                	jmp    8010d5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80111e:	40 84 f6             	test   %sil,%sil
+  801121:	75 2b                	jne    80114e <vprintfmt+0x631>
+    switch (lflag) {
+  801123:	85 d2                	test   %edx,%edx
+  801125:	74 56                	je     80117d <vprintfmt+0x660>
+  801127:	83 fa 01             	cmp    $0x1,%edx
+  80112a:	74 7f                	je     8011ab <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80112c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80112f:	83 f8 2f             	cmp    $0x2f,%eax
+  801132:	0f 87 a2 00 00 00    	ja     8011da <vprintfmt+0x6bd>
+  801138:	89 c2                	mov    %eax,%edx
+  80113a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80113e:	83 c0 08             	add    $0x8,%eax
+  801141:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801144:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801147:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80114c:	eb 8f                	jmp    8010dd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80114e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801151:	83 f8 2f             	cmp    $0x2f,%eax
+  801154:	77 19                	ja     80116f <vprintfmt+0x652>
+  801156:	89 c2                	mov    %eax,%edx
+  801158:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80115c:	83 c0 08             	add    $0x8,%eax
+  80115f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801162:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801165:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80116a:	e9 6e ff ff ff       	jmp    8010dd <vprintfmt+0x5c0>
+  80116f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801173:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801177:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80117b:	eb e5                	jmp    801162 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80117d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801180:	83 f8 2f             	cmp    $0x2f,%eax
+  801183:	77 18                	ja     80119d <vprintfmt+0x680>
+  801185:	89 c2                	mov    %eax,%edx
+  801187:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80118b:	83 c0 08             	add    $0x8,%eax
+  80118e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801191:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801193:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801198:	e9 40 ff ff ff       	jmp    8010dd <vprintfmt+0x5c0>
+  80119d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011a9:	eb e6                	jmp    801191 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8011ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8011b1:	77 19                	ja     8011cc <vprintfmt+0x6af>
+  8011b3:	89 c2                	mov    %eax,%edx
+  8011b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011b9:	83 c0 08             	add    $0x8,%eax
+  8011bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011bf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8011c2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8011c7:	e9 11 ff ff ff       	jmp    8010dd <vprintfmt+0x5c0>
+  8011cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011d8:	eb e5                	jmp    8011bf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8011da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011e6:	e9 59 ff ff ff       	jmp    801144 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8011eb:	4c 89 ee             	mov    %r13,%rsi
+  8011ee:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011f3:	41 ff d6             	call   *%r14
+            break;
+  8011f6:	e9 53 f9 ff ff       	jmp    800b4e <vprintfmt+0x31>
+            putch('%', put_arg);
+  8011fb:	4c 89 ee             	mov    %r13,%rsi
+  8011fe:	bf 25 00 00 00       	mov    $0x25,%edi
+  801203:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801206:	48 83 eb 01          	sub    $0x1,%rbx
+  80120a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80120e:	75 f6                	jne    801206 <vprintfmt+0x6e9>
+  801210:	e9 39 f9 ff ff       	jmp    800b4e <vprintfmt+0x31>
+}
+  801215:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801219:	5b                   	pop    %rbx
+  80121a:	41 5c                	pop    %r12
+  80121c:	41 5d                	pop    %r13
+  80121e:	41 5e                	pop    %r14
+  801220:	41 5f                	pop    %r15
+  801222:	5d                   	pop    %rbp
+  801223:	c3                   	ret
+
+0000000000801224 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801224:	55                   	push   %rbp
+  801225:	48 89 e5             	mov    %rsp,%rbp
+  801228:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80122c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801230:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801235:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801239:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801240:	48 85 ff             	test   %rdi,%rdi
+  801243:	74 2b                	je     801270 <vsnprintf+0x4c>
+  801245:	48 85 f6             	test   %rsi,%rsi
+  801248:	74 26                	je     801270 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80124a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80124e:	48 bf c8 0a 80 00 00 	movabs $0x800ac8,%rdi
+  801255:	00 00 00 
+  801258:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801264:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801268:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80126b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801270:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801275:	eb f7                	jmp    80126e <vsnprintf+0x4a>
+
+0000000000801277 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+  80127b:	48 83 ec 50          	sub    $0x50,%rsp
+  80127f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801283:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801287:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80128b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801292:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801296:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80129a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80129e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8012a2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8012a6:	48 b8 24 12 80 00 00 	movabs $0x801224,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8012b2:	c9                   	leave
+  8012b3:	c3                   	ret
+
+00000000008012b4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8012b4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8012b7:	74 10                	je     8012c9 <strlen+0x15>
+    size_t n = 0;
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8012be:	48 83 c0 01          	add    $0x1,%rax
+  8012c2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8012c6:	75 f6                	jne    8012be <strlen+0xa>
+  8012c8:	c3                   	ret
+    size_t n = 0;
+  8012c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8012ce:	c3                   	ret
+
+00000000008012cf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8012cf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8012d2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8012d7:	48 85 f6             	test   %rsi,%rsi
+  8012da:	74 11                	je     8012ed <strnlen+0x1e>
+  8012dc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8012e0:	74 0c                	je     8012ee <strnlen+0x1f>
+  8012e2:	48 83 c2 01          	add    $0x1,%rdx
+  8012e6:	48 39 d0             	cmp    %rdx,%rax
+  8012e9:	75 f1                	jne    8012dc <strnlen+0xd>
+  8012eb:	eb 04                	jmp    8012f1 <strnlen+0x22>
+  8012ed:	c3                   	ret
+  8012ee:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8012f1:	c3                   	ret
+
+00000000008012f2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8012f2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8012f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fa:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8012fe:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801301:	48 83 c2 01          	add    $0x1,%rdx
+  801305:	84 c9                	test   %cl,%cl
+  801307:	75 f1                	jne    8012fa <strcpy+0x8>
+        ;
+    return res;
+}
+  801309:	c3                   	ret
+
+000000000080130a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	41 54                	push   %r12
+  801310:	53                   	push   %rbx
+  801311:	48 89 fb             	mov    %rdi,%rbx
+  801314:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801317:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  80131e:	00 00 00 
+  801321:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801323:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801327:	4c 89 e6             	mov    %r12,%rsi
+  80132a:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  801331:	00 00 00 
+  801334:	ff d0                	call   *%rax
+    return dst;
+}
+  801336:	48 89 d8             	mov    %rbx,%rax
+  801339:	5b                   	pop    %rbx
+  80133a:	41 5c                	pop    %r12
+  80133c:	5d                   	pop    %rbp
+  80133d:	c3                   	ret
+
+000000000080133e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80133e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801341:	48 85 d2             	test   %rdx,%rdx
+  801344:	74 1f                	je     801365 <strncpy+0x27>
+  801346:	48 01 fa             	add    %rdi,%rdx
+  801349:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80134c:	48 83 c1 01          	add    $0x1,%rcx
+  801350:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801354:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801358:	41 80 f8 01          	cmp    $0x1,%r8b
+  80135c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801360:	48 39 ca             	cmp    %rcx,%rdx
+  801363:	75 e7                	jne    80134c <strncpy+0xe>
+    }
+    return ret;
+}
+  801365:	c3                   	ret
+
+0000000000801366 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801366:	48 89 f8             	mov    %rdi,%rax
+  801369:	48 85 d2             	test   %rdx,%rdx
+  80136c:	74 24                	je     801392 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80136e:	48 83 ea 01          	sub    $0x1,%rdx
+  801372:	74 1b                	je     80138f <strlcpy+0x29>
+  801374:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801378:	0f b6 16             	movzbl (%rsi),%edx
+  80137b:	84 d2                	test   %dl,%dl
+  80137d:	74 10                	je     80138f <strlcpy+0x29>
+            *dst++ = *src++;
+  80137f:	48 83 c6 01          	add    $0x1,%rsi
+  801383:	48 83 c0 01          	add    $0x1,%rax
+  801387:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80138a:	48 39 c8             	cmp    %rcx,%rax
+  80138d:	75 e9                	jne    801378 <strlcpy+0x12>
+        *dst = '\0';
+  80138f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801392:	48 29 f8             	sub    %rdi,%rax
+}
+  801395:	c3                   	ret
+
+0000000000801396 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801396:	0f b6 07             	movzbl (%rdi),%eax
+  801399:	84 c0                	test   %al,%al
+  80139b:	74 13                	je     8013b0 <strcmp+0x1a>
+  80139d:	38 06                	cmp    %al,(%rsi)
+  80139f:	75 0f                	jne    8013b0 <strcmp+0x1a>
+  8013a1:	48 83 c7 01          	add    $0x1,%rdi
+  8013a5:	48 83 c6 01          	add    $0x1,%rsi
+  8013a9:	0f b6 07             	movzbl (%rdi),%eax
+  8013ac:	84 c0                	test   %al,%al
+  8013ae:	75 ed                	jne    80139d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8013b0:	0f b6 c0             	movzbl %al,%eax
+  8013b3:	0f b6 16             	movzbl (%rsi),%edx
+  8013b6:	29 d0                	sub    %edx,%eax
+}
+  8013b8:	c3                   	ret
+
+00000000008013b9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8013b9:	48 85 d2             	test   %rdx,%rdx
+  8013bc:	74 1f                	je     8013dd <strncmp+0x24>
+  8013be:	0f b6 07             	movzbl (%rdi),%eax
+  8013c1:	84 c0                	test   %al,%al
+  8013c3:	74 1e                	je     8013e3 <strncmp+0x2a>
+  8013c5:	3a 06                	cmp    (%rsi),%al
+  8013c7:	75 1a                	jne    8013e3 <strncmp+0x2a>
+  8013c9:	48 83 c7 01          	add    $0x1,%rdi
+  8013cd:	48 83 c6 01          	add    $0x1,%rsi
+  8013d1:	48 83 ea 01          	sub    $0x1,%rdx
+  8013d5:	75 e7                	jne    8013be <strncmp+0x5>
+
+    if (!n) return 0;
+  8013d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dc:	c3                   	ret
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	c3                   	ret
+  8013e3:	48 85 d2             	test   %rdx,%rdx
+  8013e6:	74 09                	je     8013f1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8013e8:	0f b6 07             	movzbl (%rdi),%eax
+  8013eb:	0f b6 16             	movzbl (%rsi),%edx
+  8013ee:	29 d0                	sub    %edx,%eax
+  8013f0:	c3                   	ret
+    if (!n) return 0;
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f6:	c3                   	ret
+
+00000000008013f7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8013f7:	0f b6 17             	movzbl (%rdi),%edx
+  8013fa:	84 d2                	test   %dl,%dl
+  8013fc:	74 18                	je     801416 <strchr+0x1f>
+        if (*str == c) {
+  8013fe:	0f be d2             	movsbl %dl,%edx
+  801401:	39 f2                	cmp    %esi,%edx
+  801403:	74 17                	je     80141c <strchr+0x25>
+    for (; *str; str++) {
+  801405:	48 83 c7 01          	add    $0x1,%rdi
+  801409:	0f b6 17             	movzbl (%rdi),%edx
+  80140c:	84 d2                	test   %dl,%dl
+  80140e:	75 ee                	jne    8013fe <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	c3                   	ret
+  801416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141b:	c3                   	ret
+  80141c:	48 89 f8             	mov    %rdi,%rax
+}
+  80141f:	c3                   	ret
+
+0000000000801420 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801420:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801423:	0f b6 17             	movzbl (%rdi),%edx
+  801426:	84 d2                	test   %dl,%dl
+  801428:	74 13                	je     80143d <strfind+0x1d>
+  80142a:	0f be d2             	movsbl %dl,%edx
+  80142d:	39 f2                	cmp    %esi,%edx
+  80142f:	74 0b                	je     80143c <strfind+0x1c>
+  801431:	48 83 c0 01          	add    $0x1,%rax
+  801435:	0f b6 10             	movzbl (%rax),%edx
+  801438:	84 d2                	test   %dl,%dl
+  80143a:	75 ee                	jne    80142a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80143c:	c3                   	ret
+  80143d:	c3                   	ret
+
+000000000080143e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80143e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801441:	48 89 f8             	mov    %rdi,%rax
+  801444:	48 f7 d8             	neg    %rax
+  801447:	83 e0 07             	and    $0x7,%eax
+  80144a:	49 89 d1             	mov    %rdx,%r9
+  80144d:	49 29 c1             	sub    %rax,%r9
+  801450:	78 36                	js     801488 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801452:	40 0f b6 c6          	movzbl %sil,%eax
+  801456:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80145d:	01 01 01 
+  801460:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801464:	40 f6 c7 07          	test   $0x7,%dil
+  801468:	75 38                	jne    8014a2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80146a:	4c 89 c9             	mov    %r9,%rcx
+  80146d:	48 c1 f9 03          	sar    $0x3,%rcx
+  801471:	74 0c                	je     80147f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801473:	fc                   	cld
+  801474:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801477:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80147b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80147f:	4d 85 c9             	test   %r9,%r9
+  801482:	75 45                	jne    8014c9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801484:	4c 89 c0             	mov    %r8,%rax
+  801487:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801488:	48 85 d2             	test   %rdx,%rdx
+  80148b:	74 f7                	je     801484 <memset+0x46>
+  80148d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801490:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801493:	48 83 c0 01          	add    $0x1,%rax
+  801497:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80149b:	48 39 c2             	cmp    %rax,%rdx
+  80149e:	75 f3                	jne    801493 <memset+0x55>
+  8014a0:	eb e2                	jmp    801484 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8014a2:	40 f6 c7 01          	test   $0x1,%dil
+  8014a6:	74 06                	je     8014ae <memset+0x70>
+  8014a8:	88 07                	mov    %al,(%rdi)
+  8014aa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8014ae:	40 f6 c7 02          	test   $0x2,%dil
+  8014b2:	74 07                	je     8014bb <memset+0x7d>
+  8014b4:	66 89 07             	mov    %ax,(%rdi)
+  8014b7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8014bb:	40 f6 c7 04          	test   $0x4,%dil
+  8014bf:	74 a9                	je     80146a <memset+0x2c>
+  8014c1:	89 07                	mov    %eax,(%rdi)
+  8014c3:	48 83 c7 04          	add    $0x4,%rdi
+  8014c7:	eb a1                	jmp    80146a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8014c9:	41 f6 c1 04          	test   $0x4,%r9b
+  8014cd:	74 06                	je     8014d5 <memset+0x97>
+  8014cf:	89 07                	mov    %eax,(%rdi)
+  8014d1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8014d5:	41 f6 c1 02          	test   $0x2,%r9b
+  8014d9:	74 07                	je     8014e2 <memset+0xa4>
+  8014db:	66 89 07             	mov    %ax,(%rdi)
+  8014de:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8014e2:	41 f6 c1 01          	test   $0x1,%r9b
+  8014e6:	74 9c                	je     801484 <memset+0x46>
+  8014e8:	88 07                	mov    %al,(%rdi)
+  8014ea:	eb 98                	jmp    801484 <memset+0x46>
+
+00000000008014ec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8014ec:	48 89 f8             	mov    %rdi,%rax
+  8014ef:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8014f2:	48 39 fe             	cmp    %rdi,%rsi
+  8014f5:	73 3b                	jae    801532 <memmove+0x46>
+  8014f7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8014fb:	48 39 d7             	cmp    %rdx,%rdi
+  8014fe:	73 32                	jae    801532 <memmove+0x46>
+        s += n;
+        d += n;
+  801500:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801504:	48 89 d6             	mov    %rdx,%rsi
+  801507:	48 09 fe             	or     %rdi,%rsi
+  80150a:	48 09 ce             	or     %rcx,%rsi
+  80150d:	40 f6 c6 07          	test   $0x7,%sil
+  801511:	75 12                	jne    801525 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801513:	48 83 ef 08          	sub    $0x8,%rdi
+  801517:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80151b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80151f:	fd                   	std
+  801520:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801523:	fc                   	cld
+  801524:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801525:	48 83 ef 01          	sub    $0x1,%rdi
+  801529:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80152d:	fd                   	std
+  80152e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801530:	eb f1                	jmp    801523 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801532:	48 89 f2             	mov    %rsi,%rdx
+  801535:	48 09 c2             	or     %rax,%rdx
+  801538:	48 09 ca             	or     %rcx,%rdx
+  80153b:	f6 c2 07             	test   $0x7,%dl
+  80153e:	75 0c                	jne    80154c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801540:	48 c1 e9 03          	shr    $0x3,%rcx
+  801544:	48 89 c7             	mov    %rax,%rdi
+  801547:	fc                   	cld
+  801548:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80154b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80154c:	48 89 c7             	mov    %rax,%rdi
+  80154f:	fc                   	cld
+  801550:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801552:	c3                   	ret
+
+0000000000801553 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801553:	55                   	push   %rbp
+  801554:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801557:	48 b8 ec 14 80 00 00 	movabs $0x8014ec,%rax
+  80155e:	00 00 00 
+  801561:	ff d0                	call   *%rax
+}
+  801563:	5d                   	pop    %rbp
+  801564:	c3                   	ret
+
+0000000000801565 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801565:	55                   	push   %rbp
+  801566:	48 89 e5             	mov    %rsp,%rbp
+  801569:	41 57                	push   %r15
+  80156b:	41 56                	push   %r14
+  80156d:	41 55                	push   %r13
+  80156f:	41 54                	push   %r12
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+  801576:	49 89 fe             	mov    %rdi,%r14
+  801579:	49 89 f7             	mov    %rsi,%r15
+  80157c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80157f:	48 89 f7             	mov    %rsi,%rdi
+  801582:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  801589:	00 00 00 
+  80158c:	ff d0                	call   *%rax
+  80158e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801591:	48 89 de             	mov    %rbx,%rsi
+  801594:	4c 89 f7             	mov    %r14,%rdi
+  801597:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  80159e:	00 00 00 
+  8015a1:	ff d0                	call   *%rax
+  8015a3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8015a6:	48 39 c3             	cmp    %rax,%rbx
+  8015a9:	74 36                	je     8015e1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8015ab:	48 89 d8             	mov    %rbx,%rax
+  8015ae:	4c 29 e8             	sub    %r13,%rax
+  8015b1:	49 39 c4             	cmp    %rax,%r12
+  8015b4:	73 31                	jae    8015e7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8015b6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8015bb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8015bf:	4c 89 fe             	mov    %r15,%rsi
+  8015c2:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  8015c9:	00 00 00 
+  8015cc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8015ce:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8015d2:	48 83 c4 08          	add    $0x8,%rsp
+  8015d6:	5b                   	pop    %rbx
+  8015d7:	41 5c                	pop    %r12
+  8015d9:	41 5d                	pop    %r13
+  8015db:	41 5e                	pop    %r14
+  8015dd:	41 5f                	pop    %r15
+  8015df:	5d                   	pop    %rbp
+  8015e0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8015e1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8015e5:	eb eb                	jmp    8015d2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8015e7:	48 83 eb 01          	sub    $0x1,%rbx
+  8015eb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8015ef:	48 89 da             	mov    %rbx,%rdx
+  8015f2:	4c 89 fe             	mov    %r15,%rsi
+  8015f5:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  8015fc:	00 00 00 
+  8015ff:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801601:	49 01 de             	add    %rbx,%r14
+  801604:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801609:	eb c3                	jmp    8015ce <strlcat+0x69>
+
+000000000080160b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80160b:	48 85 d2             	test   %rdx,%rdx
+  80160e:	74 2d                	je     80163d <memcmp+0x32>
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801615:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801619:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80161e:	44 38 c1             	cmp    %r8b,%cl
+  801621:	75 0f                	jne    801632 <memcmp+0x27>
+    while (n-- > 0) {
+  801623:	48 83 c0 01          	add    $0x1,%rax
+  801627:	48 39 c2             	cmp    %rax,%rdx
+  80162a:	75 e9                	jne    801615 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80162c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801631:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801632:	0f b6 c1             	movzbl %cl,%eax
+  801635:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801639:	44 29 c0             	sub    %r8d,%eax
+  80163c:	c3                   	ret
+    return 0;
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801642:	c3                   	ret
+
+0000000000801643 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801643:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801647:	48 39 c7             	cmp    %rax,%rdi
+  80164a:	73 0f                	jae    80165b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80164c:	40 38 37             	cmp    %sil,(%rdi)
+  80164f:	74 0e                	je     80165f <memfind+0x1c>
+    for (; src < end; src++) {
+  801651:	48 83 c7 01          	add    $0x1,%rdi
+  801655:	48 39 f8             	cmp    %rdi,%rax
+  801658:	75 f2                	jne    80164c <memfind+0x9>
+  80165a:	c3                   	ret
+  80165b:	48 89 f8             	mov    %rdi,%rax
+  80165e:	c3                   	ret
+  80165f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801662:	c3                   	ret
+
+0000000000801663 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801663:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801666:	0f b6 37             	movzbl (%rdi),%esi
+  801669:	40 80 fe 20          	cmp    $0x20,%sil
+  80166d:	74 06                	je     801675 <strtol+0x12>
+  80166f:	40 80 fe 09          	cmp    $0x9,%sil
+  801673:	75 13                	jne    801688 <strtol+0x25>
+  801675:	48 83 c7 01          	add    $0x1,%rdi
+  801679:	0f b6 37             	movzbl (%rdi),%esi
+  80167c:	40 80 fe 20          	cmp    $0x20,%sil
+  801680:	74 f3                	je     801675 <strtol+0x12>
+  801682:	40 80 fe 09          	cmp    $0x9,%sil
+  801686:	74 ed                	je     801675 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801688:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80168b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80168e:	3c 01                	cmp    $0x1,%al
+  801690:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801694:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80169a:	75 0f                	jne    8016ab <strtol+0x48>
+  80169c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80169f:	74 14                	je     8016b5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8016a1:	85 d2                	test   %edx,%edx
+  8016a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8016a8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8016b0:	4c 63 ca             	movslq %edx,%r9
+  8016b3:	eb 36                	jmp    8016eb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8016b5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8016b9:	74 0f                	je     8016ca <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8016bb:	85 d2                	test   %edx,%edx
+  8016bd:	75 ec                	jne    8016ab <strtol+0x48>
+        s++;
+  8016bf:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8016c3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8016c8:	eb e1                	jmp    8016ab <strtol+0x48>
+        s += 2;
+  8016ca:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8016ce:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8016d3:	eb d6                	jmp    8016ab <strtol+0x48>
+            dig -= '0';
+  8016d5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8016d8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8016dc:	41 39 d0             	cmp    %edx,%r8d
+  8016df:	7d 21                	jge    801702 <strtol+0x9f>
+        val = val * base + dig;
+  8016e1:	49 0f af c1          	imul   %r9,%rax
+  8016e5:	0f b6 c9             	movzbl %cl,%ecx
+  8016e8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8016eb:	48 83 c7 01          	add    $0x1,%rdi
+  8016ef:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8016f3:	80 f9 39             	cmp    $0x39,%cl
+  8016f6:	76 dd                	jbe    8016d5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8016f8:	80 f9 7b             	cmp    $0x7b,%cl
+  8016fb:	77 05                	ja     801702 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8016fd:	83 e9 57             	sub    $0x57,%ecx
+  801700:	eb d6                	jmp    8016d8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801702:	4d 85 d2             	test   %r10,%r10
+  801705:	74 03                	je     80170a <strtol+0xa7>
+  801707:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80170a:	48 89 c2             	mov    %rax,%rdx
+  80170d:	48 f7 da             	neg    %rdx
+  801710:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801714:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801718:	c3                   	ret
+
+0000000000801719 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	53                   	push   %rbx
+  80171e:	48 89 fa             	mov    %rdi,%rdx
+  801721:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801724:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801729:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801733:	be 00 00 00 00       	mov    $0x0,%esi
+  801738:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801740:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801744:	c9                   	leave
+  801745:	c3                   	ret
+
+0000000000801746 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80174b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801750:	ba 00 00 00 00       	mov    $0x0,%edx
+  801755:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801764:	be 00 00 00 00       	mov    $0x0,%esi
+  801769:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801771:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+0000000000801777 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801777:	55                   	push   %rbp
+  801778:	48 89 e5             	mov    %rsp,%rbp
+  80177b:	53                   	push   %rbx
+  80177c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801780:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801783:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801788:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801792:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801797:	be 00 00 00 00       	mov    $0x0,%esi
+  80179c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a4:	48 85 c0             	test   %rax,%rax
+  8017a7:	7f 06                	jg     8017af <sys_env_destroy+0x38>
+}
+  8017a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ad:	c9                   	leave
+  8017ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017af:	49 89 c0             	mov    %rax,%r8
+  8017b2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8017b7:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8017be:	00 00 00 
+  8017c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c6:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8017cd:	00 00 00 
+  8017d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d5:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  8017dc:	00 00 00 
+  8017df:	41 ff d1             	call   *%r9
+
+00000000008017e2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+  8017e6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801800:	be 00 00 00 00       	mov    $0x0,%esi
+  801805:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80180b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80180d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801811:	c9                   	leave
+  801812:	c3                   	ret
+
+0000000000801813 <sys_yield>:
+
+void
+sys_yield(void) {
+  801813:	55                   	push   %rbp
+  801814:	48 89 e5             	mov    %rsp,%rbp
+  801817:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801818:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80181d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801822:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801827:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801831:	be 00 00 00 00       	mov    $0x0,%esi
+  801836:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80183e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+
+0000000000801844 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	53                   	push   %rbx
+  801849:	48 89 fa             	mov    %rdi,%rdx
+  80184c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80184f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801854:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80185b:	00 00 00 
+  80185e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801870:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801874:	c9                   	leave
+  801875:	c3                   	ret
+
+0000000000801876 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801876:	55                   	push   %rbp
+  801877:	48 89 e5             	mov    %rsp,%rbp
+  80187a:	53                   	push   %rbx
+  80187b:	49 89 f8             	mov    %rdi,%r8
+  80187e:	48 89 d3             	mov    %rdx,%rbx
+  801881:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801884:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801889:	4c 89 c2             	mov    %r8,%rdx
+  80188c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188f:	be 00 00 00 00       	mov    $0x0,%esi
+  801894:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80189a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80189c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+
+00000000008018a2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ab:	89 f8                	mov    %edi,%eax
+  8018ad:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8018b0:	48 63 f9             	movslq %ecx,%rdi
+  8018b3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018bb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018be:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018cb:	48 85 c0             	test   %rax,%rax
+  8018ce:	7f 06                	jg     8018d6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8018d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d4:	c9                   	leave
+  8018d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d6:	49 89 c0             	mov    %rax,%r8
+  8018d9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8018de:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8018e5:	00 00 00 
+  8018e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ed:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8018f4:	00 00 00 
+  8018f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fc:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801903:	00 00 00 
+  801906:	41 ff d1             	call   *%r9
+
+0000000000801909 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	53                   	push   %rbx
+  80190e:	48 83 ec 08          	sub    $0x8,%rsp
+  801912:	89 f8                	mov    %edi,%eax
+  801914:	49 89 f2             	mov    %rsi,%r10
+  801917:	48 89 cf             	mov    %rcx,%rdi
+  80191a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80191d:	48 63 da             	movslq %edx,%rbx
+  801920:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801923:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801928:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80192e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801930:	48 85 c0             	test   %rax,%rax
+  801933:	7f 06                	jg     80193b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801935:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80193b:	49 89 c0             	mov    %rax,%r8
+  80193e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801943:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  80194a:	00 00 00 
+  80194d:	be 26 00 00 00       	mov    $0x26,%esi
+  801952:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801959:	00 00 00 
+  80195c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801961:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801968:	00 00 00 
+  80196b:	41 ff d1             	call   *%r9
+
+000000000080196e <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80196e:	55                   	push   %rbp
+  80196f:	48 89 e5             	mov    %rsp,%rbp
+  801972:	53                   	push   %rbx
+  801973:	48 83 ec 08          	sub    $0x8,%rsp
+  801977:	49 89 f9             	mov    %rdi,%r9
+  80197a:	89 f0                	mov    %esi,%eax
+  80197c:	48 89 d3             	mov    %rdx,%rbx
+  80197f:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801982:	49 63 f0             	movslq %r8d,%rsi
+  801985:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801988:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80198d:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801990:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801996:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801998:	48 85 c0             	test   %rax,%rax
+  80199b:	7f 06                	jg     8019a3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80199d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a1:	c9                   	leave
+  8019a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019a3:	49 89 c0             	mov    %rax,%r8
+  8019a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8019ab:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  8019b2:	00 00 00 
+  8019b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ba:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  8019c1:	00 00 00 
+  8019c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c9:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  8019d0:	00 00 00 
+  8019d3:	41 ff d1             	call   *%r9
+
+00000000008019d6 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8019d6:	55                   	push   %rbp
+  8019d7:	48 89 e5             	mov    %rsp,%rbp
+  8019da:	53                   	push   %rbx
+  8019db:	48 83 ec 08          	sub    $0x8,%rsp
+  8019df:	48 89 f1             	mov    %rsi,%rcx
+  8019e2:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8019e5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019ff:	48 85 c0             	test   %rax,%rax
+  801a02:	7f 06                	jg     801a0a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801a04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a0a:	49 89 c0             	mov    %rax,%r8
+  801a0d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a12:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801a19:	00 00 00 
+  801a1c:	be 26 00 00 00       	mov    $0x26,%esi
+  801a21:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801a28:	00 00 00 
+  801a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a30:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801a37:	00 00 00 
+  801a3a:	41 ff d1             	call   *%r9
+
+0000000000801a3d <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801a3d:	55                   	push   %rbp
+  801a3e:	48 89 e5             	mov    %rsp,%rbp
+  801a41:	53                   	push   %rbx
+  801a42:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a45:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a59:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a64:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801a66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+
+0000000000801a6c <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801a6c:	55                   	push   %rbp
+  801a6d:	48 89 e5             	mov    %rsp,%rbp
+  801a70:	53                   	push   %rbx
+  801a71:	48 83 ec 08          	sub    $0x8,%rsp
+  801a75:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801a78:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a85:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a95:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a97:	48 85 c0             	test   %rax,%rax
+  801a9a:	7f 06                	jg     801aa2 <sys_env_set_tls+0x36>
+}
+  801a9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa0:	c9                   	leave
+  801aa1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aa2:	49 89 c0             	mov    %rax,%r8
+  801aa5:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801aaa:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801ab1:	00 00 00 
+  801ab4:	be 26 00 00 00       	mov    $0x26,%esi
+  801ab9:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801ac0:	00 00 00 
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801acf:	00 00 00 
+  801ad2:	41 ff d1             	call   *%r9
+
+0000000000801ad5 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	53                   	push   %rbx
+  801ada:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801ade:	48 63 ce             	movslq %esi,%rcx
+  801ae1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af3:	be 00 00 00 00       	mov    $0x0,%esi
+  801af8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801afe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b00:	48 85 c0             	test   %rax,%rax
+  801b03:	7f 06                	jg     801b0b <sys_env_set_status+0x36>
+}
+  801b05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b09:	c9                   	leave
+  801b0a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b0b:	49 89 c0             	mov    %rax,%r8
+  801b0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801b13:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801b1a:	00 00 00 
+  801b1d:	be 26 00 00 00       	mov    $0x26,%esi
+  801b22:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801b29:	00 00 00 
+  801b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b31:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801b38:	00 00 00 
+  801b3b:	41 ff d1             	call   *%r9
+
+0000000000801b3e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801b3e:	55                   	push   %rbp
+  801b3f:	48 89 e5             	mov    %rsp,%rbp
+  801b42:	53                   	push   %rbx
+  801b43:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801b47:	48 63 da             	movslq %edx,%rbx
+  801b4a:	48 63 ce             	movslq %esi,%rcx
+  801b4d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b50:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b55:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b65:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b67:	48 85 c0             	test   %rax,%rax
+  801b6a:	7f 06                	jg     801b72 <sys_env_set_priority+0x34>
+}
+  801b6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b70:	c9                   	leave
+  801b71:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b72:	49 89 c0             	mov    %rax,%r8
+  801b75:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801b7a:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801b81:	00 00 00 
+  801b84:	be 26 00 00 00       	mov    $0x26,%esi
+  801b89:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801b90:	00 00 00 
+  801b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b98:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801b9f:	00 00 00 
+  801ba2:	41 ff d1             	call   *%r9
+
+0000000000801ba5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801ba5:	55                   	push   %rbp
+  801ba6:	48 89 e5             	mov    %rsp,%rbp
+  801ba9:	53                   	push   %rbx
+  801baa:	48 83 ec 08          	sub    $0x8,%rsp
+  801bae:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801bb1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bb4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bc3:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bd0:	48 85 c0             	test   %rax,%rax
+  801bd3:	7f 06                	jg     801bdb <sys_env_set_trapframe+0x36>
+}
+  801bd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bdb:	49 89 c0             	mov    %rax,%r8
+  801bde:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801be3:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801bea:	00 00 00 
+  801bed:	be 26 00 00 00       	mov    $0x26,%esi
+  801bf2:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801bf9:	00 00 00 
+  801bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c01:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801c08:	00 00 00 
+  801c0b:	41 ff d1             	call   *%r9
+
+0000000000801c0e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801c0e:	55                   	push   %rbp
+  801c0f:	48 89 e5             	mov    %rsp,%rbp
+  801c12:	53                   	push   %rbx
+  801c13:	48 83 ec 08          	sub    $0x8,%rsp
+  801c17:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801c1a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801c31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c37:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c39:	48 85 c0             	test   %rax,%rax
+  801c3c:	7f 06                	jg     801c44 <sys_env_set_pgfault_upcall+0x36>
+}
+  801c3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c44:	49 89 c0             	mov    %rax,%r8
+  801c47:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801c4c:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801c53:	00 00 00 
+  801c56:	be 26 00 00 00       	mov    $0x26,%esi
+  801c5b:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801c62:	00 00 00 
+  801c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6a:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801c71:	00 00 00 
+  801c74:	41 ff d1             	call   *%r9
+
+0000000000801c77 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801c77:	55                   	push   %rbp
+  801c78:	48 89 e5             	mov    %rsp,%rbp
+  801c7b:	53                   	push   %rbx
+  801c7c:	89 f8                	mov    %edi,%eax
+  801c7e:	49 89 f1             	mov    %rsi,%r9
+  801c81:	48 89 d3             	mov    %rdx,%rbx
+  801c84:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801c87:	49 63 f0             	movslq %r8d,%rsi
+  801c8a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c8d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c92:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c9b:	cd 30                	int    $0x30
+}
+  801c9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	41 55                	push   %r13
+  801ca9:	41 54                	push   %r12
+  801cab:	53                   	push   %rbx
+  801cac:	89 f8                	mov    %edi,%eax
+  801cae:	49 89 f2             	mov    %rsi,%r10
+  801cb1:	48 89 d3             	mov    %rdx,%rbx
+  801cb4:	48 89 cf             	mov    %rcx,%rdi
+  801cb7:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801cba:	49 63 f0             	movslq %r8d,%rsi
+  801cbd:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801cc0:	4d 85 c9             	test   %r9,%r9
+  801cc3:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801cca:	00 00 00 
+  801ccd:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801cd1:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cd6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801cd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801cdf:	4d 8b 0b             	mov    (%r11),%r9
+  801ce2:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ce6:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801cea:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801cee:	cd 30                	int    $0x30
+}
+  801cf0:	5b                   	pop    %rbx
+  801cf1:	41 5c                	pop    %r12
+  801cf3:	41 5d                	pop    %r13
+  801cf5:	5d                   	pop    %rbp
+  801cf6:	c3                   	ret
+
+0000000000801cf7 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801cf7:	55                   	push   %rbp
+  801cf8:	48 89 e5             	mov    %rsp,%rbp
+  801cfb:	53                   	push   %rbx
+  801cfc:	48 89 fa             	mov    %rdi,%rdx
+  801cff:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d02:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d11:	be 00 00 00 00       	mov    $0x0,%esi
+  801d16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d1c:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801d1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d22:	c9                   	leave
+  801d23:	c3                   	ret
+
+0000000000801d24 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801d24:	55                   	push   %rbp
+  801d25:	48 89 e5             	mov    %rsp,%rbp
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 08          	sub    $0x8,%rsp
+  801d2d:	48 89 fa             	mov    %rdi,%rdx
+  801d30:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d33:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d42:	be 00 00 00 00       	mov    $0x0,%esi
+  801d47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d4d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d4f:	48 85 c0             	test   %rax,%rax
+  801d52:	7f 06                	jg     801d5a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801d54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d5a:	49 89 c0             	mov    %rax,%r8
+  801d5d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801d62:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801d69:	00 00 00 
+  801d6c:	be 26 00 00 00       	mov    $0x26,%esi
+  801d71:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801d78:	00 00 00 
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d80:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801d87:	00 00 00 
+  801d8a:	41 ff d1             	call   *%r9
+
+0000000000801d8d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	41 55                	push   %r13
+  801d93:	41 54                	push   %r12
+  801d95:	53                   	push   %rbx
+  801d96:	89 f8                	mov    %edi,%eax
+  801d98:	49 89 f2             	mov    %rsi,%r10
+  801d9b:	48 89 d3             	mov    %rdx,%rbx
+  801d9e:	48 89 cf             	mov    %rcx,%rdi
+  801da1:	44 89 c6             	mov    %r8d,%esi
+  801da4:	4d 89 c8             	mov    %r9,%r8
+  801da7:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801dab:	48 63 f6             	movslq %esi,%rsi
+  801dae:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801db1:	4d 85 db             	test   %r11,%r11
+  801db4:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801dbb:	00 00 00 
+  801dbe:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801dc2:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc7:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801dca:	4d 8b 0b             	mov    (%r11),%r9
+  801dcd:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801dd1:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801dd5:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801dd9:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ddb:	5b                   	pop    %rbx
+  801ddc:	41 5c                	pop    %r12
+  801dde:	41 5d                	pop    %r13
+  801de0:	5d                   	pop    %rbp
+  801de1:	c3                   	ret
+
+0000000000801de2 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801de2:	55                   	push   %rbp
+  801de3:	48 89 e5             	mov    %rsp,%rbp
+  801de6:	41 55                	push   %r13
+  801de8:	41 54                	push   %r12
+  801dea:	53                   	push   %rbx
+  801deb:	89 f8                	mov    %edi,%eax
+  801ded:	49 89 f2             	mov    %rsi,%r10
+  801df0:	48 89 d3             	mov    %rdx,%rbx
+  801df3:	48 89 cf             	mov    %rcx,%rdi
+  801df6:	44 89 c6             	mov    %r8d,%esi
+  801df9:	4d 89 c8             	mov    %r9,%r8
+  801dfc:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801e00:	48 63 f6             	movslq %esi,%rsi
+  801e03:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801e06:	4d 85 db             	test   %r11,%r11
+  801e09:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  801e10:	00 00 00 
+  801e13:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801e17:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e1c:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801e1f:	4d 8b 0b             	mov    (%r11),%r9
+  801e22:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801e26:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801e2a:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801e2e:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801e30:	5b                   	pop    %rbx
+  801e31:	41 5c                	pop    %r12
+  801e33:	41 5d                	pop    %r13
+  801e35:	5d                   	pop    %rbp
+  801e36:	c3                   	ret
+
+0000000000801e37 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e40:	48 89 f1             	mov    %rsi,%rcx
+  801e43:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e46:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e4b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e53:	be 00 00 00 00       	mov    $0x0,%esi
+  801e58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e5e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e60:	48 85 c0             	test   %rax,%rax
+  801e63:	7f 06                	jg     801e6b <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801e65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e6b:	49 89 c0             	mov    %rax,%r8
+  801e6e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801e73:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  801e7a:	00 00 00 
+  801e7d:	be 26 00 00 00       	mov    $0x26,%esi
+  801e82:	48 bf 57 57 80 00 00 	movabs $0x805757,%rdi
+  801e89:	00 00 00 
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	49 b9 7d 08 80 00 00 	movabs $0x80087d,%r9
+  801e98:	00 00 00 
+  801e9b:	41 ff d1             	call   *%r9
+
+0000000000801e9e <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801e9e:	55                   	push   %rbp
+  801e9f:	48 89 e5             	mov    %rsp,%rbp
+  801ea2:	53                   	push   %rbx
+  801ea3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ea6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801eab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eba:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ec5:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801ec7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ecb:	c9                   	leave
+  801ecc:	c3                   	ret
+
+0000000000801ecd <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801ecd:	55                   	push   %rbp
+  801ece:	48 89 e5             	mov    %rsp,%rbp
+  801ed1:	53                   	push   %rbx
+  801ed2:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ed5:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed7:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801edc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  801eeb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ef1:	cd 30                	int    $0x30
+}
+  801ef3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+
+0000000000801ef9 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ef9:	55                   	push   %rbp
+  801efa:	48 89 e5             	mov    %rsp,%rbp
+  801efd:	53                   	push   %rbx
+  801efe:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801f01:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f04:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f13:	be 00 00 00 00       	mov    $0x0,%esi
+  801f18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f1e:	cd 30                	int    $0x30
+}
+  801f20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f24:	c9                   	leave
+  801f25:	c3                   	ret
+
+0000000000801f26 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801f26:	55                   	push   %rbp
+  801f27:	48 89 e5             	mov    %rsp,%rbp
+  801f2a:	53                   	push   %rbx
+  801f2b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801f2e:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801f30:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f35:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f48:	cd 30                	int    $0x30
+}
+  801f4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f4e:	c9                   	leave
+  801f4f:	c3                   	ret
+
+0000000000801f50 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801f50:	55                   	push   %rbp
+  801f51:	48 89 e5             	mov    %rsp,%rbp
+  801f54:	53                   	push   %rbx
+  801f55:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801f58:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f5b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f65:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f6a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f75:	cd 30                	int    $0x30
+}
+  801f77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f7b:	c9                   	leave
+  801f7c:	c3                   	ret
+
+0000000000801f7d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f82:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fa6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801fa8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fac:	c9                   	leave
+  801fad:	c3                   	ret
+
+0000000000801fae <sys_monitor>:
+
+int sys_monitor(void) {
+  801fae:	55                   	push   %rbp
+  801faf:	48 89 e5             	mov    %rsp,%rbp
+  801fb2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801fb3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fd7:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801fd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fdd:	c9                   	leave
+  801fde:	c3                   	ret
+
+0000000000801fdf <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801fdf:	55                   	push   %rbp
+  801fe0:	48 89 e5             	mov    %rsp,%rbp
+  801fe3:	41 55                	push   %r13
+  801fe5:	41 54                	push   %r12
+  801fe7:	53                   	push   %rbx
+  801fe8:	48 83 ec 08          	sub    $0x8,%rsp
+  801fec:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801fef:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801ff2:	48 b8 9b 40 80 00 00 	movabs $0x80409b,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+  801ffe:	41 89 c5             	mov    %eax,%r13d
+  802001:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  802005:	a8 40                	test   $0x40,%al
+  802007:	75 31                	jne    80203a <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  802009:	a8 02                	test   $0x2,%al
+  80200b:	74 5f                	je     80206c <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  80200d:	45 89 e9             	mov    %r13d,%r9d
+  802010:	41 83 c9 40          	or     $0x40,%r9d
+  802014:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80201a:	48 89 d9             	mov    %rbx,%rcx
+  80201d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802022:	48 89 de             	mov    %rbx,%rsi
+  802025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80202a:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 27                	js     802061 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  80203a:	45 89 e9             	mov    %r13d,%r9d
+  80203d:	41 83 c9 40          	or     $0x40,%r9d
+  802041:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802047:	48 89 d9             	mov    %rbx,%rcx
+  80204a:	44 89 e2             	mov    %r12d,%edx
+  80204d:	48 89 de             	mov    %rbx,%rsi
+  802050:	bf 00 00 00 00       	mov    $0x0,%edi
+  802055:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+}
+  802061:	48 83 c4 08          	add    $0x8,%rsp
+  802065:	5b                   	pop    %rbx
+  802066:	41 5c                	pop    %r12
+  802068:	41 5d                	pop    %r13
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  80206c:	83 e0 01             	and    $0x1,%eax
+  80206f:	83 c8 06             	or     $0x6,%eax
+  802072:	41 89 c1             	mov    %eax,%r9d
+  802075:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80207b:	48 89 d9             	mov    %rbx,%rcx
+  80207e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802083:	48 89 de             	mov    %rbx,%rsi
+  802086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80208b:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  802097:	85 c0                	test   %eax,%eax
+  802099:	0f 85 6e ff ff ff    	jne    80200d <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  80209f:	48 89 df             	mov    %rbx,%rdi
+  8020a2:	48 b8 9b 40 80 00 00 	movabs $0x80409b,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	83 e0 5f             	and    $0x5f,%eax
+  8020b1:	41 89 c5             	mov    %eax,%r13d
+  8020b4:	e9 54 ff ff ff       	jmp    80200d <sfork_page+0x2e>
+
+00000000008020b9 <fork>:
+fork(void) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	41 54                	push   %r12
+  8020bf:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8020c0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020c5:	cd 30                	int    $0x30
+  8020c7:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	0f 88 81 00 00 00    	js     802153 <fork+0x9a>
+    if (envid == CURENVID) {
+  8020d2:	0f 84 83 00 00 00    	je     80215b <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8020d8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8020de:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8020e5:	00 00 00 
+  8020e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ed:	89 c2                	mov    %eax,%edx
+  8020ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f9:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	85 c0                	test   %eax,%eax
+  802107:	0f 85 82 00 00 00    	jne    80218f <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  80210d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802114:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802116:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80211a:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  802121:	44 89 e7             	mov    %r12d,%edi
+  802124:	48 b8 0e 1c 80 00 00 	movabs $0x801c0e,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+  802130:	85 c0                	test   %eax,%eax
+  802132:	75 63                	jne    802197 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  802134:	be 02 00 00 00       	mov    $0x2,%esi
+  802139:	44 89 e7             	mov    %r12d,%edi
+  80213c:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  802143:	00 00 00 
+  802146:	ff d0                	call   *%rax
+        return -1;
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80214f:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  802153:	44 89 e0             	mov    %r12d,%eax
+  802156:	5b                   	pop    %rbx
+  802157:	41 5c                	pop    %r12
+  802159:	5d                   	pop    %rbp
+  80215a:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80215b:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  80216e:	00 00 
+  802170:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802175:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80217c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802183:	00 00 00 
+  802186:	48 01 c8             	add    %rcx,%rax
+  802189:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  80218d:	eb c4                	jmp    802153 <fork+0x9a>
+        return -1;
+  80218f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802195:	eb bc                	jmp    802153 <fork+0x9a>
+  802197:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80219d:	eb b4                	jmp    802153 <fork+0x9a>
+
+000000000080219f <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	53                   	push   %rbx
+  8021a4:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  8021a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021ad:	cd 30                	int    $0x30
+  8021af:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  8021b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	78 40                	js     8021f8 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  8021b8:	74 46                	je     802200 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  8021ba:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  8021be:	48 ba df 1f 80 00 00 	movabs $0x801fdf,%rdx
+  8021c5:	00 00 00 
+  8021c8:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  8021cf:	00 00 00 
+  8021d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d7:	48 b8 0f 41 80 00 00 	movabs $0x80410f,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	79 4b                	jns    802234 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  8021e9:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8021ec:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8021f3:	00 00 00 
+  8021f6:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021fe:	c9                   	leave
+  8021ff:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802200:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  80220c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  802213:	00 00 
+  802215:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80221a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802221:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802228:	00 00 00 
+  80222b:	48 01 c8             	add    %rcx,%rax
+  80222e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  802232:	eb c4                	jmp    8021f8 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  802234:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80223a:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  802240:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  802247:	00 00 00 
+  80224a:	48 89 f1             	mov    %rsi,%rcx
+  80224d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802250:	bf 00 00 00 00       	mov    $0x0,%edi
+  802255:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  802263:	85 c0                	test   %eax,%eax
+  802265:	78 82                	js     8021e9 <sfork+0x4a>
+  802267:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80226e:	00 00 
+  802270:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802274:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  80227b:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80227e:	48 b8 0e 1c 80 00 00 	movabs $0x801c0e,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+  80228a:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	0f 88 55 ff ff ff    	js     8021e9 <sfork+0x4a>
+  802294:	be 02 00 00 00       	mov    $0x2,%esi
+  802299:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80229c:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+  8022a8:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	0f 88 37 ff ff ff    	js     8021e9 <sfork+0x4a>
+    return envid;
+  8022b2:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  8022b5:	e9 3e ff ff ff       	jmp    8021f8 <sfork+0x59>
+
+00000000008022ba <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022ba:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022c1:	ff ff ff 
+  8022c4:	48 01 f8             	add    %rdi,%rax
+  8022c7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022cb:	c3                   	ret
+
+00000000008022cc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022cc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022d3:	ff ff ff 
+  8022d6:	48 01 f8             	add    %rdi,%rax
+  8022d9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022dd:	48 c1 e0 12          	shl    $0x12,%rax
+  8022e1:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8022e6:	48 01 d0             	add    %rdx,%rax
+}
+  8022e9:	c3                   	ret
+
+00000000008022ea <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022ea:	55                   	push   %rbp
+  8022eb:	48 89 e5             	mov    %rsp,%rbp
+  8022ee:	41 57                	push   %r15
+  8022f0:	41 56                	push   %r14
+  8022f2:	41 55                	push   %r13
+  8022f4:	41 54                	push   %r12
+  8022f6:	53                   	push   %rbx
+  8022f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fb:	49 89 ff             	mov    %rdi,%r15
+  8022fe:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802303:	49 bd 9b 40 80 00 00 	movabs $0x80409b,%r13
+  80230a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80230d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802313:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802316:	48 89 df             	mov    %rbx,%rdi
+  802319:	41 ff d5             	call   *%r13
+  80231c:	83 e0 04             	and    $0x4,%eax
+  80231f:	74 17                	je     802338 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802321:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802328:	4c 39 f3             	cmp    %r14,%rbx
+  80232b:	75 e6                	jne    802313 <fd_alloc+0x29>
+  80232d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802333:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802338:	4d 89 27             	mov    %r12,(%r15)
+}
+  80233b:	48 83 c4 08          	add    $0x8,%rsp
+  80233f:	5b                   	pop    %rbx
+  802340:	41 5c                	pop    %r12
+  802342:	41 5d                	pop    %r13
+  802344:	41 5e                	pop    %r14
+  802346:	41 5f                	pop    %r15
+  802348:	5d                   	pop    %rbp
+  802349:	c3                   	ret
+
+000000000080234a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80234a:	83 ff 1f             	cmp    $0x1f,%edi
+  80234d:	77 39                	ja     802388 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80234f:	55                   	push   %rbp
+  802350:	48 89 e5             	mov    %rsp,%rbp
+  802353:	41 54                	push   %r12
+  802355:	53                   	push   %rbx
+  802356:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802359:	48 63 df             	movslq %edi,%rbx
+  80235c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802363:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802367:	48 89 df             	mov    %rbx,%rdi
+  80236a:	48 b8 9b 40 80 00 00 	movabs $0x80409b,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+  802376:	a8 04                	test   $0x4,%al
+  802378:	74 14                	je     80238e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80237a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802383:	5b                   	pop    %rbx
+  802384:	41 5c                	pop    %r12
+  802386:	5d                   	pop    %rbp
+  802387:	c3                   	ret
+        return -E_INVAL;
+  802388:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80238d:	c3                   	ret
+        return -E_INVAL;
+  80238e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802393:	eb ee                	jmp    802383 <fd_lookup+0x39>
+
+0000000000802395 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	41 54                	push   %r12
+  80239b:	53                   	push   %rbx
+  80239c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80239f:	48 b8 20 58 80 00 00 	movabs $0x805820,%rax
+  8023a6:	00 00 00 
+  8023a9:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023b0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023b3:	39 3b                	cmp    %edi,(%rbx)
+  8023b5:	74 4a                	je     802401 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023b7:	48 83 c0 08          	add    $0x8,%rax
+  8023bb:	48 8b 18             	mov    (%rax),%rbx
+  8023be:	48 85 db             	test   %rbx,%rbx
+  8023c1:	75 f0                	jne    8023b3 <dev_lookup+0x1e>
+  8023c3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023ca:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023cc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023d6:	89 fa                	mov    %edi,%edx
+  8023d8:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  8023df:	00 00 00 
+  8023e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e7:	48 b9 cd 09 80 00 00 	movabs $0x8009cd,%rcx
+  8023ee:	00 00 00 
+  8023f1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023f8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023fc:	5b                   	pop    %rbx
+  8023fd:	41 5c                	pop    %r12
+  8023ff:	5d                   	pop    %rbp
+  802400:	c3                   	ret
+            return 0;
+  802401:	b8 00 00 00 00       	mov    $0x0,%eax
+  802406:	eb f0                	jmp    8023f8 <dev_lookup+0x63>
+
+0000000000802408 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802408:	55                   	push   %rbp
+  802409:	48 89 e5             	mov    %rsp,%rbp
+  80240c:	41 55                	push   %r13
+  80240e:	41 54                	push   %r12
+  802410:	53                   	push   %rbx
+  802411:	48 83 ec 18          	sub    $0x18,%rsp
+  802415:	48 89 fb             	mov    %rdi,%rbx
+  802418:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80241b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802422:	ff ff ff 
+  802425:	48 01 df             	add    %rbx,%rdi
+  802428:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80242c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802430:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	41 89 c5             	mov    %eax,%r13d
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 06                	js     802449 <fd_close+0x41>
+  802443:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802447:	74 1a                	je     802463 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802449:	45 84 e4             	test   %r12b,%r12b
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802451:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802455:	44 89 e8             	mov    %r13d,%eax
+  802458:	48 83 c4 18          	add    $0x18,%rsp
+  80245c:	5b                   	pop    %rbx
+  80245d:	41 5c                	pop    %r12
+  80245f:	41 5d                	pop    %r13
+  802461:	5d                   	pop    %rbp
+  802462:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802463:	8b 3b                	mov    (%rbx),%edi
+  802465:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802469:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+  802475:	41 89 c5             	mov    %eax,%r13d
+  802478:	85 c0                	test   %eax,%eax
+  80247a:	78 1b                	js     802497 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80247c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802480:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802484:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80248a:	48 85 c0             	test   %rax,%rax
+  80248d:	74 08                	je     802497 <fd_close+0x8f>
+  80248f:	48 89 df             	mov    %rbx,%rdi
+  802492:	ff d0                	call   *%rax
+  802494:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80249c:	48 89 de             	mov    %rbx,%rsi
+  80249f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a4:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+    return res;
+  8024b0:	eb a3                	jmp    802455 <fd_close+0x4d>
+
+00000000008024b2 <close>:
+
+int
+close(int fdnum) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024be:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 15                	js     8024e3 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d7:	48 b8 08 24 80 00 00 	movabs $0x802408,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+00000000008024e5 <close_all>:
+
+void
+close_all(void) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	41 54                	push   %r12
+  8024eb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f1:	49 bc b2 24 80 00 00 	movabs $0x8024b2,%r12
+  8024f8:	00 00 00 
+  8024fb:	89 df                	mov    %ebx,%edi
+  8024fd:	41 ff d4             	call   *%r12
+  802500:	83 c3 01             	add    $0x1,%ebx
+  802503:	83 fb 20             	cmp    $0x20,%ebx
+  802506:	75 f3                	jne    8024fb <close_all+0x16>
+}
+  802508:	5b                   	pop    %rbx
+  802509:	41 5c                	pop    %r12
+  80250b:	5d                   	pop    %rbp
+  80250c:	c3                   	ret
+
+000000000080250d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80250d:	55                   	push   %rbp
+  80250e:	48 89 e5             	mov    %rsp,%rbp
+  802511:	41 57                	push   %r15
+  802513:	41 56                	push   %r14
+  802515:	41 55                	push   %r13
+  802517:	41 54                	push   %r12
+  802519:	53                   	push   %rbx
+  80251a:	48 83 ec 38          	sub    $0x38,%rsp
+  80251e:	41 89 f7             	mov    %esi,%r15d
+  802521:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802524:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802528:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+  802534:	89 c3                	mov    %eax,%ebx
+  802536:	85 c0                	test   %eax,%eax
+  802538:	0f 88 ec 00 00 00    	js     80262a <dup+0x11d>
+    close(newfdnum);
+  80253e:	44 89 ff             	mov    %r15d,%edi
+  802541:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80254d:	49 63 c7             	movslq %r15d,%rax
+  802550:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802556:	48 c1 e0 0c          	shl    $0xc,%rax
+  80255a:	49 89 c6             	mov    %rax,%r14
+  80255d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802561:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802565:	4c 89 ff             	mov    %r15,%rdi
+  802568:	48 bb cc 22 80 00 00 	movabs $0x8022cc,%rbx
+  80256f:	00 00 00 
+  802572:	ff d3                	call   *%rbx
+  802574:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802577:	4c 89 f7             	mov    %r14,%rdi
+  80257a:	ff d3                	call   *%rbx
+  80257c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802580:	4c 89 e7             	mov    %r12,%rdi
+  802583:	48 b8 9b 40 80 00 00 	movabs $0x80409b,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+  80258f:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802592:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802597:	49 be 9b 40 80 00 00 	movabs $0x80409b,%r14
+  80259e:	00 00 00 
+  8025a1:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8025a5:	41 ff d6             	call   *%r14
+  8025a8:	44 39 e8             	cmp    %r13d,%eax
+  8025ab:	75 10                	jne    8025bd <dup+0xb0>
+  8025ad:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025b4:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025bb:	75 e4                	jne    8025a1 <dup+0x94>
+    if (prot & PROT_R) {
+  8025bd:	41 f6 c5 04          	test   $0x4,%r13b
+  8025c1:	74 29                	je     8025ec <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025c3:	45 89 e9             	mov    %r13d,%r9d
+  8025c6:	49 89 d8             	mov    %rbx,%r8
+  8025c9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d2:	4c 89 e6             	mov    %r12,%rsi
+  8025d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025da:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	89 c3                	mov    %eax,%ebx
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	78 4f                	js     80263b <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8025ec:	4c 89 ff             	mov    %r15,%rdi
+  8025ef:	48 b8 9b 40 80 00 00 	movabs $0x80409b,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025fe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802604:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260d:	4c 89 fe             	mov    %r15,%rsi
+  802610:	bf 00 00 00 00       	mov    $0x0,%edi
+  802615:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	89 c3                	mov    %eax,%ebx
+  802623:	85 c0                	test   %eax,%eax
+  802625:	78 14                	js     80263b <dup+0x12e>
+
+    return newfdnum;
+  802627:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  80262a:	89 d8                	mov    %ebx,%eax
+  80262c:	48 83 c4 38          	add    $0x38,%rsp
+  802630:	5b                   	pop    %rbx
+  802631:	41 5c                	pop    %r12
+  802633:	41 5d                	pop    %r13
+  802635:	41 5e                	pop    %r14
+  802637:	41 5f                	pop    %r15
+  802639:	5d                   	pop    %rbp
+  80263a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80263b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802640:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802644:	bf 00 00 00 00       	mov    $0x0,%edi
+  802649:	49 bc d6 19 80 00 00 	movabs $0x8019d6,%r12
+  802650:	00 00 00 
+  802653:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802656:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80265b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80265f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802664:	41 ff d4             	call   *%r12
+    return res;
+  802667:	eb c1                	jmp    80262a <dup+0x11d>
+
+0000000000802669 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	41 56                	push   %r14
+  80266f:	41 55                	push   %r13
+  802671:	41 54                	push   %r12
+  802673:	53                   	push   %rbx
+  802674:	48 83 ec 10          	sub    $0x10,%rsp
+  802678:	89 fb                	mov    %edi,%ebx
+  80267a:	49 89 f4             	mov    %rsi,%r12
+  80267d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802680:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802684:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  80268b:	00 00 00 
+  80268e:	ff d0                	call   *%rax
+  802690:	85 c0                	test   %eax,%eax
+  802692:	78 4c                	js     8026e0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802694:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802698:	41 8b 3e             	mov    (%r14),%edi
+  80269b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80269f:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	78 35                	js     8026e4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026af:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026b3:	83 e0 03             	and    $0x3,%eax
+  8026b6:	83 f8 01             	cmp    $0x1,%eax
+  8026b9:	74 2d                	je     8026e8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026bf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026c3:	48 85 c0             	test   %rax,%rax
+  8026c6:	74 59                	je     802721 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026c8:	4c 89 ea             	mov    %r13,%rdx
+  8026cb:	4c 89 e6             	mov    %r12,%rsi
+  8026ce:	4c 89 f7             	mov    %r14,%rdi
+  8026d1:	ff d0                	call   *%rax
+}
+  8026d3:	48 83 c4 10          	add    $0x10,%rsp
+  8026d7:	5b                   	pop    %rbx
+  8026d8:	41 5c                	pop    %r12
+  8026da:	41 5d                	pop    %r13
+  8026dc:	41 5e                	pop    %r14
+  8026de:	5d                   	pop    %rbp
+  8026df:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026e0:	48 98                	cltq
+  8026e2:	eb ef                	jmp    8026d3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026e4:	48 98                	cltq
+  8026e6:	eb eb                	jmp    8026d3 <read+0x6a>
+  8026e8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026ef:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026fb:	89 da                	mov    %ebx,%edx
+  8026fd:	48 bf e1 57 80 00 00 	movabs $0x8057e1,%rdi
+  802704:	00 00 00 
+  802707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270c:	48 b9 cd 09 80 00 00 	movabs $0x8009cd,%rcx
+  802713:	00 00 00 
+  802716:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802718:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80271f:	eb b2                	jmp    8026d3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802721:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802728:	eb a9                	jmp    8026d3 <read+0x6a>
+
+000000000080272a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80272a:	55                   	push   %rbp
+  80272b:	48 89 e5             	mov    %rsp,%rbp
+  80272e:	41 57                	push   %r15
+  802730:	41 56                	push   %r14
+  802732:	41 55                	push   %r13
+  802734:	41 54                	push   %r12
+  802736:	53                   	push   %rbx
+  802737:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80273b:	48 85 d2             	test   %rdx,%rdx
+  80273e:	74 54                	je     802794 <readn+0x6a>
+  802740:	41 89 fd             	mov    %edi,%r13d
+  802743:	49 89 f6             	mov    %rsi,%r14
+  802746:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802749:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80274e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802753:	49 bf 69 26 80 00 00 	movabs $0x802669,%r15
+  80275a:	00 00 00 
+  80275d:	4c 89 e2             	mov    %r12,%rdx
+  802760:	48 29 f2             	sub    %rsi,%rdx
+  802763:	4c 01 f6             	add    %r14,%rsi
+  802766:	44 89 ef             	mov    %r13d,%edi
+  802769:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 20                	js     802790 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802770:	01 c3                	add    %eax,%ebx
+  802772:	85 c0                	test   %eax,%eax
+  802774:	74 08                	je     80277e <readn+0x54>
+  802776:	48 63 f3             	movslq %ebx,%rsi
+  802779:	4c 39 e6             	cmp    %r12,%rsi
+  80277c:	72 df                	jb     80275d <readn+0x33>
+    }
+    return res;
+  80277e:	48 63 c3             	movslq %ebx,%rax
+}
+  802781:	48 83 c4 08          	add    $0x8,%rsp
+  802785:	5b                   	pop    %rbx
+  802786:	41 5c                	pop    %r12
+  802788:	41 5d                	pop    %r13
+  80278a:	41 5e                	pop    %r14
+  80278c:	41 5f                	pop    %r15
+  80278e:	5d                   	pop    %rbp
+  80278f:	c3                   	ret
+        if (inc < 0) return inc;
+  802790:	48 98                	cltq
+  802792:	eb ed                	jmp    802781 <readn+0x57>
+    int inc = 1, res = 0;
+  802794:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802799:	eb e3                	jmp    80277e <readn+0x54>
+
+000000000080279b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80279b:	55                   	push   %rbp
+  80279c:	48 89 e5             	mov    %rsp,%rbp
+  80279f:	41 56                	push   %r14
+  8027a1:	41 55                	push   %r13
+  8027a3:	41 54                	push   %r12
+  8027a5:	53                   	push   %rbx
+  8027a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8027aa:	89 fb                	mov    %edi,%ebx
+  8027ac:	49 89 f4             	mov    %rsi,%r12
+  8027af:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027b2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027b6:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 47                	js     80280d <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027c6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027ca:	41 8b 3e             	mov    (%r14),%edi
+  8027cd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027d1:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8027d8:	00 00 00 
+  8027db:	ff d0                	call   *%rax
+  8027dd:	85 c0                	test   %eax,%eax
+  8027df:	78 30                	js     802811 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027e1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027e6:	74 2d                	je     802815 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ec:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027f0:	48 85 c0             	test   %rax,%rax
+  8027f3:	74 59                	je     80284e <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8027f5:	4c 89 ea             	mov    %r13,%rdx
+  8027f8:	4c 89 e6             	mov    %r12,%rsi
+  8027fb:	4c 89 f7             	mov    %r14,%rdi
+  8027fe:	ff d0                	call   *%rax
+}
+  802800:	48 83 c4 10          	add    $0x10,%rsp
+  802804:	5b                   	pop    %rbx
+  802805:	41 5c                	pop    %r12
+  802807:	41 5d                	pop    %r13
+  802809:	41 5e                	pop    %r14
+  80280b:	5d                   	pop    %rbp
+  80280c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80280d:	48 98                	cltq
+  80280f:	eb ef                	jmp    802800 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802811:	48 98                	cltq
+  802813:	eb eb                	jmp    802800 <write+0x65>
+  802815:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80281c:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80281e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802822:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802828:	89 da                	mov    %ebx,%edx
+  80282a:	48 bf fd 57 80 00 00 	movabs $0x8057fd,%rdi
+  802831:	00 00 00 
+  802834:	b8 00 00 00 00       	mov    $0x0,%eax
+  802839:	48 b9 cd 09 80 00 00 	movabs $0x8009cd,%rcx
+  802840:	00 00 00 
+  802843:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802845:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80284c:	eb b2                	jmp    802800 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80284e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802855:	eb a9                	jmp    802800 <write+0x65>
+
+0000000000802857 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802857:	55                   	push   %rbp
+  802858:	48 89 e5             	mov    %rsp,%rbp
+  80285b:	53                   	push   %rbx
+  80285c:	48 83 ec 18          	sub    $0x18,%rsp
+  802860:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802862:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802866:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+  802872:	85 c0                	test   %eax,%eax
+  802874:	78 0c                	js     802882 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80287d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802882:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+0000000000802888 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	41 55                	push   %r13
+  80288e:	41 54                	push   %r12
+  802890:	53                   	push   %rbx
+  802891:	48 83 ec 18          	sub    $0x18,%rsp
+  802895:	89 fb                	mov    %edi,%ebx
+  802897:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80289a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80289e:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 38                	js     8028e6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028ae:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028b2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028ba:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8028c1:	00 00 00 
+  8028c4:	ff d0                	call   *%rax
+  8028c6:	85 c0                	test   %eax,%eax
+  8028c8:	78 1c                	js     8028e6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028ca:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028cf:	74 20                	je     8028f1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028d5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028d9:	48 85 c0             	test   %rax,%rax
+  8028dc:	74 4a                	je     802928 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028de:	44 89 e6             	mov    %r12d,%esi
+  8028e1:	4c 89 ef             	mov    %r13,%rdi
+  8028e4:	ff d0                	call   *%rax
+}
+  8028e6:	48 83 c4 18          	add    $0x18,%rsp
+  8028ea:	5b                   	pop    %rbx
+  8028eb:	41 5c                	pop    %r12
+  8028ed:	41 5d                	pop    %r13
+  8028ef:	5d                   	pop    %rbp
+  8028f0:	c3                   	ret
+  8028f1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8028f8:	00 00 
+                thisenv->env_id, fdnum);
+  8028fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028fe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802904:	89 da                	mov    %ebx,%edx
+  802906:	48 bf c0 57 80 00 00 	movabs $0x8057c0,%rdi
+  80290d:	00 00 00 
+  802910:	b8 00 00 00 00       	mov    $0x0,%eax
+  802915:	48 b9 cd 09 80 00 00 	movabs $0x8009cd,%rcx
+  80291c:	00 00 00 
+  80291f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802921:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802926:	eb be                	jmp    8028e6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802928:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80292d:	eb b7                	jmp    8028e6 <ftruncate+0x5e>
+
+000000000080292f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80292f:	55                   	push   %rbp
+  802930:	48 89 e5             	mov    %rsp,%rbp
+  802933:	41 54                	push   %r12
+  802935:	53                   	push   %rbx
+  802936:	48 83 ec 10          	sub    $0x10,%rsp
+  80293a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80293d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802941:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 4e                	js     80299f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802951:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802955:	41 8b 3c 24          	mov    (%r12),%edi
+  802959:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80295d:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+  802969:	85 c0                	test   %eax,%eax
+  80296b:	78 32                	js     80299f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80296d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802971:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802976:	74 30                	je     8029a8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802978:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80297b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802982:	00 00 00 
+    stat->st_isdir = 0;
+  802985:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80298c:	00 00 00 
+    stat->st_dev = dev;
+  80298f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802996:	48 89 de             	mov    %rbx,%rsi
+  802999:	4c 89 e7             	mov    %r12,%rdi
+  80299c:	ff 50 28             	call   *0x28(%rax)
+}
+  80299f:	48 83 c4 10          	add    $0x10,%rsp
+  8029a3:	5b                   	pop    %rbx
+  8029a4:	41 5c                	pop    %r12
+  8029a6:	5d                   	pop    %rbp
+  8029a7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8029a8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8029ad:	eb f0                	jmp    80299f <fstat+0x70>
+
+00000000008029af <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	41 54                	push   %r12
+  8029b5:	53                   	push   %rbx
+  8029b6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029be:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+  8029ca:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	78 25                	js     8029f5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029d0:	4c 89 e6             	mov    %r12,%rsi
+  8029d3:	89 c7                	mov    %eax,%edi
+  8029d5:	48 b8 2f 29 80 00 00 	movabs $0x80292f,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029e4:	89 df                	mov    %ebx,%edi
+  8029e6:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8029ed:	00 00 00 
+  8029f0:	ff d0                	call   *%rax
+
+    return res;
+  8029f2:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029f5:	89 d8                	mov    %ebx,%eax
+  8029f7:	5b                   	pop    %rbx
+  8029f8:	41 5c                	pop    %r12
+  8029fa:	5d                   	pop    %rbp
+  8029fb:	c3                   	ret
+
+00000000008029fc <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029fc:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  802a03:	00 00 00 
+  802a06:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0b:	eb 0e                	jmp    802a1b <mmap_lookup+0x1f>
+  802a0d:	48 83 c2 01          	add    $0x1,%rdx
+  802a11:	48 83 c0 20          	add    $0x20,%rax
+  802a15:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a19:	74 2b                	je     802a46 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a1b:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a1f:	48 85 c9             	test   %rcx,%rcx
+  802a22:	74 e9                	je     802a0d <mmap_lookup+0x11>
+  802a24:	48 8b 30             	mov    (%rax),%rsi
+  802a27:	48 39 f7             	cmp    %rsi,%rdi
+  802a2a:	72 e1                	jb     802a0d <mmap_lookup+0x11>
+  802a2c:	48 01 f1             	add    %rsi,%rcx
+  802a2f:	48 39 cf             	cmp    %rcx,%rdi
+  802a32:	73 d9                	jae    802a0d <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a34:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a38:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  802a3f:	00 00 00 
+  802a42:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a45:	c3                   	ret
+    return NULL;
+  802a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4b:	c3                   	ret
+
+0000000000802a4c <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a4c:	55                   	push   %rbp
+  802a4d:	48 89 e5             	mov    %rsp,%rbp
+  802a50:	41 54                	push   %r12
+  802a52:	53                   	push   %rbx
+  802a53:	89 fb                	mov    %edi,%ebx
+  802a55:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a58:	48 b8 10 c0 80 00 00 	movabs $0x80c010,%rax
+  802a5f:	00 00 00 
+  802a62:	83 38 00             	cmpl   $0x0,(%rax)
+  802a65:	74 3d                	je     802aa4 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a67:	41 54                	push   %r12
+  802a69:	6a 00                	push   $0x0
+  802a6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a81:	89 de                	mov    %ebx,%esi
+  802a83:	48 b8 10 c0 80 00 00 	movabs $0x80c010,%rax
+  802a8a:	00 00 00 
+  802a8d:	8b 38                	mov    (%rax),%edi
+  802a8f:	48 b8 13 47 80 00 00 	movabs $0x804713,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+}
+  802a9b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a9f:	5b                   	pop    %rbx
+  802aa0:	41 5c                	pop    %r12
+  802aa2:	5d                   	pop    %rbp
+  802aa3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aa4:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aa9:	48 b8 7a 49 80 00 00 	movabs $0x80497a,%rax
+  802ab0:	00 00 00 
+  802ab3:	ff d0                	call   *%rax
+  802ab5:	a3 10 c0 80 00 00 00 	movabs %eax,0x80c010
+  802abc:	00 00 
+  802abe:	eb a7                	jmp    802a67 <fsipc_words+0x1b>
+
+0000000000802ac0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ac0:	55                   	push   %rbp
+  802ac1:	48 89 e5             	mov    %rsp,%rbp
+  802ac4:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802ac8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802acf:	00 
+  802ad0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ad7:	00 
+  802ad8:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802adc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ae0:	48 63 f6             	movslq %esi,%rsi
+  802ae3:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ae7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802aeb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802af0:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+}
+  802afc:	c9                   	leave
+  802afd:	c3                   	ret
+
+0000000000802afe <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+  802b02:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802b06:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b0d:	00 
+  802b0e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b15:	00 
+  802b16:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b1d:	00 
+  802b1e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b22:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b26:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b2a:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b2f:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+}
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+
+0000000000802b3d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b3d:	55                   	push   %rbp
+  802b3e:	48 89 e5             	mov    %rsp,%rbp
+  802b41:	41 54                	push   %r12
+  802b43:	53                   	push   %rbx
+  802b44:	89 fb                	mov    %edi,%ebx
+  802b46:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b49:	48 b8 0c c0 80 00 00 	movabs $0x80c00c,%rax
+  802b50:	00 00 00 
+  802b53:	83 38 00             	cmpl   $0x0,(%rax)
+  802b56:	74 3f                	je     802b97 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b58:	6a 00                	push   $0x0
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	4d 89 e1             	mov    %r12,%r9
+  802b5f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b65:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b6a:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  802b71:	00 00 00 
+  802b74:	89 de                	mov    %ebx,%esi
+  802b76:	48 b8 0c c0 80 00 00 	movabs $0x80c00c,%rax
+  802b7d:	00 00 00 
+  802b80:	8b 38                	mov    (%rax),%edi
+  802b82:	48 b8 13 47 80 00 00 	movabs $0x804713,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+}
+  802b8e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b92:	5b                   	pop    %rbx
+  802b93:	41 5c                	pop    %r12
+  802b95:	5d                   	pop    %rbp
+  802b96:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b97:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b9c:	48 b8 7a 49 80 00 00 	movabs $0x80497a,%rax
+  802ba3:	00 00 00 
+  802ba6:	ff d0                	call   *%rax
+  802ba8:	a3 0c c0 80 00 00 00 	movabs %eax,0x80c00c
+  802baf:	00 00 
+  802bb1:	eb a5                	jmp    802b58 <fsipc+0x1b>
+
+0000000000802bb3 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802bb3:	55                   	push   %rbp
+  802bb4:	48 89 e5             	mov    %rsp,%rbp
+  802bb7:	41 54                	push   %r12
+  802bb9:	53                   	push   %rbx
+  802bba:	41 89 fc             	mov    %edi,%r12d
+  802bbd:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bc0:	48 b8 04 c0 80 00 00 	movabs $0x80c004,%rax
+  802bc7:	00 00 00 
+  802bca:	83 38 00             	cmpl   $0x0,(%rax)
+  802bcd:	74 46                	je     802c15 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bcf:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bd3:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	6a 00                	push   $0x0
+  802bdb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802be1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802be7:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802bee:	00 00 00 
+  802bf1:	44 89 e6             	mov    %r12d,%esi
+  802bf4:	48 b8 04 c0 80 00 00 	movabs $0x80c004,%rax
+  802bfb:	00 00 00 
+  802bfe:	8b 38                	mov    (%rax),%edi
+  802c00:	48 b8 13 47 80 00 00 	movabs $0x804713,%rax
+  802c07:	00 00 00 
+  802c0a:	ff d0                	call   *%rax
+}
+  802c0c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802c10:	5b                   	pop    %rbx
+  802c11:	41 5c                	pop    %r12
+  802c13:	5d                   	pop    %rbp
+  802c14:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c15:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c1a:	48 b8 7a 49 80 00 00 	movabs $0x80497a,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+  802c26:	a3 04 c0 80 00 00 00 	movabs %eax,0x80c004
+  802c2d:	00 00 
+  802c2f:	eb 9e                	jmp    802bcf <fsipcv+0x1c>
+
+0000000000802c31 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c31:	55                   	push   %rbp
+  802c32:	48 89 e5             	mov    %rsp,%rbp
+  802c35:	41 54                	push   %r12
+  802c37:	53                   	push   %rbx
+  802c38:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c3b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c3e:	a3 00 b0 80 00 00 00 	movabs %eax,0x80b000
+  802c45:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c47:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c51:	48 b8 3d 2b 80 00 00 	movabs $0x802b3d,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	78 3d                	js     802c9e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c61:	49 bc 00 b0 80 00 00 	movabs $0x80b000,%r12
+  802c68:	00 00 00 
+  802c6b:	4c 89 e6             	mov    %r12,%rsi
+  802c6e:	48 89 df             	mov    %rbx,%rdi
+  802c71:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  802c78:	00 00 00 
+  802c7b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c7d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c84:	00 
+  802c85:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c8b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c92:	00 
+  802c93:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9e:	5b                   	pop    %rbx
+  802c9f:	41 5c                	pop    %r12
+  802ca1:	5d                   	pop    %rbp
+  802ca2:	c3                   	ret
+
+0000000000802ca3 <fsipcv_buf>:
+    return FSIPCV;
+  802ca3:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802caa:	00 00 00 
+    if (!allocated) {
+  802cad:	48 ba 08 c0 80 00 00 	movabs $0x80c008,%rdx
+  802cb4:	00 00 00 
+  802cb7:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802cba:	74 01                	je     802cbd <fsipcv_buf+0x1a>
+}
+  802cbc:	c3                   	ret
+fsipcv_buf(void) {
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cc1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cc6:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802ccb:	48 89 c6             	mov    %rax,%rsi
+  802cce:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd3:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  802cda:	00 00 00 
+  802cdd:	ff d0                	call   *%rax
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	78 19                	js     802cfc <fsipcv_buf+0x59>
+        allocated = 1;
+  802ce3:	48 b8 08 c0 80 00 00 	movabs $0x80c008,%rax
+  802cea:	00 00 00 
+  802ced:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802cf0:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802cf7:	00 00 00 
+}
+  802cfa:	5d                   	pop    %rbp
+  802cfb:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d01:	eb f7                	jmp    802cfa <fsipcv_buf+0x57>
+
+0000000000802d03 <devfile_write>:
+    if (!fd || !buf) {
+  802d03:	48 85 ff             	test   %rdi,%rdi
+  802d06:	0f 84 46 01 00 00    	je     802e52 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d0c:	55                   	push   %rbp
+  802d0d:	48 89 e5             	mov    %rsp,%rbp
+  802d10:	41 57                	push   %r15
+  802d12:	41 56                	push   %r14
+  802d14:	41 55                	push   %r13
+  802d16:	41 54                	push   %r12
+  802d18:	53                   	push   %rbx
+  802d19:	48 83 ec 18          	sub    $0x18,%rsp
+  802d1d:	49 89 ff             	mov    %rdi,%r15
+  802d20:	49 89 f5             	mov    %rsi,%r13
+  802d23:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d26:	48 85 f6             	test   %rsi,%rsi
+  802d29:	0f 84 1a 01 00 00    	je     802e49 <devfile_write+0x146>
+    while (n) {
+  802d2f:	48 85 d2             	test   %rdx,%rdx
+  802d32:	0f 84 fc 00 00 00    	je     802e34 <devfile_write+0x131>
+    size_t i = 0;
+  802d38:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d3e:	eb 6c                	jmp    802dac <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d40:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d46:	4c 39 e3             	cmp    %r12,%rbx
+  802d49:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d4d:	4c 89 e2             	mov    %r12,%rdx
+  802d50:	4c 89 ee             	mov    %r13,%rsi
+  802d53:	48 bf 10 b0 80 00 00 	movabs $0x80b010,%rdi
+  802d5a:	00 00 00 
+  802d5d:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d69:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d6d:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  802d74:	00 00 00 
+  802d77:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d79:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d82:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d87:	48 b8 3d 2b 80 00 00 	movabs $0x802b3d,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	0f 88 95 00 00 00    	js     802e30 <devfile_write+0x12d>
+        buf += ret;
+  802d9b:	48 98                	cltq
+  802d9d:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802da0:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802da3:	48 29 c3             	sub    %rax,%rbx
+  802da6:	0f 84 8b 00 00 00    	je     802e37 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802dac:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802db3:	76 8b                	jbe    802d40 <devfile_write+0x3d>
+  802db5:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+  802dc1:	49 89 c4             	mov    %rax,%r12
+  802dc4:	48 85 c0             	test   %rax,%rax
+  802dc7:	0f 84 73 ff ff ff    	je     802d40 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802dcd:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dd2:	48 39 c3             	cmp    %rax,%rbx
+  802dd5:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dd9:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802de0:	00 
+  802de1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802de5:	48 89 c2             	mov    %rax,%rdx
+  802de8:	4c 89 ee             	mov    %r13,%rsi
+  802deb:	48 b9 53 15 80 00 00 	movabs $0x801553,%rcx
+  802df2:	00 00 00 
+  802df5:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802df7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802dfb:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802dff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e03:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802e08:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802e0f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e13:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e18:	48 b8 b3 2b 80 00 00 	movabs $0x802bb3,%rax
+  802e1f:	00 00 00 
+  802e22:	ff d0                	call   *%rax
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	0f 89 6f ff ff ff    	jns    802d9b <devfile_write+0x98>
+                return ret;
+  802e2c:	48 98                	cltq
+  802e2e:	eb 0a                	jmp    802e3a <devfile_write+0x137>
+                return ret;
+  802e30:	48 98                	cltq
+  802e32:	eb 06                	jmp    802e3a <devfile_write+0x137>
+    size_t i = 0;
+  802e34:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e37:	4c 89 f0             	mov    %r14,%rax
+}
+  802e3a:	48 83 c4 18          	add    $0x18,%rsp
+  802e3e:	5b                   	pop    %rbx
+  802e3f:	41 5c                	pop    %r12
+  802e41:	41 5d                	pop    %r13
+  802e43:	41 5e                	pop    %r14
+  802e45:	41 5f                	pop    %r15
+  802e47:	5d                   	pop    %rbp
+  802e48:	c3                   	ret
+        return -E_INVAL;
+  802e49:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e50:	eb e8                	jmp    802e3a <devfile_write+0x137>
+  802e52:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e59:	c3                   	ret
+
+0000000000802e5a <devfile_read>:
+    if (!fd || !buf) {
+  802e5a:	48 85 ff             	test   %rdi,%rdi
+  802e5d:	0f 84 47 01 00 00    	je     802faa <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e63:	55                   	push   %rbp
+  802e64:	48 89 e5             	mov    %rsp,%rbp
+  802e67:	41 57                	push   %r15
+  802e69:	41 56                	push   %r14
+  802e6b:	41 55                	push   %r13
+  802e6d:	41 54                	push   %r12
+  802e6f:	53                   	push   %rbx
+  802e70:	48 83 ec 18          	sub    $0x18,%rsp
+  802e74:	49 89 ff             	mov    %rdi,%r15
+  802e77:	49 89 f5             	mov    %rsi,%r13
+  802e7a:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e7d:	48 85 f6             	test   %rsi,%rsi
+  802e80:	0f 84 1b 01 00 00    	je     802fa1 <devfile_read+0x147>
+    while (n) {
+  802e86:	48 85 d2             	test   %rdx,%rdx
+  802e89:	0f 84 fb 00 00 00    	je     802f8a <devfile_read+0x130>
+    size_t i = 0;
+  802e8f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e96:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e97:	49 be 00 b0 80 00 00 	movabs $0x80b000,%r14
+  802e9e:	00 00 00 
+  802ea1:	eb 5f                	jmp    802f02 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802ea3:	48 98                	cltq
+  802ea5:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802eaa:	e9 e3 00 00 00       	jmp    802f92 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802eaf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802eb3:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802eb6:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802eba:	be 00 00 00 00       	mov    $0x0,%esi
+  802ebf:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ec4:	48 b8 3d 2b 80 00 00 	movabs $0x802b3d,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+  802ed0:	89 c3                	mov    %eax,%ebx
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	0f 8e a7 00 00 00    	jle    802f81 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802eda:	48 63 d0             	movslq %eax,%rdx
+  802edd:	4c 89 f6             	mov    %r14,%rsi
+  802ee0:	4c 89 ef             	mov    %r13,%rdi
+  802ee3:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+        buf += ret;
+  802eef:	48 63 db             	movslq %ebx,%rbx
+  802ef2:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802ef5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ef9:	49 29 dc             	sub    %rbx,%r12
+  802efc:	0f 84 8c 00 00 00    	je     802f8e <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f02:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f09:	76 a4                	jbe    802eaf <devfile_read+0x55>
+  802f0b:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	48 89 c1             	mov    %rax,%rcx
+  802f1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f1e:	48 85 c0             	test   %rax,%rax
+  802f21:	74 8c                	je     802eaf <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f23:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f28:	49 39 f4             	cmp    %rsi,%r12
+  802f2b:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f2f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f33:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f35:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f39:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f40:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f44:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f49:	48 b8 b3 2b 80 00 00 	movabs $0x802bb3,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+  802f55:	89 c3                	mov    %eax,%ebx
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	0f 8e 44 ff ff ff    	jle    802ea3 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f5f:	48 63 d0             	movslq %eax,%rdx
+  802f62:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f66:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f6d:	4c 89 ef             	mov    %r13,%rdi
+  802f70:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  802f77:	00 00 00 
+  802f7a:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f7c:	e9 6e ff ff ff       	jmp    802eef <devfile_read+0x95>
+                return ret ? ret : i;
+  802f81:	48 98                	cltq
+  802f83:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f88:	eb 08                	jmp    802f92 <devfile_read+0x138>
+    size_t i = 0;
+  802f8a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f92:	48 83 c4 18          	add    $0x18,%rsp
+  802f96:	5b                   	pop    %rbx
+  802f97:	41 5c                	pop    %r12
+  802f99:	41 5d                	pop    %r13
+  802f9b:	41 5e                	pop    %r14
+  802f9d:	41 5f                	pop    %r15
+  802f9f:	5d                   	pop    %rbp
+  802fa0:	c3                   	ret
+        return -E_INVAL;
+  802fa1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fa8:	eb e8                	jmp    802f92 <devfile_read+0x138>
+  802faa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802fb1:	c3                   	ret
+
+0000000000802fb2 <open>:
+open(const char *path, int mode) {
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+  802fb6:	41 55                	push   %r13
+  802fb8:	41 54                	push   %r12
+  802fba:	53                   	push   %rbx
+  802fbb:	48 83 ec 18          	sub    $0x18,%rsp
+  802fbf:	49 89 fc             	mov    %rdi,%r12
+  802fc2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fc5:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fd7:	0f 87 8a 00 00 00    	ja     803067 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fdd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fe1:	48 b8 ea 22 80 00 00 	movabs $0x8022ea,%rax
+  802fe8:	00 00 00 
+  802feb:	ff d0                	call   *%rax
+  802fed:	89 c3                	mov    %eax,%ebx
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 50                	js     803043 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ff3:	4c 89 e6             	mov    %r12,%rsi
+  802ff6:	48 bb 00 b0 80 00 00 	movabs $0x80b000,%rbx
+  802ffd:	00 00 00 
+  803000:	48 89 df             	mov    %rbx,%rdi
+  803003:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  80300a:	00 00 00 
+  80300d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80300f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803016:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80301a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80301f:	48 b8 3d 2b 80 00 00 	movabs $0x802b3d,%rax
+  803026:	00 00 00 
+  803029:	ff d0                	call   *%rax
+  80302b:	89 c3                	mov    %eax,%ebx
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 1f                	js     803050 <open+0x9e>
+    return fd2num(fd);
+  803031:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803035:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+  803041:	89 c3                	mov    %eax,%ebx
+}
+  803043:	89 d8                	mov    %ebx,%eax
+  803045:	48 83 c4 18          	add    $0x18,%rsp
+  803049:	5b                   	pop    %rbx
+  80304a:	41 5c                	pop    %r12
+  80304c:	41 5d                	pop    %r13
+  80304e:	5d                   	pop    %rbp
+  80304f:	c3                   	ret
+        fd_close(fd, 0);
+  803050:	be 00 00 00 00       	mov    $0x0,%esi
+  803055:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803059:	48 b8 08 24 80 00 00 	movabs $0x802408,%rax
+  803060:	00 00 00 
+  803063:	ff d0                	call   *%rax
+        return res;
+  803065:	eb dc                	jmp    803043 <open+0x91>
+        return -E_BAD_PATH;
+  803067:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80306c:	eb d5                	jmp    803043 <open+0x91>
+
+000000000080306e <sync>:
+sync(void) {
+  80306e:	55                   	push   %rbp
+  80306f:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803072:	be 00 00 00 00       	mov    $0x0,%esi
+  803077:	bf 08 00 00 00       	mov    $0x8,%edi
+  80307c:	48 b8 3d 2b 80 00 00 	movabs $0x802b3d,%rax
+  803083:	00 00 00 
+  803086:	ff d0                	call   *%rax
+}
+  803088:	5d                   	pop    %rbp
+  803089:	c3                   	ret
+
+000000000080308a <drop_cache>:
+drop_cache(int fdnum) {
+  80308a:	55                   	push   %rbp
+  80308b:	48 89 e5             	mov    %rsp,%rbp
+  80308e:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803092:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803096:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	78 51                	js     8030f7 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030aa:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030b1:	00 00 00 
+  8030b4:	8b 0a                	mov    (%rdx),%ecx
+  8030b6:	39 08                	cmp    %ecx,(%rax)
+  8030b8:	75 3f                	jne    8030f9 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030ba:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030c1:	00 
+  8030c2:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030c9:	00 
+  8030ca:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030d1:	00 
+  8030d2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030d9:	00 
+  8030da:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030de:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8030e2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030e6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030eb:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+}
+  8030f7:	c9                   	leave
+  8030f8:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030fe:	eb f7                	jmp    8030f7 <drop_cache+0x6d>
+
+0000000000803100 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803100:	55                   	push   %rbp
+  803101:	48 89 e5             	mov    %rsp,%rbp
+  803104:	41 57                	push   %r15
+  803106:	41 56                	push   %r14
+  803108:	41 55                	push   %r13
+  80310a:	41 54                	push   %r12
+  80310c:	53                   	push   %rbx
+  80310d:	48 83 ec 58          	sub    $0x58,%rsp
+  803111:	41 89 f4             	mov    %esi,%r12d
+  803114:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803118:	49 89 cd             	mov    %rcx,%r13
+  80311b:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80311e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803122:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+  80312e:	48 63 d0             	movslq %eax,%rdx
+  803131:	85 c0                	test   %eax,%eax
+  803133:	0f 88 36 01 00 00    	js     80326f <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803139:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80313d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803144:	00 00 00 
+  803147:	8b 32                	mov    (%rdx),%esi
+  803149:	39 31                	cmp    %esi,(%rcx)
+  80314b:	0f 85 30 01 00 00    	jne    803281 <read_map+0x181>
+  803151:	45 85 e4             	test   %r12d,%r12d
+  803154:	0f 88 27 01 00 00    	js     803281 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80315a:	49 63 cc             	movslq %r12d,%rcx
+  80315d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803161:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803168:	0f 85 1c 01 00 00    	jne    80328a <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80316e:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803172:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803179:	0f 85 14 01 00 00    	jne    803293 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80317f:	48 63 cb             	movslq %ebx,%rcx
+  803182:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803186:	49 be 00 c0 80 00 00 	movabs $0x80c000,%r14
+  80318d:	00 00 00 
+    while (i < n) {
+  803190:	4d 85 ed             	test   %r13,%r13
+  803193:	75 5c                	jne    8031f1 <read_map+0xf1>
+  803195:	e9 d2 00 00 00       	jmp    80326c <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80319a:	41 8b 3e             	mov    (%r14),%edi
+  80319d:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8031a1:	50                   	push   %rax
+  8031a2:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8031a6:	50                   	push   %rax
+  8031a7:	4d 89 f9             	mov    %r15,%r9
+  8031aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031b0:	48 89 d9             	mov    %rbx,%rcx
+  8031b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b8:	be 09 00 00 00       	mov    $0x9,%esi
+  8031bd:	48 b8 13 47 80 00 00 	movabs $0x804713,%rax
+  8031c4:	00 00 00 
+  8031c7:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031c9:	48 83 c4 10          	add    $0x10,%rsp
+  8031cd:	85 c0                	test   %eax,%eax
+  8031cf:	0f 8e 8f 00 00 00    	jle    803264 <read_map+0x164>
+        if (!mapped_perm) {
+  8031d5:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031d9:	0f 84 80 00 00 00    	je     80325f <read_map+0x15f>
+        i += res;
+  8031df:	48 63 d0             	movslq %eax,%rdx
+  8031e2:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8031e5:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8031ea:	75 78                	jne    803264 <read_map+0x164>
+    while (i < n) {
+  8031ec:	4d 39 ec             	cmp    %r13,%r12
+  8031ef:	73 73                	jae    803264 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031f5:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8031f9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031fd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803201:	4c 01 e0             	add    %r12,%rax
+  803204:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803208:	4c 89 eb             	mov    %r13,%rbx
+  80320b:	4c 29 e3             	sub    %r12,%rbx
+  80320e:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803212:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803216:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80321a:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803221:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803228:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80322d:	48 39 c3             	cmp    %rax,%rbx
+  803230:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803234:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803238:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80323c:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803240:	0f 85 54 ff ff ff    	jne    80319a <read_map+0x9a>
+  803246:	bf 03 00 00 00       	mov    $0x3,%edi
+  80324b:	48 b8 7a 49 80 00 00 	movabs $0x80497a,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+  803257:	41 89 06             	mov    %eax,(%r14)
+  80325a:	e9 3b ff ff ff       	jmp    80319a <read_map+0x9a>
+            res = -E_INVAL;
+  80325f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803264:	4c 89 e2             	mov    %r12,%rdx
+  803267:	4d 85 e4             	test   %r12,%r12
+  80326a:	75 03                	jne    80326f <read_map+0x16f>
+  80326c:	48 63 d0             	movslq %eax,%rdx
+}
+  80326f:	48 89 d0             	mov    %rdx,%rax
+  803272:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803276:	5b                   	pop    %rbx
+  803277:	41 5c                	pop    %r12
+  803279:	41 5d                	pop    %r13
+  80327b:	41 5e                	pop    %r14
+  80327d:	41 5f                	pop    %r15
+  80327f:	5d                   	pop    %rbp
+  803280:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803281:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803288:	eb e5                	jmp    80326f <read_map+0x16f>
+  80328a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803291:	eb dc                	jmp    80326f <read_map+0x16f>
+  803293:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80329a:	eb d3                	jmp    80326f <read_map+0x16f>
+
+000000000080329c <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80329c:	55                   	push   %rbp
+  80329d:	48 89 e5             	mov    %rsp,%rbp
+  8032a0:	41 57                	push   %r15
+  8032a2:	41 56                	push   %r14
+  8032a4:	41 55                	push   %r13
+  8032a6:	41 54                	push   %r12
+  8032a8:	53                   	push   %rbx
+  8032a9:	48 83 ec 38          	sub    $0x38,%rsp
+  8032ad:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032b0:	41 89 f6             	mov    %esi,%r14d
+  8032b3:	49 89 d5             	mov    %rdx,%r13
+  8032b6:	89 cb                	mov    %ecx,%ebx
+  8032b8:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032bb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032bf:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8032c6:	00 00 00 
+  8032c9:	ff d0                	call   *%rax
+  8032cb:	85 c0                	test   %eax,%eax
+  8032cd:	0f 88 33 02 00 00    	js     803506 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032d8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032dc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8032e3:	00 00 00 
+  8032e6:	8b 3a                	mov    (%rdx),%edi
+  8032e8:	39 39                	cmp    %edi,(%rcx)
+  8032ea:	0f 85 1b 02 00 00    	jne    80350b <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8032f0:	4d 85 ed             	test   %r13,%r13
+  8032f3:	41 0f 94 c0          	sete   %r8b
+  8032f7:	44 89 f0             	mov    %r14d,%eax
+  8032fa:	c1 e8 1f             	shr    $0x1f,%eax
+  8032fd:	41 08 c0             	or     %al,%r8b
+  803300:	0f 85 14 02 00 00    	jne    80351a <mmap+0x27e>
+  803306:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80330d:	0f 85 0e 02 00 00    	jne    803521 <mmap+0x285>
+  803313:	83 fb 07             	cmp    $0x7,%ebx
+  803316:	0f 87 0c 02 00 00    	ja     803528 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80331c:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803321:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803326:	83 fa 01             	cmp    $0x1,%edx
+  803329:	0f 87 dc 01 00 00    	ja     80350b <mmap+0x26f>
+  80332f:	48 ba 28 c0 80 00 00 	movabs $0x80c028,%rdx
+  803336:	00 00 00 
+  803339:	eb 0e                	jmp    803349 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80333b:	48 83 c0 01          	add    $0x1,%rax
+  80333f:	48 83 c2 20          	add    $0x20,%rdx
+  803343:	48 83 f8 40          	cmp    $0x40,%rax
+  803347:	74 44                	je     80338d <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803349:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80334d:	75 ec                	jne    80333b <mmap+0x9f>
+  80334f:	48 c1 e0 05          	shl    $0x5,%rax
+  803353:	48 ba 20 c0 80 00 00 	movabs $0x80c020,%rdx
+  80335a:	00 00 00 
+  80335d:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803361:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803368:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80336f:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803372:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803379:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80337c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803381:	49 b9 20 c0 80 00 00 	movabs $0x80c020,%r9
+  803388:	00 00 00 
+  80338b:	eb 17                	jmp    8033a4 <mmap+0x108>
+  80338d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803392:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803398:	eb c7                	jmp    803361 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80339a:	48 83 c0 01          	add    $0x1,%rax
+  80339e:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8033a2:	77 37                	ja     8033db <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033a4:	48 89 c2             	mov    %rax,%rdx
+  8033a7:	48 c1 e2 05          	shl    $0x5,%rdx
+  8033ab:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8033b0:	48 85 d2             	test   %rdx,%rdx
+  8033b3:	74 e5                	je     80339a <mmap+0xfe>
+  8033b5:	48 89 c7             	mov    %rax,%rdi
+  8033b8:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033bc:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033c0:	48 01 fa             	add    %rdi,%rdx
+  8033c3:	48 39 d6             	cmp    %rdx,%rsi
+  8033c6:	73 d2                	jae    80339a <mmap+0xfe>
+  8033c8:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033cc:	4c 39 d7             	cmp    %r10,%rdi
+  8033cf:	73 c9                	jae    80339a <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033d1:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d9:	eb c9                	jmp    8033a4 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8033db:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8033df:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8033e4:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8033eb:	00 00 00 
+  8033ee:	49 39 f9             	cmp    %rdi,%r9
+  8033f1:	0f 82 14 01 00 00    	jb     80350b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033f7:	48 85 f6             	test   %rsi,%rsi
+  8033fa:	0f 84 2f 01 00 00    	je     80352f <mmap+0x293>
+  803400:	45 84 c0             	test   %r8b,%r8b
+  803403:	0f 85 26 01 00 00    	jne    80352f <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  803409:	41 83 fc 01          	cmp    $0x1,%r12d
+  80340d:	0f 94 c0             	sete   %al
+  803410:	0f b6 c0             	movzbl %al,%eax
+  803413:	c1 e0 06             	shl    $0x6,%eax
+  803416:	09 d8                	or     %ebx,%eax
+  803418:	89 c3                	mov    %eax,%ebx
+  80341a:	83 cb 04             	or     $0x4,%ebx
+  80341d:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803420:	4d 85 ff             	test   %r15,%r15
+  803423:	0f 84 bd 00 00 00    	je     8034e6 <mmap+0x24a>
+  803429:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80342e:	83 e0 bf             	and    $0xffffffbf,%eax
+  803431:	83 c8 04             	or     $0x4,%eax
+  803434:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803437:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80343b:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80343f:	49 89 f6             	mov    %rsi,%r14
+  803442:	eb 43                	jmp    803487 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803444:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80344a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803450:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803453:	eb 2d                	jmp    803482 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803455:	48 85 c0             	test   %rax,%rax
+  803458:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80345d:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803461:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803464:	4c 89 e2             	mov    %r12,%rdx
+  803467:	4c 89 ee             	mov    %r13,%rsi
+  80346a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346f:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	85 c0                	test   %eax,%eax
+  80347d:	78 3e                	js     8034bd <mmap+0x221>
+        i += n;
+  80347f:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803482:	4c 39 fb             	cmp    %r15,%rbx
+  803485:	73 54                	jae    8034db <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803487:	4d 89 fc             	mov    %r15,%r12
+  80348a:	49 29 dc             	sub    %rbx,%r12
+  80348d:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803491:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803494:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803497:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  80349b:	4c 89 e1             	mov    %r12,%rcx
+  80349e:	4c 89 ea             	mov    %r13,%rdx
+  8034a1:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8034a4:	48 b8 00 31 80 00 00 	movabs $0x803100,%rax
+  8034ab:	00 00 00 
+  8034ae:	ff d0                	call   *%rax
+        if (res > 0) {
+  8034b0:	48 85 c0             	test   %rax,%rax
+  8034b3:	7f 8f                	jg     803444 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034b5:	74 9e                	je     803455 <mmap+0x1b9>
+  8034b7:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034bb:	74 98                	je     803455 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034bd:	4c 89 f6             	mov    %r14,%rsi
+  8034c0:	4c 89 fa             	mov    %r15,%rdx
+  8034c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c8:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  8034cf:	00 00 00 
+  8034d2:	ff d0                	call   *%rax
+    return NULL;
+  8034d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d9:	eb 30                	jmp    80350b <mmap+0x26f>
+  8034db:	4c 89 f6             	mov    %r14,%rsi
+  8034de:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034e2:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8034e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ea:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034ed:	48 89 31             	mov    %rsi,(%rcx)
+  8034f0:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8034f4:	89 41 10             	mov    %eax,0x10(%rcx)
+  8034f7:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fe:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803501:	48 89 f0             	mov    %rsi,%rax
+  803504:	eb 05                	jmp    80350b <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803506:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80350b:	48 83 c4 38          	add    $0x38,%rsp
+  80350f:	5b                   	pop    %rbx
+  803510:	41 5c                	pop    %r12
+  803512:	41 5d                	pop    %r13
+  803514:	41 5e                	pop    %r14
+  803516:	41 5f                	pop    %r15
+  803518:	5d                   	pop    %rbp
+  803519:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80351a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351f:	eb ea                	jmp    80350b <mmap+0x26f>
+  803521:	b8 00 00 00 00       	mov    $0x0,%eax
+  803526:	eb e3                	jmp    80350b <mmap+0x26f>
+  803528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352d:	eb dc                	jmp    80350b <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80352f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803534:	eb d5                	jmp    80350b <mmap+0x26f>
+
+0000000000803536 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803536:	55                   	push   %rbp
+  803537:	48 89 e5             	mov    %rsp,%rbp
+  80353a:	41 57                	push   %r15
+  80353c:	41 56                	push   %r14
+  80353e:	41 55                	push   %r13
+  803540:	41 54                	push   %r12
+  803542:	53                   	push   %rbx
+  803543:	48 83 ec 38          	sub    $0x38,%rsp
+  803547:	49 89 fc             	mov    %rdi,%r12
+  80354a:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80354d:	48 b8 fc 29 80 00 00 	movabs $0x8029fc,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803559:	48 85 c0             	test   %rax,%rax
+  80355c:	0f 84 2f 01 00 00    	je     803691 <msync+0x15b>
+  803562:	49 89 c7             	mov    %rax,%r15
+  803565:	4d 01 e5             	add    %r12,%r13
+  803568:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80356c:	49 03 07             	add    (%r15),%rax
+  80356f:	4c 39 e8             	cmp    %r13,%rax
+  803572:	0f 82 20 01 00 00    	jb     803698 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803578:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80357c:	83 e0 40             	and    $0x40,%eax
+  80357f:	0f 84 fd 00 00 00    	je     803682 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803585:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80358c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803593:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  80359a:	4d 39 ec             	cmp    %r13,%r12
+  80359d:	0f 83 fc 00 00 00    	jae    80369f <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8035a3:	49 be e1 40 80 00 00 	movabs $0x8040e1,%r14
+  8035aa:	00 00 00 
+  8035ad:	e9 b0 00 00 00       	jmp    803662 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035b2:	4c 89 e3             	mov    %r12,%rbx
+  8035b5:	4d 39 ec             	cmp    %r13,%r12
+  8035b8:	73 16                	jae    8035d0 <msync+0x9a>
+  8035ba:	48 89 df             	mov    %rbx,%rdi
+  8035bd:	41 ff d6             	call   *%r14
+  8035c0:	84 c0                	test   %al,%al
+  8035c2:	74 0c                	je     8035d0 <msync+0x9a>
+  8035c4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035cb:	4c 39 eb             	cmp    %r13,%rbx
+  8035ce:	72 ea                	jb     8035ba <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035d0:	48 89 d8             	mov    %rbx,%rax
+  8035d3:	4c 29 e0             	sub    %r12,%rax
+  8035d6:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035da:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035de:	49 89 c0             	mov    %rax,%r8
+  8035e1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8035e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ea:	48 89 ce             	mov    %rcx,%rsi
+  8035ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f2:	49 ba 09 19 80 00 00 	movabs $0x801909,%r10
+  8035f9:	00 00 00 
+  8035fc:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	78 7f                	js     803682 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803603:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80360a:	00 
+  80360b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803612:	00 
+  803613:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80361a:	00 
+  80361b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803622:	00 
+  803623:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803627:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80362b:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80362f:	49 2b 07             	sub    (%r15),%rax
+  803632:	4c 01 e0             	add    %r12,%rax
+  803635:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803639:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80363d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803641:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803645:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80364a:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  803651:	00 00 00 
+  803654:	ff d0                	call   *%rax
+  803656:	85 c0                	test   %eax,%eax
+  803658:	78 28                	js     803682 <msync+0x14c>
+  80365a:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80365d:	4d 39 ec             	cmp    %r13,%r12
+  803660:	73 1b                	jae    80367d <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803662:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803666:	4c 89 e7             	mov    %r12,%rdi
+  803669:	41 ff d6             	call   *%r14
+  80366c:	84 c0                	test   %al,%al
+  80366e:	0f 85 3e ff ff ff    	jne    8035b2 <msync+0x7c>
+            va += PAGE_SIZE;
+  803674:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  80367b:	eb e0                	jmp    80365d <msync+0x127>
+    }
+
+    return 0;
+  80367d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803682:	48 83 c4 38          	add    $0x38,%rsp
+  803686:	5b                   	pop    %rbx
+  803687:	41 5c                	pop    %r12
+  803689:	41 5d                	pop    %r13
+  80368b:	41 5e                	pop    %r14
+  80368d:	41 5f                	pop    %r15
+  80368f:	5d                   	pop    %rbp
+  803690:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803691:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803696:	eb ea                	jmp    803682 <msync+0x14c>
+  803698:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80369d:	eb e3                	jmp    803682 <msync+0x14c>
+    return 0;
+  80369f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a4:	eb dc                	jmp    803682 <msync+0x14c>
+
+00000000008036a6 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8036a6:	55                   	push   %rbp
+  8036a7:	48 89 e5             	mov    %rsp,%rbp
+  8036aa:	41 55                	push   %r13
+  8036ac:	41 54                	push   %r12
+  8036ae:	53                   	push   %rbx
+  8036af:	48 83 ec 08          	sub    $0x8,%rsp
+  8036b3:	49 89 fc             	mov    %rdi,%r12
+  8036b6:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036b9:	48 b8 fc 29 80 00 00 	movabs $0x8029fc,%rax
+  8036c0:	00 00 00 
+  8036c3:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036c5:	48 85 c0             	test   %rax,%rax
+  8036c8:	74 58                	je     803722 <munmap+0x7c>
+  8036ca:	48 89 c3             	mov    %rax,%rbx
+  8036cd:	4c 3b 20             	cmp    (%rax),%r12
+  8036d0:	75 57                	jne    803729 <munmap+0x83>
+  8036d2:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036d9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036df:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8036e3:	75 4b                	jne    803730 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8036e5:	4c 89 ee             	mov    %r13,%rsi
+  8036e8:	4c 89 e7             	mov    %r12,%rdi
+  8036eb:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  8036f2:	00 00 00 
+  8036f5:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8036f7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036fb:	4c 89 e6             	mov    %r12,%rsi
+  8036fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803703:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  80370a:	00 00 00 
+  80370d:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80370f:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803716:	00 
+    return res;
+}
+  803717:	48 83 c4 08          	add    $0x8,%rsp
+  80371b:	5b                   	pop    %rbx
+  80371c:	41 5c                	pop    %r12
+  80371e:	41 5d                	pop    %r13
+  803720:	5d                   	pop    %rbp
+  803721:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803722:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803727:	eb ee                	jmp    803717 <munmap+0x71>
+  803729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80372e:	eb e7                	jmp    803717 <munmap+0x71>
+  803730:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803735:	eb e0                	jmp    803717 <munmap+0x71>
+
+0000000000803737 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803737:	55                   	push   %rbp
+  803738:	48 89 e5             	mov    %rsp,%rbp
+  80373b:	41 54                	push   %r12
+  80373d:	53                   	push   %rbx
+  80373e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803741:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  803748:	00 00 00 
+  80374b:	ff d0                	call   *%rax
+  80374d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803750:	48 be 40 58 80 00 00 	movabs $0x805840,%rsi
+  803757:	00 00 00 
+  80375a:	48 89 df             	mov    %rbx,%rdi
+  80375d:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  803764:	00 00 00 
+  803767:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803769:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80376e:	41 8b 14 24          	mov    (%r12),%edx
+  803772:	29 d0                	sub    %edx,%eax
+  803774:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80377a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803781:	00 00 00 
+    stat->st_dev = &devpipe;
+  803784:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80378b:	00 00 00 
+  80378e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379a:	5b                   	pop    %rbx
+  80379b:	41 5c                	pop    %r12
+  80379d:	5d                   	pop    %rbp
+  80379e:	c3                   	ret
+
+000000000080379f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80379f:	55                   	push   %rbp
+  8037a0:	48 89 e5             	mov    %rsp,%rbp
+  8037a3:	41 55                	push   %r13
+  8037a5:	41 54                	push   %r12
+  8037a7:	53                   	push   %rbx
+  8037a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8037ac:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037af:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  8037b6:	00 00 00 
+  8037b9:	ff d0                	call   *%rax
+  8037bb:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037c3:	4c 89 e6             	mov    %r12,%rsi
+  8037c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037cb:	49 bc d6 19 80 00 00 	movabs $0x8019d6,%r12
+  8037d2:	00 00 00 
+  8037d5:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037d8:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037de:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ea:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8037ed:	be 00 04 00 00       	mov    $0x400,%esi
+  8037f2:	48 89 df             	mov    %rbx,%rdi
+  8037f5:	49 bd 50 1f 80 00 00 	movabs $0x801f50,%r13
+  8037fc:	00 00 00 
+  8037ff:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803802:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803806:	be 00 04 00 00       	mov    $0x400,%esi
+  80380b:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80380e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803813:	48 89 de             	mov    %rbx,%rsi
+  803816:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381b:	41 ff d4             	call   *%r12
+}
+  80381e:	48 83 c4 08          	add    $0x8,%rsp
+  803822:	5b                   	pop    %rbx
+  803823:	41 5c                	pop    %r12
+  803825:	41 5d                	pop    %r13
+  803827:	5d                   	pop    %rbp
+  803828:	c3                   	ret
+
+0000000000803829 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803829:	55                   	push   %rbp
+  80382a:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80382d:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803833:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80383a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80383f:	48 b8 76 18 80 00 00 	movabs $0x801876,%rax
+  803846:	00 00 00 
+  803849:	ff d0                	call   *%rax
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	0f 94 c0             	sete   %al
+  803850:	0f b6 c0             	movzbl %al,%eax
+}
+  803853:	5d                   	pop    %rbp
+  803854:	c3                   	ret
+
+0000000000803855 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803855:	b8 01 00 00 00       	mov    $0x1,%eax
+  80385a:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80385c:	8b 07                	mov    (%rdi),%eax
+  80385e:	39 f0                	cmp    %esi,%eax
+  803860:	74 01                	je     803863 <pipe_wait+0xe>
+  803862:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803863:	55                   	push   %rbp
+  803864:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803867:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803869:	48 c1 e2 20          	shl    $0x20,%rdx
+  80386d:	89 c0                	mov    %eax,%eax
+  80386f:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803872:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803879:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  803880:	00 00 00 
+  803883:	ff d0                	call   *%rax
+}
+  803885:	5d                   	pop    %rbp
+  803886:	c3                   	ret
+
+0000000000803887 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388c:	87 06                	xchg   %eax,(%rsi)
+  80388e:	85 c0                	test   %eax,%eax
+  803890:	75 01                	jne    803893 <pipe_wake+0xc>
+  803892:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803893:	55                   	push   %rbp
+  803894:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803897:	be 00 04 00 00       	mov    $0x400,%esi
+  80389c:	48 b8 50 1f 80 00 00 	movabs $0x801f50,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+}
+  8038a8:	5d                   	pop    %rbp
+  8038a9:	c3                   	ret
+
+00000000008038aa <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038aa:	55                   	push   %rbp
+  8038ab:	48 89 e5             	mov    %rsp,%rbp
+  8038ae:	41 57                	push   %r15
+  8038b0:	41 56                	push   %r14
+  8038b2:	41 55                	push   %r13
+  8038b4:	41 54                	push   %r12
+  8038b6:	53                   	push   %rbx
+  8038b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8038bb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038c3:	48 89 d3             	mov    %rdx,%rbx
+  8038c6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038ca:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038d6:	48 85 db             	test   %rbx,%rbx
+  8038d9:	0f 84 0f 01 00 00    	je     8039ee <devpipe_write+0x144>
+  8038df:	49 89 c4             	mov    %rax,%r12
+  8038e2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8038e8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8038ef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038f3:	eb 4f                	jmp    803944 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038f5:	4c 89 e6             	mov    %r12,%rsi
+  8038f8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8038fc:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803903:	00 00 00 
+  803906:	ff d0                	call   *%rax
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	74 14                	je     803920 <devpipe_write+0x76>
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803911:	48 83 c4 28          	add    $0x28,%rsp
+  803915:	5b                   	pop    %rbx
+  803916:	41 5c                	pop    %r12
+  803918:	41 5d                	pop    %r13
+  80391a:	41 5e                	pop    %r14
+  80391c:	41 5f                	pop    %r15
+  80391e:	5d                   	pop    %rbp
+  80391f:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803920:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803925:	44 89 ee             	mov    %r13d,%esi
+  803928:	4c 89 e7             	mov    %r12,%rdi
+  80392b:	48 b8 55 38 80 00 00 	movabs $0x803855,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803937:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80393b:	49 39 c7             	cmp    %rax,%r15
+  80393e:	0f 83 aa 00 00 00    	jae    8039ee <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803944:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803949:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80394d:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803954:	00 
+  803955:	44 89 f0             	mov    %r14d,%eax
+  803958:	44 29 e8             	sub    %r13d,%eax
+  80395b:	39 d8                	cmp    %ebx,%eax
+  80395d:	74 96                	je     8038f5 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80395f:	89 d8                	mov    %ebx,%eax
+  803961:	44 29 f0             	sub    %r14d,%eax
+  803964:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803968:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80396c:	4c 29 f8             	sub    %r15,%rax
+  80396f:	49 39 c5             	cmp    %rax,%r13
+  803972:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803976:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803979:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80397c:	89 db                	mov    %ebx,%ebx
+  80397e:	48 29 c3             	sub    %rax,%rbx
+  803981:	4c 39 eb             	cmp    %r13,%rbx
+  803984:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803988:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80398c:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803990:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803997:	00 
+  803998:	48 89 da             	mov    %rbx,%rdx
+  80399b:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8039a7:	4c 89 ea             	mov    %r13,%rdx
+  8039aa:	48 29 da             	sub    %rbx,%rdx
+  8039ad:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039b5:	48 01 ce             	add    %rcx,%rsi
+  8039b8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039bc:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  8039c3:	00 00 00 
+  8039c6:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039c8:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039cd:	45 01 ee             	add    %r13d,%r14d
+  8039d0:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039d5:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039da:	48 b8 87 38 80 00 00 	movabs $0x803887,%rax
+  8039e1:	00 00 00 
+  8039e4:	ff d0                	call   *%rax
+        i += chunk;
+  8039e6:	4d 01 ef             	add    %r13,%r15
+  8039e9:	e9 49 ff ff ff       	jmp    803937 <devpipe_write+0x8d>
+    return n;
+  8039ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039f2:	e9 1a ff ff ff       	jmp    803911 <devpipe_write+0x67>
+
+00000000008039f7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039f7:	55                   	push   %rbp
+  8039f8:	48 89 e5             	mov    %rsp,%rbp
+  8039fb:	41 57                	push   %r15
+  8039fd:	41 56                	push   %r14
+  8039ff:	41 55                	push   %r13
+  803a01:	41 54                	push   %r12
+  803a03:	53                   	push   %rbx
+  803a04:	48 83 ec 28          	sub    $0x28,%rsp
+  803a08:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a0c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a10:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a14:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  803a1b:	00 00 00 
+  803a1e:	ff d0                	call   *%rax
+  803a20:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a23:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a27:	49 bf 29 38 80 00 00 	movabs $0x803829,%r15
+  803a2e:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a31:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a39:	eb 15                	jmp    803a50 <devpipe_read+0x59>
+  803a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a3f:	89 de                	mov    %ebx,%esi
+  803a41:	4c 89 f7             	mov    %r14,%rdi
+  803a44:	48 b8 55 38 80 00 00 	movabs $0x803855,%rax
+  803a4b:	00 00 00 
+  803a4e:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a50:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a54:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a57:	41 39 dd             	cmp    %ebx,%r13d
+  803a5a:	75 15                	jne    803a71 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a5c:	4c 89 e6             	mov    %r12,%rsi
+  803a5f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a63:	41 ff d7             	call   *%r15
+  803a66:	85 c0                	test   %eax,%eax
+  803a68:	74 d1                	je     803a3b <devpipe_read+0x44>
+  803a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6f:	eb 7c                	jmp    803aed <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a71:	44 29 eb             	sub    %r13d,%ebx
+  803a74:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a78:	48 39 c3             	cmp    %rax,%rbx
+  803a7b:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803a7f:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a86:	00 
+  803a87:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a8b:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a8e:	45 89 f6             	mov    %r14d,%r14d
+  803a91:	49 29 c6             	sub    %rax,%r14
+  803a94:	49 39 de             	cmp    %rbx,%r14
+  803a97:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a9b:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803aa2:	00 
+  803aa3:	4c 89 f2             	mov    %r14,%rdx
+  803aa6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803aaa:	49 bf 53 15 80 00 00 	movabs $0x801553,%r15
+  803ab1:	00 00 00 
+  803ab4:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ab7:	48 89 da             	mov    %rbx,%rdx
+  803aba:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803abd:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ac4:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ac5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ac9:	4c 01 f7             	add    %r14,%rdi
+  803acc:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803acf:	41 01 dd             	add    %ebx,%r13d
+  803ad2:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803ad6:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803adb:	4c 89 e7             	mov    %r12,%rdi
+  803ade:	48 b8 87 38 80 00 00 	movabs $0x803887,%rax
+  803ae5:	00 00 00 
+  803ae8:	ff d0                	call   *%rax
+    return n;
+  803aea:	48 89 d8             	mov    %rbx,%rax
+}
+  803aed:	48 83 c4 28          	add    $0x28,%rsp
+  803af1:	5b                   	pop    %rbx
+  803af2:	41 5c                	pop    %r12
+  803af4:	41 5d                	pop    %r13
+  803af6:	41 5e                	pop    %r14
+  803af8:	41 5f                	pop    %r15
+  803afa:	5d                   	pop    %rbp
+  803afb:	c3                   	ret
+
+0000000000803afc <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803afc:	55                   	push   %rbp
+  803afd:	48 89 e5             	mov    %rsp,%rbp
+  803b00:	41 57                	push   %r15
+  803b02:	41 56                	push   %r14
+  803b04:	41 55                	push   %r13
+  803b06:	41 54                	push   %r12
+  803b08:	53                   	push   %rbx
+  803b09:	48 83 ec 18          	sub    $0x18,%rsp
+  803b0d:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b10:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b17:	0f 86 96 01 00 00    	jbe    803cb3 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b1d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b22:	48 01 db             	add    %rbx,%rbx
+  803b25:	48 39 f3             	cmp    %rsi,%rbx
+  803b28:	72 f8                	jb     803b22 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b2a:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b31:	0f 87 18 02 00 00    	ja     803d4f <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b37:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b3b:	48 b8 ea 22 80 00 00 	movabs $0x8022ea,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+  803b47:	41 89 c4             	mov    %eax,%r12d
+  803b4a:	85 c0                	test   %eax,%eax
+  803b4c:	0f 88 b6 01 00 00    	js     803d08 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b52:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b60:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b65:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+  803b71:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b74:	85 c0                	test   %eax,%eax
+  803b76:	0f 88 8c 01 00 00    	js     803d08 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b7c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803b80:	48 b8 ea 22 80 00 00 	movabs $0x8022ea,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+  803b8c:	41 89 c4             	mov    %eax,%r12d
+  803b8f:	85 c0                	test   %eax,%eax
+  803b91:	0f 88 57 01 00 00    	js     803cee <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b97:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ba1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803baa:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+  803bb6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bb9:	85 c0                	test   %eax,%eax
+  803bbb:	0f 88 2d 01 00 00    	js     803cee <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803bc1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bc5:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+  803bd1:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bd4:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803bdb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803be0:	4c 89 fa             	mov    %r15,%rdx
+  803be3:	48 89 c6             	mov    %rax,%rsi
+  803be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803beb:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+  803bf7:	41 89 c4             	mov    %eax,%r12d
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	0f 88 d2 00 00 00    	js     803cd4 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803c02:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c09:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c0d:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  803c14:	00 00 00 
+  803c17:	ff d0                	call   *%rax
+  803c19:	48 89 c1             	mov    %rax,%rcx
+  803c1c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c22:	4d 89 f8             	mov    %r15,%r8
+  803c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c2a:	4c 89 f6             	mov    %r14,%rsi
+  803c2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c32:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+  803c3e:	41 89 c4             	mov    %eax,%r12d
+  803c41:	85 c0                	test   %eax,%eax
+  803c43:	78 78                	js     803cbd <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c45:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c4a:	4c 89 f7             	mov    %r14,%rdi
+  803c4d:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+  803c59:	83 f8 02             	cmp    $0x2,%eax
+  803c5c:	0f 85 b8 00 00 00    	jne    803d1a <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c62:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c69:	00 00 
+  803c6b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c6f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c71:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c75:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c80:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c82:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c86:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c8d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c91:	48 bb ba 22 80 00 00 	movabs $0x8022ba,%rbx
+  803c98:	00 00 00 
+  803c9b:	ff d3                	call   *%rbx
+  803c9d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803ca1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803ca5:	ff d3                	call   *%rbx
+  803ca7:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803cab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cb1:	eb 55                	jmp    803d08 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803cb3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803cb8:	e9 7a fe ff ff       	jmp    803b37 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803cbd:	4c 89 fa             	mov    %r15,%rdx
+  803cc0:	4c 89 f6             	mov    %r14,%rsi
+  803cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc8:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  803ccf:	00 00 00 
+  803cd2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cd4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cd9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce2:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  803ce9:	00 00 00 
+  803cec:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cf3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cfc:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  803d03:	00 00 00 
+  803d06:	ff d0                	call   *%rax
+}
+  803d08:	44 89 e0             	mov    %r12d,%eax
+  803d0b:	48 83 c4 18          	add    $0x18,%rsp
+  803d0f:	5b                   	pop    %rbx
+  803d10:	41 5c                	pop    %r12
+  803d12:	41 5d                	pop    %r13
+  803d14:	41 5e                	pop    %r14
+  803d16:	41 5f                	pop    %r15
+  803d18:	5d                   	pop    %rbp
+  803d19:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d1a:	48 b9 70 58 80 00 00 	movabs $0x805870,%rcx
+  803d21:	00 00 00 
+  803d24:	48 ba 47 58 80 00 00 	movabs $0x805847,%rdx
+  803d2b:	00 00 00 
+  803d2e:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d33:	48 bf 5c 58 80 00 00 	movabs $0x80585c,%rdi
+  803d3a:	00 00 00 
+  803d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d42:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  803d49:	00 00 00 
+  803d4c:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d4f:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d55:	eb b1                	jmp    803d08 <pipe_sized+0x20c>
+
+0000000000803d57 <pipe>:
+pipe(int pfd[2]) {
+  803d57:	55                   	push   %rbp
+  803d58:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d5b:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d60:	48 b8 fc 3a 80 00 00 	movabs $0x803afc,%rax
+  803d67:	00 00 00 
+  803d6a:	ff d0                	call   *%rax
+}
+  803d6c:	5d                   	pop    %rbp
+  803d6d:	c3                   	ret
+
+0000000000803d6e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d6e:	55                   	push   %rbp
+  803d6f:	48 89 e5             	mov    %rsp,%rbp
+  803d72:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d76:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d7a:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  803d81:	00 00 00 
+  803d84:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d86:	85 c0                	test   %eax,%eax
+  803d88:	78 23                	js     803dad <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d8a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d8e:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d9d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803da1:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803da8:	00 00 00 
+  803dab:	ff d0                	call   *%rax
+}
+  803dad:	c9                   	leave
+  803dae:	c3                   	ret
+
+0000000000803daf <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803daf:	55                   	push   %rbp
+  803db0:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803db3:	8b 0f                	mov    (%rdi),%ecx
+  803db5:	8d 41 01             	lea    0x1(%rcx),%eax
+  803db8:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803dba:	83 f9 07             	cmp    $0x7,%ecx
+  803dbd:	76 31                	jbe    803df0 <backoff+0x41>
+    asm volatile("rdtsc"
+  803dbf:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803dc1:	83 c1 06             	add    $0x6,%ecx
+  803dc4:	be 15 00 00 00       	mov    $0x15,%esi
+  803dc9:	39 f1                	cmp    %esi,%ecx
+  803dcb:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803dce:	bf 01 00 00 00       	mov    $0x1,%edi
+  803dd3:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803dd6:	48 c1 e2 20          	shl    $0x20,%rdx
+  803dda:	89 c0                	mov    %eax,%eax
+  803ddc:	48 09 c2             	or     %rax,%rdx
+  803ddf:	48 01 d7             	add    %rdx,%rdi
+  803de2:	48 b8 9e 1e 80 00 00 	movabs $0x801e9e,%rax
+  803de9:	00 00 00 
+  803dec:	ff d0                	call   *%rax
+}
+  803dee:	5d                   	pop    %rbp
+  803def:	c3                   	ret
+        sys_yield();
+  803df0:	48 b8 13 18 80 00 00 	movabs $0x801813,%rax
+  803df7:	00 00 00 
+  803dfa:	ff d0                	call   *%rax
+        return;
+  803dfc:	eb f0                	jmp    803dee <backoff+0x3f>
+
+0000000000803dfe <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803dfe:	55                   	push   %rbp
+  803dff:	48 89 e5             	mov    %rsp,%rbp
+  803e02:	41 55                	push   %r13
+  803e04:	41 54                	push   %r12
+  803e06:	53                   	push   %rbx
+  803e07:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803e0b:	85 ff                	test   %edi,%edi
+  803e0d:	74 7e                	je     803e8d <wait+0x8f>
+  803e0f:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803e12:	89 f8                	mov    %edi,%eax
+  803e14:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803e19:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803e20:	89 f9                	mov    %edi,%ecx
+  803e22:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803e28:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803e2f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e36:	00 00 00 
+  803e39:	48 01 ca             	add    %rcx,%rdx
+  803e3c:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803e42:	39 d7                	cmp    %edx,%edi
+  803e44:	75 3c                	jne    803e82 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803e46:	48 98                	cltq
+  803e48:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e4f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803e56:	00 00 00 
+  803e59:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803e5c:	49 bd af 3d 80 00 00 	movabs $0x803daf,%r13
+  803e63:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803e66:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	74 12                	je     803e82 <wait+0x84>
+        backoff(&attempt);
+  803e70:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803e74:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803e77:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803e7d:	44 39 e0             	cmp    %r12d,%eax
+  803e80:	74 e4                	je     803e66 <wait+0x68>
+    }
+}
+  803e82:	48 83 c4 18          	add    $0x18,%rsp
+  803e86:	5b                   	pop    %rbx
+  803e87:	41 5c                	pop    %r12
+  803e89:	41 5d                	pop    %r13
+  803e8b:	5d                   	pop    %rbp
+  803e8c:	c3                   	ret
+    assert(envid != 0);
+  803e8d:	48 b9 94 58 80 00 00 	movabs $0x805894,%rcx
+  803e94:	00 00 00 
+  803e97:	48 ba 47 58 80 00 00 	movabs $0x805847,%rdx
+  803e9e:	00 00 00 
+  803ea1:	be 22 00 00 00       	mov    $0x22,%esi
+  803ea6:	48 bf 9f 58 80 00 00 	movabs $0x80589f,%rdi
+  803ead:	00 00 00 
+  803eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb5:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  803ebc:	00 00 00 
+  803ebf:	41 ff d0             	call   *%r8
+
+0000000000803ec2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ec2:	48 89 f8             	mov    %rdi,%rax
+  803ec5:	48 c1 e8 27          	shr    $0x27,%rax
+  803ec9:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ed0:	7f 00 00 
+  803ed3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ed7:	f6 c2 01             	test   $0x1,%dl
+  803eda:	74 6d                	je     803f49 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803edc:	48 89 f8             	mov    %rdi,%rax
+  803edf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ee3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803eea:	7f 00 00 
+  803eed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef1:	f6 c2 01             	test   $0x1,%dl
+  803ef4:	74 62                	je     803f58 <get_uvpt_entry+0x96>
+  803ef6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803efd:	7f 00 00 
+  803f00:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f04:	f6 c2 80             	test   $0x80,%dl
+  803f07:	75 4f                	jne    803f58 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f09:	48 89 f8             	mov    %rdi,%rax
+  803f0c:	48 c1 e8 15          	shr    $0x15,%rax
+  803f10:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f17:	7f 00 00 
+  803f1a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f1e:	f6 c2 01             	test   $0x1,%dl
+  803f21:	74 44                	je     803f67 <get_uvpt_entry+0xa5>
+  803f23:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f2a:	7f 00 00 
+  803f2d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f31:	f6 c2 80             	test   $0x80,%dl
+  803f34:	75 31                	jne    803f67 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f36:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f3a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f41:	7f 00 00 
+  803f44:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f48:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f49:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f50:	7f 00 00 
+  803f53:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f57:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f58:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f5f:	7f 00 00 
+  803f62:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f66:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f67:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f6e:	7f 00 00 
+  803f71:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f75:	c3                   	ret
+
+0000000000803f76 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f76:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f79:	48 89 f9             	mov    %rdi,%rcx
+  803f7c:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f80:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f87:	7f 00 00 
+  803f8a:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f8e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f95:	f6 c1 01             	test   $0x1,%cl
+  803f98:	0f 84 b2 00 00 00    	je     804050 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f9e:	48 89 f9             	mov    %rdi,%rcx
+  803fa1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803fa5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fac:	7f 00 00 
+  803faf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fb3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fba:	40 f6 c6 01          	test   $0x1,%sil
+  803fbe:	0f 84 8c 00 00 00    	je     804050 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803fc4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fcb:	7f 00 00 
+  803fce:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fd2:	a8 80                	test   $0x80,%al
+  803fd4:	75 7b                	jne    804051 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803fd6:	48 89 f9             	mov    %rdi,%rcx
+  803fd9:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fdd:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fe4:	7f 00 00 
+  803fe7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803feb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ff2:	40 f6 c6 01          	test   $0x1,%sil
+  803ff6:	74 58                	je     804050 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ff8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fff:	7f 00 00 
+  804002:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804006:	a8 80                	test   $0x80,%al
+  804008:	75 6c                	jne    804076 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80400a:	48 89 f9             	mov    %rdi,%rcx
+  80400d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804011:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804018:	7f 00 00 
+  80401b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80401f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804026:	40 f6 c6 01          	test   $0x1,%sil
+  80402a:	74 24                	je     804050 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80402c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804033:	7f 00 00 
+  804036:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80403a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804041:	ff ff 7f 
+  804044:	48 21 c8             	and    %rcx,%rax
+  804047:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80404d:	48 09 d0             	or     %rdx,%rax
+}
+  804050:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804051:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804058:	7f 00 00 
+  80405b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80405f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804066:	ff ff 7f 
+  804069:	48 21 c8             	and    %rcx,%rax
+  80406c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804072:	48 01 d0             	add    %rdx,%rax
+  804075:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804076:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80407d:	7f 00 00 
+  804080:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804084:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80408b:	ff ff 7f 
+  80408e:	48 21 c8             	and    %rcx,%rax
+  804091:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804097:	48 01 d0             	add    %rdx,%rax
+  80409a:	c3                   	ret
+
+000000000080409b <get_prot>:
+
+int
+get_prot(void *va) {
+  80409b:	55                   	push   %rbp
+  80409c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80409f:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8040a6:	00 00 00 
+  8040a9:	ff d0                	call   *%rax
+  8040ab:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040ae:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040b3:	89 c1                	mov    %eax,%ecx
+  8040b5:	83 c9 04             	or     $0x4,%ecx
+  8040b8:	f6 c2 01             	test   $0x1,%dl
+  8040bb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040be:	89 c1                	mov    %eax,%ecx
+  8040c0:	83 c9 02             	or     $0x2,%ecx
+  8040c3:	f6 c2 02             	test   $0x2,%dl
+  8040c6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040c9:	89 c1                	mov    %eax,%ecx
+  8040cb:	83 c9 01             	or     $0x1,%ecx
+  8040ce:	48 85 d2             	test   %rdx,%rdx
+  8040d1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040d4:	89 c1                	mov    %eax,%ecx
+  8040d6:	83 c9 40             	or     $0x40,%ecx
+  8040d9:	f6 c6 04             	test   $0x4,%dh
+  8040dc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040df:	5d                   	pop    %rbp
+  8040e0:	c3                   	ret
+
+00000000008040e1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040e1:	55                   	push   %rbp
+  8040e2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040e5:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8040ec:	00 00 00 
+  8040ef:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040f1:	48 c1 e8 06          	shr    $0x6,%rax
+  8040f5:	83 e0 01             	and    $0x1,%eax
+}
+  8040f8:	5d                   	pop    %rbp
+  8040f9:	c3                   	ret
+
+00000000008040fa <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040fa:	55                   	push   %rbp
+  8040fb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040fe:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  804105:	00 00 00 
+  804108:	ff d0                	call   *%rax
+  80410a:	83 e0 01             	and    $0x1,%eax
+}
+  80410d:	5d                   	pop    %rbp
+  80410e:	c3                   	ret
+
+000000000080410f <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  80410f:	55                   	push   %rbp
+  804110:	48 89 e5             	mov    %rsp,%rbp
+  804113:	41 57                	push   %r15
+  804115:	41 56                	push   %r14
+  804117:	41 55                	push   %r13
+  804119:	41 54                	push   %r12
+  80411b:	53                   	push   %rbx
+  80411c:	48 83 ec 18          	sub    $0x18,%rsp
+  804120:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804124:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  804128:	48 39 f7             	cmp    %rsi,%rdi
+  80412b:	0f 83 e4 00 00 00    	jae    804215 <foreach_present_page+0x106>
+  804131:	49 89 f4             	mov    %rsi,%r12
+  804134:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804137:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80413e:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804141:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804148:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80414b:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804152:	7f 00 00 
+  804155:	eb 27                	jmp    80417e <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804157:	48 89 d8             	mov    %rbx,%rax
+  80415a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80415e:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804162:	f6 c2 01             	test   $0x1,%dl
+  804165:	75 43                	jne    8041aa <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804167:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80416e:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804175:	4c 39 e3             	cmp    %r12,%rbx
+  804178:	0f 83 83 00 00 00    	jae    804201 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80417e:	48 89 d8             	mov    %rbx,%rax
+  804181:	48 c1 e8 27          	shr    $0x27,%rax
+  804185:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80418a:	a8 01                	test   $0x1,%al
+  80418c:	75 c9                	jne    804157 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80418e:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804195:	ff ff ff 
+  804198:	48 21 d8             	and    %rbx,%rax
+  80419b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8041a2:	00 00 00 
+  8041a5:	48 01 c3             	add    %rax,%rbx
+  8041a8:	eb cb                	jmp    804175 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8041aa:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8041ae:	a8 80                	test   $0x80,%al
+  8041b0:	75 1f                	jne    8041d1 <foreach_present_page+0xc2>
+  8041b2:	48 89 d8             	mov    %rbx,%rax
+  8041b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8041b9:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8041bd:	a8 01                	test   $0x1,%al
+  8041bf:	75 10                	jne    8041d1 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8041c1:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8041c8:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8041cf:	eb a4                	jmp    804175 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8041d1:	48 89 df             	mov    %rbx,%rdi
+  8041d4:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8041db:	00 00 00 
+  8041de:	ff d0                	call   *%rax
+  8041e0:	a8 01                	test   $0x1,%al
+  8041e2:	74 11                	je     8041f5 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8041e4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8041e8:	48 89 df             	mov    %rbx,%rdi
+  8041eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041ef:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8041f1:	85 c0                	test   %eax,%eax
+  8041f3:	78 11                	js     804206 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8041f5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041fc:	e9 74 ff ff ff       	jmp    804175 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804201:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804206:	48 83 c4 18          	add    $0x18,%rsp
+  80420a:	5b                   	pop    %rbx
+  80420b:	41 5c                	pop    %r12
+  80420d:	41 5d                	pop    %r13
+  80420f:	41 5e                	pop    %r14
+  804211:	41 5f                	pop    %r15
+  804213:	5d                   	pop    %rbp
+  804214:	c3                   	ret
+    return 0;
+  804215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421a:	eb ea                	jmp    804206 <foreach_present_page+0xf7>
+
+000000000080421c <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80421c:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804223:	7f 00 00 
+  804226:	a8 01                	test   $0x1,%al
+  804228:	75 06                	jne    804230 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80422a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804230:	55                   	push   %rbp
+  804231:	48 89 e5             	mov    %rsp,%rbp
+  804234:	41 57                	push   %r15
+  804236:	41 56                	push   %r14
+  804238:	41 55                	push   %r13
+  80423a:	41 54                	push   %r12
+  80423c:	53                   	push   %rbx
+  80423d:	48 83 ec 28          	sub    $0x28,%rsp
+  804241:	49 89 fe             	mov    %rdi,%r14
+  804244:	49 89 f7             	mov    %rsi,%r15
+  804247:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80424e:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80424f:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804256:	7f 00 00 
+  804259:	e9 b0 00 00 00       	jmp    80430e <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80425e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804265:	49 83 ec 01          	sub    $0x1,%r12
+  804269:	74 2d                	je     804298 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80426b:	48 89 d8             	mov    %rbx,%rax
+  80426e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804272:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804277:	f6 c2 01             	test   $0x1,%dl
+  80427a:	74 e2                	je     80425e <foreach_shared_region+0x42>
+  80427c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804281:	f6 c4 04             	test   $0x4,%ah
+  804284:	74 d8                	je     80425e <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804286:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80428d:	4c 89 fa             	mov    %r15,%rdx
+  804290:	48 89 df             	mov    %rbx,%rdi
+  804293:	41 ff d6             	call   *%r14
+  804296:	eb c6                	jmp    80425e <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804298:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80429f:	00 
+  8042a0:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8042a5:	74 4c                	je     8042f3 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8042a7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8042ab:	48 89 c8             	mov    %rcx,%rax
+  8042ae:	48 c1 e8 15          	shr    $0x15,%rax
+  8042b2:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8042b9:	7f 00 00 
+  8042bc:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8042c0:	a8 01                	test   $0x1,%al
+  8042c2:	74 d4                	je     804298 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8042c4:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8042cb:	48 39 c1             	cmp    %rax,%rcx
+  8042ce:	73 c8                	jae    804298 <foreach_shared_region+0x7c>
+  8042d0:	48 89 cb             	mov    %rcx,%rbx
+  8042d3:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8042da:	48 39 d0             	cmp    %rdx,%rax
+  8042dd:	4d 19 e4             	sbb    %r12,%r12
+  8042e0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8042e7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8042ee:	e9 78 ff ff ff       	jmp    80426b <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8042f3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8042fa:	40 
+  8042fb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042ff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804306:	00 00 00 
+  804309:	48 39 c1             	cmp    %rax,%rcx
+  80430c:	74 4f                	je     80435d <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  80430e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804312:	48 89 c8             	mov    %rcx,%rax
+  804315:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804319:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804320:	7f 00 00 
+  804323:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804327:	a8 01                	test   $0x1,%al
+  804329:	74 c8                	je     8042f3 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80432b:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804332:	48 39 c1             	cmp    %rax,%rcx
+  804335:	73 bc                	jae    8042f3 <foreach_shared_region+0xd7>
+  804337:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80433e:	48 39 d0             	cmp    %rdx,%rax
+  804341:	48 19 c0             	sbb    %rax,%rax
+  804344:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80434a:	48 05 00 02 00 00    	add    $0x200,%rax
+  804350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804354:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804358:	e9 4a ff ff ff       	jmp    8042a7 <foreach_shared_region+0x8b>
+}
+  80435d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804362:	48 83 c4 28          	add    $0x28,%rsp
+  804366:	5b                   	pop    %rbx
+  804367:	41 5c                	pop    %r12
+  804369:	41 5d                	pop    %r13
+  80436b:	41 5e                	pop    %r14
+  80436d:	41 5f                	pop    %r15
+  80436f:	5d                   	pop    %rbp
+  804370:	c3                   	ret
+
+0000000000804371 <vsys_gettime>:
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= NVSYSCALLS) {
+        return -E_INVAL;
+    }
+    return vsys[num];
+  804371:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  804378:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  80437a:	c3                   	ret
+
+000000000080437b <vsys_tsc_khz>:
+    return vsys[num];
+  80437b:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  804382:	00 00 
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
+  804384:	c3                   	ret
+
+0000000000804385 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80438a:	c3                   	ret
+
+000000000080438b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80438b:	55                   	push   %rbp
+  80438c:	48 89 e5             	mov    %rsp,%rbp
+  80438f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804392:	48 be aa 58 80 00 00 	movabs $0x8058aa,%rsi
+  804399:	00 00 00 
+  80439c:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  8043a3:	00 00 00 
+  8043a6:	ff d0                	call   *%rax
+    return 0;
+}
+  8043a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ad:	5d                   	pop    %rbp
+  8043ae:	c3                   	ret
+
+00000000008043af <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043af:	55                   	push   %rbp
+  8043b0:	48 89 e5             	mov    %rsp,%rbp
+  8043b3:	41 57                	push   %r15
+  8043b5:	41 56                	push   %r14
+  8043b7:	41 55                	push   %r13
+  8043b9:	41 54                	push   %r12
+  8043bb:	53                   	push   %rbx
+  8043bc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043c3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043ca:	48 85 d2             	test   %rdx,%rdx
+  8043cd:	74 7a                	je     804449 <devcons_write+0x9a>
+  8043cf:	49 89 d6             	mov    %rdx,%r14
+  8043d2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043d8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043dd:	49 bf ec 14 80 00 00 	movabs $0x8014ec,%r15
+  8043e4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043e7:	4c 89 f3             	mov    %r14,%rbx
+  8043ea:	48 29 f3             	sub    %rsi,%rbx
+  8043ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043f2:	48 39 c3             	cmp    %rax,%rbx
+  8043f5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8043f9:	4c 63 eb             	movslq %ebx,%r13
+  8043fc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804403:	48 01 c6             	add    %rax,%rsi
+  804406:	4c 89 ea             	mov    %r13,%rdx
+  804409:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804410:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804413:	4c 89 ee             	mov    %r13,%rsi
+  804416:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80441d:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  804424:	00 00 00 
+  804427:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804429:	41 01 dc             	add    %ebx,%r12d
+  80442c:	49 63 f4             	movslq %r12d,%rsi
+  80442f:	4c 39 f6             	cmp    %r14,%rsi
+  804432:	72 b3                	jb     8043e7 <devcons_write+0x38>
+    return res;
+  804434:	49 63 c4             	movslq %r12d,%rax
+}
+  804437:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80443e:	5b                   	pop    %rbx
+  80443f:	41 5c                	pop    %r12
+  804441:	41 5d                	pop    %r13
+  804443:	41 5e                	pop    %r14
+  804445:	41 5f                	pop    %r15
+  804447:	5d                   	pop    %rbp
+  804448:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804449:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80444f:	eb e3                	jmp    804434 <devcons_write+0x85>
+
+0000000000804451 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804451:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804454:	ba 00 00 00 00       	mov    $0x0,%edx
+  804459:	48 85 c0             	test   %rax,%rax
+  80445c:	74 60                	je     8044be <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80445e:	55                   	push   %rbp
+  80445f:	48 89 e5             	mov    %rsp,%rbp
+  804462:	41 55                	push   %r13
+  804464:	41 54                	push   %r12
+  804466:	53                   	push   %rbx
+  804467:	48 83 ec 18          	sub    $0x18,%rsp
+  80446b:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80446e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804475:	48 bb 46 17 80 00 00 	movabs $0x801746,%rbx
+  80447c:	00 00 00 
+  80447f:	49 bc af 3d 80 00 00 	movabs $0x803daf,%r12
+  804486:	00 00 00 
+  804489:	eb 07                	jmp    804492 <devcons_read+0x41>
+  80448b:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80448f:	41 ff d4             	call   *%r12
+  804492:	ff d3                	call   *%rbx
+  804494:	85 c0                	test   %eax,%eax
+  804496:	74 f3                	je     80448b <devcons_read+0x3a>
+    if (c < 0) return c;
+  804498:	48 63 d0             	movslq %eax,%rdx
+  80449b:	78 13                	js     8044b0 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80449d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a2:	83 f8 04             	cmp    $0x4,%eax
+  8044a5:	74 09                	je     8044b0 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8044a7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044ab:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044b0:	48 89 d0             	mov    %rdx,%rax
+  8044b3:	48 83 c4 18          	add    $0x18,%rsp
+  8044b7:	5b                   	pop    %rbx
+  8044b8:	41 5c                	pop    %r12
+  8044ba:	41 5d                	pop    %r13
+  8044bc:	5d                   	pop    %rbp
+  8044bd:	c3                   	ret
+  8044be:	48 89 d0             	mov    %rdx,%rax
+  8044c1:	c3                   	ret
+
+00000000008044c2 <cputchar>:
+cputchar(int ch) {
+  8044c2:	55                   	push   %rbp
+  8044c3:	48 89 e5             	mov    %rsp,%rbp
+  8044c6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044ca:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8044d3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044d7:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+}
+  8044e3:	c9                   	leave
+  8044e4:	c3                   	ret
+
+00000000008044e5 <getchar>:
+getchar(void) {
+  8044e5:	55                   	push   %rbp
+  8044e6:	48 89 e5             	mov    %rsp,%rbp
+  8044e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044f2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044fb:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  804502:	00 00 00 
+  804505:	ff d0                	call   *%rax
+  804507:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804509:	85 c0                	test   %eax,%eax
+  80450b:	78 06                	js     804513 <getchar+0x2e>
+  80450d:	74 08                	je     804517 <getchar+0x32>
+  80450f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804513:	89 d0                	mov    %edx,%eax
+  804515:	c9                   	leave
+  804516:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804517:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80451c:	eb f5                	jmp    804513 <getchar+0x2e>
+
+000000000080451e <iscons>:
+iscons(int fdnum) {
+  80451e:	55                   	push   %rbp
+  80451f:	48 89 e5             	mov    %rsp,%rbp
+  804522:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804526:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80452a:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  804531:	00 00 00 
+  804534:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804536:	85 c0                	test   %eax,%eax
+  804538:	78 18                	js     804552 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80453a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80453e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804545:	00 00 00 
+  804548:	8b 00                	mov    (%rax),%eax
+  80454a:	39 02                	cmp    %eax,(%rdx)
+  80454c:	0f 94 c0             	sete   %al
+  80454f:	0f b6 c0             	movzbl %al,%eax
+}
+  804552:	c9                   	leave
+  804553:	c3                   	ret
+
+0000000000804554 <opencons>:
+opencons(void) {
+  804554:	55                   	push   %rbp
+  804555:	48 89 e5             	mov    %rsp,%rbp
+  804558:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80455c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804560:	48 b8 ea 22 80 00 00 	movabs $0x8022ea,%rax
+  804567:	00 00 00 
+  80456a:	ff d0                	call   *%rax
+  80456c:	85 c0                	test   %eax,%eax
+  80456e:	78 49                	js     8045b9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804570:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804575:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80457a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80457e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804583:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  80458a:	00 00 00 
+  80458d:	ff d0                	call   *%rax
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	78 26                	js     8045b9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804593:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804597:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80459e:	00 00 
+  8045a0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045a6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045ad:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8045b4:	00 00 00 
+  8045b7:	ff d0                	call   *%rax
+}
+  8045b9:	c9                   	leave
+  8045ba:	c3                   	ret
+
+00000000008045bb <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8045bb:	55                   	push   %rbp
+  8045bc:	48 89 e5             	mov    %rsp,%rbp
+  8045bf:	41 55                	push   %r13
+  8045c1:	41 54                	push   %r12
+  8045c3:	53                   	push   %rbx
+  8045c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c8:	49 89 fc             	mov    %rdi,%r12
+  8045cb:	48 89 f7             	mov    %rsi,%rdi
+  8045ce:	48 89 d3             	mov    %rdx,%rbx
+  8045d1:	49 89 cd             	mov    %rcx,%r13
+  8045d4:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045d7:	48 85 f6             	test   %rsi,%rsi
+  8045da:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045e1:	00 00 00 
+  8045e4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8045e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ed:	48 85 db             	test   %rbx,%rbx
+  8045f0:	74 03                	je     8045f5 <ipc_recv_timeout+0x3a>
+  8045f2:	48 8b 33             	mov    (%rbx),%rsi
+  8045f5:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8045fc:	00 00 00 
+  8045ff:	ff d0                	call   *%rax
+    if (res == 0) {
+  804601:	85 c0                	test   %eax,%eax
+  804603:	75 72                	jne    804677 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804605:	4d 85 e4             	test   %r12,%r12
+  804608:	74 17                	je     804621 <ipc_recv_timeout+0x66>
+  80460a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804611:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804613:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804617:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80461d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804621:	4d 85 ed             	test   %r13,%r13
+  804624:	74 17                	je     80463d <ipc_recv_timeout+0x82>
+  804626:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80462d:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  80462f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804633:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804639:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80463d:	48 85 db             	test   %rbx,%rbx
+  804640:	74 17                	je     804659 <ipc_recv_timeout+0x9e>
+  804642:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804649:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80464b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80464f:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804656:	48 89 03             	mov    %rax,(%rbx)
+  804659:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804660:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804662:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804666:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80466c:	48 83 c4 08          	add    $0x8,%rsp
+  804670:	5b                   	pop    %rbx
+  804671:	41 5c                	pop    %r12
+  804673:	41 5d                	pop    %r13
+  804675:	5d                   	pop    %rbp
+  804676:	c3                   	ret
+        if (from_env_store) {
+  804677:	4d 85 e4             	test   %r12,%r12
+  80467a:	74 08                	je     804684 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80467c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804683:	00 
+        if (perm_store) {
+  804684:	4d 85 ed             	test   %r13,%r13
+  804687:	74 08                	je     804691 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804689:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804690:	00 
+        if (size) {
+  804691:	48 85 db             	test   %rbx,%rbx
+  804694:	74 d6                	je     80466c <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804696:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80469d:	eb cd                	jmp    80466c <ipc_recv_timeout+0xb1>
+
+000000000080469f <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80469f:	55                   	push   %rbp
+  8046a0:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  8046a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046a9:	48 b8 bb 45 80 00 00 	movabs $0x8045bb,%rax
+  8046b0:	00 00 00 
+  8046b3:	ff d0                	call   *%rax
+}
+  8046b5:	5d                   	pop    %rbp
+  8046b6:	c3                   	ret
+
+00000000008046b7 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046b7:	55                   	push   %rbp
+  8046b8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046bb:	48 85 d2             	test   %rdx,%rdx
+  8046be:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046c5:	00 00 00 
+  8046c8:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8046cc:	89 f6                	mov    %esi,%esi
+  8046ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046d4:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  8046db:	00 00 00 
+  8046de:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8046e0:	85 c0                	test   %eax,%eax
+  8046e2:	78 02                	js     8046e6 <ipc_send+0x2f>
+}
+  8046e4:	5d                   	pop    %rbp
+  8046e5:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8046e6:	89 c1                	mov    %eax,%ecx
+  8046e8:	48 ba b6 58 80 00 00 	movabs $0x8058b6,%rdx
+  8046ef:	00 00 00 
+  8046f2:	be 51 00 00 00       	mov    $0x51,%esi
+  8046f7:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  8046fe:	00 00 00 
+  804701:	b8 00 00 00 00       	mov    $0x0,%eax
+  804706:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  80470d:	00 00 00 
+  804710:	41 ff d0             	call   *%r8
+
+0000000000804713 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804713:	55                   	push   %rbp
+  804714:	48 89 e5             	mov    %rsp,%rbp
+  804717:	41 54                	push   %r12
+  804719:	53                   	push   %rbx
+  80471a:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80471e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804722:	48 85 d2             	test   %rdx,%rdx
+  804725:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80472c:	00 00 00 
+  80472f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804733:	4d 85 c9             	test   %r9,%r9
+  804736:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80473a:	89 f6                	mov    %esi,%esi
+  80473c:	48 83 ec 08          	sub    $0x8,%rsp
+  804740:	53                   	push   %rbx
+  804741:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  804748:	00 00 00 
+  80474b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80474d:	48 83 c4 10          	add    $0x10,%rsp
+  804751:	85 c0                	test   %eax,%eax
+  804753:	78 65                	js     8047ba <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804755:	4d 85 e4             	test   %r12,%r12
+  804758:	74 17                	je     804771 <ipc_call+0x5e>
+  80475a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804761:	00 00 
+  804763:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804767:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80476d:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804771:	48 85 db             	test   %rbx,%rbx
+  804774:	74 28                	je     80479e <ipc_call+0x8b>
+  804776:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80477d:	00 00 
+  80477f:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804783:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80478a:	ba 20 00 00 00       	mov    $0x20,%edx
+  80478f:	48 89 df             	mov    %rbx,%rdi
+  804792:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  804799:	00 00 00 
+  80479c:	ff d0                	call   *%rax
+  80479e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047a5:	00 00 
+    return thisenv->env_ipc_value;
+  8047a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047ab:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8047b1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8047b5:	5b                   	pop    %rbx
+  8047b6:	41 5c                	pop    %r12
+  8047b8:	5d                   	pop    %rbp
+  8047b9:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8047ba:	89 c1                	mov    %eax,%ecx
+  8047bc:	48 ba d7 58 80 00 00 	movabs $0x8058d7,%rdx
+  8047c3:	00 00 00 
+  8047c6:	be 62 00 00 00       	mov    $0x62,%esi
+  8047cb:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  8047d2:	00 00 00 
+  8047d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047da:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  8047e1:	00 00 00 
+  8047e4:	41 ff d0             	call   *%r8
+
+00000000008047e7 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8047e7:	55                   	push   %rbp
+  8047e8:	48 89 e5             	mov    %rsp,%rbp
+  8047eb:	41 57                	push   %r15
+  8047ed:	41 56                	push   %r14
+  8047ef:	41 55                	push   %r13
+  8047f1:	41 54                	push   %r12
+  8047f3:	53                   	push   %rbx
+  8047f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8047f8:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8047fb:	48 89 d3             	mov    %rdx,%rbx
+  8047fe:	49 89 ce             	mov    %rcx,%r14
+  804801:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804805:	4d 89 cd             	mov    %r9,%r13
+  804808:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80480c:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804810:	48 85 d2             	test   %rdx,%rdx
+  804813:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80481a:	00 00 00 
+  80481d:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804821:	4d 85 e4             	test   %r12,%r12
+  804824:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804828:	89 f0                	mov    %esi,%eax
+  80482a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80482e:	41 57                	push   %r15
+  804830:	4d 89 e1             	mov    %r12,%r9
+  804833:	48 89 da             	mov    %rbx,%rdx
+  804836:	48 89 c6             	mov    %rax,%rsi
+  804839:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  804840:	00 00 00 
+  804843:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804845:	48 83 c4 10          	add    $0x10,%rsp
+  804849:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80484c:	0f 84 93 00 00 00    	je     8048e5 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804852:	85 c0                	test   %eax,%eax
+  804854:	0f 88 f3 00 00 00    	js     80494d <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80485a:	4d 85 ed             	test   %r13,%r13
+  80485d:	74 17                	je     804876 <ipc_reply_wait+0x8f>
+  80485f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804866:	00 00 
+  804868:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80486c:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804872:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804876:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80487b:	74 19                	je     804896 <ipc_reply_wait+0xaf>
+  80487d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804884:	00 00 
+  804886:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80488a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804890:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804894:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804896:	4d 85 ff             	test   %r15,%r15
+  804899:	74 28                	je     8048c3 <ipc_reply_wait+0xdc>
+  80489b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8048a2:	00 00 
+  8048a4:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8048a8:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8048af:	ba 20 00 00 00       	mov    $0x20,%edx
+  8048b4:	4c 89 ff             	mov    %r15,%rdi
+  8048b7:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  8048be:	00 00 00 
+  8048c1:	ff d0                	call   *%rax
+  8048c3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8048ca:	00 00 
+    return thisenv->env_ipc_value;
+  8048cc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8048d0:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8048d6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8048da:	5b                   	pop    %rbx
+  8048db:	41 5c                	pop    %r12
+  8048dd:	41 5d                	pop    %r13
+  8048df:	41 5e                	pop    %r14
+  8048e1:	41 5f                	pop    %r15
+  8048e3:	5d                   	pop    %rbp
+  8048e4:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8048e5:	4d 89 f9             	mov    %r15,%r9
+  8048e8:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8048ec:	4c 89 f1             	mov    %r14,%rcx
+  8048ef:	48 89 da             	mov    %rbx,%rdx
+  8048f2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8048f6:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8048f9:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  804900:	00 00 00 
+  804903:	ff d0                	call   *%rax
+  804905:	85 c0                	test   %eax,%eax
+  804907:	78 17                	js     804920 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804909:	4c 89 f6             	mov    %r14,%rsi
+  80490c:	4c 89 e7             	mov    %r12,%rdi
+  80490f:	48 b8 24 1d 80 00 00 	movabs $0x801d24,%rax
+  804916:	00 00 00 
+  804919:	ff d0                	call   *%rax
+  80491b:	e9 32 ff ff ff       	jmp    804852 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804920:	89 c1                	mov    %eax,%ecx
+  804922:	48 ba b6 58 80 00 00 	movabs $0x8058b6,%rdx
+  804929:	00 00 00 
+  80492c:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804931:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  804938:	00 00 00 
+  80493b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804940:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  804947:	00 00 00 
+  80494a:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80494d:	89 c1                	mov    %eax,%ecx
+  80494f:	48 ba ee 58 80 00 00 	movabs $0x8058ee,%rdx
+  804956:	00 00 00 
+  804959:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80495e:	48 bf cd 58 80 00 00 	movabs $0x8058cd,%rdi
+  804965:	00 00 00 
+  804968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80496d:	49 b8 7d 08 80 00 00 	movabs $0x80087d,%r8
+  804974:	00 00 00 
+  804977:	41 ff d0             	call   *%r8
+
+000000000080497a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80497a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80497f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804986:	00 00 00 
+  804989:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804990:	48 01 ca             	add    %rcx,%rdx
+  804993:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804999:	39 fa                	cmp    %edi,%edx
+  80499b:	74 12                	je     8049af <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80499d:	48 83 c0 01          	add    $0x1,%rax
+  8049a1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8049a7:	75 e0                	jne    804989 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8049a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049ae:	c3                   	ret
+            return envs[i].env_id;
+  8049af:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8049b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049bd:	00 00 00 
+  8049c0:	48 01 d0             	add    %rdx,%rax
+  8049c3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8049c9:	c3                   	ret
+
+00000000008049ca <__text_end>:
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8090 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 29 03 00 00       	call   80034c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba ac 05 80 00 00 	movabs $0x8005ac,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 45 3d 80 00 00 	movabs $0x803d45,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 7f 01 00 00    	js     8001e8 <umain+0x1c3>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 95 01 00 00    	js     800215 <umain+0x1f0>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 b8 01 00 00    	je     800242 <umain+0x21d>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 5a 50 80 00 00 	movabs $0x80505a,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 bc ac 05 80 00 00 	movabs $0x8005ac,%r12
+  8000a5:	00 00 00 
+  8000a8:	41 ff d4             	call   *%r12
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	41 89 dd             	mov    %ebx,%r13d
+  8000ae:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000b5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000bb:	48 69 db 98 01 00 00 	imul   $0x198,%rbx,%rbx
+  8000c2:	48 89 de             	mov    %rbx,%rsi
+  8000c5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8000c9:	69 f6 fb fa fa fa    	imul   $0xfafafafb,%esi,%esi
+  8000cf:	48 bf 65 50 80 00 00 	movabs $0x805065,%rdi
+  8000d6:	00 00 00 
+  8000d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000de:	41 ff d4             	call   *%r12
+    dup(p[0], 10);
+  8000e1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000e6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000e9:	48 b8 fb 24 80 00 00 	movabs $0x8024fb,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000f5:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8000fc:	00 00 00 
+  8000ff:	48 01 d8             	add    %rbx,%rax
+  800102:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800108:	83 f8 02             	cmp    $0x2,%eax
+  80010b:	75 37                	jne    800144 <umain+0x11f>
+        dup(p[0], 10);
+  80010d:	49 bc fb 24 80 00 00 	movabs $0x8024fb,%r12
+  800114:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  800117:	4d 63 ed             	movslq %r13d,%r13
+  80011a:	4d 69 ed 98 01 00 00 	imul   $0x198,%r13,%r13
+  800121:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  800128:	00 00 00 
+  80012b:	4c 01 eb             	add    %r13,%rbx
+        dup(p[0], 10);
+  80012e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800133:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800136:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  800139:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  80013f:	83 f8 02             	cmp    $0x2,%eax
+  800142:	74 ea                	je     80012e <umain+0x109>
+
+    cprintf("child done with loop\n");
+  800144:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  80014b:	00 00 00 
+  80014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800153:	48 ba ac 05 80 00 00 	movabs $0x8005ac,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80015f:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800162:	48 b8 5c 3d 80 00 00 	movabs $0x803d5c,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	0f 85 5a 01 00 00    	jne    8002d0 <umain+0x2ab>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800176:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80017a:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80017d:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 88 69 01 00 00    	js     8002fa <umain+0x2d5>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  800191:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800195:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+  8001a1:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  8001a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001a9:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+  8001b5:	83 f8 04             	cmp    $0x4,%eax
+  8001b8:	0f 84 69 01 00 00    	je     800327 <umain+0x302>
+        cprintf("\nchild detected race\n");
+  8001be:	48 bf 9e 50 80 00 00 	movabs $0x80509e,%rdi
+  8001c5:	00 00 00 
+  8001c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cd:	48 ba ac 05 80 00 00 	movabs $0x8005ac,%rdx
+  8001d4:	00 00 00 
+  8001d7:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001d9:	48 83 c4 28          	add    $0x28,%rsp
+  8001dd:	5b                   	pop    %rbx
+  8001de:	41 5c                	pop    %r12
+  8001e0:	41 5d                	pop    %r13
+  8001e2:	41 5e                	pop    %r14
+  8001e4:	41 5f                	pop    %r15
+  8001e6:	5d                   	pop    %rbp
+  8001e7:	c3                   	ret
+        panic("pipe: %i", r);
+  8001e8:	89 c1                	mov    %eax,%ecx
+  8001ea:	48 ba 19 50 80 00 00 	movabs $0x805019,%rdx
+  8001f1:	00 00 00 
+  8001f4:	be 0c 00 00 00       	mov    $0xc,%esi
+  8001f9:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  800200:	00 00 00 
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  80020f:	00 00 00 
+  800212:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800215:	89 c1                	mov    %eax,%ecx
+  800217:	48 ba 36 50 80 00 00 	movabs $0x805036,%rdx
+  80021e:	00 00 00 
+  800221:	be 0f 00 00 00       	mov    $0xf,%esi
+  800226:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  80022d:	00 00 00 
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  80023c:	00 00 00 
+  80023f:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800242:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800245:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+  800251:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  800256:	49 bc 5c 3d 80 00 00 	movabs $0x803d5c,%r12
+  80025d:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  800260:	49 bf 3f 50 80 00 00 	movabs $0x80503f,%r15
+  800267:	00 00 00 
+  80026a:	49 be ac 05 80 00 00 	movabs $0x8005ac,%r14
+  800271:	00 00 00 
+                exit();
+  800274:	49 bd 39 04 80 00 00 	movabs $0x800439,%r13
+  80027b:	00 00 00 
+  80027e:	eb 11                	jmp    800291 <umain+0x26c>
+            sys_yield();
+  800280:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  80028c:	83 eb 01             	sub    $0x1,%ebx
+  80028f:	74 1a                	je     8002ab <umain+0x286>
+            if (pipeisclosed(p[0])) {
+  800291:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800294:	41 ff d4             	call   *%r12
+  800297:	85 c0                	test   %eax,%eax
+  800299:	74 e5                	je     800280 <umain+0x25b>
+                cprintf("RACE: pipe appears closed\n");
+  80029b:	4c 89 ff             	mov    %r15,%rdi
+  80029e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a3:	41 ff d6             	call   *%r14
+                exit();
+  8002a6:	41 ff d5             	call   *%r13
+  8002a9:	eb d5                	jmp    800280 <umain+0x25b>
+        ipc_recv(0, 0, 0, 0);
+  8002ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bf:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  8002c6:	00 00 00 
+  8002c9:	ff d0                	call   *%rax
+  8002cb:	e9 ba fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002d0:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8002d7:	00 00 00 
+  8002da:	be 38 00 00 00       	mov    $0x38,%esi
+  8002df:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  8002e6:	00 00 00 
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	48 b9 5c 04 80 00 00 	movabs $0x80045c,%rcx
+  8002f5:	00 00 00 
+  8002f8:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002fa:	89 c1                	mov    %eax,%ecx
+  8002fc:	48 ba 86 50 80 00 00 	movabs $0x805086,%rdx
+  800303:	00 00 00 
+  800306:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80030b:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  800312:	00 00 00 
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  800321:	00 00 00 
+  800324:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  800327:	be c8 00 00 00       	mov    $0xc8,%esi
+  80032c:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  800333:	00 00 00 
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	48 ba ac 05 80 00 00 	movabs $0x8005ac,%rdx
+  800342:	00 00 00 
+  800345:	ff d2                	call   *%rdx
+}
+  800347:	e9 8d fe ff ff       	jmp    8001d9 <umain+0x1b4>
+
+000000000080034c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80034c:	55                   	push   %rbp
+  80034d:	48 89 e5             	mov    %rsp,%rbp
+  800350:	41 56                	push   %r14
+  800352:	41 55                	push   %r13
+  800354:	41 54                	push   %r12
+  800356:	53                   	push   %rbx
+  800357:	48 83 ec 30          	sub    $0x30,%rsp
+  80035b:	41 89 fd             	mov    %edi,%r13d
+  80035e:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800361:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800368:	00 
+  800369:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800370:	00 
+  800371:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800378:	00 
+  800379:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800380:	00 
+  800381:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800385:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800389:	bf 00 00 00 00       	mov    $0x0,%edi
+  80038e:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80039a:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003a1:	00 00 00 
+  8003a4:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003ab:	00 00 00 
+  8003ae:	48 39 c2             	cmp    %rax,%rdx
+  8003b1:	73 17                	jae    8003ca <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003b3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003b6:	49 89 c4             	mov    %rax,%r12
+  8003b9:	48 83 c3 08          	add    $0x8,%rbx
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	ff 53 f8             	call   *-0x8(%rbx)
+  8003c5:	4c 39 e3             	cmp    %r12,%rbx
+  8003c8:	72 ef                	jb     8003b9 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003ca:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8003d1:	00 00 00 
+  8003d4:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8003d6:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8003dd:	00 00 
+  8003df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003e4:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8003eb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8003f2:	00 00 00 
+  8003f5:	48 01 c8             	add    %rcx,%rax
+  8003f8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003fc:	45 85 ed             	test   %r13d,%r13d
+  8003ff:	7e 0d                	jle    80040e <libmain+0xc2>
+  800401:	49 8b 06             	mov    (%r14),%rax
+  800404:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80040b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80040e:	4c 89 f6             	mov    %r14,%rsi
+  800411:	44 89 ef             	mov    %r13d,%edi
+  800414:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800420:	48 b8 39 04 80 00 00 	movabs $0x800439,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+#endif
+}
+  80042c:	48 83 c4 30          	add    $0x30,%rsp
+  800430:	5b                   	pop    %rbx
+  800431:	41 5c                	pop    %r12
+  800433:	41 5d                	pop    %r13
+  800435:	41 5e                	pop    %r14
+  800437:	5d                   	pop    %rbp
+  800438:	c3                   	ret
+
+0000000000800439 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800439:	55                   	push   %rbp
+  80043a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80043d:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  800444:	00 00 00 
+  800447:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800449:	bf 00 00 00 00       	mov    $0x0,%edi
+  80044e:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  800455:	00 00 00 
+  800458:	ff d0                	call   *%rax
+}
+  80045a:	5d                   	pop    %rbp
+  80045b:	c3                   	ret
+
+000000000080045c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80045c:	55                   	push   %rbp
+  80045d:	48 89 e5             	mov    %rsp,%rbp
+  800460:	41 56                	push   %r14
+  800462:	41 55                	push   %r13
+  800464:	41 54                	push   %r12
+  800466:	53                   	push   %rbx
+  800467:	48 83 ec 50          	sub    $0x50,%rsp
+  80046b:	49 89 fc             	mov    %rdi,%r12
+  80046e:	41 89 f5             	mov    %esi,%r13d
+  800471:	48 89 d3             	mov    %rdx,%rbx
+  800474:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800478:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80047c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800480:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800487:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80048f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800493:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800497:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80049e:	00 00 00 
+  8004a1:	4c 8b 30             	mov    (%rax),%r14
+  8004a4:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+  8004b0:	89 c6                	mov    %eax,%esi
+  8004b2:	45 89 e8             	mov    %r13d,%r8d
+  8004b5:	4c 89 e1             	mov    %r12,%rcx
+  8004b8:	4c 89 f2             	mov    %r14,%rdx
+  8004bb:	48 bf 20 51 80 00 00 	movabs $0x805120,%rdi
+  8004c2:	00 00 00 
+  8004c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ca:	49 bc ac 05 80 00 00 	movabs $0x8005ac,%r12
+  8004d1:	00 00 00 
+  8004d4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004d7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004db:	48 89 df             	mov    %rbx,%rdi
+  8004de:	48 b8 48 05 80 00 00 	movabs $0x800548,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004ea:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  8004f1:	00 00 00 
+  8004f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004fc:	cc                   	int3
+  8004fd:	eb fd                	jmp    8004fc <_panic+0xa0>
+
+00000000008004ff <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004ff:	55                   	push   %rbp
+  800500:	48 89 e5             	mov    %rsp,%rbp
+  800503:	53                   	push   %rbx
+  800504:	48 83 ec 08          	sub    $0x8,%rsp
+  800508:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80050b:	8b 06                	mov    (%rsi),%eax
+  80050d:	8d 50 01             	lea    0x1(%rax),%edx
+  800510:	89 16                	mov    %edx,(%rsi)
+  800512:	48 98                	cltq
+  800514:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800519:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80051f:	74 0a                	je     80052b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800521:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800529:	c9                   	leave
+  80052a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80052b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80052f:	be ff 00 00 00       	mov    $0xff,%esi
+  800534:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  80053b:	00 00 00 
+  80053e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800540:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800546:	eb d9                	jmp    800521 <putch+0x22>
+
+0000000000800548 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800548:	55                   	push   %rbp
+  800549:	48 89 e5             	mov    %rsp,%rbp
+  80054c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800553:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800556:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80055d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800562:	b8 00 00 00 00       	mov    $0x0,%eax
+  800567:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80056a:	48 89 f1             	mov    %rsi,%rcx
+  80056d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800574:	48 bf ff 04 80 00 00 	movabs $0x8004ff,%rdi
+  80057b:	00 00 00 
+  80057e:	48 b8 fc 06 80 00 00 	movabs $0x8006fc,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80058a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800591:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800598:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  80059f:	00 00 00 
+  8005a2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005a4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005aa:	c9                   	leave
+  8005ab:	c3                   	ret
+
+00000000008005ac <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005ac:	55                   	push   %rbp
+  8005ad:	48 89 e5             	mov    %rsp,%rbp
+  8005b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005b8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005bc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005c8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005db:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005df:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005e3:	48 b8 48 05 80 00 00 	movabs $0x800548,%rax
+  8005ea:	00 00 00 
+  8005ed:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005ef:	c9                   	leave
+  8005f0:	c3                   	ret
+
+00000000008005f1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005f1:	55                   	push   %rbp
+  8005f2:	48 89 e5             	mov    %rsp,%rbp
+  8005f5:	41 57                	push   %r15
+  8005f7:	41 56                	push   %r14
+  8005f9:	41 55                	push   %r13
+  8005fb:	41 54                	push   %r12
+  8005fd:	53                   	push   %rbx
+  8005fe:	48 83 ec 18          	sub    $0x18,%rsp
+  800602:	49 89 fc             	mov    %rdi,%r12
+  800605:	49 89 f5             	mov    %rsi,%r13
+  800608:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80060c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80060f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800612:	41 89 cf             	mov    %ecx,%r15d
+  800615:	4c 39 fa             	cmp    %r15,%rdx
+  800618:	73 5b                	jae    800675 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80061a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80061e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800622:	85 db                	test   %ebx,%ebx
+  800624:	7e 0e                	jle    800634 <print_num+0x43>
+            putch(padc, put_arg);
+  800626:	4c 89 ee             	mov    %r13,%rsi
+  800629:	44 89 f7             	mov    %r14d,%edi
+  80062c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80062f:	83 eb 01             	sub    $0x1,%ebx
+  800632:	75 f2                	jne    800626 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800634:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800638:	48 b9 54 51 80 00 00 	movabs $0x805154,%rcx
+  80063f:	00 00 00 
+  800642:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  800649:	00 00 00 
+  80064c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800650:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800654:	ba 00 00 00 00       	mov    $0x0,%edx
+  800659:	49 f7 f7             	div    %r15
+  80065c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800660:	4c 89 ee             	mov    %r13,%rsi
+  800663:	41 ff d4             	call   *%r12
+}
+  800666:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80066a:	5b                   	pop    %rbx
+  80066b:	41 5c                	pop    %r12
+  80066d:	41 5d                	pop    %r13
+  80066f:	41 5e                	pop    %r14
+  800671:	41 5f                	pop    %r15
+  800673:	5d                   	pop    %rbp
+  800674:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800675:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067e:	49 f7 f7             	div    %r15
+  800681:	48 83 ec 08          	sub    $0x8,%rsp
+  800685:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800689:	52                   	push   %rdx
+  80068a:	45 0f be c9          	movsbl %r9b,%r9d
+  80068e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800692:	48 89 c2             	mov    %rax,%rdx
+  800695:	48 b8 f1 05 80 00 00 	movabs $0x8005f1,%rax
+  80069c:	00 00 00 
+  80069f:	ff d0                	call   *%rax
+  8006a1:	48 83 c4 10          	add    $0x10,%rsp
+  8006a5:	eb 8d                	jmp    800634 <print_num+0x43>
+
+00000000008006a7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006a7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006ab:	48 8b 06             	mov    (%rsi),%rax
+  8006ae:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006b2:	73 0a                	jae    8006be <sprintputch+0x17>
+        *state->start++ = ch;
+  8006b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006b8:	48 89 16             	mov    %rdx,(%rsi)
+  8006bb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006be:	c3                   	ret
+
+00000000008006bf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	48 83 ec 50          	sub    $0x50,%rsp
+  8006c7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006cb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006cf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006d3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006ea:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006ee:	48 b8 fc 06 80 00 00 	movabs $0x8006fc,%rax
+  8006f5:	00 00 00 
+  8006f8:	ff d0                	call   *%rax
+}
+  8006fa:	c9                   	leave
+  8006fb:	c3                   	ret
+
+00000000008006fc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006fc:	55                   	push   %rbp
+  8006fd:	48 89 e5             	mov    %rsp,%rbp
+  800700:	41 57                	push   %r15
+  800702:	41 56                	push   %r14
+  800704:	41 55                	push   %r13
+  800706:	41 54                	push   %r12
+  800708:	53                   	push   %rbx
+  800709:	48 83 ec 38          	sub    $0x38,%rsp
+  80070d:	49 89 fe             	mov    %rdi,%r14
+  800710:	49 89 f5             	mov    %rsi,%r13
+  800713:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800716:	48 8b 01             	mov    (%rcx),%rax
+  800719:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80071d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800721:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800725:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800729:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80072d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800731:	0f b6 3b             	movzbl (%rbx),%edi
+  800734:	40 80 ff 25          	cmp    $0x25,%dil
+  800738:	74 18                	je     800752 <vprintfmt+0x56>
+            if (!ch) return;
+  80073a:	40 84 ff             	test   %dil,%dil
+  80073d:	0f 84 b1 06 00 00    	je     800df4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800743:	40 0f b6 ff          	movzbl %dil,%edi
+  800747:	4c 89 ee             	mov    %r13,%rsi
+  80074a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80074d:	4c 89 e3             	mov    %r12,%rbx
+  800750:	eb db                	jmp    80072d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800752:	be 00 00 00 00       	mov    $0x0,%esi
+  800757:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80075b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800760:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800766:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80076d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800771:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800776:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80077b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80077e:	83 e8 23             	sub    $0x23,%eax
+  800781:	3c 57                	cmp    $0x57,%al
+  800783:	0f 87 51 06 00 00    	ja     800dda <vprintfmt+0x6de>
+  800789:	0f b6 c0             	movzbl %al,%eax
+  80078c:	48 b9 00 53 80 00 00 	movabs $0x805300,%rcx
+  800793:	00 00 00 
+  800796:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800799:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80079c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a0:	eb cf                	jmp    800771 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+  8007a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8007aa:	eb c5                	jmp    800771 <vprintfmt+0x75>
+            padc = ch;
+  8007ac:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007b6:	eb b9                	jmp    800771 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007be:	77 24                	ja     8007e4 <vprintfmt+0xe8>
+  8007c0:	89 c1                	mov    %eax,%ecx
+  8007c2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007c6:	83 c0 08             	add    $0x8,%eax
+  8007c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007cf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007d2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007d6:	79 99                	jns    800771 <vprintfmt+0x75>
+                width = precision;
+  8007d8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007dc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e2:	eb 8d                	jmp    800771 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007e8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f0:	eb da                	jmp    8007cc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007f2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007f7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007fb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800801:	3c 39                	cmp    $0x39,%al
+  800803:	77 1c                	ja     800821 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800805:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800809:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80080d:	0f b6 c0             	movzbl %al,%eax
+  800810:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800815:	0f b6 03             	movzbl (%rbx),%eax
+  800818:	3c 39                	cmp    $0x39,%al
+  80081a:	76 e9                	jbe    800805 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80081c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80081f:	eb b1                	jmp    8007d2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800821:	49 89 dc             	mov    %rbx,%r12
+  800824:	eb ac                	jmp    8007d2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800826:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800829:	85 c9                	test   %ecx,%ecx
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	0f 49 c1             	cmovns %ecx,%eax
+  800833:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800836:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800839:	e9 33 ff ff ff       	jmp    800771 <vprintfmt+0x75>
+            lflag++;
+  80083e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800841:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800844:	e9 28 ff ff ff       	jmp    800771 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800849:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084c:	83 f8 2f             	cmp    $0x2f,%eax
+  80084f:	77 19                	ja     80086a <vprintfmt+0x16e>
+  800851:	89 c2                	mov    %eax,%edx
+  800853:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800857:	83 c0 08             	add    $0x8,%eax
+  80085a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085d:	8b 3a                	mov    (%rdx),%edi
+  80085f:	4c 89 ee             	mov    %r13,%rsi
+  800862:	41 ff d6             	call   *%r14
+            break;
+  800865:	e9 c3 fe ff ff       	jmp    80072d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80086a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800876:	eb e5                	jmp    80085d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800878:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087b:	83 f8 2f             	cmp    $0x2f,%eax
+  80087e:	77 5a                	ja     8008da <vprintfmt+0x1de>
+  800880:	89 c2                	mov    %eax,%edx
+  800882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800886:	83 c0 08             	add    $0x8,%eax
+  800889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80088c:	8b 02                	mov    (%rdx),%eax
+  80088e:	89 c1                	mov    %eax,%ecx
+  800890:	f7 d9                	neg    %ecx
+  800892:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800895:	83 f9 16             	cmp    $0x16,%ecx
+  800898:	7f 4e                	jg     8008e8 <vprintfmt+0x1ec>
+  80089a:	48 63 c1             	movslq %ecx,%rax
+  80089d:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8008a4:	00 00 00 
+  8008a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008ab:	48 85 c0             	test   %rax,%rax
+  8008ae:	74 38                	je     8008e8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b0:	48 89 c1             	mov    %rax,%rcx
+  8008b3:	48 ba 19 58 80 00 00 	movabs $0x805819,%rdx
+  8008ba:	00 00 00 
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	4c 89 f7             	mov    %r14,%rdi
+  8008c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c8:	49 b8 bf 06 80 00 00 	movabs $0x8006bf,%r8
+  8008cf:	00 00 00 
+  8008d2:	41 ff d0             	call   *%r8
+  8008d5:	e9 53 fe ff ff       	jmp    80072d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e6:	eb a4                	jmp    80088c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008e8:	48 ba 6c 51 80 00 00 	movabs $0x80516c,%rdx
+  8008ef:	00 00 00 
+  8008f2:	4c 89 ee             	mov    %r13,%rsi
+  8008f5:	4c 89 f7             	mov    %r14,%rdi
+  8008f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fd:	49 b8 bf 06 80 00 00 	movabs $0x8006bf,%r8
+  800904:	00 00 00 
+  800907:	41 ff d0             	call   *%r8
+  80090a:	e9 1e fe ff ff       	jmp    80072d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80090f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800912:	83 f8 2f             	cmp    $0x2f,%eax
+  800915:	77 6c                	ja     800983 <vprintfmt+0x287>
+  800917:	89 c2                	mov    %eax,%edx
+  800919:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091d:	83 c0 08             	add    $0x8,%eax
+  800920:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800923:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800926:	48 85 d2             	test   %rdx,%rdx
+  800929:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  800930:	00 00 00 
+  800933:	48 0f 45 c2          	cmovne %rdx,%rax
+  800937:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80093b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80093f:	7e 06                	jle    800947 <vprintfmt+0x24b>
+  800941:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800945:	75 4a                	jne    800991 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800947:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80094b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80094f:	0f b6 00             	movzbl (%rax),%eax
+  800952:	84 c0                	test   %al,%al
+  800954:	0f 85 9a 00 00 00    	jne    8009f4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80095a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80095d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800961:	85 c0                	test   %eax,%eax
+  800963:	0f 8e c4 fd ff ff    	jle    80072d <vprintfmt+0x31>
+  800969:	4c 89 ee             	mov    %r13,%rsi
+  80096c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800971:	41 ff d6             	call   *%r14
+  800974:	41 83 ec 01          	sub    $0x1,%r12d
+  800978:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80097c:	75 eb                	jne    800969 <vprintfmt+0x26d>
+  80097e:	e9 aa fd ff ff       	jmp    80072d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800983:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800987:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098f:	eb 92                	jmp    800923 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800991:	49 63 f7             	movslq %r15d,%rsi
+  800994:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800998:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  80099f:	00 00 00 
+  8009a2:	ff d0                	call   *%rax
+  8009a4:	48 89 c2             	mov    %rax,%rdx
+  8009a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009aa:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009ac:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009af:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009b2:	85 c0                	test   %eax,%eax
+  8009b4:	7e 91                	jle    800947 <vprintfmt+0x24b>
+  8009b6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009bb:	4c 89 ee             	mov    %r13,%rsi
+  8009be:	44 89 e7             	mov    %r12d,%edi
+  8009c1:	41 ff d6             	call   *%r14
+  8009c4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009c8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009ce:	75 eb                	jne    8009bb <vprintfmt+0x2bf>
+  8009d0:	e9 72 ff ff ff       	jmp    800947 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d5:	0f b6 f8             	movzbl %al,%edi
+  8009d8:	4c 89 ee             	mov    %r13,%rsi
+  8009db:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009e2:	49 83 c4 01          	add    $0x1,%r12
+  8009e6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009ec:	84 c0                	test   %al,%al
+  8009ee:	0f 84 66 ff ff ff    	je     80095a <vprintfmt+0x25e>
+  8009f4:	45 85 ff             	test   %r15d,%r15d
+  8009f7:	78 0a                	js     800a03 <vprintfmt+0x307>
+  8009f9:	41 83 ef 01          	sub    $0x1,%r15d
+  8009fd:	0f 88 57 ff ff ff    	js     80095a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a03:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a07:	74 cc                	je     8009d5 <vprintfmt+0x2d9>
+  800a09:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a0c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a11:	80 fa 5e             	cmp    $0x5e,%dl
+  800a14:	77 c2                	ja     8009d8 <vprintfmt+0x2dc>
+  800a16:	eb bd                	jmp    8009d5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a18:	40 84 f6             	test   %sil,%sil
+  800a1b:	75 26                	jne    800a43 <vprintfmt+0x347>
+    switch (lflag) {
+  800a1d:	85 d2                	test   %edx,%edx
+  800a1f:	74 59                	je     800a7a <vprintfmt+0x37e>
+  800a21:	83 fa 01             	cmp    $0x1,%edx
+  800a24:	74 7b                	je     800aa1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a29:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2c:	0f 87 96 00 00 00    	ja     800ac8 <vprintfmt+0x3cc>
+  800a32:	89 c2                	mov    %eax,%edx
+  800a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a38:	83 c0 08             	add    $0x8,%eax
+  800a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3e:	4c 8b 22             	mov    (%rdx),%r12
+  800a41:	eb 17                	jmp    800a5a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a46:	83 f8 2f             	cmp    $0x2f,%eax
+  800a49:	77 21                	ja     800a6c <vprintfmt+0x370>
+  800a4b:	89 c2                	mov    %eax,%edx
+  800a4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a51:	83 c0 08             	add    $0x8,%eax
+  800a54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a57:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a5a:	4d 85 e4             	test   %r12,%r12
+  800a5d:	78 7a                	js     800ad9 <vprintfmt+0x3dd>
+            num = i;
+  800a5f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a67:	e9 50 02 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a78:	eb dd                	jmp    800a57 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a80:	77 11                	ja     800a93 <vprintfmt+0x397>
+  800a82:	89 c2                	mov    %eax,%edx
+  800a84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a88:	83 c0 08             	add    $0x8,%eax
+  800a8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8e:	4c 63 22             	movslq (%rdx),%r12
+  800a91:	eb c7                	jmp    800a5a <vprintfmt+0x35e>
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb ed                	jmp    800a8e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 11                	ja     800aba <vprintfmt+0x3be>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab5:	4c 8b 22             	mov    (%rdx),%r12
+  800ab8:	eb a0                	jmp    800a5a <vprintfmt+0x35e>
+  800aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	eb ed                	jmp    800ab5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ac8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad4:	e9 65 ff ff ff       	jmp    800a3e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ad9:	4c 89 ee             	mov    %r13,%rsi
+  800adc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ae1:	41 ff d6             	call   *%r14
+                i = -i;
+  800ae4:	49 f7 dc             	neg    %r12
+  800ae7:	e9 73 ff ff ff       	jmp    800a5f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800aec:	40 84 f6             	test   %sil,%sil
+  800aef:	75 32                	jne    800b23 <vprintfmt+0x427>
+    switch (lflag) {
+  800af1:	85 d2                	test   %edx,%edx
+  800af3:	74 5d                	je     800b52 <vprintfmt+0x456>
+  800af5:	83 fa 01             	cmp    $0x1,%edx
+  800af8:	0f 84 82 00 00 00    	je     800b80 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800afe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b01:	83 f8 2f             	cmp    $0x2f,%eax
+  800b04:	0f 87 a5 00 00 00    	ja     800baf <vprintfmt+0x4b3>
+  800b0a:	89 c2                	mov    %eax,%edx
+  800b0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b10:	83 c0 08             	add    $0x8,%eax
+  800b13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b16:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b1e:	e9 99 01 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b26:	83 f8 2f             	cmp    $0x2f,%eax
+  800b29:	77 19                	ja     800b44 <vprintfmt+0x448>
+  800b2b:	89 c2                	mov    %eax,%edx
+  800b2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b31:	83 c0 08             	add    $0x8,%eax
+  800b34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b37:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b3a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b3f:	e9 78 01 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+  800b44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b50:	eb e5                	jmp    800b37 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b55:	83 f8 2f             	cmp    $0x2f,%eax
+  800b58:	77 18                	ja     800b72 <vprintfmt+0x476>
+  800b5a:	89 c2                	mov    %eax,%edx
+  800b5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b60:	83 c0 08             	add    $0x8,%eax
+  800b63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b66:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b68:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b6d:	e9 4a 01 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+  800b72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7e:	eb e6                	jmp    800b66 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b83:	83 f8 2f             	cmp    $0x2f,%eax
+  800b86:	77 19                	ja     800ba1 <vprintfmt+0x4a5>
+  800b88:	89 c2                	mov    %eax,%edx
+  800b8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8e:	83 c0 08             	add    $0x8,%eax
+  800b91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b94:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b97:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b9c:	e9 1b 01 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+  800ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bad:	eb e5                	jmp    800b94 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	e9 56 ff ff ff       	jmp    800b16 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc0:	40 84 f6             	test   %sil,%sil
+  800bc3:	75 2e                	jne    800bf3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bc5:	85 d2                	test   %edx,%edx
+  800bc7:	74 59                	je     800c22 <vprintfmt+0x526>
+  800bc9:	83 fa 01             	cmp    $0x1,%edx
+  800bcc:	74 7f                	je     800c4d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd4:	0f 87 9f 00 00 00    	ja     800c79 <vprintfmt+0x57d>
+  800bda:	89 c2                	mov    %eax,%edx
+  800bdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be0:	83 c0 08             	add    $0x8,%eax
+  800be3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800be9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bee:	e9 c9 00 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf9:	77 19                	ja     800c14 <vprintfmt+0x518>
+  800bfb:	89 c2                	mov    %eax,%edx
+  800bfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c01:	83 c0 08             	add    $0x8,%eax
+  800c04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c0a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c0f:	e9 a8 00 00 00       	jmp    800cbc <vprintfmt+0x5c0>
+  800c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c20:	eb e5                	jmp    800c07 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c25:	83 f8 2f             	cmp    $0x2f,%eax
+  800c28:	77 15                	ja     800c3f <vprintfmt+0x543>
+  800c2a:	89 c2                	mov    %eax,%edx
+  800c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c30:	83 c0 08             	add    $0x8,%eax
+  800c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c36:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c38:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c3d:	eb 7d                	jmp    800cbc <vprintfmt+0x5c0>
+  800c3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4b:	eb e9                	jmp    800c36 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c50:	83 f8 2f             	cmp    $0x2f,%eax
+  800c53:	77 16                	ja     800c6b <vprintfmt+0x56f>
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5b:	83 c0 08             	add    $0x8,%eax
+  800c5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c64:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c69:	eb 51                	jmp    800cbc <vprintfmt+0x5c0>
+  800c6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c77:	eb e8                	jmp    800c61 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c85:	e9 5c ff ff ff       	jmp    800be6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c8a:	4c 89 ee             	mov    %r13,%rsi
+  800c8d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c92:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c95:	4c 89 ee             	mov    %r13,%rsi
+  800c98:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c9d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca6:	77 47                	ja     800cef <vprintfmt+0x5f3>
+  800ca8:	89 c2                	mov    %eax,%edx
+  800caa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cae:	83 c0 08             	add    $0x8,%eax
+  800cb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cbc:	48 83 ec 08          	sub    $0x8,%rsp
+  800cc0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cc4:	0f 94 c0             	sete   %al
+  800cc7:	0f b6 c0             	movzbl %al,%eax
+  800cca:	50                   	push   %rax
+  800ccb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cd0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cd4:	4c 89 ee             	mov    %r13,%rsi
+  800cd7:	4c 89 f7             	mov    %r14,%rdi
+  800cda:	48 b8 f1 05 80 00 00 	movabs $0x8005f1,%rax
+  800ce1:	00 00 00 
+  800ce4:	ff d0                	call   *%rax
+            break;
+  800ce6:	48 83 c4 10          	add    $0x10,%rsp
+  800cea:	e9 3e fa ff ff       	jmp    80072d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfb:	eb b7                	jmp    800cb4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cfd:	40 84 f6             	test   %sil,%sil
+  800d00:	75 2b                	jne    800d2d <vprintfmt+0x631>
+    switch (lflag) {
+  800d02:	85 d2                	test   %edx,%edx
+  800d04:	74 56                	je     800d5c <vprintfmt+0x660>
+  800d06:	83 fa 01             	cmp    $0x1,%edx
+  800d09:	74 7f                	je     800d8a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d11:	0f 87 a2 00 00 00    	ja     800db9 <vprintfmt+0x6bd>
+  800d17:	89 c2                	mov    %eax,%edx
+  800d19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1d:	83 c0 08             	add    $0x8,%eax
+  800d20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d23:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d2b:	eb 8f                	jmp    800cbc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d30:	83 f8 2f             	cmp    $0x2f,%eax
+  800d33:	77 19                	ja     800d4e <vprintfmt+0x652>
+  800d35:	89 c2                	mov    %eax,%edx
+  800d37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3b:	83 c0 08             	add    $0x8,%eax
+  800d3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d44:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d49:	e9 6e ff ff ff       	jmp    800cbc <vprintfmt+0x5c0>
+  800d4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5a:	eb e5                	jmp    800d41 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d62:	77 18                	ja     800d7c <vprintfmt+0x680>
+  800d64:	89 c2                	mov    %eax,%edx
+  800d66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6a:	83 c0 08             	add    $0x8,%eax
+  800d6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d70:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d72:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d77:	e9 40 ff ff ff       	jmp    800cbc <vprintfmt+0x5c0>
+  800d7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d88:	eb e6                	jmp    800d70 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d90:	77 19                	ja     800dab <vprintfmt+0x6af>
+  800d92:	89 c2                	mov    %eax,%edx
+  800d94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d98:	83 c0 08             	add    $0x8,%eax
+  800d9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800da6:	e9 11 ff ff ff       	jmp    800cbc <vprintfmt+0x5c0>
+  800dab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800daf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db7:	eb e5                	jmp    800d9e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800db9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc5:	e9 59 ff ff ff       	jmp    800d23 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dca:	4c 89 ee             	mov    %r13,%rsi
+  800dcd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dd2:	41 ff d6             	call   *%r14
+            break;
+  800dd5:	e9 53 f9 ff ff       	jmp    80072d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dda:	4c 89 ee             	mov    %r13,%rsi
+  800ddd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800de5:	48 83 eb 01          	sub    $0x1,%rbx
+  800de9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ded:	75 f6                	jne    800de5 <vprintfmt+0x6e9>
+  800def:	e9 39 f9 ff ff       	jmp    80072d <vprintfmt+0x31>
+}
+  800df4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800df8:	5b                   	pop    %rbx
+  800df9:	41 5c                	pop    %r12
+  800dfb:	41 5d                	pop    %r13
+  800dfd:	41 5e                	pop    %r14
+  800dff:	41 5f                	pop    %r15
+  800e01:	5d                   	pop    %rbp
+  800e02:	c3                   	ret
+
+0000000000800e03 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e03:	55                   	push   %rbp
+  800e04:	48 89 e5             	mov    %rsp,%rbp
+  800e07:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e0f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e14:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e18:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e1f:	48 85 ff             	test   %rdi,%rdi
+  800e22:	74 2b                	je     800e4f <vsnprintf+0x4c>
+  800e24:	48 85 f6             	test   %rsi,%rsi
+  800e27:	74 26                	je     800e4f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e29:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e2d:	48 bf a7 06 80 00 00 	movabs $0x8006a7,%rdi
+  800e34:	00 00 00 
+  800e37:	48 b8 fc 06 80 00 00 	movabs $0x8006fc,%rax
+  800e3e:	00 00 00 
+  800e41:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e47:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e4d:	c9                   	leave
+  800e4e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e54:	eb f7                	jmp    800e4d <vsnprintf+0x4a>
+
+0000000000800e56 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e56:	55                   	push   %rbp
+  800e57:	48 89 e5             	mov    %rsp,%rbp
+  800e5a:	48 83 ec 50          	sub    $0x50,%rsp
+  800e5e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e62:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e66:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e6a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e71:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e79:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e81:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e85:	48 b8 03 0e 80 00 00 	movabs $0x800e03,%rax
+  800e8c:	00 00 00 
+  800e8f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e91:	c9                   	leave
+  800e92:	c3                   	ret
+
+0000000000800e93 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e93:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e96:	74 10                	je     800ea8 <strlen+0x15>
+    size_t n = 0;
+  800e98:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e9d:	48 83 c0 01          	add    $0x1,%rax
+  800ea1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ea5:	75 f6                	jne    800e9d <strlen+0xa>
+  800ea7:	c3                   	ret
+    size_t n = 0;
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ead:	c3                   	ret
+
+0000000000800eae <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eae:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800eb6:	48 85 f6             	test   %rsi,%rsi
+  800eb9:	74 11                	je     800ecc <strnlen+0x1e>
+  800ebb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ebf:	74 0c                	je     800ecd <strnlen+0x1f>
+  800ec1:	48 83 c2 01          	add    $0x1,%rdx
+  800ec5:	48 39 d0             	cmp    %rdx,%rax
+  800ec8:	75 f1                	jne    800ebb <strnlen+0xd>
+  800eca:	eb 04                	jmp    800ed0 <strnlen+0x22>
+  800ecc:	c3                   	ret
+  800ecd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ed0:	c3                   	ret
+
+0000000000800ed1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ed1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ed4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800edd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ee0:	48 83 c2 01          	add    $0x1,%rdx
+  800ee4:	84 c9                	test   %cl,%cl
+  800ee6:	75 f1                	jne    800ed9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ee8:	c3                   	ret
+
+0000000000800ee9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ee9:	55                   	push   %rbp
+  800eea:	48 89 e5             	mov    %rsp,%rbp
+  800eed:	41 54                	push   %r12
+  800eef:	53                   	push   %rbx
+  800ef0:	48 89 fb             	mov    %rdi,%rbx
+  800ef3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ef6:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800efd:	00 00 00 
+  800f00:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f02:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f06:	4c 89 e6             	mov    %r12,%rsi
+  800f09:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f10:	00 00 00 
+  800f13:	ff d0                	call   *%rax
+    return dst;
+}
+  800f15:	48 89 d8             	mov    %rbx,%rax
+  800f18:	5b                   	pop    %rbx
+  800f19:	41 5c                	pop    %r12
+  800f1b:	5d                   	pop    %rbp
+  800f1c:	c3                   	ret
+
+0000000000800f1d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f1d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f20:	48 85 d2             	test   %rdx,%rdx
+  800f23:	74 1f                	je     800f44 <strncpy+0x27>
+  800f25:	48 01 fa             	add    %rdi,%rdx
+  800f28:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f2b:	48 83 c1 01          	add    $0x1,%rcx
+  800f2f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f33:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f37:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f3b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f3f:	48 39 ca             	cmp    %rcx,%rdx
+  800f42:	75 e7                	jne    800f2b <strncpy+0xe>
+    }
+    return ret;
+}
+  800f44:	c3                   	ret
+
+0000000000800f45 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f45:	48 89 f8             	mov    %rdi,%rax
+  800f48:	48 85 d2             	test   %rdx,%rdx
+  800f4b:	74 24                	je     800f71 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f4d:	48 83 ea 01          	sub    $0x1,%rdx
+  800f51:	74 1b                	je     800f6e <strlcpy+0x29>
+  800f53:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f57:	0f b6 16             	movzbl (%rsi),%edx
+  800f5a:	84 d2                	test   %dl,%dl
+  800f5c:	74 10                	je     800f6e <strlcpy+0x29>
+            *dst++ = *src++;
+  800f5e:	48 83 c6 01          	add    $0x1,%rsi
+  800f62:	48 83 c0 01          	add    $0x1,%rax
+  800f66:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f69:	48 39 c8             	cmp    %rcx,%rax
+  800f6c:	75 e9                	jne    800f57 <strlcpy+0x12>
+        *dst = '\0';
+  800f6e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f71:	48 29 f8             	sub    %rdi,%rax
+}
+  800f74:	c3                   	ret
+
+0000000000800f75 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f75:	0f b6 07             	movzbl (%rdi),%eax
+  800f78:	84 c0                	test   %al,%al
+  800f7a:	74 13                	je     800f8f <strcmp+0x1a>
+  800f7c:	38 06                	cmp    %al,(%rsi)
+  800f7e:	75 0f                	jne    800f8f <strcmp+0x1a>
+  800f80:	48 83 c7 01          	add    $0x1,%rdi
+  800f84:	48 83 c6 01          	add    $0x1,%rsi
+  800f88:	0f b6 07             	movzbl (%rdi),%eax
+  800f8b:	84 c0                	test   %al,%al
+  800f8d:	75 ed                	jne    800f7c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f8f:	0f b6 c0             	movzbl %al,%eax
+  800f92:	0f b6 16             	movzbl (%rsi),%edx
+  800f95:	29 d0                	sub    %edx,%eax
+}
+  800f97:	c3                   	ret
+
+0000000000800f98 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f98:	48 85 d2             	test   %rdx,%rdx
+  800f9b:	74 1f                	je     800fbc <strncmp+0x24>
+  800f9d:	0f b6 07             	movzbl (%rdi),%eax
+  800fa0:	84 c0                	test   %al,%al
+  800fa2:	74 1e                	je     800fc2 <strncmp+0x2a>
+  800fa4:	3a 06                	cmp    (%rsi),%al
+  800fa6:	75 1a                	jne    800fc2 <strncmp+0x2a>
+  800fa8:	48 83 c7 01          	add    $0x1,%rdi
+  800fac:	48 83 c6 01          	add    $0x1,%rsi
+  800fb0:	48 83 ea 01          	sub    $0x1,%rdx
+  800fb4:	75 e7                	jne    800f9d <strncmp+0x5>
+
+    if (!n) return 0;
+  800fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbb:	c3                   	ret
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc1:	c3                   	ret
+  800fc2:	48 85 d2             	test   %rdx,%rdx
+  800fc5:	74 09                	je     800fd0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fc7:	0f b6 07             	movzbl (%rdi),%eax
+  800fca:	0f b6 16             	movzbl (%rsi),%edx
+  800fcd:	29 d0                	sub    %edx,%eax
+  800fcf:	c3                   	ret
+    if (!n) return 0;
+  800fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd5:	c3                   	ret
+
+0000000000800fd6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fd6:	0f b6 17             	movzbl (%rdi),%edx
+  800fd9:	84 d2                	test   %dl,%dl
+  800fdb:	74 18                	je     800ff5 <strchr+0x1f>
+        if (*str == c) {
+  800fdd:	0f be d2             	movsbl %dl,%edx
+  800fe0:	39 f2                	cmp    %esi,%edx
+  800fe2:	74 17                	je     800ffb <strchr+0x25>
+    for (; *str; str++) {
+  800fe4:	48 83 c7 01          	add    $0x1,%rdi
+  800fe8:	0f b6 17             	movzbl (%rdi),%edx
+  800feb:	84 d2                	test   %dl,%dl
+  800fed:	75 ee                	jne    800fdd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff4:	c3                   	ret
+  800ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffa:	c3                   	ret
+  800ffb:	48 89 f8             	mov    %rdi,%rax
+}
+  800ffe:	c3                   	ret
+
+0000000000800fff <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fff:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801002:	0f b6 17             	movzbl (%rdi),%edx
+  801005:	84 d2                	test   %dl,%dl
+  801007:	74 13                	je     80101c <strfind+0x1d>
+  801009:	0f be d2             	movsbl %dl,%edx
+  80100c:	39 f2                	cmp    %esi,%edx
+  80100e:	74 0b                	je     80101b <strfind+0x1c>
+  801010:	48 83 c0 01          	add    $0x1,%rax
+  801014:	0f b6 10             	movzbl (%rax),%edx
+  801017:	84 d2                	test   %dl,%dl
+  801019:	75 ee                	jne    801009 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80101b:	c3                   	ret
+  80101c:	c3                   	ret
+
+000000000080101d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80101d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801020:	48 89 f8             	mov    %rdi,%rax
+  801023:	48 f7 d8             	neg    %rax
+  801026:	83 e0 07             	and    $0x7,%eax
+  801029:	49 89 d1             	mov    %rdx,%r9
+  80102c:	49 29 c1             	sub    %rax,%r9
+  80102f:	78 36                	js     801067 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801031:	40 0f b6 c6          	movzbl %sil,%eax
+  801035:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80103c:	01 01 01 
+  80103f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801043:	40 f6 c7 07          	test   $0x7,%dil
+  801047:	75 38                	jne    801081 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801049:	4c 89 c9             	mov    %r9,%rcx
+  80104c:	48 c1 f9 03          	sar    $0x3,%rcx
+  801050:	74 0c                	je     80105e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801052:	fc                   	cld
+  801053:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801056:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80105a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80105e:	4d 85 c9             	test   %r9,%r9
+  801061:	75 45                	jne    8010a8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801063:	4c 89 c0             	mov    %r8,%rax
+  801066:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801067:	48 85 d2             	test   %rdx,%rdx
+  80106a:	74 f7                	je     801063 <memset+0x46>
+  80106c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80106f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801072:	48 83 c0 01          	add    $0x1,%rax
+  801076:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80107a:	48 39 c2             	cmp    %rax,%rdx
+  80107d:	75 f3                	jne    801072 <memset+0x55>
+  80107f:	eb e2                	jmp    801063 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801081:	40 f6 c7 01          	test   $0x1,%dil
+  801085:	74 06                	je     80108d <memset+0x70>
+  801087:	88 07                	mov    %al,(%rdi)
+  801089:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80108d:	40 f6 c7 02          	test   $0x2,%dil
+  801091:	74 07                	je     80109a <memset+0x7d>
+  801093:	66 89 07             	mov    %ax,(%rdi)
+  801096:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80109a:	40 f6 c7 04          	test   $0x4,%dil
+  80109e:	74 a9                	je     801049 <memset+0x2c>
+  8010a0:	89 07                	mov    %eax,(%rdi)
+  8010a2:	48 83 c7 04          	add    $0x4,%rdi
+  8010a6:	eb a1                	jmp    801049 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a8:	41 f6 c1 04          	test   $0x4,%r9b
+  8010ac:	74 06                	je     8010b4 <memset+0x97>
+  8010ae:	89 07                	mov    %eax,(%rdi)
+  8010b0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010b4:	41 f6 c1 02          	test   $0x2,%r9b
+  8010b8:	74 07                	je     8010c1 <memset+0xa4>
+  8010ba:	66 89 07             	mov    %ax,(%rdi)
+  8010bd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010c1:	41 f6 c1 01          	test   $0x1,%r9b
+  8010c5:	74 9c                	je     801063 <memset+0x46>
+  8010c7:	88 07                	mov    %al,(%rdi)
+  8010c9:	eb 98                	jmp    801063 <memset+0x46>
+
+00000000008010cb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010cb:	48 89 f8             	mov    %rdi,%rax
+  8010ce:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010d1:	48 39 fe             	cmp    %rdi,%rsi
+  8010d4:	73 3b                	jae    801111 <memmove+0x46>
+  8010d6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010da:	48 39 d7             	cmp    %rdx,%rdi
+  8010dd:	73 32                	jae    801111 <memmove+0x46>
+        s += n;
+        d += n;
+  8010df:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e3:	48 89 d6             	mov    %rdx,%rsi
+  8010e6:	48 09 fe             	or     %rdi,%rsi
+  8010e9:	48 09 ce             	or     %rcx,%rsi
+  8010ec:	40 f6 c6 07          	test   $0x7,%sil
+  8010f0:	75 12                	jne    801104 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010f2:	48 83 ef 08          	sub    $0x8,%rdi
+  8010f6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010fa:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010fe:	fd                   	std
+  8010ff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801102:	fc                   	cld
+  801103:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801104:	48 83 ef 01          	sub    $0x1,%rdi
+  801108:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80110c:	fd                   	std
+  80110d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80110f:	eb f1                	jmp    801102 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801111:	48 89 f2             	mov    %rsi,%rdx
+  801114:	48 09 c2             	or     %rax,%rdx
+  801117:	48 09 ca             	or     %rcx,%rdx
+  80111a:	f6 c2 07             	test   $0x7,%dl
+  80111d:	75 0c                	jne    80112b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80111f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801123:	48 89 c7             	mov    %rax,%rdi
+  801126:	fc                   	cld
+  801127:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80112a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80112b:	48 89 c7             	mov    %rax,%rdi
+  80112e:	fc                   	cld
+  80112f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801131:	c3                   	ret
+
+0000000000801132 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801132:	55                   	push   %rbp
+  801133:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801136:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  80113d:	00 00 00 
+  801140:	ff d0                	call   *%rax
+}
+  801142:	5d                   	pop    %rbp
+  801143:	c3                   	ret
+
+0000000000801144 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801144:	55                   	push   %rbp
+  801145:	48 89 e5             	mov    %rsp,%rbp
+  801148:	41 57                	push   %r15
+  80114a:	41 56                	push   %r14
+  80114c:	41 55                	push   %r13
+  80114e:	41 54                	push   %r12
+  801150:	53                   	push   %rbx
+  801151:	48 83 ec 08          	sub    $0x8,%rsp
+  801155:	49 89 fe             	mov    %rdi,%r14
+  801158:	49 89 f7             	mov    %rsi,%r15
+  80115b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80115e:	48 89 f7             	mov    %rsi,%rdi
+  801161:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  801168:	00 00 00 
+  80116b:	ff d0                	call   *%rax
+  80116d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801170:	48 89 de             	mov    %rbx,%rsi
+  801173:	4c 89 f7             	mov    %r14,%rdi
+  801176:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  80117d:	00 00 00 
+  801180:	ff d0                	call   *%rax
+  801182:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801185:	48 39 c3             	cmp    %rax,%rbx
+  801188:	74 36                	je     8011c0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80118a:	48 89 d8             	mov    %rbx,%rax
+  80118d:	4c 29 e8             	sub    %r13,%rax
+  801190:	49 39 c4             	cmp    %rax,%r12
+  801193:	73 31                	jae    8011c6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801195:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80119a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80119e:	4c 89 fe             	mov    %r15,%rsi
+  8011a1:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  8011a8:	00 00 00 
+  8011ab:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011ad:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011b1:	48 83 c4 08          	add    $0x8,%rsp
+  8011b5:	5b                   	pop    %rbx
+  8011b6:	41 5c                	pop    %r12
+  8011b8:	41 5d                	pop    %r13
+  8011ba:	41 5e                	pop    %r14
+  8011bc:	41 5f                	pop    %r15
+  8011be:	5d                   	pop    %rbp
+  8011bf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c4:	eb eb                	jmp    8011b1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011c6:	48 83 eb 01          	sub    $0x1,%rbx
+  8011ca:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011ce:	48 89 da             	mov    %rbx,%rdx
+  8011d1:	4c 89 fe             	mov    %r15,%rsi
+  8011d4:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  8011db:	00 00 00 
+  8011de:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011e0:	49 01 de             	add    %rbx,%r14
+  8011e3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011e8:	eb c3                	jmp    8011ad <strlcat+0x69>
+
+00000000008011ea <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011ea:	48 85 d2             	test   %rdx,%rdx
+  8011ed:	74 2d                	je     80121c <memcmp+0x32>
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011f4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011f8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011fd:	44 38 c1             	cmp    %r8b,%cl
+  801200:	75 0f                	jne    801211 <memcmp+0x27>
+    while (n-- > 0) {
+  801202:	48 83 c0 01          	add    $0x1,%rax
+  801206:	48 39 c2             	cmp    %rax,%rdx
+  801209:	75 e9                	jne    8011f4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80120b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801210:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801211:	0f b6 c1             	movzbl %cl,%eax
+  801214:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801218:	44 29 c0             	sub    %r8d,%eax
+  80121b:	c3                   	ret
+    return 0;
+  80121c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801221:	c3                   	ret
+
+0000000000801222 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801222:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801226:	48 39 c7             	cmp    %rax,%rdi
+  801229:	73 0f                	jae    80123a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80122b:	40 38 37             	cmp    %sil,(%rdi)
+  80122e:	74 0e                	je     80123e <memfind+0x1c>
+    for (; src < end; src++) {
+  801230:	48 83 c7 01          	add    $0x1,%rdi
+  801234:	48 39 f8             	cmp    %rdi,%rax
+  801237:	75 f2                	jne    80122b <memfind+0x9>
+  801239:	c3                   	ret
+  80123a:	48 89 f8             	mov    %rdi,%rax
+  80123d:	c3                   	ret
+  80123e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801241:	c3                   	ret
+
+0000000000801242 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801242:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801245:	0f b6 37             	movzbl (%rdi),%esi
+  801248:	40 80 fe 20          	cmp    $0x20,%sil
+  80124c:	74 06                	je     801254 <strtol+0x12>
+  80124e:	40 80 fe 09          	cmp    $0x9,%sil
+  801252:	75 13                	jne    801267 <strtol+0x25>
+  801254:	48 83 c7 01          	add    $0x1,%rdi
+  801258:	0f b6 37             	movzbl (%rdi),%esi
+  80125b:	40 80 fe 20          	cmp    $0x20,%sil
+  80125f:	74 f3                	je     801254 <strtol+0x12>
+  801261:	40 80 fe 09          	cmp    $0x9,%sil
+  801265:	74 ed                	je     801254 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801267:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80126a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80126d:	3c 01                	cmp    $0x1,%al
+  80126f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801273:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801279:	75 0f                	jne    80128a <strtol+0x48>
+  80127b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80127e:	74 14                	je     801294 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801280:	85 d2                	test   %edx,%edx
+  801282:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801287:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80128a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80128f:	4c 63 ca             	movslq %edx,%r9
+  801292:	eb 36                	jmp    8012ca <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801294:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801298:	74 0f                	je     8012a9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80129a:	85 d2                	test   %edx,%edx
+  80129c:	75 ec                	jne    80128a <strtol+0x48>
+        s++;
+  80129e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012a2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012a7:	eb e1                	jmp    80128a <strtol+0x48>
+        s += 2;
+  8012a9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012ad:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012b2:	eb d6                	jmp    80128a <strtol+0x48>
+            dig -= '0';
+  8012b4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012b7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012bb:	41 39 d0             	cmp    %edx,%r8d
+  8012be:	7d 21                	jge    8012e1 <strtol+0x9f>
+        val = val * base + dig;
+  8012c0:	49 0f af c1          	imul   %r9,%rax
+  8012c4:	0f b6 c9             	movzbl %cl,%ecx
+  8012c7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012ca:	48 83 c7 01          	add    $0x1,%rdi
+  8012ce:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012d2:	80 f9 39             	cmp    $0x39,%cl
+  8012d5:	76 dd                	jbe    8012b4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012d7:	80 f9 7b             	cmp    $0x7b,%cl
+  8012da:	77 05                	ja     8012e1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012dc:	83 e9 57             	sub    $0x57,%ecx
+  8012df:	eb d6                	jmp    8012b7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012e1:	4d 85 d2             	test   %r10,%r10
+  8012e4:	74 03                	je     8012e9 <strtol+0xa7>
+  8012e6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012e9:	48 89 c2             	mov    %rax,%rdx
+  8012ec:	48 f7 da             	neg    %rdx
+  8012ef:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012f3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012f7:	c3                   	ret
+
+00000000008012f8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+  8012fc:	53                   	push   %rbx
+  8012fd:	48 89 fa             	mov    %rdi,%rdx
+  801300:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801308:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801312:	be 00 00 00 00       	mov    $0x0,%esi
+  801317:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80131f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801323:	c9                   	leave
+  801324:	c3                   	ret
+
+0000000000801325 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801325:	55                   	push   %rbp
+  801326:	48 89 e5             	mov    %rsp,%rbp
+  801329:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80132a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801334:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801343:	be 00 00 00 00       	mov    $0x0,%esi
+  801348:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801350:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801354:	c9                   	leave
+  801355:	c3                   	ret
+
+0000000000801356 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801356:	55                   	push   %rbp
+  801357:	48 89 e5             	mov    %rsp,%rbp
+  80135a:	53                   	push   %rbx
+  80135b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80135f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801367:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801371:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801376:	be 00 00 00 00       	mov    $0x0,%esi
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801381:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801383:	48 85 c0             	test   %rax,%rax
+  801386:	7f 06                	jg     80138e <sys_env_destroy+0x38>
+}
+  801388:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138e:	49 89 c0             	mov    %rax,%r8
+  801391:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801396:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80139d:	00 00 00 
+  8013a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a5:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8013ac:	00 00 00 
+  8013af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b4:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  8013bb:	00 00 00 
+  8013be:	41 ff d1             	call   *%r9
+
+00000000008013c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+
+00000000008013f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801401:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801406:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80141d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+
+0000000000801423 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801423:	55                   	push   %rbp
+  801424:	48 89 e5             	mov    %rsp,%rbp
+  801427:	53                   	push   %rbx
+  801428:	48 89 fa             	mov    %rdi,%rdx
+  80142b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80142e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801433:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80143a:	00 00 00 
+  80143d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80144f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801453:	c9                   	leave
+  801454:	c3                   	ret
+
+0000000000801455 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801455:	55                   	push   %rbp
+  801456:	48 89 e5             	mov    %rsp,%rbp
+  801459:	53                   	push   %rbx
+  80145a:	49 89 f8             	mov    %rdi,%r8
+  80145d:	48 89 d3             	mov    %rdx,%rbx
+  801460:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801463:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801468:	4c 89 c2             	mov    %r8,%rdx
+  80146b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146e:	be 00 00 00 00       	mov    $0x0,%esi
+  801473:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801479:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80147b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147f:	c9                   	leave
+  801480:	c3                   	ret
+
+0000000000801481 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801481:	55                   	push   %rbp
+  801482:	48 89 e5             	mov    %rsp,%rbp
+  801485:	53                   	push   %rbx
+  801486:	48 83 ec 08          	sub    $0x8,%rsp
+  80148a:	89 f8                	mov    %edi,%eax
+  80148c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80148f:	48 63 f9             	movslq %ecx,%rdi
+  801492:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801495:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149d:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014aa:	48 85 c0             	test   %rax,%rax
+  8014ad:	7f 06                	jg     8014b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b3:	c9                   	leave
+  8014b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b5:	49 89 c0             	mov    %rax,%r8
+  8014b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014bd:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8014c4:	00 00 00 
+  8014c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014cc:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8014d3:	00 00 00 
+  8014d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014db:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  8014e2:	00 00 00 
+  8014e5:	41 ff d1             	call   *%r9
+
+00000000008014e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014e8:	55                   	push   %rbp
+  8014e9:	48 89 e5             	mov    %rsp,%rbp
+  8014ec:	53                   	push   %rbx
+  8014ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f1:	89 f8                	mov    %edi,%eax
+  8014f3:	49 89 f2             	mov    %rsi,%r10
+  8014f6:	48 89 cf             	mov    %rcx,%rdi
+  8014f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014fc:	48 63 da             	movslq %edx,%rbx
+  8014ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801502:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801507:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80150d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150f:	48 85 c0             	test   %rax,%rax
+  801512:	7f 06                	jg     80151a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801518:	c9                   	leave
+  801519:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151a:	49 89 c0             	mov    %rax,%r8
+  80151d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801522:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801529:	00 00 00 
+  80152c:	be 26 00 00 00       	mov    $0x26,%esi
+  801531:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801538:	00 00 00 
+  80153b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801540:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801547:	00 00 00 
+  80154a:	41 ff d1             	call   *%r9
+
+000000000080154d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	53                   	push   %rbx
+  801552:	48 83 ec 08          	sub    $0x8,%rsp
+  801556:	49 89 f9             	mov    %rdi,%r9
+  801559:	89 f0                	mov    %esi,%eax
+  80155b:	48 89 d3             	mov    %rdx,%rbx
+  80155e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801561:	49 63 f0             	movslq %r8d,%rsi
+  801564:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801567:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801575:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801577:	48 85 c0             	test   %rax,%rax
+  80157a:	7f 06                	jg     801582 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80157c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801580:	c9                   	leave
+  801581:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801582:	49 89 c0             	mov    %rax,%r8
+  801585:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80158a:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801591:	00 00 00 
+  801594:	be 26 00 00 00       	mov    $0x26,%esi
+  801599:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8015a0:	00 00 00 
+  8015a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a8:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  8015af:	00 00 00 
+  8015b2:	41 ff d1             	call   *%r9
+
+00000000008015b5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	53                   	push   %rbx
+  8015ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8015be:	48 89 f1             	mov    %rsi,%rcx
+  8015c1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015de:	48 85 c0             	test   %rax,%rax
+  8015e1:	7f 06                	jg     8015e9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e9:	49 89 c0             	mov    %rax,%r8
+  8015ec:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8015f1:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8015f8:	00 00 00 
+  8015fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801600:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801607:	00 00 00 
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160f:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801616:	00 00 00 
+  801619:	41 ff d1             	call   *%r9
+
+000000000080161c <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80161c:	55                   	push   %rbp
+  80161d:	48 89 e5             	mov    %rsp,%rbp
+  801620:	53                   	push   %rbx
+  801621:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801624:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801629:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801633:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801638:	be 00 00 00 00       	mov    $0x0,%esi
+  80163d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801643:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801645:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+
+000000000080164b <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	53                   	push   %rbx
+  801650:	48 83 ec 08          	sub    $0x8,%rsp
+  801654:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801657:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801669:	be 00 00 00 00       	mov    $0x0,%esi
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801676:	48 85 c0             	test   %rax,%rax
+  801679:	7f 06                	jg     801681 <sys_env_set_tls+0x36>
+}
+  80167b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801681:	49 89 c0             	mov    %rax,%r8
+  801684:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801689:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801690:	00 00 00 
+  801693:	be 26 00 00 00       	mov    $0x26,%esi
+  801698:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80169f:	00 00 00 
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a7:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  8016ae:	00 00 00 
+  8016b1:	41 ff d1             	call   *%r9
+
+00000000008016b4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016bd:	48 63 ce             	movslq %esi,%rcx
+  8016c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016df:	48 85 c0             	test   %rax,%rax
+  8016e2:	7f 06                	jg     8016ea <sys_env_set_status+0x36>
+}
+  8016e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ea:	49 89 c0             	mov    %rax,%r8
+  8016ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016f2:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8016f9:	00 00 00 
+  8016fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801701:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801708:	00 00 00 
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801717:	00 00 00 
+  80171a:	41 ff d1             	call   *%r9
+
+000000000080171d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+  801721:	53                   	push   %rbx
+  801722:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801726:	48 63 da             	movslq %edx,%rbx
+  801729:	48 63 ce             	movslq %esi,%rcx
+  80172c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801734:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801739:	be 00 00 00 00       	mov    $0x0,%esi
+  80173e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801744:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801746:	48 85 c0             	test   %rax,%rax
+  801749:	7f 06                	jg     801751 <sys_env_set_priority+0x34>
+}
+  80174b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174f:	c9                   	leave
+  801750:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801751:	49 89 c0             	mov    %rax,%r8
+  801754:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801759:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801760:	00 00 00 
+  801763:	be 26 00 00 00       	mov    $0x26,%esi
+  801768:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80176f:	00 00 00 
+  801772:	b8 00 00 00 00       	mov    $0x0,%eax
+  801777:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  80177e:	00 00 00 
+  801781:	41 ff d1             	call   *%r9
+
+0000000000801784 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801784:	55                   	push   %rbp
+  801785:	48 89 e5             	mov    %rsp,%rbp
+  801788:	53                   	push   %rbx
+  801789:	48 83 ec 08          	sub    $0x8,%rsp
+  80178d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801790:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801793:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801798:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017af:	48 85 c0             	test   %rax,%rax
+  8017b2:	7f 06                	jg     8017ba <sys_env_set_trapframe+0x36>
+}
+  8017b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b8:	c9                   	leave
+  8017b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ba:	49 89 c0             	mov    %rax,%r8
+  8017bd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017c2:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8017c9:	00 00 00 
+  8017cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d1:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8017d8:	00 00 00 
+  8017db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e0:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  8017e7:	00 00 00 
+  8017ea:	41 ff d1             	call   *%r9
+
+00000000008017ed <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017ed:	55                   	push   %rbp
+  8017ee:	48 89 e5             	mov    %rsp,%rbp
+  8017f1:	53                   	push   %rbx
+  8017f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017f9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801801:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801806:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180b:	be 00 00 00 00       	mov    $0x0,%esi
+  801810:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801816:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801818:	48 85 c0             	test   %rax,%rax
+  80181b:	7f 06                	jg     801823 <sys_env_set_pgfault_upcall+0x36>
+}
+  80181d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801821:	c9                   	leave
+  801822:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801823:	49 89 c0             	mov    %rax,%r8
+  801826:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80182b:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801832:	00 00 00 
+  801835:	be 26 00 00 00       	mov    $0x26,%esi
+  80183a:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801841:	00 00 00 
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+  801849:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801850:	00 00 00 
+  801853:	41 ff d1             	call   *%r9
+
+0000000000801856 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+  80185a:	53                   	push   %rbx
+  80185b:	89 f8                	mov    %edi,%eax
+  80185d:	49 89 f1             	mov    %rsi,%r9
+  801860:	48 89 d3             	mov    %rdx,%rbx
+  801863:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801866:	49 63 f0             	movslq %r8d,%rsi
+  801869:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80186c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801871:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801874:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187a:	cd 30                	int    $0x30
+}
+  80187c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+0000000000801882 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801882:	55                   	push   %rbp
+  801883:	48 89 e5             	mov    %rsp,%rbp
+  801886:	41 55                	push   %r13
+  801888:	41 54                	push   %r12
+  80188a:	53                   	push   %rbx
+  80188b:	89 f8                	mov    %edi,%eax
+  80188d:	49 89 f2             	mov    %rsi,%r10
+  801890:	48 89 d3             	mov    %rdx,%rbx
+  801893:	48 89 cf             	mov    %rcx,%rdi
+  801896:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801899:	49 63 f0             	movslq %r8d,%rsi
+  80189c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80189f:	4d 85 c9             	test   %r9,%r9
+  8018a2:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8018a9:	00 00 00 
+  8018ac:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018b0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018b5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8018b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018be:	4d 8b 0b             	mov    (%r11),%r9
+  8018c1:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018c5:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018c9:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018cd:	cd 30                	int    $0x30
+}
+  8018cf:	5b                   	pop    %rbx
+  8018d0:	41 5c                	pop    %r12
+  8018d2:	41 5d                	pop    %r13
+  8018d4:	5d                   	pop    %rbp
+  8018d5:	c3                   	ret
+
+00000000008018d6 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8018d6:	55                   	push   %rbp
+  8018d7:	48 89 e5             	mov    %rsp,%rbp
+  8018da:	53                   	push   %rbx
+  8018db:	48 89 fa             	mov    %rdi,%rdx
+  8018de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e1:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018fb:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8018fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801901:	c9                   	leave
+  801902:	c3                   	ret
+
+0000000000801903 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801903:	55                   	push   %rbp
+  801904:	48 89 e5             	mov    %rsp,%rbp
+  801907:	53                   	push   %rbx
+  801908:	48 83 ec 08          	sub    $0x8,%rsp
+  80190c:	48 89 fa             	mov    %rdi,%rdx
+  80190f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801912:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801921:	be 00 00 00 00       	mov    $0x0,%esi
+  801926:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80192e:	48 85 c0             	test   %rax,%rax
+  801931:	7f 06                	jg     801939 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801933:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801937:	c9                   	leave
+  801938:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801939:	49 89 c0             	mov    %rax,%r8
+  80193c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801941:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801948:	00 00 00 
+  80194b:	be 26 00 00 00       	mov    $0x26,%esi
+  801950:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801957:	00 00 00 
+  80195a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195f:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801966:	00 00 00 
+  801969:	41 ff d1             	call   *%r9
+
+000000000080196c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80196c:	55                   	push   %rbp
+  80196d:	48 89 e5             	mov    %rsp,%rbp
+  801970:	41 55                	push   %r13
+  801972:	41 54                	push   %r12
+  801974:	53                   	push   %rbx
+  801975:	89 f8                	mov    %edi,%eax
+  801977:	49 89 f2             	mov    %rsi,%r10
+  80197a:	48 89 d3             	mov    %rdx,%rbx
+  80197d:	48 89 cf             	mov    %rcx,%rdi
+  801980:	44 89 c6             	mov    %r8d,%esi
+  801983:	4d 89 c8             	mov    %r9,%r8
+  801986:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80198a:	48 63 f6             	movslq %esi,%rsi
+  80198d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801990:	4d 85 db             	test   %r11,%r11
+  801993:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  80199a:	00 00 00 
+  80199d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019a1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a6:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019a9:	4d 8b 0b             	mov    (%r11),%r9
+  8019ac:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8019b0:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8019b4:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019b8:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019ba:	5b                   	pop    %rbx
+  8019bb:	41 5c                	pop    %r12
+  8019bd:	41 5d                	pop    %r13
+  8019bf:	5d                   	pop    %rbp
+  8019c0:	c3                   	ret
+
+00000000008019c1 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8019c1:	55                   	push   %rbp
+  8019c2:	48 89 e5             	mov    %rsp,%rbp
+  8019c5:	41 55                	push   %r13
+  8019c7:	41 54                	push   %r12
+  8019c9:	53                   	push   %rbx
+  8019ca:	89 f8                	mov    %edi,%eax
+  8019cc:	49 89 f2             	mov    %rsi,%r10
+  8019cf:	48 89 d3             	mov    %rdx,%rbx
+  8019d2:	48 89 cf             	mov    %rcx,%rdi
+  8019d5:	44 89 c6             	mov    %r8d,%esi
+  8019d8:	4d 89 c8             	mov    %r9,%r8
+  8019db:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8019df:	48 63 f6             	movslq %esi,%rsi
+  8019e2:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8019e5:	4d 85 db             	test   %r11,%r11
+  8019e8:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8019ef:	00 00 00 
+  8019f2:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8019f6:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019fb:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8019fe:	4d 8b 0b             	mov    (%r11),%r9
+  801a01:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801a05:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801a09:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801a0d:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a0f:	5b                   	pop    %rbx
+  801a10:	41 5c                	pop    %r12
+  801a12:	41 5d                	pop    %r13
+  801a14:	5d                   	pop    %rbp
+  801a15:	c3                   	ret
+
+0000000000801a16 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1f:	48 89 f1             	mov    %rsi,%rcx
+  801a22:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a25:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a2a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a32:	be 00 00 00 00       	mov    $0x0,%esi
+  801a37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a3f:	48 85 c0             	test   %rax,%rax
+  801a42:	7f 06                	jg     801a4a <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a4a:	49 89 c0             	mov    %rax,%r8
+  801a4d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a52:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801a59:	00 00 00 
+  801a5c:	be 26 00 00 00       	mov    $0x26,%esi
+  801a61:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a68:	00 00 00 
+  801a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a70:	49 b9 5c 04 80 00 00 	movabs $0x80045c,%r9
+  801a77:	00 00 00 
+  801a7a:	41 ff d1             	call   *%r9
+
+0000000000801a7d <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+  801a81:	53                   	push   %rbx
+  801a82:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a85:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a99:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa4:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801aa6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+0000000000801aac <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801aac:	55                   	push   %rbp
+  801aad:	48 89 e5             	mov    %rsp,%rbp
+  801ab0:	53                   	push   %rbx
+  801ab1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ab4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab6:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801abb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac5:	be 00 00 00 00       	mov    $0x0,%esi
+  801aca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ad0:	cd 30                	int    $0x30
+}
+  801ad2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+
+0000000000801ad8 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ad8:	55                   	push   %rbp
+  801ad9:	48 89 e5             	mov    %rsp,%rbp
+  801adc:	53                   	push   %rbx
+  801add:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801ae0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af2:	be 00 00 00 00       	mov    $0x0,%esi
+  801af7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801afd:	cd 30                	int    $0x30
+}
+  801aff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+
+0000000000801b05 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801b05:	55                   	push   %rbp
+  801b06:	48 89 e5             	mov    %rsp,%rbp
+  801b09:	53                   	push   %rbx
+  801b0a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801b0d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801b0f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b14:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b17:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b27:	cd 30                	int    $0x30
+}
+  801b29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+
+0000000000801b2f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801b2f:	55                   	push   %rbp
+  801b30:	48 89 e5             	mov    %rsp,%rbp
+  801b33:	53                   	push   %rbx
+  801b34:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b37:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b3a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b44:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b49:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b54:	cd 30                	int    $0x30
+}
+  801b56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5a:	c9                   	leave
+  801b5b:	c3                   	ret
+
+0000000000801b5c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b5c:	55                   	push   %rbp
+  801b5d:	48 89 e5             	mov    %rsp,%rbp
+  801b60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b61:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b85:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b8b:	c9                   	leave
+  801b8c:	c3                   	ret
+
+0000000000801b8d <sys_monitor>:
+
+int sys_monitor(void) {
+  801b8d:	55                   	push   %rbp
+  801b8e:	48 89 e5             	mov    %rsp,%rbp
+  801b91:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b92:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ba1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bab:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb6:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbc:	c9                   	leave
+  801bbd:	c3                   	ret
+
+0000000000801bbe <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801bbe:	55                   	push   %rbp
+  801bbf:	48 89 e5             	mov    %rsp,%rbp
+  801bc2:	41 55                	push   %r13
+  801bc4:	41 54                	push   %r12
+  801bc6:	53                   	push   %rbx
+  801bc7:	48 83 ec 08          	sub    $0x8,%rsp
+  801bcb:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801bce:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801bd1:	48 b8 76 3f 80 00 00 	movabs $0x803f76,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	41 89 c5             	mov    %eax,%r13d
+  801be0:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801be4:	a8 40                	test   $0x40,%al
+  801be6:	75 31                	jne    801c19 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801be8:	a8 02                	test   $0x2,%al
+  801bea:	74 5f                	je     801c4b <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801bec:	45 89 e9             	mov    %r13d,%r9d
+  801bef:	41 83 c9 40          	or     $0x40,%r9d
+  801bf3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bf9:	48 89 d9             	mov    %rbx,%rcx
+  801bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c01:	48 89 de             	mov    %rbx,%rsi
+  801c04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c09:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 27                	js     801c40 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801c19:	45 89 e9             	mov    %r13d,%r9d
+  801c1c:	41 83 c9 40          	or     $0x40,%r9d
+  801c20:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c26:	48 89 d9             	mov    %rbx,%rcx
+  801c29:	44 89 e2             	mov    %r12d,%edx
+  801c2c:	48 89 de             	mov    %rbx,%rsi
+  801c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c34:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+}
+  801c40:	48 83 c4 08          	add    $0x8,%rsp
+  801c44:	5b                   	pop    %rbx
+  801c45:	41 5c                	pop    %r12
+  801c47:	41 5d                	pop    %r13
+  801c49:	5d                   	pop    %rbp
+  801c4a:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801c4b:	83 e0 01             	and    $0x1,%eax
+  801c4e:	83 c8 06             	or     $0x6,%eax
+  801c51:	41 89 c1             	mov    %eax,%r9d
+  801c54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c5a:	48 89 d9             	mov    %rbx,%rcx
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	48 89 de             	mov    %rbx,%rsi
+  801c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6a:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	0f 85 6e ff ff ff    	jne    801bec <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c7e:	48 89 df             	mov    %rbx,%rdi
+  801c81:	48 b8 76 3f 80 00 00 	movabs $0x803f76,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+  801c8d:	83 e0 5f             	and    $0x5f,%eax
+  801c90:	41 89 c5             	mov    %eax,%r13d
+  801c93:	e9 54 ff ff ff       	jmp    801bec <sfork_page+0x2e>
+
+0000000000801c98 <fork>:
+fork(void) {
+  801c98:	55                   	push   %rbp
+  801c99:	48 89 e5             	mov    %rsp,%rbp
+  801c9c:	41 54                	push   %r12
+  801c9e:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801c9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ca4:	cd 30                	int    $0x30
+  801ca6:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801ca9:	85 c0                	test   %eax,%eax
+  801cab:	0f 88 81 00 00 00    	js     801d32 <fork+0x9a>
+    if (envid == CURENVID) {
+  801cb1:	0f 84 83 00 00 00    	je     801d3a <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801cb7:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801cbd:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801cc4:	00 00 00 
+  801cc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccc:	89 c2                	mov    %eax,%edx
+  801cce:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd8:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  801cdf:	00 00 00 
+  801ce2:	ff d0                	call   *%rax
+  801ce4:	85 c0                	test   %eax,%eax
+  801ce6:	0f 85 82 00 00 00    	jne    801d6e <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801cec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801cf3:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801cf5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cf9:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d00:	44 89 e7             	mov    %r12d,%edi
+  801d03:	48 b8 ed 17 80 00 00 	movabs $0x8017ed,%rax
+  801d0a:	00 00 00 
+  801d0d:	ff d0                	call   *%rax
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	75 63                	jne    801d76 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801d13:	be 02 00 00 00       	mov    $0x2,%esi
+  801d18:	44 89 e7             	mov    %r12d,%edi
+  801d1b:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+        return -1;
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d2e:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801d32:	44 89 e0             	mov    %r12d,%eax
+  801d35:	5b                   	pop    %rbx
+  801d36:	41 5c                	pop    %r12
+  801d38:	5d                   	pop    %rbp
+  801d39:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d3a:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  801d41:	00 00 00 
+  801d44:	ff d0                	call   *%rax
+  801d46:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d4d:	00 00 
+  801d4f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d54:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d5b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d62:	00 00 00 
+  801d65:	48 01 c8             	add    %rcx,%rax
+  801d68:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d6c:	eb c4                	jmp    801d32 <fork+0x9a>
+        return -1;
+  801d6e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d74:	eb bc                	jmp    801d32 <fork+0x9a>
+  801d76:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d7c:	eb b4                	jmp    801d32 <fork+0x9a>
+
+0000000000801d7e <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	53                   	push   %rbx
+  801d83:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d87:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d8c:	cd 30                	int    $0x30
+  801d8e:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 40                	js     801dd7 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801d97:	74 46                	je     801ddf <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801d99:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801d9d:	48 ba be 1b 80 00 00 	movabs $0x801bbe,%rdx
+  801da4:	00 00 00 
+  801da7:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801dae:	00 00 00 
+  801db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db6:	48 b8 ea 3f 80 00 00 	movabs $0x803fea,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	79 4b                	jns    801e13 <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801dc8:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801dcb:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  801dd2:	00 00 00 
+  801dd5:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801dd7:	89 d8                	mov    %ebx,%eax
+  801dd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801ddf:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801deb:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801df2:	00 00 
+  801df4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801df9:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801e00:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801e07:	00 00 00 
+  801e0a:	48 01 c8             	add    %rcx,%rax
+  801e0d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801e11:	eb c4                	jmp    801dd7 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801e13:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e19:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801e1f:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801e26:	00 00 00 
+  801e29:	48 89 f1             	mov    %rsi,%rcx
+  801e2c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e34:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  801e3b:	00 00 00 
+  801e3e:	ff d0                	call   *%rax
+  801e40:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	78 82                	js     801dc8 <sfork+0x4a>
+  801e46:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e4d:	00 00 
+  801e4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e53:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801e5a:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e5d:	48 b8 ed 17 80 00 00 	movabs $0x8017ed,%rax
+  801e64:	00 00 00 
+  801e67:	ff d0                	call   *%rax
+  801e69:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	0f 88 55 ff ff ff    	js     801dc8 <sfork+0x4a>
+  801e73:	be 02 00 00 00       	mov    $0x2,%esi
+  801e78:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e7b:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  801e82:	00 00 00 
+  801e85:	ff d0                	call   *%rax
+  801e87:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	0f 88 37 ff ff ff    	js     801dc8 <sfork+0x4a>
+    return envid;
+  801e91:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801e94:	e9 3e ff ff ff       	jmp    801dd7 <sfork+0x59>
+
+0000000000801e99 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	41 55                	push   %r13
+  801e9f:	41 54                	push   %r12
+  801ea1:	53                   	push   %rbx
+  801ea2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea6:	49 89 fc             	mov    %rdi,%r12
+  801ea9:	48 89 f7             	mov    %rsi,%rdi
+  801eac:	48 89 d3             	mov    %rdx,%rbx
+  801eaf:	49 89 cd             	mov    %rcx,%r13
+  801eb2:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801eb5:	48 85 f6             	test   %rsi,%rsi
+  801eb8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ebf:	00 00 00 
+  801ec2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  801ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecb:	48 85 db             	test   %rbx,%rbx
+  801ece:	74 03                	je     801ed3 <ipc_recv_timeout+0x3a>
+  801ed0:	48 8b 33             	mov    (%rbx),%rsi
+  801ed3:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+    if (res == 0) {
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	75 72                	jne    801f55 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  801ee3:	4d 85 e4             	test   %r12,%r12
+  801ee6:	74 17                	je     801eff <ipc_recv_timeout+0x66>
+  801ee8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801eef:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  801ef1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ef5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  801efb:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  801eff:	4d 85 ed             	test   %r13,%r13
+  801f02:	74 17                	je     801f1b <ipc_recv_timeout+0x82>
+  801f04:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f0b:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  801f0d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f11:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  801f17:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  801f1b:	48 85 db             	test   %rbx,%rbx
+  801f1e:	74 17                	je     801f37 <ipc_recv_timeout+0x9e>
+  801f20:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f27:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  801f29:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f2d:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  801f34:	48 89 03             	mov    %rax,(%rbx)
+  801f37:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f3e:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  801f40:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f44:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  801f4a:	48 83 c4 08          	add    $0x8,%rsp
+  801f4e:	5b                   	pop    %rbx
+  801f4f:	41 5c                	pop    %r12
+  801f51:	41 5d                	pop    %r13
+  801f53:	5d                   	pop    %rbp
+  801f54:	c3                   	ret
+        if (from_env_store) {
+  801f55:	4d 85 e4             	test   %r12,%r12
+  801f58:	74 08                	je     801f62 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  801f5a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f61:	00 
+        if (perm_store) {
+  801f62:	4d 85 ed             	test   %r13,%r13
+  801f65:	74 08                	je     801f6f <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  801f67:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f6e:	00 
+        if (size) {
+  801f6f:	48 85 db             	test   %rbx,%rbx
+  801f72:	74 d6                	je     801f4a <ipc_recv_timeout+0xb1>
+            *size = 0;
+  801f74:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801f7b:	eb cd                	jmp    801f4a <ipc_recv_timeout+0xb1>
+
+0000000000801f7d <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  801f81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f87:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+}
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+
+0000000000801f95 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801f95:	55                   	push   %rbp
+  801f96:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801f99:	48 85 d2             	test   %rdx,%rdx
+  801f9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fa3:	00 00 00 
+  801fa6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  801faa:	89 f6                	mov    %esi,%esi
+  801fac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb2:	48 b8 82 18 80 00 00 	movabs $0x801882,%rax
+  801fb9:	00 00 00 
+  801fbc:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fbe:	85 c0                	test   %eax,%eax
+  801fc0:	78 02                	js     801fc4 <ipc_send+0x2f>
+}
+  801fc2:	5d                   	pop    %rbp
+  801fc3:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  801fc4:	89 c1                	mov    %eax,%ecx
+  801fc6:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801fcd:	00 00 00 
+  801fd0:	be 51 00 00 00       	mov    $0x51,%esi
+  801fd5:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  801fdc:	00 00 00 
+  801fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe4:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  801feb:	00 00 00 
+  801fee:	41 ff d0             	call   *%r8
+
+0000000000801ff1 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	41 54                	push   %r12
+  801ff7:	53                   	push   %rbx
+  801ff8:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  801ffc:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  802000:	48 85 d2             	test   %rdx,%rdx
+  802003:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80200a:	00 00 00 
+  80200d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  802011:	4d 85 c9             	test   %r9,%r9
+  802014:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  802018:	89 f6                	mov    %esi,%esi
+  80201a:	48 83 ec 08          	sub    $0x8,%rsp
+  80201e:	53                   	push   %rbx
+  80201f:	48 b8 6c 19 80 00 00 	movabs $0x80196c,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80202b:	48 83 c4 10          	add    $0x10,%rsp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 65                	js     802098 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802033:	4d 85 e4             	test   %r12,%r12
+  802036:	74 17                	je     80204f <ipc_call+0x5e>
+  802038:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80203f:	00 00 
+  802041:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802045:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80204b:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80204f:	48 85 db             	test   %rbx,%rbx
+  802052:	74 28                	je     80207c <ipc_call+0x8b>
+  802054:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80205b:	00 00 
+  80205d:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802061:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  802068:	ba 20 00 00 00       	mov    $0x20,%edx
+  80206d:	48 89 df             	mov    %rbx,%rdi
+  802070:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  802077:	00 00 00 
+  80207a:	ff d0                	call   *%rax
+  80207c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802083:	00 00 
+    return thisenv->env_ipc_value;
+  802085:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802089:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80208f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802093:	5b                   	pop    %rbx
+  802094:	41 5c                	pop    %r12
+  802096:	5d                   	pop    %rbp
+  802097:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  802098:	89 c1                	mov    %eax,%ecx
+  80209a:	48 ba 21 57 80 00 00 	movabs $0x805721,%rdx
+  8020a1:	00 00 00 
+  8020a4:	be 62 00 00 00       	mov    $0x62,%esi
+  8020a9:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  8020b0:	00 00 00 
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b8:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  8020bf:	00 00 00 
+  8020c2:	41 ff d0             	call   *%r8
+
+00000000008020c5 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8020c5:	55                   	push   %rbp
+  8020c6:	48 89 e5             	mov    %rsp,%rbp
+  8020c9:	41 57                	push   %r15
+  8020cb:	41 56                	push   %r14
+  8020cd:	41 55                	push   %r13
+  8020cf:	41 54                	push   %r12
+  8020d1:	53                   	push   %rbx
+  8020d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8020d6:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8020d9:	48 89 d3             	mov    %rdx,%rbx
+  8020dc:	49 89 ce             	mov    %rcx,%r14
+  8020df:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8020e3:	4d 89 cd             	mov    %r9,%r13
+  8020e6:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8020ea:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8020ee:	48 85 d2             	test   %rdx,%rdx
+  8020f1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8020f8:	00 00 00 
+  8020fb:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8020ff:	4d 85 e4             	test   %r12,%r12
+  802102:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  802106:	89 f0                	mov    %esi,%eax
+  802108:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80210c:	41 57                	push   %r15
+  80210e:	4d 89 e1             	mov    %r12,%r9
+  802111:	48 89 da             	mov    %rbx,%rdx
+  802114:	48 89 c6             	mov    %rax,%rsi
+  802117:	48 b8 c1 19 80 00 00 	movabs $0x8019c1,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  802123:	48 83 c4 10          	add    $0x10,%rsp
+  802127:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80212a:	0f 84 93 00 00 00    	je     8021c3 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  802130:	85 c0                	test   %eax,%eax
+  802132:	0f 88 f3 00 00 00    	js     80222b <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802138:	4d 85 ed             	test   %r13,%r13
+  80213b:	74 17                	je     802154 <ipc_reply_wait+0x8f>
+  80213d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802144:	00 00 
+  802146:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80214a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  802150:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802154:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802159:	74 19                	je     802174 <ipc_reply_wait+0xaf>
+  80215b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802162:	00 00 
+  802164:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802168:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80216e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  802172:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802174:	4d 85 ff             	test   %r15,%r15
+  802177:	74 28                	je     8021a1 <ipc_reply_wait+0xdc>
+  802179:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802180:	00 00 
+  802182:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  802186:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80218d:	ba 20 00 00 00       	mov    $0x20,%edx
+  802192:	4c 89 ff             	mov    %r15,%rdi
+  802195:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+  8021a1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021a8:	00 00 
+    return thisenv->env_ipc_value;
+  8021aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021ae:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8021b4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8021b8:	5b                   	pop    %rbx
+  8021b9:	41 5c                	pop    %r12
+  8021bb:	41 5d                	pop    %r13
+  8021bd:	41 5e                	pop    %r14
+  8021bf:	41 5f                	pop    %r15
+  8021c1:	5d                   	pop    %rbp
+  8021c2:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8021c3:	4d 89 f9             	mov    %r15,%r9
+  8021c6:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8021ca:	4c 89 f1             	mov    %r14,%rcx
+  8021cd:	48 89 da             	mov    %rbx,%rdx
+  8021d0:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8021d4:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8021d7:	48 b8 82 18 80 00 00 	movabs $0x801882,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	85 c0                	test   %eax,%eax
+  8021e5:	78 17                	js     8021fe <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8021e7:	4c 89 f6             	mov    %r14,%rsi
+  8021ea:	4c 89 e7             	mov    %r12,%rdi
+  8021ed:	48 b8 03 19 80 00 00 	movabs $0x801903,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+  8021f9:	e9 32 ff ff ff       	jmp    802130 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8021fe:	89 c1                	mov    %eax,%ecx
+  802200:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  802207:	00 00 00 
+  80220a:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80220f:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  802216:	00 00 00 
+  802219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221e:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  802225:	00 00 00 
+  802228:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80222b:	89 c1                	mov    %eax,%ecx
+  80222d:	48 ba 38 57 80 00 00 	movabs $0x805738,%rdx
+  802234:	00 00 00 
+  802237:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80223c:	48 bf 17 57 80 00 00 	movabs $0x805717,%rdi
+  802243:	00 00 00 
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224b:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  802252:	00 00 00 
+  802255:	41 ff d0             	call   *%r8
+
+0000000000802258 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80225d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802264:	00 00 00 
+  802267:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  80226e:	48 01 ca             	add    %rcx,%rdx
+  802271:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802277:	39 fa                	cmp    %edi,%edx
+  802279:	74 12                	je     80228d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80227b:	48 83 c0 01          	add    $0x1,%rax
+  80227f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802285:	75 e0                	jne    802267 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802287:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80228c:	c3                   	ret
+            return envs[i].env_id;
+  80228d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802294:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80229b:	00 00 00 
+  80229e:	48 01 d0             	add    %rdx,%rax
+  8022a1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022a7:	c3                   	ret
+
+00000000008022a8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022a8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022af:	ff ff ff 
+  8022b2:	48 01 f8             	add    %rdi,%rax
+  8022b5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022b9:	c3                   	ret
+
+00000000008022ba <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022ba:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022c1:	ff ff ff 
+  8022c4:	48 01 f8             	add    %rdi,%rax
+  8022c7:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022cb:	48 c1 e0 12          	shl    $0x12,%rax
+  8022cf:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8022d4:	48 01 d0             	add    %rdx,%rax
+}
+  8022d7:	c3                   	ret
+
+00000000008022d8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022d8:	55                   	push   %rbp
+  8022d9:	48 89 e5             	mov    %rsp,%rbp
+  8022dc:	41 57                	push   %r15
+  8022de:	41 56                	push   %r14
+  8022e0:	41 55                	push   %r13
+  8022e2:	41 54                	push   %r12
+  8022e4:	53                   	push   %rbx
+  8022e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e9:	49 89 ff             	mov    %rdi,%r15
+  8022ec:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8022f1:	49 bd 76 3f 80 00 00 	movabs $0x803f76,%r13
+  8022f8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8022fb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802301:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802304:	48 89 df             	mov    %rbx,%rdi
+  802307:	41 ff d5             	call   *%r13
+  80230a:	83 e0 04             	and    $0x4,%eax
+  80230d:	74 17                	je     802326 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80230f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802316:	4c 39 f3             	cmp    %r14,%rbx
+  802319:	75 e6                	jne    802301 <fd_alloc+0x29>
+  80231b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802321:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802326:	4d 89 27             	mov    %r12,(%r15)
+}
+  802329:	48 83 c4 08          	add    $0x8,%rsp
+  80232d:	5b                   	pop    %rbx
+  80232e:	41 5c                	pop    %r12
+  802330:	41 5d                	pop    %r13
+  802332:	41 5e                	pop    %r14
+  802334:	41 5f                	pop    %r15
+  802336:	5d                   	pop    %rbp
+  802337:	c3                   	ret
+
+0000000000802338 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802338:	83 ff 1f             	cmp    $0x1f,%edi
+  80233b:	77 39                	ja     802376 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	41 54                	push   %r12
+  802343:	53                   	push   %rbx
+  802344:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802347:	48 63 df             	movslq %edi,%rbx
+  80234a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802351:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802355:	48 89 df             	mov    %rbx,%rdi
+  802358:	48 b8 76 3f 80 00 00 	movabs $0x803f76,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	a8 04                	test   $0x4,%al
+  802366:	74 14                	je     80237c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802368:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80236c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802371:	5b                   	pop    %rbx
+  802372:	41 5c                	pop    %r12
+  802374:	5d                   	pop    %rbp
+  802375:	c3                   	ret
+        return -E_INVAL;
+  802376:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80237b:	c3                   	ret
+        return -E_INVAL;
+  80237c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802381:	eb ee                	jmp    802371 <fd_lookup+0x39>
+
+0000000000802383 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	41 54                	push   %r12
+  802389:	53                   	push   %rbx
+  80238a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80238d:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  802394:	00 00 00 
+  802397:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80239e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023a1:	39 3b                	cmp    %edi,(%rbx)
+  8023a3:	74 4a                	je     8023ef <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023a5:	48 83 c0 08          	add    $0x8,%rax
+  8023a9:	48 8b 18             	mov    (%rax),%rbx
+  8023ac:	48 85 db             	test   %rbx,%rbx
+  8023af:	75 f0                	jne    8023a1 <dev_lookup+0x1e>
+  8023b1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023b8:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023c4:	89 fa                	mov    %edi,%edx
+  8023c6:	48 bf 58 57 80 00 00 	movabs $0x805758,%rdi
+  8023cd:	00 00 00 
+  8023d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d5:	48 b9 ac 05 80 00 00 	movabs $0x8005ac,%rcx
+  8023dc:	00 00 00 
+  8023df:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023e6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023ea:	5b                   	pop    %rbx
+  8023eb:	41 5c                	pop    %r12
+  8023ed:	5d                   	pop    %rbp
+  8023ee:	c3                   	ret
+            return 0;
+  8023ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f4:	eb f0                	jmp    8023e6 <dev_lookup+0x63>
+
+00000000008023f6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8023f6:	55                   	push   %rbp
+  8023f7:	48 89 e5             	mov    %rsp,%rbp
+  8023fa:	41 55                	push   %r13
+  8023fc:	41 54                	push   %r12
+  8023fe:	53                   	push   %rbx
+  8023ff:	48 83 ec 18          	sub    $0x18,%rsp
+  802403:	48 89 fb             	mov    %rdi,%rbx
+  802406:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802409:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802410:	ff ff ff 
+  802413:	48 01 df             	add    %rbx,%rdi
+  802416:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80241a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80241e:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802425:	00 00 00 
+  802428:	ff d0                	call   *%rax
+  80242a:	41 89 c5             	mov    %eax,%r13d
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	78 06                	js     802437 <fd_close+0x41>
+  802431:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802435:	74 1a                	je     802451 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802437:	45 84 e4             	test   %r12b,%r12b
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802443:	44 89 e8             	mov    %r13d,%eax
+  802446:	48 83 c4 18          	add    $0x18,%rsp
+  80244a:	5b                   	pop    %rbx
+  80244b:	41 5c                	pop    %r12
+  80244d:	41 5d                	pop    %r13
+  80244f:	5d                   	pop    %rbp
+  802450:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802451:	8b 3b                	mov    (%rbx),%edi
+  802453:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802457:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  80245e:	00 00 00 
+  802461:	ff d0                	call   *%rax
+  802463:	41 89 c5             	mov    %eax,%r13d
+  802466:	85 c0                	test   %eax,%eax
+  802468:	78 1b                	js     802485 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80246a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80246e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802472:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802478:	48 85 c0             	test   %rax,%rax
+  80247b:	74 08                	je     802485 <fd_close+0x8f>
+  80247d:	48 89 df             	mov    %rbx,%rdi
+  802480:	ff d0                	call   *%rax
+  802482:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802485:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80248a:	48 89 de             	mov    %rbx,%rsi
+  80248d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802492:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+    return res;
+  80249e:	eb a3                	jmp    802443 <fd_close+0x4d>
+
+00000000008024a0 <close>:
+
+int
+close(int fdnum) {
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+  8024a4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024a8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024ac:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	78 15                	js     8024d1 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8024c1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024c5:	48 b8 f6 23 80 00 00 	movabs $0x8023f6,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+}
+  8024d1:	c9                   	leave
+  8024d2:	c3                   	ret
+
+00000000008024d3 <close_all>:
+
+void
+close_all(void) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+  8024d7:	41 54                	push   %r12
+  8024d9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024df:	49 bc a0 24 80 00 00 	movabs $0x8024a0,%r12
+  8024e6:	00 00 00 
+  8024e9:	89 df                	mov    %ebx,%edi
+  8024eb:	41 ff d4             	call   *%r12
+  8024ee:	83 c3 01             	add    $0x1,%ebx
+  8024f1:	83 fb 20             	cmp    $0x20,%ebx
+  8024f4:	75 f3                	jne    8024e9 <close_all+0x16>
+}
+  8024f6:	5b                   	pop    %rbx
+  8024f7:	41 5c                	pop    %r12
+  8024f9:	5d                   	pop    %rbp
+  8024fa:	c3                   	ret
+
+00000000008024fb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	41 57                	push   %r15
+  802501:	41 56                	push   %r14
+  802503:	41 55                	push   %r13
+  802505:	41 54                	push   %r12
+  802507:	53                   	push   %rbx
+  802508:	48 83 ec 38          	sub    $0x38,%rsp
+  80250c:	41 89 f7             	mov    %esi,%r15d
+  80250f:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802512:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802516:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80251d:	00 00 00 
+  802520:	ff d0                	call   *%rax
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	85 c0                	test   %eax,%eax
+  802526:	0f 88 ec 00 00 00    	js     802618 <dup+0x11d>
+    close(newfdnum);
+  80252c:	44 89 ff             	mov    %r15d,%edi
+  80252f:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80253b:	49 63 c7             	movslq %r15d,%rax
+  80253e:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802544:	48 c1 e0 0c          	shl    $0xc,%rax
+  802548:	49 89 c6             	mov    %rax,%r14
+  80254b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80254f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802553:	4c 89 ff             	mov    %r15,%rdi
+  802556:	48 bb ba 22 80 00 00 	movabs $0x8022ba,%rbx
+  80255d:	00 00 00 
+  802560:	ff d3                	call   *%rbx
+  802562:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802565:	4c 89 f7             	mov    %r14,%rdi
+  802568:	ff d3                	call   *%rbx
+  80256a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80256e:	4c 89 e7             	mov    %r12,%rdi
+  802571:	48 b8 76 3f 80 00 00 	movabs $0x803f76,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+  80257d:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802580:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802585:	49 be 76 3f 80 00 00 	movabs $0x803f76,%r14
+  80258c:	00 00 00 
+  80258f:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802593:	41 ff d6             	call   *%r14
+  802596:	44 39 e8             	cmp    %r13d,%eax
+  802599:	75 10                	jne    8025ab <dup+0xb0>
+  80259b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025a2:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025a9:	75 e4                	jne    80258f <dup+0x94>
+    if (prot & PROT_R) {
+  8025ab:	41 f6 c5 04          	test   $0x4,%r13b
+  8025af:	74 29                	je     8025da <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025b1:	45 89 e9             	mov    %r13d,%r9d
+  8025b4:	49 89 d8             	mov    %rbx,%r8
+  8025b7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c0:	4c 89 e6             	mov    %r12,%rsi
+  8025c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c8:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+  8025d4:	89 c3                	mov    %eax,%ebx
+  8025d6:	85 c0                	test   %eax,%eax
+  8025d8:	78 4f                	js     802629 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8025da:	4c 89 ff             	mov    %r15,%rdi
+  8025dd:	48 b8 76 3f 80 00 00 	movabs $0x803f76,%rax
+  8025e4:	00 00 00 
+  8025e7:	ff d0                	call   *%rax
+  8025e9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025ec:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025f2:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8025f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fb:	4c 89 fe             	mov    %r15,%rsi
+  8025fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802603:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+  80260f:	89 c3                	mov    %eax,%ebx
+  802611:	85 c0                	test   %eax,%eax
+  802613:	78 14                	js     802629 <dup+0x12e>
+
+    return newfdnum;
+  802615:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802618:	89 d8                	mov    %ebx,%eax
+  80261a:	48 83 c4 38          	add    $0x38,%rsp
+  80261e:	5b                   	pop    %rbx
+  80261f:	41 5c                	pop    %r12
+  802621:	41 5d                	pop    %r13
+  802623:	41 5e                	pop    %r14
+  802625:	41 5f                	pop    %r15
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802629:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80262e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802632:	bf 00 00 00 00       	mov    $0x0,%edi
+  802637:	49 bc b5 15 80 00 00 	movabs $0x8015b5,%r12
+  80263e:	00 00 00 
+  802641:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802644:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802649:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80264d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802652:	41 ff d4             	call   *%r12
+    return res;
+  802655:	eb c1                	jmp    802618 <dup+0x11d>
+
+0000000000802657 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802657:	55                   	push   %rbp
+  802658:	48 89 e5             	mov    %rsp,%rbp
+  80265b:	41 56                	push   %r14
+  80265d:	41 55                	push   %r13
+  80265f:	41 54                	push   %r12
+  802661:	53                   	push   %rbx
+  802662:	48 83 ec 10          	sub    $0x10,%rsp
+  802666:	89 fb                	mov    %edi,%ebx
+  802668:	49 89 f4             	mov    %rsi,%r12
+  80266b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802672:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	78 4c                	js     8026ce <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802682:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802686:	41 8b 3e             	mov    (%r14),%edi
+  802689:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80268d:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	78 35                	js     8026d2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80269d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026a1:	83 e0 03             	and    $0x3,%eax
+  8026a4:	83 f8 01             	cmp    $0x1,%eax
+  8026a7:	74 2d                	je     8026d6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026ad:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026b1:	48 85 c0             	test   %rax,%rax
+  8026b4:	74 59                	je     80270f <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026b6:	4c 89 ea             	mov    %r13,%rdx
+  8026b9:	4c 89 e6             	mov    %r12,%rsi
+  8026bc:	4c 89 f7             	mov    %r14,%rdi
+  8026bf:	ff d0                	call   *%rax
+}
+  8026c1:	48 83 c4 10          	add    $0x10,%rsp
+  8026c5:	5b                   	pop    %rbx
+  8026c6:	41 5c                	pop    %r12
+  8026c8:	41 5d                	pop    %r13
+  8026ca:	41 5e                	pop    %r14
+  8026cc:	5d                   	pop    %rbp
+  8026cd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ce:	48 98                	cltq
+  8026d0:	eb ef                	jmp    8026c1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026d2:	48 98                	cltq
+  8026d4:	eb eb                	jmp    8026c1 <read+0x6a>
+  8026d6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8026dd:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026df:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026e3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026e9:	89 da                	mov    %ebx,%edx
+  8026eb:	48 bf 99 57 80 00 00 	movabs $0x805799,%rdi
+  8026f2:	00 00 00 
+  8026f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fa:	48 b9 ac 05 80 00 00 	movabs $0x8005ac,%rcx
+  802701:	00 00 00 
+  802704:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802706:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80270d:	eb b2                	jmp    8026c1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80270f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802716:	eb a9                	jmp    8026c1 <read+0x6a>
+
+0000000000802718 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802718:	55                   	push   %rbp
+  802719:	48 89 e5             	mov    %rsp,%rbp
+  80271c:	41 57                	push   %r15
+  80271e:	41 56                	push   %r14
+  802720:	41 55                	push   %r13
+  802722:	41 54                	push   %r12
+  802724:	53                   	push   %rbx
+  802725:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802729:	48 85 d2             	test   %rdx,%rdx
+  80272c:	74 54                	je     802782 <readn+0x6a>
+  80272e:	41 89 fd             	mov    %edi,%r13d
+  802731:	49 89 f6             	mov    %rsi,%r14
+  802734:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802737:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80273c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802741:	49 bf 57 26 80 00 00 	movabs $0x802657,%r15
+  802748:	00 00 00 
+  80274b:	4c 89 e2             	mov    %r12,%rdx
+  80274e:	48 29 f2             	sub    %rsi,%rdx
+  802751:	4c 01 f6             	add    %r14,%rsi
+  802754:	44 89 ef             	mov    %r13d,%edi
+  802757:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	78 20                	js     80277e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80275e:	01 c3                	add    %eax,%ebx
+  802760:	85 c0                	test   %eax,%eax
+  802762:	74 08                	je     80276c <readn+0x54>
+  802764:	48 63 f3             	movslq %ebx,%rsi
+  802767:	4c 39 e6             	cmp    %r12,%rsi
+  80276a:	72 df                	jb     80274b <readn+0x33>
+    }
+    return res;
+  80276c:	48 63 c3             	movslq %ebx,%rax
+}
+  80276f:	48 83 c4 08          	add    $0x8,%rsp
+  802773:	5b                   	pop    %rbx
+  802774:	41 5c                	pop    %r12
+  802776:	41 5d                	pop    %r13
+  802778:	41 5e                	pop    %r14
+  80277a:	41 5f                	pop    %r15
+  80277c:	5d                   	pop    %rbp
+  80277d:	c3                   	ret
+        if (inc < 0) return inc;
+  80277e:	48 98                	cltq
+  802780:	eb ed                	jmp    80276f <readn+0x57>
+    int inc = 1, res = 0;
+  802782:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802787:	eb e3                	jmp    80276c <readn+0x54>
+
+0000000000802789 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802789:	55                   	push   %rbp
+  80278a:	48 89 e5             	mov    %rsp,%rbp
+  80278d:	41 56                	push   %r14
+  80278f:	41 55                	push   %r13
+  802791:	41 54                	push   %r12
+  802793:	53                   	push   %rbx
+  802794:	48 83 ec 10          	sub    $0x10,%rsp
+  802798:	89 fb                	mov    %edi,%ebx
+  80279a:	49 89 f4             	mov    %rsi,%r12
+  80279d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027a4:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8027ab:	00 00 00 
+  8027ae:	ff d0                	call   *%rax
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	78 47                	js     8027fb <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027b4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027b8:	41 8b 3e             	mov    (%r14),%edi
+  8027bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027bf:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  8027c6:	00 00 00 
+  8027c9:	ff d0                	call   *%rax
+  8027cb:	85 c0                	test   %eax,%eax
+  8027cd:	78 30                	js     8027ff <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027cf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027d4:	74 2d                	je     802803 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027da:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027de:	48 85 c0             	test   %rax,%rax
+  8027e1:	74 59                	je     80283c <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8027e3:	4c 89 ea             	mov    %r13,%rdx
+  8027e6:	4c 89 e6             	mov    %r12,%rsi
+  8027e9:	4c 89 f7             	mov    %r14,%rdi
+  8027ec:	ff d0                	call   *%rax
+}
+  8027ee:	48 83 c4 10          	add    $0x10,%rsp
+  8027f2:	5b                   	pop    %rbx
+  8027f3:	41 5c                	pop    %r12
+  8027f5:	41 5d                	pop    %r13
+  8027f7:	41 5e                	pop    %r14
+  8027f9:	5d                   	pop    %rbp
+  8027fa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027fb:	48 98                	cltq
+  8027fd:	eb ef                	jmp    8027ee <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027ff:	48 98                	cltq
+  802801:	eb eb                	jmp    8027ee <write+0x65>
+  802803:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80280a:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80280c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802810:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802816:	89 da                	mov    %ebx,%edx
+  802818:	48 bf b5 57 80 00 00 	movabs $0x8057b5,%rdi
+  80281f:	00 00 00 
+  802822:	b8 00 00 00 00       	mov    $0x0,%eax
+  802827:	48 b9 ac 05 80 00 00 	movabs $0x8005ac,%rcx
+  80282e:	00 00 00 
+  802831:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802833:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80283a:	eb b2                	jmp    8027ee <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80283c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802843:	eb a9                	jmp    8027ee <write+0x65>
+
+0000000000802845 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802845:	55                   	push   %rbp
+  802846:	48 89 e5             	mov    %rsp,%rbp
+  802849:	53                   	push   %rbx
+  80284a:	48 83 ec 18          	sub    $0x18,%rsp
+  80284e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802850:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802854:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 0c                	js     802870 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802864:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802868:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80286b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802870:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802874:	c9                   	leave
+  802875:	c3                   	ret
+
+0000000000802876 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802876:	55                   	push   %rbp
+  802877:	48 89 e5             	mov    %rsp,%rbp
+  80287a:	41 55                	push   %r13
+  80287c:	41 54                	push   %r12
+  80287e:	53                   	push   %rbx
+  80287f:	48 83 ec 18          	sub    $0x18,%rsp
+  802883:	89 fb                	mov    %edi,%ebx
+  802885:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802888:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80288c:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802893:	00 00 00 
+  802896:	ff d0                	call   *%rax
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	78 38                	js     8028d4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80289c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028a0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028a4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028a8:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 1c                	js     8028d4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028b8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028bd:	74 20                	je     8028df <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028c3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028c7:	48 85 c0             	test   %rax,%rax
+  8028ca:	74 4a                	je     802916 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028cc:	44 89 e6             	mov    %r12d,%esi
+  8028cf:	4c 89 ef             	mov    %r13,%rdi
+  8028d2:	ff d0                	call   *%rax
+}
+  8028d4:	48 83 c4 18          	add    $0x18,%rsp
+  8028d8:	5b                   	pop    %rbx
+  8028d9:	41 5c                	pop    %r12
+  8028db:	41 5d                	pop    %r13
+  8028dd:	5d                   	pop    %rbp
+  8028de:	c3                   	ret
+  8028df:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8028e6:	00 00 
+                thisenv->env_id, fdnum);
+  8028e8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028ec:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028f2:	89 da                	mov    %ebx,%edx
+  8028f4:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8028fb:	00 00 00 
+  8028fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802903:	48 b9 ac 05 80 00 00 	movabs $0x8005ac,%rcx
+  80290a:	00 00 00 
+  80290d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80290f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802914:	eb be                	jmp    8028d4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802916:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80291b:	eb b7                	jmp    8028d4 <ftruncate+0x5e>
+
+000000000080291d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80291d:	55                   	push   %rbp
+  80291e:	48 89 e5             	mov    %rsp,%rbp
+  802921:	41 54                	push   %r12
+  802923:	53                   	push   %rbx
+  802924:	48 83 ec 10          	sub    $0x10,%rsp
+  802928:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80292b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80292f:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	78 4e                	js     80298d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80293f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802943:	41 8b 3c 24          	mov    (%r12),%edi
+  802947:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80294b:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  802952:	00 00 00 
+  802955:	ff d0                	call   *%rax
+  802957:	85 c0                	test   %eax,%eax
+  802959:	78 32                	js     80298d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80295b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80295f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802964:	74 30                	je     802996 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802966:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802969:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802970:	00 00 00 
+    stat->st_isdir = 0;
+  802973:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80297a:	00 00 00 
+    stat->st_dev = dev;
+  80297d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802984:	48 89 de             	mov    %rbx,%rsi
+  802987:	4c 89 e7             	mov    %r12,%rdi
+  80298a:	ff 50 28             	call   *0x28(%rax)
+}
+  80298d:	48 83 c4 10          	add    $0x10,%rsp
+  802991:	5b                   	pop    %rbx
+  802992:	41 5c                	pop    %r12
+  802994:	5d                   	pop    %rbp
+  802995:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802996:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80299b:	eb f0                	jmp    80298d <fstat+0x70>
+
+000000000080299d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80299d:	55                   	push   %rbp
+  80299e:	48 89 e5             	mov    %rsp,%rbp
+  8029a1:	41 54                	push   %r12
+  8029a3:	53                   	push   %rbx
+  8029a4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ac:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 25                	js     8029e3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029be:	4c 89 e6             	mov    %r12,%rsi
+  8029c1:	89 c7                	mov    %eax,%edi
+  8029c3:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+  8029cf:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029d2:	89 df                	mov    %ebx,%edi
+  8029d4:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+
+    return res;
+  8029e0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029e3:	89 d8                	mov    %ebx,%eax
+  8029e5:	5b                   	pop    %rbx
+  8029e6:	41 5c                	pop    %r12
+  8029e8:	5d                   	pop    %rbp
+  8029e9:	c3                   	ret
+
+00000000008029ea <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029ea:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8029f1:	00 00 00 
+  8029f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f9:	eb 0e                	jmp    802a09 <mmap_lookup+0x1f>
+  8029fb:	48 83 c2 01          	add    $0x1,%rdx
+  8029ff:	48 83 c0 20          	add    $0x20,%rax
+  802a03:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a07:	74 2b                	je     802a34 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a09:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a0d:	48 85 c9             	test   %rcx,%rcx
+  802a10:	74 e9                	je     8029fb <mmap_lookup+0x11>
+  802a12:	48 8b 30             	mov    (%rax),%rsi
+  802a15:	48 39 f7             	cmp    %rsi,%rdi
+  802a18:	72 e1                	jb     8029fb <mmap_lookup+0x11>
+  802a1a:	48 01 f1             	add    %rsi,%rcx
+  802a1d:	48 39 cf             	cmp    %rcx,%rdi
+  802a20:	73 d9                	jae    8029fb <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a22:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a26:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a2d:	00 00 00 
+  802a30:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a33:	c3                   	ret
+    return NULL;
+  802a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a39:	c3                   	ret
+
+0000000000802a3a <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	41 54                	push   %r12
+  802a40:	53                   	push   %rbx
+  802a41:	89 fb                	mov    %edi,%ebx
+  802a43:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a46:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a4d:	00 00 00 
+  802a50:	83 38 00             	cmpl   $0x0,(%rax)
+  802a53:	74 3d                	je     802a92 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a55:	41 54                	push   %r12
+  802a57:	6a 00                	push   $0x0
+  802a59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6f:	89 de                	mov    %ebx,%esi
+  802a71:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802a78:	00 00 00 
+  802a7b:	8b 38                	mov    (%rax),%edi
+  802a7d:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+}
+  802a89:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a8d:	5b                   	pop    %rbx
+  802a8e:	41 5c                	pop    %r12
+  802a90:	5d                   	pop    %rbp
+  802a91:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a92:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a97:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  802a9e:	00 00 00 
+  802aa1:	ff d0                	call   *%rax
+  802aa3:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802aaa:	00 00 
+  802aac:	eb a7                	jmp    802a55 <fsipc_words+0x1b>
+
+0000000000802aae <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802ab6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802abd:	00 
+  802abe:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ac5:	00 
+  802ac6:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802aca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ace:	48 63 f6             	movslq %esi,%rsi
+  802ad1:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802ad5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ad9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ade:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  802ae5:	00 00 00 
+  802ae8:	ff d0                	call   *%rax
+}
+  802aea:	c9                   	leave
+  802aeb:	c3                   	ret
+
+0000000000802aec <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802aec:	55                   	push   %rbp
+  802aed:	48 89 e5             	mov    %rsp,%rbp
+  802af0:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802af4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802afb:	00 
+  802afc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b03:	00 
+  802b04:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b0b:	00 
+  802b0c:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b10:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b14:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b18:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b1d:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  802b24:	00 00 00 
+  802b27:	ff d0                	call   *%rax
+}
+  802b29:	c9                   	leave
+  802b2a:	c3                   	ret
+
+0000000000802b2b <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b2b:	55                   	push   %rbp
+  802b2c:	48 89 e5             	mov    %rsp,%rbp
+  802b2f:	41 54                	push   %r12
+  802b31:	53                   	push   %rbx
+  802b32:	89 fb                	mov    %edi,%ebx
+  802b34:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b37:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b3e:	00 00 00 
+  802b41:	83 38 00             	cmpl   $0x0,(%rax)
+  802b44:	74 3f                	je     802b85 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b46:	6a 00                	push   $0x0
+  802b48:	6a 00                	push   $0x0
+  802b4a:	4d 89 e1             	mov    %r12,%r9
+  802b4d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b53:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b58:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802b5f:	00 00 00 
+  802b62:	89 de                	mov    %ebx,%esi
+  802b64:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802b6b:	00 00 00 
+  802b6e:	8b 38                	mov    (%rax),%edi
+  802b70:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+}
+  802b7c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b80:	5b                   	pop    %rbx
+  802b81:	41 5c                	pop    %r12
+  802b83:	5d                   	pop    %rbp
+  802b84:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b85:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b8a:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+  802b96:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802b9d:	00 00 
+  802b9f:	eb a5                	jmp    802b46 <fsipc+0x1b>
+
+0000000000802ba1 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+  802ba5:	41 54                	push   %r12
+  802ba7:	53                   	push   %rbx
+  802ba8:	41 89 fc             	mov    %edi,%r12d
+  802bab:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bae:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802bb5:	00 00 00 
+  802bb8:	83 38 00             	cmpl   $0x0,(%rax)
+  802bbb:	74 46                	je     802c03 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bbd:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bc1:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bc5:	6a 00                	push   $0x0
+  802bc7:	6a 00                	push   $0x0
+  802bc9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bcf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bd5:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802bdc:	00 00 00 
+  802bdf:	44 89 e6             	mov    %r12d,%esi
+  802be2:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802be9:	00 00 00 
+  802bec:	8b 38                	mov    (%rax),%edi
+  802bee:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+}
+  802bfa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802bfe:	5b                   	pop    %rbx
+  802bff:	41 5c                	pop    %r12
+  802c01:	5d                   	pop    %rbp
+  802c02:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c03:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c08:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802c1b:	00 00 
+  802c1d:	eb 9e                	jmp    802bbd <fsipcv+0x1c>
+
+0000000000802c1f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c1f:	55                   	push   %rbp
+  802c20:	48 89 e5             	mov    %rsp,%rbp
+  802c23:	41 54                	push   %r12
+  802c25:	53                   	push   %rbx
+  802c26:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c29:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c2c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802c33:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c35:	be 00 00 00 00       	mov    $0x0,%esi
+  802c3a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c3f:	48 b8 2b 2b 80 00 00 	movabs $0x802b2b,%rax
+  802c46:	00 00 00 
+  802c49:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c4b:	85 c0                	test   %eax,%eax
+  802c4d:	78 3d                	js     802c8c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c4f:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802c56:	00 00 00 
+  802c59:	4c 89 e6             	mov    %r12,%rsi
+  802c5c:	48 89 df             	mov    %rbx,%rdi
+  802c5f:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  802c66:	00 00 00 
+  802c69:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c6b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c72:	00 
+  802c73:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c79:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c80:	00 
+  802c81:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8c:	5b                   	pop    %rbx
+  802c8d:	41 5c                	pop    %r12
+  802c8f:	5d                   	pop    %rbp
+  802c90:	c3                   	ret
+
+0000000000802c91 <fsipcv_buf>:
+    return FSIPCV;
+  802c91:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c98:	00 00 00 
+    if (!allocated) {
+  802c9b:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  802ca2:	00 00 00 
+  802ca5:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802ca8:	74 01                	je     802cab <fsipcv_buf+0x1a>
+}
+  802caa:	c3                   	ret
+fsipcv_buf(void) {
+  802cab:	55                   	push   %rbp
+  802cac:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802caf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cb4:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802cb9:	48 89 c6             	mov    %rax,%rsi
+  802cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc1:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  802ccd:	85 c0                	test   %eax,%eax
+  802ccf:	78 19                	js     802cea <fsipcv_buf+0x59>
+        allocated = 1;
+  802cd1:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802cd8:	00 00 00 
+  802cdb:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802cde:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ce5:	00 00 00 
+}
+  802ce8:	5d                   	pop    %rbp
+  802ce9:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cef:	eb f7                	jmp    802ce8 <fsipcv_buf+0x57>
+
+0000000000802cf1 <devfile_write>:
+    if (!fd || !buf) {
+  802cf1:	48 85 ff             	test   %rdi,%rdi
+  802cf4:	0f 84 46 01 00 00    	je     802e40 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cfa:	55                   	push   %rbp
+  802cfb:	48 89 e5             	mov    %rsp,%rbp
+  802cfe:	41 57                	push   %r15
+  802d00:	41 56                	push   %r14
+  802d02:	41 55                	push   %r13
+  802d04:	41 54                	push   %r12
+  802d06:	53                   	push   %rbx
+  802d07:	48 83 ec 18          	sub    $0x18,%rsp
+  802d0b:	49 89 ff             	mov    %rdi,%r15
+  802d0e:	49 89 f5             	mov    %rsi,%r13
+  802d11:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d14:	48 85 f6             	test   %rsi,%rsi
+  802d17:	0f 84 1a 01 00 00    	je     802e37 <devfile_write+0x146>
+    while (n) {
+  802d1d:	48 85 d2             	test   %rdx,%rdx
+  802d20:	0f 84 fc 00 00 00    	je     802e22 <devfile_write+0x131>
+    size_t i = 0;
+  802d26:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d2c:	eb 6c                	jmp    802d9a <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d2e:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d34:	4c 39 e3             	cmp    %r12,%rbx
+  802d37:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d3b:	4c 89 e2             	mov    %r12,%rdx
+  802d3e:	4c 89 ee             	mov    %r13,%rsi
+  802d41:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802d48:	00 00 00 
+  802d4b:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d57:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d5b:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d62:	00 00 00 
+  802d65:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d67:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d70:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d75:	48 b8 2b 2b 80 00 00 	movabs $0x802b2b,%rax
+  802d7c:	00 00 00 
+  802d7f:	ff d0                	call   *%rax
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	0f 88 95 00 00 00    	js     802e1e <devfile_write+0x12d>
+        buf += ret;
+  802d89:	48 98                	cltq
+  802d8b:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d8e:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802d91:	48 29 c3             	sub    %rax,%rbx
+  802d94:	0f 84 8b 00 00 00    	je     802e25 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802d9a:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802da1:	76 8b                	jbe    802d2e <devfile_write+0x3d>
+  802da3:	48 b8 91 2c 80 00 00 	movabs $0x802c91,%rax
+  802daa:	00 00 00 
+  802dad:	ff d0                	call   *%rax
+  802daf:	49 89 c4             	mov    %rax,%r12
+  802db2:	48 85 c0             	test   %rax,%rax
+  802db5:	0f 84 73 ff ff ff    	je     802d2e <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802dbb:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dc0:	48 39 c3             	cmp    %rax,%rbx
+  802dc3:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dc7:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802dce:	00 
+  802dcf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802dd3:	48 89 c2             	mov    %rax,%rdx
+  802dd6:	4c 89 ee             	mov    %r13,%rsi
+  802dd9:	48 b9 32 11 80 00 00 	movabs $0x801132,%rcx
+  802de0:	00 00 00 
+  802de3:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802de5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802de9:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df1:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802df6:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802dfd:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e01:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e06:	48 b8 a1 2b 80 00 00 	movabs $0x802ba1,%rax
+  802e0d:	00 00 00 
+  802e10:	ff d0                	call   *%rax
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	0f 89 6f ff ff ff    	jns    802d89 <devfile_write+0x98>
+                return ret;
+  802e1a:	48 98                	cltq
+  802e1c:	eb 0a                	jmp    802e28 <devfile_write+0x137>
+                return ret;
+  802e1e:	48 98                	cltq
+  802e20:	eb 06                	jmp    802e28 <devfile_write+0x137>
+    size_t i = 0;
+  802e22:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e25:	4c 89 f0             	mov    %r14,%rax
+}
+  802e28:	48 83 c4 18          	add    $0x18,%rsp
+  802e2c:	5b                   	pop    %rbx
+  802e2d:	41 5c                	pop    %r12
+  802e2f:	41 5d                	pop    %r13
+  802e31:	41 5e                	pop    %r14
+  802e33:	41 5f                	pop    %r15
+  802e35:	5d                   	pop    %rbp
+  802e36:	c3                   	ret
+        return -E_INVAL;
+  802e37:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e3e:	eb e8                	jmp    802e28 <devfile_write+0x137>
+  802e40:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e47:	c3                   	ret
+
+0000000000802e48 <devfile_read>:
+    if (!fd || !buf) {
+  802e48:	48 85 ff             	test   %rdi,%rdi
+  802e4b:	0f 84 47 01 00 00    	je     802f98 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e51:	55                   	push   %rbp
+  802e52:	48 89 e5             	mov    %rsp,%rbp
+  802e55:	41 57                	push   %r15
+  802e57:	41 56                	push   %r14
+  802e59:	41 55                	push   %r13
+  802e5b:	41 54                	push   %r12
+  802e5d:	53                   	push   %rbx
+  802e5e:	48 83 ec 18          	sub    $0x18,%rsp
+  802e62:	49 89 ff             	mov    %rdi,%r15
+  802e65:	49 89 f5             	mov    %rsi,%r13
+  802e68:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e6b:	48 85 f6             	test   %rsi,%rsi
+  802e6e:	0f 84 1b 01 00 00    	je     802f8f <devfile_read+0x147>
+    while (n) {
+  802e74:	48 85 d2             	test   %rdx,%rdx
+  802e77:	0f 84 fb 00 00 00    	je     802f78 <devfile_read+0x130>
+    size_t i = 0;
+  802e7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e84:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e85:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802e8c:	00 00 00 
+  802e8f:	eb 5f                	jmp    802ef0 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802e91:	48 98                	cltq
+  802e93:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e98:	e9 e3 00 00 00       	jmp    802f80 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e9d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ea1:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802ea4:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802ea8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ead:	bf 03 00 00 00       	mov    $0x3,%edi
+  802eb2:	48 b8 2b 2b 80 00 00 	movabs $0x802b2b,%rax
+  802eb9:	00 00 00 
+  802ebc:	ff d0                	call   *%rax
+  802ebe:	89 c3                	mov    %eax,%ebx
+  802ec0:	85 c0                	test   %eax,%eax
+  802ec2:	0f 8e a7 00 00 00    	jle    802f6f <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802ec8:	48 63 d0             	movslq %eax,%rdx
+  802ecb:	4c 89 f6             	mov    %r14,%rsi
+  802ece:	4c 89 ef             	mov    %r13,%rdi
+  802ed1:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+        buf += ret;
+  802edd:	48 63 db             	movslq %ebx,%rbx
+  802ee0:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802ee3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802ee7:	49 29 dc             	sub    %rbx,%r12
+  802eea:	0f 84 8c 00 00 00    	je     802f7c <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ef0:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802ef7:	76 a4                	jbe    802e9d <devfile_read+0x55>
+  802ef9:	48 b8 91 2c 80 00 00 	movabs $0x802c91,%rax
+  802f00:	00 00 00 
+  802f03:	ff d0                	call   *%rax
+  802f05:	48 89 c1             	mov    %rax,%rcx
+  802f08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f0c:	48 85 c0             	test   %rax,%rax
+  802f0f:	74 8c                	je     802e9d <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f11:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f16:	49 39 f4             	cmp    %rsi,%r12
+  802f19:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f1d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f21:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f23:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f27:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f2e:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f32:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f37:	48 b8 a1 2b 80 00 00 	movabs $0x802ba1,%rax
+  802f3e:	00 00 00 
+  802f41:	ff d0                	call   *%rax
+  802f43:	89 c3                	mov    %eax,%ebx
+  802f45:	85 c0                	test   %eax,%eax
+  802f47:	0f 8e 44 ff ff ff    	jle    802e91 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f4d:	48 63 d0             	movslq %eax,%rdx
+  802f50:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f54:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f5b:	4c 89 ef             	mov    %r13,%rdi
+  802f5e:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f6a:	e9 6e ff ff ff       	jmp    802edd <devfile_read+0x95>
+                return ret ? ret : i;
+  802f6f:	48 98                	cltq
+  802f71:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f76:	eb 08                	jmp    802f80 <devfile_read+0x138>
+    size_t i = 0;
+  802f78:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f80:	48 83 c4 18          	add    $0x18,%rsp
+  802f84:	5b                   	pop    %rbx
+  802f85:	41 5c                	pop    %r12
+  802f87:	41 5d                	pop    %r13
+  802f89:	41 5e                	pop    %r14
+  802f8b:	41 5f                	pop    %r15
+  802f8d:	5d                   	pop    %rbp
+  802f8e:	c3                   	ret
+        return -E_INVAL;
+  802f8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f96:	eb e8                	jmp    802f80 <devfile_read+0x138>
+  802f98:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802f9f:	c3                   	ret
+
+0000000000802fa0 <open>:
+open(const char *path, int mode) {
+  802fa0:	55                   	push   %rbp
+  802fa1:	48 89 e5             	mov    %rsp,%rbp
+  802fa4:	41 55                	push   %r13
+  802fa6:	41 54                	push   %r12
+  802fa8:	53                   	push   %rbx
+  802fa9:	48 83 ec 18          	sub    $0x18,%rsp
+  802fad:	49 89 fc             	mov    %rdi,%r12
+  802fb0:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fb3:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  802fba:	00 00 00 
+  802fbd:	ff d0                	call   *%rax
+  802fbf:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fc5:	0f 87 8a 00 00 00    	ja     803055 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fcb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fcf:	48 b8 d8 22 80 00 00 	movabs $0x8022d8,%rax
+  802fd6:	00 00 00 
+  802fd9:	ff d0                	call   *%rax
+  802fdb:	89 c3                	mov    %eax,%ebx
+  802fdd:	85 c0                	test   %eax,%eax
+  802fdf:	78 50                	js     803031 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fe1:	4c 89 e6             	mov    %r12,%rsi
+  802fe4:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802feb:	00 00 00 
+  802fee:	48 89 df             	mov    %rbx,%rdi
+  802ff1:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ffd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803004:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803008:	bf 01 00 00 00       	mov    $0x1,%edi
+  80300d:	48 b8 2b 2b 80 00 00 	movabs $0x802b2b,%rax
+  803014:	00 00 00 
+  803017:	ff d0                	call   *%rax
+  803019:	89 c3                	mov    %eax,%ebx
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 1f                	js     80303e <open+0x9e>
+    return fd2num(fd);
+  80301f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803023:	48 b8 a8 22 80 00 00 	movabs $0x8022a8,%rax
+  80302a:	00 00 00 
+  80302d:	ff d0                	call   *%rax
+  80302f:	89 c3                	mov    %eax,%ebx
+}
+  803031:	89 d8                	mov    %ebx,%eax
+  803033:	48 83 c4 18          	add    $0x18,%rsp
+  803037:	5b                   	pop    %rbx
+  803038:	41 5c                	pop    %r12
+  80303a:	41 5d                	pop    %r13
+  80303c:	5d                   	pop    %rbp
+  80303d:	c3                   	ret
+        fd_close(fd, 0);
+  80303e:	be 00 00 00 00       	mov    $0x0,%esi
+  803043:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803047:	48 b8 f6 23 80 00 00 	movabs $0x8023f6,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+        return res;
+  803053:	eb dc                	jmp    803031 <open+0x91>
+        return -E_BAD_PATH;
+  803055:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80305a:	eb d5                	jmp    803031 <open+0x91>
+
+000000000080305c <sync>:
+sync(void) {
+  80305c:	55                   	push   %rbp
+  80305d:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803060:	be 00 00 00 00       	mov    $0x0,%esi
+  803065:	bf 08 00 00 00       	mov    $0x8,%edi
+  80306a:	48 b8 2b 2b 80 00 00 	movabs $0x802b2b,%rax
+  803071:	00 00 00 
+  803074:	ff d0                	call   *%rax
+}
+  803076:	5d                   	pop    %rbp
+  803077:	c3                   	ret
+
+0000000000803078 <drop_cache>:
+drop_cache(int fdnum) {
+  803078:	55                   	push   %rbp
+  803079:	48 89 e5             	mov    %rsp,%rbp
+  80307c:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803080:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803084:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 51                	js     8030e5 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803094:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803098:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80309f:	00 00 00 
+  8030a2:	8b 0a                	mov    (%rdx),%ecx
+  8030a4:	39 08                	cmp    %ecx,(%rax)
+  8030a6:	75 3f                	jne    8030e7 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030a8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030af:	00 
+  8030b0:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030b7:	00 
+  8030b8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030bf:	00 
+  8030c0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030c7:	00 
+  8030c8:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8030cc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8030d0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030d4:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030d9:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+}
+  8030e5:	c9                   	leave
+  8030e6:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030ec:	eb f7                	jmp    8030e5 <drop_cache+0x6d>
+
+00000000008030ee <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8030ee:	55                   	push   %rbp
+  8030ef:	48 89 e5             	mov    %rsp,%rbp
+  8030f2:	41 57                	push   %r15
+  8030f4:	41 56                	push   %r14
+  8030f6:	41 55                	push   %r13
+  8030f8:	41 54                	push   %r12
+  8030fa:	53                   	push   %rbx
+  8030fb:	48 83 ec 58          	sub    $0x58,%rsp
+  8030ff:	41 89 f4             	mov    %esi,%r12d
+  803102:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803106:	49 89 cd             	mov    %rcx,%r13
+  803109:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80310c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803110:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  803117:	00 00 00 
+  80311a:	ff d0                	call   *%rax
+  80311c:	48 63 d0             	movslq %eax,%rdx
+  80311f:	85 c0                	test   %eax,%eax
+  803121:	0f 88 36 01 00 00    	js     80325d <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803127:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80312b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803132:	00 00 00 
+  803135:	8b 32                	mov    (%rdx),%esi
+  803137:	39 31                	cmp    %esi,(%rcx)
+  803139:	0f 85 30 01 00 00    	jne    80326f <read_map+0x181>
+  80313f:	45 85 e4             	test   %r12d,%r12d
+  803142:	0f 88 27 01 00 00    	js     80326f <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803148:	49 63 cc             	movslq %r12d,%rcx
+  80314b:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80314f:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803156:	0f 85 1c 01 00 00    	jne    803278 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80315c:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803160:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  803167:	0f 85 14 01 00 00    	jne    803281 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  80316d:	48 63 cb             	movslq %ebx,%rcx
+  803170:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803174:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  80317b:	00 00 00 
+    while (i < n) {
+  80317e:	4d 85 ed             	test   %r13,%r13
+  803181:	75 5c                	jne    8031df <read_map+0xf1>
+  803183:	e9 d2 00 00 00       	jmp    80325a <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803188:	41 8b 3e             	mov    (%r14),%edi
+  80318b:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  80318f:	50                   	push   %rax
+  803190:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  803194:	50                   	push   %rax
+  803195:	4d 89 f9             	mov    %r15,%r9
+  803198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80319e:	48 89 d9             	mov    %rbx,%rcx
+  8031a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a6:	be 09 00 00 00       	mov    $0x9,%esi
+  8031ab:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  8031b2:	00 00 00 
+  8031b5:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031b7:	48 83 c4 10          	add    $0x10,%rsp
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	0f 8e 8f 00 00 00    	jle    803252 <read_map+0x164>
+        if (!mapped_perm) {
+  8031c3:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031c7:	0f 84 80 00 00 00    	je     80324d <read_map+0x15f>
+        i += res;
+  8031cd:	48 63 d0             	movslq %eax,%rdx
+  8031d0:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8031d3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8031d8:	75 78                	jne    803252 <read_map+0x164>
+    while (i < n) {
+  8031da:	4d 39 ec             	cmp    %r13,%r12
+  8031dd:	73 73                	jae    803252 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031e3:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8031e7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031eb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8031ef:	4c 01 e0             	add    %r12,%rax
+  8031f2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8031f6:	4c 89 eb             	mov    %r13,%rbx
+  8031f9:	4c 29 e3             	sub    %r12,%rbx
+  8031fc:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803200:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803204:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  803208:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  80320f:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  803216:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80321b:	48 39 c3             	cmp    %rax,%rbx
+  80321e:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803222:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803226:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80322a:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  80322e:	0f 85 54 ff ff ff    	jne    803188 <read_map+0x9a>
+  803234:	bf 03 00 00 00       	mov    $0x3,%edi
+  803239:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803240:	00 00 00 
+  803243:	ff d0                	call   *%rax
+  803245:	41 89 06             	mov    %eax,(%r14)
+  803248:	e9 3b ff ff ff       	jmp    803188 <read_map+0x9a>
+            res = -E_INVAL;
+  80324d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803252:	4c 89 e2             	mov    %r12,%rdx
+  803255:	4d 85 e4             	test   %r12,%r12
+  803258:	75 03                	jne    80325d <read_map+0x16f>
+  80325a:	48 63 d0             	movslq %eax,%rdx
+}
+  80325d:	48 89 d0             	mov    %rdx,%rax
+  803260:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803264:	5b                   	pop    %rbx
+  803265:	41 5c                	pop    %r12
+  803267:	41 5d                	pop    %r13
+  803269:	41 5e                	pop    %r14
+  80326b:	41 5f                	pop    %r15
+  80326d:	5d                   	pop    %rbp
+  80326e:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80326f:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803276:	eb e5                	jmp    80325d <read_map+0x16f>
+  803278:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80327f:	eb dc                	jmp    80325d <read_map+0x16f>
+  803281:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803288:	eb d3                	jmp    80325d <read_map+0x16f>
+
+000000000080328a <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  80328a:	55                   	push   %rbp
+  80328b:	48 89 e5             	mov    %rsp,%rbp
+  80328e:	41 57                	push   %r15
+  803290:	41 56                	push   %r14
+  803292:	41 55                	push   %r13
+  803294:	41 54                	push   %r12
+  803296:	53                   	push   %rbx
+  803297:	48 83 ec 38          	sub    $0x38,%rsp
+  80329b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80329e:	41 89 f6             	mov    %esi,%r14d
+  8032a1:	49 89 d5             	mov    %rdx,%r13
+  8032a4:	89 cb                	mov    %ecx,%ebx
+  8032a6:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032a9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032ad:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+  8032b9:	85 c0                	test   %eax,%eax
+  8032bb:	0f 88 33 02 00 00    	js     8034f4 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032c6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032ca:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8032d1:	00 00 00 
+  8032d4:	8b 3a                	mov    (%rdx),%edi
+  8032d6:	39 39                	cmp    %edi,(%rcx)
+  8032d8:	0f 85 1b 02 00 00    	jne    8034f9 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8032de:	4d 85 ed             	test   %r13,%r13
+  8032e1:	41 0f 94 c0          	sete   %r8b
+  8032e5:	44 89 f0             	mov    %r14d,%eax
+  8032e8:	c1 e8 1f             	shr    $0x1f,%eax
+  8032eb:	41 08 c0             	or     %al,%r8b
+  8032ee:	0f 85 14 02 00 00    	jne    803508 <mmap+0x27e>
+  8032f4:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8032fb:	0f 85 0e 02 00 00    	jne    80350f <mmap+0x285>
+  803301:	83 fb 07             	cmp    $0x7,%ebx
+  803304:	0f 87 0c 02 00 00    	ja     803516 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80330a:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  803314:	83 fa 01             	cmp    $0x1,%edx
+  803317:	0f 87 dc 01 00 00    	ja     8034f9 <mmap+0x26f>
+  80331d:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  803324:	00 00 00 
+  803327:	eb 0e                	jmp    803337 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803329:	48 83 c0 01          	add    $0x1,%rax
+  80332d:	48 83 c2 20          	add    $0x20,%rdx
+  803331:	48 83 f8 40          	cmp    $0x40,%rax
+  803335:	74 44                	je     80337b <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  803337:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80333b:	75 ec                	jne    803329 <mmap+0x9f>
+  80333d:	48 c1 e0 05          	shl    $0x5,%rax
+  803341:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803348:	00 00 00 
+  80334b:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  80334f:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803356:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80335d:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803360:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  803367:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80336a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80336f:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  803376:	00 00 00 
+  803379:	eb 17                	jmp    803392 <mmap+0x108>
+  80337b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803380:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  803386:	eb c7                	jmp    80334f <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803388:	48 83 c0 01          	add    $0x1,%rax
+  80338c:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803390:	77 37                	ja     8033c9 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803392:	48 89 c2             	mov    %rax,%rdx
+  803395:	48 c1 e2 05          	shl    $0x5,%rdx
+  803399:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  80339e:	48 85 d2             	test   %rdx,%rdx
+  8033a1:	74 e5                	je     803388 <mmap+0xfe>
+  8033a3:	48 89 c7             	mov    %rax,%rdi
+  8033a6:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033aa:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033ae:	48 01 fa             	add    %rdi,%rdx
+  8033b1:	48 39 d6             	cmp    %rdx,%rsi
+  8033b4:	73 d2                	jae    803388 <mmap+0xfe>
+  8033b6:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033ba:	4c 39 d7             	cmp    %r10,%rdi
+  8033bd:	73 c9                	jae    803388 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033bf:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c7:	eb c9                	jmp    803392 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8033c9:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8033cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8033d2:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8033d9:	00 00 00 
+  8033dc:	49 39 f9             	cmp    %rdi,%r9
+  8033df:	0f 82 14 01 00 00    	jb     8034f9 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8033e5:	48 85 f6             	test   %rsi,%rsi
+  8033e8:	0f 84 2f 01 00 00    	je     80351d <mmap+0x293>
+  8033ee:	45 84 c0             	test   %r8b,%r8b
+  8033f1:	0f 85 26 01 00 00    	jne    80351d <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8033f7:	41 83 fc 01          	cmp    $0x1,%r12d
+  8033fb:	0f 94 c0             	sete   %al
+  8033fe:	0f b6 c0             	movzbl %al,%eax
+  803401:	c1 e0 06             	shl    $0x6,%eax
+  803404:	09 d8                	or     %ebx,%eax
+  803406:	89 c3                	mov    %eax,%ebx
+  803408:	83 cb 04             	or     $0x4,%ebx
+  80340b:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  80340e:	4d 85 ff             	test   %r15,%r15
+  803411:	0f 84 bd 00 00 00    	je     8034d4 <mmap+0x24a>
+  803417:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80341c:	83 e0 bf             	and    $0xffffffbf,%eax
+  80341f:	83 c8 04             	or     $0x4,%eax
+  803422:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  803425:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803429:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  80342d:	49 89 f6             	mov    %rsi,%r14
+  803430:	eb 43                	jmp    803475 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803432:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803438:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80343e:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803441:	eb 2d                	jmp    803470 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  803443:	48 85 c0             	test   %rax,%rax
+  803446:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80344b:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  80344f:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803452:	4c 89 e2             	mov    %r12,%rdx
+  803455:	4c 89 ee             	mov    %r13,%rsi
+  803458:	bf 00 00 00 00       	mov    $0x0,%edi
+  80345d:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  803464:	00 00 00 
+  803467:	ff d0                	call   *%rax
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 3e                	js     8034ab <mmap+0x221>
+        i += n;
+  80346d:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803470:	4c 39 fb             	cmp    %r15,%rbx
+  803473:	73 54                	jae    8034c9 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  803475:	4d 89 fc             	mov    %r15,%r12
+  803478:	49 29 dc             	sub    %rbx,%r12
+  80347b:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  80347f:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803482:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803485:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803489:	4c 89 e1             	mov    %r12,%rcx
+  80348c:	4c 89 ea             	mov    %r13,%rdx
+  80348f:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803492:	48 b8 ee 30 80 00 00 	movabs $0x8030ee,%rax
+  803499:	00 00 00 
+  80349c:	ff d0                	call   *%rax
+        if (res > 0) {
+  80349e:	48 85 c0             	test   %rax,%rax
+  8034a1:	7f 8f                	jg     803432 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034a3:	74 9e                	je     803443 <mmap+0x1b9>
+  8034a5:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034a9:	74 98                	je     803443 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034ab:	4c 89 f6             	mov    %r14,%rsi
+  8034ae:	4c 89 fa             	mov    %r15,%rdx
+  8034b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b6:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+    return NULL;
+  8034c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c7:	eb 30                	jmp    8034f9 <mmap+0x26f>
+  8034c9:	4c 89 f6             	mov    %r14,%rsi
+  8034cc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8034d0:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  8034d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034d8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034db:	48 89 31             	mov    %rsi,(%rcx)
+  8034de:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  8034e2:	89 41 10             	mov    %eax,0x10(%rcx)
+  8034e5:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ec:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8034ef:	48 89 f0             	mov    %rsi,%rax
+  8034f2:	eb 05                	jmp    8034f9 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8034f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f9:	48 83 c4 38          	add    $0x38,%rsp
+  8034fd:	5b                   	pop    %rbx
+  8034fe:	41 5c                	pop    %r12
+  803500:	41 5d                	pop    %r13
+  803502:	41 5e                	pop    %r14
+  803504:	41 5f                	pop    %r15
+  803506:	5d                   	pop    %rbp
+  803507:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350d:	eb ea                	jmp    8034f9 <mmap+0x26f>
+  80350f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803514:	eb e3                	jmp    8034f9 <mmap+0x26f>
+  803516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351b:	eb dc                	jmp    8034f9 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80351d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803522:	eb d5                	jmp    8034f9 <mmap+0x26f>
+
+0000000000803524 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803524:	55                   	push   %rbp
+  803525:	48 89 e5             	mov    %rsp,%rbp
+  803528:	41 57                	push   %r15
+  80352a:	41 56                	push   %r14
+  80352c:	41 55                	push   %r13
+  80352e:	41 54                	push   %r12
+  803530:	53                   	push   %rbx
+  803531:	48 83 ec 38          	sub    $0x38,%rsp
+  803535:	49 89 fc             	mov    %rdi,%r12
+  803538:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80353b:	48 b8 ea 29 80 00 00 	movabs $0x8029ea,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803547:	48 85 c0             	test   %rax,%rax
+  80354a:	0f 84 2f 01 00 00    	je     80367f <msync+0x15b>
+  803550:	49 89 c7             	mov    %rax,%r15
+  803553:	4d 01 e5             	add    %r12,%r13
+  803556:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80355a:	49 03 07             	add    (%r15),%rax
+  80355d:	4c 39 e8             	cmp    %r13,%rax
+  803560:	0f 82 20 01 00 00    	jb     803686 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803566:	41 8b 47 18          	mov    0x18(%r15),%eax
+  80356a:	83 e0 40             	and    $0x40,%eax
+  80356d:	0f 84 fd 00 00 00    	je     803670 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803573:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80357a:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803581:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803588:	4d 39 ec             	cmp    %r13,%r12
+  80358b:	0f 83 fc 00 00 00    	jae    80368d <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803591:	49 be bc 3f 80 00 00 	movabs $0x803fbc,%r14
+  803598:	00 00 00 
+  80359b:	e9 b0 00 00 00       	jmp    803650 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035a0:	4c 89 e3             	mov    %r12,%rbx
+  8035a3:	4d 39 ec             	cmp    %r13,%r12
+  8035a6:	73 16                	jae    8035be <msync+0x9a>
+  8035a8:	48 89 df             	mov    %rbx,%rdi
+  8035ab:	41 ff d6             	call   *%r14
+  8035ae:	84 c0                	test   %al,%al
+  8035b0:	74 0c                	je     8035be <msync+0x9a>
+  8035b2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035b9:	4c 39 eb             	cmp    %r13,%rbx
+  8035bc:	72 ea                	jb     8035a8 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035be:	48 89 d8             	mov    %rbx,%rax
+  8035c1:	4c 29 e0             	sub    %r12,%rax
+  8035c4:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035c8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8035cc:	49 89 c0             	mov    %rax,%r8
+  8035cf:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8035d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d8:	48 89 ce             	mov    %rcx,%rsi
+  8035db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e0:	49 ba e8 14 80 00 00 	movabs $0x8014e8,%r10
+  8035e7:	00 00 00 
+  8035ea:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035ed:	85 c0                	test   %eax,%eax
+  8035ef:	78 7f                	js     803670 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8035f1:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8035f8:	00 
+  8035f9:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803600:	00 
+  803601:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803608:	00 
+  803609:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803610:	00 
+  803611:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803615:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803619:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80361d:	49 2b 07             	sub    (%r15),%rax
+  803620:	4c 01 e0             	add    %r12,%rax
+  803623:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803627:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80362b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80362f:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803633:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803638:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  803644:	85 c0                	test   %eax,%eax
+  803646:	78 28                	js     803670 <msync+0x14c>
+  803648:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  80364b:	4d 39 ec             	cmp    %r13,%r12
+  80364e:	73 1b                	jae    80366b <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803650:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803654:	4c 89 e7             	mov    %r12,%rdi
+  803657:	41 ff d6             	call   *%r14
+  80365a:	84 c0                	test   %al,%al
+  80365c:	0f 85 3e ff ff ff    	jne    8035a0 <msync+0x7c>
+            va += PAGE_SIZE;
+  803662:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803669:	eb e0                	jmp    80364b <msync+0x127>
+    }
+
+    return 0;
+  80366b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803670:	48 83 c4 38          	add    $0x38,%rsp
+  803674:	5b                   	pop    %rbx
+  803675:	41 5c                	pop    %r12
+  803677:	41 5d                	pop    %r13
+  803679:	41 5e                	pop    %r14
+  80367b:	41 5f                	pop    %r15
+  80367d:	5d                   	pop    %rbp
+  80367e:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80367f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803684:	eb ea                	jmp    803670 <msync+0x14c>
+  803686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80368b:	eb e3                	jmp    803670 <msync+0x14c>
+    return 0;
+  80368d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803692:	eb dc                	jmp    803670 <msync+0x14c>
+
+0000000000803694 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803694:	55                   	push   %rbp
+  803695:	48 89 e5             	mov    %rsp,%rbp
+  803698:	41 55                	push   %r13
+  80369a:	41 54                	push   %r12
+  80369c:	53                   	push   %rbx
+  80369d:	48 83 ec 08          	sub    $0x8,%rsp
+  8036a1:	49 89 fc             	mov    %rdi,%r12
+  8036a4:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036a7:	48 b8 ea 29 80 00 00 	movabs $0x8029ea,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036b3:	48 85 c0             	test   %rax,%rax
+  8036b6:	74 58                	je     803710 <munmap+0x7c>
+  8036b8:	48 89 c3             	mov    %rax,%rbx
+  8036bb:	4c 3b 20             	cmp    (%rax),%r12
+  8036be:	75 57                	jne    803717 <munmap+0x83>
+  8036c0:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036c7:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036cd:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8036d1:	75 4b                	jne    80371e <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8036d3:	4c 89 ee             	mov    %r13,%rsi
+  8036d6:	4c 89 e7             	mov    %r12,%rdi
+  8036d9:	48 b8 24 35 80 00 00 	movabs $0x803524,%rax
+  8036e0:	00 00 00 
+  8036e3:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8036e5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036e9:	4c 89 e6             	mov    %r12,%rsi
+  8036ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f1:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  8036f8:	00 00 00 
+  8036fb:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8036fd:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803704:	00 
+    return res;
+}
+  803705:	48 83 c4 08          	add    $0x8,%rsp
+  803709:	5b                   	pop    %rbx
+  80370a:	41 5c                	pop    %r12
+  80370c:	41 5d                	pop    %r13
+  80370e:	5d                   	pop    %rbp
+  80370f:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803710:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803715:	eb ee                	jmp    803705 <munmap+0x71>
+  803717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371c:	eb e7                	jmp    803705 <munmap+0x71>
+  80371e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803723:	eb e0                	jmp    803705 <munmap+0x71>
+
+0000000000803725 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803725:	55                   	push   %rbp
+  803726:	48 89 e5             	mov    %rsp,%rbp
+  803729:	41 54                	push   %r12
+  80372b:	53                   	push   %rbx
+  80372c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80372f:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+  80373b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80373e:	48 be 00 58 80 00 00 	movabs $0x805800,%rsi
+  803745:	00 00 00 
+  803748:	48 89 df             	mov    %rbx,%rdi
+  80374b:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803757:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80375c:	41 8b 14 24          	mov    (%r12),%edx
+  803760:	29 d0                	sub    %edx,%eax
+  803762:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803768:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80376f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803772:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803779:	00 00 00 
+  80377c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803783:	b8 00 00 00 00       	mov    $0x0,%eax
+  803788:	5b                   	pop    %rbx
+  803789:	41 5c                	pop    %r12
+  80378b:	5d                   	pop    %rbp
+  80378c:	c3                   	ret
+
+000000000080378d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80378d:	55                   	push   %rbp
+  80378e:	48 89 e5             	mov    %rsp,%rbp
+  803791:	41 55                	push   %r13
+  803793:	41 54                	push   %r12
+  803795:	53                   	push   %rbx
+  803796:	48 83 ec 08          	sub    $0x8,%rsp
+  80379a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80379d:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8037a4:	00 00 00 
+  8037a7:	ff d0                	call   *%rax
+  8037a9:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b1:	4c 89 e6             	mov    %r12,%rsi
+  8037b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b9:	49 bc b5 15 80 00 00 	movabs $0x8015b5,%r12
+  8037c0:	00 00 00 
+  8037c3:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037c6:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8037cc:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d8:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8037db:	be 00 04 00 00       	mov    $0x400,%esi
+  8037e0:	48 89 df             	mov    %rbx,%rdi
+  8037e3:	49 bd 2f 1b 80 00 00 	movabs $0x801b2f,%r13
+  8037ea:	00 00 00 
+  8037ed:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8037f0:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8037f4:	be 00 04 00 00       	mov    $0x400,%esi
+  8037f9:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8037fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803801:	48 89 de             	mov    %rbx,%rsi
+  803804:	bf 00 00 00 00       	mov    $0x0,%edi
+  803809:	41 ff d4             	call   *%r12
+}
+  80380c:	48 83 c4 08          	add    $0x8,%rsp
+  803810:	5b                   	pop    %rbx
+  803811:	41 5c                	pop    %r12
+  803813:	41 5d                	pop    %r13
+  803815:	5d                   	pop    %rbp
+  803816:	c3                   	ret
+
+0000000000803817 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803817:	55                   	push   %rbp
+  803818:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80381b:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803821:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803828:	be 00 10 00 00       	mov    $0x1000,%esi
+  80382d:	48 b8 55 14 80 00 00 	movabs $0x801455,%rax
+  803834:	00 00 00 
+  803837:	ff d0                	call   *%rax
+  803839:	85 c0                	test   %eax,%eax
+  80383b:	0f 94 c0             	sete   %al
+  80383e:	0f b6 c0             	movzbl %al,%eax
+}
+  803841:	5d                   	pop    %rbp
+  803842:	c3                   	ret
+
+0000000000803843 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803843:	b8 01 00 00 00       	mov    $0x1,%eax
+  803848:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80384a:	8b 07                	mov    (%rdi),%eax
+  80384c:	39 f0                	cmp    %esi,%eax
+  80384e:	74 01                	je     803851 <pipe_wait+0xe>
+  803850:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803851:	55                   	push   %rbp
+  803852:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803855:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803857:	48 c1 e2 20          	shl    $0x20,%rdx
+  80385b:	89 c0                	mov    %eax,%eax
+  80385d:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803860:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803867:	48 b8 05 1b 80 00 00 	movabs $0x801b05,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+}
+  803873:	5d                   	pop    %rbp
+  803874:	c3                   	ret
+
+0000000000803875 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387a:	87 06                	xchg   %eax,(%rsi)
+  80387c:	85 c0                	test   %eax,%eax
+  80387e:	75 01                	jne    803881 <pipe_wake+0xc>
+  803880:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803881:	55                   	push   %rbp
+  803882:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803885:	be 00 04 00 00       	mov    $0x400,%esi
+  80388a:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  803891:	00 00 00 
+  803894:	ff d0                	call   *%rax
+}
+  803896:	5d                   	pop    %rbp
+  803897:	c3                   	ret
+
+0000000000803898 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803898:	55                   	push   %rbp
+  803899:	48 89 e5             	mov    %rsp,%rbp
+  80389c:	41 57                	push   %r15
+  80389e:	41 56                	push   %r14
+  8038a0:	41 55                	push   %r13
+  8038a2:	41 54                	push   %r12
+  8038a4:	53                   	push   %rbx
+  8038a5:	48 83 ec 28          	sub    $0x28,%rsp
+  8038a9:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038ad:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038b1:	48 89 d3             	mov    %rdx,%rbx
+  8038b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038b8:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038c4:	48 85 db             	test   %rbx,%rbx
+  8038c7:	0f 84 0f 01 00 00    	je     8039dc <devpipe_write+0x144>
+  8038cd:	49 89 c4             	mov    %rax,%r12
+  8038d0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8038d6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8038dd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038e1:	eb 4f                	jmp    803932 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038e3:	4c 89 e6             	mov    %r12,%rsi
+  8038e6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8038ea:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  8038f1:	00 00 00 
+  8038f4:	ff d0                	call   *%rax
+  8038f6:	85 c0                	test   %eax,%eax
+  8038f8:	74 14                	je     80390e <devpipe_write+0x76>
+  8038fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ff:	48 83 c4 28          	add    $0x28,%rsp
+  803903:	5b                   	pop    %rbx
+  803904:	41 5c                	pop    %r12
+  803906:	41 5d                	pop    %r13
+  803908:	41 5e                	pop    %r14
+  80390a:	41 5f                	pop    %r15
+  80390c:	5d                   	pop    %rbp
+  80390d:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80390e:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803913:	44 89 ee             	mov    %r13d,%esi
+  803916:	4c 89 e7             	mov    %r12,%rdi
+  803919:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803925:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803929:	49 39 c7             	cmp    %rax,%r15
+  80392c:	0f 83 aa 00 00 00    	jae    8039dc <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803932:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803937:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80393b:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803942:	00 
+  803943:	44 89 f0             	mov    %r14d,%eax
+  803946:	44 29 e8             	sub    %r13d,%eax
+  803949:	39 d8                	cmp    %ebx,%eax
+  80394b:	74 96                	je     8038e3 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80394d:	89 d8                	mov    %ebx,%eax
+  80394f:	44 29 f0             	sub    %r14d,%eax
+  803952:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803956:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80395a:	4c 29 f8             	sub    %r15,%rax
+  80395d:	49 39 c5             	cmp    %rax,%r13
+  803960:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803964:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803967:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80396a:	89 db                	mov    %ebx,%ebx
+  80396c:	48 29 c3             	sub    %rax,%rbx
+  80396f:	4c 39 eb             	cmp    %r13,%rbx
+  803972:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803976:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80397a:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80397e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803985:	00 
+  803986:	48 89 da             	mov    %rbx,%rdx
+  803989:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803995:	4c 89 ea             	mov    %r13,%rdx
+  803998:	48 29 da             	sub    %rbx,%rdx
+  80399b:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80399f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039a3:	48 01 ce             	add    %rcx,%rsi
+  8039a6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039aa:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  8039b1:	00 00 00 
+  8039b4:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039b6:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039bb:	45 01 ee             	add    %r13d,%r14d
+  8039be:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039c3:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039c8:	48 b8 75 38 80 00 00 	movabs $0x803875,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+        i += chunk;
+  8039d4:	4d 01 ef             	add    %r13,%r15
+  8039d7:	e9 49 ff ff ff       	jmp    803925 <devpipe_write+0x8d>
+    return n;
+  8039dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039e0:	e9 1a ff ff ff       	jmp    8038ff <devpipe_write+0x67>
+
+00000000008039e5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039e5:	55                   	push   %rbp
+  8039e6:	48 89 e5             	mov    %rsp,%rbp
+  8039e9:	41 57                	push   %r15
+  8039eb:	41 56                	push   %r14
+  8039ed:	41 55                	push   %r13
+  8039ef:	41 54                	push   %r12
+  8039f1:	53                   	push   %rbx
+  8039f2:	48 83 ec 28          	sub    $0x28,%rsp
+  8039f6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039fa:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8039fe:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a02:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803a09:	00 00 00 
+  803a0c:	ff d0                	call   *%rax
+  803a0e:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a11:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a15:	49 bf 17 38 80 00 00 	movabs $0x803817,%r15
+  803a1c:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a1f:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a27:	eb 15                	jmp    803a3e <devpipe_read+0x59>
+  803a29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a2d:	89 de                	mov    %ebx,%esi
+  803a2f:	4c 89 f7             	mov    %r14,%rdi
+  803a32:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a3e:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a42:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a45:	41 39 dd             	cmp    %ebx,%r13d
+  803a48:	75 15                	jne    803a5f <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a4a:	4c 89 e6             	mov    %r12,%rsi
+  803a4d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a51:	41 ff d7             	call   *%r15
+  803a54:	85 c0                	test   %eax,%eax
+  803a56:	74 d1                	je     803a29 <devpipe_read+0x44>
+  803a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5d:	eb 7c                	jmp    803adb <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a5f:	44 29 eb             	sub    %r13d,%ebx
+  803a62:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a66:	48 39 c3             	cmp    %rax,%rbx
+  803a69:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803a6d:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803a74:	00 
+  803a75:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803a79:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803a7c:	45 89 f6             	mov    %r14d,%r14d
+  803a7f:	49 29 c6             	sub    %rax,%r14
+  803a82:	49 39 de             	cmp    %rbx,%r14
+  803a85:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803a89:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803a90:	00 
+  803a91:	4c 89 f2             	mov    %r14,%rdx
+  803a94:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a98:	49 bf 32 11 80 00 00 	movabs $0x801132,%r15
+  803a9f:	00 00 00 
+  803aa2:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aa5:	48 89 da             	mov    %rbx,%rdx
+  803aa8:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803aab:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ab2:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ab3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ab7:	4c 01 f7             	add    %r14,%rdi
+  803aba:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803abd:	41 01 dd             	add    %ebx,%r13d
+  803ac0:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803ac4:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803ac9:	4c 89 e7             	mov    %r12,%rdi
+  803acc:	48 b8 75 38 80 00 00 	movabs $0x803875,%rax
+  803ad3:	00 00 00 
+  803ad6:	ff d0                	call   *%rax
+    return n;
+  803ad8:	48 89 d8             	mov    %rbx,%rax
+}
+  803adb:	48 83 c4 28          	add    $0x28,%rsp
+  803adf:	5b                   	pop    %rbx
+  803ae0:	41 5c                	pop    %r12
+  803ae2:	41 5d                	pop    %r13
+  803ae4:	41 5e                	pop    %r14
+  803ae6:	41 5f                	pop    %r15
+  803ae8:	5d                   	pop    %rbp
+  803ae9:	c3                   	ret
+
+0000000000803aea <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803aea:	55                   	push   %rbp
+  803aeb:	48 89 e5             	mov    %rsp,%rbp
+  803aee:	41 57                	push   %r15
+  803af0:	41 56                	push   %r14
+  803af2:	41 55                	push   %r13
+  803af4:	41 54                	push   %r12
+  803af6:	53                   	push   %rbx
+  803af7:	48 83 ec 18          	sub    $0x18,%rsp
+  803afb:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803afe:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b05:	0f 86 96 01 00 00    	jbe    803ca1 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b0b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b10:	48 01 db             	add    %rbx,%rbx
+  803b13:	48 39 f3             	cmp    %rsi,%rbx
+  803b16:	72 f8                	jb     803b10 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b18:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b1f:	0f 87 18 02 00 00    	ja     803d3d <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b25:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b29:	48 b8 d8 22 80 00 00 	movabs $0x8022d8,%rax
+  803b30:	00 00 00 
+  803b33:	ff d0                	call   *%rax
+  803b35:	41 89 c4             	mov    %eax,%r12d
+  803b38:	85 c0                	test   %eax,%eax
+  803b3a:	0f 88 b6 01 00 00    	js     803cf6 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b40:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b4a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b53:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  803b5a:	00 00 00 
+  803b5d:	ff d0                	call   *%rax
+  803b5f:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b62:	85 c0                	test   %eax,%eax
+  803b64:	0f 88 8c 01 00 00    	js     803cf6 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b6a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803b6e:	48 b8 d8 22 80 00 00 	movabs $0x8022d8,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+  803b7a:	41 89 c4             	mov    %eax,%r12d
+  803b7d:	85 c0                	test   %eax,%eax
+  803b7f:	0f 88 57 01 00 00    	js     803cdc <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b85:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b8f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b93:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b98:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  803b9f:	00 00 00 
+  803ba2:	ff d0                	call   *%rax
+  803ba4:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ba7:	85 c0                	test   %eax,%eax
+  803ba9:	0f 88 2d 01 00 00    	js     803cdc <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803baf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bb3:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803bba:	00 00 00 
+  803bbd:	ff d0                	call   *%rax
+  803bbf:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bc2:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803bc9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bce:	4c 89 fa             	mov    %r15,%rdx
+  803bd1:	48 89 c6             	mov    %rax,%rsi
+  803bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd9:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  803be0:	00 00 00 
+  803be3:	ff d0                	call   *%rax
+  803be5:	41 89 c4             	mov    %eax,%r12d
+  803be8:	85 c0                	test   %eax,%eax
+  803bea:	0f 88 d2 00 00 00    	js     803cc2 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803bf0:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803bf7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803bfb:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803c02:	00 00 00 
+  803c05:	ff d0                	call   *%rax
+  803c07:	48 89 c1             	mov    %rax,%rcx
+  803c0a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c10:	4d 89 f8             	mov    %r15,%r8
+  803c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c18:	4c 89 f6             	mov    %r14,%rsi
+  803c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c20:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+  803c2c:	41 89 c4             	mov    %eax,%r12d
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	78 78                	js     803cab <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c33:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c38:	4c 89 f7             	mov    %r14,%rdi
+  803c3b:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  803c42:	00 00 00 
+  803c45:	ff d0                	call   *%rax
+  803c47:	83 f8 02             	cmp    $0x2,%eax
+  803c4a:	0f 85 b8 00 00 00    	jne    803d08 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c50:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c57:	00 00 
+  803c59:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c5d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c5f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c63:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c6e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c74:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c7b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c7f:	48 bb a8 22 80 00 00 	movabs $0x8022a8,%rbx
+  803c86:	00 00 00 
+  803c89:	ff d3                	call   *%rbx
+  803c8b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803c8f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c93:	ff d3                	call   *%rbx
+  803c95:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803c99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803c9f:	eb 55                	jmp    803cf6 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803ca1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803ca6:	e9 7a fe ff ff       	jmp    803b25 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803cab:	4c 89 fa             	mov    %r15,%rdx
+  803cae:	4c 89 f6             	mov    %r14,%rsi
+  803cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb6:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  803cbd:	00 00 00 
+  803cc0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd0:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  803cd7:	00 00 00 
+  803cda:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ce1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cea:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  803cf1:	00 00 00 
+  803cf4:	ff d0                	call   *%rax
+}
+  803cf6:	44 89 e0             	mov    %r12d,%eax
+  803cf9:	48 83 c4 18          	add    $0x18,%rsp
+  803cfd:	5b                   	pop    %rbx
+  803cfe:	41 5c                	pop    %r12
+  803d00:	41 5d                	pop    %r13
+  803d02:	41 5e                	pop    %r14
+  803d04:	41 5f                	pop    %r15
+  803d06:	5d                   	pop    %rbp
+  803d07:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d08:	48 b9 30 58 80 00 00 	movabs $0x805830,%rcx
+  803d0f:	00 00 00 
+  803d12:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  803d19:	00 00 00 
+  803d1c:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d21:	48 bf 1c 58 80 00 00 	movabs $0x80581c,%rdi
+  803d28:	00 00 00 
+  803d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d30:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  803d37:	00 00 00 
+  803d3a:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d3d:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d43:	eb b1                	jmp    803cf6 <pipe_sized+0x20c>
+
+0000000000803d45 <pipe>:
+pipe(int pfd[2]) {
+  803d45:	55                   	push   %rbp
+  803d46:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d49:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d4e:	48 b8 ea 3a 80 00 00 	movabs $0x803aea,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+}
+  803d5a:	5d                   	pop    %rbp
+  803d5b:	c3                   	ret
+
+0000000000803d5c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d5c:	55                   	push   %rbp
+  803d5d:	48 89 e5             	mov    %rsp,%rbp
+  803d60:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d64:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d68:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  803d6f:	00 00 00 
+  803d72:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	78 23                	js     803d9b <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d78:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d7c:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803d83:	00 00 00 
+  803d86:	ff d0                	call   *%rax
+  803d88:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d8b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d8f:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+}
+  803d9b:	c9                   	leave
+  803d9c:	c3                   	ret
+
+0000000000803d9d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d9d:	48 89 f8             	mov    %rdi,%rax
+  803da0:	48 c1 e8 27          	shr    $0x27,%rax
+  803da4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803dab:	7f 00 00 
+  803dae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db2:	f6 c2 01             	test   $0x1,%dl
+  803db5:	74 6d                	je     803e24 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803db7:	48 89 f8             	mov    %rdi,%rax
+  803dba:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dbe:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dc5:	7f 00 00 
+  803dc8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dcc:	f6 c2 01             	test   $0x1,%dl
+  803dcf:	74 62                	je     803e33 <get_uvpt_entry+0x96>
+  803dd1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dd8:	7f 00 00 
+  803ddb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ddf:	f6 c2 80             	test   $0x80,%dl
+  803de2:	75 4f                	jne    803e33 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803de4:	48 89 f8             	mov    %rdi,%rax
+  803de7:	48 c1 e8 15          	shr    $0x15,%rax
+  803deb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803df2:	7f 00 00 
+  803df5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df9:	f6 c2 01             	test   $0x1,%dl
+  803dfc:	74 44                	je     803e42 <get_uvpt_entry+0xa5>
+  803dfe:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e05:	7f 00 00 
+  803e08:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e0c:	f6 c2 80             	test   $0x80,%dl
+  803e0f:	75 31                	jne    803e42 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e11:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e15:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e1c:	7f 00 00 
+  803e1f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e23:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e24:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e2b:	7f 00 00 
+  803e2e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e32:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e33:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e3a:	7f 00 00 
+  803e3d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e41:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e42:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e49:	7f 00 00 
+  803e4c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e50:	c3                   	ret
+
+0000000000803e51 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e51:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e54:	48 89 f9             	mov    %rdi,%rcx
+  803e57:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e5b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e62:	7f 00 00 
+  803e65:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e69:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e70:	f6 c1 01             	test   $0x1,%cl
+  803e73:	0f 84 b2 00 00 00    	je     803f2b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e79:	48 89 f9             	mov    %rdi,%rcx
+  803e7c:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e80:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e87:	7f 00 00 
+  803e8a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e8e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e95:	40 f6 c6 01          	test   $0x1,%sil
+  803e99:	0f 84 8c 00 00 00    	je     803f2b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e9f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ea6:	7f 00 00 
+  803ea9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ead:	a8 80                	test   $0x80,%al
+  803eaf:	75 7b                	jne    803f2c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803eb1:	48 89 f9             	mov    %rdi,%rcx
+  803eb4:	48 c1 e9 15          	shr    $0x15,%rcx
+  803eb8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ebf:	7f 00 00 
+  803ec2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ec6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ecd:	40 f6 c6 01          	test   $0x1,%sil
+  803ed1:	74 58                	je     803f2b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ed3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803eda:	7f 00 00 
+  803edd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ee1:	a8 80                	test   $0x80,%al
+  803ee3:	75 6c                	jne    803f51 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ee5:	48 89 f9             	mov    %rdi,%rcx
+  803ee8:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803eec:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ef3:	7f 00 00 
+  803ef6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803efa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f01:	40 f6 c6 01          	test   $0x1,%sil
+  803f05:	74 24                	je     803f2b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f07:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f0e:	7f 00 00 
+  803f11:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f15:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f1c:	ff ff 7f 
+  803f1f:	48 21 c8             	and    %rcx,%rax
+  803f22:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f28:	48 09 d0             	or     %rdx,%rax
+}
+  803f2b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f2c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f33:	7f 00 00 
+  803f36:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f3a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f41:	ff ff 7f 
+  803f44:	48 21 c8             	and    %rcx,%rax
+  803f47:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f4d:	48 01 d0             	add    %rdx,%rax
+  803f50:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f51:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f58:	7f 00 00 
+  803f5b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f5f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f66:	ff ff 7f 
+  803f69:	48 21 c8             	and    %rcx,%rax
+  803f6c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f72:	48 01 d0             	add    %rdx,%rax
+  803f75:	c3                   	ret
+
+0000000000803f76 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f76:	55                   	push   %rbp
+  803f77:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f7a:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  803f81:	00 00 00 
+  803f84:	ff d0                	call   *%rax
+  803f86:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f89:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f8e:	89 c1                	mov    %eax,%ecx
+  803f90:	83 c9 04             	or     $0x4,%ecx
+  803f93:	f6 c2 01             	test   $0x1,%dl
+  803f96:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f99:	89 c1                	mov    %eax,%ecx
+  803f9b:	83 c9 02             	or     $0x2,%ecx
+  803f9e:	f6 c2 02             	test   $0x2,%dl
+  803fa1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fa4:	89 c1                	mov    %eax,%ecx
+  803fa6:	83 c9 01             	or     $0x1,%ecx
+  803fa9:	48 85 d2             	test   %rdx,%rdx
+  803fac:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803faf:	89 c1                	mov    %eax,%ecx
+  803fb1:	83 c9 40             	or     $0x40,%ecx
+  803fb4:	f6 c6 04             	test   $0x4,%dh
+  803fb7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fba:	5d                   	pop    %rbp
+  803fbb:	c3                   	ret
+
+0000000000803fbc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fbc:	55                   	push   %rbp
+  803fbd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc0:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  803fc7:	00 00 00 
+  803fca:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fcc:	48 c1 e8 06          	shr    $0x6,%rax
+  803fd0:	83 e0 01             	and    $0x1,%eax
+}
+  803fd3:	5d                   	pop    %rbp
+  803fd4:	c3                   	ret
+
+0000000000803fd5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fd5:	55                   	push   %rbp
+  803fd6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fd9:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  803fe0:	00 00 00 
+  803fe3:	ff d0                	call   *%rax
+  803fe5:	83 e0 01             	and    $0x1,%eax
+}
+  803fe8:	5d                   	pop    %rbp
+  803fe9:	c3                   	ret
+
+0000000000803fea <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803fea:	55                   	push   %rbp
+  803feb:	48 89 e5             	mov    %rsp,%rbp
+  803fee:	41 57                	push   %r15
+  803ff0:	41 56                	push   %r14
+  803ff2:	41 55                	push   %r13
+  803ff4:	41 54                	push   %r12
+  803ff6:	53                   	push   %rbx
+  803ff7:	48 83 ec 18          	sub    $0x18,%rsp
+  803ffb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803fff:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  804003:	48 39 f7             	cmp    %rsi,%rdi
+  804006:	0f 83 e4 00 00 00    	jae    8040f0 <foreach_present_page+0x106>
+  80400c:	49 89 f4             	mov    %rsi,%r12
+  80400f:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804012:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804019:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80401c:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804023:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804026:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  80402d:	7f 00 00 
+  804030:	eb 27                	jmp    804059 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804032:	48 89 d8             	mov    %rbx,%rax
+  804035:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804039:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  80403d:	f6 c2 01             	test   $0x1,%dl
+  804040:	75 43                	jne    804085 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804042:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804049:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804050:	4c 39 e3             	cmp    %r12,%rbx
+  804053:	0f 83 83 00 00 00    	jae    8040dc <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804059:	48 89 d8             	mov    %rbx,%rax
+  80405c:	48 c1 e8 27          	shr    $0x27,%rax
+  804060:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804065:	a8 01                	test   $0x1,%al
+  804067:	75 c9                	jne    804032 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804069:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804070:	ff ff ff 
+  804073:	48 21 d8             	and    %rbx,%rax
+  804076:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80407d:	00 00 00 
+  804080:	48 01 c3             	add    %rax,%rbx
+  804083:	eb cb                	jmp    804050 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804085:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804089:	a8 80                	test   $0x80,%al
+  80408b:	75 1f                	jne    8040ac <foreach_present_page+0xc2>
+  80408d:	48 89 d8             	mov    %rbx,%rax
+  804090:	48 c1 e8 15          	shr    $0x15,%rax
+  804094:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804098:	a8 01                	test   $0x1,%al
+  80409a:	75 10                	jne    8040ac <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  80409c:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8040a3:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8040aa:	eb a4                	jmp    804050 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8040ac:	48 89 df             	mov    %rbx,%rdi
+  8040af:	48 b8 9d 3d 80 00 00 	movabs $0x803d9d,%rax
+  8040b6:	00 00 00 
+  8040b9:	ff d0                	call   *%rax
+  8040bb:	a8 01                	test   $0x1,%al
+  8040bd:	74 11                	je     8040d0 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8040bf:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040c3:	48 89 df             	mov    %rbx,%rdi
+  8040c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040ca:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8040cc:	85 c0                	test   %eax,%eax
+  8040ce:	78 11                	js     8040e1 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8040d0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040d7:	e9 74 ff ff ff       	jmp    804050 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8040dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040e1:	48 83 c4 18          	add    $0x18,%rsp
+  8040e5:	5b                   	pop    %rbx
+  8040e6:	41 5c                	pop    %r12
+  8040e8:	41 5d                	pop    %r13
+  8040ea:	41 5e                	pop    %r14
+  8040ec:	41 5f                	pop    %r15
+  8040ee:	5d                   	pop    %rbp
+  8040ef:	c3                   	ret
+    return 0;
+  8040f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f5:	eb ea                	jmp    8040e1 <foreach_present_page+0xf7>
+
+00000000008040f7 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8040f7:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040fe:	7f 00 00 
+  804101:	a8 01                	test   $0x1,%al
+  804103:	75 06                	jne    80410b <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80410b:	55                   	push   %rbp
+  80410c:	48 89 e5             	mov    %rsp,%rbp
+  80410f:	41 57                	push   %r15
+  804111:	41 56                	push   %r14
+  804113:	41 55                	push   %r13
+  804115:	41 54                	push   %r12
+  804117:	53                   	push   %rbx
+  804118:	48 83 ec 28          	sub    $0x28,%rsp
+  80411c:	49 89 fe             	mov    %rdi,%r14
+  80411f:	49 89 f7             	mov    %rsi,%r15
+  804122:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804129:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80412a:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804131:	7f 00 00 
+  804134:	e9 b0 00 00 00       	jmp    8041e9 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804139:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804140:	49 83 ec 01          	sub    $0x1,%r12
+  804144:	74 2d                	je     804173 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804146:	48 89 d8             	mov    %rbx,%rax
+  804149:	48 c1 e8 0c          	shr    $0xc,%rax
+  80414d:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804152:	f6 c2 01             	test   $0x1,%dl
+  804155:	74 e2                	je     804139 <foreach_shared_region+0x42>
+  804157:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80415c:	f6 c4 04             	test   $0x4,%ah
+  80415f:	74 d8                	je     804139 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804161:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804168:	4c 89 fa             	mov    %r15,%rdx
+  80416b:	48 89 df             	mov    %rbx,%rdi
+  80416e:	41 ff d6             	call   *%r14
+  804171:	eb c6                	jmp    804139 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804173:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80417a:	00 
+  80417b:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804180:	74 4c                	je     8041ce <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804182:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804186:	48 89 c8             	mov    %rcx,%rax
+  804189:	48 c1 e8 15          	shr    $0x15,%rax
+  80418d:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804194:	7f 00 00 
+  804197:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80419b:	a8 01                	test   $0x1,%al
+  80419d:	74 d4                	je     804173 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80419f:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8041a6:	48 39 c1             	cmp    %rax,%rcx
+  8041a9:	73 c8                	jae    804173 <foreach_shared_region+0x7c>
+  8041ab:	48 89 cb             	mov    %rcx,%rbx
+  8041ae:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8041b5:	48 39 d0             	cmp    %rdx,%rax
+  8041b8:	4d 19 e4             	sbb    %r12,%r12
+  8041bb:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041c2:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041c9:	e9 78 ff ff ff       	jmp    804146 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8041ce:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041d5:	40 
+  8041d6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041da:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041e1:	00 00 00 
+  8041e4:	48 39 c1             	cmp    %rax,%rcx
+  8041e7:	74 4f                	je     804238 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8041e9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041ed:	48 89 c8             	mov    %rcx,%rax
+  8041f0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041f4:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  8041fb:	7f 00 00 
+  8041fe:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804202:	a8 01                	test   $0x1,%al
+  804204:	74 c8                	je     8041ce <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804206:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80420d:	48 39 c1             	cmp    %rax,%rcx
+  804210:	73 bc                	jae    8041ce <foreach_shared_region+0xd7>
+  804212:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804219:	48 39 d0             	cmp    %rdx,%rax
+  80421c:	48 19 c0             	sbb    %rax,%rax
+  80421f:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804225:	48 05 00 02 00 00    	add    $0x200,%rax
+  80422b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80422f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804233:	e9 4a ff ff ff       	jmp    804182 <foreach_shared_region+0x8b>
+}
+  804238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423d:	48 83 c4 28          	add    $0x28,%rsp
+  804241:	5b                   	pop    %rbx
+  804242:	41 5c                	pop    %r12
+  804244:	41 5d                	pop    %r13
+  804246:	41 5e                	pop    %r14
+  804248:	41 5f                	pop    %r15
+  80424a:	5d                   	pop    %rbp
+  80424b:	c3                   	ret
+
+000000000080424c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80424c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804251:	c3                   	ret
+
+0000000000804252 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804259:	48 be 54 58 80 00 00 	movabs $0x805854,%rsi
+  804260:	00 00 00 
+  804263:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+    return 0;
+}
+  80426f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804274:	5d                   	pop    %rbp
+  804275:	c3                   	ret
+
+0000000000804276 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804276:	55                   	push   %rbp
+  804277:	48 89 e5             	mov    %rsp,%rbp
+  80427a:	41 57                	push   %r15
+  80427c:	41 56                	push   %r14
+  80427e:	41 55                	push   %r13
+  804280:	41 54                	push   %r12
+  804282:	53                   	push   %rbx
+  804283:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80428a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804291:	48 85 d2             	test   %rdx,%rdx
+  804294:	74 7a                	je     804310 <devcons_write+0x9a>
+  804296:	49 89 d6             	mov    %rdx,%r14
+  804299:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80429f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042a4:	49 bf cb 10 80 00 00 	movabs $0x8010cb,%r15
+  8042ab:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042ae:	4c 89 f3             	mov    %r14,%rbx
+  8042b1:	48 29 f3             	sub    %rsi,%rbx
+  8042b4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042b9:	48 39 c3             	cmp    %rax,%rbx
+  8042bc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042c0:	4c 63 eb             	movslq %ebx,%r13
+  8042c3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042ca:	48 01 c6             	add    %rax,%rsi
+  8042cd:	4c 89 ea             	mov    %r13,%rdx
+  8042d0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042d7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042da:	4c 89 ee             	mov    %r13,%rsi
+  8042dd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e4:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042f0:	41 01 dc             	add    %ebx,%r12d
+  8042f3:	49 63 f4             	movslq %r12d,%rsi
+  8042f6:	4c 39 f6             	cmp    %r14,%rsi
+  8042f9:	72 b3                	jb     8042ae <devcons_write+0x38>
+    return res;
+  8042fb:	49 63 c4             	movslq %r12d,%rax
+}
+  8042fe:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804305:	5b                   	pop    %rbx
+  804306:	41 5c                	pop    %r12
+  804308:	41 5d                	pop    %r13
+  80430a:	41 5e                	pop    %r14
+  80430c:	41 5f                	pop    %r15
+  80430e:	5d                   	pop    %rbp
+  80430f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804310:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804316:	eb e3                	jmp    8042fb <devcons_write+0x85>
+
+0000000000804318 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804318:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80431b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804320:	48 85 c0             	test   %rax,%rax
+  804323:	74 60                	je     804385 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804325:	55                   	push   %rbp
+  804326:	48 89 e5             	mov    %rsp,%rbp
+  804329:	41 55                	push   %r13
+  80432b:	41 54                	push   %r12
+  80432d:	53                   	push   %rbx
+  80432e:	48 83 ec 18          	sub    $0x18,%rsp
+  804332:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  804335:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  80433c:	48 bb 25 13 80 00 00 	movabs $0x801325,%rbx
+  804343:	00 00 00 
+  804346:	49 bc 82 44 80 00 00 	movabs $0x804482,%r12
+  80434d:	00 00 00 
+  804350:	eb 07                	jmp    804359 <devcons_read+0x41>
+  804352:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804356:	41 ff d4             	call   *%r12
+  804359:	ff d3                	call   *%rbx
+  80435b:	85 c0                	test   %eax,%eax
+  80435d:	74 f3                	je     804352 <devcons_read+0x3a>
+    if (c < 0) return c;
+  80435f:	48 63 d0             	movslq %eax,%rdx
+  804362:	78 13                	js     804377 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  804364:	ba 00 00 00 00       	mov    $0x0,%edx
+  804369:	83 f8 04             	cmp    $0x4,%eax
+  80436c:	74 09                	je     804377 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  80436e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804372:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804377:	48 89 d0             	mov    %rdx,%rax
+  80437a:	48 83 c4 18          	add    $0x18,%rsp
+  80437e:	5b                   	pop    %rbx
+  80437f:	41 5c                	pop    %r12
+  804381:	41 5d                	pop    %r13
+  804383:	5d                   	pop    %rbp
+  804384:	c3                   	ret
+  804385:	48 89 d0             	mov    %rdx,%rax
+  804388:	c3                   	ret
+
+0000000000804389 <cputchar>:
+cputchar(int ch) {
+  804389:	55                   	push   %rbp
+  80438a:	48 89 e5             	mov    %rsp,%rbp
+  80438d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804391:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804395:	be 01 00 00 00       	mov    $0x1,%esi
+  80439a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80439e:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  8043a5:	00 00 00 
+  8043a8:	ff d0                	call   *%rax
+}
+  8043aa:	c9                   	leave
+  8043ab:	c3                   	ret
+
+00000000008043ac <getchar>:
+getchar(void) {
+  8043ac:	55                   	push   %rbp
+  8043ad:	48 89 e5             	mov    %rsp,%rbp
+  8043b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043b4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043b9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c2:	48 b8 57 26 80 00 00 	movabs $0x802657,%rax
+  8043c9:	00 00 00 
+  8043cc:	ff d0                	call   *%rax
+  8043ce:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043d0:	85 c0                	test   %eax,%eax
+  8043d2:	78 06                	js     8043da <getchar+0x2e>
+  8043d4:	74 08                	je     8043de <getchar+0x32>
+  8043d6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043da:	89 d0                	mov    %edx,%eax
+  8043dc:	c9                   	leave
+  8043dd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043de:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043e3:	eb f5                	jmp    8043da <getchar+0x2e>
+
+00000000008043e5 <iscons>:
+iscons(int fdnum) {
+  8043e5:	55                   	push   %rbp
+  8043e6:	48 89 e5             	mov    %rsp,%rbp
+  8043e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043f1:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8043f8:	00 00 00 
+  8043fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043fd:	85 c0                	test   %eax,%eax
+  8043ff:	78 18                	js     804419 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804401:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804405:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80440c:	00 00 00 
+  80440f:	8b 00                	mov    (%rax),%eax
+  804411:	39 02                	cmp    %eax,(%rdx)
+  804413:	0f 94 c0             	sete   %al
+  804416:	0f b6 c0             	movzbl %al,%eax
+}
+  804419:	c9                   	leave
+  80441a:	c3                   	ret
+
+000000000080441b <opencons>:
+opencons(void) {
+  80441b:	55                   	push   %rbp
+  80441c:	48 89 e5             	mov    %rsp,%rbp
+  80441f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804423:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804427:	48 b8 d8 22 80 00 00 	movabs $0x8022d8,%rax
+  80442e:	00 00 00 
+  804431:	ff d0                	call   *%rax
+  804433:	85 c0                	test   %eax,%eax
+  804435:	78 49                	js     804480 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804437:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80443c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804441:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804445:	bf 00 00 00 00       	mov    $0x0,%edi
+  80444a:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  804451:	00 00 00 
+  804454:	ff d0                	call   *%rax
+  804456:	85 c0                	test   %eax,%eax
+  804458:	78 26                	js     804480 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80445a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80445e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804465:	00 00 
+  804467:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804469:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80446d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804474:	48 b8 a8 22 80 00 00 	movabs $0x8022a8,%rax
+  80447b:	00 00 00 
+  80447e:	ff d0                	call   *%rax
+}
+  804480:	c9                   	leave
+  804481:	c3                   	ret
+
+0000000000804482 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  804482:	55                   	push   %rbp
+  804483:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804486:	8b 0f                	mov    (%rdi),%ecx
+  804488:	8d 41 01             	lea    0x1(%rcx),%eax
+  80448b:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80448d:	83 f9 07             	cmp    $0x7,%ecx
+  804490:	76 31                	jbe    8044c3 <backoff+0x41>
+    asm volatile("rdtsc"
+  804492:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804494:	83 c1 06             	add    $0x6,%ecx
+  804497:	be 15 00 00 00       	mov    $0x15,%esi
+  80449c:	39 f1                	cmp    %esi,%ecx
+  80449e:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8044a1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044a6:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8044a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8044ad:	89 c0                	mov    %eax,%eax
+  8044af:	48 09 c2             	or     %rax,%rdx
+  8044b2:	48 01 d7             	add    %rdx,%rdi
+  8044b5:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  8044bc:	00 00 00 
+  8044bf:	ff d0                	call   *%rax
+}
+  8044c1:	5d                   	pop    %rbp
+  8044c2:	c3                   	ret
+        sys_yield();
+  8044c3:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+        return;
+  8044cf:	eb f0                	jmp    8044c1 <backoff+0x3f>
+
+00000000008044d1 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8044d1:	55                   	push   %rbp
+  8044d2:	48 89 e5             	mov    %rsp,%rbp
+  8044d5:	41 55                	push   %r13
+  8044d7:	41 54                	push   %r12
+  8044d9:	53                   	push   %rbx
+  8044da:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8044de:	85 ff                	test   %edi,%edi
+  8044e0:	74 7e                	je     804560 <wait+0x8f>
+  8044e2:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8044e5:	89 f8                	mov    %edi,%eax
+  8044e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8044ec:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8044f3:	89 f9                	mov    %edi,%ecx
+  8044f5:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8044fb:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804502:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804509:	00 00 00 
+  80450c:	48 01 ca             	add    %rcx,%rdx
+  80450f:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804515:	39 d7                	cmp    %edx,%edi
+  804517:	75 3c                	jne    804555 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804519:	48 98                	cltq
+  80451b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804522:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804529:	00 00 00 
+  80452c:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80452f:	49 bd 82 44 80 00 00 	movabs $0x804482,%r13
+  804536:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804539:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80453f:	85 c0                	test   %eax,%eax
+  804541:	74 12                	je     804555 <wait+0x84>
+        backoff(&attempt);
+  804543:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804547:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80454a:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804550:	44 39 e0             	cmp    %r12d,%eax
+  804553:	74 e4                	je     804539 <wait+0x68>
+    }
+}
+  804555:	48 83 c4 18          	add    $0x18,%rsp
+  804559:	5b                   	pop    %rbx
+  80455a:	41 5c                	pop    %r12
+  80455c:	41 5d                	pop    %r13
+  80455e:	5d                   	pop    %rbp
+  80455f:	c3                   	ret
+    assert(envid != 0);
+  804560:	48 b9 60 58 80 00 00 	movabs $0x805860,%rcx
+  804567:	00 00 00 
+  80456a:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  804571:	00 00 00 
+  804574:	be 22 00 00 00       	mov    $0x22,%esi
+  804579:	48 bf 6b 58 80 00 00 	movabs $0x80586b,%rdi
+  804580:	00 00 00 
+  804583:	b8 00 00 00 00       	mov    $0x0,%eax
+  804588:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  80458f:	00 00 00 
+  804592:	41 ff d0             	call   *%r8
+
+0000000000804595 <__text_end>:
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
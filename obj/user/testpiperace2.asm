@@ -0,0 +1,8089 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b5 02 00 00       	call   8002d8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 38 05 80 00 00 	movabs $0x800538,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 c2 38 80 00 00 	movabs $0x8038c2,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 98 00 00 00    	js     800101 <umain+0xdc>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 24 1c 80 00 00 	movabs $0x801c24,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 ae 00 00 00    	js     80012e <umain+0x109>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 d1 00 00 00    	je     80015b <umain+0x136>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80008d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800092:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800099:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000a0:	00 00 00 
+  8000a3:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000a6:	49 bc d9 38 80 00 00 	movabs $0x8038d9,%r12
+  8000ad:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000b0:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8000b6:	83 f8 02             	cmp    $0x2,%eax
+  8000b9:	0f 85 43 01 00 00    	jne    800202 <umain+0x1dd>
+        if (pipeisclosed(p[0]) != 0) {
+  8000bf:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000c2:	41 ff d4             	call   *%r12
+  8000c5:	85 c0                	test   %eax,%eax
+  8000c7:	74 e7                	je     8000b0 <umain+0x8b>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000c9:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  8000d0:	00 00 00 
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	48 ba 38 05 80 00 00 	movabs $0x800538,%rdx
+  8000df:	00 00 00 
+  8000e2:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000e4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000e7:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+            exit();
+  8000f3:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+  8000ff:	eb af                	jmp    8000b0 <umain+0x8b>
+        panic("pipe: %i", r);
+  800101:	89 c1                	mov    %eax,%ecx
+  800103:	48 ba 52 50 80 00 00 	movabs $0x805052,%rdx
+  80010a:	00 00 00 
+  80010d:	be 0c 00 00 00       	mov    $0xc,%esi
+  800112:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800119:	00 00 00 
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800121:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  800128:	00 00 00 
+  80012b:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  800137:	00 00 00 
+  80013a:	be 0e 00 00 00       	mov    $0xe,%esi
+  80013f:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800146:	00 00 00 
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+        close(p[1]);
+  80015b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80015e:	48 b8 1d 20 80 00 00 	movabs $0x80201d,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  80016a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  80016d:	49 bf 79 50 80 00 00 	movabs $0x805079,%r15
+  800174:	00 00 00 
+  800177:	49 be 38 05 80 00 00 	movabs $0x800538,%r14
+  80017e:	00 00 00 
+            dup(p[0], 10);
+  800181:	49 bd 78 20 80 00 00 	movabs $0x802078,%r13
+  800188:	00 00 00 
+            sys_yield();
+  80018b:	49 bc 7e 13 80 00 00 	movabs $0x80137e,%r12
+  800192:	00 00 00 
+  800195:	eb 2d                	jmp    8001c4 <umain+0x19f>
+            dup(p[0], 10);
+  800197:	be 0a 00 00 00       	mov    $0xa,%esi
+  80019c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80019f:	41 ff d5             	call   *%r13
+            sys_yield();
+  8001a2:	41 ff d4             	call   *%r12
+            close(10);
+  8001a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001aa:	48 b8 1d 20 80 00 00 	movabs $0x80201d,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+            sys_yield();
+  8001b6:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001b9:	83 c3 01             	add    $0x1,%ebx
+  8001bc:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001c2:	74 2d                	je     8001f1 <umain+0x1cc>
+            if (i % 10 == 0)
+  8001c4:	48 63 c3             	movslq %ebx,%rax
+  8001c7:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001ce:	48 c1 f8 22          	sar    $0x22,%rax
+  8001d2:	89 da                	mov    %ebx,%edx
+  8001d4:	c1 fa 1f             	sar    $0x1f,%edx
+  8001d7:	29 d0                	sub    %edx,%eax
+  8001d9:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001dc:	01 c0                	add    %eax,%eax
+  8001de:	39 c3                	cmp    %eax,%ebx
+  8001e0:	75 b5                	jne    800197 <umain+0x172>
+                cprintf("%d.", i);
+  8001e2:	89 de                	mov    %ebx,%esi
+  8001e4:	4c 89 ff             	mov    %r15,%rdi
+  8001e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ec:	41 ff d6             	call   *%r14
+  8001ef:	eb a6                	jmp    800197 <umain+0x172>
+        exit();
+  8001f1:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+  8001fd:	e9 88 fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  800202:	48 bf 99 50 80 00 00 	movabs $0x805099,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	48 ba 38 05 80 00 00 	movabs $0x800538,%rdx
+  800218:	00 00 00 
+  80021b:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80021d:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800220:	48 b8 d9 38 80 00 00 	movabs $0x8038d9,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+  80022c:	85 c0                	test   %eax,%eax
+  80022e:	75 51                	jne    800281 <umain+0x25c>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800230:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800234:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800237:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+  800243:	85 c0                	test   %eax,%eax
+  800245:	78 64                	js     8002ab <umain+0x286>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  800247:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80024b:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  800252:	00 00 00 
+  800255:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  800257:	48 bf c7 50 80 00 00 	movabs $0x8050c7,%rdi
+  80025e:	00 00 00 
+  800261:	b8 00 00 00 00       	mov    $0x0,%eax
+  800266:	48 ba 38 05 80 00 00 	movabs $0x800538,%rdx
+  80026d:	00 00 00 
+  800270:	ff d2                	call   *%rdx
+}
+  800272:	48 83 c4 28          	add    $0x28,%rsp
+  800276:	5b                   	pop    %rbx
+  800277:	41 5c                	pop    %r12
+  800279:	41 5d                	pop    %r13
+  80027b:	41 5e                	pop    %r14
+  80027d:	41 5f                	pop    %r15
+  80027f:	5d                   	pop    %rbp
+  800280:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  800281:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800288:	00 00 00 
+  80028b:	be 40 00 00 00       	mov    $0x40,%esi
+  800290:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800297:	00 00 00 
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	48 b9 e8 03 80 00 00 	movabs $0x8003e8,%rcx
+  8002a6:	00 00 00 
+  8002a9:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002ab:	89 c1                	mov    %eax,%ecx
+  8002ad:	48 ba af 50 80 00 00 	movabs $0x8050af,%rdx
+  8002b4:	00 00 00 
+  8002b7:	be 42 00 00 00       	mov    $0x42,%esi
+  8002bc:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  8002c3:	00 00 00 
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  8002d2:	00 00 00 
+  8002d5:	41 ff d0             	call   *%r8
+
+00000000008002d8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002d8:	55                   	push   %rbp
+  8002d9:	48 89 e5             	mov    %rsp,%rbp
+  8002dc:	41 56                	push   %r14
+  8002de:	41 55                	push   %r13
+  8002e0:	41 54                	push   %r12
+  8002e2:	53                   	push   %rbx
+  8002e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8002e7:	41 89 fd             	mov    %edi,%r13d
+  8002ea:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  8002ed:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8002f4:	00 
+  8002f5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8002fc:	00 
+  8002fd:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800304:	00 
+  800305:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80030c:	00 
+  80030d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800311:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80031a:	48 b8 d7 15 80 00 00 	movabs $0x8015d7,%rax
+  800321:	00 00 00 
+  800324:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800326:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80032d:	00 00 00 
+  800330:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800337:	00 00 00 
+  80033a:	48 39 c2             	cmp    %rax,%rdx
+  80033d:	73 17                	jae    800356 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80033f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800342:	49 89 c4             	mov    %rax,%r12
+  800345:	48 83 c3 08          	add    $0x8,%rbx
+  800349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034e:	ff 53 f8             	call   *-0x8(%rbx)
+  800351:	4c 39 e3             	cmp    %r12,%rbx
+  800354:	72 ef                	jb     800345 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800356:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  80035d:	00 00 00 
+  800360:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800362:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800369:	00 00 
+  80036b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800370:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800377:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80037e:	00 00 00 
+  800381:	48 01 c8             	add    %rcx,%rax
+  800384:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800388:	45 85 ed             	test   %r13d,%r13d
+  80038b:	7e 0d                	jle    80039a <libmain+0xc2>
+  80038d:	49 8b 06             	mov    (%r14),%rax
+  800390:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800397:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80039a:	4c 89 f6             	mov    %r14,%rsi
+  80039d:	44 89 ef             	mov    %r13d,%edi
+  8003a0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003ac:	48 b8 c5 03 80 00 00 	movabs $0x8003c5,%rax
+  8003b3:	00 00 00 
+  8003b6:	ff d0                	call   *%rax
+#endif
+}
+  8003b8:	48 83 c4 30          	add    $0x30,%rsp
+  8003bc:	5b                   	pop    %rbx
+  8003bd:	41 5c                	pop    %r12
+  8003bf:	41 5d                	pop    %r13
+  8003c1:	41 5e                	pop    %r14
+  8003c3:	5d                   	pop    %rbp
+  8003c4:	c3                   	ret
+
+00000000008003c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003c5:	55                   	push   %rbp
+  8003c6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003c9:	48 b8 50 20 80 00 00 	movabs $0x802050,%rax
+  8003d0:	00 00 00 
+  8003d3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003da:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  8003e1:	00 00 00 
+  8003e4:	ff d0                	call   *%rax
+}
+  8003e6:	5d                   	pop    %rbp
+  8003e7:	c3                   	ret
+
+00000000008003e8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003e8:	55                   	push   %rbp
+  8003e9:	48 89 e5             	mov    %rsp,%rbp
+  8003ec:	41 56                	push   %r14
+  8003ee:	41 55                	push   %r13
+  8003f0:	41 54                	push   %r12
+  8003f2:	53                   	push   %rbx
+  8003f3:	48 83 ec 50          	sub    $0x50,%rsp
+  8003f7:	49 89 fc             	mov    %rdi,%r12
+  8003fa:	41 89 f5             	mov    %esi,%r13d
+  8003fd:	48 89 d3             	mov    %rdx,%rbx
+  800400:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800404:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800408:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80040c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800413:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800417:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80041b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80041f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800423:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80042a:	00 00 00 
+  80042d:	4c 8b 30             	mov    (%rax),%r14
+  800430:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  800437:	00 00 00 
+  80043a:	ff d0                	call   *%rax
+  80043c:	89 c6                	mov    %eax,%esi
+  80043e:	45 89 e8             	mov    %r13d,%r8d
+  800441:	4c 89 e1             	mov    %r12,%rcx
+  800444:	4c 89 f2             	mov    %r14,%rdx
+  800447:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  80044e:	00 00 00 
+  800451:	b8 00 00 00 00       	mov    $0x0,%eax
+  800456:	49 bc 38 05 80 00 00 	movabs $0x800538,%r12
+  80045d:	00 00 00 
+  800460:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800463:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800467:	48 89 df             	mov    %rbx,%rdi
+  80046a:	48 b8 d4 04 80 00 00 	movabs $0x8004d4,%rax
+  800471:	00 00 00 
+  800474:	ff d0                	call   *%rax
+    cprintf("\n");
+  800476:	48 bf 97 50 80 00 00 	movabs $0x805097,%rdi
+  80047d:	00 00 00 
+  800480:	b8 00 00 00 00       	mov    $0x0,%eax
+  800485:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800488:	cc                   	int3
+  800489:	eb fd                	jmp    800488 <_panic+0xa0>
+
+000000000080048b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80048b:	55                   	push   %rbp
+  80048c:	48 89 e5             	mov    %rsp,%rbp
+  80048f:	53                   	push   %rbx
+  800490:	48 83 ec 08          	sub    $0x8,%rsp
+  800494:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800497:	8b 06                	mov    (%rsi),%eax
+  800499:	8d 50 01             	lea    0x1(%rax),%edx
+  80049c:	89 16                	mov    %edx,(%rsi)
+  80049e:	48 98                	cltq
+  8004a0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004a5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004ab:	74 0a                	je     8004b7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004ad:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b5:	c9                   	leave
+  8004b6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004b7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004bb:	be ff 00 00 00       	mov    $0xff,%esi
+  8004c0:	48 b8 84 12 80 00 00 	movabs $0x801284,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004cc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004d2:	eb d9                	jmp    8004ad <putch+0x22>
+
+00000000008004d4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004d4:	55                   	push   %rbp
+  8004d5:	48 89 e5             	mov    %rsp,%rbp
+  8004d8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004df:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004e2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004e9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004f6:	48 89 f1             	mov    %rsi,%rcx
+  8004f9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800500:	48 bf 8b 04 80 00 00 	movabs $0x80048b,%rdi
+  800507:	00 00 00 
+  80050a:	48 b8 88 06 80 00 00 	movabs $0x800688,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800516:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80051d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800524:	48 b8 84 12 80 00 00 	movabs $0x801284,%rax
+  80052b:	00 00 00 
+  80052e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800530:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800536:	c9                   	leave
+  800537:	c3                   	ret
+
+0000000000800538 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800538:	55                   	push   %rbp
+  800539:	48 89 e5             	mov    %rsp,%rbp
+  80053c:	48 83 ec 50          	sub    $0x50,%rsp
+  800540:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800544:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800548:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80054c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800550:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800554:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80055b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80055f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800563:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800567:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80056b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80056f:	48 b8 d4 04 80 00 00 	movabs $0x8004d4,%rax
+  800576:	00 00 00 
+  800579:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80057b:	c9                   	leave
+  80057c:	c3                   	ret
+
+000000000080057d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80057d:	55                   	push   %rbp
+  80057e:	48 89 e5             	mov    %rsp,%rbp
+  800581:	41 57                	push   %r15
+  800583:	41 56                	push   %r14
+  800585:	41 55                	push   %r13
+  800587:	41 54                	push   %r12
+  800589:	53                   	push   %rbx
+  80058a:	48 83 ec 18          	sub    $0x18,%rsp
+  80058e:	49 89 fc             	mov    %rdi,%r12
+  800591:	49 89 f5             	mov    %rsi,%r13
+  800594:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800598:	8b 45 10             	mov    0x10(%rbp),%eax
+  80059b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80059e:	41 89 cf             	mov    %ecx,%r15d
+  8005a1:	4c 39 fa             	cmp    %r15,%rdx
+  8005a4:	73 5b                	jae    800601 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005a6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005aa:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005ae:	85 db                	test   %ebx,%ebx
+  8005b0:	7e 0e                	jle    8005c0 <print_num+0x43>
+            putch(padc, put_arg);
+  8005b2:	4c 89 ee             	mov    %r13,%rsi
+  8005b5:	44 89 f7             	mov    %r14d,%edi
+  8005b8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005bb:	83 eb 01             	sub    $0x1,%ebx
+  8005be:	75 f2                	jne    8005b2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005c0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005c4:	48 b9 1c 51 80 00 00 	movabs $0x80511c,%rcx
+  8005cb:	00 00 00 
+  8005ce:	48 b8 0b 51 80 00 00 	movabs $0x80510b,%rax
+  8005d5:	00 00 00 
+  8005d8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e5:	49 f7 f7             	div    %r15
+  8005e8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005ec:	4c 89 ee             	mov    %r13,%rsi
+  8005ef:	41 ff d4             	call   *%r12
+}
+  8005f2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005f6:	5b                   	pop    %rbx
+  8005f7:	41 5c                	pop    %r12
+  8005f9:	41 5d                	pop    %r13
+  8005fb:	41 5e                	pop    %r14
+  8005fd:	41 5f                	pop    %r15
+  8005ff:	5d                   	pop    %rbp
+  800600:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800601:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060a:	49 f7 f7             	div    %r15
+  80060d:	48 83 ec 08          	sub    $0x8,%rsp
+  800611:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800615:	52                   	push   %rdx
+  800616:	45 0f be c9          	movsbl %r9b,%r9d
+  80061a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80061e:	48 89 c2             	mov    %rax,%rdx
+  800621:	48 b8 7d 05 80 00 00 	movabs $0x80057d,%rax
+  800628:	00 00 00 
+  80062b:	ff d0                	call   *%rax
+  80062d:	48 83 c4 10          	add    $0x10,%rsp
+  800631:	eb 8d                	jmp    8005c0 <print_num+0x43>
+
+0000000000800633 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800633:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800637:	48 8b 06             	mov    (%rsi),%rax
+  80063a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80063e:	73 0a                	jae    80064a <sprintputch+0x17>
+        *state->start++ = ch;
+  800640:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800644:	48 89 16             	mov    %rdx,(%rsi)
+  800647:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80064a:	c3                   	ret
+
+000000000080064b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	48 83 ec 50          	sub    $0x50,%rsp
+  800653:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800657:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80065b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80065f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800666:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80066a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800672:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800676:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80067a:	48 b8 88 06 80 00 00 	movabs $0x800688,%rax
+  800681:	00 00 00 
+  800684:	ff d0                	call   *%rax
+}
+  800686:	c9                   	leave
+  800687:	c3                   	ret
+
+0000000000800688 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800688:	55                   	push   %rbp
+  800689:	48 89 e5             	mov    %rsp,%rbp
+  80068c:	41 57                	push   %r15
+  80068e:	41 56                	push   %r14
+  800690:	41 55                	push   %r13
+  800692:	41 54                	push   %r12
+  800694:	53                   	push   %rbx
+  800695:	48 83 ec 38          	sub    $0x38,%rsp
+  800699:	49 89 fe             	mov    %rdi,%r14
+  80069c:	49 89 f5             	mov    %rsi,%r13
+  80069f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006a2:	48 8b 01             	mov    (%rcx),%rax
+  8006a5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006a9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006b9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006bd:	0f b6 3b             	movzbl (%rbx),%edi
+  8006c0:	40 80 ff 25          	cmp    $0x25,%dil
+  8006c4:	74 18                	je     8006de <vprintfmt+0x56>
+            if (!ch) return;
+  8006c6:	40 84 ff             	test   %dil,%dil
+  8006c9:	0f 84 b1 06 00 00    	je     800d80 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006cf:	40 0f b6 ff          	movzbl %dil,%edi
+  8006d3:	4c 89 ee             	mov    %r13,%rsi
+  8006d6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006d9:	4c 89 e3             	mov    %r12,%rbx
+  8006dc:	eb db                	jmp    8006b9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006de:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006e7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006ec:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006f2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006f9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006fd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800702:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800707:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80070a:	83 e8 23             	sub    $0x23,%eax
+  80070d:	3c 57                	cmp    $0x57,%al
+  80070f:	0f 87 51 06 00 00    	ja     800d66 <vprintfmt+0x6de>
+  800715:	0f b6 c0             	movzbl %al,%eax
+  800718:	48 b9 c0 52 80 00 00 	movabs $0x8052c0,%rcx
+  80071f:	00 00 00 
+  800722:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800725:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800728:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80072c:	eb cf                	jmp    8006fd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80072e:	49 89 dc             	mov    %rbx,%r12
+  800731:	be 01 00 00 00       	mov    $0x1,%esi
+  800736:	eb c5                	jmp    8006fd <vprintfmt+0x75>
+            padc = ch;
+  800738:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80073c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80073f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800742:	eb b9                	jmp    8006fd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800744:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800747:	83 f8 2f             	cmp    $0x2f,%eax
+  80074a:	77 24                	ja     800770 <vprintfmt+0xe8>
+  80074c:	89 c1                	mov    %eax,%ecx
+  80074e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800752:	83 c0 08             	add    $0x8,%eax
+  800755:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800758:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80075b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80075e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800762:	79 99                	jns    8006fd <vprintfmt+0x75>
+                width = precision;
+  800764:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800768:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076e:	eb 8d                	jmp    8006fd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800770:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800774:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077c:	eb da                	jmp    800758 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80077e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800783:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800787:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80078d:	3c 39                	cmp    $0x39,%al
+  80078f:	77 1c                	ja     8007ad <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800791:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800795:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800799:	0f b6 c0             	movzbl %al,%eax
+  80079c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007a1:	0f b6 03             	movzbl (%rbx),%eax
+  8007a4:	3c 39                	cmp    $0x39,%al
+  8007a6:	76 e9                	jbe    800791 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007a8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007ab:	eb b1                	jmp    80075e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007ad:	49 89 dc             	mov    %rbx,%r12
+  8007b0:	eb ac                	jmp    80075e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007b2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007b5:	85 c9                	test   %ecx,%ecx
+  8007b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bc:	0f 49 c1             	cmovns %ecx,%eax
+  8007bf:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007c2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007c5:	e9 33 ff ff ff       	jmp    8006fd <vprintfmt+0x75>
+            lflag++;
+  8007ca:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007d0:	e9 28 ff ff ff       	jmp    8006fd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007db:	77 19                	ja     8007f6 <vprintfmt+0x16e>
+  8007dd:	89 c2                	mov    %eax,%edx
+  8007df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e3:	83 c0 08             	add    $0x8,%eax
+  8007e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e9:	8b 3a                	mov    (%rdx),%edi
+  8007eb:	4c 89 ee             	mov    %r13,%rsi
+  8007ee:	41 ff d6             	call   *%r14
+            break;
+  8007f1:	e9 c3 fe ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800802:	eb e5                	jmp    8007e9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800807:	83 f8 2f             	cmp    $0x2f,%eax
+  80080a:	77 5a                	ja     800866 <vprintfmt+0x1de>
+  80080c:	89 c2                	mov    %eax,%edx
+  80080e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800812:	83 c0 08             	add    $0x8,%eax
+  800815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800818:	8b 02                	mov    (%rdx),%eax
+  80081a:	89 c1                	mov    %eax,%ecx
+  80081c:	f7 d9                	neg    %ecx
+  80081e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800821:	83 f9 16             	cmp    $0x16,%ecx
+  800824:	7f 4e                	jg     800874 <vprintfmt+0x1ec>
+  800826:	48 63 c1             	movslq %ecx,%rax
+  800829:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  800830:	00 00 00 
+  800833:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800837:	48 85 c0             	test   %rax,%rax
+  80083a:	74 38                	je     800874 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80083c:	48 89 c1             	mov    %rax,%rcx
+  80083f:	48 ba 79 57 80 00 00 	movabs $0x805779,%rdx
+  800846:	00 00 00 
+  800849:	4c 89 ee             	mov    %r13,%rsi
+  80084c:	4c 89 f7             	mov    %r14,%rdi
+  80084f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800854:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80085b:	00 00 00 
+  80085e:	41 ff d0             	call   *%r8
+  800861:	e9 53 fe ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800866:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800872:	eb a4                	jmp    800818 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800874:	48 ba 34 51 80 00 00 	movabs $0x805134,%rdx
+  80087b:	00 00 00 
+  80087e:	4c 89 ee             	mov    %r13,%rsi
+  800881:	4c 89 f7             	mov    %r14,%rdi
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  800890:	00 00 00 
+  800893:	41 ff d0             	call   *%r8
+  800896:	e9 1e fe ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80089b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089e:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a1:	77 6c                	ja     80090f <vprintfmt+0x287>
+  8008a3:	89 c2                	mov    %eax,%edx
+  8008a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a9:	83 c0 08             	add    $0x8,%eax
+  8008ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008af:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008b2:	48 85 d2             	test   %rdx,%rdx
+  8008b5:	48 b8 2d 51 80 00 00 	movabs $0x80512d,%rax
+  8008bc:	00 00 00 
+  8008bf:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008c3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008c7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008cb:	7e 06                	jle    8008d3 <vprintfmt+0x24b>
+  8008cd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008d1:	75 4a                	jne    80091d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008d3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008d7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008db:	0f b6 00             	movzbl (%rax),%eax
+  8008de:	84 c0                	test   %al,%al
+  8008e0:	0f 85 9a 00 00 00    	jne    800980 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008e6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008e9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008ed:	85 c0                	test   %eax,%eax
+  8008ef:	0f 8e c4 fd ff ff    	jle    8006b9 <vprintfmt+0x31>
+  8008f5:	4c 89 ee             	mov    %r13,%rsi
+  8008f8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008fd:	41 ff d6             	call   *%r14
+  800900:	41 83 ec 01          	sub    $0x1,%r12d
+  800904:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800908:	75 eb                	jne    8008f5 <vprintfmt+0x26d>
+  80090a:	e9 aa fd ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80090f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800913:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800917:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091b:	eb 92                	jmp    8008af <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80091d:	49 63 f7             	movslq %r15d,%rsi
+  800920:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800924:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  80092b:	00 00 00 
+  80092e:	ff d0                	call   *%rax
+  800930:	48 89 c2             	mov    %rax,%rdx
+  800933:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800936:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800938:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80093b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80093e:	85 c0                	test   %eax,%eax
+  800940:	7e 91                	jle    8008d3 <vprintfmt+0x24b>
+  800942:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800947:	4c 89 ee             	mov    %r13,%rsi
+  80094a:	44 89 e7             	mov    %r12d,%edi
+  80094d:	41 ff d6             	call   *%r14
+  800950:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800954:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800957:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80095a:	75 eb                	jne    800947 <vprintfmt+0x2bf>
+  80095c:	e9 72 ff ff ff       	jmp    8008d3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800961:	0f b6 f8             	movzbl %al,%edi
+  800964:	4c 89 ee             	mov    %r13,%rsi
+  800967:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80096a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80096e:	49 83 c4 01          	add    $0x1,%r12
+  800972:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800978:	84 c0                	test   %al,%al
+  80097a:	0f 84 66 ff ff ff    	je     8008e6 <vprintfmt+0x25e>
+  800980:	45 85 ff             	test   %r15d,%r15d
+  800983:	78 0a                	js     80098f <vprintfmt+0x307>
+  800985:	41 83 ef 01          	sub    $0x1,%r15d
+  800989:	0f 88 57 ff ff ff    	js     8008e6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80098f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800993:	74 cc                	je     800961 <vprintfmt+0x2d9>
+  800995:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800998:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80099d:	80 fa 5e             	cmp    $0x5e,%dl
+  8009a0:	77 c2                	ja     800964 <vprintfmt+0x2dc>
+  8009a2:	eb bd                	jmp    800961 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a4:	40 84 f6             	test   %sil,%sil
+  8009a7:	75 26                	jne    8009cf <vprintfmt+0x347>
+    switch (lflag) {
+  8009a9:	85 d2                	test   %edx,%edx
+  8009ab:	74 59                	je     800a06 <vprintfmt+0x37e>
+  8009ad:	83 fa 01             	cmp    $0x1,%edx
+  8009b0:	74 7b                	je     800a2d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b8:	0f 87 96 00 00 00    	ja     800a54 <vprintfmt+0x3cc>
+  8009be:	89 c2                	mov    %eax,%edx
+  8009c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c4:	83 c0 08             	add    $0x8,%eax
+  8009c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ca:	4c 8b 22             	mov    (%rdx),%r12
+  8009cd:	eb 17                	jmp    8009e6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 21                	ja     8009f8 <vprintfmt+0x370>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009e6:	4d 85 e4             	test   %r12,%r12
+  8009e9:	78 7a                	js     800a65 <vprintfmt+0x3dd>
+            num = i;
+  8009eb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009f3:	e9 50 02 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a04:	eb dd                	jmp    8009e3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a09:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0c:	77 11                	ja     800a1f <vprintfmt+0x397>
+  800a0e:	89 c2                	mov    %eax,%edx
+  800a10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a14:	83 c0 08             	add    $0x8,%eax
+  800a17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1a:	4c 63 22             	movslq (%rdx),%r12
+  800a1d:	eb c7                	jmp    8009e6 <vprintfmt+0x35e>
+  800a1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2b:	eb ed                	jmp    800a1a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 11                	ja     800a46 <vprintfmt+0x3be>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	4c 8b 22             	mov    (%rdx),%r12
+  800a44:	eb a0                	jmp    8009e6 <vprintfmt+0x35e>
+  800a46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a52:	eb ed                	jmp    800a41 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a60:	e9 65 ff ff ff       	jmp    8009ca <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a65:	4c 89 ee             	mov    %r13,%rsi
+  800a68:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a6d:	41 ff d6             	call   *%r14
+                i = -i;
+  800a70:	49 f7 dc             	neg    %r12
+  800a73:	e9 73 ff ff ff       	jmp    8009eb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a78:	40 84 f6             	test   %sil,%sil
+  800a7b:	75 32                	jne    800aaf <vprintfmt+0x427>
+    switch (lflag) {
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	74 5d                	je     800ade <vprintfmt+0x456>
+  800a81:	83 fa 01             	cmp    $0x1,%edx
+  800a84:	0f 84 82 00 00 00    	je     800b0c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	0f 87 a5 00 00 00    	ja     800b3b <vprintfmt+0x4b3>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aa5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aaa:	e9 99 01 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	77 19                	ja     800ad0 <vprintfmt+0x448>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800acb:	e9 78 01 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+  800ad0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adc:	eb e5                	jmp    800ac3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ade:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae4:	77 18                	ja     800afe <vprintfmt+0x476>
+  800ae6:	89 c2                	mov    %eax,%edx
+  800ae8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aec:	83 c0 08             	add    $0x8,%eax
+  800aef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800af4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800af9:	e9 4a 01 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	eb e6                	jmp    800af2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	77 19                	ja     800b2d <vprintfmt+0x4a5>
+  800b14:	89 c2                	mov    %eax,%edx
+  800b16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1a:	83 c0 08             	add    $0x8,%eax
+  800b1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b20:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b23:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b28:	e9 1b 01 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+  800b2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b39:	eb e5                	jmp    800b20 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b47:	e9 56 ff ff ff       	jmp    800aa2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4c:	40 84 f6             	test   %sil,%sil
+  800b4f:	75 2e                	jne    800b7f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b51:	85 d2                	test   %edx,%edx
+  800b53:	74 59                	je     800bae <vprintfmt+0x526>
+  800b55:	83 fa 01             	cmp    $0x1,%edx
+  800b58:	74 7f                	je     800bd9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b60:	0f 87 9f 00 00 00    	ja     800c05 <vprintfmt+0x57d>
+  800b66:	89 c2                	mov    %eax,%edx
+  800b68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6c:	83 c0 08             	add    $0x8,%eax
+  800b6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b72:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b75:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b7a:	e9 c9 00 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	77 19                	ja     800ba0 <vprintfmt+0x518>
+  800b87:	89 c2                	mov    %eax,%edx
+  800b89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8d:	83 c0 08             	add    $0x8,%eax
+  800b90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b93:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b96:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b9b:	e9 a8 00 00 00       	jmp    800c48 <vprintfmt+0x5c0>
+  800ba0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bac:	eb e5                	jmp    800b93 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb4:	77 15                	ja     800bcb <vprintfmt+0x543>
+  800bb6:	89 c2                	mov    %eax,%edx
+  800bb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbc:	83 c0 08             	add    $0x8,%eax
+  800bbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bc4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bc9:	eb 7d                	jmp    800c48 <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e9                	jmp    800bc2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 16                	ja     800bf7 <vprintfmt+0x56f>
+  800be1:	89 c2                	mov    %eax,%edx
+  800be3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be7:	83 c0 08             	add    $0x8,%eax
+  800bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bed:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bf5:	eb 51                	jmp    800c48 <vprintfmt+0x5c0>
+  800bf7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c03:	eb e8                	jmp    800bed <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c11:	e9 5c ff ff ff       	jmp    800b72 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c16:	4c 89 ee             	mov    %r13,%rsi
+  800c19:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c1e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c21:	4c 89 ee             	mov    %r13,%rsi
+  800c24:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c29:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c32:	77 47                	ja     800c7b <vprintfmt+0x5f3>
+  800c34:	89 c2                	mov    %eax,%edx
+  800c36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3a:	83 c0 08             	add    $0x8,%eax
+  800c3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c43:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c48:	48 83 ec 08          	sub    $0x8,%rsp
+  800c4c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c50:	0f 94 c0             	sete   %al
+  800c53:	0f b6 c0             	movzbl %al,%eax
+  800c56:	50                   	push   %rax
+  800c57:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c5c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c60:	4c 89 ee             	mov    %r13,%rsi
+  800c63:	4c 89 f7             	mov    %r14,%rdi
+  800c66:	48 b8 7d 05 80 00 00 	movabs $0x80057d,%rax
+  800c6d:	00 00 00 
+  800c70:	ff d0                	call   *%rax
+            break;
+  800c72:	48 83 c4 10          	add    $0x10,%rsp
+  800c76:	e9 3e fa ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c87:	eb b7                	jmp    800c40 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c89:	40 84 f6             	test   %sil,%sil
+  800c8c:	75 2b                	jne    800cb9 <vprintfmt+0x631>
+    switch (lflag) {
+  800c8e:	85 d2                	test   %edx,%edx
+  800c90:	74 56                	je     800ce8 <vprintfmt+0x660>
+  800c92:	83 fa 01             	cmp    $0x1,%edx
+  800c95:	74 7f                	je     800d16 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9d:	0f 87 a2 00 00 00    	ja     800d45 <vprintfmt+0x6bd>
+  800ca3:	89 c2                	mov    %eax,%edx
+  800ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca9:	83 c0 08             	add    $0x8,%eax
+  800cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800caf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cb7:	eb 8f                	jmp    800c48 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbf:	77 19                	ja     800cda <vprintfmt+0x652>
+  800cc1:	89 c2                	mov    %eax,%edx
+  800cc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc7:	83 c0 08             	add    $0x8,%eax
+  800cca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ccd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cd0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cd5:	e9 6e ff ff ff       	jmp    800c48 <vprintfmt+0x5c0>
+  800cda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce6:	eb e5                	jmp    800ccd <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ce8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ceb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cee:	77 18                	ja     800d08 <vprintfmt+0x680>
+  800cf0:	89 c2                	mov    %eax,%edx
+  800cf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf6:	83 c0 08             	add    $0x8,%eax
+  800cf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d03:	e9 40 ff ff ff       	jmp    800c48 <vprintfmt+0x5c0>
+  800d08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d14:	eb e6                	jmp    800cfc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d19:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1c:	77 19                	ja     800d37 <vprintfmt+0x6af>
+  800d1e:	89 c2                	mov    %eax,%edx
+  800d20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d24:	83 c0 08             	add    $0x8,%eax
+  800d27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d32:	e9 11 ff ff ff       	jmp    800c48 <vprintfmt+0x5c0>
+  800d37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d43:	eb e5                	jmp    800d2a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d51:	e9 59 ff ff ff       	jmp    800caf <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d56:	4c 89 ee             	mov    %r13,%rsi
+  800d59:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d5e:	41 ff d6             	call   *%r14
+            break;
+  800d61:	e9 53 f9 ff ff       	jmp    8006b9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d66:	4c 89 ee             	mov    %r13,%rsi
+  800d69:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d6e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d71:	48 83 eb 01          	sub    $0x1,%rbx
+  800d75:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d79:	75 f6                	jne    800d71 <vprintfmt+0x6e9>
+  800d7b:	e9 39 f9 ff ff       	jmp    8006b9 <vprintfmt+0x31>
+}
+  800d80:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d84:	5b                   	pop    %rbx
+  800d85:	41 5c                	pop    %r12
+  800d87:	41 5d                	pop    %r13
+  800d89:	41 5e                	pop    %r14
+  800d8b:	41 5f                	pop    %r15
+  800d8d:	5d                   	pop    %rbp
+  800d8e:	c3                   	ret
+
+0000000000800d8f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d8f:	55                   	push   %rbp
+  800d90:	48 89 e5             	mov    %rsp,%rbp
+  800d93:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d9b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800da0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800da4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dab:	48 85 ff             	test   %rdi,%rdi
+  800dae:	74 2b                	je     800ddb <vsnprintf+0x4c>
+  800db0:	48 85 f6             	test   %rsi,%rsi
+  800db3:	74 26                	je     800ddb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800db5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800db9:	48 bf 33 06 80 00 00 	movabs $0x800633,%rdi
+  800dc0:	00 00 00 
+  800dc3:	48 b8 88 06 80 00 00 	movabs $0x800688,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dcf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dd3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dd6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dd9:	c9                   	leave
+  800dda:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ddb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800de0:	eb f7                	jmp    800dd9 <vsnprintf+0x4a>
+
+0000000000800de2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800de2:	55                   	push   %rbp
+  800de3:	48 89 e5             	mov    %rsp,%rbp
+  800de6:	48 83 ec 50          	sub    $0x50,%rsp
+  800dea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dee:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800df2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800df6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dfd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e05:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e09:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e0d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e11:	48 b8 8f 0d 80 00 00 	movabs $0x800d8f,%rax
+  800e18:	00 00 00 
+  800e1b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e1d:	c9                   	leave
+  800e1e:	c3                   	ret
+
+0000000000800e1f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e1f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e22:	74 10                	je     800e34 <strlen+0x15>
+    size_t n = 0;
+  800e24:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e29:	48 83 c0 01          	add    $0x1,%rax
+  800e2d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e31:	75 f6                	jne    800e29 <strlen+0xa>
+  800e33:	c3                   	ret
+    size_t n = 0;
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e39:	c3                   	ret
+
+0000000000800e3a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e3a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e42:	48 85 f6             	test   %rsi,%rsi
+  800e45:	74 11                	je     800e58 <strnlen+0x1e>
+  800e47:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e4b:	74 0c                	je     800e59 <strnlen+0x1f>
+  800e4d:	48 83 c2 01          	add    $0x1,%rdx
+  800e51:	48 39 d0             	cmp    %rdx,%rax
+  800e54:	75 f1                	jne    800e47 <strnlen+0xd>
+  800e56:	eb 04                	jmp    800e5c <strnlen+0x22>
+  800e58:	c3                   	ret
+  800e59:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e5c:	c3                   	ret
+
+0000000000800e5d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e5d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e65:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e69:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e6c:	48 83 c2 01          	add    $0x1,%rdx
+  800e70:	84 c9                	test   %cl,%cl
+  800e72:	75 f1                	jne    800e65 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e74:	c3                   	ret
+
+0000000000800e75 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e75:	55                   	push   %rbp
+  800e76:	48 89 e5             	mov    %rsp,%rbp
+  800e79:	41 54                	push   %r12
+  800e7b:	53                   	push   %rbx
+  800e7c:	48 89 fb             	mov    %rdi,%rbx
+  800e7f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e82:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e8e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e92:	4c 89 e6             	mov    %r12,%rsi
+  800e95:	48 b8 5d 0e 80 00 00 	movabs $0x800e5d,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+    return dst;
+}
+  800ea1:	48 89 d8             	mov    %rbx,%rax
+  800ea4:	5b                   	pop    %rbx
+  800ea5:	41 5c                	pop    %r12
+  800ea7:	5d                   	pop    %rbp
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ea9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800eac:	48 85 d2             	test   %rdx,%rdx
+  800eaf:	74 1f                	je     800ed0 <strncpy+0x27>
+  800eb1:	48 01 fa             	add    %rdi,%rdx
+  800eb4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800eb7:	48 83 c1 01          	add    $0x1,%rcx
+  800ebb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ebf:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ec3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ec7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ecb:	48 39 ca             	cmp    %rcx,%rdx
+  800ece:	75 e7                	jne    800eb7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ed0:	c3                   	ret
+
+0000000000800ed1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ed1:	48 89 f8             	mov    %rdi,%rax
+  800ed4:	48 85 d2             	test   %rdx,%rdx
+  800ed7:	74 24                	je     800efd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ed9:	48 83 ea 01          	sub    $0x1,%rdx
+  800edd:	74 1b                	je     800efa <strlcpy+0x29>
+  800edf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ee3:	0f b6 16             	movzbl (%rsi),%edx
+  800ee6:	84 d2                	test   %dl,%dl
+  800ee8:	74 10                	je     800efa <strlcpy+0x29>
+            *dst++ = *src++;
+  800eea:	48 83 c6 01          	add    $0x1,%rsi
+  800eee:	48 83 c0 01          	add    $0x1,%rax
+  800ef2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ef5:	48 39 c8             	cmp    %rcx,%rax
+  800ef8:	75 e9                	jne    800ee3 <strlcpy+0x12>
+        *dst = '\0';
+  800efa:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800efd:	48 29 f8             	sub    %rdi,%rax
+}
+  800f00:	c3                   	ret
+
+0000000000800f01 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f01:	0f b6 07             	movzbl (%rdi),%eax
+  800f04:	84 c0                	test   %al,%al
+  800f06:	74 13                	je     800f1b <strcmp+0x1a>
+  800f08:	38 06                	cmp    %al,(%rsi)
+  800f0a:	75 0f                	jne    800f1b <strcmp+0x1a>
+  800f0c:	48 83 c7 01          	add    $0x1,%rdi
+  800f10:	48 83 c6 01          	add    $0x1,%rsi
+  800f14:	0f b6 07             	movzbl (%rdi),%eax
+  800f17:	84 c0                	test   %al,%al
+  800f19:	75 ed                	jne    800f08 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f1b:	0f b6 c0             	movzbl %al,%eax
+  800f1e:	0f b6 16             	movzbl (%rsi),%edx
+  800f21:	29 d0                	sub    %edx,%eax
+}
+  800f23:	c3                   	ret
+
+0000000000800f24 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f24:	48 85 d2             	test   %rdx,%rdx
+  800f27:	74 1f                	je     800f48 <strncmp+0x24>
+  800f29:	0f b6 07             	movzbl (%rdi),%eax
+  800f2c:	84 c0                	test   %al,%al
+  800f2e:	74 1e                	je     800f4e <strncmp+0x2a>
+  800f30:	3a 06                	cmp    (%rsi),%al
+  800f32:	75 1a                	jne    800f4e <strncmp+0x2a>
+  800f34:	48 83 c7 01          	add    $0x1,%rdi
+  800f38:	48 83 c6 01          	add    $0x1,%rsi
+  800f3c:	48 83 ea 01          	sub    $0x1,%rdx
+  800f40:	75 e7                	jne    800f29 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f47:	c3                   	ret
+  800f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4d:	c3                   	ret
+  800f4e:	48 85 d2             	test   %rdx,%rdx
+  800f51:	74 09                	je     800f5c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f53:	0f b6 07             	movzbl (%rdi),%eax
+  800f56:	0f b6 16             	movzbl (%rsi),%edx
+  800f59:	29 d0                	sub    %edx,%eax
+  800f5b:	c3                   	ret
+    if (!n) return 0;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f61:	c3                   	ret
+
+0000000000800f62 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f62:	0f b6 17             	movzbl (%rdi),%edx
+  800f65:	84 d2                	test   %dl,%dl
+  800f67:	74 18                	je     800f81 <strchr+0x1f>
+        if (*str == c) {
+  800f69:	0f be d2             	movsbl %dl,%edx
+  800f6c:	39 f2                	cmp    %esi,%edx
+  800f6e:	74 17                	je     800f87 <strchr+0x25>
+    for (; *str; str++) {
+  800f70:	48 83 c7 01          	add    $0x1,%rdi
+  800f74:	0f b6 17             	movzbl (%rdi),%edx
+  800f77:	84 d2                	test   %dl,%dl
+  800f79:	75 ee                	jne    800f69 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f80:	c3                   	ret
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f86:	c3                   	ret
+  800f87:	48 89 f8             	mov    %rdi,%rax
+}
+  800f8a:	c3                   	ret
+
+0000000000800f8b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f8b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f8e:	0f b6 17             	movzbl (%rdi),%edx
+  800f91:	84 d2                	test   %dl,%dl
+  800f93:	74 13                	je     800fa8 <strfind+0x1d>
+  800f95:	0f be d2             	movsbl %dl,%edx
+  800f98:	39 f2                	cmp    %esi,%edx
+  800f9a:	74 0b                	je     800fa7 <strfind+0x1c>
+  800f9c:	48 83 c0 01          	add    $0x1,%rax
+  800fa0:	0f b6 10             	movzbl (%rax),%edx
+  800fa3:	84 d2                	test   %dl,%dl
+  800fa5:	75 ee                	jne    800f95 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fa7:	c3                   	ret
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fa9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fac:	48 89 f8             	mov    %rdi,%rax
+  800faf:	48 f7 d8             	neg    %rax
+  800fb2:	83 e0 07             	and    $0x7,%eax
+  800fb5:	49 89 d1             	mov    %rdx,%r9
+  800fb8:	49 29 c1             	sub    %rax,%r9
+  800fbb:	78 36                	js     800ff3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fbd:	40 0f b6 c6          	movzbl %sil,%eax
+  800fc1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fc8:	01 01 01 
+  800fcb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fcf:	40 f6 c7 07          	test   $0x7,%dil
+  800fd3:	75 38                	jne    80100d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fd5:	4c 89 c9             	mov    %r9,%rcx
+  800fd8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fdc:	74 0c                	je     800fea <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fde:	fc                   	cld
+  800fdf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fe2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fe6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fea:	4d 85 c9             	test   %r9,%r9
+  800fed:	75 45                	jne    801034 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fef:	4c 89 c0             	mov    %r8,%rax
+  800ff2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ff3:	48 85 d2             	test   %rdx,%rdx
+  800ff6:	74 f7                	je     800fef <memset+0x46>
+  800ff8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ffb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ffe:	48 83 c0 01          	add    $0x1,%rax
+  801002:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801006:	48 39 c2             	cmp    %rax,%rdx
+  801009:	75 f3                	jne    800ffe <memset+0x55>
+  80100b:	eb e2                	jmp    800fef <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80100d:	40 f6 c7 01          	test   $0x1,%dil
+  801011:	74 06                	je     801019 <memset+0x70>
+  801013:	88 07                	mov    %al,(%rdi)
+  801015:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801019:	40 f6 c7 02          	test   $0x2,%dil
+  80101d:	74 07                	je     801026 <memset+0x7d>
+  80101f:	66 89 07             	mov    %ax,(%rdi)
+  801022:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801026:	40 f6 c7 04          	test   $0x4,%dil
+  80102a:	74 a9                	je     800fd5 <memset+0x2c>
+  80102c:	89 07                	mov    %eax,(%rdi)
+  80102e:	48 83 c7 04          	add    $0x4,%rdi
+  801032:	eb a1                	jmp    800fd5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801034:	41 f6 c1 04          	test   $0x4,%r9b
+  801038:	74 06                	je     801040 <memset+0x97>
+  80103a:	89 07                	mov    %eax,(%rdi)
+  80103c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801040:	41 f6 c1 02          	test   $0x2,%r9b
+  801044:	74 07                	je     80104d <memset+0xa4>
+  801046:	66 89 07             	mov    %ax,(%rdi)
+  801049:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80104d:	41 f6 c1 01          	test   $0x1,%r9b
+  801051:	74 9c                	je     800fef <memset+0x46>
+  801053:	88 07                	mov    %al,(%rdi)
+  801055:	eb 98                	jmp    800fef <memset+0x46>
+
+0000000000801057 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801057:	48 89 f8             	mov    %rdi,%rax
+  80105a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80105d:	48 39 fe             	cmp    %rdi,%rsi
+  801060:	73 3b                	jae    80109d <memmove+0x46>
+  801062:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801066:	48 39 d7             	cmp    %rdx,%rdi
+  801069:	73 32                	jae    80109d <memmove+0x46>
+        s += n;
+        d += n;
+  80106b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80106f:	48 89 d6             	mov    %rdx,%rsi
+  801072:	48 09 fe             	or     %rdi,%rsi
+  801075:	48 09 ce             	or     %rcx,%rsi
+  801078:	40 f6 c6 07          	test   $0x7,%sil
+  80107c:	75 12                	jne    801090 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80107e:	48 83 ef 08          	sub    $0x8,%rdi
+  801082:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801086:	48 c1 e9 03          	shr    $0x3,%rcx
+  80108a:	fd                   	std
+  80108b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80108e:	fc                   	cld
+  80108f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801090:	48 83 ef 01          	sub    $0x1,%rdi
+  801094:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801098:	fd                   	std
+  801099:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80109b:	eb f1                	jmp    80108e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80109d:	48 89 f2             	mov    %rsi,%rdx
+  8010a0:	48 09 c2             	or     %rax,%rdx
+  8010a3:	48 09 ca             	or     %rcx,%rdx
+  8010a6:	f6 c2 07             	test   $0x7,%dl
+  8010a9:	75 0c                	jne    8010b7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010ab:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010af:	48 89 c7             	mov    %rax,%rdi
+  8010b2:	fc                   	cld
+  8010b3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010b6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010b7:	48 89 c7             	mov    %rax,%rdi
+  8010ba:	fc                   	cld
+  8010bb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010bd:	c3                   	ret
+
+00000000008010be <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010be:	55                   	push   %rbp
+  8010bf:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010c2:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  8010c9:	00 00 00 
+  8010cc:	ff d0                	call   *%rax
+}
+  8010ce:	5d                   	pop    %rbp
+  8010cf:	c3                   	ret
+
+00000000008010d0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010d0:	55                   	push   %rbp
+  8010d1:	48 89 e5             	mov    %rsp,%rbp
+  8010d4:	41 57                	push   %r15
+  8010d6:	41 56                	push   %r14
+  8010d8:	41 55                	push   %r13
+  8010da:	41 54                	push   %r12
+  8010dc:	53                   	push   %rbx
+  8010dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e1:	49 89 fe             	mov    %rdi,%r14
+  8010e4:	49 89 f7             	mov    %rsi,%r15
+  8010e7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010ea:	48 89 f7             	mov    %rsi,%rdi
+  8010ed:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  8010f4:	00 00 00 
+  8010f7:	ff d0                	call   *%rax
+  8010f9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010fc:	48 89 de             	mov    %rbx,%rsi
+  8010ff:	4c 89 f7             	mov    %r14,%rdi
+  801102:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  801109:	00 00 00 
+  80110c:	ff d0                	call   *%rax
+  80110e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801111:	48 39 c3             	cmp    %rax,%rbx
+  801114:	74 36                	je     80114c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801116:	48 89 d8             	mov    %rbx,%rax
+  801119:	4c 29 e8             	sub    %r13,%rax
+  80111c:	49 39 c4             	cmp    %rax,%r12
+  80111f:	73 31                	jae    801152 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801121:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801126:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80112a:	4c 89 fe             	mov    %r15,%rsi
+  80112d:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  801134:	00 00 00 
+  801137:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801139:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80113d:	48 83 c4 08          	add    $0x8,%rsp
+  801141:	5b                   	pop    %rbx
+  801142:	41 5c                	pop    %r12
+  801144:	41 5d                	pop    %r13
+  801146:	41 5e                	pop    %r14
+  801148:	41 5f                	pop    %r15
+  80114a:	5d                   	pop    %rbp
+  80114b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80114c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801150:	eb eb                	jmp    80113d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801152:	48 83 eb 01          	sub    $0x1,%rbx
+  801156:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80115a:	48 89 da             	mov    %rbx,%rdx
+  80115d:	4c 89 fe             	mov    %r15,%rsi
+  801160:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  801167:	00 00 00 
+  80116a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80116c:	49 01 de             	add    %rbx,%r14
+  80116f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801174:	eb c3                	jmp    801139 <strlcat+0x69>
+
+0000000000801176 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801176:	48 85 d2             	test   %rdx,%rdx
+  801179:	74 2d                	je     8011a8 <memcmp+0x32>
+  80117b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801180:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801184:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801189:	44 38 c1             	cmp    %r8b,%cl
+  80118c:	75 0f                	jne    80119d <memcmp+0x27>
+    while (n-- > 0) {
+  80118e:	48 83 c0 01          	add    $0x1,%rax
+  801192:	48 39 c2             	cmp    %rax,%rdx
+  801195:	75 e9                	jne    801180 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80119d:	0f b6 c1             	movzbl %cl,%eax
+  8011a0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011a4:	44 29 c0             	sub    %r8d,%eax
+  8011a7:	c3                   	ret
+    return 0;
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ad:	c3                   	ret
+
+00000000008011ae <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011ae:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011b2:	48 39 c7             	cmp    %rax,%rdi
+  8011b5:	73 0f                	jae    8011c6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011b7:	40 38 37             	cmp    %sil,(%rdi)
+  8011ba:	74 0e                	je     8011ca <memfind+0x1c>
+    for (; src < end; src++) {
+  8011bc:	48 83 c7 01          	add    $0x1,%rdi
+  8011c0:	48 39 f8             	cmp    %rdi,%rax
+  8011c3:	75 f2                	jne    8011b7 <memfind+0x9>
+  8011c5:	c3                   	ret
+  8011c6:	48 89 f8             	mov    %rdi,%rax
+  8011c9:	c3                   	ret
+  8011ca:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011cd:	c3                   	ret
+
+00000000008011ce <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011ce:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011d1:	0f b6 37             	movzbl (%rdi),%esi
+  8011d4:	40 80 fe 20          	cmp    $0x20,%sil
+  8011d8:	74 06                	je     8011e0 <strtol+0x12>
+  8011da:	40 80 fe 09          	cmp    $0x9,%sil
+  8011de:	75 13                	jne    8011f3 <strtol+0x25>
+  8011e0:	48 83 c7 01          	add    $0x1,%rdi
+  8011e4:	0f b6 37             	movzbl (%rdi),%esi
+  8011e7:	40 80 fe 20          	cmp    $0x20,%sil
+  8011eb:	74 f3                	je     8011e0 <strtol+0x12>
+  8011ed:	40 80 fe 09          	cmp    $0x9,%sil
+  8011f1:	74 ed                	je     8011e0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011f3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011f6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011f9:	3c 01                	cmp    $0x1,%al
+  8011fb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011ff:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801205:	75 0f                	jne    801216 <strtol+0x48>
+  801207:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80120a:	74 14                	je     801220 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80120c:	85 d2                	test   %edx,%edx
+  80120e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801213:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801216:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80121b:	4c 63 ca             	movslq %edx,%r9
+  80121e:	eb 36                	jmp    801256 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801220:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801224:	74 0f                	je     801235 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801226:	85 d2                	test   %edx,%edx
+  801228:	75 ec                	jne    801216 <strtol+0x48>
+        s++;
+  80122a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80122e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801233:	eb e1                	jmp    801216 <strtol+0x48>
+        s += 2;
+  801235:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801239:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80123e:	eb d6                	jmp    801216 <strtol+0x48>
+            dig -= '0';
+  801240:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801243:	44 0f b6 c1          	movzbl %cl,%r8d
+  801247:	41 39 d0             	cmp    %edx,%r8d
+  80124a:	7d 21                	jge    80126d <strtol+0x9f>
+        val = val * base + dig;
+  80124c:	49 0f af c1          	imul   %r9,%rax
+  801250:	0f b6 c9             	movzbl %cl,%ecx
+  801253:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801256:	48 83 c7 01          	add    $0x1,%rdi
+  80125a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80125e:	80 f9 39             	cmp    $0x39,%cl
+  801261:	76 dd                	jbe    801240 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801263:	80 f9 7b             	cmp    $0x7b,%cl
+  801266:	77 05                	ja     80126d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801268:	83 e9 57             	sub    $0x57,%ecx
+  80126b:	eb d6                	jmp    801243 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80126d:	4d 85 d2             	test   %r10,%r10
+  801270:	74 03                	je     801275 <strtol+0xa7>
+  801272:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801275:	48 89 c2             	mov    %rax,%rdx
+  801278:	48 f7 da             	neg    %rdx
+  80127b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80127f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801283:	c3                   	ret
+
+0000000000801284 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801284:	55                   	push   %rbp
+  801285:	48 89 e5             	mov    %rsp,%rbp
+  801288:	53                   	push   %rbx
+  801289:	48 89 fa             	mov    %rdi,%rdx
+  80128c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80128f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801294:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801299:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+
+00000000008012b1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012da:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+00000000008012e2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	53                   	push   %rbx
+  8012e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ee:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801302:	be 00 00 00 00       	mov    $0x0,%esi
+  801307:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130f:	48 85 c0             	test   %rax,%rax
+  801312:	7f 06                	jg     80131a <sys_env_destroy+0x38>
+}
+  801314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801318:	c9                   	leave
+  801319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131a:	49 89 c0             	mov    %rax,%r8
+  80131d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801322:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801329:	00 00 00 
+  80132c:	be 26 00 00 00       	mov    $0x26,%esi
+  801331:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801338:	00 00 00 
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  801347:	00 00 00 
+  80134a:	41 ff d1             	call   *%r9
+
+000000000080134d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80134d:	55                   	push   %rbp
+  80134e:	48 89 e5             	mov    %rsp,%rbp
+  801351:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801352:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801357:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801366:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136b:	be 00 00 00 00       	mov    $0x0,%esi
+  801370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801376:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+
+000000000080137e <sys_yield>:
+
+void
+sys_yield(void) {
+  80137e:	55                   	push   %rbp
+  80137f:	48 89 e5             	mov    %rsp,%rbp
+  801382:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801383:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801388:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ad:	c9                   	leave
+  8013ae:	c3                   	ret
+
+00000000008013af <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013af:	55                   	push   %rbp
+  8013b0:	48 89 e5             	mov    %rsp,%rbp
+  8013b3:	53                   	push   %rbx
+  8013b4:	48 89 fa             	mov    %rdi,%rdx
+  8013b7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ba:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013bf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013c6:	00 00 00 
+  8013c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+
+00000000008013e1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013e1:	55                   	push   %rbp
+  8013e2:	48 89 e5             	mov    %rsp,%rbp
+  8013e5:	53                   	push   %rbx
+  8013e6:	49 89 f8             	mov    %rdi,%r8
+  8013e9:	48 89 d3             	mov    %rdx,%rbx
+  8013ec:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ef:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f4:	4c 89 c2             	mov    %r8,%rdx
+  8013f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801405:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801407:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140b:	c9                   	leave
+  80140c:	c3                   	ret
+
+000000000080140d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80140d:	55                   	push   %rbp
+  80140e:	48 89 e5             	mov    %rsp,%rbp
+  801411:	53                   	push   %rbx
+  801412:	48 83 ec 08          	sub    $0x8,%rsp
+  801416:	89 f8                	mov    %edi,%eax
+  801418:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80141b:	48 63 f9             	movslq %ecx,%rdi
+  80141e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801421:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801426:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801429:	be 00 00 00 00       	mov    $0x0,%esi
+  80142e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801434:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801436:	48 85 c0             	test   %rax,%rax
+  801439:	7f 06                	jg     801441 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80143b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143f:	c9                   	leave
+  801440:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801441:	49 89 c0             	mov    %rax,%r8
+  801444:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801449:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801450:	00 00 00 
+  801453:	be 26 00 00 00       	mov    $0x26,%esi
+  801458:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80145f:	00 00 00 
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+  801467:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  80146e:	00 00 00 
+  801471:	41 ff d1             	call   *%r9
+
+0000000000801474 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801474:	55                   	push   %rbp
+  801475:	48 89 e5             	mov    %rsp,%rbp
+  801478:	53                   	push   %rbx
+  801479:	48 83 ec 08          	sub    $0x8,%rsp
+  80147d:	89 f8                	mov    %edi,%eax
+  80147f:	49 89 f2             	mov    %rsi,%r10
+  801482:	48 89 cf             	mov    %rcx,%rdi
+  801485:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801488:	48 63 da             	movslq %edx,%rbx
+  80148b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801493:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801496:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801499:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149b:	48 85 c0             	test   %rax,%rax
+  80149e:	7f 06                	jg     8014a6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a6:	49 89 c0             	mov    %rax,%r8
+  8014a9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014ae:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8014b5:	00 00 00 
+  8014b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bd:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8014c4:	00 00 00 
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cc:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  8014d3:	00 00 00 
+  8014d6:	41 ff d1             	call   *%r9
+
+00000000008014d9 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014d9:	55                   	push   %rbp
+  8014da:	48 89 e5             	mov    %rsp,%rbp
+  8014dd:	53                   	push   %rbx
+  8014de:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e2:	49 89 f9             	mov    %rdi,%r9
+  8014e5:	89 f0                	mov    %esi,%eax
+  8014e7:	48 89 d3             	mov    %rdx,%rbx
+  8014ea:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014ed:	49 63 f0             	movslq %r8d,%rsi
+  8014f0:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f8:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	7f 06                	jg     80150e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150c:	c9                   	leave
+  80150d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150e:	49 89 c0             	mov    %rax,%r8
+  801511:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801516:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80151d:	00 00 00 
+  801520:	be 26 00 00 00       	mov    $0x26,%esi
+  801525:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  80153b:	00 00 00 
+  80153e:	41 ff d1             	call   *%r9
+
+0000000000801541 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+  801546:	48 83 ec 08          	sub    $0x8,%rsp
+  80154a:	48 89 f1             	mov    %rsi,%rcx
+  80154d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801550:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801553:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801558:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155d:	be 00 00 00 00       	mov    $0x0,%esi
+  801562:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801568:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156a:	48 85 c0             	test   %rax,%rax
+  80156d:	7f 06                	jg     801575 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80156f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801575:	49 89 c0             	mov    %rax,%r8
+  801578:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80157d:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801584:	00 00 00 
+  801587:	be 26 00 00 00       	mov    $0x26,%esi
+  80158c:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801593:	00 00 00 
+  801596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159b:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  8015a2:	00 00 00 
+  8015a5:	41 ff d1             	call   *%r9
+
+00000000008015a8 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8015a8:	55                   	push   %rbp
+  8015a9:	48 89 e5             	mov    %rsp,%rbp
+  8015ac:	53                   	push   %rbx
+  8015ad:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cf:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8015d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+00000000008015d7 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	53                   	push   %rbx
+  8015dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8015e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801600:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801602:	48 85 c0             	test   %rax,%rax
+  801605:	7f 06                	jg     80160d <sys_env_set_tls+0x36>
+}
+  801607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160d:	49 89 c0             	mov    %rax,%r8
+  801610:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801615:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  80161c:	00 00 00 
+  80161f:	be 26 00 00 00       	mov    $0x26,%esi
+  801624:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  80162b:	00 00 00 
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  80163a:	00 00 00 
+  80163d:	41 ff d1             	call   *%r9
+
+0000000000801640 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801640:	55                   	push   %rbp
+  801641:	48 89 e5             	mov    %rsp,%rbp
+  801644:	53                   	push   %rbx
+  801645:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801649:	48 63 ce             	movslq %esi,%rcx
+  80164c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165e:	be 00 00 00 00       	mov    $0x0,%esi
+  801663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801669:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166b:	48 85 c0             	test   %rax,%rax
+  80166e:	7f 06                	jg     801676 <sys_env_set_status+0x36>
+}
+  801670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801676:	49 89 c0             	mov    %rax,%r8
+  801679:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80167e:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801685:	00 00 00 
+  801688:	be 26 00 00 00       	mov    $0x26,%esi
+  80168d:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801694:	00 00 00 
+  801697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169c:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  8016a3:	00 00 00 
+  8016a6:	41 ff d1             	call   *%r9
+
+00000000008016a9 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8016a9:	55                   	push   %rbp
+  8016aa:	48 89 e5             	mov    %rsp,%rbp
+  8016ad:	53                   	push   %rbx
+  8016ae:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8016b2:	48 63 da             	movslq %edx,%rbx
+  8016b5:	48 63 ce             	movslq %esi,%rcx
+  8016b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d2:	48 85 c0             	test   %rax,%rax
+  8016d5:	7f 06                	jg     8016dd <sys_env_set_priority+0x34>
+}
+  8016d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016db:	c9                   	leave
+  8016dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dd:	49 89 c0             	mov    %rax,%r8
+  8016e0:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016e5:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8016ec:	00 00 00 
+  8016ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f4:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  80170a:	00 00 00 
+  80170d:	41 ff d1             	call   *%r9
+
+0000000000801710 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	53                   	push   %rbx
+  801715:	48 83 ec 08          	sub    $0x8,%rsp
+  801719:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80171c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80171f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801724:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801729:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172e:	be 00 00 00 00       	mov    $0x0,%esi
+  801733:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801739:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173b:	48 85 c0             	test   %rax,%rax
+  80173e:	7f 06                	jg     801746 <sys_env_set_trapframe+0x36>
+}
+  801740:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801744:	c9                   	leave
+  801745:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801746:	49 89 c0             	mov    %rax,%r8
+  801749:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80174e:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801755:	00 00 00 
+  801758:	be 26 00 00 00       	mov    $0x26,%esi
+  80175d:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  801764:	00 00 00 
+  801767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176c:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  801773:	00 00 00 
+  801776:	41 ff d1             	call   *%r9
+
+0000000000801779 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801779:	55                   	push   %rbp
+  80177a:	48 89 e5             	mov    %rsp,%rbp
+  80177d:	53                   	push   %rbx
+  80177e:	48 83 ec 08          	sub    $0x8,%rsp
+  801782:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801785:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801788:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801792:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801797:	be 00 00 00 00       	mov    $0x0,%esi
+  80179c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a4:	48 85 c0             	test   %rax,%rax
+  8017a7:	7f 06                	jg     8017af <sys_env_set_pgfault_upcall+0x36>
+}
+  8017a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ad:	c9                   	leave
+  8017ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017af:	49 89 c0             	mov    %rax,%r8
+  8017b2:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017b7:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8017be:	00 00 00 
+  8017c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c6:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8017cd:	00 00 00 
+  8017d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d5:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  8017dc:	00 00 00 
+  8017df:	41 ff d1             	call   *%r9
+
+00000000008017e2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+  8017e6:	53                   	push   %rbx
+  8017e7:	89 f8                	mov    %edi,%eax
+  8017e9:	49 89 f1             	mov    %rsi,%r9
+  8017ec:	48 89 d3             	mov    %rdx,%rbx
+  8017ef:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017f2:	49 63 f0             	movslq %r8d,%rsi
+  8017f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017fd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801800:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801806:	cd 30                	int    $0x30
+}
+  801808:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180c:	c9                   	leave
+  80180d:	c3                   	ret
+
+000000000080180e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  80180e:	55                   	push   %rbp
+  80180f:	48 89 e5             	mov    %rsp,%rbp
+  801812:	41 55                	push   %r13
+  801814:	41 54                	push   %r12
+  801816:	53                   	push   %rbx
+  801817:	89 f8                	mov    %edi,%eax
+  801819:	49 89 f2             	mov    %rsi,%r10
+  80181c:	48 89 d3             	mov    %rdx,%rbx
+  80181f:	48 89 cf             	mov    %rcx,%rdi
+  801822:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801825:	49 63 f0             	movslq %r8d,%rsi
+  801828:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80182b:	4d 85 c9             	test   %r9,%r9
+  80182e:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801835:	00 00 00 
+  801838:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80183c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801841:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801844:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80184a:	4d 8b 0b             	mov    (%r11),%r9
+  80184d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801851:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801855:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801859:	cd 30                	int    $0x30
+}
+  80185b:	5b                   	pop    %rbx
+  80185c:	41 5c                	pop    %r12
+  80185e:	41 5d                	pop    %r13
+  801860:	5d                   	pop    %rbp
+  801861:	c3                   	ret
+
+0000000000801862 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	53                   	push   %rbx
+  801867:	48 89 fa             	mov    %rdi,%rdx
+  80186a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80186d:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801877:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187c:	be 00 00 00 00       	mov    $0x0,%esi
+  801881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801889:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+
+000000000080188f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	53                   	push   %rbx
+  801894:	48 83 ec 08          	sub    $0x8,%rsp
+  801898:	48 89 fa             	mov    %rdi,%rdx
+  80189b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80189e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ba:	48 85 c0             	test   %rax,%rax
+  8018bd:	7f 06                	jg     8018c5 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c3:	c9                   	leave
+  8018c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c5:	49 89 c0             	mov    %rax,%r8
+  8018c8:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8018cd:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8018d4:	00 00 00 
+  8018d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018dc:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8018e3:	00 00 00 
+  8018e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018eb:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  8018f2:	00 00 00 
+  8018f5:	41 ff d1             	call   *%r9
+
+00000000008018f8 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	41 55                	push   %r13
+  8018fe:	41 54                	push   %r12
+  801900:	53                   	push   %rbx
+  801901:	89 f8                	mov    %edi,%eax
+  801903:	49 89 f2             	mov    %rsi,%r10
+  801906:	48 89 d3             	mov    %rdx,%rbx
+  801909:	48 89 cf             	mov    %rcx,%rdi
+  80190c:	44 89 c6             	mov    %r8d,%esi
+  80190f:	4d 89 c8             	mov    %r9,%r8
+  801912:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801916:	48 63 f6             	movslq %esi,%rsi
+  801919:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80191c:	4d 85 db             	test   %r11,%r11
+  80191f:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801926:	00 00 00 
+  801929:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  80192d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801932:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801935:	4d 8b 0b             	mov    (%r11),%r9
+  801938:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  80193c:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801940:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801944:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801946:	5b                   	pop    %rbx
+  801947:	41 5c                	pop    %r12
+  801949:	41 5d                	pop    %r13
+  80194b:	5d                   	pop    %rbp
+  80194c:	c3                   	ret
+
+000000000080194d <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80194d:	55                   	push   %rbp
+  80194e:	48 89 e5             	mov    %rsp,%rbp
+  801951:	41 55                	push   %r13
+  801953:	41 54                	push   %r12
+  801955:	53                   	push   %rbx
+  801956:	89 f8                	mov    %edi,%eax
+  801958:	49 89 f2             	mov    %rsi,%r10
+  80195b:	48 89 d3             	mov    %rdx,%rbx
+  80195e:	48 89 cf             	mov    %rcx,%rdi
+  801961:	44 89 c6             	mov    %r8d,%esi
+  801964:	4d 89 c8             	mov    %r9,%r8
+  801967:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80196b:	48 63 f6             	movslq %esi,%rsi
+  80196e:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801971:	4d 85 db             	test   %r11,%r11
+  801974:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  80197b:	00 00 00 
+  80197e:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801982:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801987:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80198a:	4d 8b 0b             	mov    (%r11),%r9
+  80198d:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801991:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801995:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801999:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80199b:	5b                   	pop    %rbx
+  80199c:	41 5c                	pop    %r12
+  80199e:	41 5d                	pop    %r13
+  8019a0:	5d                   	pop    %rbp
+  8019a1:	c3                   	ret
+
+00000000008019a2 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8019a2:	55                   	push   %rbp
+  8019a3:	48 89 e5             	mov    %rsp,%rbp
+  8019a6:	53                   	push   %rbx
+  8019a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ab:	48 89 f1             	mov    %rsi,%rcx
+  8019ae:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b6:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019be:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019cb:	48 85 c0             	test   %rax,%rax
+  8019ce:	7f 06                	jg     8019d6 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d4:	c9                   	leave
+  8019d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019d6:	49 89 c0             	mov    %rax,%r8
+  8019d9:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019de:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  8019e5:	00 00 00 
+  8019e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ed:	48 bf 77 56 80 00 00 	movabs $0x805677,%rdi
+  8019f4:	00 00 00 
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fc:	49 b9 e8 03 80 00 00 	movabs $0x8003e8,%r9
+  801a03:	00 00 00 
+  801a06:	41 ff d1             	call   *%r9
+
+0000000000801a09 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a09:	55                   	push   %rbp
+  801a0a:	48 89 e5             	mov    %rsp,%rbp
+  801a0d:	53                   	push   %rbx
+  801a0e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a11:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a16:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a25:	be 00 00 00 00       	mov    $0x0,%esi
+  801a2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a30:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801a32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+
+0000000000801a38 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801a40:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a42:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a51:	be 00 00 00 00       	mov    $0x0,%esi
+  801a56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a5c:	cd 30                	int    $0x30
+}
+  801a5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+
+0000000000801a64 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	53                   	push   %rbx
+  801a69:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a6c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a79:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a89:	cd 30                	int    $0x30
+}
+  801a8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8f:	c9                   	leave
+  801a90:	c3                   	ret
+
+0000000000801a91 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801a91:	55                   	push   %rbp
+  801a92:	48 89 e5             	mov    %rsp,%rbp
+  801a95:	53                   	push   %rbx
+  801a96:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801a99:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a9b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aa0:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa8:	be 00 00 00 00       	mov    $0x0,%esi
+  801aad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab3:	cd 30                	int    $0x30
+}
+  801ab5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab9:	c9                   	leave
+  801aba:	c3                   	ret
+
+0000000000801abb <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	53                   	push   %rbx
+  801ac0:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801ac3:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801acb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad5:	be 00 00 00 00       	mov    $0x0,%esi
+  801ada:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae0:	cd 30                	int    $0x30
+}
+  801ae2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae6:	c9                   	leave
+  801ae7:	c3                   	ret
+
+0000000000801ae8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801ae8:	55                   	push   %rbp
+  801ae9:	48 89 e5             	mov    %rsp,%rbp
+  801aec:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801aed:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801af2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801afc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b01:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b06:	be 00 00 00 00       	mov    $0x0,%esi
+  801b0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b11:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b17:	c9                   	leave
+  801b18:	c3                   	ret
+
+0000000000801b19 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b19:	55                   	push   %rbp
+  801b1a:	48 89 e5             	mov    %rsp,%rbp
+  801b1d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b1e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b28:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b37:	be 00 00 00 00       	mov    $0x0,%esi
+  801b3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b42:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b48:	c9                   	leave
+  801b49:	c3                   	ret
+
+0000000000801b4a <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 55                	push   %r13
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	48 83 ec 08          	sub    $0x8,%rsp
+  801b57:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801b5a:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801b5d:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+  801b69:	41 89 c5             	mov    %eax,%r13d
+  801b6c:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801b70:	a8 40                	test   $0x40,%al
+  801b72:	75 31                	jne    801ba5 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801b74:	a8 02                	test   $0x2,%al
+  801b76:	74 5f                	je     801bd7 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b78:	45 89 e9             	mov    %r13d,%r9d
+  801b7b:	41 83 c9 40          	or     $0x40,%r9d
+  801b7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b85:	48 89 d9             	mov    %rbx,%rcx
+  801b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8d:	48 89 de             	mov    %rbx,%rsi
+  801b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b95:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 27                	js     801bcc <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801ba5:	45 89 e9             	mov    %r13d,%r9d
+  801ba8:	41 83 c9 40          	or     $0x40,%r9d
+  801bac:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bb2:	48 89 d9             	mov    %rbx,%rcx
+  801bb5:	44 89 e2             	mov    %r12d,%edx
+  801bb8:	48 89 de             	mov    %rbx,%rsi
+  801bbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc0:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  801bc7:	00 00 00 
+  801bca:	ff d0                	call   *%rax
+}
+  801bcc:	48 83 c4 08          	add    $0x8,%rsp
+  801bd0:	5b                   	pop    %rbx
+  801bd1:	41 5c                	pop    %r12
+  801bd3:	41 5d                	pop    %r13
+  801bd5:	5d                   	pop    %rbp
+  801bd6:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801bd7:	83 e0 01             	and    $0x1,%eax
+  801bda:	83 c8 06             	or     $0x6,%eax
+  801bdd:	41 89 c1             	mov    %eax,%r9d
+  801be0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be6:	48 89 d9             	mov    %rbx,%rcx
+  801be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bee:	48 89 de             	mov    %rbx,%rsi
+  801bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf6:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	0f 85 6e ff ff ff    	jne    801b78 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801c0a:	48 89 df             	mov    %rbx,%rdi
+  801c0d:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	83 e0 5f             	and    $0x5f,%eax
+  801c1c:	41 89 c5             	mov    %eax,%r13d
+  801c1f:	e9 54 ff ff ff       	jmp    801b78 <sfork_page+0x2e>
+
+0000000000801c24 <fork>:
+fork(void) {
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	41 54                	push   %r12
+  801c2a:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801c2b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c30:	cd 30                	int    $0x30
+  801c32:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	0f 88 81 00 00 00    	js     801cbe <fork+0x9a>
+    if (envid == CURENVID) {
+  801c3d:	0f 84 83 00 00 00    	je     801cc6 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801c43:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c49:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801c50:	00 00 00 
+  801c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c58:	89 c2                	mov    %eax,%edx
+  801c5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c64:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  801c6b:	00 00 00 
+  801c6e:	ff d0                	call   *%rax
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	0f 85 82 00 00 00    	jne    801cfa <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801c78:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c7f:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801c81:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c85:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801c8c:	44 89 e7             	mov    %r12d,%edi
+  801c8f:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	75 63                	jne    801d02 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801c9f:	be 02 00 00 00       	mov    $0x2,%esi
+  801ca4:	44 89 e7             	mov    %r12d,%edi
+  801ca7:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+        return -1;
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801cba:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801cbe:	44 89 e0             	mov    %r12d,%eax
+  801cc1:	5b                   	pop    %rbx
+  801cc2:	41 5c                	pop    %r12
+  801cc4:	5d                   	pop    %rbp
+  801cc5:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801cc6:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801cd9:	00 00 
+  801cdb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ce0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801ce7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801cee:	00 00 00 
+  801cf1:	48 01 c8             	add    %rcx,%rax
+  801cf4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801cf8:	eb c4                	jmp    801cbe <fork+0x9a>
+        return -1;
+  801cfa:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d00:	eb bc                	jmp    801cbe <fork+0x9a>
+  801d02:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801d08:	eb b4                	jmp    801cbe <fork+0x9a>
+
+0000000000801d0a <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801d0a:	55                   	push   %rbp
+  801d0b:	48 89 e5             	mov    %rsp,%rbp
+  801d0e:	53                   	push   %rbx
+  801d0f:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801d13:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d18:	cd 30                	int    $0x30
+  801d1a:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801d1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 40                	js     801d63 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801d23:	74 46                	je     801d6b <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801d25:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801d29:	48 ba 4a 1b 80 00 00 	movabs $0x801b4a,%rdx
+  801d30:	00 00 00 
+  801d33:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801d3a:	00 00 00 
+  801d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d42:	48 b8 67 3b 80 00 00 	movabs $0x803b67,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	79 4b                	jns    801d9f <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801d54:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d57:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801d5e:	00 00 00 
+  801d61:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801d63:	89 d8                	mov    %ebx,%eax
+  801d65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d6b:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  801d72:	00 00 00 
+  801d75:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801d77:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d7e:	00 00 
+  801d80:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d85:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d8c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d93:	00 00 00 
+  801d96:	48 01 c8             	add    %rcx,%rax
+  801d99:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d9d:	eb c4                	jmp    801d63 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d9f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801da5:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801dab:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801db2:	00 00 00 
+  801db5:	48 89 f1             	mov    %rsi,%rcx
+  801db8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801dbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc0:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 82                	js     801d54 <sfork+0x4a>
+  801dd2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801dd9:	00 00 
+  801ddb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ddf:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801de6:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801de9:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+  801df5:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	0f 88 55 ff ff ff    	js     801d54 <sfork+0x4a>
+  801dff:	be 02 00 00 00       	mov    $0x2,%esi
+  801e04:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801e07:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  801e0e:	00 00 00 
+  801e11:	ff d0                	call   *%rax
+  801e13:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	0f 88 37 ff ff ff    	js     801d54 <sfork+0x4a>
+    return envid;
+  801e1d:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801e20:	e9 3e ff ff ff       	jmp    801d63 <sfork+0x59>
+
+0000000000801e25 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e25:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e2c:	ff ff ff 
+  801e2f:	48 01 f8             	add    %rdi,%rax
+  801e32:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e36:	c3                   	ret
+
+0000000000801e37 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e37:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e3e:	ff ff ff 
+  801e41:	48 01 f8             	add    %rdi,%rax
+  801e44:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e48:	48 c1 e0 12          	shl    $0x12,%rax
+  801e4c:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801e51:	48 01 d0             	add    %rdx,%rax
+}
+  801e54:	c3                   	ret
+
+0000000000801e55 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e55:	55                   	push   %rbp
+  801e56:	48 89 e5             	mov    %rsp,%rbp
+  801e59:	41 57                	push   %r15
+  801e5b:	41 56                	push   %r14
+  801e5d:	41 55                	push   %r13
+  801e5f:	41 54                	push   %r12
+  801e61:	53                   	push   %rbx
+  801e62:	48 83 ec 08          	sub    $0x8,%rsp
+  801e66:	49 89 ff             	mov    %rdi,%r15
+  801e69:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e6e:	49 bd f3 3a 80 00 00 	movabs $0x803af3,%r13
+  801e75:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e78:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e7e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e81:	48 89 df             	mov    %rbx,%rdi
+  801e84:	41 ff d5             	call   *%r13
+  801e87:	83 e0 04             	and    $0x4,%eax
+  801e8a:	74 17                	je     801ea3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e8c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e93:	4c 39 f3             	cmp    %r14,%rbx
+  801e96:	75 e6                	jne    801e7e <fd_alloc+0x29>
+  801e98:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e9e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ea3:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ea6:	48 83 c4 08          	add    $0x8,%rsp
+  801eaa:	5b                   	pop    %rbx
+  801eab:	41 5c                	pop    %r12
+  801ead:	41 5d                	pop    %r13
+  801eaf:	41 5e                	pop    %r14
+  801eb1:	41 5f                	pop    %r15
+  801eb3:	5d                   	pop    %rbp
+  801eb4:	c3                   	ret
+
+0000000000801eb5 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801eb5:	83 ff 1f             	cmp    $0x1f,%edi
+  801eb8:	77 39                	ja     801ef3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	41 54                	push   %r12
+  801ec0:	53                   	push   %rbx
+  801ec1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ec4:	48 63 df             	movslq %edi,%rbx
+  801ec7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ece:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ed2:	48 89 df             	mov    %rbx,%rdi
+  801ed5:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+  801ee1:	a8 04                	test   $0x4,%al
+  801ee3:	74 14                	je     801ef9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ee5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eee:	5b                   	pop    %rbx
+  801eef:	41 5c                	pop    %r12
+  801ef1:	5d                   	pop    %rbp
+  801ef2:	c3                   	ret
+        return -E_INVAL;
+  801ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ef8:	c3                   	ret
+        return -E_INVAL;
+  801ef9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efe:	eb ee                	jmp    801eee <fd_lookup+0x39>
+
+0000000000801f00 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 54                	push   %r12
+  801f06:	53                   	push   %rbx
+  801f07:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f0a:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  801f11:	00 00 00 
+  801f14:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f1b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f1e:	39 3b                	cmp    %edi,(%rbx)
+  801f20:	74 4a                	je     801f6c <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f22:	48 83 c0 08          	add    $0x8,%rax
+  801f26:	48 8b 18             	mov    (%rax),%rbx
+  801f29:	48 85 db             	test   %rbx,%rbx
+  801f2c:	75 f0                	jne    801f1e <dev_lookup+0x1e>
+  801f2e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f35:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f37:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f41:	89 fa                	mov    %edi,%edx
+  801f43:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  801f4a:	00 00 00 
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f52:	48 b9 38 05 80 00 00 	movabs $0x800538,%rcx
+  801f59:	00 00 00 
+  801f5c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f63:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f67:	5b                   	pop    %rbx
+  801f68:	41 5c                	pop    %r12
+  801f6a:	5d                   	pop    %rbp
+  801f6b:	c3                   	ret
+            return 0;
+  801f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f71:	eb f0                	jmp    801f63 <dev_lookup+0x63>
+
+0000000000801f73 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f73:	55                   	push   %rbp
+  801f74:	48 89 e5             	mov    %rsp,%rbp
+  801f77:	41 55                	push   %r13
+  801f79:	41 54                	push   %r12
+  801f7b:	53                   	push   %rbx
+  801f7c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f80:	48 89 fb             	mov    %rdi,%rbx
+  801f83:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f86:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f8d:	ff ff ff 
+  801f90:	48 01 df             	add    %rbx,%rdi
+  801f93:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f97:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f9b:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  801fa2:	00 00 00 
+  801fa5:	ff d0                	call   *%rax
+  801fa7:	41 89 c5             	mov    %eax,%r13d
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 06                	js     801fb4 <fd_close+0x41>
+  801fae:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801fb2:	74 1a                	je     801fce <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801fb4:	45 84 e4             	test   %r12b,%r12b
+  801fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbc:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801fc0:	44 89 e8             	mov    %r13d,%eax
+  801fc3:	48 83 c4 18          	add    $0x18,%rsp
+  801fc7:	5b                   	pop    %rbx
+  801fc8:	41 5c                	pop    %r12
+  801fca:	41 5d                	pop    %r13
+  801fcc:	5d                   	pop    %rbp
+  801fcd:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801fce:	8b 3b                	mov    (%rbx),%edi
+  801fd0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fd4:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+  801fe0:	41 89 c5             	mov    %eax,%r13d
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 1b                	js     802002 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801fe7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801feb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fef:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ff5:	48 85 c0             	test   %rax,%rax
+  801ff8:	74 08                	je     802002 <fd_close+0x8f>
+  801ffa:	48 89 df             	mov    %rbx,%rdi
+  801ffd:	ff d0                	call   *%rax
+  801fff:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802002:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802007:	48 89 de             	mov    %rbx,%rsi
+  80200a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80200f:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+    return res;
+  80201b:	eb a3                	jmp    801fc0 <fd_close+0x4d>
+
+000000000080201d <close>:
+
+int
+close(int fdnum) {
+  80201d:	55                   	push   %rbp
+  80201e:	48 89 e5             	mov    %rsp,%rbp
+  802021:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802025:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802029:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802035:	85 c0                	test   %eax,%eax
+  802037:	78 15                	js     80204e <close+0x31>
+
+    return fd_close(fd, 1);
+  802039:	be 01 00 00 00       	mov    $0x1,%esi
+  80203e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802042:	48 b8 73 1f 80 00 00 	movabs $0x801f73,%rax
+  802049:	00 00 00 
+  80204c:	ff d0                	call   *%rax
+}
+  80204e:	c9                   	leave
+  80204f:	c3                   	ret
+
+0000000000802050 <close_all>:
+
+void
+close_all(void) {
+  802050:	55                   	push   %rbp
+  802051:	48 89 e5             	mov    %rsp,%rbp
+  802054:	41 54                	push   %r12
+  802056:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802057:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205c:	49 bc 1d 20 80 00 00 	movabs $0x80201d,%r12
+  802063:	00 00 00 
+  802066:	89 df                	mov    %ebx,%edi
+  802068:	41 ff d4             	call   *%r12
+  80206b:	83 c3 01             	add    $0x1,%ebx
+  80206e:	83 fb 20             	cmp    $0x20,%ebx
+  802071:	75 f3                	jne    802066 <close_all+0x16>
+}
+  802073:	5b                   	pop    %rbx
+  802074:	41 5c                	pop    %r12
+  802076:	5d                   	pop    %rbp
+  802077:	c3                   	ret
+
+0000000000802078 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802078:	55                   	push   %rbp
+  802079:	48 89 e5             	mov    %rsp,%rbp
+  80207c:	41 57                	push   %r15
+  80207e:	41 56                	push   %r14
+  802080:	41 55                	push   %r13
+  802082:	41 54                	push   %r12
+  802084:	53                   	push   %rbx
+  802085:	48 83 ec 38          	sub    $0x38,%rsp
+  802089:	41 89 f7             	mov    %esi,%r15d
+  80208c:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80208f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802093:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+  80209f:	89 c3                	mov    %eax,%ebx
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	0f 88 ec 00 00 00    	js     802195 <dup+0x11d>
+    close(newfdnum);
+  8020a9:	44 89 ff             	mov    %r15d,%edi
+  8020ac:	48 b8 1d 20 80 00 00 	movabs $0x80201d,%rax
+  8020b3:	00 00 00 
+  8020b6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8020b8:	49 63 c7             	movslq %r15d,%rax
+  8020bb:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8020c1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020c5:	49 89 c6             	mov    %rax,%r14
+  8020c8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  8020cc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020d0:	4c 89 ff             	mov    %r15,%rdi
+  8020d3:	48 bb 37 1e 80 00 00 	movabs $0x801e37,%rbx
+  8020da:	00 00 00 
+  8020dd:	ff d3                	call   *%rbx
+  8020df:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  8020e2:	4c 89 f7             	mov    %r14,%rdi
+  8020e5:	ff d3                	call   *%rbx
+  8020e7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8020eb:	4c 89 e7             	mov    %r12,%rdi
+  8020ee:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8020fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802102:	49 be f3 3a 80 00 00 	movabs $0x803af3,%r14
+  802109:	00 00 00 
+  80210c:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  802110:	41 ff d6             	call   *%r14
+  802113:	44 39 e8             	cmp    %r13d,%eax
+  802116:	75 10                	jne    802128 <dup+0xb0>
+  802118:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80211f:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802126:	75 e4                	jne    80210c <dup+0x94>
+    if (prot & PROT_R) {
+  802128:	41 f6 c5 04          	test   $0x4,%r13b
+  80212c:	74 29                	je     802157 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  80212e:	45 89 e9             	mov    %r13d,%r9d
+  802131:	49 89 d8             	mov    %rbx,%r8
+  802134:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213d:	4c 89 e6             	mov    %r12,%rsi
+  802140:	bf 00 00 00 00       	mov    $0x0,%edi
+  802145:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+  802151:	89 c3                	mov    %eax,%ebx
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 4f                	js     8021a6 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802157:	4c 89 ff             	mov    %r15,%rdi
+  80215a:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  802161:	00 00 00 
+  802164:	ff d0                	call   *%rax
+  802166:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802169:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80216f:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802173:	ba 00 00 00 00       	mov    $0x0,%edx
+  802178:	4c 89 fe             	mov    %r15,%rsi
+  80217b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802180:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	89 c3                	mov    %eax,%ebx
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 14                	js     8021a6 <dup+0x12e>
+
+    return newfdnum;
+  802192:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802195:	89 d8                	mov    %ebx,%eax
+  802197:	48 83 c4 38          	add    $0x38,%rsp
+  80219b:	5b                   	pop    %rbx
+  80219c:	41 5c                	pop    %r12
+  80219e:	41 5d                	pop    %r13
+  8021a0:	41 5e                	pop    %r14
+  8021a2:	41 5f                	pop    %r15
+  8021a4:	5d                   	pop    %rbp
+  8021a5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021ab:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8021af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b4:	49 bc 41 15 80 00 00 	movabs $0x801541,%r12
+  8021bb:	00 00 00 
+  8021be:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8021c1:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8021c6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8021ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021cf:	41 ff d4             	call   *%r12
+    return res;
+  8021d2:	eb c1                	jmp    802195 <dup+0x11d>
+
+00000000008021d4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8021d4:	55                   	push   %rbp
+  8021d5:	48 89 e5             	mov    %rsp,%rbp
+  8021d8:	41 56                	push   %r14
+  8021da:	41 55                	push   %r13
+  8021dc:	41 54                	push   %r12
+  8021de:	53                   	push   %rbx
+  8021df:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e3:	89 fb                	mov    %edi,%ebx
+  8021e5:	49 89 f4             	mov    %rsi,%r12
+  8021e8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021eb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021ef:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	78 4c                	js     80224b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ff:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802203:	41 8b 3e             	mov    (%r14),%edi
+  802206:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80220a:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 35                	js     80224f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80221a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80221e:	83 e0 03             	and    $0x3,%eax
+  802221:	83 f8 01             	cmp    $0x1,%eax
+  802224:	74 2d                	je     802253 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802226:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80222a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80222e:	48 85 c0             	test   %rax,%rax
+  802231:	74 59                	je     80228c <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802233:	4c 89 ea             	mov    %r13,%rdx
+  802236:	4c 89 e6             	mov    %r12,%rsi
+  802239:	4c 89 f7             	mov    %r14,%rdi
+  80223c:	ff d0                	call   *%rax
+}
+  80223e:	48 83 c4 10          	add    $0x10,%rsp
+  802242:	5b                   	pop    %rbx
+  802243:	41 5c                	pop    %r12
+  802245:	41 5d                	pop    %r13
+  802247:	41 5e                	pop    %r14
+  802249:	5d                   	pop    %rbp
+  80224a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224b:	48 98                	cltq
+  80224d:	eb ef                	jmp    80223e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80224f:	48 98                	cltq
+  802251:	eb eb                	jmp    80223e <read+0x6a>
+  802253:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80225a:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80225c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802260:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802266:	89 da                	mov    %ebx,%edx
+  802268:	48 bf 01 57 80 00 00 	movabs $0x805701,%rdi
+  80226f:	00 00 00 
+  802272:	b8 00 00 00 00       	mov    $0x0,%eax
+  802277:	48 b9 38 05 80 00 00 	movabs $0x800538,%rcx
+  80227e:	00 00 00 
+  802281:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802283:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80228a:	eb b2                	jmp    80223e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80228c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802293:	eb a9                	jmp    80223e <read+0x6a>
+
+0000000000802295 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802295:	55                   	push   %rbp
+  802296:	48 89 e5             	mov    %rsp,%rbp
+  802299:	41 57                	push   %r15
+  80229b:	41 56                	push   %r14
+  80229d:	41 55                	push   %r13
+  80229f:	41 54                	push   %r12
+  8022a1:	53                   	push   %rbx
+  8022a2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022a6:	48 85 d2             	test   %rdx,%rdx
+  8022a9:	74 54                	je     8022ff <readn+0x6a>
+  8022ab:	41 89 fd             	mov    %edi,%r13d
+  8022ae:	49 89 f6             	mov    %rsi,%r14
+  8022b1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022b9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022be:	49 bf d4 21 80 00 00 	movabs $0x8021d4,%r15
+  8022c5:	00 00 00 
+  8022c8:	4c 89 e2             	mov    %r12,%rdx
+  8022cb:	48 29 f2             	sub    %rsi,%rdx
+  8022ce:	4c 01 f6             	add    %r14,%rsi
+  8022d1:	44 89 ef             	mov    %r13d,%edi
+  8022d4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	78 20                	js     8022fb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8022db:	01 c3                	add    %eax,%ebx
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	74 08                	je     8022e9 <readn+0x54>
+  8022e1:	48 63 f3             	movslq %ebx,%rsi
+  8022e4:	4c 39 e6             	cmp    %r12,%rsi
+  8022e7:	72 df                	jb     8022c8 <readn+0x33>
+    }
+    return res;
+  8022e9:	48 63 c3             	movslq %ebx,%rax
+}
+  8022ec:	48 83 c4 08          	add    $0x8,%rsp
+  8022f0:	5b                   	pop    %rbx
+  8022f1:	41 5c                	pop    %r12
+  8022f3:	41 5d                	pop    %r13
+  8022f5:	41 5e                	pop    %r14
+  8022f7:	41 5f                	pop    %r15
+  8022f9:	5d                   	pop    %rbp
+  8022fa:	c3                   	ret
+        if (inc < 0) return inc;
+  8022fb:	48 98                	cltq
+  8022fd:	eb ed                	jmp    8022ec <readn+0x57>
+    int inc = 1, res = 0;
+  8022ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802304:	eb e3                	jmp    8022e9 <readn+0x54>
+
+0000000000802306 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	41 56                	push   %r14
+  80230c:	41 55                	push   %r13
+  80230e:	41 54                	push   %r12
+  802310:	53                   	push   %rbx
+  802311:	48 83 ec 10          	sub    $0x10,%rsp
+  802315:	89 fb                	mov    %edi,%ebx
+  802317:	49 89 f4             	mov    %rsi,%r12
+  80231a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80231d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802321:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	78 47                	js     802378 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802331:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802335:	41 8b 3e             	mov    (%r14),%edi
+  802338:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80233c:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+  802348:	85 c0                	test   %eax,%eax
+  80234a:	78 30                	js     80237c <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80234c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802351:	74 2d                	je     802380 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802353:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802357:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80235b:	48 85 c0             	test   %rax,%rax
+  80235e:	74 59                	je     8023b9 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  802360:	4c 89 ea             	mov    %r13,%rdx
+  802363:	4c 89 e6             	mov    %r12,%rsi
+  802366:	4c 89 f7             	mov    %r14,%rdi
+  802369:	ff d0                	call   *%rax
+}
+  80236b:	48 83 c4 10          	add    $0x10,%rsp
+  80236f:	5b                   	pop    %rbx
+  802370:	41 5c                	pop    %r12
+  802372:	41 5d                	pop    %r13
+  802374:	41 5e                	pop    %r14
+  802376:	5d                   	pop    %rbp
+  802377:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802378:	48 98                	cltq
+  80237a:	eb ef                	jmp    80236b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80237c:	48 98                	cltq
+  80237e:	eb eb                	jmp    80236b <write+0x65>
+  802380:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802387:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802389:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80238d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802393:	89 da                	mov    %ebx,%edx
+  802395:	48 bf 1d 57 80 00 00 	movabs $0x80571d,%rdi
+  80239c:	00 00 00 
+  80239f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a4:	48 b9 38 05 80 00 00 	movabs $0x800538,%rcx
+  8023ab:	00 00 00 
+  8023ae:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023b0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b7:	eb b2                	jmp    80236b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023b9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023c0:	eb a9                	jmp    80236b <write+0x65>
+
+00000000008023c2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023c2:	55                   	push   %rbp
+  8023c3:	48 89 e5             	mov    %rsp,%rbp
+  8023c6:	53                   	push   %rbx
+  8023c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023cb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023cd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023d1:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 0c                	js     8023ed <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8023e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023e5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+
+00000000008023f3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	41 55                	push   %r13
+  8023f9:	41 54                	push   %r12
+  8023fb:	53                   	push   %rbx
+  8023fc:	48 83 ec 18          	sub    $0x18,%rsp
+  802400:	89 fb                	mov    %edi,%ebx
+  802402:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802405:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802409:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+  802415:	85 c0                	test   %eax,%eax
+  802417:	78 38                	js     802451 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802419:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80241d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802421:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802425:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+  802431:	85 c0                	test   %eax,%eax
+  802433:	78 1c                	js     802451 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802435:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80243a:	74 20                	je     80245c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80243c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802440:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802444:	48 85 c0             	test   %rax,%rax
+  802447:	74 4a                	je     802493 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802449:	44 89 e6             	mov    %r12d,%esi
+  80244c:	4c 89 ef             	mov    %r13,%rdi
+  80244f:	ff d0                	call   *%rax
+}
+  802451:	48 83 c4 18          	add    $0x18,%rsp
+  802455:	5b                   	pop    %rbx
+  802456:	41 5c                	pop    %r12
+  802458:	41 5d                	pop    %r13
+  80245a:	5d                   	pop    %rbp
+  80245b:	c3                   	ret
+  80245c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802463:	00 00 
+                thisenv->env_id, fdnum);
+  802465:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802469:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80246f:	89 da                	mov    %ebx,%edx
+  802471:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  802478:	00 00 00 
+  80247b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802480:	48 b9 38 05 80 00 00 	movabs $0x800538,%rcx
+  802487:	00 00 00 
+  80248a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80248c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802491:	eb be                	jmp    802451 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802493:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802498:	eb b7                	jmp    802451 <ftruncate+0x5e>
+
+000000000080249a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	41 54                	push   %r12
+  8024a0:	53                   	push   %rbx
+  8024a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024a8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024ac:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	78 4e                	js     80250a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024bc:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024c0:	41 8b 3c 24          	mov    (%r12),%edi
+  8024c4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024c8:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	85 c0                	test   %eax,%eax
+  8024d6:	78 32                	js     80250a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024dc:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8024e1:	74 30                	je     802513 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024e3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8024e6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8024ed:	00 00 00 
+    stat->st_isdir = 0;
+  8024f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f7:	00 00 00 
+    stat->st_dev = dev;
+  8024fa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802501:	48 89 de             	mov    %rbx,%rsi
+  802504:	4c 89 e7             	mov    %r12,%rdi
+  802507:	ff 50 28             	call   *0x28(%rax)
+}
+  80250a:	48 83 c4 10          	add    $0x10,%rsp
+  80250e:	5b                   	pop    %rbx
+  80250f:	41 5c                	pop    %r12
+  802511:	5d                   	pop    %rbp
+  802512:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802513:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802518:	eb f0                	jmp    80250a <fstat+0x70>
+
+000000000080251a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 54                	push   %r12
+  802520:	53                   	push   %rbx
+  802521:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802524:	be 00 00 00 00       	mov    $0x0,%esi
+  802529:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 25                	js     802560 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80253b:	4c 89 e6             	mov    %r12,%rsi
+  80253e:	89 c7                	mov    %eax,%edi
+  802540:	48 b8 9a 24 80 00 00 	movabs $0x80249a,%rax
+  802547:	00 00 00 
+  80254a:	ff d0                	call   *%rax
+  80254c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80254f:	89 df                	mov    %ebx,%edi
+  802551:	48 b8 1d 20 80 00 00 	movabs $0x80201d,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+
+    return res;
+  80255d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802560:	89 d8                	mov    %ebx,%eax
+  802562:	5b                   	pop    %rbx
+  802563:	41 5c                	pop    %r12
+  802565:	5d                   	pop    %rbp
+  802566:	c3                   	ret
+
+0000000000802567 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802567:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80256e:	00 00 00 
+  802571:	ba 00 00 00 00       	mov    $0x0,%edx
+  802576:	eb 0e                	jmp    802586 <mmap_lookup+0x1f>
+  802578:	48 83 c2 01          	add    $0x1,%rdx
+  80257c:	48 83 c0 20          	add    $0x20,%rax
+  802580:	48 83 fa 40          	cmp    $0x40,%rdx
+  802584:	74 2b                	je     8025b1 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802586:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80258a:	48 85 c9             	test   %rcx,%rcx
+  80258d:	74 e9                	je     802578 <mmap_lookup+0x11>
+  80258f:	48 8b 30             	mov    (%rax),%rsi
+  802592:	48 39 f7             	cmp    %rsi,%rdi
+  802595:	72 e1                	jb     802578 <mmap_lookup+0x11>
+  802597:	48 01 f1             	add    %rsi,%rcx
+  80259a:	48 39 cf             	cmp    %rcx,%rdi
+  80259d:	73 d9                	jae    802578 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80259f:	48 c1 e2 05          	shl    $0x5,%rdx
+  8025a3:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8025aa:	00 00 00 
+  8025ad:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8025b0:	c3                   	ret
+    return NULL;
+  8025b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b6:	c3                   	ret
+
+00000000008025b7 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8025b7:	55                   	push   %rbp
+  8025b8:	48 89 e5             	mov    %rsp,%rbp
+  8025bb:	41 54                	push   %r12
+  8025bd:	53                   	push   %rbx
+  8025be:	89 fb                	mov    %edi,%ebx
+  8025c0:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025c3:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8025ca:	00 00 00 
+  8025cd:	83 38 00             	cmpl   $0x0,(%rax)
+  8025d0:	74 3d                	je     80260f <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8025d2:	41 54                	push   %r12
+  8025d4:	6a 00                	push   $0x0
+  8025d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ec:	89 de                	mov    %ebx,%esi
+  8025ee:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8025f5:	00 00 00 
+  8025f8:	8b 38                	mov    (%rax),%edi
+  8025fa:	48 b8 57 41 80 00 00 	movabs $0x804157,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+}
+  802606:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80260a:	5b                   	pop    %rbx
+  80260b:	41 5c                	pop    %r12
+  80260d:	5d                   	pop    %rbp
+  80260e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80260f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802614:	48 b8 be 43 80 00 00 	movabs $0x8043be,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802627:	00 00 
+  802629:	eb a7                	jmp    8025d2 <fsipc_words+0x1b>
+
+000000000080262b <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802633:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80263a:	00 
+  80263b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802642:	00 
+  802643:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802647:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80264b:	48 63 f6             	movslq %esi,%rsi
+  80264e:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802652:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802656:	bf 02 00 00 00       	mov    $0x2,%edi
+  80265b:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+}
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+0000000000802669 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802671:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802678:	00 
+  802679:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802680:	00 
+  802681:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802688:	00 
+  802689:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80268d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802691:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802695:	bf 06 00 00 00       	mov    $0x6,%edi
+  80269a:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+}
+  8026a6:	c9                   	leave
+  8026a7:	c3                   	ret
+
+00000000008026a8 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8026a8:	55                   	push   %rbp
+  8026a9:	48 89 e5             	mov    %rsp,%rbp
+  8026ac:	41 54                	push   %r12
+  8026ae:	53                   	push   %rbx
+  8026af:	89 fb                	mov    %edi,%ebx
+  8026b1:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026b4:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8026bb:	00 00 00 
+  8026be:	83 38 00             	cmpl   $0x0,(%rax)
+  8026c1:	74 3f                	je     802702 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8026c3:	6a 00                	push   $0x0
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	4d 89 e1             	mov    %r12,%r9
+  8026ca:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026d5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8026dc:	00 00 00 
+  8026df:	89 de                	mov    %ebx,%esi
+  8026e1:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8026e8:	00 00 00 
+  8026eb:	8b 38                	mov    (%rax),%edi
+  8026ed:	48 b8 57 41 80 00 00 	movabs $0x804157,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+}
+  8026f9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8026fd:	5b                   	pop    %rbx
+  8026fe:	41 5c                	pop    %r12
+  802700:	5d                   	pop    %rbp
+  802701:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802702:	bf 03 00 00 00       	mov    $0x3,%edi
+  802707:	48 b8 be 43 80 00 00 	movabs $0x8043be,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+  802713:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  80271a:	00 00 
+  80271c:	eb a5                	jmp    8026c3 <fsipc+0x1b>
+
+000000000080271e <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80271e:	55                   	push   %rbp
+  80271f:	48 89 e5             	mov    %rsp,%rbp
+  802722:	41 54                	push   %r12
+  802724:	53                   	push   %rbx
+  802725:	41 89 fc             	mov    %edi,%r12d
+  802728:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80272b:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802732:	00 00 00 
+  802735:	83 38 00             	cmpl   $0x0,(%rax)
+  802738:	74 46                	je     802780 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  80273a:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80273e:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802742:	6a 00                	push   $0x0
+  802744:	6a 00                	push   $0x0
+  802746:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802752:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802759:	00 00 00 
+  80275c:	44 89 e6             	mov    %r12d,%esi
+  80275f:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802766:	00 00 00 
+  802769:	8b 38                	mov    (%rax),%edi
+  80276b:	48 b8 57 41 80 00 00 	movabs $0x804157,%rax
+  802772:	00 00 00 
+  802775:	ff d0                	call   *%rax
+}
+  802777:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80277b:	5b                   	pop    %rbx
+  80277c:	41 5c                	pop    %r12
+  80277e:	5d                   	pop    %rbp
+  80277f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802780:	bf 03 00 00 00       	mov    $0x3,%edi
+  802785:	48 b8 be 43 80 00 00 	movabs $0x8043be,%rax
+  80278c:	00 00 00 
+  80278f:	ff d0                	call   *%rax
+  802791:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802798:	00 00 
+  80279a:	eb 9e                	jmp    80273a <fsipcv+0x1c>
+
+000000000080279c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+  8027a0:	41 54                	push   %r12
+  8027a2:	53                   	push   %rbx
+  8027a3:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027a6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027a9:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8027b0:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8027bc:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	78 3d                	js     802809 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027cc:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8027d3:	00 00 00 
+  8027d6:	4c 89 e6             	mov    %r12,%rsi
+  8027d9:	48 89 df             	mov    %rbx,%rdi
+  8027dc:	48 b8 5d 0e 80 00 00 	movabs $0x800e5d,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8027e8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8027ef:	00 
+  8027f0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027f6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8027fd:	00 
+  8027fe:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802804:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802809:	5b                   	pop    %rbx
+  80280a:	41 5c                	pop    %r12
+  80280c:	5d                   	pop    %rbp
+  80280d:	c3                   	ret
+
+000000000080280e <fsipcv_buf>:
+    return FSIPCV;
+  80280e:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802815:	00 00 00 
+    if (!allocated) {
+  802818:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80281f:	00 00 00 
+  802822:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802825:	74 01                	je     802828 <fsipcv_buf+0x1a>
+}
+  802827:	c3                   	ret
+fsipcv_buf(void) {
+  802828:	55                   	push   %rbp
+  802829:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  80282c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802831:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802836:	48 89 c6             	mov    %rax,%rsi
+  802839:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283e:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	78 19                	js     802867 <fsipcv_buf+0x59>
+        allocated = 1;
+  80284e:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802855:	00 00 00 
+  802858:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  80285b:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802862:	00 00 00 
+}
+  802865:	5d                   	pop    %rbp
+  802866:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286c:	eb f7                	jmp    802865 <fsipcv_buf+0x57>
+
+000000000080286e <devfile_write>:
+    if (!fd || !buf) {
+  80286e:	48 85 ff             	test   %rdi,%rdi
+  802871:	0f 84 46 01 00 00    	je     8029bd <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802877:	55                   	push   %rbp
+  802878:	48 89 e5             	mov    %rsp,%rbp
+  80287b:	41 57                	push   %r15
+  80287d:	41 56                	push   %r14
+  80287f:	41 55                	push   %r13
+  802881:	41 54                	push   %r12
+  802883:	53                   	push   %rbx
+  802884:	48 83 ec 18          	sub    $0x18,%rsp
+  802888:	49 89 ff             	mov    %rdi,%r15
+  80288b:	49 89 f5             	mov    %rsi,%r13
+  80288e:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802891:	48 85 f6             	test   %rsi,%rsi
+  802894:	0f 84 1a 01 00 00    	je     8029b4 <devfile_write+0x146>
+    while (n) {
+  80289a:	48 85 d2             	test   %rdx,%rdx
+  80289d:	0f 84 fc 00 00 00    	je     80299f <devfile_write+0x131>
+    size_t i = 0;
+  8028a3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8028a9:	eb 6c                	jmp    802917 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8028ab:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8028b1:	4c 39 e3             	cmp    %r12,%rbx
+  8028b4:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8028b8:	4c 89 e2             	mov    %r12,%rdx
+  8028bb:	4c 89 ee             	mov    %r13,%rsi
+  8028be:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8028c5:	00 00 00 
+  8028c8:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028d4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028d8:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8028df:	00 00 00 
+  8028e2:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  8028e4:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  8028e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028f2:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  8028f9:	00 00 00 
+  8028fc:	ff d0                	call   *%rax
+  8028fe:	85 c0                	test   %eax,%eax
+  802900:	0f 88 95 00 00 00    	js     80299b <devfile_write+0x12d>
+        buf += ret;
+  802906:	48 98                	cltq
+  802908:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80290b:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80290e:	48 29 c3             	sub    %rax,%rbx
+  802911:	0f 84 8b 00 00 00    	je     8029a2 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802917:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80291e:	76 8b                	jbe    8028ab <devfile_write+0x3d>
+  802920:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+  80292c:	49 89 c4             	mov    %rax,%r12
+  80292f:	48 85 c0             	test   %rax,%rax
+  802932:	0f 84 73 ff ff ff    	je     8028ab <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802938:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80293d:	48 39 c3             	cmp    %rax,%rbx
+  802940:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802944:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  80294b:	00 
+  80294c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802950:	48 89 c2             	mov    %rax,%rdx
+  802953:	4c 89 ee             	mov    %r13,%rsi
+  802956:	48 b9 be 10 80 00 00 	movabs $0x8010be,%rcx
+  80295d:	00 00 00 
+  802960:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802962:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802966:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  80296a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80296e:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802973:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80297a:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80297e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802983:	48 b8 1e 27 80 00 00 	movabs $0x80271e,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	0f 89 6f ff ff ff    	jns    802906 <devfile_write+0x98>
+                return ret;
+  802997:	48 98                	cltq
+  802999:	eb 0a                	jmp    8029a5 <devfile_write+0x137>
+                return ret;
+  80299b:	48 98                	cltq
+  80299d:	eb 06                	jmp    8029a5 <devfile_write+0x137>
+    size_t i = 0;
+  80299f:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8029a2:	4c 89 f0             	mov    %r14,%rax
+}
+  8029a5:	48 83 c4 18          	add    $0x18,%rsp
+  8029a9:	5b                   	pop    %rbx
+  8029aa:	41 5c                	pop    %r12
+  8029ac:	41 5d                	pop    %r13
+  8029ae:	41 5e                	pop    %r14
+  8029b0:	41 5f                	pop    %r15
+  8029b2:	5d                   	pop    %rbp
+  8029b3:	c3                   	ret
+        return -E_INVAL;
+  8029b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029bb:	eb e8                	jmp    8029a5 <devfile_write+0x137>
+  8029bd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8029c4:	c3                   	ret
+
+00000000008029c5 <devfile_read>:
+    if (!fd || !buf) {
+  8029c5:	48 85 ff             	test   %rdi,%rdi
+  8029c8:	0f 84 47 01 00 00    	je     802b15 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8029ce:	55                   	push   %rbp
+  8029cf:	48 89 e5             	mov    %rsp,%rbp
+  8029d2:	41 57                	push   %r15
+  8029d4:	41 56                	push   %r14
+  8029d6:	41 55                	push   %r13
+  8029d8:	41 54                	push   %r12
+  8029da:	53                   	push   %rbx
+  8029db:	48 83 ec 18          	sub    $0x18,%rsp
+  8029df:	49 89 ff             	mov    %rdi,%r15
+  8029e2:	49 89 f5             	mov    %rsi,%r13
+  8029e5:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  8029e8:	48 85 f6             	test   %rsi,%rsi
+  8029eb:	0f 84 1b 01 00 00    	je     802b0c <devfile_read+0x147>
+    while (n) {
+  8029f1:	48 85 d2             	test   %rdx,%rdx
+  8029f4:	0f 84 fb 00 00 00    	je     802af5 <devfile_read+0x130>
+    size_t i = 0;
+  8029fa:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a01:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a02:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802a09:	00 00 00 
+  802a0c:	eb 5f                	jmp    802a6d <devfile_read+0xa8>
+                return ret ? ret : i;
+  802a0e:	48 98                	cltq
+  802a10:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a15:	e9 e3 00 00 00       	jmp    802afd <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a1a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a1e:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802a21:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802a25:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a2f:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+  802a3b:	89 c3                	mov    %eax,%ebx
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	0f 8e a7 00 00 00    	jle    802aec <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802a45:	48 63 d0             	movslq %eax,%rdx
+  802a48:	4c 89 f6             	mov    %r14,%rsi
+  802a4b:	4c 89 ef             	mov    %r13,%rdi
+  802a4e:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  802a55:	00 00 00 
+  802a58:	ff d0                	call   *%rax
+        buf += ret;
+  802a5a:	48 63 db             	movslq %ebx,%rbx
+  802a5d:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802a60:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802a64:	49 29 dc             	sub    %rbx,%r12
+  802a67:	0f 84 8c 00 00 00    	je     802af9 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a6d:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a74:	76 a4                	jbe    802a1a <devfile_read+0x55>
+  802a76:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	48 89 c1             	mov    %rax,%rcx
+  802a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a89:	48 85 c0             	test   %rax,%rax
+  802a8c:	74 8c                	je     802a1a <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802a8e:	be 00 00 04 00       	mov    $0x40000,%esi
+  802a93:	49 39 f4             	cmp    %rsi,%r12
+  802a96:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802a9a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a9e:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802aa0:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802aa4:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802aab:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802aaf:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ab4:	48 b8 1e 27 80 00 00 	movabs $0x80271e,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+  802ac0:	89 c3                	mov    %eax,%ebx
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	0f 8e 44 ff ff ff    	jle    802a0e <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802aca:	48 63 d0             	movslq %eax,%rdx
+  802acd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ad1:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802ad8:	4c 89 ef             	mov    %r13,%rdi
+  802adb:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  802ae2:	00 00 00 
+  802ae5:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ae7:	e9 6e ff ff ff       	jmp    802a5a <devfile_read+0x95>
+                return ret ? ret : i;
+  802aec:	48 98                	cltq
+  802aee:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802af3:	eb 08                	jmp    802afd <devfile_read+0x138>
+    size_t i = 0;
+  802af5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802af9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802afd:	48 83 c4 18          	add    $0x18,%rsp
+  802b01:	5b                   	pop    %rbx
+  802b02:	41 5c                	pop    %r12
+  802b04:	41 5d                	pop    %r13
+  802b06:	41 5e                	pop    %r14
+  802b08:	41 5f                	pop    %r15
+  802b0a:	5d                   	pop    %rbp
+  802b0b:	c3                   	ret
+        return -E_INVAL;
+  802b0c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b13:	eb e8                	jmp    802afd <devfile_read+0x138>
+  802b15:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802b1c:	c3                   	ret
+
+0000000000802b1d <open>:
+open(const char *path, int mode) {
+  802b1d:	55                   	push   %rbp
+  802b1e:	48 89 e5             	mov    %rsp,%rbp
+  802b21:	41 55                	push   %r13
+  802b23:	41 54                	push   %r12
+  802b25:	53                   	push   %rbx
+  802b26:	48 83 ec 18          	sub    $0x18,%rsp
+  802b2a:	49 89 fc             	mov    %rdi,%r12
+  802b2d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b30:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  802b37:	00 00 00 
+  802b3a:	ff d0                	call   *%rax
+  802b3c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b42:	0f 87 8a 00 00 00    	ja     802bd2 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b48:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b4c:	48 b8 55 1e 80 00 00 	movabs $0x801e55,%rax
+  802b53:	00 00 00 
+  802b56:	ff d0                	call   *%rax
+  802b58:	89 c3                	mov    %eax,%ebx
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	78 50                	js     802bae <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b5e:	4c 89 e6             	mov    %r12,%rsi
+  802b61:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802b68:	00 00 00 
+  802b6b:	48 89 df             	mov    %rbx,%rdi
+  802b6e:	48 b8 5d 0e 80 00 00 	movabs $0x800e5d,%rax
+  802b75:	00 00 00 
+  802b78:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b7a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b81:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b85:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b8a:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+  802b96:	89 c3                	mov    %eax,%ebx
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 1f                	js     802bbb <open+0x9e>
+    return fd2num(fd);
+  802b9c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ba0:	48 b8 25 1e 80 00 00 	movabs $0x801e25,%rax
+  802ba7:	00 00 00 
+  802baa:	ff d0                	call   *%rax
+  802bac:	89 c3                	mov    %eax,%ebx
+}
+  802bae:	89 d8                	mov    %ebx,%eax
+  802bb0:	48 83 c4 18          	add    $0x18,%rsp
+  802bb4:	5b                   	pop    %rbx
+  802bb5:	41 5c                	pop    %r12
+  802bb7:	41 5d                	pop    %r13
+  802bb9:	5d                   	pop    %rbp
+  802bba:	c3                   	ret
+        fd_close(fd, 0);
+  802bbb:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bc4:	48 b8 73 1f 80 00 00 	movabs $0x801f73,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+        return res;
+  802bd0:	eb dc                	jmp    802bae <open+0x91>
+        return -E_BAD_PATH;
+  802bd2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bd7:	eb d5                	jmp    802bae <open+0x91>
+
+0000000000802bd9 <sync>:
+sync(void) {
+  802bd9:	55                   	push   %rbp
+  802bda:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802bdd:	be 00 00 00 00       	mov    $0x0,%esi
+  802be2:	bf 08 00 00 00       	mov    $0x8,%edi
+  802be7:	48 b8 a8 26 80 00 00 	movabs $0x8026a8,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+}
+  802bf3:	5d                   	pop    %rbp
+  802bf4:	c3                   	ret
+
+0000000000802bf5 <drop_cache>:
+drop_cache(int fdnum) {
+  802bf5:	55                   	push   %rbp
+  802bf6:	48 89 e5             	mov    %rsp,%rbp
+  802bf9:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bfd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c01:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	78 51                	js     802c62 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c15:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c1c:	00 00 00 
+  802c1f:	8b 0a                	mov    (%rdx),%ecx
+  802c21:	39 08                	cmp    %ecx,(%rax)
+  802c23:	75 3f                	jne    802c64 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802c25:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802c2c:	00 
+  802c2d:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802c34:	00 
+  802c35:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802c3c:	00 
+  802c3d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c44:	00 
+  802c45:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802c49:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802c4d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c51:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802c56:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+}
+  802c62:	c9                   	leave
+  802c63:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c69:	eb f7                	jmp    802c62 <drop_cache+0x6d>
+
+0000000000802c6b <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802c6b:	55                   	push   %rbp
+  802c6c:	48 89 e5             	mov    %rsp,%rbp
+  802c6f:	41 57                	push   %r15
+  802c71:	41 56                	push   %r14
+  802c73:	41 55                	push   %r13
+  802c75:	41 54                	push   %r12
+  802c77:	53                   	push   %rbx
+  802c78:	48 83 ec 58          	sub    $0x58,%rsp
+  802c7c:	41 89 f4             	mov    %esi,%r12d
+  802c7f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c83:	49 89 cd             	mov    %rcx,%r13
+  802c86:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c89:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c8d:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+  802c99:	48 63 d0             	movslq %eax,%rdx
+  802c9c:	85 c0                	test   %eax,%eax
+  802c9e:	0f 88 36 01 00 00    	js     802dda <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ca4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ca8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802caf:	00 00 00 
+  802cb2:	8b 32                	mov    (%rdx),%esi
+  802cb4:	39 31                	cmp    %esi,(%rcx)
+  802cb6:	0f 85 30 01 00 00    	jne    802dec <read_map+0x181>
+  802cbc:	45 85 e4             	test   %r12d,%r12d
+  802cbf:	0f 88 27 01 00 00    	js     802dec <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cc5:	49 63 cc             	movslq %r12d,%rcx
+  802cc8:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802ccc:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802cd3:	0f 85 1c 01 00 00    	jne    802df5 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802cd9:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802cdd:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802ce4:	0f 85 14 01 00 00    	jne    802dfe <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802cea:	48 63 cb             	movslq %ebx,%rcx
+  802ced:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802cf1:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802cf8:	00 00 00 
+    while (i < n) {
+  802cfb:	4d 85 ed             	test   %r13,%r13
+  802cfe:	75 5c                	jne    802d5c <read_map+0xf1>
+  802d00:	e9 d2 00 00 00       	jmp    802dd7 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802d05:	41 8b 3e             	mov    (%r14),%edi
+  802d08:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802d0c:	50                   	push   %rax
+  802d0d:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802d11:	50                   	push   %rax
+  802d12:	4d 89 f9             	mov    %r15,%r9
+  802d15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d1b:	48 89 d9             	mov    %rbx,%rcx
+  802d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d23:	be 09 00 00 00       	mov    $0x9,%esi
+  802d28:	48 b8 57 41 80 00 00 	movabs $0x804157,%rax
+  802d2f:	00 00 00 
+  802d32:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802d34:	48 83 c4 10          	add    $0x10,%rsp
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	0f 8e 8f 00 00 00    	jle    802dcf <read_map+0x164>
+        if (!mapped_perm) {
+  802d40:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802d44:	0f 84 80 00 00 00    	je     802dca <read_map+0x15f>
+        i += res;
+  802d4a:	48 63 d0             	movslq %eax,%rdx
+  802d4d:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802d50:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802d55:	75 78                	jne    802dcf <read_map+0x164>
+    while (i < n) {
+  802d57:	4d 39 ec             	cmp    %r13,%r12
+  802d5a:	73 73                	jae    802dcf <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802d5c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d60:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802d64:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802d68:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802d6c:	4c 01 e0             	add    %r12,%rax
+  802d6f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d73:	4c 89 eb             	mov    %r13,%rbx
+  802d76:	4c 29 e3             	sub    %r12,%rbx
+  802d79:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d7d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d85:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802d8c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802d93:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802d98:	48 39 c3             	cmp    %rax,%rbx
+  802d9b:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802d9f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802da3:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802da7:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802dab:	0f 85 54 ff ff ff    	jne    802d05 <read_map+0x9a>
+  802db1:	bf 03 00 00 00       	mov    $0x3,%edi
+  802db6:	48 b8 be 43 80 00 00 	movabs $0x8043be,%rax
+  802dbd:	00 00 00 
+  802dc0:	ff d0                	call   *%rax
+  802dc2:	41 89 06             	mov    %eax,(%r14)
+  802dc5:	e9 3b ff ff ff       	jmp    802d05 <read_map+0x9a>
+            res = -E_INVAL;
+  802dca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802dcf:	4c 89 e2             	mov    %r12,%rdx
+  802dd2:	4d 85 e4             	test   %r12,%r12
+  802dd5:	75 03                	jne    802dda <read_map+0x16f>
+  802dd7:	48 63 d0             	movslq %eax,%rdx
+}
+  802dda:	48 89 d0             	mov    %rdx,%rax
+  802ddd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802de1:	5b                   	pop    %rbx
+  802de2:	41 5c                	pop    %r12
+  802de4:	41 5d                	pop    %r13
+  802de6:	41 5e                	pop    %r14
+  802de8:	41 5f                	pop    %r15
+  802dea:	5d                   	pop    %rbp
+  802deb:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802dec:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802df3:	eb e5                	jmp    802dda <read_map+0x16f>
+  802df5:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802dfc:	eb dc                	jmp    802dda <read_map+0x16f>
+  802dfe:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802e05:	eb d3                	jmp    802dda <read_map+0x16f>
+
+0000000000802e07 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802e07:	55                   	push   %rbp
+  802e08:	48 89 e5             	mov    %rsp,%rbp
+  802e0b:	41 57                	push   %r15
+  802e0d:	41 56                	push   %r14
+  802e0f:	41 55                	push   %r13
+  802e11:	41 54                	push   %r12
+  802e13:	53                   	push   %rbx
+  802e14:	48 83 ec 38          	sub    $0x38,%rsp
+  802e18:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e1b:	41 89 f6             	mov    %esi,%r14d
+  802e1e:	49 89 d5             	mov    %rdx,%r13
+  802e21:	89 cb                	mov    %ecx,%ebx
+  802e23:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e26:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802e2a:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	0f 88 33 02 00 00    	js     803071 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802e43:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e47:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802e4e:	00 00 00 
+  802e51:	8b 3a                	mov    (%rdx),%edi
+  802e53:	39 39                	cmp    %edi,(%rcx)
+  802e55:	0f 85 1b 02 00 00    	jne    803076 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802e5b:	4d 85 ed             	test   %r13,%r13
+  802e5e:	41 0f 94 c0          	sete   %r8b
+  802e62:	44 89 f0             	mov    %r14d,%eax
+  802e65:	c1 e8 1f             	shr    $0x1f,%eax
+  802e68:	41 08 c0             	or     %al,%r8b
+  802e6b:	0f 85 14 02 00 00    	jne    803085 <mmap+0x27e>
+  802e71:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e78:	0f 85 0e 02 00 00    	jne    80308c <mmap+0x285>
+  802e7e:	83 fb 07             	cmp    $0x7,%ebx
+  802e81:	0f 87 0c 02 00 00    	ja     803093 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e87:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802e91:	83 fa 01             	cmp    $0x1,%edx
+  802e94:	0f 87 dc 01 00 00    	ja     803076 <mmap+0x26f>
+  802e9a:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802ea1:	00 00 00 
+  802ea4:	eb 0e                	jmp    802eb4 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802ea6:	48 83 c0 01          	add    $0x1,%rax
+  802eaa:	48 83 c2 20          	add    $0x20,%rdx
+  802eae:	48 83 f8 40          	cmp    $0x40,%rax
+  802eb2:	74 44                	je     802ef8 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802eb4:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802eb8:	75 ec                	jne    802ea6 <mmap+0x9f>
+  802eba:	48 c1 e0 05          	shl    $0x5,%rax
+  802ebe:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802ec5:	00 00 00 
+  802ec8:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802ecc:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802ed3:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802eda:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802edd:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802ee4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802eec:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802ef3:	00 00 00 
+  802ef6:	eb 17                	jmp    802f0f <mmap+0x108>
+  802ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802efd:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802f03:	eb c7                	jmp    802ecc <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f05:	48 83 c0 01          	add    $0x1,%rax
+  802f09:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802f0d:	77 37                	ja     802f46 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802f0f:	48 89 c2             	mov    %rax,%rdx
+  802f12:	48 c1 e2 05          	shl    $0x5,%rdx
+  802f16:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802f1b:	48 85 d2             	test   %rdx,%rdx
+  802f1e:	74 e5                	je     802f05 <mmap+0xfe>
+  802f20:	48 89 c7             	mov    %rax,%rdi
+  802f23:	48 c1 e7 05          	shl    $0x5,%rdi
+  802f27:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802f2b:	48 01 fa             	add    %rdi,%rdx
+  802f2e:	48 39 d6             	cmp    %rdx,%rsi
+  802f31:	73 d2                	jae    802f05 <mmap+0xfe>
+  802f33:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802f37:	4c 39 d7             	cmp    %r10,%rdi
+  802f3a:	73 c9                	jae    802f05 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802f3c:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f44:	eb c9                	jmp    802f0f <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802f46:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802f4f:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802f56:	00 00 00 
+  802f59:	49 39 f9             	cmp    %rdi,%r9
+  802f5c:	0f 82 14 01 00 00    	jb     803076 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f62:	48 85 f6             	test   %rsi,%rsi
+  802f65:	0f 84 2f 01 00 00    	je     80309a <mmap+0x293>
+  802f6b:	45 84 c0             	test   %r8b,%r8b
+  802f6e:	0f 85 26 01 00 00    	jne    80309a <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f74:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f78:	0f 94 c0             	sete   %al
+  802f7b:	0f b6 c0             	movzbl %al,%eax
+  802f7e:	c1 e0 06             	shl    $0x6,%eax
+  802f81:	09 d8                	or     %ebx,%eax
+  802f83:	89 c3                	mov    %eax,%ebx
+  802f85:	83 cb 04             	or     $0x4,%ebx
+  802f88:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802f8b:	4d 85 ff             	test   %r15,%r15
+  802f8e:	0f 84 bd 00 00 00    	je     803051 <mmap+0x24a>
+  802f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f99:	83 e0 bf             	and    $0xffffffbf,%eax
+  802f9c:	83 c8 04             	or     $0x4,%eax
+  802f9f:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802fa2:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802fa6:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802faa:	49 89 f6             	mov    %rsi,%r14
+  802fad:	eb 43                	jmp    802ff2 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802faf:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802fb5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802fbb:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802fbe:	eb 2d                	jmp    802fed <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802fc0:	48 85 c0             	test   %rax,%rax
+  802fc3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802fc8:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802fcc:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802fcf:	4c 89 e2             	mov    %r12,%rdx
+  802fd2:	4c 89 ee             	mov    %r13,%rsi
+  802fd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fda:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  802fe1:	00 00 00 
+  802fe4:	ff d0                	call   *%rax
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	78 3e                	js     803028 <mmap+0x221>
+        i += n;
+  802fea:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802fed:	4c 39 fb             	cmp    %r15,%rbx
+  802ff0:	73 54                	jae    803046 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802ff2:	4d 89 fc             	mov    %r15,%r12
+  802ff5:	49 29 dc             	sub    %rbx,%r12
+  802ff8:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802ffc:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802fff:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  803002:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803006:	4c 89 e1             	mov    %r12,%rcx
+  803009:	4c 89 ea             	mov    %r13,%rdx
+  80300c:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80300f:	48 b8 6b 2c 80 00 00 	movabs $0x802c6b,%rax
+  803016:	00 00 00 
+  803019:	ff d0                	call   *%rax
+        if (res > 0) {
+  80301b:	48 85 c0             	test   %rax,%rax
+  80301e:	7f 8f                	jg     802faf <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  803020:	74 9e                	je     802fc0 <mmap+0x1b9>
+  803022:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803026:	74 98                	je     802fc0 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803028:	4c 89 f6             	mov    %r14,%rsi
+  80302b:	4c 89 fa             	mov    %r15,%rdx
+  80302e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803033:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+    return NULL;
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	eb 30                	jmp    803076 <mmap+0x26f>
+  803046:	4c 89 f6             	mov    %r14,%rsi
+  803049:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80304d:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  803051:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803055:	8b 40 0c             	mov    0xc(%rax),%eax
+  803058:	48 89 31             	mov    %rsi,(%rcx)
+  80305b:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  80305f:	89 41 10             	mov    %eax,0x10(%rcx)
+  803062:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803066:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803069:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80306c:	48 89 f0             	mov    %rsi,%rax
+  80306f:	eb 05                	jmp    803076 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803071:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803076:	48 83 c4 38          	add    $0x38,%rsp
+  80307a:	5b                   	pop    %rbx
+  80307b:	41 5c                	pop    %r12
+  80307d:	41 5d                	pop    %r13
+  80307f:	41 5e                	pop    %r14
+  803081:	41 5f                	pop    %r15
+  803083:	5d                   	pop    %rbp
+  803084:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308a:	eb ea                	jmp    803076 <mmap+0x26f>
+  80308c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803091:	eb e3                	jmp    803076 <mmap+0x26f>
+  803093:	b8 00 00 00 00       	mov    $0x0,%eax
+  803098:	eb dc                	jmp    803076 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80309a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309f:	eb d5                	jmp    803076 <mmap+0x26f>
+
+00000000008030a1 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8030a1:	55                   	push   %rbp
+  8030a2:	48 89 e5             	mov    %rsp,%rbp
+  8030a5:	41 57                	push   %r15
+  8030a7:	41 56                	push   %r14
+  8030a9:	41 55                	push   %r13
+  8030ab:	41 54                	push   %r12
+  8030ad:	53                   	push   %rbx
+  8030ae:	48 83 ec 38          	sub    $0x38,%rsp
+  8030b2:	49 89 fc             	mov    %rdi,%r12
+  8030b5:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8030b8:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  8030bf:	00 00 00 
+  8030c2:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8030c4:	48 85 c0             	test   %rax,%rax
+  8030c7:	0f 84 2f 01 00 00    	je     8031fc <msync+0x15b>
+  8030cd:	49 89 c7             	mov    %rax,%r15
+  8030d0:	4d 01 e5             	add    %r12,%r13
+  8030d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8030d7:	49 03 07             	add    (%r15),%rax
+  8030da:	4c 39 e8             	cmp    %r13,%rax
+  8030dd:	0f 82 20 01 00 00    	jb     803203 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  8030e3:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8030e7:	83 e0 40             	and    $0x40,%eax
+  8030ea:	0f 84 fd 00 00 00    	je     8031ed <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8030f0:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8030f7:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8030fe:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803105:	4d 39 ec             	cmp    %r13,%r12
+  803108:	0f 83 fc 00 00 00    	jae    80320a <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80310e:	49 be 39 3b 80 00 00 	movabs $0x803b39,%r14
+  803115:	00 00 00 
+  803118:	e9 b0 00 00 00       	jmp    8031cd <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80311d:	4c 89 e3             	mov    %r12,%rbx
+  803120:	4d 39 ec             	cmp    %r13,%r12
+  803123:	73 16                	jae    80313b <msync+0x9a>
+  803125:	48 89 df             	mov    %rbx,%rdi
+  803128:	41 ff d6             	call   *%r14
+  80312b:	84 c0                	test   %al,%al
+  80312d:	74 0c                	je     80313b <msync+0x9a>
+  80312f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803136:	4c 39 eb             	cmp    %r13,%rbx
+  803139:	72 ea                	jb     803125 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  80313b:	48 89 d8             	mov    %rbx,%rax
+  80313e:	4c 29 e0             	sub    %r12,%rax
+  803141:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803145:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803149:	49 89 c0             	mov    %rax,%r8
+  80314c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803150:	ba 00 00 00 00       	mov    $0x0,%edx
+  803155:	48 89 ce             	mov    %rcx,%rsi
+  803158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315d:	49 ba 74 14 80 00 00 	movabs $0x801474,%r10
+  803164:	00 00 00 
+  803167:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  80316a:	85 c0                	test   %eax,%eax
+  80316c:	78 7f                	js     8031ed <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80316e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803175:	00 
+  803176:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80317d:	00 
+  80317e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803185:	00 
+  803186:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80318d:	00 
+  80318e:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803192:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803196:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80319a:	49 2b 07             	sub    (%r15),%rax
+  80319d:	4c 01 e0             	add    %r12,%rax
+  8031a0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031a4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8031a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8031ac:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8031b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8031b5:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  8031bc:	00 00 00 
+  8031bf:	ff d0                	call   *%rax
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 28                	js     8031ed <msync+0x14c>
+  8031c5:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  8031c8:	4d 39 ec             	cmp    %r13,%r12
+  8031cb:	73 1b                	jae    8031e8 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  8031cd:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  8031d1:	4c 89 e7             	mov    %r12,%rdi
+  8031d4:	41 ff d6             	call   *%r14
+  8031d7:	84 c0                	test   %al,%al
+  8031d9:	0f 85 3e ff ff ff    	jne    80311d <msync+0x7c>
+            va += PAGE_SIZE;
+  8031df:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8031e6:	eb e0                	jmp    8031c8 <msync+0x127>
+    }
+
+    return 0;
+  8031e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031ed:	48 83 c4 38          	add    $0x38,%rsp
+  8031f1:	5b                   	pop    %rbx
+  8031f2:	41 5c                	pop    %r12
+  8031f4:	41 5d                	pop    %r13
+  8031f6:	41 5e                	pop    %r14
+  8031f8:	41 5f                	pop    %r15
+  8031fa:	5d                   	pop    %rbp
+  8031fb:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8031fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803201:	eb ea                	jmp    8031ed <msync+0x14c>
+  803203:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803208:	eb e3                	jmp    8031ed <msync+0x14c>
+    return 0;
+  80320a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320f:	eb dc                	jmp    8031ed <msync+0x14c>
+
+0000000000803211 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  803211:	55                   	push   %rbp
+  803212:	48 89 e5             	mov    %rsp,%rbp
+  803215:	41 55                	push   %r13
+  803217:	41 54                	push   %r12
+  803219:	53                   	push   %rbx
+  80321a:	48 83 ec 08          	sub    $0x8,%rsp
+  80321e:	49 89 fc             	mov    %rdi,%r12
+  803221:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803224:	48 b8 67 25 80 00 00 	movabs $0x802567,%rax
+  80322b:	00 00 00 
+  80322e:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803230:	48 85 c0             	test   %rax,%rax
+  803233:	74 58                	je     80328d <munmap+0x7c>
+  803235:	48 89 c3             	mov    %rax,%rbx
+  803238:	4c 3b 20             	cmp    (%rax),%r12
+  80323b:	75 57                	jne    803294 <munmap+0x83>
+  80323d:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803244:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80324a:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  80324e:	75 4b                	jne    80329b <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  803250:	4c 89 ee             	mov    %r13,%rsi
+  803253:	4c 89 e7             	mov    %r12,%rdi
+  803256:	48 b8 a1 30 80 00 00 	movabs $0x8030a1,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803262:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803266:	4c 89 e6             	mov    %r12,%rsi
+  803269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326e:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80327a:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803281:	00 
+    return res;
+}
+  803282:	48 83 c4 08          	add    $0x8,%rsp
+  803286:	5b                   	pop    %rbx
+  803287:	41 5c                	pop    %r12
+  803289:	41 5d                	pop    %r13
+  80328b:	5d                   	pop    %rbp
+  80328c:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80328d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803292:	eb ee                	jmp    803282 <munmap+0x71>
+  803294:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803299:	eb e7                	jmp    803282 <munmap+0x71>
+  80329b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032a0:	eb e0                	jmp    803282 <munmap+0x71>
+
+00000000008032a2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8032a2:	55                   	push   %rbp
+  8032a3:	48 89 e5             	mov    %rsp,%rbp
+  8032a6:	41 54                	push   %r12
+  8032a8:	53                   	push   %rbx
+  8032a9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032ac:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+  8032b8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8032bb:	48 be 60 57 80 00 00 	movabs $0x805760,%rsi
+  8032c2:	00 00 00 
+  8032c5:	48 89 df             	mov    %rbx,%rdi
+  8032c8:	48 b8 5d 0e 80 00 00 	movabs $0x800e5d,%rax
+  8032cf:	00 00 00 
+  8032d2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8032d4:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  8032d9:	41 8b 14 24          	mov    (%r12),%edx
+  8032dd:	29 d0                	sub    %edx,%eax
+  8032df:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8032e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8032ec:	00 00 00 
+    stat->st_dev = &devpipe;
+  8032ef:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8032f6:	00 00 00 
+  8032f9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803300:	b8 00 00 00 00       	mov    $0x0,%eax
+  803305:	5b                   	pop    %rbx
+  803306:	41 5c                	pop    %r12
+  803308:	5d                   	pop    %rbp
+  803309:	c3                   	ret
+
+000000000080330a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+  80330e:	41 55                	push   %r13
+  803310:	41 54                	push   %r12
+  803312:	53                   	push   %rbx
+  803313:	48 83 ec 08          	sub    $0x8,%rsp
+  803317:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80331a:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+  803326:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803329:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80332e:	4c 89 e6             	mov    %r12,%rsi
+  803331:	bf 00 00 00 00       	mov    $0x0,%edi
+  803336:	49 bc 41 15 80 00 00 	movabs $0x801541,%r12
+  80333d:	00 00 00 
+  803340:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803343:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803349:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803350:	bf 00 00 00 00       	mov    $0x0,%edi
+  803355:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803358:	be 00 04 00 00       	mov    $0x400,%esi
+  80335d:	48 89 df             	mov    %rbx,%rdi
+  803360:	49 bd bb 1a 80 00 00 	movabs $0x801abb,%r13
+  803367:	00 00 00 
+  80336a:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  80336d:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803371:	be 00 04 00 00       	mov    $0x400,%esi
+  803376:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803379:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80337e:	48 89 de             	mov    %rbx,%rsi
+  803381:	bf 00 00 00 00       	mov    $0x0,%edi
+  803386:	41 ff d4             	call   *%r12
+}
+  803389:	48 83 c4 08          	add    $0x8,%rsp
+  80338d:	5b                   	pop    %rbx
+  80338e:	41 5c                	pop    %r12
+  803390:	41 5d                	pop    %r13
+  803392:	5d                   	pop    %rbp
+  803393:	c3                   	ret
+
+0000000000803394 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803398:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80339e:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8033a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033aa:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8033b1:	00 00 00 
+  8033b4:	ff d0                	call   *%rax
+  8033b6:	85 c0                	test   %eax,%eax
+  8033b8:	0f 94 c0             	sete   %al
+  8033bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8033be:	5d                   	pop    %rbp
+  8033bf:	c3                   	ret
+
+00000000008033c0 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8033c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033c5:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8033c7:	8b 07                	mov    (%rdi),%eax
+  8033c9:	39 f0                	cmp    %esi,%eax
+  8033cb:	74 01                	je     8033ce <pipe_wait+0xe>
+  8033cd:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8033d2:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8033d4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8033d8:	89 c0                	mov    %eax,%eax
+  8033da:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  8033dd:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  8033e4:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  8033eb:	00 00 00 
+  8033ee:	ff d0                	call   *%rax
+}
+  8033f0:	5d                   	pop    %rbp
+  8033f1:	c3                   	ret
+
+00000000008033f2 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8033f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f7:	87 06                	xchg   %eax,(%rsi)
+  8033f9:	85 c0                	test   %eax,%eax
+  8033fb:	75 01                	jne    8033fe <pipe_wake+0xc>
+  8033fd:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8033fe:	55                   	push   %rbp
+  8033ff:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803402:	be 00 04 00 00       	mov    $0x400,%esi
+  803407:	48 b8 bb 1a 80 00 00 	movabs $0x801abb,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+}
+  803413:	5d                   	pop    %rbp
+  803414:	c3                   	ret
+
+0000000000803415 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+  803419:	41 57                	push   %r15
+  80341b:	41 56                	push   %r14
+  80341d:	41 55                	push   %r13
+  80341f:	41 54                	push   %r12
+  803421:	53                   	push   %rbx
+  803422:	48 83 ec 28          	sub    $0x28,%rsp
+  803426:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80342a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80342e:	48 89 d3             	mov    %rdx,%rbx
+  803431:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803435:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80343c:	00 00 00 
+  80343f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803441:	48 85 db             	test   %rbx,%rbx
+  803444:	0f 84 0f 01 00 00    	je     803559 <devpipe_write+0x144>
+  80344a:	49 89 c4             	mov    %rax,%r12
+  80344d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803453:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80345a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80345e:	eb 4f                	jmp    8034af <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803460:	4c 89 e6             	mov    %r12,%rsi
+  803463:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803467:	48 b8 94 33 80 00 00 	movabs $0x803394,%rax
+  80346e:	00 00 00 
+  803471:	ff d0                	call   *%rax
+  803473:	85 c0                	test   %eax,%eax
+  803475:	74 14                	je     80348b <devpipe_write+0x76>
+  803477:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80347c:	48 83 c4 28          	add    $0x28,%rsp
+  803480:	5b                   	pop    %rbx
+  803481:	41 5c                	pop    %r12
+  803483:	41 5d                	pop    %r13
+  803485:	41 5e                	pop    %r14
+  803487:	41 5f                	pop    %r15
+  803489:	5d                   	pop    %rbp
+  80348a:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80348b:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803490:	44 89 ee             	mov    %r13d,%esi
+  803493:	4c 89 e7             	mov    %r12,%rdi
+  803496:	48 b8 c0 33 80 00 00 	movabs $0x8033c0,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8034a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034a6:	49 39 c7             	cmp    %rax,%r15
+  8034a9:	0f 83 aa 00 00 00    	jae    803559 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8034af:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8034b4:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8034b8:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8034bf:	00 
+  8034c0:	44 89 f0             	mov    %r14d,%eax
+  8034c3:	44 29 e8             	sub    %r13d,%eax
+  8034c6:	39 d8                	cmp    %ebx,%eax
+  8034c8:	74 96                	je     803460 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8034ca:	89 d8                	mov    %ebx,%eax
+  8034cc:	44 29 f0             	sub    %r14d,%eax
+  8034cf:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8034d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034d7:	4c 29 f8             	sub    %r15,%rax
+  8034da:	49 39 c5             	cmp    %rax,%r13
+  8034dd:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  8034e1:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  8034e4:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8034e7:	89 db                	mov    %ebx,%ebx
+  8034e9:	48 29 c3             	sub    %rax,%rbx
+  8034ec:	4c 39 eb             	cmp    %r13,%rbx
+  8034ef:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8034f3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8034f7:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8034fb:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803502:	00 
+  803503:	48 89 da             	mov    %rbx,%rdx
+  803506:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803512:	4c 89 ea             	mov    %r13,%rdx
+  803515:	48 29 da             	sub    %rbx,%rdx
+  803518:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  80351c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803520:	48 01 ce             	add    %rcx,%rsi
+  803523:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803527:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803533:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803538:	45 01 ee             	add    %r13d,%r14d
+  80353b:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803540:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803545:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  80354c:	00 00 00 
+  80354f:	ff d0                	call   *%rax
+        i += chunk;
+  803551:	4d 01 ef             	add    %r13,%r15
+  803554:	e9 49 ff ff ff       	jmp    8034a2 <devpipe_write+0x8d>
+    return n;
+  803559:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80355d:	e9 1a ff ff ff       	jmp    80347c <devpipe_write+0x67>
+
+0000000000803562 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803562:	55                   	push   %rbp
+  803563:	48 89 e5             	mov    %rsp,%rbp
+  803566:	41 57                	push   %r15
+  803568:	41 56                	push   %r14
+  80356a:	41 55                	push   %r13
+  80356c:	41 54                	push   %r12
+  80356e:	53                   	push   %rbx
+  80356f:	48 83 ec 28          	sub    $0x28,%rsp
+  803573:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803577:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80357b:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80357f:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+  80358b:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80358e:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803592:	49 bf 94 33 80 00 00 	movabs $0x803394,%r15
+  803599:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80359c:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8035a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035a4:	eb 15                	jmp    8035bb <devpipe_read+0x59>
+  8035a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035aa:	89 de                	mov    %ebx,%esi
+  8035ac:	4c 89 f7             	mov    %r14,%rdi
+  8035af:	48 b8 c0 33 80 00 00 	movabs $0x8033c0,%rax
+  8035b6:	00 00 00 
+  8035b9:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8035bb:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8035bf:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8035c2:	41 39 dd             	cmp    %ebx,%r13d
+  8035c5:	75 15                	jne    8035dc <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8035c7:	4c 89 e6             	mov    %r12,%rsi
+  8035ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035ce:	41 ff d7             	call   *%r15
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	74 d1                	je     8035a6 <devpipe_read+0x44>
+  8035d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035da:	eb 7c                	jmp    803658 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  8035dc:	44 29 eb             	sub    %r13d,%ebx
+  8035df:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8035e3:	48 39 c3             	cmp    %rax,%rbx
+  8035e6:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  8035ea:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  8035f1:	00 
+  8035f2:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  8035f6:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  8035f9:	45 89 f6             	mov    %r14d,%r14d
+  8035fc:	49 29 c6             	sub    %rax,%r14
+  8035ff:	49 39 de             	cmp    %rbx,%r14
+  803602:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803606:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80360d:	00 
+  80360e:	4c 89 f2             	mov    %r14,%rdx
+  803611:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803615:	49 bf be 10 80 00 00 	movabs $0x8010be,%r15
+  80361c:	00 00 00 
+  80361f:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803622:	48 89 da             	mov    %rbx,%rdx
+  803625:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803628:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80362f:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803630:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803634:	4c 01 f7             	add    %r14,%rdi
+  803637:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80363a:	41 01 dd             	add    %ebx,%r13d
+  80363d:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803641:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803646:	4c 89 e7             	mov    %r12,%rdi
+  803649:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+    return n;
+  803655:	48 89 d8             	mov    %rbx,%rax
+}
+  803658:	48 83 c4 28          	add    $0x28,%rsp
+  80365c:	5b                   	pop    %rbx
+  80365d:	41 5c                	pop    %r12
+  80365f:	41 5d                	pop    %r13
+  803661:	41 5e                	pop    %r14
+  803663:	41 5f                	pop    %r15
+  803665:	5d                   	pop    %rbp
+  803666:	c3                   	ret
+
+0000000000803667 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803667:	55                   	push   %rbp
+  803668:	48 89 e5             	mov    %rsp,%rbp
+  80366b:	41 57                	push   %r15
+  80366d:	41 56                	push   %r14
+  80366f:	41 55                	push   %r13
+  803671:	41 54                	push   %r12
+  803673:	53                   	push   %rbx
+  803674:	48 83 ec 18          	sub    $0x18,%rsp
+  803678:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80367b:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803682:	0f 86 96 01 00 00    	jbe    80381e <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803688:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80368d:	48 01 db             	add    %rbx,%rbx
+  803690:	48 39 f3             	cmp    %rsi,%rbx
+  803693:	72 f8                	jb     80368d <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803695:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80369c:	0f 87 18 02 00 00    	ja     8038ba <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8036a2:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8036a6:	48 b8 55 1e 80 00 00 	movabs $0x801e55,%rax
+  8036ad:	00 00 00 
+  8036b0:	ff d0                	call   *%rax
+  8036b2:	41 89 c4             	mov    %eax,%r12d
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	0f 88 b6 01 00 00    	js     803873 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8036bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036c7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8036cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036d0:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8036df:	85 c0                	test   %eax,%eax
+  8036e1:	0f 88 8c 01 00 00    	js     803873 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8036e7:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8036eb:	48 b8 55 1e 80 00 00 	movabs $0x801e55,%rax
+  8036f2:	00 00 00 
+  8036f5:	ff d0                	call   *%rax
+  8036f7:	41 89 c4             	mov    %eax,%r12d
+  8036fa:	85 c0                	test   %eax,%eax
+  8036fc:	0f 88 57 01 00 00    	js     803859 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803702:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803707:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80370c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803710:	bf 00 00 00 00       	mov    $0x0,%edi
+  803715:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  80371c:	00 00 00 
+  80371f:	ff d0                	call   *%rax
+  803721:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803724:	85 c0                	test   %eax,%eax
+  803726:	0f 88 2d 01 00 00    	js     803859 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  80372c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803730:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  803737:	00 00 00 
+  80373a:	ff d0                	call   *%rax
+  80373c:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80373f:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803746:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80374b:	4c 89 fa             	mov    %r15,%rdx
+  80374e:	48 89 c6             	mov    %rax,%rsi
+  803751:	bf 00 00 00 00       	mov    $0x0,%edi
+  803756:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  80375d:	00 00 00 
+  803760:	ff d0                	call   *%rax
+  803762:	41 89 c4             	mov    %eax,%r12d
+  803765:	85 c0                	test   %eax,%eax
+  803767:	0f 88 d2 00 00 00    	js     80383f <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  80376d:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803774:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803778:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80377f:	00 00 00 
+  803782:	ff d0                	call   *%rax
+  803784:	48 89 c1             	mov    %rax,%rcx
+  803787:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80378d:	4d 89 f8             	mov    %r15,%r8
+  803790:	ba 00 00 00 00       	mov    $0x0,%edx
+  803795:	4c 89 f6             	mov    %r14,%rsi
+  803798:	bf 00 00 00 00       	mov    $0x0,%edi
+  80379d:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  8037a4:	00 00 00 
+  8037a7:	ff d0                	call   *%rax
+  8037a9:	41 89 c4             	mov    %eax,%r12d
+  8037ac:	85 c0                	test   %eax,%eax
+  8037ae:	78 78                	js     803828 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8037b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037b5:	4c 89 f7             	mov    %r14,%rdi
+  8037b8:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  8037bf:	00 00 00 
+  8037c2:	ff d0                	call   *%rax
+  8037c4:	83 f8 02             	cmp    $0x2,%eax
+  8037c7:	0f 85 b8 00 00 00    	jne    803885 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8037cd:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8037d4:	00 00 
+  8037d6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037da:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8037dc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037e0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8037e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037eb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8037ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8037f1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8037f8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037fc:	48 bb 25 1e 80 00 00 	movabs $0x801e25,%rbx
+  803803:	00 00 00 
+  803806:	ff d3                	call   *%rbx
+  803808:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80380c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803810:	ff d3                	call   *%rbx
+  803812:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803816:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80381c:	eb 55                	jmp    803873 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80381e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803823:	e9 7a fe ff ff       	jmp    8036a2 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803828:	4c 89 fa             	mov    %r15,%rdx
+  80382b:	4c 89 f6             	mov    %r14,%rsi
+  80382e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803833:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80383f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803844:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384d:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  803854:	00 00 00 
+  803857:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803859:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80385e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803862:	bf 00 00 00 00       	mov    $0x0,%edi
+  803867:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+}
+  803873:	44 89 e0             	mov    %r12d,%eax
+  803876:	48 83 c4 18          	add    $0x18,%rsp
+  80387a:	5b                   	pop    %rbx
+  80387b:	41 5c                	pop    %r12
+  80387d:	41 5d                	pop    %r13
+  80387f:	41 5e                	pop    %r14
+  803881:	41 5f                	pop    %r15
+  803883:	5d                   	pop    %rbp
+  803884:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803885:	48 b9 90 57 80 00 00 	movabs $0x805790,%rcx
+  80388c:	00 00 00 
+  80388f:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  803896:	00 00 00 
+  803899:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80389e:	48 bf 7c 57 80 00 00 	movabs $0x80577c,%rdi
+  8038a5:	00 00 00 
+  8038a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ad:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  8038b4:	00 00 00 
+  8038b7:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8038ba:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8038c0:	eb b1                	jmp    803873 <pipe_sized+0x20c>
+
+00000000008038c2 <pipe>:
+pipe(int pfd[2]) {
+  8038c2:	55                   	push   %rbp
+  8038c3:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8038c6:	be 00 00 01 00       	mov    $0x10000,%esi
+  8038cb:	48 b8 67 36 80 00 00 	movabs $0x803667,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+}
+  8038d7:	5d                   	pop    %rbp
+  8038d8:	c3                   	ret
+
+00000000008038d9 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8038d9:	55                   	push   %rbp
+  8038da:	48 89 e5             	mov    %rsp,%rbp
+  8038dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8038e1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038e5:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  8038ec:	00 00 00 
+  8038ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038f1:	85 c0                	test   %eax,%eax
+  8038f3:	78 23                	js     803918 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8038f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038f9:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  803900:	00 00 00 
+  803903:	ff d0                	call   *%rax
+  803905:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803908:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80390c:	48 b8 94 33 80 00 00 	movabs $0x803394,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+}
+  803918:	c9                   	leave
+  803919:	c3                   	ret
+
+000000000080391a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80391a:	48 89 f8             	mov    %rdi,%rax
+  80391d:	48 c1 e8 27          	shr    $0x27,%rax
+  803921:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803928:	7f 00 00 
+  80392b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80392f:	f6 c2 01             	test   $0x1,%dl
+  803932:	74 6d                	je     8039a1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803934:	48 89 f8             	mov    %rdi,%rax
+  803937:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80393b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803942:	7f 00 00 
+  803945:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803949:	f6 c2 01             	test   $0x1,%dl
+  80394c:	74 62                	je     8039b0 <get_uvpt_entry+0x96>
+  80394e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803955:	7f 00 00 
+  803958:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80395c:	f6 c2 80             	test   $0x80,%dl
+  80395f:	75 4f                	jne    8039b0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803961:	48 89 f8             	mov    %rdi,%rax
+  803964:	48 c1 e8 15          	shr    $0x15,%rax
+  803968:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80396f:	7f 00 00 
+  803972:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803976:	f6 c2 01             	test   $0x1,%dl
+  803979:	74 44                	je     8039bf <get_uvpt_entry+0xa5>
+  80397b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803982:	7f 00 00 
+  803985:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803989:	f6 c2 80             	test   $0x80,%dl
+  80398c:	75 31                	jne    8039bf <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80398e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803992:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803999:	7f 00 00 
+  80399c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8039a0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039a1:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039a8:	7f 00 00 
+  8039ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039af:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039b0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039b7:	7f 00 00 
+  8039ba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039be:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8039bf:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8039c6:	7f 00 00 
+  8039c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039cd:	c3                   	ret
+
+00000000008039ce <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8039ce:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8039d1:	48 89 f9             	mov    %rdi,%rcx
+  8039d4:	48 c1 e9 27          	shr    $0x27,%rcx
+  8039d8:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8039df:	7f 00 00 
+  8039e2:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8039e6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8039ed:	f6 c1 01             	test   $0x1,%cl
+  8039f0:	0f 84 b2 00 00 00    	je     803aa8 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8039f6:	48 89 f9             	mov    %rdi,%rcx
+  8039f9:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8039fd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803a04:	7f 00 00 
+  803a07:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803a0b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a12:	40 f6 c6 01          	test   $0x1,%sil
+  803a16:	0f 84 8c 00 00 00    	je     803aa8 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803a1c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803a23:	7f 00 00 
+  803a26:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a2a:	a8 80                	test   $0x80,%al
+  803a2c:	75 7b                	jne    803aa9 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803a2e:	48 89 f9             	mov    %rdi,%rcx
+  803a31:	48 c1 e9 15          	shr    $0x15,%rcx
+  803a35:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803a3c:	7f 00 00 
+  803a3f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803a43:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803a4a:	40 f6 c6 01          	test   $0x1,%sil
+  803a4e:	74 58                	je     803aa8 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803a50:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803a57:	7f 00 00 
+  803a5a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a5e:	a8 80                	test   $0x80,%al
+  803a60:	75 6c                	jne    803ace <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803a62:	48 89 f9             	mov    %rdi,%rcx
+  803a65:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803a69:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a70:	7f 00 00 
+  803a73:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803a77:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803a7e:	40 f6 c6 01          	test   $0x1,%sil
+  803a82:	74 24                	je     803aa8 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803a84:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a8b:	7f 00 00 
+  803a8e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a92:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803a99:	ff ff 7f 
+  803a9c:	48 21 c8             	and    %rcx,%rax
+  803a9f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803aa5:	48 09 d0             	or     %rdx,%rax
+}
+  803aa8:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803aa9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ab0:	7f 00 00 
+  803ab3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ab7:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803abe:	ff ff 7f 
+  803ac1:	48 21 c8             	and    %rcx,%rax
+  803ac4:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803aca:	48 01 d0             	add    %rdx,%rax
+  803acd:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803ace:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ad5:	7f 00 00 
+  803ad8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803adc:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ae3:	ff ff 7f 
+  803ae6:	48 21 c8             	and    %rcx,%rax
+  803ae9:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803aef:	48 01 d0             	add    %rdx,%rax
+  803af2:	c3                   	ret
+
+0000000000803af3 <get_prot>:
+
+int
+get_prot(void *va) {
+  803af3:	55                   	push   %rbp
+  803af4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803af7:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803afe:	00 00 00 
+  803b01:	ff d0                	call   *%rax
+  803b03:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803b06:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803b0b:	89 c1                	mov    %eax,%ecx
+  803b0d:	83 c9 04             	or     $0x4,%ecx
+  803b10:	f6 c2 01             	test   $0x1,%dl
+  803b13:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803b16:	89 c1                	mov    %eax,%ecx
+  803b18:	83 c9 02             	or     $0x2,%ecx
+  803b1b:	f6 c2 02             	test   $0x2,%dl
+  803b1e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803b21:	89 c1                	mov    %eax,%ecx
+  803b23:	83 c9 01             	or     $0x1,%ecx
+  803b26:	48 85 d2             	test   %rdx,%rdx
+  803b29:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803b2c:	89 c1                	mov    %eax,%ecx
+  803b2e:	83 c9 40             	or     $0x40,%ecx
+  803b31:	f6 c6 04             	test   $0x4,%dh
+  803b34:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803b37:	5d                   	pop    %rbp
+  803b38:	c3                   	ret
+
+0000000000803b39 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803b39:	55                   	push   %rbp
+  803b3a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b3d:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803b44:	00 00 00 
+  803b47:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803b49:	48 c1 e8 06          	shr    $0x6,%rax
+  803b4d:	83 e0 01             	and    $0x1,%eax
+}
+  803b50:	5d                   	pop    %rbp
+  803b51:	c3                   	ret
+
+0000000000803b52 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803b52:	55                   	push   %rbp
+  803b53:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803b56:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803b5d:	00 00 00 
+  803b60:	ff d0                	call   *%rax
+  803b62:	83 e0 01             	and    $0x1,%eax
+}
+  803b65:	5d                   	pop    %rbp
+  803b66:	c3                   	ret
+
+0000000000803b67 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+  803b6b:	41 57                	push   %r15
+  803b6d:	41 56                	push   %r14
+  803b6f:	41 55                	push   %r13
+  803b71:	41 54                	push   %r12
+  803b73:	53                   	push   %rbx
+  803b74:	48 83 ec 18          	sub    $0x18,%rsp
+  803b78:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803b7c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803b80:	48 39 f7             	cmp    %rsi,%rdi
+  803b83:	0f 83 e4 00 00 00    	jae    803c6d <foreach_present_page+0x106>
+  803b89:	49 89 f4             	mov    %rsi,%r12
+  803b8c:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803b8f:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803b96:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803b99:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803ba0:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803ba3:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803baa:	7f 00 00 
+  803bad:	eb 27                	jmp    803bd6 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803baf:	48 89 d8             	mov    %rbx,%rax
+  803bb2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bb6:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803bba:	f6 c2 01             	test   $0x1,%dl
+  803bbd:	75 43                	jne    803c02 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803bbf:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803bc6:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803bcd:	4c 39 e3             	cmp    %r12,%rbx
+  803bd0:	0f 83 83 00 00 00    	jae    803c59 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803bd6:	48 89 d8             	mov    %rbx,%rax
+  803bd9:	48 c1 e8 27          	shr    $0x27,%rax
+  803bdd:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803be2:	a8 01                	test   $0x1,%al
+  803be4:	75 c9                	jne    803baf <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803be6:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803bed:	ff ff ff 
+  803bf0:	48 21 d8             	and    %rbx,%rax
+  803bf3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803bfa:	00 00 00 
+  803bfd:	48 01 c3             	add    %rax,%rbx
+  803c00:	eb cb                	jmp    803bcd <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803c02:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803c06:	a8 80                	test   $0x80,%al
+  803c08:	75 1f                	jne    803c29 <foreach_present_page+0xc2>
+  803c0a:	48 89 d8             	mov    %rbx,%rax
+  803c0d:	48 c1 e8 15          	shr    $0x15,%rax
+  803c11:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803c15:	a8 01                	test   $0x1,%al
+  803c17:	75 10                	jne    803c29 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803c19:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803c20:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803c27:	eb a4                	jmp    803bcd <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803c29:	48 89 df             	mov    %rbx,%rdi
+  803c2c:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803c33:	00 00 00 
+  803c36:	ff d0                	call   *%rax
+  803c38:	a8 01                	test   $0x1,%al
+  803c3a:	74 11                	je     803c4d <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803c3c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c40:	48 89 df             	mov    %rbx,%rdi
+  803c43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c47:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803c49:	85 c0                	test   %eax,%eax
+  803c4b:	78 11                	js     803c5e <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803c4d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c54:	e9 74 ff ff ff       	jmp    803bcd <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803c59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c5e:	48 83 c4 18          	add    $0x18,%rsp
+  803c62:	5b                   	pop    %rbx
+  803c63:	41 5c                	pop    %r12
+  803c65:	41 5d                	pop    %r13
+  803c67:	41 5e                	pop    %r14
+  803c69:	41 5f                	pop    %r15
+  803c6b:	5d                   	pop    %rbp
+  803c6c:	c3                   	ret
+    return 0;
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c72:	eb ea                	jmp    803c5e <foreach_present_page+0xf7>
+
+0000000000803c74 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803c74:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c7b:	7f 00 00 
+  803c7e:	a8 01                	test   $0x1,%al
+  803c80:	75 06                	jne    803c88 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c87:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+  803c8c:	41 57                	push   %r15
+  803c8e:	41 56                	push   %r14
+  803c90:	41 55                	push   %r13
+  803c92:	41 54                	push   %r12
+  803c94:	53                   	push   %rbx
+  803c95:	48 83 ec 28          	sub    $0x28,%rsp
+  803c99:	49 89 fe             	mov    %rdi,%r14
+  803c9c:	49 89 f7             	mov    %rsi,%r15
+  803c9f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803ca6:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803ca7:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803cae:	7f 00 00 
+  803cb1:	e9 b0 00 00 00       	jmp    803d66 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803cb6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cbd:	49 83 ec 01          	sub    $0x1,%r12
+  803cc1:	74 2d                	je     803cf0 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803cc3:	48 89 d8             	mov    %rbx,%rax
+  803cc6:	48 c1 e8 0c          	shr    $0xc,%rax
+  803cca:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803ccf:	f6 c2 01             	test   $0x1,%dl
+  803cd2:	74 e2                	je     803cb6 <foreach_shared_region+0x42>
+  803cd4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803cd9:	f6 c4 04             	test   $0x4,%ah
+  803cdc:	74 d8                	je     803cb6 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803cde:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803ce5:	4c 89 fa             	mov    %r15,%rdx
+  803ce8:	48 89 df             	mov    %rbx,%rdi
+  803ceb:	41 ff d6             	call   *%r14
+  803cee:	eb c6                	jmp    803cb6 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803cf0:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803cf7:	00 
+  803cf8:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803cfd:	74 4c                	je     803d4b <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803cff:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803d03:	48 89 c8             	mov    %rcx,%rax
+  803d06:	48 c1 e8 15          	shr    $0x15,%rax
+  803d0a:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803d11:	7f 00 00 
+  803d14:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803d18:	a8 01                	test   $0x1,%al
+  803d1a:	74 d4                	je     803cf0 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803d1c:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803d23:	48 39 c1             	cmp    %rax,%rcx
+  803d26:	73 c8                	jae    803cf0 <foreach_shared_region+0x7c>
+  803d28:	48 89 cb             	mov    %rcx,%rbx
+  803d2b:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803d32:	48 39 d0             	cmp    %rdx,%rax
+  803d35:	4d 19 e4             	sbb    %r12,%r12
+  803d38:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d3f:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d46:	e9 78 ff ff ff       	jmp    803cc3 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803d4b:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803d52:	40 
+  803d53:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d57:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d5e:	00 00 00 
+  803d61:	48 39 c1             	cmp    %rax,%rcx
+  803d64:	74 4f                	je     803db5 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803d66:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d6a:	48 89 c8             	mov    %rcx,%rax
+  803d6d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d71:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803d78:	7f 00 00 
+  803d7b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803d7f:	a8 01                	test   $0x1,%al
+  803d81:	74 c8                	je     803d4b <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803d83:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803d8a:	48 39 c1             	cmp    %rax,%rcx
+  803d8d:	73 bc                	jae    803d4b <foreach_shared_region+0xd7>
+  803d8f:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803d96:	48 39 d0             	cmp    %rdx,%rax
+  803d99:	48 19 c0             	sbb    %rax,%rax
+  803d9c:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803da2:	48 05 00 02 00 00    	add    $0x200,%rax
+  803da8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803db0:	e9 4a ff ff ff       	jmp    803cff <foreach_shared_region+0x8b>
+}
+  803db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dba:	48 83 c4 28          	add    $0x28,%rsp
+  803dbe:	5b                   	pop    %rbx
+  803dbf:	41 5c                	pop    %r12
+  803dc1:	41 5d                	pop    %r13
+  803dc3:	41 5e                	pop    %r14
+  803dc5:	41 5f                	pop    %r15
+  803dc7:	5d                   	pop    %rbp
+  803dc8:	c3                   	ret
+
+0000000000803dc9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dce:	c3                   	ret
+
+0000000000803dcf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803dcf:	55                   	push   %rbp
+  803dd0:	48 89 e5             	mov    %rsp,%rbp
+  803dd3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803dd6:	48 be b4 57 80 00 00 	movabs $0x8057b4,%rsi
+  803ddd:	00 00 00 
+  803de0:	48 b8 5d 0e 80 00 00 	movabs $0x800e5d,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+    return 0;
+}
+  803dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df1:	5d                   	pop    %rbp
+  803df2:	c3                   	ret
+
+0000000000803df3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803df3:	55                   	push   %rbp
+  803df4:	48 89 e5             	mov    %rsp,%rbp
+  803df7:	41 57                	push   %r15
+  803df9:	41 56                	push   %r14
+  803dfb:	41 55                	push   %r13
+  803dfd:	41 54                	push   %r12
+  803dff:	53                   	push   %rbx
+  803e00:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803e07:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803e0e:	48 85 d2             	test   %rdx,%rdx
+  803e11:	74 7a                	je     803e8d <devcons_write+0x9a>
+  803e13:	49 89 d6             	mov    %rdx,%r14
+  803e16:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e1c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803e21:	49 bf 57 10 80 00 00 	movabs $0x801057,%r15
+  803e28:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803e2b:	4c 89 f3             	mov    %r14,%rbx
+  803e2e:	48 29 f3             	sub    %rsi,%rbx
+  803e31:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803e36:	48 39 c3             	cmp    %rax,%rbx
+  803e39:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803e3d:	4c 63 eb             	movslq %ebx,%r13
+  803e40:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803e47:	48 01 c6             	add    %rax,%rsi
+  803e4a:	4c 89 ea             	mov    %r13,%rdx
+  803e4d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803e54:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803e57:	4c 89 ee             	mov    %r13,%rsi
+  803e5a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803e61:	48 b8 84 12 80 00 00 	movabs $0x801284,%rax
+  803e68:	00 00 00 
+  803e6b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803e6d:	41 01 dc             	add    %ebx,%r12d
+  803e70:	49 63 f4             	movslq %r12d,%rsi
+  803e73:	4c 39 f6             	cmp    %r14,%rsi
+  803e76:	72 b3                	jb     803e2b <devcons_write+0x38>
+    return res;
+  803e78:	49 63 c4             	movslq %r12d,%rax
+}
+  803e7b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803e82:	5b                   	pop    %rbx
+  803e83:	41 5c                	pop    %r12
+  803e85:	41 5d                	pop    %r13
+  803e87:	41 5e                	pop    %r14
+  803e89:	41 5f                	pop    %r15
+  803e8b:	5d                   	pop    %rbp
+  803e8c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803e8d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e93:	eb e3                	jmp    803e78 <devcons_write+0x85>
+
+0000000000803e95 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e95:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e9d:	48 85 c0             	test   %rax,%rax
+  803ea0:	74 60                	je     803f02 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ea2:	55                   	push   %rbp
+  803ea3:	48 89 e5             	mov    %rsp,%rbp
+  803ea6:	41 55                	push   %r13
+  803ea8:	41 54                	push   %r12
+  803eaa:	53                   	push   %rbx
+  803eab:	48 83 ec 18          	sub    $0x18,%rsp
+  803eaf:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803eb2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803eb9:	48 bb b1 12 80 00 00 	movabs $0x8012b1,%rbx
+  803ec0:	00 00 00 
+  803ec3:	49 bc 0e 44 80 00 00 	movabs $0x80440e,%r12
+  803eca:	00 00 00 
+  803ecd:	eb 07                	jmp    803ed6 <devcons_read+0x41>
+  803ecf:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803ed3:	41 ff d4             	call   *%r12
+  803ed6:	ff d3                	call   *%rbx
+  803ed8:	85 c0                	test   %eax,%eax
+  803eda:	74 f3                	je     803ecf <devcons_read+0x3a>
+    if (c < 0) return c;
+  803edc:	48 63 d0             	movslq %eax,%rdx
+  803edf:	78 13                	js     803ef4 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ee6:	83 f8 04             	cmp    $0x4,%eax
+  803ee9:	74 09                	je     803ef4 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803eeb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803eef:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803ef4:	48 89 d0             	mov    %rdx,%rax
+  803ef7:	48 83 c4 18          	add    $0x18,%rsp
+  803efb:	5b                   	pop    %rbx
+  803efc:	41 5c                	pop    %r12
+  803efe:	41 5d                	pop    %r13
+  803f00:	5d                   	pop    %rbp
+  803f01:	c3                   	ret
+  803f02:	48 89 d0             	mov    %rdx,%rax
+  803f05:	c3                   	ret
+
+0000000000803f06 <cputchar>:
+cputchar(int ch) {
+  803f06:	55                   	push   %rbp
+  803f07:	48 89 e5             	mov    %rsp,%rbp
+  803f0a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803f0e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803f12:	be 01 00 00 00       	mov    $0x1,%esi
+  803f17:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803f1b:	48 b8 84 12 80 00 00 	movabs $0x801284,%rax
+  803f22:	00 00 00 
+  803f25:	ff d0                	call   *%rax
+}
+  803f27:	c9                   	leave
+  803f28:	c3                   	ret
+
+0000000000803f29 <getchar>:
+getchar(void) {
+  803f29:	55                   	push   %rbp
+  803f2a:	48 89 e5             	mov    %rsp,%rbp
+  803f2d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803f31:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f36:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803f3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f3f:	48 b8 d4 21 80 00 00 	movabs $0x8021d4,%rax
+  803f46:	00 00 00 
+  803f49:	ff d0                	call   *%rax
+  803f4b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803f4d:	85 c0                	test   %eax,%eax
+  803f4f:	78 06                	js     803f57 <getchar+0x2e>
+  803f51:	74 08                	je     803f5b <getchar+0x32>
+  803f53:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803f57:	89 d0                	mov    %edx,%eax
+  803f59:	c9                   	leave
+  803f5a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803f5b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803f60:	eb f5                	jmp    803f57 <getchar+0x2e>
+
+0000000000803f62 <iscons>:
+iscons(int fdnum) {
+  803f62:	55                   	push   %rbp
+  803f63:	48 89 e5             	mov    %rsp,%rbp
+  803f66:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f6a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f6e:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  803f75:	00 00 00 
+  803f78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f7a:	85 c0                	test   %eax,%eax
+  803f7c:	78 18                	js     803f96 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803f7e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f82:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803f89:	00 00 00 
+  803f8c:	8b 00                	mov    (%rax),%eax
+  803f8e:	39 02                	cmp    %eax,(%rdx)
+  803f90:	0f 94 c0             	sete   %al
+  803f93:	0f b6 c0             	movzbl %al,%eax
+}
+  803f96:	c9                   	leave
+  803f97:	c3                   	ret
+
+0000000000803f98 <opencons>:
+opencons(void) {
+  803f98:	55                   	push   %rbp
+  803f99:	48 89 e5             	mov    %rsp,%rbp
+  803f9c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803fa0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803fa4:	48 b8 55 1e 80 00 00 	movabs $0x801e55,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+  803fb0:	85 c0                	test   %eax,%eax
+  803fb2:	78 49                	js     803ffd <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803fb4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fbe:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc7:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+  803fd3:	85 c0                	test   %eax,%eax
+  803fd5:	78 26                	js     803ffd <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803fd7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fdb:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803fe2:	00 00 
+  803fe4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803fe6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fea:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803ff1:	48 b8 25 1e 80 00 00 	movabs $0x801e25,%rax
+  803ff8:	00 00 00 
+  803ffb:	ff d0                	call   *%rax
+}
+  803ffd:	c9                   	leave
+  803ffe:	c3                   	ret
+
+0000000000803fff <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803fff:	55                   	push   %rbp
+  804000:	48 89 e5             	mov    %rsp,%rbp
+  804003:	41 55                	push   %r13
+  804005:	41 54                	push   %r12
+  804007:	53                   	push   %rbx
+  804008:	48 83 ec 08          	sub    $0x8,%rsp
+  80400c:	49 89 fc             	mov    %rdi,%r12
+  80400f:	48 89 f7             	mov    %rsi,%rdi
+  804012:	48 89 d3             	mov    %rdx,%rbx
+  804015:	49 89 cd             	mov    %rcx,%r13
+  804018:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80401b:	48 85 f6             	test   %rsi,%rsi
+  80401e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804025:	00 00 00 
+  804028:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  80402c:	be 00 00 00 00       	mov    $0x0,%esi
+  804031:	48 85 db             	test   %rbx,%rbx
+  804034:	74 03                	je     804039 <ipc_recv_timeout+0x3a>
+  804036:	48 8b 33             	mov    (%rbx),%rsi
+  804039:	48 b8 a2 19 80 00 00 	movabs $0x8019a2,%rax
+  804040:	00 00 00 
+  804043:	ff d0                	call   *%rax
+    if (res == 0) {
+  804045:	85 c0                	test   %eax,%eax
+  804047:	75 72                	jne    8040bb <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804049:	4d 85 e4             	test   %r12,%r12
+  80404c:	74 17                	je     804065 <ipc_recv_timeout+0x66>
+  80404e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804055:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804057:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80405b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804061:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804065:	4d 85 ed             	test   %r13,%r13
+  804068:	74 17                	je     804081 <ipc_recv_timeout+0x82>
+  80406a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804071:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804073:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804077:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80407d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804081:	48 85 db             	test   %rbx,%rbx
+  804084:	74 17                	je     80409d <ipc_recv_timeout+0x9e>
+  804086:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80408d:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80408f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804093:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80409a:	48 89 03             	mov    %rax,(%rbx)
+  80409d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040a4:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  8040a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040aa:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  8040b0:	48 83 c4 08          	add    $0x8,%rsp
+  8040b4:	5b                   	pop    %rbx
+  8040b5:	41 5c                	pop    %r12
+  8040b7:	41 5d                	pop    %r13
+  8040b9:	5d                   	pop    %rbp
+  8040ba:	c3                   	ret
+        if (from_env_store) {
+  8040bb:	4d 85 e4             	test   %r12,%r12
+  8040be:	74 08                	je     8040c8 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  8040c0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8040c7:	00 
+        if (perm_store) {
+  8040c8:	4d 85 ed             	test   %r13,%r13
+  8040cb:	74 08                	je     8040d5 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  8040cd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8040d4:	00 
+        if (size) {
+  8040d5:	48 85 db             	test   %rbx,%rbx
+  8040d8:	74 d6                	je     8040b0 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  8040da:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8040e1:	eb cd                	jmp    8040b0 <ipc_recv_timeout+0xb1>
+
+00000000008040e3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040e3:	55                   	push   %rbp
+  8040e4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  8040e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8040ed:	48 b8 ff 3f 80 00 00 	movabs $0x803fff,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+}
+  8040f9:	5d                   	pop    %rbp
+  8040fa:	c3                   	ret
+
+00000000008040fb <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8040fb:	55                   	push   %rbp
+  8040fc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8040ff:	48 85 d2             	test   %rdx,%rdx
+  804102:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804109:	00 00 00 
+  80410c:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804110:	89 f6                	mov    %esi,%esi
+  804112:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804118:	48 b8 0e 18 80 00 00 	movabs $0x80180e,%rax
+  80411f:	00 00 00 
+  804122:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804124:	85 c0                	test   %eax,%eax
+  804126:	78 02                	js     80412a <ipc_send+0x2f>
+}
+  804128:	5d                   	pop    %rbp
+  804129:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  80412a:	89 c1                	mov    %eax,%ecx
+  80412c:	48 ba c0 57 80 00 00 	movabs $0x8057c0,%rdx
+  804133:	00 00 00 
+  804136:	be 51 00 00 00       	mov    $0x51,%esi
+  80413b:	48 bf d7 57 80 00 00 	movabs $0x8057d7,%rdi
+  804142:	00 00 00 
+  804145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414a:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  804151:	00 00 00 
+  804154:	41 ff d0             	call   *%r8
+
+0000000000804157 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804157:	55                   	push   %rbp
+  804158:	48 89 e5             	mov    %rsp,%rbp
+  80415b:	41 54                	push   %r12
+  80415d:	53                   	push   %rbx
+  80415e:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804162:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804166:	48 85 d2             	test   %rdx,%rdx
+  804169:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804170:	00 00 00 
+  804173:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804177:	4d 85 c9             	test   %r9,%r9
+  80417a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80417e:	89 f6                	mov    %esi,%esi
+  804180:	48 83 ec 08          	sub    $0x8,%rsp
+  804184:	53                   	push   %rbx
+  804185:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  80418c:	00 00 00 
+  80418f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804191:	48 83 c4 10          	add    $0x10,%rsp
+  804195:	85 c0                	test   %eax,%eax
+  804197:	78 65                	js     8041fe <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804199:	4d 85 e4             	test   %r12,%r12
+  80419c:	74 17                	je     8041b5 <ipc_call+0x5e>
+  80419e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041a5:	00 00 
+  8041a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041ab:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8041b1:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8041b5:	48 85 db             	test   %rbx,%rbx
+  8041b8:	74 28                	je     8041e2 <ipc_call+0x8b>
+  8041ba:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041c1:	00 00 
+  8041c3:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8041c7:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8041ce:	ba 20 00 00 00       	mov    $0x20,%edx
+  8041d3:	48 89 df             	mov    %rbx,%rdi
+  8041d6:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  8041dd:	00 00 00 
+  8041e0:	ff d0                	call   *%rax
+  8041e2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8041e9:	00 00 
+    return thisenv->env_ipc_value;
+  8041eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041ef:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8041f5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8041f9:	5b                   	pop    %rbx
+  8041fa:	41 5c                	pop    %r12
+  8041fc:	5d                   	pop    %rbp
+  8041fd:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8041fe:	89 c1                	mov    %eax,%ecx
+  804200:	48 ba e1 57 80 00 00 	movabs $0x8057e1,%rdx
+  804207:	00 00 00 
+  80420a:	be 62 00 00 00       	mov    $0x62,%esi
+  80420f:	48 bf d7 57 80 00 00 	movabs $0x8057d7,%rdi
+  804216:	00 00 00 
+  804219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421e:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  804225:	00 00 00 
+  804228:	41 ff d0             	call   *%r8
+
+000000000080422b <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80422b:	55                   	push   %rbp
+  80422c:	48 89 e5             	mov    %rsp,%rbp
+  80422f:	41 57                	push   %r15
+  804231:	41 56                	push   %r14
+  804233:	41 55                	push   %r13
+  804235:	41 54                	push   %r12
+  804237:	53                   	push   %rbx
+  804238:	48 83 ec 20          	sub    $0x20,%rsp
+  80423c:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80423f:	48 89 d3             	mov    %rdx,%rbx
+  804242:	49 89 ce             	mov    %rcx,%r14
+  804245:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804249:	4d 89 cd             	mov    %r9,%r13
+  80424c:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804250:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804254:	48 85 d2             	test   %rdx,%rdx
+  804257:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80425e:	00 00 00 
+  804261:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804265:	4d 85 e4             	test   %r12,%r12
+  804268:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80426c:	89 f0                	mov    %esi,%eax
+  80426e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804272:	41 57                	push   %r15
+  804274:	4d 89 e1             	mov    %r12,%r9
+  804277:	48 89 da             	mov    %rbx,%rdx
+  80427a:	48 89 c6             	mov    %rax,%rsi
+  80427d:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  804284:	00 00 00 
+  804287:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804289:	48 83 c4 10          	add    $0x10,%rsp
+  80428d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804290:	0f 84 93 00 00 00    	je     804329 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804296:	85 c0                	test   %eax,%eax
+  804298:	0f 88 f3 00 00 00    	js     804391 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80429e:	4d 85 ed             	test   %r13,%r13
+  8042a1:	74 17                	je     8042ba <ipc_reply_wait+0x8f>
+  8042a3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042aa:	00 00 
+  8042ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042b0:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8042b6:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8042ba:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8042bf:	74 19                	je     8042da <ipc_reply_wait+0xaf>
+  8042c1:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042c8:	00 00 
+  8042ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042ce:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8042d4:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8042d8:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8042da:	4d 85 ff             	test   %r15,%r15
+  8042dd:	74 28                	je     804307 <ipc_reply_wait+0xdc>
+  8042df:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8042e6:	00 00 
+  8042e8:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8042ec:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8042f3:	ba 20 00 00 00       	mov    $0x20,%edx
+  8042f8:	4c 89 ff             	mov    %r15,%rdi
+  8042fb:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  804302:	00 00 00 
+  804305:	ff d0                	call   *%rax
+  804307:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80430e:	00 00 
+    return thisenv->env_ipc_value;
+  804310:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804314:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80431a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80431e:	5b                   	pop    %rbx
+  80431f:	41 5c                	pop    %r12
+  804321:	41 5d                	pop    %r13
+  804323:	41 5e                	pop    %r14
+  804325:	41 5f                	pop    %r15
+  804327:	5d                   	pop    %rbp
+  804328:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804329:	4d 89 f9             	mov    %r15,%r9
+  80432c:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804330:	4c 89 f1             	mov    %r14,%rcx
+  804333:	48 89 da             	mov    %rbx,%rdx
+  804336:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80433a:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80433d:	48 b8 0e 18 80 00 00 	movabs $0x80180e,%rax
+  804344:	00 00 00 
+  804347:	ff d0                	call   *%rax
+  804349:	85 c0                	test   %eax,%eax
+  80434b:	78 17                	js     804364 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80434d:	4c 89 f6             	mov    %r14,%rsi
+  804350:	4c 89 e7             	mov    %r12,%rdi
+  804353:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  80435a:	00 00 00 
+  80435d:	ff d0                	call   *%rax
+  80435f:	e9 32 ff ff ff       	jmp    804296 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804364:	89 c1                	mov    %eax,%ecx
+  804366:	48 ba c0 57 80 00 00 	movabs $0x8057c0,%rdx
+  80436d:	00 00 00 
+  804370:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804375:	48 bf d7 57 80 00 00 	movabs $0x8057d7,%rdi
+  80437c:	00 00 00 
+  80437f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804384:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  80438b:	00 00 00 
+  80438e:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804391:	89 c1                	mov    %eax,%ecx
+  804393:	48 ba f8 57 80 00 00 	movabs $0x8057f8,%rdx
+  80439a:	00 00 00 
+  80439d:	be 7d 00 00 00       	mov    $0x7d,%esi
+  8043a2:	48 bf d7 57 80 00 00 	movabs $0x8057d7,%rdi
+  8043a9:	00 00 00 
+  8043ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b1:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  8043b8:	00 00 00 
+  8043bb:	41 ff d0             	call   *%r8
+
+00000000008043be <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8043be:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8043c3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8043ca:	00 00 00 
+  8043cd:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8043d4:	48 01 ca             	add    %rcx,%rdx
+  8043d7:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8043dd:	39 fa                	cmp    %edi,%edx
+  8043df:	74 12                	je     8043f3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8043e1:	48 83 c0 01          	add    $0x1,%rax
+  8043e5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8043eb:	75 e0                	jne    8043cd <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8043ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043f2:	c3                   	ret
+            return envs[i].env_id;
+  8043f3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8043fa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804401:	00 00 00 
+  804404:	48 01 d0             	add    %rdx,%rax
+  804407:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80440d:	c3                   	ret
+
+000000000080440e <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80440e:	55                   	push   %rbp
+  80440f:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804412:	8b 0f                	mov    (%rdi),%ecx
+  804414:	8d 41 01             	lea    0x1(%rcx),%eax
+  804417:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  804419:	83 f9 07             	cmp    $0x7,%ecx
+  80441c:	76 31                	jbe    80444f <backoff+0x41>
+    asm volatile("rdtsc"
+  80441e:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804420:	83 c1 06             	add    $0x6,%ecx
+  804423:	be 15 00 00 00       	mov    $0x15,%esi
+  804428:	39 f1                	cmp    %esi,%ecx
+  80442a:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80442d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804432:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804435:	48 c1 e2 20          	shl    $0x20,%rdx
+  804439:	89 c0                	mov    %eax,%eax
+  80443b:	48 09 c2             	or     %rax,%rdx
+  80443e:	48 01 d7             	add    %rdx,%rdi
+  804441:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  804448:	00 00 00 
+  80444b:	ff d0                	call   *%rax
+}
+  80444d:	5d                   	pop    %rbp
+  80444e:	c3                   	ret
+        sys_yield();
+  80444f:	48 b8 7e 13 80 00 00 	movabs $0x80137e,%rax
+  804456:	00 00 00 
+  804459:	ff d0                	call   *%rax
+        return;
+  80445b:	eb f0                	jmp    80444d <backoff+0x3f>
+
+000000000080445d <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80445d:	55                   	push   %rbp
+  80445e:	48 89 e5             	mov    %rsp,%rbp
+  804461:	41 55                	push   %r13
+  804463:	41 54                	push   %r12
+  804465:	53                   	push   %rbx
+  804466:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80446a:	85 ff                	test   %edi,%edi
+  80446c:	74 7e                	je     8044ec <wait+0x8f>
+  80446e:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804471:	89 f8                	mov    %edi,%eax
+  804473:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804478:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80447f:	89 f9                	mov    %edi,%ecx
+  804481:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804487:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80448e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804495:	00 00 00 
+  804498:	48 01 ca             	add    %rcx,%rdx
+  80449b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8044a1:	39 d7                	cmp    %edx,%edi
+  8044a3:	75 3c                	jne    8044e1 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  8044a5:	48 98                	cltq
+  8044a7:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8044ae:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8044b5:	00 00 00 
+  8044b8:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  8044bb:	49 bd 0e 44 80 00 00 	movabs $0x80440e,%r13
+  8044c2:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8044c5:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8044cb:	85 c0                	test   %eax,%eax
+  8044cd:	74 12                	je     8044e1 <wait+0x84>
+        backoff(&attempt);
+  8044cf:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8044d3:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8044d6:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8044dc:	44 39 e0             	cmp    %r12d,%eax
+  8044df:	74 e4                	je     8044c5 <wait+0x68>
+    }
+}
+  8044e1:	48 83 c4 18          	add    $0x18,%rsp
+  8044e5:	5b                   	pop    %rbx
+  8044e6:	41 5c                	pop    %r12
+  8044e8:	41 5d                	pop    %r13
+  8044ea:	5d                   	pop    %rbp
+  8044eb:	c3                   	ret
+    assert(envid != 0);
+  8044ec:	48 b9 15 58 80 00 00 	movabs $0x805815,%rcx
+  8044f3:	00 00 00 
+  8044f6:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  8044fd:	00 00 00 
+  804500:	be 22 00 00 00       	mov    $0x22,%esi
+  804505:	48 bf 20 58 80 00 00 	movabs $0x805820,%rdi
+  80450c:	00 00 00 
+  80450f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804514:	49 b8 e8 03 80 00 00 	movabs $0x8003e8,%r8
+  80451b:	00 00 00 
+  80451e:	41 ff d0             	call   *%r8
+
+0000000000804521 <__text_end>:
+  804521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804528:	00 00 00 
+  80452b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804532:	00 00 00 
+  804535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453c:	00 00 00 
+  80453f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804546:	00 00 00 
+  804549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804550:	00 00 00 
+  804553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455a:	00 00 00 
+  80455d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804564:	00 00 00 
+  804567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456e:	00 00 00 
+  804571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804578:	00 00 00 
+  80457b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804582:	00 00 00 
+  804585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458c:	00 00 00 
+  80458f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804596:	00 00 00 
+  804599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a0:	00 00 00 
+  8045a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045aa:	00 00 00 
+  8045ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b4:	00 00 00 
+  8045b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045be:	00 00 00 
+  8045c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c8:	00 00 00 
+  8045cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d2:	00 00 00 
+  8045d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dc:	00 00 00 
+  8045df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e6:	00 00 00 
+  8045e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f0:	00 00 00 
+  8045f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fa:	00 00 00 
+  8045fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804604:	00 00 00 
+  804607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460e:	00 00 00 
+  804611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804618:	00 00 00 
+  80461b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804622:	00 00 00 
+  804625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462c:	00 00 00 
+  80462f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804636:	00 00 00 
+  804639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804640:	00 00 00 
+  804643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464a:	00 00 00 
+  80464d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804654:	00 00 00 
+  804657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465e:	00 00 00 
+  804661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804668:	00 00 00 
+  80466b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804672:	00 00 00 
+  804675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467c:	00 00 00 
+  80467f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804686:	00 00 00 
+  804689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804690:	00 00 00 
+  804693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469a:	00 00 00 
+  80469d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a4:	00 00 00 
+  8046a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ae:	00 00 00 
+  8046b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b8:	00 00 00 
+  8046bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c2:	00 00 00 
+  8046c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cc:	00 00 00 
+  8046cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d6:	00 00 00 
+  8046d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e0:	00 00 00 
+  8046e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ea:	00 00 00 
+  8046ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f4:	00 00 00 
+  8046f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fe:	00 00 00 
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,8299 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 22 42 80 00 00 	movabs $0x804222,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 a0 0e 80 00 00 	movabs $0x800ea0,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be 06 50 80 00 00 	movabs $0x805006,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf 3c 50 80 00 00 	movabs $0x80503c,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba d7 04 80 00 00 	movabs $0x8004d7,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba 57 50 80 00 00 	movabs $0x805057,%rdx
+  800117:	00 00 00 
+  80011a:	48 be 5c 50 80 00 00 	movabs $0x80505c,%rsi
+  800121:	00 00 00 
+  800124:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 51 3a 80 00 00 	movabs $0x803a51,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 22 42 80 00 00 	movabs $0x804222,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 a0 0e 80 00 00 	movabs $0x800ea0,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be 06 50 80 00 00 	movabs $0x805006,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf 73 50 80 00 00 	movabs $0x805073,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba d7 04 80 00 00 	movabs $0x8004d7,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba 0c 50 80 00 00 	movabs $0x80500c,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba 33 50 80 00 00 	movabs $0x805033,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba 69 50 80 00 00 	movabs $0x805069,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	48 83 ec 30          	sub    $0x30,%rsp
+  800286:	41 89 fd             	mov    %edi,%r13d
+  800289:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  80028c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800293:	00 
+  800294:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80029b:	00 
+  80029c:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8002a3:	00 
+  8002a4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8002ab:	00 
+  8002ac:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002b0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8002b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b9:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002c5:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8002cc:	00 00 00 
+  8002cf:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8002d6:	00 00 00 
+  8002d9:	48 39 c2             	cmp    %rax,%rdx
+  8002dc:	73 17                	jae    8002f5 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8002de:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002e1:	49 89 c4             	mov    %rax,%r12
+  8002e4:	48 83 c3 08          	add    $0x8,%rbx
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	ff 53 f8             	call   *-0x8(%rbx)
+  8002f0:	4c 39 e3             	cmp    %r12,%rbx
+  8002f3:	72 ef                	jb     8002e4 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8002f5:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800301:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800308:	00 00 
+  80030a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80030f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800316:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80031d:	00 00 00 
+  800320:	48 01 c8             	add    %rcx,%rax
+  800323:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800327:	45 85 ed             	test   %r13d,%r13d
+  80032a:	7e 0d                	jle    800339 <libmain+0xc2>
+  80032c:	49 8b 06             	mov    (%r14),%rax
+  80032f:	48 a3 10 60 80 00 00 	movabs %rax,0x806010
+  800336:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800339:	4c 89 f6             	mov    %r14,%rsi
+  80033c:	44 89 ef             	mov    %r13d,%edi
+  80033f:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  800346:	00 00 00 
+  800349:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80034b:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+#endif
+}
+  800357:	48 83 c4 30          	add    $0x30,%rsp
+  80035b:	5b                   	pop    %rbx
+  80035c:	41 5c                	pop    %r12
+  80035e:	41 5d                	pop    %r13
+  800360:	41 5e                	pop    %r14
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800368:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80036f:	00 00 00 
+  800372:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800374:	bf 00 00 00 00       	mov    $0x0,%edi
+  800379:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  800380:	00 00 00 
+  800383:	ff d0                	call   *%rax
+}
+  800385:	5d                   	pop    %rbp
+  800386:	c3                   	ret
+
+0000000000800387 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800387:	55                   	push   %rbp
+  800388:	48 89 e5             	mov    %rsp,%rbp
+  80038b:	41 56                	push   %r14
+  80038d:	41 55                	push   %r13
+  80038f:	41 54                	push   %r12
+  800391:	53                   	push   %rbx
+  800392:	48 83 ec 50          	sub    $0x50,%rsp
+  800396:	49 89 fc             	mov    %rdi,%r12
+  800399:	41 89 f5             	mov    %esi,%r13d
+  80039c:	48 89 d3             	mov    %rdx,%rbx
+  80039f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003a3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003a7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003ab:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003ba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003be:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003c2:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8003c9:	00 00 00 
+  8003cc:	4c 8b 30             	mov    (%rax),%r14
+  8003cf:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  8003d6:	00 00 00 
+  8003d9:	ff d0                	call   *%rax
+  8003db:	89 c6                	mov    %eax,%esi
+  8003dd:	45 89 e8             	mov    %r13d,%r8d
+  8003e0:	4c 89 e1             	mov    %r12,%rcx
+  8003e3:	4c 89 f2             	mov    %r14,%rdx
+  8003e6:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8003ed:	00 00 00 
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f5:	49 bc d7 04 80 00 00 	movabs $0x8004d7,%r12
+  8003fc:	00 00 00 
+  8003ff:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800402:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800406:	48 89 df             	mov    %rbx,%rdi
+  800409:	48 b8 73 04 80 00 00 	movabs $0x800473,%rax
+  800410:	00 00 00 
+  800413:	ff d0                	call   *%rax
+    cprintf("\n");
+  800415:	48 bf 9d 50 80 00 00 	movabs $0x80509d,%rdi
+  80041c:	00 00 00 
+  80041f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800424:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800427:	cc                   	int3
+  800428:	eb fd                	jmp    800427 <_panic+0xa0>
+
+000000000080042a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80042a:	55                   	push   %rbp
+  80042b:	48 89 e5             	mov    %rsp,%rbp
+  80042e:	53                   	push   %rbx
+  80042f:	48 83 ec 08          	sub    $0x8,%rsp
+  800433:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800436:	8b 06                	mov    (%rsi),%eax
+  800438:	8d 50 01             	lea    0x1(%rax),%edx
+  80043b:	89 16                	mov    %edx,(%rsi)
+  80043d:	48 98                	cltq
+  80043f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800444:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80044a:	74 0a                	je     800456 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80044c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800450:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800454:	c9                   	leave
+  800455:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800456:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80045a:	be ff 00 00 00       	mov    $0xff,%esi
+  80045f:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  800466:	00 00 00 
+  800469:	ff d0                	call   *%rax
+        state->offset = 0;
+  80046b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800471:	eb d9                	jmp    80044c <putch+0x22>
+
+0000000000800473 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800473:	55                   	push   %rbp
+  800474:	48 89 e5             	mov    %rsp,%rbp
+  800477:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80047e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800481:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800488:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800495:	48 89 f1             	mov    %rsi,%rcx
+  800498:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80049f:	48 bf 2a 04 80 00 00 	movabs $0x80042a,%rdi
+  8004a6:	00 00 00 
+  8004a9:	48 b8 27 06 80 00 00 	movabs $0x800627,%rax
+  8004b0:	00 00 00 
+  8004b3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004b5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004bc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004c3:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004cf:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+00000000008004d7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004d7:	55                   	push   %rbp
+  8004d8:	48 89 e5             	mov    %rsp,%rbp
+  8004db:	48 83 ec 50          	sub    $0x50,%rsp
+  8004df:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004e3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004eb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004f3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800502:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800506:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80050a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80050e:	48 b8 73 04 80 00 00 	movabs $0x800473,%rax
+  800515:	00 00 00 
+  800518:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80051a:	c9                   	leave
+  80051b:	c3                   	ret
+
+000000000080051c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80051c:	55                   	push   %rbp
+  80051d:	48 89 e5             	mov    %rsp,%rbp
+  800520:	41 57                	push   %r15
+  800522:	41 56                	push   %r14
+  800524:	41 55                	push   %r13
+  800526:	41 54                	push   %r12
+  800528:	53                   	push   %rbx
+  800529:	48 83 ec 18          	sub    $0x18,%rsp
+  80052d:	49 89 fc             	mov    %rdi,%r12
+  800530:	49 89 f5             	mov    %rsi,%r13
+  800533:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800537:	8b 45 10             	mov    0x10(%rbp),%eax
+  80053a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80053d:	41 89 cf             	mov    %ecx,%r15d
+  800540:	4c 39 fa             	cmp    %r15,%rdx
+  800543:	73 5b                	jae    8005a0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800545:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800549:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80054d:	85 db                	test   %ebx,%ebx
+  80054f:	7e 0e                	jle    80055f <print_num+0x43>
+            putch(padc, put_arg);
+  800551:	4c 89 ee             	mov    %r13,%rsi
+  800554:	44 89 f7             	mov    %r14d,%edi
+  800557:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80055a:	83 eb 01             	sub    $0x1,%ebx
+  80055d:	75 f2                	jne    800551 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80055f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800563:	48 b9 ec 50 80 00 00 	movabs $0x8050ec,%rcx
+  80056a:	00 00 00 
+  80056d:	48 b8 db 50 80 00 00 	movabs $0x8050db,%rax
+  800574:	00 00 00 
+  800577:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80057b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80057f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800584:	49 f7 f7             	div    %r15
+  800587:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80058b:	4c 89 ee             	mov    %r13,%rsi
+  80058e:	41 ff d4             	call   *%r12
+}
+  800591:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800595:	5b                   	pop    %rbx
+  800596:	41 5c                	pop    %r12
+  800598:	41 5d                	pop    %r13
+  80059a:	41 5e                	pop    %r14
+  80059c:	41 5f                	pop    %r15
+  80059e:	5d                   	pop    %rbp
+  80059f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a9:	49 f7 f7             	div    %r15
+  8005ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005b4:	52                   	push   %rdx
+  8005b5:	45 0f be c9          	movsbl %r9b,%r9d
+  8005b9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005bd:	48 89 c2             	mov    %rax,%rdx
+  8005c0:	48 b8 1c 05 80 00 00 	movabs $0x80051c,%rax
+  8005c7:	00 00 00 
+  8005ca:	ff d0                	call   *%rax
+  8005cc:	48 83 c4 10          	add    $0x10,%rsp
+  8005d0:	eb 8d                	jmp    80055f <print_num+0x43>
+
+00000000008005d2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005d2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005d6:	48 8b 06             	mov    (%rsi),%rax
+  8005d9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005dd:	73 0a                	jae    8005e9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8005df:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005e3:	48 89 16             	mov    %rdx,(%rsi)
+  8005e6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005e9:	c3                   	ret
+
+00000000008005ea <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005ea:	55                   	push   %rbp
+  8005eb:	48 89 e5             	mov    %rsp,%rbp
+  8005ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8005f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005fe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800605:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800609:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800611:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800615:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800619:	48 b8 27 06 80 00 00 	movabs $0x800627,%rax
+  800620:	00 00 00 
+  800623:	ff d0                	call   *%rax
+}
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+0000000000800627 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	41 57                	push   %r15
+  80062d:	41 56                	push   %r14
+  80062f:	41 55                	push   %r13
+  800631:	41 54                	push   %r12
+  800633:	53                   	push   %rbx
+  800634:	48 83 ec 38          	sub    $0x38,%rsp
+  800638:	49 89 fe             	mov    %rdi,%r14
+  80063b:	49 89 f5             	mov    %rsi,%r13
+  80063e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800641:	48 8b 01             	mov    (%rcx),%rax
+  800644:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800648:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80064c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800650:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800654:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800658:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80065c:	0f b6 3b             	movzbl (%rbx),%edi
+  80065f:	40 80 ff 25          	cmp    $0x25,%dil
+  800663:	74 18                	je     80067d <vprintfmt+0x56>
+            if (!ch) return;
+  800665:	40 84 ff             	test   %dil,%dil
+  800668:	0f 84 b1 06 00 00    	je     800d1f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80066e:	40 0f b6 ff          	movzbl %dil,%edi
+  800672:	4c 89 ee             	mov    %r13,%rsi
+  800675:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800678:	4c 89 e3             	mov    %r12,%rbx
+  80067b:	eb db                	jmp    800658 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80067d:	be 00 00 00 00       	mov    $0x0,%esi
+  800682:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800686:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80068b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800691:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800698:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80069c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006a1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006a6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006a9:	83 e8 23             	sub    $0x23,%eax
+  8006ac:	3c 57                	cmp    $0x57,%al
+  8006ae:	0f 87 51 06 00 00    	ja     800d05 <vprintfmt+0x6de>
+  8006b4:	0f b6 c0             	movzbl %al,%eax
+  8006b7:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  8006be:	00 00 00 
+  8006c1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006c4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006c7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006cb:	eb cf                	jmp    80069c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006cd:	49 89 dc             	mov    %rbx,%r12
+  8006d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8006d5:	eb c5                	jmp    80069c <vprintfmt+0x75>
+            padc = ch;
+  8006d7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006db:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006e1:	eb b9                	jmp    80069c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e9:	77 24                	ja     80070f <vprintfmt+0xe8>
+  8006eb:	89 c1                	mov    %eax,%ecx
+  8006ed:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006f1:	83 c0 08             	add    $0x8,%eax
+  8006f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006fa:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006fd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800701:	79 99                	jns    80069c <vprintfmt+0x75>
+                width = precision;
+  800703:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800707:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80070d:	eb 8d                	jmp    80069c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80070f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800713:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800717:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071b:	eb da                	jmp    8006f7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80071d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800722:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800726:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80072c:	3c 39                	cmp    $0x39,%al
+  80072e:	77 1c                	ja     80074c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800730:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800734:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800738:	0f b6 c0             	movzbl %al,%eax
+  80073b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800740:	0f b6 03             	movzbl (%rbx),%eax
+  800743:	3c 39                	cmp    $0x39,%al
+  800745:	76 e9                	jbe    800730 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800747:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80074a:	eb b1                	jmp    8006fd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80074c:	49 89 dc             	mov    %rbx,%r12
+  80074f:	eb ac                	jmp    8006fd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800751:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800754:	85 c9                	test   %ecx,%ecx
+  800756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075b:	0f 49 c1             	cmovns %ecx,%eax
+  80075e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800761:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800764:	e9 33 ff ff ff       	jmp    80069c <vprintfmt+0x75>
+            lflag++;
+  800769:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80076c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80076f:	e9 28 ff ff ff       	jmp    80069c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800774:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800777:	83 f8 2f             	cmp    $0x2f,%eax
+  80077a:	77 19                	ja     800795 <vprintfmt+0x16e>
+  80077c:	89 c2                	mov    %eax,%edx
+  80077e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800782:	83 c0 08             	add    $0x8,%eax
+  800785:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800788:	8b 3a                	mov    (%rdx),%edi
+  80078a:	4c 89 ee             	mov    %r13,%rsi
+  80078d:	41 ff d6             	call   *%r14
+            break;
+  800790:	e9 c3 fe ff ff       	jmp    800658 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800795:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800799:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a1:	eb e5                	jmp    800788 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a9:	77 5a                	ja     800805 <vprintfmt+0x1de>
+  8007ab:	89 c2                	mov    %eax,%edx
+  8007ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b1:	83 c0 08             	add    $0x8,%eax
+  8007b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007b7:	8b 02                	mov    (%rdx),%eax
+  8007b9:	89 c1                	mov    %eax,%ecx
+  8007bb:	f7 d9                	neg    %ecx
+  8007bd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007c0:	83 f9 16             	cmp    $0x16,%ecx
+  8007c3:	7f 4e                	jg     800813 <vprintfmt+0x1ec>
+  8007c5:	48 63 c1             	movslq %ecx,%rax
+  8007c8:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8007cf:	00 00 00 
+  8007d2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007d6:	48 85 c0             	test   %rax,%rax
+  8007d9:	74 38                	je     800813 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007db:	48 89 c1             	mov    %rax,%rcx
+  8007de:	48 ba cc 57 80 00 00 	movabs $0x8057cc,%rdx
+  8007e5:	00 00 00 
+  8007e8:	4c 89 ee             	mov    %r13,%rsi
+  8007eb:	4c 89 f7             	mov    %r14,%rdi
+  8007ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f3:	49 b8 ea 05 80 00 00 	movabs $0x8005ea,%r8
+  8007fa:	00 00 00 
+  8007fd:	41 ff d0             	call   *%r8
+  800800:	e9 53 fe ff ff       	jmp    800658 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800805:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800809:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800811:	eb a4                	jmp    8007b7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800813:	48 ba 04 51 80 00 00 	movabs $0x805104,%rdx
+  80081a:	00 00 00 
+  80081d:	4c 89 ee             	mov    %r13,%rsi
+  800820:	4c 89 f7             	mov    %r14,%rdi
+  800823:	b8 00 00 00 00       	mov    $0x0,%eax
+  800828:	49 b8 ea 05 80 00 00 	movabs $0x8005ea,%r8
+  80082f:	00 00 00 
+  800832:	41 ff d0             	call   *%r8
+  800835:	e9 1e fe ff ff       	jmp    800658 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	77 6c                	ja     8008ae <vprintfmt+0x287>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800851:	48 85 d2             	test   %rdx,%rdx
+  800854:	48 b8 fd 50 80 00 00 	movabs $0x8050fd,%rax
+  80085b:	00 00 00 
+  80085e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800862:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800866:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80086a:	7e 06                	jle    800872 <vprintfmt+0x24b>
+  80086c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800870:	75 4a                	jne    8008bc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800872:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800876:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80087a:	0f b6 00             	movzbl (%rax),%eax
+  80087d:	84 c0                	test   %al,%al
+  80087f:	0f 85 9a 00 00 00    	jne    80091f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800885:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800888:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80088c:	85 c0                	test   %eax,%eax
+  80088e:	0f 8e c4 fd ff ff    	jle    800658 <vprintfmt+0x31>
+  800894:	4c 89 ee             	mov    %r13,%rsi
+  800897:	bf 20 00 00 00       	mov    $0x20,%edi
+  80089c:	41 ff d6             	call   *%r14
+  80089f:	41 83 ec 01          	sub    $0x1,%r12d
+  8008a3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008a7:	75 eb                	jne    800894 <vprintfmt+0x26d>
+  8008a9:	e9 aa fd ff ff       	jmp    800658 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ba:	eb 92                	jmp    80084e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008bc:	49 63 f7             	movslq %r15d,%rsi
+  8008bf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008c3:	48 b8 d9 0d 80 00 00 	movabs $0x800dd9,%rax
+  8008ca:	00 00 00 
+  8008cd:	ff d0                	call   *%rax
+  8008cf:	48 89 c2             	mov    %rax,%rdx
+  8008d2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008d5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008d7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008da:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008dd:	85 c0                	test   %eax,%eax
+  8008df:	7e 91                	jle    800872 <vprintfmt+0x24b>
+  8008e1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008e6:	4c 89 ee             	mov    %r13,%rsi
+  8008e9:	44 89 e7             	mov    %r12d,%edi
+  8008ec:	41 ff d6             	call   *%r14
+  8008ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008f3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008f9:	75 eb                	jne    8008e6 <vprintfmt+0x2bf>
+  8008fb:	e9 72 ff ff ff       	jmp    800872 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800900:	0f b6 f8             	movzbl %al,%edi
+  800903:	4c 89 ee             	mov    %r13,%rsi
+  800906:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800909:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80090d:	49 83 c4 01          	add    $0x1,%r12
+  800911:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800917:	84 c0                	test   %al,%al
+  800919:	0f 84 66 ff ff ff    	je     800885 <vprintfmt+0x25e>
+  80091f:	45 85 ff             	test   %r15d,%r15d
+  800922:	78 0a                	js     80092e <vprintfmt+0x307>
+  800924:	41 83 ef 01          	sub    $0x1,%r15d
+  800928:	0f 88 57 ff ff ff    	js     800885 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80092e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800932:	74 cc                	je     800900 <vprintfmt+0x2d9>
+  800934:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800937:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80093c:	80 fa 5e             	cmp    $0x5e,%dl
+  80093f:	77 c2                	ja     800903 <vprintfmt+0x2dc>
+  800941:	eb bd                	jmp    800900 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800943:	40 84 f6             	test   %sil,%sil
+  800946:	75 26                	jne    80096e <vprintfmt+0x347>
+    switch (lflag) {
+  800948:	85 d2                	test   %edx,%edx
+  80094a:	74 59                	je     8009a5 <vprintfmt+0x37e>
+  80094c:	83 fa 01             	cmp    $0x1,%edx
+  80094f:	74 7b                	je     8009cc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800954:	83 f8 2f             	cmp    $0x2f,%eax
+  800957:	0f 87 96 00 00 00    	ja     8009f3 <vprintfmt+0x3cc>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	4c 8b 22             	mov    (%rdx),%r12
+  80096c:	eb 17                	jmp    800985 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80096e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800971:	83 f8 2f             	cmp    $0x2f,%eax
+  800974:	77 21                	ja     800997 <vprintfmt+0x370>
+  800976:	89 c2                	mov    %eax,%edx
+  800978:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097c:	83 c0 08             	add    $0x8,%eax
+  80097f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800982:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800985:	4d 85 e4             	test   %r12,%r12
+  800988:	78 7a                	js     800a04 <vprintfmt+0x3dd>
+            num = i;
+  80098a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80098d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800992:	e9 50 02 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800997:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a3:	eb dd                	jmp    800982 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ab:	77 11                	ja     8009be <vprintfmt+0x397>
+  8009ad:	89 c2                	mov    %eax,%edx
+  8009af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b3:	83 c0 08             	add    $0x8,%eax
+  8009b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b9:	4c 63 22             	movslq (%rdx),%r12
+  8009bc:	eb c7                	jmp    800985 <vprintfmt+0x35e>
+  8009be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	eb ed                	jmp    8009b9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 11                	ja     8009e5 <vprintfmt+0x3be>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	4c 8b 22             	mov    (%rdx),%r12
+  8009e3:	eb a0                	jmp    800985 <vprintfmt+0x35e>
+  8009e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f1:	eb ed                	jmp    8009e0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ff:	e9 65 ff ff ff       	jmp    800969 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a04:	4c 89 ee             	mov    %r13,%rsi
+  800a07:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a0c:	41 ff d6             	call   *%r14
+                i = -i;
+  800a0f:	49 f7 dc             	neg    %r12
+  800a12:	e9 73 ff ff ff       	jmp    80098a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a17:	40 84 f6             	test   %sil,%sil
+  800a1a:	75 32                	jne    800a4e <vprintfmt+0x427>
+    switch (lflag) {
+  800a1c:	85 d2                	test   %edx,%edx
+  800a1e:	74 5d                	je     800a7d <vprintfmt+0x456>
+  800a20:	83 fa 01             	cmp    $0x1,%edx
+  800a23:	0f 84 82 00 00 00    	je     800aab <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2f:	0f 87 a5 00 00 00    	ja     800ada <vprintfmt+0x4b3>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a44:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a49:	e9 99 01 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a51:	83 f8 2f             	cmp    $0x2f,%eax
+  800a54:	77 19                	ja     800a6f <vprintfmt+0x448>
+  800a56:	89 c2                	mov    %eax,%edx
+  800a58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5c:	83 c0 08             	add    $0x8,%eax
+  800a5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a62:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a65:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a6a:	e9 78 01 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+  800a6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7b:	eb e5                	jmp    800a62 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	77 18                	ja     800a9d <vprintfmt+0x476>
+  800a85:	89 c2                	mov    %eax,%edx
+  800a87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8b:	83 c0 08             	add    $0x8,%eax
+  800a8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a91:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a93:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a98:	e9 4a 01 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+  800a9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa9:	eb e6                	jmp    800a91 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800aab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aae:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab1:	77 19                	ja     800acc <vprintfmt+0x4a5>
+  800ab3:	89 c2                	mov    %eax,%edx
+  800ab5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab9:	83 c0 08             	add    $0x8,%eax
+  800abc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ac2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac7:	e9 1b 01 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+  800acc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad8:	eb e5                	jmp    800abf <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800ada:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ade:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae6:	e9 56 ff ff ff       	jmp    800a41 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aeb:	40 84 f6             	test   %sil,%sil
+  800aee:	75 2e                	jne    800b1e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800af0:	85 d2                	test   %edx,%edx
+  800af2:	74 59                	je     800b4d <vprintfmt+0x526>
+  800af4:	83 fa 01             	cmp    $0x1,%edx
+  800af7:	74 7f                	je     800b78 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afc:	83 f8 2f             	cmp    $0x2f,%eax
+  800aff:	0f 87 9f 00 00 00    	ja     800ba4 <vprintfmt+0x57d>
+  800b05:	89 c2                	mov    %eax,%edx
+  800b07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0b:	83 c0 08             	add    $0x8,%eax
+  800b0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b14:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b19:	e9 c9 00 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b21:	83 f8 2f             	cmp    $0x2f,%eax
+  800b24:	77 19                	ja     800b3f <vprintfmt+0x518>
+  800b26:	89 c2                	mov    %eax,%edx
+  800b28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2c:	83 c0 08             	add    $0x8,%eax
+  800b2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b32:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b35:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b3a:	e9 a8 00 00 00       	jmp    800be7 <vprintfmt+0x5c0>
+  800b3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4b:	eb e5                	jmp    800b32 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b50:	83 f8 2f             	cmp    $0x2f,%eax
+  800b53:	77 15                	ja     800b6a <vprintfmt+0x543>
+  800b55:	89 c2                	mov    %eax,%edx
+  800b57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5b:	83 c0 08             	add    $0x8,%eax
+  800b5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b61:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b63:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b68:	eb 7d                	jmp    800be7 <vprintfmt+0x5c0>
+  800b6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b76:	eb e9                	jmp    800b61 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7e:	77 16                	ja     800b96 <vprintfmt+0x56f>
+  800b80:	89 c2                	mov    %eax,%edx
+  800b82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b86:	83 c0 08             	add    $0x8,%eax
+  800b89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b8f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b94:	eb 51                	jmp    800be7 <vprintfmt+0x5c0>
+  800b96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba2:	eb e8                	jmp    800b8c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb0:	e9 5c ff ff ff       	jmp    800b11 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bb5:	4c 89 ee             	mov    %r13,%rsi
+  800bb8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bbd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bc0:	4c 89 ee             	mov    %r13,%rsi
+  800bc3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bc8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bce:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd1:	77 47                	ja     800c1a <vprintfmt+0x5f3>
+  800bd3:	89 c2                	mov    %eax,%edx
+  800bd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd9:	83 c0 08             	add    $0x8,%eax
+  800bdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800be2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800be7:	48 83 ec 08          	sub    $0x8,%rsp
+  800beb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bef:	0f 94 c0             	sete   %al
+  800bf2:	0f b6 c0             	movzbl %al,%eax
+  800bf5:	50                   	push   %rax
+  800bf6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bfb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bff:	4c 89 ee             	mov    %r13,%rsi
+  800c02:	4c 89 f7             	mov    %r14,%rdi
+  800c05:	48 b8 1c 05 80 00 00 	movabs $0x80051c,%rax
+  800c0c:	00 00 00 
+  800c0f:	ff d0                	call   *%rax
+            break;
+  800c11:	48 83 c4 10          	add    $0x10,%rsp
+  800c15:	e9 3e fa ff ff       	jmp    800658 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c26:	eb b7                	jmp    800bdf <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c28:	40 84 f6             	test   %sil,%sil
+  800c2b:	75 2b                	jne    800c58 <vprintfmt+0x631>
+    switch (lflag) {
+  800c2d:	85 d2                	test   %edx,%edx
+  800c2f:	74 56                	je     800c87 <vprintfmt+0x660>
+  800c31:	83 fa 01             	cmp    $0x1,%edx
+  800c34:	74 7f                	je     800cb5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c39:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3c:	0f 87 a2 00 00 00    	ja     800ce4 <vprintfmt+0x6bd>
+  800c42:	89 c2                	mov    %eax,%edx
+  800c44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c48:	83 c0 08             	add    $0x8,%eax
+  800c4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c51:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c56:	eb 8f                	jmp    800be7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5e:	77 19                	ja     800c79 <vprintfmt+0x652>
+  800c60:	89 c2                	mov    %eax,%edx
+  800c62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c66:	83 c0 08             	add    $0x8,%eax
+  800c69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c74:	e9 6e ff ff ff       	jmp    800be7 <vprintfmt+0x5c0>
+  800c79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c85:	eb e5                	jmp    800c6c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 18                	ja     800ca7 <vprintfmt+0x680>
+  800c8f:	89 c2                	mov    %eax,%edx
+  800c91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c95:	83 c0 08             	add    $0x8,%eax
+  800c98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ca2:	e9 40 ff ff ff       	jmp    800be7 <vprintfmt+0x5c0>
+  800ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb3:	eb e6                	jmp    800c9b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbb:	77 19                	ja     800cd6 <vprintfmt+0x6af>
+  800cbd:	89 c2                	mov    %eax,%edx
+  800cbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc3:	83 c0 08             	add    $0x8,%eax
+  800cc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ccc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cd1:	e9 11 ff ff ff       	jmp    800be7 <vprintfmt+0x5c0>
+  800cd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce2:	eb e5                	jmp    800cc9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ce4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf0:	e9 59 ff ff ff       	jmp    800c4e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cf5:	4c 89 ee             	mov    %r13,%rsi
+  800cf8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cfd:	41 ff d6             	call   *%r14
+            break;
+  800d00:	e9 53 f9 ff ff       	jmp    800658 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d05:	4c 89 ee             	mov    %r13,%rsi
+  800d08:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d0d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d10:	48 83 eb 01          	sub    $0x1,%rbx
+  800d14:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d18:	75 f6                	jne    800d10 <vprintfmt+0x6e9>
+  800d1a:	e9 39 f9 ff ff       	jmp    800658 <vprintfmt+0x31>
+}
+  800d1f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d23:	5b                   	pop    %rbx
+  800d24:	41 5c                	pop    %r12
+  800d26:	41 5d                	pop    %r13
+  800d28:	41 5e                	pop    %r14
+  800d2a:	41 5f                	pop    %r15
+  800d2c:	5d                   	pop    %rbp
+  800d2d:	c3                   	ret
+
+0000000000800d2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d2e:	55                   	push   %rbp
+  800d2f:	48 89 e5             	mov    %rsp,%rbp
+  800d32:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d3a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d43:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d4a:	48 85 ff             	test   %rdi,%rdi
+  800d4d:	74 2b                	je     800d7a <vsnprintf+0x4c>
+  800d4f:	48 85 f6             	test   %rsi,%rsi
+  800d52:	74 26                	je     800d7a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d54:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d58:	48 bf d2 05 80 00 00 	movabs $0x8005d2,%rdi
+  800d5f:	00 00 00 
+  800d62:	48 b8 27 06 80 00 00 	movabs $0x800627,%rax
+  800d69:	00 00 00 
+  800d6c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d72:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d78:	c9                   	leave
+  800d79:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d7f:	eb f7                	jmp    800d78 <vsnprintf+0x4a>
+
+0000000000800d81 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d81:	55                   	push   %rbp
+  800d82:	48 89 e5             	mov    %rsp,%rbp
+  800d85:	48 83 ec 50          	sub    $0x50,%rsp
+  800d89:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d8d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d91:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d95:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800da8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dac:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800db0:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  800db7:	00 00 00 
+  800dba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dbc:	c9                   	leave
+  800dbd:	c3                   	ret
+
+0000000000800dbe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dbe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dc1:	74 10                	je     800dd3 <strlen+0x15>
+    size_t n = 0;
+  800dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dc8:	48 83 c0 01          	add    $0x1,%rax
+  800dcc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800dd0:	75 f6                	jne    800dc8 <strlen+0xa>
+  800dd2:	c3                   	ret
+    size_t n = 0;
+  800dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800dd8:	c3                   	ret
+
+0000000000800dd9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800dd9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800de1:	48 85 f6             	test   %rsi,%rsi
+  800de4:	74 11                	je     800df7 <strnlen+0x1e>
+  800de6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800dea:	74 0c                	je     800df8 <strnlen+0x1f>
+  800dec:	48 83 c2 01          	add    $0x1,%rdx
+  800df0:	48 39 d0             	cmp    %rdx,%rax
+  800df3:	75 f1                	jne    800de6 <strnlen+0xd>
+  800df5:	eb 04                	jmp    800dfb <strnlen+0x22>
+  800df7:	c3                   	ret
+  800df8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800dfb:	c3                   	ret
+
+0000000000800dfc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dfc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e04:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e08:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e0b:	48 83 c2 01          	add    $0x1,%rdx
+  800e0f:	84 c9                	test   %cl,%cl
+  800e11:	75 f1                	jne    800e04 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e13:	c3                   	ret
+
+0000000000800e14 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e14:	55                   	push   %rbp
+  800e15:	48 89 e5             	mov    %rsp,%rbp
+  800e18:	41 54                	push   %r12
+  800e1a:	53                   	push   %rbx
+  800e1b:	48 89 fb             	mov    %rdi,%rbx
+  800e1e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e21:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  800e28:	00 00 00 
+  800e2b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e2d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e31:	4c 89 e6             	mov    %r12,%rsi
+  800e34:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  800e3b:	00 00 00 
+  800e3e:	ff d0                	call   *%rax
+    return dst;
+}
+  800e40:	48 89 d8             	mov    %rbx,%rax
+  800e43:	5b                   	pop    %rbx
+  800e44:	41 5c                	pop    %r12
+  800e46:	5d                   	pop    %rbp
+  800e47:	c3                   	ret
+
+0000000000800e48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e48:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e4b:	48 85 d2             	test   %rdx,%rdx
+  800e4e:	74 1f                	je     800e6f <strncpy+0x27>
+  800e50:	48 01 fa             	add    %rdi,%rdx
+  800e53:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e56:	48 83 c1 01          	add    $0x1,%rcx
+  800e5a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e5e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e62:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e66:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e6a:	48 39 ca             	cmp    %rcx,%rdx
+  800e6d:	75 e7                	jne    800e56 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e6f:	c3                   	ret
+
+0000000000800e70 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e70:	48 89 f8             	mov    %rdi,%rax
+  800e73:	48 85 d2             	test   %rdx,%rdx
+  800e76:	74 24                	je     800e9c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e78:	48 83 ea 01          	sub    $0x1,%rdx
+  800e7c:	74 1b                	je     800e99 <strlcpy+0x29>
+  800e7e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e82:	0f b6 16             	movzbl (%rsi),%edx
+  800e85:	84 d2                	test   %dl,%dl
+  800e87:	74 10                	je     800e99 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e89:	48 83 c6 01          	add    $0x1,%rsi
+  800e8d:	48 83 c0 01          	add    $0x1,%rax
+  800e91:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e94:	48 39 c8             	cmp    %rcx,%rax
+  800e97:	75 e9                	jne    800e82 <strlcpy+0x12>
+        *dst = '\0';
+  800e99:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e9c:	48 29 f8             	sub    %rdi,%rax
+}
+  800e9f:	c3                   	ret
+
+0000000000800ea0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ea0:	0f b6 07             	movzbl (%rdi),%eax
+  800ea3:	84 c0                	test   %al,%al
+  800ea5:	74 13                	je     800eba <strcmp+0x1a>
+  800ea7:	38 06                	cmp    %al,(%rsi)
+  800ea9:	75 0f                	jne    800eba <strcmp+0x1a>
+  800eab:	48 83 c7 01          	add    $0x1,%rdi
+  800eaf:	48 83 c6 01          	add    $0x1,%rsi
+  800eb3:	0f b6 07             	movzbl (%rdi),%eax
+  800eb6:	84 c0                	test   %al,%al
+  800eb8:	75 ed                	jne    800ea7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eba:	0f b6 c0             	movzbl %al,%eax
+  800ebd:	0f b6 16             	movzbl (%rsi),%edx
+  800ec0:	29 d0                	sub    %edx,%eax
+}
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ec3:	48 85 d2             	test   %rdx,%rdx
+  800ec6:	74 1f                	je     800ee7 <strncmp+0x24>
+  800ec8:	0f b6 07             	movzbl (%rdi),%eax
+  800ecb:	84 c0                	test   %al,%al
+  800ecd:	74 1e                	je     800eed <strncmp+0x2a>
+  800ecf:	3a 06                	cmp    (%rsi),%al
+  800ed1:	75 1a                	jne    800eed <strncmp+0x2a>
+  800ed3:	48 83 c7 01          	add    $0x1,%rdi
+  800ed7:	48 83 c6 01          	add    $0x1,%rsi
+  800edb:	48 83 ea 01          	sub    $0x1,%rdx
+  800edf:	75 e7                	jne    800ec8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	c3                   	ret
+  800ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eec:	c3                   	ret
+  800eed:	48 85 d2             	test   %rdx,%rdx
+  800ef0:	74 09                	je     800efb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ef2:	0f b6 07             	movzbl (%rdi),%eax
+  800ef5:	0f b6 16             	movzbl (%rsi),%edx
+  800ef8:	29 d0                	sub    %edx,%eax
+  800efa:	c3                   	ret
+    if (!n) return 0;
+  800efb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f00:	c3                   	ret
+
+0000000000800f01 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f01:	0f b6 17             	movzbl (%rdi),%edx
+  800f04:	84 d2                	test   %dl,%dl
+  800f06:	74 18                	je     800f20 <strchr+0x1f>
+        if (*str == c) {
+  800f08:	0f be d2             	movsbl %dl,%edx
+  800f0b:	39 f2                	cmp    %esi,%edx
+  800f0d:	74 17                	je     800f26 <strchr+0x25>
+    for (; *str; str++) {
+  800f0f:	48 83 c7 01          	add    $0x1,%rdi
+  800f13:	0f b6 17             	movzbl (%rdi),%edx
+  800f16:	84 d2                	test   %dl,%dl
+  800f18:	75 ee                	jne    800f08 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1f:	c3                   	ret
+  800f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f25:	c3                   	ret
+  800f26:	48 89 f8             	mov    %rdi,%rax
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f2a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f2d:	0f b6 17             	movzbl (%rdi),%edx
+  800f30:	84 d2                	test   %dl,%dl
+  800f32:	74 13                	je     800f47 <strfind+0x1d>
+  800f34:	0f be d2             	movsbl %dl,%edx
+  800f37:	39 f2                	cmp    %esi,%edx
+  800f39:	74 0b                	je     800f46 <strfind+0x1c>
+  800f3b:	48 83 c0 01          	add    $0x1,%rax
+  800f3f:	0f b6 10             	movzbl (%rax),%edx
+  800f42:	84 d2                	test   %dl,%dl
+  800f44:	75 ee                	jne    800f34 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f46:	c3                   	ret
+  800f47:	c3                   	ret
+
+0000000000800f48 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f48:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f4b:	48 89 f8             	mov    %rdi,%rax
+  800f4e:	48 f7 d8             	neg    %rax
+  800f51:	83 e0 07             	and    $0x7,%eax
+  800f54:	49 89 d1             	mov    %rdx,%r9
+  800f57:	49 29 c1             	sub    %rax,%r9
+  800f5a:	78 36                	js     800f92 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f5c:	40 0f b6 c6          	movzbl %sil,%eax
+  800f60:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f67:	01 01 01 
+  800f6a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f6e:	40 f6 c7 07          	test   $0x7,%dil
+  800f72:	75 38                	jne    800fac <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f74:	4c 89 c9             	mov    %r9,%rcx
+  800f77:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f7b:	74 0c                	je     800f89 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f7d:	fc                   	cld
+  800f7e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f81:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f85:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f89:	4d 85 c9             	test   %r9,%r9
+  800f8c:	75 45                	jne    800fd3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f8e:	4c 89 c0             	mov    %r8,%rax
+  800f91:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f92:	48 85 d2             	test   %rdx,%rdx
+  800f95:	74 f7                	je     800f8e <memset+0x46>
+  800f97:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f9a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f9d:	48 83 c0 01          	add    $0x1,%rax
+  800fa1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fa5:	48 39 c2             	cmp    %rax,%rdx
+  800fa8:	75 f3                	jne    800f9d <memset+0x55>
+  800faa:	eb e2                	jmp    800f8e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fac:	40 f6 c7 01          	test   $0x1,%dil
+  800fb0:	74 06                	je     800fb8 <memset+0x70>
+  800fb2:	88 07                	mov    %al,(%rdi)
+  800fb4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fb8:	40 f6 c7 02          	test   $0x2,%dil
+  800fbc:	74 07                	je     800fc5 <memset+0x7d>
+  800fbe:	66 89 07             	mov    %ax,(%rdi)
+  800fc1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fc5:	40 f6 c7 04          	test   $0x4,%dil
+  800fc9:	74 a9                	je     800f74 <memset+0x2c>
+  800fcb:	89 07                	mov    %eax,(%rdi)
+  800fcd:	48 83 c7 04          	add    $0x4,%rdi
+  800fd1:	eb a1                	jmp    800f74 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fd3:	41 f6 c1 04          	test   $0x4,%r9b
+  800fd7:	74 06                	je     800fdf <memset+0x97>
+  800fd9:	89 07                	mov    %eax,(%rdi)
+  800fdb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fdf:	41 f6 c1 02          	test   $0x2,%r9b
+  800fe3:	74 07                	je     800fec <memset+0xa4>
+  800fe5:	66 89 07             	mov    %ax,(%rdi)
+  800fe8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fec:	41 f6 c1 01          	test   $0x1,%r9b
+  800ff0:	74 9c                	je     800f8e <memset+0x46>
+  800ff2:	88 07                	mov    %al,(%rdi)
+  800ff4:	eb 98                	jmp    800f8e <memset+0x46>
+
+0000000000800ff6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ff6:	48 89 f8             	mov    %rdi,%rax
+  800ff9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ffc:	48 39 fe             	cmp    %rdi,%rsi
+  800fff:	73 3b                	jae    80103c <memmove+0x46>
+  801001:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801005:	48 39 d7             	cmp    %rdx,%rdi
+  801008:	73 32                	jae    80103c <memmove+0x46>
+        s += n;
+        d += n;
+  80100a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80100e:	48 89 d6             	mov    %rdx,%rsi
+  801011:	48 09 fe             	or     %rdi,%rsi
+  801014:	48 09 ce             	or     %rcx,%rsi
+  801017:	40 f6 c6 07          	test   $0x7,%sil
+  80101b:	75 12                	jne    80102f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80101d:	48 83 ef 08          	sub    $0x8,%rdi
+  801021:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801025:	48 c1 e9 03          	shr    $0x3,%rcx
+  801029:	fd                   	std
+  80102a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80102d:	fc                   	cld
+  80102e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80102f:	48 83 ef 01          	sub    $0x1,%rdi
+  801033:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801037:	fd                   	std
+  801038:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80103a:	eb f1                	jmp    80102d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80103c:	48 89 f2             	mov    %rsi,%rdx
+  80103f:	48 09 c2             	or     %rax,%rdx
+  801042:	48 09 ca             	or     %rcx,%rdx
+  801045:	f6 c2 07             	test   $0x7,%dl
+  801048:	75 0c                	jne    801056 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80104a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80104e:	48 89 c7             	mov    %rax,%rdi
+  801051:	fc                   	cld
+  801052:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801055:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801056:	48 89 c7             	mov    %rax,%rdi
+  801059:	fc                   	cld
+  80105a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80105c:	c3                   	ret
+
+000000000080105d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80105d:	55                   	push   %rbp
+  80105e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801061:	48 b8 f6 0f 80 00 00 	movabs $0x800ff6,%rax
+  801068:	00 00 00 
+  80106b:	ff d0                	call   *%rax
+}
+  80106d:	5d                   	pop    %rbp
+  80106e:	c3                   	ret
+
+000000000080106f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80106f:	55                   	push   %rbp
+  801070:	48 89 e5             	mov    %rsp,%rbp
+  801073:	41 57                	push   %r15
+  801075:	41 56                	push   %r14
+  801077:	41 55                	push   %r13
+  801079:	41 54                	push   %r12
+  80107b:	53                   	push   %rbx
+  80107c:	48 83 ec 08          	sub    $0x8,%rsp
+  801080:	49 89 fe             	mov    %rdi,%r14
+  801083:	49 89 f7             	mov    %rsi,%r15
+  801086:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801089:	48 89 f7             	mov    %rsi,%rdi
+  80108c:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  801093:	00 00 00 
+  801096:	ff d0                	call   *%rax
+  801098:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80109b:	48 89 de             	mov    %rbx,%rsi
+  80109e:	4c 89 f7             	mov    %r14,%rdi
+  8010a1:	48 b8 d9 0d 80 00 00 	movabs $0x800dd9,%rax
+  8010a8:	00 00 00 
+  8010ab:	ff d0                	call   *%rax
+  8010ad:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010b0:	48 39 c3             	cmp    %rax,%rbx
+  8010b3:	74 36                	je     8010eb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010b5:	48 89 d8             	mov    %rbx,%rax
+  8010b8:	4c 29 e8             	sub    %r13,%rax
+  8010bb:	49 39 c4             	cmp    %rax,%r12
+  8010be:	73 31                	jae    8010f1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010c0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010c9:	4c 89 fe             	mov    %r15,%rsi
+  8010cc:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010d8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010dc:	48 83 c4 08          	add    $0x8,%rsp
+  8010e0:	5b                   	pop    %rbx
+  8010e1:	41 5c                	pop    %r12
+  8010e3:	41 5d                	pop    %r13
+  8010e5:	41 5e                	pop    %r14
+  8010e7:	41 5f                	pop    %r15
+  8010e9:	5d                   	pop    %rbp
+  8010ea:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010eb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010ef:	eb eb                	jmp    8010dc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010f1:	48 83 eb 01          	sub    $0x1,%rbx
+  8010f5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f9:	48 89 da             	mov    %rbx,%rdx
+  8010fc:	4c 89 fe             	mov    %r15,%rsi
+  8010ff:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  801106:	00 00 00 
+  801109:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80110b:	49 01 de             	add    %rbx,%r14
+  80110e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801113:	eb c3                	jmp    8010d8 <strlcat+0x69>
+
+0000000000801115 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801115:	48 85 d2             	test   %rdx,%rdx
+  801118:	74 2d                	je     801147 <memcmp+0x32>
+  80111a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80111f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801123:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801128:	44 38 c1             	cmp    %r8b,%cl
+  80112b:	75 0f                	jne    80113c <memcmp+0x27>
+    while (n-- > 0) {
+  80112d:	48 83 c0 01          	add    $0x1,%rax
+  801131:	48 39 c2             	cmp    %rax,%rdx
+  801134:	75 e9                	jne    80111f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80113c:	0f b6 c1             	movzbl %cl,%eax
+  80113f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801143:	44 29 c0             	sub    %r8d,%eax
+  801146:	c3                   	ret
+    return 0;
+  801147:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114c:	c3                   	ret
+
+000000000080114d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80114d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801151:	48 39 c7             	cmp    %rax,%rdi
+  801154:	73 0f                	jae    801165 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801156:	40 38 37             	cmp    %sil,(%rdi)
+  801159:	74 0e                	je     801169 <memfind+0x1c>
+    for (; src < end; src++) {
+  80115b:	48 83 c7 01          	add    $0x1,%rdi
+  80115f:	48 39 f8             	cmp    %rdi,%rax
+  801162:	75 f2                	jne    801156 <memfind+0x9>
+  801164:	c3                   	ret
+  801165:	48 89 f8             	mov    %rdi,%rax
+  801168:	c3                   	ret
+  801169:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80116c:	c3                   	ret
+
+000000000080116d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80116d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801170:	0f b6 37             	movzbl (%rdi),%esi
+  801173:	40 80 fe 20          	cmp    $0x20,%sil
+  801177:	74 06                	je     80117f <strtol+0x12>
+  801179:	40 80 fe 09          	cmp    $0x9,%sil
+  80117d:	75 13                	jne    801192 <strtol+0x25>
+  80117f:	48 83 c7 01          	add    $0x1,%rdi
+  801183:	0f b6 37             	movzbl (%rdi),%esi
+  801186:	40 80 fe 20          	cmp    $0x20,%sil
+  80118a:	74 f3                	je     80117f <strtol+0x12>
+  80118c:	40 80 fe 09          	cmp    $0x9,%sil
+  801190:	74 ed                	je     80117f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801192:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801195:	83 e0 fd             	and    $0xfffffffd,%eax
+  801198:	3c 01                	cmp    $0x1,%al
+  80119a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80119e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011a4:	75 0f                	jne    8011b5 <strtol+0x48>
+  8011a6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011a9:	74 14                	je     8011bf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011ab:	85 d2                	test   %edx,%edx
+  8011ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011b2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011b5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011ba:	4c 63 ca             	movslq %edx,%r9
+  8011bd:	eb 36                	jmp    8011f5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011bf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011c3:	74 0f                	je     8011d4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011c5:	85 d2                	test   %edx,%edx
+  8011c7:	75 ec                	jne    8011b5 <strtol+0x48>
+        s++;
+  8011c9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011cd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011d2:	eb e1                	jmp    8011b5 <strtol+0x48>
+        s += 2;
+  8011d4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011d8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011dd:	eb d6                	jmp    8011b5 <strtol+0x48>
+            dig -= '0';
+  8011df:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011e2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011e6:	41 39 d0             	cmp    %edx,%r8d
+  8011e9:	7d 21                	jge    80120c <strtol+0x9f>
+        val = val * base + dig;
+  8011eb:	49 0f af c1          	imul   %r9,%rax
+  8011ef:	0f b6 c9             	movzbl %cl,%ecx
+  8011f2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011f5:	48 83 c7 01          	add    $0x1,%rdi
+  8011f9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011fd:	80 f9 39             	cmp    $0x39,%cl
+  801200:	76 dd                	jbe    8011df <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801202:	80 f9 7b             	cmp    $0x7b,%cl
+  801205:	77 05                	ja     80120c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801207:	83 e9 57             	sub    $0x57,%ecx
+  80120a:	eb d6                	jmp    8011e2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80120c:	4d 85 d2             	test   %r10,%r10
+  80120f:	74 03                	je     801214 <strtol+0xa7>
+  801211:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801214:	48 89 c2             	mov    %rax,%rdx
+  801217:	48 f7 da             	neg    %rdx
+  80121a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80121e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801222:	c3                   	ret
+
+0000000000801223 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801223:	55                   	push   %rbp
+  801224:	48 89 e5             	mov    %rsp,%rbp
+  801227:	53                   	push   %rbx
+  801228:	48 89 fa             	mov    %rdi,%rdx
+  80122b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80122e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801255:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80125a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801269:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126e:	be 00 00 00 00       	mov    $0x0,%esi
+  801273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801279:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80127b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+0000000000801281 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	53                   	push   %rbx
+  801286:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80128a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801292:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801297:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ae:	48 85 c0             	test   %rax,%rax
+  8012b1:	7f 06                	jg     8012b9 <sys_env_destroy+0x38>
+}
+  8012b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b9:	49 89 c0             	mov    %rax,%r8
+  8012bc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012c1:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8012c8:	00 00 00 
+  8012cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d0:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8012d7:	00 00 00 
+  8012da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012df:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  8012e6:	00 00 00 
+  8012e9:	41 ff d1             	call   *%r9
+
+00000000008012ec <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+  8012f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801305:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+  80130f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801315:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+
+000000000080131d <sys_yield>:
+
+void
+sys_yield(void) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801322:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801331:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801336:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133b:	be 00 00 00 00       	mov    $0x0,%esi
+  801340:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801346:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801348:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134c:	c9                   	leave
+  80134d:	c3                   	ret
+
+000000000080134e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80134e:	55                   	push   %rbp
+  80134f:	48 89 e5             	mov    %rsp,%rbp
+  801352:	53                   	push   %rbx
+  801353:	48 89 fa             	mov    %rdi,%rdx
+  801356:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801359:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801365:	00 00 00 
+  801368:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136d:	be 00 00 00 00       	mov    $0x0,%esi
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801378:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80137a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137e:	c9                   	leave
+  80137f:	c3                   	ret
+
+0000000000801380 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801380:	55                   	push   %rbp
+  801381:	48 89 e5             	mov    %rsp,%rbp
+  801384:	53                   	push   %rbx
+  801385:	49 89 f8             	mov    %rdi,%r8
+  801388:	48 89 d3             	mov    %rdx,%rbx
+  80138b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801393:	4c 89 c2             	mov    %r8,%rdx
+  801396:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801399:	be 00 00 00 00       	mov    $0x0,%esi
+  80139e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013aa:	c9                   	leave
+  8013ab:	c3                   	ret
+
+00000000008013ac <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+  8013b0:	53                   	push   %rbx
+  8013b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b5:	89 f8                	mov    %edi,%eax
+  8013b7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ba:	48 63 f9             	movslq %ecx,%rdi
+  8013bd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d5:	48 85 c0             	test   %rax,%rax
+  8013d8:	7f 06                	jg     8013e0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e0:	49 89 c0             	mov    %rax,%r8
+  8013e3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013e8:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8013ef:	00 00 00 
+  8013f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f7:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8013fe:	00 00 00 
+  801401:	b8 00 00 00 00       	mov    $0x0,%eax
+  801406:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  80140d:	00 00 00 
+  801410:	41 ff d1             	call   *%r9
+
+0000000000801413 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+  801418:	48 83 ec 08          	sub    $0x8,%rsp
+  80141c:	89 f8                	mov    %edi,%eax
+  80141e:	49 89 f2             	mov    %rsi,%r10
+  801421:	48 89 cf             	mov    %rcx,%rdi
+  801424:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801427:	48 63 da             	movslq %edx,%rbx
+  80142a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801432:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801435:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801438:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143a:	48 85 c0             	test   %rax,%rax
+  80143d:	7f 06                	jg     801445 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80143f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801443:	c9                   	leave
+  801444:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801445:	49 89 c0             	mov    %rax,%r8
+  801448:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80144d:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801454:	00 00 00 
+  801457:	be 26 00 00 00       	mov    $0x26,%esi
+  80145c:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801463:	00 00 00 
+  801466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146b:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  801472:	00 00 00 
+  801475:	41 ff d1             	call   *%r9
+
+0000000000801478 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801478:	55                   	push   %rbp
+  801479:	48 89 e5             	mov    %rsp,%rbp
+  80147c:	53                   	push   %rbx
+  80147d:	48 83 ec 08          	sub    $0x8,%rsp
+  801481:	49 89 f9             	mov    %rdi,%r9
+  801484:	89 f0                	mov    %esi,%eax
+  801486:	48 89 d3             	mov    %rdx,%rbx
+  801489:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80148c:	49 63 f0             	movslq %r8d,%rsi
+  80148f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801492:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801497:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	7f 06                	jg     8014ad <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ab:	c9                   	leave
+  8014ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ad:	49 89 c0             	mov    %rax,%r8
+  8014b0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014b5:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8014bc:	00 00 00 
+  8014bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c4:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8014cb:	00 00 00 
+  8014ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d3:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  8014da:	00 00 00 
+  8014dd:	41 ff d1             	call   *%r9
+
+00000000008014e0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e9:	48 89 f1             	mov    %rsi,%rcx
+  8014ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801507:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801509:	48 85 c0             	test   %rax,%rax
+  80150c:	7f 06                	jg     801514 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80150e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801514:	49 89 c0             	mov    %rax,%r8
+  801517:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80151c:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801523:	00 00 00 
+  801526:	be 26 00 00 00       	mov    $0x26,%esi
+  80152b:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  801541:	00 00 00 
+  801544:	41 ff d1             	call   *%r9
+
+0000000000801547 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801547:	55                   	push   %rbp
+  801548:	48 89 e5             	mov    %rsp,%rbp
+  80154b:	53                   	push   %rbx
+  80154c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80154f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801554:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156e:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801570:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+
+0000000000801576 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801576:	55                   	push   %rbp
+  801577:	48 89 e5             	mov    %rsp,%rbp
+  80157a:	53                   	push   %rbx
+  80157b:	48 83 ec 08          	sub    $0x8,%rsp
+  80157f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801582:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801585:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801594:	be 00 00 00 00       	mov    $0x0,%esi
+  801599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a1:	48 85 c0             	test   %rax,%rax
+  8015a4:	7f 06                	jg     8015ac <sys_env_set_tls+0x36>
+}
+  8015a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015aa:	c9                   	leave
+  8015ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ac:	49 89 c0             	mov    %rax,%r8
+  8015af:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8015b4:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8015bb:	00 00 00 
+  8015be:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c3:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  8015ca:	00 00 00 
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  8015d9:	00 00 00 
+  8015dc:	41 ff d1             	call   *%r9
+
+00000000008015df <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	53                   	push   %rbx
+  8015e4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015e8:	48 63 ce             	movslq %esi,%rcx
+  8015eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801602:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801608:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160a:	48 85 c0             	test   %rax,%rax
+  80160d:	7f 06                	jg     801615 <sys_env_set_status+0x36>
+}
+  80160f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801615:	49 89 c0             	mov    %rax,%r8
+  801618:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80161d:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801624:	00 00 00 
+  801627:	be 26 00 00 00       	mov    $0x26,%esi
+  80162c:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801633:	00 00 00 
+  801636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163b:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  801642:	00 00 00 
+  801645:	41 ff d1             	call   *%r9
+
+0000000000801648 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	53                   	push   %rbx
+  80164d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801651:	48 63 da             	movslq %edx,%rbx
+  801654:	48 63 ce             	movslq %esi,%rcx
+  801657:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801664:	be 00 00 00 00       	mov    $0x0,%esi
+  801669:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801671:	48 85 c0             	test   %rax,%rax
+  801674:	7f 06                	jg     80167c <sys_env_set_priority+0x34>
+}
+  801676:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167a:	c9                   	leave
+  80167b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167c:	49 89 c0             	mov    %rax,%r8
+  80167f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801684:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80168b:	00 00 00 
+  80168e:	be 26 00 00 00       	mov    $0x26,%esi
+  801693:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80169a:	00 00 00 
+  80169d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a2:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  8016a9:	00 00 00 
+  8016ac:	41 ff d1             	call   *%r9
+
+00000000008016af <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+  8016b3:	53                   	push   %rbx
+  8016b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016be:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016da:	48 85 c0             	test   %rax,%rax
+  8016dd:	7f 06                	jg     8016e5 <sys_env_set_trapframe+0x36>
+}
+  8016df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e3:	c9                   	leave
+  8016e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e5:	49 89 c0             	mov    %rax,%r8
+  8016e8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016ed:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  8016f4:	00 00 00 
+  8016f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fc:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801703:	00 00 00 
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170b:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  801712:	00 00 00 
+  801715:	41 ff d1             	call   *%r9
+
+0000000000801718 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801718:	55                   	push   %rbp
+  801719:	48 89 e5             	mov    %rsp,%rbp
+  80171c:	53                   	push   %rbx
+  80171d:	48 83 ec 08          	sub    $0x8,%rsp
+  801721:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801724:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801727:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801731:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801736:	be 00 00 00 00       	mov    $0x0,%esi
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801741:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801743:	48 85 c0             	test   %rax,%rax
+  801746:	7f 06                	jg     80174e <sys_env_set_pgfault_upcall+0x36>
+}
+  801748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174e:	49 89 c0             	mov    %rax,%r8
+  801751:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801756:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  80175d:	00 00 00 
+  801760:	be 26 00 00 00       	mov    $0x26,%esi
+  801765:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  80176c:	00 00 00 
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  80177b:	00 00 00 
+  80177e:	41 ff d1             	call   *%r9
+
+0000000000801781 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801781:	55                   	push   %rbp
+  801782:	48 89 e5             	mov    %rsp,%rbp
+  801785:	53                   	push   %rbx
+  801786:	89 f8                	mov    %edi,%eax
+  801788:	49 89 f1             	mov    %rsi,%r9
+  80178b:	48 89 d3             	mov    %rdx,%rbx
+  80178e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801791:	49 63 f0             	movslq %r8d,%rsi
+  801794:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801797:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80179c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a5:	cd 30                	int    $0x30
+}
+  8017a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+
+00000000008017ad <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	41 55                	push   %r13
+  8017b3:	41 54                	push   %r12
+  8017b5:	53                   	push   %rbx
+  8017b6:	89 f8                	mov    %edi,%eax
+  8017b8:	49 89 f2             	mov    %rsi,%r10
+  8017bb:	48 89 d3             	mov    %rdx,%rbx
+  8017be:	48 89 cf             	mov    %rcx,%rdi
+  8017c1:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  8017c4:	49 63 f0             	movslq %r8d,%rsi
+  8017c7:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8017ca:	4d 85 c9             	test   %r9,%r9
+  8017cd:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8017d4:	00 00 00 
+  8017d7:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8017db:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8017e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8017e9:	4d 8b 0b             	mov    (%r11),%r9
+  8017ec:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8017f0:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8017f4:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8017f8:	cd 30                	int    $0x30
+}
+  8017fa:	5b                   	pop    %rbx
+  8017fb:	41 5c                	pop    %r12
+  8017fd:	41 5d                	pop    %r13
+  8017ff:	5d                   	pop    %rbp
+  801800:	c3                   	ret
+
+0000000000801801 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	53                   	push   %rbx
+  801806:	48 89 fa             	mov    %rdi,%rdx
+  801809:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80180c:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181b:	be 00 00 00 00       	mov    $0x0,%esi
+  801820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801826:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801828:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182c:	c9                   	leave
+  80182d:	c3                   	ret
+
+000000000080182e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+  801832:	53                   	push   %rbx
+  801833:	48 83 ec 08          	sub    $0x8,%rsp
+  801837:	48 89 fa             	mov    %rdi,%rdx
+  80183a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80183d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801842:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801847:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184c:	be 00 00 00 00       	mov    $0x0,%esi
+  801851:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801857:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801859:	48 85 c0             	test   %rax,%rax
+  80185c:	7f 06                	jg     801864 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80185e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801862:	c9                   	leave
+  801863:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801864:	49 89 c0             	mov    %rax,%r8
+  801867:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80186c:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801873:	00 00 00 
+  801876:	be 26 00 00 00       	mov    $0x26,%esi
+  80187b:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801882:	00 00 00 
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188a:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  801891:	00 00 00 
+  801894:	41 ff d1             	call   *%r9
+
+0000000000801897 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+  80189b:	41 55                	push   %r13
+  80189d:	41 54                	push   %r12
+  80189f:	53                   	push   %rbx
+  8018a0:	89 f8                	mov    %edi,%eax
+  8018a2:	49 89 f2             	mov    %rsi,%r10
+  8018a5:	48 89 d3             	mov    %rdx,%rbx
+  8018a8:	48 89 cf             	mov    %rcx,%rdi
+  8018ab:	44 89 c6             	mov    %r8d,%esi
+  8018ae:	4d 89 c8             	mov    %r9,%r8
+  8018b1:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8018b5:	48 63 f6             	movslq %esi,%rsi
+  8018b8:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8018bb:	4d 85 db             	test   %r11,%r11
+  8018be:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  8018c5:	00 00 00 
+  8018c8:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8018cc:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018d1:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8018d4:	4d 8b 0b             	mov    (%r11),%r9
+  8018d7:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8018db:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8018df:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8018e3:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018e5:	5b                   	pop    %rbx
+  8018e6:	41 5c                	pop    %r12
+  8018e8:	41 5d                	pop    %r13
+  8018ea:	5d                   	pop    %rbp
+  8018eb:	c3                   	ret
+
+00000000008018ec <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8018ec:	55                   	push   %rbp
+  8018ed:	48 89 e5             	mov    %rsp,%rbp
+  8018f0:	41 55                	push   %r13
+  8018f2:	41 54                	push   %r12
+  8018f4:	53                   	push   %rbx
+  8018f5:	89 f8                	mov    %edi,%eax
+  8018f7:	49 89 f2             	mov    %rsi,%r10
+  8018fa:	48 89 d3             	mov    %rdx,%rbx
+  8018fd:	48 89 cf             	mov    %rcx,%rdi
+  801900:	44 89 c6             	mov    %r8d,%esi
+  801903:	4d 89 c8             	mov    %r9,%r8
+  801906:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80190a:	48 63 f6             	movslq %esi,%rsi
+  80190d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801910:	4d 85 db             	test   %r11,%r11
+  801913:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  80191a:	00 00 00 
+  80191d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801921:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801926:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801929:	4d 8b 0b             	mov    (%r11),%r9
+  80192c:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801930:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801934:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801938:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80193a:	5b                   	pop    %rbx
+  80193b:	41 5c                	pop    %r12
+  80193d:	41 5d                	pop    %r13
+  80193f:	5d                   	pop    %rbp
+  801940:	c3                   	ret
+
+0000000000801941 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801941:	55                   	push   %rbp
+  801942:	48 89 e5             	mov    %rsp,%rbp
+  801945:	53                   	push   %rbx
+  801946:	48 83 ec 08          	sub    $0x8,%rsp
+  80194a:	48 89 f1             	mov    %rsi,%rcx
+  80194d:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801950:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801955:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801958:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195d:	be 00 00 00 00       	mov    $0x0,%esi
+  801962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801968:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80196a:	48 85 c0             	test   %rax,%rax
+  80196d:	7f 06                	jg     801975 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80196f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801973:	c9                   	leave
+  801974:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801975:	49 89 c0             	mov    %rax,%r8
+  801978:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80197d:	48 ba 38 56 80 00 00 	movabs $0x805638,%rdx
+  801984:	00 00 00 
+  801987:	be 26 00 00 00       	mov    $0x26,%esi
+  80198c:	48 bf 57 56 80 00 00 	movabs $0x805657,%rdi
+  801993:	00 00 00 
+  801996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199b:	49 b9 87 03 80 00 00 	movabs $0x800387,%r9
+  8019a2:	00 00 00 
+  8019a5:	41 ff d1             	call   *%r9
+
+00000000008019a8 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  8019a8:	55                   	push   %rbp
+  8019a9:	48 89 e5             	mov    %rsp,%rbp
+  8019ac:	53                   	push   %rbx
+  8019ad:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019cf:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8019d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d5:	c9                   	leave
+  8019d6:	c3                   	ret
+
+00000000008019d7 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8019d7:	55                   	push   %rbp
+  8019d8:	48 89 e5             	mov    %rsp,%rbp
+  8019db:	53                   	push   %rbx
+  8019dc:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8019df:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e1:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019fb:	cd 30                	int    $0x30
+}
+  8019fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a01:	c9                   	leave
+  801a02:	c3                   	ret
+
+0000000000801a03 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a03:	55                   	push   %rbp
+  801a04:	48 89 e5             	mov    %rsp,%rbp
+  801a07:	53                   	push   %rbx
+  801a08:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a0b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a0e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a18:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a28:	cd 30                	int    $0x30
+}
+  801a2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2e:	c9                   	leave
+  801a2f:	c3                   	ret
+
+0000000000801a30 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801a30:	55                   	push   %rbp
+  801a31:	48 89 e5             	mov    %rsp,%rbp
+  801a34:	53                   	push   %rbx
+  801a35:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801a38:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a3a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a3f:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a47:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a52:	cd 30                	int    $0x30
+}
+  801a54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+0000000000801a5a <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801a5a:	55                   	push   %rbp
+  801a5b:	48 89 e5             	mov    %rsp,%rbp
+  801a5e:	53                   	push   %rbx
+  801a5f:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801a62:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a65:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a74:	be 00 00 00 00       	mov    $0x0,%esi
+  801a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a7f:	cd 30                	int    $0x30
+}
+  801a81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a85:	c9                   	leave
+  801a86:	c3                   	ret
+
+0000000000801a87 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a87:	55                   	push   %rbp
+  801a88:	48 89 e5             	mov    %rsp,%rbp
+  801a8b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a8c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  801aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ab2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+0000000000801ab8 <sys_monitor>:
+
+int sys_monitor(void) {
+  801ab8:	55                   	push   %rbp
+  801ab9:	48 89 e5             	mov    %rsp,%rbp
+  801abc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801abd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad6:	be 00 00 00 00       	mov    $0x0,%esi
+  801adb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae1:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ae3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+0000000000801ae9 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801ae9:	55                   	push   %rbp
+  801aea:	48 89 e5             	mov    %rsp,%rbp
+  801aed:	41 55                	push   %r13
+  801aef:	41 54                	push   %r12
+  801af1:	53                   	push   %rbx
+  801af2:	48 83 ec 08          	sub    $0x8,%rsp
+  801af6:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801af9:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801afc:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+  801b08:	41 89 c5             	mov    %eax,%r13d
+  801b0b:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801b0f:	a8 40                	test   $0x40,%al
+  801b11:	75 31                	jne    801b44 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801b13:	a8 02                	test   $0x2,%al
+  801b15:	74 5f                	je     801b76 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b17:	45 89 e9             	mov    %r13d,%r9d
+  801b1a:	41 83 c9 40          	or     $0x40,%r9d
+  801b1e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b24:	48 89 d9             	mov    %rbx,%rcx
+  801b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2c:	48 89 de             	mov    %rbx,%rsi
+  801b2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b34:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	78 27                	js     801b6b <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801b44:	45 89 e9             	mov    %r13d,%r9d
+  801b47:	41 83 c9 40          	or     $0x40,%r9d
+  801b4b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b51:	48 89 d9             	mov    %rbx,%rcx
+  801b54:	44 89 e2             	mov    %r12d,%edx
+  801b57:	48 89 de             	mov    %rbx,%rsi
+  801b5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5f:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+}
+  801b6b:	48 83 c4 08          	add    $0x8,%rsp
+  801b6f:	5b                   	pop    %rbx
+  801b70:	41 5c                	pop    %r12
+  801b72:	41 5d                	pop    %r13
+  801b74:	5d                   	pop    %rbp
+  801b75:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  801b76:	83 e0 01             	and    $0x1,%eax
+  801b79:	83 c8 06             	or     $0x6,%eax
+  801b7c:	41 89 c1             	mov    %eax,%r9d
+  801b7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b85:	48 89 d9             	mov    %rbx,%rcx
+  801b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8d:	48 89 de             	mov    %rbx,%rsi
+  801b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b95:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	0f 85 6e ff ff ff    	jne    801b17 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  801ba9:	48 89 df             	mov    %rbx,%rdi
+  801bac:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+  801bb8:	83 e0 5f             	and    $0x5f,%eax
+  801bbb:	41 89 c5             	mov    %eax,%r13d
+  801bbe:	e9 54 ff ff ff       	jmp    801b17 <sfork_page+0x2e>
+
+0000000000801bc3 <fork>:
+fork(void) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	41 54                	push   %r12
+  801bc9:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801bca:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bcf:	cd 30                	int    $0x30
+  801bd1:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	0f 88 81 00 00 00    	js     801c5d <fork+0x9a>
+    if (envid == CURENVID) {
+  801bdc:	0f 84 83 00 00 00    	je     801c65 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801be2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801be8:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801bef:	00 00 00 
+  801bf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf7:	89 c2                	mov    %eax,%edx
+  801bf9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	0f 85 82 00 00 00    	jne    801c99 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  801c17:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c1e:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801c20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c24:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801c2b:	44 89 e7             	mov    %r12d,%edi
+  801c2e:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	75 63                	jne    801ca1 <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  801c3e:	be 02 00 00 00       	mov    $0x2,%esi
+  801c43:	44 89 e7             	mov    %r12d,%edi
+  801c46:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801c4d:	00 00 00 
+  801c50:	ff d0                	call   *%rax
+        return -1;
+  801c52:	85 c0                	test   %eax,%eax
+  801c54:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c59:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  801c5d:	44 89 e0             	mov    %r12d,%eax
+  801c60:	5b                   	pop    %rbx
+  801c61:	41 5c                	pop    %r12
+  801c63:	5d                   	pop    %rbp
+  801c64:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801c65:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+  801c71:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801c78:	00 00 
+  801c7a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c7f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801c86:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801c8d:	00 00 00 
+  801c90:	48 01 c8             	add    %rcx,%rax
+  801c93:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801c97:	eb c4                	jmp    801c5d <fork+0x9a>
+        return -1;
+  801c99:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801c9f:	eb bc                	jmp    801c5d <fork+0x9a>
+  801ca1:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ca7:	eb b4                	jmp    801c5d <fork+0x9a>
+
+0000000000801ca9 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	53                   	push   %rbx
+  801cae:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  801cb2:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cb7:	cd 30                	int    $0x30
+  801cb9:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  801cbb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 40                	js     801d02 <sfork+0x59>
+
+    if (envid == CURENVID) {
+  801cc2:	74 46                	je     801d0a <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  801cc4:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  801cc8:	48 ba e9 1a 80 00 00 	movabs $0x801ae9,%rdx
+  801ccf:	00 00 00 
+  801cd2:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801cd9:	00 00 00 
+  801cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce1:	48 b8 33 45 80 00 00 	movabs $0x804533,%rax
+  801ce8:	00 00 00 
+  801ceb:	ff d0                	call   *%rax
+  801ced:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	79 4b                	jns    801d3e <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  801cf3:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801cf6:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  801d02:	89 d8                	mov    %ebx,%eax
+  801d04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d08:	c9                   	leave
+  801d09:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d0a:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  801d11:	00 00 00 
+  801d14:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  801d16:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  801d1d:	00 00 
+  801d1f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d24:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  801d2b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d32:	00 00 00 
+  801d35:	48 01 c8             	add    %rcx,%rax
+  801d38:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  801d3c:	eb c4                	jmp    801d02 <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  801d3e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d44:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  801d4a:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  801d51:	00 00 00 
+  801d54:	48 89 f1             	mov    %rsi,%rcx
+  801d57:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5f:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  801d66:	00 00 00 
+  801d69:	ff d0                	call   *%rax
+  801d6b:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 82                	js     801cf3 <sfork+0x4a>
+  801d71:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801d78:	00 00 
+  801d7a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d7e:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  801d85:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801d88:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801d8f:	00 00 00 
+  801d92:	ff d0                	call   *%rax
+  801d94:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	0f 88 55 ff ff ff    	js     801cf3 <sfork+0x4a>
+  801d9e:	be 02 00 00 00       	mov    $0x2,%esi
+  801da3:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801da6:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  801dad:	00 00 00 
+  801db0:	ff d0                	call   *%rax
+  801db2:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	0f 88 37 ff ff ff    	js     801cf3 <sfork+0x4a>
+    return envid;
+  801dbc:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  801dbf:	e9 3e ff ff ff       	jmp    801d02 <sfork+0x59>
+
+0000000000801dc4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dc4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dcb:	ff ff ff 
+  801dce:	48 01 f8             	add    %rdi,%rax
+  801dd1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801dd5:	c3                   	ret
+
+0000000000801dd6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dd6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ddd:	ff ff ff 
+  801de0:	48 01 f8             	add    %rdi,%rax
+  801de3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801de7:	48 c1 e0 12          	shl    $0x12,%rax
+  801deb:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801df0:	48 01 d0             	add    %rdx,%rax
+}
+  801df3:	c3                   	ret
+
+0000000000801df4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	41 57                	push   %r15
+  801dfa:	41 56                	push   %r14
+  801dfc:	41 55                	push   %r13
+  801dfe:	41 54                	push   %r12
+  801e00:	53                   	push   %rbx
+  801e01:	48 83 ec 08          	sub    $0x8,%rsp
+  801e05:	49 89 ff             	mov    %rdi,%r15
+  801e08:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e0d:	49 bd bf 44 80 00 00 	movabs $0x8044bf,%r13
+  801e14:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e17:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e1d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e20:	48 89 df             	mov    %rbx,%rdi
+  801e23:	41 ff d5             	call   *%r13
+  801e26:	83 e0 04             	and    $0x4,%eax
+  801e29:	74 17                	je     801e42 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e2b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e32:	4c 39 f3             	cmp    %r14,%rbx
+  801e35:	75 e6                	jne    801e1d <fd_alloc+0x29>
+  801e37:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e3d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e42:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e45:	48 83 c4 08          	add    $0x8,%rsp
+  801e49:	5b                   	pop    %rbx
+  801e4a:	41 5c                	pop    %r12
+  801e4c:	41 5d                	pop    %r13
+  801e4e:	41 5e                	pop    %r14
+  801e50:	41 5f                	pop    %r15
+  801e52:	5d                   	pop    %rbp
+  801e53:	c3                   	ret
+
+0000000000801e54 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e54:	83 ff 1f             	cmp    $0x1f,%edi
+  801e57:	77 39                	ja     801e92 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e59:	55                   	push   %rbp
+  801e5a:	48 89 e5             	mov    %rsp,%rbp
+  801e5d:	41 54                	push   %r12
+  801e5f:	53                   	push   %rbx
+  801e60:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e63:	48 63 df             	movslq %edi,%rbx
+  801e66:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e6d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e71:	48 89 df             	mov    %rbx,%rdi
+  801e74:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  801e7b:	00 00 00 
+  801e7e:	ff d0                	call   *%rax
+  801e80:	a8 04                	test   $0x4,%al
+  801e82:	74 14                	je     801e98 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e84:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8d:	5b                   	pop    %rbx
+  801e8e:	41 5c                	pop    %r12
+  801e90:	5d                   	pop    %rbp
+  801e91:	c3                   	ret
+        return -E_INVAL;
+  801e92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e97:	c3                   	ret
+        return -E_INVAL;
+  801e98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9d:	eb ee                	jmp    801e8d <fd_lookup+0x39>
+
+0000000000801e9f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e9f:	55                   	push   %rbp
+  801ea0:	48 89 e5             	mov    %rsp,%rbp
+  801ea3:	41 54                	push   %r12
+  801ea5:	53                   	push   %rbx
+  801ea6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ea9:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  801eb0:	00 00 00 
+  801eb3:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801eba:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ebd:	39 3b                	cmp    %edi,(%rbx)
+  801ebf:	74 4a                	je     801f0b <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ec1:	48 83 c0 08          	add    $0x8,%rax
+  801ec5:	48 8b 18             	mov    (%rax),%rbx
+  801ec8:	48 85 db             	test   %rbx,%rbx
+  801ecb:	75 f0                	jne    801ebd <dev_lookup+0x1e>
+  801ecd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ed4:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ed6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801eda:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ee0:	89 fa                	mov    %edi,%edx
+  801ee2:	48 bf a0 56 80 00 00 	movabs $0x8056a0,%rdi
+  801ee9:	00 00 00 
+  801eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef1:	48 b9 d7 04 80 00 00 	movabs $0x8004d7,%rcx
+  801ef8:	00 00 00 
+  801efb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801efd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f02:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f06:	5b                   	pop    %rbx
+  801f07:	41 5c                	pop    %r12
+  801f09:	5d                   	pop    %rbp
+  801f0a:	c3                   	ret
+            return 0;
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f10:	eb f0                	jmp    801f02 <dev_lookup+0x63>
+
+0000000000801f12 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f12:	55                   	push   %rbp
+  801f13:	48 89 e5             	mov    %rsp,%rbp
+  801f16:	41 55                	push   %r13
+  801f18:	41 54                	push   %r12
+  801f1a:	53                   	push   %rbx
+  801f1b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f1f:	48 89 fb             	mov    %rdi,%rbx
+  801f22:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f25:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f2c:	ff ff ff 
+  801f2f:	48 01 df             	add    %rbx,%rdi
+  801f32:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f36:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3a:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  801f41:	00 00 00 
+  801f44:	ff d0                	call   *%rax
+  801f46:	41 89 c5             	mov    %eax,%r13d
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	78 06                	js     801f53 <fd_close+0x41>
+  801f4d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f51:	74 1a                	je     801f6d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f53:	45 84 e4             	test   %r12b,%r12b
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f5f:	44 89 e8             	mov    %r13d,%eax
+  801f62:	48 83 c4 18          	add    $0x18,%rsp
+  801f66:	5b                   	pop    %rbx
+  801f67:	41 5c                	pop    %r12
+  801f69:	41 5d                	pop    %r13
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f6d:	8b 3b                	mov    (%rbx),%edi
+  801f6f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f73:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  801f7a:	00 00 00 
+  801f7d:	ff d0                	call   *%rax
+  801f7f:	41 89 c5             	mov    %eax,%r13d
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	78 1b                	js     801fa1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f8a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f8e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f94:	48 85 c0             	test   %rax,%rax
+  801f97:	74 08                	je     801fa1 <fd_close+0x8f>
+  801f99:	48 89 df             	mov    %rbx,%rdi
+  801f9c:	ff d0                	call   *%rax
+  801f9e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801fa1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fa6:	48 89 de             	mov    %rbx,%rsi
+  801fa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fae:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+    return res;
+  801fba:	eb a3                	jmp    801f5f <fd_close+0x4d>
+
+0000000000801fbc <close>:
+
+int
+close(int fdnum) {
+  801fbc:	55                   	push   %rbp
+  801fbd:	48 89 e5             	mov    %rsp,%rbp
+  801fc0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fc4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fc8:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 15                	js     801fed <close+0x31>
+
+    return fd_close(fd, 1);
+  801fd8:	be 01 00 00 00       	mov    $0x1,%esi
+  801fdd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fe1:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+0000000000801fef <close_all>:
+
+void
+close_all(void) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	41 54                	push   %r12
+  801ff5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ffb:	49 bc bc 1f 80 00 00 	movabs $0x801fbc,%r12
+  802002:	00 00 00 
+  802005:	89 df                	mov    %ebx,%edi
+  802007:	41 ff d4             	call   *%r12
+  80200a:	83 c3 01             	add    $0x1,%ebx
+  80200d:	83 fb 20             	cmp    $0x20,%ebx
+  802010:	75 f3                	jne    802005 <close_all+0x16>
+}
+  802012:	5b                   	pop    %rbx
+  802013:	41 5c                	pop    %r12
+  802015:	5d                   	pop    %rbp
+  802016:	c3                   	ret
+
+0000000000802017 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802017:	55                   	push   %rbp
+  802018:	48 89 e5             	mov    %rsp,%rbp
+  80201b:	41 57                	push   %r15
+  80201d:	41 56                	push   %r14
+  80201f:	41 55                	push   %r13
+  802021:	41 54                	push   %r12
+  802023:	53                   	push   %rbx
+  802024:	48 83 ec 38          	sub    $0x38,%rsp
+  802028:	41 89 f7             	mov    %esi,%r15d
+  80202b:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80202e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802032:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802039:	00 00 00 
+  80203c:	ff d0                	call   *%rax
+  80203e:	89 c3                	mov    %eax,%ebx
+  802040:	85 c0                	test   %eax,%eax
+  802042:	0f 88 ec 00 00 00    	js     802134 <dup+0x11d>
+    close(newfdnum);
+  802048:	44 89 ff             	mov    %r15d,%edi
+  80204b:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802057:	49 63 c7             	movslq %r15d,%rax
+  80205a:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802060:	48 c1 e0 0c          	shl    $0xc,%rax
+  802064:	49 89 c6             	mov    %rax,%r14
+  802067:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80206b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80206f:	4c 89 ff             	mov    %r15,%rdi
+  802072:	48 bb d6 1d 80 00 00 	movabs $0x801dd6,%rbx
+  802079:	00 00 00 
+  80207c:	ff d3                	call   *%rbx
+  80207e:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802081:	4c 89 f7             	mov    %r14,%rdi
+  802084:	ff d3                	call   *%rbx
+  802086:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80208a:	4c 89 e7             	mov    %r12,%rdi
+  80208d:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+  802099:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80209c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8020a1:	49 be bf 44 80 00 00 	movabs $0x8044bf,%r14
+  8020a8:	00 00 00 
+  8020ab:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8020af:	41 ff d6             	call   *%r14
+  8020b2:	44 39 e8             	cmp    %r13d,%eax
+  8020b5:	75 10                	jne    8020c7 <dup+0xb0>
+  8020b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8020be:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8020c5:	75 e4                	jne    8020ab <dup+0x94>
+    if (prot & PROT_R) {
+  8020c7:	41 f6 c5 04          	test   $0x4,%r13b
+  8020cb:	74 29                	je     8020f6 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8020cd:	45 89 e9             	mov    %r13d,%r9d
+  8020d0:	49 89 d8             	mov    %rbx,%r8
+  8020d3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8020d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020dc:	4c 89 e6             	mov    %r12,%rsi
+  8020df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e4:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  8020eb:	00 00 00 
+  8020ee:	ff d0                	call   *%rax
+  8020f0:	89 c3                	mov    %eax,%ebx
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	78 4f                	js     802145 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8020f6:	4c 89 ff             	mov    %r15,%rdi
+  8020f9:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802108:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80210e:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802112:	ba 00 00 00 00       	mov    $0x0,%edx
+  802117:	4c 89 fe             	mov    %r15,%rsi
+  80211a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211f:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  802126:	00 00 00 
+  802129:	ff d0                	call   *%rax
+  80212b:	89 c3                	mov    %eax,%ebx
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	78 14                	js     802145 <dup+0x12e>
+
+    return newfdnum;
+  802131:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802134:	89 d8                	mov    %ebx,%eax
+  802136:	48 83 c4 38          	add    $0x38,%rsp
+  80213a:	5b                   	pop    %rbx
+  80213b:	41 5c                	pop    %r12
+  80213d:	41 5d                	pop    %r13
+  80213f:	41 5e                	pop    %r14
+  802141:	41 5f                	pop    %r15
+  802143:	5d                   	pop    %rbp
+  802144:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802145:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80214a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80214e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802153:	49 bc e0 14 80 00 00 	movabs $0x8014e0,%r12
+  80215a:	00 00 00 
+  80215d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802160:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802165:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216e:	41 ff d4             	call   *%r12
+    return res;
+  802171:	eb c1                	jmp    802134 <dup+0x11d>
+
+0000000000802173 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802173:	55                   	push   %rbp
+  802174:	48 89 e5             	mov    %rsp,%rbp
+  802177:	41 56                	push   %r14
+  802179:	41 55                	push   %r13
+  80217b:	41 54                	push   %r12
+  80217d:	53                   	push   %rbx
+  80217e:	48 83 ec 10          	sub    $0x10,%rsp
+  802182:	89 fb                	mov    %edi,%ebx
+  802184:	49 89 f4             	mov    %rsi,%r12
+  802187:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80218a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80218e:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 4c                	js     8021ea <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80219e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021a2:	41 8b 3e             	mov    (%r14),%edi
+  8021a5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021a9:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 35                	js     8021ee <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021b9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8021bd:	83 e0 03             	and    $0x3,%eax
+  8021c0:	83 f8 01             	cmp    $0x1,%eax
+  8021c3:	74 2d                	je     8021f2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021c9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8021cd:	48 85 c0             	test   %rax,%rax
+  8021d0:	74 59                	je     80222b <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8021d2:	4c 89 ea             	mov    %r13,%rdx
+  8021d5:	4c 89 e6             	mov    %r12,%rsi
+  8021d8:	4c 89 f7             	mov    %r14,%rdi
+  8021db:	ff d0                	call   *%rax
+}
+  8021dd:	48 83 c4 10          	add    $0x10,%rsp
+  8021e1:	5b                   	pop    %rbx
+  8021e2:	41 5c                	pop    %r12
+  8021e4:	41 5d                	pop    %r13
+  8021e6:	41 5e                	pop    %r14
+  8021e8:	5d                   	pop    %rbp
+  8021e9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ea:	48 98                	cltq
+  8021ec:	eb ef                	jmp    8021dd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ee:	48 98                	cltq
+  8021f0:	eb eb                	jmp    8021dd <read+0x6a>
+  8021f2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021f9:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021ff:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802205:	89 da                	mov    %ebx,%edx
+  802207:	48 bf e1 56 80 00 00 	movabs $0x8056e1,%rdi
+  80220e:	00 00 00 
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+  802216:	48 b9 d7 04 80 00 00 	movabs $0x8004d7,%rcx
+  80221d:	00 00 00 
+  802220:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802222:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802229:	eb b2                	jmp    8021dd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80222b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802232:	eb a9                	jmp    8021dd <read+0x6a>
+
+0000000000802234 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802234:	55                   	push   %rbp
+  802235:	48 89 e5             	mov    %rsp,%rbp
+  802238:	41 57                	push   %r15
+  80223a:	41 56                	push   %r14
+  80223c:	41 55                	push   %r13
+  80223e:	41 54                	push   %r12
+  802240:	53                   	push   %rbx
+  802241:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802245:	48 85 d2             	test   %rdx,%rdx
+  802248:	74 54                	je     80229e <readn+0x6a>
+  80224a:	41 89 fd             	mov    %edi,%r13d
+  80224d:	49 89 f6             	mov    %rsi,%r14
+  802250:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802253:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802258:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80225d:	49 bf 73 21 80 00 00 	movabs $0x802173,%r15
+  802264:	00 00 00 
+  802267:	4c 89 e2             	mov    %r12,%rdx
+  80226a:	48 29 f2             	sub    %rsi,%rdx
+  80226d:	4c 01 f6             	add    %r14,%rsi
+  802270:	44 89 ef             	mov    %r13d,%edi
+  802273:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802276:	85 c0                	test   %eax,%eax
+  802278:	78 20                	js     80229a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80227a:	01 c3                	add    %eax,%ebx
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	74 08                	je     802288 <readn+0x54>
+  802280:	48 63 f3             	movslq %ebx,%rsi
+  802283:	4c 39 e6             	cmp    %r12,%rsi
+  802286:	72 df                	jb     802267 <readn+0x33>
+    }
+    return res;
+  802288:	48 63 c3             	movslq %ebx,%rax
+}
+  80228b:	48 83 c4 08          	add    $0x8,%rsp
+  80228f:	5b                   	pop    %rbx
+  802290:	41 5c                	pop    %r12
+  802292:	41 5d                	pop    %r13
+  802294:	41 5e                	pop    %r14
+  802296:	41 5f                	pop    %r15
+  802298:	5d                   	pop    %rbp
+  802299:	c3                   	ret
+        if (inc < 0) return inc;
+  80229a:	48 98                	cltq
+  80229c:	eb ed                	jmp    80228b <readn+0x57>
+    int inc = 1, res = 0;
+  80229e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022a3:	eb e3                	jmp    802288 <readn+0x54>
+
+00000000008022a5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8022a5:	55                   	push   %rbp
+  8022a6:	48 89 e5             	mov    %rsp,%rbp
+  8022a9:	41 56                	push   %r14
+  8022ab:	41 55                	push   %r13
+  8022ad:	41 54                	push   %r12
+  8022af:	53                   	push   %rbx
+  8022b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b4:	89 fb                	mov    %edi,%ebx
+  8022b6:	49 89 f4             	mov    %rsi,%r12
+  8022b9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022bc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022c0:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+  8022cc:	85 c0                	test   %eax,%eax
+  8022ce:	78 47                	js     802317 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022d0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022d4:	41 8b 3e             	mov    (%r14),%edi
+  8022d7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022db:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 30                	js     80231b <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022eb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8022f0:	74 2d                	je     80231f <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022f6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8022fa:	48 85 c0             	test   %rax,%rax
+  8022fd:	74 59                	je     802358 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8022ff:	4c 89 ea             	mov    %r13,%rdx
+  802302:	4c 89 e6             	mov    %r12,%rsi
+  802305:	4c 89 f7             	mov    %r14,%rdi
+  802308:	ff d0                	call   *%rax
+}
+  80230a:	48 83 c4 10          	add    $0x10,%rsp
+  80230e:	5b                   	pop    %rbx
+  80230f:	41 5c                	pop    %r12
+  802311:	41 5d                	pop    %r13
+  802313:	41 5e                	pop    %r14
+  802315:	5d                   	pop    %rbp
+  802316:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802317:	48 98                	cltq
+  802319:	eb ef                	jmp    80230a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80231b:	48 98                	cltq
+  80231d:	eb eb                	jmp    80230a <write+0x65>
+  80231f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802326:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802328:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80232c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802332:	89 da                	mov    %ebx,%edx
+  802334:	48 bf fd 56 80 00 00 	movabs $0x8056fd,%rdi
+  80233b:	00 00 00 
+  80233e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802343:	48 b9 d7 04 80 00 00 	movabs $0x8004d7,%rcx
+  80234a:	00 00 00 
+  80234d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80234f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802356:	eb b2                	jmp    80230a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802358:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80235f:	eb a9                	jmp    80230a <write+0x65>
+
+0000000000802361 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802361:	55                   	push   %rbp
+  802362:	48 89 e5             	mov    %rsp,%rbp
+  802365:	53                   	push   %rbx
+  802366:	48 83 ec 18          	sub    $0x18,%rsp
+  80236a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80236c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802370:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 0c                	js     80238c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802380:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802384:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802387:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802390:	c9                   	leave
+  802391:	c3                   	ret
+
+0000000000802392 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+  802396:	41 55                	push   %r13
+  802398:	41 54                	push   %r12
+  80239a:	53                   	push   %rbx
+  80239b:	48 83 ec 18          	sub    $0x18,%rsp
+  80239f:	89 fb                	mov    %edi,%ebx
+  8023a1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023a4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023a8:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  8023af:	00 00 00 
+  8023b2:	ff d0                	call   *%rax
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 38                	js     8023f0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023b8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8023bc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8023c0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023c4:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  8023cb:	00 00 00 
+  8023ce:	ff d0                	call   *%rax
+  8023d0:	85 c0                	test   %eax,%eax
+  8023d2:	78 1c                	js     8023f0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023d4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8023d9:	74 20                	je     8023fb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023db:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023df:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8023e3:	48 85 c0             	test   %rax,%rax
+  8023e6:	74 4a                	je     802432 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8023e8:	44 89 e6             	mov    %r12d,%esi
+  8023eb:	4c 89 ef             	mov    %r13,%rdi
+  8023ee:	ff d0                	call   *%rax
+}
+  8023f0:	48 83 c4 18          	add    $0x18,%rsp
+  8023f4:	5b                   	pop    %rbx
+  8023f5:	41 5c                	pop    %r12
+  8023f7:	41 5d                	pop    %r13
+  8023f9:	5d                   	pop    %rbp
+  8023fa:	c3                   	ret
+  8023fb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802402:	00 00 
+                thisenv->env_id, fdnum);
+  802404:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802408:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80240e:	89 da                	mov    %ebx,%edx
+  802410:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  802417:	00 00 00 
+  80241a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241f:	48 b9 d7 04 80 00 00 	movabs $0x8004d7,%rcx
+  802426:	00 00 00 
+  802429:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80242b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802430:	eb be                	jmp    8023f0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802432:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802437:	eb b7                	jmp    8023f0 <ftruncate+0x5e>
+
+0000000000802439 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802439:	55                   	push   %rbp
+  80243a:	48 89 e5             	mov    %rsp,%rbp
+  80243d:	41 54                	push   %r12
+  80243f:	53                   	push   %rbx
+  802440:	48 83 ec 10          	sub    $0x10,%rsp
+  802444:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802447:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80244b:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802452:	00 00 00 
+  802455:	ff d0                	call   *%rax
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 4e                	js     8024a9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80245b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80245f:	41 8b 3c 24          	mov    (%r12),%edi
+  802463:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802467:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+  802473:	85 c0                	test   %eax,%eax
+  802475:	78 32                	js     8024a9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802477:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80247b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802480:	74 30                	je     8024b2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802482:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802485:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80248c:	00 00 00 
+    stat->st_isdir = 0;
+  80248f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802496:	00 00 00 
+    stat->st_dev = dev;
+  802499:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8024a0:	48 89 de             	mov    %rbx,%rsi
+  8024a3:	4c 89 e7             	mov    %r12,%rdi
+  8024a6:	ff 50 28             	call   *0x28(%rax)
+}
+  8024a9:	48 83 c4 10          	add    $0x10,%rsp
+  8024ad:	5b                   	pop    %rbx
+  8024ae:	41 5c                	pop    %r12
+  8024b0:	5d                   	pop    %rbp
+  8024b1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b7:	eb f0                	jmp    8024a9 <fstat+0x70>
+
+00000000008024b9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8024b9:	55                   	push   %rbp
+  8024ba:	48 89 e5             	mov    %rsp,%rbp
+  8024bd:	41 54                	push   %r12
+  8024bf:	53                   	push   %rbx
+  8024c0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8024c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c8:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8024d6:	85 c0                	test   %eax,%eax
+  8024d8:	78 25                	js     8024ff <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8024da:	4c 89 e6             	mov    %r12,%rsi
+  8024dd:	89 c7                	mov    %eax,%edi
+  8024df:	48 b8 39 24 80 00 00 	movabs $0x802439,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+  8024eb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8024ee:	89 df                	mov    %ebx,%edi
+  8024f0:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+
+    return res;
+  8024fc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8024ff:	89 d8                	mov    %ebx,%eax
+  802501:	5b                   	pop    %rbx
+  802502:	41 5c                	pop    %r12
+  802504:	5d                   	pop    %rbp
+  802505:	c3                   	ret
+
+0000000000802506 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802506:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80250d:	00 00 00 
+  802510:	ba 00 00 00 00       	mov    $0x0,%edx
+  802515:	eb 0e                	jmp    802525 <mmap_lookup+0x1f>
+  802517:	48 83 c2 01          	add    $0x1,%rdx
+  80251b:	48 83 c0 20          	add    $0x20,%rax
+  80251f:	48 83 fa 40          	cmp    $0x40,%rdx
+  802523:	74 2b                	je     802550 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802525:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802529:	48 85 c9             	test   %rcx,%rcx
+  80252c:	74 e9                	je     802517 <mmap_lookup+0x11>
+  80252e:	48 8b 30             	mov    (%rax),%rsi
+  802531:	48 39 f7             	cmp    %rsi,%rdi
+  802534:	72 e1                	jb     802517 <mmap_lookup+0x11>
+  802536:	48 01 f1             	add    %rsi,%rcx
+  802539:	48 39 cf             	cmp    %rcx,%rdi
+  80253c:	73 d9                	jae    802517 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80253e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802542:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802549:	00 00 00 
+  80254c:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  80254f:	c3                   	ret
+    return NULL;
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+  802555:	c3                   	ret
+
+0000000000802556 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	41 54                	push   %r12
+  80255c:	53                   	push   %rbx
+  80255d:	89 fb                	mov    %edi,%ebx
+  80255f:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802562:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802569:	00 00 00 
+  80256c:	83 38 00             	cmpl   $0x0,(%rax)
+  80256f:	74 3d                	je     8025ae <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802571:	41 54                	push   %r12
+  802573:	6a 00                	push   $0x0
+  802575:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802581:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802586:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258b:	89 de                	mov    %ebx,%esi
+  80258d:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802594:	00 00 00 
+  802597:	8b 38                	mov    (%rax),%edi
+  802599:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+}
+  8025a5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	5d                   	pop    %rbp
+  8025ad:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025ae:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025b3:	48 b8 8a 4d 80 00 00 	movabs $0x804d8a,%rax
+  8025ba:	00 00 00 
+  8025bd:	ff d0                	call   *%rax
+  8025bf:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8025c6:	00 00 
+  8025c8:	eb a7                	jmp    802571 <fsipc_words+0x1b>
+
+00000000008025ca <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8025ca:	55                   	push   %rbp
+  8025cb:	48 89 e5             	mov    %rsp,%rbp
+  8025ce:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8025d2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8025d9:	00 
+  8025da:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8025e1:	00 
+  8025e2:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8025e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025ea:	48 63 f6             	movslq %esi,%rsi
+  8025ed:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8025f1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025f5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8025fa:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+}
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+0000000000802608 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802610:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802617:	00 
+  802618:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80261f:	00 
+  802620:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802627:	00 
+  802628:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80262c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802630:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802634:	bf 06 00 00 00       	mov    $0x6,%edi
+  802639:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+}
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+
+0000000000802647 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802647:	55                   	push   %rbp
+  802648:	48 89 e5             	mov    %rsp,%rbp
+  80264b:	41 54                	push   %r12
+  80264d:	53                   	push   %rbx
+  80264e:	89 fb                	mov    %edi,%ebx
+  802650:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802653:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80265a:	00 00 00 
+  80265d:	83 38 00             	cmpl   $0x0,(%rax)
+  802660:	74 3f                	je     8026a1 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802662:	6a 00                	push   $0x0
+  802664:	6a 00                	push   $0x0
+  802666:	4d 89 e1             	mov    %r12,%r9
+  802669:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80266f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802674:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80267b:	00 00 00 
+  80267e:	89 de                	mov    %ebx,%esi
+  802680:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802687:	00 00 00 
+  80268a:	8b 38                	mov    (%rax),%edi
+  80268c:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+}
+  802698:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80269c:	5b                   	pop    %rbx
+  80269d:	41 5c                	pop    %r12
+  80269f:	5d                   	pop    %rbp
+  8026a0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026a1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026a6:	48 b8 8a 4d 80 00 00 	movabs $0x804d8a,%rax
+  8026ad:	00 00 00 
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8026b9:	00 00 
+  8026bb:	eb a5                	jmp    802662 <fsipc+0x1b>
+
+00000000008026bd <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8026bd:	55                   	push   %rbp
+  8026be:	48 89 e5             	mov    %rsp,%rbp
+  8026c1:	41 54                	push   %r12
+  8026c3:	53                   	push   %rbx
+  8026c4:	41 89 fc             	mov    %edi,%r12d
+  8026c7:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ca:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8026d1:	00 00 00 
+  8026d4:	83 38 00             	cmpl   $0x0,(%rax)
+  8026d7:	74 46                	je     80271f <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8026d9:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8026dd:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8026e1:	6a 00                	push   $0x0
+  8026e3:	6a 00                	push   $0x0
+  8026e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026eb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026f1:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8026f8:	00 00 00 
+  8026fb:	44 89 e6             	mov    %r12d,%esi
+  8026fe:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802705:	00 00 00 
+  802708:	8b 38                	mov    (%rax),%edi
+  80270a:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+}
+  802716:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80271a:	5b                   	pop    %rbx
+  80271b:	41 5c                	pop    %r12
+  80271d:	5d                   	pop    %rbp
+  80271e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80271f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802724:	48 b8 8a 4d 80 00 00 	movabs $0x804d8a,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802737:	00 00 
+  802739:	eb 9e                	jmp    8026d9 <fsipcv+0x1c>
+
+000000000080273b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	41 54                	push   %r12
+  802741:	53                   	push   %rbx
+  802742:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802745:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802748:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80274f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802751:	be 00 00 00 00       	mov    $0x0,%esi
+  802756:	bf 05 00 00 00       	mov    $0x5,%edi
+  80275b:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802767:	85 c0                	test   %eax,%eax
+  802769:	78 3d                	js     8027a8 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80276b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802772:	00 00 00 
+  802775:	4c 89 e6             	mov    %r12,%rsi
+  802778:	48 89 df             	mov    %rbx,%rdi
+  80277b:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802787:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80278e:	00 
+  80278f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802795:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80279c:	00 
+  80279d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8027a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a8:	5b                   	pop    %rbx
+  8027a9:	41 5c                	pop    %r12
+  8027ab:	5d                   	pop    %rbp
+  8027ac:	c3                   	ret
+
+00000000008027ad <fsipcv_buf>:
+    return FSIPCV;
+  8027ad:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8027b4:	00 00 00 
+    if (!allocated) {
+  8027b7:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8027be:	00 00 00 
+  8027c1:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8027c4:	74 01                	je     8027c7 <fsipcv_buf+0x1a>
+}
+  8027c6:	c3                   	ret
+fsipcv_buf(void) {
+  8027c7:	55                   	push   %rbp
+  8027c8:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8027cb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027d0:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027d5:	48 89 c6             	mov    %rax,%rsi
+  8027d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027dd:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	78 19                	js     802806 <fsipcv_buf+0x59>
+        allocated = 1;
+  8027ed:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8027f4:	00 00 00 
+  8027f7:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8027fa:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802801:	00 00 00 
+}
+  802804:	5d                   	pop    %rbp
+  802805:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280b:	eb f7                	jmp    802804 <fsipcv_buf+0x57>
+
+000000000080280d <devfile_write>:
+    if (!fd || !buf) {
+  80280d:	48 85 ff             	test   %rdi,%rdi
+  802810:	0f 84 46 01 00 00    	je     80295c <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802816:	55                   	push   %rbp
+  802817:	48 89 e5             	mov    %rsp,%rbp
+  80281a:	41 57                	push   %r15
+  80281c:	41 56                	push   %r14
+  80281e:	41 55                	push   %r13
+  802820:	41 54                	push   %r12
+  802822:	53                   	push   %rbx
+  802823:	48 83 ec 18          	sub    $0x18,%rsp
+  802827:	49 89 ff             	mov    %rdi,%r15
+  80282a:	49 89 f5             	mov    %rsi,%r13
+  80282d:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802830:	48 85 f6             	test   %rsi,%rsi
+  802833:	0f 84 1a 01 00 00    	je     802953 <devfile_write+0x146>
+    while (n) {
+  802839:	48 85 d2             	test   %rdx,%rdx
+  80283c:	0f 84 fc 00 00 00    	je     80293e <devfile_write+0x131>
+    size_t i = 0;
+  802842:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802848:	eb 6c                	jmp    8028b6 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80284a:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802850:	4c 39 e3             	cmp    %r12,%rbx
+  802853:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802857:	4c 89 e2             	mov    %r12,%rdx
+  80285a:	4c 89 ee             	mov    %r13,%rsi
+  80285d:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802864:	00 00 00 
+  802867:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  80286e:	00 00 00 
+  802871:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802873:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802877:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80287e:	00 00 00 
+  802881:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802883:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802887:	be 00 00 00 00       	mov    $0x0,%esi
+  80288c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802891:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	0f 88 95 00 00 00    	js     80293a <devfile_write+0x12d>
+        buf += ret;
+  8028a5:	48 98                	cltq
+  8028a7:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8028aa:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8028ad:	48 29 c3             	sub    %rax,%rbx
+  8028b0:	0f 84 8b 00 00 00    	je     802941 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8028b6:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8028bd:	76 8b                	jbe    80284a <devfile_write+0x3d>
+  8028bf:	48 b8 ad 27 80 00 00 	movabs $0x8027ad,%rax
+  8028c6:	00 00 00 
+  8028c9:	ff d0                	call   *%rax
+  8028cb:	49 89 c4             	mov    %rax,%r12
+  8028ce:	48 85 c0             	test   %rax,%rax
+  8028d1:	0f 84 73 ff ff ff    	je     80284a <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8028d7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028dc:	48 39 c3             	cmp    %rax,%rbx
+  8028df:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8028e3:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8028ea:	00 
+  8028eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8028ef:	48 89 c2             	mov    %rax,%rdx
+  8028f2:	4c 89 ee             	mov    %r13,%rsi
+  8028f5:	48 b9 5d 10 80 00 00 	movabs $0x80105d,%rcx
+  8028fc:	00 00 00 
+  8028ff:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802901:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802905:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802909:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80290d:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802912:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802919:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80291d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802922:	48 b8 bd 26 80 00 00 	movabs $0x8026bd,%rax
+  802929:	00 00 00 
+  80292c:	ff d0                	call   *%rax
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	0f 89 6f ff ff ff    	jns    8028a5 <devfile_write+0x98>
+                return ret;
+  802936:	48 98                	cltq
+  802938:	eb 0a                	jmp    802944 <devfile_write+0x137>
+                return ret;
+  80293a:	48 98                	cltq
+  80293c:	eb 06                	jmp    802944 <devfile_write+0x137>
+    size_t i = 0;
+  80293e:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802941:	4c 89 f0             	mov    %r14,%rax
+}
+  802944:	48 83 c4 18          	add    $0x18,%rsp
+  802948:	5b                   	pop    %rbx
+  802949:	41 5c                	pop    %r12
+  80294b:	41 5d                	pop    %r13
+  80294d:	41 5e                	pop    %r14
+  80294f:	41 5f                	pop    %r15
+  802951:	5d                   	pop    %rbp
+  802952:	c3                   	ret
+        return -E_INVAL;
+  802953:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80295a:	eb e8                	jmp    802944 <devfile_write+0x137>
+  80295c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802963:	c3                   	ret
+
+0000000000802964 <devfile_read>:
+    if (!fd || !buf) {
+  802964:	48 85 ff             	test   %rdi,%rdi
+  802967:	0f 84 47 01 00 00    	je     802ab4 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80296d:	55                   	push   %rbp
+  80296e:	48 89 e5             	mov    %rsp,%rbp
+  802971:	41 57                	push   %r15
+  802973:	41 56                	push   %r14
+  802975:	41 55                	push   %r13
+  802977:	41 54                	push   %r12
+  802979:	53                   	push   %rbx
+  80297a:	48 83 ec 18          	sub    $0x18,%rsp
+  80297e:	49 89 ff             	mov    %rdi,%r15
+  802981:	49 89 f5             	mov    %rsi,%r13
+  802984:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802987:	48 85 f6             	test   %rsi,%rsi
+  80298a:	0f 84 1b 01 00 00    	je     802aab <devfile_read+0x147>
+    while (n) {
+  802990:	48 85 d2             	test   %rdx,%rdx
+  802993:	0f 84 fb 00 00 00    	je     802a94 <devfile_read+0x130>
+    size_t i = 0;
+  802999:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8029a0:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029a1:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8029a8:	00 00 00 
+  8029ab:	eb 5f                	jmp    802a0c <devfile_read+0xa8>
+                return ret ? ret : i;
+  8029ad:	48 98                	cltq
+  8029af:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8029b4:	e9 e3 00 00 00       	jmp    802a9c <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029b9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029bd:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8029c0:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8029c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029ce:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  8029d5:	00 00 00 
+  8029d8:	ff d0                	call   *%rax
+  8029da:	89 c3                	mov    %eax,%ebx
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	0f 8e a7 00 00 00    	jle    802a8b <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8029e4:	48 63 d0             	movslq %eax,%rdx
+  8029e7:	4c 89 f6             	mov    %r14,%rsi
+  8029ea:	4c 89 ef             	mov    %r13,%rdi
+  8029ed:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+        buf += ret;
+  8029f9:	48 63 db             	movslq %ebx,%rbx
+  8029fc:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8029ff:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802a03:	49 29 dc             	sub    %rbx,%r12
+  802a06:	0f 84 8c 00 00 00    	je     802a98 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a0c:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a13:	76 a4                	jbe    8029b9 <devfile_read+0x55>
+  802a15:	48 b8 ad 27 80 00 00 	movabs $0x8027ad,%rax
+  802a1c:	00 00 00 
+  802a1f:	ff d0                	call   *%rax
+  802a21:	48 89 c1             	mov    %rax,%rcx
+  802a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a28:	48 85 c0             	test   %rax,%rax
+  802a2b:	74 8c                	je     8029b9 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802a2d:	be 00 00 04 00       	mov    $0x40000,%esi
+  802a32:	49 39 f4             	cmp    %rsi,%r12
+  802a35:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802a39:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a3d:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802a3f:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802a43:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802a4a:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802a4e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a53:	48 b8 bd 26 80 00 00 	movabs $0x8026bd,%rax
+  802a5a:	00 00 00 
+  802a5d:	ff d0                	call   *%rax
+  802a5f:	89 c3                	mov    %eax,%ebx
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	0f 8e 44 ff ff ff    	jle    8029ad <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802a69:	48 63 d0             	movslq %eax,%rdx
+  802a6c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a70:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802a77:	4c 89 ef             	mov    %r13,%rdi
+  802a7a:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  802a81:	00 00 00 
+  802a84:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a86:	e9 6e ff ff ff       	jmp    8029f9 <devfile_read+0x95>
+                return ret ? ret : i;
+  802a8b:	48 98                	cltq
+  802a8d:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a92:	eb 08                	jmp    802a9c <devfile_read+0x138>
+    size_t i = 0;
+  802a94:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802a98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802a9c:	48 83 c4 18          	add    $0x18,%rsp
+  802aa0:	5b                   	pop    %rbx
+  802aa1:	41 5c                	pop    %r12
+  802aa3:	41 5d                	pop    %r13
+  802aa5:	41 5e                	pop    %r14
+  802aa7:	41 5f                	pop    %r15
+  802aa9:	5d                   	pop    %rbp
+  802aaa:	c3                   	ret
+        return -E_INVAL;
+  802aab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ab2:	eb e8                	jmp    802a9c <devfile_read+0x138>
+  802ab4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802abb:	c3                   	ret
+
+0000000000802abc <open>:
+open(const char *path, int mode) {
+  802abc:	55                   	push   %rbp
+  802abd:	48 89 e5             	mov    %rsp,%rbp
+  802ac0:	41 55                	push   %r13
+  802ac2:	41 54                	push   %r12
+  802ac4:	53                   	push   %rbx
+  802ac5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ac9:	49 89 fc             	mov    %rdi,%r12
+  802acc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802acf:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  802adb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ae1:	0f 87 8a 00 00 00    	ja     802b71 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ae7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802aeb:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  802af2:	00 00 00 
+  802af5:	ff d0                	call   *%rax
+  802af7:	89 c3                	mov    %eax,%ebx
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 50                	js     802b4d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802afd:	4c 89 e6             	mov    %r12,%rsi
+  802b00:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802b07:	00 00 00 
+  802b0a:	48 89 df             	mov    %rbx,%rdi
+  802b0d:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b19:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b20:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b24:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b29:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  802b30:	00 00 00 
+  802b33:	ff d0                	call   *%rax
+  802b35:	89 c3                	mov    %eax,%ebx
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	78 1f                	js     802b5a <open+0x9e>
+    return fd2num(fd);
+  802b3b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b3f:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+  802b4b:	89 c3                	mov    %eax,%ebx
+}
+  802b4d:	89 d8                	mov    %ebx,%eax
+  802b4f:	48 83 c4 18          	add    $0x18,%rsp
+  802b53:	5b                   	pop    %rbx
+  802b54:	41 5c                	pop    %r12
+  802b56:	41 5d                	pop    %r13
+  802b58:	5d                   	pop    %rbp
+  802b59:	c3                   	ret
+        fd_close(fd, 0);
+  802b5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b5f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b63:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  802b6a:	00 00 00 
+  802b6d:	ff d0                	call   *%rax
+        return res;
+  802b6f:	eb dc                	jmp    802b4d <open+0x91>
+        return -E_BAD_PATH;
+  802b71:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b76:	eb d5                	jmp    802b4d <open+0x91>
+
+0000000000802b78 <sync>:
+sync(void) {
+  802b78:	55                   	push   %rbp
+  802b79:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802b7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b81:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b86:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+}
+  802b92:	5d                   	pop    %rbp
+  802b93:	c3                   	ret
+
+0000000000802b94 <drop_cache>:
+drop_cache(int fdnum) {
+  802b94:	55                   	push   %rbp
+  802b95:	48 89 e5             	mov    %rsp,%rbp
+  802b98:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b9c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ba0:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802ba7:	00 00 00 
+  802baa:	ff d0                	call   *%rax
+  802bac:	85 c0                	test   %eax,%eax
+  802bae:	78 51                	js     802c01 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802bbb:	00 00 00 
+  802bbe:	8b 0a                	mov    (%rdx),%ecx
+  802bc0:	39 08                	cmp    %ecx,(%rax)
+  802bc2:	75 3f                	jne    802c03 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802bc4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802bcb:	00 
+  802bcc:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802bd3:	00 
+  802bd4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802bdb:	00 
+  802bdc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802be3:	00 
+  802be4:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802be8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802bec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802bf0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802bf5:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+}
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c08:	eb f7                	jmp    802c01 <drop_cache+0x6d>
+
+0000000000802c0a <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802c0a:	55                   	push   %rbp
+  802c0b:	48 89 e5             	mov    %rsp,%rbp
+  802c0e:	41 57                	push   %r15
+  802c10:	41 56                	push   %r14
+  802c12:	41 55                	push   %r13
+  802c14:	41 54                	push   %r12
+  802c16:	53                   	push   %rbx
+  802c17:	48 83 ec 58          	sub    $0x58,%rsp
+  802c1b:	41 89 f4             	mov    %esi,%r12d
+  802c1e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c22:	49 89 cd             	mov    %rcx,%r13
+  802c25:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c28:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c2c:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+  802c38:	48 63 d0             	movslq %eax,%rdx
+  802c3b:	85 c0                	test   %eax,%eax
+  802c3d:	0f 88 36 01 00 00    	js     802d79 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c43:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c47:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c4e:	00 00 00 
+  802c51:	8b 32                	mov    (%rdx),%esi
+  802c53:	39 31                	cmp    %esi,(%rcx)
+  802c55:	0f 85 30 01 00 00    	jne    802d8b <read_map+0x181>
+  802c5b:	45 85 e4             	test   %r12d,%r12d
+  802c5e:	0f 88 27 01 00 00    	js     802d8b <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c64:	49 63 cc             	movslq %r12d,%rcx
+  802c67:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c6b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c72:	0f 85 1c 01 00 00    	jne    802d94 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c78:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802c7c:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802c83:	0f 85 14 01 00 00    	jne    802d9d <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802c89:	48 63 cb             	movslq %ebx,%rcx
+  802c8c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c90:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802c97:	00 00 00 
+    while (i < n) {
+  802c9a:	4d 85 ed             	test   %r13,%r13
+  802c9d:	75 5c                	jne    802cfb <read_map+0xf1>
+  802c9f:	e9 d2 00 00 00       	jmp    802d76 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802ca4:	41 8b 3e             	mov    (%r14),%edi
+  802ca7:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802cab:	50                   	push   %rax
+  802cac:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802cb0:	50                   	push   %rax
+  802cb1:	4d 89 f9             	mov    %r15,%r9
+  802cb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cba:	48 89 d9             	mov    %rbx,%rcx
+  802cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc2:	be 09 00 00 00       	mov    $0x9,%esi
+  802cc7:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802cd3:	48 83 c4 10          	add    $0x10,%rsp
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	0f 8e 8f 00 00 00    	jle    802d6e <read_map+0x164>
+        if (!mapped_perm) {
+  802cdf:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802ce3:	0f 84 80 00 00 00    	je     802d69 <read_map+0x15f>
+        i += res;
+  802ce9:	48 63 d0             	movslq %eax,%rdx
+  802cec:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802cef:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802cf4:	75 78                	jne    802d6e <read_map+0x164>
+    while (i < n) {
+  802cf6:	4d 39 ec             	cmp    %r13,%r12
+  802cf9:	73 73                	jae    802d6e <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802cfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cff:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802d03:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802d07:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802d0b:	4c 01 e0             	add    %r12,%rax
+  802d0e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d12:	4c 89 eb             	mov    %r13,%rbx
+  802d15:	4c 29 e3             	sub    %r12,%rbx
+  802d18:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d1c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d24:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802d2b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802d32:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802d37:	48 39 c3             	cmp    %rax,%rbx
+  802d3a:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802d3e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802d42:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d46:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802d4a:	0f 85 54 ff ff ff    	jne    802ca4 <read_map+0x9a>
+  802d50:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d55:	48 b8 8a 4d 80 00 00 	movabs $0x804d8a,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+  802d61:	41 89 06             	mov    %eax,(%r14)
+  802d64:	e9 3b ff ff ff       	jmp    802ca4 <read_map+0x9a>
+            res = -E_INVAL;
+  802d69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802d6e:	4c 89 e2             	mov    %r12,%rdx
+  802d71:	4d 85 e4             	test   %r12,%r12
+  802d74:	75 03                	jne    802d79 <read_map+0x16f>
+  802d76:	48 63 d0             	movslq %eax,%rdx
+}
+  802d79:	48 89 d0             	mov    %rdx,%rax
+  802d7c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d80:	5b                   	pop    %rbx
+  802d81:	41 5c                	pop    %r12
+  802d83:	41 5d                	pop    %r13
+  802d85:	41 5e                	pop    %r14
+  802d87:	41 5f                	pop    %r15
+  802d89:	5d                   	pop    %rbp
+  802d8a:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d8b:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d92:	eb e5                	jmp    802d79 <read_map+0x16f>
+  802d94:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d9b:	eb dc                	jmp    802d79 <read_map+0x16f>
+  802d9d:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802da4:	eb d3                	jmp    802d79 <read_map+0x16f>
+
+0000000000802da6 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802da6:	55                   	push   %rbp
+  802da7:	48 89 e5             	mov    %rsp,%rbp
+  802daa:	41 57                	push   %r15
+  802dac:	41 56                	push   %r14
+  802dae:	41 55                	push   %r13
+  802db0:	41 54                	push   %r12
+  802db2:	53                   	push   %rbx
+  802db3:	48 83 ec 38          	sub    $0x38,%rsp
+  802db7:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802dba:	41 89 f6             	mov    %esi,%r14d
+  802dbd:	49 89 d5             	mov    %rdx,%r13
+  802dc0:	89 cb                	mov    %ecx,%ebx
+  802dc2:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802dc5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802dc9:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+  802dd5:	85 c0                	test   %eax,%eax
+  802dd7:	0f 88 33 02 00 00    	js     803010 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802de2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802de6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ded:	00 00 00 
+  802df0:	8b 3a                	mov    (%rdx),%edi
+  802df2:	39 39                	cmp    %edi,(%rcx)
+  802df4:	0f 85 1b 02 00 00    	jne    803015 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802dfa:	4d 85 ed             	test   %r13,%r13
+  802dfd:	41 0f 94 c0          	sete   %r8b
+  802e01:	44 89 f0             	mov    %r14d,%eax
+  802e04:	c1 e8 1f             	shr    $0x1f,%eax
+  802e07:	41 08 c0             	or     %al,%r8b
+  802e0a:	0f 85 14 02 00 00    	jne    803024 <mmap+0x27e>
+  802e10:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e17:	0f 85 0e 02 00 00    	jne    80302b <mmap+0x285>
+  802e1d:	83 fb 07             	cmp    $0x7,%ebx
+  802e20:	0f 87 0c 02 00 00    	ja     803032 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e26:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802e30:	83 fa 01             	cmp    $0x1,%edx
+  802e33:	0f 87 dc 01 00 00    	ja     803015 <mmap+0x26f>
+  802e39:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802e40:	00 00 00 
+  802e43:	eb 0e                	jmp    802e53 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e45:	48 83 c0 01          	add    $0x1,%rax
+  802e49:	48 83 c2 20          	add    $0x20,%rdx
+  802e4d:	48 83 f8 40          	cmp    $0x40,%rax
+  802e51:	74 44                	je     802e97 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802e53:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802e57:	75 ec                	jne    802e45 <mmap+0x9f>
+  802e59:	48 c1 e0 05          	shl    $0x5,%rax
+  802e5d:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802e64:	00 00 00 
+  802e67:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802e6b:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802e72:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e79:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802e7c:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802e83:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e86:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802e8b:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802e92:	00 00 00 
+  802e95:	eb 17                	jmp    802eae <mmap+0x108>
+  802e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e9c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802ea2:	eb c7                	jmp    802e6b <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ea4:	48 83 c0 01          	add    $0x1,%rax
+  802ea8:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802eac:	77 37                	ja     802ee5 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802eae:	48 89 c2             	mov    %rax,%rdx
+  802eb1:	48 c1 e2 05          	shl    $0x5,%rdx
+  802eb5:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802eba:	48 85 d2             	test   %rdx,%rdx
+  802ebd:	74 e5                	je     802ea4 <mmap+0xfe>
+  802ebf:	48 89 c7             	mov    %rax,%rdi
+  802ec2:	48 c1 e7 05          	shl    $0x5,%rdi
+  802ec6:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802eca:	48 01 fa             	add    %rdi,%rdx
+  802ecd:	48 39 d6             	cmp    %rdx,%rsi
+  802ed0:	73 d2                	jae    802ea4 <mmap+0xfe>
+  802ed2:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802ed6:	4c 39 d7             	cmp    %r10,%rdi
+  802ed9:	73 c9                	jae    802ea4 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802edb:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee3:	eb c9                	jmp    802eae <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802ee5:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802eee:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802ef5:	00 00 00 
+  802ef8:	49 39 f9             	cmp    %rdi,%r9
+  802efb:	0f 82 14 01 00 00    	jb     803015 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802f01:	48 85 f6             	test   %rsi,%rsi
+  802f04:	0f 84 2f 01 00 00    	je     803039 <mmap+0x293>
+  802f0a:	45 84 c0             	test   %r8b,%r8b
+  802f0d:	0f 85 26 01 00 00    	jne    803039 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f13:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f17:	0f 94 c0             	sete   %al
+  802f1a:	0f b6 c0             	movzbl %al,%eax
+  802f1d:	c1 e0 06             	shl    $0x6,%eax
+  802f20:	09 d8                	or     %ebx,%eax
+  802f22:	89 c3                	mov    %eax,%ebx
+  802f24:	83 cb 04             	or     $0x4,%ebx
+  802f27:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802f2a:	4d 85 ff             	test   %r15,%r15
+  802f2d:	0f 84 bd 00 00 00    	je     802ff0 <mmap+0x24a>
+  802f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f38:	83 e0 bf             	and    $0xffffffbf,%eax
+  802f3b:	83 c8 04             	or     $0x4,%eax
+  802f3e:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802f41:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802f45:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802f49:	49 89 f6             	mov    %rsi,%r14
+  802f4c:	eb 43                	jmp    802f91 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802f4e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802f54:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f5a:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802f5d:	eb 2d                	jmp    802f8c <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802f5f:	48 85 c0             	test   %rax,%rax
+  802f62:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f67:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f6b:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802f6e:	4c 89 e2             	mov    %r12,%rdx
+  802f71:	4c 89 ee             	mov    %r13,%rsi
+  802f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f79:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 3e                	js     802fc7 <mmap+0x221>
+        i += n;
+  802f89:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802f8c:	4c 39 fb             	cmp    %r15,%rbx
+  802f8f:	73 54                	jae    802fe5 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802f91:	4d 89 fc             	mov    %r15,%r12
+  802f94:	49 29 dc             	sub    %rbx,%r12
+  802f97:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802f9b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802f9e:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802fa1:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802fa5:	4c 89 e1             	mov    %r12,%rcx
+  802fa8:	4c 89 ea             	mov    %r13,%rdx
+  802fab:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802fae:	48 b8 0a 2c 80 00 00 	movabs $0x802c0a,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+        if (res > 0) {
+  802fba:	48 85 c0             	test   %rax,%rax
+  802fbd:	7f 8f                	jg     802f4e <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802fbf:	74 9e                	je     802f5f <mmap+0x1b9>
+  802fc1:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802fc5:	74 98                	je     802f5f <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802fc7:	4c 89 f6             	mov    %r14,%rsi
+  802fca:	4c 89 fa             	mov    %r15,%rdx
+  802fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd2:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  802fd9:	00 00 00 
+  802fdc:	ff d0                	call   *%rax
+    return NULL;
+  802fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe3:	eb 30                	jmp    803015 <mmap+0x26f>
+  802fe5:	4c 89 f6             	mov    %r14,%rsi
+  802fe8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802fec:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802ff0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ff4:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ff7:	48 89 31             	mov    %rsi,(%rcx)
+  802ffa:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802ffe:	89 41 10             	mov    %eax,0x10(%rcx)
+  803001:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803005:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803008:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  80300b:	48 89 f0             	mov    %rsi,%rax
+  80300e:	eb 05                	jmp    803015 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803010:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803015:	48 83 c4 38          	add    $0x38,%rsp
+  803019:	5b                   	pop    %rbx
+  80301a:	41 5c                	pop    %r12
+  80301c:	41 5d                	pop    %r13
+  80301e:	41 5e                	pop    %r14
+  803020:	41 5f                	pop    %r15
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803024:	b8 00 00 00 00       	mov    $0x0,%eax
+  803029:	eb ea                	jmp    803015 <mmap+0x26f>
+  80302b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803030:	eb e3                	jmp    803015 <mmap+0x26f>
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+  803037:	eb dc                	jmp    803015 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303e:	eb d5                	jmp    803015 <mmap+0x26f>
+
+0000000000803040 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803040:	55                   	push   %rbp
+  803041:	48 89 e5             	mov    %rsp,%rbp
+  803044:	41 57                	push   %r15
+  803046:	41 56                	push   %r14
+  803048:	41 55                	push   %r13
+  80304a:	41 54                	push   %r12
+  80304c:	53                   	push   %rbx
+  80304d:	48 83 ec 38          	sub    $0x38,%rsp
+  803051:	49 89 fc             	mov    %rdi,%r12
+  803054:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803057:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  80305e:	00 00 00 
+  803061:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803063:	48 85 c0             	test   %rax,%rax
+  803066:	0f 84 2f 01 00 00    	je     80319b <msync+0x15b>
+  80306c:	49 89 c7             	mov    %rax,%r15
+  80306f:	4d 01 e5             	add    %r12,%r13
+  803072:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803076:	49 03 07             	add    (%r15),%rax
+  803079:	4c 39 e8             	cmp    %r13,%rax
+  80307c:	0f 82 20 01 00 00    	jb     8031a2 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803082:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803086:	83 e0 40             	and    $0x40,%eax
+  803089:	0f 84 fd 00 00 00    	je     80318c <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80308f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803096:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80309d:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8030a4:	4d 39 ec             	cmp    %r13,%r12
+  8030a7:	0f 83 fc 00 00 00    	jae    8031a9 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8030ad:	49 be 05 45 80 00 00 	movabs $0x804505,%r14
+  8030b4:	00 00 00 
+  8030b7:	e9 b0 00 00 00       	jmp    80316c <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8030bc:	4c 89 e3             	mov    %r12,%rbx
+  8030bf:	4d 39 ec             	cmp    %r13,%r12
+  8030c2:	73 16                	jae    8030da <msync+0x9a>
+  8030c4:	48 89 df             	mov    %rbx,%rdi
+  8030c7:	41 ff d6             	call   *%r14
+  8030ca:	84 c0                	test   %al,%al
+  8030cc:	74 0c                	je     8030da <msync+0x9a>
+  8030ce:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8030d5:	4c 39 eb             	cmp    %r13,%rbx
+  8030d8:	72 ea                	jb     8030c4 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8030da:	48 89 d8             	mov    %rbx,%rax
+  8030dd:	4c 29 e0             	sub    %r12,%rax
+  8030e0:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8030e4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8030e8:	49 89 c0             	mov    %rax,%r8
+  8030eb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8030ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f4:	48 89 ce             	mov    %rcx,%rsi
+  8030f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fc:	49 ba 13 14 80 00 00 	movabs $0x801413,%r10
+  803103:	00 00 00 
+  803106:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803109:	85 c0                	test   %eax,%eax
+  80310b:	78 7f                	js     80318c <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  80310d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803114:	00 
+  803115:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80311c:	00 
+  80311d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803124:	00 
+  803125:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80312c:	00 
+  80312d:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803131:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803135:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803139:	49 2b 07             	sub    (%r15),%rax
+  80313c:	4c 01 e0             	add    %r12,%rax
+  80313f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803143:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803147:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80314b:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80314f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803154:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+  803160:	85 c0                	test   %eax,%eax
+  803162:	78 28                	js     80318c <msync+0x14c>
+  803164:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803167:	4d 39 ec             	cmp    %r13,%r12
+  80316a:	73 1b                	jae    803187 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80316c:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803170:	4c 89 e7             	mov    %r12,%rdi
+  803173:	41 ff d6             	call   *%r14
+  803176:	84 c0                	test   %al,%al
+  803178:	0f 85 3e ff ff ff    	jne    8030bc <msync+0x7c>
+            va += PAGE_SIZE;
+  80317e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803185:	eb e0                	jmp    803167 <msync+0x127>
+    }
+
+    return 0;
+  803187:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80318c:	48 83 c4 38          	add    $0x38,%rsp
+  803190:	5b                   	pop    %rbx
+  803191:	41 5c                	pop    %r12
+  803193:	41 5d                	pop    %r13
+  803195:	41 5e                	pop    %r14
+  803197:	41 5f                	pop    %r15
+  803199:	5d                   	pop    %rbp
+  80319a:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80319b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a0:	eb ea                	jmp    80318c <msync+0x14c>
+  8031a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a7:	eb e3                	jmp    80318c <msync+0x14c>
+    return 0;
+  8031a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ae:	eb dc                	jmp    80318c <msync+0x14c>
+
+00000000008031b0 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8031b0:	55                   	push   %rbp
+  8031b1:	48 89 e5             	mov    %rsp,%rbp
+  8031b4:	41 55                	push   %r13
+  8031b6:	41 54                	push   %r12
+  8031b8:	53                   	push   %rbx
+  8031b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031bd:	49 89 fc             	mov    %rdi,%r12
+  8031c0:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8031c3:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8031ca:	00 00 00 
+  8031cd:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8031cf:	48 85 c0             	test   %rax,%rax
+  8031d2:	74 58                	je     80322c <munmap+0x7c>
+  8031d4:	48 89 c3             	mov    %rax,%rbx
+  8031d7:	4c 3b 20             	cmp    (%rax),%r12
+  8031da:	75 57                	jne    803233 <munmap+0x83>
+  8031dc:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8031e3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031e9:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8031ed:	75 4b                	jne    80323a <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8031ef:	4c 89 ee             	mov    %r13,%rsi
+  8031f2:	4c 89 e7             	mov    %r12,%rdi
+  8031f5:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  803201:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803205:	4c 89 e6             	mov    %r12,%rsi
+  803208:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320d:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803219:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803220:	00 
+    return res;
+}
+  803221:	48 83 c4 08          	add    $0x8,%rsp
+  803225:	5b                   	pop    %rbx
+  803226:	41 5c                	pop    %r12
+  803228:	41 5d                	pop    %r13
+  80322a:	5d                   	pop    %rbp
+  80322b:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80322c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803231:	eb ee                	jmp    803221 <munmap+0x71>
+  803233:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803238:	eb e7                	jmp    803221 <munmap+0x71>
+  80323a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80323f:	eb e0                	jmp    803221 <munmap+0x71>
+
+0000000000803241 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803241:	55                   	push   %rbp
+  803242:	48 89 e5             	mov    %rsp,%rbp
+  803245:	41 55                	push   %r13
+  803247:	41 54                	push   %r12
+  803249:	53                   	push   %rbx
+  80324a:	48 83 ec 08          	sub    $0x8,%rsp
+  80324e:	48 89 fb             	mov    %rdi,%rbx
+  803251:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803254:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803257:	48 b8 bf 44 80 00 00 	movabs $0x8044bf,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+  803263:	41 89 c1             	mov    %eax,%r9d
+  803266:	4d 89 e0             	mov    %r12,%r8
+  803269:	49 29 d8             	sub    %rbx,%r8
+  80326c:	48 89 d9             	mov    %rbx,%rcx
+  80326f:	44 89 ea             	mov    %r13d,%edx
+  803272:	48 89 de             	mov    %rbx,%rsi
+  803275:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327a:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+}
+  803286:	48 83 c4 08          	add    $0x8,%rsp
+  80328a:	5b                   	pop    %rbx
+  80328b:	41 5c                	pop    %r12
+  80328d:	41 5d                	pop    %r13
+  80328f:	5d                   	pop    %rbp
+  803290:	c3                   	ret
+
+0000000000803291 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803291:	55                   	push   %rbp
+  803292:	48 89 e5             	mov    %rsp,%rbp
+  803295:	41 57                	push   %r15
+  803297:	41 56                	push   %r14
+  803299:	41 55                	push   %r13
+  80329b:	41 54                	push   %r12
+  80329d:	53                   	push   %rbx
+  80329e:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8032a5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  8032a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032ad:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+  8032b9:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  8032bf:	85 c0                	test   %eax,%eax
+  8032c1:	0f 88 1a 07 00 00    	js     8039e1 <spawn+0x750>
+  8032c7:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8032c9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8032ce:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8032d5:	48 b8 34 22 80 00 00 	movabs $0x802234,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8032e3:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8032e8:	0f 85 78 02 00 00    	jne    803566 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8032ee:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8032f5:	ff ff 00 
+  8032f8:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8032ff:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803306:	01 01 00 
+  803309:	48 39 d0             	cmp    %rdx,%rax
+  80330c:	0f 85 90 02 00 00    	jne    8035a2 <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803312:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803319:	00 3e 00 
+  80331c:	0f 85 80 02 00 00    	jne    8035a2 <spawn+0x311>
+    asm volatile("int %2"
+  803322:	b8 09 00 00 00       	mov    $0x9,%eax
+  803327:	cd 30                	int    $0x30
+  803329:	41 89 c6             	mov    %eax,%r14d
+  80332c:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80332e:	85 c0                	test   %eax,%eax
+  803330:	0f 88 93 06 00 00    	js     8039c9 <spawn+0x738>
+    envid_t child = res;
+  803336:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80333c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803341:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803348:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80334f:	00 00 00 
+  803352:	48 01 c6             	add    %rax,%rsi
+  803355:	48 8b 06             	mov    (%rsi),%rax
+  803358:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80335f:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803366:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80336d:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803374:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  80337b:	48 29 ce             	sub    %rcx,%rsi
+  80337e:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803384:	c1 e9 03             	shr    $0x3,%ecx
+  803387:	89 c9                	mov    %ecx,%ecx
+  803389:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  80338c:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803393:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  80339a:	49 8b 3c 24          	mov    (%r12),%rdi
+  80339e:	48 85 ff             	test   %rdi,%rdi
+  8033a1:	0f 84 5b 06 00 00    	je     803a02 <spawn+0x771>
+  8033a7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8033ad:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8033b3:	48 bb be 0d 80 00 00 	movabs $0x800dbe,%rbx
+  8033ba:	00 00 00 
+  8033bd:	ff d3                	call   *%rbx
+  8033bf:	4c 01 f8             	add    %r15,%rax
+  8033c2:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8033c6:	4c 89 ea             	mov    %r13,%rdx
+  8033c9:	49 83 c5 01          	add    $0x1,%r13
+  8033cd:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8033d2:	48 85 ff             	test   %rdi,%rdi
+  8033d5:	75 e6                	jne    8033bd <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8033d7:	49 89 d5             	mov    %rdx,%r13
+  8033da:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8033e1:	48 f7 d0             	not    %rax
+  8033e4:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8033eb:	49 89 df             	mov    %rbx,%r15
+  8033ee:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8033f2:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  8033f9:	89 d0                	mov    %edx,%eax
+  8033fb:	83 c0 01             	add    $0x1,%eax
+  8033fe:	48 98                	cltq
+  803400:	48 c1 e0 03          	shl    $0x3,%rax
+  803404:	49 29 c7             	sub    %rax,%r15
+  803407:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80340e:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803412:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803418:	0f 86 db 05 00 00    	jbe    8039f9 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80341e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803423:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803428:	be 00 00 40 00       	mov    $0x400000,%esi
+  80342d:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  803434:	00 00 00 
+  803437:	ff d0                	call   *%rax
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	0f 88 bd 05 00 00    	js     8039fe <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  803441:	4c 89 e8             	mov    %r13,%rax
+  803444:	45 85 ed             	test   %r13d,%r13d
+  803447:	7e 54                	jle    80349d <spawn+0x20c>
+  803449:	4d 89 fd             	mov    %r15,%r13
+  80344c:	48 98                	cltq
+  80344e:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803452:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803459:	00 00 00 
+  80345c:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803463:	ff 
+  803464:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803468:	49 8b 34 24          	mov    (%r12),%rsi
+  80346c:	48 89 df             	mov    %rbx,%rdi
+  80346f:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80347b:	49 8b 3c 24          	mov    (%r12),%rdi
+  80347f:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  803486:	00 00 00 
+  803489:	ff d0                	call   *%rax
+  80348b:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803490:	49 83 c5 08          	add    $0x8,%r13
+  803494:	49 83 c4 08          	add    $0x8,%r12
+  803498:	4d 39 fd             	cmp    %r15,%r13
+  80349b:	75 b5                	jne    803452 <spawn+0x1c1>
+    argv_store[argc] = 0;
+  80349d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8034a4:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8034ab:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8034ac:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8034b3:	0f 85 30 01 00 00    	jne    8035e9 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8034b9:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8034c0:	00 00 00 
+  8034c3:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  8034ca:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8034d1:	ff 
+  8034d2:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8034d6:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8034dd:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8034e1:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8034e8:	00 00 00 
+  8034eb:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8034f2:	ff 
+  8034f3:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8034fa:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803500:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803506:	44 89 f2             	mov    %r14d,%edx
+  803509:	be 00 00 40 00       	mov    $0x400000,%esi
+  80350e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803513:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  80351a:	00 00 00 
+  80351d:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80351f:	48 bb e0 14 80 00 00 	movabs $0x8014e0,%rbx
+  803526:	00 00 00 
+  803529:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80352e:	be 00 00 40 00       	mov    $0x400000,%esi
+  803533:	bf 00 00 00 00       	mov    $0x0,%edi
+  803538:	ff d3                	call   *%rbx
+  80353a:	85 c0                	test   %eax,%eax
+  80353c:	78 eb                	js     803529 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80353e:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803545:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  80354c:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80354d:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803554:	00 
+  803555:	0f 84 53 03 00 00    	je     8038ae <spawn+0x61d>
+  80355b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803561:	e9 ae 01 00 00       	jmp    803714 <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803566:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  80356d:	00 00 00 
+  803570:	b8 00 00 00 00       	mov    $0x0,%eax
+  803575:	48 ba d7 04 80 00 00 	movabs $0x8004d7,%rdx
+  80357c:	00 00 00 
+  80357f:	ff d2                	call   *%rdx
+        close(fd);
+  803581:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803587:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  80358e:	00 00 00 
+  803591:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803593:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  80359a:	ff ff ff 
+  80359d:	e9 3f 04 00 00       	jmp    8039e1 <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8035a2:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8035a7:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8035ad:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  8035b4:	00 00 00 
+  8035b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bc:	48 b9 d7 04 80 00 00 	movabs $0x8004d7,%rcx
+  8035c3:	00 00 00 
+  8035c6:	ff d1                	call   *%rcx
+        close(fd);
+  8035c8:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8035ce:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  8035d5:	00 00 00 
+  8035d8:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8035da:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  8035e1:	ff ff ff 
+  8035e4:	e9 f8 03 00 00       	jmp    8039e1 <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8035e9:	48 b9 70 57 80 00 00 	movabs $0x805770,%rcx
+  8035f0:	00 00 00 
+  8035f3:	48 ba ba 57 80 00 00 	movabs $0x8057ba,%rdx
+  8035fa:	00 00 00 
+  8035fd:	be ef 00 00 00       	mov    $0xef,%esi
+  803602:	48 bf cf 57 80 00 00 	movabs $0x8057cf,%rdi
+  803609:	00 00 00 
+  80360c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803611:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  803618:	00 00 00 
+  80361b:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  80361e:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  803625:	00 
+  803626:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80362d:	89 d9                	mov    %ebx,%ecx
+  80362f:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  803635:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+  803641:	85 c0                	test   %eax,%eax
+  803643:	0f 89 4a 01 00 00    	jns    803793 <spawn+0x502>
+  803649:	89 c3                	mov    %eax,%ebx
+  80364b:	e9 67 03 00 00       	jmp    8039b7 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  803650:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803656:	4c 89 f1             	mov    %r14,%rcx
+  803659:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80365e:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  803664:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  80366a:	48 b8 0a 2c 80 00 00 	movabs $0x802c0a,%rax
+  803671:	00 00 00 
+  803674:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  803676:	48 85 c0             	test   %rax,%rax
+  803679:	0f 8e 24 01 00 00    	jle    8037a3 <spawn+0x512>
+  80367f:	4c 39 f0             	cmp    %r14,%rax
+  803682:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  803686:	4c 39 f0             	cmp    %r14,%rax
+  803689:	0f 82 19 01 00 00    	jb     8037a8 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  80368f:	4c 89 f0             	mov    %r14,%rax
+  803692:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803697:	0f 85 dd 01 00 00    	jne    80387a <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  80369d:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  8036a4:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  8036ab:	80 cb 80             	or     $0x80,%bl
+  8036ae:	41 89 d9             	mov    %ebx,%r9d
+  8036b1:	4d 89 f0             	mov    %r14,%r8
+  8036b4:	4c 89 e9             	mov    %r13,%rcx
+  8036b7:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8036bd:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c7:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  8036ce:	00 00 00 
+  8036d1:	ff d0                	call   *%rax
+  8036d3:	85 c0                	test   %eax,%eax
+  8036d5:	0f 88 da 02 00 00    	js     8039b5 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  8036db:	4c 89 f2             	mov    %r14,%rdx
+  8036de:	be 00 00 40 00       	mov    $0x400000,%esi
+  8036e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e8:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8036ef:	00 00 00 
+  8036f2:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8036f4:	85 c0                	test   %eax,%eax
+  8036f6:	0f 88 a3 01 00 00    	js     80389f <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8036fc:	49 83 c7 01          	add    $0x1,%r15
+  803700:	49 83 c4 38          	add    $0x38,%r12
+  803704:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80370b:	49 39 c7             	cmp    %rax,%r15
+  80370e:	0f 83 9a 01 00 00    	jae    8038ae <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803714:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  803719:	75 e1                	jne    8036fc <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80371b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803720:	89 c3                	mov    %eax,%ebx
+  803722:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803725:	89 da                	mov    %ebx,%edx
+  803727:	83 ca 04             	or     $0x4,%edx
+  80372a:	a8 04                	test   $0x4,%al
+  80372c:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80372f:	89 da                	mov    %ebx,%edx
+  803731:	83 ca 01             	or     $0x1,%edx
+  803734:	a8 01                	test   $0x1,%al
+  803736:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803739:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  80373e:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  803744:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  803749:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  80374e:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  803753:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803759:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  80375f:	44 89 e9             	mov    %r13d,%ecx
+  803762:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803768:	74 14                	je     80377e <spawn+0x4ed>
+        va -= res;
+  80376a:	48 63 f1             	movslq %ecx,%rsi
+  80376d:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  803770:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  803773:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  803776:	29 c8                	sub    %ecx,%eax
+  803778:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  80377e:	4d 85 f6             	test   %r14,%r14
+  803781:	b8 01 00 00 00       	mov    $0x1,%eax
+  803786:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  80378a:	49 39 d6             	cmp    %rdx,%r14
+  80378d:	0f 82 8b fe ff ff    	jb     80361e <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  803793:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  80379a:	0f 00 00 
+  80379d:	0f 84 ad fe ff ff    	je     803650 <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8037a3:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  8037a8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8037ae:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  8037b5:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8037bc:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  8037c3:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  8037ca:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8037d1:	48 29 c2             	sub    %rax,%rdx
+  8037d4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8037d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037de:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	85 c0                	test   %eax,%eax
+  8037ec:	78 5d                	js     80384b <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  8037ee:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  8037f4:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  8037fa:	01 ce                	add    %ecx,%esi
+  8037fc:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803802:	48 b9 61 23 80 00 00 	movabs $0x802361,%rcx
+  803809:	00 00 00 
+  80380c:	ff d1                	call   *%rcx
+  80380e:	85 c0                	test   %eax,%eax
+  803810:	0f 88 9b 01 00 00    	js     8039b1 <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  803816:	4c 89 f2             	mov    %r14,%rdx
+  803819:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803820:	48 29 c2             	sub    %rax,%rdx
+  803823:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  80382a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803830:	48 b8 34 22 80 00 00 	movabs $0x802234,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+  80383c:	85 c0                	test   %eax,%eax
+  80383e:	0f 89 59 fe ff ff    	jns    80369d <spawn+0x40c>
+  803844:	89 c3                	mov    %eax,%ebx
+  803846:	e9 6c 01 00 00       	jmp    8039b7 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  80384b:	89 c3                	mov    %eax,%ebx
+  80384d:	4c 89 f6             	mov    %r14,%rsi
+  803850:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803857:	48 29 c6             	sub    %rax,%rsi
+  80385a:	48 bf db 57 80 00 00 	movabs $0x8057db,%rdi
+  803861:	00 00 00 
+  803864:	b8 00 00 00 00       	mov    $0x0,%eax
+  803869:	48 ba d7 04 80 00 00 	movabs $0x8004d7,%rdx
+  803870:	00 00 00 
+  803873:	ff d2                	call   *%rdx
+            return res;
+  803875:	e9 3d 01 00 00       	jmp    8039b7 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  80387a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80387f:	48 29 c2             	sub    %rax,%rdx
+  803882:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  803889:	be 00 00 00 00       	mov    $0x0,%esi
+  80388e:	48 b8 48 0f 80 00 00 	movabs $0x800f48,%rax
+  803895:	00 00 00 
+  803898:	ff d0                	call   *%rax
+  80389a:	e9 fe fd ff ff       	jmp    80369d <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  80389f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a4:	0f 4e d0             	cmovle %eax,%edx
+  8038a7:	89 d3                	mov    %edx,%ebx
+  8038a9:	e9 09 01 00 00       	jmp    8039b7 <spawn+0x726>
+    close(fd);
+  8038ae:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8038b4:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8038c0:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8038c7:	48 bf 41 32 80 00 00 	movabs $0x803241,%rdi
+  8038ce:	00 00 00 
+  8038d1:	48 b8 40 46 80 00 00 	movabs $0x804640,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+  8038dd:	85 c0                	test   %eax,%eax
+  8038df:	78 49                	js     80392a <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8038e1:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8038e8:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8038ee:	48 b8 af 16 80 00 00 	movabs $0x8016af,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	85 c0                	test   %eax,%eax
+  8038fc:	78 59                	js     803957 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8038fe:	be 02 00 00 00       	mov    $0x2,%esi
+  803903:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803909:	48 b8 df 15 80 00 00 	movabs $0x8015df,%rax
+  803910:	00 00 00 
+  803913:	ff d0                	call   *%rax
+  803915:	85 c0                	test   %eax,%eax
+  803917:	78 6b                	js     803984 <spawn+0x6f3>
+    return child;
+  803919:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  80391f:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  803925:	e9 b7 00 00 00       	jmp    8039e1 <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  80392a:	89 c1                	mov    %eax,%ecx
+  80392c:	48 ba eb 57 80 00 00 	movabs $0x8057eb,%rdx
+  803933:	00 00 00 
+  803936:	be 83 00 00 00       	mov    $0x83,%esi
+  80393b:	48 bf cf 57 80 00 00 	movabs $0x8057cf,%rdi
+  803942:	00 00 00 
+  803945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394a:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  803951:	00 00 00 
+  803954:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803957:	89 c1                	mov    %eax,%ecx
+  803959:	48 ba 02 58 80 00 00 	movabs $0x805802,%rdx
+  803960:	00 00 00 
+  803963:	be 86 00 00 00       	mov    $0x86,%esi
+  803968:	48 bf cf 57 80 00 00 	movabs $0x8057cf,%rdi
+  80396f:	00 00 00 
+  803972:	b8 00 00 00 00       	mov    $0x0,%eax
+  803977:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  80397e:	00 00 00 
+  803981:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803984:	89 c1                	mov    %eax,%ecx
+  803986:	48 ba 1c 58 80 00 00 	movabs $0x80581c,%rdx
+  80398d:	00 00 00 
+  803990:	be 89 00 00 00       	mov    $0x89,%esi
+  803995:	48 bf cf 57 80 00 00 	movabs $0x8057cf,%rdi
+  80399c:	00 00 00 
+  80399f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a4:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  8039ab:	00 00 00 
+  8039ae:	41 ff d0             	call   *%r8
+  8039b1:	89 c3                	mov    %eax,%ebx
+  8039b3:	eb 02                	jmp    8039b7 <spawn+0x726>
+  8039b5:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  8039b7:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8039bd:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+    close(fd);
+  8039c9:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  8039cf:	48 b8 bc 1f 80 00 00 	movabs $0x801fbc,%rax
+  8039d6:	00 00 00 
+  8039d9:	ff d0                	call   *%rax
+    return res;
+  8039db:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  8039e1:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  8039e7:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  8039ee:	5b                   	pop    %rbx
+  8039ef:	41 5c                	pop    %r12
+  8039f1:	41 5d                	pop    %r13
+  8039f3:	41 5e                	pop    %r14
+  8039f5:	41 5f                	pop    %r15
+  8039f7:	5d                   	pop    %rbp
+  8039f8:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8039f9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8039fe:	89 c3                	mov    %eax,%ebx
+  803a00:	eb b5                	jmp    8039b7 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803a02:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803a07:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803a0c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a16:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	85 c0                	test   %eax,%eax
+  803a24:	78 d8                	js     8039fe <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803a26:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  803a2d:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803a31:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  803a38:	f8 ff 40 00 
+  803a3c:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803a43:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803a47:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803a4c:	e9 4c fa ff ff       	jmp    80349d <spawn+0x20c>
+
+0000000000803a51 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803a51:	55                   	push   %rbp
+  803a52:	48 89 e5             	mov    %rsp,%rbp
+  803a55:	48 83 ec 50          	sub    $0x50,%rsp
+  803a59:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803a5d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803a61:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803a65:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803a69:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803a70:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a78:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803a7c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803a80:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803a85:	eb 15                	jmp    803a9c <spawnl+0x4b>
+  803a87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a93:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803a97:	74 1c                	je     803ab5 <spawnl+0x64>
+  803a99:	83 c1 01             	add    $0x1,%ecx
+  803a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  803aa2:	77 e3                	ja     803a87 <spawnl+0x36>
+  803aa4:	89 c2                	mov    %eax,%edx
+  803aa6:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803aaa:	4c 01 d2             	add    %r10,%rdx
+  803aad:	83 c0 08             	add    $0x8,%eax
+  803ab0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ab3:	eb de                	jmp    803a93 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803ab5:	8d 41 02             	lea    0x2(%rcx),%eax
+  803ab8:	48 98                	cltq
+  803aba:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803ac1:	00 
+  803ac2:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803ac6:	48 29 c4             	sub    %rax,%rsp
+  803ac9:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803ace:	4c 89 c0             	mov    %r8,%rax
+  803ad1:	48 c1 e8 03          	shr    $0x3,%rax
+  803ad5:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803ad9:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803ae0:	00 
+    argv[argc + 1] = NULL;
+  803ae1:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ae4:	48 98                	cltq
+  803ae6:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803aed:	00 
+    va_start(vl, arg0);
+  803aee:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803af5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803af9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803afd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b01:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803b05:	85 c9                	test   %ecx,%ecx
+  803b07:	74 41                	je     803b4a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803b09:	49 89 c1             	mov    %rax,%r9
+  803b0c:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803b10:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803b13:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803b18:	eb 1b                	jmp    803b35 <spawnl+0xe4>
+  803b1a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b1e:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803b22:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803b26:	48 8b 11             	mov    (%rcx),%rdx
+  803b29:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803b2c:	48 83 c0 08          	add    $0x8,%rax
+  803b30:	48 39 f0             	cmp    %rsi,%rax
+  803b33:	74 15                	je     803b4a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803b35:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803b38:	83 fa 2f             	cmp    $0x2f,%edx
+  803b3b:	77 dd                	ja     803b1a <spawnl+0xc9>
+  803b3d:	89 d1                	mov    %edx,%ecx
+  803b3f:	4c 01 c9             	add    %r9,%rcx
+  803b42:	83 c2 08             	add    $0x8,%edx
+  803b45:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803b48:	eb dc                	jmp    803b26 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803b4a:	4c 89 c6             	mov    %r8,%rsi
+  803b4d:	48 b8 91 32 80 00 00 	movabs $0x803291,%rax
+  803b54:	00 00 00 
+  803b57:	ff d0                	call   *%rax
+}
+  803b59:	c9                   	leave
+  803b5a:	c3                   	ret
+
+0000000000803b5b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b5b:	55                   	push   %rbp
+  803b5c:	48 89 e5             	mov    %rsp,%rbp
+  803b5f:	41 54                	push   %r12
+  803b61:	53                   	push   %rbx
+  803b62:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b65:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+  803b71:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b74:	48 be 33 58 80 00 00 	movabs $0x805833,%rsi
+  803b7b:	00 00 00 
+  803b7e:	48 89 df             	mov    %rbx,%rdi
+  803b81:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  803b88:	00 00 00 
+  803b8b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b8d:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803b92:	41 8b 14 24          	mov    (%r12),%edx
+  803b96:	29 d0                	sub    %edx,%eax
+  803b98:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b9e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ba5:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ba8:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803baf:	00 00 00 
+  803bb2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbe:	5b                   	pop    %rbx
+  803bbf:	41 5c                	pop    %r12
+  803bc1:	5d                   	pop    %rbp
+  803bc2:	c3                   	ret
+
+0000000000803bc3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803bc3:	55                   	push   %rbp
+  803bc4:	48 89 e5             	mov    %rsp,%rbp
+  803bc7:	41 55                	push   %r13
+  803bc9:	41 54                	push   %r12
+  803bcb:	53                   	push   %rbx
+  803bcc:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd0:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bd3:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  803bda:	00 00 00 
+  803bdd:	ff d0                	call   *%rax
+  803bdf:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803be2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be7:	4c 89 e6             	mov    %r12,%rsi
+  803bea:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bef:	49 bc e0 14 80 00 00 	movabs $0x8014e0,%r12
+  803bf6:	00 00 00 
+  803bf9:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803bfc:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803c02:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  803c09:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c0e:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803c11:	be 00 04 00 00       	mov    $0x400,%esi
+  803c16:	48 89 df             	mov    %rbx,%rdi
+  803c19:	49 bd 5a 1a 80 00 00 	movabs $0x801a5a,%r13
+  803c20:	00 00 00 
+  803c23:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803c26:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803c2a:	be 00 04 00 00       	mov    $0x400,%esi
+  803c2f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803c32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c37:	48 89 de             	mov    %rbx,%rsi
+  803c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c3f:	41 ff d4             	call   *%r12
+}
+  803c42:	48 83 c4 08          	add    $0x8,%rsp
+  803c46:	5b                   	pop    %rbx
+  803c47:	41 5c                	pop    %r12
+  803c49:	41 5d                	pop    %r13
+  803c4b:	5d                   	pop    %rbp
+  803c4c:	c3                   	ret
+
+0000000000803c4d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c4d:	55                   	push   %rbp
+  803c4e:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c51:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803c57:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803c5e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c63:	48 b8 80 13 80 00 00 	movabs $0x801380,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	0f 94 c0             	sete   %al
+  803c74:	0f b6 c0             	movzbl %al,%eax
+}
+  803c77:	5d                   	pop    %rbp
+  803c78:	c3                   	ret
+
+0000000000803c79 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803c79:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c7e:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803c80:	8b 07                	mov    (%rdi),%eax
+  803c82:	39 f0                	cmp    %esi,%eax
+  803c84:	74 01                	je     803c87 <pipe_wait+0xe>
+  803c86:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803c87:	55                   	push   %rbp
+  803c88:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803c8b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803c8d:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c91:	89 c0                	mov    %eax,%eax
+  803c93:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803c96:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803c9d:	48 b8 30 1a 80 00 00 	movabs $0x801a30,%rax
+  803ca4:	00 00 00 
+  803ca7:	ff d0                	call   *%rax
+}
+  803ca9:	5d                   	pop    %rbp
+  803caa:	c3                   	ret
+
+0000000000803cab <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb0:	87 06                	xchg   %eax,(%rsi)
+  803cb2:	85 c0                	test   %eax,%eax
+  803cb4:	75 01                	jne    803cb7 <pipe_wake+0xc>
+  803cb6:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  803cb7:	55                   	push   %rbp
+  803cb8:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803cbb:	be 00 04 00 00       	mov    $0x400,%esi
+  803cc0:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  803cc7:	00 00 00 
+  803cca:	ff d0                	call   *%rax
+}
+  803ccc:	5d                   	pop    %rbp
+  803ccd:	c3                   	ret
+
+0000000000803cce <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803cce:	55                   	push   %rbp
+  803ccf:	48 89 e5             	mov    %rsp,%rbp
+  803cd2:	41 57                	push   %r15
+  803cd4:	41 56                	push   %r14
+  803cd6:	41 55                	push   %r13
+  803cd8:	41 54                	push   %r12
+  803cda:	53                   	push   %rbx
+  803cdb:	48 83 ec 28          	sub    $0x28,%rsp
+  803cdf:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803ce3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ce7:	48 89 d3             	mov    %rdx,%rbx
+  803cea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cee:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  803cf5:	00 00 00 
+  803cf8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803cfa:	48 85 db             	test   %rbx,%rbx
+  803cfd:	0f 84 0f 01 00 00    	je     803e12 <devpipe_write+0x144>
+  803d03:	49 89 c4             	mov    %rax,%r12
+  803d06:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  803d0c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803d13:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803d17:	eb 4f                	jmp    803d68 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d19:	4c 89 e6             	mov    %r12,%rsi
+  803d1c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803d20:	48 b8 4d 3c 80 00 00 	movabs $0x803c4d,%rax
+  803d27:	00 00 00 
+  803d2a:	ff d0                	call   *%rax
+  803d2c:	85 c0                	test   %eax,%eax
+  803d2e:	74 14                	je     803d44 <devpipe_write+0x76>
+  803d30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d35:	48 83 c4 28          	add    $0x28,%rsp
+  803d39:	5b                   	pop    %rbx
+  803d3a:	41 5c                	pop    %r12
+  803d3c:	41 5d                	pop    %r13
+  803d3e:	41 5e                	pop    %r14
+  803d40:	41 5f                	pop    %r15
+  803d42:	5d                   	pop    %rbp
+  803d43:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803d44:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803d49:	44 89 ee             	mov    %r13d,%esi
+  803d4c:	4c 89 e7             	mov    %r12,%rdi
+  803d4f:	48 b8 79 3c 80 00 00 	movabs $0x803c79,%rax
+  803d56:	00 00 00 
+  803d59:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803d5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d5f:	49 39 c7             	cmp    %rax,%r15
+  803d62:	0f 83 aa 00 00 00    	jae    803e12 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803d68:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803d6d:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803d71:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803d78:	00 
+  803d79:	44 89 f0             	mov    %r14d,%eax
+  803d7c:	44 29 e8             	sub    %r13d,%eax
+  803d7f:	39 d8                	cmp    %ebx,%eax
+  803d81:	74 96                	je     803d19 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803d83:	89 d8                	mov    %ebx,%eax
+  803d85:	44 29 f0             	sub    %r14d,%eax
+  803d88:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803d8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d90:	4c 29 f8             	sub    %r15,%rax
+  803d93:	49 39 c5             	cmp    %rax,%r13
+  803d96:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803d9a:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803d9d:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803da0:	89 db                	mov    %ebx,%ebx
+  803da2:	48 29 c3             	sub    %rax,%rbx
+  803da5:	4c 39 eb             	cmp    %r13,%rbx
+  803da8:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803dac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803db0:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803db4:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803dbb:	00 
+  803dbc:	48 89 da             	mov    %rbx,%rdx
+  803dbf:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  803dcb:	4c 89 ea             	mov    %r13,%rdx
+  803dce:	48 29 da             	sub    %rbx,%rdx
+  803dd1:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803dd5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803dd9:	48 01 ce             	add    %rcx,%rsi
+  803ddc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803de0:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  803dec:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803df1:	45 01 ee             	add    %r13d,%r14d
+  803df4:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  803df9:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803dfe:	48 b8 ab 3c 80 00 00 	movabs $0x803cab,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+        i += chunk;
+  803e0a:	4d 01 ef             	add    %r13,%r15
+  803e0d:	e9 49 ff ff ff       	jmp    803d5b <devpipe_write+0x8d>
+    return n;
+  803e12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e16:	e9 1a ff ff ff       	jmp    803d35 <devpipe_write+0x67>
+
+0000000000803e1b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e1b:	55                   	push   %rbp
+  803e1c:	48 89 e5             	mov    %rsp,%rbp
+  803e1f:	41 57                	push   %r15
+  803e21:	41 56                	push   %r14
+  803e23:	41 55                	push   %r13
+  803e25:	41 54                	push   %r12
+  803e27:	53                   	push   %rbx
+  803e28:	48 83 ec 28          	sub    $0x28,%rsp
+  803e2c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803e30:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803e34:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e38:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+  803e44:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803e47:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803e4b:	49 bf 4d 3c 80 00 00 	movabs $0x803c4d,%r15
+  803e52:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803e55:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803e59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e5d:	eb 15                	jmp    803e74 <devpipe_read+0x59>
+  803e5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e63:	89 de                	mov    %ebx,%esi
+  803e65:	4c 89 f7             	mov    %r14,%rdi
+  803e68:	48 b8 79 3c 80 00 00 	movabs $0x803c79,%rax
+  803e6f:	00 00 00 
+  803e72:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803e74:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803e78:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803e7b:	41 39 dd             	cmp    %ebx,%r13d
+  803e7e:	75 15                	jne    803e95 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803e80:	4c 89 e6             	mov    %r12,%rsi
+  803e83:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e87:	41 ff d7             	call   *%r15
+  803e8a:	85 c0                	test   %eax,%eax
+  803e8c:	74 d1                	je     803e5f <devpipe_read+0x44>
+  803e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e93:	eb 7c                	jmp    803f11 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803e95:	44 29 eb             	sub    %r13d,%ebx
+  803e98:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803e9c:	48 39 c3             	cmp    %rax,%rbx
+  803e9f:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803ea3:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803eaa:	00 
+  803eab:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803eaf:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803eb2:	45 89 f6             	mov    %r14d,%r14d
+  803eb5:	49 29 c6             	sub    %rax,%r14
+  803eb8:	49 39 de             	cmp    %rbx,%r14
+  803ebb:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803ebf:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803ec6:	00 
+  803ec7:	4c 89 f2             	mov    %r14,%rdx
+  803eca:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ece:	49 bf 5d 10 80 00 00 	movabs $0x80105d,%r15
+  803ed5:	00 00 00 
+  803ed8:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803edb:	48 89 da             	mov    %rbx,%rdx
+  803ede:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803ee1:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ee8:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803ee9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803eed:	4c 01 f7             	add    %r14,%rdi
+  803ef0:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803ef3:	41 01 dd             	add    %ebx,%r13d
+  803ef6:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803efa:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803eff:	4c 89 e7             	mov    %r12,%rdi
+  803f02:	48 b8 ab 3c 80 00 00 	movabs $0x803cab,%rax
+  803f09:	00 00 00 
+  803f0c:	ff d0                	call   *%rax
+    return n;
+  803f0e:	48 89 d8             	mov    %rbx,%rax
+}
+  803f11:	48 83 c4 28          	add    $0x28,%rsp
+  803f15:	5b                   	pop    %rbx
+  803f16:	41 5c                	pop    %r12
+  803f18:	41 5d                	pop    %r13
+  803f1a:	41 5e                	pop    %r14
+  803f1c:	41 5f                	pop    %r15
+  803f1e:	5d                   	pop    %rbp
+  803f1f:	c3                   	ret
+
+0000000000803f20 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803f20:	55                   	push   %rbp
+  803f21:	48 89 e5             	mov    %rsp,%rbp
+  803f24:	41 57                	push   %r15
+  803f26:	41 56                	push   %r14
+  803f28:	41 55                	push   %r13
+  803f2a:	41 54                	push   %r12
+  803f2c:	53                   	push   %rbx
+  803f2d:	48 83 ec 18          	sub    $0x18,%rsp
+  803f31:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803f34:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803f3b:	0f 86 96 01 00 00    	jbe    8040d7 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803f41:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803f46:	48 01 db             	add    %rbx,%rbx
+  803f49:	48 39 f3             	cmp    %rsi,%rbx
+  803f4c:	72 f8                	jb     803f46 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803f4e:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803f55:	0f 87 18 02 00 00    	ja     804173 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f5b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803f5f:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803f66:	00 00 00 
+  803f69:	ff d0                	call   *%rax
+  803f6b:	41 89 c4             	mov    %eax,%r12d
+  803f6e:	85 c0                	test   %eax,%eax
+  803f70:	0f 88 b6 01 00 00    	js     80412c <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f76:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f80:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803f84:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f89:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  803f90:	00 00 00 
+  803f93:	ff d0                	call   *%rax
+  803f95:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f98:	85 c0                	test   %eax,%eax
+  803f9a:	0f 88 8c 01 00 00    	js     80412c <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fa0:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803fa4:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+  803fb0:	41 89 c4             	mov    %eax,%r12d
+  803fb3:	85 c0                	test   %eax,%eax
+  803fb5:	0f 88 57 01 00 00    	js     804112 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803fbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fce:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+  803fda:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fdd:	85 c0                	test   %eax,%eax
+  803fdf:	0f 88 2d 01 00 00    	js     804112 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803fe5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803fe9:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ff8:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803fff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804004:	4c 89 fa             	mov    %r15,%rdx
+  804007:	48 89 c6             	mov    %rax,%rsi
+  80400a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80400f:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  804016:	00 00 00 
+  804019:	ff d0                	call   *%rax
+  80401b:	41 89 c4             	mov    %eax,%r12d
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	0f 88 d2 00 00 00    	js     8040f8 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  804026:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80402d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804031:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  804038:	00 00 00 
+  80403b:	ff d0                	call   *%rax
+  80403d:	48 89 c1             	mov    %rax,%rcx
+  804040:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804046:	4d 89 f8             	mov    %r15,%r8
+  804049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80404e:	4c 89 f6             	mov    %r14,%rsi
+  804051:	bf 00 00 00 00       	mov    $0x0,%edi
+  804056:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+  804062:	41 89 c4             	mov    %eax,%r12d
+  804065:	85 c0                	test   %eax,%eax
+  804067:	78 78                	js     8040e1 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804069:	be 00 10 00 00       	mov    $0x1000,%esi
+  80406e:	4c 89 f7             	mov    %r14,%rdi
+  804071:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  804078:	00 00 00 
+  80407b:	ff d0                	call   *%rax
+  80407d:	83 f8 02             	cmp    $0x2,%eax
+  804080:	0f 85 b8 00 00 00    	jne    80413e <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804086:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80408d:	00 00 
+  80408f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804093:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804095:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804099:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040a4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040aa:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040b1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8040b5:	48 bb c4 1d 80 00 00 	movabs $0x801dc4,%rbx
+  8040bc:	00 00 00 
+  8040bf:	ff d3                	call   *%rbx
+  8040c1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8040c5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8040c9:	ff d3                	call   *%rbx
+  8040cb:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8040cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040d5:	eb 55                	jmp    80412c <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8040d7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8040dc:	e9 7a fe ff ff       	jmp    803f5b <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8040e1:	4c 89 fa             	mov    %r15,%rdx
+  8040e4:	4c 89 f6             	mov    %r14,%rsi
+  8040e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ec:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8040f3:	00 00 00 
+  8040f6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8040f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040fd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804101:	bf 00 00 00 00       	mov    $0x0,%edi
+  804106:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  80410d:	00 00 00 
+  804110:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804112:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804117:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80411b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804120:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  804127:	00 00 00 
+  80412a:	ff d0                	call   *%rax
+}
+  80412c:	44 89 e0             	mov    %r12d,%eax
+  80412f:	48 83 c4 18          	add    $0x18,%rsp
+  804133:	5b                   	pop    %rbx
+  804134:	41 5c                	pop    %r12
+  804136:	41 5d                	pop    %r13
+  804138:	41 5e                	pop    %r14
+  80413a:	41 5f                	pop    %r15
+  80413c:	5d                   	pop    %rbp
+  80413d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80413e:	48 b9 50 58 80 00 00 	movabs $0x805850,%rcx
+  804145:	00 00 00 
+  804148:	48 ba ba 57 80 00 00 	movabs $0x8057ba,%rdx
+  80414f:	00 00 00 
+  804152:	be 4c 00 00 00       	mov    $0x4c,%esi
+  804157:	48 bf 3a 58 80 00 00 	movabs $0x80583a,%rdi
+  80415e:	00 00 00 
+  804161:	b8 00 00 00 00       	mov    $0x0,%eax
+  804166:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  80416d:	00 00 00 
+  804170:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  804173:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804179:	eb b1                	jmp    80412c <pipe_sized+0x20c>
+
+000000000080417b <pipe>:
+pipe(int pfd[2]) {
+  80417b:	55                   	push   %rbp
+  80417c:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80417f:	be 00 00 01 00       	mov    $0x10000,%esi
+  804184:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  80418b:	00 00 00 
+  80418e:	ff d0                	call   *%rax
+}
+  804190:	5d                   	pop    %rbp
+  804191:	c3                   	ret
+
+0000000000804192 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804192:	55                   	push   %rbp
+  804193:	48 89 e5             	mov    %rsp,%rbp
+  804196:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80419a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80419e:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  8041a5:	00 00 00 
+  8041a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041aa:	85 c0                	test   %eax,%eax
+  8041ac:	78 23                	js     8041d1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041ae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041b2:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  8041b9:	00 00 00 
+  8041bc:	ff d0                	call   *%rax
+  8041be:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8041c1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041c5:	48 b8 4d 3c 80 00 00 	movabs $0x803c4d,%rax
+  8041cc:	00 00 00 
+  8041cf:	ff d0                	call   *%rax
+}
+  8041d1:	c9                   	leave
+  8041d2:	c3                   	ret
+
+00000000008041d3 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8041d3:	55                   	push   %rbp
+  8041d4:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8041d7:	8b 0f                	mov    (%rdi),%ecx
+  8041d9:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041dc:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8041de:	83 f9 07             	cmp    $0x7,%ecx
+  8041e1:	76 31                	jbe    804214 <backoff+0x41>
+    asm volatile("rdtsc"
+  8041e3:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8041e5:	83 c1 06             	add    $0x6,%ecx
+  8041e8:	be 15 00 00 00       	mov    $0x15,%esi
+  8041ed:	39 f1                	cmp    %esi,%ecx
+  8041ef:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8041f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041f7:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8041fa:	48 c1 e2 20          	shl    $0x20,%rdx
+  8041fe:	89 c0                	mov    %eax,%eax
+  804200:	48 09 c2             	or     %rax,%rdx
+  804203:	48 01 d7             	add    %rdx,%rdi
+  804206:	48 b8 a8 19 80 00 00 	movabs $0x8019a8,%rax
+  80420d:	00 00 00 
+  804210:	ff d0                	call   *%rax
+}
+  804212:	5d                   	pop    %rbp
+  804213:	c3                   	ret
+        sys_yield();
+  804214:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  80421b:	00 00 00 
+  80421e:	ff d0                	call   *%rax
+        return;
+  804220:	eb f0                	jmp    804212 <backoff+0x3f>
+
+0000000000804222 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804222:	55                   	push   %rbp
+  804223:	48 89 e5             	mov    %rsp,%rbp
+  804226:	41 55                	push   %r13
+  804228:	41 54                	push   %r12
+  80422a:	53                   	push   %rbx
+  80422b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80422f:	85 ff                	test   %edi,%edi
+  804231:	74 7e                	je     8042b1 <wait+0x8f>
+  804233:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804236:	89 f8                	mov    %edi,%eax
+  804238:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80423d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804244:	89 f9                	mov    %edi,%ecx
+  804246:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80424c:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804253:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80425a:	00 00 00 
+  80425d:	48 01 ca             	add    %rcx,%rdx
+  804260:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804266:	39 d7                	cmp    %edx,%edi
+  804268:	75 3c                	jne    8042a6 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  80426a:	48 98                	cltq
+  80426c:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804273:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80427a:	00 00 00 
+  80427d:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  804280:	49 bd d3 41 80 00 00 	movabs $0x8041d3,%r13
+  804287:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80428a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804290:	85 c0                	test   %eax,%eax
+  804292:	74 12                	je     8042a6 <wait+0x84>
+        backoff(&attempt);
+  804294:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804298:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80429b:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8042a1:	44 39 e0             	cmp    %r12d,%eax
+  8042a4:	74 e4                	je     80428a <wait+0x68>
+    }
+}
+  8042a6:	48 83 c4 18          	add    $0x18,%rsp
+  8042aa:	5b                   	pop    %rbx
+  8042ab:	41 5c                	pop    %r12
+  8042ad:	41 5d                	pop    %r13
+  8042af:	5d                   	pop    %rbp
+  8042b0:	c3                   	ret
+    assert(envid != 0);
+  8042b1:	48 b9 74 58 80 00 00 	movabs $0x805874,%rcx
+  8042b8:	00 00 00 
+  8042bb:	48 ba ba 57 80 00 00 	movabs $0x8057ba,%rdx
+  8042c2:	00 00 00 
+  8042c5:	be 22 00 00 00       	mov    $0x22,%esi
+  8042ca:	48 bf 7f 58 80 00 00 	movabs $0x80587f,%rdi
+  8042d1:	00 00 00 
+  8042d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d9:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  8042e0:	00 00 00 
+  8042e3:	41 ff d0             	call   *%r8
+
+00000000008042e6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042e6:	48 89 f8             	mov    %rdi,%rax
+  8042e9:	48 c1 e8 27          	shr    $0x27,%rax
+  8042ed:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8042f4:	7f 00 00 
+  8042f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042fb:	f6 c2 01             	test   $0x1,%dl
+  8042fe:	74 6d                	je     80436d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804300:	48 89 f8             	mov    %rdi,%rax
+  804303:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804307:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80430e:	7f 00 00 
+  804311:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804315:	f6 c2 01             	test   $0x1,%dl
+  804318:	74 62                	je     80437c <get_uvpt_entry+0x96>
+  80431a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804321:	7f 00 00 
+  804324:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804328:	f6 c2 80             	test   $0x80,%dl
+  80432b:	75 4f                	jne    80437c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80432d:	48 89 f8             	mov    %rdi,%rax
+  804330:	48 c1 e8 15          	shr    $0x15,%rax
+  804334:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80433b:	7f 00 00 
+  80433e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804342:	f6 c2 01             	test   $0x1,%dl
+  804345:	74 44                	je     80438b <get_uvpt_entry+0xa5>
+  804347:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80434e:	7f 00 00 
+  804351:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804355:	f6 c2 80             	test   $0x80,%dl
+  804358:	75 31                	jne    80438b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80435a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80435e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804365:	7f 00 00 
+  804368:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80436c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80436d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804374:	7f 00 00 
+  804377:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80437b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80437c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804383:	7f 00 00 
+  804386:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80438a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80438b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804392:	7f 00 00 
+  804395:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804399:	c3                   	ret
+
+000000000080439a <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80439a:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80439d:	48 89 f9             	mov    %rdi,%rcx
+  8043a0:	48 c1 e9 27          	shr    $0x27,%rcx
+  8043a4:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8043ab:	7f 00 00 
+  8043ae:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8043b2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043b9:	f6 c1 01             	test   $0x1,%cl
+  8043bc:	0f 84 b2 00 00 00    	je     804474 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8043c2:	48 89 f9             	mov    %rdi,%rcx
+  8043c5:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8043c9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8043d0:	7f 00 00 
+  8043d3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8043d7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8043de:	40 f6 c6 01          	test   $0x1,%sil
+  8043e2:	0f 84 8c 00 00 00    	je     804474 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8043e8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8043ef:	7f 00 00 
+  8043f2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8043f6:	a8 80                	test   $0x80,%al
+  8043f8:	75 7b                	jne    804475 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8043fa:	48 89 f9             	mov    %rdi,%rcx
+  8043fd:	48 c1 e9 15          	shr    $0x15,%rcx
+  804401:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804408:	7f 00 00 
+  80440b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80440f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804416:	40 f6 c6 01          	test   $0x1,%sil
+  80441a:	74 58                	je     804474 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80441c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804423:	7f 00 00 
+  804426:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80442a:	a8 80                	test   $0x80,%al
+  80442c:	75 6c                	jne    80449a <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80442e:	48 89 f9             	mov    %rdi,%rcx
+  804431:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804435:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80443c:	7f 00 00 
+  80443f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804443:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80444a:	40 f6 c6 01          	test   $0x1,%sil
+  80444e:	74 24                	je     804474 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804450:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804457:	7f 00 00 
+  80445a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80445e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804465:	ff ff 7f 
+  804468:	48 21 c8             	and    %rcx,%rax
+  80446b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804471:	48 09 d0             	or     %rdx,%rax
+}
+  804474:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804475:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80447c:	7f 00 00 
+  80447f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804483:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80448a:	ff ff 7f 
+  80448d:	48 21 c8             	and    %rcx,%rax
+  804490:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804496:	48 01 d0             	add    %rdx,%rax
+  804499:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80449a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8044a1:	7f 00 00 
+  8044a4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044a8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044af:	ff ff 7f 
+  8044b2:	48 21 c8             	and    %rcx,%rax
+  8044b5:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8044bb:	48 01 d0             	add    %rdx,%rax
+  8044be:	c3                   	ret
+
+00000000008044bf <get_prot>:
+
+int
+get_prot(void *va) {
+  8044bf:	55                   	push   %rbp
+  8044c0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044c3:	48 b8 e6 42 80 00 00 	movabs $0x8042e6,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+  8044cf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044d2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8044d7:	89 c1                	mov    %eax,%ecx
+  8044d9:	83 c9 04             	or     $0x4,%ecx
+  8044dc:	f6 c2 01             	test   $0x1,%dl
+  8044df:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8044e2:	89 c1                	mov    %eax,%ecx
+  8044e4:	83 c9 02             	or     $0x2,%ecx
+  8044e7:	f6 c2 02             	test   $0x2,%dl
+  8044ea:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044ed:	89 c1                	mov    %eax,%ecx
+  8044ef:	83 c9 01             	or     $0x1,%ecx
+  8044f2:	48 85 d2             	test   %rdx,%rdx
+  8044f5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8044f8:	89 c1                	mov    %eax,%ecx
+  8044fa:	83 c9 40             	or     $0x40,%ecx
+  8044fd:	f6 c6 04             	test   $0x4,%dh
+  804500:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804503:	5d                   	pop    %rbp
+  804504:	c3                   	ret
+
+0000000000804505 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804505:	55                   	push   %rbp
+  804506:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804509:	48 b8 e6 42 80 00 00 	movabs $0x8042e6,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804515:	48 c1 e8 06          	shr    $0x6,%rax
+  804519:	83 e0 01             	and    $0x1,%eax
+}
+  80451c:	5d                   	pop    %rbp
+  80451d:	c3                   	ret
+
+000000000080451e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80451e:	55                   	push   %rbp
+  80451f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804522:	48 b8 e6 42 80 00 00 	movabs $0x8042e6,%rax
+  804529:	00 00 00 
+  80452c:	ff d0                	call   *%rax
+  80452e:	83 e0 01             	and    $0x1,%eax
+}
+  804531:	5d                   	pop    %rbp
+  804532:	c3                   	ret
+
+0000000000804533 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  804533:	55                   	push   %rbp
+  804534:	48 89 e5             	mov    %rsp,%rbp
+  804537:	41 57                	push   %r15
+  804539:	41 56                	push   %r14
+  80453b:	41 55                	push   %r13
+  80453d:	41 54                	push   %r12
+  80453f:	53                   	push   %rbx
+  804540:	48 83 ec 18          	sub    $0x18,%rsp
+  804544:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804548:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80454c:	48 39 f7             	cmp    %rsi,%rdi
+  80454f:	0f 83 e4 00 00 00    	jae    804639 <foreach_present_page+0x106>
+  804555:	49 89 f4             	mov    %rsi,%r12
+  804558:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80455b:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804562:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804565:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80456c:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80456f:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804576:	7f 00 00 
+  804579:	eb 27                	jmp    8045a2 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80457b:	48 89 d8             	mov    %rbx,%rax
+  80457e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804582:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804586:	f6 c2 01             	test   $0x1,%dl
+  804589:	75 43                	jne    8045ce <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80458b:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804592:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804599:	4c 39 e3             	cmp    %r12,%rbx
+  80459c:	0f 83 83 00 00 00    	jae    804625 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8045a2:	48 89 d8             	mov    %rbx,%rax
+  8045a5:	48 c1 e8 27          	shr    $0x27,%rax
+  8045a9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8045ae:	a8 01                	test   $0x1,%al
+  8045b0:	75 c9                	jne    80457b <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8045b2:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8045b9:	ff ff ff 
+  8045bc:	48 21 d8             	and    %rbx,%rax
+  8045bf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8045c6:	00 00 00 
+  8045c9:	48 01 c3             	add    %rax,%rbx
+  8045cc:	eb cb                	jmp    804599 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8045ce:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8045d2:	a8 80                	test   $0x80,%al
+  8045d4:	75 1f                	jne    8045f5 <foreach_present_page+0xc2>
+  8045d6:	48 89 d8             	mov    %rbx,%rax
+  8045d9:	48 c1 e8 15          	shr    $0x15,%rax
+  8045dd:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8045e1:	a8 01                	test   $0x1,%al
+  8045e3:	75 10                	jne    8045f5 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8045e5:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8045ec:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8045f3:	eb a4                	jmp    804599 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8045f5:	48 89 df             	mov    %rbx,%rdi
+  8045f8:	48 b8 e6 42 80 00 00 	movabs $0x8042e6,%rax
+  8045ff:	00 00 00 
+  804602:	ff d0                	call   *%rax
+  804604:	a8 01                	test   $0x1,%al
+  804606:	74 11                	je     804619 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804608:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80460c:	48 89 df             	mov    %rbx,%rdi
+  80460f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804613:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804615:	85 c0                	test   %eax,%eax
+  804617:	78 11                	js     80462a <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804619:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804620:	e9 74 ff ff ff       	jmp    804599 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804625:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80462a:	48 83 c4 18          	add    $0x18,%rsp
+  80462e:	5b                   	pop    %rbx
+  80462f:	41 5c                	pop    %r12
+  804631:	41 5d                	pop    %r13
+  804633:	41 5e                	pop    %r14
+  804635:	41 5f                	pop    %r15
+  804637:	5d                   	pop    %rbp
+  804638:	c3                   	ret
+    return 0;
+  804639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463e:	eb ea                	jmp    80462a <foreach_present_page+0xf7>
+
+0000000000804640 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804640:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804647:	7f 00 00 
+  80464a:	a8 01                	test   $0x1,%al
+  80464c:	75 06                	jne    804654 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80464e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804653:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804654:	55                   	push   %rbp
+  804655:	48 89 e5             	mov    %rsp,%rbp
+  804658:	41 57                	push   %r15
+  80465a:	41 56                	push   %r14
+  80465c:	41 55                	push   %r13
+  80465e:	41 54                	push   %r12
+  804660:	53                   	push   %rbx
+  804661:	48 83 ec 28          	sub    $0x28,%rsp
+  804665:	49 89 fe             	mov    %rdi,%r14
+  804668:	49 89 f7             	mov    %rsi,%r15
+  80466b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804672:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804673:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80467a:	7f 00 00 
+  80467d:	e9 b0 00 00 00       	jmp    804732 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804682:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804689:	49 83 ec 01          	sub    $0x1,%r12
+  80468d:	74 2d                	je     8046bc <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80468f:	48 89 d8             	mov    %rbx,%rax
+  804692:	48 c1 e8 0c          	shr    $0xc,%rax
+  804696:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80469b:	f6 c2 01             	test   $0x1,%dl
+  80469e:	74 e2                	je     804682 <foreach_shared_region+0x42>
+  8046a0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8046a5:	f6 c4 04             	test   $0x4,%ah
+  8046a8:	74 d8                	je     804682 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8046aa:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8046b1:	4c 89 fa             	mov    %r15,%rdx
+  8046b4:	48 89 df             	mov    %rbx,%rdi
+  8046b7:	41 ff d6             	call   *%r14
+  8046ba:	eb c6                	jmp    804682 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8046bc:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8046c3:	00 
+  8046c4:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8046c9:	74 4c                	je     804717 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8046cb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8046cf:	48 89 c8             	mov    %rcx,%rax
+  8046d2:	48 c1 e8 15          	shr    $0x15,%rax
+  8046d6:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8046dd:	7f 00 00 
+  8046e0:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8046e4:	a8 01                	test   $0x1,%al
+  8046e6:	74 d4                	je     8046bc <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8046e8:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8046ef:	48 39 c1             	cmp    %rax,%rcx
+  8046f2:	73 c8                	jae    8046bc <foreach_shared_region+0x7c>
+  8046f4:	48 89 cb             	mov    %rcx,%rbx
+  8046f7:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8046fe:	48 39 d0             	cmp    %rdx,%rax
+  804701:	4d 19 e4             	sbb    %r12,%r12
+  804704:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80470b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804712:	e9 78 ff ff ff       	jmp    80468f <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804717:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80471e:	40 
+  80471f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804723:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80472a:	00 00 00 
+  80472d:	48 39 c1             	cmp    %rax,%rcx
+  804730:	74 4f                	je     804781 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804732:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804736:	48 89 c8             	mov    %rcx,%rax
+  804739:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80473d:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804744:	7f 00 00 
+  804747:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80474b:	a8 01                	test   $0x1,%al
+  80474d:	74 c8                	je     804717 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80474f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804756:	48 39 c1             	cmp    %rax,%rcx
+  804759:	73 bc                	jae    804717 <foreach_shared_region+0xd7>
+  80475b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804762:	48 39 d0             	cmp    %rdx,%rax
+  804765:	48 19 c0             	sbb    %rax,%rax
+  804768:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80476e:	48 05 00 02 00 00    	add    $0x200,%rax
+  804774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804778:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80477c:	e9 4a ff ff ff       	jmp    8046cb <foreach_shared_region+0x8b>
+}
+  804781:	b8 00 00 00 00       	mov    $0x0,%eax
+  804786:	48 83 c4 28          	add    $0x28,%rsp
+  80478a:	5b                   	pop    %rbx
+  80478b:	41 5c                	pop    %r12
+  80478d:	41 5d                	pop    %r13
+  80478f:	41 5e                	pop    %r14
+  804791:	41 5f                	pop    %r15
+  804793:	5d                   	pop    %rbp
+  804794:	c3                   	ret
+
+0000000000804795 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479a:	c3                   	ret
+
+000000000080479b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80479b:	55                   	push   %rbp
+  80479c:	48 89 e5             	mov    %rsp,%rbp
+  80479f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8047a2:	48 be 8a 58 80 00 00 	movabs $0x80588a,%rsi
+  8047a9:	00 00 00 
+  8047ac:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  8047b3:	00 00 00 
+  8047b6:	ff d0                	call   *%rax
+    return 0;
+}
+  8047b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047bd:	5d                   	pop    %rbp
+  8047be:	c3                   	ret
+
+00000000008047bf <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8047bf:	55                   	push   %rbp
+  8047c0:	48 89 e5             	mov    %rsp,%rbp
+  8047c3:	41 57                	push   %r15
+  8047c5:	41 56                	push   %r14
+  8047c7:	41 55                	push   %r13
+  8047c9:	41 54                	push   %r12
+  8047cb:	53                   	push   %rbx
+  8047cc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8047d3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8047da:	48 85 d2             	test   %rdx,%rdx
+  8047dd:	74 7a                	je     804859 <devcons_write+0x9a>
+  8047df:	49 89 d6             	mov    %rdx,%r14
+  8047e2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8047e8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8047ed:	49 bf f6 0f 80 00 00 	movabs $0x800ff6,%r15
+  8047f4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8047f7:	4c 89 f3             	mov    %r14,%rbx
+  8047fa:	48 29 f3             	sub    %rsi,%rbx
+  8047fd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804802:	48 39 c3             	cmp    %rax,%rbx
+  804805:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804809:	4c 63 eb             	movslq %ebx,%r13
+  80480c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804813:	48 01 c6             	add    %rax,%rsi
+  804816:	4c 89 ea             	mov    %r13,%rdx
+  804819:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804820:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804823:	4c 89 ee             	mov    %r13,%rsi
+  804826:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80482d:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  804834:	00 00 00 
+  804837:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804839:	41 01 dc             	add    %ebx,%r12d
+  80483c:	49 63 f4             	movslq %r12d,%rsi
+  80483f:	4c 39 f6             	cmp    %r14,%rsi
+  804842:	72 b3                	jb     8047f7 <devcons_write+0x38>
+    return res;
+  804844:	49 63 c4             	movslq %r12d,%rax
+}
+  804847:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80484e:	5b                   	pop    %rbx
+  80484f:	41 5c                	pop    %r12
+  804851:	41 5d                	pop    %r13
+  804853:	41 5e                	pop    %r14
+  804855:	41 5f                	pop    %r15
+  804857:	5d                   	pop    %rbp
+  804858:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804859:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80485f:	eb e3                	jmp    804844 <devcons_write+0x85>
+
+0000000000804861 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804861:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804864:	ba 00 00 00 00       	mov    $0x0,%edx
+  804869:	48 85 c0             	test   %rax,%rax
+  80486c:	74 60                	je     8048ce <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80486e:	55                   	push   %rbp
+  80486f:	48 89 e5             	mov    %rsp,%rbp
+  804872:	41 55                	push   %r13
+  804874:	41 54                	push   %r12
+  804876:	53                   	push   %rbx
+  804877:	48 83 ec 18          	sub    $0x18,%rsp
+  80487b:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80487e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804885:	48 bb 50 12 80 00 00 	movabs $0x801250,%rbx
+  80488c:	00 00 00 
+  80488f:	49 bc d3 41 80 00 00 	movabs $0x8041d3,%r12
+  804896:	00 00 00 
+  804899:	eb 07                	jmp    8048a2 <devcons_read+0x41>
+  80489b:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80489f:	41 ff d4             	call   *%r12
+  8048a2:	ff d3                	call   *%rbx
+  8048a4:	85 c0                	test   %eax,%eax
+  8048a6:	74 f3                	je     80489b <devcons_read+0x3a>
+    if (c < 0) return c;
+  8048a8:	48 63 d0             	movslq %eax,%rdx
+  8048ab:	78 13                	js     8048c0 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8048ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048b2:	83 f8 04             	cmp    $0x4,%eax
+  8048b5:	74 09                	je     8048c0 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8048b7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8048bb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8048c0:	48 89 d0             	mov    %rdx,%rax
+  8048c3:	48 83 c4 18          	add    $0x18,%rsp
+  8048c7:	5b                   	pop    %rbx
+  8048c8:	41 5c                	pop    %r12
+  8048ca:	41 5d                	pop    %r13
+  8048cc:	5d                   	pop    %rbp
+  8048cd:	c3                   	ret
+  8048ce:	48 89 d0             	mov    %rdx,%rax
+  8048d1:	c3                   	ret
+
+00000000008048d2 <cputchar>:
+cputchar(int ch) {
+  8048d2:	55                   	push   %rbp
+  8048d3:	48 89 e5             	mov    %rsp,%rbp
+  8048d6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8048da:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8048de:	be 01 00 00 00       	mov    $0x1,%esi
+  8048e3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8048e7:	48 b8 23 12 80 00 00 	movabs $0x801223,%rax
+  8048ee:	00 00 00 
+  8048f1:	ff d0                	call   *%rax
+}
+  8048f3:	c9                   	leave
+  8048f4:	c3                   	ret
+
+00000000008048f5 <getchar>:
+getchar(void) {
+  8048f5:	55                   	push   %rbp
+  8048f6:	48 89 e5             	mov    %rsp,%rbp
+  8048f9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8048fd:	ba 01 00 00 00       	mov    $0x1,%edx
+  804902:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804906:	bf 00 00 00 00       	mov    $0x0,%edi
+  80490b:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  804912:	00 00 00 
+  804915:	ff d0                	call   *%rax
+  804917:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804919:	85 c0                	test   %eax,%eax
+  80491b:	78 06                	js     804923 <getchar+0x2e>
+  80491d:	74 08                	je     804927 <getchar+0x32>
+  80491f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804923:	89 d0                	mov    %edx,%eax
+  804925:	c9                   	leave
+  804926:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804927:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80492c:	eb f5                	jmp    804923 <getchar+0x2e>
+
+000000000080492e <iscons>:
+iscons(int fdnum) {
+  80492e:	55                   	push   %rbp
+  80492f:	48 89 e5             	mov    %rsp,%rbp
+  804932:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804936:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80493a:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  804941:	00 00 00 
+  804944:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804946:	85 c0                	test   %eax,%eax
+  804948:	78 18                	js     804962 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80494a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80494e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804955:	00 00 00 
+  804958:	8b 00                	mov    (%rax),%eax
+  80495a:	39 02                	cmp    %eax,(%rdx)
+  80495c:	0f 94 c0             	sete   %al
+  80495f:	0f b6 c0             	movzbl %al,%eax
+}
+  804962:	c9                   	leave
+  804963:	c3                   	ret
+
+0000000000804964 <opencons>:
+opencons(void) {
+  804964:	55                   	push   %rbp
+  804965:	48 89 e5             	mov    %rsp,%rbp
+  804968:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80496c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804970:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  804977:	00 00 00 
+  80497a:	ff d0                	call   *%rax
+  80497c:	85 c0                	test   %eax,%eax
+  80497e:	78 49                	js     8049c9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804980:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804985:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80498a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80498e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804993:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  80499a:	00 00 00 
+  80499d:	ff d0                	call   *%rax
+  80499f:	85 c0                	test   %eax,%eax
+  8049a1:	78 26                	js     8049c9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8049a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049a7:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8049ae:	00 00 
+  8049b0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8049b2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049b6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8049bd:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  8049c4:	00 00 00 
+  8049c7:	ff d0                	call   *%rax
+}
+  8049c9:	c9                   	leave
+  8049ca:	c3                   	ret
+
+00000000008049cb <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8049cb:	55                   	push   %rbp
+  8049cc:	48 89 e5             	mov    %rsp,%rbp
+  8049cf:	41 55                	push   %r13
+  8049d1:	41 54                	push   %r12
+  8049d3:	53                   	push   %rbx
+  8049d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8049d8:	49 89 fc             	mov    %rdi,%r12
+  8049db:	48 89 f7             	mov    %rsi,%rdi
+  8049de:	48 89 d3             	mov    %rdx,%rbx
+  8049e1:	49 89 cd             	mov    %rcx,%r13
+  8049e4:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8049e7:	48 85 f6             	test   %rsi,%rsi
+  8049ea:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049f1:	00 00 00 
+  8049f4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8049f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8049fd:	48 85 db             	test   %rbx,%rbx
+  804a00:	74 03                	je     804a05 <ipc_recv_timeout+0x3a>
+  804a02:	48 8b 33             	mov    (%rbx),%rsi
+  804a05:	48 b8 41 19 80 00 00 	movabs $0x801941,%rax
+  804a0c:	00 00 00 
+  804a0f:	ff d0                	call   *%rax
+    if (res == 0) {
+  804a11:	85 c0                	test   %eax,%eax
+  804a13:	75 72                	jne    804a87 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804a15:	4d 85 e4             	test   %r12,%r12
+  804a18:	74 17                	je     804a31 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  804a1a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a21:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804a23:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a27:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804a2d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804a31:	4d 85 ed             	test   %r13,%r13
+  804a34:	74 17                	je     804a4d <ipc_recv_timeout+0x82>
+  804a36:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a3d:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804a3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a43:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804a49:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804a4d:	48 85 db             	test   %rbx,%rbx
+  804a50:	74 17                	je     804a69 <ipc_recv_timeout+0x9e>
+  804a52:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a59:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804a5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a5f:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804a66:	48 89 03             	mov    %rax,(%rbx)
+  804a69:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804a70:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804a72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a76:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804a7c:	48 83 c4 08          	add    $0x8,%rsp
+  804a80:	5b                   	pop    %rbx
+  804a81:	41 5c                	pop    %r12
+  804a83:	41 5d                	pop    %r13
+  804a85:	5d                   	pop    %rbp
+  804a86:	c3                   	ret
+        if (from_env_store) {
+  804a87:	4d 85 e4             	test   %r12,%r12
+  804a8a:	74 08                	je     804a94 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804a8c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a93:	00 
+        if (perm_store) {
+  804a94:	4d 85 ed             	test   %r13,%r13
+  804a97:	74 08                	je     804aa1 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804a99:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804aa0:	00 
+        if (size) {
+  804aa1:	48 85 db             	test   %rbx,%rbx
+  804aa4:	74 d6                	je     804a7c <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804aa6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804aad:	eb cd                	jmp    804a7c <ipc_recv_timeout+0xb1>
+
+0000000000804aaf <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804aaf:	55                   	push   %rbp
+  804ab0:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804ab3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ab9:	48 b8 cb 49 80 00 00 	movabs $0x8049cb,%rax
+  804ac0:	00 00 00 
+  804ac3:	ff d0                	call   *%rax
+}
+  804ac5:	5d                   	pop    %rbp
+  804ac6:	c3                   	ret
+
+0000000000804ac7 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804ac7:	55                   	push   %rbp
+  804ac8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804acb:	48 85 d2             	test   %rdx,%rdx
+  804ace:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ad5:	00 00 00 
+  804ad8:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804adc:	89 f6                	mov    %esi,%esi
+  804ade:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ae4:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  804aeb:	00 00 00 
+  804aee:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804af0:	85 c0                	test   %eax,%eax
+  804af2:	78 02                	js     804af6 <ipc_send+0x2f>
+}
+  804af4:	5d                   	pop    %rbp
+  804af5:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804af6:	89 c1                	mov    %eax,%ecx
+  804af8:	48 ba 96 58 80 00 00 	movabs $0x805896,%rdx
+  804aff:	00 00 00 
+  804b02:	be 51 00 00 00       	mov    $0x51,%esi
+  804b07:	48 bf ad 58 80 00 00 	movabs $0x8058ad,%rdi
+  804b0e:	00 00 00 
+  804b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b16:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  804b1d:	00 00 00 
+  804b20:	41 ff d0             	call   *%r8
+
+0000000000804b23 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804b23:	55                   	push   %rbp
+  804b24:	48 89 e5             	mov    %rsp,%rbp
+  804b27:	41 54                	push   %r12
+  804b29:	53                   	push   %rbx
+  804b2a:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804b2e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804b32:	48 85 d2             	test   %rdx,%rdx
+  804b35:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b3c:	00 00 00 
+  804b3f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804b43:	4d 85 c9             	test   %r9,%r9
+  804b46:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804b4a:	89 f6                	mov    %esi,%esi
+  804b4c:	48 83 ec 08          	sub    $0x8,%rsp
+  804b50:	53                   	push   %rbx
+  804b51:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  804b58:	00 00 00 
+  804b5b:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804b5d:	48 83 c4 10          	add    $0x10,%rsp
+  804b61:	85 c0                	test   %eax,%eax
+  804b63:	78 65                	js     804bca <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804b65:	4d 85 e4             	test   %r12,%r12
+  804b68:	74 17                	je     804b81 <ipc_call+0x5e>
+  804b6a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804b71:	00 00 
+  804b73:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b77:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804b7d:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804b81:	48 85 db             	test   %rbx,%rbx
+  804b84:	74 28                	je     804bae <ipc_call+0x8b>
+  804b86:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804b8d:	00 00 
+  804b8f:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804b93:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804b9a:	ba 20 00 00 00       	mov    $0x20,%edx
+  804b9f:	48 89 df             	mov    %rbx,%rdi
+  804ba2:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  804ba9:	00 00 00 
+  804bac:	ff d0                	call   *%rax
+  804bae:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804bb5:	00 00 
+    return thisenv->env_ipc_value;
+  804bb7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bbb:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804bc1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804bc5:	5b                   	pop    %rbx
+  804bc6:	41 5c                	pop    %r12
+  804bc8:	5d                   	pop    %rbp
+  804bc9:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804bca:	89 c1                	mov    %eax,%ecx
+  804bcc:	48 ba b7 58 80 00 00 	movabs $0x8058b7,%rdx
+  804bd3:	00 00 00 
+  804bd6:	be 62 00 00 00       	mov    $0x62,%esi
+  804bdb:	48 bf ad 58 80 00 00 	movabs $0x8058ad,%rdi
+  804be2:	00 00 00 
+  804be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bea:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  804bf1:	00 00 00 
+  804bf4:	41 ff d0             	call   *%r8
+
+0000000000804bf7 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804bf7:	55                   	push   %rbp
+  804bf8:	48 89 e5             	mov    %rsp,%rbp
+  804bfb:	41 57                	push   %r15
+  804bfd:	41 56                	push   %r14
+  804bff:	41 55                	push   %r13
+  804c01:	41 54                	push   %r12
+  804c03:	53                   	push   %rbx
+  804c04:	48 83 ec 20          	sub    $0x20,%rsp
+  804c08:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804c0b:	48 89 d3             	mov    %rdx,%rbx
+  804c0e:	49 89 ce             	mov    %rcx,%r14
+  804c11:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804c15:	4d 89 cd             	mov    %r9,%r13
+  804c18:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804c1c:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804c20:	48 85 d2             	test   %rdx,%rdx
+  804c23:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c2a:	00 00 00 
+  804c2d:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804c31:	4d 85 e4             	test   %r12,%r12
+  804c34:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804c38:	89 f0                	mov    %esi,%eax
+  804c3a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804c3e:	41 57                	push   %r15
+  804c40:	4d 89 e1             	mov    %r12,%r9
+  804c43:	48 89 da             	mov    %rbx,%rdx
+  804c46:	48 89 c6             	mov    %rax,%rsi
+  804c49:	48 b8 ec 18 80 00 00 	movabs $0x8018ec,%rax
+  804c50:	00 00 00 
+  804c53:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804c55:	48 83 c4 10          	add    $0x10,%rsp
+  804c59:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804c5c:	0f 84 93 00 00 00    	je     804cf5 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804c62:	85 c0                	test   %eax,%eax
+  804c64:	0f 88 f3 00 00 00    	js     804d5d <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804c6a:	4d 85 ed             	test   %r13,%r13
+  804c6d:	74 17                	je     804c86 <ipc_reply_wait+0x8f>
+  804c6f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804c76:	00 00 
+  804c78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c7c:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804c82:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804c86:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804c8b:	74 19                	je     804ca6 <ipc_reply_wait+0xaf>
+  804c8d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804c94:	00 00 
+  804c96:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c9a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804ca0:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804ca4:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804ca6:	4d 85 ff             	test   %r15,%r15
+  804ca9:	74 28                	je     804cd3 <ipc_reply_wait+0xdc>
+  804cab:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cb2:	00 00 
+  804cb4:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804cb8:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804cbf:	ba 20 00 00 00       	mov    $0x20,%edx
+  804cc4:	4c 89 ff             	mov    %r15,%rdi
+  804cc7:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  804cce:	00 00 00 
+  804cd1:	ff d0                	call   *%rax
+  804cd3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cda:	00 00 
+    return thisenv->env_ipc_value;
+  804cdc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ce0:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804ce6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804cea:	5b                   	pop    %rbx
+  804ceb:	41 5c                	pop    %r12
+  804ced:	41 5d                	pop    %r13
+  804cef:	41 5e                	pop    %r14
+  804cf1:	41 5f                	pop    %r15
+  804cf3:	5d                   	pop    %rbp
+  804cf4:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804cf5:	4d 89 f9             	mov    %r15,%r9
+  804cf8:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804cfc:	4c 89 f1             	mov    %r14,%rcx
+  804cff:	48 89 da             	mov    %rbx,%rdx
+  804d02:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804d06:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804d09:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  804d10:	00 00 00 
+  804d13:	ff d0                	call   *%rax
+  804d15:	85 c0                	test   %eax,%eax
+  804d17:	78 17                	js     804d30 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804d19:	4c 89 f6             	mov    %r14,%rsi
+  804d1c:	4c 89 e7             	mov    %r12,%rdi
+  804d1f:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  804d26:	00 00 00 
+  804d29:	ff d0                	call   *%rax
+  804d2b:	e9 32 ff ff ff       	jmp    804c62 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804d30:	89 c1                	mov    %eax,%ecx
+  804d32:	48 ba 96 58 80 00 00 	movabs $0x805896,%rdx
+  804d39:	00 00 00 
+  804d3c:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804d41:	48 bf ad 58 80 00 00 	movabs $0x8058ad,%rdi
+  804d48:	00 00 00 
+  804d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d50:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  804d57:	00 00 00 
+  804d5a:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804d5d:	89 c1                	mov    %eax,%ecx
+  804d5f:	48 ba ce 58 80 00 00 	movabs $0x8058ce,%rdx
+  804d66:	00 00 00 
+  804d69:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804d6e:	48 bf ad 58 80 00 00 	movabs $0x8058ad,%rdi
+  804d75:	00 00 00 
+  804d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7d:	49 b8 87 03 80 00 00 	movabs $0x800387,%r8
+  804d84:	00 00 00 
+  804d87:	41 ff d0             	call   *%r8
+
+0000000000804d8a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804d8f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804d96:	00 00 00 
+  804d99:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804da0:	48 01 ca             	add    %rcx,%rdx
+  804da3:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804da9:	39 fa                	cmp    %edi,%edx
+  804dab:	74 12                	je     804dbf <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804dad:	48 83 c0 01          	add    $0x1,%rax
+  804db1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804db7:	75 e0                	jne    804d99 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804db9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dbe:	c3                   	ret
+            return envs[i].env_id;
+  804dbf:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804dc6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804dcd:	00 00 00 
+  804dd0:	48 01 d0             	add    %rdx,%rax
+  804dd3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804dd9:	c3                   	ret
+
+0000000000804dda <__text_end>:
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
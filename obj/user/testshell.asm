@@ -0,0 +1,9206 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f0 06 00 00       	call   800713 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf fd 27 80 00 00 	movabs $0x8027fd,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 73 09 80 00 00 	movabs $0x800973,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf 73 60 80 00 00 	movabs $0x806073,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 0f 26 80 00 00 	movabs $0x80260f,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be bf 16 80 00 00 	movabs $0x8016bf,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf 84 60 80 00 00 	movabs $0x806084,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 0f 26 80 00 00 	movabs $0x80260f,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd bf 16 80 00 00 	movabs $0x8016bf,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 00 08 80 00 00 	movabs $0x800800,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb 58 24 80 00 00 	movabs $0x802458,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb ac 06 80 00 00 	movabs $0x8006ac,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf 99 60 80 00 00 	movabs $0x806099,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 4c 01 00 00    	js     800309 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 61 01 00 00    	js     800336 <umain+0x1d5>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf 28 60 80 00 00 	movabs $0x806028,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 5f 20 80 00 00 	movabs $0x80205f,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 5b 01 00 00    	js     800363 <umain+0x202>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd b3 24 80 00 00 	movabs $0x8024b3,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd 58 24 80 00 00 	movabs $0x802458,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba df 60 80 00 00 	movabs $0x8060df,%rdx
+  80024e:	00 00 00 
+  800251:	48 be a3 60 80 00 00 	movabs $0x8060a3,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf e2 60 80 00 00 	movabs $0x8060e2,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 ed 3e 80 00 00 	movabs $0x803eed,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 0e 01 00 00    	js     800390 <umain+0x22f>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be 58 24 80 00 00 	movabs $0x802458,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 00 08 80 00 00 	movabs $0x800800,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb 58 24 80 00 00 	movabs $0x802458,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf f0 60 80 00 00 	movabs $0x8060f0,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 c9 00 00 00    	js     8003bd <umain+0x25c>
+    for (off = 0;; off++) {
+  8002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8002fa:	49 bd 0f 26 80 00 00 	movabs $0x80260f,%r13
+  800301:	00 00 00 
+  800304:	e9 5c 01 00 00       	jmp    800465 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba a6 60 80 00 00 	movabs $0x8060a6,%rdx
+  800312:	00 00 00 
+  800315:	be 12 00 00 00       	mov    $0x12,%esi
+  80031a:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  800336:	89 c1                	mov    %eax,%ecx
+  800338:	48 ba cd 60 80 00 00 	movabs $0x8060cd,%rdx
+  80033f:	00 00 00 
+  800342:	be 14 00 00 00       	mov    $0x14,%esi
+  800347:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  80035d:	00 00 00 
+  800360:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800363:	89 c1                	mov    %eax,%ecx
+  800365:	48 ba d6 60 80 00 00 	movabs $0x8060d6,%rdx
+  80036c:	00 00 00 
+  80036f:	be 19 00 00 00       	mov    $0x19,%esi
+  800374:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  80038a:	00 00 00 
+  80038d:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	48 ba e6 60 80 00 00 	movabs $0x8060e6,%rdx
+  800399:	00 00 00 
+  80039c:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a1:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  8003a8:	00 00 00 
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  8003b7:	00 00 00 
+  8003ba:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003bd:	89 c1                	mov    %eax,%ecx
+  8003bf:	48 ba 50 60 80 00 00 	movabs $0x806050,%rdx
+  8003c6:	00 00 00 
+  8003c9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003ce:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  8003d5:	00 00 00 
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  8003e4:	00 00 00 
+  8003e7:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003ea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003ed:	48 ba fe 60 80 00 00 	movabs $0x8060fe,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 31 00 00 00       	mov    $0x31,%esi
+  8003fc:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  800412:	00 00 00 
+  800415:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  800418:	48 ba 18 61 80 00 00 	movabs $0x806118,%rdx
+  80041f:	00 00 00 
+  800422:	be 33 00 00 00       	mov    $0x33,%esi
+  800427:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  800443:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  800447:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  80044c:	44 89 e2             	mov    %r12d,%edx
+  80044f:	44 89 f6             	mov    %r14d,%esi
+  800452:	44 89 ff             	mov    %r15d,%edi
+  800455:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  800461:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80046e:	44 89 ff             	mov    %r15d,%edi
+  800471:	41 ff d5             	call   *%r13
+  800474:	48 89 c3             	mov    %rax,%rbx
+  800477:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  80047a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80047f:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d5             	call   *%r13
+  800489:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  80048b:	85 db                	test   %ebx,%ebx
+  80048d:	0f 88 57 ff ff ff    	js     8003ea <umain+0x289>
+        if (n2 < 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	78 81                	js     800418 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	09 da                	or     %ebx,%edx
+  80049b:	74 15                	je     8004b2 <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  80049d:	83 fb 01             	cmp    $0x1,%ebx
+  8004a0:	75 a1                	jne    800443 <umain+0x2e2>
+  8004a2:	83 f8 01             	cmp    $0x1,%eax
+  8004a5:	75 9c                	jne    800443 <umain+0x2e2>
+  8004a7:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004ab:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004ae:	75 93                	jne    800443 <umain+0x2e2>
+  8004b0:	eb af                	jmp    800461 <umain+0x300>
+    cprintf("shell ran correctly\n");
+  8004b2:	48 bf 32 61 80 00 00 	movabs $0x806132,%rdi
+  8004b9:	00 00 00 
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  8004c8:	00 00 00 
+  8004cb:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004cd:	cc                   	int3
+}
+  8004ce:	48 83 c4 28          	add    $0x28,%rsp
+  8004d2:	5b                   	pop    %rbx
+  8004d3:	41 5c                	pop    %r12
+  8004d5:	41 5d                	pop    %r13
+  8004d7:	41 5e                	pop    %r14
+  8004d9:	41 5f                	pop    %r15
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	c3                   	ret
+
+00000000008004e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  8004e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8004ea:	48 be 47 61 80 00 00 	movabs $0x806147,%rsi
+  8004f1:	00 00 00 
+  8004f4:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+    return 0;
+}
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	41 57                	push   %r15
+  80050d:	41 56                	push   %r14
+  80050f:	41 55                	push   %r13
+  800511:	41 54                	push   %r12
+  800513:	53                   	push   %rbx
+  800514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80051b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800522:	48 85 d2             	test   %rdx,%rdx
+  800525:	74 7a                	je     8005a1 <devcons_write+0x9a>
+  800527:	49 89 d6             	mov    %rdx,%r14
+  80052a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800535:	49 bf 92 14 80 00 00 	movabs $0x801492,%r15
+  80053c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80053f:	4c 89 f3             	mov    %r14,%rbx
+  800542:	48 29 f3             	sub    %rsi,%rbx
+  800545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80054a:	48 39 c3             	cmp    %rax,%rbx
+  80054d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800551:	4c 63 eb             	movslq %ebx,%r13
+  800554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80055b:	48 01 c6             	add    %rax,%rsi
+  80055e:	4c 89 ea             	mov    %r13,%rdx
+  800561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80056b:	4c 89 ee             	mov    %r13,%rsi
+  80056e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800575:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  800581:	41 01 dc             	add    %ebx,%r12d
+  800584:	49 63 f4             	movslq %r12d,%rsi
+  800587:	4c 39 f6             	cmp    %r14,%rsi
+  80058a:	72 b3                	jb     80053f <devcons_write+0x38>
+    return res;
+  80058c:	49 63 c4             	movslq %r12d,%rax
+}
+  80058f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005a7:	eb e3                	jmp    80058c <devcons_write+0x85>
+
+00000000008005a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	48 85 c0             	test   %rax,%rax
+  8005b4:	74 60                	je     800616 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  8005c6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  8005cd:	48 bb ec 16 80 00 00 	movabs $0x8016ec,%rbx
+  8005d4:	00 00 00 
+  8005d7:	49 bc 6f 46 80 00 00 	movabs $0x80466f,%r12
+  8005de:	00 00 00 
+  8005e1:	eb 07                	jmp    8005ea <devcons_read+0x41>
+  8005e3:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8005e7:	41 ff d4             	call   *%r12
+  8005ea:	ff d3                	call   *%rbx
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	74 f3                	je     8005e3 <devcons_read+0x3a>
+    if (c < 0) return c;
+  8005f0:	48 63 d0             	movslq %eax,%rdx
+  8005f3:	78 13                	js     800608 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8005f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fa:	83 f8 04             	cmp    $0x4,%eax
+  8005fd:	74 09                	je     800608 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8005ff:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800603:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800608:	48 89 d0             	mov    %rdx,%rax
+  80060b:	48 83 c4 18          	add    $0x18,%rsp
+  80060f:	5b                   	pop    %rbx
+  800610:	41 5c                	pop    %r12
+  800612:	41 5d                	pop    %r13
+  800614:	5d                   	pop    %rbp
+  800615:	c3                   	ret
+  800616:	48 89 d0             	mov    %rdx,%rax
+  800619:	c3                   	ret
+
+000000000080061a <cputchar>:
+cputchar(int ch) {
+  80061a:	55                   	push   %rbp
+  80061b:	48 89 e5             	mov    %rsp,%rbp
+  80061e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800622:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800626:	be 01 00 00 00       	mov    $0x1,%esi
+  80062b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80062f:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  800636:	00 00 00 
+  800639:	ff d0                	call   *%rax
+}
+  80063b:	c9                   	leave
+  80063c:	c3                   	ret
+
+000000000080063d <getchar>:
+getchar(void) {
+  80063d:	55                   	push   %rbp
+  80063e:	48 89 e5             	mov    %rsp,%rbp
+  800641:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800645:	ba 01 00 00 00       	mov    $0x1,%edx
+  80064a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80064e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800653:	48 b8 0f 26 80 00 00 	movabs $0x80260f,%rax
+  80065a:	00 00 00 
+  80065d:	ff d0                	call   *%rax
+  80065f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800661:	85 c0                	test   %eax,%eax
+  800663:	78 06                	js     80066b <getchar+0x2e>
+  800665:	74 08                	je     80066f <getchar+0x32>
+  800667:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80066b:	89 d0                	mov    %edx,%eax
+  80066d:	c9                   	leave
+  80066e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80066f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800674:	eb f5                	jmp    80066b <getchar+0x2e>
+
+0000000000800676 <iscons>:
+iscons(int fdnum) {
+  800676:	55                   	push   %rbp
+  800677:	48 89 e5             	mov    %rsp,%rbp
+  80067a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80067e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800682:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  800689:	00 00 00 
+  80068c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80068e:	85 c0                	test   %eax,%eax
+  800690:	78 18                	js     8006aa <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800692:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800696:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80069d:	00 00 00 
+  8006a0:	8b 00                	mov    (%rax),%eax
+  8006a2:	39 02                	cmp    %eax,(%rdx)
+  8006a4:	0f 94 c0             	sete   %al
+  8006a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8006aa:	c9                   	leave
+  8006ab:	c3                   	ret
+
+00000000008006ac <opencons>:
+opencons(void) {
+  8006ac:	55                   	push   %rbp
+  8006ad:	48 89 e5             	mov    %rsp,%rbp
+  8006b0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006b4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006b8:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+  8006c4:	85 c0                	test   %eax,%eax
+  8006c6:	78 49                	js     800711 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8006c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8006cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8006d2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8006d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006db:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  8006e2:	00 00 00 
+  8006e5:	ff d0                	call   *%rax
+  8006e7:	85 c0                	test   %eax,%eax
+  8006e9:	78 26                	js     800711 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8006eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ef:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8006f6:	00 00 
+  8006f8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8006fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8006fe:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800705:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  80070c:	00 00 00 
+  80070f:	ff d0                	call   *%rax
+}
+  800711:	c9                   	leave
+  800712:	c3                   	ret
+
+0000000000800713 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800713:	55                   	push   %rbp
+  800714:	48 89 e5             	mov    %rsp,%rbp
+  800717:	41 56                	push   %r14
+  800719:	41 55                	push   %r13
+  80071b:	41 54                	push   %r12
+  80071d:	53                   	push   %rbx
+  80071e:	48 83 ec 30          	sub    $0x30,%rsp
+  800722:	41 89 fd             	mov    %edi,%r13d
+  800725:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800728:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80072f:	00 
+  800730:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800737:	00 
+  800738:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80073f:	00 
+  800740:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800747:	00 
+  800748:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80074c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800750:	bf 00 00 00 00       	mov    $0x0,%edi
+  800755:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  80075c:	00 00 00 
+  80075f:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800761:	48 ba b8 70 80 00 00 	movabs $0x8070b8,%rdx
+  800768:	00 00 00 
+  80076b:	48 b8 b8 70 80 00 00 	movabs $0x8070b8,%rax
+  800772:	00 00 00 
+  800775:	48 39 c2             	cmp    %rax,%rdx
+  800778:	73 17                	jae    800791 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  80077a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80077d:	49 89 c4             	mov    %rax,%r12
+  800780:	48 83 c3 08          	add    $0x8,%rbx
+  800784:	b8 00 00 00 00       	mov    $0x0,%eax
+  800789:	ff 53 f8             	call   *-0x8(%rbx)
+  80078c:	4c 39 e3             	cmp    %r12,%rbx
+  80078f:	72 ef                	jb     800780 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800791:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  800798:	00 00 00 
+  80079b:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80079d:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8007a4:	00 00 
+  8007a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8007ab:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8007b2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8007b9:	00 00 00 
+  8007bc:	48 01 c8             	add    %rcx,%rax
+  8007bf:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8007c3:	45 85 ed             	test   %r13d,%r13d
+  8007c6:	7e 0d                	jle    8007d5 <libmain+0xc2>
+  8007c8:	49 8b 06             	mov    (%r14),%rax
+  8007cb:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8007d2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8007d5:	4c 89 f6             	mov    %r14,%rsi
+  8007d8:	44 89 ef             	mov    %r13d,%edi
+  8007db:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8007e2:	00 00 00 
+  8007e5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8007e7:	48 b8 00 08 80 00 00 	movabs $0x800800,%rax
+  8007ee:	00 00 00 
+  8007f1:	ff d0                	call   *%rax
+#endif
+}
+  8007f3:	48 83 c4 30          	add    $0x30,%rsp
+  8007f7:	5b                   	pop    %rbx
+  8007f8:	41 5c                	pop    %r12
+  8007fa:	41 5d                	pop    %r13
+  8007fc:	41 5e                	pop    %r14
+  8007fe:	5d                   	pop    %rbp
+  8007ff:	c3                   	ret
+
+0000000000800800 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800800:	55                   	push   %rbp
+  800801:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800804:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  80080b:	00 00 00 
+  80080e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800810:	bf 00 00 00 00       	mov    $0x0,%edi
+  800815:	48 b8 1d 17 80 00 00 	movabs $0x80171d,%rax
+  80081c:	00 00 00 
+  80081f:	ff d0                	call   *%rax
+}
+  800821:	5d                   	pop    %rbp
+  800822:	c3                   	ret
+
+0000000000800823 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800823:	55                   	push   %rbp
+  800824:	48 89 e5             	mov    %rsp,%rbp
+  800827:	41 56                	push   %r14
+  800829:	41 55                	push   %r13
+  80082b:	41 54                	push   %r12
+  80082d:	53                   	push   %rbx
+  80082e:	48 83 ec 50          	sub    $0x50,%rsp
+  800832:	49 89 fc             	mov    %rdi,%r12
+  800835:	41 89 f5             	mov    %esi,%r13d
+  800838:	48 89 d3             	mov    %rdx,%rbx
+  80083b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80083f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800843:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800847:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80084e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800852:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800856:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80085a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80085e:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  800865:	00 00 00 
+  800868:	4c 8b 30             	mov    (%rax),%r14
+  80086b:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  800872:	00 00 00 
+  800875:	ff d0                	call   *%rax
+  800877:	89 c6                	mov    %eax,%esi
+  800879:	45 89 e8             	mov    %r13d,%r8d
+  80087c:	4c 89 e1             	mov    %r12,%rcx
+  80087f:	4c 89 f2             	mov    %r14,%rdx
+  800882:	48 bf 60 61 80 00 00 	movabs $0x806160,%rdi
+  800889:	00 00 00 
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800891:	49 bc 73 09 80 00 00 	movabs $0x800973,%r12
+  800898:	00 00 00 
+  80089b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80089e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8008a2:	48 89 df             	mov    %rbx,%rdi
+  8008a5:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  8008ac:	00 00 00 
+  8008af:	ff d0                	call   *%rax
+    cprintf("\n");
+  8008b1:	48 bf 97 60 80 00 00 	movabs $0x806097,%rdi
+  8008b8:	00 00 00 
+  8008bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8008c3:	cc                   	int3
+  8008c4:	eb fd                	jmp    8008c3 <_panic+0xa0>
+
+00000000008008c6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8008c6:	55                   	push   %rbp
+  8008c7:	48 89 e5             	mov    %rsp,%rbp
+  8008ca:	53                   	push   %rbx
+  8008cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8008cf:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8008d2:	8b 06                	mov    (%rsi),%eax
+  8008d4:	8d 50 01             	lea    0x1(%rax),%edx
+  8008d7:	89 16                	mov    %edx,(%rsi)
+  8008d9:	48 98                	cltq
+  8008db:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8008e0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8008e6:	74 0a                	je     8008f2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8008e8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8008ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008f0:	c9                   	leave
+  8008f1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008f2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008f6:	be ff 00 00 00       	mov    $0xff,%esi
+  8008fb:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  800902:	00 00 00 
+  800905:	ff d0                	call   *%rax
+        state->offset = 0;
+  800907:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80090d:	eb d9                	jmp    8008e8 <putch+0x22>
+
+000000000080090f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80090f:	55                   	push   %rbp
+  800910:	48 89 e5             	mov    %rsp,%rbp
+  800913:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80091a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80091d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800924:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800931:	48 89 f1             	mov    %rsi,%rcx
+  800934:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80093b:	48 bf c6 08 80 00 00 	movabs $0x8008c6,%rdi
+  800942:	00 00 00 
+  800945:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  80094c:	00 00 00 
+  80094f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800951:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800958:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80095f:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  800966:	00 00 00 
+  800969:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80096b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800971:	c9                   	leave
+  800972:	c3                   	ret
+
+0000000000800973 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800973:	55                   	push   %rbp
+  800974:	48 89 e5             	mov    %rsp,%rbp
+  800977:	48 83 ec 50          	sub    $0x50,%rsp
+  80097b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80097f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800983:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800987:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80098b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80098f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800996:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80099a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8009a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8009a6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8009aa:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  8009b1:	00 00 00 
+  8009b4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8009b6:	c9                   	leave
+  8009b7:	c3                   	ret
+
+00000000008009b8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8009b8:	55                   	push   %rbp
+  8009b9:	48 89 e5             	mov    %rsp,%rbp
+  8009bc:	41 57                	push   %r15
+  8009be:	41 56                	push   %r14
+  8009c0:	41 55                	push   %r13
+  8009c2:	41 54                	push   %r12
+  8009c4:	53                   	push   %rbx
+  8009c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8009c9:	49 89 fc             	mov    %rdi,%r12
+  8009cc:	49 89 f5             	mov    %rsi,%r13
+  8009cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8009d3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8009d6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8009d9:	41 89 cf             	mov    %ecx,%r15d
+  8009dc:	4c 39 fa             	cmp    %r15,%rdx
+  8009df:	73 5b                	jae    800a3c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8009e1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8009e5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8009e9:	85 db                	test   %ebx,%ebx
+  8009eb:	7e 0e                	jle    8009fb <print_num+0x43>
+            putch(padc, put_arg);
+  8009ed:	4c 89 ee             	mov    %r13,%rsi
+  8009f0:	44 89 f7             	mov    %r14d,%edi
+  8009f3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009f6:	83 eb 01             	sub    $0x1,%ebx
+  8009f9:	75 f2                	jne    8009ed <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009fb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009ff:	48 b9 94 61 80 00 00 	movabs $0x806194,%rcx
+  800a06:	00 00 00 
+  800a09:	48 b8 83 61 80 00 00 	movabs $0x806183,%rax
+  800a10:	00 00 00 
+  800a13:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800a17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a20:	49 f7 f7             	div    %r15
+  800a23:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800a27:	4c 89 ee             	mov    %r13,%rsi
+  800a2a:	41 ff d4             	call   *%r12
+}
+  800a2d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a31:	5b                   	pop    %rbx
+  800a32:	41 5c                	pop    %r12
+  800a34:	41 5d                	pop    %r13
+  800a36:	41 5e                	pop    %r14
+  800a38:	41 5f                	pop    %r15
+  800a3a:	5d                   	pop    %rbp
+  800a3b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800a3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a45:	49 f7 f7             	div    %r15
+  800a48:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a50:	52                   	push   %rdx
+  800a51:	45 0f be c9          	movsbl %r9b,%r9d
+  800a55:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a59:	48 89 c2             	mov    %rax,%rdx
+  800a5c:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  800a63:	00 00 00 
+  800a66:	ff d0                	call   *%rax
+  800a68:	48 83 c4 10          	add    $0x10,%rsp
+  800a6c:	eb 8d                	jmp    8009fb <print_num+0x43>
+
+0000000000800a6e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a6e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a72:	48 8b 06             	mov    (%rsi),%rax
+  800a75:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a79:	73 0a                	jae    800a85 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a7b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a7f:	48 89 16             	mov    %rdx,(%rsi)
+  800a82:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a85:	c3                   	ret
+
+0000000000800a86 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a86:	55                   	push   %rbp
+  800a87:	48 89 e5             	mov    %rsp,%rbp
+  800a8a:	48 83 ec 50          	sub    $0x50,%rsp
+  800a8e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a92:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a96:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a9a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800ab1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab5:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  800abc:	00 00 00 
+  800abf:	ff d0                	call   *%rax
+}
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+0000000000800ac3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800ac3:	55                   	push   %rbp
+  800ac4:	48 89 e5             	mov    %rsp,%rbp
+  800ac7:	41 57                	push   %r15
+  800ac9:	41 56                	push   %r14
+  800acb:	41 55                	push   %r13
+  800acd:	41 54                	push   %r12
+  800acf:	53                   	push   %rbx
+  800ad0:	48 83 ec 38          	sub    $0x38,%rsp
+  800ad4:	49 89 fe             	mov    %rdi,%r14
+  800ad7:	49 89 f5             	mov    %rsi,%r13
+  800ada:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800add:	48 8b 01             	mov    (%rcx),%rax
+  800ae0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800ae4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800ae8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aec:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800af0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800af4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800af8:	0f b6 3b             	movzbl (%rbx),%edi
+  800afb:	40 80 ff 25          	cmp    $0x25,%dil
+  800aff:	74 18                	je     800b19 <vprintfmt+0x56>
+            if (!ch) return;
+  800b01:	40 84 ff             	test   %dil,%dil
+  800b04:	0f 84 b1 06 00 00    	je     8011bb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800b0a:	40 0f b6 ff          	movzbl %dil,%edi
+  800b0e:	4c 89 ee             	mov    %r13,%rsi
+  800b11:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800b14:	4c 89 e3             	mov    %r12,%rbx
+  800b17:	eb db                	jmp    800af4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800b19:	be 00 00 00 00       	mov    $0x0,%esi
+  800b1e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800b22:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800b27:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b2d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800b34:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b38:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800b3d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800b42:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b45:	83 e8 23             	sub    $0x23,%eax
+  800b48:	3c 57                	cmp    $0x57,%al
+  800b4a:	0f 87 51 06 00 00    	ja     8011a1 <vprintfmt+0x6de>
+  800b50:	0f b6 c0             	movzbl %al,%eax
+  800b53:	48 b9 40 63 80 00 00 	movabs $0x806340,%rcx
+  800b5a:	00 00 00 
+  800b5d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b60:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b63:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b67:	eb cf                	jmp    800b38 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b69:	49 89 dc             	mov    %rbx,%r12
+  800b6c:	be 01 00 00 00       	mov    $0x1,%esi
+  800b71:	eb c5                	jmp    800b38 <vprintfmt+0x75>
+            padc = ch;
+  800b73:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b77:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b7a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b7d:	eb b9                	jmp    800b38 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	77 24                	ja     800bab <vprintfmt+0xe8>
+  800b87:	89 c1                	mov    %eax,%ecx
+  800b89:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b8d:	83 c0 08             	add    $0x8,%eax
+  800b90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b93:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b96:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b99:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b9d:	79 99                	jns    800b38 <vprintfmt+0x75>
+                width = precision;
+  800b9f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800ba3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800ba9:	eb 8d                	jmp    800b38 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800bab:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800baf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	eb da                	jmp    800b93 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800bb9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800bbe:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bc2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800bc8:	3c 39                	cmp    $0x39,%al
+  800bca:	77 1c                	ja     800be8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800bcc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800bd0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800bd4:	0f b6 c0             	movzbl %al,%eax
+  800bd7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bdc:	0f b6 03             	movzbl (%rbx),%eax
+  800bdf:	3c 39                	cmp    $0x39,%al
+  800be1:	76 e9                	jbe    800bcc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800be3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800be6:	eb b1                	jmp    800b99 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800be8:	49 89 dc             	mov    %rbx,%r12
+  800beb:	eb ac                	jmp    800b99 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800bed:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800bf0:	85 c9                	test   %ecx,%ecx
+  800bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf7:	0f 49 c1             	cmovns %ecx,%eax
+  800bfa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bfd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c00:	e9 33 ff ff ff       	jmp    800b38 <vprintfmt+0x75>
+            lflag++;
+  800c05:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800c08:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800c0b:	e9 28 ff ff ff       	jmp    800b38 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800c10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c13:	83 f8 2f             	cmp    $0x2f,%eax
+  800c16:	77 19                	ja     800c31 <vprintfmt+0x16e>
+  800c18:	89 c2                	mov    %eax,%edx
+  800c1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1e:	83 c0 08             	add    $0x8,%eax
+  800c21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c24:	8b 3a                	mov    (%rdx),%edi
+  800c26:	4c 89 ee             	mov    %r13,%rsi
+  800c29:	41 ff d6             	call   *%r14
+            break;
+  800c2c:	e9 c3 fe ff ff       	jmp    800af4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800c31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3d:	eb e5                	jmp    800c24 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800c3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c42:	83 f8 2f             	cmp    $0x2f,%eax
+  800c45:	77 5a                	ja     800ca1 <vprintfmt+0x1de>
+  800c47:	89 c2                	mov    %eax,%edx
+  800c49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4d:	83 c0 08             	add    $0x8,%eax
+  800c50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c53:	8b 02                	mov    (%rdx),%eax
+  800c55:	89 c1                	mov    %eax,%ecx
+  800c57:	f7 d9                	neg    %ecx
+  800c59:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c5c:	83 f9 16             	cmp    $0x16,%ecx
+  800c5f:	7f 4e                	jg     800caf <vprintfmt+0x1ec>
+  800c61:	48 63 c1             	movslq %ecx,%rax
+  800c64:	48 ba 00 66 80 00 00 	movabs $0x806600,%rdx
+  800c6b:	00 00 00 
+  800c6e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c72:	48 85 c0             	test   %rax,%rax
+  800c75:	74 38                	je     800caf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c77:	48 89 c1             	mov    %rax,%rcx
+  800c7a:	48 ba 6c 68 80 00 00 	movabs $0x80686c,%rdx
+  800c81:	00 00 00 
+  800c84:	4c 89 ee             	mov    %r13,%rsi
+  800c87:	4c 89 f7             	mov    %r14,%rdi
+  800c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8f:	49 b8 86 0a 80 00 00 	movabs $0x800a86,%r8
+  800c96:	00 00 00 
+  800c99:	41 ff d0             	call   *%r8
+  800c9c:	e9 53 fe ff ff       	jmp    800af4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ca1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cad:	eb a4                	jmp    800c53 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800caf:	48 ba ac 61 80 00 00 	movabs $0x8061ac,%rdx
+  800cb6:	00 00 00 
+  800cb9:	4c 89 ee             	mov    %r13,%rsi
+  800cbc:	4c 89 f7             	mov    %r14,%rdi
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc4:	49 b8 86 0a 80 00 00 	movabs $0x800a86,%r8
+  800ccb:	00 00 00 
+  800cce:	41 ff d0             	call   *%r8
+  800cd1:	e9 1e fe ff ff       	jmp    800af4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cd6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdc:	77 6c                	ja     800d4a <vprintfmt+0x287>
+  800cde:	89 c2                	mov    %eax,%edx
+  800ce0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce4:	83 c0 08             	add    $0x8,%eax
+  800ce7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cea:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800ced:	48 85 d2             	test   %rdx,%rdx
+  800cf0:	48 b8 a5 61 80 00 00 	movabs $0x8061a5,%rax
+  800cf7:	00 00 00 
+  800cfa:	48 0f 45 c2          	cmovne %rdx,%rax
+  800cfe:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800d02:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800d06:	7e 06                	jle    800d0e <vprintfmt+0x24b>
+  800d08:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800d0c:	75 4a                	jne    800d58 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d0e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d12:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d16:	0f b6 00             	movzbl (%rax),%eax
+  800d19:	84 c0                	test   %al,%al
+  800d1b:	0f 85 9a 00 00 00    	jne    800dbb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800d21:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d24:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d28:	85 c0                	test   %eax,%eax
+  800d2a:	0f 8e c4 fd ff ff    	jle    800af4 <vprintfmt+0x31>
+  800d30:	4c 89 ee             	mov    %r13,%rsi
+  800d33:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d38:	41 ff d6             	call   *%r14
+  800d3b:	41 83 ec 01          	sub    $0x1,%r12d
+  800d3f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d43:	75 eb                	jne    800d30 <vprintfmt+0x26d>
+  800d45:	e9 aa fd ff ff       	jmp    800af4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d56:	eb 92                	jmp    800cea <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d58:	49 63 f7             	movslq %r15d,%rsi
+  800d5b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d5f:	48 b8 75 12 80 00 00 	movabs $0x801275,%rax
+  800d66:	00 00 00 
+  800d69:	ff d0                	call   *%rax
+  800d6b:	48 89 c2             	mov    %rax,%rdx
+  800d6e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d71:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d73:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d76:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7e 91                	jle    800d0e <vprintfmt+0x24b>
+  800d7d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d82:	4c 89 ee             	mov    %r13,%rsi
+  800d85:	44 89 e7             	mov    %r12d,%edi
+  800d88:	41 ff d6             	call   *%r14
+  800d8b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d8f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d92:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d95:	75 eb                	jne    800d82 <vprintfmt+0x2bf>
+  800d97:	e9 72 ff ff ff       	jmp    800d0e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d9c:	0f b6 f8             	movzbl %al,%edi
+  800d9f:	4c 89 ee             	mov    %r13,%rsi
+  800da2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800da5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800da9:	49 83 c4 01          	add    $0x1,%r12
+  800dad:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800db3:	84 c0                	test   %al,%al
+  800db5:	0f 84 66 ff ff ff    	je     800d21 <vprintfmt+0x25e>
+  800dbb:	45 85 ff             	test   %r15d,%r15d
+  800dbe:	78 0a                	js     800dca <vprintfmt+0x307>
+  800dc0:	41 83 ef 01          	sub    $0x1,%r15d
+  800dc4:	0f 88 57 ff ff ff    	js     800d21 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800dca:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800dce:	74 cc                	je     800d9c <vprintfmt+0x2d9>
+  800dd0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800dd3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800dd8:	80 fa 5e             	cmp    $0x5e,%dl
+  800ddb:	77 c2                	ja     800d9f <vprintfmt+0x2dc>
+  800ddd:	eb bd                	jmp    800d9c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800ddf:	40 84 f6             	test   %sil,%sil
+  800de2:	75 26                	jne    800e0a <vprintfmt+0x347>
+    switch (lflag) {
+  800de4:	85 d2                	test   %edx,%edx
+  800de6:	74 59                	je     800e41 <vprintfmt+0x37e>
+  800de8:	83 fa 01             	cmp    $0x1,%edx
+  800deb:	74 7b                	je     800e68 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ded:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df0:	83 f8 2f             	cmp    $0x2f,%eax
+  800df3:	0f 87 96 00 00 00    	ja     800e8f <vprintfmt+0x3cc>
+  800df9:	89 c2                	mov    %eax,%edx
+  800dfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dff:	83 c0 08             	add    $0x8,%eax
+  800e02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e05:	4c 8b 22             	mov    (%rdx),%r12
+  800e08:	eb 17                	jmp    800e21 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800e0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e10:	77 21                	ja     800e33 <vprintfmt+0x370>
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e18:	83 c0 08             	add    $0x8,%eax
+  800e1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800e21:	4d 85 e4             	test   %r12,%r12
+  800e24:	78 7a                	js     800ea0 <vprintfmt+0x3dd>
+            num = i;
+  800e26:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800e29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800e2e:	e9 50 02 00 00       	jmp    801083 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3f:	eb dd                	jmp    800e1e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800e41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e44:	83 f8 2f             	cmp    $0x2f,%eax
+  800e47:	77 11                	ja     800e5a <vprintfmt+0x397>
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4f:	83 c0 08             	add    $0x8,%eax
+  800e52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e55:	4c 63 22             	movslq (%rdx),%r12
+  800e58:	eb c7                	jmp    800e21 <vprintfmt+0x35e>
+  800e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e66:	eb ed                	jmp    800e55 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6e:	77 11                	ja     800e81 <vprintfmt+0x3be>
+  800e70:	89 c2                	mov    %eax,%edx
+  800e72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e76:	83 c0 08             	add    $0x8,%eax
+  800e79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7c:	4c 8b 22             	mov    (%rdx),%r12
+  800e7f:	eb a0                	jmp    800e21 <vprintfmt+0x35e>
+  800e81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e8d:	eb ed                	jmp    800e7c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9b:	e9 65 ff ff ff       	jmp    800e05 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ea0:	4c 89 ee             	mov    %r13,%rsi
+  800ea3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ea8:	41 ff d6             	call   *%r14
+                i = -i;
+  800eab:	49 f7 dc             	neg    %r12
+  800eae:	e9 73 ff ff ff       	jmp    800e26 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800eb3:	40 84 f6             	test   %sil,%sil
+  800eb6:	75 32                	jne    800eea <vprintfmt+0x427>
+    switch (lflag) {
+  800eb8:	85 d2                	test   %edx,%edx
+  800eba:	74 5d                	je     800f19 <vprintfmt+0x456>
+  800ebc:	83 fa 01             	cmp    $0x1,%edx
+  800ebf:	0f 84 82 00 00 00    	je     800f47 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ec5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ecb:	0f 87 a5 00 00 00    	ja     800f76 <vprintfmt+0x4b3>
+  800ed1:	89 c2                	mov    %eax,%edx
+  800ed3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed7:	83 c0 08             	add    $0x8,%eax
+  800eda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ee0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ee5:	e9 99 01 00 00       	jmp    801083 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800eea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eed:	83 f8 2f             	cmp    $0x2f,%eax
+  800ef0:	77 19                	ja     800f0b <vprintfmt+0x448>
+  800ef2:	89 c2                	mov    %eax,%edx
+  800ef4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef8:	83 c0 08             	add    $0x8,%eax
+  800efb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800efe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f01:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f06:	e9 78 01 00 00       	jmp    801083 <vprintfmt+0x5c0>
+  800f0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f17:	eb e5                	jmp    800efe <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800f19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f1f:	77 18                	ja     800f39 <vprintfmt+0x476>
+  800f21:	89 c2                	mov    %eax,%edx
+  800f23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f27:	83 c0 08             	add    $0x8,%eax
+  800f2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f2d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800f2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800f34:	e9 4a 01 00 00       	jmp    801083 <vprintfmt+0x5c0>
+  800f39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f45:	eb e6                	jmp    800f2d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800f47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4d:	77 19                	ja     800f68 <vprintfmt+0x4a5>
+  800f4f:	89 c2                	mov    %eax,%edx
+  800f51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f55:	83 c0 08             	add    $0x8,%eax
+  800f58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f63:	e9 1b 01 00 00       	jmp    801083 <vprintfmt+0x5c0>
+  800f68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f74:	eb e5                	jmp    800f5b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f82:	e9 56 ff ff ff       	jmp    800edd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f87:	40 84 f6             	test   %sil,%sil
+  800f8a:	75 2e                	jne    800fba <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f8c:	85 d2                	test   %edx,%edx
+  800f8e:	74 59                	je     800fe9 <vprintfmt+0x526>
+  800f90:	83 fa 01             	cmp    $0x1,%edx
+  800f93:	74 7f                	je     801014 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f98:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9b:	0f 87 9f 00 00 00    	ja     801040 <vprintfmt+0x57d>
+  800fa1:	89 c2                	mov    %eax,%edx
+  800fa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa7:	83 c0 08             	add    $0x8,%eax
+  800faa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fb0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800fb5:	e9 c9 00 00 00       	jmp    801083 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800fba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800fc0:	77 19                	ja     800fdb <vprintfmt+0x518>
+  800fc2:	89 c2                	mov    %eax,%edx
+  800fc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fc8:	83 c0 08             	add    $0x8,%eax
+  800fcb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fd1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800fd6:	e9 a8 00 00 00       	jmp    801083 <vprintfmt+0x5c0>
+  800fdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe7:	eb e5                	jmp    800fce <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800fe9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fec:	83 f8 2f             	cmp    $0x2f,%eax
+  800fef:	77 15                	ja     801006 <vprintfmt+0x543>
+  800ff1:	89 c2                	mov    %eax,%edx
+  800ff3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ff7:	83 c0 08             	add    $0x8,%eax
+  800ffa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ffd:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800fff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801004:	eb 7d                	jmp    801083 <vprintfmt+0x5c0>
+  801006:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80100a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80100e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801012:	eb e9                	jmp    800ffd <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801014:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801017:	83 f8 2f             	cmp    $0x2f,%eax
+  80101a:	77 16                	ja     801032 <vprintfmt+0x56f>
+  80101c:	89 c2                	mov    %eax,%edx
+  80101e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801022:	83 c0 08             	add    $0x8,%eax
+  801025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801028:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80102b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801030:	eb 51                	jmp    801083 <vprintfmt+0x5c0>
+  801032:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801036:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80103e:	eb e8                	jmp    801028 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801040:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801044:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801048:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80104c:	e9 5c ff ff ff       	jmp    800fad <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801051:	4c 89 ee             	mov    %r13,%rsi
+  801054:	bf 30 00 00 00       	mov    $0x30,%edi
+  801059:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80105c:	4c 89 ee             	mov    %r13,%rsi
+  80105f:	bf 78 00 00 00       	mov    $0x78,%edi
+  801064:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801067:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80106a:	83 f8 2f             	cmp    $0x2f,%eax
+  80106d:	77 47                	ja     8010b6 <vprintfmt+0x5f3>
+  80106f:	89 c2                	mov    %eax,%edx
+  801071:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801075:	83 c0 08             	add    $0x8,%eax
+  801078:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80107b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80107e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801083:	48 83 ec 08          	sub    $0x8,%rsp
+  801087:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80108b:	0f 94 c0             	sete   %al
+  80108e:	0f b6 c0             	movzbl %al,%eax
+  801091:	50                   	push   %rax
+  801092:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801097:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80109b:	4c 89 ee             	mov    %r13,%rsi
+  80109e:	4c 89 f7             	mov    %r14,%rdi
+  8010a1:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  8010a8:	00 00 00 
+  8010ab:	ff d0                	call   *%rax
+            break;
+  8010ad:	48 83 c4 10          	add    $0x10,%rsp
+  8010b1:	e9 3e fa ff ff       	jmp    800af4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8010b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010c2:	eb b7                	jmp    80107b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8010c4:	40 84 f6             	test   %sil,%sil
+  8010c7:	75 2b                	jne    8010f4 <vprintfmt+0x631>
+    switch (lflag) {
+  8010c9:	85 d2                	test   %edx,%edx
+  8010cb:	74 56                	je     801123 <vprintfmt+0x660>
+  8010cd:	83 fa 01             	cmp    $0x1,%edx
+  8010d0:	74 7f                	je     801151 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8010d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d8:	0f 87 a2 00 00 00    	ja     801180 <vprintfmt+0x6bd>
+  8010de:	89 c2                	mov    %eax,%edx
+  8010e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e4:	83 c0 08             	add    $0x8,%eax
+  8010e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010ea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010f2:	eb 8f                	jmp    801083 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8010fa:	77 19                	ja     801115 <vprintfmt+0x652>
+  8010fc:	89 c2                	mov    %eax,%edx
+  8010fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801102:	83 c0 08             	add    $0x8,%eax
+  801105:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801108:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80110b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801110:	e9 6e ff ff ff       	jmp    801083 <vprintfmt+0x5c0>
+  801115:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801119:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80111d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801121:	eb e5                	jmp    801108 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801123:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801126:	83 f8 2f             	cmp    $0x2f,%eax
+  801129:	77 18                	ja     801143 <vprintfmt+0x680>
+  80112b:	89 c2                	mov    %eax,%edx
+  80112d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801131:	83 c0 08             	add    $0x8,%eax
+  801134:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801137:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801139:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80113e:	e9 40 ff ff ff       	jmp    801083 <vprintfmt+0x5c0>
+  801143:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801147:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80114b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80114f:	eb e6                	jmp    801137 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801151:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801154:	83 f8 2f             	cmp    $0x2f,%eax
+  801157:	77 19                	ja     801172 <vprintfmt+0x6af>
+  801159:	89 c2                	mov    %eax,%edx
+  80115b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80115f:	83 c0 08             	add    $0x8,%eax
+  801162:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801165:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801168:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80116d:	e9 11 ff ff ff       	jmp    801083 <vprintfmt+0x5c0>
+  801172:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801176:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80117a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80117e:	eb e5                	jmp    801165 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801180:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801184:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801188:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80118c:	e9 59 ff ff ff       	jmp    8010ea <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801191:	4c 89 ee             	mov    %r13,%rsi
+  801194:	bf 25 00 00 00       	mov    $0x25,%edi
+  801199:	41 ff d6             	call   *%r14
+            break;
+  80119c:	e9 53 f9 ff ff       	jmp    800af4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8011a1:	4c 89 ee             	mov    %r13,%rsi
+  8011a4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011a9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8011ac:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8011b4:	75 f6                	jne    8011ac <vprintfmt+0x6e9>
+  8011b6:	e9 39 f9 ff ff       	jmp    800af4 <vprintfmt+0x31>
+}
+  8011bb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011bf:	5b                   	pop    %rbx
+  8011c0:	41 5c                	pop    %r12
+  8011c2:	41 5d                	pop    %r13
+  8011c4:	41 5e                	pop    %r14
+  8011c6:	41 5f                	pop    %r15
+  8011c8:	5d                   	pop    %rbp
+  8011c9:	c3                   	ret
+
+00000000008011ca <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8011ca:	55                   	push   %rbp
+  8011cb:	48 89 e5             	mov    %rsp,%rbp
+  8011ce:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8011d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011d6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8011db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8011df:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8011e6:	48 85 ff             	test   %rdi,%rdi
+  8011e9:	74 2b                	je     801216 <vsnprintf+0x4c>
+  8011eb:	48 85 f6             	test   %rsi,%rsi
+  8011ee:	74 26                	je     801216 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011f0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011f4:	48 bf 6e 0a 80 00 00 	movabs $0x800a6e,%rdi
+  8011fb:	00 00 00 
+  8011fe:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  801205:	00 00 00 
+  801208:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80120a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801211:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121b:	eb f7                	jmp    801214 <vsnprintf+0x4a>
+
+000000000080121d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	48 83 ec 50          	sub    $0x50,%rsp
+  801225:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801229:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80122d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801231:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801238:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80123c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801240:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801244:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801248:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80124c:	48 b8 ca 11 80 00 00 	movabs $0x8011ca,%rax
+  801253:	00 00 00 
+  801256:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+
+000000000080125a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80125a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80125d:	74 10                	je     80126f <strlen+0x15>
+    size_t n = 0;
+  80125f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801264:	48 83 c0 01          	add    $0x1,%rax
+  801268:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80126c:	75 f6                	jne    801264 <strlen+0xa>
+  80126e:	c3                   	ret
+    size_t n = 0;
+  80126f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801274:	c3                   	ret
+
+0000000000801275 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801275:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801278:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80127d:	48 85 f6             	test   %rsi,%rsi
+  801280:	74 11                	je     801293 <strnlen+0x1e>
+  801282:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801286:	74 0c                	je     801294 <strnlen+0x1f>
+  801288:	48 83 c2 01          	add    $0x1,%rdx
+  80128c:	48 39 d0             	cmp    %rdx,%rax
+  80128f:	75 f1                	jne    801282 <strnlen+0xd>
+  801291:	eb 04                	jmp    801297 <strnlen+0x22>
+  801293:	c3                   	ret
+  801294:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801297:	c3                   	ret
+
+0000000000801298 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801298:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80129b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8012a4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8012a7:	48 83 c2 01          	add    $0x1,%rdx
+  8012ab:	84 c9                	test   %cl,%cl
+  8012ad:	75 f1                	jne    8012a0 <strcpy+0x8>
+        ;
+    return res;
+}
+  8012af:	c3                   	ret
+
+00000000008012b0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	41 54                	push   %r12
+  8012b6:	53                   	push   %rbx
+  8012b7:	48 89 fb             	mov    %rdi,%rbx
+  8012ba:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8012bd:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  8012c4:	00 00 00 
+  8012c7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8012c9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8012cd:	4c 89 e6             	mov    %r12,%rsi
+  8012d0:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  8012d7:	00 00 00 
+  8012da:	ff d0                	call   *%rax
+    return dst;
+}
+  8012dc:	48 89 d8             	mov    %rbx,%rax
+  8012df:	5b                   	pop    %rbx
+  8012e0:	41 5c                	pop    %r12
+  8012e2:	5d                   	pop    %rbp
+  8012e3:	c3                   	ret
+
+00000000008012e4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8012e4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8012e7:	48 85 d2             	test   %rdx,%rdx
+  8012ea:	74 1f                	je     80130b <strncpy+0x27>
+  8012ec:	48 01 fa             	add    %rdi,%rdx
+  8012ef:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012f2:	48 83 c1 01          	add    $0x1,%rcx
+  8012f6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012fa:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012fe:	41 80 f8 01          	cmp    $0x1,%r8b
+  801302:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801306:	48 39 ca             	cmp    %rcx,%rdx
+  801309:	75 e7                	jne    8012f2 <strncpy+0xe>
+    }
+    return ret;
+}
+  80130b:	c3                   	ret
+
+000000000080130c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80130c:	48 89 f8             	mov    %rdi,%rax
+  80130f:	48 85 d2             	test   %rdx,%rdx
+  801312:	74 24                	je     801338 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801314:	48 83 ea 01          	sub    $0x1,%rdx
+  801318:	74 1b                	je     801335 <strlcpy+0x29>
+  80131a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80131e:	0f b6 16             	movzbl (%rsi),%edx
+  801321:	84 d2                	test   %dl,%dl
+  801323:	74 10                	je     801335 <strlcpy+0x29>
+            *dst++ = *src++;
+  801325:	48 83 c6 01          	add    $0x1,%rsi
+  801329:	48 83 c0 01          	add    $0x1,%rax
+  80132d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801330:	48 39 c8             	cmp    %rcx,%rax
+  801333:	75 e9                	jne    80131e <strlcpy+0x12>
+        *dst = '\0';
+  801335:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801338:	48 29 f8             	sub    %rdi,%rax
+}
+  80133b:	c3                   	ret
+
+000000000080133c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80133c:	0f b6 07             	movzbl (%rdi),%eax
+  80133f:	84 c0                	test   %al,%al
+  801341:	74 13                	je     801356 <strcmp+0x1a>
+  801343:	38 06                	cmp    %al,(%rsi)
+  801345:	75 0f                	jne    801356 <strcmp+0x1a>
+  801347:	48 83 c7 01          	add    $0x1,%rdi
+  80134b:	48 83 c6 01          	add    $0x1,%rsi
+  80134f:	0f b6 07             	movzbl (%rdi),%eax
+  801352:	84 c0                	test   %al,%al
+  801354:	75 ed                	jne    801343 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801356:	0f b6 c0             	movzbl %al,%eax
+  801359:	0f b6 16             	movzbl (%rsi),%edx
+  80135c:	29 d0                	sub    %edx,%eax
+}
+  80135e:	c3                   	ret
+
+000000000080135f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80135f:	48 85 d2             	test   %rdx,%rdx
+  801362:	74 1f                	je     801383 <strncmp+0x24>
+  801364:	0f b6 07             	movzbl (%rdi),%eax
+  801367:	84 c0                	test   %al,%al
+  801369:	74 1e                	je     801389 <strncmp+0x2a>
+  80136b:	3a 06                	cmp    (%rsi),%al
+  80136d:	75 1a                	jne    801389 <strncmp+0x2a>
+  80136f:	48 83 c7 01          	add    $0x1,%rdi
+  801373:	48 83 c6 01          	add    $0x1,%rsi
+  801377:	48 83 ea 01          	sub    $0x1,%rdx
+  80137b:	75 e7                	jne    801364 <strncmp+0x5>
+
+    if (!n) return 0;
+  80137d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801382:	c3                   	ret
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+  801388:	c3                   	ret
+  801389:	48 85 d2             	test   %rdx,%rdx
+  80138c:	74 09                	je     801397 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80138e:	0f b6 07             	movzbl (%rdi),%eax
+  801391:	0f b6 16             	movzbl (%rsi),%edx
+  801394:	29 d0                	sub    %edx,%eax
+  801396:	c3                   	ret
+    if (!n) return 0;
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80139c:	c3                   	ret
+
+000000000080139d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80139d:	0f b6 17             	movzbl (%rdi),%edx
+  8013a0:	84 d2                	test   %dl,%dl
+  8013a2:	74 18                	je     8013bc <strchr+0x1f>
+        if (*str == c) {
+  8013a4:	0f be d2             	movsbl %dl,%edx
+  8013a7:	39 f2                	cmp    %esi,%edx
+  8013a9:	74 17                	je     8013c2 <strchr+0x25>
+    for (; *str; str++) {
+  8013ab:	48 83 c7 01          	add    $0x1,%rdi
+  8013af:	0f b6 17             	movzbl (%rdi),%edx
+  8013b2:	84 d2                	test   %dl,%dl
+  8013b4:	75 ee                	jne    8013a4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8013b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bb:	c3                   	ret
+  8013bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c1:	c3                   	ret
+  8013c2:	48 89 f8             	mov    %rdi,%rax
+}
+  8013c5:	c3                   	ret
+
+00000000008013c6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8013c6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8013c9:	0f b6 17             	movzbl (%rdi),%edx
+  8013cc:	84 d2                	test   %dl,%dl
+  8013ce:	74 13                	je     8013e3 <strfind+0x1d>
+  8013d0:	0f be d2             	movsbl %dl,%edx
+  8013d3:	39 f2                	cmp    %esi,%edx
+  8013d5:	74 0b                	je     8013e2 <strfind+0x1c>
+  8013d7:	48 83 c0 01          	add    $0x1,%rax
+  8013db:	0f b6 10             	movzbl (%rax),%edx
+  8013de:	84 d2                	test   %dl,%dl
+  8013e0:	75 ee                	jne    8013d0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8013e2:	c3                   	ret
+  8013e3:	c3                   	ret
+
+00000000008013e4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8013e4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8013e7:	48 89 f8             	mov    %rdi,%rax
+  8013ea:	48 f7 d8             	neg    %rax
+  8013ed:	83 e0 07             	and    $0x7,%eax
+  8013f0:	49 89 d1             	mov    %rdx,%r9
+  8013f3:	49 29 c1             	sub    %rax,%r9
+  8013f6:	78 36                	js     80142e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013f8:	40 0f b6 c6          	movzbl %sil,%eax
+  8013fc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801403:	01 01 01 
+  801406:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80140a:	40 f6 c7 07          	test   $0x7,%dil
+  80140e:	75 38                	jne    801448 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801410:	4c 89 c9             	mov    %r9,%rcx
+  801413:	48 c1 f9 03          	sar    $0x3,%rcx
+  801417:	74 0c                	je     801425 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801419:	fc                   	cld
+  80141a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80141d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801421:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801425:	4d 85 c9             	test   %r9,%r9
+  801428:	75 45                	jne    80146f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80142a:	4c 89 c0             	mov    %r8,%rax
+  80142d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80142e:	48 85 d2             	test   %rdx,%rdx
+  801431:	74 f7                	je     80142a <memset+0x46>
+  801433:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801436:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801439:	48 83 c0 01          	add    $0x1,%rax
+  80143d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801441:	48 39 c2             	cmp    %rax,%rdx
+  801444:	75 f3                	jne    801439 <memset+0x55>
+  801446:	eb e2                	jmp    80142a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801448:	40 f6 c7 01          	test   $0x1,%dil
+  80144c:	74 06                	je     801454 <memset+0x70>
+  80144e:	88 07                	mov    %al,(%rdi)
+  801450:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801454:	40 f6 c7 02          	test   $0x2,%dil
+  801458:	74 07                	je     801461 <memset+0x7d>
+  80145a:	66 89 07             	mov    %ax,(%rdi)
+  80145d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801461:	40 f6 c7 04          	test   $0x4,%dil
+  801465:	74 a9                	je     801410 <memset+0x2c>
+  801467:	89 07                	mov    %eax,(%rdi)
+  801469:	48 83 c7 04          	add    $0x4,%rdi
+  80146d:	eb a1                	jmp    801410 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80146f:	41 f6 c1 04          	test   $0x4,%r9b
+  801473:	74 06                	je     80147b <memset+0x97>
+  801475:	89 07                	mov    %eax,(%rdi)
+  801477:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80147b:	41 f6 c1 02          	test   $0x2,%r9b
+  80147f:	74 07                	je     801488 <memset+0xa4>
+  801481:	66 89 07             	mov    %ax,(%rdi)
+  801484:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801488:	41 f6 c1 01          	test   $0x1,%r9b
+  80148c:	74 9c                	je     80142a <memset+0x46>
+  80148e:	88 07                	mov    %al,(%rdi)
+  801490:	eb 98                	jmp    80142a <memset+0x46>
+
+0000000000801492 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801492:	48 89 f8             	mov    %rdi,%rax
+  801495:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801498:	48 39 fe             	cmp    %rdi,%rsi
+  80149b:	73 3b                	jae    8014d8 <memmove+0x46>
+  80149d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8014a1:	48 39 d7             	cmp    %rdx,%rdi
+  8014a4:	73 32                	jae    8014d8 <memmove+0x46>
+        s += n;
+        d += n;
+  8014a6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014aa:	48 89 d6             	mov    %rdx,%rsi
+  8014ad:	48 09 fe             	or     %rdi,%rsi
+  8014b0:	48 09 ce             	or     %rcx,%rsi
+  8014b3:	40 f6 c6 07          	test   $0x7,%sil
+  8014b7:	75 12                	jne    8014cb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8014b9:	48 83 ef 08          	sub    $0x8,%rdi
+  8014bd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8014c1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014c5:	fd                   	std
+  8014c6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8014c9:	fc                   	cld
+  8014ca:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8014cb:	48 83 ef 01          	sub    $0x1,%rdi
+  8014cf:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8014d3:	fd                   	std
+  8014d4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014d6:	eb f1                	jmp    8014c9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014d8:	48 89 f2             	mov    %rsi,%rdx
+  8014db:	48 09 c2             	or     %rax,%rdx
+  8014de:	48 09 ca             	or     %rcx,%rdx
+  8014e1:	f6 c2 07             	test   $0x7,%dl
+  8014e4:	75 0c                	jne    8014f2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8014e6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014ea:	48 89 c7             	mov    %rax,%rdi
+  8014ed:	fc                   	cld
+  8014ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014f1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014f2:	48 89 c7             	mov    %rax,%rdi
+  8014f5:	fc                   	cld
+  8014f6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014f8:	c3                   	ret
+
+00000000008014f9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014f9:	55                   	push   %rbp
+  8014fa:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014fd:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  801504:	00 00 00 
+  801507:	ff d0                	call   *%rax
+}
+  801509:	5d                   	pop    %rbp
+  80150a:	c3                   	ret
+
+000000000080150b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	41 57                	push   %r15
+  801511:	41 56                	push   %r14
+  801513:	41 55                	push   %r13
+  801515:	41 54                	push   %r12
+  801517:	53                   	push   %rbx
+  801518:	48 83 ec 08          	sub    $0x8,%rsp
+  80151c:	49 89 fe             	mov    %rdi,%r14
+  80151f:	49 89 f7             	mov    %rsi,%r15
+  801522:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801525:	48 89 f7             	mov    %rsi,%rdi
+  801528:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  80152f:	00 00 00 
+  801532:	ff d0                	call   *%rax
+  801534:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801537:	48 89 de             	mov    %rbx,%rsi
+  80153a:	4c 89 f7             	mov    %r14,%rdi
+  80153d:	48 b8 75 12 80 00 00 	movabs $0x801275,%rax
+  801544:	00 00 00 
+  801547:	ff d0                	call   *%rax
+  801549:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80154c:	48 39 c3             	cmp    %rax,%rbx
+  80154f:	74 36                	je     801587 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801551:	48 89 d8             	mov    %rbx,%rax
+  801554:	4c 29 e8             	sub    %r13,%rax
+  801557:	49 39 c4             	cmp    %rax,%r12
+  80155a:	73 31                	jae    80158d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80155c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801561:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801565:	4c 89 fe             	mov    %r15,%rsi
+  801568:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  80156f:	00 00 00 
+  801572:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801574:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801578:	48 83 c4 08          	add    $0x8,%rsp
+  80157c:	5b                   	pop    %rbx
+  80157d:	41 5c                	pop    %r12
+  80157f:	41 5d                	pop    %r13
+  801581:	41 5e                	pop    %r14
+  801583:	41 5f                	pop    %r15
+  801585:	5d                   	pop    %rbp
+  801586:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801587:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80158b:	eb eb                	jmp    801578 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80158d:	48 83 eb 01          	sub    $0x1,%rbx
+  801591:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801595:	48 89 da             	mov    %rbx,%rdx
+  801598:	4c 89 fe             	mov    %r15,%rsi
+  80159b:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  8015a2:	00 00 00 
+  8015a5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8015a7:	49 01 de             	add    %rbx,%r14
+  8015aa:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8015af:	eb c3                	jmp    801574 <strlcat+0x69>
+
+00000000008015b1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8015b1:	48 85 d2             	test   %rdx,%rdx
+  8015b4:	74 2d                	je     8015e3 <memcmp+0x32>
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8015bb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8015bf:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8015c4:	44 38 c1             	cmp    %r8b,%cl
+  8015c7:	75 0f                	jne    8015d8 <memcmp+0x27>
+    while (n-- > 0) {
+  8015c9:	48 83 c0 01          	add    $0x1,%rax
+  8015cd:	48 39 c2             	cmp    %rax,%rdx
+  8015d0:	75 e9                	jne    8015bb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8015d8:	0f b6 c1             	movzbl %cl,%eax
+  8015db:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8015df:	44 29 c0             	sub    %r8d,%eax
+  8015e2:	c3                   	ret
+    return 0;
+  8015e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e8:	c3                   	ret
+
+00000000008015e9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8015e9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8015ed:	48 39 c7             	cmp    %rax,%rdi
+  8015f0:	73 0f                	jae    801601 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015f2:	40 38 37             	cmp    %sil,(%rdi)
+  8015f5:	74 0e                	je     801605 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015f7:	48 83 c7 01          	add    $0x1,%rdi
+  8015fb:	48 39 f8             	cmp    %rdi,%rax
+  8015fe:	75 f2                	jne    8015f2 <memfind+0x9>
+  801600:	c3                   	ret
+  801601:	48 89 f8             	mov    %rdi,%rax
+  801604:	c3                   	ret
+  801605:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801608:	c3                   	ret
+
+0000000000801609 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801609:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80160c:	0f b6 37             	movzbl (%rdi),%esi
+  80160f:	40 80 fe 20          	cmp    $0x20,%sil
+  801613:	74 06                	je     80161b <strtol+0x12>
+  801615:	40 80 fe 09          	cmp    $0x9,%sil
+  801619:	75 13                	jne    80162e <strtol+0x25>
+  80161b:	48 83 c7 01          	add    $0x1,%rdi
+  80161f:	0f b6 37             	movzbl (%rdi),%esi
+  801622:	40 80 fe 20          	cmp    $0x20,%sil
+  801626:	74 f3                	je     80161b <strtol+0x12>
+  801628:	40 80 fe 09          	cmp    $0x9,%sil
+  80162c:	74 ed                	je     80161b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80162e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801631:	83 e0 fd             	and    $0xfffffffd,%eax
+  801634:	3c 01                	cmp    $0x1,%al
+  801636:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80163a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801640:	75 0f                	jne    801651 <strtol+0x48>
+  801642:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801645:	74 14                	je     80165b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801647:	85 d2                	test   %edx,%edx
+  801649:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80164e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801656:	4c 63 ca             	movslq %edx,%r9
+  801659:	eb 36                	jmp    801691 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80165b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80165f:	74 0f                	je     801670 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801661:	85 d2                	test   %edx,%edx
+  801663:	75 ec                	jne    801651 <strtol+0x48>
+        s++;
+  801665:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801669:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80166e:	eb e1                	jmp    801651 <strtol+0x48>
+        s += 2;
+  801670:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801674:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801679:	eb d6                	jmp    801651 <strtol+0x48>
+            dig -= '0';
+  80167b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80167e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801682:	41 39 d0             	cmp    %edx,%r8d
+  801685:	7d 21                	jge    8016a8 <strtol+0x9f>
+        val = val * base + dig;
+  801687:	49 0f af c1          	imul   %r9,%rax
+  80168b:	0f b6 c9             	movzbl %cl,%ecx
+  80168e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801691:	48 83 c7 01          	add    $0x1,%rdi
+  801695:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801699:	80 f9 39             	cmp    $0x39,%cl
+  80169c:	76 dd                	jbe    80167b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80169e:	80 f9 7b             	cmp    $0x7b,%cl
+  8016a1:	77 05                	ja     8016a8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8016a3:	83 e9 57             	sub    $0x57,%ecx
+  8016a6:	eb d6                	jmp    80167e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8016a8:	4d 85 d2             	test   %r10,%r10
+  8016ab:	74 03                	je     8016b0 <strtol+0xa7>
+  8016ad:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8016b0:	48 89 c2             	mov    %rax,%rdx
+  8016b3:	48 f7 da             	neg    %rdx
+  8016b6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8016ba:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8016be:	c3                   	ret
+
+00000000008016bf <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+  8016c3:	53                   	push   %rbx
+  8016c4:	48 89 fa             	mov    %rdi,%rdx
+  8016c7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ca:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8016e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+
+00000000008016ec <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+  8016f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801705:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170a:	be 00 00 00 00       	mov    $0x0,%esi
+  80170f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801715:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801717:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+000000000080171d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+  801721:	53                   	push   %rbx
+  801722:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801726:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801729:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80172e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801733:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801738:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173d:	be 00 00 00 00       	mov    $0x0,%esi
+  801742:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801748:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174a:	48 85 c0             	test   %rax,%rax
+  80174d:	7f 06                	jg     801755 <sys_env_destroy+0x38>
+}
+  80174f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801753:	c9                   	leave
+  801754:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801755:	49 89 c0             	mov    %rax,%r8
+  801758:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80175d:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801764:	00 00 00 
+  801767:	be 26 00 00 00       	mov    $0x26,%esi
+  80176c:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801773:	00 00 00 
+  801776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177b:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801782:	00 00 00 
+  801785:	41 ff d1             	call   *%r9
+
+0000000000801788 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801788:	55                   	push   %rbp
+  801789:	48 89 e5             	mov    %rsp,%rbp
+  80178c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80178d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801792:	ba 00 00 00 00       	mov    $0x0,%edx
+  801797:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+
+00000000008017b9 <sys_yield>:
+
+void
+sys_yield(void) {
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017be:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e2:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e8:	c9                   	leave
+  8017e9:	c3                   	ret
+
+00000000008017ea <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8017ea:	55                   	push   %rbp
+  8017eb:	48 89 e5             	mov    %rsp,%rbp
+  8017ee:	53                   	push   %rbx
+  8017ef:	48 89 fa             	mov    %rdi,%rdx
+  8017f2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f5:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fa:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801801:	00 00 00 
+  801804:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801809:	be 00 00 00 00       	mov    $0x0,%esi
+  80180e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801814:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801816:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181a:	c9                   	leave
+  80181b:	c3                   	ret
+
+000000000080181c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	53                   	push   %rbx
+  801821:	49 89 f8             	mov    %rdi,%r8
+  801824:	48 89 d3             	mov    %rdx,%rbx
+  801827:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80182a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80182f:	4c 89 c2             	mov    %r8,%rdx
+  801832:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801835:	be 00 00 00 00       	mov    $0x0,%esi
+  80183a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801840:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801842:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801846:	c9                   	leave
+  801847:	c3                   	ret
+
+0000000000801848 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	53                   	push   %rbx
+  80184d:	48 83 ec 08          	sub    $0x8,%rsp
+  801851:	89 f8                	mov    %edi,%eax
+  801853:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801856:	48 63 f9             	movslq %ecx,%rdi
+  801859:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80185c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801861:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801864:	be 00 00 00 00       	mov    $0x0,%esi
+  801869:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801871:	48 85 c0             	test   %rax,%rax
+  801874:	7f 06                	jg     80187c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801876:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187c:	49 89 c0             	mov    %rax,%r8
+  80187f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801884:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  80188b:	00 00 00 
+  80188e:	be 26 00 00 00       	mov    $0x26,%esi
+  801893:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  80189a:	00 00 00 
+  80189d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a2:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  8018a9:	00 00 00 
+  8018ac:	41 ff d1             	call   *%r9
+
+00000000008018af <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8018af:	55                   	push   %rbp
+  8018b0:	48 89 e5             	mov    %rsp,%rbp
+  8018b3:	53                   	push   %rbx
+  8018b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8018b8:	89 f8                	mov    %edi,%eax
+  8018ba:	49 89 f2             	mov    %rsi,%r10
+  8018bd:	48 89 cf             	mov    %rcx,%rdi
+  8018c0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8018c3:	48 63 da             	movslq %edx,%rbx
+  8018c6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018ce:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d1:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8018d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018d6:	48 85 c0             	test   %rax,%rax
+  8018d9:	7f 06                	jg     8018e1 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8018db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018df:	c9                   	leave
+  8018e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e1:	49 89 c0             	mov    %rax,%r8
+  8018e4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018e9:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  8018f0:	00 00 00 
+  8018f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f8:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  8018ff:	00 00 00 
+  801902:	b8 00 00 00 00       	mov    $0x0,%eax
+  801907:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  80190e:	00 00 00 
+  801911:	41 ff d1             	call   *%r9
+
+0000000000801914 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	53                   	push   %rbx
+  801919:	48 83 ec 08          	sub    $0x8,%rsp
+  80191d:	49 89 f9             	mov    %rdi,%r9
+  801920:	89 f0                	mov    %esi,%eax
+  801922:	48 89 d3             	mov    %rdx,%rbx
+  801925:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801928:	49 63 f0             	movslq %r8d,%rsi
+  80192b:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80192e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801933:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801936:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193e:	48 85 c0             	test   %rax,%rax
+  801941:	7f 06                	jg     801949 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801943:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801949:	49 89 c0             	mov    %rax,%r8
+  80194c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801951:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801958:	00 00 00 
+  80195b:	be 26 00 00 00       	mov    $0x26,%esi
+  801960:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801967:	00 00 00 
+  80196a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196f:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801976:	00 00 00 
+  801979:	41 ff d1             	call   *%r9
+
+000000000080197c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80197c:	55                   	push   %rbp
+  80197d:	48 89 e5             	mov    %rsp,%rbp
+  801980:	53                   	push   %rbx
+  801981:	48 83 ec 08          	sub    $0x8,%rsp
+  801985:	48 89 f1             	mov    %rsi,%rcx
+  801988:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80198b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80198e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801993:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801998:	be 00 00 00 00       	mov    $0x0,%esi
+  80199d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019a5:	48 85 c0             	test   %rax,%rax
+  8019a8:	7f 06                	jg     8019b0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8019aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ae:	c9                   	leave
+  8019af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019b0:	49 89 c0             	mov    %rax,%r8
+  8019b3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8019b8:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  8019bf:	00 00 00 
+  8019c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8019c7:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  8019ce:	00 00 00 
+  8019d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d6:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  8019dd:	00 00 00 
+  8019e0:	41 ff d1             	call   *%r9
+
+00000000008019e3 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8019e3:	55                   	push   %rbp
+  8019e4:	48 89 e5             	mov    %rsp,%rbp
+  8019e7:	53                   	push   %rbx
+  8019e8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801a04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0a:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801a0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a10:	c9                   	leave
+  801a11:	c3                   	ret
+
+0000000000801a12 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801a12:	55                   	push   %rbp
+  801a13:	48 89 e5             	mov    %rsp,%rbp
+  801a16:	53                   	push   %rbx
+  801a17:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801a1e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a21:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a30:	be 00 00 00 00       	mov    $0x0,%esi
+  801a35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a3d:	48 85 c0             	test   %rax,%rax
+  801a40:	7f 06                	jg     801a48 <sys_env_set_tls+0x36>
+}
+  801a42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a46:	c9                   	leave
+  801a47:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a48:	49 89 c0             	mov    %rax,%r8
+  801a4b:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801a50:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801a57:	00 00 00 
+  801a5a:	be 26 00 00 00       	mov    $0x26,%esi
+  801a5f:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801a66:	00 00 00 
+  801a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6e:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801a75:	00 00 00 
+  801a78:	41 ff d1             	call   *%r9
+
+0000000000801a7b <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	53                   	push   %rbx
+  801a80:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801a84:	48 63 ce             	movslq %esi,%rcx
+  801a87:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a99:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aa6:	48 85 c0             	test   %rax,%rax
+  801aa9:	7f 06                	jg     801ab1 <sys_env_set_status+0x36>
+}
+  801aab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aaf:	c9                   	leave
+  801ab0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ab1:	49 89 c0             	mov    %rax,%r8
+  801ab4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801ab9:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801ac0:	00 00 00 
+  801ac3:	be 26 00 00 00       	mov    $0x26,%esi
+  801ac8:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801acf:	00 00 00 
+  801ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad7:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801ade:	00 00 00 
+  801ae1:	41 ff d1             	call   *%r9
+
+0000000000801ae4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801ae4:	55                   	push   %rbp
+  801ae5:	48 89 e5             	mov    %rsp,%rbp
+  801ae8:	53                   	push   %rbx
+  801ae9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801aed:	48 63 da             	movslq %edx,%rbx
+  801af0:	48 63 ce             	movslq %esi,%rcx
+  801af3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801af6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801afb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b00:	be 00 00 00 00       	mov    $0x0,%esi
+  801b05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b0d:	48 85 c0             	test   %rax,%rax
+  801b10:	7f 06                	jg     801b18 <sys_env_set_priority+0x34>
+}
+  801b12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b16:	c9                   	leave
+  801b17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b18:	49 89 c0             	mov    %rax,%r8
+  801b1b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801b20:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801b27:	00 00 00 
+  801b2a:	be 26 00 00 00       	mov    $0x26,%esi
+  801b2f:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801b36:	00 00 00 
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3e:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801b45:	00 00 00 
+  801b48:	41 ff d1             	call   *%r9
+
+0000000000801b4b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801b4b:	55                   	push   %rbp
+  801b4c:	48 89 e5             	mov    %rsp,%rbp
+  801b4f:	53                   	push   %rbx
+  801b50:	48 83 ec 08          	sub    $0x8,%rsp
+  801b54:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801b57:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b5a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b69:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b74:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b76:	48 85 c0             	test   %rax,%rax
+  801b79:	7f 06                	jg     801b81 <sys_env_set_trapframe+0x36>
+}
+  801b7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b81:	49 89 c0             	mov    %rax,%r8
+  801b84:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801b89:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801b90:	00 00 00 
+  801b93:	be 26 00 00 00       	mov    $0x26,%esi
+  801b98:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801b9f:	00 00 00 
+  801ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba7:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801bae:	00 00 00 
+  801bb1:	41 ff d1             	call   *%r9
+
+0000000000801bb4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801bb4:	55                   	push   %rbp
+  801bb5:	48 89 e5             	mov    %rsp,%rbp
+  801bb8:	53                   	push   %rbx
+  801bb9:	48 83 ec 08          	sub    $0x8,%rsp
+  801bbd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801bc0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bc3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd2:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bdd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bdf:	48 85 c0             	test   %rax,%rax
+  801be2:	7f 06                	jg     801bea <sys_env_set_pgfault_upcall+0x36>
+}
+  801be4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bea:	49 89 c0             	mov    %rax,%r8
+  801bed:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801bf2:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801bf9:	00 00 00 
+  801bfc:	be 26 00 00 00       	mov    $0x26,%esi
+  801c01:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801c08:	00 00 00 
+  801c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c10:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801c17:	00 00 00 
+  801c1a:	41 ff d1             	call   *%r9
+
+0000000000801c1d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801c1d:	55                   	push   %rbp
+  801c1e:	48 89 e5             	mov    %rsp,%rbp
+  801c21:	53                   	push   %rbx
+  801c22:	89 f8                	mov    %edi,%eax
+  801c24:	49 89 f1             	mov    %rsi,%r9
+  801c27:	48 89 d3             	mov    %rdx,%rbx
+  801c2a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801c2d:	49 63 f0             	movslq %r8d,%rsi
+  801c30:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c33:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c38:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c41:	cd 30                	int    $0x30
+}
+  801c43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+
+0000000000801c49 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801c49:	55                   	push   %rbp
+  801c4a:	48 89 e5             	mov    %rsp,%rbp
+  801c4d:	41 55                	push   %r13
+  801c4f:	41 54                	push   %r12
+  801c51:	53                   	push   %rbx
+  801c52:	89 f8                	mov    %edi,%eax
+  801c54:	49 89 f2             	mov    %rsi,%r10
+  801c57:	48 89 d3             	mov    %rdx,%rbx
+  801c5a:	48 89 cf             	mov    %rcx,%rdi
+  801c5d:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801c60:	49 63 f0             	movslq %r8d,%rsi
+  801c63:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801c66:	4d 85 c9             	test   %r9,%r9
+  801c69:	48 b8 20 67 80 00 00 	movabs $0x806720,%rax
+  801c70:	00 00 00 
+  801c73:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801c77:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c7c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801c7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801c85:	4d 8b 0b             	mov    (%r11),%r9
+  801c88:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801c8c:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801c90:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801c94:	cd 30                	int    $0x30
+}
+  801c96:	5b                   	pop    %rbx
+  801c97:	41 5c                	pop    %r12
+  801c99:	41 5d                	pop    %r13
+  801c9b:	5d                   	pop    %rbp
+  801c9c:	c3                   	ret
+
+0000000000801c9d <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801c9d:	55                   	push   %rbp
+  801c9e:	48 89 e5             	mov    %rsp,%rbp
+  801ca1:	53                   	push   %rbx
+  801ca2:	48 89 fa             	mov    %rdi,%rdx
+  801ca5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca8:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cb7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc2:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801cc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc8:	c9                   	leave
+  801cc9:	c3                   	ret
+
+0000000000801cca <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+  801cce:	53                   	push   %rbx
+  801ccf:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd3:	48 89 fa             	mov    %rdi,%rdx
+  801cd6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ced:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cf5:	48 85 c0             	test   %rax,%rax
+  801cf8:	7f 06                	jg     801d00 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801cfa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfe:	c9                   	leave
+  801cff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d00:	49 89 c0             	mov    %rax,%r8
+  801d03:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801d08:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801d0f:	00 00 00 
+  801d12:	be 26 00 00 00       	mov    $0x26,%esi
+  801d17:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801d1e:	00 00 00 
+  801d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d26:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801d2d:	00 00 00 
+  801d30:	41 ff d1             	call   *%r9
+
+0000000000801d33 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801d33:	55                   	push   %rbp
+  801d34:	48 89 e5             	mov    %rsp,%rbp
+  801d37:	41 55                	push   %r13
+  801d39:	41 54                	push   %r12
+  801d3b:	53                   	push   %rbx
+  801d3c:	89 f8                	mov    %edi,%eax
+  801d3e:	49 89 f2             	mov    %rsi,%r10
+  801d41:	48 89 d3             	mov    %rdx,%rbx
+  801d44:	48 89 cf             	mov    %rcx,%rdi
+  801d47:	44 89 c6             	mov    %r8d,%esi
+  801d4a:	4d 89 c8             	mov    %r9,%r8
+  801d4d:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801d51:	48 63 f6             	movslq %esi,%rsi
+  801d54:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801d57:	4d 85 db             	test   %r11,%r11
+  801d5a:	48 b8 20 67 80 00 00 	movabs $0x806720,%rax
+  801d61:	00 00 00 
+  801d64:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801d68:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d6d:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801d70:	4d 8b 0b             	mov    (%r11),%r9
+  801d73:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801d77:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801d7b:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801d7f:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801d81:	5b                   	pop    %rbx
+  801d82:	41 5c                	pop    %r12
+  801d84:	41 5d                	pop    %r13
+  801d86:	5d                   	pop    %rbp
+  801d87:	c3                   	ret
+
+0000000000801d88 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801d88:	55                   	push   %rbp
+  801d89:	48 89 e5             	mov    %rsp,%rbp
+  801d8c:	41 55                	push   %r13
+  801d8e:	41 54                	push   %r12
+  801d90:	53                   	push   %rbx
+  801d91:	89 f8                	mov    %edi,%eax
+  801d93:	49 89 f2             	mov    %rsi,%r10
+  801d96:	48 89 d3             	mov    %rdx,%rbx
+  801d99:	48 89 cf             	mov    %rcx,%rdi
+  801d9c:	44 89 c6             	mov    %r8d,%esi
+  801d9f:	4d 89 c8             	mov    %r9,%r8
+  801da2:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801da6:	48 63 f6             	movslq %esi,%rsi
+  801da9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801dac:	4d 85 db             	test   %r11,%r11
+  801daf:	48 b8 20 67 80 00 00 	movabs $0x806720,%rax
+  801db6:	00 00 00 
+  801db9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801dbd:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc2:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801dc5:	4d 8b 0b             	mov    (%r11),%r9
+  801dc8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801dcc:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801dd0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801dd4:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801dd6:	5b                   	pop    %rbx
+  801dd7:	41 5c                	pop    %r12
+  801dd9:	41 5d                	pop    %r13
+  801ddb:	5d                   	pop    %rbp
+  801ddc:	c3                   	ret
+
+0000000000801ddd <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801ddd:	55                   	push   %rbp
+  801dde:	48 89 e5             	mov    %rsp,%rbp
+  801de1:	53                   	push   %rbx
+  801de2:	48 83 ec 08          	sub    $0x8,%rsp
+  801de6:	48 89 f1             	mov    %rsi,%rcx
+  801de9:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801dec:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801df1:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801df4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801df9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e04:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e06:	48 85 c0             	test   %rax,%rax
+  801e09:	7f 06                	jg     801e11 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801e0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e0f:	c9                   	leave
+  801e10:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e11:	49 89 c0             	mov    %rax,%r8
+  801e14:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801e19:	48 ba d8 66 80 00 00 	movabs $0x8066d8,%rdx
+  801e20:	00 00 00 
+  801e23:	be 26 00 00 00       	mov    $0x26,%esi
+  801e28:	48 bf f7 66 80 00 00 	movabs $0x8066f7,%rdi
+  801e2f:	00 00 00 
+  801e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e37:	49 b9 23 08 80 00 00 	movabs $0x800823,%r9
+  801e3e:	00 00 00 
+  801e41:	41 ff d1             	call   *%r9
+
+0000000000801e44 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801e44:	55                   	push   %rbp
+  801e45:	48 89 e5             	mov    %rsp,%rbp
+  801e48:	53                   	push   %rbx
+  801e49:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e51:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e60:	be 00 00 00 00       	mov    $0x0,%esi
+  801e65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e6b:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801e6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e71:	c9                   	leave
+  801e72:	c3                   	ret
+
+0000000000801e73 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801e73:	55                   	push   %rbp
+  801e74:	48 89 e5             	mov    %rsp,%rbp
+  801e77:	53                   	push   %rbx
+  801e78:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801e7b:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e7d:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e97:	cd 30                	int    $0x30
+}
+  801e99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e9d:	c9                   	leave
+  801e9e:	c3                   	ret
+
+0000000000801e9f <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801e9f:	55                   	push   %rbp
+  801ea0:	48 89 e5             	mov    %rsp,%rbp
+  801ea3:	53                   	push   %rbx
+  801ea4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801ea7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eaa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ec4:	cd 30                	int    $0x30
+}
+  801ec6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+
+0000000000801ecc <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801ecc:	55                   	push   %rbp
+  801ecd:	48 89 e5             	mov    %rsp,%rbp
+  801ed0:	53                   	push   %rbx
+  801ed1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801ed4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801edb:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ede:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801eee:	cd 30                	int    $0x30
+}
+  801ef0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+
+0000000000801ef6 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801ef6:	55                   	push   %rbp
+  801ef7:	48 89 e5             	mov    %rsp,%rbp
+  801efa:	53                   	push   %rbx
+  801efb:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801efe:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f01:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f10:	be 00 00 00 00       	mov    $0x0,%esi
+  801f15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f1b:	cd 30                	int    $0x30
+}
+  801f1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+0000000000801f23 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801f23:	55                   	push   %rbp
+  801f24:	48 89 e5             	mov    %rsp,%rbp
+  801f27:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f28:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f3c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f41:	be 00 00 00 00       	mov    $0x0,%esi
+  801f46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f4c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+0000000000801f54 <sys_monitor>:
+
+int sys_monitor(void) {
+  801f54:	55                   	push   %rbp
+  801f55:	48 89 e5             	mov    %rsp,%rbp
+  801f58:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f59:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f6d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f72:	be 00 00 00 00       	mov    $0x0,%esi
+  801f77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f7d:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+0000000000801f85 <sfork_page>:
+}
+
+/* Share the page at 'va' with the child.  It is made shared in our
+ * address space too, so that a later fork() does not copy it. */
+static int
+sfork_page(void *va, void *arg) {
+  801f85:	55                   	push   %rbp
+  801f86:	48 89 e5             	mov    %rsp,%rbp
+  801f89:	41 55                	push   %r13
+  801f8b:	41 54                	push   %r12
+  801f8d:	53                   	push   %rbx
+  801f8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f92:	48 89 fb             	mov    %rdi,%rbx
+    envid_t child = *(envid_t *)arg;
+  801f95:	44 8b 26             	mov    (%rsi),%r12d
+    int prot = get_prot(va) & PROT_ALL;
+  801f98:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  801f9f:	00 00 00 
+  801fa2:	ff d0                	call   *%rax
+  801fa4:	41 89 c5             	mov    %eax,%r13d
+  801fa7:	41 83 e5 5f          	and    $0x5f,%r13d
+
+    if (!(prot & PROT_SHARE)) {
+  801fab:	a8 40                	test   $0x40,%al
+  801fad:	75 31                	jne    801fe0 <sfork_page+0x5b>
+        /* Copy pages that are copied on write now.  This fails
+         * for really read-only pages, which are fine as they are */
+        if (!(prot & PROT_W) &&
+  801faf:	a8 02                	test   $0x2,%al
+  801fb1:	74 5f                	je     802012 <sfork_page+0x8d>
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+            prot = get_prot(va) & PROT_ALL;
+
+        int res = sys_map_region(0, va, 0, va, PAGE_SIZE, prot | PROT_SHARE);
+  801fb3:	45 89 e9             	mov    %r13d,%r9d
+  801fb6:	41 83 c9 40          	or     $0x40,%r9d
+  801fba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fc0:	48 89 d9             	mov    %rbx,%rcx
+  801fc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc8:	48 89 de             	mov    %rbx,%rsi
+  801fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd0:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	78 27                	js     802007 <sfork_page+0x82>
+    }
+
+    return sys_map_region(0, va, child, va, PAGE_SIZE, prot | PROT_SHARE);
+  801fe0:	45 89 e9             	mov    %r13d,%r9d
+  801fe3:	41 83 c9 40          	or     $0x40,%r9d
+  801fe7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fed:	48 89 d9             	mov    %rbx,%rcx
+  801ff0:	44 89 e2             	mov    %r12d,%edx
+  801ff3:	48 89 de             	mov    %rbx,%rsi
+  801ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ffb:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802002:	00 00 00 
+  802005:	ff d0                	call   *%rax
+}
+  802007:	48 83 c4 08          	add    $0x8,%rsp
+  80200b:	5b                   	pop    %rbx
+  80200c:	41 5c                	pop    %r12
+  80200e:	41 5d                	pop    %r13
+  802010:	5d                   	pop    %rbp
+  802011:	c3                   	ret
+            !sys_map_region(0, va, 0, va, PAGE_SIZE, (prot & PROT_X) | PROT_RW))
+  802012:	83 e0 01             	and    $0x1,%eax
+  802015:	83 c8 06             	or     $0x6,%eax
+  802018:	41 89 c1             	mov    %eax,%r9d
+  80201b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802021:	48 89 d9             	mov    %rbx,%rcx
+  802024:	ba 00 00 00 00       	mov    $0x0,%edx
+  802029:	48 89 de             	mov    %rbx,%rsi
+  80202c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802031:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+        if (!(prot & PROT_W) &&
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	0f 85 6e ff ff ff    	jne    801fb3 <sfork_page+0x2e>
+            prot = get_prot(va) & PROT_ALL;
+  802045:	48 89 df             	mov    %rbx,%rdi
+  802048:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	83 e0 5f             	and    $0x5f,%eax
+  802057:	41 89 c5             	mov    %eax,%r13d
+  80205a:	e9 54 ff ff ff       	jmp    801fb3 <sfork_page+0x2e>
+
+000000000080205f <fork>:
+fork(void) {
+  80205f:	55                   	push   %rbp
+  802060:	48 89 e5             	mov    %rsp,%rbp
+  802063:	41 54                	push   %r12
+  802065:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802066:	b8 09 00 00 00       	mov    $0x9,%eax
+  80206b:	cd 30                	int    $0x30
+  80206d:	41 89 c4             	mov    %eax,%r12d
+    if (envid < 0) {
+  802070:	85 c0                	test   %eax,%eax
+  802072:	0f 88 81 00 00 00    	js     8020f9 <fork+0x9a>
+    if (envid == CURENVID) {
+  802078:	0f 84 83 00 00 00    	je     802101 <fork+0xa2>
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  80207e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802084:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80208b:	00 00 00 
+  80208e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802093:	89 c2                	mov    %eax,%edx
+  802095:	be 00 00 00 00       	mov    $0x0,%esi
+  80209a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209f:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	0f 85 82 00 00 00    	jne    802135 <fork+0xd6>
+    asm("movq %%fs:0, %0"
+  8020b3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020ba:	00 00 
+            || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  8020bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020c0:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  8020c7:	44 89 e7             	mov    %r12d,%edi
+  8020ca:	48 b8 b4 1b 80 00 00 	movabs $0x801bb4,%rax
+  8020d1:	00 00 00 
+  8020d4:	ff d0                	call   *%rax
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	75 63                	jne    80213d <fork+0xde>
+            || sys_env_set_status(envid, ENV_RUNNABLE)) {
+  8020da:	be 02 00 00 00       	mov    $0x2,%esi
+  8020df:	44 89 e7             	mov    %r12d,%edi
+  8020e2:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+        return -1;
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8020f5:	44 0f 45 e0          	cmovne %eax,%r12d
+}
+  8020f9:	44 89 e0             	mov    %r12d,%eax
+  8020fc:	5b                   	pop    %rbx
+  8020fd:	41 5c                	pop    %r12
+  8020ff:	5d                   	pop    %rbp
+  802100:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802101:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+  80210d:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  802114:	00 00 
+  802116:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80211b:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  802122:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802129:	00 00 00 
+  80212c:	48 01 c8             	add    %rcx,%rax
+  80212f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  802133:	eb c4                	jmp    8020f9 <fork+0x9a>
+        return -1;
+  802135:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80213b:	eb bc                	jmp    8020f9 <fork+0x9a>
+  80213d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802143:	eb b4                	jmp    8020f9 <fork+0x9a>
+
+0000000000802145 <sfork>:
+ * later by either of them is not shared.  thisenv works in both
+ * since the thread control block of libmain() is on the stack.
+ *
+ * Returns: child's envid to the parent, 0 to the child, < 0 on error. */
+envid_t
+sfork(void) {
+  802145:	55                   	push   %rbp
+  802146:	48 89 e5             	mov    %rsp,%rbp
+  802149:	53                   	push   %rbx
+  80214a:	48 83 ec 18          	sub    $0x18,%rsp
+    asm volatile("int %2"
+  80214e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802153:	cd 30                	int    $0x30
+  802155:	89 c3                	mov    %eax,%ebx
+    envid_t envid = sys_exofork();
+  802157:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (envid < 0) return envid;
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 40                	js     80219e <sfork+0x59>
+
+    if (envid == CURENVID) {
+  80215e:	74 46                	je     8021a6 <sfork+0x61>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return CURENVID;
+    }
+
+    void *stack = (void *)(USER_STACK_TOP - USER_STACK_SIZE);
+    int res = foreach_present_page(NULL, stack, sfork_page, &envid);
+  802160:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  802164:	48 ba 85 1f 80 00 00 	movabs $0x801f85,%rdx
+  80216b:	00 00 00 
+  80216e:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  802175:	00 00 00 
+  802178:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217d:	48 b8 cf 49 80 00 00 	movabs $0x8049cf,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+  802189:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	79 4b                	jns    8021da <sfork+0x95>
+                                       PROT_ALL | PROT_LAZY | PROT_COMBINE);
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+    if (res < 0) {
+        sys_env_destroy(envid);
+  80218f:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802192:	48 b8 1d 17 80 00 00 	movabs $0x80171d,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+        return res;
+    }
+
+    return envid;
+}
+  80219e:	89 d8                	mov    %ebx,%eax
+  8021a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8021a6:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+    asm("movq %%fs:0, %0"
+  8021b2:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8021b9:	00 00 
+  8021bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8021c0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8021c7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8021ce:	00 00 00 
+  8021d1:	48 01 c8             	add    %rcx,%rax
+  8021d4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        return CURENVID;
+  8021d8:	eb c4                	jmp    80219e <sfork+0x59>
+    if (res >= 0) res = sys_map_region(0, stack, envid, stack, MAX_USER_ADDRESS - (uintptr_t)stack,
+  8021da:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8021e0:	41 b8 00 90 01 00    	mov    $0x19000,%r8d
+  8021e6:	48 be 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rsi
+  8021ed:	00 00 00 
+  8021f0:	48 89 f1             	mov    %rsi,%rcx
+  8021f3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8021f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fb:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802202:	00 00 00 
+  802205:	ff d0                	call   *%rax
+  802207:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	78 82                	js     80218f <sfork+0x4a>
+  80220d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802214:	00 00 
+  802216:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80221a:	48 8b b0 40 01 00 00 	mov    0x140(%rax),%rsi
+  802221:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802224:	48 b8 b4 1b 80 00 00 	movabs $0x801bb4,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	89 c3                	mov    %eax,%ebx
+    if (res >= 0) res = sys_env_set_status(envid, ENV_RUNNABLE);
+  802232:	85 c0                	test   %eax,%eax
+  802234:	0f 88 55 ff ff ff    	js     80218f <sfork+0x4a>
+  80223a:	be 02 00 00 00       	mov    $0x2,%esi
+  80223f:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  802242:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  802249:	00 00 00 
+  80224c:	ff d0                	call   *%rax
+  80224e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802250:	85 c0                	test   %eax,%eax
+  802252:	0f 88 37 ff ff ff    	js     80218f <sfork+0x4a>
+    return envid;
+  802258:	8b 5d ec             	mov    -0x14(%rbp),%ebx
+  80225b:	e9 3e ff ff ff       	jmp    80219e <sfork+0x59>
+
+0000000000802260 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802260:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802267:	ff ff ff 
+  80226a:	48 01 f8             	add    %rdi,%rax
+  80226d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802271:	c3                   	ret
+
+0000000000802272 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802272:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802279:	ff ff ff 
+  80227c:	48 01 f8             	add    %rdi,%rax
+  80227f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802283:	48 c1 e0 12          	shl    $0x12,%rax
+  802287:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80228c:	48 01 d0             	add    %rdx,%rax
+}
+  80228f:	c3                   	ret
+
+0000000000802290 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802290:	55                   	push   %rbp
+  802291:	48 89 e5             	mov    %rsp,%rbp
+  802294:	41 57                	push   %r15
+  802296:	41 56                	push   %r14
+  802298:	41 55                	push   %r13
+  80229a:	41 54                	push   %r12
+  80229c:	53                   	push   %rbx
+  80229d:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a1:	49 89 ff             	mov    %rdi,%r15
+  8022a4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8022a9:	49 bd 5b 49 80 00 00 	movabs $0x80495b,%r13
+  8022b0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8022b3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8022b9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8022bc:	48 89 df             	mov    %rbx,%rdi
+  8022bf:	41 ff d5             	call   *%r13
+  8022c2:	83 e0 04             	and    $0x4,%eax
+  8022c5:	74 17                	je     8022de <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8022c7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022ce:	4c 39 f3             	cmp    %r14,%rbx
+  8022d1:	75 e6                	jne    8022b9 <fd_alloc+0x29>
+  8022d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8022d9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8022de:	4d 89 27             	mov    %r12,(%r15)
+}
+  8022e1:	48 83 c4 08          	add    $0x8,%rsp
+  8022e5:	5b                   	pop    %rbx
+  8022e6:	41 5c                	pop    %r12
+  8022e8:	41 5d                	pop    %r13
+  8022ea:	41 5e                	pop    %r14
+  8022ec:	41 5f                	pop    %r15
+  8022ee:	5d                   	pop    %rbp
+  8022ef:	c3                   	ret
+
+00000000008022f0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8022f0:	83 ff 1f             	cmp    $0x1f,%edi
+  8022f3:	77 39                	ja     80232e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8022f5:	55                   	push   %rbp
+  8022f6:	48 89 e5             	mov    %rsp,%rbp
+  8022f9:	41 54                	push   %r12
+  8022fb:	53                   	push   %rbx
+  8022fc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8022ff:	48 63 df             	movslq %edi,%rbx
+  802302:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802309:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80230d:	48 89 df             	mov    %rbx,%rdi
+  802310:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+  80231c:	a8 04                	test   $0x4,%al
+  80231e:	74 14                	je     802334 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802320:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802329:	5b                   	pop    %rbx
+  80232a:	41 5c                	pop    %r12
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+        return -E_INVAL;
+  80232e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802333:	c3                   	ret
+        return -E_INVAL;
+  802334:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802339:	eb ee                	jmp    802329 <fd_lookup+0x39>
+
+000000000080233b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  80233f:	41 54                	push   %r12
+  802341:	53                   	push   %rbx
+  802342:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802345:	48 b8 c0 67 80 00 00 	movabs $0x8067c0,%rax
+  80234c:	00 00 00 
+  80234f:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802356:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802359:	39 3b                	cmp    %edi,(%rbx)
+  80235b:	74 4a                	je     8023a7 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  80235d:	48 83 c0 08          	add    $0x8,%rax
+  802361:	48 8b 18             	mov    (%rax),%rbx
+  802364:	48 85 db             	test   %rbx,%rbx
+  802367:	75 f0                	jne    802359 <dev_lookup+0x1e>
+  802369:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802370:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802372:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802376:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80237c:	89 fa                	mov    %edi,%edx
+  80237e:	48 bf 40 67 80 00 00 	movabs $0x806740,%rdi
+  802385:	00 00 00 
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238d:	48 b9 73 09 80 00 00 	movabs $0x800973,%rcx
+  802394:	00 00 00 
+  802397:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802399:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80239e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023a2:	5b                   	pop    %rbx
+  8023a3:	41 5c                	pop    %r12
+  8023a5:	5d                   	pop    %rbp
+  8023a6:	c3                   	ret
+            return 0;
+  8023a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ac:	eb f0                	jmp    80239e <dev_lookup+0x63>
+
+00000000008023ae <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8023ae:	55                   	push   %rbp
+  8023af:	48 89 e5             	mov    %rsp,%rbp
+  8023b2:	41 55                	push   %r13
+  8023b4:	41 54                	push   %r12
+  8023b6:	53                   	push   %rbx
+  8023b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bb:	48 89 fb             	mov    %rdi,%rbx
+  8023be:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8023c1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8023c8:	ff ff ff 
+  8023cb:	48 01 df             	add    %rbx,%rdi
+  8023ce:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8023d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023d6:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+  8023e2:	41 89 c5             	mov    %eax,%r13d
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	78 06                	js     8023ef <fd_close+0x41>
+  8023e9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8023ed:	74 1a                	je     802409 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8023ef:	45 84 e4             	test   %r12b,%r12b
+  8023f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8023fb:	44 89 e8             	mov    %r13d,%eax
+  8023fe:	48 83 c4 18          	add    $0x18,%rsp
+  802402:	5b                   	pop    %rbx
+  802403:	41 5c                	pop    %r12
+  802405:	41 5d                	pop    %r13
+  802407:	5d                   	pop    %rbp
+  802408:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802409:	8b 3b                	mov    (%rbx),%edi
+  80240b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80240f:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+  80241b:	41 89 c5             	mov    %eax,%r13d
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	78 1b                	js     80243d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802422:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802426:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80242a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802430:	48 85 c0             	test   %rax,%rax
+  802433:	74 08                	je     80243d <fd_close+0x8f>
+  802435:	48 89 df             	mov    %rbx,%rdi
+  802438:	ff d0                	call   *%rax
+  80243a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80243d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802442:	48 89 de             	mov    %rbx,%rsi
+  802445:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244a:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  802451:	00 00 00 
+  802454:	ff d0                	call   *%rax
+    return res;
+  802456:	eb a3                	jmp    8023fb <fd_close+0x4d>
+
+0000000000802458 <close>:
+
+int
+close(int fdnum) {
+  802458:	55                   	push   %rbp
+  802459:	48 89 e5             	mov    %rsp,%rbp
+  80245c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802460:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802464:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802470:	85 c0                	test   %eax,%eax
+  802472:	78 15                	js     802489 <close+0x31>
+
+    return fd_close(fd, 1);
+  802474:	be 01 00 00 00       	mov    $0x1,%esi
+  802479:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80247d:	48 b8 ae 23 80 00 00 	movabs $0x8023ae,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+}
+  802489:	c9                   	leave
+  80248a:	c3                   	ret
+
+000000000080248b <close_all>:
+
+void
+close_all(void) {
+  80248b:	55                   	push   %rbp
+  80248c:	48 89 e5             	mov    %rsp,%rbp
+  80248f:	41 54                	push   %r12
+  802491:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802492:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802497:	49 bc 58 24 80 00 00 	movabs $0x802458,%r12
+  80249e:	00 00 00 
+  8024a1:	89 df                	mov    %ebx,%edi
+  8024a3:	41 ff d4             	call   *%r12
+  8024a6:	83 c3 01             	add    $0x1,%ebx
+  8024a9:	83 fb 20             	cmp    $0x20,%ebx
+  8024ac:	75 f3                	jne    8024a1 <close_all+0x16>
+}
+  8024ae:	5b                   	pop    %rbx
+  8024af:	41 5c                	pop    %r12
+  8024b1:	5d                   	pop    %rbp
+  8024b2:	c3                   	ret
+
+00000000008024b3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8024b3:	55                   	push   %rbp
+  8024b4:	48 89 e5             	mov    %rsp,%rbp
+  8024b7:	41 57                	push   %r15
+  8024b9:	41 56                	push   %r14
+  8024bb:	41 55                	push   %r13
+  8024bd:	41 54                	push   %r12
+  8024bf:	53                   	push   %rbx
+  8024c0:	48 83 ec 38          	sub    $0x38,%rsp
+  8024c4:	41 89 f7             	mov    %esi,%r15d
+  8024c7:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8024ca:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8024ce:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+  8024da:	89 c3                	mov    %eax,%ebx
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	0f 88 ec 00 00 00    	js     8025d0 <dup+0x11d>
+    close(newfdnum);
+  8024e4:	44 89 ff             	mov    %r15d,%edi
+  8024e7:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8024f3:	49 63 c7             	movslq %r15d,%rax
+  8024f6:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8024fc:	48 c1 e0 0c          	shl    $0xc,%rax
+  802500:	49 89 c6             	mov    %rax,%r14
+  802503:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802507:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80250b:	4c 89 ff             	mov    %r15,%rdi
+  80250e:	48 bb 72 22 80 00 00 	movabs $0x802272,%rbx
+  802515:	00 00 00 
+  802518:	ff d3                	call   *%rbx
+  80251a:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80251d:	4c 89 f7             	mov    %r14,%rdi
+  802520:	ff d3                	call   *%rbx
+  802522:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  802526:	4c 89 e7             	mov    %r12,%rdi
+  802529:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  802538:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  80253d:	49 be 5b 49 80 00 00 	movabs $0x80495b,%r14
+  802544:	00 00 00 
+  802547:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  80254b:	41 ff d6             	call   *%r14
+  80254e:	44 39 e8             	cmp    %r13d,%eax
+  802551:	75 10                	jne    802563 <dup+0xb0>
+  802553:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80255a:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  802561:	75 e4                	jne    802547 <dup+0x94>
+    if (prot & PROT_R) {
+  802563:	41 f6 c5 04          	test   $0x4,%r13b
+  802567:	74 29                	je     802592 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  802569:	45 89 e9             	mov    %r13d,%r9d
+  80256c:	49 89 d8             	mov    %rbx,%r8
+  80256f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802573:	ba 00 00 00 00       	mov    $0x0,%edx
+  802578:	4c 89 e6             	mov    %r12,%rsi
+  80257b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802580:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+  80258c:	89 c3                	mov    %eax,%ebx
+  80258e:	85 c0                	test   %eax,%eax
+  802590:	78 4f                	js     8025e1 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802592:	4c 89 ff             	mov    %r15,%rdi
+  802595:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+  8025a1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025aa:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8025ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b3:	4c 89 fe             	mov    %r15,%rsi
+  8025b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025bb:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+  8025c7:	89 c3                	mov    %eax,%ebx
+  8025c9:	85 c0                	test   %eax,%eax
+  8025cb:	78 14                	js     8025e1 <dup+0x12e>
+
+    return newfdnum;
+  8025cd:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  8025d0:	89 d8                	mov    %ebx,%eax
+  8025d2:	48 83 c4 38          	add    $0x38,%rsp
+  8025d6:	5b                   	pop    %rbx
+  8025d7:	41 5c                	pop    %r12
+  8025d9:	41 5d                	pop    %r13
+  8025db:	41 5e                	pop    %r14
+  8025dd:	41 5f                	pop    %r15
+  8025df:	5d                   	pop    %rbp
+  8025e0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8025e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025e6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8025ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ef:	49 bc 7c 19 80 00 00 	movabs $0x80197c,%r12
+  8025f6:	00 00 00 
+  8025f9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  8025fc:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802601:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260a:	41 ff d4             	call   *%r12
+    return res;
+  80260d:	eb c1                	jmp    8025d0 <dup+0x11d>
+
+000000000080260f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80260f:	55                   	push   %rbp
+  802610:	48 89 e5             	mov    %rsp,%rbp
+  802613:	41 56                	push   %r14
+  802615:	41 55                	push   %r13
+  802617:	41 54                	push   %r12
+  802619:	53                   	push   %rbx
+  80261a:	48 83 ec 10          	sub    $0x10,%rsp
+  80261e:	89 fb                	mov    %edi,%ebx
+  802620:	49 89 f4             	mov    %rsi,%r12
+  802623:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802626:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80262a:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+  802636:	85 c0                	test   %eax,%eax
+  802638:	78 4c                	js     802686 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80263a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80263e:	41 8b 3e             	mov    (%r14),%edi
+  802641:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802645:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+  802651:	85 c0                	test   %eax,%eax
+  802653:	78 35                	js     80268a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802655:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802659:	83 e0 03             	and    $0x3,%eax
+  80265c:	83 f8 01             	cmp    $0x1,%eax
+  80265f:	74 2d                	je     80268e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802661:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802665:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802669:	48 85 c0             	test   %rax,%rax
+  80266c:	74 59                	je     8026c7 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80266e:	4c 89 ea             	mov    %r13,%rdx
+  802671:	4c 89 e6             	mov    %r12,%rsi
+  802674:	4c 89 f7             	mov    %r14,%rdi
+  802677:	ff d0                	call   *%rax
+}
+  802679:	48 83 c4 10          	add    $0x10,%rsp
+  80267d:	5b                   	pop    %rbx
+  80267e:	41 5c                	pop    %r12
+  802680:	41 5d                	pop    %r13
+  802682:	41 5e                	pop    %r14
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802686:	48 98                	cltq
+  802688:	eb ef                	jmp    802679 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80268a:	48 98                	cltq
+  80268c:	eb eb                	jmp    802679 <read+0x6a>
+  80268e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802695:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802697:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80269b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026a1:	89 da                	mov    %ebx,%edx
+  8026a3:	48 bf 81 67 80 00 00 	movabs $0x806781,%rdi
+  8026aa:	00 00 00 
+  8026ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b2:	48 b9 73 09 80 00 00 	movabs $0x800973,%rcx
+  8026b9:	00 00 00 
+  8026bc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026c5:	eb b2                	jmp    802679 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026c7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026ce:	eb a9                	jmp    802679 <read+0x6a>
+
+00000000008026d0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+  8026d4:	41 57                	push   %r15
+  8026d6:	41 56                	push   %r14
+  8026d8:	41 55                	push   %r13
+  8026da:	41 54                	push   %r12
+  8026dc:	53                   	push   %rbx
+  8026dd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8026e1:	48 85 d2             	test   %rdx,%rdx
+  8026e4:	74 54                	je     80273a <readn+0x6a>
+  8026e6:	41 89 fd             	mov    %edi,%r13d
+  8026e9:	49 89 f6             	mov    %rsi,%r14
+  8026ec:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8026ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8026f4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8026f9:	49 bf 0f 26 80 00 00 	movabs $0x80260f,%r15
+  802700:	00 00 00 
+  802703:	4c 89 e2             	mov    %r12,%rdx
+  802706:	48 29 f2             	sub    %rsi,%rdx
+  802709:	4c 01 f6             	add    %r14,%rsi
+  80270c:	44 89 ef             	mov    %r13d,%edi
+  80270f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802712:	85 c0                	test   %eax,%eax
+  802714:	78 20                	js     802736 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802716:	01 c3                	add    %eax,%ebx
+  802718:	85 c0                	test   %eax,%eax
+  80271a:	74 08                	je     802724 <readn+0x54>
+  80271c:	48 63 f3             	movslq %ebx,%rsi
+  80271f:	4c 39 e6             	cmp    %r12,%rsi
+  802722:	72 df                	jb     802703 <readn+0x33>
+    }
+    return res;
+  802724:	48 63 c3             	movslq %ebx,%rax
+}
+  802727:	48 83 c4 08          	add    $0x8,%rsp
+  80272b:	5b                   	pop    %rbx
+  80272c:	41 5c                	pop    %r12
+  80272e:	41 5d                	pop    %r13
+  802730:	41 5e                	pop    %r14
+  802732:	41 5f                	pop    %r15
+  802734:	5d                   	pop    %rbp
+  802735:	c3                   	ret
+        if (inc < 0) return inc;
+  802736:	48 98                	cltq
+  802738:	eb ed                	jmp    802727 <readn+0x57>
+    int inc = 1, res = 0;
+  80273a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273f:	eb e3                	jmp    802724 <readn+0x54>
+
+0000000000802741 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	41 56                	push   %r14
+  802747:	41 55                	push   %r13
+  802749:	41 54                	push   %r12
+  80274b:	53                   	push   %rbx
+  80274c:	48 83 ec 10          	sub    $0x10,%rsp
+  802750:	89 fb                	mov    %edi,%ebx
+  802752:	49 89 f4             	mov    %rsi,%r12
+  802755:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802758:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80275c:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 47                	js     8027b3 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80276c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802770:	41 8b 3e             	mov    (%r14),%edi
+  802773:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802777:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 30                	js     8027b7 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802787:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80278c:	74 2d                	je     8027bb <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80278e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802792:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802796:	48 85 c0             	test   %rax,%rax
+  802799:	74 59                	je     8027f4 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80279b:	4c 89 ea             	mov    %r13,%rdx
+  80279e:	4c 89 e6             	mov    %r12,%rsi
+  8027a1:	4c 89 f7             	mov    %r14,%rdi
+  8027a4:	ff d0                	call   *%rax
+}
+  8027a6:	48 83 c4 10          	add    $0x10,%rsp
+  8027aa:	5b                   	pop    %rbx
+  8027ab:	41 5c                	pop    %r12
+  8027ad:	41 5d                	pop    %r13
+  8027af:	41 5e                	pop    %r14
+  8027b1:	5d                   	pop    %rbp
+  8027b2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027b3:	48 98                	cltq
+  8027b5:	eb ef                	jmp    8027a6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027b7:	48 98                	cltq
+  8027b9:	eb eb                	jmp    8027a6 <write+0x65>
+  8027bb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8027c2:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027c8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027ce:	89 da                	mov    %ebx,%edx
+  8027d0:	48 bf 9d 67 80 00 00 	movabs $0x80679d,%rdi
+  8027d7:	00 00 00 
+  8027da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027df:	48 b9 73 09 80 00 00 	movabs $0x800973,%rcx
+  8027e6:	00 00 00 
+  8027e9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027eb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027f2:	eb b2                	jmp    8027a6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027f4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8027fb:	eb a9                	jmp    8027a6 <write+0x65>
+
+00000000008027fd <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8027fd:	55                   	push   %rbp
+  8027fe:	48 89 e5             	mov    %rsp,%rbp
+  802801:	53                   	push   %rbx
+  802802:	48 83 ec 18          	sub    $0x18,%rsp
+  802806:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802808:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80280c:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	78 0c                	js     802828 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80281c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802820:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802823:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802828:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+000000000080282e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	41 55                	push   %r13
+  802834:	41 54                	push   %r12
+  802836:	53                   	push   %rbx
+  802837:	48 83 ec 18          	sub    $0x18,%rsp
+  80283b:	89 fb                	mov    %edi,%ebx
+  80283d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802840:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802844:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  80284b:	00 00 00 
+  80284e:	ff d0                	call   *%rax
+  802850:	85 c0                	test   %eax,%eax
+  802852:	78 38                	js     80288c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802854:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802858:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80285c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802860:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  802867:	00 00 00 
+  80286a:	ff d0                	call   *%rax
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 1c                	js     80288c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802870:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802875:	74 20                	je     802897 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802877:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80287b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80287f:	48 85 c0             	test   %rax,%rax
+  802882:	74 4a                	je     8028ce <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802884:	44 89 e6             	mov    %r12d,%esi
+  802887:	4c 89 ef             	mov    %r13,%rdi
+  80288a:	ff d0                	call   *%rax
+}
+  80288c:	48 83 c4 18          	add    $0x18,%rsp
+  802890:	5b                   	pop    %rbx
+  802891:	41 5c                	pop    %r12
+  802893:	41 5d                	pop    %r13
+  802895:	5d                   	pop    %rbp
+  802896:	c3                   	ret
+  802897:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80289e:	00 00 
+                thisenv->env_id, fdnum);
+  8028a0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028a4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028aa:	89 da                	mov    %ebx,%edx
+  8028ac:	48 bf 60 67 80 00 00 	movabs $0x806760,%rdi
+  8028b3:	00 00 00 
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bb:	48 b9 73 09 80 00 00 	movabs $0x800973,%rcx
+  8028c2:	00 00 00 
+  8028c5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8028c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028cc:	eb be                	jmp    80288c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028ce:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028d3:	eb b7                	jmp    80288c <ftruncate+0x5e>
+
+00000000008028d5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8028d5:	55                   	push   %rbp
+  8028d6:	48 89 e5             	mov    %rsp,%rbp
+  8028d9:	41 54                	push   %r12
+  8028db:	53                   	push   %rbx
+  8028dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028e3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028e7:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 4e                	js     802945 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028f7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8028fb:	41 8b 3c 24          	mov    (%r12),%edi
+  8028ff:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802903:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 32                	js     802945 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802913:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802917:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80291c:	74 30                	je     80294e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80291e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802921:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802928:	00 00 00 
+    stat->st_isdir = 0;
+  80292b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802932:	00 00 00 
+    stat->st_dev = dev;
+  802935:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80293c:	48 89 de             	mov    %rbx,%rsi
+  80293f:	4c 89 e7             	mov    %r12,%rdi
+  802942:	ff 50 28             	call   *0x28(%rax)
+}
+  802945:	48 83 c4 10          	add    $0x10,%rsp
+  802949:	5b                   	pop    %rbx
+  80294a:	41 5c                	pop    %r12
+  80294c:	5d                   	pop    %rbp
+  80294d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80294e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802953:	eb f0                	jmp    802945 <fstat+0x70>
+
+0000000000802955 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802955:	55                   	push   %rbp
+  802956:	48 89 e5             	mov    %rsp,%rbp
+  802959:	41 54                	push   %r12
+  80295b:	53                   	push   %rbx
+  80295c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80295f:	be 00 00 00 00       	mov    $0x0,%esi
+  802964:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  80296b:	00 00 00 
+  80296e:	ff d0                	call   *%rax
+  802970:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802972:	85 c0                	test   %eax,%eax
+  802974:	78 25                	js     80299b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802976:	4c 89 e6             	mov    %r12,%rsi
+  802979:	89 c7                	mov    %eax,%edi
+  80297b:	48 b8 d5 28 80 00 00 	movabs $0x8028d5,%rax
+  802982:	00 00 00 
+  802985:	ff d0                	call   *%rax
+  802987:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80298a:	89 df                	mov    %ebx,%edi
+  80298c:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+
+    return res;
+  802998:	44 89 e3             	mov    %r12d,%ebx
+}
+  80299b:	89 d8                	mov    %ebx,%eax
+  80299d:	5b                   	pop    %rbx
+  80299e:	41 5c                	pop    %r12
+  8029a0:	5d                   	pop    %rbp
+  8029a1:	c3                   	ret
+
+00000000008029a2 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029a2:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8029a9:	00 00 00 
+  8029ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b1:	eb 0e                	jmp    8029c1 <mmap_lookup+0x1f>
+  8029b3:	48 83 c2 01          	add    $0x1,%rdx
+  8029b7:	48 83 c0 20          	add    $0x20,%rax
+  8029bb:	48 83 fa 40          	cmp    $0x40,%rdx
+  8029bf:	74 2b                	je     8029ec <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8029c1:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8029c5:	48 85 c9             	test   %rcx,%rcx
+  8029c8:	74 e9                	je     8029b3 <mmap_lookup+0x11>
+  8029ca:	48 8b 30             	mov    (%rax),%rsi
+  8029cd:	48 39 f7             	cmp    %rsi,%rdi
+  8029d0:	72 e1                	jb     8029b3 <mmap_lookup+0x11>
+  8029d2:	48 01 f1             	add    %rsi,%rcx
+  8029d5:	48 39 cf             	cmp    %rcx,%rdi
+  8029d8:	73 d9                	jae    8029b3 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8029da:	48 c1 e2 05          	shl    $0x5,%rdx
+  8029de:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8029e5:	00 00 00 
+  8029e8:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8029eb:	c3                   	ret
+    return NULL;
+  8029ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f1:	c3                   	ret
+
+00000000008029f2 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	41 54                	push   %r12
+  8029f8:	53                   	push   %rbx
+  8029f9:	89 fb                	mov    %edi,%ebx
+  8029fb:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029fe:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802a05:	00 00 00 
+  802a08:	83 38 00             	cmpl   $0x0,(%rax)
+  802a0b:	74 3d                	je     802a4a <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a0d:	41 54                	push   %r12
+  802a0f:	6a 00                	push   $0x0
+  802a11:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a27:	89 de                	mov    %ebx,%esi
+  802a29:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802a30:	00 00 00 
+  802a33:	8b 38                	mov    (%rax),%edi
+  802a35:	48 b8 89 4d 80 00 00 	movabs $0x804d89,%rax
+  802a3c:	00 00 00 
+  802a3f:	ff d0                	call   *%rax
+}
+  802a41:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802a45:	5b                   	pop    %rbx
+  802a46:	41 5c                	pop    %r12
+  802a48:	5d                   	pop    %rbp
+  802a49:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a4a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a4f:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  802a56:	00 00 00 
+  802a59:	ff d0                	call   *%rax
+  802a5b:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802a62:	00 00 
+  802a64:	eb a7                	jmp    802a0d <fsipc_words+0x1b>
+
+0000000000802a66 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a66:	55                   	push   %rbp
+  802a67:	48 89 e5             	mov    %rsp,%rbp
+  802a6a:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802a6e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a75:	00 
+  802a76:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a7d:	00 
+  802a7e:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802a82:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a86:	48 63 f6             	movslq %esi,%rsi
+  802a89:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802a8d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a91:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a96:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+}
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+
+0000000000802aa4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802aa4:	55                   	push   %rbp
+  802aa5:	48 89 e5             	mov    %rsp,%rbp
+  802aa8:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802aac:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802ab3:	00 
+  802ab4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802abb:	00 
+  802abc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802ac3:	00 
+  802ac4:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802ac8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802acc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ad0:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ad5:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802adc:	00 00 00 
+  802adf:	ff d0                	call   *%rax
+}
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+
+0000000000802ae3 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	41 54                	push   %r12
+  802ae9:	53                   	push   %rbx
+  802aea:	89 fb                	mov    %edi,%ebx
+  802aec:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aef:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802af6:	00 00 00 
+  802af9:	83 38 00             	cmpl   $0x0,(%rax)
+  802afc:	74 3f                	je     802b3d <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802afe:	6a 00                	push   $0x0
+  802b00:	6a 00                	push   $0x0
+  802b02:	4d 89 e1             	mov    %r12,%r9
+  802b05:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b0b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b10:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802b17:	00 00 00 
+  802b1a:	89 de                	mov    %ebx,%esi
+  802b1c:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802b23:	00 00 00 
+  802b26:	8b 38                	mov    (%rax),%edi
+  802b28:	48 b8 89 4d 80 00 00 	movabs $0x804d89,%rax
+  802b2f:	00 00 00 
+  802b32:	ff d0                	call   *%rax
+}
+  802b34:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802b38:	5b                   	pop    %rbx
+  802b39:	41 5c                	pop    %r12
+  802b3b:	5d                   	pop    %rbp
+  802b3c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b3d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b42:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802b55:	00 00 
+  802b57:	eb a5                	jmp    802afe <fsipc+0x1b>
+
+0000000000802b59 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802b59:	55                   	push   %rbp
+  802b5a:	48 89 e5             	mov    %rsp,%rbp
+  802b5d:	41 54                	push   %r12
+  802b5f:	53                   	push   %rbx
+  802b60:	41 89 fc             	mov    %edi,%r12d
+  802b63:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b66:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802b6d:	00 00 00 
+  802b70:	83 38 00             	cmpl   $0x0,(%rax)
+  802b73:	74 46                	je     802bbb <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802b75:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802b79:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802b7d:	6a 00                	push   $0x0
+  802b7f:	6a 00                	push   $0x0
+  802b81:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b87:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b8d:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802b94:	00 00 00 
+  802b97:	44 89 e6             	mov    %r12d,%esi
+  802b9a:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802ba1:	00 00 00 
+  802ba4:	8b 38                	mov    (%rax),%edi
+  802ba6:	48 b8 89 4d 80 00 00 	movabs $0x804d89,%rax
+  802bad:	00 00 00 
+  802bb0:	ff d0                	call   *%rax
+}
+  802bb2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802bb6:	5b                   	pop    %rbx
+  802bb7:	41 5c                	pop    %r12
+  802bb9:	5d                   	pop    %rbp
+  802bba:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bbb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bc0:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  802bc7:	00 00 00 
+  802bca:	ff d0                	call   *%rax
+  802bcc:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802bd3:	00 00 
+  802bd5:	eb 9e                	jmp    802b75 <fsipcv+0x1c>
+
+0000000000802bd7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802bd7:	55                   	push   %rbp
+  802bd8:	48 89 e5             	mov    %rsp,%rbp
+  802bdb:	41 54                	push   %r12
+  802bdd:	53                   	push   %rbx
+  802bde:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802be1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802be4:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802beb:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802bed:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf2:	bf 05 00 00 00       	mov    $0x5,%edi
+  802bf7:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	78 3d                	js     802c44 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c07:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802c0e:	00 00 00 
+  802c11:	4c 89 e6             	mov    %r12,%rsi
+  802c14:	48 89 df             	mov    %rbx,%rdi
+  802c17:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  802c1e:	00 00 00 
+  802c21:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c23:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802c2a:	00 
+  802c2b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c31:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802c38:	00 
+  802c39:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c44:	5b                   	pop    %rbx
+  802c45:	41 5c                	pop    %r12
+  802c47:	5d                   	pop    %rbp
+  802c48:	c3                   	ret
+
+0000000000802c49 <fsipcv_buf>:
+    return FSIPCV;
+  802c49:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c50:	00 00 00 
+    if (!allocated) {
+  802c53:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802c5a:	00 00 00 
+  802c5d:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802c60:	74 01                	je     802c63 <fsipcv_buf+0x1a>
+}
+  802c62:	c3                   	ret
+fsipcv_buf(void) {
+  802c63:	55                   	push   %rbp
+  802c64:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802c67:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c6c:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802c71:	48 89 c6             	mov    %rax,%rsi
+  802c74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c79:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  802c80:	00 00 00 
+  802c83:	ff d0                	call   *%rax
+  802c85:	85 c0                	test   %eax,%eax
+  802c87:	78 19                	js     802ca2 <fsipcv_buf+0x59>
+        allocated = 1;
+  802c89:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802c90:	00 00 00 
+  802c93:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802c96:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802c9d:	00 00 00 
+}
+  802ca0:	5d                   	pop    %rbp
+  802ca1:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	eb f7                	jmp    802ca0 <fsipcv_buf+0x57>
+
+0000000000802ca9 <devfile_write>:
+    if (!fd || !buf) {
+  802ca9:	48 85 ff             	test   %rdi,%rdi
+  802cac:	0f 84 46 01 00 00    	je     802df8 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cb2:	55                   	push   %rbp
+  802cb3:	48 89 e5             	mov    %rsp,%rbp
+  802cb6:	41 57                	push   %r15
+  802cb8:	41 56                	push   %r14
+  802cba:	41 55                	push   %r13
+  802cbc:	41 54                	push   %r12
+  802cbe:	53                   	push   %rbx
+  802cbf:	48 83 ec 18          	sub    $0x18,%rsp
+  802cc3:	49 89 ff             	mov    %rdi,%r15
+  802cc6:	49 89 f5             	mov    %rsi,%r13
+  802cc9:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802ccc:	48 85 f6             	test   %rsi,%rsi
+  802ccf:	0f 84 1a 01 00 00    	je     802def <devfile_write+0x146>
+    while (n) {
+  802cd5:	48 85 d2             	test   %rdx,%rdx
+  802cd8:	0f 84 fc 00 00 00    	je     802dda <devfile_write+0x131>
+    size_t i = 0;
+  802cde:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802ce4:	eb 6c                	jmp    802d52 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802ce6:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802cec:	4c 39 e3             	cmp    %r12,%rbx
+  802cef:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802cf3:	4c 89 e2             	mov    %r12,%rdx
+  802cf6:	4c 89 ee             	mov    %r13,%rsi
+  802cf9:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802d00:	00 00 00 
+  802d03:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d0f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d13:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802d1a:	00 00 00 
+  802d1d:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d1f:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802d23:	be 00 00 00 00       	mov    $0x0,%esi
+  802d28:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d2d:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  802d34:	00 00 00 
+  802d37:	ff d0                	call   *%rax
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	0f 88 95 00 00 00    	js     802dd6 <devfile_write+0x12d>
+        buf += ret;
+  802d41:	48 98                	cltq
+  802d43:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802d46:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802d49:	48 29 c3             	sub    %rax,%rbx
+  802d4c:	0f 84 8b 00 00 00    	je     802ddd <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802d52:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802d59:	76 8b                	jbe    802ce6 <devfile_write+0x3d>
+  802d5b:	48 b8 49 2c 80 00 00 	movabs $0x802c49,%rax
+  802d62:	00 00 00 
+  802d65:	ff d0                	call   *%rax
+  802d67:	49 89 c4             	mov    %rax,%r12
+  802d6a:	48 85 c0             	test   %rax,%rax
+  802d6d:	0f 84 73 ff ff ff    	je     802ce6 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802d73:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802d78:	48 39 c3             	cmp    %rax,%rbx
+  802d7b:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802d7f:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802d86:	00 
+  802d87:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d8b:	48 89 c2             	mov    %rax,%rdx
+  802d8e:	4c 89 ee             	mov    %r13,%rsi
+  802d91:	48 b9 f9 14 80 00 00 	movabs $0x8014f9,%rcx
+  802d98:	00 00 00 
+  802d9b:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802d9d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802da1:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802da5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802da9:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802dae:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802db5:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802db9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802dbe:	48 b8 59 2b 80 00 00 	movabs $0x802b59,%rax
+  802dc5:	00 00 00 
+  802dc8:	ff d0                	call   *%rax
+  802dca:	85 c0                	test   %eax,%eax
+  802dcc:	0f 89 6f ff ff ff    	jns    802d41 <devfile_write+0x98>
+                return ret;
+  802dd2:	48 98                	cltq
+  802dd4:	eb 0a                	jmp    802de0 <devfile_write+0x137>
+                return ret;
+  802dd6:	48 98                	cltq
+  802dd8:	eb 06                	jmp    802de0 <devfile_write+0x137>
+    size_t i = 0;
+  802dda:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802ddd:	4c 89 f0             	mov    %r14,%rax
+}
+  802de0:	48 83 c4 18          	add    $0x18,%rsp
+  802de4:	5b                   	pop    %rbx
+  802de5:	41 5c                	pop    %r12
+  802de7:	41 5d                	pop    %r13
+  802de9:	41 5e                	pop    %r14
+  802deb:	41 5f                	pop    %r15
+  802ded:	5d                   	pop    %rbp
+  802dee:	c3                   	ret
+        return -E_INVAL;
+  802def:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802df6:	eb e8                	jmp    802de0 <devfile_write+0x137>
+  802df8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802dff:	c3                   	ret
+
+0000000000802e00 <devfile_read>:
+    if (!fd || !buf) {
+  802e00:	48 85 ff             	test   %rdi,%rdi
+  802e03:	0f 84 47 01 00 00    	je     802f50 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e09:	55                   	push   %rbp
+  802e0a:	48 89 e5             	mov    %rsp,%rbp
+  802e0d:	41 57                	push   %r15
+  802e0f:	41 56                	push   %r14
+  802e11:	41 55                	push   %r13
+  802e13:	41 54                	push   %r12
+  802e15:	53                   	push   %rbx
+  802e16:	48 83 ec 18          	sub    $0x18,%rsp
+  802e1a:	49 89 ff             	mov    %rdi,%r15
+  802e1d:	49 89 f5             	mov    %rsi,%r13
+  802e20:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802e23:	48 85 f6             	test   %rsi,%rsi
+  802e26:	0f 84 1b 01 00 00    	je     802f47 <devfile_read+0x147>
+    while (n) {
+  802e2c:	48 85 d2             	test   %rdx,%rdx
+  802e2f:	0f 84 fb 00 00 00    	je     802f30 <devfile_read+0x130>
+    size_t i = 0;
+  802e35:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802e3c:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e3d:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802e44:	00 00 00 
+  802e47:	eb 5f                	jmp    802ea8 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802e49:	48 98                	cltq
+  802e4b:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802e50:	e9 e3 00 00 00       	jmp    802f38 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e55:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e59:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802e5c:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802e60:	be 00 00 00 00       	mov    $0x0,%esi
+  802e65:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e6a:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	89 c3                	mov    %eax,%ebx
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	0f 8e a7 00 00 00    	jle    802f27 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802e80:	48 63 d0             	movslq %eax,%rdx
+  802e83:	4c 89 f6             	mov    %r14,%rsi
+  802e86:	4c 89 ef             	mov    %r13,%rdi
+  802e89:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+        buf += ret;
+  802e95:	48 63 db             	movslq %ebx,%rbx
+  802e98:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802e9b:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802e9f:	49 29 dc             	sub    %rbx,%r12
+  802ea2:	0f 84 8c 00 00 00    	je     802f34 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802ea8:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802eaf:	76 a4                	jbe    802e55 <devfile_read+0x55>
+  802eb1:	48 b8 49 2c 80 00 00 	movabs $0x802c49,%rax
+  802eb8:	00 00 00 
+  802ebb:	ff d0                	call   *%rax
+  802ebd:	48 89 c1             	mov    %rax,%rcx
+  802ec0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec4:	48 85 c0             	test   %rax,%rax
+  802ec7:	74 8c                	je     802e55 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802ec9:	be 00 00 04 00       	mov    $0x40000,%esi
+  802ece:	49 39 f4             	cmp    %rsi,%r12
+  802ed1:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802ed5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ed9:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802edb:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802edf:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802ee6:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802eea:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802eef:	48 b8 59 2b 80 00 00 	movabs $0x802b59,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+  802efb:	89 c3                	mov    %eax,%ebx
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	0f 8e 44 ff ff ff    	jle    802e49 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f05:	48 63 d0             	movslq %eax,%rdx
+  802f08:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f0c:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f13:	4c 89 ef             	mov    %r13,%rdi
+  802f16:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  802f1d:	00 00 00 
+  802f20:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f22:	e9 6e ff ff ff       	jmp    802e95 <devfile_read+0x95>
+                return ret ? ret : i;
+  802f27:	48 98                	cltq
+  802f29:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802f2e:	eb 08                	jmp    802f38 <devfile_read+0x138>
+    size_t i = 0;
+  802f30:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802f34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802f38:	48 83 c4 18          	add    $0x18,%rsp
+  802f3c:	5b                   	pop    %rbx
+  802f3d:	41 5c                	pop    %r12
+  802f3f:	41 5d                	pop    %r13
+  802f41:	41 5e                	pop    %r14
+  802f43:	41 5f                	pop    %r15
+  802f45:	5d                   	pop    %rbp
+  802f46:	c3                   	ret
+        return -E_INVAL;
+  802f47:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f4e:	eb e8                	jmp    802f38 <devfile_read+0x138>
+  802f50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802f57:	c3                   	ret
+
+0000000000802f58 <open>:
+open(const char *path, int mode) {
+  802f58:	55                   	push   %rbp
+  802f59:	48 89 e5             	mov    %rsp,%rbp
+  802f5c:	41 55                	push   %r13
+  802f5e:	41 54                	push   %r12
+  802f60:	53                   	push   %rbx
+  802f61:	48 83 ec 18          	sub    $0x18,%rsp
+  802f65:	49 89 fc             	mov    %rdi,%r12
+  802f68:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f6b:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802f72:	00 00 00 
+  802f75:	ff d0                	call   *%rax
+  802f77:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f7d:	0f 87 8a 00 00 00    	ja     80300d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f83:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f87:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+  802f93:	89 c3                	mov    %eax,%ebx
+  802f95:	85 c0                	test   %eax,%eax
+  802f97:	78 50                	js     802fe9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f99:	4c 89 e6             	mov    %r12,%rsi
+  802f9c:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  802fa3:	00 00 00 
+  802fa6:	48 89 df             	mov    %rbx,%rdi
+  802fa9:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  802fb0:	00 00 00 
+  802fb3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802fb5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802fbc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fc0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fc5:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	89 c3                	mov    %eax,%ebx
+  802fd3:	85 c0                	test   %eax,%eax
+  802fd5:	78 1f                	js     802ff6 <open+0x9e>
+    return fd2num(fd);
+  802fd7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fdb:	48 b8 60 22 80 00 00 	movabs $0x802260,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	89 c3                	mov    %eax,%ebx
+}
+  802fe9:	89 d8                	mov    %ebx,%eax
+  802feb:	48 83 c4 18          	add    $0x18,%rsp
+  802fef:	5b                   	pop    %rbx
+  802ff0:	41 5c                	pop    %r12
+  802ff2:	41 5d                	pop    %r13
+  802ff4:	5d                   	pop    %rbp
+  802ff5:	c3                   	ret
+        fd_close(fd, 0);
+  802ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ffb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fff:	48 b8 ae 23 80 00 00 	movabs $0x8023ae,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+        return res;
+  80300b:	eb dc                	jmp    802fe9 <open+0x91>
+        return -E_BAD_PATH;
+  80300d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803012:	eb d5                	jmp    802fe9 <open+0x91>
+
+0000000000803014 <sync>:
+sync(void) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803018:	be 00 00 00 00       	mov    $0x0,%esi
+  80301d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803022:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+}
+  80302e:	5d                   	pop    %rbp
+  80302f:	c3                   	ret
+
+0000000000803030 <drop_cache>:
+drop_cache(int fdnum) {
+  803030:	55                   	push   %rbp
+  803031:	48 89 e5             	mov    %rsp,%rbp
+  803034:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803038:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80303c:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  803043:	00 00 00 
+  803046:	ff d0                	call   *%rax
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	78 51                	js     80309d <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80304c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803050:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803057:	00 00 00 
+  80305a:	8b 0a                	mov    (%rdx),%ecx
+  80305c:	39 08                	cmp    %ecx,(%rax)
+  80305e:	75 3f                	jne    80309f <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  803060:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803067:	00 
+  803068:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80306f:	00 
+  803070:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803077:	00 
+  803078:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80307f:	00 
+  803080:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803084:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803088:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80308c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803091:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  803098:	00 00 00 
+  80309b:	ff d0                	call   *%rax
+}
+  80309d:	c9                   	leave
+  80309e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80309f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030a4:	eb f7                	jmp    80309d <drop_cache+0x6d>
+
+00000000008030a6 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  8030a6:	55                   	push   %rbp
+  8030a7:	48 89 e5             	mov    %rsp,%rbp
+  8030aa:	41 57                	push   %r15
+  8030ac:	41 56                	push   %r14
+  8030ae:	41 55                	push   %r13
+  8030b0:	41 54                	push   %r12
+  8030b2:	53                   	push   %rbx
+  8030b3:	48 83 ec 58          	sub    $0x58,%rsp
+  8030b7:	41 89 f4             	mov    %esi,%r12d
+  8030ba:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8030be:	49 89 cd             	mov    %rcx,%r13
+  8030c1:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030c4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8030c8:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8030cf:	00 00 00 
+  8030d2:	ff d0                	call   *%rax
+  8030d4:	48 63 d0             	movslq %eax,%rdx
+  8030d7:	85 c0                	test   %eax,%eax
+  8030d9:	0f 88 36 01 00 00    	js     803215 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8030df:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030e3:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8030ea:	00 00 00 
+  8030ed:	8b 32                	mov    (%rdx),%esi
+  8030ef:	39 31                	cmp    %esi,(%rcx)
+  8030f1:	0f 85 30 01 00 00    	jne    803227 <read_map+0x181>
+  8030f7:	45 85 e4             	test   %r12d,%r12d
+  8030fa:	0f 88 27 01 00 00    	js     803227 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803100:	49 63 cc             	movslq %r12d,%rcx
+  803103:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803107:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80310e:	0f 85 1c 01 00 00    	jne    803230 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803114:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803118:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80311f:	0f 85 14 01 00 00    	jne    803239 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803125:	48 63 cb             	movslq %ebx,%rcx
+  803128:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80312c:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  803133:	00 00 00 
+    while (i < n) {
+  803136:	4d 85 ed             	test   %r13,%r13
+  803139:	75 5c                	jne    803197 <read_map+0xf1>
+  80313b:	e9 d2 00 00 00       	jmp    803212 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  803140:	41 8b 3e             	mov    (%r14),%edi
+  803143:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  803147:	50                   	push   %rax
+  803148:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  80314c:	50                   	push   %rax
+  80314d:	4d 89 f9             	mov    %r15,%r9
+  803150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803156:	48 89 d9             	mov    %rbx,%rcx
+  803159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315e:	be 09 00 00 00       	mov    $0x9,%esi
+  803163:	48 b8 89 4d 80 00 00 	movabs $0x804d89,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  80316f:	48 83 c4 10          	add    $0x10,%rsp
+  803173:	85 c0                	test   %eax,%eax
+  803175:	0f 8e 8f 00 00 00    	jle    80320a <read_map+0x164>
+        if (!mapped_perm) {
+  80317b:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  80317f:	0f 84 80 00 00 00    	je     803205 <read_map+0x15f>
+        i += res;
+  803185:	48 63 d0             	movslq %eax,%rdx
+  803188:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80318b:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803190:	75 78                	jne    80320a <read_map+0x164>
+    while (i < n) {
+  803192:	4d 39 ec             	cmp    %r13,%r12
+  803195:	73 73                	jae    80320a <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80319b:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80319f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031a3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8031a7:	4c 01 e0             	add    %r12,%rax
+  8031aa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8031ae:	4c 89 eb             	mov    %r13,%rbx
+  8031b1:	4c 29 e3             	sub    %r12,%rbx
+  8031b4:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  8031b8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8031bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  8031c0:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  8031c7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8031ce:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8031d3:	48 39 c3             	cmp    %rax,%rbx
+  8031d6:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  8031da:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8031de:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031e2:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  8031e6:	0f 85 54 ff ff ff    	jne    803140 <read_map+0x9a>
+  8031ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031f1:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	41 89 06             	mov    %eax,(%r14)
+  803200:	e9 3b ff ff ff       	jmp    803140 <read_map+0x9a>
+            res = -E_INVAL;
+  803205:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  80320a:	4c 89 e2             	mov    %r12,%rdx
+  80320d:	4d 85 e4             	test   %r12,%r12
+  803210:	75 03                	jne    803215 <read_map+0x16f>
+  803212:	48 63 d0             	movslq %eax,%rdx
+}
+  803215:	48 89 d0             	mov    %rdx,%rax
+  803218:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80321c:	5b                   	pop    %rbx
+  80321d:	41 5c                	pop    %r12
+  80321f:	41 5d                	pop    %r13
+  803221:	41 5e                	pop    %r14
+  803223:	41 5f                	pop    %r15
+  803225:	5d                   	pop    %rbp
+  803226:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803227:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80322e:	eb e5                	jmp    803215 <read_map+0x16f>
+  803230:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803237:	eb dc                	jmp    803215 <read_map+0x16f>
+  803239:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  803240:	eb d3                	jmp    803215 <read_map+0x16f>
+
+0000000000803242 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  803242:	55                   	push   %rbp
+  803243:	48 89 e5             	mov    %rsp,%rbp
+  803246:	41 57                	push   %r15
+  803248:	41 56                	push   %r14
+  80324a:	41 55                	push   %r13
+  80324c:	41 54                	push   %r12
+  80324e:	53                   	push   %rbx
+  80324f:	48 83 ec 38          	sub    $0x38,%rsp
+  803253:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803256:	41 89 f6             	mov    %esi,%r14d
+  803259:	49 89 d5             	mov    %rdx,%r13
+  80325c:	89 cb                	mov    %ecx,%ebx
+  80325e:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  803261:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803265:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+  803271:	85 c0                	test   %eax,%eax
+  803273:	0f 88 33 02 00 00    	js     8034ac <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803279:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  80327e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803282:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803289:	00 00 00 
+  80328c:	8b 3a                	mov    (%rdx),%edi
+  80328e:	39 39                	cmp    %edi,(%rcx)
+  803290:	0f 85 1b 02 00 00    	jne    8034b1 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803296:	4d 85 ed             	test   %r13,%r13
+  803299:	41 0f 94 c0          	sete   %r8b
+  80329d:	44 89 f0             	mov    %r14d,%eax
+  8032a0:	c1 e8 1f             	shr    $0x1f,%eax
+  8032a3:	41 08 c0             	or     %al,%r8b
+  8032a6:	0f 85 14 02 00 00    	jne    8034c0 <mmap+0x27e>
+  8032ac:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8032b3:	0f 85 0e 02 00 00    	jne    8034c7 <mmap+0x285>
+  8032b9:	83 fb 07             	cmp    $0x7,%ebx
+  8032bc:	0f 87 0c 02 00 00    	ja     8034ce <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032c2:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8032c7:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  8032cc:	83 fa 01             	cmp    $0x1,%edx
+  8032cf:	0f 87 dc 01 00 00    	ja     8034b1 <mmap+0x26f>
+  8032d5:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  8032dc:	00 00 00 
+  8032df:	eb 0e                	jmp    8032ef <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8032e1:	48 83 c0 01          	add    $0x1,%rax
+  8032e5:	48 83 c2 20          	add    $0x20,%rdx
+  8032e9:	48 83 f8 40          	cmp    $0x40,%rax
+  8032ed:	74 44                	je     803333 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  8032ef:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8032f3:	75 ec                	jne    8032e1 <mmap+0x9f>
+  8032f5:	48 c1 e0 05          	shl    $0x5,%rax
+  8032f9:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  803300:	00 00 00 
+  803303:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803307:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80330e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803315:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803318:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  80331f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  803327:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  80332e:	00 00 00 
+  803331:	eb 17                	jmp    80334a <mmap+0x108>
+  803333:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803338:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80333e:	eb c7                	jmp    803307 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803340:	48 83 c0 01          	add    $0x1,%rax
+  803344:	48 83 f8 3f          	cmp    $0x3f,%rax
+  803348:	77 37                	ja     803381 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  80334a:	48 89 c2             	mov    %rax,%rdx
+  80334d:	48 c1 e2 05          	shl    $0x5,%rdx
+  803351:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  803356:	48 85 d2             	test   %rdx,%rdx
+  803359:	74 e5                	je     803340 <mmap+0xfe>
+  80335b:	48 89 c7             	mov    %rax,%rdi
+  80335e:	48 c1 e7 05          	shl    $0x5,%rdi
+  803362:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  803366:	48 01 fa             	add    %rdi,%rdx
+  803369:	48 39 d6             	cmp    %rdx,%rsi
+  80336c:	73 d2                	jae    803340 <mmap+0xfe>
+  80336e:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  803372:	4c 39 d7             	cmp    %r10,%rdi
+  803375:	73 c9                	jae    803340 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  803377:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80337a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80337f:	eb c9                	jmp    80334a <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803381:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  80338a:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803391:	00 00 00 
+  803394:	49 39 f9             	cmp    %rdi,%r9
+  803397:	0f 82 14 01 00 00    	jb     8034b1 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80339d:	48 85 f6             	test   %rsi,%rsi
+  8033a0:	0f 84 2f 01 00 00    	je     8034d5 <mmap+0x293>
+  8033a6:	45 84 c0             	test   %r8b,%r8b
+  8033a9:	0f 85 26 01 00 00    	jne    8034d5 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  8033af:	41 83 fc 01          	cmp    $0x1,%r12d
+  8033b3:	0f 94 c0             	sete   %al
+  8033b6:	0f b6 c0             	movzbl %al,%eax
+  8033b9:	c1 e0 06             	shl    $0x6,%eax
+  8033bc:	09 d8                	or     %ebx,%eax
+  8033be:	89 c3                	mov    %eax,%ebx
+  8033c0:	83 cb 04             	or     $0x4,%ebx
+  8033c3:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  8033c6:	4d 85 ff             	test   %r15,%r15
+  8033c9:	0f 84 bd 00 00 00    	je     80348c <mmap+0x24a>
+  8033cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  8033d4:	83 e0 bf             	and    $0xffffffbf,%eax
+  8033d7:	83 c8 04             	or     $0x4,%eax
+  8033da:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  8033dd:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8033e1:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  8033e5:	49 89 f6             	mov    %rsi,%r14
+  8033e8:	eb 43                	jmp    80342d <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  8033ea:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8033f0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8033f6:	48 01 c3             	add    %rax,%rbx
+            continue;
+  8033f9:	eb 2d                	jmp    803428 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  8033fb:	48 85 c0             	test   %rax,%rax
+  8033fe:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803403:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803407:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  80340a:	4c 89 e2             	mov    %r12,%rdx
+  80340d:	4c 89 ee             	mov    %r13,%rsi
+  803410:	bf 00 00 00 00       	mov    $0x0,%edi
+  803415:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  80341c:	00 00 00 
+  80341f:	ff d0                	call   *%rax
+  803421:	85 c0                	test   %eax,%eax
+  803423:	78 3e                	js     803463 <mmap+0x221>
+        i += n;
+  803425:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  803428:	4c 39 fb             	cmp    %r15,%rbx
+  80342b:	73 54                	jae    803481 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  80342d:	4d 89 fc             	mov    %r15,%r12
+  803430:	49 29 dc             	sub    %rbx,%r12
+  803433:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  803437:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80343a:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  80343d:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  803441:	4c 89 e1             	mov    %r12,%rcx
+  803444:	4c 89 ea             	mov    %r13,%rdx
+  803447:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80344a:	48 b8 a6 30 80 00 00 	movabs $0x8030a6,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+        if (res > 0) {
+  803456:	48 85 c0             	test   %rax,%rax
+  803459:	7f 8f                	jg     8033ea <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  80345b:	74 9e                	je     8033fb <mmap+0x1b9>
+  80345d:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  803461:	74 98                	je     8033fb <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  803463:	4c 89 f6             	mov    %r14,%rsi
+  803466:	4c 89 fa             	mov    %r15,%rdx
+  803469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346e:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+    return NULL;
+  80347a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347f:	eb 30                	jmp    8034b1 <mmap+0x26f>
+  803481:	4c 89 f6             	mov    %r14,%rsi
+  803484:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803488:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  80348c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803490:	8b 40 0c             	mov    0xc(%rax),%eax
+  803493:	48 89 31             	mov    %rsi,(%rcx)
+  803496:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  80349a:	89 41 10             	mov    %eax,0x10(%rcx)
+  80349d:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  8034a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034a4:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  8034a7:	48 89 f0             	mov    %rsi,%rax
+  8034aa:	eb 05                	jmp    8034b1 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8034ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b1:	48 83 c4 38          	add    $0x38,%rsp
+  8034b5:	5b                   	pop    %rbx
+  8034b6:	41 5c                	pop    %r12
+  8034b8:	41 5d                	pop    %r13
+  8034ba:	41 5e                	pop    %r14
+  8034bc:	41 5f                	pop    %r15
+  8034be:	5d                   	pop    %rbp
+  8034bf:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8034c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c5:	eb ea                	jmp    8034b1 <mmap+0x26f>
+  8034c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cc:	eb e3                	jmp    8034b1 <mmap+0x26f>
+  8034ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d3:	eb dc                	jmp    8034b1 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8034d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034da:	eb d5                	jmp    8034b1 <mmap+0x26f>
+
+00000000008034dc <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  8034dc:	55                   	push   %rbp
+  8034dd:	48 89 e5             	mov    %rsp,%rbp
+  8034e0:	41 57                	push   %r15
+  8034e2:	41 56                	push   %r14
+  8034e4:	41 55                	push   %r13
+  8034e6:	41 54                	push   %r12
+  8034e8:	53                   	push   %rbx
+  8034e9:	48 83 ec 38          	sub    $0x38,%rsp
+  8034ed:	49 89 fc             	mov    %rdi,%r12
+  8034f0:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8034f3:	48 b8 a2 29 80 00 00 	movabs $0x8029a2,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8034ff:	48 85 c0             	test   %rax,%rax
+  803502:	0f 84 2f 01 00 00    	je     803637 <msync+0x15b>
+  803508:	49 89 c7             	mov    %rax,%r15
+  80350b:	4d 01 e5             	add    %r12,%r13
+  80350e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803512:	49 03 07             	add    (%r15),%rax
+  803515:	4c 39 e8             	cmp    %r13,%rax
+  803518:	0f 82 20 01 00 00    	jb     80363e <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  80351e:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803522:	83 e0 40             	and    $0x40,%eax
+  803525:	0f 84 fd 00 00 00    	je     803628 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80352b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803532:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803539:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803540:	4d 39 ec             	cmp    %r13,%r12
+  803543:	0f 83 fc 00 00 00    	jae    803645 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  803549:	49 be a1 49 80 00 00 	movabs $0x8049a1,%r14
+  803550:	00 00 00 
+  803553:	e9 b0 00 00 00       	jmp    803608 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  803558:	4c 89 e3             	mov    %r12,%rbx
+  80355b:	4d 39 ec             	cmp    %r13,%r12
+  80355e:	73 16                	jae    803576 <msync+0x9a>
+  803560:	48 89 df             	mov    %rbx,%rdi
+  803563:	41 ff d6             	call   *%r14
+  803566:	84 c0                	test   %al,%al
+  803568:	74 0c                	je     803576 <msync+0x9a>
+  80356a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803571:	4c 39 eb             	cmp    %r13,%rbx
+  803574:	72 ea                	jb     803560 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  803576:	48 89 d8             	mov    %rbx,%rax
+  803579:	4c 29 e0             	sub    %r12,%rax
+  80357c:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  803580:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803584:	49 89 c0             	mov    %rax,%r8
+  803587:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80358b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803590:	48 89 ce             	mov    %rcx,%rsi
+  803593:	bf 00 00 00 00       	mov    $0x0,%edi
+  803598:	49 ba af 18 80 00 00 	movabs $0x8018af,%r10
+  80359f:	00 00 00 
+  8035a2:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8035a5:	85 c0                	test   %eax,%eax
+  8035a7:	78 7f                	js     803628 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8035a9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8035b0:	00 
+  8035b1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8035b8:	00 
+  8035b9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8035c0:	00 
+  8035c1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8035c8:	00 
+  8035c9:	49 63 47 10          	movslq 0x10(%r15),%rax
+  8035cd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8035d1:	49 63 47 14          	movslq 0x14(%r15),%rax
+  8035d5:	49 2b 07             	sub    (%r15),%rax
+  8035d8:	4c 01 e0             	add    %r12,%rax
+  8035db:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8035df:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8035e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  8035e7:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  8035eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8035f0:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  8035f7:	00 00 00 
+  8035fa:	ff d0                	call   *%rax
+  8035fc:	85 c0                	test   %eax,%eax
+  8035fe:	78 28                	js     803628 <msync+0x14c>
+  803600:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803603:	4d 39 ec             	cmp    %r13,%r12
+  803606:	73 1b                	jae    803623 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803608:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80360c:	4c 89 e7             	mov    %r12,%rdi
+  80360f:	41 ff d6             	call   *%r14
+  803612:	84 c0                	test   %al,%al
+  803614:	0f 85 3e ff ff ff    	jne    803558 <msync+0x7c>
+            va += PAGE_SIZE;
+  80361a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803621:	eb e0                	jmp    803603 <msync+0x127>
+    }
+
+    return 0;
+  803623:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803628:	48 83 c4 38          	add    $0x38,%rsp
+  80362c:	5b                   	pop    %rbx
+  80362d:	41 5c                	pop    %r12
+  80362f:	41 5d                	pop    %r13
+  803631:	41 5e                	pop    %r14
+  803633:	41 5f                	pop    %r15
+  803635:	5d                   	pop    %rbp
+  803636:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803637:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80363c:	eb ea                	jmp    803628 <msync+0x14c>
+  80363e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803643:	eb e3                	jmp    803628 <msync+0x14c>
+    return 0;
+  803645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364a:	eb dc                	jmp    803628 <msync+0x14c>
+
+000000000080364c <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  80364c:	55                   	push   %rbp
+  80364d:	48 89 e5             	mov    %rsp,%rbp
+  803650:	41 55                	push   %r13
+  803652:	41 54                	push   %r12
+  803654:	53                   	push   %rbx
+  803655:	48 83 ec 08          	sub    $0x8,%rsp
+  803659:	49 89 fc             	mov    %rdi,%r12
+  80365c:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  80365f:	48 b8 a2 29 80 00 00 	movabs $0x8029a2,%rax
+  803666:	00 00 00 
+  803669:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80366b:	48 85 c0             	test   %rax,%rax
+  80366e:	74 58                	je     8036c8 <munmap+0x7c>
+  803670:	48 89 c3             	mov    %rax,%rbx
+  803673:	4c 3b 20             	cmp    (%rax),%r12
+  803676:	75 57                	jne    8036cf <munmap+0x83>
+  803678:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  80367f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803685:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803689:	75 4b                	jne    8036d6 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  80368b:	4c 89 ee             	mov    %r13,%rsi
+  80368e:	4c 89 e7             	mov    %r12,%rdi
+  803691:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  803698:	00 00 00 
+  80369b:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  80369d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036a1:	4c 89 e6             	mov    %r12,%rsi
+  8036a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a9:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  8036b0:	00 00 00 
+  8036b3:	ff d0                	call   *%rax
+    m->m_size = 0;
+  8036b5:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8036bc:	00 
+    return res;
+}
+  8036bd:	48 83 c4 08          	add    $0x8,%rsp
+  8036c1:	5b                   	pop    %rbx
+  8036c2:	41 5c                	pop    %r12
+  8036c4:	41 5d                	pop    %r13
+  8036c6:	5d                   	pop    %rbp
+  8036c7:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036cd:	eb ee                	jmp    8036bd <munmap+0x71>
+  8036cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036d4:	eb e7                	jmp    8036bd <munmap+0x71>
+  8036d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036db:	eb e0                	jmp    8036bd <munmap+0x71>
+
+00000000008036dd <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8036dd:	55                   	push   %rbp
+  8036de:	48 89 e5             	mov    %rsp,%rbp
+  8036e1:	41 55                	push   %r13
+  8036e3:	41 54                	push   %r12
+  8036e5:	53                   	push   %rbx
+  8036e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8036ea:	48 89 fb             	mov    %rdi,%rbx
+  8036ed:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8036f0:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8036f3:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  8036fa:	00 00 00 
+  8036fd:	ff d0                	call   *%rax
+  8036ff:	41 89 c1             	mov    %eax,%r9d
+  803702:	4d 89 e0             	mov    %r12,%r8
+  803705:	49 29 d8             	sub    %rbx,%r8
+  803708:	48 89 d9             	mov    %rbx,%rcx
+  80370b:	44 89 ea             	mov    %r13d,%edx
+  80370e:	48 89 de             	mov    %rbx,%rsi
+  803711:	bf 00 00 00 00       	mov    $0x0,%edi
+  803716:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  80371d:	00 00 00 
+  803720:	ff d0                	call   *%rax
+}
+  803722:	48 83 c4 08          	add    $0x8,%rsp
+  803726:	5b                   	pop    %rbx
+  803727:	41 5c                	pop    %r12
+  803729:	41 5d                	pop    %r13
+  80372b:	5d                   	pop    %rbp
+  80372c:	c3                   	ret
+
+000000000080372d <spawn>:
+spawn(const char *prog, const char **argv) {
+  80372d:	55                   	push   %rbp
+  80372e:	48 89 e5             	mov    %rsp,%rbp
+  803731:	41 57                	push   %r15
+  803733:	41 56                	push   %r14
+  803735:	41 55                	push   %r13
+  803737:	41 54                	push   %r12
+  803739:	53                   	push   %rbx
+  80373a:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803741:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  803744:	be 00 00 00 00       	mov    $0x0,%esi
+  803749:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  803750:	00 00 00 
+  803753:	ff d0                	call   *%rax
+  803755:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+    if (fd < 0) return fd;
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	0f 88 1a 07 00 00    	js     803e7d <spawn+0x750>
+  803763:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803765:	ba 00 02 00 00       	mov    $0x200,%edx
+  80376a:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803771:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  803778:	00 00 00 
+  80377b:	ff d0                	call   *%rax
+  80377d:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80377f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803784:	0f 85 78 02 00 00    	jne    803a02 <spawn+0x2d5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80378a:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803791:	ff ff 00 
+  803794:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80379b:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8037a2:	01 01 00 
+  8037a5:	48 39 d0             	cmp    %rdx,%rax
+  8037a8:	0f 85 90 02 00 00    	jne    803a3e <spawn+0x311>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8037ae:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8037b5:	00 3e 00 
+  8037b8:	0f 85 80 02 00 00    	jne    803a3e <spawn+0x311>
+    asm volatile("int %2"
+  8037be:	b8 09 00 00 00       	mov    $0x9,%eax
+  8037c3:	cd 30                	int    $0x30
+  8037c5:	41 89 c6             	mov    %eax,%r14d
+  8037c8:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8037ca:	85 c0                	test   %eax,%eax
+  8037cc:	0f 88 93 06 00 00    	js     803e65 <spawn+0x738>
+    envid_t child = res;
+  8037d2:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8037d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037dd:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8037e4:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8037eb:	00 00 00 
+  8037ee:	48 01 c6             	add    %rax,%rsi
+  8037f1:	48 8b 06             	mov    (%rsi),%rax
+  8037f4:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8037fb:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803802:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803809:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803810:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803817:	48 29 ce             	sub    %rcx,%rsi
+  80381a:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803820:	c1 e9 03             	shr    $0x3,%ecx
+  803823:	89 c9                	mov    %ecx,%ecx
+  803825:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803828:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80382f:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803836:	49 8b 3c 24          	mov    (%r12),%rdi
+  80383a:	48 85 ff             	test   %rdi,%rdi
+  80383d:	0f 84 5b 06 00 00    	je     803e9e <spawn+0x771>
+  803843:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803849:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80384f:	48 bb 5a 12 80 00 00 	movabs $0x80125a,%rbx
+  803856:	00 00 00 
+  803859:	ff d3                	call   *%rbx
+  80385b:	4c 01 f8             	add    %r15,%rax
+  80385e:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803862:	4c 89 ea             	mov    %r13,%rdx
+  803865:	49 83 c5 01          	add    $0x1,%r13
+  803869:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80386e:	48 85 ff             	test   %rdi,%rdi
+  803871:	75 e6                	jne    803859 <spawn+0x12c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803873:	49 89 d5             	mov    %rdx,%r13
+  803876:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  80387d:	48 f7 d0             	not    %rax
+  803880:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803887:	49 89 df             	mov    %rbx,%r15
+  80388a:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  80388e:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803895:	89 d0                	mov    %edx,%eax
+  803897:	83 c0 01             	add    $0x1,%eax
+  80389a:	48 98                	cltq
+  80389c:	48 c1 e0 03          	shl    $0x3,%rax
+  8038a0:	49 29 c7             	sub    %rax,%r15
+  8038a3:	4c 89 bd f8 fc ff ff 	mov    %r15,-0x308(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8038aa:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8038ae:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8038b4:	0f 86 db 05 00 00    	jbe    803e95 <spawn+0x768>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8038ba:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8038bf:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8038c4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8038c9:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+  8038d5:	85 c0                	test   %eax,%eax
+  8038d7:	0f 88 bd 05 00 00    	js     803e9a <spawn+0x76d>
+    for (i = 0; i < argc; i++) {
+  8038dd:	4c 89 e8             	mov    %r13,%rax
+  8038e0:	45 85 ed             	test   %r13d,%r13d
+  8038e3:	7e 54                	jle    803939 <spawn+0x20c>
+  8038e5:	4d 89 fd             	mov    %r15,%r13
+  8038e8:	48 98                	cltq
+  8038ea:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8038ee:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8038f5:	00 00 00 
+  8038f8:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8038ff:	ff 
+  803900:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803904:	49 8b 34 24          	mov    (%r12),%rsi
+  803908:	48 89 df             	mov    %rbx,%rdi
+  80390b:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803917:	49 8b 3c 24          	mov    (%r12),%rdi
+  80391b:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+  803927:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80392c:	49 83 c5 08          	add    $0x8,%r13
+  803930:	49 83 c4 08          	add    $0x8,%r12
+  803934:	4d 39 fd             	cmp    %r15,%r13
+  803937:	75 b5                	jne    8038ee <spawn+0x1c1>
+    argv_store[argc] = 0;
+  803939:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803940:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803947:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803948:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80394f:	0f 85 30 01 00 00    	jne    803a85 <spawn+0x358>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803955:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80395c:	00 00 00 
+  80395f:	48 8b 9d f8 fc ff ff 	mov    -0x308(%rbp),%rbx
+  803966:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80396d:	ff 
+  80396e:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803972:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803979:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80397d:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803984:	00 00 00 
+  803987:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80398e:	ff 
+  80398f:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803996:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80399c:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8039a2:	44 89 f2             	mov    %r14d,%edx
+  8039a5:	be 00 00 40 00       	mov    $0x400000,%esi
+  8039aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039af:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8039bb:	48 bb 7c 19 80 00 00 	movabs $0x80197c,%rbx
+  8039c2:	00 00 00 
+  8039c5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8039ca:	be 00 00 40 00       	mov    $0x400000,%esi
+  8039cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d4:	ff d3                	call   *%rbx
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	78 eb                	js     8039c5 <spawn+0x298>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8039da:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8039e1:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  8039e8:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8039e9:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8039f0:	00 
+  8039f1:	0f 84 53 03 00 00    	je     803d4a <spawn+0x61d>
+  8039f7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8039fd:	e9 ae 01 00 00       	jmp    803bb0 <spawn+0x483>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803a02:	48 bf e0 67 80 00 00 	movabs $0x8067e0,%rdi
+  803a09:	00 00 00 
+  803a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a11:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  803a18:	00 00 00 
+  803a1b:	ff d2                	call   *%rdx
+        close(fd);
+  803a1d:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803a23:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803a2f:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803a36:	ff ff ff 
+  803a39:	e9 3f 04 00 00       	jmp    803e7d <spawn+0x750>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803a3e:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803a43:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803a49:	48 bf 40 68 80 00 00 	movabs $0x806840,%rdi
+  803a50:	00 00 00 
+  803a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a58:	48 b9 73 09 80 00 00 	movabs $0x800973,%rcx
+  803a5f:	00 00 00 
+  803a62:	ff d1                	call   *%rcx
+        close(fd);
+  803a64:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803a6a:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  803a71:	00 00 00 
+  803a74:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803a76:	c7 85 f4 fc ff ff ee 	movl   $0xffffffee,-0x30c(%rbp)
+  803a7d:	ff ff ff 
+  803a80:	e9 f8 03 00 00       	jmp    803e7d <spawn+0x750>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803a85:	48 b9 10 68 80 00 00 	movabs $0x806810,%rcx
+  803a8c:	00 00 00 
+  803a8f:	48 ba 5a 68 80 00 00 	movabs $0x80685a,%rdx
+  803a96:	00 00 00 
+  803a99:	be ef 00 00 00       	mov    $0xef,%esi
+  803a9e:	48 bf 6f 68 80 00 00 	movabs $0x80686f,%rdi
+  803aa5:	00 00 00 
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aad:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  803ab4:	00 00 00 
+  803ab7:	41 ff d0             	call   *%r8
+        fileoffset -= res;
+    }
+    if (!filesz)
+        filesz = 1;
+    /* Allocate filesz - memsz in child */
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  803aba:	4b 8d b4 35 ff 0f 00 	lea    0xfff(%r13,%r14,1),%rsi
+  803ac1:	00 
+  803ac2:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803ac9:	89 d9                	mov    %ebx,%ecx
+  803acb:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  803ad1:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803ad8:	00 00 00 
+  803adb:	ff d0                	call   *%rax
+  803add:	85 c0                	test   %eax,%eax
+  803adf:	0f 89 4a 01 00 00    	jns    803c2f <spawn+0x502>
+  803ae5:	89 c3                	mov    %eax,%ebx
+  803ae7:	e9 67 03 00 00       	jmp    803e53 <spawn+0x726>
+    /* Map as much of filesz as possible from the file server's
+     * block cache to UTEMP copy-on-write, then allocate the rest
+     * (if any) in parent and read it there */
+    size_t mapped = 0;
+    if (!PAGE_OFFSET(fileoffset)) {
+        ssize_t count = read_map(fd, fileoffset, UTEMP, filesz, PROT_RW);
+  803aec:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803af2:	4c 89 f1             	mov    %r14,%rcx
+  803af5:	ba 00 00 40 00       	mov    $0x400000,%edx
+  803afa:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  803b00:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803b06:	48 b8 a6 30 80 00 00 	movabs $0x8030a6,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+        if (count > 0) mapped = MIN((size_t)count, filesz);
+  803b12:	48 85 c0             	test   %rax,%rax
+  803b15:	0f 8e 24 01 00 00    	jle    803c3f <spawn+0x512>
+  803b1b:	4c 39 f0             	cmp    %r14,%rax
+  803b1e:	49 0f 47 c6          	cmova  %r14,%rax
+    }
+
+    if (mapped < filesz) {
+  803b22:	4c 39 f0             	cmp    %r14,%rax
+  803b25:	0f 82 19 01 00 00    	jb     803c44 <spawn+0x517>
+
+        /* read filesz to UTEMP */
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+            return res;
+        }
+    } else if (PAGE_OFFSET(filesz)) {
+  803b2b:	4c 89 f0             	mov    %r14,%rax
+  803b2e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803b33:	0f 85 dd 01 00 00    	jne    803d16 <spawn+0x5e9>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+    }
+
+    /* Map read section contents to child, copy-on-write
+     * so that the block cache pages are not copied here */
+    if ((res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, PAGE_SIZE), perm | PROT_LAZY)) < 0) {
+  803b39:	49 81 c6 ff 0f 00 00 	add    $0xfff,%r14
+  803b40:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+  803b47:	80 cb 80             	or     $0x80,%bl
+  803b4a:	41 89 d9             	mov    %ebx,%r9d
+  803b4d:	4d 89 f0             	mov    %r14,%r8
+  803b50:	4c 89 e9             	mov    %r13,%rcx
+  803b53:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803b59:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b63:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  803b6a:	00 00 00 
+  803b6d:	ff d0                	call   *%rax
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	0f 88 da 02 00 00    	js     803e51 <spawn+0x724>
+        return res;
+    }
+
+    /* Unmap it from parent */
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  803b77:	4c 89 f2             	mov    %r14,%rdx
+  803b7a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b84:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803b90:	85 c0                	test   %eax,%eax
+  803b92:	0f 88 a3 01 00 00    	js     803d3b <spawn+0x60e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803b98:	49 83 c7 01          	add    $0x1,%r15
+  803b9c:	49 83 c4 38          	add    $0x38,%r12
+  803ba0:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803ba7:	49 39 c7             	cmp    %rax,%r15
+  803baa:	0f 83 9a 01 00 00    	jae    803d4a <spawn+0x61d>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803bb0:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  803bb5:	75 e1                	jne    803b98 <spawn+0x46b>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803bb7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803bbc:	89 c3                	mov    %eax,%ebx
+  803bbe:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803bc1:	89 da                	mov    %ebx,%edx
+  803bc3:	83 ca 04             	or     $0x4,%edx
+  803bc6:	a8 04                	test   $0x4,%al
+  803bc8:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803bcb:	89 da                	mov    %ebx,%edx
+  803bcd:	83 ca 01             	or     $0x1,%edx
+  803bd0:	a8 01                	test   $0x1,%al
+  803bd2:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803bd5:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  803bda:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+  803be0:	4d 8b 74 24 20       	mov    0x20(%r12),%r14
+  803be5:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  803bea:	4d 8b 6c 24 10       	mov    0x10(%r12),%r13
+  803bef:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803bf5:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  803bfb:	44 89 e9             	mov    %r13d,%ecx
+  803bfe:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  803c04:	74 14                	je     803c1a <spawn+0x4ed>
+        va -= res;
+  803c06:	48 63 f1             	movslq %ecx,%rsi
+  803c09:	49 29 f5             	sub    %rsi,%r13
+        memsz += res;
+  803c0c:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  803c0f:	49 01 f6             	add    %rsi,%r14
+        fileoffset -= res;
+  803c12:	29 c8                	sub    %ecx,%eax
+  803c14:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (!filesz)
+  803c1a:	4d 85 f6             	test   %r14,%r14
+  803c1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c22:	4c 0f 44 f0          	cmove  %rax,%r14
+    if (memsz > filesz && (res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, PAGE_SIZE), memsz, perm)) < 0) {
+  803c26:	49 39 d6             	cmp    %rdx,%r14
+  803c29:	0f 82 8b fe ff ff    	jb     803aba <spawn+0x38d>
+    if (!PAGE_OFFSET(fileoffset)) {
+  803c2f:	f7 85 f8 fc ff ff ff 	testl  $0xfff,-0x308(%rbp)
+  803c36:	0f 00 00 
+  803c39:	0f 84 ad fe ff ff    	je     803aec <spawn+0x3bf>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+        mapped = ROUNDDOWN(mapped, PAGE_SIZE);
+  803c44:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803c4a:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+        if ((res = sys_alloc_region(0, UTEMP + mapped, ROUNDUP(filesz, PAGE_SIZE) - mapped, PTE_P | PTE_U | PTE_W)) < 0) {
+  803c51:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  803c58:	48 89 b5 d8 fc ff ff 	mov    %rsi,-0x328(%rbp)
+  803c5f:	49 8d 96 ff 0f 00 00 	lea    0xfff(%r14),%rdx
+  803c66:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803c6d:	48 29 c2             	sub    %rax,%rdx
+  803c70:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7a:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803c81:	00 00 00 
+  803c84:	ff d0                	call   *%rax
+  803c86:	85 c0                	test   %eax,%eax
+  803c88:	78 5d                	js     803ce7 <spawn+0x5ba>
+        if ((res = seek(fd, fileoffset + mapped)) < 0) {
+  803c8a:	8b b5 f8 fc ff ff    	mov    -0x308(%rbp),%esi
+  803c90:	8b 8d e0 fc ff ff    	mov    -0x320(%rbp),%ecx
+  803c96:	01 ce                	add    %ecx,%esi
+  803c98:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803c9e:	48 b9 fd 27 80 00 00 	movabs $0x8027fd,%rcx
+  803ca5:	00 00 00 
+  803ca8:	ff d1                	call   *%rcx
+  803caa:	85 c0                	test   %eax,%eax
+  803cac:	0f 88 9b 01 00 00    	js     803e4d <spawn+0x720>
+        if ((res = readn(fd, UTEMP + mapped, filesz - mapped)) < 0) {
+  803cb2:	4c 89 f2             	mov    %r14,%rdx
+  803cb5:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803cbc:	48 29 c2             	sub    %rax,%rdx
+  803cbf:	48 8b b5 d8 fc ff ff 	mov    -0x328(%rbp),%rsi
+  803cc6:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803ccc:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+  803cd8:	85 c0                	test   %eax,%eax
+  803cda:	0f 89 59 fe ff ff    	jns    803b39 <spawn+0x40c>
+  803ce0:	89 c3                	mov    %eax,%ebx
+  803ce2:	e9 6c 01 00 00       	jmp    803e53 <spawn+0x726>
+            cprintf("Allocating %lu\n", filesz - mapped);
+  803ce7:	89 c3                	mov    %eax,%ebx
+  803ce9:	4c 89 f6             	mov    %r14,%rsi
+  803cec:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  803cf3:	48 29 c6             	sub    %rax,%rsi
+  803cf6:	48 bf 7b 68 80 00 00 	movabs $0x80687b,%rdi
+  803cfd:	00 00 00 
+  803d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d05:	48 ba 73 09 80 00 00 	movabs $0x800973,%rdx
+  803d0c:	00 00 00 
+  803d0f:	ff d2                	call   *%rdx
+            return res;
+  803d11:	e9 3d 01 00 00       	jmp    803e53 <spawn+0x726>
+        memset(UTEMP + filesz, 0, PAGE_SIZE - PAGE_OFFSET(filesz));
+  803d16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d1b:	48 29 c2             	sub    %rax,%rdx
+  803d1e:	49 8d be 00 00 40 00 	lea    0x400000(%r14),%rdi
+  803d25:	be 00 00 00 00       	mov    $0x0,%esi
+  803d2a:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+  803d36:	e9 fe fd ff ff       	jmp    803b39 <spawn+0x40c>
+    if ((res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, PAGE_SIZE))) < 0) {
+  803d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d40:	0f 4e d0             	cmovle %eax,%edx
+  803d43:	89 d3                	mov    %edx,%ebx
+  803d45:	e9 09 01 00 00       	jmp    803e53 <spawn+0x726>
+    close(fd);
+  803d4a:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803d50:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803d5c:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803d63:	48 bf dd 36 80 00 00 	movabs $0x8036dd,%rdi
+  803d6a:	00 00 00 
+  803d6d:	48 b8 dc 4a 80 00 00 	movabs $0x804adc,%rax
+  803d74:	00 00 00 
+  803d77:	ff d0                	call   *%rax
+  803d79:	85 c0                	test   %eax,%eax
+  803d7b:	78 49                	js     803dc6 <spawn+0x699>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803d7d:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803d84:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803d8a:	48 b8 4b 1b 80 00 00 	movabs $0x801b4b,%rax
+  803d91:	00 00 00 
+  803d94:	ff d0                	call   *%rax
+  803d96:	85 c0                	test   %eax,%eax
+  803d98:	78 59                	js     803df3 <spawn+0x6c6>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803d9a:	be 02 00 00 00       	mov    $0x2,%esi
+  803d9f:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803da5:	48 b8 7b 1a 80 00 00 	movabs $0x801a7b,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+  803db1:	85 c0                	test   %eax,%eax
+  803db3:	78 6b                	js     803e20 <spawn+0x6f3>
+    return child;
+  803db5:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803dbb:	89 85 f4 fc ff ff    	mov    %eax,-0x30c(%rbp)
+  803dc1:	e9 b7 00 00 00       	jmp    803e7d <spawn+0x750>
+        panic("copy_shared_region: %i", res);
+  803dc6:	89 c1                	mov    %eax,%ecx
+  803dc8:	48 ba 8b 68 80 00 00 	movabs $0x80688b,%rdx
+  803dcf:	00 00 00 
+  803dd2:	be 83 00 00 00       	mov    $0x83,%esi
+  803dd7:	48 bf 6f 68 80 00 00 	movabs $0x80686f,%rdi
+  803dde:	00 00 00 
+  803de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de6:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  803ded:	00 00 00 
+  803df0:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803df3:	89 c1                	mov    %eax,%ecx
+  803df5:	48 ba a2 68 80 00 00 	movabs $0x8068a2,%rdx
+  803dfc:	00 00 00 
+  803dff:	be 86 00 00 00       	mov    $0x86,%esi
+  803e04:	48 bf 6f 68 80 00 00 	movabs $0x80686f,%rdi
+  803e0b:	00 00 00 
+  803e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e13:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  803e1a:	00 00 00 
+  803e1d:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803e20:	89 c1                	mov    %eax,%ecx
+  803e22:	48 ba bc 68 80 00 00 	movabs $0x8068bc,%rdx
+  803e29:	00 00 00 
+  803e2c:	be 89 00 00 00       	mov    $0x89,%esi
+  803e31:	48 bf 6f 68 80 00 00 	movabs $0x80686f,%rdi
+  803e38:	00 00 00 
+  803e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e40:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  803e47:	00 00 00 
+  803e4a:	41 ff d0             	call   *%r8
+  803e4d:	89 c3                	mov    %eax,%ebx
+  803e4f:	eb 02                	jmp    803e53 <spawn+0x726>
+  803e51:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  803e53:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803e59:	48 b8 1d 17 80 00 00 	movabs $0x80171d,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+    close(fd);
+  803e65:	8b bd f4 fc ff ff    	mov    -0x30c(%rbp),%edi
+  803e6b:	48 b8 58 24 80 00 00 	movabs $0x802458,%rax
+  803e72:	00 00 00 
+  803e75:	ff d0                	call   *%rax
+    return res;
+  803e77:	89 9d f4 fc ff ff    	mov    %ebx,-0x30c(%rbp)
+}
+  803e7d:	8b 85 f4 fc ff ff    	mov    -0x30c(%rbp),%eax
+  803e83:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803e8a:	5b                   	pop    %rbx
+  803e8b:	41 5c                	pop    %r12
+  803e8d:	41 5d                	pop    %r13
+  803e8f:	41 5e                	pop    %r14
+  803e91:	41 5f                	pop    %r15
+  803e93:	5d                   	pop    %rbp
+  803e94:	c3                   	ret
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803e95:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803e9a:	89 c3                	mov    %eax,%ebx
+  803e9c:	eb b5                	jmp    803e53 <spawn+0x726>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803e9e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803ea3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803ea8:	be 00 00 40 00       	mov    $0x400000,%esi
+  803ead:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eb2:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803eb9:	00 00 00 
+  803ebc:	ff d0                	call   *%rax
+  803ebe:	85 c0                	test   %eax,%eax
+  803ec0:	78 d8                	js     803e9a <spawn+0x76d>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803ec2:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  803ec9:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803ecd:	48 c7 85 f8 fc ff ff 	movq   $0x40fff8,-0x308(%rbp)
+  803ed4:	f8 ff 40 00 
+  803ed8:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803edf:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803ee3:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803ee8:	e9 4c fa ff ff       	jmp    803939 <spawn+0x20c>
+
+0000000000803eed <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803eed:	55                   	push   %rbp
+  803eee:	48 89 e5             	mov    %rsp,%rbp
+  803ef1:	48 83 ec 50          	sub    $0x50,%rsp
+  803ef5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ef9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803efd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f01:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803f05:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f0c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f14:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803f1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803f21:	eb 15                	jmp    803f38 <spawnl+0x4b>
+  803f23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f2f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803f33:	74 1c                	je     803f51 <spawnl+0x64>
+  803f35:	83 c1 01             	add    $0x1,%ecx
+  803f38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f3b:	83 f8 2f             	cmp    $0x2f,%eax
+  803f3e:	77 e3                	ja     803f23 <spawnl+0x36>
+  803f40:	89 c2                	mov    %eax,%edx
+  803f42:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803f46:	4c 01 d2             	add    %r10,%rdx
+  803f49:	83 c0 08             	add    $0x8,%eax
+  803f4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f4f:	eb de                	jmp    803f2f <spawnl+0x42>
+    const char *argv[argc + 2];
+  803f51:	8d 41 02             	lea    0x2(%rcx),%eax
+  803f54:	48 98                	cltq
+  803f56:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803f5d:	00 
+  803f5e:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803f62:	48 29 c4             	sub    %rax,%rsp
+  803f65:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803f6a:	4c 89 c0             	mov    %r8,%rax
+  803f6d:	48 c1 e8 03          	shr    $0x3,%rax
+  803f71:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803f75:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803f7c:	00 
+    argv[argc + 1] = NULL;
+  803f7d:	8d 41 01             	lea    0x1(%rcx),%eax
+  803f80:	48 98                	cltq
+  803f82:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803f89:	00 
+    va_start(vl, arg0);
+  803f8a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f99:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803fa1:	85 c9                	test   %ecx,%ecx
+  803fa3:	74 41                	je     803fe6 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803fa5:	49 89 c1             	mov    %rax,%r9
+  803fa8:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803fac:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803faf:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803fb4:	eb 1b                	jmp    803fd1 <spawnl+0xe4>
+  803fb6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803fba:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803fbe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803fc2:	48 8b 11             	mov    (%rcx),%rdx
+  803fc5:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803fc8:	48 83 c0 08          	add    $0x8,%rax
+  803fcc:	48 39 f0             	cmp    %rsi,%rax
+  803fcf:	74 15                	je     803fe6 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803fd1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803fd4:	83 fa 2f             	cmp    $0x2f,%edx
+  803fd7:	77 dd                	ja     803fb6 <spawnl+0xc9>
+  803fd9:	89 d1                	mov    %edx,%ecx
+  803fdb:	4c 01 c9             	add    %r9,%rcx
+  803fde:	83 c2 08             	add    $0x8,%edx
+  803fe1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803fe4:	eb dc                	jmp    803fc2 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803fe6:	4c 89 c6             	mov    %r8,%rsi
+  803fe9:	48 b8 2d 37 80 00 00 	movabs $0x80372d,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+}
+  803ff5:	c9                   	leave
+  803ff6:	c3                   	ret
+
+0000000000803ff7 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803ff7:	55                   	push   %rbp
+  803ff8:	48 89 e5             	mov    %rsp,%rbp
+  803ffb:	41 54                	push   %r12
+  803ffd:	53                   	push   %rbx
+  803ffe:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804001:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  804008:	00 00 00 
+  80400b:	ff d0                	call   *%rax
+  80400d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804010:	48 be d3 68 80 00 00 	movabs $0x8068d3,%rsi
+  804017:	00 00 00 
+  80401a:	48 89 df             	mov    %rbx,%rdi
+  80401d:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804029:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  80402e:	41 8b 14 24          	mov    (%r12),%edx
+  804032:	29 d0                	sub    %edx,%eax
+  804034:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80403a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804041:	00 00 00 
+    stat->st_dev = &devpipe;
+  804044:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80404b:	00 00 00 
+  80404e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80405a:	5b                   	pop    %rbx
+  80405b:	41 5c                	pop    %r12
+  80405d:	5d                   	pop    %rbp
+  80405e:	c3                   	ret
+
+000000000080405f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80405f:	55                   	push   %rbp
+  804060:	48 89 e5             	mov    %rsp,%rbp
+  804063:	41 55                	push   %r13
+  804065:	41 54                	push   %r12
+  804067:	53                   	push   %rbx
+  804068:	48 83 ec 08          	sub    $0x8,%rsp
+  80406c:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80406f:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  804076:	00 00 00 
+  804079:	ff d0                	call   *%rax
+  80407b:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80407e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804083:	4c 89 e6             	mov    %r12,%rsi
+  804086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408b:	49 bc 7c 19 80 00 00 	movabs $0x80197c,%r12
+  804092:	00 00 00 
+  804095:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  804098:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  80409e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8040a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040aa:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8040ad:	be 00 04 00 00       	mov    $0x400,%esi
+  8040b2:	48 89 df             	mov    %rbx,%rdi
+  8040b5:	49 bd f6 1e 80 00 00 	movabs $0x801ef6,%r13
+  8040bc:	00 00 00 
+  8040bf:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8040c2:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  8040c6:	be 00 04 00 00       	mov    $0x400,%esi
+  8040cb:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8040ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040d3:	48 89 de             	mov    %rbx,%rsi
+  8040d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040db:	41 ff d4             	call   *%r12
+}
+  8040de:	48 83 c4 08          	add    $0x8,%rsp
+  8040e2:	5b                   	pop    %rbx
+  8040e3:	41 5c                	pop    %r12
+  8040e5:	41 5d                	pop    %r13
+  8040e7:	5d                   	pop    %rbp
+  8040e8:	c3                   	ret
+
+00000000008040e9 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8040e9:	55                   	push   %rbp
+  8040ea:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8040ed:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8040f3:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8040fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ff:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  804106:	00 00 00 
+  804109:	ff d0                	call   *%rax
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	0f 94 c0             	sete   %al
+  804110:	0f b6 c0             	movzbl %al,%eax
+}
+  804113:	5d                   	pop    %rbp
+  804114:	c3                   	ret
+
+0000000000804115 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  804115:	b8 01 00 00 00       	mov    $0x1,%eax
+  80411a:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  80411c:	8b 07                	mov    (%rdi),%eax
+  80411e:	39 f0                	cmp    %esi,%eax
+  804120:	74 01                	je     804123 <pipe_wait+0xe>
+  804122:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  804123:	55                   	push   %rbp
+  804124:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  804127:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804129:	48 c1 e2 20          	shl    $0x20,%rdx
+  80412d:	89 c0                	mov    %eax,%eax
+  80412f:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  804132:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  804139:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  804140:	00 00 00 
+  804143:	ff d0                	call   *%rax
+}
+  804145:	5d                   	pop    %rbp
+  804146:	c3                   	ret
+
+0000000000804147 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  804147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414c:	87 06                	xchg   %eax,(%rsi)
+  80414e:	85 c0                	test   %eax,%eax
+  804150:	75 01                	jne    804153 <pipe_wake+0xc>
+  804152:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  804153:	55                   	push   %rbp
+  804154:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  804157:	be 00 04 00 00       	mov    $0x400,%esi
+  80415c:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  804163:	00 00 00 
+  804166:	ff d0                	call   *%rax
+}
+  804168:	5d                   	pop    %rbp
+  804169:	c3                   	ret
+
+000000000080416a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	41 57                	push   %r15
+  804170:	41 56                	push   %r14
+  804172:	41 55                	push   %r13
+  804174:	41 54                	push   %r12
+  804176:	53                   	push   %rbx
+  804177:	48 83 ec 28          	sub    $0x28,%rsp
+  80417b:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80417f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804183:	48 89 d3             	mov    %rdx,%rbx
+  804186:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80418a:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  804191:	00 00 00 
+  804194:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  804196:	48 85 db             	test   %rbx,%rbx
+  804199:	0f 84 0f 01 00 00    	je     8042ae <devpipe_write+0x144>
+  80419f:	49 89 c4             	mov    %rax,%r12
+  8041a2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8041a8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8041af:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8041b3:	eb 4f                	jmp    804204 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041b5:	4c 89 e6             	mov    %r12,%rsi
+  8041b8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8041bc:	48 b8 e9 40 80 00 00 	movabs $0x8040e9,%rax
+  8041c3:	00 00 00 
+  8041c6:	ff d0                	call   *%rax
+  8041c8:	85 c0                	test   %eax,%eax
+  8041ca:	74 14                	je     8041e0 <devpipe_write+0x76>
+  8041cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041d1:	48 83 c4 28          	add    $0x28,%rsp
+  8041d5:	5b                   	pop    %rbx
+  8041d6:	41 5c                	pop    %r12
+  8041d8:	41 5d                	pop    %r13
+  8041da:	41 5e                	pop    %r14
+  8041dc:	41 5f                	pop    %r15
+  8041de:	5d                   	pop    %rbp
+  8041df:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8041e0:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8041e5:	44 89 ee             	mov    %r13d,%esi
+  8041e8:	4c 89 e7             	mov    %r12,%rdi
+  8041eb:	48 b8 15 41 80 00 00 	movabs $0x804115,%rax
+  8041f2:	00 00 00 
+  8041f5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8041f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041fb:	49 39 c7             	cmp    %rax,%r15
+  8041fe:	0f 83 aa 00 00 00    	jae    8042ae <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  804204:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  804209:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  80420d:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  804214:	00 
+  804215:	44 89 f0             	mov    %r14d,%eax
+  804218:	44 29 e8             	sub    %r13d,%eax
+  80421b:	39 d8                	cmp    %ebx,%eax
+  80421d:	74 96                	je     8041b5 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80421f:	89 d8                	mov    %ebx,%eax
+  804221:	44 29 f0             	sub    %r14d,%eax
+  804224:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  804228:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80422c:	4c 29 f8             	sub    %r15,%rax
+  80422f:	49 39 c5             	cmp    %rax,%r13
+  804232:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  804236:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  804239:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  80423c:	89 db                	mov    %ebx,%ebx
+  80423e:	48 29 c3             	sub    %rax,%rbx
+  804241:	4c 39 eb             	cmp    %r13,%rbx
+  804244:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  804248:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80424c:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  804250:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  804257:	00 
+  804258:	48 89 da             	mov    %rbx,%rdx
+  80425b:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  804262:	00 00 00 
+  804265:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  804267:	4c 89 ea             	mov    %r13,%rdx
+  80426a:	48 29 da             	sub    %rbx,%rdx
+  80426d:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  804271:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804275:	48 01 ce             	add    %rcx,%rsi
+  804278:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80427c:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  804283:	00 00 00 
+  804286:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  804288:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  80428d:	45 01 ee             	add    %r13d,%r14d
+  804290:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  804295:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  80429a:	48 b8 47 41 80 00 00 	movabs $0x804147,%rax
+  8042a1:	00 00 00 
+  8042a4:	ff d0                	call   *%rax
+        i += chunk;
+  8042a6:	4d 01 ef             	add    %r13,%r15
+  8042a9:	e9 49 ff ff ff       	jmp    8041f7 <devpipe_write+0x8d>
+    return n;
+  8042ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042b2:	e9 1a ff ff ff       	jmp    8041d1 <devpipe_write+0x67>
+
+00000000008042b7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042b7:	55                   	push   %rbp
+  8042b8:	48 89 e5             	mov    %rsp,%rbp
+  8042bb:	41 57                	push   %r15
+  8042bd:	41 56                	push   %r14
+  8042bf:	41 55                	push   %r13
+  8042c1:	41 54                	push   %r12
+  8042c3:	53                   	push   %rbx
+  8042c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8042c8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8042cc:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8042d0:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042d4:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  8042db:	00 00 00 
+  8042de:	ff d0                	call   *%rax
+  8042e0:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8042e3:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8042e7:	49 bf e9 40 80 00 00 	movabs $0x8040e9,%r15
+  8042ee:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8042f1:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8042f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042f9:	eb 15                	jmp    804310 <devpipe_read+0x59>
+  8042fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042ff:	89 de                	mov    %ebx,%esi
+  804301:	4c 89 f7             	mov    %r14,%rdi
+  804304:	48 b8 15 41 80 00 00 	movabs $0x804115,%rax
+  80430b:	00 00 00 
+  80430e:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  804310:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  804314:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  804317:	41 39 dd             	cmp    %ebx,%r13d
+  80431a:	75 15                	jne    804331 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  80431c:	4c 89 e6             	mov    %r12,%rsi
+  80431f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804323:	41 ff d7             	call   *%r15
+  804326:	85 c0                	test   %eax,%eax
+  804328:	74 d1                	je     8042fb <devpipe_read+0x44>
+  80432a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432f:	eb 7c                	jmp    8043ad <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  804331:	44 29 eb             	sub    %r13d,%ebx
+  804334:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804338:	48 39 c3             	cmp    %rax,%rbx
+  80433b:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80433f:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  804346:	00 
+  804347:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80434b:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  80434e:	45 89 f6             	mov    %r14d,%r14d
+  804351:	49 29 c6             	sub    %rax,%r14
+  804354:	49 39 de             	cmp    %rbx,%r14
+  804357:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80435b:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  804362:	00 
+  804363:	4c 89 f2             	mov    %r14,%rdx
+  804366:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80436a:	49 bf f9 14 80 00 00 	movabs $0x8014f9,%r15
+  804371:	00 00 00 
+  804374:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804377:	48 89 da             	mov    %rbx,%rdx
+  80437a:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  80437d:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804384:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  804385:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804389:	4c 01 f7             	add    %r14,%rdi
+  80438c:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  80438f:	41 01 dd             	add    %ebx,%r13d
+  804392:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  804396:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  80439b:	4c 89 e7             	mov    %r12,%rdi
+  80439e:	48 b8 47 41 80 00 00 	movabs $0x804147,%rax
+  8043a5:	00 00 00 
+  8043a8:	ff d0                	call   *%rax
+    return n;
+  8043aa:	48 89 d8             	mov    %rbx,%rax
+}
+  8043ad:	48 83 c4 28          	add    $0x28,%rsp
+  8043b1:	5b                   	pop    %rbx
+  8043b2:	41 5c                	pop    %r12
+  8043b4:	41 5d                	pop    %r13
+  8043b6:	41 5e                	pop    %r14
+  8043b8:	41 5f                	pop    %r15
+  8043ba:	5d                   	pop    %rbp
+  8043bb:	c3                   	ret
+
+00000000008043bc <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8043bc:	55                   	push   %rbp
+  8043bd:	48 89 e5             	mov    %rsp,%rbp
+  8043c0:	41 57                	push   %r15
+  8043c2:	41 56                	push   %r14
+  8043c4:	41 55                	push   %r13
+  8043c6:	41 54                	push   %r12
+  8043c8:	53                   	push   %rbx
+  8043c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8043cd:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8043d0:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8043d7:	0f 86 96 01 00 00    	jbe    804573 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8043dd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8043e2:	48 01 db             	add    %rbx,%rbx
+  8043e5:	48 39 f3             	cmp    %rsi,%rbx
+  8043e8:	72 f8                	jb     8043e2 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8043ea:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8043f1:	0f 87 18 02 00 00    	ja     80460f <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8043f7:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8043fb:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  804402:	00 00 00 
+  804405:	ff d0                	call   *%rax
+  804407:	41 89 c4             	mov    %eax,%r12d
+  80440a:	85 c0                	test   %eax,%eax
+  80440c:	0f 88 b6 01 00 00    	js     8045c8 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804412:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804417:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80441c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804420:	bf 00 00 00 00       	mov    $0x0,%edi
+  804425:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  80442c:	00 00 00 
+  80442f:	ff d0                	call   *%rax
+  804431:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804434:	85 c0                	test   %eax,%eax
+  804436:	0f 88 8c 01 00 00    	js     8045c8 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80443c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804440:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	41 89 c4             	mov    %eax,%r12d
+  80444f:	85 c0                	test   %eax,%eax
+  804451:	0f 88 57 01 00 00    	js     8045ae <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804457:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80445c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804461:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804465:	bf 00 00 00 00       	mov    $0x0,%edi
+  80446a:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  804471:	00 00 00 
+  804474:	ff d0                	call   *%rax
+  804476:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804479:	85 c0                	test   %eax,%eax
+  80447b:	0f 88 2d 01 00 00    	js     8045ae <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  804481:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804485:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  80448c:	00 00 00 
+  80448f:	ff d0                	call   *%rax
+  804491:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804494:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  80449b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044a0:	4c 89 fa             	mov    %r15,%rdx
+  8044a3:	48 89 c6             	mov    %rax,%rsi
+  8044a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ab:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  8044b2:	00 00 00 
+  8044b5:	ff d0                	call   *%rax
+  8044b7:	41 89 c4             	mov    %eax,%r12d
+  8044ba:	85 c0                	test   %eax,%eax
+  8044bc:	0f 88 d2 00 00 00    	js     804594 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8044c2:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8044c9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8044cd:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  8044d4:	00 00 00 
+  8044d7:	ff d0                	call   *%rax
+  8044d9:	48 89 c1             	mov    %rax,%rcx
+  8044dc:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8044e2:	4d 89 f8             	mov    %r15,%r8
+  8044e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044ea:	4c 89 f6             	mov    %r14,%rsi
+  8044ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044f2:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  8044f9:	00 00 00 
+  8044fc:	ff d0                	call   *%rax
+  8044fe:	41 89 c4             	mov    %eax,%r12d
+  804501:	85 c0                	test   %eax,%eax
+  804503:	78 78                	js     80457d <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804505:	be 00 10 00 00       	mov    $0x1000,%esi
+  80450a:	4c 89 f7             	mov    %r14,%rdi
+  80450d:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  804514:	00 00 00 
+  804517:	ff d0                	call   *%rax
+  804519:	83 f8 02             	cmp    $0x2,%eax
+  80451c:	0f 85 b8 00 00 00    	jne    8045da <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804522:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804529:	00 00 
+  80452b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80452f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804531:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804535:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80453c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804540:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804542:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804546:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80454d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804551:	48 bb 60 22 80 00 00 	movabs $0x802260,%rbx
+  804558:	00 00 00 
+  80455b:	ff d3                	call   *%rbx
+  80455d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  804561:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804565:	ff d3                	call   *%rbx
+  804567:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  80456b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804571:	eb 55                	jmp    8045c8 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  804573:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  804578:	e9 7a fe ff ff       	jmp    8043f7 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  80457d:	4c 89 fa             	mov    %r15,%rdx
+  804580:	4c 89 f6             	mov    %r14,%rsi
+  804583:	bf 00 00 00 00       	mov    $0x0,%edi
+  804588:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  80458f:	00 00 00 
+  804592:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804594:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804599:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80459d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045a2:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  8045a9:	00 00 00 
+  8045ac:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8045ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045b3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8045b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045bc:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  8045c3:	00 00 00 
+  8045c6:	ff d0                	call   *%rax
+}
+  8045c8:	44 89 e0             	mov    %r12d,%eax
+  8045cb:	48 83 c4 18          	add    $0x18,%rsp
+  8045cf:	5b                   	pop    %rbx
+  8045d0:	41 5c                	pop    %r12
+  8045d2:	41 5d                	pop    %r13
+  8045d4:	41 5e                	pop    %r14
+  8045d6:	41 5f                	pop    %r15
+  8045d8:	5d                   	pop    %rbp
+  8045d9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8045da:	48 b9 f0 68 80 00 00 	movabs $0x8068f0,%rcx
+  8045e1:	00 00 00 
+  8045e4:	48 ba 5a 68 80 00 00 	movabs $0x80685a,%rdx
+  8045eb:	00 00 00 
+  8045ee:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8045f3:	48 bf da 68 80 00 00 	movabs $0x8068da,%rdi
+  8045fa:	00 00 00 
+  8045fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804602:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  804609:	00 00 00 
+  80460c:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80460f:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  804615:	eb b1                	jmp    8045c8 <pipe_sized+0x20c>
+
+0000000000804617 <pipe>:
+pipe(int pfd[2]) {
+  804617:	55                   	push   %rbp
+  804618:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80461b:	be 00 00 01 00       	mov    $0x10000,%esi
+  804620:	48 b8 bc 43 80 00 00 	movabs $0x8043bc,%rax
+  804627:	00 00 00 
+  80462a:	ff d0                	call   *%rax
+}
+  80462c:	5d                   	pop    %rbp
+  80462d:	c3                   	ret
+
+000000000080462e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80462e:	55                   	push   %rbp
+  80462f:	48 89 e5             	mov    %rsp,%rbp
+  804632:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804636:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80463a:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  804641:	00 00 00 
+  804644:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804646:	85 c0                	test   %eax,%eax
+  804648:	78 23                	js     80466d <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80464a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80464e:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  804655:	00 00 00 
+  804658:	ff d0                	call   *%rax
+  80465a:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80465d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804661:	48 b8 e9 40 80 00 00 	movabs $0x8040e9,%rax
+  804668:	00 00 00 
+  80466b:	ff d0                	call   *%rax
+}
+  80466d:	c9                   	leave
+  80466e:	c3                   	ret
+
+000000000080466f <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80466f:	55                   	push   %rbp
+  804670:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  804673:	8b 0f                	mov    (%rdi),%ecx
+  804675:	8d 41 01             	lea    0x1(%rcx),%eax
+  804678:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  80467a:	83 f9 07             	cmp    $0x7,%ecx
+  80467d:	76 31                	jbe    8046b0 <backoff+0x41>
+    asm volatile("rdtsc"
+  80467f:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804681:	83 c1 06             	add    $0x6,%ecx
+  804684:	be 15 00 00 00       	mov    $0x15,%esi
+  804689:	39 f1                	cmp    %esi,%ecx
+  80468b:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  80468e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804693:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804696:	48 c1 e2 20          	shl    $0x20,%rdx
+  80469a:	89 c0                	mov    %eax,%eax
+  80469c:	48 09 c2             	or     %rax,%rdx
+  80469f:	48 01 d7             	add    %rdx,%rdi
+  8046a2:	48 b8 44 1e 80 00 00 	movabs $0x801e44,%rax
+  8046a9:	00 00 00 
+  8046ac:	ff d0                	call   *%rax
+}
+  8046ae:	5d                   	pop    %rbp
+  8046af:	c3                   	ret
+        sys_yield();
+  8046b0:	48 b8 b9 17 80 00 00 	movabs $0x8017b9,%rax
+  8046b7:	00 00 00 
+  8046ba:	ff d0                	call   *%rax
+        return;
+  8046bc:	eb f0                	jmp    8046ae <backoff+0x3f>
+
+00000000008046be <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8046be:	55                   	push   %rbp
+  8046bf:	48 89 e5             	mov    %rsp,%rbp
+  8046c2:	41 55                	push   %r13
+  8046c4:	41 54                	push   %r12
+  8046c6:	53                   	push   %rbx
+  8046c7:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8046cb:	85 ff                	test   %edi,%edi
+  8046cd:	74 7e                	je     80474d <wait+0x8f>
+  8046cf:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8046d2:	89 f8                	mov    %edi,%eax
+  8046d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  8046d9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  8046e0:	89 f9                	mov    %edi,%ecx
+  8046e2:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8046e8:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  8046ef:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046f6:	00 00 00 
+  8046f9:	48 01 ca             	add    %rcx,%rdx
+  8046fc:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804702:	39 d7                	cmp    %edx,%edi
+  804704:	75 3c                	jne    804742 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804706:	48 98                	cltq
+  804708:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80470f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804716:	00 00 00 
+  804719:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80471c:	49 bd 6f 46 80 00 00 	movabs $0x80466f,%r13
+  804723:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804726:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80472c:	85 c0                	test   %eax,%eax
+  80472e:	74 12                	je     804742 <wait+0x84>
+        backoff(&attempt);
+  804730:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804734:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804737:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80473d:	44 39 e0             	cmp    %r12d,%eax
+  804740:	74 e4                	je     804726 <wait+0x68>
+    }
+}
+  804742:	48 83 c4 18          	add    $0x18,%rsp
+  804746:	5b                   	pop    %rbx
+  804747:	41 5c                	pop    %r12
+  804749:	41 5d                	pop    %r13
+  80474b:	5d                   	pop    %rbp
+  80474c:	c3                   	ret
+    assert(envid != 0);
+  80474d:	48 b9 14 69 80 00 00 	movabs $0x806914,%rcx
+  804754:	00 00 00 
+  804757:	48 ba 5a 68 80 00 00 	movabs $0x80685a,%rdx
+  80475e:	00 00 00 
+  804761:	be 22 00 00 00       	mov    $0x22,%esi
+  804766:	48 bf 1f 69 80 00 00 	movabs $0x80691f,%rdi
+  80476d:	00 00 00 
+  804770:	b8 00 00 00 00       	mov    $0x0,%eax
+  804775:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  80477c:	00 00 00 
+  80477f:	41 ff d0             	call   *%r8
+
+0000000000804782 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804782:	48 89 f8             	mov    %rdi,%rax
+  804785:	48 c1 e8 27          	shr    $0x27,%rax
+  804789:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804790:	7f 00 00 
+  804793:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804797:	f6 c2 01             	test   $0x1,%dl
+  80479a:	74 6d                	je     804809 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80479c:	48 89 f8             	mov    %rdi,%rax
+  80479f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047a3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8047aa:	7f 00 00 
+  8047ad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047b1:	f6 c2 01             	test   $0x1,%dl
+  8047b4:	74 62                	je     804818 <get_uvpt_entry+0x96>
+  8047b6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8047bd:	7f 00 00 
+  8047c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047c4:	f6 c2 80             	test   $0x80,%dl
+  8047c7:	75 4f                	jne    804818 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047c9:	48 89 f8             	mov    %rdi,%rax
+  8047cc:	48 c1 e8 15          	shr    $0x15,%rax
+  8047d0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8047d7:	7f 00 00 
+  8047da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047de:	f6 c2 01             	test   $0x1,%dl
+  8047e1:	74 44                	je     804827 <get_uvpt_entry+0xa5>
+  8047e3:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8047ea:	7f 00 00 
+  8047ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047f1:	f6 c2 80             	test   $0x80,%dl
+  8047f4:	75 31                	jne    804827 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8047f6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8047fa:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804801:	7f 00 00 
+  804804:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804808:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804809:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804810:	7f 00 00 
+  804813:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804817:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804818:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80481f:	7f 00 00 
+  804822:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804826:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804827:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80482e:	7f 00 00 
+  804831:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804835:	c3                   	ret
+
+0000000000804836 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804836:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804839:	48 89 f9             	mov    %rdi,%rcx
+  80483c:	48 c1 e9 27          	shr    $0x27,%rcx
+  804840:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804847:	7f 00 00 
+  80484a:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80484e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804855:	f6 c1 01             	test   $0x1,%cl
+  804858:	0f 84 b2 00 00 00    	je     804910 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80485e:	48 89 f9             	mov    %rdi,%rcx
+  804861:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804865:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80486c:	7f 00 00 
+  80486f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804873:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80487a:	40 f6 c6 01          	test   $0x1,%sil
+  80487e:	0f 84 8c 00 00 00    	je     804910 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804884:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80488b:	7f 00 00 
+  80488e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804892:	a8 80                	test   $0x80,%al
+  804894:	75 7b                	jne    804911 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804896:	48 89 f9             	mov    %rdi,%rcx
+  804899:	48 c1 e9 15          	shr    $0x15,%rcx
+  80489d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8048a4:	7f 00 00 
+  8048a7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8048ab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8048b2:	40 f6 c6 01          	test   $0x1,%sil
+  8048b6:	74 58                	je     804910 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8048b8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8048bf:	7f 00 00 
+  8048c2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8048c6:	a8 80                	test   $0x80,%al
+  8048c8:	75 6c                	jne    804936 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8048ca:	48 89 f9             	mov    %rdi,%rcx
+  8048cd:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8048d1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8048d8:	7f 00 00 
+  8048db:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8048df:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8048e6:	40 f6 c6 01          	test   $0x1,%sil
+  8048ea:	74 24                	je     804910 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8048ec:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8048f3:	7f 00 00 
+  8048f6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8048fa:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804901:	ff ff 7f 
+  804904:	48 21 c8             	and    %rcx,%rax
+  804907:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80490d:	48 09 d0             	or     %rdx,%rax
+}
+  804910:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804911:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804918:	7f 00 00 
+  80491b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80491f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804926:	ff ff 7f 
+  804929:	48 21 c8             	and    %rcx,%rax
+  80492c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804932:	48 01 d0             	add    %rdx,%rax
+  804935:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804936:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80493d:	7f 00 00 
+  804940:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804944:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80494b:	ff ff 7f 
+  80494e:	48 21 c8             	and    %rcx,%rax
+  804951:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804957:	48 01 d0             	add    %rdx,%rax
+  80495a:	c3                   	ret
+
+000000000080495b <get_prot>:
+
+int
+get_prot(void *va) {
+  80495b:	55                   	push   %rbp
+  80495c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80495f:	48 b8 82 47 80 00 00 	movabs $0x804782,%rax
+  804966:	00 00 00 
+  804969:	ff d0                	call   *%rax
+  80496b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80496e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804973:	89 c1                	mov    %eax,%ecx
+  804975:	83 c9 04             	or     $0x4,%ecx
+  804978:	f6 c2 01             	test   $0x1,%dl
+  80497b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80497e:	89 c1                	mov    %eax,%ecx
+  804980:	83 c9 02             	or     $0x2,%ecx
+  804983:	f6 c2 02             	test   $0x2,%dl
+  804986:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804989:	89 c1                	mov    %eax,%ecx
+  80498b:	83 c9 01             	or     $0x1,%ecx
+  80498e:	48 85 d2             	test   %rdx,%rdx
+  804991:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804994:	89 c1                	mov    %eax,%ecx
+  804996:	83 c9 40             	or     $0x40,%ecx
+  804999:	f6 c6 04             	test   $0x4,%dh
+  80499c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80499f:	5d                   	pop    %rbp
+  8049a0:	c3                   	ret
+
+00000000008049a1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8049a1:	55                   	push   %rbp
+  8049a2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8049a5:	48 b8 82 47 80 00 00 	movabs $0x804782,%rax
+  8049ac:	00 00 00 
+  8049af:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8049b1:	48 c1 e8 06          	shr    $0x6,%rax
+  8049b5:	83 e0 01             	and    $0x1,%eax
+}
+  8049b8:	5d                   	pop    %rbp
+  8049b9:	c3                   	ret
+
+00000000008049ba <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8049ba:	55                   	push   %rbp
+  8049bb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8049be:	48 b8 82 47 80 00 00 	movabs $0x804782,%rax
+  8049c5:	00 00 00 
+  8049c8:	ff d0                	call   *%rax
+  8049ca:	83 e0 01             	and    $0x1,%eax
+}
+  8049cd:	5d                   	pop    %rbp
+  8049ce:	c3                   	ret
+
+00000000008049cf <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  8049cf:	55                   	push   %rbp
+  8049d0:	48 89 e5             	mov    %rsp,%rbp
+  8049d3:	41 57                	push   %r15
+  8049d5:	41 56                	push   %r14
+  8049d7:	41 55                	push   %r13
+  8049d9:	41 54                	push   %r12
+  8049db:	53                   	push   %rbx
+  8049dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8049e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049e4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8049e8:	48 39 f7             	cmp    %rsi,%rdi
+  8049eb:	0f 83 e4 00 00 00    	jae    804ad5 <foreach_present_page+0x106>
+  8049f1:	49 89 f4             	mov    %rsi,%r12
+  8049f4:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8049f7:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8049fe:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804a01:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  804a08:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804a0b:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804a12:	7f 00 00 
+  804a15:	eb 27                	jmp    804a3e <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804a17:	48 89 d8             	mov    %rbx,%rax
+  804a1a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804a1e:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804a22:	f6 c2 01             	test   $0x1,%dl
+  804a25:	75 43                	jne    804a6a <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  804a27:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804a2e:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  804a35:	4c 39 e3             	cmp    %r12,%rbx
+  804a38:	0f 83 83 00 00 00    	jae    804ac1 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  804a3e:	48 89 d8             	mov    %rbx,%rax
+  804a41:	48 c1 e8 27          	shr    $0x27,%rax
+  804a45:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804a4a:	a8 01                	test   $0x1,%al
+  804a4c:	75 c9                	jne    804a17 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  804a4e:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  804a55:	ff ff ff 
+  804a58:	48 21 d8             	and    %rbx,%rax
+  804a5b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  804a62:	00 00 00 
+  804a65:	48 01 c3             	add    %rax,%rbx
+  804a68:	eb cb                	jmp    804a35 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804a6a:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  804a6e:	a8 80                	test   $0x80,%al
+  804a70:	75 1f                	jne    804a91 <foreach_present_page+0xc2>
+  804a72:	48 89 d8             	mov    %rbx,%rax
+  804a75:	48 c1 e8 15          	shr    $0x15,%rax
+  804a79:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  804a7d:	a8 01                	test   $0x1,%al
+  804a7f:	75 10                	jne    804a91 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  804a81:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  804a88:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  804a8f:	eb a4                	jmp    804a35 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  804a91:	48 89 df             	mov    %rbx,%rdi
+  804a94:	48 b8 82 47 80 00 00 	movabs $0x804782,%rax
+  804a9b:	00 00 00 
+  804a9e:	ff d0                	call   *%rax
+  804aa0:	a8 01                	test   $0x1,%al
+  804aa2:	74 11                	je     804ab5 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804aa4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804aa8:	48 89 df             	mov    %rbx,%rdi
+  804aab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aaf:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804ab1:	85 c0                	test   %eax,%eax
+  804ab3:	78 11                	js     804ac6 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  804ab5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804abc:	e9 74 ff ff ff       	jmp    804a35 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ac6:	48 83 c4 18          	add    $0x18,%rsp
+  804aca:	5b                   	pop    %rbx
+  804acb:	41 5c                	pop    %r12
+  804acd:	41 5d                	pop    %r13
+  804acf:	41 5e                	pop    %r14
+  804ad1:	41 5f                	pop    %r15
+  804ad3:	5d                   	pop    %rbp
+  804ad4:	c3                   	ret
+    return 0;
+  804ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ada:	eb ea                	jmp    804ac6 <foreach_present_page+0xf7>
+
+0000000000804adc <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804adc:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804ae3:	7f 00 00 
+  804ae6:	a8 01                	test   $0x1,%al
+  804ae8:	75 06                	jne    804af0 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  804aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aef:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804af0:	55                   	push   %rbp
+  804af1:	48 89 e5             	mov    %rsp,%rbp
+  804af4:	41 57                	push   %r15
+  804af6:	41 56                	push   %r14
+  804af8:	41 55                	push   %r13
+  804afa:	41 54                	push   %r12
+  804afc:	53                   	push   %rbx
+  804afd:	48 83 ec 28          	sub    $0x28,%rsp
+  804b01:	49 89 fe             	mov    %rdi,%r14
+  804b04:	49 89 f7             	mov    %rsi,%r15
+  804b07:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804b0e:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804b0f:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  804b16:	7f 00 00 
+  804b19:	e9 b0 00 00 00       	jmp    804bce <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804b1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804b25:	49 83 ec 01          	sub    $0x1,%r12
+  804b29:	74 2d                	je     804b58 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804b2b:	48 89 d8             	mov    %rbx,%rax
+  804b2e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b32:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804b37:	f6 c2 01             	test   $0x1,%dl
+  804b3a:	74 e2                	je     804b1e <foreach_shared_region+0x42>
+  804b3c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804b41:	f6 c4 04             	test   $0x4,%ah
+  804b44:	74 d8                	je     804b1e <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  804b46:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804b4d:	4c 89 fa             	mov    %r15,%rdx
+  804b50:	48 89 df             	mov    %rbx,%rdi
+  804b53:	41 ff d6             	call   *%r14
+  804b56:	eb c6                	jmp    804b1e <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804b58:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804b5f:	00 
+  804b60:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804b65:	74 4c                	je     804bb3 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  804b67:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804b6b:	48 89 c8             	mov    %rcx,%rax
+  804b6e:	48 c1 e8 15          	shr    $0x15,%rax
+  804b72:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  804b79:	7f 00 00 
+  804b7c:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804b80:	a8 01                	test   $0x1,%al
+  804b82:	74 d4                	je     804b58 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804b84:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  804b8b:	48 39 c1             	cmp    %rax,%rcx
+  804b8e:	73 c8                	jae    804b58 <foreach_shared_region+0x7c>
+  804b90:	48 89 cb             	mov    %rcx,%rbx
+  804b93:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  804b9a:	48 39 d0             	cmp    %rdx,%rax
+  804b9d:	4d 19 e4             	sbb    %r12,%r12
+  804ba0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804ba7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804bae:	e9 78 ff ff ff       	jmp    804b2b <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804bb3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804bba:	40 
+  804bbb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804bbf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804bc6:	00 00 00 
+  804bc9:	48 39 c1             	cmp    %rax,%rcx
+  804bcc:	74 4f                	je     804c1d <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804bce:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804bd2:	48 89 c8             	mov    %rcx,%rax
+  804bd5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804bd9:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804be0:	7f 00 00 
+  804be3:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  804be7:	a8 01                	test   $0x1,%al
+  804be9:	74 c8                	je     804bb3 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804beb:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804bf2:	48 39 c1             	cmp    %rax,%rcx
+  804bf5:	73 bc                	jae    804bb3 <foreach_shared_region+0xd7>
+  804bf7:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804bfe:	48 39 d0             	cmp    %rdx,%rax
+  804c01:	48 19 c0             	sbb    %rax,%rax
+  804c04:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804c0a:	48 05 00 02 00 00    	add    $0x200,%rax
+  804c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804c14:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804c18:	e9 4a ff ff ff       	jmp    804b67 <foreach_shared_region+0x8b>
+}
+  804c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c22:	48 83 c4 28          	add    $0x28,%rsp
+  804c26:	5b                   	pop    %rbx
+  804c27:	41 5c                	pop    %r12
+  804c29:	41 5d                	pop    %r13
+  804c2b:	41 5e                	pop    %r14
+  804c2d:	41 5f                	pop    %r15
+  804c2f:	5d                   	pop    %rbp
+  804c30:	c3                   	ret
+
+0000000000804c31 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  804c31:	55                   	push   %rbp
+  804c32:	48 89 e5             	mov    %rsp,%rbp
+  804c35:	41 55                	push   %r13
+  804c37:	41 54                	push   %r12
+  804c39:	53                   	push   %rbx
+  804c3a:	48 83 ec 08          	sub    $0x8,%rsp
+  804c3e:	49 89 fc             	mov    %rdi,%r12
+  804c41:	48 89 f7             	mov    %rsi,%rdi
+  804c44:	48 89 d3             	mov    %rdx,%rbx
+  804c47:	49 89 cd             	mov    %rcx,%r13
+  804c4a:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c4d:	48 85 f6             	test   %rsi,%rsi
+  804c50:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c57:	00 00 00 
+  804c5a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  804c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  804c63:	48 85 db             	test   %rbx,%rbx
+  804c66:	74 03                	je     804c6b <ipc_recv_timeout+0x3a>
+  804c68:	48 8b 33             	mov    (%rbx),%rsi
+  804c6b:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  804c72:	00 00 00 
+  804c75:	ff d0                	call   *%rax
+    if (res == 0) {
+  804c77:	85 c0                	test   %eax,%eax
+  804c79:	75 72                	jne    804ced <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804c7b:	4d 85 e4             	test   %r12,%r12
+  804c7e:	74 17                	je     804c97 <ipc_recv_timeout+0x66>
+    asm("movq %%fs:0, %0"
+  804c80:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804c87:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804c89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c8d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804c93:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804c97:	4d 85 ed             	test   %r13,%r13
+  804c9a:	74 17                	je     804cb3 <ipc_recv_timeout+0x82>
+  804c9c:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804ca3:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804ca5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ca9:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804caf:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804cb3:	48 85 db             	test   %rbx,%rbx
+  804cb6:	74 17                	je     804ccf <ipc_recv_timeout+0x9e>
+  804cb8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cbf:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  804cc1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804cc5:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804ccc:	48 89 03             	mov    %rax,(%rbx)
+  804ccf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804cd6:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804cd8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804cdc:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804ce2:	48 83 c4 08          	add    $0x8,%rsp
+  804ce6:	5b                   	pop    %rbx
+  804ce7:	41 5c                	pop    %r12
+  804ce9:	41 5d                	pop    %r13
+  804ceb:	5d                   	pop    %rbp
+  804cec:	c3                   	ret
+        if (from_env_store) {
+  804ced:	4d 85 e4             	test   %r12,%r12
+  804cf0:	74 08                	je     804cfa <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804cf2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804cf9:	00 
+        if (perm_store) {
+  804cfa:	4d 85 ed             	test   %r13,%r13
+  804cfd:	74 08                	je     804d07 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  804cff:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804d06:	00 
+        if (size) {
+  804d07:	48 85 db             	test   %rbx,%rbx
+  804d0a:	74 d6                	je     804ce2 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  804d0c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804d13:	eb cd                	jmp    804ce2 <ipc_recv_timeout+0xb1>
+
+0000000000804d15 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804d15:	55                   	push   %rbp
+  804d16:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804d19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804d1f:	48 b8 31 4c 80 00 00 	movabs $0x804c31,%rax
+  804d26:	00 00 00 
+  804d29:	ff d0                	call   *%rax
+}
+  804d2b:	5d                   	pop    %rbp
+  804d2c:	c3                   	ret
+
+0000000000804d2d <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804d2d:	55                   	push   %rbp
+  804d2e:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804d31:	48 85 d2             	test   %rdx,%rdx
+  804d34:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d3b:	00 00 00 
+  804d3e:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  804d42:	89 f6                	mov    %esi,%esi
+  804d44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804d4a:	48 b8 49 1c 80 00 00 	movabs $0x801c49,%rax
+  804d51:	00 00 00 
+  804d54:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804d56:	85 c0                	test   %eax,%eax
+  804d58:	78 02                	js     804d5c <ipc_send+0x2f>
+}
+  804d5a:	5d                   	pop    %rbp
+  804d5b:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  804d5c:	89 c1                	mov    %eax,%ecx
+  804d5e:	48 ba 2a 69 80 00 00 	movabs $0x80692a,%rdx
+  804d65:	00 00 00 
+  804d68:	be 51 00 00 00       	mov    $0x51,%esi
+  804d6d:	48 bf 41 69 80 00 00 	movabs $0x806941,%rdi
+  804d74:	00 00 00 
+  804d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7c:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  804d83:	00 00 00 
+  804d86:	41 ff d0             	call   *%r8
+
+0000000000804d89 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804d89:	55                   	push   %rbp
+  804d8a:	48 89 e5             	mov    %rsp,%rbp
+  804d8d:	41 54                	push   %r12
+  804d8f:	53                   	push   %rbx
+  804d90:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804d94:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804d98:	48 85 d2             	test   %rdx,%rdx
+  804d9b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804da2:	00 00 00 
+  804da5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804da9:	4d 85 c9             	test   %r9,%r9
+  804dac:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  804db0:	89 f6                	mov    %esi,%esi
+  804db2:	48 83 ec 08          	sub    $0x8,%rsp
+  804db6:	53                   	push   %rbx
+  804db7:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  804dbe:	00 00 00 
+  804dc1:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804dc3:	48 83 c4 10          	add    $0x10,%rsp
+  804dc7:	85 c0                	test   %eax,%eax
+  804dc9:	78 65                	js     804e30 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804dcb:	4d 85 e4             	test   %r12,%r12
+  804dce:	74 17                	je     804de7 <ipc_call+0x5e>
+  804dd0:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804dd7:	00 00 
+  804dd9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ddd:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804de3:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804de7:	48 85 db             	test   %rbx,%rbx
+  804dea:	74 28                	je     804e14 <ipc_call+0x8b>
+  804dec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804df3:	00 00 
+  804df5:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804df9:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804e00:	ba 20 00 00 00       	mov    $0x20,%edx
+  804e05:	48 89 df             	mov    %rbx,%rdi
+  804e08:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  804e0f:	00 00 00 
+  804e12:	ff d0                	call   *%rax
+  804e14:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804e1b:	00 00 
+    return thisenv->env_ipc_value;
+  804e1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e21:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804e27:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804e2b:	5b                   	pop    %rbx
+  804e2c:	41 5c                	pop    %r12
+  804e2e:	5d                   	pop    %rbp
+  804e2f:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804e30:	89 c1                	mov    %eax,%ecx
+  804e32:	48 ba 4b 69 80 00 00 	movabs $0x80694b,%rdx
+  804e39:	00 00 00 
+  804e3c:	be 62 00 00 00       	mov    $0x62,%esi
+  804e41:	48 bf 41 69 80 00 00 	movabs $0x806941,%rdi
+  804e48:	00 00 00 
+  804e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e50:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  804e57:	00 00 00 
+  804e5a:	41 ff d0             	call   *%r8
+
+0000000000804e5d <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804e5d:	55                   	push   %rbp
+  804e5e:	48 89 e5             	mov    %rsp,%rbp
+  804e61:	41 57                	push   %r15
+  804e63:	41 56                	push   %r14
+  804e65:	41 55                	push   %r13
+  804e67:	41 54                	push   %r12
+  804e69:	53                   	push   %rbx
+  804e6a:	48 83 ec 20          	sub    $0x20,%rsp
+  804e6e:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804e71:	48 89 d3             	mov    %rdx,%rbx
+  804e74:	49 89 ce             	mov    %rcx,%r14
+  804e77:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804e7b:	4d 89 cd             	mov    %r9,%r13
+  804e7e:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804e82:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804e86:	48 85 d2             	test   %rdx,%rdx
+  804e89:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e90:	00 00 00 
+  804e93:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804e97:	4d 85 e4             	test   %r12,%r12
+  804e9a:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804e9e:	89 f0                	mov    %esi,%eax
+  804ea0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ea4:	41 57                	push   %r15
+  804ea6:	4d 89 e1             	mov    %r12,%r9
+  804ea9:	48 89 da             	mov    %rbx,%rdx
+  804eac:	48 89 c6             	mov    %rax,%rsi
+  804eaf:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  804eb6:	00 00 00 
+  804eb9:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804ebb:	48 83 c4 10          	add    $0x10,%rsp
+  804ebf:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804ec2:	0f 84 93 00 00 00    	je     804f5b <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804ec8:	85 c0                	test   %eax,%eax
+  804eca:	0f 88 f3 00 00 00    	js     804fc3 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804ed0:	4d 85 ed             	test   %r13,%r13
+  804ed3:	74 17                	je     804eec <ipc_reply_wait+0x8f>
+  804ed5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804edc:	00 00 
+  804ede:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ee2:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804ee8:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804eec:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  804ef1:	74 19                	je     804f0c <ipc_reply_wait+0xaf>
+  804ef3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804efa:	00 00 
+  804efc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f00:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804f06:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804f0a:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804f0c:	4d 85 ff             	test   %r15,%r15
+  804f0f:	74 28                	je     804f39 <ipc_reply_wait+0xdc>
+  804f11:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804f18:	00 00 
+  804f1a:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804f1e:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804f25:	ba 20 00 00 00       	mov    $0x20,%edx
+  804f2a:	4c 89 ff             	mov    %r15,%rdi
+  804f2d:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  804f34:	00 00 00 
+  804f37:	ff d0                	call   *%rax
+  804f39:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804f40:	00 00 
+    return thisenv->env_ipc_value;
+  804f42:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f46:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804f4c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804f50:	5b                   	pop    %rbx
+  804f51:	41 5c                	pop    %r12
+  804f53:	41 5d                	pop    %r13
+  804f55:	41 5e                	pop    %r14
+  804f57:	41 5f                	pop    %r15
+  804f59:	5d                   	pop    %rbp
+  804f5a:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  804f5b:	4d 89 f9             	mov    %r15,%r9
+  804f5e:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804f62:	4c 89 f1             	mov    %r14,%rcx
+  804f65:	48 89 da             	mov    %rbx,%rdx
+  804f68:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804f6c:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804f6f:	48 b8 49 1c 80 00 00 	movabs $0x801c49,%rax
+  804f76:	00 00 00 
+  804f79:	ff d0                	call   *%rax
+  804f7b:	85 c0                	test   %eax,%eax
+  804f7d:	78 17                	js     804f96 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804f7f:	4c 89 f6             	mov    %r14,%rsi
+  804f82:	4c 89 e7             	mov    %r12,%rdi
+  804f85:	48 b8 ca 1c 80 00 00 	movabs $0x801cca,%rax
+  804f8c:	00 00 00 
+  804f8f:	ff d0                	call   *%rax
+  804f91:	e9 32 ff ff ff       	jmp    804ec8 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804f96:	89 c1                	mov    %eax,%ecx
+  804f98:	48 ba 2a 69 80 00 00 	movabs $0x80692a,%rdx
+  804f9f:	00 00 00 
+  804fa2:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804fa7:	48 bf 41 69 80 00 00 	movabs $0x806941,%rdi
+  804fae:	00 00 00 
+  804fb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb6:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  804fbd:	00 00 00 
+  804fc0:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804fc3:	89 c1                	mov    %eax,%ecx
+  804fc5:	48 ba 62 69 80 00 00 	movabs $0x806962,%rdx
+  804fcc:	00 00 00 
+  804fcf:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804fd4:	48 bf 41 69 80 00 00 	movabs $0x806941,%rdi
+  804fdb:	00 00 00 
+  804fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe3:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  804fea:	00 00 00 
+  804fed:	41 ff d0             	call   *%r8
+
+0000000000804ff0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804ff5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804ffc:	00 00 00 
+  804fff:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  805006:	48 01 ca             	add    %rcx,%rdx
+  805009:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80500f:	39 fa                	cmp    %edi,%edx
+  805011:	74 12                	je     805025 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805013:	48 83 c0 01          	add    $0x1,%rax
+  805017:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80501d:	75 e0                	jne    804fff <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80501f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805024:	c3                   	ret
+            return envs[i].env_id;
+  805025:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80502c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805033:	00 00 00 
+  805036:	48 01 d0             	add    %rdx,%rax
+  805039:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80503f:	c3                   	ret
+
+0000000000805040 <__text_end>:
+  805040:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805047:	00 00 00 
+  80504a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805051:	00 00 00 
+  805054:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80505b:	00 00 00 
+  80505e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805065:	00 00 00 
+  805068:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80506f:	00 00 00 
+  805072:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805079:	00 00 00 
+  80507c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805083:	00 00 00 
+  805086:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80508d:	00 00 00 
+  805090:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805097:	00 00 00 
+  80509a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050a1:	00 00 00 
+  8050a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050ab:	00 00 00 
+  8050ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050b5:	00 00 00 
+  8050b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050bf:	00 00 00 
+  8050c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050c9:	00 00 00 
+  8050cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050d3:	00 00 00 
+  8050d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050dd:	00 00 00 
+  8050e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050e7:	00 00 00 
+  8050ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050f1:	00 00 00 
+  8050f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8050fb:	00 00 00 
+  8050fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805105:	00 00 00 
+  805108:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80510f:	00 00 00 
+  805112:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805119:	00 00 00 
+  80511c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805123:	00 00 00 
+  805126:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80512d:	00 00 00 
+  805130:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805137:	00 00 00 
+  80513a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805141:	00 00 00 
+  805144:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80514b:	00 00 00 
+  80514e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805155:	00 00 00 
+  805158:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80515f:	00 00 00 
+  805162:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805169:	00 00 00 
+  80516c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805173:	00 00 00 
+  805176:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80517d:	00 00 00 
+  805180:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805187:	00 00 00 
+  80518a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805191:	00 00 00 
+  805194:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80519b:	00 00 00 
+  80519e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051a5:	00 00 00 
+  8051a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051af:	00 00 00 
+  8051b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051b9:	00 00 00 
+  8051bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051c3:	00 00 00 
+  8051c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051cd:	00 00 00 
+  8051d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051d7:	00 00 00 
+  8051da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051e1:	00 00 00 
+  8051e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051eb:	00 00 00 
+  8051ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051f5:	00 00 00 
+  8051f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051ff:	00 00 00 
+  805202:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805209:	00 00 00 
+  80520c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805213:	00 00 00 
+  805216:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80521d:	00 00 00 
+  805220:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805227:	00 00 00 
+  80522a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805231:	00 00 00 
+  805234:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80523b:	00 00 00 
+  80523e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805245:	00 00 00 
+  805248:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80524f:	00 00 00 
+  805252:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805259:	00 00 00 
+  80525c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805263:	00 00 00 
+  805266:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80526d:	00 00 00 
+  805270:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805277:	00 00 00 
+  80527a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805281:	00 00 00 
+  805284:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80528b:	00 00 00 
+  80528e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805295:	00 00 00 
+  805298:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80529f:	00 00 00 
+  8052a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052a9:	00 00 00 
+  8052ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052b3:	00 00 00 
+  8052b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052bd:	00 00 00 
+  8052c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052c7:	00 00 00 
+  8052ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052d1:	00 00 00 
+  8052d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052db:	00 00 00 
+  8052de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052e5:	00 00 00 
+  8052e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ef:	00 00 00 
+  8052f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052f9:	00 00 00 
+  8052fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805303:	00 00 00 
+  805306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80530d:	00 00 00 
+  805310:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805317:	00 00 00 
+  80531a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805321:	00 00 00 
+  805324:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80532b:	00 00 00 
+  80532e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805335:	00 00 00 
+  805338:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80533f:	00 00 00 
+  805342:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805349:	00 00 00 
+  80534c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805353:	00 00 00 
+  805356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80535d:	00 00 00 
+  805360:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805367:	00 00 00 
+  80536a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805371:	00 00 00 
+  805374:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80537b:	00 00 00 
+  80537e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805385:	00 00 00 
+  805388:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80538f:	00 00 00 
+  805392:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805399:	00 00 00 
+  80539c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053a3:	00 00 00 
+  8053a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053ad:	00 00 00 
+  8053b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053b7:	00 00 00 
+  8053ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053c1:	00 00 00 
+  8053c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053cb:	00 00 00 
+  8053ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053d5:	00 00 00 
+  8053d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053df:	00 00 00 
+  8053e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053e9:	00 00 00 
+  8053ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053f3:	00 00 00 
+  8053f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053fd:	00 00 00 
+  805400:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805407:	00 00 00 
+  80540a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805411:	00 00 00 
+  805414:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80541b:	00 00 00 
+  80541e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805425:	00 00 00 
+  805428:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80542f:	00 00 00 
+  805432:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805439:	00 00 00 
+  80543c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805443:	00 00 00 
+  805446:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80544d:	00 00 00 
+  805450:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805457:	00 00 00 
+  80545a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805461:	00 00 00 
+  805464:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80546b:	00 00 00 
+  80546e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805475:	00 00 00 
+  805478:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80547f:	00 00 00 
+  805482:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805489:	00 00 00 
+  80548c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805493:	00 00 00 
+  805496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80549d:	00 00 00 
+  8054a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054a7:	00 00 00 
+  8054aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054b1:	00 00 00 
+  8054b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054bb:	00 00 00 
+  8054be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054c5:	00 00 00 
+  8054c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054cf:	00 00 00 
+  8054d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054d9:	00 00 00 
+  8054dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054e3:	00 00 00 
+  8054e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ed:	00 00 00 
+  8054f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054f7:	00 00 00 
+  8054fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805501:	00 00 00 
+  805504:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80550b:	00 00 00 
+  80550e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805515:	00 00 00 
+  805518:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80551f:	00 00 00 
+  805522:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805529:	00 00 00 
+  80552c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805533:	00 00 00 
+  805536:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80553d:	00 00 00 
+  805540:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805547:	00 00 00 
+  80554a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805551:	00 00 00 
+  805554:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80555b:	00 00 00 
+  80555e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805565:	00 00 00 
+  805568:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80556f:	00 00 00 
+  805572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805579:	00 00 00 
+  80557c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805583:	00 00 00 
+  805586:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80558d:	00 00 00 
+  805590:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805597:	00 00 00 
+  80559a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055a1:	00 00 00 
+  8055a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055ab:	00 00 00 
+  8055ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055b5:	00 00 00 
+  8055b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055bf:	00 00 00 
+  8055c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055c9:	00 00 00 
+  8055cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055d3:	00 00 00 
+  8055d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055dd:	00 00 00 
+  8055e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055e7:	00 00 00 
+  8055ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055f1:	00 00 00 
+  8055f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055fb:	00 00 00 
+  8055fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805605:	00 00 00 
+  805608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80560f:	00 00 00 
+  805612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805619:	00 00 00 
+  80561c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805623:	00 00 00 
+  805626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80562d:	00 00 00 
+  805630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805637:	00 00 00 
+  80563a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805641:	00 00 00 
+  805644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80564b:	00 00 00 
+  80564e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805655:	00 00 00 
+  805658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80565f:	00 00 00 
+  805662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805669:	00 00 00 
+  80566c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805673:	00 00 00 
+  805676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80567d:	00 00 00 
+  805680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805687:	00 00 00 
+  80568a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805691:	00 00 00 
+  805694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80569b:	00 00 00 
+  80569e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056a5:	00 00 00 
+  8056a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056af:	00 00 00 
+  8056b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056b9:	00 00 00 
+  8056bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056c3:	00 00 00 
+  8056c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056cd:	00 00 00 
+  8056d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d7:	00 00 00 
+  8056da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056e1:	00 00 00 
+  8056e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056eb:	00 00 00 
+  8056ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056f5:	00 00 00 
+  8056f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ff:	00 00 00 
+  805702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805709:	00 00 00 
+  80570c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805713:	00 00 00 
+  805716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80571d:	00 00 00 
+  805720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805727:	00 00 00 
+  80572a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805731:	00 00 00 
+  805734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80573b:	00 00 00 
+  80573e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805745:	00 00 00 
+  805748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80574f:	00 00 00 
+  805752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805759:	00 00 00 
+  80575c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805763:	00 00 00 
+  805766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80576d:	00 00 00 
+  805770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805777:	00 00 00 
+  80577a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805781:	00 00 00 
+  805784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80578b:	00 00 00 
+  80578e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805795:	00 00 00 
+  805798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80579f:	00 00 00 
+  8057a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057a9:	00 00 00 
+  8057ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057b3:	00 00 00 
+  8057b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057bd:	00 00 00 
+  8057c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057c7:	00 00 00 
+  8057ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057d1:	00 00 00 
+  8057d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057db:	00 00 00 
+  8057de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057e5:	00 00 00 
+  8057e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ef:	00 00 00 
+  8057f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057f9:	00 00 00 
+  8057fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805803:	00 00 00 
+  805806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80580d:	00 00 00 
+  805810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805817:	00 00 00 
+  80581a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805821:	00 00 00 
+  805824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80582b:	00 00 00 
+  80582e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805835:	00 00 00 
+  805838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80583f:	00 00 00 
+  805842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805849:	00 00 00 
+  80584c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805853:	00 00 00 
+  805856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80585d:	00 00 00 
+  805860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805867:	00 00 00 
+  80586a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805871:	00 00 00 
+  805874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80587b:	00 00 00 
+  80587e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805885:	00 00 00 
+  805888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80588f:	00 00 00 
+  805892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805899:	00 00 00 
+  80589c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058a3:	00 00 00 
+  8058a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058ad:	00 00 00 
+  8058b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058b7:	00 00 00 
+  8058ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058c1:	00 00 00 
+  8058c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058cb:	00 00 00 
+  8058ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058d5:	00 00 00 
+  8058d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058df:	00 00 00 
+  8058e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058e9:	00 00 00 
+  8058ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058f3:	00 00 00 
+  8058f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058fd:	00 00 00 
+  805900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805907:	00 00 00 
+  80590a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805911:	00 00 00 
+  805914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80591b:	00 00 00 
+  80591e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805925:	00 00 00 
+  805928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80592f:	00 00 00 
+  805932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805939:	00 00 00 
+  80593c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805943:	00 00 00 
+  805946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80594d:	00 00 00 
+  805950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805957:	00 00 00 
+  80595a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805961:	00 00 00 
+  805964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80596b:	00 00 00 
+  80596e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805975:	00 00 00 
+  805978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80597f:	00 00 00 
+  805982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805989:	00 00 00 
+  80598c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805993:	00 00 00 
+  805996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80599d:	00 00 00 
+  8059a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a7:	00 00 00 
+  8059aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b1:	00 00 00 
+  8059b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059bb:	00 00 00 
+  8059be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c5:	00 00 00 
+  8059c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059cf:	00 00 00 
+  8059d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d9:	00 00 00 
+  8059dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e3:	00 00 00 
+  8059e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ed:	00 00 00 
+  8059f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f7:	00 00 00 
+  8059fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a01:	00 00 00 
+  805a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a0b:	00 00 00 
+  805a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a15:	00 00 00 
+  805a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1f:	00 00 00 
+  805a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a29:	00 00 00 
+  805a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a33:	00 00 00 
+  805a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a3d:	00 00 00 
+  805a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a47:	00 00 00 
+  805a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a51:	00 00 00 
+  805a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a5b:	00 00 00 
+  805a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a65:	00 00 00 
+  805a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6f:	00 00 00 
+  805a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a79:	00 00 00 
+  805a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a83:	00 00 00 
+  805a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a8d:	00 00 00 
+  805a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a97:	00 00 00 
+  805a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa1:	00 00 00 
+  805aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aab:	00 00 00 
+  805aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab5:	00 00 00 
+  805ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abf:	00 00 00 
+  805ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac9:	00 00 00 
+  805acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad3:	00 00 00 
+  805ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805add:	00 00 00 
+  805ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae7:	00 00 00 
+  805aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af1:	00 00 00 
+  805af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805afb:	00 00 00 
+  805afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b05:	00 00 00 
+  805b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0f:	00 00 00 
+  805b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b19:	00 00 00 
+  805b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b23:	00 00 00 
+  805b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b2d:	00 00 00 
+  805b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b37:	00 00 00 
+  805b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b41:	00 00 00 
+  805b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b4b:	00 00 00 
+  805b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b55:	00 00 00 
+  805b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5f:	00 00 00 
+  805b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b69:	00 00 00 
+  805b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b73:	00 00 00 
+  805b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b7d:	00 00 00 
+  805b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b87:	00 00 00 
+  805b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b91:	00 00 00 
+  805b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b9b:	00 00 00 
+  805b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba5:	00 00 00 
+  805ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805baf:	00 00 00 
+  805bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb9:	00 00 00 
+  805bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc3:	00 00 00 
+  805bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bcd:	00 00 00 
+  805bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd7:	00 00 00 
+  805bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be1:	00 00 00 
+  805be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805beb:	00 00 00 
+  805bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf5:	00 00 00 
+  805bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bff:	00 00 00 
+  805c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c09:	00 00 00 
+  805c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c13:	00 00 00 
+  805c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c1d:	00 00 00 
+  805c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c27:	00 00 00 
+  805c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c31:	00 00 00 
+  805c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c3b:	00 00 00 
+  805c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c45:	00 00 00 
+  805c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4f:	00 00 00 
+  805c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c59:	00 00 00 
+  805c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c63:	00 00 00 
+  805c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c6d:	00 00 00 
+  805c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c77:	00 00 00 
+  805c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c81:	00 00 00 
+  805c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c8b:	00 00 00 
+  805c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c95:	00 00 00 
+  805c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9f:	00 00 00 
+  805ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca9:	00 00 00 
+  805cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb3:	00 00 00 
+  805cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cbd:	00 00 00 
+  805cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc7:	00 00 00 
+  805cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd1:	00 00 00 
+  805cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cdb:	00 00 00 
+  805cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce5:	00 00 00 
+  805ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cef:	00 00 00 
+  805cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf9:	00 00 00 
+  805cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d03:	00 00 00 
+  805d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d0d:	00 00 00 
+  805d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d17:	00 00 00 
+  805d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d21:	00 00 00 
+  805d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d2b:	00 00 00 
+  805d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d35:	00 00 00 
+  805d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3f:	00 00 00 
+  805d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d49:	00 00 00 
+  805d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d53:	00 00 00 
+  805d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d5d:	00 00 00 
+  805d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d67:	00 00 00 
+  805d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d71:	00 00 00 
+  805d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d7b:	00 00 00 
+  805d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d85:	00 00 00 
+  805d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8f:	00 00 00 
+  805d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d99:	00 00 00 
+  805d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da3:	00 00 00 
+  805da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dad:	00 00 00 
+  805db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db7:	00 00 00 
+  805dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc1:	00 00 00 
+  805dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dcb:	00 00 00 
+  805dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd5:	00 00 00 
+  805dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ddf:	00 00 00 
+  805de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de9:	00 00 00 
+  805dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df3:	00 00 00 
+  805df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dfd:	00 00 00 
+  805e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e07:	00 00 00 
+  805e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e11:	00 00 00 
+  805e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e1b:	00 00 00 
+  805e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e25:	00 00 00 
+  805e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2f:	00 00 00 
+  805e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e39:	00 00 00 
+  805e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e43:	00 00 00 
+  805e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e4d:	00 00 00 
+  805e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e57:	00 00 00 
+  805e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e61:	00 00 00 
+  805e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e6b:	00 00 00 
+  805e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e75:	00 00 00 
+  805e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7f:	00 00 00 
+  805e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e89:	00 00 00 
+  805e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e93:	00 00 00 
+  805e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e9d:	00 00 00 
+  805ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea7:	00 00 00 
+  805eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb1:	00 00 00 
+  805eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ebb:	00 00 00 
+  805ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec5:	00 00 00 
+  805ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ecf:	00 00 00 
+  805ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed9:	00 00 00 
+  805edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee3:	00 00 00 
+  805ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eed:	00 00 00 
+  805ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef7:	00 00 00 
+  805efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f01:	00 00 00 
+  805f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f0b:	00 00 00 
+  805f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f15:	00 00 00 
+  805f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1f:	00 00 00 
+  805f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f29:	00 00 00 
+  805f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f33:	00 00 00 
+  805f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f3d:	00 00 00 
+  805f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f47:	00 00 00 
+  805f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f51:	00 00 00 
+  805f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f5b:	00 00 00 
+  805f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f65:	00 00 00 
+  805f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6f:	00 00 00 
+  805f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f79:	00 00 00 
+  805f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f83:	00 00 00 
+  805f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f8d:	00 00 00 
+  805f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f97:	00 00 00 
+  805f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa1:	00 00 00 
+  805fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fab:	00 00 00 
+  805fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb5:	00 00 00 
+  805fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbf:	00 00 00 
+  805fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc9:	00 00 00 
+  805fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd3:	00 00 00 
+  805fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fdd:	00 00 00 
+  805fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe7:	00 00 00 
+  805fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff1:	00 00 00 
+  805ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ffb:	00 00 00 
+  805ffe:	66 90                	xchg   %ax,%ax
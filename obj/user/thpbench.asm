@@ -0,0 +1,8018 @@
+
+obj/user/thpbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 20 05 00 00       	call   800543 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <touch>:
+is_huge(void *va) {
+    return get_uvpt_entry(va) & PTE_PS;
+}
+
+static void
+touch(const char *what, char *va) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800029:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80002b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80002f:	89 c0                	mov    %eax,%eax
+  800031:	48 89 d1             	mov    %rdx,%rcx
+  800034:	48 09 c1             	or     %rax,%rcx
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < NPAGES; i++) va[i * PAGE_SIZE] = (char)i;
+  800037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003c:	48 89 c2             	mov    %rax,%rdx
+  80003f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800043:	88 04 16             	mov    %al,(%rsi,%rdx,1)
+  800046:	48 83 c0 01          	add    $0x1,%rax
+  80004a:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  800050:	75 ea                	jne    80003c <touch+0x17>
+    asm volatile("rdtsc"
+  800052:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800054:	48 c1 e2 20          	shl    $0x20,%rdx
+  800058:	89 c0                	mov    %eax,%eax
+  80005a:	48 09 c2             	or     %rax,%rdx
+    report(what, read_tsc() - start, NPAGES);
+  80005d:	48 29 ca             	sub    %rcx,%rdx
+    cprintf("thpbench: %s: %lu cycles\n", what, (unsigned long)(cycles / n));
+  800060:	48 c1 ea 0e          	shr    $0xe,%rdx
+  800064:	48 89 fe             	mov    %rdi,%rsi
+  800067:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80006e:	00 00 00 
+  800071:	b8 00 00 00 00       	mov    $0x0,%eax
+  800076:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  80007d:	00 00 00 
+  800080:	ff d1                	call   *%rcx
+}
+  800082:	5d                   	pop    %rbp
+  800083:	c3                   	ret
+
+0000000000800084 <sweep>:
+
+static void
+sweep(const char *what, char *va) {
+  800084:	55                   	push   %rbp
+  800085:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  800088:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80008a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80008e:	89 c0                	mov    %eax,%eax
+  800090:	48 09 c2             	or     %rax,%rdx
+  800093:	49 89 d0             	mov    %rdx,%r8
+    volatile uint64_t *words = (volatile uint64_t *)va;
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < NACCESS; i++) words[xorshift() % (REGION_SIZE / sizeof(uint64_t))]++;
+  800096:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80009d:	00 00 00 
+  8000a0:	41 b9 00 00 40 00    	mov    $0x400000,%r9d
+    rng ^= rng << 13;
+  8000a6:	48 89 c2             	mov    %rax,%rdx
+  8000a9:	48 c1 e2 0d          	shl    $0xd,%rdx
+  8000ad:	48 31 d0             	xor    %rdx,%rax
+    rng ^= rng >> 7;
+  8000b0:	48 89 c2             	mov    %rax,%rdx
+  8000b3:	48 c1 ea 07          	shr    $0x7,%rdx
+  8000b7:	48 31 c2             	xor    %rax,%rdx
+    rng ^= rng << 17;
+  8000ba:	48 89 d0             	mov    %rdx,%rax
+  8000bd:	48 c1 e0 11          	shl    $0x11,%rax
+  8000c1:	48 31 d0             	xor    %rdx,%rax
+    for (size_t i = 0; i < NACCESS; i++) words[xorshift() % (REGION_SIZE / sizeof(uint64_t))]++;
+  8000c4:	48 89 c2             	mov    %rax,%rdx
+  8000c7:	81 e2 ff ff 7f 00    	and    $0x7fffff,%edx
+  8000cd:	48 8d 0c d6          	lea    (%rsi,%rdx,8),%rcx
+  8000d1:	48 8b 11             	mov    (%rcx),%rdx
+  8000d4:	48 83 c2 01          	add    $0x1,%rdx
+  8000d8:	48 89 11             	mov    %rdx,(%rcx)
+  8000db:	49 83 e9 01          	sub    $0x1,%r9
+  8000df:	75 c5                	jne    8000a6 <sweep+0x22>
+  8000e1:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000e8:	00 00 00 
+  8000eb:	48 89 11             	mov    %rdx,(%rcx)
+    asm volatile("rdtsc"
+  8000ee:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000f0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000f4:	89 c0                	mov    %eax,%eax
+  8000f6:	48 09 c2             	or     %rax,%rdx
+    report(what, read_tsc() - start, NACCESS);
+  8000f9:	4c 29 c2             	sub    %r8,%rdx
+    cprintf("thpbench: %s: %lu cycles\n", what, (unsigned long)(cycles / n));
+  8000fc:	48 c1 ea 16          	shr    $0x16,%rdx
+  800100:	48 89 fe             	mov    %rdi,%rsi
+  800103:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80010a:	00 00 00 
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800112:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  800119:	00 00 00 
+  80011c:	ff d1                	call   *%rcx
+}
+  80011e:	5d                   	pop    %rbp
+  80011f:	c3                   	ret
+
+0000000000800120 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800120:	55                   	push   %rbp
+  800121:	48 89 e5             	mov    %rsp,%rbp
+  800124:	41 56                	push   %r14
+  800126:	41 55                	push   %r13
+  800128:	41 54                	push   %r12
+  80012a:	53                   	push   %rbx
+    int res;
+
+    if ((res = sys_alloc_region(0, REGION_VA, REGION_SIZE, PROT_RW)) < 0)
+  80012b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800130:	ba 00 00 00 04       	mov    $0x4000000,%edx
+  800135:	be 00 00 00 40       	mov    $0x40000000,%esi
+  80013a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80013f:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  800146:	00 00 00 
+  800149:	ff d0                	call   *%rax
+  80014b:	85 c0                	test   %eax,%eax
+  80014d:	0f 88 ef 01 00 00    	js     800342 <umain+0x222>
+        panic("sys_alloc_region: %i", res);
+    touch("2M first touch/page", REGION_VA);
+  800153:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800158:	48 bf 3f 50 80 00 00 	movabs $0x80503f,%rdi
+  80015f:	00 00 00 
+  800162:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+  80016e:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+    return get_uvpt_entry(va) & PTE_PS;
+  800173:	49 bc aa 38 80 00 00 	movabs $0x8038aa,%r12
+  80017a:	00 00 00 
+  80017d:	48 89 df             	mov    %rbx,%rdi
+  800180:	41 ff d4             	call   *%r12
+    for (size_t i = 0; i < REGION_SIZE; i += HUGE_PAGE_SIZE)
+        if (!is_huge(REGION_VA + i)) panic("%p is not in a huge page", REGION_VA + i);
+  800183:	a8 80                	test   $0x80,%al
+  800185:	0f 84 e4 01 00 00    	je     80036f <umain+0x24f>
+    for (size_t i = 0; i < REGION_SIZE; i += HUGE_PAGE_SIZE)
+  80018b:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  800192:	48 81 fb 00 00 00 44 	cmp    $0x44000000,%rbx
+  800199:	75 e2                	jne    80017d <umain+0x5d>
+    sweep("2M random access", REGION_VA);
+  80019b:	be 00 00 00 40       	mov    $0x40000000,%esi
+  8001a0:	48 bf 6c 50 80 00 00 	movabs $0x80506c,%rdi
+  8001a7:	00 00 00 
+  8001aa:	48 b8 84 00 80 00 00 	movabs $0x800084,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+    sys_unmap_region(0, REGION_VA, REGION_SIZE);
+  8001b6:	ba 00 00 00 04       	mov    $0x4000000,%edx
+  8001bb:	be 00 00 00 40       	mov    $0x40000000,%esi
+  8001c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c5:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+  8001d1:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8001d6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+
+    for (size_t i = 0; i < NPAGES; i++) {
+        int mark = i & 1 ? SMALL_MARK : 0;
+        if ((res = sys_alloc_region(0, REGION_VA + i * PAGE_SIZE, PAGE_SIZE, PROT_RW | mark)) < 0)
+  8001dc:	49 bd 78 16 80 00 00 	movabs $0x801678,%r13
+  8001e3:	00 00 00 
+  8001e6:	44 89 e1             	mov    %r12d,%ecx
+  8001e9:	81 e1 00 02 00 00    	and    $0x200,%ecx
+  8001ef:	83 c9 06             	or     $0x6,%ecx
+  8001f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001f7:	48 89 de             	mov    %rbx,%rsi
+  8001fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ff:	41 ff d5             	call   *%r13
+  800202:	85 c0                	test   %eax,%eax
+  800204:	0f 88 93 01 00 00    	js     80039d <umain+0x27d>
+    for (size_t i = 0; i < NPAGES; i++) {
+  80020a:	41 81 c4 00 02 00 00 	add    $0x200,%r12d
+  800211:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800218:	48 81 fb 00 00 00 44 	cmp    $0x44000000,%rbx
+  80021f:	75 c5                	jne    8001e6 <umain+0xc6>
+            panic("sys_alloc_region: %i", res);
+    }
+    touch("4K first touch/page", REGION_VA);
+  800221:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800226:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  80022d:	00 00 00 
+  800230:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800237:	00 00 00 
+  80023a:	ff d0                	call   *%rax
+    return get_uvpt_entry(va) & PTE_PS;
+  80023c:	bf 00 00 00 40       	mov    $0x40000000,%edi
+  800241:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  800248:	00 00 00 
+  80024b:	ff d0                	call   *%rax
+    if (is_huge(REGION_VA)) panic("%p is in a huge page", REGION_VA);
+  80024d:	25 80 00 00 00       	and    $0x80,%eax
+  800252:	48 89 c3             	mov    %rax,%rbx
+  800255:	0f 85 6f 01 00 00    	jne    8003ca <umain+0x2aa>
+    sweep("4K random access", REGION_VA);
+  80025b:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800260:	48 bf a6 50 80 00 00 	movabs $0x8050a6,%rdi
+  800267:	00 00 00 
+  80026a:	48 b8 84 00 80 00 00 	movabs $0x800084,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+    sys_unmap_region(0, REGION_VA, REGION_SIZE);
+  800276:	ba 00 00 00 04       	mov    $0x4000000,%edx
+  80027b:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800280:	bf 00 00 00 00       	mov    $0x0,%edi
+  800285:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  80028c:	00 00 00 
+  80028f:	ff d0                	call   *%rax
+  800291:	41 bc 00 00 00 48    	mov    $0x48000000,%r12d
+
+    /* Every page is written before the next one is mapped,
+     * so the window is never covered by lazy mappings */
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++) {
+        if ((res = sys_alloc_region(0, WINDOW_VA + i * PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  800297:	49 bd 78 16 80 00 00 	movabs $0x801678,%r13
+  80029e:	00 00 00 
+  8002a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002ab:	4c 89 e6             	mov    %r12,%rsi
+  8002ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b3:	41 ff d5             	call   *%r13
+  8002b6:	85 c0                	test   %eax,%eax
+  8002b8:	0f 88 3c 01 00 00    	js     8003fa <umain+0x2da>
+            panic("sys_alloc_region: %i", res);
+        WINDOW_VA[i * PAGE_SIZE] = (char)i;
+  8002be:	41 88 1c 24          	mov    %bl,(%r12)
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++) {
+  8002c2:	48 83 c3 01          	add    $0x1,%rbx
+  8002c6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8002cd:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  8002d4:	75 cb                	jne    8002a1 <umain+0x181>
+    return get_uvpt_entry(va) & PTE_PS;
+  8002d6:	bf 00 00 00 48       	mov    $0x48000000,%edi
+  8002db:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+    }
+    if (is_huge(WINDOW_VA)) panic("%p is in a huge page before collapse", WINDOW_VA);
+  8002e7:	25 80 00 00 00       	and    $0x80,%eax
+  8002ec:	48 89 c3             	mov    %rax,%rbx
+  8002ef:	0f 85 32 01 00 00    	jne    800427 <umain+0x307>
+    asm volatile("rdtsc"
+  8002f5:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8002f7:	48 c1 e2 20          	shl    $0x20,%rdx
+  8002fb:	89 c0                	mov    %eax,%eax
+  8002fd:	48 09 c2             	or     %rax,%rdx
+  800300:	49 89 d4             	mov    %rdx,%r12
+    return get_uvpt_entry(va) & PTE_PS;
+  800303:	49 bd aa 38 80 00 00 	movabs $0x8038aa,%r13
+  80030a:	00 00 00 
+
+    uint64_t start = read_tsc();
+    while (!is_huge(WINDOW_VA)) {
+        if (read_tsc() - start > MAXWAIT) panic("%p was not collapsed", WINDOW_VA);
+  80030d:	49 be 00 00 00 00 04 	movabs $0x400000000,%r14
+  800314:	00 00 00 
+    return get_uvpt_entry(va) & PTE_PS;
+  800317:	bf 00 00 00 48       	mov    $0x48000000,%edi
+  80031c:	41 ff d5             	call   *%r13
+    while (!is_huge(WINDOW_VA)) {
+  80031f:	a8 80                	test   $0x80,%al
+  800321:	0f 85 60 01 00 00    	jne    800487 <umain+0x367>
+    asm volatile("rdtsc"
+  800327:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800329:	48 c1 e2 20          	shl    $0x20,%rdx
+  80032d:	89 c0                	mov    %eax,%eax
+  80032f:	48 09 c2             	or     %rax,%rdx
+        if (read_tsc() - start > MAXWAIT) panic("%p was not collapsed", WINDOW_VA);
+  800332:	4c 29 e2             	sub    %r12,%rdx
+  800335:	49 39 d6             	cmp    %rdx,%r14
+  800338:	0f 82 19 01 00 00    	jb     800457 <umain+0x337>
+        asm volatile("pause");
+  80033e:	f3 90                	pause
+  800340:	eb d5                	jmp    800317 <umain+0x1f7>
+        panic("sys_alloc_region: %i", res);
+  800342:	89 c1                	mov    %eax,%ecx
+  800344:	48 ba 1a 50 80 00 00 	movabs $0x80501a,%rdx
+  80034b:	00 00 00 
+  80034e:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800353:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80035a:	00 00 00 
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  800369:	00 00 00 
+  80036c:	41 ff d0             	call   *%r8
+        if (!is_huge(REGION_VA + i)) panic("%p is not in a huge page", REGION_VA + i);
+  80036f:	48 89 d9             	mov    %rbx,%rcx
+  800372:	48 ba 53 50 80 00 00 	movabs $0x805053,%rdx
+  800379:	00 00 00 
+  80037c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  800381:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800388:	00 00 00 
+  80038b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800390:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  800397:	00 00 00 
+  80039a:	41 ff d0             	call   *%r8
+            panic("sys_alloc_region: %i", res);
+  80039d:	89 c1                	mov    %eax,%ecx
+  80039f:	48 ba 1a 50 80 00 00 	movabs $0x80501a,%rdx
+  8003a6:	00 00 00 
+  8003a9:	be 44 00 00 00       	mov    $0x44,%esi
+  8003ae:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8003b5:	00 00 00 
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bd:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  8003c4:	00 00 00 
+  8003c7:	41 ff d0             	call   *%r8
+    if (is_huge(REGION_VA)) panic("%p is in a huge page", REGION_VA);
+  8003ca:	b9 00 00 00 40       	mov    $0x40000000,%ecx
+  8003cf:	48 ba 91 50 80 00 00 	movabs $0x805091,%rdx
+  8003d6:	00 00 00 
+  8003d9:	be 47 00 00 00       	mov    $0x47,%esi
+  8003de:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8003e5:	00 00 00 
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  8003f4:	00 00 00 
+  8003f7:	41 ff d0             	call   *%r8
+            panic("sys_alloc_region: %i", res);
+  8003fa:	89 c1                	mov    %eax,%ecx
+  8003fc:	48 ba 1a 50 80 00 00 	movabs $0x80501a,%rdx
+  800403:	00 00 00 
+  800406:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80040b:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800412:	00 00 00 
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  800421:	00 00 00 
+  800424:	41 ff d0             	call   *%r8
+    if (is_huge(WINDOW_VA)) panic("%p is in a huge page before collapse", WINDOW_VA);
+  800427:	b9 00 00 00 48       	mov    $0x48000000,%ecx
+  80042c:	48 ba 08 51 80 00 00 	movabs $0x805108,%rdx
+  800433:	00 00 00 
+  800436:	be 52 00 00 00       	mov    $0x52,%esi
+  80043b:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800442:	00 00 00 
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  800451:	00 00 00 
+  800454:	41 ff d0             	call   *%r8
+        if (read_tsc() - start > MAXWAIT) panic("%p was not collapsed", WINDOW_VA);
+  800457:	b9 00 00 00 48       	mov    $0x48000000,%ecx
+  80045c:	48 ba b7 50 80 00 00 	movabs $0x8050b7,%rdx
+  800463:	00 00 00 
+  800466:	be 56 00 00 00       	mov    $0x56,%esi
+  80046b:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  800481:	00 00 00 
+  800484:	41 ff d0             	call   *%r8
+    asm volatile("rdtsc"
+  800487:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800489:	48 c1 e2 20          	shl    $0x20,%rdx
+  80048d:	89 c0                	mov    %eax,%eax
+  80048f:	48 09 c2             	or     %rax,%rdx
+    }
+    report("collapse wait", read_tsc() - start, 1);
+  800492:	4c 29 e2             	sub    %r12,%rdx
+    cprintf("thpbench: %s: %lu cycles\n", what, (unsigned long)(cycles / n));
+  800495:	48 be cc 50 80 00 00 	movabs $0x8050cc,%rsi
+  80049c:	00 00 00 
+  80049f:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  8004a6:	00 00 00 
+  8004a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ae:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  8004b5:	00 00 00 
+  8004b8:	ff d1                	call   *%rcx
+  8004ba:	b8 00 00 00 48       	mov    $0x48000000,%eax
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++)
+        if (WINDOW_VA[i * PAGE_SIZE] != (char)i) panic("page %lu changed by collapse", (unsigned long)i);
+  8004bf:	38 18                	cmp    %bl,(%rax)
+  8004c1:	75 52                	jne    800515 <umain+0x3f5>
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++)
+  8004c3:	48 83 c3 01          	add    $0x1,%rbx
+  8004c7:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8004cd:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  8004d4:	75 e9                	jne    8004bf <umain+0x39f>
+    sys_unmap_region(0, WINDOW_VA, HUGE_PAGE_SIZE);
+  8004d6:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8004db:	be 00 00 00 48       	mov    $0x48000000,%esi
+  8004e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004e5:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+
+    cprintf("thpbench: OK\n");
+  8004f1:	48 bf f7 50 80 00 00 	movabs $0x8050f7,%rdi
+  8004f8:	00 00 00 
+  8004fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800500:	48 ba a3 07 80 00 00 	movabs $0x8007a3,%rdx
+  800507:	00 00 00 
+  80050a:	ff d2                	call   *%rdx
+}
+  80050c:	5b                   	pop    %rbx
+  80050d:	41 5c                	pop    %r12
+  80050f:	41 5d                	pop    %r13
+  800511:	41 5e                	pop    %r14
+  800513:	5d                   	pop    %rbp
+  800514:	c3                   	ret
+        if (WINDOW_VA[i * PAGE_SIZE] != (char)i) panic("page %lu changed by collapse", (unsigned long)i);
+  800515:	48 89 d9             	mov    %rbx,%rcx
+  800518:	48 ba da 50 80 00 00 	movabs $0x8050da,%rdx
+  80051f:	00 00 00 
+  800522:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800527:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80052e:	00 00 00 
+  800531:	b8 00 00 00 00       	mov    $0x0,%eax
+  800536:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  80053d:	00 00 00 
+  800540:	41 ff d0             	call   *%r8
+
+0000000000800543 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800543:	55                   	push   %rbp
+  800544:	48 89 e5             	mov    %rsp,%rbp
+  800547:	41 56                	push   %r14
+  800549:	41 55                	push   %r13
+  80054b:	41 54                	push   %r12
+  80054d:	53                   	push   %rbx
+  80054e:	48 83 ec 30          	sub    $0x30,%rsp
+  800552:	41 89 fd             	mov    %edi,%r13d
+  800555:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800558:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80055f:	00 
+  800560:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800567:	00 
+  800568:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80056f:	00 
+  800570:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800577:	00 
+  800578:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80057c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800580:	bf 00 00 00 00       	mov    $0x0,%edi
+  800585:	48 b8 42 18 80 00 00 	movabs $0x801842,%rax
+  80058c:	00 00 00 
+  80058f:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800591:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800598:	00 00 00 
+  80059b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8005a2:	00 00 00 
+  8005a5:	48 39 c2             	cmp    %rax,%rdx
+  8005a8:	73 17                	jae    8005c1 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8005aa:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005ad:	49 89 c4             	mov    %rax,%r12
+  8005b0:	48 83 c3 08          	add    $0x8,%rbx
+  8005b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b9:	ff 53 f8             	call   *-0x8(%rbx)
+  8005bc:	4c 39 e3             	cmp    %r12,%rbx
+  8005bf:	72 ef                	jb     8005b0 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005c1:	48 b8 b8 15 80 00 00 	movabs $0x8015b8,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8005cd:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8005d4:	00 00 
+  8005d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005db:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8005e2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8005e9:	00 00 00 
+  8005ec:	48 01 c8             	add    %rcx,%rax
+  8005ef:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005f3:	45 85 ed             	test   %r13d,%r13d
+  8005f6:	7e 0d                	jle    800605 <libmain+0xc2>
+  8005f8:	49 8b 06             	mov    (%r14),%rax
+  8005fb:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800602:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800605:	4c 89 f6             	mov    %r14,%rsi
+  800608:	44 89 ef             	mov    %r13d,%edi
+  80060b:	48 b8 20 01 80 00 00 	movabs $0x800120,%rax
+  800612:	00 00 00 
+  800615:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800617:	48 b8 30 06 80 00 00 	movabs $0x800630,%rax
+  80061e:	00 00 00 
+  800621:	ff d0                	call   *%rax
+#endif
+}
+  800623:	48 83 c4 30          	add    $0x30,%rsp
+  800627:	5b                   	pop    %rbx
+  800628:	41 5c                	pop    %r12
+  80062a:	41 5d                	pop    %r13
+  80062c:	41 5e                	pop    %r14
+  80062e:	5d                   	pop    %rbp
+  80062f:	c3                   	ret
+
+0000000000800630 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800630:	55                   	push   %rbp
+  800631:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800634:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80063b:	00 00 00 
+  80063e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800640:	bf 00 00 00 00       	mov    $0x0,%edi
+  800645:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  80064c:	00 00 00 
+  80064f:	ff d0                	call   *%rax
+}
+  800651:	5d                   	pop    %rbp
+  800652:	c3                   	ret
+
+0000000000800653 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800653:	55                   	push   %rbp
+  800654:	48 89 e5             	mov    %rsp,%rbp
+  800657:	41 56                	push   %r14
+  800659:	41 55                	push   %r13
+  80065b:	41 54                	push   %r12
+  80065d:	53                   	push   %rbx
+  80065e:	48 83 ec 50          	sub    $0x50,%rsp
+  800662:	49 89 fc             	mov    %rdi,%r12
+  800665:	41 89 f5             	mov    %esi,%r13d
+  800668:	48 89 d3             	mov    %rdx,%rbx
+  80066b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80066f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800673:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800677:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80067e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800682:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800686:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80068a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80068e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800695:	00 00 00 
+  800698:	4c 8b 30             	mov    (%rax),%r14
+  80069b:	48 b8 b8 15 80 00 00 	movabs $0x8015b8,%rax
+  8006a2:	00 00 00 
+  8006a5:	ff d0                	call   *%rax
+  8006a7:	89 c6                	mov    %eax,%esi
+  8006a9:	45 89 e8             	mov    %r13d,%r8d
+  8006ac:	4c 89 e1             	mov    %r12,%rcx
+  8006af:	4c 89 f2             	mov    %r14,%rdx
+  8006b2:	48 bf 38 51 80 00 00 	movabs $0x805138,%rdi
+  8006b9:	00 00 00 
+  8006bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c1:	49 bc a3 07 80 00 00 	movabs $0x8007a3,%r12
+  8006c8:	00 00 00 
+  8006cb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006ce:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006d2:	48 89 df             	mov    %rbx,%rdi
+  8006d5:	48 b8 3f 07 80 00 00 	movabs $0x80073f,%rax
+  8006dc:	00 00 00 
+  8006df:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006e1:	48 bf 03 51 80 00 00 	movabs $0x805103,%rdi
+  8006e8:	00 00 00 
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006f3:	cc                   	int3
+  8006f4:	eb fd                	jmp    8006f3 <_panic+0xa0>
+
+00000000008006f6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006f6:	55                   	push   %rbp
+  8006f7:	48 89 e5             	mov    %rsp,%rbp
+  8006fa:	53                   	push   %rbx
+  8006fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ff:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800702:	8b 06                	mov    (%rsi),%eax
+  800704:	8d 50 01             	lea    0x1(%rax),%edx
+  800707:	89 16                	mov    %edx,(%rsi)
+  800709:	48 98                	cltq
+  80070b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800710:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800716:	74 0a                	je     800722 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800718:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80071c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800720:	c9                   	leave
+  800721:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800722:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800726:	be ff 00 00 00       	mov    $0xff,%esi
+  80072b:	48 b8 ef 14 80 00 00 	movabs $0x8014ef,%rax
+  800732:	00 00 00 
+  800735:	ff d0                	call   *%rax
+        state->offset = 0;
+  800737:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80073d:	eb d9                	jmp    800718 <putch+0x22>
+
+000000000080073f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80073f:	55                   	push   %rbp
+  800740:	48 89 e5             	mov    %rsp,%rbp
+  800743:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80074a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80074d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800754:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800761:	48 89 f1             	mov    %rsi,%rcx
+  800764:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80076b:	48 bf f6 06 80 00 00 	movabs $0x8006f6,%rdi
+  800772:	00 00 00 
+  800775:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  80077c:	00 00 00 
+  80077f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800781:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800788:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80078f:	48 b8 ef 14 80 00 00 	movabs $0x8014ef,%rax
+  800796:	00 00 00 
+  800799:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80079b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8007a1:	c9                   	leave
+  8007a2:	c3                   	ret
+
+00000000008007a3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8007a3:	55                   	push   %rbp
+  8007a4:	48 89 e5             	mov    %rsp,%rbp
+  8007a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8007ab:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007af:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007bf:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007d6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007da:	48 b8 3f 07 80 00 00 	movabs $0x80073f,%rax
+  8007e1:	00 00 00 
+  8007e4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007e6:	c9                   	leave
+  8007e7:	c3                   	ret
+
+00000000008007e8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007e8:	55                   	push   %rbp
+  8007e9:	48 89 e5             	mov    %rsp,%rbp
+  8007ec:	41 57                	push   %r15
+  8007ee:	41 56                	push   %r14
+  8007f0:	41 55                	push   %r13
+  8007f2:	41 54                	push   %r12
+  8007f4:	53                   	push   %rbx
+  8007f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8007f9:	49 89 fc             	mov    %rdi,%r12
+  8007fc:	49 89 f5             	mov    %rsi,%r13
+  8007ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800803:	8b 45 10             	mov    0x10(%rbp),%eax
+  800806:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800809:	41 89 cf             	mov    %ecx,%r15d
+  80080c:	4c 39 fa             	cmp    %r15,%rdx
+  80080f:	73 5b                	jae    80086c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800811:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800815:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800819:	85 db                	test   %ebx,%ebx
+  80081b:	7e 0e                	jle    80082b <print_num+0x43>
+            putch(padc, put_arg);
+  80081d:	4c 89 ee             	mov    %r13,%rsi
+  800820:	44 89 f7             	mov    %r14d,%edi
+  800823:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800826:	83 eb 01             	sub    $0x1,%ebx
+  800829:	75 f2                	jne    80081d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80082b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80082f:	48 b9 6c 51 80 00 00 	movabs $0x80516c,%rcx
+  800836:	00 00 00 
+  800839:	48 b8 5b 51 80 00 00 	movabs $0x80515b,%rax
+  800840:	00 00 00 
+  800843:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800847:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80084b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800850:	49 f7 f7             	div    %r15
+  800853:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800857:	4c 89 ee             	mov    %r13,%rsi
+  80085a:	41 ff d4             	call   *%r12
+}
+  80085d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800861:	5b                   	pop    %rbx
+  800862:	41 5c                	pop    %r12
+  800864:	41 5d                	pop    %r13
+  800866:	41 5e                	pop    %r14
+  800868:	41 5f                	pop    %r15
+  80086a:	5d                   	pop    %rbp
+  80086b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80086c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800870:	ba 00 00 00 00       	mov    $0x0,%edx
+  800875:	49 f7 f7             	div    %r15
+  800878:	48 83 ec 08          	sub    $0x8,%rsp
+  80087c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800880:	52                   	push   %rdx
+  800881:	45 0f be c9          	movsbl %r9b,%r9d
+  800885:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800889:	48 89 c2             	mov    %rax,%rdx
+  80088c:	48 b8 e8 07 80 00 00 	movabs $0x8007e8,%rax
+  800893:	00 00 00 
+  800896:	ff d0                	call   *%rax
+  800898:	48 83 c4 10          	add    $0x10,%rsp
+  80089c:	eb 8d                	jmp    80082b <print_num+0x43>
+
+000000000080089e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80089e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8008a2:	48 8b 06             	mov    (%rsi),%rax
+  8008a5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008a9:	73 0a                	jae    8008b5 <sprintputch+0x17>
+        *state->start++ = ch;
+  8008ab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008af:	48 89 16             	mov    %rdx,(%rsi)
+  8008b2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008b5:	c3                   	ret
+
+00000000008008b6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008b6:	55                   	push   %rbp
+  8008b7:	48 89 e5             	mov    %rsp,%rbp
+  8008ba:	48 83 ec 50          	sub    $0x50,%rsp
+  8008be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008c2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008c6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008ca:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008e1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008e5:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8008ec:	00 00 00 
+  8008ef:	ff d0                	call   *%rax
+}
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+
+00000000008008f3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008f3:	55                   	push   %rbp
+  8008f4:	48 89 e5             	mov    %rsp,%rbp
+  8008f7:	41 57                	push   %r15
+  8008f9:	41 56                	push   %r14
+  8008fb:	41 55                	push   %r13
+  8008fd:	41 54                	push   %r12
+  8008ff:	53                   	push   %rbx
+  800900:	48 83 ec 38          	sub    $0x38,%rsp
+  800904:	49 89 fe             	mov    %rdi,%r14
+  800907:	49 89 f5             	mov    %rsi,%r13
+  80090a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80090d:	48 8b 01             	mov    (%rcx),%rax
+  800910:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800914:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800920:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800924:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800928:	0f b6 3b             	movzbl (%rbx),%edi
+  80092b:	40 80 ff 25          	cmp    $0x25,%dil
+  80092f:	74 18                	je     800949 <vprintfmt+0x56>
+            if (!ch) return;
+  800931:	40 84 ff             	test   %dil,%dil
+  800934:	0f 84 b1 06 00 00    	je     800feb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80093a:	40 0f b6 ff          	movzbl %dil,%edi
+  80093e:	4c 89 ee             	mov    %r13,%rsi
+  800941:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800944:	4c 89 e3             	mov    %r12,%rbx
+  800947:	eb db                	jmp    800924 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800949:	be 00 00 00 00       	mov    $0x0,%esi
+  80094e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800952:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800957:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80095d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800964:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800968:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80096d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800972:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800975:	83 e8 23             	sub    $0x23,%eax
+  800978:	3c 57                	cmp    $0x57,%al
+  80097a:	0f 87 51 06 00 00    	ja     800fd1 <vprintfmt+0x6de>
+  800980:	0f b6 c0             	movzbl %al,%eax
+  800983:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  80098a:	00 00 00 
+  80098d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800990:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800993:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800997:	eb cf                	jmp    800968 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800999:	49 89 dc             	mov    %rbx,%r12
+  80099c:	be 01 00 00 00       	mov    $0x1,%esi
+  8009a1:	eb c5                	jmp    800968 <vprintfmt+0x75>
+            padc = ch;
+  8009a3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8009a7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009aa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009ad:	eb b9                	jmp    800968 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	77 24                	ja     8009db <vprintfmt+0xe8>
+  8009b7:	89 c1                	mov    %eax,%ecx
+  8009b9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009bd:	83 c0 08             	add    $0x8,%eax
+  8009c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009c6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009c9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009cd:	79 99                	jns    800968 <vprintfmt+0x75>
+                width = precision;
+  8009cf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009d3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009d9:	eb 8d                	jmp    800968 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009db:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009df:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e7:	eb da                	jmp    8009c3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009e9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009ee:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009f2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009f8:	3c 39                	cmp    $0x39,%al
+  8009fa:	77 1c                	ja     800a18 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009fc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800a00:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800a04:	0f b6 c0             	movzbl %al,%eax
+  800a07:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a0c:	0f b6 03             	movzbl (%rbx),%eax
+  800a0f:	3c 39                	cmp    $0x39,%al
+  800a11:	76 e9                	jbe    8009fc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a13:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a16:	eb b1                	jmp    8009c9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a18:	49 89 dc             	mov    %rbx,%r12
+  800a1b:	eb ac                	jmp    8009c9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a1d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a20:	85 c9                	test   %ecx,%ecx
+  800a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a27:	0f 49 c1             	cmovns %ecx,%eax
+  800a2a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a2d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a30:	e9 33 ff ff ff       	jmp    800968 <vprintfmt+0x75>
+            lflag++;
+  800a35:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a38:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a3b:	e9 28 ff ff ff       	jmp    800968 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	77 19                	ja     800a61 <vprintfmt+0x16e>
+  800a48:	89 c2                	mov    %eax,%edx
+  800a4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4e:	83 c0 08             	add    $0x8,%eax
+  800a51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a54:	8b 3a                	mov    (%rdx),%edi
+  800a56:	4c 89 ee             	mov    %r13,%rsi
+  800a59:	41 ff d6             	call   *%r14
+            break;
+  800a5c:	e9 c3 fe ff ff       	jmp    800924 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6d:	eb e5                	jmp    800a54 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a72:	83 f8 2f             	cmp    $0x2f,%eax
+  800a75:	77 5a                	ja     800ad1 <vprintfmt+0x1de>
+  800a77:	89 c2                	mov    %eax,%edx
+  800a79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7d:	83 c0 08             	add    $0x8,%eax
+  800a80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a83:	8b 02                	mov    (%rdx),%eax
+  800a85:	89 c1                	mov    %eax,%ecx
+  800a87:	f7 d9                	neg    %ecx
+  800a89:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a8c:	83 f9 16             	cmp    $0x16,%ecx
+  800a8f:	7f 4e                	jg     800adf <vprintfmt+0x1ec>
+  800a91:	48 63 c1             	movslq %ecx,%rax
+  800a94:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  800a9b:	00 00 00 
+  800a9e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800aa2:	48 85 c0             	test   %rax,%rax
+  800aa5:	74 38                	je     800adf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800aa7:	48 89 c1             	mov    %rax,%rcx
+  800aaa:	48 ba d9 57 80 00 00 	movabs $0x8057d9,%rdx
+  800ab1:	00 00 00 
+  800ab4:	4c 89 ee             	mov    %r13,%rsi
+  800ab7:	4c 89 f7             	mov    %r14,%rdi
+  800aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abf:	49 b8 b6 08 80 00 00 	movabs $0x8008b6,%r8
+  800ac6:	00 00 00 
+  800ac9:	41 ff d0             	call   *%r8
+  800acc:	e9 53 fe ff ff       	jmp    800924 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ad1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800add:	eb a4                	jmp    800a83 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800adf:	48 ba 84 51 80 00 00 	movabs $0x805184,%rdx
+  800ae6:	00 00 00 
+  800ae9:	4c 89 ee             	mov    %r13,%rsi
+  800aec:	4c 89 f7             	mov    %r14,%rdi
+  800aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af4:	49 b8 b6 08 80 00 00 	movabs $0x8008b6,%r8
+  800afb:	00 00 00 
+  800afe:	41 ff d0             	call   *%r8
+  800b01:	e9 1e fe ff ff       	jmp    800924 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b09:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0c:	77 6c                	ja     800b7a <vprintfmt+0x287>
+  800b0e:	89 c2                	mov    %eax,%edx
+  800b10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b14:	83 c0 08             	add    $0x8,%eax
+  800b17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b1d:	48 85 d2             	test   %rdx,%rdx
+  800b20:	48 b8 7d 51 80 00 00 	movabs $0x80517d,%rax
+  800b27:	00 00 00 
+  800b2a:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b2e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b32:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b36:	7e 06                	jle    800b3e <vprintfmt+0x24b>
+  800b38:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b3c:	75 4a                	jne    800b88 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b3e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b42:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b46:	0f b6 00             	movzbl (%rax),%eax
+  800b49:	84 c0                	test   %al,%al
+  800b4b:	0f 85 9a 00 00 00    	jne    800beb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b51:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b54:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b58:	85 c0                	test   %eax,%eax
+  800b5a:	0f 8e c4 fd ff ff    	jle    800924 <vprintfmt+0x31>
+  800b60:	4c 89 ee             	mov    %r13,%rsi
+  800b63:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b68:	41 ff d6             	call   *%r14
+  800b6b:	41 83 ec 01          	sub    $0x1,%r12d
+  800b6f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b73:	75 eb                	jne    800b60 <vprintfmt+0x26d>
+  800b75:	e9 aa fd ff ff       	jmp    800924 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b86:	eb 92                	jmp    800b1a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b88:	49 63 f7             	movslq %r15d,%rsi
+  800b8b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b8f:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  800b96:	00 00 00 
+  800b99:	ff d0                	call   *%rax
+  800b9b:	48 89 c2             	mov    %rax,%rdx
+  800b9e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ba1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ba3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ba6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ba9:	85 c0                	test   %eax,%eax
+  800bab:	7e 91                	jle    800b3e <vprintfmt+0x24b>
+  800bad:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800bb2:	4c 89 ee             	mov    %r13,%rsi
+  800bb5:	44 89 e7             	mov    %r12d,%edi
+  800bb8:	41 ff d6             	call   *%r14
+  800bbb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bbf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bc2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bc5:	75 eb                	jne    800bb2 <vprintfmt+0x2bf>
+  800bc7:	e9 72 ff ff ff       	jmp    800b3e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bcc:	0f b6 f8             	movzbl %al,%edi
+  800bcf:	4c 89 ee             	mov    %r13,%rsi
+  800bd2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bd5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bd9:	49 83 c4 01          	add    $0x1,%r12
+  800bdd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800be3:	84 c0                	test   %al,%al
+  800be5:	0f 84 66 ff ff ff    	je     800b51 <vprintfmt+0x25e>
+  800beb:	45 85 ff             	test   %r15d,%r15d
+  800bee:	78 0a                	js     800bfa <vprintfmt+0x307>
+  800bf0:	41 83 ef 01          	sub    $0x1,%r15d
+  800bf4:	0f 88 57 ff ff ff    	js     800b51 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bfa:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800bfe:	74 cc                	je     800bcc <vprintfmt+0x2d9>
+  800c00:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800c03:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c08:	80 fa 5e             	cmp    $0x5e,%dl
+  800c0b:	77 c2                	ja     800bcf <vprintfmt+0x2dc>
+  800c0d:	eb bd                	jmp    800bcc <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c0f:	40 84 f6             	test   %sil,%sil
+  800c12:	75 26                	jne    800c3a <vprintfmt+0x347>
+    switch (lflag) {
+  800c14:	85 d2                	test   %edx,%edx
+  800c16:	74 59                	je     800c71 <vprintfmt+0x37e>
+  800c18:	83 fa 01             	cmp    $0x1,%edx
+  800c1b:	74 7b                	je     800c98 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c20:	83 f8 2f             	cmp    $0x2f,%eax
+  800c23:	0f 87 96 00 00 00    	ja     800cbf <vprintfmt+0x3cc>
+  800c29:	89 c2                	mov    %eax,%edx
+  800c2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2f:	83 c0 08             	add    $0x8,%eax
+  800c32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c35:	4c 8b 22             	mov    (%rdx),%r12
+  800c38:	eb 17                	jmp    800c51 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c40:	77 21                	ja     800c63 <vprintfmt+0x370>
+  800c42:	89 c2                	mov    %eax,%edx
+  800c44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c48:	83 c0 08             	add    $0x8,%eax
+  800c4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c51:	4d 85 e4             	test   %r12,%r12
+  800c54:	78 7a                	js     800cd0 <vprintfmt+0x3dd>
+            num = i;
+  800c56:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c59:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c5e:	e9 50 02 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6f:	eb dd                	jmp    800c4e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c74:	83 f8 2f             	cmp    $0x2f,%eax
+  800c77:	77 11                	ja     800c8a <vprintfmt+0x397>
+  800c79:	89 c2                	mov    %eax,%edx
+  800c7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7f:	83 c0 08             	add    $0x8,%eax
+  800c82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c85:	4c 63 22             	movslq (%rdx),%r12
+  800c88:	eb c7                	jmp    800c51 <vprintfmt+0x35e>
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	eb ed                	jmp    800c85 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9e:	77 11                	ja     800cb1 <vprintfmt+0x3be>
+  800ca0:	89 c2                	mov    %eax,%edx
+  800ca2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca6:	83 c0 08             	add    $0x8,%eax
+  800ca9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cac:	4c 8b 22             	mov    (%rdx),%r12
+  800caf:	eb a0                	jmp    800c51 <vprintfmt+0x35e>
+  800cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cbd:	eb ed                	jmp    800cac <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccb:	e9 65 ff ff ff       	jmp    800c35 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cd0:	4c 89 ee             	mov    %r13,%rsi
+  800cd3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cd8:	41 ff d6             	call   *%r14
+                i = -i;
+  800cdb:	49 f7 dc             	neg    %r12
+  800cde:	e9 73 ff ff ff       	jmp    800c56 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce3:	40 84 f6             	test   %sil,%sil
+  800ce6:	75 32                	jne    800d1a <vprintfmt+0x427>
+    switch (lflag) {
+  800ce8:	85 d2                	test   %edx,%edx
+  800cea:	74 5d                	je     800d49 <vprintfmt+0x456>
+  800cec:	83 fa 01             	cmp    $0x1,%edx
+  800cef:	0f 84 82 00 00 00    	je     800d77 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfb:	0f 87 a5 00 00 00    	ja     800da6 <vprintfmt+0x4b3>
+  800d01:	89 c2                	mov    %eax,%edx
+  800d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d07:	83 c0 08             	add    $0x8,%eax
+  800d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d15:	e9 99 01 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d20:	77 19                	ja     800d3b <vprintfmt+0x448>
+  800d22:	89 c2                	mov    %eax,%edx
+  800d24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d28:	83 c0 08             	add    $0x8,%eax
+  800d2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d36:	e9 78 01 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+  800d3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d47:	eb e5                	jmp    800d2e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4f:	77 18                	ja     800d69 <vprintfmt+0x476>
+  800d51:	89 c2                	mov    %eax,%edx
+  800d53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d57:	83 c0 08             	add    $0x8,%eax
+  800d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d64:	e9 4a 01 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+  800d69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d75:	eb e6                	jmp    800d5d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7d:	77 19                	ja     800d98 <vprintfmt+0x4a5>
+  800d7f:	89 c2                	mov    %eax,%edx
+  800d81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d85:	83 c0 08             	add    $0x8,%eax
+  800d88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d8e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d93:	e9 1b 01 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+  800d98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da4:	eb e5                	jmp    800d8b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800da6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800daa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db2:	e9 56 ff ff ff       	jmp    800d0d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800db7:	40 84 f6             	test   %sil,%sil
+  800dba:	75 2e                	jne    800dea <vprintfmt+0x4f7>
+    switch (lflag) {
+  800dbc:	85 d2                	test   %edx,%edx
+  800dbe:	74 59                	je     800e19 <vprintfmt+0x526>
+  800dc0:	83 fa 01             	cmp    $0x1,%edx
+  800dc3:	74 7f                	je     800e44 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800dc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dcb:	0f 87 9f 00 00 00    	ja     800e70 <vprintfmt+0x57d>
+  800dd1:	89 c2                	mov    %eax,%edx
+  800dd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd7:	83 c0 08             	add    $0x8,%eax
+  800dda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ddd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800de0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800de5:	e9 c9 00 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ded:	83 f8 2f             	cmp    $0x2f,%eax
+  800df0:	77 19                	ja     800e0b <vprintfmt+0x518>
+  800df2:	89 c2                	mov    %eax,%edx
+  800df4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df8:	83 c0 08             	add    $0x8,%eax
+  800dfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e01:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e06:	e9 a8 00 00 00       	jmp    800eb3 <vprintfmt+0x5c0>
+  800e0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e17:	eb e5                	jmp    800dfe <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1f:	77 15                	ja     800e36 <vprintfmt+0x543>
+  800e21:	89 c2                	mov    %eax,%edx
+  800e23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e27:	83 c0 08             	add    $0x8,%eax
+  800e2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e2f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e34:	eb 7d                	jmp    800eb3 <vprintfmt+0x5c0>
+  800e36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e42:	eb e9                	jmp    800e2d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e47:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4a:	77 16                	ja     800e62 <vprintfmt+0x56f>
+  800e4c:	89 c2                	mov    %eax,%edx
+  800e4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e52:	83 c0 08             	add    $0x8,%eax
+  800e55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e60:	eb 51                	jmp    800eb3 <vprintfmt+0x5c0>
+  800e62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6e:	eb e8                	jmp    800e58 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7c:	e9 5c ff ff ff       	jmp    800ddd <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e81:	4c 89 ee             	mov    %r13,%rsi
+  800e84:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e89:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e8c:	4c 89 ee             	mov    %r13,%rsi
+  800e8f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e94:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9d:	77 47                	ja     800ee6 <vprintfmt+0x5f3>
+  800e9f:	89 c2                	mov    %eax,%edx
+  800ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea5:	83 c0 08             	add    $0x8,%eax
+  800ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800eae:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800eb3:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ebb:	0f 94 c0             	sete   %al
+  800ebe:	0f b6 c0             	movzbl %al,%eax
+  800ec1:	50                   	push   %rax
+  800ec2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ec7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ecb:	4c 89 ee             	mov    %r13,%rsi
+  800ece:	4c 89 f7             	mov    %r14,%rdi
+  800ed1:	48 b8 e8 07 80 00 00 	movabs $0x8007e8,%rax
+  800ed8:	00 00 00 
+  800edb:	ff d0                	call   *%rax
+            break;
+  800edd:	48 83 c4 10          	add    $0x10,%rsp
+  800ee1:	e9 3e fa ff ff       	jmp    800924 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ee6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef2:	eb b7                	jmp    800eab <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ef4:	40 84 f6             	test   %sil,%sil
+  800ef7:	75 2b                	jne    800f24 <vprintfmt+0x631>
+    switch (lflag) {
+  800ef9:	85 d2                	test   %edx,%edx
+  800efb:	74 56                	je     800f53 <vprintfmt+0x660>
+  800efd:	83 fa 01             	cmp    $0x1,%edx
+  800f00:	74 7f                	je     800f81 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800f02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f05:	83 f8 2f             	cmp    $0x2f,%eax
+  800f08:	0f 87 a2 00 00 00    	ja     800fb0 <vprintfmt+0x6bd>
+  800f0e:	89 c2                	mov    %eax,%edx
+  800f10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f14:	83 c0 08             	add    $0x8,%eax
+  800f17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f1a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f22:	eb 8f                	jmp    800eb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f27:	83 f8 2f             	cmp    $0x2f,%eax
+  800f2a:	77 19                	ja     800f45 <vprintfmt+0x652>
+  800f2c:	89 c2                	mov    %eax,%edx
+  800f2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f32:	83 c0 08             	add    $0x8,%eax
+  800f35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f3b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f40:	e9 6e ff ff ff       	jmp    800eb3 <vprintfmt+0x5c0>
+  800f45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f51:	eb e5                	jmp    800f38 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f56:	83 f8 2f             	cmp    $0x2f,%eax
+  800f59:	77 18                	ja     800f73 <vprintfmt+0x680>
+  800f5b:	89 c2                	mov    %eax,%edx
+  800f5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f61:	83 c0 08             	add    $0x8,%eax
+  800f64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f67:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f69:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f6e:	e9 40 ff ff ff       	jmp    800eb3 <vprintfmt+0x5c0>
+  800f73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f7f:	eb e6                	jmp    800f67 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f84:	83 f8 2f             	cmp    $0x2f,%eax
+  800f87:	77 19                	ja     800fa2 <vprintfmt+0x6af>
+  800f89:	89 c2                	mov    %eax,%edx
+  800f8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f8f:	83 c0 08             	add    $0x8,%eax
+  800f92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f98:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f9d:	e9 11 ff ff ff       	jmp    800eb3 <vprintfmt+0x5c0>
+  800fa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800faa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fae:	eb e5                	jmp    800f95 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fbc:	e9 59 ff ff ff       	jmp    800f1a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fc1:	4c 89 ee             	mov    %r13,%rsi
+  800fc4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fc9:	41 ff d6             	call   *%r14
+            break;
+  800fcc:	e9 53 f9 ff ff       	jmp    800924 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fd1:	4c 89 ee             	mov    %r13,%rsi
+  800fd4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fd9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fdc:	48 83 eb 01          	sub    $0x1,%rbx
+  800fe0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fe4:	75 f6                	jne    800fdc <vprintfmt+0x6e9>
+  800fe6:	e9 39 f9 ff ff       	jmp    800924 <vprintfmt+0x31>
+}
+  800feb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fef:	5b                   	pop    %rbx
+  800ff0:	41 5c                	pop    %r12
+  800ff2:	41 5d                	pop    %r13
+  800ff4:	41 5e                	pop    %r14
+  800ff6:	41 5f                	pop    %r15
+  800ff8:	5d                   	pop    %rbp
+  800ff9:	c3                   	ret
+
+0000000000800ffa <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ffa:	55                   	push   %rbp
+  800ffb:	48 89 e5             	mov    %rsp,%rbp
+  800ffe:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801002:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801006:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80100b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80100f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801016:	48 85 ff             	test   %rdi,%rdi
+  801019:	74 2b                	je     801046 <vsnprintf+0x4c>
+  80101b:	48 85 f6             	test   %rsi,%rsi
+  80101e:	74 26                	je     801046 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801020:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801024:	48 bf 9e 08 80 00 00 	movabs $0x80089e,%rdi
+  80102b:	00 00 00 
+  80102e:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80103a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80103e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801041:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801044:	c9                   	leave
+  801045:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801046:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80104b:	eb f7                	jmp    801044 <vsnprintf+0x4a>
+
+000000000080104d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80104d:	55                   	push   %rbp
+  80104e:	48 89 e5             	mov    %rsp,%rbp
+  801051:	48 83 ec 50          	sub    $0x50,%rsp
+  801055:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801059:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80105d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801061:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801068:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80106c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801070:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801074:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801078:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80107c:	48 b8 fa 0f 80 00 00 	movabs $0x800ffa,%rax
+  801083:	00 00 00 
+  801086:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801088:	c9                   	leave
+  801089:	c3                   	ret
+
+000000000080108a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80108a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80108d:	74 10                	je     80109f <strlen+0x15>
+    size_t n = 0;
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801094:	48 83 c0 01          	add    $0x1,%rax
+  801098:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80109c:	75 f6                	jne    801094 <strlen+0xa>
+  80109e:	c3                   	ret
+    size_t n = 0;
+  80109f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8010a4:	c3                   	ret
+
+00000000008010a5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8010a5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010a8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010ad:	48 85 f6             	test   %rsi,%rsi
+  8010b0:	74 11                	je     8010c3 <strnlen+0x1e>
+  8010b2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010b6:	74 0c                	je     8010c4 <strnlen+0x1f>
+  8010b8:	48 83 c2 01          	add    $0x1,%rdx
+  8010bc:	48 39 d0             	cmp    %rdx,%rax
+  8010bf:	75 f1                	jne    8010b2 <strnlen+0xd>
+  8010c1:	eb 04                	jmp    8010c7 <strnlen+0x22>
+  8010c3:	c3                   	ret
+  8010c4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010c7:	c3                   	ret
+
+00000000008010c8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010c8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010d4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010d7:	48 83 c2 01          	add    $0x1,%rdx
+  8010db:	84 c9                	test   %cl,%cl
+  8010dd:	75 f1                	jne    8010d0 <strcpy+0x8>
+        ;
+    return res;
+}
+  8010df:	c3                   	ret
+
+00000000008010e0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010e0:	55                   	push   %rbp
+  8010e1:	48 89 e5             	mov    %rsp,%rbp
+  8010e4:	41 54                	push   %r12
+  8010e6:	53                   	push   %rbx
+  8010e7:	48 89 fb             	mov    %rdi,%rbx
+  8010ea:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010ed:	48 b8 8a 10 80 00 00 	movabs $0x80108a,%rax
+  8010f4:	00 00 00 
+  8010f7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010f9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010fd:	4c 89 e6             	mov    %r12,%rsi
+  801100:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  801107:	00 00 00 
+  80110a:	ff d0                	call   *%rax
+    return dst;
+}
+  80110c:	48 89 d8             	mov    %rbx,%rax
+  80110f:	5b                   	pop    %rbx
+  801110:	41 5c                	pop    %r12
+  801112:	5d                   	pop    %rbp
+  801113:	c3                   	ret
+
+0000000000801114 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801114:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801117:	48 85 d2             	test   %rdx,%rdx
+  80111a:	74 1f                	je     80113b <strncpy+0x27>
+  80111c:	48 01 fa             	add    %rdi,%rdx
+  80111f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801122:	48 83 c1 01          	add    $0x1,%rcx
+  801126:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80112a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80112e:	41 80 f8 01          	cmp    $0x1,%r8b
+  801132:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801136:	48 39 ca             	cmp    %rcx,%rdx
+  801139:	75 e7                	jne    801122 <strncpy+0xe>
+    }
+    return ret;
+}
+  80113b:	c3                   	ret
+
+000000000080113c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80113c:	48 89 f8             	mov    %rdi,%rax
+  80113f:	48 85 d2             	test   %rdx,%rdx
+  801142:	74 24                	je     801168 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801144:	48 83 ea 01          	sub    $0x1,%rdx
+  801148:	74 1b                	je     801165 <strlcpy+0x29>
+  80114a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80114e:	0f b6 16             	movzbl (%rsi),%edx
+  801151:	84 d2                	test   %dl,%dl
+  801153:	74 10                	je     801165 <strlcpy+0x29>
+            *dst++ = *src++;
+  801155:	48 83 c6 01          	add    $0x1,%rsi
+  801159:	48 83 c0 01          	add    $0x1,%rax
+  80115d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801160:	48 39 c8             	cmp    %rcx,%rax
+  801163:	75 e9                	jne    80114e <strlcpy+0x12>
+        *dst = '\0';
+  801165:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801168:	48 29 f8             	sub    %rdi,%rax
+}
+  80116b:	c3                   	ret
+
+000000000080116c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80116c:	0f b6 07             	movzbl (%rdi),%eax
+  80116f:	84 c0                	test   %al,%al
+  801171:	74 13                	je     801186 <strcmp+0x1a>
+  801173:	38 06                	cmp    %al,(%rsi)
+  801175:	75 0f                	jne    801186 <strcmp+0x1a>
+  801177:	48 83 c7 01          	add    $0x1,%rdi
+  80117b:	48 83 c6 01          	add    $0x1,%rsi
+  80117f:	0f b6 07             	movzbl (%rdi),%eax
+  801182:	84 c0                	test   %al,%al
+  801184:	75 ed                	jne    801173 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801186:	0f b6 c0             	movzbl %al,%eax
+  801189:	0f b6 16             	movzbl (%rsi),%edx
+  80118c:	29 d0                	sub    %edx,%eax
+}
+  80118e:	c3                   	ret
+
+000000000080118f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80118f:	48 85 d2             	test   %rdx,%rdx
+  801192:	74 1f                	je     8011b3 <strncmp+0x24>
+  801194:	0f b6 07             	movzbl (%rdi),%eax
+  801197:	84 c0                	test   %al,%al
+  801199:	74 1e                	je     8011b9 <strncmp+0x2a>
+  80119b:	3a 06                	cmp    (%rsi),%al
+  80119d:	75 1a                	jne    8011b9 <strncmp+0x2a>
+  80119f:	48 83 c7 01          	add    $0x1,%rdi
+  8011a3:	48 83 c6 01          	add    $0x1,%rsi
+  8011a7:	48 83 ea 01          	sub    $0x1,%rdx
+  8011ab:	75 e7                	jne    801194 <strncmp+0x5>
+
+    if (!n) return 0;
+  8011ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b2:	c3                   	ret
+  8011b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b8:	c3                   	ret
+  8011b9:	48 85 d2             	test   %rdx,%rdx
+  8011bc:	74 09                	je     8011c7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011be:	0f b6 07             	movzbl (%rdi),%eax
+  8011c1:	0f b6 16             	movzbl (%rsi),%edx
+  8011c4:	29 d0                	sub    %edx,%eax
+  8011c6:	c3                   	ret
+    if (!n) return 0;
+  8011c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011cc:	c3                   	ret
+
+00000000008011cd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011cd:	0f b6 17             	movzbl (%rdi),%edx
+  8011d0:	84 d2                	test   %dl,%dl
+  8011d2:	74 18                	je     8011ec <strchr+0x1f>
+        if (*str == c) {
+  8011d4:	0f be d2             	movsbl %dl,%edx
+  8011d7:	39 f2                	cmp    %esi,%edx
+  8011d9:	74 17                	je     8011f2 <strchr+0x25>
+    for (; *str; str++) {
+  8011db:	48 83 c7 01          	add    $0x1,%rdi
+  8011df:	0f b6 17             	movzbl (%rdi),%edx
+  8011e2:	84 d2                	test   %dl,%dl
+  8011e4:	75 ee                	jne    8011d4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011eb:	c3                   	ret
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f1:	c3                   	ret
+  8011f2:	48 89 f8             	mov    %rdi,%rax
+}
+  8011f5:	c3                   	ret
+
+00000000008011f6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011f6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011f9:	0f b6 17             	movzbl (%rdi),%edx
+  8011fc:	84 d2                	test   %dl,%dl
+  8011fe:	74 13                	je     801213 <strfind+0x1d>
+  801200:	0f be d2             	movsbl %dl,%edx
+  801203:	39 f2                	cmp    %esi,%edx
+  801205:	74 0b                	je     801212 <strfind+0x1c>
+  801207:	48 83 c0 01          	add    $0x1,%rax
+  80120b:	0f b6 10             	movzbl (%rax),%edx
+  80120e:	84 d2                	test   %dl,%dl
+  801210:	75 ee                	jne    801200 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801212:	c3                   	ret
+  801213:	c3                   	ret
+
+0000000000801214 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801214:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801217:	48 89 f8             	mov    %rdi,%rax
+  80121a:	48 f7 d8             	neg    %rax
+  80121d:	83 e0 07             	and    $0x7,%eax
+  801220:	49 89 d1             	mov    %rdx,%r9
+  801223:	49 29 c1             	sub    %rax,%r9
+  801226:	78 36                	js     80125e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801228:	40 0f b6 c6          	movzbl %sil,%eax
+  80122c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801233:	01 01 01 
+  801236:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80123a:	40 f6 c7 07          	test   $0x7,%dil
+  80123e:	75 38                	jne    801278 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801240:	4c 89 c9             	mov    %r9,%rcx
+  801243:	48 c1 f9 03          	sar    $0x3,%rcx
+  801247:	74 0c                	je     801255 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801249:	fc                   	cld
+  80124a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80124d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801251:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801255:	4d 85 c9             	test   %r9,%r9
+  801258:	75 45                	jne    80129f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80125a:	4c 89 c0             	mov    %r8,%rax
+  80125d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80125e:	48 85 d2             	test   %rdx,%rdx
+  801261:	74 f7                	je     80125a <memset+0x46>
+  801263:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801266:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801269:	48 83 c0 01          	add    $0x1,%rax
+  80126d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801271:	48 39 c2             	cmp    %rax,%rdx
+  801274:	75 f3                	jne    801269 <memset+0x55>
+  801276:	eb e2                	jmp    80125a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801278:	40 f6 c7 01          	test   $0x1,%dil
+  80127c:	74 06                	je     801284 <memset+0x70>
+  80127e:	88 07                	mov    %al,(%rdi)
+  801280:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801284:	40 f6 c7 02          	test   $0x2,%dil
+  801288:	74 07                	je     801291 <memset+0x7d>
+  80128a:	66 89 07             	mov    %ax,(%rdi)
+  80128d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801291:	40 f6 c7 04          	test   $0x4,%dil
+  801295:	74 a9                	je     801240 <memset+0x2c>
+  801297:	89 07                	mov    %eax,(%rdi)
+  801299:	48 83 c7 04          	add    $0x4,%rdi
+  80129d:	eb a1                	jmp    801240 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80129f:	41 f6 c1 04          	test   $0x4,%r9b
+  8012a3:	74 06                	je     8012ab <memset+0x97>
+  8012a5:	89 07                	mov    %eax,(%rdi)
+  8012a7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012ab:	41 f6 c1 02          	test   $0x2,%r9b
+  8012af:	74 07                	je     8012b8 <memset+0xa4>
+  8012b1:	66 89 07             	mov    %ax,(%rdi)
+  8012b4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012b8:	41 f6 c1 01          	test   $0x1,%r9b
+  8012bc:	74 9c                	je     80125a <memset+0x46>
+  8012be:	88 07                	mov    %al,(%rdi)
+  8012c0:	eb 98                	jmp    80125a <memset+0x46>
+
+00000000008012c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012c2:	48 89 f8             	mov    %rdi,%rax
+  8012c5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012c8:	48 39 fe             	cmp    %rdi,%rsi
+  8012cb:	73 3b                	jae    801308 <memmove+0x46>
+  8012cd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012d1:	48 39 d7             	cmp    %rdx,%rdi
+  8012d4:	73 32                	jae    801308 <memmove+0x46>
+        s += n;
+        d += n;
+  8012d6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012da:	48 89 d6             	mov    %rdx,%rsi
+  8012dd:	48 09 fe             	or     %rdi,%rsi
+  8012e0:	48 09 ce             	or     %rcx,%rsi
+  8012e3:	40 f6 c6 07          	test   $0x7,%sil
+  8012e7:	75 12                	jne    8012fb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012e9:	48 83 ef 08          	sub    $0x8,%rdi
+  8012ed:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012f1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012f5:	fd                   	std
+  8012f6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012f9:	fc                   	cld
+  8012fa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012fb:	48 83 ef 01          	sub    $0x1,%rdi
+  8012ff:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801303:	fd                   	std
+  801304:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801306:	eb f1                	jmp    8012f9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801308:	48 89 f2             	mov    %rsi,%rdx
+  80130b:	48 09 c2             	or     %rax,%rdx
+  80130e:	48 09 ca             	or     %rcx,%rdx
+  801311:	f6 c2 07             	test   $0x7,%dl
+  801314:	75 0c                	jne    801322 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801316:	48 c1 e9 03          	shr    $0x3,%rcx
+  80131a:	48 89 c7             	mov    %rax,%rdi
+  80131d:	fc                   	cld
+  80131e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801321:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801322:	48 89 c7             	mov    %rax,%rdi
+  801325:	fc                   	cld
+  801326:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801328:	c3                   	ret
+
+0000000000801329 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80132d:	48 b8 c2 12 80 00 00 	movabs $0x8012c2,%rax
+  801334:	00 00 00 
+  801337:	ff d0                	call   *%rax
+}
+  801339:	5d                   	pop    %rbp
+  80133a:	c3                   	ret
+
+000000000080133b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	41 57                	push   %r15
+  801341:	41 56                	push   %r14
+  801343:	41 55                	push   %r13
+  801345:	41 54                	push   %r12
+  801347:	53                   	push   %rbx
+  801348:	48 83 ec 08          	sub    $0x8,%rsp
+  80134c:	49 89 fe             	mov    %rdi,%r14
+  80134f:	49 89 f7             	mov    %rsi,%r15
+  801352:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801355:	48 89 f7             	mov    %rsi,%rdi
+  801358:	48 b8 8a 10 80 00 00 	movabs $0x80108a,%rax
+  80135f:	00 00 00 
+  801362:	ff d0                	call   *%rax
+  801364:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801367:	48 89 de             	mov    %rbx,%rsi
+  80136a:	4c 89 f7             	mov    %r14,%rdi
+  80136d:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  801374:	00 00 00 
+  801377:	ff d0                	call   *%rax
+  801379:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80137c:	48 39 c3             	cmp    %rax,%rbx
+  80137f:	74 36                	je     8013b7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801381:	48 89 d8             	mov    %rbx,%rax
+  801384:	4c 29 e8             	sub    %r13,%rax
+  801387:	49 39 c4             	cmp    %rax,%r12
+  80138a:	73 31                	jae    8013bd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80138c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801391:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801395:	4c 89 fe             	mov    %r15,%rsi
+  801398:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  80139f:	00 00 00 
+  8013a2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8013a4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013a8:	48 83 c4 08          	add    $0x8,%rsp
+  8013ac:	5b                   	pop    %rbx
+  8013ad:	41 5c                	pop    %r12
+  8013af:	41 5d                	pop    %r13
+  8013b1:	41 5e                	pop    %r14
+  8013b3:	41 5f                	pop    %r15
+  8013b5:	5d                   	pop    %rbp
+  8013b6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013b7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013bb:	eb eb                	jmp    8013a8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013bd:	48 83 eb 01          	sub    $0x1,%rbx
+  8013c1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013c5:	48 89 da             	mov    %rbx,%rdx
+  8013c8:	4c 89 fe             	mov    %r15,%rsi
+  8013cb:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  8013d2:	00 00 00 
+  8013d5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013d7:	49 01 de             	add    %rbx,%r14
+  8013da:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013df:	eb c3                	jmp    8013a4 <strlcat+0x69>
+
+00000000008013e1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013e1:	48 85 d2             	test   %rdx,%rdx
+  8013e4:	74 2d                	je     801413 <memcmp+0x32>
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013eb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013ef:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013f4:	44 38 c1             	cmp    %r8b,%cl
+  8013f7:	75 0f                	jne    801408 <memcmp+0x27>
+    while (n-- > 0) {
+  8013f9:	48 83 c0 01          	add    $0x1,%rax
+  8013fd:	48 39 c2             	cmp    %rax,%rdx
+  801400:	75 e9                	jne    8013eb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+  801407:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801408:	0f b6 c1             	movzbl %cl,%eax
+  80140b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80140f:	44 29 c0             	sub    %r8d,%eax
+  801412:	c3                   	ret
+    return 0;
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801418:	c3                   	ret
+
+0000000000801419 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801419:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80141d:	48 39 c7             	cmp    %rax,%rdi
+  801420:	73 0f                	jae    801431 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801422:	40 38 37             	cmp    %sil,(%rdi)
+  801425:	74 0e                	je     801435 <memfind+0x1c>
+    for (; src < end; src++) {
+  801427:	48 83 c7 01          	add    $0x1,%rdi
+  80142b:	48 39 f8             	cmp    %rdi,%rax
+  80142e:	75 f2                	jne    801422 <memfind+0x9>
+  801430:	c3                   	ret
+  801431:	48 89 f8             	mov    %rdi,%rax
+  801434:	c3                   	ret
+  801435:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801438:	c3                   	ret
+
+0000000000801439 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801439:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80143c:	0f b6 37             	movzbl (%rdi),%esi
+  80143f:	40 80 fe 20          	cmp    $0x20,%sil
+  801443:	74 06                	je     80144b <strtol+0x12>
+  801445:	40 80 fe 09          	cmp    $0x9,%sil
+  801449:	75 13                	jne    80145e <strtol+0x25>
+  80144b:	48 83 c7 01          	add    $0x1,%rdi
+  80144f:	0f b6 37             	movzbl (%rdi),%esi
+  801452:	40 80 fe 20          	cmp    $0x20,%sil
+  801456:	74 f3                	je     80144b <strtol+0x12>
+  801458:	40 80 fe 09          	cmp    $0x9,%sil
+  80145c:	74 ed                	je     80144b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80145e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801461:	83 e0 fd             	and    $0xfffffffd,%eax
+  801464:	3c 01                	cmp    $0x1,%al
+  801466:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80146a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801470:	75 0f                	jne    801481 <strtol+0x48>
+  801472:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801475:	74 14                	je     80148b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801477:	85 d2                	test   %edx,%edx
+  801479:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80147e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801481:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801486:	4c 63 ca             	movslq %edx,%r9
+  801489:	eb 36                	jmp    8014c1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80148b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80148f:	74 0f                	je     8014a0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801491:	85 d2                	test   %edx,%edx
+  801493:	75 ec                	jne    801481 <strtol+0x48>
+        s++;
+  801495:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801499:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80149e:	eb e1                	jmp    801481 <strtol+0x48>
+        s += 2;
+  8014a0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8014a4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014a9:	eb d6                	jmp    801481 <strtol+0x48>
+            dig -= '0';
+  8014ab:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014ae:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014b2:	41 39 d0             	cmp    %edx,%r8d
+  8014b5:	7d 21                	jge    8014d8 <strtol+0x9f>
+        val = val * base + dig;
+  8014b7:	49 0f af c1          	imul   %r9,%rax
+  8014bb:	0f b6 c9             	movzbl %cl,%ecx
+  8014be:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014c1:	48 83 c7 01          	add    $0x1,%rdi
+  8014c5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014c9:	80 f9 39             	cmp    $0x39,%cl
+  8014cc:	76 dd                	jbe    8014ab <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014ce:	80 f9 7b             	cmp    $0x7b,%cl
+  8014d1:	77 05                	ja     8014d8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014d3:	83 e9 57             	sub    $0x57,%ecx
+  8014d6:	eb d6                	jmp    8014ae <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014d8:	4d 85 d2             	test   %r10,%r10
+  8014db:	74 03                	je     8014e0 <strtol+0xa7>
+  8014dd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014e0:	48 89 c2             	mov    %rax,%rdx
+  8014e3:	48 f7 da             	neg    %rdx
+  8014e6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014ea:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014ee:	c3                   	ret
+
+00000000008014ef <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014ef:	55                   	push   %rbp
+  8014f0:	48 89 e5             	mov    %rsp,%rbp
+  8014f3:	53                   	push   %rbx
+  8014f4:	48 89 fa             	mov    %rdi,%rdx
+  8014f7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fa:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801504:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801509:	be 00 00 00 00       	mov    $0x0,%esi
+  80150e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801514:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801516:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151a:	c9                   	leave
+  80151b:	c3                   	ret
+
+000000000080151c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80151c:	55                   	push   %rbp
+  80151d:	48 89 e5             	mov    %rsp,%rbp
+  801520:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801521:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801526:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801535:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153a:	be 00 00 00 00       	mov    $0x0,%esi
+  80153f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801545:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+
+000000000080154d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	53                   	push   %rbx
+  801552:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801556:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801559:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80155e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801568:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156d:	be 00 00 00 00       	mov    $0x0,%esi
+  801572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801578:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157a:	48 85 c0             	test   %rax,%rax
+  80157d:	7f 06                	jg     801585 <sys_env_destroy+0x38>
+}
+  80157f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801583:	c9                   	leave
+  801584:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801585:	49 89 c0             	mov    %rax,%r8
+  801588:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80158d:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801594:	00 00 00 
+  801597:	be 26 00 00 00       	mov    $0x26,%esi
+  80159c:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8015a3:	00 00 00 
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  8015b2:	00 00 00 
+  8015b5:	41 ff d1             	call   *%r9
+
+00000000008015b8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015b8:	55                   	push   %rbp
+  8015b9:	48 89 e5             	mov    %rsp,%rbp
+  8015bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+
+00000000008015e9 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ee:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801602:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801607:	be 00 00 00 00       	mov    $0x0,%esi
+  80160c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801612:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+
+000000000080161a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+  80161e:	53                   	push   %rbx
+  80161f:	48 89 fa             	mov    %rdi,%rdx
+  801622:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801631:	00 00 00 
+  801634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801644:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164a:	c9                   	leave
+  80164b:	c3                   	ret
+
+000000000080164c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80164c:	55                   	push   %rbp
+  80164d:	48 89 e5             	mov    %rsp,%rbp
+  801650:	53                   	push   %rbx
+  801651:	49 89 f8             	mov    %rdi,%r8
+  801654:	48 89 d3             	mov    %rdx,%rbx
+  801657:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80165f:	4c 89 c2             	mov    %r8,%rdx
+  801662:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801672:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801676:	c9                   	leave
+  801677:	c3                   	ret
+
+0000000000801678 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801678:	55                   	push   %rbp
+  801679:	48 89 e5             	mov    %rsp,%rbp
+  80167c:	53                   	push   %rbx
+  80167d:	48 83 ec 08          	sub    $0x8,%rsp
+  801681:	89 f8                	mov    %edi,%eax
+  801683:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801686:	48 63 f9             	movslq %ecx,%rdi
+  801689:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80168c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801691:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801694:	be 00 00 00 00       	mov    $0x0,%esi
+  801699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a1:	48 85 c0             	test   %rax,%rax
+  8016a4:	7f 06                	jg     8016ac <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016aa:	c9                   	leave
+  8016ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ac:	49 89 c0             	mov    %rax,%r8
+  8016af:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016b4:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8016bb:	00 00 00 
+  8016be:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c3:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8016ca:	00 00 00 
+  8016cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d2:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  8016d9:	00 00 00 
+  8016dc:	41 ff d1             	call   *%r9
+
+00000000008016df <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016df:	55                   	push   %rbp
+  8016e0:	48 89 e5             	mov    %rsp,%rbp
+  8016e3:	53                   	push   %rbx
+  8016e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e8:	89 f8                	mov    %edi,%eax
+  8016ea:	49 89 f2             	mov    %rsi,%r10
+  8016ed:	48 89 cf             	mov    %rcx,%rdi
+  8016f0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016f3:	48 63 da             	movslq %edx,%rbx
+  8016f6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fe:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801701:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801704:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801706:	48 85 c0             	test   %rax,%rax
+  801709:	7f 06                	jg     801711 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80170b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170f:	c9                   	leave
+  801710:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801711:	49 89 c0             	mov    %rax,%r8
+  801714:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801719:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801720:	00 00 00 
+  801723:	be 26 00 00 00       	mov    $0x26,%esi
+  801728:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  80172f:	00 00 00 
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+  801737:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  80173e:	00 00 00 
+  801741:	41 ff d1             	call   *%r9
+
+0000000000801744 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801744:	55                   	push   %rbp
+  801745:	48 89 e5             	mov    %rsp,%rbp
+  801748:	53                   	push   %rbx
+  801749:	48 83 ec 08          	sub    $0x8,%rsp
+  80174d:	49 89 f9             	mov    %rdi,%r9
+  801750:	89 f0                	mov    %esi,%eax
+  801752:	48 89 d3             	mov    %rdx,%rbx
+  801755:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801758:	49 63 f0             	movslq %r8d,%rsi
+  80175b:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80175e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801763:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176e:	48 85 c0             	test   %rax,%rax
+  801771:	7f 06                	jg     801779 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801773:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801777:	c9                   	leave
+  801778:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801779:	49 89 c0             	mov    %rax,%r8
+  80177c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801781:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801788:	00 00 00 
+  80178b:	be 26 00 00 00       	mov    $0x26,%esi
+  801790:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801797:	00 00 00 
+  80179a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179f:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  8017a6:	00 00 00 
+  8017a9:	41 ff d1             	call   *%r9
+
+00000000008017ac <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017ac:	55                   	push   %rbp
+  8017ad:	48 89 e5             	mov    %rsp,%rbp
+  8017b0:	53                   	push   %rbx
+  8017b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b5:	48 89 f1             	mov    %rsi,%rcx
+  8017b8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017be:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d5:	48 85 c0             	test   %rax,%rax
+  8017d8:	7f 06                	jg     8017e0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e0:	49 89 c0             	mov    %rax,%r8
+  8017e3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8017e8:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8017ef:	00 00 00 
+  8017f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017f7:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8017fe:	00 00 00 
+  801801:	b8 00 00 00 00       	mov    $0x0,%eax
+  801806:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  80180d:	00 00 00 
+  801810:	41 ff d1             	call   *%r9
+
+0000000000801813 <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  801813:	55                   	push   %rbp
+  801814:	48 89 e5             	mov    %rsp,%rbp
+  801817:	53                   	push   %rbx
+  801818:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80181b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801820:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801825:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80182f:	be 00 00 00 00       	mov    $0x0,%esi
+  801834:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183a:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  80183c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+0000000000801842 <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  801842:	55                   	push   %rbp
+  801843:	48 89 e5             	mov    %rsp,%rbp
+  801846:	53                   	push   %rbx
+  801847:	48 83 ec 08          	sub    $0x8,%rsp
+  80184b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  80184e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801851:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801856:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801860:	be 00 00 00 00       	mov    $0x0,%esi
+  801865:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80186d:	48 85 c0             	test   %rax,%rax
+  801870:	7f 06                	jg     801878 <sys_env_set_tls+0x36>
+}
+  801872:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801876:	c9                   	leave
+  801877:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801878:	49 89 c0             	mov    %rax,%r8
+  80187b:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801880:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801887:	00 00 00 
+  80188a:	be 26 00 00 00       	mov    $0x26,%esi
+  80188f:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801896:	00 00 00 
+  801899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189e:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  8018a5:	00 00 00 
+  8018a8:	41 ff d1             	call   *%r9
+
+00000000008018ab <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018ab:	55                   	push   %rbp
+  8018ac:	48 89 e5             	mov    %rsp,%rbp
+  8018af:	53                   	push   %rbx
+  8018b0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018b4:	48 63 ce             	movslq %esi,%rcx
+  8018b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018d6:	48 85 c0             	test   %rax,%rax
+  8018d9:	7f 06                	jg     8018e1 <sys_env_set_status+0x36>
+}
+  8018db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018df:	c9                   	leave
+  8018e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e1:	49 89 c0             	mov    %rax,%r8
+  8018e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8018e9:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8018f0:	00 00 00 
+  8018f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f8:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8018ff:	00 00 00 
+  801902:	b8 00 00 00 00       	mov    $0x0,%eax
+  801907:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  80190e:	00 00 00 
+  801911:	41 ff d1             	call   *%r9
+
+0000000000801914 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	53                   	push   %rbx
+  801919:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  80191d:	48 63 da             	movslq %edx,%rbx
+  801920:	48 63 ce             	movslq %esi,%rcx
+  801923:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801926:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801930:	be 00 00 00 00       	mov    $0x0,%esi
+  801935:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193d:	48 85 c0             	test   %rax,%rax
+  801940:	7f 06                	jg     801948 <sys_env_set_priority+0x34>
+}
+  801942:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801948:	49 89 c0             	mov    %rax,%r8
+  80194b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801950:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801957:	00 00 00 
+  80195a:	be 26 00 00 00       	mov    $0x26,%esi
+  80195f:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801966:	00 00 00 
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  801975:	00 00 00 
+  801978:	41 ff d1             	call   *%r9
+
+000000000080197b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+  80197f:	53                   	push   %rbx
+  801980:	48 83 ec 08          	sub    $0x8,%rsp
+  801984:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801987:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80198a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80198f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801994:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801999:	be 00 00 00 00       	mov    $0x0,%esi
+  80199e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019a6:	48 85 c0             	test   %rax,%rax
+  8019a9:	7f 06                	jg     8019b1 <sys_env_set_trapframe+0x36>
+}
+  8019ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019b1:	49 89 c0             	mov    %rax,%r8
+  8019b4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019b9:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  8019c0:	00 00 00 
+  8019c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8019c8:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  8019cf:	00 00 00 
+  8019d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d7:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  8019de:	00 00 00 
+  8019e1:	41 ff d1             	call   *%r9
+
+00000000008019e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8019e4:	55                   	push   %rbp
+  8019e5:	48 89 e5             	mov    %rsp,%rbp
+  8019e8:	53                   	push   %rbx
+  8019e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ed:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8019f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a02:	be 00 00 00 00       	mov    $0x0,%esi
+  801a07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a0f:	48 85 c0             	test   %rax,%rax
+  801a12:	7f 06                	jg     801a1a <sys_env_set_pgfault_upcall+0x36>
+}
+  801a14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a1a:	49 89 c0             	mov    %rax,%r8
+  801a1d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a22:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801a29:	00 00 00 
+  801a2c:	be 26 00 00 00       	mov    $0x26,%esi
+  801a31:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801a38:	00 00 00 
+  801a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a40:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  801a47:	00 00 00 
+  801a4a:	41 ff d1             	call   *%r9
+
+0000000000801a4d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	53                   	push   %rbx
+  801a52:	89 f8                	mov    %edi,%eax
+  801a54:	49 89 f1             	mov    %rsi,%r9
+  801a57:	48 89 d3             	mov    %rdx,%rbx
+  801a5a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a5d:	49 63 f0             	movslq %r8d,%rsi
+  801a60:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a63:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a68:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a71:	cd 30                	int    $0x30
+}
+  801a73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a77:	c9                   	leave
+  801a78:	c3                   	ret
+
+0000000000801a79 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801a79:	55                   	push   %rbp
+  801a7a:	48 89 e5             	mov    %rsp,%rbp
+  801a7d:	41 55                	push   %r13
+  801a7f:	41 54                	push   %r12
+  801a81:	53                   	push   %rbx
+  801a82:	89 f8                	mov    %edi,%eax
+  801a84:	49 89 f2             	mov    %rsi,%r10
+  801a87:	48 89 d3             	mov    %rdx,%rbx
+  801a8a:	48 89 cf             	mov    %rcx,%rdi
+  801a8d:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801a90:	49 63 f0             	movslq %r8d,%rsi
+  801a93:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a96:	4d 85 c9             	test   %r9,%r9
+  801a99:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801aa0:	00 00 00 
+  801aa3:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801aa7:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aac:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801aaf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ab5:	4d 8b 0b             	mov    (%r11),%r9
+  801ab8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801abc:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ac0:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801ac4:	cd 30                	int    $0x30
+}
+  801ac6:	5b                   	pop    %rbx
+  801ac7:	41 5c                	pop    %r12
+  801ac9:	41 5d                	pop    %r13
+  801acb:	5d                   	pop    %rbp
+  801acc:	c3                   	ret
+
+0000000000801acd <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801acd:	55                   	push   %rbp
+  801ace:	48 89 e5             	mov    %rsp,%rbp
+  801ad1:	53                   	push   %rbx
+  801ad2:	48 89 fa             	mov    %rdi,%rdx
+  801ad5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad8:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801add:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ae7:	be 00 00 00 00       	mov    $0x0,%esi
+  801aec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af2:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801af4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+0000000000801afa <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801afa:	55                   	push   %rbp
+  801afb:	48 89 e5             	mov    %rsp,%rbp
+  801afe:	53                   	push   %rbx
+  801aff:	48 83 ec 08          	sub    $0x8,%rsp
+  801b03:	48 89 fa             	mov    %rdi,%rdx
+  801b06:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b09:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b18:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b25:	48 85 c0             	test   %rax,%rax
+  801b28:	7f 06                	jg     801b30 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2e:	c9                   	leave
+  801b2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b30:	49 89 c0             	mov    %rax,%r8
+  801b33:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801b38:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801b3f:	00 00 00 
+  801b42:	be 26 00 00 00       	mov    $0x26,%esi
+  801b47:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801b4e:	00 00 00 
+  801b51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b56:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  801b5d:	00 00 00 
+  801b60:	41 ff d1             	call   *%r9
+
+0000000000801b63 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+  801b67:	41 55                	push   %r13
+  801b69:	41 54                	push   %r12
+  801b6b:	53                   	push   %rbx
+  801b6c:	89 f8                	mov    %edi,%eax
+  801b6e:	49 89 f2             	mov    %rsi,%r10
+  801b71:	48 89 d3             	mov    %rdx,%rbx
+  801b74:	48 89 cf             	mov    %rcx,%rdi
+  801b77:	44 89 c6             	mov    %r8d,%esi
+  801b7a:	4d 89 c8             	mov    %r9,%r8
+  801b7d:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801b81:	48 63 f6             	movslq %esi,%rsi
+  801b84:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801b87:	4d 85 db             	test   %r11,%r11
+  801b8a:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801b91:	00 00 00 
+  801b94:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801b98:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b9d:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801ba0:	4d 8b 0b             	mov    (%r11),%r9
+  801ba3:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ba7:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801bab:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801baf:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bb1:	5b                   	pop    %rbx
+  801bb2:	41 5c                	pop    %r12
+  801bb4:	41 5d                	pop    %r13
+  801bb6:	5d                   	pop    %rbp
+  801bb7:	c3                   	ret
+
+0000000000801bb8 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801bb8:	55                   	push   %rbp
+  801bb9:	48 89 e5             	mov    %rsp,%rbp
+  801bbc:	41 55                	push   %r13
+  801bbe:	41 54                	push   %r12
+  801bc0:	53                   	push   %rbx
+  801bc1:	89 f8                	mov    %edi,%eax
+  801bc3:	49 89 f2             	mov    %rsi,%r10
+  801bc6:	48 89 d3             	mov    %rdx,%rbx
+  801bc9:	48 89 cf             	mov    %rcx,%rdi
+  801bcc:	44 89 c6             	mov    %r8d,%esi
+  801bcf:	4d 89 c8             	mov    %r9,%r8
+  801bd2:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801bd6:	48 63 f6             	movslq %esi,%rsi
+  801bd9:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801bdc:	4d 85 db             	test   %r11,%r11
+  801bdf:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  801be6:	00 00 00 
+  801be9:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801bed:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bf2:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801bf5:	4d 8b 0b             	mov    (%r11),%r9
+  801bf8:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801bfc:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801c00:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801c04:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c06:	5b                   	pop    %rbx
+  801c07:	41 5c                	pop    %r12
+  801c09:	41 5d                	pop    %r13
+  801c0b:	5d                   	pop    %rbp
+  801c0c:	c3                   	ret
+
+0000000000801c0d <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801c0d:	55                   	push   %rbp
+  801c0e:	48 89 e5             	mov    %rsp,%rbp
+  801c11:	53                   	push   %rbx
+  801c12:	48 83 ec 08          	sub    $0x8,%rsp
+  801c16:	48 89 f1             	mov    %rsi,%rcx
+  801c19:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c21:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c29:	be 00 00 00 00       	mov    $0x0,%esi
+  801c2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c34:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c36:	48 85 c0             	test   %rax,%rax
+  801c39:	7f 06                	jg     801c41 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3f:	c9                   	leave
+  801c40:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c41:	49 89 c0             	mov    %rax,%r8
+  801c44:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801c49:	48 ba b8 56 80 00 00 	movabs $0x8056b8,%rdx
+  801c50:	00 00 00 
+  801c53:	be 26 00 00 00       	mov    $0x26,%esi
+  801c58:	48 bf d7 56 80 00 00 	movabs $0x8056d7,%rdi
+  801c5f:	00 00 00 
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	49 b9 53 06 80 00 00 	movabs $0x800653,%r9
+  801c6e:	00 00 00 
+  801c71:	41 ff d1             	call   *%r9
+
+0000000000801c74 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801c74:	55                   	push   %rbp
+  801c75:	48 89 e5             	mov    %rsp,%rbp
+  801c78:	53                   	push   %rbx
+  801c79:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c7c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c81:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c90:	be 00 00 00 00       	mov    $0x0,%esi
+  801c95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c9b:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801c9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	53                   	push   %rbx
+  801ca8:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801cab:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cad:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc7:	cd 30                	int    $0x30
+}
+  801cc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+
+0000000000801ccf <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801ccf:	55                   	push   %rbp
+  801cd0:	48 89 e5             	mov    %rsp,%rbp
+  801cd3:	53                   	push   %rbx
+  801cd4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801cd7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cda:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf4:	cd 30                	int    $0x30
+}
+  801cf6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+0000000000801cfc <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	53                   	push   %rbx
+  801d01:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801d04:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d06:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d0b:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d13:	be 00 00 00 00       	mov    $0x0,%esi
+  801d18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d1e:	cd 30                	int    $0x30
+}
+  801d20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d24:	c9                   	leave
+  801d25:	c3                   	ret
+
+0000000000801d26 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	53                   	push   %rbx
+  801d2b:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801d2e:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d31:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d40:	be 00 00 00 00       	mov    $0x0,%esi
+  801d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d4b:	cd 30                	int    $0x30
+}
+  801d4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+0000000000801d53 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801d53:	55                   	push   %rbp
+  801d54:	48 89 e5             	mov    %rsp,%rbp
+  801d57:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d58:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d62:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d71:	be 00 00 00 00       	mov    $0x0,%esi
+  801d76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d7c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+0000000000801d84 <sys_monitor>:
+
+int sys_monitor(void) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d89:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d93:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da2:	be 00 00 00 00       	mov    $0x0,%esi
+  801da7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dad:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801daf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db3:	c9                   	leave
+  801db4:	c3                   	ret
+
+0000000000801db5 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801db5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dbc:	ff ff ff 
+  801dbf:	48 01 f8             	add    %rdi,%rax
+  801dc2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801dc6:	c3                   	ret
+
+0000000000801dc7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dc7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dce:	ff ff ff 
+  801dd1:	48 01 f8             	add    %rdi,%rax
+  801dd4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801dd8:	48 c1 e0 12          	shl    $0x12,%rax
+  801ddc:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801de1:	48 01 d0             	add    %rdx,%rax
+}
+  801de4:	c3                   	ret
+
+0000000000801de5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801de5:	55                   	push   %rbp
+  801de6:	48 89 e5             	mov    %rsp,%rbp
+  801de9:	41 57                	push   %r15
+  801deb:	41 56                	push   %r14
+  801ded:	41 55                	push   %r13
+  801def:	41 54                	push   %r12
+  801df1:	53                   	push   %rbx
+  801df2:	48 83 ec 08          	sub    $0x8,%rsp
+  801df6:	49 89 ff             	mov    %rdi,%r15
+  801df9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801dfe:	49 bd 83 3a 80 00 00 	movabs $0x803a83,%r13
+  801e05:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e08:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e0e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e11:	48 89 df             	mov    %rbx,%rdi
+  801e14:	41 ff d5             	call   *%r13
+  801e17:	83 e0 04             	and    $0x4,%eax
+  801e1a:	74 17                	je     801e33 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e1c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e23:	4c 39 f3             	cmp    %r14,%rbx
+  801e26:	75 e6                	jne    801e0e <fd_alloc+0x29>
+  801e28:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e2e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e33:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e36:	48 83 c4 08          	add    $0x8,%rsp
+  801e3a:	5b                   	pop    %rbx
+  801e3b:	41 5c                	pop    %r12
+  801e3d:	41 5d                	pop    %r13
+  801e3f:	41 5e                	pop    %r14
+  801e41:	41 5f                	pop    %r15
+  801e43:	5d                   	pop    %rbp
+  801e44:	c3                   	ret
+
+0000000000801e45 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e45:	83 ff 1f             	cmp    $0x1f,%edi
+  801e48:	77 39                	ja     801e83 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e4a:	55                   	push   %rbp
+  801e4b:	48 89 e5             	mov    %rsp,%rbp
+  801e4e:	41 54                	push   %r12
+  801e50:	53                   	push   %rbx
+  801e51:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e54:	48 63 df             	movslq %edi,%rbx
+  801e57:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e5e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e62:	48 89 df             	mov    %rbx,%rdi
+  801e65:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	a8 04                	test   $0x4,%al
+  801e73:	74 14                	je     801e89 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e75:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e7e:	5b                   	pop    %rbx
+  801e7f:	41 5c                	pop    %r12
+  801e81:	5d                   	pop    %rbp
+  801e82:	c3                   	ret
+        return -E_INVAL;
+  801e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e88:	c3                   	ret
+        return -E_INVAL;
+  801e89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8e:	eb ee                	jmp    801e7e <fd_lookup+0x39>
+
+0000000000801e90 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+  801e94:	41 54                	push   %r12
+  801e96:	53                   	push   %rbx
+  801e97:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801e9a:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  801ea1:	00 00 00 
+  801ea4:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801eab:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801eae:	39 3b                	cmp    %edi,(%rbx)
+  801eb0:	74 4a                	je     801efc <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801eb2:	48 83 c0 08          	add    $0x8,%rax
+  801eb6:	48 8b 18             	mov    (%rax),%rbx
+  801eb9:	48 85 db             	test   %rbx,%rbx
+  801ebc:	75 f0                	jne    801eae <dev_lookup+0x1e>
+  801ebe:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ec5:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ec7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ecb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ed1:	89 fa                	mov    %edi,%edx
+  801ed3:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  801eda:	00 00 00 
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  801ee9:	00 00 00 
+  801eec:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801eee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ef3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ef7:	5b                   	pop    %rbx
+  801ef8:	41 5c                	pop    %r12
+  801efa:	5d                   	pop    %rbp
+  801efb:	c3                   	ret
+            return 0;
+  801efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f01:	eb f0                	jmp    801ef3 <dev_lookup+0x63>
+
+0000000000801f03 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f03:	55                   	push   %rbp
+  801f04:	48 89 e5             	mov    %rsp,%rbp
+  801f07:	41 55                	push   %r13
+  801f09:	41 54                	push   %r12
+  801f0b:	53                   	push   %rbx
+  801f0c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f10:	48 89 fb             	mov    %rdi,%rbx
+  801f13:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f16:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f1d:	ff ff ff 
+  801f20:	48 01 df             	add    %rbx,%rdi
+  801f23:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f27:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f2b:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  801f32:	00 00 00 
+  801f35:	ff d0                	call   *%rax
+  801f37:	41 89 c5             	mov    %eax,%r13d
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 06                	js     801f44 <fd_close+0x41>
+  801f3e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f42:	74 1a                	je     801f5e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f44:	45 84 e4             	test   %r12b,%r12b
+  801f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f50:	44 89 e8             	mov    %r13d,%eax
+  801f53:	48 83 c4 18          	add    $0x18,%rsp
+  801f57:	5b                   	pop    %rbx
+  801f58:	41 5c                	pop    %r12
+  801f5a:	41 5d                	pop    %r13
+  801f5c:	5d                   	pop    %rbp
+  801f5d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f5e:	8b 3b                	mov    (%rbx),%edi
+  801f60:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f64:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  801f6b:	00 00 00 
+  801f6e:	ff d0                	call   *%rax
+  801f70:	41 89 c5             	mov    %eax,%r13d
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 1b                	js     801f92 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f7b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f7f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f85:	48 85 c0             	test   %rax,%rax
+  801f88:	74 08                	je     801f92 <fd_close+0x8f>
+  801f8a:	48 89 df             	mov    %rbx,%rdi
+  801f8d:	ff d0                	call   *%rax
+  801f8f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f92:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f97:	48 89 de             	mov    %rbx,%rsi
+  801f9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f9f:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  801fa6:	00 00 00 
+  801fa9:	ff d0                	call   *%rax
+    return res;
+  801fab:	eb a3                	jmp    801f50 <fd_close+0x4d>
+
+0000000000801fad <close>:
+
+int
+close(int fdnum) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fb5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fb9:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  801fc0:	00 00 00 
+  801fc3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fc5:	85 c0                	test   %eax,%eax
+  801fc7:	78 15                	js     801fde <close+0x31>
+
+    return fd_close(fd, 1);
+  801fc9:	be 01 00 00 00       	mov    $0x1,%esi
+  801fce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fd2:	48 b8 03 1f 80 00 00 	movabs $0x801f03,%rax
+  801fd9:	00 00 00 
+  801fdc:	ff d0                	call   *%rax
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <close_all>:
+
+void
+close_all(void) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	41 54                	push   %r12
+  801fe6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801fe7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fec:	49 bc ad 1f 80 00 00 	movabs $0x801fad,%r12
+  801ff3:	00 00 00 
+  801ff6:	89 df                	mov    %ebx,%edi
+  801ff8:	41 ff d4             	call   *%r12
+  801ffb:	83 c3 01             	add    $0x1,%ebx
+  801ffe:	83 fb 20             	cmp    $0x20,%ebx
+  802001:	75 f3                	jne    801ff6 <close_all+0x16>
+}
+  802003:	5b                   	pop    %rbx
+  802004:	41 5c                	pop    %r12
+  802006:	5d                   	pop    %rbp
+  802007:	c3                   	ret
+
+0000000000802008 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802008:	55                   	push   %rbp
+  802009:	48 89 e5             	mov    %rsp,%rbp
+  80200c:	41 57                	push   %r15
+  80200e:	41 56                	push   %r14
+  802010:	41 55                	push   %r13
+  802012:	41 54                	push   %r12
+  802014:	53                   	push   %rbx
+  802015:	48 83 ec 38          	sub    $0x38,%rsp
+  802019:	41 89 f7             	mov    %esi,%r15d
+  80201c:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80201f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802023:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  80202a:	00 00 00 
+  80202d:	ff d0                	call   *%rax
+  80202f:	89 c3                	mov    %eax,%ebx
+  802031:	85 c0                	test   %eax,%eax
+  802033:	0f 88 ec 00 00 00    	js     802125 <dup+0x11d>
+    close(newfdnum);
+  802039:	44 89 ff             	mov    %r15d,%edi
+  80203c:	48 b8 ad 1f 80 00 00 	movabs $0x801fad,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802048:	49 63 c7             	movslq %r15d,%rax
+  80204b:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802051:	48 c1 e0 0c          	shl    $0xc,%rax
+  802055:	49 89 c6             	mov    %rax,%r14
+  802058:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  80205c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802060:	4c 89 ff             	mov    %r15,%rdi
+  802063:	48 bb c7 1d 80 00 00 	movabs $0x801dc7,%rbx
+  80206a:	00 00 00 
+  80206d:	ff d3                	call   *%rbx
+  80206f:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  802072:	4c 89 f7             	mov    %r14,%rdi
+  802075:	ff d3                	call   *%rbx
+  802077:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  80207b:	4c 89 e7             	mov    %r12,%rdi
+  80207e:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+  80208a:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  80208d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  802092:	49 be 83 3a 80 00 00 	movabs $0x803a83,%r14
+  802099:	00 00 00 
+  80209c:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8020a0:	41 ff d6             	call   *%r14
+  8020a3:	44 39 e8             	cmp    %r13d,%eax
+  8020a6:	75 10                	jne    8020b8 <dup+0xb0>
+  8020a8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8020af:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8020b6:	75 e4                	jne    80209c <dup+0x94>
+    if (prot & PROT_R) {
+  8020b8:	41 f6 c5 04          	test   $0x4,%r13b
+  8020bc:	74 29                	je     8020e7 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8020be:	45 89 e9             	mov    %r13d,%r9d
+  8020c1:	49 89 d8             	mov    %rbx,%r8
+  8020c4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8020c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020cd:	4c 89 e6             	mov    %r12,%rsi
+  8020d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d5:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	89 c3                	mov    %eax,%ebx
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 4f                	js     802136 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  8020e7:	4c 89 ff             	mov    %r15,%rdi
+  8020ea:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  8020f1:	00 00 00 
+  8020f4:	ff d0                	call   *%rax
+  8020f6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8020f9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020ff:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  802103:	ba 00 00 00 00       	mov    $0x0,%edx
+  802108:	4c 89 fe             	mov    %r15,%rsi
+  80210b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802110:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  802117:	00 00 00 
+  80211a:	ff d0                	call   *%rax
+  80211c:	89 c3                	mov    %eax,%ebx
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	78 14                	js     802136 <dup+0x12e>
+
+    return newfdnum;
+  802122:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  802125:	89 d8                	mov    %ebx,%eax
+  802127:	48 83 c4 38          	add    $0x38,%rsp
+  80212b:	5b                   	pop    %rbx
+  80212c:	41 5c                	pop    %r12
+  80212e:	41 5d                	pop    %r13
+  802130:	41 5e                	pop    %r14
+  802132:	41 5f                	pop    %r15
+  802134:	5d                   	pop    %rbp
+  802135:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802136:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80213b:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80213f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802144:	49 bc ac 17 80 00 00 	movabs $0x8017ac,%r12
+  80214b:	00 00 00 
+  80214e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  802151:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802156:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80215a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215f:	41 ff d4             	call   *%r12
+    return res;
+  802162:	eb c1                	jmp    802125 <dup+0x11d>
+
+0000000000802164 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	41 56                	push   %r14
+  80216a:	41 55                	push   %r13
+  80216c:	41 54                	push   %r12
+  80216e:	53                   	push   %rbx
+  80216f:	48 83 ec 10          	sub    $0x10,%rsp
+  802173:	89 fb                	mov    %edi,%ebx
+  802175:	49 89 f4             	mov    %rsi,%r12
+  802178:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80217b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80217f:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802186:	00 00 00 
+  802189:	ff d0                	call   *%rax
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 4c                	js     8021db <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80218f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802193:	41 8b 3e             	mov    (%r14),%edi
+  802196:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80219a:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 35                	js     8021df <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021aa:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8021ae:	83 e0 03             	and    $0x3,%eax
+  8021b1:	83 f8 01             	cmp    $0x1,%eax
+  8021b4:	74 2d                	je     8021e3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ba:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8021be:	48 85 c0             	test   %rax,%rax
+  8021c1:	74 59                	je     80221c <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8021c3:	4c 89 ea             	mov    %r13,%rdx
+  8021c6:	4c 89 e6             	mov    %r12,%rsi
+  8021c9:	4c 89 f7             	mov    %r14,%rdi
+  8021cc:	ff d0                	call   *%rax
+}
+  8021ce:	48 83 c4 10          	add    $0x10,%rsp
+  8021d2:	5b                   	pop    %rbx
+  8021d3:	41 5c                	pop    %r12
+  8021d5:	41 5d                	pop    %r13
+  8021d7:	41 5e                	pop    %r14
+  8021d9:	5d                   	pop    %rbp
+  8021da:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021db:	48 98                	cltq
+  8021dd:	eb ef                	jmp    8021ce <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021df:	48 98                	cltq
+  8021e1:	eb eb                	jmp    8021ce <read+0x6a>
+  8021e3:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8021ea:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021f0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021f6:	89 da                	mov    %ebx,%edx
+  8021f8:	48 bf 61 57 80 00 00 	movabs $0x805761,%rdi
+  8021ff:	00 00 00 
+  802202:	b8 00 00 00 00       	mov    $0x0,%eax
+  802207:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  80220e:	00 00 00 
+  802211:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802213:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80221a:	eb b2                	jmp    8021ce <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80221c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802223:	eb a9                	jmp    8021ce <read+0x6a>
+
+0000000000802225 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+  802229:	41 57                	push   %r15
+  80222b:	41 56                	push   %r14
+  80222d:	41 55                	push   %r13
+  80222f:	41 54                	push   %r12
+  802231:	53                   	push   %rbx
+  802232:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802236:	48 85 d2             	test   %rdx,%rdx
+  802239:	74 54                	je     80228f <readn+0x6a>
+  80223b:	41 89 fd             	mov    %edi,%r13d
+  80223e:	49 89 f6             	mov    %rsi,%r14
+  802241:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802244:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802249:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80224e:	49 bf 64 21 80 00 00 	movabs $0x802164,%r15
+  802255:	00 00 00 
+  802258:	4c 89 e2             	mov    %r12,%rdx
+  80225b:	48 29 f2             	sub    %rsi,%rdx
+  80225e:	4c 01 f6             	add    %r14,%rsi
+  802261:	44 89 ef             	mov    %r13d,%edi
+  802264:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802267:	85 c0                	test   %eax,%eax
+  802269:	78 20                	js     80228b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80226b:	01 c3                	add    %eax,%ebx
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	74 08                	je     802279 <readn+0x54>
+  802271:	48 63 f3             	movslq %ebx,%rsi
+  802274:	4c 39 e6             	cmp    %r12,%rsi
+  802277:	72 df                	jb     802258 <readn+0x33>
+    }
+    return res;
+  802279:	48 63 c3             	movslq %ebx,%rax
+}
+  80227c:	48 83 c4 08          	add    $0x8,%rsp
+  802280:	5b                   	pop    %rbx
+  802281:	41 5c                	pop    %r12
+  802283:	41 5d                	pop    %r13
+  802285:	41 5e                	pop    %r14
+  802287:	41 5f                	pop    %r15
+  802289:	5d                   	pop    %rbp
+  80228a:	c3                   	ret
+        if (inc < 0) return inc;
+  80228b:	48 98                	cltq
+  80228d:	eb ed                	jmp    80227c <readn+0x57>
+    int inc = 1, res = 0;
+  80228f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802294:	eb e3                	jmp    802279 <readn+0x54>
+
+0000000000802296 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802296:	55                   	push   %rbp
+  802297:	48 89 e5             	mov    %rsp,%rbp
+  80229a:	41 56                	push   %r14
+  80229c:	41 55                	push   %r13
+  80229e:	41 54                	push   %r12
+  8022a0:	53                   	push   %rbx
+  8022a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a5:	89 fb                	mov    %edi,%ebx
+  8022a7:	49 89 f4             	mov    %rsi,%r12
+  8022aa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022b1:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	78 47                	js     802308 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022c1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022c5:	41 8b 3e             	mov    (%r14),%edi
+  8022c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022cc:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  8022d3:	00 00 00 
+  8022d6:	ff d0                	call   *%rax
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	78 30                	js     80230c <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022dc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8022e1:	74 2d                	je     802310 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022e7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8022eb:	48 85 c0             	test   %rax,%rax
+  8022ee:	74 59                	je     802349 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  8022f0:	4c 89 ea             	mov    %r13,%rdx
+  8022f3:	4c 89 e6             	mov    %r12,%rsi
+  8022f6:	4c 89 f7             	mov    %r14,%rdi
+  8022f9:	ff d0                	call   *%rax
+}
+  8022fb:	48 83 c4 10          	add    $0x10,%rsp
+  8022ff:	5b                   	pop    %rbx
+  802300:	41 5c                	pop    %r12
+  802302:	41 5d                	pop    %r13
+  802304:	41 5e                	pop    %r14
+  802306:	5d                   	pop    %rbp
+  802307:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802308:	48 98                	cltq
+  80230a:	eb ef                	jmp    8022fb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80230c:	48 98                	cltq
+  80230e:	eb eb                	jmp    8022fb <write+0x65>
+  802310:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802317:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802319:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80231d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802323:	89 da                	mov    %ebx,%edx
+  802325:	48 bf 7d 57 80 00 00 	movabs $0x80577d,%rdi
+  80232c:	00 00 00 
+  80232f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802334:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  80233b:	00 00 00 
+  80233e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802340:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802347:	eb b2                	jmp    8022fb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802349:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802350:	eb a9                	jmp    8022fb <write+0x65>
+
+0000000000802352 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  802356:	53                   	push   %rbx
+  802357:	48 83 ec 18          	sub    $0x18,%rsp
+  80235b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80235d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802361:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	78 0c                	js     80237d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802371:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802375:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802381:	c9                   	leave
+  802382:	c3                   	ret
+
+0000000000802383 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	41 55                	push   %r13
+  802389:	41 54                	push   %r12
+  80238b:	53                   	push   %rbx
+  80238c:	48 83 ec 18          	sub    $0x18,%rsp
+  802390:	89 fb                	mov    %edi,%ebx
+  802392:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802395:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802399:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 38                	js     8023e1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023a9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8023ad:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8023b1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023b5:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 1c                	js     8023e1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023c5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8023ca:	74 20                	je     8023ec <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023d0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8023d4:	48 85 c0             	test   %rax,%rax
+  8023d7:	74 4a                	je     802423 <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8023d9:	44 89 e6             	mov    %r12d,%esi
+  8023dc:	4c 89 ef             	mov    %r13,%rdi
+  8023df:	ff d0                	call   *%rax
+}
+  8023e1:	48 83 c4 18          	add    $0x18,%rsp
+  8023e5:	5b                   	pop    %rbx
+  8023e6:	41 5c                	pop    %r12
+  8023e8:	41 5d                	pop    %r13
+  8023ea:	5d                   	pop    %rbp
+  8023eb:	c3                   	ret
+  8023ec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023f3:	00 00 
+                thisenv->env_id, fdnum);
+  8023f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023ff:	89 da                	mov    %ebx,%edx
+  802401:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  802408:	00 00 00 
+  80240b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802410:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  802417:	00 00 00 
+  80241a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80241c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802421:	eb be                	jmp    8023e1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802423:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802428:	eb b7                	jmp    8023e1 <ftruncate+0x5e>
+
+000000000080242a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80242a:	55                   	push   %rbp
+  80242b:	48 89 e5             	mov    %rsp,%rbp
+  80242e:	41 54                	push   %r12
+  802430:	53                   	push   %rbx
+  802431:	48 83 ec 10          	sub    $0x10,%rsp
+  802435:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802438:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80243c:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	78 4e                	js     80249a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80244c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802450:	41 8b 3c 24          	mov    (%r12),%edi
+  802454:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802458:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+  802464:	85 c0                	test   %eax,%eax
+  802466:	78 32                	js     80249a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802468:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80246c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802471:	74 30                	je     8024a3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802473:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802476:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80247d:	00 00 00 
+    stat->st_isdir = 0;
+  802480:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802487:	00 00 00 
+    stat->st_dev = dev;
+  80248a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802491:	48 89 de             	mov    %rbx,%rsi
+  802494:	4c 89 e7             	mov    %r12,%rdi
+  802497:	ff 50 28             	call   *0x28(%rax)
+}
+  80249a:	48 83 c4 10          	add    $0x10,%rsp
+  80249e:	5b                   	pop    %rbx
+  80249f:	41 5c                	pop    %r12
+  8024a1:	5d                   	pop    %rbp
+  8024a2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024a3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024a8:	eb f0                	jmp    80249a <fstat+0x70>
+
+00000000008024aa <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+  8024ae:	41 54                	push   %r12
+  8024b0:	53                   	push   %rbx
+  8024b1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8024b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b9:	48 b8 ad 2a 80 00 00 	movabs $0x802aad,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 25                	js     8024f0 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8024cb:	4c 89 e6             	mov    %r12,%rsi
+  8024ce:	89 c7                	mov    %eax,%edi
+  8024d0:	48 b8 2a 24 80 00 00 	movabs $0x80242a,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8024df:	89 df                	mov    %ebx,%edi
+  8024e1:	48 b8 ad 1f 80 00 00 	movabs $0x801fad,%rax
+  8024e8:	00 00 00 
+  8024eb:	ff d0                	call   *%rax
+
+    return res;
+  8024ed:	44 89 e3             	mov    %r12d,%ebx
+}
+  8024f0:	89 d8                	mov    %ebx,%eax
+  8024f2:	5b                   	pop    %rbx
+  8024f3:	41 5c                	pop    %r12
+  8024f5:	5d                   	pop    %rbp
+  8024f6:	c3                   	ret
+
+00000000008024f7 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8024f7:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8024fe:	00 00 00 
+  802501:	ba 00 00 00 00       	mov    $0x0,%edx
+  802506:	eb 0e                	jmp    802516 <mmap_lookup+0x1f>
+  802508:	48 83 c2 01          	add    $0x1,%rdx
+  80250c:	48 83 c0 20          	add    $0x20,%rax
+  802510:	48 83 fa 40          	cmp    $0x40,%rdx
+  802514:	74 2b                	je     802541 <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802516:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80251a:	48 85 c9             	test   %rcx,%rcx
+  80251d:	74 e9                	je     802508 <mmap_lookup+0x11>
+  80251f:	48 8b 30             	mov    (%rax),%rsi
+  802522:	48 39 f7             	cmp    %rsi,%rdi
+  802525:	72 e1                	jb     802508 <mmap_lookup+0x11>
+  802527:	48 01 f1             	add    %rsi,%rcx
+  80252a:	48 39 cf             	cmp    %rcx,%rdi
+  80252d:	73 d9                	jae    802508 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  80252f:	48 c1 e2 05          	shl    $0x5,%rdx
+  802533:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80253a:	00 00 00 
+  80253d:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802540:	c3                   	ret
+    return NULL;
+  802541:	b8 00 00 00 00       	mov    $0x0,%eax
+  802546:	c3                   	ret
+
+0000000000802547 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802547:	55                   	push   %rbp
+  802548:	48 89 e5             	mov    %rsp,%rbp
+  80254b:	41 54                	push   %r12
+  80254d:	53                   	push   %rbx
+  80254e:	89 fb                	mov    %edi,%ebx
+  802550:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802553:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80255a:	00 00 00 
+  80255d:	83 38 00             	cmpl   $0x0,(%rax)
+  802560:	74 3d                	je     80259f <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802562:	41 54                	push   %r12
+  802564:	6a 00                	push   $0x0
+  802566:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80256c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802577:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257c:	89 de                	mov    %ebx,%esi
+  80257e:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802585:	00 00 00 
+  802588:	8b 38                	mov    (%rax),%edi
+  80258a:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+}
+  802596:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	5d                   	pop    %rbp
+  80259e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80259f:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025a4:	48 b8 4e 43 80 00 00 	movabs $0x80434e,%rax
+  8025ab:	00 00 00 
+  8025ae:	ff d0                	call   *%rax
+  8025b0:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8025b7:	00 00 
+  8025b9:	eb a7                	jmp    802562 <fsipc_words+0x1b>
+
+00000000008025bb <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8025bb:	55                   	push   %rbp
+  8025bc:	48 89 e5             	mov    %rsp,%rbp
+  8025bf:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8025c3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8025ca:	00 
+  8025cb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8025d2:	00 
+  8025d3:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8025d7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025db:	48 63 f6             	movslq %esi,%rsi
+  8025de:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8025e2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025e6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8025eb:	48 b8 47 25 80 00 00 	movabs $0x802547,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+}
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+00000000008025f9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802601:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802608:	00 
+  802609:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802610:	00 
+  802611:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802618:	00 
+  802619:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  80261d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802621:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802625:	bf 06 00 00 00       	mov    $0x6,%edi
+  80262a:	48 b8 47 25 80 00 00 	movabs $0x802547,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+}
+  802636:	c9                   	leave
+  802637:	c3                   	ret
+
+0000000000802638 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802638:	55                   	push   %rbp
+  802639:	48 89 e5             	mov    %rsp,%rbp
+  80263c:	41 54                	push   %r12
+  80263e:	53                   	push   %rbx
+  80263f:	89 fb                	mov    %edi,%ebx
+  802641:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802644:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  80264b:	00 00 00 
+  80264e:	83 38 00             	cmpl   $0x0,(%rax)
+  802651:	74 3f                	je     802692 <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802653:	6a 00                	push   $0x0
+  802655:	6a 00                	push   $0x0
+  802657:	4d 89 e1             	mov    %r12,%r9
+  80265a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802660:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802665:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80266c:	00 00 00 
+  80266f:	89 de                	mov    %ebx,%esi
+  802671:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802678:	00 00 00 
+  80267b:	8b 38                	mov    (%rax),%edi
+  80267d:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  802684:	00 00 00 
+  802687:	ff d0                	call   *%rax
+}
+  802689:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80268d:	5b                   	pop    %rbx
+  80268e:	41 5c                	pop    %r12
+  802690:	5d                   	pop    %rbp
+  802691:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802692:	bf 03 00 00 00       	mov    $0x3,%edi
+  802697:	48 b8 4e 43 80 00 00 	movabs $0x80434e,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+  8026a3:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8026aa:	00 00 
+  8026ac:	eb a5                	jmp    802653 <fsipc+0x1b>
+
+00000000008026ae <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8026ae:	55                   	push   %rbp
+  8026af:	48 89 e5             	mov    %rsp,%rbp
+  8026b2:	41 54                	push   %r12
+  8026b4:	53                   	push   %rbx
+  8026b5:	41 89 fc             	mov    %edi,%r12d
+  8026b8:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026bb:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8026c2:	00 00 00 
+  8026c5:	83 38 00             	cmpl   $0x0,(%rax)
+  8026c8:	74 46                	je     802710 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8026ca:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8026ce:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026dc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026e2:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8026e9:	00 00 00 
+  8026ec:	44 89 e6             	mov    %r12d,%esi
+  8026ef:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8026f6:	00 00 00 
+  8026f9:	8b 38                	mov    (%rax),%edi
+  8026fb:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  802702:	00 00 00 
+  802705:	ff d0                	call   *%rax
+}
+  802707:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80270b:	5b                   	pop    %rbx
+  80270c:	41 5c                	pop    %r12
+  80270e:	5d                   	pop    %rbp
+  80270f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802710:	bf 03 00 00 00       	mov    $0x3,%edi
+  802715:	48 b8 4e 43 80 00 00 	movabs $0x80434e,%rax
+  80271c:	00 00 00 
+  80271f:	ff d0                	call   *%rax
+  802721:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802728:	00 00 
+  80272a:	eb 9e                	jmp    8026ca <fsipcv+0x1c>
+
+000000000080272c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80272c:	55                   	push   %rbp
+  80272d:	48 89 e5             	mov    %rsp,%rbp
+  802730:	41 54                	push   %r12
+  802732:	53                   	push   %rbx
+  802733:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802736:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802739:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802740:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802742:	be 00 00 00 00       	mov    $0x0,%esi
+  802747:	bf 05 00 00 00       	mov    $0x5,%edi
+  80274c:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802753:	00 00 00 
+  802756:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802758:	85 c0                	test   %eax,%eax
+  80275a:	78 3d                	js     802799 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80275c:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802763:	00 00 00 
+  802766:	4c 89 e6             	mov    %r12,%rsi
+  802769:	48 89 df             	mov    %rbx,%rdi
+  80276c:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  802773:	00 00 00 
+  802776:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802778:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80277f:	00 
+  802780:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802786:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80278d:	00 
+  80278e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802794:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802799:	5b                   	pop    %rbx
+  80279a:	41 5c                	pop    %r12
+  80279c:	5d                   	pop    %rbp
+  80279d:	c3                   	ret
+
+000000000080279e <fsipcv_buf>:
+    return FSIPCV;
+  80279e:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8027a5:	00 00 00 
+    if (!allocated) {
+  8027a8:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8027af:	00 00 00 
+  8027b2:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8027b5:	74 01                	je     8027b8 <fsipcv_buf+0x1a>
+}
+  8027b7:	c3                   	ret
+fsipcv_buf(void) {
+  8027b8:	55                   	push   %rbp
+  8027b9:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8027bc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027c1:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027c6:	48 89 c6             	mov    %rax,%rsi
+  8027c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ce:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	78 19                	js     8027f7 <fsipcv_buf+0x59>
+        allocated = 1;
+  8027de:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8027e5:	00 00 00 
+  8027e8:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8027eb:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8027f2:	00 00 00 
+}
+  8027f5:	5d                   	pop    %rbp
+  8027f6:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8027f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fc:	eb f7                	jmp    8027f5 <fsipcv_buf+0x57>
+
+00000000008027fe <devfile_write>:
+    if (!fd || !buf) {
+  8027fe:	48 85 ff             	test   %rdi,%rdi
+  802801:	0f 84 46 01 00 00    	je     80294d <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802807:	55                   	push   %rbp
+  802808:	48 89 e5             	mov    %rsp,%rbp
+  80280b:	41 57                	push   %r15
+  80280d:	41 56                	push   %r14
+  80280f:	41 55                	push   %r13
+  802811:	41 54                	push   %r12
+  802813:	53                   	push   %rbx
+  802814:	48 83 ec 18          	sub    $0x18,%rsp
+  802818:	49 89 ff             	mov    %rdi,%r15
+  80281b:	49 89 f5             	mov    %rsi,%r13
+  80281e:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802821:	48 85 f6             	test   %rsi,%rsi
+  802824:	0f 84 1a 01 00 00    	je     802944 <devfile_write+0x146>
+    while (n) {
+  80282a:	48 85 d2             	test   %rdx,%rdx
+  80282d:	0f 84 fc 00 00 00    	je     80292f <devfile_write+0x131>
+    size_t i = 0;
+  802833:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802839:	eb 6c                	jmp    8028a7 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80283b:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802841:	4c 39 e3             	cmp    %r12,%rbx
+  802844:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802848:	4c 89 e2             	mov    %r12,%rdx
+  80284b:	4c 89 ee             	mov    %r13,%rsi
+  80284e:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802855:	00 00 00 
+  802858:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802864:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802868:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80286f:	00 00 00 
+  802872:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802874:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802878:	be 00 00 00 00       	mov    $0x0,%esi
+  80287d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802882:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	0f 88 95 00 00 00    	js     80292b <devfile_write+0x12d>
+        buf += ret;
+  802896:	48 98                	cltq
+  802898:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  80289b:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80289e:	48 29 c3             	sub    %rax,%rbx
+  8028a1:	0f 84 8b 00 00 00    	je     802932 <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8028a7:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8028ae:	76 8b                	jbe    80283b <devfile_write+0x3d>
+  8028b0:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+  8028bc:	49 89 c4             	mov    %rax,%r12
+  8028bf:	48 85 c0             	test   %rax,%rax
+  8028c2:	0f 84 73 ff ff ff    	je     80283b <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8028c8:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028cd:	48 39 c3             	cmp    %rax,%rbx
+  8028d0:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8028d4:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8028db:	00 
+  8028dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8028e0:	48 89 c2             	mov    %rax,%rdx
+  8028e3:	4c 89 ee             	mov    %r13,%rsi
+  8028e6:	48 b9 29 13 80 00 00 	movabs $0x801329,%rcx
+  8028ed:	00 00 00 
+  8028f0:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8028f2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028f6:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  8028fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028fe:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802903:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  80290a:	48 c1 ee 0c          	shr    $0xc,%rsi
+  80290e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802913:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	0f 89 6f ff ff ff    	jns    802896 <devfile_write+0x98>
+                return ret;
+  802927:	48 98                	cltq
+  802929:	eb 0a                	jmp    802935 <devfile_write+0x137>
+                return ret;
+  80292b:	48 98                	cltq
+  80292d:	eb 06                	jmp    802935 <devfile_write+0x137>
+    size_t i = 0;
+  80292f:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802932:	4c 89 f0             	mov    %r14,%rax
+}
+  802935:	48 83 c4 18          	add    $0x18,%rsp
+  802939:	5b                   	pop    %rbx
+  80293a:	41 5c                	pop    %r12
+  80293c:	41 5d                	pop    %r13
+  80293e:	41 5e                	pop    %r14
+  802940:	41 5f                	pop    %r15
+  802942:	5d                   	pop    %rbp
+  802943:	c3                   	ret
+        return -E_INVAL;
+  802944:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80294b:	eb e8                	jmp    802935 <devfile_write+0x137>
+  80294d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802954:	c3                   	ret
+
+0000000000802955 <devfile_read>:
+    if (!fd || !buf) {
+  802955:	48 85 ff             	test   %rdi,%rdi
+  802958:	0f 84 47 01 00 00    	je     802aa5 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80295e:	55                   	push   %rbp
+  80295f:	48 89 e5             	mov    %rsp,%rbp
+  802962:	41 57                	push   %r15
+  802964:	41 56                	push   %r14
+  802966:	41 55                	push   %r13
+  802968:	41 54                	push   %r12
+  80296a:	53                   	push   %rbx
+  80296b:	48 83 ec 18          	sub    $0x18,%rsp
+  80296f:	49 89 ff             	mov    %rdi,%r15
+  802972:	49 89 f5             	mov    %rsi,%r13
+  802975:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802978:	48 85 f6             	test   %rsi,%rsi
+  80297b:	0f 84 1b 01 00 00    	je     802a9c <devfile_read+0x147>
+    while (n) {
+  802981:	48 85 d2             	test   %rdx,%rdx
+  802984:	0f 84 fb 00 00 00    	je     802a85 <devfile_read+0x130>
+    size_t i = 0;
+  80298a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802991:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802992:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802999:	00 00 00 
+  80299c:	eb 5f                	jmp    8029fd <devfile_read+0xa8>
+                return ret ? ret : i;
+  80299e:	48 98                	cltq
+  8029a0:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8029a5:	e9 e3 00 00 00       	jmp    802a8d <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029aa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029ae:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8029b1:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8029b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ba:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029bf:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+  8029cb:	89 c3                	mov    %eax,%ebx
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	0f 8e a7 00 00 00    	jle    802a7c <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8029d5:	48 63 d0             	movslq %eax,%rdx
+  8029d8:	4c 89 f6             	mov    %r14,%rsi
+  8029db:	4c 89 ef             	mov    %r13,%rdi
+  8029de:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  8029e5:	00 00 00 
+  8029e8:	ff d0                	call   *%rax
+        buf += ret;
+  8029ea:	48 63 db             	movslq %ebx,%rbx
+  8029ed:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8029f0:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8029f4:	49 29 dc             	sub    %rbx,%r12
+  8029f7:	0f 84 8c 00 00 00    	je     802a89 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  8029fd:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802a04:	76 a4                	jbe    8029aa <devfile_read+0x55>
+  802a06:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+  802a12:	48 89 c1             	mov    %rax,%rcx
+  802a15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a19:	48 85 c0             	test   %rax,%rax
+  802a1c:	74 8c                	je     8029aa <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802a1e:	be 00 00 04 00       	mov    $0x40000,%esi
+  802a23:	49 39 f4             	cmp    %rsi,%r12
+  802a26:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802a2a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a2e:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802a30:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802a34:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802a3b:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802a3f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a44:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  802a4b:	00 00 00 
+  802a4e:	ff d0                	call   *%rax
+  802a50:	89 c3                	mov    %eax,%ebx
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	0f 8e 44 ff ff ff    	jle    80299e <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802a5a:	48 63 d0             	movslq %eax,%rdx
+  802a5d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a61:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802a68:	4c 89 ef             	mov    %r13,%rdi
+  802a6b:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802a77:	e9 6e ff ff ff       	jmp    8029ea <devfile_read+0x95>
+                return ret ? ret : i;
+  802a7c:	48 98                	cltq
+  802a7e:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802a83:	eb 08                	jmp    802a8d <devfile_read+0x138>
+    size_t i = 0;
+  802a85:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802a89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802a8d:	48 83 c4 18          	add    $0x18,%rsp
+  802a91:	5b                   	pop    %rbx
+  802a92:	41 5c                	pop    %r12
+  802a94:	41 5d                	pop    %r13
+  802a96:	41 5e                	pop    %r14
+  802a98:	41 5f                	pop    %r15
+  802a9a:	5d                   	pop    %rbp
+  802a9b:	c3                   	ret
+        return -E_INVAL;
+  802a9c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802aa3:	eb e8                	jmp    802a8d <devfile_read+0x138>
+  802aa5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802aac:	c3                   	ret
+
+0000000000802aad <open>:
+open(const char *path, int mode) {
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	41 55                	push   %r13
+  802ab3:	41 54                	push   %r12
+  802ab5:	53                   	push   %rbx
+  802ab6:	48 83 ec 18          	sub    $0x18,%rsp
+  802aba:	49 89 fc             	mov    %rdi,%r12
+  802abd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ac0:	48 b8 8a 10 80 00 00 	movabs $0x80108a,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+  802acc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ad2:	0f 87 8a 00 00 00    	ja     802b62 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ad8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802adc:	48 b8 e5 1d 80 00 00 	movabs $0x801de5,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  802ae8:	89 c3                	mov    %eax,%ebx
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	78 50                	js     802b3e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802aee:	4c 89 e6             	mov    %r12,%rsi
+  802af1:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802af8:	00 00 00 
+  802afb:	48 89 df             	mov    %rbx,%rdi
+  802afe:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b0a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b11:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b15:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b1a:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+  802b26:	89 c3                	mov    %eax,%ebx
+  802b28:	85 c0                	test   %eax,%eax
+  802b2a:	78 1f                	js     802b4b <open+0x9e>
+    return fd2num(fd);
+  802b2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b30:	48 b8 b5 1d 80 00 00 	movabs $0x801db5,%rax
+  802b37:	00 00 00 
+  802b3a:	ff d0                	call   *%rax
+  802b3c:	89 c3                	mov    %eax,%ebx
+}
+  802b3e:	89 d8                	mov    %ebx,%eax
+  802b40:	48 83 c4 18          	add    $0x18,%rsp
+  802b44:	5b                   	pop    %rbx
+  802b45:	41 5c                	pop    %r12
+  802b47:	41 5d                	pop    %r13
+  802b49:	5d                   	pop    %rbp
+  802b4a:	c3                   	ret
+        fd_close(fd, 0);
+  802b4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b50:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b54:	48 b8 03 1f 80 00 00 	movabs $0x801f03,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+        return res;
+  802b60:	eb dc                	jmp    802b3e <open+0x91>
+        return -E_BAD_PATH;
+  802b62:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802b67:	eb d5                	jmp    802b3e <open+0x91>
+
+0000000000802b69 <sync>:
+sync(void) {
+  802b69:	55                   	push   %rbp
+  802b6a:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802b6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b72:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b77:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802b7e:	00 00 00 
+  802b81:	ff d0                	call   *%rax
+}
+  802b83:	5d                   	pop    %rbp
+  802b84:	c3                   	ret
+
+0000000000802b85 <drop_cache>:
+drop_cache(int fdnum) {
+  802b85:	55                   	push   %rbp
+  802b86:	48 89 e5             	mov    %rsp,%rbp
+  802b89:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b8d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b91:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 51                	js     802bf2 <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ba1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ba5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802bac:	00 00 00 
+  802baf:	8b 0a                	mov    (%rdx),%ecx
+  802bb1:	39 08                	cmp    %ecx,(%rax)
+  802bb3:	75 3f                	jne    802bf4 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802bb5:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802bbc:	00 
+  802bbd:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802bc4:	00 
+  802bc5:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802bcc:	00 
+  802bcd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802bd4:	00 
+  802bd5:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802bd9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802bdd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802be1:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802be6:	48 b8 47 25 80 00 00 	movabs $0x802547,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+}
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802bf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf9:	eb f7                	jmp    802bf2 <drop_cache+0x6d>
+
+0000000000802bfb <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	41 57                	push   %r15
+  802c01:	41 56                	push   %r14
+  802c03:	41 55                	push   %r13
+  802c05:	41 54                	push   %r12
+  802c07:	53                   	push   %rbx
+  802c08:	48 83 ec 58          	sub    $0x58,%rsp
+  802c0c:	41 89 f4             	mov    %esi,%r12d
+  802c0f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c13:	49 89 cd             	mov    %rcx,%r13
+  802c16:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c19:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802c1d:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802c24:	00 00 00 
+  802c27:	ff d0                	call   *%rax
+  802c29:	48 63 d0             	movslq %eax,%rdx
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	0f 88 36 01 00 00    	js     802d6a <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c34:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c38:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c3f:	00 00 00 
+  802c42:	8b 32                	mov    (%rdx),%esi
+  802c44:	39 31                	cmp    %esi,(%rcx)
+  802c46:	0f 85 30 01 00 00    	jne    802d7c <read_map+0x181>
+  802c4c:	45 85 e4             	test   %r12d,%r12d
+  802c4f:	0f 88 27 01 00 00    	js     802d7c <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c55:	49 63 cc             	movslq %r12d,%rcx
+  802c58:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802c5c:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c63:	0f 85 1c 01 00 00    	jne    802d85 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c69:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802c6d:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802c74:	0f 85 14 01 00 00    	jne    802d8e <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802c7a:	48 63 cb             	movslq %ebx,%rcx
+  802c7d:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c81:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802c88:	00 00 00 
+    while (i < n) {
+  802c8b:	4d 85 ed             	test   %r13,%r13
+  802c8e:	75 5c                	jne    802cec <read_map+0xf1>
+  802c90:	e9 d2 00 00 00       	jmp    802d67 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802c95:	41 8b 3e             	mov    (%r14),%edi
+  802c98:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802c9c:	50                   	push   %rax
+  802c9d:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802ca1:	50                   	push   %rax
+  802ca2:	4d 89 f9             	mov    %r15,%r9
+  802ca5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cab:	48 89 d9             	mov    %rbx,%rcx
+  802cae:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cb3:	be 09 00 00 00       	mov    $0x9,%esi
+  802cb8:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  802cbf:	00 00 00 
+  802cc2:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802cc4:	48 83 c4 10          	add    $0x10,%rsp
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	0f 8e 8f 00 00 00    	jle    802d5f <read_map+0x164>
+        if (!mapped_perm) {
+  802cd0:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802cd4:	0f 84 80 00 00 00    	je     802d5a <read_map+0x15f>
+        i += res;
+  802cda:	48 63 d0             	movslq %eax,%rdx
+  802cdd:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802ce0:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802ce5:	75 78                	jne    802d5f <read_map+0x164>
+    while (i < n) {
+  802ce7:	4d 39 ec             	cmp    %r13,%r12
+  802cea:	73 73                	jae    802d5f <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802cec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cf0:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802cf4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802cf8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802cfc:	4c 01 e0             	add    %r12,%rax
+  802cff:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802d03:	4c 89 eb             	mov    %r13,%rbx
+  802d06:	4c 29 e3             	sub    %r12,%rbx
+  802d09:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802d0d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802d11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802d15:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802d1c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802d23:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802d28:	48 39 c3             	cmp    %rax,%rbx
+  802d2b:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802d2f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802d33:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d37:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802d3b:	0f 85 54 ff ff ff    	jne    802c95 <read_map+0x9a>
+  802d41:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d46:	48 b8 4e 43 80 00 00 	movabs $0x80434e,%rax
+  802d4d:	00 00 00 
+  802d50:	ff d0                	call   *%rax
+  802d52:	41 89 06             	mov    %eax,(%r14)
+  802d55:	e9 3b ff ff ff       	jmp    802c95 <read_map+0x9a>
+            res = -E_INVAL;
+  802d5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802d5f:	4c 89 e2             	mov    %r12,%rdx
+  802d62:	4d 85 e4             	test   %r12,%r12
+  802d65:	75 03                	jne    802d6a <read_map+0x16f>
+  802d67:	48 63 d0             	movslq %eax,%rdx
+}
+  802d6a:	48 89 d0             	mov    %rdx,%rax
+  802d6d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d71:	5b                   	pop    %rbx
+  802d72:	41 5c                	pop    %r12
+  802d74:	41 5d                	pop    %r13
+  802d76:	41 5e                	pop    %r14
+  802d78:	41 5f                	pop    %r15
+  802d7a:	5d                   	pop    %rbp
+  802d7b:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d7c:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d83:	eb e5                	jmp    802d6a <read_map+0x16f>
+  802d85:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d8c:	eb dc                	jmp    802d6a <read_map+0x16f>
+  802d8e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802d95:	eb d3                	jmp    802d6a <read_map+0x16f>
+
+0000000000802d97 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802d97:	55                   	push   %rbp
+  802d98:	48 89 e5             	mov    %rsp,%rbp
+  802d9b:	41 57                	push   %r15
+  802d9d:	41 56                	push   %r14
+  802d9f:	41 55                	push   %r13
+  802da1:	41 54                	push   %r12
+  802da3:	53                   	push   %rbx
+  802da4:	48 83 ec 38          	sub    $0x38,%rsp
+  802da8:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802dab:	41 89 f6             	mov    %esi,%r14d
+  802dae:	49 89 d5             	mov    %rdx,%r13
+  802db1:	89 cb                	mov    %ecx,%ebx
+  802db3:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802db6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802dba:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  802dc1:	00 00 00 
+  802dc4:	ff d0                	call   *%rax
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	0f 88 33 02 00 00    	js     803001 <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802dce:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802dd3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802dd7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802dde:	00 00 00 
+  802de1:	8b 3a                	mov    (%rdx),%edi
+  802de3:	39 39                	cmp    %edi,(%rcx)
+  802de5:	0f 85 1b 02 00 00    	jne    803006 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802deb:	4d 85 ed             	test   %r13,%r13
+  802dee:	41 0f 94 c0          	sete   %r8b
+  802df2:	44 89 f0             	mov    %r14d,%eax
+  802df5:	c1 e8 1f             	shr    $0x1f,%eax
+  802df8:	41 08 c0             	or     %al,%r8b
+  802dfb:	0f 85 14 02 00 00    	jne    803015 <mmap+0x27e>
+  802e01:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802e08:	0f 85 0e 02 00 00    	jne    80301c <mmap+0x285>
+  802e0e:	83 fb 07             	cmp    $0x7,%ebx
+  802e11:	0f 87 0c 02 00 00    	ja     803023 <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802e17:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802e21:	83 fa 01             	cmp    $0x1,%edx
+  802e24:	0f 87 dc 01 00 00    	ja     803006 <mmap+0x26f>
+  802e2a:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802e31:	00 00 00 
+  802e34:	eb 0e                	jmp    802e44 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e36:	48 83 c0 01          	add    $0x1,%rax
+  802e3a:	48 83 c2 20          	add    $0x20,%rdx
+  802e3e:	48 83 f8 40          	cmp    $0x40,%rax
+  802e42:	74 44                	je     802e88 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802e44:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802e48:	75 ec                	jne    802e36 <mmap+0x9f>
+  802e4a:	48 c1 e0 05          	shl    $0x5,%rax
+  802e4e:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802e55:	00 00 00 
+  802e58:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802e5c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802e63:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e6a:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802e6d:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802e74:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e77:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802e7c:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802e83:	00 00 00 
+  802e86:	eb 17                	jmp    802e9f <mmap+0x108>
+  802e88:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802e8d:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802e93:	eb c7                	jmp    802e5c <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802e95:	48 83 c0 01          	add    $0x1,%rax
+  802e99:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802e9d:	77 37                	ja     802ed6 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802e9f:	48 89 c2             	mov    %rax,%rdx
+  802ea2:	48 c1 e2 05          	shl    $0x5,%rdx
+  802ea6:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802eab:	48 85 d2             	test   %rdx,%rdx
+  802eae:	74 e5                	je     802e95 <mmap+0xfe>
+  802eb0:	48 89 c7             	mov    %rax,%rdi
+  802eb3:	48 c1 e7 05          	shl    $0x5,%rdi
+  802eb7:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802ebb:	48 01 fa             	add    %rdi,%rdx
+  802ebe:	48 39 d6             	cmp    %rdx,%rsi
+  802ec1:	73 d2                	jae    802e95 <mmap+0xfe>
+  802ec3:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802ec7:	4c 39 d7             	cmp    %r10,%rdi
+  802eca:	73 c9                	jae    802e95 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802ecc:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed4:	eb c9                	jmp    802e9f <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802ed6:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802edf:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802ee6:	00 00 00 
+  802ee9:	49 39 f9             	cmp    %rdi,%r9
+  802eec:	0f 82 14 01 00 00    	jb     803006 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802ef2:	48 85 f6             	test   %rsi,%rsi
+  802ef5:	0f 84 2f 01 00 00    	je     80302a <mmap+0x293>
+  802efb:	45 84 c0             	test   %r8b,%r8b
+  802efe:	0f 85 26 01 00 00    	jne    80302a <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802f04:	41 83 fc 01          	cmp    $0x1,%r12d
+  802f08:	0f 94 c0             	sete   %al
+  802f0b:	0f b6 c0             	movzbl %al,%eax
+  802f0e:	c1 e0 06             	shl    $0x6,%eax
+  802f11:	09 d8                	or     %ebx,%eax
+  802f13:	89 c3                	mov    %eax,%ebx
+  802f15:	83 cb 04             	or     $0x4,%ebx
+  802f18:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802f1b:	4d 85 ff             	test   %r15,%r15
+  802f1e:	0f 84 bd 00 00 00    	je     802fe1 <mmap+0x24a>
+  802f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f29:	83 e0 bf             	and    $0xffffffbf,%eax
+  802f2c:	83 c8 04             	or     $0x4,%eax
+  802f2f:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802f32:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802f36:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802f3a:	49 89 f6             	mov    %rsi,%r14
+  802f3d:	eb 43                	jmp    802f82 <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802f3f:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802f45:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f4b:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802f4e:	eb 2d                	jmp    802f7d <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802f50:	48 85 c0             	test   %rax,%rax
+  802f53:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f58:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802f5c:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802f5f:	4c 89 e2             	mov    %r12,%rdx
+  802f62:	4c 89 ee             	mov    %r13,%rsi
+  802f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6a:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  802f71:	00 00 00 
+  802f74:	ff d0                	call   *%rax
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	78 3e                	js     802fb8 <mmap+0x221>
+        i += n;
+  802f7a:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802f7d:	4c 39 fb             	cmp    %r15,%rbx
+  802f80:	73 54                	jae    802fd6 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802f82:	4d 89 fc             	mov    %r15,%r12
+  802f85:	49 29 dc             	sub    %rbx,%r12
+  802f88:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802f8c:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802f8f:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802f92:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802f96:	4c 89 e1             	mov    %r12,%rcx
+  802f99:	4c 89 ea             	mov    %r13,%rdx
+  802f9c:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802f9f:	48 b8 fb 2b 80 00 00 	movabs $0x802bfb,%rax
+  802fa6:	00 00 00 
+  802fa9:	ff d0                	call   *%rax
+        if (res > 0) {
+  802fab:	48 85 c0             	test   %rax,%rax
+  802fae:	7f 8f                	jg     802f3f <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802fb0:	74 9e                	je     802f50 <mmap+0x1b9>
+  802fb2:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802fb6:	74 98                	je     802f50 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802fb8:	4c 89 f6             	mov    %r14,%rsi
+  802fbb:	4c 89 fa             	mov    %r15,%rdx
+  802fbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc3:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  802fca:	00 00 00 
+  802fcd:	ff d0                	call   *%rax
+    return NULL;
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd4:	eb 30                	jmp    803006 <mmap+0x26f>
+  802fd6:	4c 89 f6             	mov    %r14,%rsi
+  802fd9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802fdd:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802fe1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fe5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fe8:	48 89 31             	mov    %rsi,(%rcx)
+  802feb:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802fef:	89 41 10             	mov    %eax,0x10(%rcx)
+  802ff2:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802ff6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ff9:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802ffc:	48 89 f0             	mov    %rsi,%rax
+  802fff:	eb 05                	jmp    803006 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803001:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803006:	48 83 c4 38          	add    $0x38,%rsp
+  80300a:	5b                   	pop    %rbx
+  80300b:	41 5c                	pop    %r12
+  80300d:	41 5d                	pop    %r13
+  80300f:	41 5e                	pop    %r14
+  803011:	41 5f                	pop    %r15
+  803013:	5d                   	pop    %rbp
+  803014:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	eb ea                	jmp    803006 <mmap+0x26f>
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803021:	eb e3                	jmp    803006 <mmap+0x26f>
+  803023:	b8 00 00 00 00       	mov    $0x0,%eax
+  803028:	eb dc                	jmp    803006 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	eb d5                	jmp    803006 <mmap+0x26f>
+
+0000000000803031 <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  803031:	55                   	push   %rbp
+  803032:	48 89 e5             	mov    %rsp,%rbp
+  803035:	41 57                	push   %r15
+  803037:	41 56                	push   %r14
+  803039:	41 55                	push   %r13
+  80303b:	41 54                	push   %r12
+  80303d:	53                   	push   %rbx
+  80303e:	48 83 ec 38          	sub    $0x38,%rsp
+  803042:	49 89 fc             	mov    %rdi,%r12
+  803045:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803048:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  803054:	48 85 c0             	test   %rax,%rax
+  803057:	0f 84 2f 01 00 00    	je     80318c <msync+0x15b>
+  80305d:	49 89 c7             	mov    %rax,%r15
+  803060:	4d 01 e5             	add    %r12,%r13
+  803063:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803067:	49 03 07             	add    (%r15),%rax
+  80306a:	4c 39 e8             	cmp    %r13,%rax
+  80306d:	0f 82 20 01 00 00    	jb     803193 <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  803073:	41 8b 47 18          	mov    0x18(%r15),%eax
+  803077:	83 e0 40             	and    $0x40,%eax
+  80307a:	0f 84 fd 00 00 00    	je     80317d <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  803080:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  803087:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80308e:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  803095:	4d 39 ec             	cmp    %r13,%r12
+  803098:	0f 83 fc 00 00 00    	jae    80319a <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  80309e:	49 be c9 3a 80 00 00 	movabs $0x803ac9,%r14
+  8030a5:	00 00 00 
+  8030a8:	e9 b0 00 00 00       	jmp    80315d <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8030ad:	4c 89 e3             	mov    %r12,%rbx
+  8030b0:	4d 39 ec             	cmp    %r13,%r12
+  8030b3:	73 16                	jae    8030cb <msync+0x9a>
+  8030b5:	48 89 df             	mov    %rbx,%rdi
+  8030b8:	41 ff d6             	call   *%r14
+  8030bb:	84 c0                	test   %al,%al
+  8030bd:	74 0c                	je     8030cb <msync+0x9a>
+  8030bf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8030c6:	4c 39 eb             	cmp    %r13,%rbx
+  8030c9:	72 ea                	jb     8030b5 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8030cb:	48 89 d8             	mov    %rbx,%rax
+  8030ce:	4c 29 e0             	sub    %r12,%rax
+  8030d1:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8030d5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8030d9:	49 89 c0             	mov    %rax,%r8
+  8030dc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8030e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e5:	48 89 ce             	mov    %rcx,%rsi
+  8030e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ed:	49 ba df 16 80 00 00 	movabs $0x8016df,%r10
+  8030f4:	00 00 00 
+  8030f7:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	78 7f                	js     80317d <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  8030fe:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803105:	00 
+  803106:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80310d:	00 
+  80310e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803115:	00 
+  803116:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80311d:	00 
+  80311e:	49 63 47 10          	movslq 0x10(%r15),%rax
+  803122:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803126:	49 63 47 14          	movslq 0x14(%r15),%rax
+  80312a:	49 2b 07             	sub    (%r15),%rax
+  80312d:	4c 01 e0             	add    %r12,%rax
+  803130:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803134:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803138:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  80313c:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  803140:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803145:	48 b8 47 25 80 00 00 	movabs $0x802547,%rax
+  80314c:	00 00 00 
+  80314f:	ff d0                	call   *%rax
+  803151:	85 c0                	test   %eax,%eax
+  803153:	78 28                	js     80317d <msync+0x14c>
+  803155:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803158:	4d 39 ec             	cmp    %r13,%r12
+  80315b:	73 1b                	jae    803178 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  80315d:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  803161:	4c 89 e7             	mov    %r12,%rdi
+  803164:	41 ff d6             	call   *%r14
+  803167:	84 c0                	test   %al,%al
+  803169:	0f 85 3e ff ff ff    	jne    8030ad <msync+0x7c>
+            va += PAGE_SIZE;
+  80316f:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  803176:	eb e0                	jmp    803158 <msync+0x127>
+    }
+
+    return 0;
+  803178:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80317d:	48 83 c4 38          	add    $0x38,%rsp
+  803181:	5b                   	pop    %rbx
+  803182:	41 5c                	pop    %r12
+  803184:	41 5d                	pop    %r13
+  803186:	41 5e                	pop    %r14
+  803188:	41 5f                	pop    %r15
+  80318a:	5d                   	pop    %rbp
+  80318b:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80318c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803191:	eb ea                	jmp    80317d <msync+0x14c>
+  803193:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803198:	eb e3                	jmp    80317d <msync+0x14c>
+    return 0;
+  80319a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319f:	eb dc                	jmp    80317d <msync+0x14c>
+
+00000000008031a1 <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8031a1:	55                   	push   %rbp
+  8031a2:	48 89 e5             	mov    %rsp,%rbp
+  8031a5:	41 55                	push   %r13
+  8031a7:	41 54                	push   %r12
+  8031a9:	53                   	push   %rbx
+  8031aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ae:	49 89 fc             	mov    %rdi,%r12
+  8031b1:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8031b4:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8031c0:	48 85 c0             	test   %rax,%rax
+  8031c3:	74 58                	je     80321d <munmap+0x7c>
+  8031c5:	48 89 c3             	mov    %rax,%rbx
+  8031c8:	4c 3b 20             	cmp    (%rax),%r12
+  8031cb:	75 57                	jne    803224 <munmap+0x83>
+  8031cd:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8031d4:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031da:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  8031de:	75 4b                	jne    80322b <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  8031e0:	4c 89 ee             	mov    %r13,%rsi
+  8031e3:	4c 89 e7             	mov    %r12,%rdi
+  8031e6:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  8031f2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8031f6:	4c 89 e6             	mov    %r12,%rsi
+  8031f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031fe:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  803205:	00 00 00 
+  803208:	ff d0                	call   *%rax
+    m->m_size = 0;
+  80320a:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  803211:	00 
+    return res;
+}
+  803212:	48 83 c4 08          	add    $0x8,%rsp
+  803216:	5b                   	pop    %rbx
+  803217:	41 5c                	pop    %r12
+  803219:	41 5d                	pop    %r13
+  80321b:	5d                   	pop    %rbp
+  80321c:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  80321d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803222:	eb ee                	jmp    803212 <munmap+0x71>
+  803224:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803229:	eb e7                	jmp    803212 <munmap+0x71>
+  80322b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803230:	eb e0                	jmp    803212 <munmap+0x71>
+
+0000000000803232 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	41 54                	push   %r12
+  803238:	53                   	push   %rbx
+  803239:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80323c:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  803243:	00 00 00 
+  803246:	ff d0                	call   *%rax
+  803248:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80324b:	48 be c0 57 80 00 00 	movabs $0x8057c0,%rsi
+  803252:	00 00 00 
+  803255:	48 89 df             	mov    %rbx,%rdi
+  803258:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  80325f:	00 00 00 
+  803262:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803264:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803269:	41 8b 14 24          	mov    (%r12),%edx
+  80326d:	29 d0                	sub    %edx,%eax
+  80326f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803275:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80327c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80327f:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803286:	00 00 00 
+  803289:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803290:	b8 00 00 00 00       	mov    $0x0,%eax
+  803295:	5b                   	pop    %rbx
+  803296:	41 5c                	pop    %r12
+  803298:	5d                   	pop    %rbp
+  803299:	c3                   	ret
+
+000000000080329a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80329a:	55                   	push   %rbp
+  80329b:	48 89 e5             	mov    %rsp,%rbp
+  80329e:	41 55                	push   %r13
+  8032a0:	41 54                	push   %r12
+  8032a2:	53                   	push   %rbx
+  8032a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8032a7:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032aa:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+  8032b6:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032be:	4c 89 e6             	mov    %r12,%rsi
+  8032c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c6:	49 bc ac 17 80 00 00 	movabs $0x8017ac,%r12
+  8032cd:	00 00 00 
+  8032d0:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8032d3:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  8032d9:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8032e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e5:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  8032e8:	be 00 04 00 00       	mov    $0x400,%esi
+  8032ed:	48 89 df             	mov    %rbx,%rdi
+  8032f0:	49 bd 26 1d 80 00 00 	movabs $0x801d26,%r13
+  8032f7:	00 00 00 
+  8032fa:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  8032fd:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  803301:	be 00 04 00 00       	mov    $0x400,%esi
+  803306:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803309:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80330e:	48 89 de             	mov    %rbx,%rsi
+  803311:	bf 00 00 00 00       	mov    $0x0,%edi
+  803316:	41 ff d4             	call   *%r12
+}
+  803319:	48 83 c4 08          	add    $0x8,%rsp
+  80331d:	5b                   	pop    %rbx
+  80331e:	41 5c                	pop    %r12
+  803320:	41 5d                	pop    %r13
+  803322:	5d                   	pop    %rbp
+  803323:	c3                   	ret
+
+0000000000803324 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803324:	55                   	push   %rbp
+  803325:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803328:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  80332e:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803335:	be 00 10 00 00       	mov    $0x1000,%esi
+  80333a:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  803341:	00 00 00 
+  803344:	ff d0                	call   *%rax
+  803346:	85 c0                	test   %eax,%eax
+  803348:	0f 94 c0             	sete   %al
+  80334b:	0f b6 c0             	movzbl %al,%eax
+}
+  80334e:	5d                   	pop    %rbp
+  80334f:	c3                   	ret
+
+0000000000803350 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  803350:	b8 01 00 00 00       	mov    $0x1,%eax
+  803355:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803357:	8b 07                	mov    (%rdi),%eax
+  803359:	39 f0                	cmp    %esi,%eax
+  80335b:	74 01                	je     80335e <pipe_wait+0xe>
+  80335d:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  80335e:	55                   	push   %rbp
+  80335f:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  803362:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803364:	48 c1 e2 20          	shl    $0x20,%rdx
+  803368:	89 c0                	mov    %eax,%eax
+  80336a:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  80336d:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803374:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80337b:	00 00 00 
+  80337e:	ff d0                	call   *%rax
+}
+  803380:	5d                   	pop    %rbp
+  803381:	c3                   	ret
+
+0000000000803382 <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  803382:	b8 00 00 00 00       	mov    $0x0,%eax
+  803387:	87 06                	xchg   %eax,(%rsi)
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	75 01                	jne    80338e <pipe_wake+0xc>
+  80338d:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80338e:	55                   	push   %rbp
+  80338f:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  803392:	be 00 04 00 00       	mov    $0x400,%esi
+  803397:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  80339e:	00 00 00 
+  8033a1:	ff d0                	call   *%rax
+}
+  8033a3:	5d                   	pop    %rbp
+  8033a4:	c3                   	ret
+
+00000000008033a5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8033a5:	55                   	push   %rbp
+  8033a6:	48 89 e5             	mov    %rsp,%rbp
+  8033a9:	41 57                	push   %r15
+  8033ab:	41 56                	push   %r14
+  8033ad:	41 55                	push   %r13
+  8033af:	41 54                	push   %r12
+  8033b1:	53                   	push   %rbx
+  8033b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8033b6:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8033ba:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8033be:	48 89 d3             	mov    %rdx,%rbx
+  8033c1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8033c5:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  8033cc:	00 00 00 
+  8033cf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8033d1:	48 85 db             	test   %rbx,%rbx
+  8033d4:	0f 84 0f 01 00 00    	je     8034e9 <devpipe_write+0x144>
+  8033da:	49 89 c4             	mov    %rax,%r12
+  8033dd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  8033e3:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8033ea:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8033ee:	eb 4f                	jmp    80343f <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  8033f0:	4c 89 e6             	mov    %r12,%rsi
+  8033f3:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8033f7:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  8033fe:	00 00 00 
+  803401:	ff d0                	call   *%rax
+  803403:	85 c0                	test   %eax,%eax
+  803405:	74 14                	je     80341b <devpipe_write+0x76>
+  803407:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80340c:	48 83 c4 28          	add    $0x28,%rsp
+  803410:	5b                   	pop    %rbx
+  803411:	41 5c                	pop    %r12
+  803413:	41 5d                	pop    %r13
+  803415:	41 5e                	pop    %r14
+  803417:	41 5f                	pop    %r15
+  803419:	5d                   	pop    %rbp
+  80341a:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  80341b:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  803420:	44 89 ee             	mov    %r13d,%esi
+  803423:	4c 89 e7             	mov    %r12,%rdi
+  803426:	48 b8 50 33 80 00 00 	movabs $0x803350,%rax
+  80342d:	00 00 00 
+  803430:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  803432:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803436:	49 39 c7             	cmp    %rax,%r15
+  803439:	0f 83 aa 00 00 00    	jae    8034e9 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  80343f:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  803444:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803448:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  80344f:	00 
+  803450:	44 89 f0             	mov    %r14d,%eax
+  803453:	44 29 e8             	sub    %r13d,%eax
+  803456:	39 d8                	cmp    %ebx,%eax
+  803458:	74 96                	je     8033f0 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  80345a:	89 d8                	mov    %ebx,%eax
+  80345c:	44 29 f0             	sub    %r14d,%eax
+  80345f:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  803463:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803467:	4c 29 f8             	sub    %r15,%rax
+  80346a:	49 39 c5             	cmp    %rax,%r13
+  80346d:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  803471:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803474:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803477:	89 db                	mov    %ebx,%ebx
+  803479:	48 29 c3             	sub    %rax,%rbx
+  80347c:	4c 39 eb             	cmp    %r13,%rbx
+  80347f:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  803483:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803487:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  80348b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803492:	00 
+  803493:	48 89 da             	mov    %rbx,%rdx
+  803496:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8034a2:	4c 89 ea             	mov    %r13,%rdx
+  8034a5:	48 29 da             	sub    %rbx,%rdx
+  8034a8:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8034ac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8034b0:	48 01 ce             	add    %rcx,%rsi
+  8034b3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8034b7:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8034c3:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8034c8:	45 01 ee             	add    %r13d,%r14d
+  8034cb:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8034d0:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8034d5:	48 b8 82 33 80 00 00 	movabs $0x803382,%rax
+  8034dc:	00 00 00 
+  8034df:	ff d0                	call   *%rax
+        i += chunk;
+  8034e1:	4d 01 ef             	add    %r13,%r15
+  8034e4:	e9 49 ff ff ff       	jmp    803432 <devpipe_write+0x8d>
+    return n;
+  8034e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ed:	e9 1a ff ff ff       	jmp    80340c <devpipe_write+0x67>
+
+00000000008034f2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8034f2:	55                   	push   %rbp
+  8034f3:	48 89 e5             	mov    %rsp,%rbp
+  8034f6:	41 57                	push   %r15
+  8034f8:	41 56                	push   %r14
+  8034fa:	41 55                	push   %r13
+  8034fc:	41 54                	push   %r12
+  8034fe:	53                   	push   %rbx
+  8034ff:	48 83 ec 28          	sub    $0x28,%rsp
+  803503:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803507:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80350b:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80350f:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  803516:	00 00 00 
+  803519:	ff d0                	call   *%rax
+  80351b:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80351e:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803522:	49 bf 24 33 80 00 00 	movabs $0x803324,%r15
+  803529:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80352c:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803530:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803534:	eb 15                	jmp    80354b <devpipe_read+0x59>
+  803536:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80353a:	89 de                	mov    %ebx,%esi
+  80353c:	4c 89 f7             	mov    %r14,%rdi
+  80353f:	48 b8 50 33 80 00 00 	movabs $0x803350,%rax
+  803546:	00 00 00 
+  803549:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  80354b:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  80354f:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803552:	41 39 dd             	cmp    %ebx,%r13d
+  803555:	75 15                	jne    80356c <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803557:	4c 89 e6             	mov    %r12,%rsi
+  80355a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80355e:	41 ff d7             	call   *%r15
+  803561:	85 c0                	test   %eax,%eax
+  803563:	74 d1                	je     803536 <devpipe_read+0x44>
+  803565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356a:	eb 7c                	jmp    8035e8 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  80356c:	44 29 eb             	sub    %r13d,%ebx
+  80356f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803573:	48 39 c3             	cmp    %rax,%rbx
+  803576:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  80357a:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803581:	00 
+  803582:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803586:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803589:	45 89 f6             	mov    %r14d,%r14d
+  80358c:	49 29 c6             	sub    %rax,%r14
+  80358f:	49 39 de             	cmp    %rbx,%r14
+  803592:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803596:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  80359d:	00 
+  80359e:	4c 89 f2             	mov    %r14,%rdx
+  8035a1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8035a5:	49 bf 29 13 80 00 00 	movabs $0x801329,%r15
+  8035ac:	00 00 00 
+  8035af:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8035b2:	48 89 da             	mov    %rbx,%rdx
+  8035b5:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8035b8:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8035bf:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8035c0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8035c4:	4c 01 f7             	add    %r14,%rdi
+  8035c7:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8035ca:	41 01 dd             	add    %ebx,%r13d
+  8035cd:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8035d1:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8035d6:	4c 89 e7             	mov    %r12,%rdi
+  8035d9:	48 b8 82 33 80 00 00 	movabs $0x803382,%rax
+  8035e0:	00 00 00 
+  8035e3:	ff d0                	call   *%rax
+    return n;
+  8035e5:	48 89 d8             	mov    %rbx,%rax
+}
+  8035e8:	48 83 c4 28          	add    $0x28,%rsp
+  8035ec:	5b                   	pop    %rbx
+  8035ed:	41 5c                	pop    %r12
+  8035ef:	41 5d                	pop    %r13
+  8035f1:	41 5e                	pop    %r14
+  8035f3:	41 5f                	pop    %r15
+  8035f5:	5d                   	pop    %rbp
+  8035f6:	c3                   	ret
+
+00000000008035f7 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  8035f7:	55                   	push   %rbp
+  8035f8:	48 89 e5             	mov    %rsp,%rbp
+  8035fb:	41 57                	push   %r15
+  8035fd:	41 56                	push   %r14
+  8035ff:	41 55                	push   %r13
+  803601:	41 54                	push   %r12
+  803603:	53                   	push   %rbx
+  803604:	48 83 ec 18          	sub    $0x18,%rsp
+  803608:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  80360b:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803612:	0f 86 96 01 00 00    	jbe    8037ae <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803618:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  80361d:	48 01 db             	add    %rbx,%rbx
+  803620:	48 39 f3             	cmp    %rsi,%rbx
+  803623:	72 f8                	jb     80361d <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803625:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  80362c:	0f 87 18 02 00 00    	ja     80384a <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803632:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803636:	48 b8 e5 1d 80 00 00 	movabs $0x801de5,%rax
+  80363d:	00 00 00 
+  803640:	ff d0                	call   *%rax
+  803642:	41 89 c4             	mov    %eax,%r12d
+  803645:	85 c0                	test   %eax,%eax
+  803647:	0f 88 b6 01 00 00    	js     803803 <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80364d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803652:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803657:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80365b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803660:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+  80366c:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80366f:	85 c0                	test   %eax,%eax
+  803671:	0f 88 8c 01 00 00    	js     803803 <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803677:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80367b:	48 b8 e5 1d 80 00 00 	movabs $0x801de5,%rax
+  803682:	00 00 00 
+  803685:	ff d0                	call   *%rax
+  803687:	41 89 c4             	mov    %eax,%r12d
+  80368a:	85 c0                	test   %eax,%eax
+  80368c:	0f 88 57 01 00 00    	js     8037e9 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803692:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803697:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80369c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8036a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a5:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8036b4:	85 c0                	test   %eax,%eax
+  8036b6:	0f 88 2d 01 00 00    	js     8037e9 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8036bc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036c0:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8036cf:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8036d6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036db:	4c 89 fa             	mov    %r15,%rdx
+  8036de:	48 89 c6             	mov    %rax,%rsi
+  8036e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e6:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  8036ed:	00 00 00 
+  8036f0:	ff d0                	call   *%rax
+  8036f2:	41 89 c4             	mov    %eax,%r12d
+  8036f5:	85 c0                	test   %eax,%eax
+  8036f7:	0f 88 d2 00 00 00    	js     8037cf <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  8036fd:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803704:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803708:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+  803714:	48 89 c1             	mov    %rax,%rcx
+  803717:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80371d:	4d 89 f8             	mov    %r15,%r8
+  803720:	ba 00 00 00 00       	mov    $0x0,%edx
+  803725:	4c 89 f6             	mov    %r14,%rsi
+  803728:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372d:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  803734:	00 00 00 
+  803737:	ff d0                	call   *%rax
+  803739:	41 89 c4             	mov    %eax,%r12d
+  80373c:	85 c0                	test   %eax,%eax
+  80373e:	78 78                	js     8037b8 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803740:	be 00 10 00 00       	mov    $0x1000,%esi
+  803745:	4c 89 f7             	mov    %r14,%rdi
+  803748:	48 b8 1a 16 80 00 00 	movabs $0x80161a,%rax
+  80374f:	00 00 00 
+  803752:	ff d0                	call   *%rax
+  803754:	83 f8 02             	cmp    $0x2,%eax
+  803757:	0f 85 b8 00 00 00    	jne    803815 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80375d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803764:	00 00 
+  803766:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80376a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80376c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803770:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803777:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80377b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80377d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803781:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803788:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80378c:	48 bb b5 1d 80 00 00 	movabs $0x801db5,%rbx
+  803793:	00 00 00 
+  803796:	ff d3                	call   *%rbx
+  803798:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  80379c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8037a0:	ff d3                	call   *%rbx
+  8037a2:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8037a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8037ac:	eb 55                	jmp    803803 <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8037ae:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8037b3:	e9 7a fe ff ff       	jmp    803632 <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8037b8:	4c 89 fa             	mov    %r15,%rdx
+  8037bb:	4c 89 f6             	mov    %r14,%rsi
+  8037be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c3:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  8037ca:	00 00 00 
+  8037cd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8037cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037d4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037dd:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8037e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ee:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8037f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f7:	48 b8 ac 17 80 00 00 	movabs $0x8017ac,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+}
+  803803:	44 89 e0             	mov    %r12d,%eax
+  803806:	48 83 c4 18          	add    $0x18,%rsp
+  80380a:	5b                   	pop    %rbx
+  80380b:	41 5c                	pop    %r12
+  80380d:	41 5d                	pop    %r13
+  80380f:	41 5e                	pop    %r14
+  803811:	41 5f                	pop    %r15
+  803813:	5d                   	pop    %rbp
+  803814:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803815:	48 b9 f0 57 80 00 00 	movabs $0x8057f0,%rcx
+  80381c:	00 00 00 
+  80381f:	48 ba c7 57 80 00 00 	movabs $0x8057c7,%rdx
+  803826:	00 00 00 
+  803829:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80382e:	48 bf dc 57 80 00 00 	movabs $0x8057dc,%rdi
+  803835:	00 00 00 
+  803838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383d:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  803844:	00 00 00 
+  803847:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80384a:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803850:	eb b1                	jmp    803803 <pipe_sized+0x20c>
+
+0000000000803852 <pipe>:
+pipe(int pfd[2]) {
+  803852:	55                   	push   %rbp
+  803853:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803856:	be 00 00 01 00       	mov    $0x10000,%esi
+  80385b:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+}
+  803867:	5d                   	pop    %rbp
+  803868:	c3                   	ret
+
+0000000000803869 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803871:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803875:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803881:	85 c0                	test   %eax,%eax
+  803883:	78 23                	js     8038a8 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803885:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803889:	48 b8 c7 1d 80 00 00 	movabs $0x801dc7,%rax
+  803890:	00 00 00 
+  803893:	ff d0                	call   *%rax
+  803895:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803898:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80389c:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+}
+  8038a8:	c9                   	leave
+  8038a9:	c3                   	ret
+
+00000000008038aa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8038aa:	48 89 f8             	mov    %rdi,%rax
+  8038ad:	48 c1 e8 27          	shr    $0x27,%rax
+  8038b1:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8038b8:	7f 00 00 
+  8038bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8038bf:	f6 c2 01             	test   $0x1,%dl
+  8038c2:	74 6d                	je     803931 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8038c4:	48 89 f8             	mov    %rdi,%rax
+  8038c7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038cb:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8038d2:	7f 00 00 
+  8038d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8038d9:	f6 c2 01             	test   $0x1,%dl
+  8038dc:	74 62                	je     803940 <get_uvpt_entry+0x96>
+  8038de:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8038e5:	7f 00 00 
+  8038e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8038ec:	f6 c2 80             	test   $0x80,%dl
+  8038ef:	75 4f                	jne    803940 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8038f1:	48 89 f8             	mov    %rdi,%rax
+  8038f4:	48 c1 e8 15          	shr    $0x15,%rax
+  8038f8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8038ff:	7f 00 00 
+  803902:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803906:	f6 c2 01             	test   $0x1,%dl
+  803909:	74 44                	je     80394f <get_uvpt_entry+0xa5>
+  80390b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803912:	7f 00 00 
+  803915:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803919:	f6 c2 80             	test   $0x80,%dl
+  80391c:	75 31                	jne    80394f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80391e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803922:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803929:	7f 00 00 
+  80392c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803930:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803931:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803938:	7f 00 00 
+  80393b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80393f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803940:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803947:	7f 00 00 
+  80394a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80394e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80394f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803956:	7f 00 00 
+  803959:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80395d:	c3                   	ret
+
+000000000080395e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80395e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803961:	48 89 f9             	mov    %rdi,%rcx
+  803964:	48 c1 e9 27          	shr    $0x27,%rcx
+  803968:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80396f:	7f 00 00 
+  803972:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803976:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80397d:	f6 c1 01             	test   $0x1,%cl
+  803980:	0f 84 b2 00 00 00    	je     803a38 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803986:	48 89 f9             	mov    %rdi,%rcx
+  803989:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80398d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803994:	7f 00 00 
+  803997:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80399b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8039a2:	40 f6 c6 01          	test   $0x1,%sil
+  8039a6:	0f 84 8c 00 00 00    	je     803a38 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8039ac:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8039b3:	7f 00 00 
+  8039b6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8039ba:	a8 80                	test   $0x80,%al
+  8039bc:	75 7b                	jne    803a39 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8039be:	48 89 f9             	mov    %rdi,%rcx
+  8039c1:	48 c1 e9 15          	shr    $0x15,%rcx
+  8039c5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8039cc:	7f 00 00 
+  8039cf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8039d3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8039da:	40 f6 c6 01          	test   $0x1,%sil
+  8039de:	74 58                	je     803a38 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8039e0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8039e7:	7f 00 00 
+  8039ea:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8039ee:	a8 80                	test   $0x80,%al
+  8039f0:	75 6c                	jne    803a5e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8039f2:	48 89 f9             	mov    %rdi,%rcx
+  8039f5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8039f9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a00:	7f 00 00 
+  803a03:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803a07:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803a0e:	40 f6 c6 01          	test   $0x1,%sil
+  803a12:	74 24                	je     803a38 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803a14:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a1b:	7f 00 00 
+  803a1e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a22:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803a29:	ff ff 7f 
+  803a2c:	48 21 c8             	and    %rcx,%rax
+  803a2f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803a35:	48 09 d0             	or     %rdx,%rax
+}
+  803a38:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803a39:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803a40:	7f 00 00 
+  803a43:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a47:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803a4e:	ff ff 7f 
+  803a51:	48 21 c8             	and    %rcx,%rax
+  803a54:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803a5a:	48 01 d0             	add    %rdx,%rax
+  803a5d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803a5e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803a65:	7f 00 00 
+  803a68:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803a6c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803a73:	ff ff 7f 
+  803a76:	48 21 c8             	and    %rcx,%rax
+  803a79:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803a7f:	48 01 d0             	add    %rdx,%rax
+  803a82:	c3                   	ret
+
+0000000000803a83 <get_prot>:
+
+int
+get_prot(void *va) {
+  803a83:	55                   	push   %rbp
+  803a84:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803a87:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  803a8e:	00 00 00 
+  803a91:	ff d0                	call   *%rax
+  803a93:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803a96:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803a9b:	89 c1                	mov    %eax,%ecx
+  803a9d:	83 c9 04             	or     $0x4,%ecx
+  803aa0:	f6 c2 01             	test   $0x1,%dl
+  803aa3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803aa6:	89 c1                	mov    %eax,%ecx
+  803aa8:	83 c9 02             	or     $0x2,%ecx
+  803aab:	f6 c2 02             	test   $0x2,%dl
+  803aae:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ab1:	89 c1                	mov    %eax,%ecx
+  803ab3:	83 c9 01             	or     $0x1,%ecx
+  803ab6:	48 85 d2             	test   %rdx,%rdx
+  803ab9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803abc:	89 c1                	mov    %eax,%ecx
+  803abe:	83 c9 40             	or     $0x40,%ecx
+  803ac1:	f6 c6 04             	test   $0x4,%dh
+  803ac4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803ac7:	5d                   	pop    %rbp
+  803ac8:	c3                   	ret
+
+0000000000803ac9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803ac9:	55                   	push   %rbp
+  803aca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803acd:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803ad9:	48 c1 e8 06          	shr    $0x6,%rax
+  803add:	83 e0 01             	and    $0x1,%eax
+}
+  803ae0:	5d                   	pop    %rbp
+  803ae1:	c3                   	ret
+
+0000000000803ae2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ae2:	55                   	push   %rbp
+  803ae3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ae6:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+  803af2:	83 e0 01             	and    $0x1,%eax
+}
+  803af5:	5d                   	pop    %rbp
+  803af6:	c3                   	ret
+
+0000000000803af7 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803af7:	55                   	push   %rbp
+  803af8:	48 89 e5             	mov    %rsp,%rbp
+  803afb:	41 57                	push   %r15
+  803afd:	41 56                	push   %r14
+  803aff:	41 55                	push   %r13
+  803b01:	41 54                	push   %r12
+  803b03:	53                   	push   %rbx
+  803b04:	48 83 ec 18          	sub    $0x18,%rsp
+  803b08:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803b0c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803b10:	48 39 f7             	cmp    %rsi,%rdi
+  803b13:	0f 83 e4 00 00 00    	jae    803bfd <foreach_present_page+0x106>
+  803b19:	49 89 f4             	mov    %rsi,%r12
+  803b1c:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803b1f:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  803b26:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803b29:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803b30:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803b33:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803b3a:	7f 00 00 
+  803b3d:	eb 27                	jmp    803b66 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803b3f:	48 89 d8             	mov    %rbx,%rax
+  803b42:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b46:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803b4a:	f6 c2 01             	test   $0x1,%dl
+  803b4d:	75 43                	jne    803b92 <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803b4f:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  803b56:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803b5d:	4c 39 e3             	cmp    %r12,%rbx
+  803b60:	0f 83 83 00 00 00    	jae    803be9 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803b66:	48 89 d8             	mov    %rbx,%rax
+  803b69:	48 c1 e8 27          	shr    $0x27,%rax
+  803b6d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803b72:	a8 01                	test   $0x1,%al
+  803b74:	75 c9                	jne    803b3f <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803b76:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803b7d:	ff ff ff 
+  803b80:	48 21 d8             	and    %rbx,%rax
+  803b83:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803b8a:	00 00 00 
+  803b8d:	48 01 c3             	add    %rax,%rbx
+  803b90:	eb cb                	jmp    803b5d <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  803b92:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803b96:	a8 80                	test   $0x80,%al
+  803b98:	75 1f                	jne    803bb9 <foreach_present_page+0xc2>
+  803b9a:	48 89 d8             	mov    %rbx,%rax
+  803b9d:	48 c1 e8 15          	shr    $0x15,%rax
+  803ba1:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803ba5:	a8 01                	test   $0x1,%al
+  803ba7:	75 10                	jne    803bb9 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803ba9:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  803bb0:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803bb7:	eb a4                	jmp    803b5d <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803bb9:	48 89 df             	mov    %rbx,%rdi
+  803bbc:	48 b8 aa 38 80 00 00 	movabs $0x8038aa,%rax
+  803bc3:	00 00 00 
+  803bc6:	ff d0                	call   *%rax
+  803bc8:	a8 01                	test   $0x1,%al
+  803bca:	74 11                	je     803bdd <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803bcc:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bd0:	48 89 df             	mov    %rbx,%rdi
+  803bd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bd7:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803bd9:	85 c0                	test   %eax,%eax
+  803bdb:	78 11                	js     803bee <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803bdd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803be4:	e9 74 ff ff ff       	jmp    803b5d <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803be9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bee:	48 83 c4 18          	add    $0x18,%rsp
+  803bf2:	5b                   	pop    %rbx
+  803bf3:	41 5c                	pop    %r12
+  803bf5:	41 5d                	pop    %r13
+  803bf7:	41 5e                	pop    %r14
+  803bf9:	41 5f                	pop    %r15
+  803bfb:	5d                   	pop    %rbp
+  803bfc:	c3                   	ret
+    return 0;
+  803bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c02:	eb ea                	jmp    803bee <foreach_present_page+0xf7>
+
+0000000000803c04 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  803c04:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c0b:	7f 00 00 
+  803c0e:	a8 01                	test   $0x1,%al
+  803c10:	75 06                	jne    803c18 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  803c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c17:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c18:	55                   	push   %rbp
+  803c19:	48 89 e5             	mov    %rsp,%rbp
+  803c1c:	41 57                	push   %r15
+  803c1e:	41 56                	push   %r14
+  803c20:	41 55                	push   %r13
+  803c22:	41 54                	push   %r12
+  803c24:	53                   	push   %rbx
+  803c25:	48 83 ec 28          	sub    $0x28,%rsp
+  803c29:	49 89 fe             	mov    %rdi,%r14
+  803c2c:	49 89 f7             	mov    %rsi,%r15
+  803c2f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803c36:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803c37:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803c3e:	7f 00 00 
+  803c41:	e9 b0 00 00 00       	jmp    803cf6 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803c46:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c4d:	49 83 ec 01          	sub    $0x1,%r12
+  803c51:	74 2d                	je     803c80 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803c53:	48 89 d8             	mov    %rbx,%rax
+  803c56:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c5a:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803c5f:	f6 c2 01             	test   $0x1,%dl
+  803c62:	74 e2                	je     803c46 <foreach_shared_region+0x42>
+  803c64:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803c69:	f6 c4 04             	test   $0x4,%ah
+  803c6c:	74 d8                	je     803c46 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803c6e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c75:	4c 89 fa             	mov    %r15,%rdx
+  803c78:	48 89 df             	mov    %rbx,%rdi
+  803c7b:	41 ff d6             	call   *%r14
+  803c7e:	eb c6                	jmp    803c46 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803c80:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803c87:	00 
+  803c88:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803c8d:	74 4c                	je     803cdb <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803c8f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803c93:	48 89 c8             	mov    %rcx,%rax
+  803c96:	48 c1 e8 15          	shr    $0x15,%rax
+  803c9a:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803ca1:	7f 00 00 
+  803ca4:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803ca8:	a8 01                	test   $0x1,%al
+  803caa:	74 d4                	je     803c80 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803cac:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803cb3:	48 39 c1             	cmp    %rax,%rcx
+  803cb6:	73 c8                	jae    803c80 <foreach_shared_region+0x7c>
+  803cb8:	48 89 cb             	mov    %rcx,%rbx
+  803cbb:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803cc2:	48 39 d0             	cmp    %rdx,%rax
+  803cc5:	4d 19 e4             	sbb    %r12,%r12
+  803cc8:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ccf:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803cd6:	e9 78 ff ff ff       	jmp    803c53 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803cdb:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803ce2:	40 
+  803ce3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ce7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cee:	00 00 00 
+  803cf1:	48 39 c1             	cmp    %rax,%rcx
+  803cf4:	74 4f                	je     803d45 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803cf6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803cfa:	48 89 c8             	mov    %rcx,%rax
+  803cfd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d01:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803d08:	7f 00 00 
+  803d0b:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803d0f:	a8 01                	test   $0x1,%al
+  803d11:	74 c8                	je     803cdb <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803d13:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803d1a:	48 39 c1             	cmp    %rax,%rcx
+  803d1d:	73 bc                	jae    803cdb <foreach_shared_region+0xd7>
+  803d1f:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803d26:	48 39 d0             	cmp    %rdx,%rax
+  803d29:	48 19 c0             	sbb    %rax,%rax
+  803d2c:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803d32:	48 05 00 02 00 00    	add    $0x200,%rax
+  803d38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d3c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803d40:	e9 4a ff ff ff       	jmp    803c8f <foreach_shared_region+0x8b>
+}
+  803d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4a:	48 83 c4 28          	add    $0x28,%rsp
+  803d4e:	5b                   	pop    %rbx
+  803d4f:	41 5c                	pop    %r12
+  803d51:	41 5d                	pop    %r13
+  803d53:	41 5e                	pop    %r14
+  803d55:	41 5f                	pop    %r15
+  803d57:	5d                   	pop    %rbp
+  803d58:	c3                   	ret
+
+0000000000803d59 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5e:	c3                   	ret
+
+0000000000803d5f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d5f:	55                   	push   %rbp
+  803d60:	48 89 e5             	mov    %rsp,%rbp
+  803d63:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d66:	48 be 14 58 80 00 00 	movabs $0x805814,%rsi
+  803d6d:	00 00 00 
+  803d70:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  803d77:	00 00 00 
+  803d7a:	ff d0                	call   *%rax
+    return 0;
+}
+  803d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d81:	5d                   	pop    %rbp
+  803d82:	c3                   	ret
+
+0000000000803d83 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d83:	55                   	push   %rbp
+  803d84:	48 89 e5             	mov    %rsp,%rbp
+  803d87:	41 57                	push   %r15
+  803d89:	41 56                	push   %r14
+  803d8b:	41 55                	push   %r13
+  803d8d:	41 54                	push   %r12
+  803d8f:	53                   	push   %rbx
+  803d90:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d97:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d9e:	48 85 d2             	test   %rdx,%rdx
+  803da1:	74 7a                	je     803e1d <devcons_write+0x9a>
+  803da3:	49 89 d6             	mov    %rdx,%r14
+  803da6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803dac:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803db1:	49 bf c2 12 80 00 00 	movabs $0x8012c2,%r15
+  803db8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803dbb:	4c 89 f3             	mov    %r14,%rbx
+  803dbe:	48 29 f3             	sub    %rsi,%rbx
+  803dc1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803dc6:	48 39 c3             	cmp    %rax,%rbx
+  803dc9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803dcd:	4c 63 eb             	movslq %ebx,%r13
+  803dd0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803dd7:	48 01 c6             	add    %rax,%rsi
+  803dda:	4c 89 ea             	mov    %r13,%rdx
+  803ddd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803de4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803de7:	4c 89 ee             	mov    %r13,%rsi
+  803dea:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803df1:	48 b8 ef 14 80 00 00 	movabs $0x8014ef,%rax
+  803df8:	00 00 00 
+  803dfb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803dfd:	41 01 dc             	add    %ebx,%r12d
+  803e00:	49 63 f4             	movslq %r12d,%rsi
+  803e03:	4c 39 f6             	cmp    %r14,%rsi
+  803e06:	72 b3                	jb     803dbb <devcons_write+0x38>
+    return res;
+  803e08:	49 63 c4             	movslq %r12d,%rax
+}
+  803e0b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803e12:	5b                   	pop    %rbx
+  803e13:	41 5c                	pop    %r12
+  803e15:	41 5d                	pop    %r13
+  803e17:	41 5e                	pop    %r14
+  803e19:	41 5f                	pop    %r15
+  803e1b:	5d                   	pop    %rbp
+  803e1c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803e1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e23:	eb e3                	jmp    803e08 <devcons_write+0x85>
+
+0000000000803e25 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e25:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e2d:	48 85 c0             	test   %rax,%rax
+  803e30:	74 60                	je     803e92 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e32:	55                   	push   %rbp
+  803e33:	48 89 e5             	mov    %rsp,%rbp
+  803e36:	41 55                	push   %r13
+  803e38:	41 54                	push   %r12
+  803e3a:	53                   	push   %rbx
+  803e3b:	48 83 ec 18          	sub    $0x18,%rsp
+  803e3f:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803e42:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803e49:	48 bb 1c 15 80 00 00 	movabs $0x80151c,%rbx
+  803e50:	00 00 00 
+  803e53:	49 bc 9e 43 80 00 00 	movabs $0x80439e,%r12
+  803e5a:	00 00 00 
+  803e5d:	eb 07                	jmp    803e66 <devcons_read+0x41>
+  803e5f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803e63:	41 ff d4             	call   *%r12
+  803e66:	ff d3                	call   *%rbx
+  803e68:	85 c0                	test   %eax,%eax
+  803e6a:	74 f3                	je     803e5f <devcons_read+0x3a>
+    if (c < 0) return c;
+  803e6c:	48 63 d0             	movslq %eax,%rdx
+  803e6f:	78 13                	js     803e84 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803e71:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e76:	83 f8 04             	cmp    $0x4,%eax
+  803e79:	74 09                	je     803e84 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803e7b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e7f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e84:	48 89 d0             	mov    %rdx,%rax
+  803e87:	48 83 c4 18          	add    $0x18,%rsp
+  803e8b:	5b                   	pop    %rbx
+  803e8c:	41 5c                	pop    %r12
+  803e8e:	41 5d                	pop    %r13
+  803e90:	5d                   	pop    %rbp
+  803e91:	c3                   	ret
+  803e92:	48 89 d0             	mov    %rdx,%rax
+  803e95:	c3                   	ret
+
+0000000000803e96 <cputchar>:
+cputchar(int ch) {
+  803e96:	55                   	push   %rbp
+  803e97:	48 89 e5             	mov    %rsp,%rbp
+  803e9a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e9e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ea2:	be 01 00 00 00       	mov    $0x1,%esi
+  803ea7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803eab:	48 b8 ef 14 80 00 00 	movabs $0x8014ef,%rax
+  803eb2:	00 00 00 
+  803eb5:	ff d0                	call   *%rax
+}
+  803eb7:	c9                   	leave
+  803eb8:	c3                   	ret
+
+0000000000803eb9 <getchar>:
+getchar(void) {
+  803eb9:	55                   	push   %rbp
+  803eba:	48 89 e5             	mov    %rsp,%rbp
+  803ebd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803ec1:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ec6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ecf:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+  803edb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	78 06                	js     803ee7 <getchar+0x2e>
+  803ee1:	74 08                	je     803eeb <getchar+0x32>
+  803ee3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803ee7:	89 d0                	mov    %edx,%eax
+  803ee9:	c9                   	leave
+  803eea:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803eeb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803ef0:	eb f5                	jmp    803ee7 <getchar+0x2e>
+
+0000000000803ef2 <iscons>:
+iscons(int fdnum) {
+  803ef2:	55                   	push   %rbp
+  803ef3:	48 89 e5             	mov    %rsp,%rbp
+  803ef6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803efa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803efe:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  803f05:	00 00 00 
+  803f08:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f0a:	85 c0                	test   %eax,%eax
+  803f0c:	78 18                	js     803f26 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803f0e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f12:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803f19:	00 00 00 
+  803f1c:	8b 00                	mov    (%rax),%eax
+  803f1e:	39 02                	cmp    %eax,(%rdx)
+  803f20:	0f 94 c0             	sete   %al
+  803f23:	0f b6 c0             	movzbl %al,%eax
+}
+  803f26:	c9                   	leave
+  803f27:	c3                   	ret
+
+0000000000803f28 <opencons>:
+opencons(void) {
+  803f28:	55                   	push   %rbp
+  803f29:	48 89 e5             	mov    %rsp,%rbp
+  803f2c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f30:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803f34:	48 b8 e5 1d 80 00 00 	movabs $0x801de5,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+  803f40:	85 c0                	test   %eax,%eax
+  803f42:	78 49                	js     803f8d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803f44:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f4e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f57:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+  803f63:	85 c0                	test   %eax,%eax
+  803f65:	78 26                	js     803f8d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f67:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f6b:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f72:	00 00 
+  803f74:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f76:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f7a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f81:	48 b8 b5 1d 80 00 00 	movabs $0x801db5,%rax
+  803f88:	00 00 00 
+  803f8b:	ff d0                	call   *%rax
+}
+  803f8d:	c9                   	leave
+  803f8e:	c3                   	ret
+
+0000000000803f8f <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803f8f:	55                   	push   %rbp
+  803f90:	48 89 e5             	mov    %rsp,%rbp
+  803f93:	41 55                	push   %r13
+  803f95:	41 54                	push   %r12
+  803f97:	53                   	push   %rbx
+  803f98:	48 83 ec 08          	sub    $0x8,%rsp
+  803f9c:	49 89 fc             	mov    %rdi,%r12
+  803f9f:	48 89 f7             	mov    %rsi,%rdi
+  803fa2:	48 89 d3             	mov    %rdx,%rbx
+  803fa5:	49 89 cd             	mov    %rcx,%r13
+  803fa8:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803fab:	48 85 f6             	test   %rsi,%rsi
+  803fae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fb5:	00 00 00 
+  803fb8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc1:	48 85 db             	test   %rbx,%rbx
+  803fc4:	74 03                	je     803fc9 <ipc_recv_timeout+0x3a>
+  803fc6:	48 8b 33             	mov    (%rbx),%rsi
+  803fc9:	48 b8 0d 1c 80 00 00 	movabs $0x801c0d,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+    if (res == 0) {
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	75 72                	jne    80404b <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803fd9:	4d 85 e4             	test   %r12,%r12
+  803fdc:	74 17                	je     803ff5 <ipc_recv_timeout+0x66>
+  803fde:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fe5:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803fe7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803feb:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803ff1:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ff5:	4d 85 ed             	test   %r13,%r13
+  803ff8:	74 17                	je     804011 <ipc_recv_timeout+0x82>
+  803ffa:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804001:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804003:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804007:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80400d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  804011:	48 85 db             	test   %rbx,%rbx
+  804014:	74 17                	je     80402d <ipc_recv_timeout+0x9e>
+  804016:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80401d:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80401f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804023:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  80402a:	48 89 03             	mov    %rax,(%rbx)
+  80402d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804034:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804036:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80403a:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  804040:	48 83 c4 08          	add    $0x8,%rsp
+  804044:	5b                   	pop    %rbx
+  804045:	41 5c                	pop    %r12
+  804047:	41 5d                	pop    %r13
+  804049:	5d                   	pop    %rbp
+  80404a:	c3                   	ret
+        if (from_env_store) {
+  80404b:	4d 85 e4             	test   %r12,%r12
+  80404e:	74 08                	je     804058 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  804050:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804057:	00 
+        if (perm_store) {
+  804058:	4d 85 ed             	test   %r13,%r13
+  80405b:	74 08                	je     804065 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80405d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804064:	00 
+        if (size) {
+  804065:	48 85 db             	test   %rbx,%rbx
+  804068:	74 d6                	je     804040 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  80406a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804071:	eb cd                	jmp    804040 <ipc_recv_timeout+0xb1>
+
+0000000000804073 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804073:	55                   	push   %rbp
+  804074:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  804077:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80407d:	48 b8 8f 3f 80 00 00 	movabs $0x803f8f,%rax
+  804084:	00 00 00 
+  804087:	ff d0                	call   *%rax
+}
+  804089:	5d                   	pop    %rbp
+  80408a:	c3                   	ret
+
+000000000080408b <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80408b:	55                   	push   %rbp
+  80408c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80408f:	48 85 d2             	test   %rdx,%rdx
+  804092:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804099:	00 00 00 
+  80409c:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8040a0:	89 f6                	mov    %esi,%esi
+  8040a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8040a8:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8040b4:	85 c0                	test   %eax,%eax
+  8040b6:	78 02                	js     8040ba <ipc_send+0x2f>
+}
+  8040b8:	5d                   	pop    %rbp
+  8040b9:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8040ba:	89 c1                	mov    %eax,%ecx
+  8040bc:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  8040c3:	00 00 00 
+  8040c6:	be 51 00 00 00       	mov    $0x51,%esi
+  8040cb:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8040d2:	00 00 00 
+  8040d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040da:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  8040e1:	00 00 00 
+  8040e4:	41 ff d0             	call   *%r8
+
+00000000008040e7 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8040e7:	55                   	push   %rbp
+  8040e8:	48 89 e5             	mov    %rsp,%rbp
+  8040eb:	41 54                	push   %r12
+  8040ed:	53                   	push   %rbx
+  8040ee:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8040f2:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8040f6:	48 85 d2             	test   %rdx,%rdx
+  8040f9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804100:	00 00 00 
+  804103:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804107:	4d 85 c9             	test   %r9,%r9
+  80410a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80410e:	89 f6                	mov    %esi,%esi
+  804110:	48 83 ec 08          	sub    $0x8,%rsp
+  804114:	53                   	push   %rbx
+  804115:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  804121:	48 83 c4 10          	add    $0x10,%rsp
+  804125:	85 c0                	test   %eax,%eax
+  804127:	78 65                	js     80418e <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804129:	4d 85 e4             	test   %r12,%r12
+  80412c:	74 17                	je     804145 <ipc_call+0x5e>
+  80412e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804135:	00 00 
+  804137:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80413b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804141:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804145:	48 85 db             	test   %rbx,%rbx
+  804148:	74 28                	je     804172 <ipc_call+0x8b>
+  80414a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804151:	00 00 
+  804153:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804157:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80415e:	ba 20 00 00 00       	mov    $0x20,%edx
+  804163:	48 89 df             	mov    %rbx,%rdi
+  804166:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  80416d:	00 00 00 
+  804170:	ff d0                	call   *%rax
+  804172:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804179:	00 00 
+    return thisenv->env_ipc_value;
+  80417b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80417f:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  804185:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804189:	5b                   	pop    %rbx
+  80418a:	41 5c                	pop    %r12
+  80418c:	5d                   	pop    %rbp
+  80418d:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80418e:	89 c1                	mov    %eax,%ecx
+  804190:	48 ba 41 58 80 00 00 	movabs $0x805841,%rdx
+  804197:	00 00 00 
+  80419a:	be 62 00 00 00       	mov    $0x62,%esi
+  80419f:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8041a6:	00 00 00 
+  8041a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ae:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  8041b5:	00 00 00 
+  8041b8:	41 ff d0             	call   *%r8
+
+00000000008041bb <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8041bb:	55                   	push   %rbp
+  8041bc:	48 89 e5             	mov    %rsp,%rbp
+  8041bf:	41 57                	push   %r15
+  8041c1:	41 56                	push   %r14
+  8041c3:	41 55                	push   %r13
+  8041c5:	41 54                	push   %r12
+  8041c7:	53                   	push   %rbx
+  8041c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8041cc:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  8041cf:	48 89 d3             	mov    %rdx,%rbx
+  8041d2:	49 89 ce             	mov    %rcx,%r14
+  8041d5:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  8041d9:	4d 89 cd             	mov    %r9,%r13
+  8041dc:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  8041e0:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8041e4:	48 85 d2             	test   %rdx,%rdx
+  8041e7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041ee:	00 00 00 
+  8041f1:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8041f5:	4d 85 e4             	test   %r12,%r12
+  8041f8:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  8041fc:	89 f0                	mov    %esi,%eax
+  8041fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804202:	41 57                	push   %r15
+  804204:	4d 89 e1             	mov    %r12,%r9
+  804207:	48 89 da             	mov    %rbx,%rdx
+  80420a:	48 89 c6             	mov    %rax,%rsi
+  80420d:	48 b8 b8 1b 80 00 00 	movabs $0x801bb8,%rax
+  804214:	00 00 00 
+  804217:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804219:	48 83 c4 10          	add    $0x10,%rsp
+  80421d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804220:	0f 84 93 00 00 00    	je     8042b9 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804226:	85 c0                	test   %eax,%eax
+  804228:	0f 88 f3 00 00 00    	js     804321 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80422e:	4d 85 ed             	test   %r13,%r13
+  804231:	74 17                	je     80424a <ipc_reply_wait+0x8f>
+  804233:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80423a:	00 00 
+  80423c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804240:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804246:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80424a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80424f:	74 19                	je     80426a <ipc_reply_wait+0xaf>
+  804251:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804258:	00 00 
+  80425a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80425e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804264:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  804268:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  80426a:	4d 85 ff             	test   %r15,%r15
+  80426d:	74 28                	je     804297 <ipc_reply_wait+0xdc>
+  80426f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804276:	00 00 
+  804278:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80427c:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  804283:	ba 20 00 00 00       	mov    $0x20,%edx
+  804288:	4c 89 ff             	mov    %r15,%rdi
+  80428b:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  804292:	00 00 00 
+  804295:	ff d0                	call   *%rax
+  804297:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80429e:	00 00 
+    return thisenv->env_ipc_value;
+  8042a0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042a4:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8042aa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8042ae:	5b                   	pop    %rbx
+  8042af:	41 5c                	pop    %r12
+  8042b1:	41 5d                	pop    %r13
+  8042b3:	41 5e                	pop    %r14
+  8042b5:	41 5f                	pop    %r15
+  8042b7:	5d                   	pop    %rbp
+  8042b8:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8042b9:	4d 89 f9             	mov    %r15,%r9
+  8042bc:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8042c0:	4c 89 f1             	mov    %r14,%rcx
+  8042c3:	48 89 da             	mov    %rbx,%rdx
+  8042c6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8042ca:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  8042cd:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  8042d4:	00 00 00 
+  8042d7:	ff d0                	call   *%rax
+  8042d9:	85 c0                	test   %eax,%eax
+  8042db:	78 17                	js     8042f4 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  8042dd:	4c 89 f6             	mov    %r14,%rsi
+  8042e0:	4c 89 e7             	mov    %r12,%rdi
+  8042e3:	48 b8 fa 1a 80 00 00 	movabs $0x801afa,%rax
+  8042ea:	00 00 00 
+  8042ed:	ff d0                	call   *%rax
+  8042ef:	e9 32 ff ff ff       	jmp    804226 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  8042f4:	89 c1                	mov    %eax,%ecx
+  8042f6:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  8042fd:	00 00 00 
+  804300:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804305:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  80430c:	00 00 00 
+  80430f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804314:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  80431b:	00 00 00 
+  80431e:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804321:	89 c1                	mov    %eax,%ecx
+  804323:	48 ba 58 58 80 00 00 	movabs $0x805858,%rdx
+  80432a:	00 00 00 
+  80432d:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804332:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  804339:	00 00 00 
+  80433c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804341:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  804348:	00 00 00 
+  80434b:	41 ff d0             	call   *%r8
+
+000000000080434e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80434e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804353:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80435a:	00 00 00 
+  80435d:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  804364:	48 01 ca             	add    %rcx,%rdx
+  804367:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80436d:	39 fa                	cmp    %edi,%edx
+  80436f:	74 12                	je     804383 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804371:	48 83 c0 01          	add    $0x1,%rax
+  804375:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80437b:	75 e0                	jne    80435d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80437d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804382:	c3                   	ret
+            return envs[i].env_id;
+  804383:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80438a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804391:	00 00 00 
+  804394:	48 01 d0             	add    %rdx,%rax
+  804397:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80439d:	c3                   	ret
+
+000000000080439e <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  80439e:	55                   	push   %rbp
+  80439f:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8043a2:	8b 0f                	mov    (%rdi),%ecx
+  8043a4:	8d 41 01             	lea    0x1(%rcx),%eax
+  8043a7:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8043a9:	83 f9 07             	cmp    $0x7,%ecx
+  8043ac:	76 31                	jbe    8043df <backoff+0x41>
+    asm volatile("rdtsc"
+  8043ae:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  8043b0:	83 c1 06             	add    $0x6,%ecx
+  8043b3:	be 15 00 00 00       	mov    $0x15,%esi
+  8043b8:	39 f1                	cmp    %esi,%ecx
+  8043ba:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  8043bd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043c2:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8043c5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8043c9:	89 c0                	mov    %eax,%eax
+  8043cb:	48 09 c2             	or     %rax,%rdx
+  8043ce:	48 01 d7             	add    %rdx,%rdi
+  8043d1:	48 b8 74 1c 80 00 00 	movabs $0x801c74,%rax
+  8043d8:	00 00 00 
+  8043db:	ff d0                	call   *%rax
+}
+  8043dd:	5d                   	pop    %rbp
+  8043de:	c3                   	ret
+        sys_yield();
+  8043df:	48 b8 e9 15 80 00 00 	movabs $0x8015e9,%rax
+  8043e6:	00 00 00 
+  8043e9:	ff d0                	call   *%rax
+        return;
+  8043eb:	eb f0                	jmp    8043dd <backoff+0x3f>
+
+00000000008043ed <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8043ed:	55                   	push   %rbp
+  8043ee:	48 89 e5             	mov    %rsp,%rbp
+  8043f1:	41 55                	push   %r13
+  8043f3:	41 54                	push   %r12
+  8043f5:	53                   	push   %rbx
+  8043f6:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  8043fa:	85 ff                	test   %edi,%edi
+  8043fc:	74 7e                	je     80447c <wait+0x8f>
+  8043fe:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804401:	89 f8                	mov    %edi,%eax
+  804403:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  804408:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  80440f:	89 f9                	mov    %edi,%ecx
+  804411:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804417:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  80441e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804425:	00 00 00 
+  804428:	48 01 ca             	add    %rcx,%rdx
+  80442b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804431:	39 d7                	cmp    %edx,%edi
+  804433:	75 3c                	jne    804471 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804435:	48 98                	cltq
+  804437:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80443e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804445:	00 00 00 
+  804448:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80444b:	49 bd 9e 43 80 00 00 	movabs $0x80439e,%r13
+  804452:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804455:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80445b:	85 c0                	test   %eax,%eax
+  80445d:	74 12                	je     804471 <wait+0x84>
+        backoff(&attempt);
+  80445f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  804463:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804466:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80446c:	44 39 e0             	cmp    %r12d,%eax
+  80446f:	74 e4                	je     804455 <wait+0x68>
+    }
+}
+  804471:	48 83 c4 18          	add    $0x18,%rsp
+  804475:	5b                   	pop    %rbx
+  804476:	41 5c                	pop    %r12
+  804478:	41 5d                	pop    %r13
+  80447a:	5d                   	pop    %rbp
+  80447b:	c3                   	ret
+    assert(envid != 0);
+  80447c:	48 b9 75 58 80 00 00 	movabs $0x805875,%rcx
+  804483:	00 00 00 
+  804486:	48 ba c7 57 80 00 00 	movabs $0x8057c7,%rdx
+  80448d:	00 00 00 
+  804490:	be 22 00 00 00       	mov    $0x22,%esi
+  804495:	48 bf 80 58 80 00 00 	movabs $0x805880,%rdi
+  80449c:	00 00 00 
+  80449f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044a4:	49 b8 53 06 80 00 00 	movabs $0x800653,%r8
+  8044ab:	00 00 00 
+  8044ae:	41 ff d0             	call   *%r8
+
+00000000008044b1 <__text_end>:
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
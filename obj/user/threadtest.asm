@@ -0,0 +1,8291 @@
+
+obj/user/threadtest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 18 05 00 00       	call   80053b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <watch>:
+
+/* Keep reading UTEMP until the main thread replaces its page */
+static void *
+watch(void *arg) {
+    volatile uint32_t *val = (volatile uint32_t *)UTEMP;
+    __atomic_add_fetch(&ready, 1, __ATOMIC_SEQ_CST);
+  800025:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80002c:	00 00 00 
+  80002f:	f0 83 00 01          	lock addl $0x1,(%rax)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800033:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800035:	48 c1 e2 20          	shl    $0x20,%rdx
+  800039:	89 c0                	mov    %eax,%eax
+  80003b:	48 89 d1             	mov    %rdx,%rcx
+  80003e:	48 09 c1             	or     %rax,%rcx
+
+    uint64_t start = read_tsc();
+    while (*val != 2) {
+  800041:	8b 04 25 00 00 40 00 	mov    0x400000,%eax
+  800048:	83 f8 02             	cmp    $0x2,%eax
+  80004b:	74 4d                	je     80009a <watch+0x75>
+    asm volatile("rdtsc"
+  80004d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80004f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800053:	89 c0                	mov    %eax,%eax
+  800055:	48 09 c2             	or     %rax,%rdx
+        if (read_tsc() - start > MAXWAIT) return (void *)0;
+  800058:	48 29 ca             	sub    %rcx,%rdx
+  80005b:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  800062:	00 00 00 
+  800065:	48 39 d0             	cmp    %rdx,%rax
+  800068:	72 36                	jb     8000a0 <watch+0x7b>
+  80006a:	48 89 c6             	mov    %rax,%rsi
+        asm volatile("pause");
+  80006d:	f3 90                	pause
+    while (*val != 2) {
+  80006f:	8b 04 25 00 00 40 00 	mov    0x400000,%eax
+  800076:	83 f8 02             	cmp    $0x2,%eax
+  800079:	74 19                	je     800094 <watch+0x6f>
+    asm volatile("rdtsc"
+  80007b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80007d:	48 c1 e2 20          	shl    $0x20,%rdx
+  800081:	89 c0                	mov    %eax,%eax
+  800083:	48 09 c2             	or     %rax,%rdx
+        if (read_tsc() - start > MAXWAIT) return (void *)0;
+  800086:	48 29 ca             	sub    %rcx,%rdx
+  800089:	48 39 d6             	cmp    %rdx,%rsi
+  80008c:	73 df                	jae    80006d <watch+0x48>
+  80008e:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    return (void *)1;
+}
+  800093:	c3                   	ret
+    return (void *)1;
+  800094:	b8 01 00 00 00       	mov    $0x1,%eax
+  800099:	c3                   	ret
+  80009a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80009f:	c3                   	ret
+        if (read_tsc() - start > MAXWAIT) return (void *)0;
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	c3                   	ret
+
+00000000008000a6 <count>:
+count(void *arg) {
+  8000a6:	55                   	push   %rbp
+  8000a7:	48 89 e5             	mov    %rsp,%rbp
+  8000aa:	41 57                	push   %r15
+  8000ac:	41 56                	push   %r14
+  8000ae:	41 55                	push   %r13
+  8000b0:	41 54                	push   %r12
+  8000b2:	53                   	push   %rbx
+  8000b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8000b7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  8000bb:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8000c2:	00 00 
+    if (thisenv->env_id != sys_getenvid())
+  8000c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8000c8:	8b 98 c8 00 00 00    	mov    0xc8(%rax),%ebx
+  8000ce:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+  8000da:	39 c3                	cmp    %eax,%ebx
+  8000dc:	75 59                	jne    800137 <count+0x91>
+  8000de:	bb 10 27 00 00       	mov    $0x2710,%ebx
+        mutex_lock(&lock);
+  8000e3:	49 bd 08 70 80 00 00 	movabs $0x807008,%r13
+  8000ea:	00 00 00 
+  8000ed:	49 bf ad 1d 80 00 00 	movabs $0x801dad,%r15
+  8000f4:	00 00 00 
+        counter++;
+  8000f7:	49 bc 04 70 80 00 00 	movabs $0x807004,%r12
+  8000fe:	00 00 00 
+        mutex_unlock(&lock);
+  800101:	49 be 2e 1e 80 00 00 	movabs $0x801e2e,%r14
+  800108:	00 00 00 
+        mutex_lock(&lock);
+  80010b:	4c 89 ef             	mov    %r13,%rdi
+  80010e:	41 ff d7             	call   *%r15
+        counter++;
+  800111:	41 83 04 24 01       	addl   $0x1,(%r12)
+        mutex_unlock(&lock);
+  800116:	4c 89 ef             	mov    %r13,%rdi
+  800119:	41 ff d6             	call   *%r14
+    for (int n = 0; n < NITER; n++) {
+  80011c:	83 eb 01             	sub    $0x1,%ebx
+  80011f:	75 ea                	jne    80010b <count+0x65>
+    return (void *)(i * 2);
+  800121:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800125:	48 01 c0             	add    %rax,%rax
+}
+  800128:	48 83 c4 18          	add    $0x18,%rsp
+  80012c:	5b                   	pop    %rbx
+  80012d:	41 5c                	pop    %r12
+  80012f:	41 5d                	pop    %r13
+  800131:	41 5e                	pop    %r14
+  800133:	41 5f                	pop    %r15
+  800135:	5d                   	pop    %rbp
+  800136:	c3                   	ret
+        panic("thread %lu: thisenv is %08x, not %08x", (unsigned long)i, thisenv->env_id, sys_getenvid());
+  800137:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	41 89 c1             	mov    %eax,%r9d
+  800146:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80014d:	00 00 
+  80014f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800153:	44 8b 80 c8 00 00 00 	mov    0xc8(%rax),%r8d
+  80015a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80015e:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800165:	00 00 00 
+  800168:	be 16 00 00 00       	mov    $0x16,%esi
+  80016d:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  800174:	00 00 00 
+  800177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017c:	49 ba 4b 06 80 00 00 	movabs $0x80064b,%r10
+  800183:	00 00 00 
+  800186:	41 ff d2             	call   *%r10
+
+0000000000800189 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800189:	55                   	push   %rbp
+  80018a:	48 89 e5             	mov    %rsp,%rbp
+  80018d:	41 56                	push   %r14
+  80018f:	41 55                	push   %r13
+  800191:	41 54                	push   %r12
+  800193:	53                   	push   %rbx
+  800194:	48 83 ec 20          	sub    $0x20,%rsp
+    envid_t ids[NTHREADS];
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  800198:	bb 00 00 00 00       	mov    $0x0,%ebx
+        ids[i] = thread_create(count, (void *)i);
+  80019d:	49 bd a6 00 80 00 00 	movabs $0x8000a6,%r13
+  8001a4:	00 00 00 
+  8001a7:	49 bc 47 1f 80 00 00 	movabs $0x801f47,%r12
+  8001ae:	00 00 00 
+  8001b1:	48 89 de             	mov    %rbx,%rsi
+  8001b4:	4c 89 ef             	mov    %r13,%rdi
+  8001b7:	41 ff d4             	call   *%r12
+  8001ba:	89 44 9d d0          	mov    %eax,-0x30(%rbp,%rbx,4)
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+  8001be:	85 c0                	test   %eax,%eax
+  8001c0:	0f 88 db 01 00 00    	js     8003a1 <umain+0x218>
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  8001c6:	48 83 c3 01          	add    $0x1,%rbx
+  8001ca:	48 83 fb 04          	cmp    $0x4,%rbx
+  8001ce:	75 e1                	jne    8001b1 <umain+0x28>
+    }
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  8001d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        void *res;
+        int err = thread_join(ids[i], &res);
+  8001d5:	49 bc 98 21 80 00 00 	movabs $0x802198,%r12
+  8001dc:	00 00 00 
+  8001df:	8b 7c 9d d0          	mov    -0x30(%rbp,%rbx,4),%edi
+  8001e3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8001e7:	41 ff d4             	call   *%r12
+        if (err < 0) panic("thread_join: %i", err);
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	0f 88 dc 01 00 00    	js     8003ce <umain+0x245>
+        if (res != (void *)(i * 2)) panic("thread %lu returned %p", (unsigned long)i, res);
+  8001f2:	4c 8b 45 c8          	mov    -0x38(%rbp),%r8
+  8001f6:	48 8d 04 1b          	lea    (%rbx,%rbx,1),%rax
+  8001fa:	49 39 c0             	cmp    %rax,%r8
+  8001fd:	0f 85 f8 01 00 00    	jne    8003fb <umain+0x272>
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  800203:	48 83 c3 01          	add    $0x1,%rbx
+  800207:	48 83 fb 04          	cmp    $0x4,%rbx
+  80020b:	75 d2                	jne    8001df <umain+0x56>
+    }
+    if (counter != NTHREADS * NITER) panic("counter is %u instead of %u", counter, NTHREADS * NITER);
+  80020d:	a1 04 70 80 00 00 00 	movabs 0x807004,%eax
+  800214:	00 00 
+  800216:	3d 40 9c 00 00       	cmp    $0x9c40,%eax
+  80021b:	0f 85 08 02 00 00    	jne    800429 <umain+0x2a0>
+  800221:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  800228:	00 00 
+    if (thisenv->env_id != sys_getenvid()) panic("thisenv of the main thread changed");
+  80022a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80022e:	8b 98 c8 00 00 00    	mov    0xc8(%rax),%ebx
+  800234:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	39 c3                	cmp    %eax,%ebx
+  800242:	0f 85 14 02 00 00    	jne    80045c <umain+0x2d3>
+    cprintf("threadtest: counting OK\n");
+  800248:	48 bf db 50 80 00 00 	movabs $0x8050db,%rdi
+  80024f:	00 00 00 
+  800252:	b8 00 00 00 00       	mov    $0x0,%eax
+  800257:	48 ba 9b 07 80 00 00 	movabs $0x80079b,%rdx
+  80025e:	00 00 00 
+  800261:	ff d2                	call   *%rdx
+
+    uint32_t *val = (uint32_t *)UTEMP;
+    int res = sys_alloc_region(0, val, PAGE_SIZE, PROT_RW);
+  800263:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800268:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80026d:	be 00 00 40 00       	mov    $0x400000,%esi
+  800272:	bf 00 00 00 00       	mov    $0x0,%edi
+  800277:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80027e:	00 00 00 
+  800281:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800283:	85 c0                	test   %eax,%eax
+  800285:	0f 88 fb 01 00 00    	js     800486 <umain+0x2fd>
+    *val = 1;
+  80028b:	c7 04 25 00 00 40 00 	movl   $0x1,0x400000
+  800292:	01 00 00 00 
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  800296:	48 8d 5d d0          	lea    -0x30(%rbp),%rbx
+  80029a:	4c 8d 75 e0          	lea    -0x20(%rbp),%r14
+        ids[i] = thread_create(watch, NULL);
+  80029e:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8002a5:	00 00 00 
+  8002a8:	49 bc 47 1f 80 00 00 	movabs $0x801f47,%r12
+  8002af:	00 00 00 
+  8002b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b7:	4c 89 ef             	mov    %r13,%rdi
+  8002ba:	41 ff d4             	call   *%r12
+  8002bd:	89 03                	mov    %eax,(%rbx)
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+  8002bf:	85 c0                	test   %eax,%eax
+  8002c1:	0f 88 ec 01 00 00    	js     8004b3 <umain+0x32a>
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  8002c7:	48 83 c3 04          	add    $0x4,%rbx
+  8002cb:	4c 39 f3             	cmp    %r14,%rbx
+  8002ce:	75 e2                	jne    8002b2 <umain+0x129>
+    }
+    while (ready != NTHREADS) sys_yield();
+  8002d0:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8002d7:	00 00 
+  8002d9:	83 f8 04             	cmp    $0x4,%eax
+  8002dc:	74 1e                	je     8002fc <umain+0x173>
+  8002de:	49 bc e1 15 80 00 00 	movabs $0x8015e1,%r12
+  8002e5:	00 00 00 
+  8002e8:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8002ef:	00 00 00 
+  8002f2:	41 ff d4             	call   *%r12
+  8002f5:	8b 03                	mov    (%rbx),%eax
+  8002f7:	83 f8 04             	cmp    $0x4,%eax
+  8002fa:	75 f6                	jne    8002f2 <umain+0x169>
+
+    /* Threads see the new page only once their TLBs are flushed */
+    if ((res = sys_alloc_region(0, val, PAGE_SIZE, PROT_RW)) < 0) panic("sys_alloc_region: %i", res);
+  8002fc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800301:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800306:	be 00 00 40 00       	mov    $0x400000,%esi
+  80030b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800310:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	0f 88 bc 01 00 00    	js     8004e0 <umain+0x357>
+    *val = 2;
+  800324:	c7 04 25 00 00 40 00 	movl   $0x2,0x400000
+  80032b:	02 00 00 00 
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  80032f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        void *seen;
+        thread_join(ids[i], &seen);
+  800334:	49 bc 98 21 80 00 00 	movabs $0x802198,%r12
+  80033b:	00 00 00 
+  80033e:	8b 7c 9d d0          	mov    -0x30(%rbp,%rbx,4),%edi
+  800342:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800346:	41 ff d4             	call   *%r12
+        if (!seen) panic("thread %lu kept seeing the old page", (unsigned long)i);
+  800349:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80034e:	0f 84 b9 01 00 00    	je     80050d <umain+0x384>
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+  800354:	48 83 c3 01          	add    $0x1,%rbx
+  800358:	48 83 fb 04          	cmp    $0x4,%rbx
+  80035c:	75 e0                	jne    80033e <umain+0x1b5>
+    }
+    sys_unmap_region(0, val, PAGE_SIZE);
+  80035e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800363:	be 00 00 40 00       	mov    $0x400000,%esi
+  800368:	bf 00 00 00 00       	mov    $0x0,%edi
+  80036d:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  800374:	00 00 00 
+  800377:	ff d0                	call   *%rax
+    cprintf("threadtest: OK\n");
+  800379:	48 bf 09 51 80 00 00 	movabs $0x805109,%rdi
+  800380:	00 00 00 
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	48 ba 9b 07 80 00 00 	movabs $0x80079b,%rdx
+  80038f:	00 00 00 
+  800392:	ff d2                	call   *%rdx
+}
+  800394:	48 83 c4 20          	add    $0x20,%rsp
+  800398:	5b                   	pop    %rbx
+  800399:	41 5c                	pop    %r12
+  80039b:	41 5d                	pop    %r13
+  80039d:	41 5e                	pop    %r14
+  80039f:	5d                   	pop    %rbp
+  8003a0:	c3                   	ret
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+  8003a1:	89 c1                	mov    %eax,%ecx
+  8003a3:	48 ba 86 50 80 00 00 	movabs $0x805086,%rdx
+  8003aa:	00 00 00 
+  8003ad:	be 34 00 00 00       	mov    $0x34,%esi
+  8003b2:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  8003b9:	00 00 00 
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8003c8:	00 00 00 
+  8003cb:	41 ff d0             	call   *%r8
+        if (err < 0) panic("thread_join: %i", err);
+  8003ce:	89 c1                	mov    %eax,%ecx
+  8003d0:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8003d7:	00 00 00 
+  8003da:	be 39 00 00 00       	mov    $0x39,%esi
+  8003df:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  8003e6:	00 00 00 
+  8003e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ee:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8003f5:	00 00 00 
+  8003f8:	41 ff d0             	call   *%r8
+        if (res != (void *)(i * 2)) panic("thread %lu returned %p", (unsigned long)i, res);
+  8003fb:	48 89 d9             	mov    %rbx,%rcx
+  8003fe:	48 ba a8 50 80 00 00 	movabs $0x8050a8,%rdx
+  800405:	00 00 00 
+  800408:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80040d:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  800414:	00 00 00 
+  800417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041c:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  800423:	00 00 00 
+  800426:	41 ff d1             	call   *%r9
+    if (counter != NTHREADS * NITER) panic("counter is %u instead of %u", counter, NTHREADS * NITER);
+  800429:	41 b8 40 9c 00 00    	mov    $0x9c40,%r8d
+  80042f:	89 c1                	mov    %eax,%ecx
+  800431:	48 ba bf 50 80 00 00 	movabs $0x8050bf,%rdx
+  800438:	00 00 00 
+  80043b:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800440:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  800447:	00 00 00 
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  800456:	00 00 00 
+  800459:	41 ff d1             	call   *%r9
+    if (thisenv->env_id != sys_getenvid()) panic("thisenv of the main thread changed");
+  80045c:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800463:	00 00 00 
+  800466:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80046b:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	48 b9 4b 06 80 00 00 	movabs $0x80064b,%rcx
+  800481:	00 00 00 
+  800484:	ff d1                	call   *%rcx
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800486:	89 c1                	mov    %eax,%ecx
+  800488:	48 ba f4 50 80 00 00 	movabs $0x8050f4,%rdx
+  80048f:	00 00 00 
+  800492:	be 42 00 00 00       	mov    $0x42,%esi
+  800497:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  80049e:	00 00 00 
+  8004a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a6:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8004ad:	00 00 00 
+  8004b0:	41 ff d0             	call   *%r8
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+  8004b3:	89 c1                	mov    %eax,%ecx
+  8004b5:	48 ba 86 50 80 00 00 	movabs $0x805086,%rdx
+  8004bc:	00 00 00 
+  8004bf:	be 47 00 00 00       	mov    $0x47,%esi
+  8004c4:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  8004cb:	00 00 00 
+  8004ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d3:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8004da:	00 00 00 
+  8004dd:	41 ff d0             	call   *%r8
+    if ((res = sys_alloc_region(0, val, PAGE_SIZE, PROT_RW)) < 0) panic("sys_alloc_region: %i", res);
+  8004e0:	89 c1                	mov    %eax,%ecx
+  8004e2:	48 ba f4 50 80 00 00 	movabs $0x8050f4,%rdx
+  8004e9:	00 00 00 
+  8004ec:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8004f1:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  8004f8:	00 00 00 
+  8004fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800500:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  800507:	00 00 00 
+  80050a:	41 ff d0             	call   *%r8
+        if (!seen) panic("thread %lu kept seeing the old page", (unsigned long)i);
+  80050d:	48 89 d9             	mov    %rbx,%rcx
+  800510:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  800517:	00 00 00 
+  80051a:	be 52 00 00 00       	mov    $0x52,%esi
+  80051f:	48 bf 74 50 80 00 00 	movabs $0x805074,%rdi
+  800526:	00 00 00 
+  800529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052e:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  800535:	00 00 00 
+  800538:	41 ff d0             	call   *%r8
+
+000000000080053b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80053b:	55                   	push   %rbp
+  80053c:	48 89 e5             	mov    %rsp,%rbp
+  80053f:	41 56                	push   %r14
+  800541:	41 55                	push   %r13
+  800543:	41 54                	push   %r12
+  800545:	53                   	push   %rbx
+  800546:	48 83 ec 30          	sub    $0x30,%rsp
+  80054a:	41 89 fd             	mov    %edi,%r13d
+  80054d:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800550:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800557:	00 
+  800558:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80055f:	00 
+  800560:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  800567:	00 
+  800568:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80056f:	00 
+  800570:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800574:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  800578:	bf 00 00 00 00       	mov    $0x0,%edi
+  80057d:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800589:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800590:	00 00 00 
+  800593:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80059a:	00 00 00 
+  80059d:	48 39 c2             	cmp    %rax,%rdx
+  8005a0:	73 17                	jae    8005b9 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8005a2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005a5:	49 89 c4             	mov    %rax,%r12
+  8005a8:	48 83 c3 08          	add    $0x8,%rbx
+  8005ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b1:	ff 53 f8             	call   *-0x8(%rbx)
+  8005b4:	4c 39 e3             	cmp    %r12,%rbx
+  8005b7:	72 ef                	jb     8005a8 <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005b9:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  8005c0:	00 00 00 
+  8005c3:	ff d0                	call   *%rax
+  8005c5:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  8005cc:	00 00 
+  8005ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005d3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8005da:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8005e1:	00 00 00 
+  8005e4:	48 01 c8             	add    %rcx,%rax
+  8005e7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005eb:	45 85 ed             	test   %r13d,%r13d
+  8005ee:	7e 0d                	jle    8005fd <libmain+0xc2>
+  8005f0:	49 8b 06             	mov    (%r14),%rax
+  8005f3:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8005fa:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005fd:	4c 89 f6             	mov    %r14,%rsi
+  800600:	44 89 ef             	mov    %r13d,%edi
+  800603:	48 b8 89 01 80 00 00 	movabs $0x800189,%rax
+  80060a:	00 00 00 
+  80060d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80060f:	48 b8 28 06 80 00 00 	movabs $0x800628,%rax
+  800616:	00 00 00 
+  800619:	ff d0                	call   *%rax
+#endif
+}
+  80061b:	48 83 c4 30          	add    $0x30,%rsp
+  80061f:	5b                   	pop    %rbx
+  800620:	41 5c                	pop    %r12
+  800622:	41 5d                	pop    %r13
+  800624:	41 5e                	pop    %r14
+  800626:	5d                   	pop    %rbp
+  800627:	c3                   	ret
+
+0000000000800628 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800628:	55                   	push   %rbp
+  800629:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80062c:	48 b8 0a 25 80 00 00 	movabs $0x80250a,%rax
+  800633:	00 00 00 
+  800636:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800638:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063d:	48 b8 45 15 80 00 00 	movabs $0x801545,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+}
+  800649:	5d                   	pop    %rbp
+  80064a:	c3                   	ret
+
+000000000080064b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	41 56                	push   %r14
+  800651:	41 55                	push   %r13
+  800653:	41 54                	push   %r12
+  800655:	53                   	push   %rbx
+  800656:	48 83 ec 50          	sub    $0x50,%rsp
+  80065a:	49 89 fc             	mov    %rdi,%r12
+  80065d:	41 89 f5             	mov    %esi,%r13d
+  800660:	48 89 d3             	mov    %rdx,%rbx
+  800663:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800667:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80066b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80066f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800676:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80067a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80067e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800682:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800686:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80068d:	00 00 00 
+  800690:	4c 8b 30             	mov    (%rax),%r14
+  800693:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  80069a:	00 00 00 
+  80069d:	ff d0                	call   *%rax
+  80069f:	89 c6                	mov    %eax,%esi
+  8006a1:	45 89 e8             	mov    %r13d,%r8d
+  8006a4:	4c 89 e1             	mov    %r12,%rcx
+  8006a7:	4c 89 f2             	mov    %r14,%rdx
+  8006aa:	48 bf 28 51 80 00 00 	movabs $0x805128,%rdi
+  8006b1:	00 00 00 
+  8006b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b9:	49 bc 9b 07 80 00 00 	movabs $0x80079b,%r12
+  8006c0:	00 00 00 
+  8006c3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006c6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006ca:	48 89 df             	mov    %rbx,%rdi
+  8006cd:	48 b8 37 07 80 00 00 	movabs $0x800737,%rax
+  8006d4:	00 00 00 
+  8006d7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006d9:	48 bf 17 51 80 00 00 	movabs $0x805117,%rdi
+  8006e0:	00 00 00 
+  8006e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006eb:	cc                   	int3
+  8006ec:	eb fd                	jmp    8006eb <_panic+0xa0>
+
+00000000008006ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006ee:	55                   	push   %rbp
+  8006ef:	48 89 e5             	mov    %rsp,%rbp
+  8006f2:	53                   	push   %rbx
+  8006f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006fa:	8b 06                	mov    (%rsi),%eax
+  8006fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8006ff:	89 16                	mov    %edx,(%rsi)
+  800701:	48 98                	cltq
+  800703:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800708:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80070e:	74 0a                	je     80071a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800710:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80071a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80071e:	be ff 00 00 00       	mov    $0xff,%esi
+  800723:	48 b8 e7 14 80 00 00 	movabs $0x8014e7,%rax
+  80072a:	00 00 00 
+  80072d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80072f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800735:	eb d9                	jmp    800710 <putch+0x22>
+
+0000000000800737 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800737:	55                   	push   %rbp
+  800738:	48 89 e5             	mov    %rsp,%rbp
+  80073b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800742:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800745:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80074c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800751:	b8 00 00 00 00       	mov    $0x0,%eax
+  800756:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800759:	48 89 f1             	mov    %rsi,%rcx
+  80075c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800763:	48 bf ee 06 80 00 00 	movabs $0x8006ee,%rdi
+  80076a:	00 00 00 
+  80076d:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  800774:	00 00 00 
+  800777:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800779:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800780:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800787:	48 b8 e7 14 80 00 00 	movabs $0x8014e7,%rax
+  80078e:	00 00 00 
+  800791:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800793:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800799:	c9                   	leave
+  80079a:	c3                   	ret
+
+000000000080079b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80079b:	55                   	push   %rbp
+  80079c:	48 89 e5             	mov    %rsp,%rbp
+  80079f:	48 83 ec 50          	sub    $0x50,%rsp
+  8007a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007d2:	48 b8 37 07 80 00 00 	movabs $0x800737,%rax
+  8007d9:	00 00 00 
+  8007dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007de:	c9                   	leave
+  8007df:	c3                   	ret
+
+00000000008007e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007e0:	55                   	push   %rbp
+  8007e1:	48 89 e5             	mov    %rsp,%rbp
+  8007e4:	41 57                	push   %r15
+  8007e6:	41 56                	push   %r14
+  8007e8:	41 55                	push   %r13
+  8007ea:	41 54                	push   %r12
+  8007ec:	53                   	push   %rbx
+  8007ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8007f1:	49 89 fc             	mov    %rdi,%r12
+  8007f4:	49 89 f5             	mov    %rsi,%r13
+  8007f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800801:	41 89 cf             	mov    %ecx,%r15d
+  800804:	4c 39 fa             	cmp    %r15,%rdx
+  800807:	73 5b                	jae    800864 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800809:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80080d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800811:	85 db                	test   %ebx,%ebx
+  800813:	7e 0e                	jle    800823 <print_num+0x43>
+            putch(padc, put_arg);
+  800815:	4c 89 ee             	mov    %r13,%rsi
+  800818:	44 89 f7             	mov    %r14d,%edi
+  80081b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80081e:	83 eb 01             	sub    $0x1,%ebx
+  800821:	75 f2                	jne    800815 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800823:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800827:	48 b9 5c 51 80 00 00 	movabs $0x80515c,%rcx
+  80082e:	00 00 00 
+  800831:	48 b8 4b 51 80 00 00 	movabs $0x80514b,%rax
+  800838:	00 00 00 
+  80083b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80083f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800843:	ba 00 00 00 00       	mov    $0x0,%edx
+  800848:	49 f7 f7             	div    %r15
+  80084b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80084f:	4c 89 ee             	mov    %r13,%rsi
+  800852:	41 ff d4             	call   *%r12
+}
+  800855:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800859:	5b                   	pop    %rbx
+  80085a:	41 5c                	pop    %r12
+  80085c:	41 5d                	pop    %r13
+  80085e:	41 5e                	pop    %r14
+  800860:	41 5f                	pop    %r15
+  800862:	5d                   	pop    %rbp
+  800863:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800864:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086d:	49 f7 f7             	div    %r15
+  800870:	48 83 ec 08          	sub    $0x8,%rsp
+  800874:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800878:	52                   	push   %rdx
+  800879:	45 0f be c9          	movsbl %r9b,%r9d
+  80087d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800881:	48 89 c2             	mov    %rax,%rdx
+  800884:	48 b8 e0 07 80 00 00 	movabs $0x8007e0,%rax
+  80088b:	00 00 00 
+  80088e:	ff d0                	call   *%rax
+  800890:	48 83 c4 10          	add    $0x10,%rsp
+  800894:	eb 8d                	jmp    800823 <print_num+0x43>
+
+0000000000800896 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800896:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80089a:	48 8b 06             	mov    (%rsi),%rax
+  80089d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008a1:	73 0a                	jae    8008ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8008a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008a7:	48 89 16             	mov    %rdx,(%rsi)
+  8008aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008ad:	c3                   	ret
+
+00000000008008ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008ae:	55                   	push   %rbp
+  8008af:	48 89 e5             	mov    %rsp,%rbp
+  8008b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8008b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008dd:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  8008e4:	00 00 00 
+  8008e7:	ff d0                	call   *%rax
+}
+  8008e9:	c9                   	leave
+  8008ea:	c3                   	ret
+
+00000000008008eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008eb:	55                   	push   %rbp
+  8008ec:	48 89 e5             	mov    %rsp,%rbp
+  8008ef:	41 57                	push   %r15
+  8008f1:	41 56                	push   %r14
+  8008f3:	41 55                	push   %r13
+  8008f5:	41 54                	push   %r12
+  8008f7:	53                   	push   %rbx
+  8008f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8008fc:	49 89 fe             	mov    %rdi,%r14
+  8008ff:	49 89 f5             	mov    %rsi,%r13
+  800902:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800905:	48 8b 01             	mov    (%rcx),%rax
+  800908:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80090c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800918:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80091c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800920:	0f b6 3b             	movzbl (%rbx),%edi
+  800923:	40 80 ff 25          	cmp    $0x25,%dil
+  800927:	74 18                	je     800941 <vprintfmt+0x56>
+            if (!ch) return;
+  800929:	40 84 ff             	test   %dil,%dil
+  80092c:	0f 84 b1 06 00 00    	je     800fe3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800932:	40 0f b6 ff          	movzbl %dil,%edi
+  800936:	4c 89 ee             	mov    %r13,%rsi
+  800939:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80093c:	4c 89 e3             	mov    %r12,%rbx
+  80093f:	eb db                	jmp    80091c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800941:	be 00 00 00 00       	mov    $0x0,%esi
+  800946:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80094a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80094f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800955:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80095c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800960:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800965:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80096a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80096d:	83 e8 23             	sub    $0x23,%eax
+  800970:	3c 57                	cmp    $0x57,%al
+  800972:	0f 87 51 06 00 00    	ja     800fc9 <vprintfmt+0x6de>
+  800978:	0f b6 c0             	movzbl %al,%eax
+  80097b:	48 b9 00 53 80 00 00 	movabs $0x805300,%rcx
+  800982:	00 00 00 
+  800985:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800988:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80098b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80098f:	eb cf                	jmp    800960 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800991:	49 89 dc             	mov    %rbx,%r12
+  800994:	be 01 00 00 00       	mov    $0x1,%esi
+  800999:	eb c5                	jmp    800960 <vprintfmt+0x75>
+            padc = ch;
+  80099b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80099f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009a5:	eb b9                	jmp    800960 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 24                	ja     8009d3 <vprintfmt+0xe8>
+  8009af:	89 c1                	mov    %eax,%ecx
+  8009b1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009b5:	83 c0 08             	add    $0x8,%eax
+  8009b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009be:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009c5:	79 99                	jns    800960 <vprintfmt+0x75>
+                width = precision;
+  8009c7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009d1:	eb 8d                	jmp    800960 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009d7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb da                	jmp    8009bb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009e1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009e6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009ea:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009f0:	3c 39                	cmp    $0x39,%al
+  8009f2:	77 1c                	ja     800a10 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009f4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009f8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009fc:	0f b6 c0             	movzbl %al,%eax
+  8009ff:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a04:	0f b6 03             	movzbl (%rbx),%eax
+  800a07:	3c 39                	cmp    $0x39,%al
+  800a09:	76 e9                	jbe    8009f4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a0b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a0e:	eb b1                	jmp    8009c1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a10:	49 89 dc             	mov    %rbx,%r12
+  800a13:	eb ac                	jmp    8009c1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a15:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a18:	85 c9                	test   %ecx,%ecx
+  800a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1f:	0f 49 c1             	cmovns %ecx,%eax
+  800a22:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a25:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a28:	e9 33 ff ff ff       	jmp    800960 <vprintfmt+0x75>
+            lflag++;
+  800a2d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a30:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a33:	e9 28 ff ff ff       	jmp    800960 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3e:	77 19                	ja     800a59 <vprintfmt+0x16e>
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a46:	83 c0 08             	add    $0x8,%eax
+  800a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4c:	8b 3a                	mov    (%rdx),%edi
+  800a4e:	4c 89 ee             	mov    %r13,%rsi
+  800a51:	41 ff d6             	call   *%r14
+            break;
+  800a54:	e9 c3 fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a65:	eb e5                	jmp    800a4c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6d:	77 5a                	ja     800ac9 <vprintfmt+0x1de>
+  800a6f:	89 c2                	mov    %eax,%edx
+  800a71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a75:	83 c0 08             	add    $0x8,%eax
+  800a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a7b:	8b 02                	mov    (%rdx),%eax
+  800a7d:	89 c1                	mov    %eax,%ecx
+  800a7f:	f7 d9                	neg    %ecx
+  800a81:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a84:	83 f9 16             	cmp    $0x16,%ecx
+  800a87:	7f 4e                	jg     800ad7 <vprintfmt+0x1ec>
+  800a89:	48 63 c1             	movslq %ecx,%rax
+  800a8c:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  800a93:	00 00 00 
+  800a96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a9a:	48 85 c0             	test   %rax,%rax
+  800a9d:	74 38                	je     800ad7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a9f:	48 89 c1             	mov    %rax,%rcx
+  800aa2:	48 ba f9 57 80 00 00 	movabs $0x8057f9,%rdx
+  800aa9:	00 00 00 
+  800aac:	4c 89 ee             	mov    %r13,%rsi
+  800aaf:	4c 89 f7             	mov    %r14,%rdi
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab7:	49 b8 ae 08 80 00 00 	movabs $0x8008ae,%r8
+  800abe:	00 00 00 
+  800ac1:	41 ff d0             	call   *%r8
+  800ac4:	e9 53 fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ac9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad5:	eb a4                	jmp    800a7b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ad7:	48 ba 74 51 80 00 00 	movabs $0x805174,%rdx
+  800ade:	00 00 00 
+  800ae1:	4c 89 ee             	mov    %r13,%rsi
+  800ae4:	4c 89 f7             	mov    %r14,%rdi
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	49 b8 ae 08 80 00 00 	movabs $0x8008ae,%r8
+  800af3:	00 00 00 
+  800af6:	41 ff d0             	call   *%r8
+  800af9:	e9 1e fe ff ff       	jmp    80091c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800afe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b01:	83 f8 2f             	cmp    $0x2f,%eax
+  800b04:	77 6c                	ja     800b72 <vprintfmt+0x287>
+  800b06:	89 c2                	mov    %eax,%edx
+  800b08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0c:	83 c0 08             	add    $0x8,%eax
+  800b0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b12:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b15:	48 85 d2             	test   %rdx,%rdx
+  800b18:	48 b8 6d 51 80 00 00 	movabs $0x80516d,%rax
+  800b1f:	00 00 00 
+  800b22:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b26:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b2a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b2e:	7e 06                	jle    800b36 <vprintfmt+0x24b>
+  800b30:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b34:	75 4a                	jne    800b80 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b36:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b3a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b3e:	0f b6 00             	movzbl (%rax),%eax
+  800b41:	84 c0                	test   %al,%al
+  800b43:	0f 85 9a 00 00 00    	jne    800be3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b49:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b4c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b50:	85 c0                	test   %eax,%eax
+  800b52:	0f 8e c4 fd ff ff    	jle    80091c <vprintfmt+0x31>
+  800b58:	4c 89 ee             	mov    %r13,%rsi
+  800b5b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b60:	41 ff d6             	call   *%r14
+  800b63:	41 83 ec 01          	sub    $0x1,%r12d
+  800b67:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b6b:	75 eb                	jne    800b58 <vprintfmt+0x26d>
+  800b6d:	e9 aa fd ff ff       	jmp    80091c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7e:	eb 92                	jmp    800b12 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b80:	49 63 f7             	movslq %r15d,%rsi
+  800b83:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b87:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  800b8e:	00 00 00 
+  800b91:	ff d0                	call   *%rax
+  800b93:	48 89 c2             	mov    %rax,%rdx
+  800b96:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b99:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b9b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b9e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ba1:	85 c0                	test   %eax,%eax
+  800ba3:	7e 91                	jle    800b36 <vprintfmt+0x24b>
+  800ba5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800baa:	4c 89 ee             	mov    %r13,%rsi
+  800bad:	44 89 e7             	mov    %r12d,%edi
+  800bb0:	41 ff d6             	call   *%r14
+  800bb3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bb7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bba:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bbd:	75 eb                	jne    800baa <vprintfmt+0x2bf>
+  800bbf:	e9 72 ff ff ff       	jmp    800b36 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bc4:	0f b6 f8             	movzbl %al,%edi
+  800bc7:	4c 89 ee             	mov    %r13,%rsi
+  800bca:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bcd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bd1:	49 83 c4 01          	add    $0x1,%r12
+  800bd5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bdb:	84 c0                	test   %al,%al
+  800bdd:	0f 84 66 ff ff ff    	je     800b49 <vprintfmt+0x25e>
+  800be3:	45 85 ff             	test   %r15d,%r15d
+  800be6:	78 0a                	js     800bf2 <vprintfmt+0x307>
+  800be8:	41 83 ef 01          	sub    $0x1,%r15d
+  800bec:	0f 88 57 ff ff ff    	js     800b49 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bf2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800bf6:	74 cc                	je     800bc4 <vprintfmt+0x2d9>
+  800bf8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800bfb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c00:	80 fa 5e             	cmp    $0x5e,%dl
+  800c03:	77 c2                	ja     800bc7 <vprintfmt+0x2dc>
+  800c05:	eb bd                	jmp    800bc4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c07:	40 84 f6             	test   %sil,%sil
+  800c0a:	75 26                	jne    800c32 <vprintfmt+0x347>
+    switch (lflag) {
+  800c0c:	85 d2                	test   %edx,%edx
+  800c0e:	74 59                	je     800c69 <vprintfmt+0x37e>
+  800c10:	83 fa 01             	cmp    $0x1,%edx
+  800c13:	74 7b                	je     800c90 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c18:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1b:	0f 87 96 00 00 00    	ja     800cb7 <vprintfmt+0x3cc>
+  800c21:	89 c2                	mov    %eax,%edx
+  800c23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c27:	83 c0 08             	add    $0x8,%eax
+  800c2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2d:	4c 8b 22             	mov    (%rdx),%r12
+  800c30:	eb 17                	jmp    800c49 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c35:	83 f8 2f             	cmp    $0x2f,%eax
+  800c38:	77 21                	ja     800c5b <vprintfmt+0x370>
+  800c3a:	89 c2                	mov    %eax,%edx
+  800c3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c40:	83 c0 08             	add    $0x8,%eax
+  800c43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c46:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c49:	4d 85 e4             	test   %r12,%r12
+  800c4c:	78 7a                	js     800cc8 <vprintfmt+0x3dd>
+            num = i;
+  800c4e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c56:	e9 50 02 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c67:	eb dd                	jmp    800c46 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6f:	77 11                	ja     800c82 <vprintfmt+0x397>
+  800c71:	89 c2                	mov    %eax,%edx
+  800c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c77:	83 c0 08             	add    $0x8,%eax
+  800c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7d:	4c 63 22             	movslq (%rdx),%r12
+  800c80:	eb c7                	jmp    800c49 <vprintfmt+0x35e>
+  800c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8e:	eb ed                	jmp    800c7d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c93:	83 f8 2f             	cmp    $0x2f,%eax
+  800c96:	77 11                	ja     800ca9 <vprintfmt+0x3be>
+  800c98:	89 c2                	mov    %eax,%edx
+  800c9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9e:	83 c0 08             	add    $0x8,%eax
+  800ca1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca4:	4c 8b 22             	mov    (%rdx),%r12
+  800ca7:	eb a0                	jmp    800c49 <vprintfmt+0x35e>
+  800ca9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb5:	eb ed                	jmp    800ca4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800cb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc3:	e9 65 ff ff ff       	jmp    800c2d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cc8:	4c 89 ee             	mov    %r13,%rsi
+  800ccb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cd0:	41 ff d6             	call   *%r14
+                i = -i;
+  800cd3:	49 f7 dc             	neg    %r12
+  800cd6:	e9 73 ff ff ff       	jmp    800c4e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800cdb:	40 84 f6             	test   %sil,%sil
+  800cde:	75 32                	jne    800d12 <vprintfmt+0x427>
+    switch (lflag) {
+  800ce0:	85 d2                	test   %edx,%edx
+  800ce2:	74 5d                	je     800d41 <vprintfmt+0x456>
+  800ce4:	83 fa 01             	cmp    $0x1,%edx
+  800ce7:	0f 84 82 00 00 00    	je     800d6f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ced:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf3:	0f 87 a5 00 00 00    	ja     800d9e <vprintfmt+0x4b3>
+  800cf9:	89 c2                	mov    %eax,%edx
+  800cfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cff:	83 c0 08             	add    $0x8,%eax
+  800d02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d0d:	e9 99 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d15:	83 f8 2f             	cmp    $0x2f,%eax
+  800d18:	77 19                	ja     800d33 <vprintfmt+0x448>
+  800d1a:	89 c2                	mov    %eax,%edx
+  800d1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d20:	83 c0 08             	add    $0x8,%eax
+  800d23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d26:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d2e:	e9 78 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3f:	eb e5                	jmp    800d26 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d44:	83 f8 2f             	cmp    $0x2f,%eax
+  800d47:	77 18                	ja     800d61 <vprintfmt+0x476>
+  800d49:	89 c2                	mov    %eax,%edx
+  800d4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4f:	83 c0 08             	add    $0x8,%eax
+  800d52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d55:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5c:	e9 4a 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e6                	jmp    800d55 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 19                	ja     800d90 <vprintfmt+0x4a5>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7d:	83 c0 08             	add    $0x8,%eax
+  800d80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d83:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d8b:	e9 1b 01 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9c:	eb e5                	jmp    800d83 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daa:	e9 56 ff ff ff       	jmp    800d05 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800daf:	40 84 f6             	test   %sil,%sil
+  800db2:	75 2e                	jne    800de2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800db4:	85 d2                	test   %edx,%edx
+  800db6:	74 59                	je     800e11 <vprintfmt+0x526>
+  800db8:	83 fa 01             	cmp    $0x1,%edx
+  800dbb:	74 7f                	je     800e3c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc3:	0f 87 9f 00 00 00    	ja     800e68 <vprintfmt+0x57d>
+  800dc9:	89 c2                	mov    %eax,%edx
+  800dcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dcf:	83 c0 08             	add    $0x8,%eax
+  800dd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800dd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ddd:	e9 c9 00 00 00       	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800de2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de5:	83 f8 2f             	cmp    $0x2f,%eax
+  800de8:	77 19                	ja     800e03 <vprintfmt+0x518>
+  800dea:	89 c2                	mov    %eax,%edx
+  800dec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df0:	83 c0 08             	add    $0x8,%eax
+  800df3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800df9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dfe:	e9 a8 00 00 00       	jmp    800eab <vprintfmt+0x5c0>
+  800e03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0f:	eb e5                	jmp    800df6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e14:	83 f8 2f             	cmp    $0x2f,%eax
+  800e17:	77 15                	ja     800e2e <vprintfmt+0x543>
+  800e19:	89 c2                	mov    %eax,%edx
+  800e1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1f:	83 c0 08             	add    $0x8,%eax
+  800e22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e25:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e27:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e2c:	eb 7d                	jmp    800eab <vprintfmt+0x5c0>
+  800e2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3a:	eb e9                	jmp    800e25 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e42:	77 16                	ja     800e5a <vprintfmt+0x56f>
+  800e44:	89 c2                	mov    %eax,%edx
+  800e46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4a:	83 c0 08             	add    $0x8,%eax
+  800e4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e50:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e53:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e58:	eb 51                	jmp    800eab <vprintfmt+0x5c0>
+  800e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e66:	eb e8                	jmp    800e50 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e74:	e9 5c ff ff ff       	jmp    800dd5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e79:	4c 89 ee             	mov    %r13,%rsi
+  800e7c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e81:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e84:	4c 89 ee             	mov    %r13,%rsi
+  800e87:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e8c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e92:	83 f8 2f             	cmp    $0x2f,%eax
+  800e95:	77 47                	ja     800ede <vprintfmt+0x5f3>
+  800e97:	89 c2                	mov    %eax,%edx
+  800e99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e9d:	83 c0 08             	add    $0x8,%eax
+  800ea0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ea3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ea6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800eab:	48 83 ec 08          	sub    $0x8,%rsp
+  800eaf:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800eb3:	0f 94 c0             	sete   %al
+  800eb6:	0f b6 c0             	movzbl %al,%eax
+  800eb9:	50                   	push   %rax
+  800eba:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ebf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ec3:	4c 89 ee             	mov    %r13,%rsi
+  800ec6:	4c 89 f7             	mov    %r14,%rdi
+  800ec9:	48 b8 e0 07 80 00 00 	movabs $0x8007e0,%rax
+  800ed0:	00 00 00 
+  800ed3:	ff d0                	call   *%rax
+            break;
+  800ed5:	48 83 c4 10          	add    $0x10,%rsp
+  800ed9:	e9 3e fa ff ff       	jmp    80091c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ede:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ee2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eea:	eb b7                	jmp    800ea3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800eec:	40 84 f6             	test   %sil,%sil
+  800eef:	75 2b                	jne    800f1c <vprintfmt+0x631>
+    switch (lflag) {
+  800ef1:	85 d2                	test   %edx,%edx
+  800ef3:	74 56                	je     800f4b <vprintfmt+0x660>
+  800ef5:	83 fa 01             	cmp    $0x1,%edx
+  800ef8:	74 7f                	je     800f79 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800efa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800efd:	83 f8 2f             	cmp    $0x2f,%eax
+  800f00:	0f 87 a2 00 00 00    	ja     800fa8 <vprintfmt+0x6bd>
+  800f06:	89 c2                	mov    %eax,%edx
+  800f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f0c:	83 c0 08             	add    $0x8,%eax
+  800f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f15:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f1a:	eb 8f                	jmp    800eab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800f22:	77 19                	ja     800f3d <vprintfmt+0x652>
+  800f24:	89 c2                	mov    %eax,%edx
+  800f26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f2a:	83 c0 08             	add    $0x8,%eax
+  800f2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f33:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f38:	e9 6e ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f49:	eb e5                	jmp    800f30 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f51:	77 18                	ja     800f6b <vprintfmt+0x680>
+  800f53:	89 c2                	mov    %eax,%edx
+  800f55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f59:	83 c0 08             	add    $0x8,%eax
+  800f5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f61:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f66:	e9 40 ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f77:	eb e6                	jmp    800f5f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7f:	77 19                	ja     800f9a <vprintfmt+0x6af>
+  800f81:	89 c2                	mov    %eax,%edx
+  800f83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f87:	83 c0 08             	add    $0x8,%eax
+  800f8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f90:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f95:	e9 11 ff ff ff       	jmp    800eab <vprintfmt+0x5c0>
+  800f9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa6:	eb e5                	jmp    800f8d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb4:	e9 59 ff ff ff       	jmp    800f12 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fb9:	4c 89 ee             	mov    %r13,%rsi
+  800fbc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fc1:	41 ff d6             	call   *%r14
+            break;
+  800fc4:	e9 53 f9 ff ff       	jmp    80091c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fc9:	4c 89 ee             	mov    %r13,%rsi
+  800fcc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fd1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fd4:	48 83 eb 01          	sub    $0x1,%rbx
+  800fd8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fdc:	75 f6                	jne    800fd4 <vprintfmt+0x6e9>
+  800fde:	e9 39 f9 ff ff       	jmp    80091c <vprintfmt+0x31>
+}
+  800fe3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fe7:	5b                   	pop    %rbx
+  800fe8:	41 5c                	pop    %r12
+  800fea:	41 5d                	pop    %r13
+  800fec:	41 5e                	pop    %r14
+  800fee:	41 5f                	pop    %r15
+  800ff0:	5d                   	pop    %rbp
+  800ff1:	c3                   	ret
+
+0000000000800ff2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ff2:	55                   	push   %rbp
+  800ff3:	48 89 e5             	mov    %rsp,%rbp
+  800ff6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ffa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ffe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801003:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801007:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80100e:	48 85 ff             	test   %rdi,%rdi
+  801011:	74 2b                	je     80103e <vsnprintf+0x4c>
+  801013:	48 85 f6             	test   %rsi,%rsi
+  801016:	74 26                	je     80103e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801018:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80101c:	48 bf 96 08 80 00 00 	movabs $0x800896,%rdi
+  801023:	00 00 00 
+  801026:	48 b8 eb 08 80 00 00 	movabs $0x8008eb,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801032:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801036:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801039:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80103c:	c9                   	leave
+  80103d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80103e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801043:	eb f7                	jmp    80103c <vsnprintf+0x4a>
+
+0000000000801045 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	48 83 ec 50          	sub    $0x50,%rsp
+  80104d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801051:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801055:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801059:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801060:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801064:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801068:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80106c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801070:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801074:	48 b8 f2 0f 80 00 00 	movabs $0x800ff2,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+0000000000801082 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801082:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801085:	74 10                	je     801097 <strlen+0x15>
+    size_t n = 0;
+  801087:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80108c:	48 83 c0 01          	add    $0x1,%rax
+  801090:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801094:	75 f6                	jne    80108c <strlen+0xa>
+  801096:	c3                   	ret
+    size_t n = 0;
+  801097:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80109c:	c3                   	ret
+
+000000000080109d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80109d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010a0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010a5:	48 85 f6             	test   %rsi,%rsi
+  8010a8:	74 11                	je     8010bb <strnlen+0x1e>
+  8010aa:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010ae:	74 0c                	je     8010bc <strnlen+0x1f>
+  8010b0:	48 83 c2 01          	add    $0x1,%rdx
+  8010b4:	48 39 d0             	cmp    %rdx,%rax
+  8010b7:	75 f1                	jne    8010aa <strnlen+0xd>
+  8010b9:	eb 04                	jmp    8010bf <strnlen+0x22>
+  8010bb:	c3                   	ret
+  8010bc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010bf:	c3                   	ret
+
+00000000008010c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010c0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010cc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010cf:	48 83 c2 01          	add    $0x1,%rdx
+  8010d3:	84 c9                	test   %cl,%cl
+  8010d5:	75 f1                	jne    8010c8 <strcpy+0x8>
+        ;
+    return res;
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010d8:	55                   	push   %rbp
+  8010d9:	48 89 e5             	mov    %rsp,%rbp
+  8010dc:	41 54                	push   %r12
+  8010de:	53                   	push   %rbx
+  8010df:	48 89 fb             	mov    %rdi,%rbx
+  8010e2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010e5:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010f1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010f5:	4c 89 e6             	mov    %r12,%rsi
+  8010f8:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  8010ff:	00 00 00 
+  801102:	ff d0                	call   *%rax
+    return dst;
+}
+  801104:	48 89 d8             	mov    %rbx,%rax
+  801107:	5b                   	pop    %rbx
+  801108:	41 5c                	pop    %r12
+  80110a:	5d                   	pop    %rbp
+  80110b:	c3                   	ret
+
+000000000080110c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80110c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80110f:	48 85 d2             	test   %rdx,%rdx
+  801112:	74 1f                	je     801133 <strncpy+0x27>
+  801114:	48 01 fa             	add    %rdi,%rdx
+  801117:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80111a:	48 83 c1 01          	add    $0x1,%rcx
+  80111e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801122:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801126:	41 80 f8 01          	cmp    $0x1,%r8b
+  80112a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80112e:	48 39 ca             	cmp    %rcx,%rdx
+  801131:	75 e7                	jne    80111a <strncpy+0xe>
+    }
+    return ret;
+}
+  801133:	c3                   	ret
+
+0000000000801134 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801134:	48 89 f8             	mov    %rdi,%rax
+  801137:	48 85 d2             	test   %rdx,%rdx
+  80113a:	74 24                	je     801160 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80113c:	48 83 ea 01          	sub    $0x1,%rdx
+  801140:	74 1b                	je     80115d <strlcpy+0x29>
+  801142:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801146:	0f b6 16             	movzbl (%rsi),%edx
+  801149:	84 d2                	test   %dl,%dl
+  80114b:	74 10                	je     80115d <strlcpy+0x29>
+            *dst++ = *src++;
+  80114d:	48 83 c6 01          	add    $0x1,%rsi
+  801151:	48 83 c0 01          	add    $0x1,%rax
+  801155:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801158:	48 39 c8             	cmp    %rcx,%rax
+  80115b:	75 e9                	jne    801146 <strlcpy+0x12>
+        *dst = '\0';
+  80115d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801160:	48 29 f8             	sub    %rdi,%rax
+}
+  801163:	c3                   	ret
+
+0000000000801164 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801164:	0f b6 07             	movzbl (%rdi),%eax
+  801167:	84 c0                	test   %al,%al
+  801169:	74 13                	je     80117e <strcmp+0x1a>
+  80116b:	38 06                	cmp    %al,(%rsi)
+  80116d:	75 0f                	jne    80117e <strcmp+0x1a>
+  80116f:	48 83 c7 01          	add    $0x1,%rdi
+  801173:	48 83 c6 01          	add    $0x1,%rsi
+  801177:	0f b6 07             	movzbl (%rdi),%eax
+  80117a:	84 c0                	test   %al,%al
+  80117c:	75 ed                	jne    80116b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80117e:	0f b6 c0             	movzbl %al,%eax
+  801181:	0f b6 16             	movzbl (%rsi),%edx
+  801184:	29 d0                	sub    %edx,%eax
+}
+  801186:	c3                   	ret
+
+0000000000801187 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801187:	48 85 d2             	test   %rdx,%rdx
+  80118a:	74 1f                	je     8011ab <strncmp+0x24>
+  80118c:	0f b6 07             	movzbl (%rdi),%eax
+  80118f:	84 c0                	test   %al,%al
+  801191:	74 1e                	je     8011b1 <strncmp+0x2a>
+  801193:	3a 06                	cmp    (%rsi),%al
+  801195:	75 1a                	jne    8011b1 <strncmp+0x2a>
+  801197:	48 83 c7 01          	add    $0x1,%rdi
+  80119b:	48 83 c6 01          	add    $0x1,%rsi
+  80119f:	48 83 ea 01          	sub    $0x1,%rdx
+  8011a3:	75 e7                	jne    80118c <strncmp+0x5>
+
+    if (!n) return 0;
+  8011a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011aa:	c3                   	ret
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b0:	c3                   	ret
+  8011b1:	48 85 d2             	test   %rdx,%rdx
+  8011b4:	74 09                	je     8011bf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011b6:	0f b6 07             	movzbl (%rdi),%eax
+  8011b9:	0f b6 16             	movzbl (%rsi),%edx
+  8011bc:	29 d0                	sub    %edx,%eax
+  8011be:	c3                   	ret
+    if (!n) return 0;
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011c5:	0f b6 17             	movzbl (%rdi),%edx
+  8011c8:	84 d2                	test   %dl,%dl
+  8011ca:	74 18                	je     8011e4 <strchr+0x1f>
+        if (*str == c) {
+  8011cc:	0f be d2             	movsbl %dl,%edx
+  8011cf:	39 f2                	cmp    %esi,%edx
+  8011d1:	74 17                	je     8011ea <strchr+0x25>
+    for (; *str; str++) {
+  8011d3:	48 83 c7 01          	add    $0x1,%rdi
+  8011d7:	0f b6 17             	movzbl (%rdi),%edx
+  8011da:	84 d2                	test   %dl,%dl
+  8011dc:	75 ee                	jne    8011cc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e3:	c3                   	ret
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e9:	c3                   	ret
+  8011ea:	48 89 f8             	mov    %rdi,%rax
+}
+  8011ed:	c3                   	ret
+
+00000000008011ee <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011ee:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011f1:	0f b6 17             	movzbl (%rdi),%edx
+  8011f4:	84 d2                	test   %dl,%dl
+  8011f6:	74 13                	je     80120b <strfind+0x1d>
+  8011f8:	0f be d2             	movsbl %dl,%edx
+  8011fb:	39 f2                	cmp    %esi,%edx
+  8011fd:	74 0b                	je     80120a <strfind+0x1c>
+  8011ff:	48 83 c0 01          	add    $0x1,%rax
+  801203:	0f b6 10             	movzbl (%rax),%edx
+  801206:	84 d2                	test   %dl,%dl
+  801208:	75 ee                	jne    8011f8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80120a:	c3                   	ret
+  80120b:	c3                   	ret
+
+000000000080120c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80120c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80120f:	48 89 f8             	mov    %rdi,%rax
+  801212:	48 f7 d8             	neg    %rax
+  801215:	83 e0 07             	and    $0x7,%eax
+  801218:	49 89 d1             	mov    %rdx,%r9
+  80121b:	49 29 c1             	sub    %rax,%r9
+  80121e:	78 36                	js     801256 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801220:	40 0f b6 c6          	movzbl %sil,%eax
+  801224:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80122b:	01 01 01 
+  80122e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801232:	40 f6 c7 07          	test   $0x7,%dil
+  801236:	75 38                	jne    801270 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801238:	4c 89 c9             	mov    %r9,%rcx
+  80123b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80123f:	74 0c                	je     80124d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801241:	fc                   	cld
+  801242:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801245:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801249:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80124d:	4d 85 c9             	test   %r9,%r9
+  801250:	75 45                	jne    801297 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801252:	4c 89 c0             	mov    %r8,%rax
+  801255:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801256:	48 85 d2             	test   %rdx,%rdx
+  801259:	74 f7                	je     801252 <memset+0x46>
+  80125b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80125e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801261:	48 83 c0 01          	add    $0x1,%rax
+  801265:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801269:	48 39 c2             	cmp    %rax,%rdx
+  80126c:	75 f3                	jne    801261 <memset+0x55>
+  80126e:	eb e2                	jmp    801252 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801270:	40 f6 c7 01          	test   $0x1,%dil
+  801274:	74 06                	je     80127c <memset+0x70>
+  801276:	88 07                	mov    %al,(%rdi)
+  801278:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80127c:	40 f6 c7 02          	test   $0x2,%dil
+  801280:	74 07                	je     801289 <memset+0x7d>
+  801282:	66 89 07             	mov    %ax,(%rdi)
+  801285:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801289:	40 f6 c7 04          	test   $0x4,%dil
+  80128d:	74 a9                	je     801238 <memset+0x2c>
+  80128f:	89 07                	mov    %eax,(%rdi)
+  801291:	48 83 c7 04          	add    $0x4,%rdi
+  801295:	eb a1                	jmp    801238 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801297:	41 f6 c1 04          	test   $0x4,%r9b
+  80129b:	74 06                	je     8012a3 <memset+0x97>
+  80129d:	89 07                	mov    %eax,(%rdi)
+  80129f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012a3:	41 f6 c1 02          	test   $0x2,%r9b
+  8012a7:	74 07                	je     8012b0 <memset+0xa4>
+  8012a9:	66 89 07             	mov    %ax,(%rdi)
+  8012ac:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012b0:	41 f6 c1 01          	test   $0x1,%r9b
+  8012b4:	74 9c                	je     801252 <memset+0x46>
+  8012b6:	88 07                	mov    %al,(%rdi)
+  8012b8:	eb 98                	jmp    801252 <memset+0x46>
+
+00000000008012ba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012ba:	48 89 f8             	mov    %rdi,%rax
+  8012bd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012c0:	48 39 fe             	cmp    %rdi,%rsi
+  8012c3:	73 3b                	jae    801300 <memmove+0x46>
+  8012c5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012c9:	48 39 d7             	cmp    %rdx,%rdi
+  8012cc:	73 32                	jae    801300 <memmove+0x46>
+        s += n;
+        d += n;
+  8012ce:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012d2:	48 89 d6             	mov    %rdx,%rsi
+  8012d5:	48 09 fe             	or     %rdi,%rsi
+  8012d8:	48 09 ce             	or     %rcx,%rsi
+  8012db:	40 f6 c6 07          	test   $0x7,%sil
+  8012df:	75 12                	jne    8012f3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012e1:	48 83 ef 08          	sub    $0x8,%rdi
+  8012e5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012e9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012ed:	fd                   	std
+  8012ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012f1:	fc                   	cld
+  8012f2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012f3:	48 83 ef 01          	sub    $0x1,%rdi
+  8012f7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012fb:	fd                   	std
+  8012fc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012fe:	eb f1                	jmp    8012f1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801300:	48 89 f2             	mov    %rsi,%rdx
+  801303:	48 09 c2             	or     %rax,%rdx
+  801306:	48 09 ca             	or     %rcx,%rdx
+  801309:	f6 c2 07             	test   $0x7,%dl
+  80130c:	75 0c                	jne    80131a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80130e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801312:	48 89 c7             	mov    %rax,%rdi
+  801315:	fc                   	cld
+  801316:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801319:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80131a:	48 89 c7             	mov    %rax,%rdi
+  80131d:	fc                   	cld
+  80131e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801320:	c3                   	ret
+
+0000000000801321 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801325:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+}
+  801331:	5d                   	pop    %rbp
+  801332:	c3                   	ret
+
+0000000000801333 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+  801337:	41 57                	push   %r15
+  801339:	41 56                	push   %r14
+  80133b:	41 55                	push   %r13
+  80133d:	41 54                	push   %r12
+  80133f:	53                   	push   %rbx
+  801340:	48 83 ec 08          	sub    $0x8,%rsp
+  801344:	49 89 fe             	mov    %rdi,%r14
+  801347:	49 89 f7             	mov    %rsi,%r15
+  80134a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80134d:	48 89 f7             	mov    %rsi,%rdi
+  801350:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  801357:	00 00 00 
+  80135a:	ff d0                	call   *%rax
+  80135c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80135f:	48 89 de             	mov    %rbx,%rsi
+  801362:	4c 89 f7             	mov    %r14,%rdi
+  801365:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  80136c:	00 00 00 
+  80136f:	ff d0                	call   *%rax
+  801371:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801374:	48 39 c3             	cmp    %rax,%rbx
+  801377:	74 36                	je     8013af <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801379:	48 89 d8             	mov    %rbx,%rax
+  80137c:	4c 29 e8             	sub    %r13,%rax
+  80137f:	49 39 c4             	cmp    %rax,%r12
+  801382:	73 31                	jae    8013b5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801384:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801389:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80138d:	4c 89 fe             	mov    %r15,%rsi
+  801390:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801397:	00 00 00 
+  80139a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80139c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013a0:	48 83 c4 08          	add    $0x8,%rsp
+  8013a4:	5b                   	pop    %rbx
+  8013a5:	41 5c                	pop    %r12
+  8013a7:	41 5d                	pop    %r13
+  8013a9:	41 5e                	pop    %r14
+  8013ab:	41 5f                	pop    %r15
+  8013ad:	5d                   	pop    %rbp
+  8013ae:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013af:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013b3:	eb eb                	jmp    8013a0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013b5:	48 83 eb 01          	sub    $0x1,%rbx
+  8013b9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013bd:	48 89 da             	mov    %rbx,%rdx
+  8013c0:	4c 89 fe             	mov    %r15,%rsi
+  8013c3:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8013ca:	00 00 00 
+  8013cd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013cf:	49 01 de             	add    %rbx,%r14
+  8013d2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013d7:	eb c3                	jmp    80139c <strlcat+0x69>
+
+00000000008013d9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013d9:	48 85 d2             	test   %rdx,%rdx
+  8013dc:	74 2d                	je     80140b <memcmp+0x32>
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013e3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013e7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013ec:	44 38 c1             	cmp    %r8b,%cl
+  8013ef:	75 0f                	jne    801400 <memcmp+0x27>
+    while (n-- > 0) {
+  8013f1:	48 83 c0 01          	add    $0x1,%rax
+  8013f5:	48 39 c2             	cmp    %rax,%rdx
+  8013f8:	75 e9                	jne    8013e3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ff:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801400:	0f b6 c1             	movzbl %cl,%eax
+  801403:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801407:	44 29 c0             	sub    %r8d,%eax
+  80140a:	c3                   	ret
+    return 0;
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801410:	c3                   	ret
+
+0000000000801411 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801411:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801415:	48 39 c7             	cmp    %rax,%rdi
+  801418:	73 0f                	jae    801429 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80141a:	40 38 37             	cmp    %sil,(%rdi)
+  80141d:	74 0e                	je     80142d <memfind+0x1c>
+    for (; src < end; src++) {
+  80141f:	48 83 c7 01          	add    $0x1,%rdi
+  801423:	48 39 f8             	cmp    %rdi,%rax
+  801426:	75 f2                	jne    80141a <memfind+0x9>
+  801428:	c3                   	ret
+  801429:	48 89 f8             	mov    %rdi,%rax
+  80142c:	c3                   	ret
+  80142d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801430:	c3                   	ret
+
+0000000000801431 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801431:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801434:	0f b6 37             	movzbl (%rdi),%esi
+  801437:	40 80 fe 20          	cmp    $0x20,%sil
+  80143b:	74 06                	je     801443 <strtol+0x12>
+  80143d:	40 80 fe 09          	cmp    $0x9,%sil
+  801441:	75 13                	jne    801456 <strtol+0x25>
+  801443:	48 83 c7 01          	add    $0x1,%rdi
+  801447:	0f b6 37             	movzbl (%rdi),%esi
+  80144a:	40 80 fe 20          	cmp    $0x20,%sil
+  80144e:	74 f3                	je     801443 <strtol+0x12>
+  801450:	40 80 fe 09          	cmp    $0x9,%sil
+  801454:	74 ed                	je     801443 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801456:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801459:	83 e0 fd             	and    $0xfffffffd,%eax
+  80145c:	3c 01                	cmp    $0x1,%al
+  80145e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801462:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801468:	75 0f                	jne    801479 <strtol+0x48>
+  80146a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80146d:	74 14                	je     801483 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80146f:	85 d2                	test   %edx,%edx
+  801471:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801476:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801479:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80147e:	4c 63 ca             	movslq %edx,%r9
+  801481:	eb 36                	jmp    8014b9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801483:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801487:	74 0f                	je     801498 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801489:	85 d2                	test   %edx,%edx
+  80148b:	75 ec                	jne    801479 <strtol+0x48>
+        s++;
+  80148d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801491:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801496:	eb e1                	jmp    801479 <strtol+0x48>
+        s += 2;
+  801498:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80149c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014a1:	eb d6                	jmp    801479 <strtol+0x48>
+            dig -= '0';
+  8014a3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014a6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014aa:	41 39 d0             	cmp    %edx,%r8d
+  8014ad:	7d 21                	jge    8014d0 <strtol+0x9f>
+        val = val * base + dig;
+  8014af:	49 0f af c1          	imul   %r9,%rax
+  8014b3:	0f b6 c9             	movzbl %cl,%ecx
+  8014b6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014b9:	48 83 c7 01          	add    $0x1,%rdi
+  8014bd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014c1:	80 f9 39             	cmp    $0x39,%cl
+  8014c4:	76 dd                	jbe    8014a3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014c6:	80 f9 7b             	cmp    $0x7b,%cl
+  8014c9:	77 05                	ja     8014d0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014cb:	83 e9 57             	sub    $0x57,%ecx
+  8014ce:	eb d6                	jmp    8014a6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014d0:	4d 85 d2             	test   %r10,%r10
+  8014d3:	74 03                	je     8014d8 <strtol+0xa7>
+  8014d5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014d8:	48 89 c2             	mov    %rax,%rdx
+  8014db:	48 f7 da             	neg    %rdx
+  8014de:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014e2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014e6:	c3                   	ret
+
+00000000008014e7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014e7:	55                   	push   %rbp
+  8014e8:	48 89 e5             	mov    %rsp,%rbp
+  8014eb:	53                   	push   %rbx
+  8014ec:	48 89 fa             	mov    %rdi,%rdx
+  8014ef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801501:	be 00 00 00 00       	mov    $0x0,%esi
+  801506:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80150e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+
+0000000000801514 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801519:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801523:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801543:	c9                   	leave
+  801544:	c3                   	ret
+
+0000000000801545 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801545:	55                   	push   %rbp
+  801546:	48 89 e5             	mov    %rsp,%rbp
+  801549:	53                   	push   %rbx
+  80154a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80154e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801551:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801556:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801560:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801565:	be 00 00 00 00       	mov    $0x0,%esi
+  80156a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801570:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801572:	48 85 c0             	test   %rax,%rax
+  801575:	7f 06                	jg     80157d <sys_env_destroy+0x38>
+}
+  801577:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157b:	c9                   	leave
+  80157c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157d:	49 89 c0             	mov    %rax,%r8
+  801580:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801585:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80158c:	00 00 00 
+  80158f:	be 26 00 00 00       	mov    $0x26,%esi
+  801594:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80159b:	00 00 00 
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a3:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8015aa:	00 00 00 
+  8015ad:	41 ff d1             	call   *%r9
+
+00000000008015b0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015b0:	55                   	push   %rbp
+  8015b1:	48 89 e5             	mov    %rsp,%rbp
+  8015b4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+00000000008015e1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801604:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80160c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+0000000000801612 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801612:	55                   	push   %rbp
+  801613:	48 89 e5             	mov    %rsp,%rbp
+  801616:	53                   	push   %rbx
+  801617:	48 89 fa             	mov    %rdi,%rdx
+  80161a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80161d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801622:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801629:	00 00 00 
+  80162c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80163e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+
+0000000000801644 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801644:	55                   	push   %rbp
+  801645:	48 89 e5             	mov    %rsp,%rbp
+  801648:	53                   	push   %rbx
+  801649:	49 89 f8             	mov    %rdi,%r8
+  80164c:	48 89 d3             	mov    %rdx,%rbx
+  80164f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801652:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801657:	4c 89 c2             	mov    %r8,%rdx
+  80165a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165d:	be 00 00 00 00       	mov    $0x0,%esi
+  801662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801668:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80166a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+
+0000000000801670 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801670:	55                   	push   %rbp
+  801671:	48 89 e5             	mov    %rsp,%rbp
+  801674:	53                   	push   %rbx
+  801675:	48 83 ec 08          	sub    $0x8,%rsp
+  801679:	89 f8                	mov    %edi,%eax
+  80167b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80167e:	48 63 f9             	movslq %ecx,%rdi
+  801681:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801684:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801689:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	be 00 00 00 00       	mov    $0x0,%esi
+  801691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801697:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801699:	48 85 c0             	test   %rax,%rax
+  80169c:	7f 06                	jg     8016a4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80169e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a4:	49 89 c0             	mov    %rax,%r8
+  8016a7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016ac:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8016b3:	00 00 00 
+  8016b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016bb:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8016c2:	00 00 00 
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ca:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8016d1:	00 00 00 
+  8016d4:	41 ff d1             	call   *%r9
+
+00000000008016d7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016d7:	55                   	push   %rbp
+  8016d8:	48 89 e5             	mov    %rsp,%rbp
+  8016db:	53                   	push   %rbx
+  8016dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e0:	89 f8                	mov    %edi,%eax
+  8016e2:	49 89 f2             	mov    %rsi,%r10
+  8016e5:	48 89 cf             	mov    %rcx,%rdi
+  8016e8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016eb:	48 63 da             	movslq %edx,%rbx
+  8016ee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fe:	48 85 c0             	test   %rax,%rax
+  801701:	7f 06                	jg     801709 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801703:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801709:	49 89 c0             	mov    %rax,%r8
+  80170c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801711:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801718:	00 00 00 
+  80171b:	be 26 00 00 00       	mov    $0x26,%esi
+  801720:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801727:	00 00 00 
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801736:	00 00 00 
+  801739:	41 ff d1             	call   *%r9
+
+000000000080173c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80173c:	55                   	push   %rbp
+  80173d:	48 89 e5             	mov    %rsp,%rbp
+  801740:	53                   	push   %rbx
+  801741:	48 83 ec 08          	sub    $0x8,%rsp
+  801745:	49 89 f9             	mov    %rdi,%r9
+  801748:	89 f0                	mov    %esi,%eax
+  80174a:	48 89 d3             	mov    %rdx,%rbx
+  80174d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801750:	49 63 f0             	movslq %r8d,%rsi
+  801753:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801756:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175b:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801764:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801766:	48 85 c0             	test   %rax,%rax
+  801769:	7f 06                	jg     801771 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80176b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176f:	c9                   	leave
+  801770:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801771:	49 89 c0             	mov    %rax,%r8
+  801774:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801779:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801780:	00 00 00 
+  801783:	be 26 00 00 00       	mov    $0x26,%esi
+  801788:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80178f:	00 00 00 
+  801792:	b8 00 00 00 00       	mov    $0x0,%eax
+  801797:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  80179e:	00 00 00 
+  8017a1:	41 ff d1             	call   *%r9
+
+00000000008017a4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017a4:	55                   	push   %rbp
+  8017a5:	48 89 e5             	mov    %rsp,%rbp
+  8017a8:	53                   	push   %rbx
+  8017a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ad:	48 89 f1             	mov    %rsi,%rcx
+  8017b0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017cd:	48 85 c0             	test   %rax,%rax
+  8017d0:	7f 06                	jg     8017d8 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d8:	49 89 c0             	mov    %rax,%r8
+  8017db:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8017e0:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8017e7:	00 00 00 
+  8017ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ef:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8017f6:	00 00 00 
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801805:	00 00 00 
+  801808:	41 ff d1             	call   *%r9
+
+000000000080180b <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80180b:	55                   	push   %rbp
+  80180c:	48 89 e5             	mov    %rsp,%rbp
+  80180f:	53                   	push   %rbx
+  801810:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801813:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801818:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801822:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801827:	be 00 00 00 00       	mov    $0x0,%esi
+  80182c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801832:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801834:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+
+000000000080183a <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80183a:	55                   	push   %rbp
+  80183b:	48 89 e5             	mov    %rsp,%rbp
+  80183e:	53                   	push   %rbx
+  80183f:	48 83 ec 08          	sub    $0x8,%rsp
+  801843:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801846:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801849:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801853:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801858:	be 00 00 00 00       	mov    $0x0,%esi
+  80185d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801863:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801865:	48 85 c0             	test   %rax,%rax
+  801868:	7f 06                	jg     801870 <sys_env_set_tls+0x36>
+}
+  80186a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186e:	c9                   	leave
+  80186f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801870:	49 89 c0             	mov    %rax,%r8
+  801873:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801878:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80187f:	00 00 00 
+  801882:	be 26 00 00 00       	mov    $0x26,%esi
+  801887:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80188e:	00 00 00 
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  80189d:	00 00 00 
+  8018a0:	41 ff d1             	call   *%r9
+
+00000000008018a3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+  8018a7:	53                   	push   %rbx
+  8018a8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018ac:	48 63 ce             	movslq %esi,%rcx
+  8018af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ce:	48 85 c0             	test   %rax,%rax
+  8018d1:	7f 06                	jg     8018d9 <sys_env_set_status+0x36>
+}
+  8018d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d9:	49 89 c0             	mov    %rax,%r8
+  8018dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8018e1:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8018e8:	00 00 00 
+  8018eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f0:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8018f7:	00 00 00 
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ff:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801906:	00 00 00 
+  801909:	41 ff d1             	call   *%r9
+
+000000000080190c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	53                   	push   %rbx
+  801911:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801915:	48 63 da             	movslq %edx,%rbx
+  801918:	48 63 ce             	movslq %esi,%rcx
+  80191b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80191e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801923:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801928:	be 00 00 00 00       	mov    $0x0,%esi
+  80192d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801933:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801935:	48 85 c0             	test   %rax,%rax
+  801938:	7f 06                	jg     801940 <sys_env_set_priority+0x34>
+}
+  80193a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80193e:	c9                   	leave
+  80193f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801940:	49 89 c0             	mov    %rax,%r8
+  801943:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801948:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  80194f:	00 00 00 
+  801952:	be 26 00 00 00       	mov    $0x26,%esi
+  801957:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  80195e:	00 00 00 
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+  801966:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  80196d:	00 00 00 
+  801970:	41 ff d1             	call   *%r9
+
+0000000000801973 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+  801977:	53                   	push   %rbx
+  801978:	48 83 ec 08          	sub    $0x8,%rsp
+  80197c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80197f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801982:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801987:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801991:	be 00 00 00 00       	mov    $0x0,%esi
+  801996:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80199e:	48 85 c0             	test   %rax,%rax
+  8019a1:	7f 06                	jg     8019a9 <sys_env_set_trapframe+0x36>
+}
+  8019a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a7:	c9                   	leave
+  8019a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019a9:	49 89 c0             	mov    %rax,%r8
+  8019ac:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019b1:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8019b8:	00 00 00 
+  8019bb:	be 26 00 00 00       	mov    $0x26,%esi
+  8019c0:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  8019c7:	00 00 00 
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cf:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8019d6:	00 00 00 
+  8019d9:	41 ff d1             	call   *%r9
+
+00000000008019dc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+  8019e0:	53                   	push   %rbx
+  8019e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8019e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a05:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a07:	48 85 c0             	test   %rax,%rax
+  801a0a:	7f 06                	jg     801a12 <sys_env_set_pgfault_upcall+0x36>
+}
+  801a0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a10:	c9                   	leave
+  801a11:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a12:	49 89 c0             	mov    %rax,%r8
+  801a15:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a1a:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801a21:	00 00 00 
+  801a24:	be 26 00 00 00       	mov    $0x26,%esi
+  801a29:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801a30:	00 00 00 
+  801a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a38:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801a3f:	00 00 00 
+  801a42:	41 ff d1             	call   *%r9
+
+0000000000801a45 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801a45:	55                   	push   %rbp
+  801a46:	48 89 e5             	mov    %rsp,%rbp
+  801a49:	53                   	push   %rbx
+  801a4a:	89 f8                	mov    %edi,%eax
+  801a4c:	49 89 f1             	mov    %rsi,%r9
+  801a4f:	48 89 d3             	mov    %rdx,%rbx
+  801a52:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a55:	49 63 f0             	movslq %r8d,%rsi
+  801a58:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a5b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a60:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a69:	cd 30                	int    $0x30
+}
+  801a6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a6f:	c9                   	leave
+  801a70:	c3                   	ret
+
+0000000000801a71 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	41 55                	push   %r13
+  801a77:	41 54                	push   %r12
+  801a79:	53                   	push   %rbx
+  801a7a:	89 f8                	mov    %edi,%eax
+  801a7c:	49 89 f2             	mov    %rsi,%r10
+  801a7f:	48 89 d3             	mov    %rdx,%rbx
+  801a82:	48 89 cf             	mov    %rcx,%rdi
+  801a85:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801a88:	49 63 f0             	movslq %r8d,%rsi
+  801a8b:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801a8e:	4d 85 c9             	test   %r9,%r9
+  801a91:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801a98:	00 00 00 
+  801a9b:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801a9f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aa4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  801aa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801aad:	4d 8b 0b             	mov    (%r11),%r9
+  801ab0:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801ab4:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ab8:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801abc:	cd 30                	int    $0x30
+}
+  801abe:	5b                   	pop    %rbx
+  801abf:	41 5c                	pop    %r12
+  801ac1:	41 5d                	pop    %r13
+  801ac3:	5d                   	pop    %rbp
+  801ac4:	c3                   	ret
+
+0000000000801ac5 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	53                   	push   %rbx
+  801aca:	48 89 fa             	mov    %rdi,%rdx
+  801acd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad0:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ada:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aea:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801aec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+
+0000000000801af2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801af2:	55                   	push   %rbp
+  801af3:	48 89 e5             	mov    %rsp,%rbp
+  801af6:	53                   	push   %rbx
+  801af7:	48 83 ec 08          	sub    $0x8,%rsp
+  801afb:	48 89 fa             	mov    %rdi,%rdx
+  801afe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b01:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b10:	be 00 00 00 00       	mov    $0x0,%esi
+  801b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b1b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b1d:	48 85 c0             	test   %rax,%rax
+  801b20:	7f 06                	jg     801b28 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b26:	c9                   	leave
+  801b27:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b28:	49 89 c0             	mov    %rax,%r8
+  801b2b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801b30:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801b37:	00 00 00 
+  801b3a:	be 26 00 00 00       	mov    $0x26,%esi
+  801b3f:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801b46:	00 00 00 
+  801b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4e:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801b55:	00 00 00 
+  801b58:	41 ff d1             	call   *%r9
+
+0000000000801b5b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801b5b:	55                   	push   %rbp
+  801b5c:	48 89 e5             	mov    %rsp,%rbp
+  801b5f:	41 55                	push   %r13
+  801b61:	41 54                	push   %r12
+  801b63:	53                   	push   %rbx
+  801b64:	89 f8                	mov    %edi,%eax
+  801b66:	49 89 f2             	mov    %rsi,%r10
+  801b69:	48 89 d3             	mov    %rdx,%rbx
+  801b6c:	48 89 cf             	mov    %rcx,%rdi
+  801b6f:	44 89 c6             	mov    %r8d,%esi
+  801b72:	4d 89 c8             	mov    %r9,%r8
+  801b75:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801b79:	48 63 f6             	movslq %esi,%rsi
+  801b7c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801b7f:	4d 85 db             	test   %r11,%r11
+  801b82:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801b89:	00 00 00 
+  801b8c:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801b90:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b95:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801b98:	4d 8b 0b             	mov    (%r11),%r9
+  801b9b:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801b9f:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801ba3:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801ba7:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ba9:	5b                   	pop    %rbx
+  801baa:	41 5c                	pop    %r12
+  801bac:	41 5d                	pop    %r13
+  801bae:	5d                   	pop    %rbp
+  801baf:	c3                   	ret
+
+0000000000801bb0 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801bb0:	55                   	push   %rbp
+  801bb1:	48 89 e5             	mov    %rsp,%rbp
+  801bb4:	41 55                	push   %r13
+  801bb6:	41 54                	push   %r12
+  801bb8:	53                   	push   %rbx
+  801bb9:	89 f8                	mov    %edi,%eax
+  801bbb:	49 89 f2             	mov    %rsi,%r10
+  801bbe:	48 89 d3             	mov    %rdx,%rbx
+  801bc1:	48 89 cf             	mov    %rcx,%rdi
+  801bc4:	44 89 c6             	mov    %r8d,%esi
+  801bc7:	4d 89 c8             	mov    %r9,%r8
+  801bca:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801bce:	48 63 f6             	movslq %esi,%rsi
+  801bd1:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801bd4:	4d 85 db             	test   %r11,%r11
+  801bd7:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801bde:	00 00 00 
+  801be1:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801be5:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bea:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801bed:	4d 8b 0b             	mov    (%r11),%r9
+  801bf0:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801bf4:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801bf8:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801bfc:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bfe:	5b                   	pop    %rbx
+  801bff:	41 5c                	pop    %r12
+  801c01:	41 5d                	pop    %r13
+  801c03:	5d                   	pop    %rbp
+  801c04:	c3                   	ret
+
+0000000000801c05 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801c05:	55                   	push   %rbp
+  801c06:	48 89 e5             	mov    %rsp,%rbp
+  801c09:	53                   	push   %rbx
+  801c0a:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0e:	48 89 f1             	mov    %rsi,%rcx
+  801c11:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c14:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c19:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c21:	be 00 00 00 00       	mov    $0x0,%esi
+  801c26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c2c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c2e:	48 85 c0             	test   %rax,%rax
+  801c31:	7f 06                	jg     801c39 <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c37:	c9                   	leave
+  801c38:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c39:	49 89 c0             	mov    %rax,%r8
+  801c3c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801c41:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  801c48:	00 00 00 
+  801c4b:	be 26 00 00 00       	mov    $0x26,%esi
+  801c50:	48 bf b7 56 80 00 00 	movabs $0x8056b7,%rdi
+  801c57:	00 00 00 
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5f:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  801c66:	00 00 00 
+  801c69:	41 ff d1             	call   *%r9
+
+0000000000801c6c <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	53                   	push   %rbx
+  801c71:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c74:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c79:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c88:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c93:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801c95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c99:	c9                   	leave
+  801c9a:	c3                   	ret
+
+0000000000801c9b <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801c9b:	55                   	push   %rbp
+  801c9c:	48 89 e5             	mov    %rsp,%rbp
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801ca3:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca5:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801caf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cbf:	cd 30                	int    $0x30
+}
+  801cc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+0000000000801cc7 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801cc7:	55                   	push   %rbp
+  801cc8:	48 89 e5             	mov    %rsp,%rbp
+  801ccb:	53                   	push   %rbx
+  801ccc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801ccf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cec:	cd 30                	int    $0x30
+}
+  801cee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf2:	c9                   	leave
+  801cf3:	c3                   	ret
+
+0000000000801cf4 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801cf4:	55                   	push   %rbp
+  801cf5:	48 89 e5             	mov    %rsp,%rbp
+  801cf8:	53                   	push   %rbx
+  801cf9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801cfc:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cfe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d03:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d16:	cd 30                	int    $0x30
+}
+  801d18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d1c:	c9                   	leave
+  801d1d:	c3                   	ret
+
+0000000000801d1e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801d1e:	55                   	push   %rbp
+  801d1f:	48 89 e5             	mov    %rsp,%rbp
+  801d22:	53                   	push   %rbx
+  801d23:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801d26:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d29:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d33:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d38:	be 00 00 00 00       	mov    $0x0,%esi
+  801d3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d43:	cd 30                	int    $0x30
+}
+  801d45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d49:	c9                   	leave
+  801d4a:	c3                   	ret
+
+0000000000801d4b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801d4b:	55                   	push   %rbp
+  801d4c:	48 89 e5             	mov    %rsp,%rbp
+  801d4f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d50:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d69:	be 00 00 00 00       	mov    $0x0,%esi
+  801d6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d74:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+0000000000801d7c <sys_monitor>:
+
+int sys_monitor(void) {
+  801d7c:	55                   	push   %rbp
+  801d7d:	48 89 e5             	mov    %rsp,%rbp
+  801d80:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d81:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d95:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801da5:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801da7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dab:	c9                   	leave
+  801dac:	c3                   	ret
+
+0000000000801dad <mutex_lock>:
+    MUTEX_CONTENDED, /* Locked, somebody might wait */
+};
+
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t expected, uint32_t desired) {
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db2:	ba 01 00 00 00       	mov    $0x1,%edx
+  801db7:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+}
+
+void
+mutex_lock(struct Mutex *m) {
+    uint32_t state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED);
+    if (state == MUTEX_UNLOCKED) return;
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	74 5a                	je     801e19 <mutex_lock+0x6c>
+mutex_lock(struct Mutex *m) {
+  801dbf:	55                   	push   %rbp
+  801dc0:	48 89 e5             	mov    %rsp,%rbp
+  801dc3:	41 54                	push   %r12
+  801dc5:	53                   	push   %rbx
+  801dc6:	48 89 fb             	mov    %rdi,%rbx
+  801dc9:	89 c2                	mov    %eax,%edx
+    /* Mark it contended before sleeping so that the owner wakes us,
+     * and keep it contended when taking it as others may still wait */
+    do {
+        if (state == MUTEX_CONTENDED ||
+            cmpxchg(&m->m_state, MUTEX_LOCKED, MUTEX_CONTENDED) != MUTEX_UNLOCKED)
+            sys_futex_wait(&m->m_state, MUTEX_CONTENDED, 0);
+  801dcb:	49 bc f4 1c 80 00 00 	movabs $0x801cf4,%r12
+  801dd2:	00 00 00 
+  801dd5:	eb 24                	jmp    801dfb <mutex_lock+0x4e>
+  801dd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ddc:	be 02 00 00 00       	mov    $0x2,%esi
+  801de1:	48 89 df             	mov    %rbx,%rdi
+  801de4:	41 ff d4             	call   *%r12
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	ba 02 00 00 00       	mov    $0x2,%edx
+  801df1:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+  801df5:	89 c2                	mov    %eax,%edx
+    } while ((state = cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_CONTENDED)) != MUTEX_UNLOCKED);
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	74 19                	je     801e14 <mutex_lock+0x67>
+        if (state == MUTEX_CONTENDED ||
+  801dfb:	83 fa 02             	cmp    $0x2,%edx
+  801dfe:	74 d7                	je     801dd7 <mutex_lock+0x2a>
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801e00:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e05:	ba 02 00 00 00       	mov    $0x2,%edx
+  801e0a:	f0 0f b1 13          	lock cmpxchg %edx,(%rbx)
+        if (state == MUTEX_CONTENDED ||
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	74 d5                	je     801de7 <mutex_lock+0x3a>
+  801e12:	eb c3                	jmp    801dd7 <mutex_lock+0x2a>
+}
+  801e14:	5b                   	pop    %rbx
+  801e15:	41 5c                	pop    %r12
+  801e17:	5d                   	pop    %rbp
+  801e18:	c3                   	ret
+  801e19:	c3                   	ret
+
+0000000000801e1a <mutex_trylock>:
+    __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+  801e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e24:	f0 0f b1 17          	lock cmpxchg %edx,(%rdi)
+
+bool
+mutex_trylock(struct Mutex *m) {
+    return cmpxchg(&m->m_state, MUTEX_UNLOCKED, MUTEX_LOCKED) == MUTEX_UNLOCKED;
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	0f 94 c0             	sete   %al
+}
+  801e2d:	c3                   	ret
+
+0000000000801e2e <mutex_unlock>:
+
+void
+mutex_unlock(struct Mutex *m) {
+    if (__atomic_exchange_n(&m->m_state, MUTEX_UNLOCKED, __ATOMIC_RELEASE) == MUTEX_CONTENDED)
+  801e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e33:	87 07                	xchg   %eax,(%rdi)
+  801e35:	83 f8 02             	cmp    $0x2,%eax
+  801e38:	74 01                	je     801e3b <mutex_unlock+0xd>
+  801e3a:	c3                   	ret
+mutex_unlock(struct Mutex *m) {
+  801e3b:	55                   	push   %rbp
+  801e3c:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(&m->m_state, 1);
+  801e3f:	be 01 00 00 00       	mov    $0x1,%esi
+  801e44:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+}
+  801e50:	5d                   	pop    %rbp
+  801e51:	c3                   	ret
+
+0000000000801e52 <cond_wait>:
+
+/* Release 'm', wait until cond_signal() or cond_broadcast()
+ * and lock 'm' again.  Wakeups may be spurious */
+void
+cond_wait(struct Cond *c, struct Mutex *m) {
+  801e52:	55                   	push   %rbp
+  801e53:	48 89 e5             	mov    %rsp,%rbp
+  801e56:	41 55                	push   %r13
+  801e58:	41 54                	push   %r12
+  801e5a:	53                   	push   %rbx
+  801e5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5f:	49 89 fc             	mov    %rdi,%r12
+  801e62:	48 89 f3             	mov    %rsi,%rbx
+    uint32_t seq = __atomic_load_n(&c->c_seq, __ATOMIC_RELAXED);
+  801e65:	44 8b 2f             	mov    (%rdi),%r13d
+
+    mutex_unlock(m);
+  801e68:	48 89 f7             	mov    %rsi,%rdi
+  801e6b:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  801e72:	00 00 00 
+  801e75:	ff d0                	call   *%rax
+    sys_futex_wait(&c->c_seq, seq, 0);
+  801e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7c:	44 89 ee             	mov    %r13d,%esi
+  801e7f:	4c 89 e7             	mov    %r12,%rdi
+  801e82:	48 b8 f4 1c 80 00 00 	movabs $0x801cf4,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+    mutex_lock(m);
+  801e8e:	48 89 df             	mov    %rbx,%rdi
+  801e91:	48 b8 ad 1d 80 00 00 	movabs $0x801dad,%rax
+  801e98:	00 00 00 
+  801e9b:	ff d0                	call   *%rax
+}
+  801e9d:	48 83 c4 08          	add    $0x8,%rsp
+  801ea1:	5b                   	pop    %rbx
+  801ea2:	41 5c                	pop    %r12
+  801ea4:	41 5d                	pop    %r13
+  801ea6:	5d                   	pop    %rbp
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <cond_signal>:
+
+void
+cond_signal(struct Cond *c) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  801eac:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, 1);
+  801eb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801eb5:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801ebc:	00 00 00 
+  801ebf:	ff d0                	call   *%rax
+}
+  801ec1:	5d                   	pop    %rbp
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <cond_broadcast>:
+
+void
+cond_broadcast(struct Cond *c) {
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+    __atomic_add_fetch(&c->c_seq, 1, __ATOMIC_RELEASE);
+  801ec7:	f0 83 07 01          	lock addl $0x1,(%rdi)
+    sys_futex_wake(&c->c_seq, NENV);
+  801ecb:	be 00 04 00 00       	mov    $0x400,%esi
+  801ed0:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801ed7:	00 00 00 
+  801eda:	ff d0                	call   *%rax
+}
+  801edc:	5d                   	pop    %rbp
+  801edd:	c3                   	ret
+
+0000000000801ede <thread_exit>:
+
+/* Finish the calling thread, thread_join() returns 'res'.
+ * Unlike exit() this leaves file descriptors open,
+ * they are shared with other threads. */
+_Noreturn void
+thread_exit(void *res) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801ee9:	00 00 
+    thread_tcb()->tcb_res = res;
+  801eeb:	48 89 78 20          	mov    %rdi,0x20(%rax)
+    sys_env_destroy(CURENVID);
+  801eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef4:	48 b8 45 15 80 00 00 	movabs $0x801545,%rax
+  801efb:	00 00 00 
+  801efe:	ff d0                	call   *%rax
+    panic("thread_exit: still running");
+  801f00:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801f07:	00 00 00 
+  801f0a:	be 27 00 00 00       	mov    $0x27,%esi
+  801f0f:	48 bf 1b 57 80 00 00 	movabs $0x80571b,%rdi
+  801f16:	00 00 00 
+  801f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1e:	48 b9 4b 06 80 00 00 	movabs $0x80064b,%rcx
+  801f25:	00 00 00 
+  801f28:	ff d1                	call   *%rcx
+
+0000000000801f2a <thread_start>:
+thread_start(struct Tcb *tcb) {
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	48 89 f8             	mov    %rdi,%rax
+    thread_exit(tcb->tcb_func(tcb->tcb_arg));
+  801f31:	48 8b 7f 18          	mov    0x18(%rdi),%rdi
+  801f35:	ff 50 10             	call   *0x10(%rax)
+  801f38:	48 89 c7             	mov    %rax,%rdi
+  801f3b:	48 b8 de 1e 80 00 00 	movabs $0x801ede,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+
+0000000000801f47 <thread_create>:
+}
+
+/* Start a thread running func(arg) in our address space.
+ * Returns its envid or < 0 on error. */
+envid_t
+thread_create(void *(*func)(void *), void *arg) {
+  801f47:	55                   	push   %rbp
+  801f48:	48 89 e5             	mov    %rsp,%rbp
+  801f4b:	41 57                	push   %r15
+  801f4d:	41 56                	push   %r14
+  801f4f:	41 55                	push   %r13
+  801f51:	41 54                	push   %r12
+  801f53:	53                   	push   %rbx
+  801f54:	48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+  801f5b:	49 89 ff             	mov    %rdi,%r15
+  801f5e:	48 89 b5 08 ff ff ff 	mov    %rsi,-0xf8(%rbp)
+    mutex_lock(&thread_lock);
+  801f65:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  801f6c:	00 00 00 
+  801f6f:	48 b8 ad 1d 80 00 00 	movabs $0x801dad,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+
+    size_t i = 0;
+  801f7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (i < THREAD_MAX && thread_ids[i]) i++;
+  801f80:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801f87:	00 00 00 
+  801f8a:	83 3c 98 00          	cmpl   $0x0,(%rax,%rbx,4)
+  801f8e:	74 2b                	je     801fbb <thread_create+0x74>
+  801f90:	48 83 c3 01          	add    $0x1,%rbx
+  801f94:	48 83 fb 40          	cmp    $0x40,%rbx
+  801f98:	75 f0                	jne    801f8a <thread_create+0x43>
+    if (i == THREAD_MAX) {
+        mutex_unlock(&thread_lock);
+  801f9a:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  801fa1:	00 00 00 
+  801fa4:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  801fab:	00 00 00 
+  801fae:	ff d0                	call   *%rax
+        return -E_NO_FREE_ENV;
+  801fb0:	41 bc fb ff ff ff    	mov    $0xfffffffb,%r12d
+  801fb6:	e9 c8 01 00 00       	jmp    802183 <thread_create+0x23c>
+    if (i == THREAD_MAX) {
+  801fbb:	48 83 fb 40          	cmp    $0x40,%rbx
+  801fbf:	74 d9                	je     801f9a <thread_create+0x53>
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  801fc1:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  801fc5:	4c 8d 34 43          	lea    (%rbx,%rax,2),%r14
+  801fc9:	49 c1 e6 0c          	shl    $0xc,%r14
+  801fcd:	49 bd 00 00 00 00 70 	movabs $0x7000000000,%r13
+  801fd4:	00 00 00 
+  801fd7:	4d 01 f5             	add    %r14,%r13
+    }
+
+    char *slot = thread_slot(i);
+    int res = sys_alloc_region(0, slot + PAGE_SIZE, PAGE_SIZE, PROT_RW);
+  801fda:	49 8d b5 00 10 00 00 	lea    0x1000(%r13),%rsi
+  801fe1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801fe6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ff0:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+  801ffc:	41 89 c4             	mov    %eax,%r12d
+    if (res >= 0) res = sys_alloc_region(0, slot + 3 * PAGE_SIZE, THREAD_STACK_SIZE, PROT_RW);
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	0f 88 4d 01 00 00    	js     802154 <thread_create+0x20d>
+  802007:	49 8d b5 00 30 00 00 	lea    0x3000(%r13),%rsi
+  80200e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802013:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201d:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+  802029:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	0f 88 20 01 00 00    	js     802154 <thread_create+0x20d>
+
+    envid_t id = sys_exothread(slot + 2 * PAGE_SIZE);
+  802034:	49 8d bd 00 20 00 00 	lea    0x2000(%r13),%rdi
+  80203b:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	41 89 c4             	mov    %eax,%r12d
+    if ((res = id) < 0) goto error;
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	0f 88 02 01 00 00    	js     802154 <thread_create+0x20d>
+    return (struct Tcb *)ROUNDDOWN((uintptr_t)thread_slot(i + 1) - sizeof(struct Tcb), 16);
+  802052:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  802059:	00 00 00 
+  80205c:	4d 8d b4 06 d0 2f 01 	lea    0x12fd0(%r14,%rax,1),%r14
+  802063:	00 
+
+    struct Tcb *tcb = thread_slot_tcb(i);
+    *tcb = (struct Tcb){
+  802064:	49 c7 46 20 00 00 00 	movq   $0x0,0x20(%r14)
+  80206b:	00 
+  80206c:	4d 89 36             	mov    %r14,(%r14)
+            .tcb_self = tcb,
+            .tcb_env = &envs[ENVX(id)],
+  80206f:	44 89 e6             	mov    %r12d,%esi
+  802072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802078:	48 69 f6 98 01 00 00 	imul   $0x198,%rsi,%rsi
+  80207f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  802086:	00 00 00 
+  802089:	48 01 c6             	add    %rax,%rsi
+  80208c:	49 89 76 08          	mov    %rsi,0x8(%r14)
+    *tcb = (struct Tcb){
+  802090:	4d 89 7e 10          	mov    %r15,0x10(%r14)
+  802094:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80209b:	49 89 46 18          	mov    %rax,0x18(%r14)
+            .tcb_func = func,
+            .tcb_arg = arg,
+    };
+
+    /* Enter thread_start() as if it was called */
+    struct Trapframe tf = envs[ENVX(id)].env_tf;
+  80209f:	48 8d bd 10 ff ff ff 	lea    -0xf0(%rbp),%rdi
+  8020a6:	b9 18 00 00 00       	mov    $0x18,%ecx
+  8020ab:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    tf.tf_rip = (uintptr_t)thread_start;
+  8020ae:	48 b8 2a 1f 80 00 00 	movabs $0x801f2a,%rax
+  8020b5:	00 00 00 
+  8020b8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    tf.tf_rsp = (uintptr_t)tcb - sizeof(uintptr_t);
+  8020bc:	49 8d 46 f8          	lea    -0x8(%r14),%rax
+  8020c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    tf.tf_regs.reg_rdi = (uintptr_t)tcb;
+  8020c4:	4c 89 b5 58 ff ff ff 	mov    %r14,-0xa8(%rbp)
+    if ((res = sys_env_set_trapframe(id, &tf)) < 0 ||
+  8020cb:	48 8d b5 10 ff ff ff 	lea    -0xf0(%rbp),%rsi
+  8020d2:	44 89 e7             	mov    %r12d,%edi
+  8020d5:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	41 89 c7             	mov    %eax,%r15d
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 5a                	js     802142 <thread_create+0x1fb>
+        (res = sys_env_set_tls(id, tcb)) < 0 ||
+  8020e8:	4c 89 f6             	mov    %r14,%rsi
+  8020eb:	44 89 e7             	mov    %r12d,%edi
+  8020ee:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	41 89 c7             	mov    %eax,%r15d
+    if ((res = sys_env_set_trapframe(id, &tf)) < 0 ||
+  8020fd:	85 c0                	test   %eax,%eax
+  8020ff:	78 41                	js     802142 <thread_create+0x1fb>
+        (res = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  802101:	be 02 00 00 00       	mov    $0x2,%esi
+  802106:	44 89 e7             	mov    %r12d,%edi
+  802109:	48 b8 a3 18 80 00 00 	movabs $0x8018a3,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+  802115:	41 89 c7             	mov    %eax,%r15d
+        (res = sys_env_set_tls(id, tcb)) < 0 ||
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 26                	js     802142 <thread_create+0x1fb>
+        sys_env_destroy(id);
+        goto error;
+    }
+
+    thread_ids[i] = id;
+  80211c:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802123:	00 00 00 
+  802126:	44 89 24 98          	mov    %r12d,(%rax,%rbx,4)
+    mutex_unlock(&thread_lock);
+  80212a:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  802131:	00 00 00 
+  802134:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+    return id;
+  802140:	eb 41                	jmp    802183 <thread_create+0x23c>
+        sys_env_destroy(id);
+  802142:	44 89 e7             	mov    %r12d,%edi
+  802145:	48 b8 45 15 80 00 00 	movabs $0x801545,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+        goto error;
+  802151:	45 89 fc             	mov    %r15d,%r12d
+
+error:
+    sys_unmap_region(0, slot, THREAD_SLOT);
+  802154:	ba 00 30 01 00       	mov    $0x13000,%edx
+  802159:	4c 89 ee             	mov    %r13,%rsi
+  80215c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802161:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+    mutex_unlock(&thread_lock);
+  80216d:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  802174:	00 00 00 
+  802177:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+    return res;
+}
+  802183:	44 89 e0             	mov    %r12d,%eax
+  802186:	48 81 c4 d8 00 00 00 	add    $0xd8,%rsp
+  80218d:	5b                   	pop    %rbx
+  80218e:	41 5c                	pop    %r12
+  802190:	41 5d                	pop    %r13
+  802192:	41 5e                	pop    %r14
+  802194:	41 5f                	pop    %r15
+  802196:	5d                   	pop    %rbp
+  802197:	c3                   	ret
+
+0000000000802198 <thread_join>:
+
+/* Wait for 'thread' made by thread_create() to finish, store
+ * the value it returned into '*res' and release its stacks.
+ * Returns 0 on success, -E_BAD_ENV if there is no such thread. */
+int
+thread_join(envid_t thread, void **res) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+  80219c:	41 55                	push   %r13
+  80219e:	41 54                	push   %r12
+  8021a0:	53                   	push   %rbx
+  8021a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a5:	41 89 fc             	mov    %edi,%r12d
+  8021a8:	49 89 f5             	mov    %rsi,%r13
+    mutex_lock(&thread_lock);
+  8021ab:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  8021b2:	00 00 00 
+  8021b5:	48 b8 ad 1d 80 00 00 	movabs $0x801dad,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+    size_t i = 0;
+  8021c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (i < THREAD_MAX && thread_ids[i] != thread) i++;
+  8021c6:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8021cd:	00 00 00 
+  8021d0:	44 39 24 98          	cmp    %r12d,(%rax,%rbx,4)
+  8021d4:	74 2a                	je     802200 <thread_join+0x68>
+  8021d6:	48 83 c3 01          	add    $0x1,%rbx
+  8021da:	48 83 fb 40          	cmp    $0x40,%rbx
+  8021de:	75 f0                	jne    8021d0 <thread_join+0x38>
+    mutex_unlock(&thread_lock);
+  8021e0:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  8021e7:	00 00 00 
+  8021ea:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  8021f1:	00 00 00 
+  8021f4:	ff d0                	call   *%rax
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  8021f6:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8021fb:	e9 cd 00 00 00       	jmp    8022cd <thread_join+0x135>
+    mutex_unlock(&thread_lock);
+  802200:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  802207:	00 00 00 
+  80220a:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  802216:	45 85 e4             	test   %r12d,%r12d
+  802219:	0f 84 b9 00 00 00    	je     8022d8 <thread_join+0x140>
+  80221f:	48 83 fb 40          	cmp    $0x40,%rbx
+  802223:	0f 84 af 00 00 00    	je     8022d8 <thread_join+0x140>
+
+    wait(thread);
+  802229:	44 89 e7             	mov    %r12d,%edi
+  80222c:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+    if (res) *res = thread_slot_tcb(i)->tcb_res;
+  802238:	4d 85 ed             	test   %r13,%r13
+  80223b:	74 23                	je     802260 <thread_join+0xc8>
+    return (struct Tcb *)ROUNDDOWN((uintptr_t)thread_slot(i + 1) - sizeof(struct Tcb), 16);
+  80223d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  802241:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  802245:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  802249:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (res) *res = thread_slot_tcb(i)->tcb_res;
+  80224d:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  802254:	00 00 00 
+  802257:	48 8b 44 10 f0       	mov    -0x10(%rax,%rdx,1),%rax
+  80225c:	49 89 45 00          	mov    %rax,0x0(%r13)
+
+    mutex_lock(&thread_lock);
+  802260:	49 bc 20 71 80 00 00 	movabs $0x807120,%r12
+  802267:	00 00 00 
+  80226a:	4c 89 e7             	mov    %r12,%rdi
+  80226d:	48 b8 ad 1d 80 00 00 	movabs $0x801dad,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+    return (char *)THREAD_BASE + i * THREAD_SLOT;
+  802279:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  80227d:	48 8d 34 43          	lea    (%rbx,%rax,2),%rsi
+  802281:	48 c1 e6 0c          	shl    $0xc,%rsi
+  802285:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  80228c:	00 00 00 
+  80228f:	48 01 c6             	add    %rax,%rsi
+    sys_unmap_region(0, thread_slot(i), THREAD_SLOT);
+  802292:	ba 00 30 01 00       	mov    $0x13000,%edx
+  802297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229c:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+    thread_ids[i] = 0;
+  8022a8:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8022af:	00 00 00 
+  8022b2:	c7 04 98 00 00 00 00 	movl   $0x0,(%rax,%rbx,4)
+    mutex_unlock(&thread_lock);
+  8022b9:	4c 89 e7             	mov    %r12,%rdi
+  8022bc:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+    return 0;
+  8022c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022cd:	48 83 c4 08          	add    $0x8,%rsp
+  8022d1:	5b                   	pop    %rbx
+  8022d2:	41 5c                	pop    %r12
+  8022d4:	41 5d                	pop    %r13
+  8022d6:	5d                   	pop    %rbp
+  8022d7:	c3                   	ret
+    if (!thread || i == THREAD_MAX) return -E_BAD_ENV;
+  8022d8:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8022dd:	eb ee                	jmp    8022cd <thread_join+0x135>
+
+00000000008022df <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022df:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022e6:	ff ff ff 
+  8022e9:	48 01 f8             	add    %rdi,%rax
+  8022ec:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022f0:	c3                   	ret
+
+00000000008022f1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022f1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022f8:	ff ff ff 
+  8022fb:	48 01 f8             	add    %rdi,%rax
+  8022fe:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802302:	48 c1 e0 12          	shl    $0x12,%rax
+  802306:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80230b:	48 01 d0             	add    %rdx,%rax
+}
+  80230e:	c3                   	ret
+
+000000000080230f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80230f:	55                   	push   %rbp
+  802310:	48 89 e5             	mov    %rsp,%rbp
+  802313:	41 57                	push   %r15
+  802315:	41 56                	push   %r14
+  802317:	41 55                	push   %r13
+  802319:	41 54                	push   %r12
+  80231b:	53                   	push   %rbx
+  80231c:	48 83 ec 08          	sub    $0x8,%rsp
+  802320:	49 89 ff             	mov    %rdi,%r15
+  802323:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802328:	49 bd c0 40 80 00 00 	movabs $0x8040c0,%r13
+  80232f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802332:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802338:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80233b:	48 89 df             	mov    %rbx,%rdi
+  80233e:	41 ff d5             	call   *%r13
+  802341:	83 e0 04             	and    $0x4,%eax
+  802344:	74 17                	je     80235d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802346:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80234d:	4c 39 f3             	cmp    %r14,%rbx
+  802350:	75 e6                	jne    802338 <fd_alloc+0x29>
+  802352:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802358:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80235d:	4d 89 27             	mov    %r12,(%r15)
+}
+  802360:	48 83 c4 08          	add    $0x8,%rsp
+  802364:	5b                   	pop    %rbx
+  802365:	41 5c                	pop    %r12
+  802367:	41 5d                	pop    %r13
+  802369:	41 5e                	pop    %r14
+  80236b:	41 5f                	pop    %r15
+  80236d:	5d                   	pop    %rbp
+  80236e:	c3                   	ret
+
+000000000080236f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80236f:	83 ff 1f             	cmp    $0x1f,%edi
+  802372:	77 39                	ja     8023ad <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+  802378:	41 54                	push   %r12
+  80237a:	53                   	push   %rbx
+  80237b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80237e:	48 63 df             	movslq %edi,%rbx
+  802381:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802388:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80238c:	48 89 df             	mov    %rbx,%rdi
+  80238f:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+  80239b:	a8 04                	test   $0x4,%al
+  80239d:	74 14                	je     8023b3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80239f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8023a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023a8:	5b                   	pop    %rbx
+  8023a9:	41 5c                	pop    %r12
+  8023ab:	5d                   	pop    %rbp
+  8023ac:	c3                   	ret
+        return -E_INVAL;
+  8023ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8023b2:	c3                   	ret
+        return -E_INVAL;
+  8023b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023b8:	eb ee                	jmp    8023a8 <fd_lookup+0x39>
+
+00000000008023ba <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8023ba:	55                   	push   %rbp
+  8023bb:	48 89 e5             	mov    %rsp,%rbp
+  8023be:	41 54                	push   %r12
+  8023c0:	53                   	push   %rbx
+  8023c1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8023c4:	48 b8 c0 57 80 00 00 	movabs $0x8057c0,%rax
+  8023cb:	00 00 00 
+  8023ce:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023d5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023d8:	39 3b                	cmp    %edi,(%rbx)
+  8023da:	74 4a                	je     802426 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023dc:	48 83 c0 08          	add    $0x8,%rax
+  8023e0:	48 8b 18             	mov    (%rax),%rbx
+  8023e3:	48 85 db             	test   %rbx,%rbx
+  8023e6:	75 f0                	jne    8023d8 <dev_lookup+0x1e>
+  8023e8:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8023ef:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8023f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023fb:	89 fa                	mov    %edi,%edx
+  8023fd:	48 bf 28 57 80 00 00 	movabs $0x805728,%rdi
+  802404:	00 00 00 
+  802407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240c:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802413:	00 00 00 
+  802416:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802418:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80241d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802421:	5b                   	pop    %rbx
+  802422:	41 5c                	pop    %r12
+  802424:	5d                   	pop    %rbp
+  802425:	c3                   	ret
+            return 0;
+  802426:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242b:	eb f0                	jmp    80241d <dev_lookup+0x63>
+
+000000000080242d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80242d:	55                   	push   %rbp
+  80242e:	48 89 e5             	mov    %rsp,%rbp
+  802431:	41 55                	push   %r13
+  802433:	41 54                	push   %r12
+  802435:	53                   	push   %rbx
+  802436:	48 83 ec 18          	sub    $0x18,%rsp
+  80243a:	48 89 fb             	mov    %rdi,%rbx
+  80243d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802440:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802447:	ff ff ff 
+  80244a:	48 01 df             	add    %rbx,%rdi
+  80244d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802451:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802455:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	41 89 c5             	mov    %eax,%r13d
+  802464:	85 c0                	test   %eax,%eax
+  802466:	78 06                	js     80246e <fd_close+0x41>
+  802468:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80246c:	74 1a                	je     802488 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80246e:	45 84 e4             	test   %r12b,%r12b
+  802471:	b8 00 00 00 00       	mov    $0x0,%eax
+  802476:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80247a:	44 89 e8             	mov    %r13d,%eax
+  80247d:	48 83 c4 18          	add    $0x18,%rsp
+  802481:	5b                   	pop    %rbx
+  802482:	41 5c                	pop    %r12
+  802484:	41 5d                	pop    %r13
+  802486:	5d                   	pop    %rbp
+  802487:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802488:	8b 3b                	mov    (%rbx),%edi
+  80248a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80248e:	48 b8 ba 23 80 00 00 	movabs $0x8023ba,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+  80249a:	41 89 c5             	mov    %eax,%r13d
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 1b                	js     8024bc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8024a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024a5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8024a9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8024af:	48 85 c0             	test   %rax,%rax
+  8024b2:	74 08                	je     8024bc <fd_close+0x8f>
+  8024b4:	48 89 df             	mov    %rbx,%rdi
+  8024b7:	ff d0                	call   *%rax
+  8024b9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024c1:	48 89 de             	mov    %rbx,%rsi
+  8024c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c9:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+    return res;
+  8024d5:	eb a3                	jmp    80247a <fd_close+0x4d>
+
+00000000008024d7 <close>:
+
+int
+close(int fdnum) {
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024df:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024e3:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024ef:	85 c0                	test   %eax,%eax
+  8024f1:	78 15                	js     802508 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024fc:	48 b8 2d 24 80 00 00 	movabs $0x80242d,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+}
+  802508:	c9                   	leave
+  802509:	c3                   	ret
+
+000000000080250a <close_all>:
+
+void
+close_all(void) {
+  80250a:	55                   	push   %rbp
+  80250b:	48 89 e5             	mov    %rsp,%rbp
+  80250e:	41 54                	push   %r12
+  802510:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802516:	49 bc d7 24 80 00 00 	movabs $0x8024d7,%r12
+  80251d:	00 00 00 
+  802520:	89 df                	mov    %ebx,%edi
+  802522:	41 ff d4             	call   *%r12
+  802525:	83 c3 01             	add    $0x1,%ebx
+  802528:	83 fb 20             	cmp    $0x20,%ebx
+  80252b:	75 f3                	jne    802520 <close_all+0x16>
+}
+  80252d:	5b                   	pop    %rbx
+  80252e:	41 5c                	pop    %r12
+  802530:	5d                   	pop    %rbp
+  802531:	c3                   	ret
+
+0000000000802532 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802532:	55                   	push   %rbp
+  802533:	48 89 e5             	mov    %rsp,%rbp
+  802536:	41 57                	push   %r15
+  802538:	41 56                	push   %r14
+  80253a:	41 55                	push   %r13
+  80253c:	41 54                	push   %r12
+  80253e:	53                   	push   %rbx
+  80253f:	48 83 ec 38          	sub    $0x38,%rsp
+  802543:	41 89 f7             	mov    %esi,%r15d
+  802546:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802549:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80254d:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	89 c3                	mov    %eax,%ebx
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	0f 88 ec 00 00 00    	js     80264f <dup+0x11d>
+    close(newfdnum);
+  802563:	44 89 ff             	mov    %r15d,%edi
+  802566:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802572:	49 63 c7             	movslq %r15d,%rax
+  802575:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80257b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80257f:	49 89 c6             	mov    %rax,%r14
+  802582:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  802586:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80258a:	4c 89 ff             	mov    %r15,%rdi
+  80258d:	48 bb f1 22 80 00 00 	movabs $0x8022f1,%rbx
+  802594:	00 00 00 
+  802597:	ff d3                	call   *%rbx
+  802599:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  80259c:	4c 89 f7             	mov    %r14,%rdi
+  80259f:	ff d3                	call   *%rbx
+  8025a1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  8025a5:	4c 89 e7             	mov    %r12,%rdi
+  8025a8:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  8025b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  8025bc:	49 be c0 40 80 00 00 	movabs $0x8040c0,%r14
+  8025c3:	00 00 00 
+  8025c6:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  8025ca:	41 ff d6             	call   *%r14
+  8025cd:	44 39 e8             	cmp    %r13d,%eax
+  8025d0:	75 10                	jne    8025e2 <dup+0xb0>
+  8025d2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025d9:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  8025e0:	75 e4                	jne    8025c6 <dup+0x94>
+    if (prot & PROT_R) {
+  8025e2:	41 f6 c5 04          	test   $0x4,%r13b
+  8025e6:	74 29                	je     802611 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  8025e8:	45 89 e9             	mov    %r13d,%r9d
+  8025eb:	49 89 d8             	mov    %rbx,%r8
+  8025ee:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8025f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f7:	4c 89 e6             	mov    %r12,%rsi
+  8025fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ff:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  802606:	00 00 00 
+  802609:	ff d0                	call   *%rax
+  80260b:	89 c3                	mov    %eax,%ebx
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	78 4f                	js     802660 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  802611:	4c 89 ff             	mov    %r15,%rdi
+  802614:	48 b8 c0 40 80 00 00 	movabs $0x8040c0,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802623:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802629:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  80262d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802632:	4c 89 fe             	mov    %r15,%rsi
+  802635:	bf 00 00 00 00       	mov    $0x0,%edi
+  80263a:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  802646:	89 c3                	mov    %eax,%ebx
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	78 14                	js     802660 <dup+0x12e>
+
+    return newfdnum;
+  80264c:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  80264f:	89 d8                	mov    %ebx,%eax
+  802651:	48 83 c4 38          	add    $0x38,%rsp
+  802655:	5b                   	pop    %rbx
+  802656:	41 5c                	pop    %r12
+  802658:	41 5d                	pop    %r13
+  80265a:	41 5e                	pop    %r14
+  80265c:	41 5f                	pop    %r15
+  80265e:	5d                   	pop    %rbp
+  80265f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802660:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802665:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266e:	49 bc a4 17 80 00 00 	movabs $0x8017a4,%r12
+  802675:	00 00 00 
+  802678:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  80267b:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802680:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802684:	bf 00 00 00 00       	mov    $0x0,%edi
+  802689:	41 ff d4             	call   *%r12
+    return res;
+  80268c:	eb c1                	jmp    80264f <dup+0x11d>
+
+000000000080268e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80268e:	55                   	push   %rbp
+  80268f:	48 89 e5             	mov    %rsp,%rbp
+  802692:	41 56                	push   %r14
+  802694:	41 55                	push   %r13
+  802696:	41 54                	push   %r12
+  802698:	53                   	push   %rbx
+  802699:	48 83 ec 10          	sub    $0x10,%rsp
+  80269d:	89 fb                	mov    %edi,%ebx
+  80269f:	49 89 f4             	mov    %rsi,%r12
+  8026a2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026a9:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8026b0:	00 00 00 
+  8026b3:	ff d0                	call   *%rax
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	78 4c                	js     802705 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026b9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8026bd:	41 8b 3e             	mov    (%r14),%edi
+  8026c0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026c4:	48 b8 ba 23 80 00 00 	movabs $0x8023ba,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+  8026d0:	85 c0                	test   %eax,%eax
+  8026d2:	78 35                	js     802709 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026d4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8026d8:	83 e0 03             	and    $0x3,%eax
+  8026db:	83 f8 01             	cmp    $0x1,%eax
+  8026de:	74 2d                	je     80270d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026e4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026e8:	48 85 c0             	test   %rax,%rax
+  8026eb:	74 59                	je     802746 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8026ed:	4c 89 ea             	mov    %r13,%rdx
+  8026f0:	4c 89 e6             	mov    %r12,%rsi
+  8026f3:	4c 89 f7             	mov    %r14,%rdi
+  8026f6:	ff d0                	call   *%rax
+}
+  8026f8:	48 83 c4 10          	add    $0x10,%rsp
+  8026fc:	5b                   	pop    %rbx
+  8026fd:	41 5c                	pop    %r12
+  8026ff:	41 5d                	pop    %r13
+  802701:	41 5e                	pop    %r14
+  802703:	5d                   	pop    %rbp
+  802704:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802705:	48 98                	cltq
+  802707:	eb ef                	jmp    8026f8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802709:	48 98                	cltq
+  80270b:	eb eb                	jmp    8026f8 <read+0x6a>
+  80270d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802714:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802716:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80271a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802720:	89 da                	mov    %ebx,%edx
+  802722:	48 bf 69 57 80 00 00 	movabs $0x805769,%rdi
+  802729:	00 00 00 
+  80272c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802731:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802738:	00 00 00 
+  80273b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80273d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802744:	eb b2                	jmp    8026f8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802746:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80274d:	eb a9                	jmp    8026f8 <read+0x6a>
+
+000000000080274f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	41 57                	push   %r15
+  802755:	41 56                	push   %r14
+  802757:	41 55                	push   %r13
+  802759:	41 54                	push   %r12
+  80275b:	53                   	push   %rbx
+  80275c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802760:	48 85 d2             	test   %rdx,%rdx
+  802763:	74 54                	je     8027b9 <readn+0x6a>
+  802765:	41 89 fd             	mov    %edi,%r13d
+  802768:	49 89 f6             	mov    %rsi,%r14
+  80276b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80276e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802773:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802778:	49 bf 8e 26 80 00 00 	movabs $0x80268e,%r15
+  80277f:	00 00 00 
+  802782:	4c 89 e2             	mov    %r12,%rdx
+  802785:	48 29 f2             	sub    %rsi,%rdx
+  802788:	4c 01 f6             	add    %r14,%rsi
+  80278b:	44 89 ef             	mov    %r13d,%edi
+  80278e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802791:	85 c0                	test   %eax,%eax
+  802793:	78 20                	js     8027b5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802795:	01 c3                	add    %eax,%ebx
+  802797:	85 c0                	test   %eax,%eax
+  802799:	74 08                	je     8027a3 <readn+0x54>
+  80279b:	48 63 f3             	movslq %ebx,%rsi
+  80279e:	4c 39 e6             	cmp    %r12,%rsi
+  8027a1:	72 df                	jb     802782 <readn+0x33>
+    }
+    return res;
+  8027a3:	48 63 c3             	movslq %ebx,%rax
+}
+  8027a6:	48 83 c4 08          	add    $0x8,%rsp
+  8027aa:	5b                   	pop    %rbx
+  8027ab:	41 5c                	pop    %r12
+  8027ad:	41 5d                	pop    %r13
+  8027af:	41 5e                	pop    %r14
+  8027b1:	41 5f                	pop    %r15
+  8027b3:	5d                   	pop    %rbp
+  8027b4:	c3                   	ret
+        if (inc < 0) return inc;
+  8027b5:	48 98                	cltq
+  8027b7:	eb ed                	jmp    8027a6 <readn+0x57>
+    int inc = 1, res = 0;
+  8027b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027be:	eb e3                	jmp    8027a3 <readn+0x54>
+
+00000000008027c0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8027c0:	55                   	push   %rbp
+  8027c1:	48 89 e5             	mov    %rsp,%rbp
+  8027c4:	41 56                	push   %r14
+  8027c6:	41 55                	push   %r13
+  8027c8:	41 54                	push   %r12
+  8027ca:	53                   	push   %rbx
+  8027cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8027cf:	89 fb                	mov    %edi,%ebx
+  8027d1:	49 89 f4             	mov    %rsi,%r12
+  8027d4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027db:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	78 47                	js     802832 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027eb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027ef:	41 8b 3e             	mov    (%r14),%edi
+  8027f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027f6:	48 b8 ba 23 80 00 00 	movabs $0x8023ba,%rax
+  8027fd:	00 00 00 
+  802800:	ff d0                	call   *%rax
+  802802:	85 c0                	test   %eax,%eax
+  802804:	78 30                	js     802836 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802806:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80280b:	74 2d                	je     80283a <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80280d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802811:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802815:	48 85 c0             	test   %rax,%rax
+  802818:	74 59                	je     802873 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80281a:	4c 89 ea             	mov    %r13,%rdx
+  80281d:	4c 89 e6             	mov    %r12,%rsi
+  802820:	4c 89 f7             	mov    %r14,%rdi
+  802823:	ff d0                	call   *%rax
+}
+  802825:	48 83 c4 10          	add    $0x10,%rsp
+  802829:	5b                   	pop    %rbx
+  80282a:	41 5c                	pop    %r12
+  80282c:	41 5d                	pop    %r13
+  80282e:	41 5e                	pop    %r14
+  802830:	5d                   	pop    %rbp
+  802831:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802832:	48 98                	cltq
+  802834:	eb ef                	jmp    802825 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802836:	48 98                	cltq
+  802838:	eb eb                	jmp    802825 <write+0x65>
+  80283a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  802841:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802843:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802847:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80284d:	89 da                	mov    %ebx,%edx
+  80284f:	48 bf 85 57 80 00 00 	movabs $0x805785,%rdi
+  802856:	00 00 00 
+  802859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285e:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802865:	00 00 00 
+  802868:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80286a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802871:	eb b2                	jmp    802825 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802873:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80287a:	eb a9                	jmp    802825 <write+0x65>
+
+000000000080287c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80287c:	55                   	push   %rbp
+  80287d:	48 89 e5             	mov    %rsp,%rbp
+  802880:	53                   	push   %rbx
+  802881:	48 83 ec 18          	sub    $0x18,%rsp
+  802885:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802887:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80288b:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	85 c0                	test   %eax,%eax
+  802899:	78 0c                	js     8028a7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80289b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80289f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ab:	c9                   	leave
+  8028ac:	c3                   	ret
+
+00000000008028ad <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8028ad:	55                   	push   %rbp
+  8028ae:	48 89 e5             	mov    %rsp,%rbp
+  8028b1:	41 55                	push   %r13
+  8028b3:	41 54                	push   %r12
+  8028b5:	53                   	push   %rbx
+  8028b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8028ba:	89 fb                	mov    %edi,%ebx
+  8028bc:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028bf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028c3:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	78 38                	js     80290b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028d3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8028d7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8028db:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028df:	48 b8 ba 23 80 00 00 	movabs $0x8023ba,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	78 1c                	js     80290b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028ef:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028f4:	74 20                	je     802916 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028fa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028fe:	48 85 c0             	test   %rax,%rax
+  802901:	74 4a                	je     80294d <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802903:	44 89 e6             	mov    %r12d,%esi
+  802906:	4c 89 ef             	mov    %r13,%rdi
+  802909:	ff d0                	call   *%rax
+}
+  80290b:	48 83 c4 18          	add    $0x18,%rsp
+  80290f:	5b                   	pop    %rbx
+  802910:	41 5c                	pop    %r12
+  802912:	41 5d                	pop    %r13
+  802914:	5d                   	pop    %rbp
+  802915:	c3                   	ret
+  802916:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80291d:	00 00 
+                thisenv->env_id, fdnum);
+  80291f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802923:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802929:	89 da                	mov    %ebx,%edx
+  80292b:	48 bf 48 57 80 00 00 	movabs $0x805748,%rdi
+  802932:	00 00 00 
+  802935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293a:	48 b9 9b 07 80 00 00 	movabs $0x80079b,%rcx
+  802941:	00 00 00 
+  802944:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802946:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80294b:	eb be                	jmp    80290b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80294d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802952:	eb b7                	jmp    80290b <ftruncate+0x5e>
+
+0000000000802954 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802954:	55                   	push   %rbp
+  802955:	48 89 e5             	mov    %rsp,%rbp
+  802958:	41 54                	push   %r12
+  80295a:	53                   	push   %rbx
+  80295b:	48 83 ec 10          	sub    $0x10,%rsp
+  80295f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802962:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802966:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	85 c0                	test   %eax,%eax
+  802974:	78 4e                	js     8029c4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802976:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80297a:	41 8b 3c 24          	mov    (%r12),%edi
+  80297e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802982:	48 b8 ba 23 80 00 00 	movabs $0x8023ba,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+  80298e:	85 c0                	test   %eax,%eax
+  802990:	78 32                	js     8029c4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802992:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802996:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80299b:	74 30                	je     8029cd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80299d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8029a0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8029a7:	00 00 00 
+    stat->st_isdir = 0;
+  8029aa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8029b1:	00 00 00 
+    stat->st_dev = dev;
+  8029b4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8029bb:	48 89 de             	mov    %rbx,%rsi
+  8029be:	4c 89 e7             	mov    %r12,%rdi
+  8029c1:	ff 50 28             	call   *0x28(%rax)
+}
+  8029c4:	48 83 c4 10          	add    $0x10,%rsp
+  8029c8:	5b                   	pop    %rbx
+  8029c9:	41 5c                	pop    %r12
+  8029cb:	5d                   	pop    %rbp
+  8029cc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8029cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8029d2:	eb f0                	jmp    8029c4 <fstat+0x70>
+
+00000000008029d4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029d4:	55                   	push   %rbp
+  8029d5:	48 89 e5             	mov    %rsp,%rbp
+  8029d8:	41 54                	push   %r12
+  8029da:	53                   	push   %rbx
+  8029db:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029de:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e3:	48 b8 d7 2f 80 00 00 	movabs $0x802fd7,%rax
+  8029ea:	00 00 00 
+  8029ed:	ff d0                	call   *%rax
+  8029ef:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029f1:	85 c0                	test   %eax,%eax
+  8029f3:	78 25                	js     802a1a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029f5:	4c 89 e6             	mov    %r12,%rsi
+  8029f8:	89 c7                	mov    %eax,%edi
+  8029fa:	48 b8 54 29 80 00 00 	movabs $0x802954,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+  802a06:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a09:	89 df                	mov    %ebx,%edi
+  802a0b:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  802a12:	00 00 00 
+  802a15:	ff d0                	call   *%rax
+
+    return res;
+  802a17:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a1a:	89 d8                	mov    %ebx,%eax
+  802a1c:	5b                   	pop    %rbx
+  802a1d:	41 5c                	pop    %r12
+  802a1f:	5d                   	pop    %rbp
+  802a20:	c3                   	ret
+
+0000000000802a21 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a21:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802a28:	00 00 00 
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	eb 0e                	jmp    802a40 <mmap_lookup+0x1f>
+  802a32:	48 83 c2 01          	add    $0x1,%rdx
+  802a36:	48 83 c0 20          	add    $0x20,%rax
+  802a3a:	48 83 fa 40          	cmp    $0x40,%rdx
+  802a3e:	74 2b                	je     802a6b <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  802a40:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802a44:	48 85 c9             	test   %rcx,%rcx
+  802a47:	74 e9                	je     802a32 <mmap_lookup+0x11>
+  802a49:	48 8b 30             	mov    (%rax),%rsi
+  802a4c:	48 39 f7             	cmp    %rsi,%rdi
+  802a4f:	72 e1                	jb     802a32 <mmap_lookup+0x11>
+  802a51:	48 01 f1             	add    %rsi,%rcx
+  802a54:	48 39 cf             	cmp    %rcx,%rdi
+  802a57:	73 d9                	jae    802a32 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802a59:	48 c1 e2 05          	shl    $0x5,%rdx
+  802a5d:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  802a64:	00 00 00 
+  802a67:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802a6a:	c3                   	ret
+    return NULL;
+  802a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a70:	c3                   	ret
+
+0000000000802a71 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	41 54                	push   %r12
+  802a77:	53                   	push   %rbx
+  802a78:	89 fb                	mov    %edi,%ebx
+  802a7a:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a7d:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802a84:	00 00 00 
+  802a87:	83 38 00             	cmpl   $0x0,(%rax)
+  802a8a:	74 3d                	je     802ac9 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  802a8c:	41 54                	push   %r12
+  802a8e:	6a 00                	push   $0x0
+  802a90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa6:	89 de                	mov    %ebx,%esi
+  802aa8:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  802aaf:	00 00 00 
+  802ab2:	8b 38                	mov    (%rax),%edi
+  802ab4:	48 b8 24 47 80 00 00 	movabs $0x804724,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+}
+  802ac0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802ac4:	5b                   	pop    %rbx
+  802ac5:	41 5c                	pop    %r12
+  802ac7:	5d                   	pop    %rbp
+  802ac8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ac9:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ace:	48 b8 8b 49 80 00 00 	movabs $0x80498b,%rax
+  802ad5:	00 00 00 
+  802ad8:	ff d0                	call   *%rax
+  802ada:	a3 10 90 80 00 00 00 	movabs %eax,0x809010
+  802ae1:	00 00 
+  802ae3:	eb a7                	jmp    802a8c <fsipc_words+0x1b>
+
+0000000000802ae5 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+  802ae9:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  802aed:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802af4:	00 
+  802af5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802afc:	00 
+  802afd:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b01:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802b05:	48 63 f6             	movslq %esi,%rsi
+  802b08:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  802b0c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b10:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b15:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+0000000000802b23 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802b2b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802b32:	00 
+  802b33:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b3a:	00 
+  802b3b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b42:	00 
+  802b43:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802b47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  802b4b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b4f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b54:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+}
+  802b60:	c9                   	leave
+  802b61:	c3                   	ret
+
+0000000000802b62 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b62:	55                   	push   %rbp
+  802b63:	48 89 e5             	mov    %rsp,%rbp
+  802b66:	41 54                	push   %r12
+  802b68:	53                   	push   %rbx
+  802b69:	89 fb                	mov    %edi,%ebx
+  802b6b:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b6e:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802b75:	00 00 00 
+  802b78:	83 38 00             	cmpl   $0x0,(%rax)
+  802b7b:	74 3f                	je     802bbc <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  802b7d:	6a 00                	push   $0x0
+  802b7f:	6a 00                	push   $0x0
+  802b81:	4d 89 e1             	mov    %r12,%r9
+  802b84:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b8a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b8f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802b96:	00 00 00 
+  802b99:	89 de                	mov    %ebx,%esi
+  802b9b:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  802ba2:	00 00 00 
+  802ba5:	8b 38                	mov    (%rax),%edi
+  802ba7:	48 b8 24 47 80 00 00 	movabs $0x804724,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+}
+  802bb3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802bb7:	5b                   	pop    %rbx
+  802bb8:	41 5c                	pop    %r12
+  802bba:	5d                   	pop    %rbp
+  802bbb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bbc:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bc1:	48 b8 8b 49 80 00 00 	movabs $0x80498b,%rax
+  802bc8:	00 00 00 
+  802bcb:	ff d0                	call   *%rax
+  802bcd:	a3 0c 90 80 00 00 00 	movabs %eax,0x80900c
+  802bd4:	00 00 
+  802bd6:	eb a5                	jmp    802b7d <fsipc+0x1b>
+
+0000000000802bd8 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	41 54                	push   %r12
+  802bde:	53                   	push   %rbx
+  802bdf:	41 89 fc             	mov    %edi,%r12d
+  802be2:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802be5:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802bec:	00 00 00 
+  802bef:	83 38 00             	cmpl   $0x0,(%rax)
+  802bf2:	74 46                	je     802c3a <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802bf4:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  802bf8:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802bfc:	6a 00                	push   $0x0
+  802bfe:	6a 00                	push   $0x0
+  802c00:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c06:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c0c:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802c13:	00 00 00 
+  802c16:	44 89 e6             	mov    %r12d,%esi
+  802c19:	48 b8 04 90 80 00 00 	movabs $0x809004,%rax
+  802c20:	00 00 00 
+  802c23:	8b 38                	mov    (%rax),%edi
+  802c25:	48 b8 24 47 80 00 00 	movabs $0x804724,%rax
+  802c2c:	00 00 00 
+  802c2f:	ff d0                	call   *%rax
+}
+  802c31:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802c35:	5b                   	pop    %rbx
+  802c36:	41 5c                	pop    %r12
+  802c38:	5d                   	pop    %rbp
+  802c39:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c3f:	48 b8 8b 49 80 00 00 	movabs $0x80498b,%rax
+  802c46:	00 00 00 
+  802c49:	ff d0                	call   *%rax
+  802c4b:	a3 04 90 80 00 00 00 	movabs %eax,0x809004
+  802c52:	00 00 
+  802c54:	eb 9e                	jmp    802bf4 <fsipcv+0x1c>
+
+0000000000802c56 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c56:	55                   	push   %rbp
+  802c57:	48 89 e5             	mov    %rsp,%rbp
+  802c5a:	41 54                	push   %r12
+  802c5c:	53                   	push   %rbx
+  802c5d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c60:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802c63:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802c6a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802c6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c71:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c76:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c82:	85 c0                	test   %eax,%eax
+  802c84:	78 3d                	js     802cc3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c86:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  802c8d:	00 00 00 
+  802c90:	4c 89 e6             	mov    %r12,%rsi
+  802c93:	48 89 df             	mov    %rbx,%rdi
+  802c96:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ca2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ca9:	00 
+  802caa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802cb0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802cb7:	00 
+  802cb8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cc3:	5b                   	pop    %rbx
+  802cc4:	41 5c                	pop    %r12
+  802cc6:	5d                   	pop    %rbp
+  802cc7:	c3                   	ret
+
+0000000000802cc8 <fsipcv_buf>:
+    return FSIPCV;
+  802cc8:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802ccf:	00 00 00 
+    if (!allocated) {
+  802cd2:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  802cd9:	00 00 00 
+  802cdc:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802cdf:	74 01                	je     802ce2 <fsipcv_buf+0x1a>
+}
+  802ce1:	c3                   	ret
+fsipcv_buf(void) {
+  802ce2:	55                   	push   %rbp
+  802ce3:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802ce6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ceb:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802cf0:	48 89 c6             	mov    %rax,%rsi
+  802cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf8:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+  802d04:	85 c0                	test   %eax,%eax
+  802d06:	78 19                	js     802d21 <fsipcv_buf+0x59>
+        allocated = 1;
+  802d08:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  802d0f:	00 00 00 
+  802d12:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802d15:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802d1c:	00 00 00 
+}
+  802d1f:	5d                   	pop    %rbp
+  802d20:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d26:	eb f7                	jmp    802d1f <fsipcv_buf+0x57>
+
+0000000000802d28 <devfile_write>:
+    if (!fd || !buf) {
+  802d28:	48 85 ff             	test   %rdi,%rdi
+  802d2b:	0f 84 46 01 00 00    	je     802e77 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d31:	55                   	push   %rbp
+  802d32:	48 89 e5             	mov    %rsp,%rbp
+  802d35:	41 57                	push   %r15
+  802d37:	41 56                	push   %r14
+  802d39:	41 55                	push   %r13
+  802d3b:	41 54                	push   %r12
+  802d3d:	53                   	push   %rbx
+  802d3e:	48 83 ec 18          	sub    $0x18,%rsp
+  802d42:	49 89 ff             	mov    %rdi,%r15
+  802d45:	49 89 f5             	mov    %rsi,%r13
+  802d48:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  802d4b:	48 85 f6             	test   %rsi,%rsi
+  802d4e:	0f 84 1a 01 00 00    	je     802e6e <devfile_write+0x146>
+    while (n) {
+  802d54:	48 85 d2             	test   %rdx,%rdx
+  802d57:	0f 84 fc 00 00 00    	je     802e59 <devfile_write+0x131>
+    size_t i = 0;
+  802d5d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802d63:	eb 6c                	jmp    802dd1 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802d65:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  802d6b:	4c 39 e3             	cmp    %r12,%rbx
+  802d6e:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802d72:	4c 89 e2             	mov    %r12,%rdx
+  802d75:	4c 89 ee             	mov    %r13,%rsi
+  802d78:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  802d7f:	00 00 00 
+  802d82:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d8e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d92:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  802d99:	00 00 00 
+  802d9c:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802d9e:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802da2:	be 00 00 00 00       	mov    $0x0,%esi
+  802da7:	bf 04 00 00 00       	mov    $0x4,%edi
+  802dac:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	0f 88 95 00 00 00    	js     802e55 <devfile_write+0x12d>
+        buf += ret;
+  802dc0:	48 98                	cltq
+  802dc2:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802dc5:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  802dc8:	48 29 c3             	sub    %rax,%rbx
+  802dcb:	0f 84 8b 00 00 00    	je     802e5c <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802dd1:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802dd8:	76 8b                	jbe    802d65 <devfile_write+0x3d>
+  802dda:	48 b8 c8 2c 80 00 00 	movabs $0x802cc8,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+  802de6:	49 89 c4             	mov    %rax,%r12
+  802de9:	48 85 c0             	test   %rax,%rax
+  802dec:	0f 84 73 ff ff ff    	je     802d65 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802df2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802df7:	48 39 c3             	cmp    %rax,%rbx
+  802dfa:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802dfe:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802e05:	00 
+  802e06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802e0a:	48 89 c2             	mov    %rax,%rdx
+  802e0d:	4c 89 ee             	mov    %r13,%rsi
+  802e10:	48 b9 21 13 80 00 00 	movabs $0x801321,%rcx
+  802e17:	00 00 00 
+  802e1a:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  802e1c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e20:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802e24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e28:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  802e2d:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802e34:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802e38:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e3d:	48 b8 d8 2b 80 00 00 	movabs $0x802bd8,%rax
+  802e44:	00 00 00 
+  802e47:	ff d0                	call   *%rax
+  802e49:	85 c0                	test   %eax,%eax
+  802e4b:	0f 89 6f ff ff ff    	jns    802dc0 <devfile_write+0x98>
+                return ret;
+  802e51:	48 98                	cltq
+  802e53:	eb 0a                	jmp    802e5f <devfile_write+0x137>
+                return ret;
+  802e55:	48 98                	cltq
+  802e57:	eb 06                	jmp    802e5f <devfile_write+0x137>
+    size_t i = 0;
+  802e59:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  802e5c:	4c 89 f0             	mov    %r14,%rax
+}
+  802e5f:	48 83 c4 18          	add    $0x18,%rsp
+  802e63:	5b                   	pop    %rbx
+  802e64:	41 5c                	pop    %r12
+  802e66:	41 5d                	pop    %r13
+  802e68:	41 5e                	pop    %r14
+  802e6a:	41 5f                	pop    %r15
+  802e6c:	5d                   	pop    %rbp
+  802e6d:	c3                   	ret
+        return -E_INVAL;
+  802e6e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e75:	eb e8                	jmp    802e5f <devfile_write+0x137>
+  802e77:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802e7e:	c3                   	ret
+
+0000000000802e7f <devfile_read>:
+    if (!fd || !buf) {
+  802e7f:	48 85 ff             	test   %rdi,%rdi
+  802e82:	0f 84 47 01 00 00    	je     802fcf <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e88:	55                   	push   %rbp
+  802e89:	48 89 e5             	mov    %rsp,%rbp
+  802e8c:	41 57                	push   %r15
+  802e8e:	41 56                	push   %r14
+  802e90:	41 55                	push   %r13
+  802e92:	41 54                	push   %r12
+  802e94:	53                   	push   %rbx
+  802e95:	48 83 ec 18          	sub    $0x18,%rsp
+  802e99:	49 89 ff             	mov    %rdi,%r15
+  802e9c:	49 89 f5             	mov    %rsi,%r13
+  802e9f:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802ea2:	48 85 f6             	test   %rsi,%rsi
+  802ea5:	0f 84 1b 01 00 00    	je     802fc6 <devfile_read+0x147>
+    while (n) {
+  802eab:	48 85 d2             	test   %rdx,%rdx
+  802eae:	0f 84 fb 00 00 00    	je     802faf <devfile_read+0x130>
+    size_t i = 0;
+  802eb4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802ebb:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ebc:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802ec3:	00 00 00 
+  802ec6:	eb 5f                	jmp    802f27 <devfile_read+0xa8>
+                return ret ? ret : i;
+  802ec8:	48 98                	cltq
+  802eca:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802ecf:	e9 e3 00 00 00       	jmp    802fb7 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ed4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ed8:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  802edb:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802edf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee4:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ee9:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  802ef0:	00 00 00 
+  802ef3:	ff d0                	call   *%rax
+  802ef5:	89 c3                	mov    %eax,%ebx
+  802ef7:	85 c0                	test   %eax,%eax
+  802ef9:	0f 8e a7 00 00 00    	jle    802fa6 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802eff:	48 63 d0             	movslq %eax,%rdx
+  802f02:	4c 89 f6             	mov    %r14,%rsi
+  802f05:	4c 89 ef             	mov    %r13,%rdi
+  802f08:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+        buf += ret;
+  802f14:	48 63 db             	movslq %ebx,%rbx
+  802f17:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  802f1a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802f1e:	49 29 dc             	sub    %rbx,%r12
+  802f21:	0f 84 8c 00 00 00    	je     802fb3 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802f27:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f2e:	76 a4                	jbe    802ed4 <devfile_read+0x55>
+  802f30:	48 b8 c8 2c 80 00 00 	movabs $0x802cc8,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+  802f3c:	48 89 c1             	mov    %rax,%rcx
+  802f3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f43:	48 85 c0             	test   %rax,%rax
+  802f46:	74 8c                	je     802ed4 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802f48:	be 00 00 04 00       	mov    $0x40000,%esi
+  802f4d:	49 39 f4             	cmp    %rsi,%r12
+  802f50:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802f54:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f58:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802f5a:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  802f5e:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802f65:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802f69:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f6e:	48 b8 d8 2b 80 00 00 	movabs $0x802bd8,%rax
+  802f75:	00 00 00 
+  802f78:	ff d0                	call   *%rax
+  802f7a:	89 c3                	mov    %eax,%ebx
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	0f 8e 44 ff ff ff    	jle    802ec8 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802f84:	48 63 d0             	movslq %eax,%rdx
+  802f87:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f8b:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802f92:	4c 89 ef             	mov    %r13,%rdi
+  802f95:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802f9c:	00 00 00 
+  802f9f:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802fa1:	e9 6e ff ff ff       	jmp    802f14 <devfile_read+0x95>
+                return ret ? ret : i;
+  802fa6:	48 98                	cltq
+  802fa8:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802fad:	eb 08                	jmp    802fb7 <devfile_read+0x138>
+    size_t i = 0;
+  802faf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802fb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802fb7:	48 83 c4 18          	add    $0x18,%rsp
+  802fbb:	5b                   	pop    %rbx
+  802fbc:	41 5c                	pop    %r12
+  802fbe:	41 5d                	pop    %r13
+  802fc0:	41 5e                	pop    %r14
+  802fc2:	41 5f                	pop    %r15
+  802fc4:	5d                   	pop    %rbp
+  802fc5:	c3                   	ret
+        return -E_INVAL;
+  802fc6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fcd:	eb e8                	jmp    802fb7 <devfile_read+0x138>
+  802fcf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802fd6:	c3                   	ret
+
+0000000000802fd7 <open>:
+open(const char *path, int mode) {
+  802fd7:	55                   	push   %rbp
+  802fd8:	48 89 e5             	mov    %rsp,%rbp
+  802fdb:	41 55                	push   %r13
+  802fdd:	41 54                	push   %r12
+  802fdf:	53                   	push   %rbx
+  802fe0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe4:	49 89 fc             	mov    %rdi,%r12
+  802fe7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fea:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ffc:	0f 87 8a 00 00 00    	ja     80308c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803002:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803006:	48 b8 0f 23 80 00 00 	movabs $0x80230f,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+  803012:	89 c3                	mov    %eax,%ebx
+  803014:	85 c0                	test   %eax,%eax
+  803016:	78 50                	js     803068 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803018:	4c 89 e6             	mov    %r12,%rsi
+  80301b:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  803022:	00 00 00 
+  803025:	48 89 df             	mov    %rbx,%rdi
+  803028:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  80302f:	00 00 00 
+  803032:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803034:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80303b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80303f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803044:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  803050:	89 c3                	mov    %eax,%ebx
+  803052:	85 c0                	test   %eax,%eax
+  803054:	78 1f                	js     803075 <open+0x9e>
+    return fd2num(fd);
+  803056:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80305a:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  803066:	89 c3                	mov    %eax,%ebx
+}
+  803068:	89 d8                	mov    %ebx,%eax
+  80306a:	48 83 c4 18          	add    $0x18,%rsp
+  80306e:	5b                   	pop    %rbx
+  80306f:	41 5c                	pop    %r12
+  803071:	41 5d                	pop    %r13
+  803073:	5d                   	pop    %rbp
+  803074:	c3                   	ret
+        fd_close(fd, 0);
+  803075:	be 00 00 00 00       	mov    $0x0,%esi
+  80307a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80307e:	48 b8 2d 24 80 00 00 	movabs $0x80242d,%rax
+  803085:	00 00 00 
+  803088:	ff d0                	call   *%rax
+        return res;
+  80308a:	eb dc                	jmp    803068 <open+0x91>
+        return -E_BAD_PATH;
+  80308c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803091:	eb d5                	jmp    803068 <open+0x91>
+
+0000000000803093 <sync>:
+sync(void) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  803097:	be 00 00 00 00       	mov    $0x0,%esi
+  80309c:	bf 08 00 00 00       	mov    $0x8,%edi
+  8030a1:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  8030a8:	00 00 00 
+  8030ab:	ff d0                	call   *%rax
+}
+  8030ad:	5d                   	pop    %rbp
+  8030ae:	c3                   	ret
+
+00000000008030af <drop_cache>:
+drop_cache(int fdnum) {
+  8030af:	55                   	push   %rbp
+  8030b0:	48 89 e5             	mov    %rsp,%rbp
+  8030b3:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030b7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030bb:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+  8030c7:	85 c0                	test   %eax,%eax
+  8030c9:	78 51                	js     80311c <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030cf:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030d6:	00 00 00 
+  8030d9:	8b 0a                	mov    (%rdx),%ecx
+  8030db:	39 08                	cmp    %ecx,(%rax)
+  8030dd:	75 3f                	jne    80311e <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8030df:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8030e6:	00 
+  8030e7:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8030ee:	00 
+  8030ef:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030f6:	00 
+  8030f7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030fe:	00 
+  8030ff:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  803103:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  803107:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80310b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803110:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  803117:	00 00 00 
+  80311a:	ff d0                	call   *%rax
+}
+  80311c:	c9                   	leave
+  80311d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80311e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803123:	eb f7                	jmp    80311c <drop_cache+0x6d>
+
+0000000000803125 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  803125:	55                   	push   %rbp
+  803126:	48 89 e5             	mov    %rsp,%rbp
+  803129:	41 57                	push   %r15
+  80312b:	41 56                	push   %r14
+  80312d:	41 55                	push   %r13
+  80312f:	41 54                	push   %r12
+  803131:	53                   	push   %rbx
+  803132:	48 83 ec 58          	sub    $0x58,%rsp
+  803136:	41 89 f4             	mov    %esi,%r12d
+  803139:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80313d:	49 89 cd             	mov    %rcx,%r13
+  803140:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803143:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803147:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	48 63 d0             	movslq %eax,%rdx
+  803156:	85 c0                	test   %eax,%eax
+  803158:	0f 88 36 01 00 00    	js     803294 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80315e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803162:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803169:	00 00 00 
+  80316c:	8b 32                	mov    (%rdx),%esi
+  80316e:	39 31                	cmp    %esi,(%rcx)
+  803170:	0f 85 30 01 00 00    	jne    8032a6 <read_map+0x181>
+  803176:	45 85 e4             	test   %r12d,%r12d
+  803179:	0f 88 27 01 00 00    	js     8032a6 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80317f:	49 63 cc             	movslq %r12d,%rcx
+  803182:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  803186:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80318d:	0f 85 1c 01 00 00    	jne    8032af <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803193:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  803197:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80319e:	0f 85 14 01 00 00    	jne    8032b8 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8031a4:	48 63 cb             	movslq %ebx,%rcx
+  8031a7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031ab:	49 be 00 90 80 00 00 	movabs $0x809000,%r14
+  8031b2:	00 00 00 
+    while (i < n) {
+  8031b5:	4d 85 ed             	test   %r13,%r13
+  8031b8:	75 5c                	jne    803216 <read_map+0xf1>
+  8031ba:	e9 d2 00 00 00       	jmp    803291 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  8031bf:	41 8b 3e             	mov    (%r14),%edi
+  8031c2:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8031c6:	50                   	push   %rax
+  8031c7:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8031cb:	50                   	push   %rax
+  8031cc:	4d 89 f9             	mov    %r15,%r9
+  8031cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031d5:	48 89 d9             	mov    %rbx,%rcx
+  8031d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031dd:	be 09 00 00 00       	mov    $0x9,%esi
+  8031e2:	48 b8 24 47 80 00 00 	movabs $0x804724,%rax
+  8031e9:	00 00 00 
+  8031ec:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8031ee:	48 83 c4 10          	add    $0x10,%rsp
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	0f 8e 8f 00 00 00    	jle    803289 <read_map+0x164>
+        if (!mapped_perm) {
+  8031fa:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8031fe:	0f 84 80 00 00 00    	je     803284 <read_map+0x15f>
+        i += res;
+  803204:	48 63 d0             	movslq %eax,%rdx
+  803207:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  80320a:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80320f:	75 78                	jne    803289 <read_map+0x164>
+    while (i < n) {
+  803211:	4d 39 ec             	cmp    %r13,%r12
+  803214:	73 73                	jae    803289 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  803216:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80321a:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  80321e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  803222:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  803226:	4c 01 e0             	add    %r12,%rax
+  803229:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80322d:	4c 89 eb             	mov    %r13,%rbx
+  803230:	4c 29 e3             	sub    %r12,%rbx
+  803233:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  803237:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80323b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80323f:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  803246:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80324d:	b8 00 00 10 00       	mov    $0x100000,%eax
+  803252:	48 39 c3             	cmp    %rax,%rbx
+  803255:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  803259:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80325d:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803261:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  803265:	0f 85 54 ff ff ff    	jne    8031bf <read_map+0x9a>
+  80326b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803270:	48 b8 8b 49 80 00 00 	movabs $0x80498b,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+  80327c:	41 89 06             	mov    %eax,(%r14)
+  80327f:	e9 3b ff ff ff       	jmp    8031bf <read_map+0x9a>
+            res = -E_INVAL;
+  803284:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  803289:	4c 89 e2             	mov    %r12,%rdx
+  80328c:	4d 85 e4             	test   %r12,%r12
+  80328f:	75 03                	jne    803294 <read_map+0x16f>
+  803291:	48 63 d0             	movslq %eax,%rdx
+}
+  803294:	48 89 d0             	mov    %rdx,%rax
+  803297:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80329b:	5b                   	pop    %rbx
+  80329c:	41 5c                	pop    %r12
+  80329e:	41 5d                	pop    %r13
+  8032a0:	41 5e                	pop    %r14
+  8032a2:	41 5f                	pop    %r15
+  8032a4:	5d                   	pop    %rbp
+  8032a5:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8032a6:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032ad:	eb e5                	jmp    803294 <read_map+0x16f>
+  8032af:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032b6:	eb dc                	jmp    803294 <read_map+0x16f>
+  8032b8:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  8032bf:	eb d3                	jmp    803294 <read_map+0x16f>
+
+00000000008032c1 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8032c1:	55                   	push   %rbp
+  8032c2:	48 89 e5             	mov    %rsp,%rbp
+  8032c5:	41 57                	push   %r15
+  8032c7:	41 56                	push   %r14
+  8032c9:	41 55                	push   %r13
+  8032cb:	41 54                	push   %r12
+  8032cd:	53                   	push   %rbx
+  8032ce:	48 83 ec 38          	sub    $0x38,%rsp
+  8032d2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032d5:	41 89 f6             	mov    %esi,%r14d
+  8032d8:	49 89 d5             	mov    %rdx,%r13
+  8032db:	89 cb                	mov    %ecx,%ebx
+  8032dd:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032e0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032e4:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	0f 88 33 02 00 00    	js     80352b <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8032f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8032fd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803301:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803308:	00 00 00 
+  80330b:	8b 3a                	mov    (%rdx),%edi
+  80330d:	39 39                	cmp    %edi,(%rcx)
+  80330f:	0f 85 1b 02 00 00    	jne    803530 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  803315:	4d 85 ed             	test   %r13,%r13
+  803318:	41 0f 94 c0          	sete   %r8b
+  80331c:	44 89 f0             	mov    %r14d,%eax
+  80331f:	c1 e8 1f             	shr    $0x1f,%eax
+  803322:	41 08 c0             	or     %al,%r8b
+  803325:	0f 85 14 02 00 00    	jne    80353f <mmap+0x27e>
+  80332b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803332:	0f 85 0e 02 00 00    	jne    803546 <mmap+0x285>
+  803338:	83 fb 07             	cmp    $0x7,%ebx
+  80333b:	0f 87 0c 02 00 00    	ja     80354d <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  803341:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  803346:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80334b:	83 fa 01             	cmp    $0x1,%edx
+  80334e:	0f 87 dc 01 00 00    	ja     803530 <mmap+0x26f>
+  803354:	48 ba 28 90 80 00 00 	movabs $0x809028,%rdx
+  80335b:	00 00 00 
+  80335e:	eb 0e                	jmp    80336e <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  803360:	48 83 c0 01          	add    $0x1,%rax
+  803364:	48 83 c2 20          	add    $0x20,%rdx
+  803368:	48 83 f8 40          	cmp    $0x40,%rax
+  80336c:	74 44                	je     8033b2 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  80336e:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803372:	75 ec                	jne    803360 <mmap+0x9f>
+  803374:	48 c1 e0 05          	shl    $0x5,%rax
+  803378:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  80337f:	00 00 00 
+  803382:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  803386:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80338d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803394:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  803397:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  80339e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033a1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033a6:	49 b9 20 90 80 00 00 	movabs $0x809020,%r9
+  8033ad:	00 00 00 
+  8033b0:	eb 17                	jmp    8033c9 <mmap+0x108>
+  8033b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  8033b7:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  8033bd:	eb c7                	jmp    803386 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033bf:	48 83 c0 01          	add    $0x1,%rax
+  8033c3:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8033c7:	77 37                	ja     803400 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8033c9:	48 89 c2             	mov    %rax,%rdx
+  8033cc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8033d0:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8033d5:	48 85 d2             	test   %rdx,%rdx
+  8033d8:	74 e5                	je     8033bf <mmap+0xfe>
+  8033da:	48 89 c7             	mov    %rax,%rdi
+  8033dd:	48 c1 e7 05          	shl    $0x5,%rdi
+  8033e1:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8033e5:	48 01 fa             	add    %rdi,%rdx
+  8033e8:	48 39 d6             	cmp    %rdx,%rsi
+  8033eb:	73 d2                	jae    8033bf <mmap+0xfe>
+  8033ed:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8033f1:	4c 39 d7             	cmp    %r10,%rdi
+  8033f4:	73 c9                	jae    8033bf <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8033f6:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fe:	eb c9                	jmp    8033c9 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  803400:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  803404:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  803409:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  803410:	00 00 00 
+  803413:	49 39 f9             	cmp    %rdi,%r9
+  803416:	0f 82 14 01 00 00    	jb     803530 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  80341c:	48 85 f6             	test   %rsi,%rsi
+  80341f:	0f 84 2f 01 00 00    	je     803554 <mmap+0x293>
+  803425:	45 84 c0             	test   %r8b,%r8b
+  803428:	0f 85 26 01 00 00    	jne    803554 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  80342e:	41 83 fc 01          	cmp    $0x1,%r12d
+  803432:	0f 94 c0             	sete   %al
+  803435:	0f b6 c0             	movzbl %al,%eax
+  803438:	c1 e0 06             	shl    $0x6,%eax
+  80343b:	09 d8                	or     %ebx,%eax
+  80343d:	89 c3                	mov    %eax,%ebx
+  80343f:	83 cb 04             	or     $0x4,%ebx
+  803442:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  803445:	4d 85 ff             	test   %r15,%r15
+  803448:	0f 84 bd 00 00 00    	je     80350b <mmap+0x24a>
+  80344e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803453:	83 e0 bf             	and    $0xffffffbf,%eax
+  803456:	83 c8 04             	or     $0x4,%eax
+  803459:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  80345c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  803460:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  803464:	49 89 f6             	mov    %rsi,%r14
+  803467:	eb 43                	jmp    8034ac <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  803469:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80346f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803475:	48 01 c3             	add    %rax,%rbx
+            continue;
+  803478:	eb 2d                	jmp    8034a7 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  80347a:	48 85 c0             	test   %rax,%rax
+  80347d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803482:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  803486:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  803489:	4c 89 e2             	mov    %r12,%rdx
+  80348c:	4c 89 ee             	mov    %r13,%rsi
+  80348f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803494:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+  8034a0:	85 c0                	test   %eax,%eax
+  8034a2:	78 3e                	js     8034e2 <mmap+0x221>
+        i += n;
+  8034a4:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  8034a7:	4c 39 fb             	cmp    %r15,%rbx
+  8034aa:	73 54                	jae    803500 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  8034ac:	4d 89 fc             	mov    %r15,%r12
+  8034af:	49 29 dc             	sub    %rbx,%r12
+  8034b2:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  8034b6:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8034b9:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  8034bc:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  8034c0:	4c 89 e1             	mov    %r12,%rcx
+  8034c3:	4c 89 ea             	mov    %r13,%rdx
+  8034c6:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8034c9:	48 b8 25 31 80 00 00 	movabs $0x803125,%rax
+  8034d0:	00 00 00 
+  8034d3:	ff d0                	call   *%rax
+        if (res > 0) {
+  8034d5:	48 85 c0             	test   %rax,%rax
+  8034d8:	7f 8f                	jg     803469 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  8034da:	74 9e                	je     80347a <mmap+0x1b9>
+  8034dc:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  8034e0:	74 98                	je     80347a <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  8034e2:	4c 89 f6             	mov    %r14,%rsi
+  8034e5:	4c 89 fa             	mov    %r15,%rdx
+  8034e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ed:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+    return NULL;
+  8034f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fe:	eb 30                	jmp    803530 <mmap+0x26f>
+  803500:	4c 89 f6             	mov    %r14,%rsi
+  803503:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803507:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  80350b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80350f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803512:	48 89 31             	mov    %rsi,(%rcx)
+  803515:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  803519:	89 41 10             	mov    %eax,0x10(%rcx)
+  80351c:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  803520:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803523:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  803526:	48 89 f0             	mov    %rsi,%rax
+  803529:	eb 05                	jmp    803530 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80352b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803530:	48 83 c4 38          	add    $0x38,%rsp
+  803534:	5b                   	pop    %rbx
+  803535:	41 5c                	pop    %r12
+  803537:	41 5d                	pop    %r13
+  803539:	41 5e                	pop    %r14
+  80353b:	41 5f                	pop    %r15
+  80353d:	5d                   	pop    %rbp
+  80353e:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  80353f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803544:	eb ea                	jmp    803530 <mmap+0x26f>
+  803546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354b:	eb e3                	jmp    803530 <mmap+0x26f>
+  80354d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803552:	eb dc                	jmp    803530 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  803554:	b8 00 00 00 00       	mov    $0x0,%eax
+  803559:	eb d5                	jmp    803530 <mmap+0x26f>
+
+000000000080355b <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  80355b:	55                   	push   %rbp
+  80355c:	48 89 e5             	mov    %rsp,%rbp
+  80355f:	41 57                	push   %r15
+  803561:	41 56                	push   %r14
+  803563:	41 55                	push   %r13
+  803565:	41 54                	push   %r12
+  803567:	53                   	push   %rbx
+  803568:	48 83 ec 38          	sub    $0x38,%rsp
+  80356c:	49 89 fc             	mov    %rdi,%r12
+  80356f:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  803572:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  803579:	00 00 00 
+  80357c:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  80357e:	48 85 c0             	test   %rax,%rax
+  803581:	0f 84 2f 01 00 00    	je     8036b6 <msync+0x15b>
+  803587:	49 89 c7             	mov    %rax,%r15
+  80358a:	4d 01 e5             	add    %r12,%r13
+  80358d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803591:	49 03 07             	add    (%r15),%rax
+  803594:	4c 39 e8             	cmp    %r13,%rax
+  803597:	0f 82 20 01 00 00    	jb     8036bd <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  80359d:	41 8b 47 18          	mov    0x18(%r15),%eax
+  8035a1:	83 e0 40             	and    $0x40,%eax
+  8035a4:	0f 84 fd 00 00 00    	je     8036a7 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8035aa:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8035b1:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8035b8:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  8035bf:	4d 39 ec             	cmp    %r13,%r12
+  8035c2:	0f 83 fc 00 00 00    	jae    8036c4 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  8035c8:	49 be 06 41 80 00 00 	movabs $0x804106,%r14
+  8035cf:	00 00 00 
+  8035d2:	e9 b0 00 00 00       	jmp    803687 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8035d7:	4c 89 e3             	mov    %r12,%rbx
+  8035da:	4d 39 ec             	cmp    %r13,%r12
+  8035dd:	73 16                	jae    8035f5 <msync+0x9a>
+  8035df:	48 89 df             	mov    %rbx,%rdi
+  8035e2:	41 ff d6             	call   *%r14
+  8035e5:	84 c0                	test   %al,%al
+  8035e7:	74 0c                	je     8035f5 <msync+0x9a>
+  8035e9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035f0:	4c 39 eb             	cmp    %r13,%rbx
+  8035f3:	72 ea                	jb     8035df <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  8035f5:	48 89 d8             	mov    %rbx,%rax
+  8035f8:	4c 29 e0             	sub    %r12,%rax
+  8035fb:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  8035ff:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803603:	49 89 c0             	mov    %rax,%r8
+  803606:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80360a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80360f:	48 89 ce             	mov    %rcx,%rsi
+  803612:	bf 00 00 00 00       	mov    $0x0,%edi
+  803617:	49 ba d7 16 80 00 00 	movabs $0x8016d7,%r10
+  80361e:	00 00 00 
+  803621:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  803624:	85 c0                	test   %eax,%eax
+  803626:	78 7f                	js     8036a7 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  803628:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80362f:	00 
+  803630:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803637:	00 
+  803638:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80363f:	00 
+  803640:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803647:	00 
+  803648:	49 63 47 10          	movslq 0x10(%r15),%rax
+  80364c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  803650:	49 63 47 14          	movslq 0x14(%r15),%rax
+  803654:	49 2b 07             	sub    (%r15),%rax
+  803657:	4c 01 e0             	add    %r12,%rax
+  80365a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80365e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803662:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  803666:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  80366a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80366f:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+  80367b:	85 c0                	test   %eax,%eax
+  80367d:	78 28                	js     8036a7 <msync+0x14c>
+  80367f:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  803682:	4d 39 ec             	cmp    %r13,%r12
+  803685:	73 1b                	jae    8036a2 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  803687:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  80368b:	4c 89 e7             	mov    %r12,%rdi
+  80368e:	41 ff d6             	call   *%r14
+  803691:	84 c0                	test   %al,%al
+  803693:	0f 85 3e ff ff ff    	jne    8035d7 <msync+0x7c>
+            va += PAGE_SIZE;
+  803699:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  8036a0:	eb e0                	jmp    803682 <msync+0x127>
+    }
+
+    return 0;
+  8036a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036a7:	48 83 c4 38          	add    $0x38,%rsp
+  8036ab:	5b                   	pop    %rbx
+  8036ac:	41 5c                	pop    %r12
+  8036ae:	41 5d                	pop    %r13
+  8036b0:	41 5e                	pop    %r14
+  8036b2:	41 5f                	pop    %r15
+  8036b4:	5d                   	pop    %rbp
+  8036b5:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  8036b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036bb:	eb ea                	jmp    8036a7 <msync+0x14c>
+  8036bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036c2:	eb e3                	jmp    8036a7 <msync+0x14c>
+    return 0;
+  8036c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c9:	eb dc                	jmp    8036a7 <msync+0x14c>
+
+00000000008036cb <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  8036cb:	55                   	push   %rbp
+  8036cc:	48 89 e5             	mov    %rsp,%rbp
+  8036cf:	41 55                	push   %r13
+  8036d1:	41 54                	push   %r12
+  8036d3:	53                   	push   %rbx
+  8036d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036d8:	49 89 fc             	mov    %rdi,%r12
+  8036db:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  8036de:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  8036e5:	00 00 00 
+  8036e8:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  8036ea:	48 85 c0             	test   %rax,%rax
+  8036ed:	74 58                	je     803747 <munmap+0x7c>
+  8036ef:	48 89 c3             	mov    %rax,%rbx
+  8036f2:	4c 3b 20             	cmp    (%rax),%r12
+  8036f5:	75 57                	jne    80374e <munmap+0x83>
+  8036f7:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  8036fe:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803704:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  803708:	75 4b                	jne    803755 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  80370a:	4c 89 ee             	mov    %r13,%rsi
+  80370d:	4c 89 e7             	mov    %r12,%rdi
+  803710:	48 b8 5b 35 80 00 00 	movabs $0x80355b,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  80371c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803720:	4c 89 e6             	mov    %r12,%rsi
+  803723:	bf 00 00 00 00       	mov    $0x0,%edi
+  803728:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  80372f:	00 00 00 
+  803732:	ff d0                	call   *%rax
+    m->m_size = 0;
+  803734:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  80373b:	00 
+    return res;
+}
+  80373c:	48 83 c4 08          	add    $0x8,%rsp
+  803740:	5b                   	pop    %rbx
+  803741:	41 5c                	pop    %r12
+  803743:	41 5d                	pop    %r13
+  803745:	5d                   	pop    %rbp
+  803746:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  803747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80374c:	eb ee                	jmp    80373c <munmap+0x71>
+  80374e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803753:	eb e7                	jmp    80373c <munmap+0x71>
+  803755:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80375a:	eb e0                	jmp    80373c <munmap+0x71>
+
+000000000080375c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80375c:	55                   	push   %rbp
+  80375d:	48 89 e5             	mov    %rsp,%rbp
+  803760:	41 54                	push   %r12
+  803762:	53                   	push   %rbx
+  803763:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803766:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  80376d:	00 00 00 
+  803770:	ff d0                	call   *%rax
+  803772:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803775:	48 be e0 57 80 00 00 	movabs $0x8057e0,%rsi
+  80377c:	00 00 00 
+  80377f:	48 89 df             	mov    %rbx,%rdi
+  803782:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80378e:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803793:	41 8b 14 24          	mov    (%r12),%edx
+  803797:	29 d0                	sub    %edx,%eax
+  803799:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80379f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037a6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037a9:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037b0:	00 00 00 
+  8037b3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bf:	5b                   	pop    %rbx
+  8037c0:	41 5c                	pop    %r12
+  8037c2:	5d                   	pop    %rbp
+  8037c3:	c3                   	ret
+
+00000000008037c4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037c4:	55                   	push   %rbp
+  8037c5:	48 89 e5             	mov    %rsp,%rbp
+  8037c8:	41 55                	push   %r13
+  8037ca:	41 54                	push   %r12
+  8037cc:	53                   	push   %rbx
+  8037cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d1:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037d4:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+  8037e0:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e8:	4c 89 e6             	mov    %r12,%rsi
+  8037eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f0:	49 bc a4 17 80 00 00 	movabs $0x8017a4,%r12
+  8037f7:	00 00 00 
+  8037fa:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  8037fd:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803803:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80380a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80380f:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803812:	be 00 04 00 00       	mov    $0x400,%esi
+  803817:	48 89 df             	mov    %rbx,%rdi
+  80381a:	49 bd 1e 1d 80 00 00 	movabs $0x801d1e,%r13
+  803821:	00 00 00 
+  803824:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803827:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80382b:	be 00 04 00 00       	mov    $0x400,%esi
+  803830:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803833:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803838:	48 89 de             	mov    %rbx,%rsi
+  80383b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803840:	41 ff d4             	call   *%r12
+}
+  803843:	48 83 c4 08          	add    $0x8,%rsp
+  803847:	5b                   	pop    %rbx
+  803848:	41 5c                	pop    %r12
+  80384a:	41 5d                	pop    %r13
+  80384c:	5d                   	pop    %rbp
+  80384d:	c3                   	ret
+
+000000000080384e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80384e:	55                   	push   %rbp
+  80384f:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  803852:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  803858:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  80385f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803864:	48 b8 44 16 80 00 00 	movabs $0x801644,%rax
+  80386b:	00 00 00 
+  80386e:	ff d0                	call   *%rax
+  803870:	85 c0                	test   %eax,%eax
+  803872:	0f 94 c0             	sete   %al
+  803875:	0f b6 c0             	movzbl %al,%eax
+}
+  803878:	5d                   	pop    %rbp
+  803879:	c3                   	ret
+
+000000000080387a <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  80387a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80387f:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  803881:	8b 07                	mov    (%rdi),%eax
+  803883:	39 f0                	cmp    %esi,%eax
+  803885:	74 01                	je     803888 <pipe_wait+0xe>
+  803887:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  803888:	55                   	push   %rbp
+  803889:	48 89 e5             	mov    %rsp,%rbp
+    asm volatile("rdtsc"
+  80388c:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80388e:	48 c1 e2 20          	shl    $0x20,%rdx
+  803892:	89 c0                	mov    %eax,%eax
+  803894:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803897:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  80389e:	48 b8 f4 1c 80 00 00 	movabs $0x801cf4,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+}
+  8038aa:	5d                   	pop    %rbp
+  8038ab:	c3                   	ret
+
+00000000008038ac <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  8038ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b1:	87 06                	xchg   %eax,(%rsi)
+  8038b3:	85 c0                	test   %eax,%eax
+  8038b5:	75 01                	jne    8038b8 <pipe_wake+0xc>
+  8038b7:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  8038b8:	55                   	push   %rbp
+  8038b9:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  8038bc:	be 00 04 00 00       	mov    $0x400,%esi
+  8038c1:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+}
+  8038cd:	5d                   	pop    %rbp
+  8038ce:	c3                   	ret
+
+00000000008038cf <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+  8038d3:	41 57                	push   %r15
+  8038d5:	41 56                	push   %r14
+  8038d7:	41 55                	push   %r13
+  8038d9:	41 54                	push   %r12
+  8038db:	53                   	push   %rbx
+  8038dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8038e0:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8038e4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038e8:	48 89 d3             	mov    %rdx,%rbx
+  8038eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038ef:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8038f6:	00 00 00 
+  8038f9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8038fb:	48 85 db             	test   %rbx,%rbx
+  8038fe:	0f 84 0f 01 00 00    	je     803a13 <devpipe_write+0x144>
+  803904:	49 89 c4             	mov    %rax,%r12
+  803907:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80390d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803914:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803918:	eb 4f                	jmp    803969 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80391a:	4c 89 e6             	mov    %r12,%rsi
+  80391d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803921:	48 b8 4e 38 80 00 00 	movabs $0x80384e,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+  80392d:	85 c0                	test   %eax,%eax
+  80392f:	74 14                	je     803945 <devpipe_write+0x76>
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803936:	48 83 c4 28          	add    $0x28,%rsp
+  80393a:	5b                   	pop    %rbx
+  80393b:	41 5c                	pop    %r12
+  80393d:	41 5d                	pop    %r13
+  80393f:	41 5e                	pop    %r14
+  803941:	41 5f                	pop    %r15
+  803943:	5d                   	pop    %rbp
+  803944:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  803945:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  80394a:	44 89 ee             	mov    %r13d,%esi
+  80394d:	4c 89 e7             	mov    %r12,%rdi
+  803950:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  803957:	00 00 00 
+  80395a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80395c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803960:	49 39 c7             	cmp    %rax,%r15
+  803963:	0f 83 aa 00 00 00    	jae    803a13 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  803969:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  80396e:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  803972:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  803979:	00 
+  80397a:	44 89 f0             	mov    %r14d,%eax
+  80397d:	44 29 e8             	sub    %r13d,%eax
+  803980:	39 d8                	cmp    %ebx,%eax
+  803982:	74 96                	je     80391a <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  803984:	89 d8                	mov    %ebx,%eax
+  803986:	44 29 f0             	sub    %r14d,%eax
+  803989:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  80398d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803991:	4c 29 f8             	sub    %r15,%rax
+  803994:	49 39 c5             	cmp    %rax,%r13
+  803997:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80399b:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  80399e:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  8039a1:	89 db                	mov    %ebx,%ebx
+  8039a3:	48 29 c3             	sub    %rax,%rbx
+  8039a6:	4c 39 eb             	cmp    %r13,%rbx
+  8039a9:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  8039ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039b1:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  8039b5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8039bc:	00 
+  8039bd:	48 89 da             	mov    %rbx,%rdx
+  8039c0:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8039c7:	00 00 00 
+  8039ca:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  8039cc:	4c 89 ea             	mov    %r13,%rdx
+  8039cf:	48 29 da             	sub    %rbx,%rdx
+  8039d2:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  8039d6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039da:	48 01 ce             	add    %rcx,%rsi
+  8039dd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8039e1:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  8039ed:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  8039f2:	45 01 ee             	add    %r13d,%r14d
+  8039f5:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  8039fa:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  8039ff:	48 b8 ac 38 80 00 00 	movabs $0x8038ac,%rax
+  803a06:	00 00 00 
+  803a09:	ff d0                	call   *%rax
+        i += chunk;
+  803a0b:	4d 01 ef             	add    %r13,%r15
+  803a0e:	e9 49 ff ff ff       	jmp    80395c <devpipe_write+0x8d>
+    return n;
+  803a13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a17:	e9 1a ff ff ff       	jmp    803936 <devpipe_write+0x67>
+
+0000000000803a1c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a1c:	55                   	push   %rbp
+  803a1d:	48 89 e5             	mov    %rsp,%rbp
+  803a20:	41 57                	push   %r15
+  803a22:	41 56                	push   %r14
+  803a24:	41 55                	push   %r13
+  803a26:	41 54                	push   %r12
+  803a28:	53                   	push   %rbx
+  803a29:	48 83 ec 28          	sub    $0x28,%rsp
+  803a2d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a31:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a35:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a39:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  803a40:	00 00 00 
+  803a43:	ff d0                	call   *%rax
+  803a45:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a48:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  803a4c:	49 bf 4e 38 80 00 00 	movabs $0x80384e,%r15
+  803a53:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803a56:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803a5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a5e:	eb 15                	jmp    803a75 <devpipe_read+0x59>
+  803a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a64:	89 de                	mov    %ebx,%esi
+  803a66:	4c 89 f7             	mov    %r14,%rdi
+  803a69:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  803a70:	00 00 00 
+  803a73:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803a75:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803a79:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  803a7c:	41 39 dd             	cmp    %ebx,%r13d
+  803a7f:	75 15                	jne    803a96 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803a81:	4c 89 e6             	mov    %r12,%rsi
+  803a84:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a88:	41 ff d7             	call   *%r15
+  803a8b:	85 c0                	test   %eax,%eax
+  803a8d:	74 d1                	je     803a60 <devpipe_read+0x44>
+  803a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a94:	eb 7c                	jmp    803b12 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803a96:	44 29 eb             	sub    %r13d,%ebx
+  803a99:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a9d:	48 39 c3             	cmp    %rax,%rbx
+  803aa0:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803aa4:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  803aab:	00 
+  803aac:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803ab0:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803ab3:	45 89 f6             	mov    %r14d,%r14d
+  803ab6:	49 29 c6             	sub    %rax,%r14
+  803ab9:	49 39 de             	cmp    %rbx,%r14
+  803abc:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803ac0:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803ac7:	00 
+  803ac8:	4c 89 f2             	mov    %r14,%rdx
+  803acb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803acf:	49 bf 21 13 80 00 00 	movabs $0x801321,%r15
+  803ad6:	00 00 00 
+  803ad9:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803adc:	48 89 da             	mov    %rbx,%rdx
+  803adf:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803ae2:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  803ae9:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  803aea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803aee:	4c 01 f7             	add    %r14,%rdi
+  803af1:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803af4:	41 01 dd             	add    %ebx,%r13d
+  803af7:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  803afb:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803b00:	4c 89 e7             	mov    %r12,%rdi
+  803b03:	48 b8 ac 38 80 00 00 	movabs $0x8038ac,%rax
+  803b0a:	00 00 00 
+  803b0d:	ff d0                	call   *%rax
+    return n;
+  803b0f:	48 89 d8             	mov    %rbx,%rax
+}
+  803b12:	48 83 c4 28          	add    $0x28,%rsp
+  803b16:	5b                   	pop    %rbx
+  803b17:	41 5c                	pop    %r12
+  803b19:	41 5d                	pop    %r13
+  803b1b:	41 5e                	pop    %r14
+  803b1d:	41 5f                	pop    %r15
+  803b1f:	5d                   	pop    %rbp
+  803b20:	c3                   	ret
+
+0000000000803b21 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803b21:	55                   	push   %rbp
+  803b22:	48 89 e5             	mov    %rsp,%rbp
+  803b25:	41 57                	push   %r15
+  803b27:	41 56                	push   %r14
+  803b29:	41 55                	push   %r13
+  803b2b:	41 54                	push   %r12
+  803b2d:	53                   	push   %rbx
+  803b2e:	48 83 ec 18          	sub    $0x18,%rsp
+  803b32:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803b35:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  803b3c:	0f 86 96 01 00 00    	jbe    803cd8 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803b42:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803b47:	48 01 db             	add    %rbx,%rbx
+  803b4a:	48 39 f3             	cmp    %rsi,%rbx
+  803b4d:	72 f8                	jb     803b47 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803b4f:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803b56:	0f 87 18 02 00 00    	ja     803d74 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b5c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b60:	48 b8 0f 23 80 00 00 	movabs $0x80230f,%rax
+  803b67:	00 00 00 
+  803b6a:	ff d0                	call   *%rax
+  803b6c:	41 89 c4             	mov    %eax,%r12d
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	0f 88 b6 01 00 00    	js     803d2d <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b77:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b81:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b85:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b8a:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+  803b96:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	0f 88 8c 01 00 00    	js     803d2d <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ba1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803ba5:	48 b8 0f 23 80 00 00 	movabs $0x80230f,%rax
+  803bac:	00 00 00 
+  803baf:	ff d0                	call   *%rax
+  803bb1:	41 89 c4             	mov    %eax,%r12d
+  803bb4:	85 c0                	test   %eax,%eax
+  803bb6:	0f 88 57 01 00 00    	js     803d13 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803bbc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bc6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bcf:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  803bd6:	00 00 00 
+  803bd9:	ff d0                	call   *%rax
+  803bdb:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bde:	85 c0                	test   %eax,%eax
+  803be0:	0f 88 2d 01 00 00    	js     803d13 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803be6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bea:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  803bf1:	00 00 00 
+  803bf4:	ff d0                	call   *%rax
+  803bf6:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bf9:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803c00:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c05:	4c 89 fa             	mov    %r15,%rdx
+  803c08:	48 89 c6             	mov    %rax,%rsi
+  803c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c10:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  803c17:	00 00 00 
+  803c1a:	ff d0                	call   *%rax
+  803c1c:	41 89 c4             	mov    %eax,%r12d
+  803c1f:	85 c0                	test   %eax,%eax
+  803c21:	0f 88 d2 00 00 00    	js     803cf9 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803c27:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c2e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803c32:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+  803c3e:	48 89 c1             	mov    %rax,%rcx
+  803c41:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c47:	4d 89 f8             	mov    %r15,%r8
+  803c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c4f:	4c 89 f6             	mov    %r14,%rsi
+  803c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c57:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+  803c63:	41 89 c4             	mov    %eax,%r12d
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	78 78                	js     803ce2 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c6a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c6f:	4c 89 f7             	mov    %r14,%rdi
+  803c72:	48 b8 12 16 80 00 00 	movabs $0x801612,%rax
+  803c79:	00 00 00 
+  803c7c:	ff d0                	call   *%rax
+  803c7e:	83 f8 02             	cmp    $0x2,%eax
+  803c81:	0f 85 b8 00 00 00    	jne    803d3f <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c87:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c8e:	00 00 
+  803c90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c94:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c96:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c9a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ca1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ca5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ca7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cab:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803cb2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cb6:	48 bb df 22 80 00 00 	movabs $0x8022df,%rbx
+  803cbd:	00 00 00 
+  803cc0:	ff d3                	call   *%rbx
+  803cc2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803cc6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803cca:	ff d3                	call   *%rbx
+  803ccc:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803cd0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803cd6:	eb 55                	jmp    803d2d <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  803cd8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803cdd:	e9 7a fe ff ff       	jmp    803b5c <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803ce2:	4c 89 fa             	mov    %r15,%rdx
+  803ce5:	4c 89 f6             	mov    %r14,%rsi
+  803ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ced:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cfe:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d07:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d18:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d21:	48 b8 a4 17 80 00 00 	movabs $0x8017a4,%rax
+  803d28:	00 00 00 
+  803d2b:	ff d0                	call   *%rax
+}
+  803d2d:	44 89 e0             	mov    %r12d,%eax
+  803d30:	48 83 c4 18          	add    $0x18,%rsp
+  803d34:	5b                   	pop    %rbx
+  803d35:	41 5c                	pop    %r12
+  803d37:	41 5d                	pop    %r13
+  803d39:	41 5e                	pop    %r14
+  803d3b:	41 5f                	pop    %r15
+  803d3d:	5d                   	pop    %rbp
+  803d3e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d3f:	48 b9 10 58 80 00 00 	movabs $0x805810,%rcx
+  803d46:	00 00 00 
+  803d49:	48 ba e7 57 80 00 00 	movabs $0x8057e7,%rdx
+  803d50:	00 00 00 
+  803d53:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803d58:	48 bf fc 57 80 00 00 	movabs $0x8057fc,%rdi
+  803d5f:	00 00 00 
+  803d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d67:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  803d6e:	00 00 00 
+  803d71:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803d74:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803d7a:	eb b1                	jmp    803d2d <pipe_sized+0x20c>
+
+0000000000803d7c <pipe>:
+pipe(int pfd[2]) {
+  803d7c:	55                   	push   %rbp
+  803d7d:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  803d80:	be 00 00 01 00       	mov    $0x10000,%esi
+  803d85:	48 b8 21 3b 80 00 00 	movabs $0x803b21,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+}
+  803d91:	5d                   	pop    %rbp
+  803d92:	c3                   	ret
+
+0000000000803d93 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d93:	55                   	push   %rbp
+  803d94:	48 89 e5             	mov    %rsp,%rbp
+  803d97:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d9b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d9f:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	78 23                	js     803dd2 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803daf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803db3:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  803dba:	00 00 00 
+  803dbd:	ff d0                	call   *%rax
+  803dbf:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803dc2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dc6:	48 b8 4e 38 80 00 00 	movabs $0x80384e,%rax
+  803dcd:	00 00 00 
+  803dd0:	ff d0                	call   *%rax
+}
+  803dd2:	c9                   	leave
+  803dd3:	c3                   	ret
+
+0000000000803dd4 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803dd4:	55                   	push   %rbp
+  803dd5:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803dd8:	8b 0f                	mov    (%rdi),%ecx
+  803dda:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ddd:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803ddf:	83 f9 07             	cmp    $0x7,%ecx
+  803de2:	76 31                	jbe    803e15 <backoff+0x41>
+    asm volatile("rdtsc"
+  803de4:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803de6:	83 c1 06             	add    $0x6,%ecx
+  803de9:	be 15 00 00 00       	mov    $0x15,%esi
+  803dee:	39 f1                	cmp    %esi,%ecx
+  803df0:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803df3:	bf 01 00 00 00       	mov    $0x1,%edi
+  803df8:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803dfb:	48 c1 e2 20          	shl    $0x20,%rdx
+  803dff:	89 c0                	mov    %eax,%eax
+  803e01:	48 09 c2             	or     %rax,%rdx
+  803e04:	48 01 d7             	add    %rdx,%rdi
+  803e07:	48 b8 6c 1c 80 00 00 	movabs $0x801c6c,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+}
+  803e13:	5d                   	pop    %rbp
+  803e14:	c3                   	ret
+        sys_yield();
+  803e15:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+        return;
+  803e21:	eb f0                	jmp    803e13 <backoff+0x3f>
+
+0000000000803e23 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803e23:	55                   	push   %rbp
+  803e24:	48 89 e5             	mov    %rsp,%rbp
+  803e27:	41 55                	push   %r13
+  803e29:	41 54                	push   %r12
+  803e2b:	53                   	push   %rbx
+  803e2c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803e30:	85 ff                	test   %edi,%edi
+  803e32:	74 7e                	je     803eb2 <wait+0x8f>
+  803e34:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803e37:	89 f8                	mov    %edi,%eax
+  803e39:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803e3e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803e45:	89 f9                	mov    %edi,%ecx
+  803e47:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803e4d:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803e54:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e5b:	00 00 00 
+  803e5e:	48 01 ca             	add    %rcx,%rdx
+  803e61:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803e67:	39 d7                	cmp    %edx,%edi
+  803e69:	75 3c                	jne    803ea7 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803e6b:	48 98                	cltq
+  803e6d:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803e74:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803e7b:	00 00 00 
+  803e7e:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803e81:	49 bd d4 3d 80 00 00 	movabs $0x803dd4,%r13
+  803e88:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803e8b:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803e91:	85 c0                	test   %eax,%eax
+  803e93:	74 12                	je     803ea7 <wait+0x84>
+        backoff(&attempt);
+  803e95:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803e99:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803e9c:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803ea2:	44 39 e0             	cmp    %r12d,%eax
+  803ea5:	74 e4                	je     803e8b <wait+0x68>
+    }
+}
+  803ea7:	48 83 c4 18          	add    $0x18,%rsp
+  803eab:	5b                   	pop    %rbx
+  803eac:	41 5c                	pop    %r12
+  803eae:	41 5d                	pop    %r13
+  803eb0:	5d                   	pop    %rbp
+  803eb1:	c3                   	ret
+    assert(envid != 0);
+  803eb2:	48 b9 34 58 80 00 00 	movabs $0x805834,%rcx
+  803eb9:	00 00 00 
+  803ebc:	48 ba e7 57 80 00 00 	movabs $0x8057e7,%rdx
+  803ec3:	00 00 00 
+  803ec6:	be 22 00 00 00       	mov    $0x22,%esi
+  803ecb:	48 bf 3f 58 80 00 00 	movabs $0x80583f,%rdi
+  803ed2:	00 00 00 
+  803ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eda:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  803ee1:	00 00 00 
+  803ee4:	41 ff d0             	call   *%r8
+
+0000000000803ee7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ee7:	48 89 f8             	mov    %rdi,%rax
+  803eea:	48 c1 e8 27          	shr    $0x27,%rax
+  803eee:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ef5:	7f 00 00 
+  803ef8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803efc:	f6 c2 01             	test   $0x1,%dl
+  803eff:	74 6d                	je     803f6e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f01:	48 89 f8             	mov    %rdi,%rax
+  803f04:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f08:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f0f:	7f 00 00 
+  803f12:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f16:	f6 c2 01             	test   $0x1,%dl
+  803f19:	74 62                	je     803f7d <get_uvpt_entry+0x96>
+  803f1b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f22:	7f 00 00 
+  803f25:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f29:	f6 c2 80             	test   $0x80,%dl
+  803f2c:	75 4f                	jne    803f7d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f2e:	48 89 f8             	mov    %rdi,%rax
+  803f31:	48 c1 e8 15          	shr    $0x15,%rax
+  803f35:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f3c:	7f 00 00 
+  803f3f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f43:	f6 c2 01             	test   $0x1,%dl
+  803f46:	74 44                	je     803f8c <get_uvpt_entry+0xa5>
+  803f48:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f4f:	7f 00 00 
+  803f52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f56:	f6 c2 80             	test   $0x80,%dl
+  803f59:	75 31                	jne    803f8c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f5b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f5f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f66:	7f 00 00 
+  803f69:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f6d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f6e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f75:	7f 00 00 
+  803f78:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f7c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f7d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f84:	7f 00 00 
+  803f87:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f8b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f8c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f93:	7f 00 00 
+  803f96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f9a:	c3                   	ret
+
+0000000000803f9b <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f9b:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f9e:	48 89 f9             	mov    %rdi,%rcx
+  803fa1:	48 c1 e9 27          	shr    $0x27,%rcx
+  803fa5:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803fac:	7f 00 00 
+  803faf:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803fb3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803fba:	f6 c1 01             	test   $0x1,%cl
+  803fbd:	0f 84 b2 00 00 00    	je     804075 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fc3:	48 89 f9             	mov    %rdi,%rcx
+  803fc6:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803fca:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fd1:	7f 00 00 
+  803fd4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fd8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fdf:	40 f6 c6 01          	test   $0x1,%sil
+  803fe3:	0f 84 8c 00 00 00    	je     804075 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803fe9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ff0:	7f 00 00 
+  803ff3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ff7:	a8 80                	test   $0x80,%al
+  803ff9:	75 7b                	jne    804076 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ffb:	48 89 f9             	mov    %rdi,%rcx
+  803ffe:	48 c1 e9 15          	shr    $0x15,%rcx
+  804002:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804009:	7f 00 00 
+  80400c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804010:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804017:	40 f6 c6 01          	test   $0x1,%sil
+  80401b:	74 58                	je     804075 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80401d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804024:	7f 00 00 
+  804027:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80402b:	a8 80                	test   $0x80,%al
+  80402d:	75 6c                	jne    80409b <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80402f:	48 89 f9             	mov    %rdi,%rcx
+  804032:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804036:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80403d:	7f 00 00 
+  804040:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804044:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80404b:	40 f6 c6 01          	test   $0x1,%sil
+  80404f:	74 24                	je     804075 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804051:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804058:	7f 00 00 
+  80405b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80405f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804066:	ff ff 7f 
+  804069:	48 21 c8             	and    %rcx,%rax
+  80406c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804072:	48 09 d0             	or     %rdx,%rax
+}
+  804075:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804076:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80407d:	7f 00 00 
+  804080:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804084:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80408b:	ff ff 7f 
+  80408e:	48 21 c8             	and    %rcx,%rax
+  804091:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804097:	48 01 d0             	add    %rdx,%rax
+  80409a:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80409b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8040a2:	7f 00 00 
+  8040a5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8040a9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8040b0:	ff ff 7f 
+  8040b3:	48 21 c8             	and    %rcx,%rax
+  8040b6:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8040bc:	48 01 d0             	add    %rdx,%rax
+  8040bf:	c3                   	ret
+
+00000000008040c0 <get_prot>:
+
+int
+get_prot(void *va) {
+  8040c0:	55                   	push   %rbp
+  8040c1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040c4:	48 b8 e7 3e 80 00 00 	movabs $0x803ee7,%rax
+  8040cb:	00 00 00 
+  8040ce:	ff d0                	call   *%rax
+  8040d0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040d3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040d8:	89 c1                	mov    %eax,%ecx
+  8040da:	83 c9 04             	or     $0x4,%ecx
+  8040dd:	f6 c2 01             	test   $0x1,%dl
+  8040e0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040e3:	89 c1                	mov    %eax,%ecx
+  8040e5:	83 c9 02             	or     $0x2,%ecx
+  8040e8:	f6 c2 02             	test   $0x2,%dl
+  8040eb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040ee:	89 c1                	mov    %eax,%ecx
+  8040f0:	83 c9 01             	or     $0x1,%ecx
+  8040f3:	48 85 d2             	test   %rdx,%rdx
+  8040f6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040f9:	89 c1                	mov    %eax,%ecx
+  8040fb:	83 c9 40             	or     $0x40,%ecx
+  8040fe:	f6 c6 04             	test   $0x4,%dh
+  804101:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804104:	5d                   	pop    %rbp
+  804105:	c3                   	ret
+
+0000000000804106 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804106:	55                   	push   %rbp
+  804107:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80410a:	48 b8 e7 3e 80 00 00 	movabs $0x803ee7,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804116:	48 c1 e8 06          	shr    $0x6,%rax
+  80411a:	83 e0 01             	and    $0x1,%eax
+}
+  80411d:	5d                   	pop    %rbp
+  80411e:	c3                   	ret
+
+000000000080411f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80411f:	55                   	push   %rbp
+  804120:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804123:	48 b8 e7 3e 80 00 00 	movabs $0x803ee7,%rax
+  80412a:	00 00 00 
+  80412d:	ff d0                	call   *%rax
+  80412f:	83 e0 01             	and    $0x1,%eax
+}
+  804132:	5d                   	pop    %rbp
+  804133:	c3                   	ret
+
+0000000000804134 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  804134:	55                   	push   %rbp
+  804135:	48 89 e5             	mov    %rsp,%rbp
+  804138:	41 57                	push   %r15
+  80413a:	41 56                	push   %r14
+  80413c:	41 55                	push   %r13
+  80413e:	41 54                	push   %r12
+  804140:	53                   	push   %rbx
+  804141:	48 83 ec 18          	sub    $0x18,%rsp
+  804145:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804149:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  80414d:	48 39 f7             	cmp    %rsi,%rdi
+  804150:	0f 83 e4 00 00 00    	jae    80423a <foreach_present_page+0x106>
+  804156:	49 89 f4             	mov    %rsi,%r12
+  804159:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80415c:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  804163:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  804166:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  80416d:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  804170:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  804177:	7f 00 00 
+  80417a:	eb 27                	jmp    8041a3 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  80417c:	48 89 d8             	mov    %rbx,%rax
+  80417f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804183:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  804187:	f6 c2 01             	test   $0x1,%dl
+  80418a:	75 43                	jne    8041cf <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  80418c:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  804193:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  80419a:	4c 39 e3             	cmp    %r12,%rbx
+  80419d:	0f 83 83 00 00 00    	jae    804226 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8041a3:	48 89 d8             	mov    %rbx,%rax
+  8041a6:	48 c1 e8 27          	shr    $0x27,%rax
+  8041aa:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8041af:	a8 01                	test   $0x1,%al
+  8041b1:	75 c9                	jne    80417c <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  8041b3:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  8041ba:	ff ff ff 
+  8041bd:	48 21 d8             	and    %rbx,%rax
+  8041c0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8041c7:	00 00 00 
+  8041ca:	48 01 c3             	add    %rax,%rbx
+  8041cd:	eb cb                	jmp    80419a <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8041cf:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  8041d3:	a8 80                	test   $0x80,%al
+  8041d5:	75 1f                	jne    8041f6 <foreach_present_page+0xc2>
+  8041d7:	48 89 d8             	mov    %rbx,%rax
+  8041da:	48 c1 e8 15          	shr    $0x15,%rax
+  8041de:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8041e2:	a8 01                	test   $0x1,%al
+  8041e4:	75 10                	jne    8041f6 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8041e6:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8041ed:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8041f4:	eb a4                	jmp    80419a <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8041f6:	48 89 df             	mov    %rbx,%rdi
+  8041f9:	48 b8 e7 3e 80 00 00 	movabs $0x803ee7,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+  804205:	a8 01                	test   $0x1,%al
+  804207:	74 11                	je     80421a <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  804209:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80420d:	48 89 df             	mov    %rbx,%rdi
+  804210:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804214:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  804216:	85 c0                	test   %eax,%eax
+  804218:	78 11                	js     80422b <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  80421a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804221:	e9 74 ff ff ff       	jmp    80419a <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  804226:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80422b:	48 83 c4 18          	add    $0x18,%rsp
+  80422f:	5b                   	pop    %rbx
+  804230:	41 5c                	pop    %r12
+  804232:	41 5d                	pop    %r13
+  804234:	41 5e                	pop    %r14
+  804236:	41 5f                	pop    %r15
+  804238:	5d                   	pop    %rbp
+  804239:	c3                   	ret
+    return 0;
+  80423a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423f:	eb ea                	jmp    80422b <foreach_present_page+0xf7>
+
+0000000000804241 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  804241:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804248:	7f 00 00 
+  80424b:	a8 01                	test   $0x1,%al
+  80424d:	75 06                	jne    804255 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80424f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804254:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804255:	55                   	push   %rbp
+  804256:	48 89 e5             	mov    %rsp,%rbp
+  804259:	41 57                	push   %r15
+  80425b:	41 56                	push   %r14
+  80425d:	41 55                	push   %r13
+  80425f:	41 54                	push   %r12
+  804261:	53                   	push   %rbx
+  804262:	48 83 ec 28          	sub    $0x28,%rsp
+  804266:	49 89 fe             	mov    %rdi,%r14
+  804269:	49 89 f7             	mov    %rsi,%r15
+  80426c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804273:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804274:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  80427b:	7f 00 00 
+  80427e:	e9 b0 00 00 00       	jmp    804333 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  804283:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80428a:	49 83 ec 01          	sub    $0x1,%r12
+  80428e:	74 2d                	je     8042bd <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  804290:	48 89 d8             	mov    %rbx,%rax
+  804293:	48 c1 e8 0c          	shr    $0xc,%rax
+  804297:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80429c:	f6 c2 01             	test   $0x1,%dl
+  80429f:	74 e2                	je     804283 <foreach_shared_region+0x42>
+  8042a1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8042a6:	f6 c4 04             	test   $0x4,%ah
+  8042a9:	74 d8                	je     804283 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  8042ab:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8042b2:	4c 89 fa             	mov    %r15,%rdx
+  8042b5:	48 89 df             	mov    %rbx,%rdi
+  8042b8:	41 ff d6             	call   *%r14
+  8042bb:	eb c6                	jmp    804283 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  8042bd:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8042c4:	00 
+  8042c5:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8042ca:	74 4c                	je     804318 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  8042cc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8042d0:	48 89 c8             	mov    %rcx,%rax
+  8042d3:	48 c1 e8 15          	shr    $0x15,%rax
+  8042d7:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8042de:	7f 00 00 
+  8042e1:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8042e5:	a8 01                	test   $0x1,%al
+  8042e7:	74 d4                	je     8042bd <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8042e9:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8042f0:	48 39 c1             	cmp    %rax,%rcx
+  8042f3:	73 c8                	jae    8042bd <foreach_shared_region+0x7c>
+  8042f5:	48 89 cb             	mov    %rcx,%rbx
+  8042f8:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8042ff:	48 39 d0             	cmp    %rdx,%rax
+  804302:	4d 19 e4             	sbb    %r12,%r12
+  804305:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80430c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804313:	e9 78 ff ff ff       	jmp    804290 <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  804318:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80431f:	40 
+  804320:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804324:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80432b:	00 00 00 
+  80432e:	48 39 c1             	cmp    %rax,%rcx
+  804331:	74 4f                	je     804382 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  804333:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804337:	48 89 c8             	mov    %rcx,%rax
+  80433a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80433e:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  804345:	7f 00 00 
+  804348:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80434c:	a8 01                	test   $0x1,%al
+  80434e:	74 c8                	je     804318 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  804350:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804357:	48 39 c1             	cmp    %rax,%rcx
+  80435a:	73 bc                	jae    804318 <foreach_shared_region+0xd7>
+  80435c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804363:	48 39 d0             	cmp    %rdx,%rax
+  804366:	48 19 c0             	sbb    %rax,%rax
+  804369:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80436f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804375:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804379:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80437d:	e9 4a ff ff ff       	jmp    8042cc <foreach_shared_region+0x8b>
+}
+  804382:	b8 00 00 00 00       	mov    $0x0,%eax
+  804387:	48 83 c4 28          	add    $0x28,%rsp
+  80438b:	5b                   	pop    %rbx
+  80438c:	41 5c                	pop    %r12
+  80438e:	41 5d                	pop    %r13
+  804390:	41 5e                	pop    %r14
+  804392:	41 5f                	pop    %r15
+  804394:	5d                   	pop    %rbp
+  804395:	c3                   	ret
+
+0000000000804396 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439b:	c3                   	ret
+
+000000000080439c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80439c:	55                   	push   %rbp
+  80439d:	48 89 e5             	mov    %rsp,%rbp
+  8043a0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8043a3:	48 be 4a 58 80 00 00 	movabs $0x80584a,%rsi
+  8043aa:	00 00 00 
+  8043ad:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  8043b4:	00 00 00 
+  8043b7:	ff d0                	call   *%rax
+    return 0;
+}
+  8043b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043be:	5d                   	pop    %rbp
+  8043bf:	c3                   	ret
+
+00000000008043c0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043c0:	55                   	push   %rbp
+  8043c1:	48 89 e5             	mov    %rsp,%rbp
+  8043c4:	41 57                	push   %r15
+  8043c6:	41 56                	push   %r14
+  8043c8:	41 55                	push   %r13
+  8043ca:	41 54                	push   %r12
+  8043cc:	53                   	push   %rbx
+  8043cd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043d4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043db:	48 85 d2             	test   %rdx,%rdx
+  8043de:	74 7a                	je     80445a <devcons_write+0x9a>
+  8043e0:	49 89 d6             	mov    %rdx,%r14
+  8043e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043e9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043ee:	49 bf ba 12 80 00 00 	movabs $0x8012ba,%r15
+  8043f5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043f8:	4c 89 f3             	mov    %r14,%rbx
+  8043fb:	48 29 f3             	sub    %rsi,%rbx
+  8043fe:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804403:	48 39 c3             	cmp    %rax,%rbx
+  804406:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80440a:	4c 63 eb             	movslq %ebx,%r13
+  80440d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804414:	48 01 c6             	add    %rax,%rsi
+  804417:	4c 89 ea             	mov    %r13,%rdx
+  80441a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804421:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804424:	4c 89 ee             	mov    %r13,%rsi
+  804427:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80442e:	48 b8 e7 14 80 00 00 	movabs $0x8014e7,%rax
+  804435:	00 00 00 
+  804438:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80443a:	41 01 dc             	add    %ebx,%r12d
+  80443d:	49 63 f4             	movslq %r12d,%rsi
+  804440:	4c 39 f6             	cmp    %r14,%rsi
+  804443:	72 b3                	jb     8043f8 <devcons_write+0x38>
+    return res;
+  804445:	49 63 c4             	movslq %r12d,%rax
+}
+  804448:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80444f:	5b                   	pop    %rbx
+  804450:	41 5c                	pop    %r12
+  804452:	41 5d                	pop    %r13
+  804454:	41 5e                	pop    %r14
+  804456:	41 5f                	pop    %r15
+  804458:	5d                   	pop    %rbp
+  804459:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80445a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804460:	eb e3                	jmp    804445 <devcons_write+0x85>
+
+0000000000804462 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804462:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804465:	ba 00 00 00 00       	mov    $0x0,%edx
+  80446a:	48 85 c0             	test   %rax,%rax
+  80446d:	74 60                	je     8044cf <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80446f:	55                   	push   %rbp
+  804470:	48 89 e5             	mov    %rsp,%rbp
+  804473:	41 55                	push   %r13
+  804475:	41 54                	push   %r12
+  804477:	53                   	push   %rbx
+  804478:	48 83 ec 18          	sub    $0x18,%rsp
+  80447c:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80447f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  804486:	48 bb 14 15 80 00 00 	movabs $0x801514,%rbx
+  80448d:	00 00 00 
+  804490:	49 bc d4 3d 80 00 00 	movabs $0x803dd4,%r12
+  804497:	00 00 00 
+  80449a:	eb 07                	jmp    8044a3 <devcons_read+0x41>
+  80449c:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8044a0:	41 ff d4             	call   *%r12
+  8044a3:	ff d3                	call   *%rbx
+  8044a5:	85 c0                	test   %eax,%eax
+  8044a7:	74 f3                	je     80449c <devcons_read+0x3a>
+    if (c < 0) return c;
+  8044a9:	48 63 d0             	movslq %eax,%rdx
+  8044ac:	78 13                	js     8044c1 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  8044ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044b3:	83 f8 04             	cmp    $0x4,%eax
+  8044b6:	74 09                	je     8044c1 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  8044b8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044bc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044c1:	48 89 d0             	mov    %rdx,%rax
+  8044c4:	48 83 c4 18          	add    $0x18,%rsp
+  8044c8:	5b                   	pop    %rbx
+  8044c9:	41 5c                	pop    %r12
+  8044cb:	41 5d                	pop    %r13
+  8044cd:	5d                   	pop    %rbp
+  8044ce:	c3                   	ret
+  8044cf:	48 89 d0             	mov    %rdx,%rax
+  8044d2:	c3                   	ret
+
+00000000008044d3 <cputchar>:
+cputchar(int ch) {
+  8044d3:	55                   	push   %rbp
+  8044d4:	48 89 e5             	mov    %rsp,%rbp
+  8044d7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044db:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044df:	be 01 00 00 00       	mov    $0x1,%esi
+  8044e4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044e8:	48 b8 e7 14 80 00 00 	movabs $0x8014e7,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+}
+  8044f4:	c9                   	leave
+  8044f5:	c3                   	ret
+
+00000000008044f6 <getchar>:
+getchar(void) {
+  8044f6:	55                   	push   %rbp
+  8044f7:	48 89 e5             	mov    %rsp,%rbp
+  8044fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044fe:	ba 01 00 00 00       	mov    $0x1,%edx
+  804503:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804507:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450c:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+  804518:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80451a:	85 c0                	test   %eax,%eax
+  80451c:	78 06                	js     804524 <getchar+0x2e>
+  80451e:	74 08                	je     804528 <getchar+0x32>
+  804520:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804524:	89 d0                	mov    %edx,%eax
+  804526:	c9                   	leave
+  804527:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804528:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80452d:	eb f5                	jmp    804524 <getchar+0x2e>
+
+000000000080452f <iscons>:
+iscons(int fdnum) {
+  80452f:	55                   	push   %rbp
+  804530:	48 89 e5             	mov    %rsp,%rbp
+  804533:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804537:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80453b:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  804542:	00 00 00 
+  804545:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804547:	85 c0                	test   %eax,%eax
+  804549:	78 18                	js     804563 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80454b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80454f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804556:	00 00 00 
+  804559:	8b 00                	mov    (%rax),%eax
+  80455b:	39 02                	cmp    %eax,(%rdx)
+  80455d:	0f 94 c0             	sete   %al
+  804560:	0f b6 c0             	movzbl %al,%eax
+}
+  804563:	c9                   	leave
+  804564:	c3                   	ret
+
+0000000000804565 <opencons>:
+opencons(void) {
+  804565:	55                   	push   %rbp
+  804566:	48 89 e5             	mov    %rsp,%rbp
+  804569:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80456d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804571:	48 b8 0f 23 80 00 00 	movabs $0x80230f,%rax
+  804578:	00 00 00 
+  80457b:	ff d0                	call   *%rax
+  80457d:	85 c0                	test   %eax,%eax
+  80457f:	78 49                	js     8045ca <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804581:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804586:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80458b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80458f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804594:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80459b:	00 00 00 
+  80459e:	ff d0                	call   *%rax
+  8045a0:	85 c0                	test   %eax,%eax
+  8045a2:	78 26                	js     8045ca <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8045a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045a8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8045af:	00 00 
+  8045b1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045b3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045b7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045be:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  8045c5:	00 00 00 
+  8045c8:	ff d0                	call   *%rax
+}
+  8045ca:	c9                   	leave
+  8045cb:	c3                   	ret
+
+00000000008045cc <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  8045cc:	55                   	push   %rbp
+  8045cd:	48 89 e5             	mov    %rsp,%rbp
+  8045d0:	41 55                	push   %r13
+  8045d2:	41 54                	push   %r12
+  8045d4:	53                   	push   %rbx
+  8045d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d9:	49 89 fc             	mov    %rdi,%r12
+  8045dc:	48 89 f7             	mov    %rsi,%rdi
+  8045df:	48 89 d3             	mov    %rdx,%rbx
+  8045e2:	49 89 cd             	mov    %rcx,%r13
+  8045e5:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045e8:	48 85 f6             	test   %rsi,%rsi
+  8045eb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045f2:	00 00 00 
+  8045f5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  8045f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8045fe:	48 85 db             	test   %rbx,%rbx
+  804601:	74 03                	je     804606 <ipc_recv_timeout+0x3a>
+  804603:	48 8b 33             	mov    (%rbx),%rsi
+  804606:	48 b8 05 1c 80 00 00 	movabs $0x801c05,%rax
+  80460d:	00 00 00 
+  804610:	ff d0                	call   *%rax
+    if (res == 0) {
+  804612:	85 c0                	test   %eax,%eax
+  804614:	75 72                	jne    804688 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  804616:	4d 85 e4             	test   %r12,%r12
+  804619:	74 17                	je     804632 <ipc_recv_timeout+0x66>
+  80461b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804622:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  804624:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804628:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  80462e:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  804632:	4d 85 ed             	test   %r13,%r13
+  804635:	74 17                	je     80464e <ipc_recv_timeout+0x82>
+  804637:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80463e:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  804640:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804644:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80464a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  80464e:	48 85 db             	test   %rbx,%rbx
+  804651:	74 17                	je     80466a <ipc_recv_timeout+0x9e>
+  804653:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80465a:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  80465c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804660:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  804667:	48 89 03             	mov    %rax,(%rbx)
+  80466a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804671:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  804673:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804677:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  80467d:	48 83 c4 08          	add    $0x8,%rsp
+  804681:	5b                   	pop    %rbx
+  804682:	41 5c                	pop    %r12
+  804684:	41 5d                	pop    %r13
+  804686:	5d                   	pop    %rbp
+  804687:	c3                   	ret
+        if (from_env_store) {
+  804688:	4d 85 e4             	test   %r12,%r12
+  80468b:	74 08                	je     804695 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  80468d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804694:	00 
+        if (perm_store) {
+  804695:	4d 85 ed             	test   %r13,%r13
+  804698:	74 08                	je     8046a2 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  80469a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8046a1:	00 
+        if (size) {
+  8046a2:	48 85 db             	test   %rbx,%rbx
+  8046a5:	74 d6                	je     80467d <ipc_recv_timeout+0xb1>
+            *size = 0;
+  8046a7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8046ae:	eb cd                	jmp    80467d <ipc_recv_timeout+0xb1>
+
+00000000008046b0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8046b0:	55                   	push   %rbp
+  8046b1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  8046b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046ba:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  8046c1:	00 00 00 
+  8046c4:	ff d0                	call   *%rax
+}
+  8046c6:	5d                   	pop    %rbp
+  8046c7:	c3                   	ret
+
+00000000008046c8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046c8:	55                   	push   %rbp
+  8046c9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046cc:	48 85 d2             	test   %rdx,%rdx
+  8046cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046d6:	00 00 00 
+  8046d9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  8046dd:	89 f6                	mov    %esi,%esi
+  8046df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046e5:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  8046ec:	00 00 00 
+  8046ef:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8046f1:	85 c0                	test   %eax,%eax
+  8046f3:	78 02                	js     8046f7 <ipc_send+0x2f>
+}
+  8046f5:	5d                   	pop    %rbp
+  8046f6:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  8046f7:	89 c1                	mov    %eax,%ecx
+  8046f9:	48 ba 56 58 80 00 00 	movabs $0x805856,%rdx
+  804700:	00 00 00 
+  804703:	be 51 00 00 00       	mov    $0x51,%esi
+  804708:	48 bf 6d 58 80 00 00 	movabs $0x80586d,%rdi
+  80470f:	00 00 00 
+  804712:	b8 00 00 00 00       	mov    $0x0,%eax
+  804717:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80471e:	00 00 00 
+  804721:	41 ff d0             	call   *%r8
+
+0000000000804724 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  804724:	55                   	push   %rbp
+  804725:	48 89 e5             	mov    %rsp,%rbp
+  804728:	41 54                	push   %r12
+  80472a:	53                   	push   %rbx
+  80472b:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80472f:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804733:	48 85 d2             	test   %rdx,%rdx
+  804736:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80473d:	00 00 00 
+  804740:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804744:	4d 85 c9             	test   %r9,%r9
+  804747:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  80474b:	89 f6                	mov    %esi,%esi
+  80474d:	48 83 ec 08          	sub    $0x8,%rsp
+  804751:	53                   	push   %rbx
+  804752:	48 b8 5b 1b 80 00 00 	movabs $0x801b5b,%rax
+  804759:	00 00 00 
+  80475c:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  80475e:	48 83 c4 10          	add    $0x10,%rsp
+  804762:	85 c0                	test   %eax,%eax
+  804764:	78 65                	js     8047cb <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804766:	4d 85 e4             	test   %r12,%r12
+  804769:	74 17                	je     804782 <ipc_call+0x5e>
+  80476b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804772:	00 00 
+  804774:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804778:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80477e:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  804782:	48 85 db             	test   %rbx,%rbx
+  804785:	74 28                	je     8047af <ipc_call+0x8b>
+  804787:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80478e:	00 00 
+  804790:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  804794:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  80479b:	ba 20 00 00 00       	mov    $0x20,%edx
+  8047a0:	48 89 df             	mov    %rbx,%rdi
+  8047a3:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8047aa:	00 00 00 
+  8047ad:	ff d0                	call   *%rax
+  8047af:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8047b6:	00 00 
+    return thisenv->env_ipc_value;
+  8047b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047bc:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8047c2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8047c6:	5b                   	pop    %rbx
+  8047c7:	41 5c                	pop    %r12
+  8047c9:	5d                   	pop    %rbp
+  8047ca:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  8047cb:	89 c1                	mov    %eax,%ecx
+  8047cd:	48 ba 77 58 80 00 00 	movabs $0x805877,%rdx
+  8047d4:	00 00 00 
+  8047d7:	be 62 00 00 00       	mov    $0x62,%esi
+  8047dc:	48 bf 6d 58 80 00 00 	movabs $0x80586d,%rdi
+  8047e3:	00 00 00 
+  8047e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047eb:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8047f2:	00 00 00 
+  8047f5:	41 ff d0             	call   *%r8
+
+00000000008047f8 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  8047f8:	55                   	push   %rbp
+  8047f9:	48 89 e5             	mov    %rsp,%rbp
+  8047fc:	41 57                	push   %r15
+  8047fe:	41 56                	push   %r14
+  804800:	41 55                	push   %r13
+  804802:	41 54                	push   %r12
+  804804:	53                   	push   %rbx
+  804805:	48 83 ec 20          	sub    $0x20,%rsp
+  804809:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  80480c:	48 89 d3             	mov    %rdx,%rbx
+  80480f:	49 89 ce             	mov    %rcx,%r14
+  804812:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  804816:	4d 89 cd             	mov    %r9,%r13
+  804819:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  80481d:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804821:	48 85 d2             	test   %rdx,%rdx
+  804824:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80482b:	00 00 00 
+  80482e:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804832:	4d 85 e4             	test   %r12,%r12
+  804835:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  804839:	89 f0                	mov    %esi,%eax
+  80483b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80483f:	41 57                	push   %r15
+  804841:	4d 89 e1             	mov    %r12,%r9
+  804844:	48 89 da             	mov    %rbx,%rdx
+  804847:	48 89 c6             	mov    %rax,%rsi
+  80484a:	48 b8 b0 1b 80 00 00 	movabs $0x801bb0,%rax
+  804851:	00 00 00 
+  804854:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  804856:	48 83 c4 10          	add    $0x10,%rsp
+  80485a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80485d:	0f 84 93 00 00 00    	je     8048f6 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804863:	85 c0                	test   %eax,%eax
+  804865:	0f 88 f3 00 00 00    	js     80495e <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80486b:	4d 85 ed             	test   %r13,%r13
+  80486e:	74 17                	je     804887 <ipc_reply_wait+0x8f>
+  804870:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804877:	00 00 
+  804879:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80487d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804883:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  804887:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80488c:	74 19                	je     8048a7 <ipc_reply_wait+0xaf>
+  80488e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  804895:	00 00 
+  804897:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80489b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8048a1:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8048a5:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8048a7:	4d 85 ff             	test   %r15,%r15
+  8048aa:	74 28                	je     8048d4 <ipc_reply_wait+0xdc>
+  8048ac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8048b3:	00 00 
+  8048b5:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8048b9:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8048c0:	ba 20 00 00 00       	mov    $0x20,%edx
+  8048c5:	4c 89 ff             	mov    %r15,%rdi
+  8048c8:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8048cf:	00 00 00 
+  8048d2:	ff d0                	call   *%rax
+  8048d4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8048db:	00 00 
+    return thisenv->env_ipc_value;
+  8048dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8048e1:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8048e7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8048eb:	5b                   	pop    %rbx
+  8048ec:	41 5c                	pop    %r12
+  8048ee:	41 5d                	pop    %r13
+  8048f0:	41 5e                	pop    %r14
+  8048f2:	41 5f                	pop    %r15
+  8048f4:	5d                   	pop    %rbp
+  8048f5:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  8048f6:	4d 89 f9             	mov    %r15,%r9
+  8048f9:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8048fd:	4c 89 f1             	mov    %r14,%rcx
+  804900:	48 89 da             	mov    %rbx,%rdx
+  804903:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804907:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80490a:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  804911:	00 00 00 
+  804914:	ff d0                	call   *%rax
+  804916:	85 c0                	test   %eax,%eax
+  804918:	78 17                	js     804931 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  80491a:	4c 89 f6             	mov    %r14,%rsi
+  80491d:	4c 89 e7             	mov    %r12,%rdi
+  804920:	48 b8 f2 1a 80 00 00 	movabs $0x801af2,%rax
+  804927:	00 00 00 
+  80492a:	ff d0                	call   *%rax
+  80492c:	e9 32 ff ff ff       	jmp    804863 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804931:	89 c1                	mov    %eax,%ecx
+  804933:	48 ba 56 58 80 00 00 	movabs $0x805856,%rdx
+  80493a:	00 00 00 
+  80493d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804942:	48 bf 6d 58 80 00 00 	movabs $0x80586d,%rdi
+  804949:	00 00 00 
+  80494c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804951:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  804958:	00 00 00 
+  80495b:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  80495e:	89 c1                	mov    %eax,%ecx
+  804960:	48 ba 8e 58 80 00 00 	movabs $0x80588e,%rdx
+  804967:	00 00 00 
+  80496a:	be 7d 00 00 00       	mov    $0x7d,%esi
+  80496f:	48 bf 6d 58 80 00 00 	movabs $0x80586d,%rdi
+  804976:	00 00 00 
+  804979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80497e:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  804985:	00 00 00 
+  804988:	41 ff d0             	call   *%r8
+
+000000000080498b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80498b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804990:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804997:	00 00 00 
+  80499a:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8049a1:	48 01 ca             	add    %rcx,%rdx
+  8049a4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8049aa:	39 fa                	cmp    %edi,%edx
+  8049ac:	74 12                	je     8049c0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8049ae:	48 83 c0 01          	add    $0x1,%rax
+  8049b2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8049b8:	75 e0                	jne    80499a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8049ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049bf:	c3                   	ret
+            return envs[i].env_id;
+  8049c0:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8049c7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049ce:	00 00 00 
+  8049d1:	48 01 d0             	add    %rdx,%rax
+  8049d4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8049da:	c3                   	ret
+
+00000000008049db <__text_end>:
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
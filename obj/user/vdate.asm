@@ -0,0 +1,7968 @@
+
+obj/user/vdate:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5f 03 00 00       	call   800382 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = vsys_gettime();
+  80002e:	48 b8 f5 3a 80 00 00 	movabs $0x803af5,%rax
+  800035:	00 00 00 
+  800038:	ff d0                	call   *%rax
+  80003a:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  80003d:	48 63 f0             	movslq %eax,%rsi
+  800040:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  800047:	48 c1 fe 35          	sar    $0x35,%rsi
+  80004b:	c1 f8 1f             	sar    $0x1f,%eax
+  80004e:	29 c6                	sub    %eax,%esi
+  800050:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  800056:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  80005c:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  800062:	89 f9                	mov    %edi,%ecx
+  800064:	83 c7 01             	add    $0x1,%edi
+  800067:	8d 41 03             	lea    0x3(%rcx),%eax
+  80006a:	85 c9                	test   %ecx,%ecx
+  80006c:	0f 49 c1             	cmovns %ecx,%eax
+  80006f:	c1 f8 02             	sar    $0x2,%eax
+  800072:	01 f0                	add    %esi,%eax
+  800074:	48 63 d1             	movslq %ecx,%rdx
+  800077:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80007e:	48 89 d3             	mov    %rdx,%rbx
+  800081:	48 c1 fb 25          	sar    $0x25,%rbx
+  800085:	49 89 db             	mov    %rbx,%r11
+  800088:	41 89 c9             	mov    %ecx,%r9d
+  80008b:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80008f:	45 89 ca             	mov    %r9d,%r10d
+  800092:	41 29 da             	sub    %ebx,%r10d
+  800095:	44 01 d0             	add    %r10d,%eax
+  800098:	48 c1 fa 27          	sar    $0x27,%rdx
+  80009c:	44 29 ca             	sub    %r9d,%edx
+  80009f:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  8000a6:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000ac:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  8000b2:	41 39 c0             	cmp    %eax,%r8d
+  8000b5:	7d ab                	jge    800062 <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  8000b7:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  8000bd:	8d 41 02             	lea    0x2(%rcx),%eax
+  8000c0:	89 ca                	mov    %ecx,%edx
+  8000c2:	83 ea 01             	sub    $0x1,%edx
+  8000c5:	0f 49 c2             	cmovns %edx,%eax
+  8000c8:	c1 f8 02             	sar    $0x2,%eax
+  8000cb:	01 c6                	add    %eax,%esi
+  8000cd:	48 63 c2             	movslq %edx,%rax
+  8000d0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8000d7:	48 89 c3             	mov    %rax,%rbx
+  8000da:	48 c1 fb 25          	sar    $0x25,%rbx
+  8000de:	c1 fa 1f             	sar    $0x1f,%edx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	29 df                	sub    %ebx,%edi
+  8000e5:	01 fe                	add    %edi,%esi
+  8000e7:	48 c1 f8 27          	sar    $0x27,%rax
+  8000eb:	29 d0                	sub    %edx,%eax
+  8000ed:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8000f4:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8000fa:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8000fd:	4c 63 c9             	movslq %ecx,%r9
+  800100:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  800107:	4c 89 c8             	mov    %r9,%rax
+  80010a:	48 c1 f8 27          	sar    $0x27,%rax
+  80010e:	49 89 c2             	mov    %rax,%r10
+  800111:	89 c8                	mov    %ecx,%eax
+  800113:	c1 f8 1f             	sar    $0x1f,%eax
+  800116:	41 29 c2             	sub    %eax,%r10d
+  800119:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  800120:	41 89 ca             	mov    %ecx,%r10d
+  800123:	41 29 d2             	sub    %edx,%r10d
+  800126:	4d 89 d9             	mov    %r11,%r9
+  800129:	41 29 c1             	sub    %eax,%r9d
+  80012c:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  800130:	41 89 c9             	mov    %ecx,%r9d
+  800133:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  800136:	48 63 d6             	movslq %esi,%rdx
+  800139:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800140:	48 c1 ea 20          	shr    $0x20,%rdx
+  800144:	01 f2                	add    %esi,%edx
+  800146:	c1 fa 15             	sar    $0x15,%edx
+  800149:	89 f0                	mov    %esi,%eax
+  80014b:	c1 f8 1f             	sar    $0x1f,%eax
+  80014e:	29 c2                	sub    %eax,%edx
+  800150:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  800153:	41 89 cb             	mov    %ecx,%r11d
+  800156:	41 83 e3 03          	and    $0x3,%r11d
+  80015a:	44 89 cb             	mov    %r9d,%ebx
+  80015d:	eb 21                	jmp    800180 <umain+0x15b>
+  80015f:	85 d2                	test   %edx,%edx
+  800161:	40 0f 9f c7          	setg   %dil
+  800165:	40 0f b6 ff          	movzbl %dil,%edi
+  800169:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  80016d:	01 f8                	add    %edi,%eax
+  80016f:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800175:	39 c6                	cmp    %eax,%esi
+  800177:	0f 8c 89 00 00 00    	jl     800206 <umain+0x1e1>
+  80017d:	4c 89 c2             	mov    %r8,%rdx
+  800180:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  800187:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80018e:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  800195:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  80019c:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  8001a3:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  8001aa:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  8001b1:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  8001b8:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  8001bf:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8001c6:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8001cd:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8001d4:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8001db:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8001df:	45 85 d2             	test   %r10d,%r10d
+  8001e2:	0f 84 77 ff ff ff    	je     80015f <umain+0x13a>
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	45 85 db             	test   %r11d,%r11d
+  8001f0:	0f 85 73 ff ff ff    	jne    800169 <umain+0x144>
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	45 85 c9             	test   %r9d,%r9d
+  8001fb:	0f 84 68 ff ff ff    	je     800169 <umain+0x144>
+  800201:	e9 59 ff ff ff       	jmp    80015f <umain+0x13a>
+  800206:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  800208:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  80020f:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  800216:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  80021d:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  800224:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80022b:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  800232:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  800239:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  800240:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  800247:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80024e:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  800255:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  80025c:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  800263:	48 63 c2             	movslq %edx,%rax
+  800266:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  80026a:	45 85 d2             	test   %r10d,%r10d
+  80026d:	74 0e                	je     80027d <umain+0x258>
+  80026f:	f6 c1 03             	test   $0x3,%cl
+  800272:	0f 85 ff 00 00 00    	jne    800377 <umain+0x352>
+  800278:	45 85 c9             	test   %r9d,%r9d
+  80027b:	74 0b                	je     800288 <umain+0x263>
+  80027d:	83 ff 01             	cmp    $0x1,%edi
+  800280:	41 0f 9f c1          	setg   %r9b
+  800284:	45 0f b6 c9          	movzbl %r9b,%r9d
+  800288:	44 01 c8             	add    %r9d,%eax
+  80028b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800291:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  800293:	48 63 c6             	movslq %esi,%rax
+  800296:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  80029d:	48 c1 e8 20          	shr    $0x20,%rax
+  8002a1:	01 f0                	add    %esi,%eax
+  8002a3:	c1 f8 10             	sar    $0x10,%eax
+  8002a6:	41 89 f3             	mov    %esi,%r11d
+  8002a9:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  8002ad:	41 89 c2             	mov    %eax,%r10d
+  8002b0:	45 29 da             	sub    %r11d,%r10d
+  8002b3:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  8002ba:	29 fe                	sub    %edi,%esi
+  8002bc:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  8002bf:	48 63 f6             	movslq %esi,%rsi
+  8002c2:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8002c9:	48 c1 ee 20          	shr    $0x20,%rsi
+  8002cd:	44 01 d6             	add    %r10d,%esi
+  8002d0:	c1 fe 0b             	sar    $0xb,%esi
+  8002d3:	41 89 f0             	mov    %esi,%r8d
+  8002d6:	45 89 d1             	mov    %r10d,%r9d
+  8002d9:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8002dd:	89 f7                	mov    %esi,%edi
+  8002df:	44 29 cf             	sub    %r9d,%edi
+  8002e2:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8002e8:	44 89 d7             	mov    %r10d,%edi
+  8002eb:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8002ed:	44 29 d8             	sub    %r11d,%eax
+  8002f0:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8002f6:	48 63 c7             	movslq %edi,%rax
+  8002f9:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  800300:	48 c1 e8 20          	shr    $0x20,%rax
+  800304:	01 f8                	add    %edi,%eax
+  800306:	c1 f8 05             	sar    $0x5,%eax
+  800309:	41 89 fa             	mov    %edi,%r10d
+  80030c:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  800310:	44 29 d0             	sub    %r10d,%eax
+  800313:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  800317:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031a:	57                   	push   %rdi
+  80031b:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  80031c:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031f:	41 50                	push   %r8
+  800321:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  800325:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  800329:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800330:	00 00 00 
+  800333:	be 14 00 00 00       	mov    $0x14,%esi
+  800338:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 ba e9 0d 80 00 00 	movabs $0x800de9,%r10
+  800348:	00 00 00 
+  80034b:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("VDATE: %s\n", time);
+  80034e:	48 83 c4 20          	add    $0x20,%rsp
+  800352:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  800356:	48 bf 1e 50 80 00 00 	movabs $0x80501e,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 ba 3f 05 80 00 00 	movabs $0x80053f,%rdx
+  80036c:	00 00 00 
+  80036f:	ff d2                	call   *%rdx
+}
+  800371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  800377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037d:	e9 06 ff ff ff       	jmp    800288 <umain+0x263>
+
+0000000000800382 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	48 83 ec 30          	sub    $0x30,%rsp
+  800391:	41 89 fd             	mov    %edi,%r13d
+  800394:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800397:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80039e:	00 
+  80039f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8003a6:	00 
+  8003a7:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8003ae:	00 
+  8003af:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8003b6:	00 
+  8003b7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003bb:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  8003bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003c4:	48 b8 de 15 80 00 00 	movabs $0x8015de,%rax
+  8003cb:	00 00 00 
+  8003ce:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003d0:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003d7:	00 00 00 
+  8003da:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003e1:	00 00 00 
+  8003e4:	48 39 c2             	cmp    %rax,%rdx
+  8003e7:	73 17                	jae    800400 <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  8003e9:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003ec:	49 89 c4             	mov    %rax,%r12
+  8003ef:	48 83 c3 08          	add    $0x8,%rbx
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f8:	ff 53 f8             	call   *-0x8(%rbx)
+  8003fb:	4c 39 e3             	cmp    %r12,%rbx
+  8003fe:	72 ef                	jb     8003ef <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800400:	48 b8 54 13 80 00 00 	movabs $0x801354,%rax
+  800407:	00 00 00 
+  80040a:	ff d0                	call   *%rax
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  80040c:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800413:	00 00 
+  800415:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80041a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  800421:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800428:	00 00 00 
+  80042b:	48 01 c8             	add    %rcx,%rax
+  80042e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800432:	45 85 ed             	test   %r13d,%r13d
+  800435:	7e 0d                	jle    800444 <libmain+0xc2>
+  800437:	49 8b 06             	mov    (%r14),%rax
+  80043a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800441:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800444:	4c 89 f6             	mov    %r14,%rsi
+  800447:	44 89 ef             	mov    %r13d,%edi
+  80044a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800456:	48 b8 6f 04 80 00 00 	movabs $0x80046f,%rax
+  80045d:	00 00 00 
+  800460:	ff d0                	call   *%rax
+#endif
+}
+  800462:	48 83 c4 30          	add    $0x30,%rsp
+  800466:	5b                   	pop    %rbx
+  800467:	41 5c                	pop    %r12
+  800469:	41 5d                	pop    %r13
+  80046b:	41 5e                	pop    %r14
+  80046d:	5d                   	pop    %rbp
+  80046e:	c3                   	ret
+
+000000000080046f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80046f:	55                   	push   %rbp
+  800470:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800473:	48 b8 7c 1d 80 00 00 	movabs $0x801d7c,%rax
+  80047a:	00 00 00 
+  80047d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80047f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800484:	48 b8 e9 12 80 00 00 	movabs $0x8012e9,%rax
+  80048b:	00 00 00 
+  80048e:	ff d0                	call   *%rax
+}
+  800490:	5d                   	pop    %rbp
+  800491:	c3                   	ret
+
+0000000000800492 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800492:	55                   	push   %rbp
+  800493:	48 89 e5             	mov    %rsp,%rbp
+  800496:	53                   	push   %rbx
+  800497:	48 83 ec 08          	sub    $0x8,%rsp
+  80049b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80049e:	8b 06                	mov    (%rsi),%eax
+  8004a0:	8d 50 01             	lea    0x1(%rax),%edx
+  8004a3:	89 16                	mov    %edx,(%rsi)
+  8004a5:	48 98                	cltq
+  8004a7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004ac:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004b2:	74 0a                	je     8004be <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004b4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bc:	c9                   	leave
+  8004bd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004be:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004c2:	be ff 00 00 00       	mov    $0xff,%esi
+  8004c7:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  8004ce:	00 00 00 
+  8004d1:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004d3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004d9:	eb d9                	jmp    8004b4 <putch+0x22>
+
+00000000008004db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004db:	55                   	push   %rbp
+  8004dc:	48 89 e5             	mov    %rsp,%rbp
+  8004df:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004e6:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004e9:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004f0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004fd:	48 89 f1             	mov    %rsi,%rcx
+  800500:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800507:	48 bf 92 04 80 00 00 	movabs $0x800492,%rdi
+  80050e:	00 00 00 
+  800511:	48 b8 8f 06 80 00 00 	movabs $0x80068f,%rax
+  800518:	00 00 00 
+  80051b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80051d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800524:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80052b:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800537:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80053d:	c9                   	leave
+  80053e:	c3                   	ret
+
+000000000080053f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80053f:	55                   	push   %rbp
+  800540:	48 89 e5             	mov    %rsp,%rbp
+  800543:	48 83 ec 50          	sub    $0x50,%rsp
+  800547:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80054b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80054f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800553:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800557:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80055b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800562:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800566:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80056e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800572:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800576:	48 b8 db 04 80 00 00 	movabs $0x8004db,%rax
+  80057d:	00 00 00 
+  800580:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800582:	c9                   	leave
+  800583:	c3                   	ret
+
+0000000000800584 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800584:	55                   	push   %rbp
+  800585:	48 89 e5             	mov    %rsp,%rbp
+  800588:	41 57                	push   %r15
+  80058a:	41 56                	push   %r14
+  80058c:	41 55                	push   %r13
+  80058e:	41 54                	push   %r12
+  800590:	53                   	push   %rbx
+  800591:	48 83 ec 18          	sub    $0x18,%rsp
+  800595:	49 89 fc             	mov    %rdi,%r12
+  800598:	49 89 f5             	mov    %rsi,%r13
+  80059b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80059f:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005a2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005a5:	41 89 cf             	mov    %ecx,%r15d
+  8005a8:	4c 39 fa             	cmp    %r15,%rdx
+  8005ab:	73 5b                	jae    800608 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005ad:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005b1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005b5:	85 db                	test   %ebx,%ebx
+  8005b7:	7e 0e                	jle    8005c7 <print_num+0x43>
+            putch(padc, put_arg);
+  8005b9:	4c 89 ee             	mov    %r13,%rsi
+  8005bc:	44 89 f7             	mov    %r14d,%edi
+  8005bf:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005c2:	83 eb 01             	sub    $0x1,%ebx
+  8005c5:	75 f2                	jne    8005b9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005c7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005cb:	48 b9 44 50 80 00 00 	movabs $0x805044,%rcx
+  8005d2:	00 00 00 
+  8005d5:	48 b8 33 50 80 00 00 	movabs $0x805033,%rax
+  8005dc:	00 00 00 
+  8005df:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ec:	49 f7 f7             	div    %r15
+  8005ef:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005f3:	4c 89 ee             	mov    %r13,%rsi
+  8005f6:	41 ff d4             	call   *%r12
+}
+  8005f9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005fd:	5b                   	pop    %rbx
+  8005fe:	41 5c                	pop    %r12
+  800600:	41 5d                	pop    %r13
+  800602:	41 5e                	pop    %r14
+  800604:	41 5f                	pop    %r15
+  800606:	5d                   	pop    %rbp
+  800607:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800608:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80060c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800611:	49 f7 f7             	div    %r15
+  800614:	48 83 ec 08          	sub    $0x8,%rsp
+  800618:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80061c:	52                   	push   %rdx
+  80061d:	45 0f be c9          	movsbl %r9b,%r9d
+  800621:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800625:	48 89 c2             	mov    %rax,%rdx
+  800628:	48 b8 84 05 80 00 00 	movabs $0x800584,%rax
+  80062f:	00 00 00 
+  800632:	ff d0                	call   *%rax
+  800634:	48 83 c4 10          	add    $0x10,%rsp
+  800638:	eb 8d                	jmp    8005c7 <print_num+0x43>
+
+000000000080063a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80063a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80063e:	48 8b 06             	mov    (%rsi),%rax
+  800641:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800645:	73 0a                	jae    800651 <sprintputch+0x17>
+        *state->start++ = ch;
+  800647:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80064b:	48 89 16             	mov    %rdx,(%rsi)
+  80064e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800651:	c3                   	ret
+
+0000000000800652 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800652:	55                   	push   %rbp
+  800653:	48 89 e5             	mov    %rsp,%rbp
+  800656:	48 83 ec 50          	sub    $0x50,%rsp
+  80065a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80065e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800662:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800666:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80066d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800671:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800675:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800679:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80067d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800681:	48 b8 8f 06 80 00 00 	movabs $0x80068f,%rax
+  800688:	00 00 00 
+  80068b:	ff d0                	call   *%rax
+}
+  80068d:	c9                   	leave
+  80068e:	c3                   	ret
+
+000000000080068f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80068f:	55                   	push   %rbp
+  800690:	48 89 e5             	mov    %rsp,%rbp
+  800693:	41 57                	push   %r15
+  800695:	41 56                	push   %r14
+  800697:	41 55                	push   %r13
+  800699:	41 54                	push   %r12
+  80069b:	53                   	push   %rbx
+  80069c:	48 83 ec 38          	sub    $0x38,%rsp
+  8006a0:	49 89 fe             	mov    %rdi,%r14
+  8006a3:	49 89 f5             	mov    %rsi,%r13
+  8006a6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006a9:	48 8b 01             	mov    (%rcx),%rax
+  8006ac:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006b0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006bc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006c0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006c4:	0f b6 3b             	movzbl (%rbx),%edi
+  8006c7:	40 80 ff 25          	cmp    $0x25,%dil
+  8006cb:	74 18                	je     8006e5 <vprintfmt+0x56>
+            if (!ch) return;
+  8006cd:	40 84 ff             	test   %dil,%dil
+  8006d0:	0f 84 b1 06 00 00    	je     800d87 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006d6:	40 0f b6 ff          	movzbl %dil,%edi
+  8006da:	4c 89 ee             	mov    %r13,%rsi
+  8006dd:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006e0:	4c 89 e3             	mov    %r12,%rbx
+  8006e3:	eb db                	jmp    8006c0 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ea:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006ee:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006f3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006f9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800700:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800704:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800709:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80070e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800711:	83 e8 23             	sub    $0x23,%eax
+  800714:	3c 57                	cmp    $0x57,%al
+  800716:	0f 87 51 06 00 00    	ja     800d6d <vprintfmt+0x6de>
+  80071c:	0f b6 c0             	movzbl %al,%eax
+  80071f:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  800726:	00 00 00 
+  800729:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80072c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80072f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800733:	eb cf                	jmp    800704 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800735:	49 89 dc             	mov    %rbx,%r12
+  800738:	be 01 00 00 00       	mov    $0x1,%esi
+  80073d:	eb c5                	jmp    800704 <vprintfmt+0x75>
+            padc = ch;
+  80073f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800743:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800746:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800749:	eb b9                	jmp    800704 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 24                	ja     800777 <vprintfmt+0xe8>
+  800753:	89 c1                	mov    %eax,%ecx
+  800755:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800762:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800765:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800769:	79 99                	jns    800704 <vprintfmt+0x75>
+                width = precision;
+  80076b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80076f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800775:	eb 8d                	jmp    800704 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800777:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80077b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80077f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800783:	eb da                	jmp    80075f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800785:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80078a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80078e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800794:	3c 39                	cmp    $0x39,%al
+  800796:	77 1c                	ja     8007b4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800798:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80079c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007a0:	0f b6 c0             	movzbl %al,%eax
+  8007a3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007a8:	0f b6 03             	movzbl (%rbx),%eax
+  8007ab:	3c 39                	cmp    $0x39,%al
+  8007ad:	76 e9                	jbe    800798 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007af:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007b2:	eb b1                	jmp    800765 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007b4:	49 89 dc             	mov    %rbx,%r12
+  8007b7:	eb ac                	jmp    800765 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007b9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007bc:	85 c9                	test   %ecx,%ecx
+  8007be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c3:	0f 49 c1             	cmovns %ecx,%eax
+  8007c6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007c9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007cc:	e9 33 ff ff ff       	jmp    800704 <vprintfmt+0x75>
+            lflag++;
+  8007d1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007d4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007d7:	e9 28 ff ff ff       	jmp    800704 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	77 19                	ja     8007fd <vprintfmt+0x16e>
+  8007e4:	89 c2                	mov    %eax,%edx
+  8007e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ea:	83 c0 08             	add    $0x8,%eax
+  8007ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f0:	8b 3a                	mov    (%rdx),%edi
+  8007f2:	4c 89 ee             	mov    %r13,%rsi
+  8007f5:	41 ff d6             	call   *%r14
+            break;
+  8007f8:	e9 c3 fe ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800801:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800805:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800809:	eb e5                	jmp    8007f0 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 5a                	ja     80086d <vprintfmt+0x1de>
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80081f:	8b 02                	mov    (%rdx),%eax
+  800821:	89 c1                	mov    %eax,%ecx
+  800823:	f7 d9                	neg    %ecx
+  800825:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800828:	83 f9 16             	cmp    $0x16,%ecx
+  80082b:	7f 4e                	jg     80087b <vprintfmt+0x1ec>
+  80082d:	48 63 c1             	movslq %ecx,%rax
+  800830:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  800837:	00 00 00 
+  80083a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80083e:	48 85 c0             	test   %rax,%rax
+  800841:	74 38                	je     80087b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800843:	48 89 c1             	mov    %rax,%rcx
+  800846:	48 ba 99 56 80 00 00 	movabs $0x805699,%rdx
+  80084d:	00 00 00 
+  800850:	4c 89 ee             	mov    %r13,%rsi
+  800853:	4c 89 f7             	mov    %r14,%rdi
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	49 b8 52 06 80 00 00 	movabs $0x800652,%r8
+  800862:	00 00 00 
+  800865:	41 ff d0             	call   *%r8
+  800868:	e9 53 fe ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80086d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800871:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800875:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800879:	eb a4                	jmp    80081f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80087b:	48 ba 5c 50 80 00 00 	movabs $0x80505c,%rdx
+  800882:	00 00 00 
+  800885:	4c 89 ee             	mov    %r13,%rsi
+  800888:	4c 89 f7             	mov    %r14,%rdi
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	49 b8 52 06 80 00 00 	movabs $0x800652,%r8
+  800897:	00 00 00 
+  80089a:	41 ff d0             	call   *%r8
+  80089d:	e9 1e fe ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 6c                	ja     800916 <vprintfmt+0x287>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008b9:	48 85 d2             	test   %rdx,%rdx
+  8008bc:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  8008c3:	00 00 00 
+  8008c6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008ca:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008ce:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008d2:	7e 06                	jle    8008da <vprintfmt+0x24b>
+  8008d4:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008d8:	75 4a                	jne    800924 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008de:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008e2:	0f b6 00             	movzbl (%rax),%eax
+  8008e5:	84 c0                	test   %al,%al
+  8008e7:	0f 85 9a 00 00 00    	jne    800987 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008ed:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008f4:	85 c0                	test   %eax,%eax
+  8008f6:	0f 8e c4 fd ff ff    	jle    8006c0 <vprintfmt+0x31>
+  8008fc:	4c 89 ee             	mov    %r13,%rsi
+  8008ff:	bf 20 00 00 00       	mov    $0x20,%edi
+  800904:	41 ff d6             	call   *%r14
+  800907:	41 83 ec 01          	sub    $0x1,%r12d
+  80090b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80090f:	75 eb                	jne    8008fc <vprintfmt+0x26d>
+  800911:	e9 aa fd ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb 92                	jmp    8008b6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800924:	49 63 f7             	movslq %r15d,%rsi
+  800927:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80092b:	48 b8 41 0e 80 00 00 	movabs $0x800e41,%rax
+  800932:	00 00 00 
+  800935:	ff d0                	call   *%rax
+  800937:	48 89 c2             	mov    %rax,%rdx
+  80093a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80093d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80093f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800942:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800945:	85 c0                	test   %eax,%eax
+  800947:	7e 91                	jle    8008da <vprintfmt+0x24b>
+  800949:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80094e:	4c 89 ee             	mov    %r13,%rsi
+  800951:	44 89 e7             	mov    %r12d,%edi
+  800954:	41 ff d6             	call   *%r14
+  800957:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80095b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80095e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800961:	75 eb                	jne    80094e <vprintfmt+0x2bf>
+  800963:	e9 72 ff ff ff       	jmp    8008da <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800968:	0f b6 f8             	movzbl %al,%edi
+  80096b:	4c 89 ee             	mov    %r13,%rsi
+  80096e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800971:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800975:	49 83 c4 01          	add    $0x1,%r12
+  800979:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80097f:	84 c0                	test   %al,%al
+  800981:	0f 84 66 ff ff ff    	je     8008ed <vprintfmt+0x25e>
+  800987:	45 85 ff             	test   %r15d,%r15d
+  80098a:	78 0a                	js     800996 <vprintfmt+0x307>
+  80098c:	41 83 ef 01          	sub    $0x1,%r15d
+  800990:	0f 88 57 ff ff ff    	js     8008ed <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800996:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80099a:	74 cc                	je     800968 <vprintfmt+0x2d9>
+  80099c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80099f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009a4:	80 fa 5e             	cmp    $0x5e,%dl
+  8009a7:	77 c2                	ja     80096b <vprintfmt+0x2dc>
+  8009a9:	eb bd                	jmp    800968 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ab:	40 84 f6             	test   %sil,%sil
+  8009ae:	75 26                	jne    8009d6 <vprintfmt+0x347>
+    switch (lflag) {
+  8009b0:	85 d2                	test   %edx,%edx
+  8009b2:	74 59                	je     800a0d <vprintfmt+0x37e>
+  8009b4:	83 fa 01             	cmp    $0x1,%edx
+  8009b7:	74 7b                	je     800a34 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bf:	0f 87 96 00 00 00    	ja     800a5b <vprintfmt+0x3cc>
+  8009c5:	89 c2                	mov    %eax,%edx
+  8009c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cb:	83 c0 08             	add    $0x8,%eax
+  8009ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d1:	4c 8b 22             	mov    (%rdx),%r12
+  8009d4:	eb 17                	jmp    8009ed <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dc:	77 21                	ja     8009ff <vprintfmt+0x370>
+  8009de:	89 c2                	mov    %eax,%edx
+  8009e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e4:	83 c0 08             	add    $0x8,%eax
+  8009e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ea:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009ed:	4d 85 e4             	test   %r12,%r12
+  8009f0:	78 7a                	js     800a6c <vprintfmt+0x3dd>
+            num = i;
+  8009f2:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009fa:	e9 50 02 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0b:	eb dd                	jmp    8009ea <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 11                	ja     800a26 <vprintfmt+0x397>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	4c 63 22             	movslq (%rdx),%r12
+  800a24:	eb c7                	jmp    8009ed <vprintfmt+0x35e>
+  800a26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a32:	eb ed                	jmp    800a21 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a37:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3a:	77 11                	ja     800a4d <vprintfmt+0x3be>
+  800a3c:	89 c2                	mov    %eax,%edx
+  800a3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a42:	83 c0 08             	add    $0x8,%eax
+  800a45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a48:	4c 8b 22             	mov    (%rdx),%r12
+  800a4b:	eb a0                	jmp    8009ed <vprintfmt+0x35e>
+  800a4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a59:	eb ed                	jmp    800a48 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	e9 65 ff ff ff       	jmp    8009d1 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a6c:	4c 89 ee             	mov    %r13,%rsi
+  800a6f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a74:	41 ff d6             	call   *%r14
+                i = -i;
+  800a77:	49 f7 dc             	neg    %r12
+  800a7a:	e9 73 ff ff ff       	jmp    8009f2 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7f:	40 84 f6             	test   %sil,%sil
+  800a82:	75 32                	jne    800ab6 <vprintfmt+0x427>
+    switch (lflag) {
+  800a84:	85 d2                	test   %edx,%edx
+  800a86:	74 5d                	je     800ae5 <vprintfmt+0x456>
+  800a88:	83 fa 01             	cmp    $0x1,%edx
+  800a8b:	0f 84 82 00 00 00    	je     800b13 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a94:	83 f8 2f             	cmp    $0x2f,%eax
+  800a97:	0f 87 a5 00 00 00    	ja     800b42 <vprintfmt+0x4b3>
+  800a9d:	89 c2                	mov    %eax,%edx
+  800a9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa3:	83 c0 08             	add    $0x8,%eax
+  800aa6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ab1:	e9 99 01 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab9:	83 f8 2f             	cmp    $0x2f,%eax
+  800abc:	77 19                	ja     800ad7 <vprintfmt+0x448>
+  800abe:	89 c2                	mov    %eax,%edx
+  800ac0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac4:	83 c0 08             	add    $0x8,%eax
+  800ac7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aca:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800acd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ad2:	e9 78 01 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+  800ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae3:	eb e5                	jmp    800aca <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ae5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	77 18                	ja     800b05 <vprintfmt+0x476>
+  800aed:	89 c2                	mov    %eax,%edx
+  800aef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af3:	83 c0 08             	add    $0x8,%eax
+  800af6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800afb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b00:	e9 4a 01 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+  800b05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b11:	eb e6                	jmp    800af9 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b16:	83 f8 2f             	cmp    $0x2f,%eax
+  800b19:	77 19                	ja     800b34 <vprintfmt+0x4a5>
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b21:	83 c0 08             	add    $0x8,%eax
+  800b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b27:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b2a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b2f:	e9 1b 01 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+  800b34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b40:	eb e5                	jmp    800b27 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4e:	e9 56 ff ff ff       	jmp    800aa9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b53:	40 84 f6             	test   %sil,%sil
+  800b56:	75 2e                	jne    800b86 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b58:	85 d2                	test   %edx,%edx
+  800b5a:	74 59                	je     800bb5 <vprintfmt+0x526>
+  800b5c:	83 fa 01             	cmp    $0x1,%edx
+  800b5f:	74 7f                	je     800be0 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b64:	83 f8 2f             	cmp    $0x2f,%eax
+  800b67:	0f 87 9f 00 00 00    	ja     800c0c <vprintfmt+0x57d>
+  800b6d:	89 c2                	mov    %eax,%edx
+  800b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b73:	83 c0 08             	add    $0x8,%eax
+  800b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b7c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b81:	e9 c9 00 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b89:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8c:	77 19                	ja     800ba7 <vprintfmt+0x518>
+  800b8e:	89 c2                	mov    %eax,%edx
+  800b90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b94:	83 c0 08             	add    $0x8,%eax
+  800b97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b9d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba2:	e9 a8 00 00 00       	jmp    800c4f <vprintfmt+0x5c0>
+  800ba7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800baf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb3:	eb e5                	jmp    800b9a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbb:	77 15                	ja     800bd2 <vprintfmt+0x543>
+  800bbd:	89 c2                	mov    %eax,%edx
+  800bbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc3:	83 c0 08             	add    $0x8,%eax
+  800bc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bcb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd0:	eb 7d                	jmp    800c4f <vprintfmt+0x5c0>
+  800bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bde:	eb e9                	jmp    800bc9 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800be0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be3:	83 f8 2f             	cmp    $0x2f,%eax
+  800be6:	77 16                	ja     800bfe <vprintfmt+0x56f>
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bee:	83 c0 08             	add    $0x8,%eax
+  800bf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bfc:	eb 51                	jmp    800c4f <vprintfmt+0x5c0>
+  800bfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0a:	eb e8                	jmp    800bf4 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c18:	e9 5c ff ff ff       	jmp    800b79 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c1d:	4c 89 ee             	mov    %r13,%rsi
+  800c20:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c25:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c28:	4c 89 ee             	mov    %r13,%rsi
+  800c2b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c30:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c36:	83 f8 2f             	cmp    $0x2f,%eax
+  800c39:	77 47                	ja     800c82 <vprintfmt+0x5f3>
+  800c3b:	89 c2                	mov    %eax,%edx
+  800c3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c41:	83 c0 08             	add    $0x8,%eax
+  800c44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c4f:	48 83 ec 08          	sub    $0x8,%rsp
+  800c53:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c57:	0f 94 c0             	sete   %al
+  800c5a:	0f b6 c0             	movzbl %al,%eax
+  800c5d:	50                   	push   %rax
+  800c5e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c63:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c67:	4c 89 ee             	mov    %r13,%rsi
+  800c6a:	4c 89 f7             	mov    %r14,%rdi
+  800c6d:	48 b8 84 05 80 00 00 	movabs $0x800584,%rax
+  800c74:	00 00 00 
+  800c77:	ff d0                	call   *%rax
+            break;
+  800c79:	48 83 c4 10          	add    $0x10,%rsp
+  800c7d:	e9 3e fa ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8e:	eb b7                	jmp    800c47 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c90:	40 84 f6             	test   %sil,%sil
+  800c93:	75 2b                	jne    800cc0 <vprintfmt+0x631>
+    switch (lflag) {
+  800c95:	85 d2                	test   %edx,%edx
+  800c97:	74 56                	je     800cef <vprintfmt+0x660>
+  800c99:	83 fa 01             	cmp    $0x1,%edx
+  800c9c:	74 7f                	je     800d1d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	0f 87 a2 00 00 00    	ja     800d4c <vprintfmt+0x6bd>
+  800caa:	89 c2                	mov    %eax,%edx
+  800cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb0:	83 c0 08             	add    $0x8,%eax
+  800cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cbe:	eb 8f                	jmp    800c4f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc6:	77 19                	ja     800ce1 <vprintfmt+0x652>
+  800cc8:	89 c2                	mov    %eax,%edx
+  800cca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cce:	83 c0 08             	add    $0x8,%eax
+  800cd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cdc:	e9 6e ff ff ff       	jmp    800c4f <vprintfmt+0x5c0>
+  800ce1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ced:	eb e5                	jmp    800cd4 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf5:	77 18                	ja     800d0f <vprintfmt+0x680>
+  800cf7:	89 c2                	mov    %eax,%edx
+  800cf9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cfd:	83 c0 08             	add    $0x8,%eax
+  800d00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d03:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d05:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d0a:	e9 40 ff ff ff       	jmp    800c4f <vprintfmt+0x5c0>
+  800d0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1b:	eb e6                	jmp    800d03 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d20:	83 f8 2f             	cmp    $0x2f,%eax
+  800d23:	77 19                	ja     800d3e <vprintfmt+0x6af>
+  800d25:	89 c2                	mov    %eax,%edx
+  800d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2b:	83 c0 08             	add    $0x8,%eax
+  800d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d34:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d39:	e9 11 ff ff ff       	jmp    800c4f <vprintfmt+0x5c0>
+  800d3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4a:	eb e5                	jmp    800d31 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d58:	e9 59 ff ff ff       	jmp    800cb6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d5d:	4c 89 ee             	mov    %r13,%rsi
+  800d60:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d65:	41 ff d6             	call   *%r14
+            break;
+  800d68:	e9 53 f9 ff ff       	jmp    8006c0 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d6d:	4c 89 ee             	mov    %r13,%rsi
+  800d70:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d75:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d78:	48 83 eb 01          	sub    $0x1,%rbx
+  800d7c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d80:	75 f6                	jne    800d78 <vprintfmt+0x6e9>
+  800d82:	e9 39 f9 ff ff       	jmp    8006c0 <vprintfmt+0x31>
+}
+  800d87:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d8b:	5b                   	pop    %rbx
+  800d8c:	41 5c                	pop    %r12
+  800d8e:	41 5d                	pop    %r13
+  800d90:	41 5e                	pop    %r14
+  800d92:	41 5f                	pop    %r15
+  800d94:	5d                   	pop    %rbp
+  800d95:	c3                   	ret
+
+0000000000800d96 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d96:	55                   	push   %rbp
+  800d97:	48 89 e5             	mov    %rsp,%rbp
+  800d9a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d9e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800da2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800da7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dab:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800db2:	48 85 ff             	test   %rdi,%rdi
+  800db5:	74 2b                	je     800de2 <vsnprintf+0x4c>
+  800db7:	48 85 f6             	test   %rsi,%rsi
+  800dba:	74 26                	je     800de2 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dbc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dc0:	48 bf 3a 06 80 00 00 	movabs $0x80063a,%rdi
+  800dc7:	00 00 00 
+  800dca:	48 b8 8f 06 80 00 00 	movabs $0x80068f,%rax
+  800dd1:	00 00 00 
+  800dd4:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dda:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ddd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800de0:	c9                   	leave
+  800de1:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800de2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800de7:	eb f7                	jmp    800de0 <vsnprintf+0x4a>
+
+0000000000800de9 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800de9:	55                   	push   %rbp
+  800dea:	48 89 e5             	mov    %rsp,%rbp
+  800ded:	48 83 ec 50          	sub    $0x50,%rsp
+  800df1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800df5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800df9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dfd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e04:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e10:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e14:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e18:	48 b8 96 0d 80 00 00 	movabs $0x800d96,%rax
+  800e1f:	00 00 00 
+  800e22:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e24:	c9                   	leave
+  800e25:	c3                   	ret
+
+0000000000800e26 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e26:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e29:	74 10                	je     800e3b <strlen+0x15>
+    size_t n = 0;
+  800e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e30:	48 83 c0 01          	add    $0x1,%rax
+  800e34:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e38:	75 f6                	jne    800e30 <strlen+0xa>
+  800e3a:	c3                   	ret
+    size_t n = 0;
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e40:	c3                   	ret
+
+0000000000800e41 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e41:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e44:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e49:	48 85 f6             	test   %rsi,%rsi
+  800e4c:	74 11                	je     800e5f <strnlen+0x1e>
+  800e4e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e52:	74 0c                	je     800e60 <strnlen+0x1f>
+  800e54:	48 83 c2 01          	add    $0x1,%rdx
+  800e58:	48 39 d0             	cmp    %rdx,%rax
+  800e5b:	75 f1                	jne    800e4e <strnlen+0xd>
+  800e5d:	eb 04                	jmp    800e63 <strnlen+0x22>
+  800e5f:	c3                   	ret
+  800e60:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e63:	c3                   	ret
+
+0000000000800e64 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e64:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e70:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e73:	48 83 c2 01          	add    $0x1,%rdx
+  800e77:	84 c9                	test   %cl,%cl
+  800e79:	75 f1                	jne    800e6c <strcpy+0x8>
+        ;
+    return res;
+}
+  800e7b:	c3                   	ret
+
+0000000000800e7c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e7c:	55                   	push   %rbp
+  800e7d:	48 89 e5             	mov    %rsp,%rbp
+  800e80:	41 54                	push   %r12
+  800e82:	53                   	push   %rbx
+  800e83:	48 89 fb             	mov    %rdi,%rbx
+  800e86:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e89:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e95:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e99:	4c 89 e6             	mov    %r12,%rsi
+  800e9c:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  800ea3:	00 00 00 
+  800ea6:	ff d0                	call   *%rax
+    return dst;
+}
+  800ea8:	48 89 d8             	mov    %rbx,%rax
+  800eab:	5b                   	pop    %rbx
+  800eac:	41 5c                	pop    %r12
+  800eae:	5d                   	pop    %rbp
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eb0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800eb3:	48 85 d2             	test   %rdx,%rdx
+  800eb6:	74 1f                	je     800ed7 <strncpy+0x27>
+  800eb8:	48 01 fa             	add    %rdi,%rdx
+  800ebb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ebe:	48 83 c1 01          	add    $0x1,%rcx
+  800ec2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ec6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800eca:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ece:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ed2:	48 39 ca             	cmp    %rcx,%rdx
+  800ed5:	75 e7                	jne    800ebe <strncpy+0xe>
+    }
+    return ret;
+}
+  800ed7:	c3                   	ret
+
+0000000000800ed8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ed8:	48 89 f8             	mov    %rdi,%rax
+  800edb:	48 85 d2             	test   %rdx,%rdx
+  800ede:	74 24                	je     800f04 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ee0:	48 83 ea 01          	sub    $0x1,%rdx
+  800ee4:	74 1b                	je     800f01 <strlcpy+0x29>
+  800ee6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eea:	0f b6 16             	movzbl (%rsi),%edx
+  800eed:	84 d2                	test   %dl,%dl
+  800eef:	74 10                	je     800f01 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ef1:	48 83 c6 01          	add    $0x1,%rsi
+  800ef5:	48 83 c0 01          	add    $0x1,%rax
+  800ef9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800efc:	48 39 c8             	cmp    %rcx,%rax
+  800eff:	75 e9                	jne    800eea <strlcpy+0x12>
+        *dst = '\0';
+  800f01:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f04:	48 29 f8             	sub    %rdi,%rax
+}
+  800f07:	c3                   	ret
+
+0000000000800f08 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f08:	0f b6 07             	movzbl (%rdi),%eax
+  800f0b:	84 c0                	test   %al,%al
+  800f0d:	74 13                	je     800f22 <strcmp+0x1a>
+  800f0f:	38 06                	cmp    %al,(%rsi)
+  800f11:	75 0f                	jne    800f22 <strcmp+0x1a>
+  800f13:	48 83 c7 01          	add    $0x1,%rdi
+  800f17:	48 83 c6 01          	add    $0x1,%rsi
+  800f1b:	0f b6 07             	movzbl (%rdi),%eax
+  800f1e:	84 c0                	test   %al,%al
+  800f20:	75 ed                	jne    800f0f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f22:	0f b6 c0             	movzbl %al,%eax
+  800f25:	0f b6 16             	movzbl (%rsi),%edx
+  800f28:	29 d0                	sub    %edx,%eax
+}
+  800f2a:	c3                   	ret
+
+0000000000800f2b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f2b:	48 85 d2             	test   %rdx,%rdx
+  800f2e:	74 1f                	je     800f4f <strncmp+0x24>
+  800f30:	0f b6 07             	movzbl (%rdi),%eax
+  800f33:	84 c0                	test   %al,%al
+  800f35:	74 1e                	je     800f55 <strncmp+0x2a>
+  800f37:	3a 06                	cmp    (%rsi),%al
+  800f39:	75 1a                	jne    800f55 <strncmp+0x2a>
+  800f3b:	48 83 c7 01          	add    $0x1,%rdi
+  800f3f:	48 83 c6 01          	add    $0x1,%rsi
+  800f43:	48 83 ea 01          	sub    $0x1,%rdx
+  800f47:	75 e7                	jne    800f30 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4e:	c3                   	ret
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f54:	c3                   	ret
+  800f55:	48 85 d2             	test   %rdx,%rdx
+  800f58:	74 09                	je     800f63 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f5a:	0f b6 07             	movzbl (%rdi),%eax
+  800f5d:	0f b6 16             	movzbl (%rsi),%edx
+  800f60:	29 d0                	sub    %edx,%eax
+  800f62:	c3                   	ret
+    if (!n) return 0;
+  800f63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f68:	c3                   	ret
+
+0000000000800f69 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f69:	0f b6 17             	movzbl (%rdi),%edx
+  800f6c:	84 d2                	test   %dl,%dl
+  800f6e:	74 18                	je     800f88 <strchr+0x1f>
+        if (*str == c) {
+  800f70:	0f be d2             	movsbl %dl,%edx
+  800f73:	39 f2                	cmp    %esi,%edx
+  800f75:	74 17                	je     800f8e <strchr+0x25>
+    for (; *str; str++) {
+  800f77:	48 83 c7 01          	add    $0x1,%rdi
+  800f7b:	0f b6 17             	movzbl (%rdi),%edx
+  800f7e:	84 d2                	test   %dl,%dl
+  800f80:	75 ee                	jne    800f70 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f87:	c3                   	ret
+  800f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8d:	c3                   	ret
+  800f8e:	48 89 f8             	mov    %rdi,%rax
+}
+  800f91:	c3                   	ret
+
+0000000000800f92 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f92:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f95:	0f b6 17             	movzbl (%rdi),%edx
+  800f98:	84 d2                	test   %dl,%dl
+  800f9a:	74 13                	je     800faf <strfind+0x1d>
+  800f9c:	0f be d2             	movsbl %dl,%edx
+  800f9f:	39 f2                	cmp    %esi,%edx
+  800fa1:	74 0b                	je     800fae <strfind+0x1c>
+  800fa3:	48 83 c0 01          	add    $0x1,%rax
+  800fa7:	0f b6 10             	movzbl (%rax),%edx
+  800faa:	84 d2                	test   %dl,%dl
+  800fac:	75 ee                	jne    800f9c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fae:	c3                   	ret
+  800faf:	c3                   	ret
+
+0000000000800fb0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fb0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fb3:	48 89 f8             	mov    %rdi,%rax
+  800fb6:	48 f7 d8             	neg    %rax
+  800fb9:	83 e0 07             	and    $0x7,%eax
+  800fbc:	49 89 d1             	mov    %rdx,%r9
+  800fbf:	49 29 c1             	sub    %rax,%r9
+  800fc2:	78 36                	js     800ffa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fc4:	40 0f b6 c6          	movzbl %sil,%eax
+  800fc8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fcf:	01 01 01 
+  800fd2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fd6:	40 f6 c7 07          	test   $0x7,%dil
+  800fda:	75 38                	jne    801014 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fdc:	4c 89 c9             	mov    %r9,%rcx
+  800fdf:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fe3:	74 0c                	je     800ff1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fe5:	fc                   	cld
+  800fe6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fe9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fed:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ff1:	4d 85 c9             	test   %r9,%r9
+  800ff4:	75 45                	jne    80103b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ff6:	4c 89 c0             	mov    %r8,%rax
+  800ff9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ffa:	48 85 d2             	test   %rdx,%rdx
+  800ffd:	74 f7                	je     800ff6 <memset+0x46>
+  800fff:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801002:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801005:	48 83 c0 01          	add    $0x1,%rax
+  801009:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80100d:	48 39 c2             	cmp    %rax,%rdx
+  801010:	75 f3                	jne    801005 <memset+0x55>
+  801012:	eb e2                	jmp    800ff6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801014:	40 f6 c7 01          	test   $0x1,%dil
+  801018:	74 06                	je     801020 <memset+0x70>
+  80101a:	88 07                	mov    %al,(%rdi)
+  80101c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801020:	40 f6 c7 02          	test   $0x2,%dil
+  801024:	74 07                	je     80102d <memset+0x7d>
+  801026:	66 89 07             	mov    %ax,(%rdi)
+  801029:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80102d:	40 f6 c7 04          	test   $0x4,%dil
+  801031:	74 a9                	je     800fdc <memset+0x2c>
+  801033:	89 07                	mov    %eax,(%rdi)
+  801035:	48 83 c7 04          	add    $0x4,%rdi
+  801039:	eb a1                	jmp    800fdc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80103b:	41 f6 c1 04          	test   $0x4,%r9b
+  80103f:	74 06                	je     801047 <memset+0x97>
+  801041:	89 07                	mov    %eax,(%rdi)
+  801043:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801047:	41 f6 c1 02          	test   $0x2,%r9b
+  80104b:	74 07                	je     801054 <memset+0xa4>
+  80104d:	66 89 07             	mov    %ax,(%rdi)
+  801050:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801054:	41 f6 c1 01          	test   $0x1,%r9b
+  801058:	74 9c                	je     800ff6 <memset+0x46>
+  80105a:	88 07                	mov    %al,(%rdi)
+  80105c:	eb 98                	jmp    800ff6 <memset+0x46>
+
+000000000080105e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80105e:	48 89 f8             	mov    %rdi,%rax
+  801061:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801064:	48 39 fe             	cmp    %rdi,%rsi
+  801067:	73 3b                	jae    8010a4 <memmove+0x46>
+  801069:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80106d:	48 39 d7             	cmp    %rdx,%rdi
+  801070:	73 32                	jae    8010a4 <memmove+0x46>
+        s += n;
+        d += n;
+  801072:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801076:	48 89 d6             	mov    %rdx,%rsi
+  801079:	48 09 fe             	or     %rdi,%rsi
+  80107c:	48 09 ce             	or     %rcx,%rsi
+  80107f:	40 f6 c6 07          	test   $0x7,%sil
+  801083:	75 12                	jne    801097 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801085:	48 83 ef 08          	sub    $0x8,%rdi
+  801089:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80108d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801091:	fd                   	std
+  801092:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801095:	fc                   	cld
+  801096:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801097:	48 83 ef 01          	sub    $0x1,%rdi
+  80109b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80109f:	fd                   	std
+  8010a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010a2:	eb f1                	jmp    801095 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010a4:	48 89 f2             	mov    %rsi,%rdx
+  8010a7:	48 09 c2             	or     %rax,%rdx
+  8010aa:	48 09 ca             	or     %rcx,%rdx
+  8010ad:	f6 c2 07             	test   $0x7,%dl
+  8010b0:	75 0c                	jne    8010be <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010b2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010b6:	48 89 c7             	mov    %rax,%rdi
+  8010b9:	fc                   	cld
+  8010ba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010bd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010be:	48 89 c7             	mov    %rax,%rdi
+  8010c1:	fc                   	cld
+  8010c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010c4:	c3                   	ret
+
+00000000008010c5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010c9:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  8010d0:	00 00 00 
+  8010d3:	ff d0                	call   *%rax
+}
+  8010d5:	5d                   	pop    %rbp
+  8010d6:	c3                   	ret
+
+00000000008010d7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010d7:	55                   	push   %rbp
+  8010d8:	48 89 e5             	mov    %rsp,%rbp
+  8010db:	41 57                	push   %r15
+  8010dd:	41 56                	push   %r14
+  8010df:	41 55                	push   %r13
+  8010e1:	41 54                	push   %r12
+  8010e3:	53                   	push   %rbx
+  8010e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e8:	49 89 fe             	mov    %rdi,%r14
+  8010eb:	49 89 f7             	mov    %rsi,%r15
+  8010ee:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010f1:	48 89 f7             	mov    %rsi,%rdi
+  8010f4:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  8010fb:	00 00 00 
+  8010fe:	ff d0                	call   *%rax
+  801100:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801103:	48 89 de             	mov    %rbx,%rsi
+  801106:	4c 89 f7             	mov    %r14,%rdi
+  801109:	48 b8 41 0e 80 00 00 	movabs $0x800e41,%rax
+  801110:	00 00 00 
+  801113:	ff d0                	call   *%rax
+  801115:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801118:	48 39 c3             	cmp    %rax,%rbx
+  80111b:	74 36                	je     801153 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80111d:	48 89 d8             	mov    %rbx,%rax
+  801120:	4c 29 e8             	sub    %r13,%rax
+  801123:	49 39 c4             	cmp    %rax,%r12
+  801126:	73 31                	jae    801159 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801128:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80112d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801131:	4c 89 fe             	mov    %r15,%rsi
+  801134:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80113b:	00 00 00 
+  80113e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801140:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801144:	48 83 c4 08          	add    $0x8,%rsp
+  801148:	5b                   	pop    %rbx
+  801149:	41 5c                	pop    %r12
+  80114b:	41 5d                	pop    %r13
+  80114d:	41 5e                	pop    %r14
+  80114f:	41 5f                	pop    %r15
+  801151:	5d                   	pop    %rbp
+  801152:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801153:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801157:	eb eb                	jmp    801144 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801159:	48 83 eb 01          	sub    $0x1,%rbx
+  80115d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801161:	48 89 da             	mov    %rbx,%rdx
+  801164:	4c 89 fe             	mov    %r15,%rsi
+  801167:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80116e:	00 00 00 
+  801171:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801173:	49 01 de             	add    %rbx,%r14
+  801176:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80117b:	eb c3                	jmp    801140 <strlcat+0x69>
+
+000000000080117d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80117d:	48 85 d2             	test   %rdx,%rdx
+  801180:	74 2d                	je     8011af <memcmp+0x32>
+  801182:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801187:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80118b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801190:	44 38 c1             	cmp    %r8b,%cl
+  801193:	75 0f                	jne    8011a4 <memcmp+0x27>
+    while (n-- > 0) {
+  801195:	48 83 c0 01          	add    $0x1,%rax
+  801199:	48 39 c2             	cmp    %rax,%rdx
+  80119c:	75 e9                	jne    801187 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80119e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011a4:	0f b6 c1             	movzbl %cl,%eax
+  8011a7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011ab:	44 29 c0             	sub    %r8d,%eax
+  8011ae:	c3                   	ret
+    return 0;
+  8011af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b4:	c3                   	ret
+
+00000000008011b5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011b5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011b9:	48 39 c7             	cmp    %rax,%rdi
+  8011bc:	73 0f                	jae    8011cd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011be:	40 38 37             	cmp    %sil,(%rdi)
+  8011c1:	74 0e                	je     8011d1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011c3:	48 83 c7 01          	add    $0x1,%rdi
+  8011c7:	48 39 f8             	cmp    %rdi,%rax
+  8011ca:	75 f2                	jne    8011be <memfind+0x9>
+  8011cc:	c3                   	ret
+  8011cd:	48 89 f8             	mov    %rdi,%rax
+  8011d0:	c3                   	ret
+  8011d1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011d4:	c3                   	ret
+
+00000000008011d5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011d5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011d8:	0f b6 37             	movzbl (%rdi),%esi
+  8011db:	40 80 fe 20          	cmp    $0x20,%sil
+  8011df:	74 06                	je     8011e7 <strtol+0x12>
+  8011e1:	40 80 fe 09          	cmp    $0x9,%sil
+  8011e5:	75 13                	jne    8011fa <strtol+0x25>
+  8011e7:	48 83 c7 01          	add    $0x1,%rdi
+  8011eb:	0f b6 37             	movzbl (%rdi),%esi
+  8011ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8011f2:	74 f3                	je     8011e7 <strtol+0x12>
+  8011f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8011f8:	74 ed                	je     8011e7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011fa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011fd:	83 e0 fd             	and    $0xfffffffd,%eax
+  801200:	3c 01                	cmp    $0x1,%al
+  801202:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801206:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80120c:	75 0f                	jne    80121d <strtol+0x48>
+  80120e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801211:	74 14                	je     801227 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801213:	85 d2                	test   %edx,%edx
+  801215:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80121a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801222:	4c 63 ca             	movslq %edx,%r9
+  801225:	eb 36                	jmp    80125d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801227:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80122b:	74 0f                	je     80123c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80122d:	85 d2                	test   %edx,%edx
+  80122f:	75 ec                	jne    80121d <strtol+0x48>
+        s++;
+  801231:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801235:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80123a:	eb e1                	jmp    80121d <strtol+0x48>
+        s += 2;
+  80123c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801240:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801245:	eb d6                	jmp    80121d <strtol+0x48>
+            dig -= '0';
+  801247:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80124a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80124e:	41 39 d0             	cmp    %edx,%r8d
+  801251:	7d 21                	jge    801274 <strtol+0x9f>
+        val = val * base + dig;
+  801253:	49 0f af c1          	imul   %r9,%rax
+  801257:	0f b6 c9             	movzbl %cl,%ecx
+  80125a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80125d:	48 83 c7 01          	add    $0x1,%rdi
+  801261:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801265:	80 f9 39             	cmp    $0x39,%cl
+  801268:	76 dd                	jbe    801247 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80126a:	80 f9 7b             	cmp    $0x7b,%cl
+  80126d:	77 05                	ja     801274 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80126f:	83 e9 57             	sub    $0x57,%ecx
+  801272:	eb d6                	jmp    80124a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801274:	4d 85 d2             	test   %r10,%r10
+  801277:	74 03                	je     80127c <strtol+0xa7>
+  801279:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80127c:	48 89 c2             	mov    %rax,%rdx
+  80127f:	48 f7 da             	neg    %rdx
+  801282:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801286:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80128a:	c3                   	ret
+
+000000000080128b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80128b:	55                   	push   %rbp
+  80128c:	48 89 e5             	mov    %rsp,%rbp
+  80128f:	53                   	push   %rbx
+  801290:	48 89 fa             	mov    %rdi,%rdx
+  801293:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801296:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b6:	c9                   	leave
+  8012b7:	c3                   	ret
+
+00000000008012b8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012b8:	55                   	push   %rbp
+  8012b9:	48 89 e5             	mov    %rsp,%rbp
+  8012bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e7:	c9                   	leave
+  8012e8:	c3                   	ret
+
+00000000008012e9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012e9:	55                   	push   %rbp
+  8012ea:	48 89 e5             	mov    %rsp,%rbp
+  8012ed:	53                   	push   %rbx
+  8012ee:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801304:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801309:	be 00 00 00 00       	mov    $0x0,%esi
+  80130e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801314:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801316:	48 85 c0             	test   %rax,%rax
+  801319:	7f 06                	jg     801321 <sys_env_destroy+0x38>
+}
+  80131b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801321:	49 89 c0             	mov    %rax,%r8
+  801324:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801329:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801330:	00 00 00 
+  801333:	be 26 00 00 00       	mov    $0x26,%esi
+  801338:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80133f:	00 00 00 
+  801342:	b8 00 00 00 00       	mov    $0x0,%eax
+  801347:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  80134e:	00 00 00 
+  801351:	41 ff d1             	call   *%r9
+
+0000000000801354 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801354:	55                   	push   %rbp
+  801355:	48 89 e5             	mov    %rsp,%rbp
+  801358:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801359:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801363:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801372:	be 00 00 00 00       	mov    $0x0,%esi
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801383:	c9                   	leave
+  801384:	c3                   	ret
+
+0000000000801385 <sys_yield>:
+
+void
+sys_yield(void) {
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+  801389:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80138a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801394:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801399:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ae:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b4:	c9                   	leave
+  8013b5:	c3                   	ret
+
+00000000008013b6 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013b6:	55                   	push   %rbp
+  8013b7:	48 89 e5             	mov    %rsp,%rbp
+  8013ba:	53                   	push   %rbx
+  8013bb:	48 89 fa             	mov    %rdi,%rdx
+  8013be:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c1:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c6:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013cd:	00 00 00 
+  8013d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e6:	c9                   	leave
+  8013e7:	c3                   	ret
+
+00000000008013e8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013e8:	55                   	push   %rbp
+  8013e9:	48 89 e5             	mov    %rsp,%rbp
+  8013ec:	53                   	push   %rbx
+  8013ed:	49 89 f8             	mov    %rdi,%r8
+  8013f0:	48 89 d3             	mov    %rdx,%rbx
+  8013f3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fb:	4c 89 c2             	mov    %r8,%rdx
+  8013fe:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801401:	be 00 00 00 00       	mov    $0x0,%esi
+  801406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80140e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+
+0000000000801414 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+  801418:	53                   	push   %rbx
+  801419:	48 83 ec 08          	sub    $0x8,%rsp
+  80141d:	89 f8                	mov    %edi,%eax
+  80141f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801422:	48 63 f9             	movslq %ecx,%rdi
+  801425:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801428:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143d:	48 85 c0             	test   %rax,%rax
+  801440:	7f 06                	jg     801448 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801448:	49 89 c0             	mov    %rax,%r8
+  80144b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801450:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801457:	00 00 00 
+  80145a:	be 26 00 00 00       	mov    $0x26,%esi
+  80145f:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801466:	00 00 00 
+  801469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146e:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  801475:	00 00 00 
+  801478:	41 ff d1             	call   *%r9
+
+000000000080147b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+  80147f:	53                   	push   %rbx
+  801480:	48 83 ec 08          	sub    $0x8,%rsp
+  801484:	89 f8                	mov    %edi,%eax
+  801486:	49 89 f2             	mov    %rsi,%r10
+  801489:	48 89 cf             	mov    %rcx,%rdi
+  80148c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80148f:	48 63 da             	movslq %edx,%rbx
+  801492:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801495:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	7f 06                	jg     8014ad <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ab:	c9                   	leave
+  8014ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ad:	49 89 c0             	mov    %rax,%r8
+  8014b0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014b5:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8014bc:	00 00 00 
+  8014bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c4:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8014cb:	00 00 00 
+  8014ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d3:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  8014da:	00 00 00 
+  8014dd:	41 ff d1             	call   *%r9
+
+00000000008014e0 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e9:	49 89 f9             	mov    %rdi,%r9
+  8014ec:	89 f0                	mov    %esi,%eax
+  8014ee:	48 89 d3             	mov    %rdx,%rbx
+  8014f1:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014f4:	49 63 f0             	movslq %r8d,%rsi
+  8014f7:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fa:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ff:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801502:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801508:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150a:	48 85 c0             	test   %rax,%rax
+  80150d:	7f 06                	jg     801515 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80150f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801515:	49 89 c0             	mov    %rax,%r8
+  801518:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80151d:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801524:	00 00 00 
+  801527:	be 26 00 00 00       	mov    $0x26,%esi
+  80152c:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801533:	00 00 00 
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  801542:	00 00 00 
+  801545:	41 ff d1             	call   *%r9
+
+0000000000801548 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801548:	55                   	push   %rbp
+  801549:	48 89 e5             	mov    %rsp,%rbp
+  80154c:	53                   	push   %rbx
+  80154d:	48 83 ec 08          	sub    $0x8,%rsp
+  801551:	48 89 f1             	mov    %rsi,%rcx
+  801554:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801557:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801564:	be 00 00 00 00       	mov    $0x0,%esi
+  801569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801571:	48 85 c0             	test   %rax,%rax
+  801574:	7f 06                	jg     80157c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801576:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157a:	c9                   	leave
+  80157b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157c:	49 89 c0             	mov    %rax,%r8
+  80157f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801584:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80158b:	00 00 00 
+  80158e:	be 26 00 00 00       	mov    $0x26,%esi
+  801593:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80159a:	00 00 00 
+  80159d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a2:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  8015a9:	00 00 00 
+  8015ac:	41 ff d1             	call   *%r9
+
+00000000008015af <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  8015af:	55                   	push   %rbp
+  8015b0:	48 89 e5             	mov    %rsp,%rbp
+  8015b3:	53                   	push   %rbx
+  8015b4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d6:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  8015d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015dc:	c9                   	leave
+  8015dd:	c3                   	ret
+
+00000000008015de <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  8015de:	55                   	push   %rbp
+  8015df:	48 89 e5             	mov    %rsp,%rbp
+  8015e2:	53                   	push   %rbx
+  8015e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  8015ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ed:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801601:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801607:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801609:	48 85 c0             	test   %rax,%rax
+  80160c:	7f 06                	jg     801614 <sys_env_set_tls+0x36>
+}
+  80160e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801614:	49 89 c0             	mov    %rax,%r8
+  801617:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80161c:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  801623:	00 00 00 
+  801626:	be 26 00 00 00       	mov    $0x26,%esi
+  80162b:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801632:	00 00 00 
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163a:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  801641:	00 00 00 
+  801644:	41 ff d1             	call   *%r9
+
+0000000000801647 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801647:	55                   	push   %rbp
+  801648:	48 89 e5             	mov    %rsp,%rbp
+  80164b:	53                   	push   %rbx
+  80164c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801650:	48 63 ce             	movslq %esi,%rcx
+  801653:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801656:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801672:	48 85 c0             	test   %rax,%rax
+  801675:	7f 06                	jg     80167d <sys_env_set_status+0x36>
+}
+  801677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167d:	49 89 c0             	mov    %rax,%r8
+  801680:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801685:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80168c:	00 00 00 
+  80168f:	be 26 00 00 00       	mov    $0x26,%esi
+  801694:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80169b:	00 00 00 
+  80169e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a3:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  8016aa:	00 00 00 
+  8016ad:	41 ff d1             	call   *%r9
+
+00000000008016b0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  8016b9:	48 63 da             	movslq %edx,%rbx
+  8016bc:	48 63 ce             	movslq %esi,%rcx
+  8016bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d9:	48 85 c0             	test   %rax,%rax
+  8016dc:	7f 06                	jg     8016e4 <sys_env_set_priority+0x34>
+}
+  8016de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e2:	c9                   	leave
+  8016e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e4:	49 89 c0             	mov    %rax,%r8
+  8016e7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016ec:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8016f3:	00 00 00 
+  8016f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fb:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  801702:	00 00 00 
+  801705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170a:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  801711:	00 00 00 
+  801714:	41 ff d1             	call   *%r9
+
+0000000000801717 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+  80171b:	53                   	push   %rbx
+  80171c:	48 83 ec 08          	sub    $0x8,%rsp
+  801720:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801723:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801726:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801730:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801735:	be 00 00 00 00       	mov    $0x0,%esi
+  80173a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801740:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801742:	48 85 c0             	test   %rax,%rax
+  801745:	7f 06                	jg     80174d <sys_env_set_trapframe+0x36>
+}
+  801747:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174d:	49 89 c0             	mov    %rax,%r8
+  801750:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801755:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  80175c:	00 00 00 
+  80175f:	be 26 00 00 00       	mov    $0x26,%esi
+  801764:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  80176b:	00 00 00 
+  80176e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801773:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  80177a:	00 00 00 
+  80177d:	41 ff d1             	call   *%r9
+
+0000000000801780 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801780:	55                   	push   %rbp
+  801781:	48 89 e5             	mov    %rsp,%rbp
+  801784:	53                   	push   %rbx
+  801785:	48 83 ec 08          	sub    $0x8,%rsp
+  801789:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80178c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80178f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801794:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801799:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179e:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	7f 06                	jg     8017b6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b6:	49 89 c0             	mov    %rax,%r8
+  8017b9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017be:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8017c5:	00 00 00 
+  8017c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017cd:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8017d4:	00 00 00 
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dc:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  8017e3:	00 00 00 
+  8017e6:	41 ff d1             	call   *%r9
+
+00000000008017e9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017e9:	55                   	push   %rbp
+  8017ea:	48 89 e5             	mov    %rsp,%rbp
+  8017ed:	53                   	push   %rbx
+  8017ee:	89 f8                	mov    %edi,%eax
+  8017f0:	49 89 f1             	mov    %rsi,%r9
+  8017f3:	48 89 d3             	mov    %rdx,%rbx
+  8017f6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017f9:	49 63 f0             	movslq %r8d,%rsi
+  8017fc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ff:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801804:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801807:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80180d:	cd 30                	int    $0x30
+}
+  80180f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+
+0000000000801815 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801815:	55                   	push   %rbp
+  801816:	48 89 e5             	mov    %rsp,%rbp
+  801819:	41 55                	push   %r13
+  80181b:	41 54                	push   %r12
+  80181d:	53                   	push   %rbx
+  80181e:	89 f8                	mov    %edi,%eax
+  801820:	49 89 f2             	mov    %rsi,%r10
+  801823:	48 89 d3             	mov    %rdx,%rbx
+  801826:	48 89 cf             	mov    %rcx,%rdi
+  801829:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  80182c:	49 63 f0             	movslq %r8d,%rsi
+  80182f:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801832:	4d 85 c9             	test   %r9,%r9
+  801835:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  80183c:	00 00 00 
+  80183f:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801843:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801848:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80184b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801851:	4d 8b 0b             	mov    (%r11),%r9
+  801854:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801858:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80185c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  801860:	cd 30                	int    $0x30
+}
+  801862:	5b                   	pop    %rbx
+  801863:	41 5c                	pop    %r12
+  801865:	41 5d                	pop    %r13
+  801867:	5d                   	pop    %rbp
+  801868:	c3                   	ret
+
+0000000000801869 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  801869:	55                   	push   %rbp
+  80186a:	48 89 e5             	mov    %rsp,%rbp
+  80186d:	53                   	push   %rbx
+  80186e:	48 89 fa             	mov    %rdi,%rdx
+  801871:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801874:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801879:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801883:	be 00 00 00 00       	mov    $0x0,%esi
+  801888:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188e:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  801890:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801894:	c9                   	leave
+  801895:	c3                   	ret
+
+0000000000801896 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801896:	55                   	push   %rbp
+  801897:	48 89 e5             	mov    %rsp,%rbp
+  80189a:	53                   	push   %rbx
+  80189b:	48 83 ec 08          	sub    $0x8,%rsp
+  80189f:	48 89 fa             	mov    %rdi,%rdx
+  8018a2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c1:	48 85 c0             	test   %rax,%rax
+  8018c4:	7f 06                	jg     8018cc <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018cc:	49 89 c0             	mov    %rax,%r8
+  8018cf:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8018d4:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8018db:	00 00 00 
+  8018de:	be 26 00 00 00       	mov    $0x26,%esi
+  8018e3:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8018ea:	00 00 00 
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f2:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  8018f9:	00 00 00 
+  8018fc:	41 ff d1             	call   *%r9
+
+00000000008018ff <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8018ff:	55                   	push   %rbp
+  801900:	48 89 e5             	mov    %rsp,%rbp
+  801903:	41 55                	push   %r13
+  801905:	41 54                	push   %r12
+  801907:	53                   	push   %rbx
+  801908:	89 f8                	mov    %edi,%eax
+  80190a:	49 89 f2             	mov    %rsi,%r10
+  80190d:	48 89 d3             	mov    %rdx,%rbx
+  801910:	48 89 cf             	mov    %rcx,%rdi
+  801913:	44 89 c6             	mov    %r8d,%esi
+  801916:	4d 89 c8             	mov    %r9,%r8
+  801919:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80191d:	48 63 f6             	movslq %esi,%rsi
+  801920:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801923:	4d 85 db             	test   %r11,%r11
+  801926:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  80192d:	00 00 00 
+  801930:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801934:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801939:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  80193c:	4d 8b 0b             	mov    (%r11),%r9
+  80193f:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801943:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801947:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80194b:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80194d:	5b                   	pop    %rbx
+  80194e:	41 5c                	pop    %r12
+  801950:	41 5d                	pop    %r13
+  801952:	5d                   	pop    %rbp
+  801953:	c3                   	ret
+
+0000000000801954 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  801954:	55                   	push   %rbp
+  801955:	48 89 e5             	mov    %rsp,%rbp
+  801958:	41 55                	push   %r13
+  80195a:	41 54                	push   %r12
+  80195c:	53                   	push   %rbx
+  80195d:	89 f8                	mov    %edi,%eax
+  80195f:	49 89 f2             	mov    %rsi,%r10
+  801962:	48 89 d3             	mov    %rdx,%rbx
+  801965:	48 89 cf             	mov    %rcx,%rdi
+  801968:	44 89 c6             	mov    %r8d,%esi
+  80196b:	4d 89 c8             	mov    %r9,%r8
+  80196e:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  801972:	48 63 f6             	movslq %esi,%rsi
+  801975:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801978:	4d 85 db             	test   %r11,%r11
+  80197b:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  801982:	00 00 00 
+  801985:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  801989:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80198e:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  801991:	4d 8b 0b             	mov    (%r11),%r9
+  801994:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801998:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  80199c:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8019a0:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019a2:	5b                   	pop    %rbx
+  8019a3:	41 5c                	pop    %r12
+  8019a5:	41 5d                	pop    %r13
+  8019a7:	5d                   	pop    %rbp
+  8019a8:	c3                   	ret
+
+00000000008019a9 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	53                   	push   %rbx
+  8019ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b2:	48 89 f1             	mov    %rsi,%rcx
+  8019b5:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019bd:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019d2:	48 85 c0             	test   %rax,%rax
+  8019d5:	7f 06                	jg     8019dd <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019db:	c9                   	leave
+  8019dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019dd:	49 89 c0             	mov    %rax,%r8
+  8019e0:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019e5:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8019ec:	00 00 00 
+  8019ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8019f4:	48 bf 97 55 80 00 00 	movabs $0x805597,%rdi
+  8019fb:	00 00 00 
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a03:	49 b9 3f 3d 80 00 00 	movabs $0x803d3f,%r9
+  801a0a:	00 00 00 
+  801a0d:	41 ff d1             	call   *%r9
+
+0000000000801a10 <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  801a10:	55                   	push   %rbp
+  801a11:	48 89 e5             	mov    %rsp,%rbp
+  801a14:	53                   	push   %rbx
+  801a15:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a18:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a37:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  801a39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a3d:	c9                   	leave
+  801a3e:	c3                   	ret
+
+0000000000801a3f <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  801a3f:	55                   	push   %rbp
+  801a40:	48 89 e5             	mov    %rsp,%rbp
+  801a43:	53                   	push   %rbx
+  801a44:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  801a47:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801a49:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a58:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a63:	cd 30                	int    $0x30
+}
+  801a65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+0000000000801a6b <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	53                   	push   %rbx
+  801a70:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  801a73:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a76:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a80:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a85:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a90:	cd 30                	int    $0x30
+}
+  801a92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+
+0000000000801a98 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	53                   	push   %rbx
+  801a9d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  801aa0:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801aa2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aa7:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aaa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aaf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aba:	cd 30                	int    $0x30
+}
+  801abc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ac0:	c9                   	leave
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  801ac2:	55                   	push   %rbp
+  801ac3:	48 89 e5             	mov    %rsp,%rbp
+  801ac6:	53                   	push   %rbx
+  801ac7:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801aca:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801acd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae7:	cd 30                	int    $0x30
+}
+  801ae9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+
+0000000000801aef <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801aef:	55                   	push   %rbp
+  801af0:	48 89 e5             	mov    %rsp,%rbp
+  801af3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801af4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b08:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b18:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+
+0000000000801b20 <sys_monitor>:
+
+int sys_monitor(void) {
+  801b20:	55                   	push   %rbp
+  801b21:	48 89 e5             	mov    %rsp,%rbp
+  801b24:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b25:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b49:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+
+0000000000801b51 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b51:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b58:	ff ff ff 
+  801b5b:	48 01 f8             	add    %rdi,%rax
+  801b5e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b62:	c3                   	ret
+
+0000000000801b63 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b63:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b6a:	ff ff ff 
+  801b6d:	48 01 f8             	add    %rdi,%rax
+  801b70:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b74:	48 c1 e0 12          	shl    $0x12,%rax
+  801b78:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  801b7d:	48 01 d0             	add    %rdx,%rax
+}
+  801b80:	c3                   	ret
+
+0000000000801b81 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	41 57                	push   %r15
+  801b87:	41 56                	push   %r14
+  801b89:	41 55                	push   %r13
+  801b8b:	41 54                	push   %r12
+  801b8d:	53                   	push   %rbx
+  801b8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801b92:	49 89 ff             	mov    %rdi,%r15
+  801b95:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b9a:	49 bd 1f 38 80 00 00 	movabs $0x80381f,%r13
+  801ba1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ba4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801baa:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bad:	48 89 df             	mov    %rbx,%rdi
+  801bb0:	41 ff d5             	call   *%r13
+  801bb3:	83 e0 04             	and    $0x4,%eax
+  801bb6:	74 17                	je     801bcf <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bb8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bbf:	4c 39 f3             	cmp    %r14,%rbx
+  801bc2:	75 e6                	jne    801baa <fd_alloc+0x29>
+  801bc4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bca:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bcf:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bd2:	48 83 c4 08          	add    $0x8,%rsp
+  801bd6:	5b                   	pop    %rbx
+  801bd7:	41 5c                	pop    %r12
+  801bd9:	41 5d                	pop    %r13
+  801bdb:	41 5e                	pop    %r14
+  801bdd:	41 5f                	pop    %r15
+  801bdf:	5d                   	pop    %rbp
+  801be0:	c3                   	ret
+
+0000000000801be1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801be1:	83 ff 1f             	cmp    $0x1f,%edi
+  801be4:	77 39                	ja     801c1f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801be6:	55                   	push   %rbp
+  801be7:	48 89 e5             	mov    %rsp,%rbp
+  801bea:	41 54                	push   %r12
+  801bec:	53                   	push   %rbx
+  801bed:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bf0:	48 63 df             	movslq %edi,%rbx
+  801bf3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bfa:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bfe:	48 89 df             	mov    %rbx,%rdi
+  801c01:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	a8 04                	test   $0x4,%al
+  801c0f:	74 14                	je     801c25 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c11:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1a:	5b                   	pop    %rbx
+  801c1b:	41 5c                	pop    %r12
+  801c1d:	5d                   	pop    %rbp
+  801c1e:	c3                   	ret
+        return -E_INVAL;
+  801c1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c24:	c3                   	ret
+        return -E_INVAL;
+  801c25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2a:	eb ee                	jmp    801c1a <fd_lookup+0x39>
+
+0000000000801c2c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c2c:	55                   	push   %rbp
+  801c2d:	48 89 e5             	mov    %rsp,%rbp
+  801c30:	41 54                	push   %r12
+  801c32:	53                   	push   %rbx
+  801c33:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c36:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801c3d:	00 00 00 
+  801c40:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801c47:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c4a:	39 3b                	cmp    %edi,(%rbx)
+  801c4c:	74 4a                	je     801c98 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c4e:	48 83 c0 08          	add    $0x8,%rax
+  801c52:	48 8b 18             	mov    (%rax),%rbx
+  801c55:	48 85 db             	test   %rbx,%rbx
+  801c58:	75 f0                	jne    801c4a <dev_lookup+0x1e>
+  801c5a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801c61:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c63:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c67:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c6d:	89 fa                	mov    %edi,%edx
+  801c6f:	48 bf e0 55 80 00 00 	movabs $0x8055e0,%rdi
+  801c76:	00 00 00 
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	48 b9 3f 05 80 00 00 	movabs $0x80053f,%rcx
+  801c85:	00 00 00 
+  801c88:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c8f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c93:	5b                   	pop    %rbx
+  801c94:	41 5c                	pop    %r12
+  801c96:	5d                   	pop    %rbp
+  801c97:	c3                   	ret
+            return 0;
+  801c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9d:	eb f0                	jmp    801c8f <dev_lookup+0x63>
+
+0000000000801c9f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c9f:	55                   	push   %rbp
+  801ca0:	48 89 e5             	mov    %rsp,%rbp
+  801ca3:	41 55                	push   %r13
+  801ca5:	41 54                	push   %r12
+  801ca7:	53                   	push   %rbx
+  801ca8:	48 83 ec 18          	sub    $0x18,%rsp
+  801cac:	48 89 fb             	mov    %rdi,%rbx
+  801caf:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cb9:	ff ff ff 
+  801cbc:	48 01 df             	add    %rbx,%rdi
+  801cbf:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cc7:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  801cce:	00 00 00 
+  801cd1:	ff d0                	call   *%rax
+  801cd3:	41 89 c5             	mov    %eax,%r13d
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 06                	js     801ce0 <fd_close+0x41>
+  801cda:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cde:	74 1a                	je     801cfa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ce0:	45 84 e4             	test   %r12b,%r12b
+  801ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cec:	44 89 e8             	mov    %r13d,%eax
+  801cef:	48 83 c4 18          	add    $0x18,%rsp
+  801cf3:	5b                   	pop    %rbx
+  801cf4:	41 5c                	pop    %r12
+  801cf6:	41 5d                	pop    %r13
+  801cf8:	5d                   	pop    %rbp
+  801cf9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cfa:	8b 3b                	mov    (%rbx),%edi
+  801cfc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d00:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+  801d0c:	41 89 c5             	mov    %eax,%r13d
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	78 1b                	js     801d2e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d17:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d1b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d21:	48 85 c0             	test   %rax,%rax
+  801d24:	74 08                	je     801d2e <fd_close+0x8f>
+  801d26:	48 89 df             	mov    %rbx,%rdi
+  801d29:	ff d0                	call   *%rax
+  801d2b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d33:	48 89 de             	mov    %rbx,%rsi
+  801d36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3b:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+    return res;
+  801d47:	eb a3                	jmp    801cec <fd_close+0x4d>
+
+0000000000801d49 <close>:
+
+int
+close(int fdnum) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d51:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d55:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  801d5c:	00 00 00 
+  801d5f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 15                	js     801d7a <close+0x31>
+
+    return fd_close(fd, 1);
+  801d65:	be 01 00 00 00       	mov    $0x1,%esi
+  801d6a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d6e:	48 b8 9f 1c 80 00 00 	movabs $0x801c9f,%rax
+  801d75:	00 00 00 
+  801d78:	ff d0                	call   *%rax
+}
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+0000000000801d7c <close_all>:
+
+void
+close_all(void) {
+  801d7c:	55                   	push   %rbp
+  801d7d:	48 89 e5             	mov    %rsp,%rbp
+  801d80:	41 54                	push   %r12
+  801d82:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d88:	49 bc 49 1d 80 00 00 	movabs $0x801d49,%r12
+  801d8f:	00 00 00 
+  801d92:	89 df                	mov    %ebx,%edi
+  801d94:	41 ff d4             	call   *%r12
+  801d97:	83 c3 01             	add    $0x1,%ebx
+  801d9a:	83 fb 20             	cmp    $0x20,%ebx
+  801d9d:	75 f3                	jne    801d92 <close_all+0x16>
+}
+  801d9f:	5b                   	pop    %rbx
+  801da0:	41 5c                	pop    %r12
+  801da2:	5d                   	pop    %rbp
+  801da3:	c3                   	ret
+
+0000000000801da4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	41 57                	push   %r15
+  801daa:	41 56                	push   %r14
+  801dac:	41 55                	push   %r13
+  801dae:	41 54                	push   %r12
+  801db0:	53                   	push   %rbx
+  801db1:	48 83 ec 38          	sub    $0x38,%rsp
+  801db5:	41 89 f7             	mov    %esi,%r15d
+  801db8:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dbb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dbf:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	89 c3                	mov    %eax,%ebx
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	0f 88 ec 00 00 00    	js     801ec1 <dup+0x11d>
+    close(newfdnum);
+  801dd5:	44 89 ff             	mov    %r15d,%edi
+  801dd8:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801de4:	49 63 c7             	movslq %r15d,%rax
+  801de7:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801ded:	48 c1 e0 0c          	shl    $0xc,%rax
+  801df1:	49 89 c6             	mov    %rax,%r14
+  801df4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801df8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801dfc:	4c 89 ff             	mov    %r15,%rdi
+  801dff:	48 bb 63 1b 80 00 00 	movabs $0x801b63,%rbx
+  801e06:	00 00 00 
+  801e09:	ff d3                	call   *%rbx
+  801e0b:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801e0e:	4c 89 f7             	mov    %r14,%rdi
+  801e11:	ff d3                	call   *%rbx
+  801e13:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801e17:	4c 89 e7             	mov    %r12,%rdi
+  801e1a:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801e29:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801e2e:	49 be 1f 38 80 00 00 	movabs $0x80381f,%r14
+  801e35:	00 00 00 
+  801e38:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801e3c:	41 ff d6             	call   *%r14
+  801e3f:	44 39 e8             	cmp    %r13d,%eax
+  801e42:	75 10                	jne    801e54 <dup+0xb0>
+  801e44:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e4b:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801e52:	75 e4                	jne    801e38 <dup+0x94>
+    if (prot & PROT_R) {
+  801e54:	41 f6 c5 04          	test   $0x4,%r13b
+  801e58:	74 29                	je     801e83 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801e5a:	45 89 e9             	mov    %r13d,%r9d
+  801e5d:	49 89 d8             	mov    %rbx,%r8
+  801e60:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e69:	4c 89 e6             	mov    %r12,%rsi
+  801e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e71:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+  801e7d:	89 c3                	mov    %eax,%ebx
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 4f                	js     801ed2 <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801e83:	4c 89 ff             	mov    %r15,%rdi
+  801e86:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  801e8d:	00 00 00 
+  801e90:	ff d0                	call   *%rax
+  801e92:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e95:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e9b:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea4:	4c 89 fe             	mov    %r15,%rsi
+  801ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eac:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  801eb3:	00 00 00 
+  801eb6:	ff d0                	call   *%rax
+  801eb8:	89 c3                	mov    %eax,%ebx
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 14                	js     801ed2 <dup+0x12e>
+
+    return newfdnum;
+  801ebe:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801ec1:	89 d8                	mov    %ebx,%eax
+  801ec3:	48 83 c4 38          	add    $0x38,%rsp
+  801ec7:	5b                   	pop    %rbx
+  801ec8:	41 5c                	pop    %r12
+  801eca:	41 5d                	pop    %r13
+  801ecc:	41 5e                	pop    %r14
+  801ece:	41 5f                	pop    %r15
+  801ed0:	5d                   	pop    %rbp
+  801ed1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ed2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ed7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801edb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee0:	49 bc 48 15 80 00 00 	movabs $0x801548,%r12
+  801ee7:	00 00 00 
+  801eea:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801eed:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801ef2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ef6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801efb:	41 ff d4             	call   *%r12
+    return res;
+  801efe:	eb c1                	jmp    801ec1 <dup+0x11d>
+
+0000000000801f00 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 56                	push   %r14
+  801f06:	41 55                	push   %r13
+  801f08:	41 54                	push   %r12
+  801f0a:	53                   	push   %rbx
+  801f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0f:	89 fb                	mov    %edi,%ebx
+  801f11:	49 89 f4             	mov    %rsi,%r12
+  801f14:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f17:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f1b:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  801f22:	00 00 00 
+  801f25:	ff d0                	call   *%rax
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	78 4c                	js     801f77 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f2b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f2f:	41 8b 3e             	mov    (%r14),%edi
+  801f32:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f36:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  801f3d:	00 00 00 
+  801f40:	ff d0                	call   *%rax
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 35                	js     801f7b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f46:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f4a:	83 e0 03             	and    $0x3,%eax
+  801f4d:	83 f8 01             	cmp    $0x1,%eax
+  801f50:	74 2d                	je     801f7f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f56:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f5a:	48 85 c0             	test   %rax,%rax
+  801f5d:	74 59                	je     801fb8 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f5f:	4c 89 ea             	mov    %r13,%rdx
+  801f62:	4c 89 e6             	mov    %r12,%rsi
+  801f65:	4c 89 f7             	mov    %r14,%rdi
+  801f68:	ff d0                	call   *%rax
+}
+  801f6a:	48 83 c4 10          	add    $0x10,%rsp
+  801f6e:	5b                   	pop    %rbx
+  801f6f:	41 5c                	pop    %r12
+  801f71:	41 5d                	pop    %r13
+  801f73:	41 5e                	pop    %r14
+  801f75:	5d                   	pop    %rbp
+  801f76:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f77:	48 98                	cltq
+  801f79:	eb ef                	jmp    801f6a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7b:	48 98                	cltq
+  801f7d:	eb eb                	jmp    801f6a <read+0x6a>
+  801f7f:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801f86:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f8c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f92:	89 da                	mov    %ebx,%edx
+  801f94:	48 bf 21 56 80 00 00 	movabs $0x805621,%rdi
+  801f9b:	00 00 00 
+  801f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa3:	48 b9 3f 05 80 00 00 	movabs $0x80053f,%rcx
+  801faa:	00 00 00 
+  801fad:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801faf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb6:	eb b2                	jmp    801f6a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fb8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fbf:	eb a9                	jmp    801f6a <read+0x6a>
+
+0000000000801fc1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fc1:	55                   	push   %rbp
+  801fc2:	48 89 e5             	mov    %rsp,%rbp
+  801fc5:	41 57                	push   %r15
+  801fc7:	41 56                	push   %r14
+  801fc9:	41 55                	push   %r13
+  801fcb:	41 54                	push   %r12
+  801fcd:	53                   	push   %rbx
+  801fce:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fd2:	48 85 d2             	test   %rdx,%rdx
+  801fd5:	74 54                	je     80202b <readn+0x6a>
+  801fd7:	41 89 fd             	mov    %edi,%r13d
+  801fda:	49 89 f6             	mov    %rsi,%r14
+  801fdd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fe5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fea:	49 bf 00 1f 80 00 00 	movabs $0x801f00,%r15
+  801ff1:	00 00 00 
+  801ff4:	4c 89 e2             	mov    %r12,%rdx
+  801ff7:	48 29 f2             	sub    %rsi,%rdx
+  801ffa:	4c 01 f6             	add    %r14,%rsi
+  801ffd:	44 89 ef             	mov    %r13d,%edi
+  802000:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 20                	js     802027 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802007:	01 c3                	add    %eax,%ebx
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	74 08                	je     802015 <readn+0x54>
+  80200d:	48 63 f3             	movslq %ebx,%rsi
+  802010:	4c 39 e6             	cmp    %r12,%rsi
+  802013:	72 df                	jb     801ff4 <readn+0x33>
+    }
+    return res;
+  802015:	48 63 c3             	movslq %ebx,%rax
+}
+  802018:	48 83 c4 08          	add    $0x8,%rsp
+  80201c:	5b                   	pop    %rbx
+  80201d:	41 5c                	pop    %r12
+  80201f:	41 5d                	pop    %r13
+  802021:	41 5e                	pop    %r14
+  802023:	41 5f                	pop    %r15
+  802025:	5d                   	pop    %rbp
+  802026:	c3                   	ret
+        if (inc < 0) return inc;
+  802027:	48 98                	cltq
+  802029:	eb ed                	jmp    802018 <readn+0x57>
+    int inc = 1, res = 0;
+  80202b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802030:	eb e3                	jmp    802015 <readn+0x54>
+
+0000000000802032 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  802036:	41 56                	push   %r14
+  802038:	41 55                	push   %r13
+  80203a:	41 54                	push   %r12
+  80203c:	53                   	push   %rbx
+  80203d:	48 83 ec 10          	sub    $0x10,%rsp
+  802041:	89 fb                	mov    %edi,%ebx
+  802043:	49 89 f4             	mov    %rsi,%r12
+  802046:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802049:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80204d:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  802054:	00 00 00 
+  802057:	ff d0                	call   *%rax
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	78 47                	js     8020a4 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80205d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802061:	41 8b 3e             	mov    (%r14),%edi
+  802064:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802068:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 30                	js     8020a8 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802078:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80207d:	74 2d                	je     8020ac <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80207f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802083:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802087:	48 85 c0             	test   %rax,%rax
+  80208a:	74 59                	je     8020e5 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  80208c:	4c 89 ea             	mov    %r13,%rdx
+  80208f:	4c 89 e6             	mov    %r12,%rsi
+  802092:	4c 89 f7             	mov    %r14,%rdi
+  802095:	ff d0                	call   *%rax
+}
+  802097:	48 83 c4 10          	add    $0x10,%rsp
+  80209b:	5b                   	pop    %rbx
+  80209c:	41 5c                	pop    %r12
+  80209e:	41 5d                	pop    %r13
+  8020a0:	41 5e                	pop    %r14
+  8020a2:	5d                   	pop    %rbp
+  8020a3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a4:	48 98                	cltq
+  8020a6:	eb ef                	jmp    802097 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a8:	48 98                	cltq
+  8020aa:	eb eb                	jmp    802097 <write+0x65>
+  8020ac:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8020b3:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020bf:	89 da                	mov    %ebx,%edx
+  8020c1:	48 bf 3d 56 80 00 00 	movabs $0x80563d,%rdi
+  8020c8:	00 00 00 
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	48 b9 3f 05 80 00 00 	movabs $0x80053f,%rcx
+  8020d7:	00 00 00 
+  8020da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020e3:	eb b2                	jmp    802097 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020e5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020ec:	eb a9                	jmp    802097 <write+0x65>
+
+00000000008020ee <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	53                   	push   %rbx
+  8020f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020fd:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 0c                	js     802119 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80210d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802111:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+000000000080211f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	41 55                	push   %r13
+  802125:	41 54                	push   %r12
+  802127:	53                   	push   %rbx
+  802128:	48 83 ec 18          	sub    $0x18,%rsp
+  80212c:	89 fb                	mov    %edi,%ebx
+  80212e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802131:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802135:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 38                	js     80217d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802145:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802149:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80214d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802151:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 1c                	js     80217d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802161:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802166:	74 20                	je     802188 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802168:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80216c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802170:	48 85 c0             	test   %rax,%rax
+  802173:	74 4a                	je     8021bf <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802175:	44 89 e6             	mov    %r12d,%esi
+  802178:	4c 89 ef             	mov    %r13,%rdi
+  80217b:	ff d0                	call   *%rax
+}
+  80217d:	48 83 c4 18          	add    $0x18,%rsp
+  802181:	5b                   	pop    %rbx
+  802182:	41 5c                	pop    %r12
+  802184:	41 5d                	pop    %r13
+  802186:	5d                   	pop    %rbp
+  802187:	c3                   	ret
+  802188:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80218f:	00 00 
+                thisenv->env_id, fdnum);
+  802191:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802195:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80219b:	89 da                	mov    %ebx,%edx
+  80219d:	48 bf 00 56 80 00 00 	movabs $0x805600,%rdi
+  8021a4:	00 00 00 
+  8021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ac:	48 b9 3f 05 80 00 00 	movabs $0x80053f,%rcx
+  8021b3:	00 00 00 
+  8021b6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021bd:	eb be                	jmp    80217d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021bf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c4:	eb b7                	jmp    80217d <ftruncate+0x5e>
+
+00000000008021c6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8021c6:	55                   	push   %rbp
+  8021c7:	48 89 e5             	mov    %rsp,%rbp
+  8021ca:	41 54                	push   %r12
+  8021cc:	53                   	push   %rbx
+  8021cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021d8:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 4e                	js     802236 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021e8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021ec:	41 8b 3c 24          	mov    (%r12),%edi
+  8021f0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021f4:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  8021fb:	00 00 00 
+  8021fe:	ff d0                	call   *%rax
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 32                	js     802236 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802204:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802208:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80220d:	74 30                	je     80223f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80220f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802212:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802219:	00 00 00 
+    stat->st_isdir = 0;
+  80221c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802223:	00 00 00 
+    stat->st_dev = dev;
+  802226:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80222d:	48 89 de             	mov    %rbx,%rsi
+  802230:	4c 89 e7             	mov    %r12,%rdi
+  802233:	ff 50 28             	call   *0x28(%rax)
+}
+  802236:	48 83 c4 10          	add    $0x10,%rsp
+  80223a:	5b                   	pop    %rbx
+  80223b:	41 5c                	pop    %r12
+  80223d:	5d                   	pop    %rbp
+  80223e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80223f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802244:	eb f0                	jmp    802236 <fstat+0x70>
+
+0000000000802246 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802246:	55                   	push   %rbp
+  802247:	48 89 e5             	mov    %rsp,%rbp
+  80224a:	41 54                	push   %r12
+  80224c:	53                   	push   %rbx
+  80224d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802250:	be 00 00 00 00       	mov    $0x0,%esi
+  802255:	48 b8 49 28 80 00 00 	movabs $0x802849,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802263:	85 c0                	test   %eax,%eax
+  802265:	78 25                	js     80228c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802267:	4c 89 e6             	mov    %r12,%rsi
+  80226a:	89 c7                	mov    %eax,%edi
+  80226c:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802273:	00 00 00 
+  802276:	ff d0                	call   *%rax
+  802278:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80227b:	89 df                	mov    %ebx,%edi
+  80227d:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  802284:	00 00 00 
+  802287:	ff d0                	call   *%rax
+
+    return res;
+  802289:	44 89 e3             	mov    %r12d,%ebx
+}
+  80228c:	89 d8                	mov    %ebx,%eax
+  80228e:	5b                   	pop    %rbx
+  80228f:	41 5c                	pop    %r12
+  802291:	5d                   	pop    %rbp
+  802292:	c3                   	ret
+
+0000000000802293 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802293:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80229a:	00 00 00 
+  80229d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a2:	eb 0e                	jmp    8022b2 <mmap_lookup+0x1f>
+  8022a4:	48 83 c2 01          	add    $0x1,%rdx
+  8022a8:	48 83 c0 20          	add    $0x20,%rax
+  8022ac:	48 83 fa 40          	cmp    $0x40,%rdx
+  8022b0:	74 2b                	je     8022dd <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  8022b2:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8022b6:	48 85 c9             	test   %rcx,%rcx
+  8022b9:	74 e9                	je     8022a4 <mmap_lookup+0x11>
+  8022bb:	48 8b 30             	mov    (%rax),%rsi
+  8022be:	48 39 f7             	cmp    %rsi,%rdi
+  8022c1:	72 e1                	jb     8022a4 <mmap_lookup+0x11>
+  8022c3:	48 01 f1             	add    %rsi,%rcx
+  8022c6:	48 39 cf             	cmp    %rcx,%rdi
+  8022c9:	73 d9                	jae    8022a4 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  8022cb:	48 c1 e2 05          	shl    $0x5,%rdx
+  8022cf:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8022d6:	00 00 00 
+  8022d9:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  8022dc:	c3                   	ret
+    return NULL;
+  8022dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e2:	c3                   	ret
+
+00000000008022e3 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	89 fb                	mov    %edi,%ebx
+  8022ec:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022ef:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8022f6:	00 00 00 
+  8022f9:	83 38 00             	cmpl   $0x0,(%rax)
+  8022fc:	74 3d                	je     80233b <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  8022fe:	41 54                	push   %r12
+  802300:	6a 00                	push   $0x0
+  802302:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80230e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802313:	ba 00 00 00 00       	mov    $0x0,%edx
+  802318:	89 de                	mov    %ebx,%esi
+  80231a:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802321:	00 00 00 
+  802324:	8b 38                	mov    (%rax),%edi
+  802326:	48 b8 3a 3f 80 00 00 	movabs $0x803f3a,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+}
+  802332:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	5d                   	pop    %rbp
+  80233a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802340:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+  80234c:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  802353:	00 00 
+  802355:	eb a7                	jmp    8022fe <fsipc_words+0x1b>
+
+0000000000802357 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  80235f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802366:	00 
+  802367:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80236e:	00 
+  80236f:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802373:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802377:	48 63 f6             	movslq %esi,%rsi
+  80237a:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  80237e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802382:	bf 02 00 00 00       	mov    $0x2,%edi
+  802387:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+}
+  802393:	c9                   	leave
+  802394:	c3                   	ret
+
+0000000000802395 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80239d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8023a4:	00 
+  8023a5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023ac:	00 
+  8023ad:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8023b4:	00 
+  8023b5:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8023b9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  8023bd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023c1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023c6:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+}
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+
+00000000008023d4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8023d4:	55                   	push   %rbp
+  8023d5:	48 89 e5             	mov    %rsp,%rbp
+  8023d8:	41 54                	push   %r12
+  8023da:	53                   	push   %rbx
+  8023db:	89 fb                	mov    %edi,%ebx
+  8023dd:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023e0:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8023e7:	00 00 00 
+  8023ea:	83 38 00             	cmpl   $0x0,(%rax)
+  8023ed:	74 3f                	je     80242e <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  8023ef:	6a 00                	push   $0x0
+  8023f1:	6a 00                	push   $0x0
+  8023f3:	4d 89 e1             	mov    %r12,%r9
+  8023f6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023fc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802401:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802408:	00 00 00 
+  80240b:	89 de                	mov    %ebx,%esi
+  80240d:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802414:	00 00 00 
+  802417:	8b 38                	mov    (%rax),%edi
+  802419:	48 b8 3a 3f 80 00 00 	movabs $0x803f3a,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+}
+  802425:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802429:	5b                   	pop    %rbx
+  80242a:	41 5c                	pop    %r12
+  80242c:	5d                   	pop    %rbp
+  80242d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80242e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802433:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  802446:	00 00 
+  802448:	eb a5                	jmp    8023ef <fsipc+0x1b>
+
+000000000080244a <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	41 54                	push   %r12
+  802450:	53                   	push   %rbx
+  802451:	41 89 fc             	mov    %edi,%r12d
+  802454:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802457:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80245e:	00 00 00 
+  802461:	83 38 00             	cmpl   $0x0,(%rax)
+  802464:	74 46                	je     8024ac <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  802466:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  80246a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80246e:	6a 00                	push   $0x0
+  802470:	6a 00                	push   $0x0
+  802472:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802478:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80247e:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  802485:	00 00 00 
+  802488:	44 89 e6             	mov    %r12d,%esi
+  80248b:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  802492:	00 00 00 
+  802495:	8b 38                	mov    (%rax),%edi
+  802497:	48 b8 3a 3f 80 00 00 	movabs $0x803f3a,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+}
+  8024a3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8024a7:	5b                   	pop    %rbx
+  8024a8:	41 5c                	pop    %r12
+  8024aa:	5d                   	pop    %rbp
+  8024ab:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024b1:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  8024bd:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  8024c4:	00 00 
+  8024c6:	eb 9e                	jmp    802466 <fsipcv+0x1c>
+
+00000000008024c8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	41 54                	push   %r12
+  8024ce:	53                   	push   %rbx
+  8024cf:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8024d2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8024d5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8024dc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8024de:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8024e8:	48 b8 d4 23 80 00 00 	movabs $0x8023d4,%rax
+  8024ef:	00 00 00 
+  8024f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	78 3d                	js     802535 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8024f8:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8024ff:	00 00 00 
+  802502:	4c 89 e6             	mov    %r12,%rsi
+  802505:	48 89 df             	mov    %rbx,%rdi
+  802508:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802514:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80251b:	00 
+  80251c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802522:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802529:	00 
+  80252a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802530:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802535:	5b                   	pop    %rbx
+  802536:	41 5c                	pop    %r12
+  802538:	5d                   	pop    %rbp
+  802539:	c3                   	ret
+
+000000000080253a <fsipcv_buf>:
+    return FSIPCV;
+  80253a:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  802541:	00 00 00 
+    if (!allocated) {
+  802544:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80254b:	00 00 00 
+  80254e:	80 3a 00             	cmpb   $0x0,(%rdx)
+  802551:	74 01                	je     802554 <fsipcv_buf+0x1a>
+}
+  802553:	c3                   	ret
+fsipcv_buf(void) {
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802558:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80255d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802562:	48 89 c6             	mov    %rax,%rsi
+  802565:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256a:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 19                	js     802593 <fsipcv_buf+0x59>
+        allocated = 1;
+  80257a:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  802581:	00 00 00 
+  802584:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  802587:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  80258e:	00 00 00 
+}
+  802591:	5d                   	pop    %rbp
+  802592:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802593:	b8 00 00 00 00       	mov    $0x0,%eax
+  802598:	eb f7                	jmp    802591 <fsipcv_buf+0x57>
+
+000000000080259a <devfile_write>:
+    if (!fd || !buf) {
+  80259a:	48 85 ff             	test   %rdi,%rdi
+  80259d:	0f 84 46 01 00 00    	je     8026e9 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8025a3:	55                   	push   %rbp
+  8025a4:	48 89 e5             	mov    %rsp,%rbp
+  8025a7:	41 57                	push   %r15
+  8025a9:	41 56                	push   %r14
+  8025ab:	41 55                	push   %r13
+  8025ad:	41 54                	push   %r12
+  8025af:	53                   	push   %rbx
+  8025b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b4:	49 89 ff             	mov    %rdi,%r15
+  8025b7:	49 89 f5             	mov    %rsi,%r13
+  8025ba:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  8025bd:	48 85 f6             	test   %rsi,%rsi
+  8025c0:	0f 84 1a 01 00 00    	je     8026e0 <devfile_write+0x146>
+    while (n) {
+  8025c6:	48 85 d2             	test   %rdx,%rdx
+  8025c9:	0f 84 fc 00 00 00    	je     8026cb <devfile_write+0x131>
+    size_t i = 0;
+  8025cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8025d5:	eb 6c                	jmp    802643 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025d7:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  8025dd:	4c 39 e3             	cmp    %r12,%rbx
+  8025e0:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  8025e4:	4c 89 e2             	mov    %r12,%rdx
+  8025e7:	4c 89 ee             	mov    %r13,%rsi
+  8025ea:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8025f1:	00 00 00 
+  8025f4:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8025fb:	00 00 00 
+  8025fe:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802600:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802604:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80260b:	00 00 00 
+  80260e:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  802610:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802614:	be 00 00 00 00       	mov    $0x0,%esi
+  802619:	bf 04 00 00 00       	mov    $0x4,%edi
+  80261e:	48 b8 d4 23 80 00 00 	movabs $0x8023d4,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	0f 88 95 00 00 00    	js     8026c7 <devfile_write+0x12d>
+        buf += ret;
+  802632:	48 98                	cltq
+  802634:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  802637:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  80263a:	48 29 c3             	sub    %rax,%rbx
+  80263d:	0f 84 8b 00 00 00    	je     8026ce <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  802643:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80264a:	76 8b                	jbe    8025d7 <devfile_write+0x3d>
+  80264c:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	49 89 c4             	mov    %rax,%r12
+  80265b:	48 85 c0             	test   %rax,%rax
+  80265e:	0f 84 73 ff ff ff    	je     8025d7 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  802664:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802669:	48 39 c3             	cmp    %rax,%rbx
+  80266c:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  802670:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  802677:	00 
+  802678:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80267c:	48 89 c2             	mov    %rax,%rdx
+  80267f:	4c 89 ee             	mov    %r13,%rsi
+  802682:	48 b9 c5 10 80 00 00 	movabs $0x8010c5,%rcx
+  802689:	00 00 00 
+  80268c:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  80268e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802692:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802696:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80269a:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80269f:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  8026a6:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8026aa:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8026af:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  8026b6:	00 00 00 
+  8026b9:	ff d0                	call   *%rax
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	0f 89 6f ff ff ff    	jns    802632 <devfile_write+0x98>
+                return ret;
+  8026c3:	48 98                	cltq
+  8026c5:	eb 0a                	jmp    8026d1 <devfile_write+0x137>
+                return ret;
+  8026c7:	48 98                	cltq
+  8026c9:	eb 06                	jmp    8026d1 <devfile_write+0x137>
+    size_t i = 0;
+  8026cb:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  8026ce:	4c 89 f0             	mov    %r14,%rax
+}
+  8026d1:	48 83 c4 18          	add    $0x18,%rsp
+  8026d5:	5b                   	pop    %rbx
+  8026d6:	41 5c                	pop    %r12
+  8026d8:	41 5d                	pop    %r13
+  8026da:	41 5e                	pop    %r14
+  8026dc:	41 5f                	pop    %r15
+  8026de:	5d                   	pop    %rbp
+  8026df:	c3                   	ret
+        return -E_INVAL;
+  8026e0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026e7:	eb e8                	jmp    8026d1 <devfile_write+0x137>
+  8026e9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8026f0:	c3                   	ret
+
+00000000008026f1 <devfile_read>:
+    if (!fd || !buf) {
+  8026f1:	48 85 ff             	test   %rdi,%rdi
+  8026f4:	0f 84 47 01 00 00    	je     802841 <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	41 57                	push   %r15
+  802700:	41 56                	push   %r14
+  802702:	41 55                	push   %r13
+  802704:	41 54                	push   %r12
+  802706:	53                   	push   %rbx
+  802707:	48 83 ec 18          	sub    $0x18,%rsp
+  80270b:	49 89 ff             	mov    %rdi,%r15
+  80270e:	49 89 f5             	mov    %rsi,%r13
+  802711:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802714:	48 85 f6             	test   %rsi,%rsi
+  802717:	0f 84 1b 01 00 00    	je     802838 <devfile_read+0x147>
+    while (n) {
+  80271d:	48 85 d2             	test   %rdx,%rdx
+  802720:	0f 84 fb 00 00 00    	je     802821 <devfile_read+0x130>
+    size_t i = 0;
+  802726:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80272d:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80272e:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  802735:	00 00 00 
+  802738:	eb 5f                	jmp    802799 <devfile_read+0xa8>
+                return ret ? ret : i;
+  80273a:	48 98                	cltq
+  80273c:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  802741:	e9 e3 00 00 00       	jmp    802829 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802746:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80274a:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  80274d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  802751:	be 00 00 00 00       	mov    $0x0,%esi
+  802756:	bf 03 00 00 00       	mov    $0x3,%edi
+  80275b:	48 b8 d4 23 80 00 00 	movabs $0x8023d4,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+  802767:	89 c3                	mov    %eax,%ebx
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	0f 8e a7 00 00 00    	jle    802818 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  802771:	48 63 d0             	movslq %eax,%rdx
+  802774:	4c 89 f6             	mov    %r14,%rsi
+  802777:	4c 89 ef             	mov    %r13,%rdi
+  80277a:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+        buf += ret;
+  802786:	48 63 db             	movslq %ebx,%rbx
+  802789:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  80278c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  802790:	49 29 dc             	sub    %rbx,%r12
+  802793:	0f 84 8c 00 00 00    	je     802825 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802799:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8027a0:	76 a4                	jbe    802746 <devfile_read+0x55>
+  8027a2:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	48 89 c1             	mov    %rax,%rcx
+  8027b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b5:	48 85 c0             	test   %rax,%rax
+  8027b8:	74 8c                	je     802746 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  8027ba:	be 00 00 04 00       	mov    $0x40000,%esi
+  8027bf:	49 39 f4             	cmp    %rsi,%r12
+  8027c2:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  8027c6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027ca:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  8027cc:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  8027d0:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8027d7:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8027db:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8027e0:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	89 c3                	mov    %eax,%ebx
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	0f 8e 44 ff ff ff    	jle    80273a <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  8027f6:	48 63 d0             	movslq %eax,%rdx
+  8027f9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8027fd:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802804:	4c 89 ef             	mov    %r13,%rdi
+  802807:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802813:	e9 6e ff ff ff       	jmp    802786 <devfile_read+0x95>
+                return ret ? ret : i;
+  802818:	48 98                	cltq
+  80281a:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80281f:	eb 08                	jmp    802829 <devfile_read+0x138>
+    size_t i = 0;
+  802821:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802825:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802829:	48 83 c4 18          	add    $0x18,%rsp
+  80282d:	5b                   	pop    %rbx
+  80282e:	41 5c                	pop    %r12
+  802830:	41 5d                	pop    %r13
+  802832:	41 5e                	pop    %r14
+  802834:	41 5f                	pop    %r15
+  802836:	5d                   	pop    %rbp
+  802837:	c3                   	ret
+        return -E_INVAL;
+  802838:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80283f:	eb e8                	jmp    802829 <devfile_read+0x138>
+  802841:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  802848:	c3                   	ret
+
+0000000000802849 <open>:
+open(const char *path, int mode) {
+  802849:	55                   	push   %rbp
+  80284a:	48 89 e5             	mov    %rsp,%rbp
+  80284d:	41 55                	push   %r13
+  80284f:	41 54                	push   %r12
+  802851:	53                   	push   %rbx
+  802852:	48 83 ec 18          	sub    $0x18,%rsp
+  802856:	49 89 fc             	mov    %rdi,%r12
+  802859:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80285c:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  802863:	00 00 00 
+  802866:	ff d0                	call   *%rax
+  802868:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80286e:	0f 87 8a 00 00 00    	ja     8028fe <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802874:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802878:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  80287f:	00 00 00 
+  802882:	ff d0                	call   *%rax
+  802884:	89 c3                	mov    %eax,%ebx
+  802886:	85 c0                	test   %eax,%eax
+  802888:	78 50                	js     8028da <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80288a:	4c 89 e6             	mov    %r12,%rsi
+  80288d:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802894:	00 00 00 
+  802897:	48 89 df             	mov    %rbx,%rdi
+  80289a:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8028a6:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028ad:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028b6:	48 b8 d4 23 80 00 00 	movabs $0x8023d4,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	89 c3                	mov    %eax,%ebx
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 1f                	js     8028e7 <open+0x9e>
+    return fd2num(fd);
+  8028c8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028cc:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  8028d3:	00 00 00 
+  8028d6:	ff d0                	call   *%rax
+  8028d8:	89 c3                	mov    %eax,%ebx
+}
+  8028da:	89 d8                	mov    %ebx,%eax
+  8028dc:	48 83 c4 18          	add    $0x18,%rsp
+  8028e0:	5b                   	pop    %rbx
+  8028e1:	41 5c                	pop    %r12
+  8028e3:	41 5d                	pop    %r13
+  8028e5:	5d                   	pop    %rbp
+  8028e6:	c3                   	ret
+        fd_close(fd, 0);
+  8028e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028f0:	48 b8 9f 1c 80 00 00 	movabs $0x801c9f,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+        return res;
+  8028fc:	eb dc                	jmp    8028da <open+0x91>
+        return -E_BAD_PATH;
+  8028fe:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802903:	eb d5                	jmp    8028da <open+0x91>
+
+0000000000802905 <sync>:
+sync(void) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802909:	be 00 00 00 00       	mov    $0x0,%esi
+  80290e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802913:	48 b8 d4 23 80 00 00 	movabs $0x8023d4,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+}
+  80291f:	5d                   	pop    %rbp
+  802920:	c3                   	ret
+
+0000000000802921 <drop_cache>:
+drop_cache(int fdnum) {
+  802921:	55                   	push   %rbp
+  802922:	48 89 e5             	mov    %rsp,%rbp
+  802925:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802929:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80292d:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  802934:	00 00 00 
+  802937:	ff d0                	call   *%rax
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 51                	js     80298e <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80293d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802941:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802948:	00 00 00 
+  80294b:	8b 0a                	mov    (%rdx),%ecx
+  80294d:	39 08                	cmp    %ecx,(%rax)
+  80294f:	75 3f                	jne    802990 <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  802951:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802958:	00 
+  802959:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802960:	00 
+  802961:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802968:	00 
+  802969:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802970:	00 
+  802971:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802975:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  802979:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80297d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802982:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+}
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802990:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802995:	eb f7                	jmp    80298e <drop_cache+0x6d>
+
+0000000000802997 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802997:	55                   	push   %rbp
+  802998:	48 89 e5             	mov    %rsp,%rbp
+  80299b:	41 57                	push   %r15
+  80299d:	41 56                	push   %r14
+  80299f:	41 55                	push   %r13
+  8029a1:	41 54                	push   %r12
+  8029a3:	53                   	push   %rbx
+  8029a4:	48 83 ec 58          	sub    $0x58,%rsp
+  8029a8:	41 89 f4             	mov    %esi,%r12d
+  8029ab:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8029af:	49 89 cd             	mov    %rcx,%r13
+  8029b2:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029b5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8029b9:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  8029c0:	00 00 00 
+  8029c3:	ff d0                	call   *%rax
+  8029c5:	48 63 d0             	movslq %eax,%rdx
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	0f 88 36 01 00 00    	js     802b06 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029d0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8029d4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029db:	00 00 00 
+  8029de:	8b 32                	mov    (%rdx),%esi
+  8029e0:	39 31                	cmp    %esi,(%rcx)
+  8029e2:	0f 85 30 01 00 00    	jne    802b18 <read_map+0x181>
+  8029e8:	45 85 e4             	test   %r12d,%r12d
+  8029eb:	0f 88 27 01 00 00    	js     802b18 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8029f1:	49 63 cc             	movslq %r12d,%rcx
+  8029f4:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  8029f8:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8029ff:	0f 85 1c 01 00 00    	jne    802b21 <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802a05:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802a09:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  802a10:	0f 85 14 01 00 00    	jne    802b2a <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a16:	48 63 cb             	movslq %ebx,%rcx
+  802a19:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a1d:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802a24:	00 00 00 
+    while (i < n) {
+  802a27:	4d 85 ed             	test   %r13,%r13
+  802a2a:	75 5c                	jne    802a88 <read_map+0xf1>
+  802a2c:	e9 d2 00 00 00       	jmp    802b03 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  802a31:	41 8b 3e             	mov    (%r14),%edi
+  802a34:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  802a38:	50                   	push   %rax
+  802a39:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  802a3d:	50                   	push   %rax
+  802a3e:	4d 89 f9             	mov    %r15,%r9
+  802a41:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a47:	48 89 d9             	mov    %rbx,%rcx
+  802a4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4f:	be 09 00 00 00       	mov    $0x9,%esi
+  802a54:	48 b8 3a 3f 80 00 00 	movabs $0x803f3a,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  802a60:	48 83 c4 10          	add    $0x10,%rsp
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	0f 8e 8f 00 00 00    	jle    802afb <read_map+0x164>
+        if (!mapped_perm) {
+  802a6c:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  802a70:	0f 84 80 00 00 00    	je     802af6 <read_map+0x15f>
+        i += res;
+  802a76:	48 63 d0             	movslq %eax,%rdx
+  802a79:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  802a7c:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802a81:	75 78                	jne    802afb <read_map+0x164>
+    while (i < n) {
+  802a83:	4d 39 ec             	cmp    %r13,%r12
+  802a86:	73 73                	jae    802afb <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802a88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a8c:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  802a90:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802a94:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802a98:	4c 01 e0             	add    %r12,%rax
+  802a9b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802a9f:	4c 89 eb             	mov    %r13,%rbx
+  802aa2:	4c 29 e3             	sub    %r12,%rbx
+  802aa5:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802aa9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  802ab1:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802ab8:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802abf:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802ac4:	48 39 c3             	cmp    %rax,%rbx
+  802ac7:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802acb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802acf:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ad3:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802ad7:	0f 85 54 ff ff ff    	jne    802a31 <read_map+0x9a>
+  802add:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ae2:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  802ae9:	00 00 00 
+  802aec:	ff d0                	call   *%rax
+  802aee:	41 89 06             	mov    %eax,(%r14)
+  802af1:	e9 3b ff ff ff       	jmp    802a31 <read_map+0x9a>
+            res = -E_INVAL;
+  802af6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802afb:	4c 89 e2             	mov    %r12,%rdx
+  802afe:	4d 85 e4             	test   %r12,%r12
+  802b01:	75 03                	jne    802b06 <read_map+0x16f>
+  802b03:	48 63 d0             	movslq %eax,%rdx
+}
+  802b06:	48 89 d0             	mov    %rdx,%rax
+  802b09:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802b0d:	5b                   	pop    %rbx
+  802b0e:	41 5c                	pop    %r12
+  802b10:	41 5d                	pop    %r13
+  802b12:	41 5e                	pop    %r14
+  802b14:	41 5f                	pop    %r15
+  802b16:	5d                   	pop    %rbp
+  802b17:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802b18:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b1f:	eb e5                	jmp    802b06 <read_map+0x16f>
+  802b21:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b28:	eb dc                	jmp    802b06 <read_map+0x16f>
+  802b2a:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802b31:	eb d3                	jmp    802b06 <read_map+0x16f>
+
+0000000000802b33 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  802b33:	55                   	push   %rbp
+  802b34:	48 89 e5             	mov    %rsp,%rbp
+  802b37:	41 57                	push   %r15
+  802b39:	41 56                	push   %r14
+  802b3b:	41 55                	push   %r13
+  802b3d:	41 54                	push   %r12
+  802b3f:	53                   	push   %rbx
+  802b40:	48 83 ec 38          	sub    $0x38,%rsp
+  802b44:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802b47:	41 89 f6             	mov    %esi,%r14d
+  802b4a:	49 89 d5             	mov    %rdx,%r13
+  802b4d:	89 cb                	mov    %ecx,%ebx
+  802b4f:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b52:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802b56:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  802b5d:	00 00 00 
+  802b60:	ff d0                	call   *%rax
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	0f 88 33 02 00 00    	js     802d9d <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  802b6f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b73:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b7a:	00 00 00 
+  802b7d:	8b 3a                	mov    (%rdx),%edi
+  802b7f:	39 39                	cmp    %edi,(%rcx)
+  802b81:	0f 85 1b 02 00 00    	jne    802da2 <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  802b87:	4d 85 ed             	test   %r13,%r13
+  802b8a:	41 0f 94 c0          	sete   %r8b
+  802b8e:	44 89 f0             	mov    %r14d,%eax
+  802b91:	c1 e8 1f             	shr    $0x1f,%eax
+  802b94:	41 08 c0             	or     %al,%r8b
+  802b97:	0f 85 14 02 00 00    	jne    802db1 <mmap+0x27e>
+  802b9d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802ba4:	0f 85 0e 02 00 00    	jne    802db8 <mmap+0x285>
+  802baa:	83 fb 07             	cmp    $0x7,%ebx
+  802bad:	0f 87 0c 02 00 00    	ja     802dbf <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802bb3:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  802bbd:	83 fa 01             	cmp    $0x1,%edx
+  802bc0:	0f 87 dc 01 00 00    	ja     802da2 <mmap+0x26f>
+  802bc6:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  802bcd:	00 00 00 
+  802bd0:	eb 0e                	jmp    802be0 <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802bd2:	48 83 c0 01          	add    $0x1,%rax
+  802bd6:	48 83 c2 20          	add    $0x20,%rdx
+  802bda:	48 83 f8 40          	cmp    $0x40,%rax
+  802bde:	74 44                	je     802c24 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  802be0:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802be4:	75 ec                	jne    802bd2 <mmap+0x9f>
+  802be6:	48 c1 e0 05          	shl    $0x5,%rax
+  802bea:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802bf1:	00 00 00 
+  802bf4:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802bf8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802bff:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c06:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802c09:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  802c10:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c13:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c18:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  802c1f:	00 00 00 
+  802c22:	eb 17                	jmp    802c3b <mmap+0x108>
+  802c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802c29:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  802c2f:	eb c7                	jmp    802bf8 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c31:	48 83 c0 01          	add    $0x1,%rax
+  802c35:	48 83 f8 3f          	cmp    $0x3f,%rax
+  802c39:	77 37                	ja     802c72 <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802c3b:	48 89 c2             	mov    %rax,%rdx
+  802c3e:	48 c1 e2 05          	shl    $0x5,%rdx
+  802c42:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  802c47:	48 85 d2             	test   %rdx,%rdx
+  802c4a:	74 e5                	je     802c31 <mmap+0xfe>
+  802c4c:	48 89 c7             	mov    %rax,%rdi
+  802c4f:	48 c1 e7 05          	shl    $0x5,%rdi
+  802c53:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  802c57:	48 01 fa             	add    %rdi,%rdx
+  802c5a:	48 39 d6             	cmp    %rdx,%rsi
+  802c5d:	73 d2                	jae    802c31 <mmap+0xfe>
+  802c5f:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  802c63:	4c 39 d7             	cmp    %r10,%rdi
+  802c66:	73 c9                	jae    802c31 <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  802c68:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c70:	eb c9                	jmp    802c3b <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  802c72:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  802c76:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  802c7b:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  802c82:	00 00 00 
+  802c85:	49 39 f9             	cmp    %rdi,%r9
+  802c88:	0f 82 14 01 00 00    	jb     802da2 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802c8e:	48 85 f6             	test   %rsi,%rsi
+  802c91:	0f 84 2f 01 00 00    	je     802dc6 <mmap+0x293>
+  802c97:	45 84 c0             	test   %r8b,%r8b
+  802c9a:	0f 85 26 01 00 00    	jne    802dc6 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802ca0:	41 83 fc 01          	cmp    $0x1,%r12d
+  802ca4:	0f 94 c0             	sete   %al
+  802ca7:	0f b6 c0             	movzbl %al,%eax
+  802caa:	c1 e0 06             	shl    $0x6,%eax
+  802cad:	09 d8                	or     %ebx,%eax
+  802caf:	89 c3                	mov    %eax,%ebx
+  802cb1:	83 cb 04             	or     $0x4,%ebx
+  802cb4:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802cb7:	4d 85 ff             	test   %r15,%r15
+  802cba:	0f 84 bd 00 00 00    	je     802d7d <mmap+0x24a>
+  802cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802cc5:	83 e0 bf             	and    $0xffffffbf,%eax
+  802cc8:	83 c8 04             	or     $0x4,%eax
+  802ccb:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802cce:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802cd2:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802cd6:	49 89 f6             	mov    %rsi,%r14
+  802cd9:	eb 43                	jmp    802d1e <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802cdb:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802ce1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ce7:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802cea:	eb 2d                	jmp    802d19 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802cec:	48 85 c0             	test   %rax,%rax
+  802cef:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802cf4:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802cf8:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802cfb:	4c 89 e2             	mov    %r12,%rdx
+  802cfe:	4c 89 ee             	mov    %r13,%rsi
+  802d01:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d06:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  802d0d:	00 00 00 
+  802d10:	ff d0                	call   *%rax
+  802d12:	85 c0                	test   %eax,%eax
+  802d14:	78 3e                	js     802d54 <mmap+0x221>
+        i += n;
+  802d16:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802d19:	4c 39 fb             	cmp    %r15,%rbx
+  802d1c:	73 54                	jae    802d72 <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802d1e:	4d 89 fc             	mov    %r15,%r12
+  802d21:	49 29 dc             	sub    %rbx,%r12
+  802d24:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802d28:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802d2b:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802d2e:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802d32:	4c 89 e1             	mov    %r12,%rcx
+  802d35:	4c 89 ea             	mov    %r13,%rdx
+  802d38:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802d3b:	48 b8 97 29 80 00 00 	movabs $0x802997,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+        if (res > 0) {
+  802d47:	48 85 c0             	test   %rax,%rax
+  802d4a:	7f 8f                	jg     802cdb <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802d4c:	74 9e                	je     802cec <mmap+0x1b9>
+  802d4e:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802d52:	74 98                	je     802cec <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802d54:	4c 89 f6             	mov    %r14,%rsi
+  802d57:	4c 89 fa             	mov    %r15,%rdx
+  802d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d5f:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+    return NULL;
+  802d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d70:	eb 30                	jmp    802da2 <mmap+0x26f>
+  802d72:	4c 89 f6             	mov    %r14,%rsi
+  802d75:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d79:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802d7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d81:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d84:	48 89 31             	mov    %rsi,(%rcx)
+  802d87:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802d8b:	89 41 10             	mov    %eax,0x10(%rcx)
+  802d8e:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802d92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d95:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802d98:	48 89 f0             	mov    %rsi,%rax
+  802d9b:	eb 05                	jmp    802da2 <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da2:	48 83 c4 38          	add    $0x38,%rsp
+  802da6:	5b                   	pop    %rbx
+  802da7:	41 5c                	pop    %r12
+  802da9:	41 5d                	pop    %r13
+  802dab:	41 5e                	pop    %r14
+  802dad:	41 5f                	pop    %r15
+  802daf:	5d                   	pop    %rbp
+  802db0:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db6:	eb ea                	jmp    802da2 <mmap+0x26f>
+  802db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbd:	eb e3                	jmp    802da2 <mmap+0x26f>
+  802dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc4:	eb dc                	jmp    802da2 <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcb:	eb d5                	jmp    802da2 <mmap+0x26f>
+
+0000000000802dcd <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802dcd:	55                   	push   %rbp
+  802dce:	48 89 e5             	mov    %rsp,%rbp
+  802dd1:	41 57                	push   %r15
+  802dd3:	41 56                	push   %r14
+  802dd5:	41 55                	push   %r13
+  802dd7:	41 54                	push   %r12
+  802dd9:	53                   	push   %rbx
+  802dda:	48 83 ec 38          	sub    $0x38,%rsp
+  802dde:	49 89 fc             	mov    %rdi,%r12
+  802de1:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802de4:	48 b8 93 22 80 00 00 	movabs $0x802293,%rax
+  802deb:	00 00 00 
+  802dee:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802df0:	48 85 c0             	test   %rax,%rax
+  802df3:	0f 84 2f 01 00 00    	je     802f28 <msync+0x15b>
+  802df9:	49 89 c7             	mov    %rax,%r15
+  802dfc:	4d 01 e5             	add    %r12,%r13
+  802dff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e03:	49 03 07             	add    (%r15),%rax
+  802e06:	4c 39 e8             	cmp    %r13,%rax
+  802e09:	0f 82 20 01 00 00    	jb     802f2f <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802e0f:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802e13:	83 e0 40             	and    $0x40,%eax
+  802e16:	0f 84 fd 00 00 00    	je     802f19 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802e1c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802e23:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802e2a:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802e31:	4d 39 ec             	cmp    %r13,%r12
+  802e34:	0f 83 fc 00 00 00    	jae    802f36 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802e3a:	49 be 65 38 80 00 00 	movabs $0x803865,%r14
+  802e41:	00 00 00 
+  802e44:	e9 b0 00 00 00       	jmp    802ef9 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802e49:	4c 89 e3             	mov    %r12,%rbx
+  802e4c:	4d 39 ec             	cmp    %r13,%r12
+  802e4f:	73 16                	jae    802e67 <msync+0x9a>
+  802e51:	48 89 df             	mov    %rbx,%rdi
+  802e54:	41 ff d6             	call   *%r14
+  802e57:	84 c0                	test   %al,%al
+  802e59:	74 0c                	je     802e67 <msync+0x9a>
+  802e5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e62:	4c 39 eb             	cmp    %r13,%rbx
+  802e65:	72 ea                	jb     802e51 <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802e67:	48 89 d8             	mov    %rbx,%rax
+  802e6a:	4c 29 e0             	sub    %r12,%rax
+  802e6d:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802e71:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802e75:	49 89 c0             	mov    %rax,%r8
+  802e78:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e81:	48 89 ce             	mov    %rcx,%rsi
+  802e84:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e89:	49 ba 7b 14 80 00 00 	movabs $0x80147b,%r10
+  802e90:	00 00 00 
+  802e93:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	78 7f                	js     802f19 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802e9a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802ea1:	00 
+  802ea2:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ea9:	00 
+  802eaa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802eb1:	00 
+  802eb2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802eb9:	00 
+  802eba:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802ebe:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ec2:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802ec6:	49 2b 07             	sub    (%r15),%rax
+  802ec9:	4c 01 e0             	add    %r12,%rax
+  802ecc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ed0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ed4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802ed8:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802edc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ee1:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	78 28                	js     802f19 <msync+0x14c>
+  802ef1:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802ef4:	4d 39 ec             	cmp    %r13,%r12
+  802ef7:	73 1b                	jae    802f14 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802ef9:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802efd:	4c 89 e7             	mov    %r12,%rdi
+  802f00:	41 ff d6             	call   *%r14
+  802f03:	84 c0                	test   %al,%al
+  802f05:	0f 85 3e ff ff ff    	jne    802e49 <msync+0x7c>
+            va += PAGE_SIZE;
+  802f0b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802f12:	eb e0                	jmp    802ef4 <msync+0x127>
+    }
+
+    return 0;
+  802f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f19:	48 83 c4 38          	add    $0x38,%rsp
+  802f1d:	5b                   	pop    %rbx
+  802f1e:	41 5c                	pop    %r12
+  802f20:	41 5d                	pop    %r13
+  802f22:	41 5e                	pop    %r14
+  802f24:	41 5f                	pop    %r15
+  802f26:	5d                   	pop    %rbp
+  802f27:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802f28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f2d:	eb ea                	jmp    802f19 <msync+0x14c>
+  802f2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f34:	eb e3                	jmp    802f19 <msync+0x14c>
+    return 0;
+  802f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3b:	eb dc                	jmp    802f19 <msync+0x14c>
+
+0000000000802f3d <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802f3d:	55                   	push   %rbp
+  802f3e:	48 89 e5             	mov    %rsp,%rbp
+  802f41:	41 55                	push   %r13
+  802f43:	41 54                	push   %r12
+  802f45:	53                   	push   %rbx
+  802f46:	48 83 ec 08          	sub    $0x8,%rsp
+  802f4a:	49 89 fc             	mov    %rdi,%r12
+  802f4d:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802f50:	48 b8 93 22 80 00 00 	movabs $0x802293,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802f5c:	48 85 c0             	test   %rax,%rax
+  802f5f:	74 58                	je     802fb9 <munmap+0x7c>
+  802f61:	48 89 c3             	mov    %rax,%rbx
+  802f64:	4c 3b 20             	cmp    (%rax),%r12
+  802f67:	75 57                	jne    802fc0 <munmap+0x83>
+  802f69:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802f70:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f76:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802f7a:	75 4b                	jne    802fc7 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802f7c:	4c 89 ee             	mov    %r13,%rsi
+  802f7f:	4c 89 e7             	mov    %r12,%rdi
+  802f82:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802f8e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802f92:	4c 89 e6             	mov    %r12,%rsi
+  802f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9a:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802fa6:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802fad:	00 
+    return res;
+}
+  802fae:	48 83 c4 08          	add    $0x8,%rsp
+  802fb2:	5b                   	pop    %rbx
+  802fb3:	41 5c                	pop    %r12
+  802fb5:	41 5d                	pop    %r13
+  802fb7:	5d                   	pop    %rbp
+  802fb8:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802fb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fbe:	eb ee                	jmp    802fae <munmap+0x71>
+  802fc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fc5:	eb e7                	jmp    802fae <munmap+0x71>
+  802fc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fcc:	eb e0                	jmp    802fae <munmap+0x71>
+
+0000000000802fce <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802fce:	55                   	push   %rbp
+  802fcf:	48 89 e5             	mov    %rsp,%rbp
+  802fd2:	41 54                	push   %r12
+  802fd4:	53                   	push   %rbx
+  802fd5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802fd8:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802fe7:	48 be 80 56 80 00 00 	movabs $0x805680,%rsi
+  802fee:	00 00 00 
+  802ff1:	48 89 df             	mov    %rbx,%rdi
+  802ff4:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803000:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  803005:	41 8b 14 24          	mov    (%r12),%edx
+  803009:	29 d0                	sub    %edx,%eax
+  80300b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803011:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803018:	00 00 00 
+    stat->st_dev = &devpipe;
+  80301b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803022:	00 00 00 
+  803025:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80302c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803031:	5b                   	pop    %rbx
+  803032:	41 5c                	pop    %r12
+  803034:	5d                   	pop    %rbp
+  803035:	c3                   	ret
+
+0000000000803036 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803036:	55                   	push   %rbp
+  803037:	48 89 e5             	mov    %rsp,%rbp
+  80303a:	41 55                	push   %r13
+  80303c:	41 54                	push   %r12
+  80303e:	53                   	push   %rbx
+  80303f:	48 83 ec 08          	sub    $0x8,%rsp
+  803043:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803046:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803055:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80305a:	4c 89 e6             	mov    %r12,%rsi
+  80305d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803062:	49 bc 48 15 80 00 00 	movabs $0x801548,%r12
+  803069:	00 00 00 
+  80306c:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80306f:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  803075:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  80307c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803081:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  803084:	be 00 04 00 00       	mov    $0x400,%esi
+  803089:	48 89 df             	mov    %rbx,%rdi
+  80308c:	49 bd c2 1a 80 00 00 	movabs $0x801ac2,%r13
+  803093:	00 00 00 
+  803096:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  803099:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  80309d:	be 00 04 00 00       	mov    $0x400,%esi
+  8030a2:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8030a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030aa:	48 89 de             	mov    %rbx,%rsi
+  8030ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b2:	41 ff d4             	call   *%r12
+}
+  8030b5:	48 83 c4 08          	add    $0x8,%rsp
+  8030b9:	5b                   	pop    %rbx
+  8030ba:	41 5c                	pop    %r12
+  8030bc:	41 5d                	pop    %r13
+  8030be:	5d                   	pop    %rbp
+  8030bf:	c3                   	ret
+
+00000000008030c0 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8030c0:	55                   	push   %rbp
+  8030c1:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030c4:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030ca:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  8030d1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030d6:	48 b8 e8 13 80 00 00 	movabs $0x8013e8,%rax
+  8030dd:	00 00 00 
+  8030e0:	ff d0                	call   *%rax
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	0f 94 c0             	sete   %al
+  8030e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8030ea:	5d                   	pop    %rbp
+  8030eb:	c3                   	ret
+
+00000000008030ec <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  8030ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030f1:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  8030f3:	8b 07                	mov    (%rdi),%eax
+  8030f5:	39 f0                	cmp    %esi,%eax
+  8030f7:	74 01                	je     8030fa <pipe_wait+0xe>
+  8030f9:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  8030fa:	55                   	push   %rbp
+  8030fb:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8030fe:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803100:	48 c1 e2 20          	shl    $0x20,%rdx
+  803104:	89 c0                	mov    %eax,%eax
+  803106:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  803109:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  803110:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  803117:	00 00 00 
+  80311a:	ff d0                	call   *%rax
+}
+  80311c:	5d                   	pop    %rbp
+  80311d:	c3                   	ret
+
+000000000080311e <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  80311e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803123:	87 06                	xchg   %eax,(%rsi)
+  803125:	85 c0                	test   %eax,%eax
+  803127:	75 01                	jne    80312a <pipe_wake+0xc>
+  803129:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  80312a:	55                   	push   %rbp
+  80312b:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  80312e:	be 00 04 00 00       	mov    $0x400,%esi
+  803133:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  80313a:	00 00 00 
+  80313d:	ff d0                	call   *%rax
+}
+  80313f:	5d                   	pop    %rbp
+  803140:	c3                   	ret
+
+0000000000803141 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803141:	55                   	push   %rbp
+  803142:	48 89 e5             	mov    %rsp,%rbp
+  803145:	41 57                	push   %r15
+  803147:	41 56                	push   %r14
+  803149:	41 55                	push   %r13
+  80314b:	41 54                	push   %r12
+  80314d:	53                   	push   %rbx
+  80314e:	48 83 ec 28          	sub    $0x28,%rsp
+  803152:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803156:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80315a:	48 89 d3             	mov    %rdx,%rbx
+  80315d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803161:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  80316d:	48 85 db             	test   %rbx,%rbx
+  803170:	0f 84 0f 01 00 00    	je     803285 <devpipe_write+0x144>
+  803176:	49 89 c4             	mov    %rax,%r12
+  803179:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  80317f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803186:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80318a:	eb 4f                	jmp    8031db <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  80318c:	4c 89 e6             	mov    %r12,%rsi
+  80318f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803193:	48 b8 c0 30 80 00 00 	movabs $0x8030c0,%rax
+  80319a:	00 00 00 
+  80319d:	ff d0                	call   *%rax
+  80319f:	85 c0                	test   %eax,%eax
+  8031a1:	74 14                	je     8031b7 <devpipe_write+0x76>
+  8031a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031a8:	48 83 c4 28          	add    $0x28,%rsp
+  8031ac:	5b                   	pop    %rbx
+  8031ad:	41 5c                	pop    %r12
+  8031af:	41 5d                	pop    %r13
+  8031b1:	41 5e                	pop    %r14
+  8031b3:	41 5f                	pop    %r15
+  8031b5:	5d                   	pop    %rbp
+  8031b6:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  8031b7:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  8031bc:	44 89 ee             	mov    %r13d,%esi
+  8031bf:	4c 89 e7             	mov    %r12,%rdi
+  8031c2:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  8031c9:	00 00 00 
+  8031cc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  8031ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d2:	49 39 c7             	cmp    %rax,%r15
+  8031d5:	0f 83 aa 00 00 00    	jae    803285 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  8031db:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  8031e0:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  8031e4:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  8031eb:	00 
+  8031ec:	44 89 f0             	mov    %r14d,%eax
+  8031ef:	44 29 e8             	sub    %r13d,%eax
+  8031f2:	39 d8                	cmp    %ebx,%eax
+  8031f4:	74 96                	je     80318c <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  8031f6:	89 d8                	mov    %ebx,%eax
+  8031f8:	44 29 f0             	sub    %r14d,%eax
+  8031fb:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  8031ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803203:	4c 29 f8             	sub    %r15,%rax
+  803206:	49 39 c5             	cmp    %rax,%r13
+  803209:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  80320d:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  803210:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  803213:	89 db                	mov    %ebx,%ebx
+  803215:	48 29 c3             	sub    %rax,%rbx
+  803218:	4c 39 eb             	cmp    %r13,%rbx
+  80321b:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  80321f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803223:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  803227:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80322e:	00 
+  80322f:	48 89 da             	mov    %rbx,%rdx
+  803232:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  80323e:	4c 89 ea             	mov    %r13,%rdx
+  803241:	48 29 da             	sub    %rbx,%rdx
+  803244:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  803248:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80324c:	48 01 ce             	add    %rcx,%rsi
+  80324f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803253:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  80325f:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  803264:	45 01 ee             	add    %r13d,%r14d
+  803267:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  80326c:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  803271:	48 b8 1e 31 80 00 00 	movabs $0x80311e,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+        i += chunk;
+  80327d:	4d 01 ef             	add    %r13,%r15
+  803280:	e9 49 ff ff ff       	jmp    8031ce <devpipe_write+0x8d>
+    return n;
+  803285:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803289:	e9 1a ff ff ff       	jmp    8031a8 <devpipe_write+0x67>
+
+000000000080328e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80328e:	55                   	push   %rbp
+  80328f:	48 89 e5             	mov    %rsp,%rbp
+  803292:	41 57                	push   %r15
+  803294:	41 56                	push   %r14
+  803296:	41 55                	push   %r13
+  803298:	41 54                	push   %r12
+  80329a:	53                   	push   %rbx
+  80329b:	48 83 ec 28          	sub    $0x28,%rsp
+  80329f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8032a3:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8032a7:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032ab:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  8032b2:	00 00 00 
+  8032b5:	ff d0                	call   *%rax
+  8032b7:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032ba:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  8032be:	49 bf c0 30 80 00 00 	movabs $0x8030c0,%r15
+  8032c5:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8032c8:	48 8d 40 04          	lea    0x4(%rax),%rax
+  8032cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d0:	eb 15                	jmp    8032e7 <devpipe_read+0x59>
+  8032d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032d6:	89 de                	mov    %ebx,%esi
+  8032d8:	4c 89 f7             	mov    %r14,%rdi
+  8032db:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  8032e2:	00 00 00 
+  8032e5:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  8032e7:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  8032eb:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  8032ee:	41 39 dd             	cmp    %ebx,%r13d
+  8032f1:	75 15                	jne    803308 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  8032f3:	4c 89 e6             	mov    %r12,%rsi
+  8032f6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032fa:	41 ff d7             	call   *%r15
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	74 d1                	je     8032d2 <devpipe_read+0x44>
+  803301:	b8 00 00 00 00       	mov    $0x0,%eax
+  803306:	eb 7c                	jmp    803384 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803308:	44 29 eb             	sub    %r13d,%ebx
+  80330b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80330f:	48 39 c3             	cmp    %rax,%rbx
+  803312:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803316:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80331d:	00 
+  80331e:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  803322:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803325:	45 89 f6             	mov    %r14d,%r14d
+  803328:	49 29 c6             	sub    %rax,%r14
+  80332b:	49 39 de             	cmp    %rbx,%r14
+  80332e:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  803332:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  803339:	00 
+  80333a:	4c 89 f2             	mov    %r14,%rdx
+  80333d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803341:	49 bf c5 10 80 00 00 	movabs $0x8010c5,%r15
+  803348:	00 00 00 
+  80334b:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80334e:	48 89 da             	mov    %rbx,%rdx
+  803351:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  803354:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80335b:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  80335c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803360:	4c 01 f7             	add    %r14,%rdi
+  803363:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  803366:	41 01 dd             	add    %ebx,%r13d
+  803369:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  80336d:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  803372:	4c 89 e7             	mov    %r12,%rdi
+  803375:	48 b8 1e 31 80 00 00 	movabs $0x80311e,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+    return n;
+  803381:	48 89 d8             	mov    %rbx,%rax
+}
+  803384:	48 83 c4 28          	add    $0x28,%rsp
+  803388:	5b                   	pop    %rbx
+  803389:	41 5c                	pop    %r12
+  80338b:	41 5d                	pop    %r13
+  80338d:	41 5e                	pop    %r14
+  80338f:	41 5f                	pop    %r15
+  803391:	5d                   	pop    %rbp
+  803392:	c3                   	ret
+
+0000000000803393 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803393:	55                   	push   %rbp
+  803394:	48 89 e5             	mov    %rsp,%rbp
+  803397:	41 57                	push   %r15
+  803399:	41 56                	push   %r14
+  80339b:	41 55                	push   %r13
+  80339d:	41 54                	push   %r12
+  80339f:	53                   	push   %rbx
+  8033a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8033a4:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  8033a7:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  8033ae:	0f 86 96 01 00 00    	jbe    80354a <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  8033b4:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  8033b9:	48 01 db             	add    %rbx,%rbx
+  8033bc:	48 39 f3             	cmp    %rsi,%rbx
+  8033bf:	72 f8                	jb     8033b9 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8033c1:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  8033c8:	0f 87 18 02 00 00    	ja     8035e6 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033ce:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8033d2:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8033d9:	00 00 00 
+  8033dc:	ff d0                	call   *%rax
+  8033de:	41 89 c4             	mov    %eax,%r12d
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	0f 88 b6 01 00 00    	js     80359f <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033e9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8033f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fc:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+  803408:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80340b:	85 c0                	test   %eax,%eax
+  80340d:	0f 88 8c 01 00 00    	js     80359f <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803413:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803417:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  80341e:	00 00 00 
+  803421:	ff d0                	call   *%rax
+  803423:	41 89 c4             	mov    %eax,%r12d
+  803426:	85 c0                	test   %eax,%eax
+  803428:	0f 88 57 01 00 00    	js     803585 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80342e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803433:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803438:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80343c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803441:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  803448:	00 00 00 
+  80344b:	ff d0                	call   *%rax
+  80344d:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803450:	85 c0                	test   %eax,%eax
+  803452:	0f 88 2d 01 00 00    	js     803585 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  803458:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80345c:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  803463:	00 00 00 
+  803466:	ff d0                	call   *%rax
+  803468:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80346b:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  803472:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803477:	4c 89 fa             	mov    %r15,%rdx
+  80347a:	48 89 c6             	mov    %rax,%rsi
+  80347d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803482:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+  80348e:	41 89 c4             	mov    %eax,%r12d
+  803491:	85 c0                	test   %eax,%eax
+  803493:	0f 88 d2 00 00 00    	js     80356b <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803499:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8034a0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8034a4:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  8034ab:	00 00 00 
+  8034ae:	ff d0                	call   *%rax
+  8034b0:	48 89 c1             	mov    %rax,%rcx
+  8034b3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8034b9:	4d 89 f8             	mov    %r15,%r8
+  8034bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c1:	4c 89 f6             	mov    %r14,%rsi
+  8034c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c9:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  8034d0:	00 00 00 
+  8034d3:	ff d0                	call   *%rax
+  8034d5:	41 89 c4             	mov    %eax,%r12d
+  8034d8:	85 c0                	test   %eax,%eax
+  8034da:	78 78                	js     803554 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034dc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8034e1:	4c 89 f7             	mov    %r14,%rdi
+  8034e4:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  8034eb:	00 00 00 
+  8034ee:	ff d0                	call   *%rax
+  8034f0:	83 f8 02             	cmp    $0x2,%eax
+  8034f3:	0f 85 b8 00 00 00    	jne    8035b1 <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034f9:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803500:	00 00 
+  803502:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803506:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803508:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80350c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803513:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803517:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803519:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80351d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803524:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803528:	48 bb 51 1b 80 00 00 	movabs $0x801b51,%rbx
+  80352f:	00 00 00 
+  803532:	ff d3                	call   *%rbx
+  803534:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  803538:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80353c:	ff d3                	call   *%rbx
+  80353e:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  803542:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803548:	eb 55                	jmp    80359f <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  80354a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80354f:	e9 7a fe ff ff       	jmp    8033ce <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  803554:	4c 89 fa             	mov    %r15,%rdx
+  803557:	4c 89 f6             	mov    %r14,%rsi
+  80355a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355f:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80356b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803570:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803574:	bf 00 00 00 00       	mov    $0x0,%edi
+  803579:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  803580:	00 00 00 
+  803583:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803585:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80358a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80358e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803593:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+}
+  80359f:	44 89 e0             	mov    %r12d,%eax
+  8035a2:	48 83 c4 18          	add    $0x18,%rsp
+  8035a6:	5b                   	pop    %rbx
+  8035a7:	41 5c                	pop    %r12
+  8035a9:	41 5d                	pop    %r13
+  8035ab:	41 5e                	pop    %r14
+  8035ad:	41 5f                	pop    %r15
+  8035af:	5d                   	pop    %rbp
+  8035b0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035b1:	48 b9 b0 56 80 00 00 	movabs $0x8056b0,%rcx
+  8035b8:	00 00 00 
+  8035bb:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  8035c2:	00 00 00 
+  8035c5:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8035ca:	48 bf 9c 56 80 00 00 	movabs $0x80569c,%rdi
+  8035d1:	00 00 00 
+  8035d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d9:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  8035e0:	00 00 00 
+  8035e3:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  8035e6:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8035ec:	eb b1                	jmp    80359f <pipe_sized+0x20c>
+
+00000000008035ee <pipe>:
+pipe(int pfd[2]) {
+  8035ee:	55                   	push   %rbp
+  8035ef:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  8035f2:	be 00 00 01 00       	mov    $0x10000,%esi
+  8035f7:	48 b8 93 33 80 00 00 	movabs $0x803393,%rax
+  8035fe:	00 00 00 
+  803601:	ff d0                	call   *%rax
+}
+  803603:	5d                   	pop    %rbp
+  803604:	c3                   	ret
+
+0000000000803605 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803605:	55                   	push   %rbp
+  803606:	48 89 e5             	mov    %rsp,%rbp
+  803609:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80360d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803611:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  803618:	00 00 00 
+  80361b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	78 23                	js     803644 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803621:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803625:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  80362c:	00 00 00 
+  80362f:	ff d0                	call   *%rax
+  803631:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803634:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803638:	48 b8 c0 30 80 00 00 	movabs $0x8030c0,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+}
+  803644:	c9                   	leave
+  803645:	c3                   	ret
+
+0000000000803646 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803646:	48 89 f8             	mov    %rdi,%rax
+  803649:	48 c1 e8 27          	shr    $0x27,%rax
+  80364d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803654:	7f 00 00 
+  803657:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80365b:	f6 c2 01             	test   $0x1,%dl
+  80365e:	74 6d                	je     8036cd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803660:	48 89 f8             	mov    %rdi,%rax
+  803663:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803667:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80366e:	7f 00 00 
+  803671:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803675:	f6 c2 01             	test   $0x1,%dl
+  803678:	74 62                	je     8036dc <get_uvpt_entry+0x96>
+  80367a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803681:	7f 00 00 
+  803684:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803688:	f6 c2 80             	test   $0x80,%dl
+  80368b:	75 4f                	jne    8036dc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80368d:	48 89 f8             	mov    %rdi,%rax
+  803690:	48 c1 e8 15          	shr    $0x15,%rax
+  803694:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80369b:	7f 00 00 
+  80369e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036a2:	f6 c2 01             	test   $0x1,%dl
+  8036a5:	74 44                	je     8036eb <get_uvpt_entry+0xa5>
+  8036a7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036ae:	7f 00 00 
+  8036b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036b5:	f6 c2 80             	test   $0x80,%dl
+  8036b8:	75 31                	jne    8036eb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8036ba:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8036be:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8036c5:	7f 00 00 
+  8036c8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8036cc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8036cd:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8036d4:	7f 00 00 
+  8036d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036db:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036dc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036e3:	7f 00 00 
+  8036e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036ea:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036eb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036f2:	7f 00 00 
+  8036f5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8036f9:	c3                   	ret
+
+00000000008036fa <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8036fa:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8036fd:	48 89 f9             	mov    %rdi,%rcx
+  803700:	48 c1 e9 27          	shr    $0x27,%rcx
+  803704:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80370b:	7f 00 00 
+  80370e:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803712:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803719:	f6 c1 01             	test   $0x1,%cl
+  80371c:	0f 84 b2 00 00 00    	je     8037d4 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803722:	48 89 f9             	mov    %rdi,%rcx
+  803725:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803729:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803730:	7f 00 00 
+  803733:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803737:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80373e:	40 f6 c6 01          	test   $0x1,%sil
+  803742:	0f 84 8c 00 00 00    	je     8037d4 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803748:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80374f:	7f 00 00 
+  803752:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803756:	a8 80                	test   $0x80,%al
+  803758:	75 7b                	jne    8037d5 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80375a:	48 89 f9             	mov    %rdi,%rcx
+  80375d:	48 c1 e9 15          	shr    $0x15,%rcx
+  803761:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803768:	7f 00 00 
+  80376b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80376f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803776:	40 f6 c6 01          	test   $0x1,%sil
+  80377a:	74 58                	je     8037d4 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80377c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803783:	7f 00 00 
+  803786:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80378a:	a8 80                	test   $0x80,%al
+  80378c:	75 6c                	jne    8037fa <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80378e:	48 89 f9             	mov    %rdi,%rcx
+  803791:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803795:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80379c:	7f 00 00 
+  80379f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037a3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037aa:	40 f6 c6 01          	test   $0x1,%sil
+  8037ae:	74 24                	je     8037d4 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8037b0:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037b7:	7f 00 00 
+  8037ba:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037be:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037c5:	ff ff 7f 
+  8037c8:	48 21 c8             	and    %rcx,%rax
+  8037cb:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8037d1:	48 09 d0             	or     %rdx,%rax
+}
+  8037d4:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8037d5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8037dc:	7f 00 00 
+  8037df:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037e3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037ea:	ff ff 7f 
+  8037ed:	48 21 c8             	and    %rcx,%rax
+  8037f0:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8037f6:	48 01 d0             	add    %rdx,%rax
+  8037f9:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8037fa:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803801:	7f 00 00 
+  803804:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803808:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80380f:	ff ff 7f 
+  803812:	48 21 c8             	and    %rcx,%rax
+  803815:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80381b:	48 01 d0             	add    %rdx,%rax
+  80381e:	c3                   	ret
+
+000000000080381f <get_prot>:
+
+int
+get_prot(void *va) {
+  80381f:	55                   	push   %rbp
+  803820:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803823:	48 b8 46 36 80 00 00 	movabs $0x803646,%rax
+  80382a:	00 00 00 
+  80382d:	ff d0                	call   *%rax
+  80382f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803832:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803837:	89 c1                	mov    %eax,%ecx
+  803839:	83 c9 04             	or     $0x4,%ecx
+  80383c:	f6 c2 01             	test   $0x1,%dl
+  80383f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803842:	89 c1                	mov    %eax,%ecx
+  803844:	83 c9 02             	or     $0x2,%ecx
+  803847:	f6 c2 02             	test   $0x2,%dl
+  80384a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80384d:	89 c1                	mov    %eax,%ecx
+  80384f:	83 c9 01             	or     $0x1,%ecx
+  803852:	48 85 d2             	test   %rdx,%rdx
+  803855:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803858:	89 c1                	mov    %eax,%ecx
+  80385a:	83 c9 40             	or     $0x40,%ecx
+  80385d:	f6 c6 04             	test   $0x4,%dh
+  803860:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803863:	5d                   	pop    %rbp
+  803864:	c3                   	ret
+
+0000000000803865 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803865:	55                   	push   %rbp
+  803866:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803869:	48 b8 46 36 80 00 00 	movabs $0x803646,%rax
+  803870:	00 00 00 
+  803873:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803875:	48 c1 e8 06          	shr    $0x6,%rax
+  803879:	83 e0 01             	and    $0x1,%eax
+}
+  80387c:	5d                   	pop    %rbp
+  80387d:	c3                   	ret
+
+000000000080387e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80387e:	55                   	push   %rbp
+  80387f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803882:	48 b8 46 36 80 00 00 	movabs $0x803646,%rax
+  803889:	00 00 00 
+  80388c:	ff d0                	call   *%rax
+  80388e:	83 e0 01             	and    $0x1,%eax
+}
+  803891:	5d                   	pop    %rbp
+  803892:	c3                   	ret
+
+0000000000803893 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803893:	55                   	push   %rbp
+  803894:	48 89 e5             	mov    %rsp,%rbp
+  803897:	41 57                	push   %r15
+  803899:	41 56                	push   %r14
+  80389b:	41 55                	push   %r13
+  80389d:	41 54                	push   %r12
+  80389f:	53                   	push   %rbx
+  8038a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8038a8:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  8038ac:	48 39 f7             	cmp    %rsi,%rdi
+  8038af:	0f 83 e4 00 00 00    	jae    803999 <foreach_present_page+0x106>
+  8038b5:	49 89 f4             	mov    %rsi,%r12
+  8038b8:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  8038bb:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  8038c2:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038c5:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  8038cc:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  8038cf:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  8038d6:	7f 00 00 
+  8038d9:	eb 27                	jmp    803902 <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  8038db:	48 89 d8             	mov    %rbx,%rax
+  8038de:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038e2:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  8038e6:	f6 c2 01             	test   $0x1,%dl
+  8038e9:	75 43                	jne    80392e <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  8038eb:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  8038f2:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  8038f9:	4c 39 e3             	cmp    %r12,%rbx
+  8038fc:	0f 83 83 00 00 00    	jae    803985 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803902:	48 89 d8             	mov    %rbx,%rax
+  803905:	48 c1 e8 27          	shr    $0x27,%rax
+  803909:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80390e:	a8 01                	test   $0x1,%al
+  803910:	75 c9                	jne    8038db <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  803912:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803919:	ff ff ff 
+  80391c:	48 21 d8             	and    %rbx,%rax
+  80391f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803926:	00 00 00 
+  803929:	48 01 c3             	add    %rax,%rbx
+  80392c:	eb cb                	jmp    8038f9 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80392e:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  803932:	a8 80                	test   $0x80,%al
+  803934:	75 1f                	jne    803955 <foreach_present_page+0xc2>
+  803936:	48 89 d8             	mov    %rbx,%rax
+  803939:	48 c1 e8 15          	shr    $0x15,%rax
+  80393d:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  803941:	a8 01                	test   $0x1,%al
+  803943:	75 10                	jne    803955 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  803945:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  80394c:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  803953:	eb a4                	jmp    8038f9 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  803955:	48 89 df             	mov    %rbx,%rdi
+  803958:	48 b8 46 36 80 00 00 	movabs $0x803646,%rax
+  80395f:	00 00 00 
+  803962:	ff d0                	call   *%rax
+  803964:	a8 01                	test   $0x1,%al
+  803966:	74 11                	je     803979 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  803968:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80396c:	48 89 df             	mov    %rbx,%rdi
+  80396f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803973:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  803975:	85 c0                	test   %eax,%eax
+  803977:	78 11                	js     80398a <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  803979:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803980:	e9 74 ff ff ff       	jmp    8038f9 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  803985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80398a:	48 83 c4 18          	add    $0x18,%rsp
+  80398e:	5b                   	pop    %rbx
+  80398f:	41 5c                	pop    %r12
+  803991:	41 5d                	pop    %r13
+  803993:	41 5e                	pop    %r14
+  803995:	41 5f                	pop    %r15
+  803997:	5d                   	pop    %rbp
+  803998:	c3                   	ret
+    return 0;
+  803999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399e:	eb ea                	jmp    80398a <foreach_present_page+0xf7>
+
+00000000008039a0 <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  8039a0:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8039a7:	7f 00 00 
+  8039aa:	a8 01                	test   $0x1,%al
+  8039ac:	75 06                	jne    8039b4 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  8039ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b3:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8039b4:	55                   	push   %rbp
+  8039b5:	48 89 e5             	mov    %rsp,%rbp
+  8039b8:	41 57                	push   %r15
+  8039ba:	41 56                	push   %r14
+  8039bc:	41 55                	push   %r13
+  8039be:	41 54                	push   %r12
+  8039c0:	53                   	push   %rbx
+  8039c1:	48 83 ec 28          	sub    $0x28,%rsp
+  8039c5:	49 89 fe             	mov    %rdi,%r14
+  8039c8:	49 89 f7             	mov    %rsi,%r15
+  8039cb:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8039d2:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039d3:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  8039da:	7f 00 00 
+  8039dd:	e9 b0 00 00 00       	jmp    803a92 <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8039e2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039e9:	49 83 ec 01          	sub    $0x1,%r12
+  8039ed:	74 2d                	je     803a1c <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  8039ef:	48 89 d8             	mov    %rbx,%rax
+  8039f2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039f6:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8039fb:	f6 c2 01             	test   $0x1,%dl
+  8039fe:	74 e2                	je     8039e2 <foreach_shared_region+0x42>
+  803a00:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803a05:	f6 c4 04             	test   $0x4,%ah
+  803a08:	74 d8                	je     8039e2 <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803a0a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803a11:	4c 89 fa             	mov    %r15,%rdx
+  803a14:	48 89 df             	mov    %rbx,%rdi
+  803a17:	41 ff d6             	call   *%r14
+  803a1a:	eb c6                	jmp    8039e2 <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803a1c:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a23:	00 
+  803a24:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803a29:	74 4c                	je     803a77 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803a2b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803a2f:	48 89 c8             	mov    %rcx,%rax
+  803a32:	48 c1 e8 15          	shr    $0x15,%rax
+  803a36:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  803a3d:	7f 00 00 
+  803a40:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803a44:	a8 01                	test   $0x1,%al
+  803a46:	74 d4                	je     803a1c <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  803a48:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  803a4f:	48 39 c1             	cmp    %rax,%rcx
+  803a52:	73 c8                	jae    803a1c <foreach_shared_region+0x7c>
+  803a54:	48 89 cb             	mov    %rcx,%rbx
+  803a57:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  803a5e:	48 39 d0             	cmp    %rdx,%rax
+  803a61:	4d 19 e4             	sbb    %r12,%r12
+  803a64:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803a6b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803a72:	e9 78 ff ff ff       	jmp    8039ef <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  803a77:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803a7e:	40 
+  803a7f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a83:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a8a:	00 00 00 
+  803a8d:	48 39 c1             	cmp    %rax,%rcx
+  803a90:	74 4f                	je     803ae1 <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  803a92:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a96:	48 89 c8             	mov    %rcx,%rax
+  803a99:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a9d:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803aa4:	7f 00 00 
+  803aa7:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803aab:	a8 01                	test   $0x1,%al
+  803aad:	74 c8                	je     803a77 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803aaf:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803ab6:	48 39 c1             	cmp    %rax,%rcx
+  803ab9:	73 bc                	jae    803a77 <foreach_shared_region+0xd7>
+  803abb:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803ac2:	48 39 d0             	cmp    %rdx,%rax
+  803ac5:	48 19 c0             	sbb    %rax,%rax
+  803ac8:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803ace:	48 05 00 02 00 00    	add    $0x200,%rax
+  803ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ad8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803adc:	e9 4a ff ff ff       	jmp    803a2b <foreach_shared_region+0x8b>
+}
+  803ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae6:	48 83 c4 28          	add    $0x28,%rsp
+  803aea:	5b                   	pop    %rbx
+  803aeb:	41 5c                	pop    %r12
+  803aed:	41 5d                	pop    %r13
+  803aef:	41 5e                	pop    %r14
+  803af1:	41 5f                	pop    %r15
+  803af3:	5d                   	pop    %rbp
+  803af4:	c3                   	ret
+
+0000000000803af5 <vsys_gettime>:
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num >= NVSYSCALLS) {
+        return -E_INVAL;
+    }
+    return vsys[num];
+  803af5:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  803afc:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  803afe:	c3                   	ret
+
+0000000000803aff <vsys_tsc_khz>:
+    return vsys[num];
+  803aff:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  803b06:	00 00 
+
+/* TSC frequency in kHz, to convert read_tsc() deltas to time */
+int
+vsys_tsc_khz(void) {
+    return vsyscall(VSYS_tsc_khz);
+}
+  803b08:	c3                   	ret
+
+0000000000803b09 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0e:	c3                   	ret
+
+0000000000803b0f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803b0f:	55                   	push   %rbp
+  803b10:	48 89 e5             	mov    %rsp,%rbp
+  803b13:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803b16:	48 be d4 56 80 00 00 	movabs $0x8056d4,%rsi
+  803b1d:	00 00 00 
+  803b20:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  803b27:	00 00 00 
+  803b2a:	ff d0                	call   *%rax
+    return 0;
+}
+  803b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b31:	5d                   	pop    %rbp
+  803b32:	c3                   	ret
+
+0000000000803b33 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b33:	55                   	push   %rbp
+  803b34:	48 89 e5             	mov    %rsp,%rbp
+  803b37:	41 57                	push   %r15
+  803b39:	41 56                	push   %r14
+  803b3b:	41 55                	push   %r13
+  803b3d:	41 54                	push   %r12
+  803b3f:	53                   	push   %rbx
+  803b40:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803b47:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803b4e:	48 85 d2             	test   %rdx,%rdx
+  803b51:	74 7a                	je     803bcd <devcons_write+0x9a>
+  803b53:	49 89 d6             	mov    %rdx,%r14
+  803b56:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803b5c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803b61:	49 bf 5e 10 80 00 00 	movabs $0x80105e,%r15
+  803b68:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803b6b:	4c 89 f3             	mov    %r14,%rbx
+  803b6e:	48 29 f3             	sub    %rsi,%rbx
+  803b71:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b76:	48 39 c3             	cmp    %rax,%rbx
+  803b79:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803b7d:	4c 63 eb             	movslq %ebx,%r13
+  803b80:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803b87:	48 01 c6             	add    %rax,%rsi
+  803b8a:	4c 89 ea             	mov    %r13,%rdx
+  803b8d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803b94:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803b97:	4c 89 ee             	mov    %r13,%rsi
+  803b9a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ba1:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803ba8:	00 00 00 
+  803bab:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803bad:	41 01 dc             	add    %ebx,%r12d
+  803bb0:	49 63 f4             	movslq %r12d,%rsi
+  803bb3:	4c 39 f6             	cmp    %r14,%rsi
+  803bb6:	72 b3                	jb     803b6b <devcons_write+0x38>
+    return res;
+  803bb8:	49 63 c4             	movslq %r12d,%rax
+}
+  803bbb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803bc2:	5b                   	pop    %rbx
+  803bc3:	41 5c                	pop    %r12
+  803bc5:	41 5d                	pop    %r13
+  803bc7:	41 5e                	pop    %r14
+  803bc9:	41 5f                	pop    %r15
+  803bcb:	5d                   	pop    %rbp
+  803bcc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803bcd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803bd3:	eb e3                	jmp    803bb8 <devcons_write+0x85>
+
+0000000000803bd5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bd5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bdd:	48 85 c0             	test   %rax,%rax
+  803be0:	74 60                	je     803c42 <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803be2:	55                   	push   %rbp
+  803be3:	48 89 e5             	mov    %rsp,%rbp
+  803be6:	41 55                	push   %r13
+  803be8:	41 54                	push   %r12
+  803bea:	53                   	push   %rbx
+  803beb:	48 83 ec 18          	sub    $0x18,%rsp
+  803bef:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  803bf2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803bf9:	48 bb b8 12 80 00 00 	movabs $0x8012b8,%rbx
+  803c00:	00 00 00 
+  803c03:	49 bc f1 41 80 00 00 	movabs $0x8041f1,%r12
+  803c0a:	00 00 00 
+  803c0d:	eb 07                	jmp    803c16 <devcons_read+0x41>
+  803c0f:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  803c13:	41 ff d4             	call   *%r12
+  803c16:	ff d3                	call   *%rbx
+  803c18:	85 c0                	test   %eax,%eax
+  803c1a:	74 f3                	je     803c0f <devcons_read+0x3a>
+    if (c < 0) return c;
+  803c1c:	48 63 d0             	movslq %eax,%rdx
+  803c1f:	78 13                	js     803c34 <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  803c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c26:	83 f8 04             	cmp    $0x4,%eax
+  803c29:	74 09                	je     803c34 <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803c2b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803c2f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803c34:	48 89 d0             	mov    %rdx,%rax
+  803c37:	48 83 c4 18          	add    $0x18,%rsp
+  803c3b:	5b                   	pop    %rbx
+  803c3c:	41 5c                	pop    %r12
+  803c3e:	41 5d                	pop    %r13
+  803c40:	5d                   	pop    %rbp
+  803c41:	c3                   	ret
+  803c42:	48 89 d0             	mov    %rdx,%rax
+  803c45:	c3                   	ret
+
+0000000000803c46 <cputchar>:
+cputchar(int ch) {
+  803c46:	55                   	push   %rbp
+  803c47:	48 89 e5             	mov    %rsp,%rbp
+  803c4a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803c4e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803c52:	be 01 00 00 00       	mov    $0x1,%esi
+  803c57:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803c5b:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+}
+  803c67:	c9                   	leave
+  803c68:	c3                   	ret
+
+0000000000803c69 <getchar>:
+getchar(void) {
+  803c69:	55                   	push   %rbp
+  803c6a:	48 89 e5             	mov    %rsp,%rbp
+  803c6d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803c71:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c76:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7f:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  803c86:	00 00 00 
+  803c89:	ff d0                	call   *%rax
+  803c8b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803c8d:	85 c0                	test   %eax,%eax
+  803c8f:	78 06                	js     803c97 <getchar+0x2e>
+  803c91:	74 08                	je     803c9b <getchar+0x32>
+  803c93:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803c97:	89 d0                	mov    %edx,%eax
+  803c99:	c9                   	leave
+  803c9a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803c9b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803ca0:	eb f5                	jmp    803c97 <getchar+0x2e>
+
+0000000000803ca2 <iscons>:
+iscons(int fdnum) {
+  803ca2:	55                   	push   %rbp
+  803ca3:	48 89 e5             	mov    %rsp,%rbp
+  803ca6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803caa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cae:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  803cb5:	00 00 00 
+  803cb8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	78 18                	js     803cd6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803cbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803cc2:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803cc9:	00 00 00 
+  803ccc:	8b 00                	mov    (%rax),%eax
+  803cce:	39 02                	cmp    %eax,(%rdx)
+  803cd0:	0f 94 c0             	sete   %al
+  803cd3:	0f b6 c0             	movzbl %al,%eax
+}
+  803cd6:	c9                   	leave
+  803cd7:	c3                   	ret
+
+0000000000803cd8 <opencons>:
+opencons(void) {
+  803cd8:	55                   	push   %rbp
+  803cd9:	48 89 e5             	mov    %rsp,%rbp
+  803cdc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ce0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ce4:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  803ceb:	00 00 00 
+  803cee:	ff d0                	call   *%rax
+  803cf0:	85 c0                	test   %eax,%eax
+  803cf2:	78 49                	js     803d3d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803cf4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cfe:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d07:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+  803d13:	85 c0                	test   %eax,%eax
+  803d15:	78 26                	js     803d3d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803d17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d1b:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803d22:	00 00 
+  803d24:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803d26:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d2a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803d31:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  803d38:	00 00 00 
+  803d3b:	ff d0                	call   *%rax
+}
+  803d3d:	c9                   	leave
+  803d3e:	c3                   	ret
+
+0000000000803d3f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803d3f:	55                   	push   %rbp
+  803d40:	48 89 e5             	mov    %rsp,%rbp
+  803d43:	41 56                	push   %r14
+  803d45:	41 55                	push   %r13
+  803d47:	41 54                	push   %r12
+  803d49:	53                   	push   %rbx
+  803d4a:	48 83 ec 50          	sub    $0x50,%rsp
+  803d4e:	49 89 fc             	mov    %rdi,%r12
+  803d51:	41 89 f5             	mov    %esi,%r13d
+  803d54:	48 89 d3             	mov    %rdx,%rbx
+  803d57:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803d5b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803d5f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d63:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803d6a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d6e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803d72:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803d76:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d7a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803d81:	00 00 00 
+  803d84:	4c 8b 30             	mov    (%rax),%r14
+  803d87:	48 b8 54 13 80 00 00 	movabs $0x801354,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+  803d93:	89 c6                	mov    %eax,%esi
+  803d95:	45 89 e8             	mov    %r13d,%r8d
+  803d98:	4c 89 e1             	mov    %r12,%rcx
+  803d9b:	4c 89 f2             	mov    %r14,%rdx
+  803d9e:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  803da5:	00 00 00 
+  803da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dad:	49 bc 3f 05 80 00 00 	movabs $0x80053f,%r12
+  803db4:	00 00 00 
+  803db7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803dba:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803dbe:	48 89 df             	mov    %rbx,%rdi
+  803dc1:	48 b8 db 04 80 00 00 	movabs $0x8004db,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+    cprintf("\n");
+  803dcd:	48 bf 3b 56 80 00 00 	movabs $0x80563b,%rdi
+  803dd4:	00 00 00 
+  803dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ddc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803ddf:	cc                   	int3
+  803de0:	eb fd                	jmp    803ddf <_panic+0xa0>
+
+0000000000803de2 <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803de2:	55                   	push   %rbp
+  803de3:	48 89 e5             	mov    %rsp,%rbp
+  803de6:	41 55                	push   %r13
+  803de8:	41 54                	push   %r12
+  803dea:	53                   	push   %rbx
+  803deb:	48 83 ec 08          	sub    $0x8,%rsp
+  803def:	49 89 fc             	mov    %rdi,%r12
+  803df2:	48 89 f7             	mov    %rsi,%rdi
+  803df5:	48 89 d3             	mov    %rdx,%rbx
+  803df8:	49 89 cd             	mov    %rcx,%r13
+  803dfb:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803dfe:	48 85 f6             	test   %rsi,%rsi
+  803e01:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e08:	00 00 00 
+  803e0b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e14:	48 85 db             	test   %rbx,%rbx
+  803e17:	74 03                	je     803e1c <ipc_recv_timeout+0x3a>
+  803e19:	48 8b 33             	mov    (%rbx),%rsi
+  803e1c:	48 b8 a9 19 80 00 00 	movabs $0x8019a9,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+    if (res == 0) {
+  803e28:	85 c0                	test   %eax,%eax
+  803e2a:	75 72                	jne    803e9e <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803e2c:	4d 85 e4             	test   %r12,%r12
+  803e2f:	74 17                	je     803e48 <ipc_recv_timeout+0x66>
+  803e31:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e38:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803e3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e3e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803e44:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803e48:	4d 85 ed             	test   %r13,%r13
+  803e4b:	74 17                	je     803e64 <ipc_recv_timeout+0x82>
+  803e4d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e54:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803e56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e5a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e60:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803e64:	48 85 db             	test   %rbx,%rbx
+  803e67:	74 17                	je     803e80 <ipc_recv_timeout+0x9e>
+  803e69:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e70:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803e72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e76:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803e7d:	48 89 03             	mov    %rax,(%rbx)
+  803e80:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e87:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803e89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e8d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803e93:	48 83 c4 08          	add    $0x8,%rsp
+  803e97:	5b                   	pop    %rbx
+  803e98:	41 5c                	pop    %r12
+  803e9a:	41 5d                	pop    %r13
+  803e9c:	5d                   	pop    %rbp
+  803e9d:	c3                   	ret
+        if (from_env_store) {
+  803e9e:	4d 85 e4             	test   %r12,%r12
+  803ea1:	74 08                	je     803eab <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803ea3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803eaa:	00 
+        if (perm_store) {
+  803eab:	4d 85 ed             	test   %r13,%r13
+  803eae:	74 08                	je     803eb8 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803eb0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803eb7:	00 
+        if (size) {
+  803eb8:	48 85 db             	test   %rbx,%rbx
+  803ebb:	74 d6                	je     803e93 <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803ebd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803ec4:	eb cd                	jmp    803e93 <ipc_recv_timeout+0xb1>
+
+0000000000803ec6 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ec6:	55                   	push   %rbp
+  803ec7:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803eca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ed0:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  803ed7:	00 00 00 
+  803eda:	ff d0                	call   *%rax
+}
+  803edc:	5d                   	pop    %rbp
+  803edd:	c3                   	ret
+
+0000000000803ede <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803ede:	55                   	push   %rbp
+  803edf:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803ee2:	48 85 d2             	test   %rdx,%rdx
+  803ee5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803eec:	00 00 00 
+  803eef:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803ef3:	89 f6                	mov    %esi,%esi
+  803ef5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803efb:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  803f02:	00 00 00 
+  803f05:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f07:	85 c0                	test   %eax,%eax
+  803f09:	78 02                	js     803f0d <ipc_send+0x2f>
+}
+  803f0b:	5d                   	pop    %rbp
+  803f0c:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803f0d:	89 c1                	mov    %eax,%ecx
+  803f0f:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  803f16:	00 00 00 
+  803f19:	be 51 00 00 00       	mov    $0x51,%esi
+  803f1e:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  803f25:	00 00 00 
+  803f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2d:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  803f34:	00 00 00 
+  803f37:	41 ff d0             	call   *%r8
+
+0000000000803f3a <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803f3a:	55                   	push   %rbp
+  803f3b:	48 89 e5             	mov    %rsp,%rbp
+  803f3e:	41 54                	push   %r12
+  803f40:	53                   	push   %rbx
+  803f41:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803f45:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803f49:	48 85 d2             	test   %rdx,%rdx
+  803f4c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f53:	00 00 00 
+  803f56:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803f5a:	4d 85 c9             	test   %r9,%r9
+  803f5d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803f61:	89 f6                	mov    %esi,%esi
+  803f63:	48 83 ec 08          	sub    $0x8,%rsp
+  803f67:	53                   	push   %rbx
+  803f68:	48 b8 ff 18 80 00 00 	movabs $0x8018ff,%rax
+  803f6f:	00 00 00 
+  803f72:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803f74:	48 83 c4 10          	add    $0x10,%rsp
+  803f78:	85 c0                	test   %eax,%eax
+  803f7a:	78 65                	js     803fe1 <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803f7c:	4d 85 e4             	test   %r12,%r12
+  803f7f:	74 17                	je     803f98 <ipc_call+0x5e>
+  803f81:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803f88:	00 00 
+  803f8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803f8e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803f94:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803f98:	48 85 db             	test   %rbx,%rbx
+  803f9b:	74 28                	je     803fc5 <ipc_call+0x8b>
+  803f9d:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fa4:	00 00 
+  803fa6:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803faa:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803fb1:	ba 20 00 00 00       	mov    $0x20,%edx
+  803fb6:	48 89 df             	mov    %rbx,%rdi
+  803fb9:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  803fc0:	00 00 00 
+  803fc3:	ff d0                	call   *%rax
+  803fc5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803fcc:	00 00 
+    return thisenv->env_ipc_value;
+  803fce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803fd2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803fd8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803fdc:	5b                   	pop    %rbx
+  803fdd:	41 5c                	pop    %r12
+  803fdf:	5d                   	pop    %rbp
+  803fe0:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803fe1:	89 c1                	mov    %eax,%ecx
+  803fe3:	48 ba 24 57 80 00 00 	movabs $0x805724,%rdx
+  803fea:	00 00 00 
+  803fed:	be 62 00 00 00       	mov    $0x62,%esi
+  803ff2:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  803ff9:	00 00 00 
+  803ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804001:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  804008:	00 00 00 
+  80400b:	41 ff d0             	call   *%r8
+
+000000000080400e <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  80400e:	55                   	push   %rbp
+  80400f:	48 89 e5             	mov    %rsp,%rbp
+  804012:	41 57                	push   %r15
+  804014:	41 56                	push   %r14
+  804016:	41 55                	push   %r13
+  804018:	41 54                	push   %r12
+  80401a:	53                   	push   %rbx
+  80401b:	48 83 ec 20          	sub    $0x20,%rsp
+  80401f:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  804022:	48 89 d3             	mov    %rdx,%rbx
+  804025:	49 89 ce             	mov    %rcx,%r14
+  804028:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  80402c:	4d 89 cd             	mov    %r9,%r13
+  80402f:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  804033:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804037:	48 85 d2             	test   %rdx,%rdx
+  80403a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804041:	00 00 00 
+  804044:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804048:	4d 85 e4             	test   %r12,%r12
+  80404b:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  80404f:	89 f0                	mov    %esi,%eax
+  804051:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804055:	41 57                	push   %r15
+  804057:	4d 89 e1             	mov    %r12,%r9
+  80405a:	48 89 da             	mov    %rbx,%rdx
+  80405d:	48 89 c6             	mov    %rax,%rsi
+  804060:	48 b8 54 19 80 00 00 	movabs $0x801954,%rax
+  804067:	00 00 00 
+  80406a:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  80406c:	48 83 c4 10          	add    $0x10,%rsp
+  804070:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804073:	0f 84 93 00 00 00    	je     80410c <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804079:	85 c0                	test   %eax,%eax
+  80407b:	0f 88 f3 00 00 00    	js     804174 <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804081:	4d 85 ed             	test   %r13,%r13
+  804084:	74 17                	je     80409d <ipc_reply_wait+0x8f>
+  804086:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80408d:	00 00 
+  80408f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804093:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  804099:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80409d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8040a2:	74 19                	je     8040bd <ipc_reply_wait+0xaf>
+  8040a4:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040ab:	00 00 
+  8040ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040b1:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8040b7:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  8040bb:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  8040bd:	4d 85 ff             	test   %r15,%r15
+  8040c0:	74 28                	je     8040ea <ipc_reply_wait+0xdc>
+  8040c2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040c9:	00 00 
+  8040cb:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  8040cf:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  8040d6:	ba 20 00 00 00       	mov    $0x20,%edx
+  8040db:	4c 89 ff             	mov    %r15,%rdi
+  8040de:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8040e5:	00 00 00 
+  8040e8:	ff d0                	call   *%rax
+  8040ea:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8040f1:	00 00 
+    return thisenv->env_ipc_value;
+  8040f3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8040f7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8040fd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804101:	5b                   	pop    %rbx
+  804102:	41 5c                	pop    %r12
+  804104:	41 5d                	pop    %r13
+  804106:	41 5e                	pop    %r14
+  804108:	41 5f                	pop    %r15
+  80410a:	5d                   	pop    %rbp
+  80410b:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  80410c:	4d 89 f9             	mov    %r15,%r9
+  80410f:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  804113:	4c 89 f1             	mov    %r14,%rcx
+  804116:	48 89 da             	mov    %rbx,%rdx
+  804119:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80411d:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  804120:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  804127:	00 00 00 
+  80412a:	ff d0                	call   *%rax
+  80412c:	85 c0                	test   %eax,%eax
+  80412e:	78 17                	js     804147 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  804130:	4c 89 f6             	mov    %r14,%rsi
+  804133:	4c 89 e7             	mov    %r12,%rdi
+  804136:	48 b8 96 18 80 00 00 	movabs $0x801896,%rax
+  80413d:	00 00 00 
+  804140:	ff d0                	call   *%rax
+  804142:	e9 32 ff ff ff       	jmp    804079 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  804147:	89 c1                	mov    %eax,%ecx
+  804149:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  804150:	00 00 00 
+  804153:	be 7a 00 00 00       	mov    $0x7a,%esi
+  804158:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  80415f:	00 00 00 
+  804162:	b8 00 00 00 00       	mov    $0x0,%eax
+  804167:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  80416e:	00 00 00 
+  804171:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  804174:	89 c1                	mov    %eax,%ecx
+  804176:	48 ba 3b 57 80 00 00 	movabs $0x80573b,%rdx
+  80417d:	00 00 00 
+  804180:	be 7d 00 00 00       	mov    $0x7d,%esi
+  804185:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  80418c:	00 00 00 
+  80418f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804194:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  80419b:	00 00 00 
+  80419e:	41 ff d0             	call   *%r8
+
+00000000008041a1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8041a1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8041a6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8041ad:	00 00 00 
+  8041b0:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  8041b7:	48 01 ca             	add    %rcx,%rdx
+  8041ba:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8041c0:	39 fa                	cmp    %edi,%edx
+  8041c2:	74 12                	je     8041d6 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8041c4:	48 83 c0 01          	add    $0x1,%rax
+  8041c8:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8041ce:	75 e0                	jne    8041b0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8041d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041d5:	c3                   	ret
+            return envs[i].env_id;
+  8041d6:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  8041dd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8041e4:	00 00 00 
+  8041e7:	48 01 d0             	add    %rdx,%rax
+  8041ea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8041f0:	c3                   	ret
+
+00000000008041f1 <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  8041f1:	55                   	push   %rbp
+  8041f2:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  8041f5:	8b 0f                	mov    (%rdi),%ecx
+  8041f7:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041fa:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  8041fc:	83 f9 07             	cmp    $0x7,%ecx
+  8041ff:	76 31                	jbe    804232 <backoff+0x41>
+    asm volatile("rdtsc"
+  804201:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  804203:	83 c1 06             	add    $0x6,%ecx
+  804206:	be 15 00 00 00       	mov    $0x15,%esi
+  80420b:	39 f1                	cmp    %esi,%ecx
+  80420d:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  804210:	bf 01 00 00 00       	mov    $0x1,%edi
+  804215:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  804218:	48 c1 e2 20          	shl    $0x20,%rdx
+  80421c:	89 c0                	mov    %eax,%eax
+  80421e:	48 09 c2             	or     %rax,%rdx
+  804221:	48 01 d7             	add    %rdx,%rdi
+  804224:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  80422b:	00 00 00 
+  80422e:	ff d0                	call   *%rax
+}
+  804230:	5d                   	pop    %rbp
+  804231:	c3                   	ret
+        sys_yield();
+  804232:	48 b8 85 13 80 00 00 	movabs $0x801385,%rax
+  804239:	00 00 00 
+  80423c:	ff d0                	call   *%rax
+        return;
+  80423e:	eb f0                	jmp    804230 <backoff+0x3f>
+
+0000000000804240 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804240:	55                   	push   %rbp
+  804241:	48 89 e5             	mov    %rsp,%rbp
+  804244:	41 55                	push   %r13
+  804246:	41 54                	push   %r12
+  804248:	53                   	push   %rbx
+  804249:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  80424d:	85 ff                	test   %edi,%edi
+  80424f:	74 7e                	je     8042cf <wait+0x8f>
+  804251:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804254:	89 f8                	mov    %edi,%eax
+  804256:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  80425b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  804262:	89 f9                	mov    %edi,%ecx
+  804264:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80426a:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  804271:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804278:	00 00 00 
+  80427b:	48 01 ca             	add    %rcx,%rdx
+  80427e:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804284:	39 d7                	cmp    %edx,%edi
+  804286:	75 3c                	jne    8042c4 <wait+0x84>
+           env->env_status != ENV_FREE) {
+  804288:	48 98                	cltq
+  80428a:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  804291:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804298:	00 00 00 
+  80429b:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  80429e:	49 bd f1 41 80 00 00 	movabs $0x8041f1,%r13
+  8042a5:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8042a8:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8042ae:	85 c0                	test   %eax,%eax
+  8042b0:	74 12                	je     8042c4 <wait+0x84>
+        backoff(&attempt);
+  8042b2:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8042b6:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8042b9:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8042bf:	44 39 e0             	cmp    %r12d,%eax
+  8042c2:	74 e4                	je     8042a8 <wait+0x68>
+    }
+}
+  8042c4:	48 83 c4 18          	add    $0x18,%rsp
+  8042c8:	5b                   	pop    %rbx
+  8042c9:	41 5c                	pop    %r12
+  8042cb:	41 5d                	pop    %r13
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+    assert(envid != 0);
+  8042cf:	48 b9 58 57 80 00 00 	movabs $0x805758,%rcx
+  8042d6:	00 00 00 
+  8042d9:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  8042e0:	00 00 00 
+  8042e3:	be 22 00 00 00       	mov    $0x22,%esi
+  8042e8:	48 bf 63 57 80 00 00 	movabs $0x805763,%rdi
+  8042ef:	00 00 00 
+  8042f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f7:	49 b8 3f 3d 80 00 00 	movabs $0x803d3f,%r8
+  8042fe:	00 00 00 
+  804301:	41 ff d0             	call   *%r8
+
+0000000000804304 <__text_end>:
+  804304:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430b:	00 00 00 
+  80430e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804315:	00 00 00 
+  804318:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431f:	00 00 00 
+  804322:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804329:	00 00 00 
+  80432c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804333:	00 00 00 
+  804336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433d:	00 00 00 
+  804340:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804347:	00 00 00 
+  80434a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804351:	00 00 00 
+  804354:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435b:	00 00 00 
+  80435e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804365:	00 00 00 
+  804368:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436f:	00 00 00 
+  804372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804379:	00 00 00 
+  80437c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804383:	00 00 00 
+  804386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438d:	00 00 00 
+  804390:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804397:	00 00 00 
+  80439a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a1:	00 00 00 
+  8043a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ab:	00 00 00 
+  8043ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b5:	00 00 00 
+  8043b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bf:	00 00 00 
+  8043c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c9:	00 00 00 
+  8043cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d3:	00 00 00 
+  8043d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dd:	00 00 00 
+  8043e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e7:	00 00 00 
+  8043ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f1:	00 00 00 
+  8043f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fb:	00 00 00 
+  8043fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804405:	00 00 00 
+  804408:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440f:	00 00 00 
+  804412:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804419:	00 00 00 
+  80441c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804423:	00 00 00 
+  804426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442d:	00 00 00 
+  804430:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804437:	00 00 00 
+  80443a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804441:	00 00 00 
+  804444:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444b:	00 00 00 
+  80444e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804455:	00 00 00 
+  804458:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445f:	00 00 00 
+  804462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804469:	00 00 00 
+  80446c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804473:	00 00 00 
+  804476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447d:	00 00 00 
+  804480:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804487:	00 00 00 
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,7885 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cc 00 00 00       	call   8000ef <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+};
+
+static inline struct Tcb *
+thread_tcb(void) {
+    struct Tcb *tcb;
+    asm("movq %%fs:0, %0"
+  800036:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  80003d:	00 00 
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800043:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800049:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 ba ac 02 80 00 00 	movabs $0x8002ac,%rdx
+  80005f:	00 00 00 
+  800062:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800064:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800069:	49 bf f2 10 80 00 00 	movabs $0x8010f2,%r15
+  800070:	00 00 00 
+  800073:	64 4c 8b 34 25 00 00 	mov    %fs:0x0,%r14
+  80007a:	00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007c:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  800083:	00 00 00 
+  800086:	49 bc ac 02 80 00 00 	movabs $0x8002ac,%r12
+  80008d:	00 00 00 
+        sys_yield();
+  800090:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800093:	49 8b 46 08          	mov    0x8(%r14),%rax
+  800097:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009d:	89 da                	mov    %ebx,%edx
+  80009f:	4c 89 ef             	mov    %r13,%rdi
+  8000a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a7:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000aa:	83 c3 01             	add    $0x1,%ebx
+  8000ad:	83 fb 05             	cmp    $0x5,%ebx
+  8000b0:	75 de                	jne    800090 <umain+0x6b>
+  8000b2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8000b9:	00 00 
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000bb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8000bf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000c5:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  8000cc:	00 00 00 
+  8000cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d4:	48 ba ac 02 80 00 00 	movabs $0x8002ac,%rdx
+  8000db:	00 00 00 
+  8000de:	ff d2                	call   *%rdx
+}
+  8000e0:	48 83 c4 08          	add    $0x8,%rsp
+  8000e4:	5b                   	pop    %rbx
+  8000e5:	41 5c                	pop    %r12
+  8000e7:	41 5d                	pop    %r13
+  8000e9:	41 5e                	pop    %r14
+  8000eb:	41 5f                	pop    %r15
+  8000ed:	5d                   	pop    %rbp
+  8000ee:	c3                   	ret
+
+00000000008000ef <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ef:	55                   	push   %rbp
+  8000f0:	48 89 e5             	mov    %rsp,%rbp
+  8000f3:	41 56                	push   %r14
+  8000f5:	41 55                	push   %r13
+  8000f7:	41 54                	push   %r12
+  8000f9:	53                   	push   %rbx
+  8000fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8000fe:	41 89 fd             	mov    %edi,%r13d
+  800101:	49 89 f6             	mov    %rsi,%r14
+    /* Thread-local storage of the main thread.  It is on the stack,
+     * so it stays private to children made by fork() and sfork().
+     * thisenv is NULL until it is set below */
+    struct Tcb tcb = {.tcb_self = &tcb};
+  800104:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80010b:	00 
+  80010c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800113:	00 
+  800114:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80011b:	00 
+  80011c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800123:	00 
+  800124:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800128:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    sys_env_set_tls(CURENVID, &tcb);
+  80012c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800131:	48 b8 4b 13 80 00 00 	movabs $0x80134b,%rax
+  800138:	00 00 00 
+  80013b:	ff d0                	call   *%rax
+
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013d:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800144:	00 00 00 
+  800147:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80014e:	00 00 00 
+  800151:	48 39 c2             	cmp    %rax,%rdx
+  800154:	73 17                	jae    80016d <libmain+0x7e>
+    void (**ctor)() = &__ctors_start;
+  800156:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800159:	49 89 c4             	mov    %rax,%r12
+  80015c:	48 83 c3 08          	add    $0x8,%rbx
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff 53 f8             	call   *-0x8(%rbx)
+  800168:	4c 39 e3             	cmp    %r12,%rbx
+  80016b:	72 ef                	jb     80015c <libmain+0x6d>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    // LAB 8: Your code here
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80016d:	48 b8 c1 10 80 00 00 	movabs $0x8010c1,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+  800179:	64 48 8b 14 25 00 00 	mov    %fs:0x0,%rdx
+  800180:	00 00 
+  800182:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800187:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  80018e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800195:	00 00 00 
+  800198:	48 01 c8             	add    %rcx,%rax
+  80019b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80019f:	45 85 ed             	test   %r13d,%r13d
+  8001a2:	7e 0d                	jle    8001b1 <libmain+0xc2>
+  8001a4:	49 8b 06             	mov    (%r14),%rax
+  8001a7:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001ae:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b1:	4c 89 f6             	mov    %r14,%rsi
+  8001b4:	44 89 ef             	mov    %r13d,%edi
+  8001b7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c3:	48 b8 dc 01 80 00 00 	movabs $0x8001dc,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+#endif
+}
+  8001cf:	48 83 c4 30          	add    $0x30,%rsp
+  8001d3:	5b                   	pop    %rbx
+  8001d4:	41 5c                	pop    %r12
+  8001d6:	41 5d                	pop    %r13
+  8001d8:	41 5e                	pop    %r14
+  8001da:	5d                   	pop    %rbp
+  8001db:	c3                   	ret
+
+00000000008001dc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001dc:	55                   	push   %rbp
+  8001dd:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e0:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f1:	48 b8 56 10 80 00 00 	movabs $0x801056,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+}
+  8001fd:	5d                   	pop    %rbp
+  8001fe:	c3                   	ret
+
+00000000008001ff <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ff:	55                   	push   %rbp
+  800200:	48 89 e5             	mov    %rsp,%rbp
+  800203:	53                   	push   %rbx
+  800204:	48 83 ec 08          	sub    $0x8,%rsp
+  800208:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80020b:	8b 06                	mov    (%rsi),%eax
+  80020d:	8d 50 01             	lea    0x1(%rax),%edx
+  800210:	89 16                	mov    %edx,(%rsi)
+  800212:	48 98                	cltq
+  800214:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800219:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80021f:	74 0a                	je     80022b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800221:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800229:	c9                   	leave
+  80022a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80022b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80022f:	be ff 00 00 00       	mov    $0xff,%esi
+  800234:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800240:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800246:	eb d9                	jmp    800221 <putch+0x22>
+
+0000000000800248 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800248:	55                   	push   %rbp
+  800249:	48 89 e5             	mov    %rsp,%rbp
+  80024c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800253:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800256:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80025d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800262:	b8 00 00 00 00       	mov    $0x0,%eax
+  800267:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80026a:	48 89 f1             	mov    %rsi,%rcx
+  80026d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800274:	48 bf ff 01 80 00 00 	movabs $0x8001ff,%rdi
+  80027b:	00 00 00 
+  80027e:	48 b8 fc 03 80 00 00 	movabs $0x8003fc,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80028a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800291:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800298:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  80029f:	00 00 00 
+  8002a2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002a4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002aa:	c9                   	leave
+  8002ab:	c3                   	ret
+
+00000000008002ac <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002ac:	55                   	push   %rbp
+  8002ad:	48 89 e5             	mov    %rsp,%rbp
+  8002b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002b4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002b8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002bc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002c0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002c4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002c8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002d7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002db:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002df:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e3:	48 b8 48 02 80 00 00 	movabs $0x800248,%rax
+  8002ea:	00 00 00 
+  8002ed:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002ef:	c9                   	leave
+  8002f0:	c3                   	ret
+
+00000000008002f1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002f1:	55                   	push   %rbp
+  8002f2:	48 89 e5             	mov    %rsp,%rbp
+  8002f5:	41 57                	push   %r15
+  8002f7:	41 56                	push   %r14
+  8002f9:	41 55                	push   %r13
+  8002fb:	41 54                	push   %r12
+  8002fd:	53                   	push   %rbx
+  8002fe:	48 83 ec 18          	sub    $0x18,%rsp
+  800302:	49 89 fc             	mov    %rdi,%r12
+  800305:	49 89 f5             	mov    %rsi,%r13
+  800308:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80030c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80030f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800312:	41 89 cf             	mov    %ecx,%r15d
+  800315:	4c 39 fa             	cmp    %r15,%rdx
+  800318:	73 5b                	jae    800375 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80031a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80031e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800322:	85 db                	test   %ebx,%ebx
+  800324:	7e 0e                	jle    800334 <print_num+0x43>
+            putch(padc, put_arg);
+  800326:	4c 89 ee             	mov    %r13,%rsi
+  800329:	44 89 f7             	mov    %r14d,%edi
+  80032c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80032f:	83 eb 01             	sub    $0x1,%ebx
+  800332:	75 f2                	jne    800326 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800334:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800338:	48 b9 8a 50 80 00 00 	movabs $0x80508a,%rcx
+  80033f:	00 00 00 
+  800342:	48 b8 79 50 80 00 00 	movabs $0x805079,%rax
+  800349:	00 00 00 
+  80034c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800350:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800354:	ba 00 00 00 00       	mov    $0x0,%edx
+  800359:	49 f7 f7             	div    %r15
+  80035c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800360:	4c 89 ee             	mov    %r13,%rsi
+  800363:	41 ff d4             	call   *%r12
+}
+  800366:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80036a:	5b                   	pop    %rbx
+  80036b:	41 5c                	pop    %r12
+  80036d:	41 5d                	pop    %r13
+  80036f:	41 5e                	pop    %r14
+  800371:	41 5f                	pop    %r15
+  800373:	5d                   	pop    %rbp
+  800374:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800375:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800379:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037e:	49 f7 f7             	div    %r15
+  800381:	48 83 ec 08          	sub    $0x8,%rsp
+  800385:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800389:	52                   	push   %rdx
+  80038a:	45 0f be c9          	movsbl %r9b,%r9d
+  80038e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800392:	48 89 c2             	mov    %rax,%rdx
+  800395:	48 b8 f1 02 80 00 00 	movabs $0x8002f1,%rax
+  80039c:	00 00 00 
+  80039f:	ff d0                	call   *%rax
+  8003a1:	48 83 c4 10          	add    $0x10,%rsp
+  8003a5:	eb 8d                	jmp    800334 <print_num+0x43>
+
+00000000008003a7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003a7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003ab:	48 8b 06             	mov    (%rsi),%rax
+  8003ae:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003b2:	73 0a                	jae    8003be <sprintputch+0x17>
+        *state->start++ = ch;
+  8003b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003b8:	48 89 16             	mov    %rdx,(%rsi)
+  8003bb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003be:	c3                   	ret
+
+00000000008003bf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003bf:	55                   	push   %rbp
+  8003c0:	48 89 e5             	mov    %rsp,%rbp
+  8003c3:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003cb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003cf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003d3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003ea:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003ee:	48 b8 fc 03 80 00 00 	movabs $0x8003fc,%rax
+  8003f5:	00 00 00 
+  8003f8:	ff d0                	call   *%rax
+}
+  8003fa:	c9                   	leave
+  8003fb:	c3                   	ret
+
+00000000008003fc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003fc:	55                   	push   %rbp
+  8003fd:	48 89 e5             	mov    %rsp,%rbp
+  800400:	41 57                	push   %r15
+  800402:	41 56                	push   %r14
+  800404:	41 55                	push   %r13
+  800406:	41 54                	push   %r12
+  800408:	53                   	push   %rbx
+  800409:	48 83 ec 38          	sub    $0x38,%rsp
+  80040d:	49 89 fe             	mov    %rdi,%r14
+  800410:	49 89 f5             	mov    %rsi,%r13
+  800413:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800416:	48 8b 01             	mov    (%rcx),%rax
+  800419:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80041d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800421:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800425:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800429:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80042d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800431:	0f b6 3b             	movzbl (%rbx),%edi
+  800434:	40 80 ff 25          	cmp    $0x25,%dil
+  800438:	74 18                	je     800452 <vprintfmt+0x56>
+            if (!ch) return;
+  80043a:	40 84 ff             	test   %dil,%dil
+  80043d:	0f 84 b1 06 00 00    	je     800af4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800443:	40 0f b6 ff          	movzbl %dil,%edi
+  800447:	4c 89 ee             	mov    %r13,%rsi
+  80044a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80044d:	4c 89 e3             	mov    %r12,%rbx
+  800450:	eb db                	jmp    80042d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800452:	be 00 00 00 00       	mov    $0x0,%esi
+  800457:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80045b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800460:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800466:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80046d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800471:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800476:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80047b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80047e:	83 e8 23             	sub    $0x23,%eax
+  800481:	3c 57                	cmp    $0x57,%al
+  800483:	0f 87 51 06 00 00    	ja     800ada <vprintfmt+0x6de>
+  800489:	0f b6 c0             	movzbl %al,%eax
+  80048c:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800493:	00 00 00 
+  800496:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800499:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80049c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004a0:	eb cf                	jmp    800471 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004a2:	49 89 dc             	mov    %rbx,%r12
+  8004a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8004aa:	eb c5                	jmp    800471 <vprintfmt+0x75>
+            padc = ch;
+  8004ac:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004b0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b6:	eb b9                	jmp    800471 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8004be:	77 24                	ja     8004e4 <vprintfmt+0xe8>
+  8004c0:	89 c1                	mov    %eax,%ecx
+  8004c2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004c6:	83 c0 08             	add    $0x8,%eax
+  8004c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004cf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004d2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004d6:	79 99                	jns    800471 <vprintfmt+0x75>
+                width = precision;
+  8004d8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004dc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e2:	eb 8d                	jmp    800471 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004e8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f0:	eb da                	jmp    8004cc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004f2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004f7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004fb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800501:	3c 39                	cmp    $0x39,%al
+  800503:	77 1c                	ja     800521 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800505:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800509:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80050d:	0f b6 c0             	movzbl %al,%eax
+  800510:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800515:	0f b6 03             	movzbl (%rbx),%eax
+  800518:	3c 39                	cmp    $0x39,%al
+  80051a:	76 e9                	jbe    800505 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80051c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80051f:	eb b1                	jmp    8004d2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800521:	49 89 dc             	mov    %rbx,%r12
+  800524:	eb ac                	jmp    8004d2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800526:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800529:	85 c9                	test   %ecx,%ecx
+  80052b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800530:	0f 49 c1             	cmovns %ecx,%eax
+  800533:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800536:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800539:	e9 33 ff ff ff       	jmp    800471 <vprintfmt+0x75>
+            lflag++;
+  80053e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800541:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800544:	e9 28 ff ff ff       	jmp    800471 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800549:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054c:	83 f8 2f             	cmp    $0x2f,%eax
+  80054f:	77 19                	ja     80056a <vprintfmt+0x16e>
+  800551:	89 c2                	mov    %eax,%edx
+  800553:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800557:	83 c0 08             	add    $0x8,%eax
+  80055a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80055d:	8b 3a                	mov    (%rdx),%edi
+  80055f:	4c 89 ee             	mov    %r13,%rsi
+  800562:	41 ff d6             	call   *%r14
+            break;
+  800565:	e9 c3 fe ff ff       	jmp    80042d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80056a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80056e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800572:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800576:	eb e5                	jmp    80055d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800578:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057b:	83 f8 2f             	cmp    $0x2f,%eax
+  80057e:	77 5a                	ja     8005da <vprintfmt+0x1de>
+  800580:	89 c2                	mov    %eax,%edx
+  800582:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800586:	83 c0 08             	add    $0x8,%eax
+  800589:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80058c:	8b 02                	mov    (%rdx),%eax
+  80058e:	89 c1                	mov    %eax,%ecx
+  800590:	f7 d9                	neg    %ecx
+  800592:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800595:	83 f9 16             	cmp    $0x16,%ecx
+  800598:	7f 4e                	jg     8005e8 <vprintfmt+0x1ec>
+  80059a:	48 63 c1             	movslq %ecx,%rax
+  80059d:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  8005a4:	00 00 00 
+  8005a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005ab:	48 85 c0             	test   %rax,%rax
+  8005ae:	74 38                	je     8005e8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005b0:	48 89 c1             	mov    %rax,%rcx
+  8005b3:	48 ba f9 56 80 00 00 	movabs $0x8056f9,%rdx
+  8005ba:	00 00 00 
+  8005bd:	4c 89 ee             	mov    %r13,%rsi
+  8005c0:	4c 89 f7             	mov    %r14,%rdi
+  8005c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c8:	49 b8 bf 03 80 00 00 	movabs $0x8003bf,%r8
+  8005cf:	00 00 00 
+  8005d2:	41 ff d0             	call   *%r8
+  8005d5:	e9 53 fe ff ff       	jmp    80042d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e6:	eb a4                	jmp    80058c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005e8:	48 ba a2 50 80 00 00 	movabs $0x8050a2,%rdx
+  8005ef:	00 00 00 
+  8005f2:	4c 89 ee             	mov    %r13,%rsi
+  8005f5:	4c 89 f7             	mov    %r14,%rdi
+  8005f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fd:	49 b8 bf 03 80 00 00 	movabs $0x8003bf,%r8
+  800604:	00 00 00 
+  800607:	41 ff d0             	call   *%r8
+  80060a:	e9 1e fe ff ff       	jmp    80042d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80060f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800612:	83 f8 2f             	cmp    $0x2f,%eax
+  800615:	77 6c                	ja     800683 <vprintfmt+0x287>
+  800617:	89 c2                	mov    %eax,%edx
+  800619:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061d:	83 c0 08             	add    $0x8,%eax
+  800620:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800623:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800626:	48 85 d2             	test   %rdx,%rdx
+  800629:	48 b8 9b 50 80 00 00 	movabs $0x80509b,%rax
+  800630:	00 00 00 
+  800633:	48 0f 45 c2          	cmovne %rdx,%rax
+  800637:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80063b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80063f:	7e 06                	jle    800647 <vprintfmt+0x24b>
+  800641:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800645:	75 4a                	jne    800691 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800647:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80064b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80064f:	0f b6 00             	movzbl (%rax),%eax
+  800652:	84 c0                	test   %al,%al
+  800654:	0f 85 9a 00 00 00    	jne    8006f4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80065a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800661:	85 c0                	test   %eax,%eax
+  800663:	0f 8e c4 fd ff ff    	jle    80042d <vprintfmt+0x31>
+  800669:	4c 89 ee             	mov    %r13,%rsi
+  80066c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800671:	41 ff d6             	call   *%r14
+  800674:	41 83 ec 01          	sub    $0x1,%r12d
+  800678:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80067c:	75 eb                	jne    800669 <vprintfmt+0x26d>
+  80067e:	e9 aa fd ff ff       	jmp    80042d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800683:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800687:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068f:	eb 92                	jmp    800623 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800691:	49 63 f7             	movslq %r15d,%rsi
+  800694:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800698:	48 b8 ae 0b 80 00 00 	movabs $0x800bae,%rax
+  80069f:	00 00 00 
+  8006a2:	ff d0                	call   *%rax
+  8006a4:	48 89 c2             	mov    %rax,%rdx
+  8006a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006aa:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006ac:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006af:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006b2:	85 c0                	test   %eax,%eax
+  8006b4:	7e 91                	jle    800647 <vprintfmt+0x24b>
+  8006b6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006bb:	4c 89 ee             	mov    %r13,%rsi
+  8006be:	44 89 e7             	mov    %r12d,%edi
+  8006c1:	41 ff d6             	call   *%r14
+  8006c4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006c8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006ce:	75 eb                	jne    8006bb <vprintfmt+0x2bf>
+  8006d0:	e9 72 ff ff ff       	jmp    800647 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d5:	0f b6 f8             	movzbl %al,%edi
+  8006d8:	4c 89 ee             	mov    %r13,%rsi
+  8006db:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e2:	49 83 c4 01          	add    $0x1,%r12
+  8006e6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006ec:	84 c0                	test   %al,%al
+  8006ee:	0f 84 66 ff ff ff    	je     80065a <vprintfmt+0x25e>
+  8006f4:	45 85 ff             	test   %r15d,%r15d
+  8006f7:	78 0a                	js     800703 <vprintfmt+0x307>
+  8006f9:	41 83 ef 01          	sub    $0x1,%r15d
+  8006fd:	0f 88 57 ff ff ff    	js     80065a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800703:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800707:	74 cc                	je     8006d5 <vprintfmt+0x2d9>
+  800709:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80070c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800711:	80 fa 5e             	cmp    $0x5e,%dl
+  800714:	77 c2                	ja     8006d8 <vprintfmt+0x2dc>
+  800716:	eb bd                	jmp    8006d5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800718:	40 84 f6             	test   %sil,%sil
+  80071b:	75 26                	jne    800743 <vprintfmt+0x347>
+    switch (lflag) {
+  80071d:	85 d2                	test   %edx,%edx
+  80071f:	74 59                	je     80077a <vprintfmt+0x37e>
+  800721:	83 fa 01             	cmp    $0x1,%edx
+  800724:	74 7b                	je     8007a1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800726:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800729:	83 f8 2f             	cmp    $0x2f,%eax
+  80072c:	0f 87 96 00 00 00    	ja     8007c8 <vprintfmt+0x3cc>
+  800732:	89 c2                	mov    %eax,%edx
+  800734:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800738:	83 c0 08             	add    $0x8,%eax
+  80073b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073e:	4c 8b 22             	mov    (%rdx),%r12
+  800741:	eb 17                	jmp    80075a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800743:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800746:	83 f8 2f             	cmp    $0x2f,%eax
+  800749:	77 21                	ja     80076c <vprintfmt+0x370>
+  80074b:	89 c2                	mov    %eax,%edx
+  80074d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800751:	83 c0 08             	add    $0x8,%eax
+  800754:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800757:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80075a:	4d 85 e4             	test   %r12,%r12
+  80075d:	78 7a                	js     8007d9 <vprintfmt+0x3dd>
+            num = i;
+  80075f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800762:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800767:	e9 50 02 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80076c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800770:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800778:	eb dd                	jmp    800757 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80077a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077d:	83 f8 2f             	cmp    $0x2f,%eax
+  800780:	77 11                	ja     800793 <vprintfmt+0x397>
+  800782:	89 c2                	mov    %eax,%edx
+  800784:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800788:	83 c0 08             	add    $0x8,%eax
+  80078b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078e:	4c 63 22             	movslq (%rdx),%r12
+  800791:	eb c7                	jmp    80075a <vprintfmt+0x35e>
+  800793:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800797:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079f:	eb ed                	jmp    80078e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a7:	77 11                	ja     8007ba <vprintfmt+0x3be>
+  8007a9:	89 c2                	mov    %eax,%edx
+  8007ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007af:	83 c0 08             	add    $0x8,%eax
+  8007b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b5:	4c 8b 22             	mov    (%rdx),%r12
+  8007b8:	eb a0                	jmp    80075a <vprintfmt+0x35e>
+  8007ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c6:	eb ed                	jmp    8007b5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d4:	e9 65 ff ff ff       	jmp    80073e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007d9:	4c 89 ee             	mov    %r13,%rsi
+  8007dc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007e1:	41 ff d6             	call   *%r14
+                i = -i;
+  8007e4:	49 f7 dc             	neg    %r12
+  8007e7:	e9 73 ff ff ff       	jmp    80075f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ec:	40 84 f6             	test   %sil,%sil
+  8007ef:	75 32                	jne    800823 <vprintfmt+0x427>
+    switch (lflag) {
+  8007f1:	85 d2                	test   %edx,%edx
+  8007f3:	74 5d                	je     800852 <vprintfmt+0x456>
+  8007f5:	83 fa 01             	cmp    $0x1,%edx
+  8007f8:	0f 84 82 00 00 00    	je     800880 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800801:	83 f8 2f             	cmp    $0x2f,%eax
+  800804:	0f 87 a5 00 00 00    	ja     8008af <vprintfmt+0x4b3>
+  80080a:	89 c2                	mov    %eax,%edx
+  80080c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800810:	83 c0 08             	add    $0x8,%eax
+  800813:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800816:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800819:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80081e:	e9 99 01 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800823:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800826:	83 f8 2f             	cmp    $0x2f,%eax
+  800829:	77 19                	ja     800844 <vprintfmt+0x448>
+  80082b:	89 c2                	mov    %eax,%edx
+  80082d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800831:	83 c0 08             	add    $0x8,%eax
+  800834:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800837:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80083f:	e9 78 01 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+  800844:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800848:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800850:	eb e5                	jmp    800837 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800852:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800855:	83 f8 2f             	cmp    $0x2f,%eax
+  800858:	77 18                	ja     800872 <vprintfmt+0x476>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800868:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80086d:	e9 4a 01 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+  800872:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800876:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087e:	eb e6                	jmp    800866 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 19                	ja     8008a1 <vprintfmt+0x4a5>
+  800888:	89 c2                	mov    %eax,%edx
+  80088a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088e:	83 c0 08             	add    $0x8,%eax
+  800891:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800894:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800897:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80089c:	e9 1b 01 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb e5                	jmp    800894 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bb:	e9 56 ff ff ff       	jmp    800816 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c0:	40 84 f6             	test   %sil,%sil
+  8008c3:	75 2e                	jne    8008f3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008c5:	85 d2                	test   %edx,%edx
+  8008c7:	74 59                	je     800922 <vprintfmt+0x526>
+  8008c9:	83 fa 01             	cmp    $0x1,%edx
+  8008cc:	74 7f                	je     80094d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d4:	0f 87 9f 00 00 00    	ja     800979 <vprintfmt+0x57d>
+  8008da:	89 c2                	mov    %eax,%edx
+  8008dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e0:	83 c0 08             	add    $0x8,%eax
+  8008e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ee:	e9 c9 00 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f9:	77 19                	ja     800914 <vprintfmt+0x518>
+  8008fb:	89 c2                	mov    %eax,%edx
+  8008fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800901:	83 c0 08             	add    $0x8,%eax
+  800904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800907:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80090a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090f:	e9 a8 00 00 00       	jmp    8009bc <vprintfmt+0x5c0>
+  800914:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800918:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800920:	eb e5                	jmp    800907 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800922:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800925:	83 f8 2f             	cmp    $0x2f,%eax
+  800928:	77 15                	ja     80093f <vprintfmt+0x543>
+  80092a:	89 c2                	mov    %eax,%edx
+  80092c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800930:	83 c0 08             	add    $0x8,%eax
+  800933:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800936:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800938:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80093d:	eb 7d                	jmp    8009bc <vprintfmt+0x5c0>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e9                	jmp    800936 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 16                	ja     80096b <vprintfmt+0x56f>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800964:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800969:	eb 51                	jmp    8009bc <vprintfmt+0x5c0>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb e8                	jmp    800961 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800979:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800985:	e9 5c ff ff ff       	jmp    8008e6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80098a:	4c 89 ee             	mov    %r13,%rsi
+  80098d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800992:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800995:	4c 89 ee             	mov    %r13,%rsi
+  800998:	bf 78 00 00 00       	mov    $0x78,%edi
+  80099d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a6:	77 47                	ja     8009ef <vprintfmt+0x5f3>
+  8009a8:	89 c2                	mov    %eax,%edx
+  8009aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ae:	83 c0 08             	add    $0x8,%eax
+  8009b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009c4:	0f 94 c0             	sete   %al
+  8009c7:	0f b6 c0             	movzbl %al,%eax
+  8009ca:	50                   	push   %rax
+  8009cb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009d4:	4c 89 ee             	mov    %r13,%rsi
+  8009d7:	4c 89 f7             	mov    %r14,%rdi
+  8009da:	48 b8 f1 02 80 00 00 	movabs $0x8002f1,%rax
+  8009e1:	00 00 00 
+  8009e4:	ff d0                	call   *%rax
+            break;
+  8009e6:	48 83 c4 10          	add    $0x10,%rsp
+  8009ea:	e9 3e fa ff ff       	jmp    80042d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	eb b7                	jmp    8009b4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fd:	40 84 f6             	test   %sil,%sil
+  800a00:	75 2b                	jne    800a2d <vprintfmt+0x631>
+    switch (lflag) {
+  800a02:	85 d2                	test   %edx,%edx
+  800a04:	74 56                	je     800a5c <vprintfmt+0x660>
+  800a06:	83 fa 01             	cmp    $0x1,%edx
+  800a09:	74 7f                	je     800a8a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a11:	0f 87 a2 00 00 00    	ja     800ab9 <vprintfmt+0x6bd>
+  800a17:	89 c2                	mov    %eax,%edx
+  800a19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1d:	83 c0 08             	add    $0x8,%eax
+  800a20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a23:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2b:	eb 8f                	jmp    8009bc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 19                	ja     800a4e <vprintfmt+0x652>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a44:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a49:	e9 6e ff ff ff       	jmp    8009bc <vprintfmt+0x5c0>
+  800a4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5a:	eb e5                	jmp    800a41 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a62:	77 18                	ja     800a7c <vprintfmt+0x680>
+  800a64:	89 c2                	mov    %eax,%edx
+  800a66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6a:	83 c0 08             	add    $0x8,%eax
+  800a6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a70:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a72:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a77:	e9 40 ff ff ff       	jmp    8009bc <vprintfmt+0x5c0>
+  800a7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a88:	eb e6                	jmp    800a70 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	77 19                	ja     800aab <vprintfmt+0x6af>
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a98:	83 c0 08             	add    $0x8,%eax
+  800a9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa6:	e9 11 ff ff ff       	jmp    8009bc <vprintfmt+0x5c0>
+  800aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab7:	eb e5                	jmp    800a9e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ab9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac5:	e9 59 ff ff ff       	jmp    800a23 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800aca:	4c 89 ee             	mov    %r13,%rsi
+  800acd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad2:	41 ff d6             	call   *%r14
+            break;
+  800ad5:	e9 53 f9 ff ff       	jmp    80042d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ada:	4c 89 ee             	mov    %r13,%rsi
+  800add:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ae2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ae5:	48 83 eb 01          	sub    $0x1,%rbx
+  800ae9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aed:	75 f6                	jne    800ae5 <vprintfmt+0x6e9>
+  800aef:	e9 39 f9 ff ff       	jmp    80042d <vprintfmt+0x31>
+}
+  800af4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800af8:	5b                   	pop    %rbx
+  800af9:	41 5c                	pop    %r12
+  800afb:	41 5d                	pop    %r13
+  800afd:	41 5e                	pop    %r14
+  800aff:	41 5f                	pop    %r15
+  800b01:	5d                   	pop    %rbp
+  800b02:	c3                   	ret
+
+0000000000800b03 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b03:	55                   	push   %rbp
+  800b04:	48 89 e5             	mov    %rsp,%rbp
+  800b07:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b0f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b14:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b18:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b1f:	48 85 ff             	test   %rdi,%rdi
+  800b22:	74 2b                	je     800b4f <vsnprintf+0x4c>
+  800b24:	48 85 f6             	test   %rsi,%rsi
+  800b27:	74 26                	je     800b4f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b29:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b2d:	48 bf a7 03 80 00 00 	movabs $0x8003a7,%rdi
+  800b34:	00 00 00 
+  800b37:	48 b8 fc 03 80 00 00 	movabs $0x8003fc,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b47:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b54:	eb f7                	jmp    800b4d <vsnprintf+0x4a>
+
+0000000000800b56 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b56:	55                   	push   %rbp
+  800b57:	48 89 e5             	mov    %rsp,%rbp
+  800b5a:	48 83 ec 50          	sub    $0x50,%rsp
+  800b5e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b62:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b66:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b6a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b71:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b79:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b81:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b85:	48 b8 03 0b 80 00 00 	movabs $0x800b03,%rax
+  800b8c:	00 00 00 
+  800b8f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b91:	c9                   	leave
+  800b92:	c3                   	ret
+
+0000000000800b93 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b93:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b96:	74 10                	je     800ba8 <strlen+0x15>
+    size_t n = 0;
+  800b98:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b9d:	48 83 c0 01          	add    $0x1,%rax
+  800ba1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ba5:	75 f6                	jne    800b9d <strlen+0xa>
+  800ba7:	c3                   	ret
+    size_t n = 0;
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bad:	c3                   	ret
+
+0000000000800bae <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bae:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bb6:	48 85 f6             	test   %rsi,%rsi
+  800bb9:	74 11                	je     800bcc <strnlen+0x1e>
+  800bbb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bbf:	74 0c                	je     800bcd <strnlen+0x1f>
+  800bc1:	48 83 c2 01          	add    $0x1,%rdx
+  800bc5:	48 39 d0             	cmp    %rdx,%rax
+  800bc8:	75 f1                	jne    800bbb <strnlen+0xd>
+  800bca:	eb 04                	jmp    800bd0 <strnlen+0x22>
+  800bcc:	c3                   	ret
+  800bcd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd0:	c3                   	ret
+
+0000000000800bd1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bd1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bdd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be0:	48 83 c2 01          	add    $0x1,%rdx
+  800be4:	84 c9                	test   %cl,%cl
+  800be6:	75 f1                	jne    800bd9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800be8:	c3                   	ret
+
+0000000000800be9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800be9:	55                   	push   %rbp
+  800bea:	48 89 e5             	mov    %rsp,%rbp
+  800bed:	41 54                	push   %r12
+  800bef:	53                   	push   %rbx
+  800bf0:	48 89 fb             	mov    %rdi,%rbx
+  800bf3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bf6:	48 b8 93 0b 80 00 00 	movabs $0x800b93,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c02:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c06:	4c 89 e6             	mov    %r12,%rsi
+  800c09:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  800c10:	00 00 00 
+  800c13:	ff d0                	call   *%rax
+    return dst;
+}
+  800c15:	48 89 d8             	mov    %rbx,%rax
+  800c18:	5b                   	pop    %rbx
+  800c19:	41 5c                	pop    %r12
+  800c1b:	5d                   	pop    %rbp
+  800c1c:	c3                   	ret
+
+0000000000800c1d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c20:	48 85 d2             	test   %rdx,%rdx
+  800c23:	74 1f                	je     800c44 <strncpy+0x27>
+  800c25:	48 01 fa             	add    %rdi,%rdx
+  800c28:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c2b:	48 83 c1 01          	add    $0x1,%rcx
+  800c2f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c33:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c37:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c3b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c3f:	48 39 ca             	cmp    %rcx,%rdx
+  800c42:	75 e7                	jne    800c2b <strncpy+0xe>
+    }
+    return ret;
+}
+  800c44:	c3                   	ret
+
+0000000000800c45 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c45:	48 89 f8             	mov    %rdi,%rax
+  800c48:	48 85 d2             	test   %rdx,%rdx
+  800c4b:	74 24                	je     800c71 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c4d:	48 83 ea 01          	sub    $0x1,%rdx
+  800c51:	74 1b                	je     800c6e <strlcpy+0x29>
+  800c53:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c57:	0f b6 16             	movzbl (%rsi),%edx
+  800c5a:	84 d2                	test   %dl,%dl
+  800c5c:	74 10                	je     800c6e <strlcpy+0x29>
+            *dst++ = *src++;
+  800c5e:	48 83 c6 01          	add    $0x1,%rsi
+  800c62:	48 83 c0 01          	add    $0x1,%rax
+  800c66:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c69:	48 39 c8             	cmp    %rcx,%rax
+  800c6c:	75 e9                	jne    800c57 <strlcpy+0x12>
+        *dst = '\0';
+  800c6e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c71:	48 29 f8             	sub    %rdi,%rax
+}
+  800c74:	c3                   	ret
+
+0000000000800c75 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c75:	0f b6 07             	movzbl (%rdi),%eax
+  800c78:	84 c0                	test   %al,%al
+  800c7a:	74 13                	je     800c8f <strcmp+0x1a>
+  800c7c:	38 06                	cmp    %al,(%rsi)
+  800c7e:	75 0f                	jne    800c8f <strcmp+0x1a>
+  800c80:	48 83 c7 01          	add    $0x1,%rdi
+  800c84:	48 83 c6 01          	add    $0x1,%rsi
+  800c88:	0f b6 07             	movzbl (%rdi),%eax
+  800c8b:	84 c0                	test   %al,%al
+  800c8d:	75 ed                	jne    800c7c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c8f:	0f b6 c0             	movzbl %al,%eax
+  800c92:	0f b6 16             	movzbl (%rsi),%edx
+  800c95:	29 d0                	sub    %edx,%eax
+}
+  800c97:	c3                   	ret
+
+0000000000800c98 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c98:	48 85 d2             	test   %rdx,%rdx
+  800c9b:	74 1f                	je     800cbc <strncmp+0x24>
+  800c9d:	0f b6 07             	movzbl (%rdi),%eax
+  800ca0:	84 c0                	test   %al,%al
+  800ca2:	74 1e                	je     800cc2 <strncmp+0x2a>
+  800ca4:	3a 06                	cmp    (%rsi),%al
+  800ca6:	75 1a                	jne    800cc2 <strncmp+0x2a>
+  800ca8:	48 83 c7 01          	add    $0x1,%rdi
+  800cac:	48 83 c6 01          	add    $0x1,%rsi
+  800cb0:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb4:	75 e7                	jne    800c9d <strncmp+0x5>
+
+    if (!n) return 0;
+  800cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbb:	c3                   	ret
+  800cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc1:	c3                   	ret
+  800cc2:	48 85 d2             	test   %rdx,%rdx
+  800cc5:	74 09                	je     800cd0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc7:	0f b6 07             	movzbl (%rdi),%eax
+  800cca:	0f b6 16             	movzbl (%rsi),%edx
+  800ccd:	29 d0                	sub    %edx,%eax
+  800ccf:	c3                   	ret
+    if (!n) return 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cd6:	0f b6 17             	movzbl (%rdi),%edx
+  800cd9:	84 d2                	test   %dl,%dl
+  800cdb:	74 18                	je     800cf5 <strchr+0x1f>
+        if (*str == c) {
+  800cdd:	0f be d2             	movsbl %dl,%edx
+  800ce0:	39 f2                	cmp    %esi,%edx
+  800ce2:	74 17                	je     800cfb <strchr+0x25>
+    for (; *str; str++) {
+  800ce4:	48 83 c7 01          	add    $0x1,%rdi
+  800ce8:	0f b6 17             	movzbl (%rdi),%edx
+  800ceb:	84 d2                	test   %dl,%dl
+  800ced:	75 ee                	jne    800cdd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf4:	c3                   	ret
+  800cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfa:	c3                   	ret
+  800cfb:	48 89 f8             	mov    %rdi,%rax
+}
+  800cfe:	c3                   	ret
+
+0000000000800cff <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cff:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d02:	0f b6 17             	movzbl (%rdi),%edx
+  800d05:	84 d2                	test   %dl,%dl
+  800d07:	74 13                	je     800d1c <strfind+0x1d>
+  800d09:	0f be d2             	movsbl %dl,%edx
+  800d0c:	39 f2                	cmp    %esi,%edx
+  800d0e:	74 0b                	je     800d1b <strfind+0x1c>
+  800d10:	48 83 c0 01          	add    $0x1,%rax
+  800d14:	0f b6 10             	movzbl (%rax),%edx
+  800d17:	84 d2                	test   %dl,%dl
+  800d19:	75 ee                	jne    800d09 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d1b:	c3                   	ret
+  800d1c:	c3                   	ret
+
+0000000000800d1d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d1d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d20:	48 89 f8             	mov    %rdi,%rax
+  800d23:	48 f7 d8             	neg    %rax
+  800d26:	83 e0 07             	and    $0x7,%eax
+  800d29:	49 89 d1             	mov    %rdx,%r9
+  800d2c:	49 29 c1             	sub    %rax,%r9
+  800d2f:	78 36                	js     800d67 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d31:	40 0f b6 c6          	movzbl %sil,%eax
+  800d35:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d3c:	01 01 01 
+  800d3f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d43:	40 f6 c7 07          	test   $0x7,%dil
+  800d47:	75 38                	jne    800d81 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d49:	4c 89 c9             	mov    %r9,%rcx
+  800d4c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d50:	74 0c                	je     800d5e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d52:	fc                   	cld
+  800d53:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d56:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d5a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d5e:	4d 85 c9             	test   %r9,%r9
+  800d61:	75 45                	jne    800da8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d63:	4c 89 c0             	mov    %r8,%rax
+  800d66:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d67:	48 85 d2             	test   %rdx,%rdx
+  800d6a:	74 f7                	je     800d63 <memset+0x46>
+  800d6c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d6f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d72:	48 83 c0 01          	add    $0x1,%rax
+  800d76:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d7a:	48 39 c2             	cmp    %rax,%rdx
+  800d7d:	75 f3                	jne    800d72 <memset+0x55>
+  800d7f:	eb e2                	jmp    800d63 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d81:	40 f6 c7 01          	test   $0x1,%dil
+  800d85:	74 06                	je     800d8d <memset+0x70>
+  800d87:	88 07                	mov    %al,(%rdi)
+  800d89:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d8d:	40 f6 c7 02          	test   $0x2,%dil
+  800d91:	74 07                	je     800d9a <memset+0x7d>
+  800d93:	66 89 07             	mov    %ax,(%rdi)
+  800d96:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d9a:	40 f6 c7 04          	test   $0x4,%dil
+  800d9e:	74 a9                	je     800d49 <memset+0x2c>
+  800da0:	89 07                	mov    %eax,(%rdi)
+  800da2:	48 83 c7 04          	add    $0x4,%rdi
+  800da6:	eb a1                	jmp    800d49 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da8:	41 f6 c1 04          	test   $0x4,%r9b
+  800dac:	74 06                	je     800db4 <memset+0x97>
+  800dae:	89 07                	mov    %eax,(%rdi)
+  800db0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800db4:	41 f6 c1 02          	test   $0x2,%r9b
+  800db8:	74 07                	je     800dc1 <memset+0xa4>
+  800dba:	66 89 07             	mov    %ax,(%rdi)
+  800dbd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dc1:	41 f6 c1 01          	test   $0x1,%r9b
+  800dc5:	74 9c                	je     800d63 <memset+0x46>
+  800dc7:	88 07                	mov    %al,(%rdi)
+  800dc9:	eb 98                	jmp    800d63 <memset+0x46>
+
+0000000000800dcb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dcb:	48 89 f8             	mov    %rdi,%rax
+  800dce:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dd1:	48 39 fe             	cmp    %rdi,%rsi
+  800dd4:	73 3b                	jae    800e11 <memmove+0x46>
+  800dd6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dda:	48 39 d7             	cmp    %rdx,%rdi
+  800ddd:	73 32                	jae    800e11 <memmove+0x46>
+        s += n;
+        d += n;
+  800ddf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de3:	48 89 d6             	mov    %rdx,%rsi
+  800de6:	48 09 fe             	or     %rdi,%rsi
+  800de9:	48 09 ce             	or     %rcx,%rsi
+  800dec:	40 f6 c6 07          	test   $0x7,%sil
+  800df0:	75 12                	jne    800e04 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800df2:	48 83 ef 08          	sub    $0x8,%rdi
+  800df6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dfa:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dfe:	fd                   	std
+  800dff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e02:	fc                   	cld
+  800e03:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e04:	48 83 ef 01          	sub    $0x1,%rdi
+  800e08:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e0c:	fd                   	std
+  800e0d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e0f:	eb f1                	jmp    800e02 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e11:	48 89 f2             	mov    %rsi,%rdx
+  800e14:	48 09 c2             	or     %rax,%rdx
+  800e17:	48 09 ca             	or     %rcx,%rdx
+  800e1a:	f6 c2 07             	test   $0x7,%dl
+  800e1d:	75 0c                	jne    800e2b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e1f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e23:	48 89 c7             	mov    %rax,%rdi
+  800e26:	fc                   	cld
+  800e27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e2a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e2b:	48 89 c7             	mov    %rax,%rdi
+  800e2e:	fc                   	cld
+  800e2f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e31:	c3                   	ret
+
+0000000000800e32 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e32:	55                   	push   %rbp
+  800e33:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e36:	48 b8 cb 0d 80 00 00 	movabs $0x800dcb,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+}
+  800e42:	5d                   	pop    %rbp
+  800e43:	c3                   	ret
+
+0000000000800e44 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e44:	55                   	push   %rbp
+  800e45:	48 89 e5             	mov    %rsp,%rbp
+  800e48:	41 57                	push   %r15
+  800e4a:	41 56                	push   %r14
+  800e4c:	41 55                	push   %r13
+  800e4e:	41 54                	push   %r12
+  800e50:	53                   	push   %rbx
+  800e51:	48 83 ec 08          	sub    $0x8,%rsp
+  800e55:	49 89 fe             	mov    %rdi,%r14
+  800e58:	49 89 f7             	mov    %rsi,%r15
+  800e5b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e5e:	48 89 f7             	mov    %rsi,%rdi
+  800e61:	48 b8 93 0b 80 00 00 	movabs $0x800b93,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+  800e6d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e70:	48 89 de             	mov    %rbx,%rsi
+  800e73:	4c 89 f7             	mov    %r14,%rdi
+  800e76:	48 b8 ae 0b 80 00 00 	movabs $0x800bae,%rax
+  800e7d:	00 00 00 
+  800e80:	ff d0                	call   *%rax
+  800e82:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e85:	48 39 c3             	cmp    %rax,%rbx
+  800e88:	74 36                	je     800ec0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e8a:	48 89 d8             	mov    %rbx,%rax
+  800e8d:	4c 29 e8             	sub    %r13,%rax
+  800e90:	49 39 c4             	cmp    %rax,%r12
+  800e93:	73 31                	jae    800ec6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e95:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e9a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e9e:	4c 89 fe             	mov    %r15,%rsi
+  800ea1:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ead:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eb1:	48 83 c4 08          	add    $0x8,%rsp
+  800eb5:	5b                   	pop    %rbx
+  800eb6:	41 5c                	pop    %r12
+  800eb8:	41 5d                	pop    %r13
+  800eba:	41 5e                	pop    %r14
+  800ebc:	41 5f                	pop    %r15
+  800ebe:	5d                   	pop    %rbp
+  800ebf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ec0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec4:	eb eb                	jmp    800eb1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ec6:	48 83 eb 01          	sub    $0x1,%rbx
+  800eca:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ece:	48 89 da             	mov    %rbx,%rdx
+  800ed1:	4c 89 fe             	mov    %r15,%rsi
+  800ed4:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  800edb:	00 00 00 
+  800ede:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ee0:	49 01 de             	add    %rbx,%r14
+  800ee3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ee8:	eb c3                	jmp    800ead <strlcat+0x69>
+
+0000000000800eea <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eea:	48 85 d2             	test   %rdx,%rdx
+  800eed:	74 2d                	je     800f1c <memcmp+0x32>
+  800eef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ef4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ef8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800efd:	44 38 c1             	cmp    %r8b,%cl
+  800f00:	75 0f                	jne    800f11 <memcmp+0x27>
+    while (n-- > 0) {
+  800f02:	48 83 c0 01          	add    $0x1,%rax
+  800f06:	48 39 c2             	cmp    %rax,%rdx
+  800f09:	75 e9                	jne    800ef4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f10:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f11:	0f b6 c1             	movzbl %cl,%eax
+  800f14:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f18:	44 29 c0             	sub    %r8d,%eax
+  800f1b:	c3                   	ret
+    return 0;
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f21:	c3                   	ret
+
+0000000000800f22 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f22:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f26:	48 39 c7             	cmp    %rax,%rdi
+  800f29:	73 0f                	jae    800f3a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f2b:	40 38 37             	cmp    %sil,(%rdi)
+  800f2e:	74 0e                	je     800f3e <memfind+0x1c>
+    for (; src < end; src++) {
+  800f30:	48 83 c7 01          	add    $0x1,%rdi
+  800f34:	48 39 f8             	cmp    %rdi,%rax
+  800f37:	75 f2                	jne    800f2b <memfind+0x9>
+  800f39:	c3                   	ret
+  800f3a:	48 89 f8             	mov    %rdi,%rax
+  800f3d:	c3                   	ret
+  800f3e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f41:	c3                   	ret
+
+0000000000800f42 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f42:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f45:	0f b6 37             	movzbl (%rdi),%esi
+  800f48:	40 80 fe 20          	cmp    $0x20,%sil
+  800f4c:	74 06                	je     800f54 <strtol+0x12>
+  800f4e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f52:	75 13                	jne    800f67 <strtol+0x25>
+  800f54:	48 83 c7 01          	add    $0x1,%rdi
+  800f58:	0f b6 37             	movzbl (%rdi),%esi
+  800f5b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f5f:	74 f3                	je     800f54 <strtol+0x12>
+  800f61:	40 80 fe 09          	cmp    $0x9,%sil
+  800f65:	74 ed                	je     800f54 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f67:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f6a:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f6d:	3c 01                	cmp    $0x1,%al
+  800f6f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f73:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f79:	75 0f                	jne    800f8a <strtol+0x48>
+  800f7b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f7e:	74 14                	je     800f94 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f80:	85 d2                	test   %edx,%edx
+  800f82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f87:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f8f:	4c 63 ca             	movslq %edx,%r9
+  800f92:	eb 36                	jmp    800fca <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f94:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f98:	74 0f                	je     800fa9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f9a:	85 d2                	test   %edx,%edx
+  800f9c:	75 ec                	jne    800f8a <strtol+0x48>
+        s++;
+  800f9e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fa2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fa7:	eb e1                	jmp    800f8a <strtol+0x48>
+        s += 2;
+  800fa9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fad:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fb2:	eb d6                	jmp    800f8a <strtol+0x48>
+            dig -= '0';
+  800fb4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fb7:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fbb:	41 39 d0             	cmp    %edx,%r8d
+  800fbe:	7d 21                	jge    800fe1 <strtol+0x9f>
+        val = val * base + dig;
+  800fc0:	49 0f af c1          	imul   %r9,%rax
+  800fc4:	0f b6 c9             	movzbl %cl,%ecx
+  800fc7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fca:	48 83 c7 01          	add    $0x1,%rdi
+  800fce:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fd2:	80 f9 39             	cmp    $0x39,%cl
+  800fd5:	76 dd                	jbe    800fb4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fd7:	80 f9 7b             	cmp    $0x7b,%cl
+  800fda:	77 05                	ja     800fe1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fdc:	83 e9 57             	sub    $0x57,%ecx
+  800fdf:	eb d6                	jmp    800fb7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fe1:	4d 85 d2             	test   %r10,%r10
+  800fe4:	74 03                	je     800fe9 <strtol+0xa7>
+  800fe6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fe9:	48 89 c2             	mov    %rax,%rdx
+  800fec:	48 f7 da             	neg    %rdx
+  800fef:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800ff3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800ff7:	c3                   	ret
+
+0000000000800ff8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ff8:	55                   	push   %rbp
+  800ff9:	48 89 e5             	mov    %rsp,%rbp
+  800ffc:	53                   	push   %rbx
+  800ffd:	48 89 fa             	mov    %rdi,%rdx
+  801000:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801008:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801012:	be 00 00 00 00       	mov    $0x0,%esi
+  801017:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80101d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80101f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801023:	c9                   	leave
+  801024:	c3                   	ret
+
+0000000000801025 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801025:	55                   	push   %rbp
+  801026:	48 89 e5             	mov    %rsp,%rbp
+  801029:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80102a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801034:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801039:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801043:	be 00 00 00 00       	mov    $0x0,%esi
+  801048:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801050:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801054:	c9                   	leave
+  801055:	c3                   	ret
+
+0000000000801056 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801056:	55                   	push   %rbp
+  801057:	48 89 e5             	mov    %rsp,%rbp
+  80105a:	53                   	push   %rbx
+  80105b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80105f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801062:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801067:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801076:	be 00 00 00 00       	mov    $0x0,%esi
+  80107b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801081:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801083:	48 85 c0             	test   %rax,%rax
+  801086:	7f 06                	jg     80108e <sys_env_destroy+0x38>
+}
+  801088:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108c:	c9                   	leave
+  80108d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80108e:	49 89 c0             	mov    %rax,%r8
+  801091:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801096:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  80109d:	00 00 00 
+  8010a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8010a5:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8010ac:	00 00 00 
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  8010bb:	00 00 00 
+  8010be:	41 ff d1             	call   *%r9
+
+00000000008010c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010c1:	55                   	push   %rbp
+  8010c2:	48 89 e5             	mov    %rsp,%rbp
+  8010c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010df:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+00000000008010f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+  8010f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801106:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801110:	be 00 00 00 00       	mov    $0x0,%esi
+  801115:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80111d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801121:	c9                   	leave
+  801122:	c3                   	ret
+
+0000000000801123 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801123:	55                   	push   %rbp
+  801124:	48 89 e5             	mov    %rsp,%rbp
+  801127:	53                   	push   %rbx
+  801128:	48 89 fa             	mov    %rdi,%rdx
+  80112b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80112e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801133:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80113a:	00 00 00 
+  80113d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801142:	be 00 00 00 00       	mov    $0x0,%esi
+  801147:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	53                   	push   %rbx
+  80115a:	49 89 f8             	mov    %rdi,%r8
+  80115d:	48 89 d3             	mov    %rdx,%rbx
+  801160:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801163:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801168:	4c 89 c2             	mov    %r8,%rdx
+  80116b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116e:	be 00 00 00 00       	mov    $0x0,%esi
+  801173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801179:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80117b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117f:	c9                   	leave
+  801180:	c3                   	ret
+
+0000000000801181 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801181:	55                   	push   %rbp
+  801182:	48 89 e5             	mov    %rsp,%rbp
+  801185:	53                   	push   %rbx
+  801186:	48 83 ec 08          	sub    $0x8,%rsp
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80118f:	48 63 f9             	movslq %ecx,%rdi
+  801192:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801195:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011aa:	48 85 c0             	test   %rax,%rax
+  8011ad:	7f 06                	jg     8011b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b5:	49 89 c0             	mov    %rax,%r8
+  8011b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011bd:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8011c4:	00 00 00 
+  8011c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8011cc:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8011d3:	00 00 00 
+  8011d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011db:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  8011e2:	00 00 00 
+  8011e5:	41 ff d1             	call   *%r9
+
+00000000008011e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e8:	55                   	push   %rbp
+  8011e9:	48 89 e5             	mov    %rsp,%rbp
+  8011ec:	53                   	push   %rbx
+  8011ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8011f1:	89 f8                	mov    %edi,%eax
+  8011f3:	49 89 f2             	mov    %rsi,%r10
+  8011f6:	48 89 cf             	mov    %rcx,%rdi
+  8011f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011fc:	48 63 da             	movslq %edx,%rbx
+  8011ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801202:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801207:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80120d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120f:	48 85 c0             	test   %rax,%rax
+  801212:	7f 06                	jg     80121a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121a:	49 89 c0             	mov    %rax,%r8
+  80121d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801222:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801229:	00 00 00 
+  80122c:	be 26 00 00 00       	mov    $0x26,%esi
+  801231:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801238:	00 00 00 
+  80123b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801240:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801247:	00 00 00 
+  80124a:	41 ff d1             	call   *%r9
+
+000000000080124d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	53                   	push   %rbx
+  801252:	48 83 ec 08          	sub    $0x8,%rsp
+  801256:	49 89 f9             	mov    %rdi,%r9
+  801259:	89 f0                	mov    %esi,%eax
+  80125b:	48 89 d3             	mov    %rdx,%rbx
+  80125e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801261:	49 63 f0             	movslq %r8d,%rsi
+  801264:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801267:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801275:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801277:	48 85 c0             	test   %rax,%rax
+  80127a:	7f 06                	jg     801282 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80127c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801280:	c9                   	leave
+  801281:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801282:	49 89 c0             	mov    %rax,%r8
+  801285:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80128a:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801291:	00 00 00 
+  801294:	be 26 00 00 00       	mov    $0x26,%esi
+  801299:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8012a0:	00 00 00 
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  8012af:	00 00 00 
+  8012b2:	41 ff d1             	call   *%r9
+
+00000000008012b5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+  8012b9:	53                   	push   %rbx
+  8012ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8012be:	48 89 f1             	mov    %rsi,%rcx
+  8012c1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012de:	48 85 c0             	test   %rax,%rax
+  8012e1:	7f 06                	jg     8012e9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e7:	c9                   	leave
+  8012e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e9:	49 89 c0             	mov    %rax,%r8
+  8012ec:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8012f1:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8012f8:	00 00 00 
+  8012fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801300:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801307:	00 00 00 
+  80130a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130f:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801316:	00 00 00 
+  801319:	41 ff d1             	call   *%r9
+
+000000000080131c <sys_exothread>:
+
+/* sys_exofork is inlined in lib.h */
+
+envid_t
+sys_exothread(void *xstacktop) {
+  80131c:	55                   	push   %rbp
+  80131d:	48 89 e5             	mov    %rsp,%rbp
+  801320:	53                   	push   %rbx
+  801321:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801324:	b8 1d 00 00 00       	mov    $0x1d,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801329:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801333:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801338:	be 00 00 00 00       	mov    $0x0,%esi
+  80133d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801343:	cd 30                	int    $0x30
+    return syscall(SYS_exothread, 0, (uintptr_t)xstacktop, 0, 0, 0, 0, 0);
+}
+  801345:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801349:	c9                   	leave
+  80134a:	c3                   	ret
+
+000000000080134b <sys_env_set_tls>:
+
+int
+sys_env_set_tls(envid_t envid, void *tls) {
+  80134b:	55                   	push   %rbp
+  80134c:	48 89 e5             	mov    %rsp,%rbp
+  80134f:	53                   	push   %rbx
+  801350:	48 83 ec 08          	sub    $0x8,%rsp
+  801354:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_tls, 1, envid, (uintptr_t)tls, 0, 0, 0, 0);
+  801357:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801369:	be 00 00 00 00       	mov    $0x0,%esi
+  80136e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801374:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801376:	48 85 c0             	test   %rax,%rax
+  801379:	7f 06                	jg     801381 <sys_env_set_tls+0x36>
+}
+  80137b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137f:	c9                   	leave
+  801380:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801381:	49 89 c0             	mov    %rax,%r8
+  801384:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  801389:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801390:	00 00 00 
+  801393:	be 26 00 00 00       	mov    $0x26,%esi
+  801398:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80139f:	00 00 00 
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a7:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  8013ae:	00 00 00 
+  8013b1:	41 ff d1             	call   *%r9
+
+00000000008013b4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013b4:	55                   	push   %rbp
+  8013b5:	48 89 e5             	mov    %rsp,%rbp
+  8013b8:	53                   	push   %rbx
+  8013b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013bd:	48 63 ce             	movslq %esi,%rcx
+  8013c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013df:	48 85 c0             	test   %rax,%rax
+  8013e2:	7f 06                	jg     8013ea <sys_env_set_status+0x36>
+}
+  8013e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e8:	c9                   	leave
+  8013e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ea:	49 89 c0             	mov    %rax,%r8
+  8013ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013f2:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8013f9:	00 00 00 
+  8013fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801401:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801408:	00 00 00 
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801410:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801417:	00 00 00 
+  80141a:	41 ff d1             	call   *%r9
+
+000000000080141d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int class, int priority) {
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+  801421:	53                   	push   %rbx
+  801422:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_priority, 1, envid, class, priority, 0, 0, 0);
+  801426:	48 63 da             	movslq %edx,%rbx
+  801429:	48 63 ce             	movslq %esi,%rcx
+  80142c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801439:	be 00 00 00 00       	mov    $0x0,%esi
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801446:	48 85 c0             	test   %rax,%rax
+  801449:	7f 06                	jg     801451 <sys_env_set_priority+0x34>
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801451:	49 89 c0             	mov    %rax,%r8
+  801454:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801459:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801460:	00 00 00 
+  801463:	be 26 00 00 00       	mov    $0x26,%esi
+  801468:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  80146f:	00 00 00 
+  801472:	b8 00 00 00 00       	mov    $0x0,%eax
+  801477:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  80147e:	00 00 00 
+  801481:	41 ff d1             	call   *%r9
+
+0000000000801484 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801484:	55                   	push   %rbp
+  801485:	48 89 e5             	mov    %rsp,%rbp
+  801488:	53                   	push   %rbx
+  801489:	48 83 ec 08          	sub    $0x8,%rsp
+  80148d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801490:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801493:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801498:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014af:	48 85 c0             	test   %rax,%rax
+  8014b2:	7f 06                	jg     8014ba <sys_env_set_trapframe+0x36>
+}
+  8014b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b8:	c9                   	leave
+  8014b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ba:	49 89 c0             	mov    %rax,%r8
+  8014bd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014c2:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  8014c9:	00 00 00 
+  8014cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d1:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  8014d8:	00 00 00 
+  8014db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e0:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  8014e7:	00 00 00 
+  8014ea:	41 ff d1             	call   *%r9
+
+00000000008014ed <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014ed:	55                   	push   %rbp
+  8014ee:	48 89 e5             	mov    %rsp,%rbp
+  8014f1:	53                   	push   %rbx
+  8014f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014f9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801506:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150b:	be 00 00 00 00       	mov    $0x0,%esi
+  801510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801516:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801518:	48 85 c0             	test   %rax,%rax
+  80151b:	7f 06                	jg     801523 <sys_env_set_pgfault_upcall+0x36>
+}
+  80151d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801521:	c9                   	leave
+  801522:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801523:	49 89 c0             	mov    %rax,%r8
+  801526:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80152b:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801532:	00 00 00 
+  801535:	be 26 00 00 00       	mov    $0x26,%esi
+  80153a:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801541:	00 00 00 
+  801544:	b8 00 00 00 00       	mov    $0x0,%eax
+  801549:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801550:	00 00 00 
+  801553:	41 ff d1             	call   *%r9
+
+0000000000801556 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	53                   	push   %rbx
+  80155b:	89 f8                	mov    %edi,%eax
+  80155d:	49 89 f1             	mov    %rsi,%r9
+  801560:	48 89 d3             	mov    %rdx,%rbx
+  801563:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801566:	49 63 f0             	movslq %r8d,%rsi
+  801569:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801571:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801574:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157a:	cd 30                	int    $0x30
+}
+  80157c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801580:	c9                   	leave
+  801581:	c3                   	ret
+
+0000000000801582 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, const uint64_t *words) {
+  801582:	55                   	push   %rbp
+  801583:	48 89 e5             	mov    %rsp,%rbp
+  801586:	41 55                	push   %r13
+  801588:	41 54                	push   %r12
+  80158a:	53                   	push   %rbx
+  80158b:	89 f8                	mov    %edi,%eax
+  80158d:	49 89 f2             	mov    %rsi,%r10
+  801590:	48 89 d3             	mov    %rdx,%rbx
+  801593:	48 89 cf             	mov    %rcx,%rdi
+  801596:	4d 89 cb             	mov    %r9,%r11
+    return syscall_words(SYS_ipc_send, envid, value, (uintptr_t)srcva, size, perm, 0, words);
+  801599:	49 63 f0             	movslq %r8d,%rsi
+  80159c:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  80159f:	4d 85 c9             	test   %r9,%r9
+  8015a2:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8015a9:	00 00 00 
+  8015ac:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8015b0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8015b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8015be:	4d 8b 0b             	mov    (%r11),%r9
+  8015c1:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8015c5:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8015c9:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8015cd:	cd 30                	int    $0x30
+}
+  8015cf:	5b                   	pop    %rbx
+  8015d0:	41 5c                	pop    %r12
+  8015d2:	41 5d                	pop    %r13
+  8015d4:	5d                   	pop    %rbp
+  8015d5:	c3                   	ret
+
+00000000008015d6 <sys_ipc_sendv>:
+
+int
+sys_ipc_sendv(struct IpcVec *vec, size_t n) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+  8015da:	53                   	push   %rbx
+  8015db:	48 89 fa             	mov    %rdi,%rdx
+  8015de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e1:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    return syscall(SYS_ipc_sendv, 0, (uintptr_t)vec, n, 0, 0, 0, 0);
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+0000000000801603 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	53                   	push   %rbx
+  801608:	48 83 ec 08          	sub    $0x8,%rsp
+  80160c:	48 89 fa             	mov    %rdi,%rdx
+  80160f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801617:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801621:	be 00 00 00 00       	mov    $0x0,%esi
+  801626:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162e:	48 85 c0             	test   %rax,%rax
+  801631:	7f 06                	jg     801639 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801633:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801639:	49 89 c0             	mov    %rax,%r8
+  80163c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801641:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801648:	00 00 00 
+  80164b:	be 26 00 00 00       	mov    $0x26,%esi
+  801650:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801657:	00 00 00 
+  80165a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165f:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801666:	00 00 00 
+  801669:	41 ff d1             	call   *%r9
+
+000000000080166c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	41 55                	push   %r13
+  801672:	41 54                	push   %r12
+  801674:	53                   	push   %rbx
+  801675:	89 f8                	mov    %edi,%eax
+  801677:	49 89 f2             	mov    %rsi,%r10
+  80167a:	48 89 d3             	mov    %rdx,%rbx
+  80167d:	48 89 cf             	mov    %rcx,%rdi
+  801680:	44 89 c6             	mov    %r8d,%esi
+  801683:	4d 89 c8             	mov    %r9,%r8
+  801686:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_call, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  80168a:	48 63 f6             	movslq %esi,%rsi
+  80168d:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  801690:	4d 85 db             	test   %r11,%r11
+  801693:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  80169a:	00 00 00 
+  80169d:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016a1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a6:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016a9:	4d 8b 0b             	mov    (%r11),%r9
+  8016ac:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  8016b0:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  8016b4:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  8016b8:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016ba:	5b                   	pop    %rbx
+  8016bb:	41 5c                	pop    %r12
+  8016bd:	41 5d                	pop    %r13
+  8016bf:	5d                   	pop    %rbp
+  8016c0:	c3                   	ret
+
+00000000008016c1 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, const uint64_t *words) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	41 55                	push   %r13
+  8016c7:	41 54                	push   %r12
+  8016c9:	53                   	push   %rbx
+  8016ca:	89 f8                	mov    %edi,%eax
+  8016cc:	49 89 f2             	mov    %rsi,%r10
+  8016cf:	48 89 d3             	mov    %rdx,%rbx
+  8016d2:	48 89 cf             	mov    %rcx,%rdi
+  8016d5:	44 89 c6             	mov    %r8d,%esi
+  8016d8:	4d 89 c8             	mov    %r9,%r8
+  8016db:	4c 8b 5d 10          	mov    0x10(%rbp),%r11
+    int res = syscall_words(SYS_ipc_reply_wait, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, words);
+  8016df:	48 63 f6             	movslq %esi,%rsi
+  8016e2:	48 63 d0             	movslq %eax,%rdx
+    if (!words) words = zero_words;
+  8016e5:	4d 85 db             	test   %r11,%r11
+  8016e8:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  8016ef:	00 00 00 
+  8016f2:	4c 0f 44 d8          	cmove  %rax,%r11
+    register uintptr_t _a0 asm("rax") = num,
+  8016f6:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fb:	4c 89 d1             	mov    %r10,%rcx
+                           _w0 asm("r9") = words[0], _w1 asm("r10") = words[1],
+  8016fe:	4d 8b 0b             	mov    (%r11),%r9
+  801701:	4d 8b 53 08          	mov    0x8(%r11),%r10
+                           _w2 asm("r12") = words[2], _w3 asm("r13") = words[3];
+  801705:	4d 8b 63 10          	mov    0x10(%r11),%r12
+  801709:	4d 8b 6b 18          	mov    0x18(%r11),%r13
+    asm volatile("int %1\n"
+  80170d:	cd 30                	int    $0x30
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80170f:	5b                   	pop    %rbx
+  801710:	41 5c                	pop    %r12
+  801712:	41 5d                	pop    %r13
+  801714:	5d                   	pop    %rbp
+  801715:	c3                   	ret
+
+0000000000801716 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, size_t size, uint64_t deadline) {
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+  80171a:	53                   	push   %rbx
+  80171b:	48 83 ec 08          	sub    $0x8,%rsp
+  80171f:	48 89 f1             	mov    %rsi,%rcx
+  801722:	48 89 d3             	mov    %rdx,%rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801725:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80172a:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801732:	be 00 00 00 00       	mov    $0x0,%esi
+  801737:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173f:	48 85 c0             	test   %rax,%rax
+  801742:	7f 06                	jg     80174a <sys_ipc_recv_timeout+0x34>
+    int res = syscall(SYS_ipc_recv_timeout, 1, (uintptr_t)dstva, size, deadline, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801744:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801748:	c9                   	leave
+  801749:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174a:	49 89 c0             	mov    %rax,%r8
+  80174d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801752:	48 ba d8 55 80 00 00 	movabs $0x8055d8,%rdx
+  801759:	00 00 00 
+  80175c:	be 26 00 00 00       	mov    $0x26,%esi
+  801761:	48 bf f7 55 80 00 00 	movabs $0x8055f7,%rdi
+  801768:	00 00 00 
+  80176b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801770:	49 b9 98 3a 80 00 00 	movabs $0x803a98,%r9
+  801777:	00 00 00 
+  80177a:	41 ff d1             	call   *%r9
+
+000000000080177d <sys_sleep_until>:
+
+int
+sys_sleep_until(uint64_t deadline) {
+  80177d:	55                   	push   %rbp
+  80177e:	48 89 e5             	mov    %rsp,%rbp
+  801781:	53                   	push   %rbx
+  801782:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801785:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80178a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801794:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801799:	be 00 00 00 00       	mov    $0x0,%esi
+  80179e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a4:	cd 30                	int    $0x30
+    return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0, 0);
+}
+  8017a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+00000000008017ac <sys_notify_wait>:
+
+int
+sys_notify_wait(const volatile uint32_t *addr, uint32_t expected) {
+  8017ac:	55                   	push   %rbp
+  8017ad:	48 89 e5             	mov    %rsp,%rbp
+  8017b0:	53                   	push   %rbx
+  8017b1:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_notify_wait, 0, (uintptr_t)addr, expected, 0, 0, 0, 0);
+  8017b4:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b6:	b8 19 00 00 00       	mov    $0x19,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d0:	cd 30                	int    $0x30
+}
+  8017d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+00000000008017d8 <sys_notify>:
+
+int
+sys_notify(envid_t envid, const volatile uint32_t *addr) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+  8017dc:	53                   	push   %rbx
+  8017dd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_notify, 0, envid, (uintptr_t)addr, 0, 0, 0, 0);
+  8017e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fd:	cd 30                	int    $0x30
+}
+  8017ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801803:	c9                   	leave
+  801804:	c3                   	ret
+
+0000000000801805 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, uint64_t deadline) {
+  801805:	55                   	push   %rbp
+  801806:	48 89 e5             	mov    %rsp,%rbp
+  801809:	53                   	push   %rbx
+  80180a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, deadline, 0, 0, 0);
+  80180d:	89 f1                	mov    %esi,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80180f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801814:	48 89 fa             	mov    %rdi,%rdx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801817:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181c:	be 00 00 00 00       	mov    $0x0,%esi
+  801821:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801827:	cd 30                	int    $0x30
+}
+  801829:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+
+000000000080182f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	53                   	push   %rbx
+  801834:	48 89 fa             	mov    %rdi,%rdx
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801837:	48 63 ce             	movslq %esi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80183a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80183f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801844:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801849:	be 00 00 00 00       	mov    $0x0,%esi
+  80184e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801854:	cd 30                	int    $0x30
+}
+  801856:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80185a:	c9                   	leave
+  80185b:	c3                   	ret
+
+000000000080185c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801861:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801870:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801875:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187a:	be 00 00 00 00       	mov    $0x0,%esi
+  80187f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801885:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+000000000080188d <sys_monitor>:
+
+int sys_monitor(void) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801892:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801897:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b6:	cd 30                	int    $0x30
+    return syscall(SYS_monitor, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018bc:	c9                   	leave
+  8018bd:	c3                   	ret
+
+00000000008018be <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018be:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018c5:	ff ff ff 
+  8018c8:	48 01 f8             	add    %rdi,%rax
+  8018cb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018cf:	c3                   	ret
+
+00000000008018d0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018d0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018d7:	ff ff ff 
+  8018da:	48 01 f8             	add    %rdi,%rax
+  8018dd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018e1:	48 c1 e0 12          	shl    $0x12,%rax
+  8018e5:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8018ea:	48 01 d0             	add    %rdx,%rax
+}
+  8018ed:	c3                   	ret
+
+00000000008018ee <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 57                	push   %r15
+  8018f4:	41 56                	push   %r14
+  8018f6:	41 55                	push   %r13
+  8018f8:	41 54                	push   %r12
+  8018fa:	53                   	push   %rbx
+  8018fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ff:	49 89 ff             	mov    %rdi,%r15
+  801902:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801907:	49 bd 8c 35 80 00 00 	movabs $0x80358c,%r13
+  80190e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801911:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801917:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80191a:	48 89 df             	mov    %rbx,%rdi
+  80191d:	41 ff d5             	call   *%r13
+  801920:	83 e0 04             	and    $0x4,%eax
+  801923:	74 17                	je     80193c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801925:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80192c:	4c 39 f3             	cmp    %r14,%rbx
+  80192f:	75 e6                	jne    801917 <fd_alloc+0x29>
+  801931:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801937:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80193c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80193f:	48 83 c4 08          	add    $0x8,%rsp
+  801943:	5b                   	pop    %rbx
+  801944:	41 5c                	pop    %r12
+  801946:	41 5d                	pop    %r13
+  801948:	41 5e                	pop    %r14
+  80194a:	41 5f                	pop    %r15
+  80194c:	5d                   	pop    %rbp
+  80194d:	c3                   	ret
+
+000000000080194e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80194e:	83 ff 1f             	cmp    $0x1f,%edi
+  801951:	77 39                	ja     80198c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801953:	55                   	push   %rbp
+  801954:	48 89 e5             	mov    %rsp,%rbp
+  801957:	41 54                	push   %r12
+  801959:	53                   	push   %rbx
+  80195a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80195d:	48 63 df             	movslq %edi,%rbx
+  801960:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801967:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80196b:	48 89 df             	mov    %rbx,%rdi
+  80196e:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+  80197a:	a8 04                	test   $0x4,%al
+  80197c:	74 14                	je     801992 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80197e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801982:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801987:	5b                   	pop    %rbx
+  801988:	41 5c                	pop    %r12
+  80198a:	5d                   	pop    %rbp
+  80198b:	c3                   	ret
+        return -E_INVAL;
+  80198c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801991:	c3                   	ret
+        return -E_INVAL;
+  801992:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801997:	eb ee                	jmp    801987 <fd_lookup+0x39>
+
+0000000000801999 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	41 54                	push   %r12
+  80199f:	53                   	push   %rbx
+  8019a0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019a3:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  8019aa:	00 00 00 
+  8019ad:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8019b4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019b7:	39 3b                	cmp    %edi,(%rbx)
+  8019b9:	74 4a                	je     801a05 <dev_lookup+0x6c>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019bb:	48 83 c0 08          	add    $0x8,%rax
+  8019bf:	48 8b 18             	mov    (%rax),%rbx
+  8019c2:	48 85 db             	test   %rbx,%rbx
+  8019c5:	75 f0                	jne    8019b7 <dev_lookup+0x1e>
+  8019c7:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  8019ce:	00 00 
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019d4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019da:	89 fa                	mov    %edi,%edx
+  8019dc:	48 bf 40 56 80 00 00 	movabs $0x805640,%rdi
+  8019e3:	00 00 00 
+  8019e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019eb:	48 b9 ac 02 80 00 00 	movabs $0x8002ac,%rcx
+  8019f2:	00 00 00 
+  8019f5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019fc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	5d                   	pop    %rbp
+  801a04:	c3                   	ret
+            return 0;
+  801a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0a:	eb f0                	jmp    8019fc <dev_lookup+0x63>
+
+0000000000801a0c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a0c:	55                   	push   %rbp
+  801a0d:	48 89 e5             	mov    %rsp,%rbp
+  801a10:	41 55                	push   %r13
+  801a12:	41 54                	push   %r12
+  801a14:	53                   	push   %rbx
+  801a15:	48 83 ec 18          	sub    $0x18,%rsp
+  801a19:	48 89 fb             	mov    %rdi,%rbx
+  801a1c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a1f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a26:	ff ff ff 
+  801a29:	48 01 df             	add    %rbx,%rdi
+  801a2c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a30:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a34:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+  801a40:	41 89 c5             	mov    %eax,%r13d
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	78 06                	js     801a4d <fd_close+0x41>
+  801a47:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a4b:	74 1a                	je     801a67 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a4d:	45 84 e4             	test   %r12b,%r12b
+  801a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a55:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a59:	44 89 e8             	mov    %r13d,%eax
+  801a5c:	48 83 c4 18          	add    $0x18,%rsp
+  801a60:	5b                   	pop    %rbx
+  801a61:	41 5c                	pop    %r12
+  801a63:	41 5d                	pop    %r13
+  801a65:	5d                   	pop    %rbp
+  801a66:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a67:	8b 3b                	mov    (%rbx),%edi
+  801a69:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a6d:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  801a74:	00 00 00 
+  801a77:	ff d0                	call   *%rax
+  801a79:	41 89 c5             	mov    %eax,%r13d
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 1b                	js     801a9b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a84:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a88:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a8e:	48 85 c0             	test   %rax,%rax
+  801a91:	74 08                	je     801a9b <fd_close+0x8f>
+  801a93:	48 89 df             	mov    %rbx,%rdi
+  801a96:	ff d0                	call   *%rax
+  801a98:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aa0:	48 89 de             	mov    %rbx,%rsi
+  801aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa8:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  801aaf:	00 00 00 
+  801ab2:	ff d0                	call   *%rax
+    return res;
+  801ab4:	eb a3                	jmp    801a59 <fd_close+0x4d>
+
+0000000000801ab6 <close>:
+
+int
+close(int fdnum) {
+  801ab6:	55                   	push   %rbp
+  801ab7:	48 89 e5             	mov    %rsp,%rbp
+  801aba:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801abe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ac2:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801ac9:	00 00 00 
+  801acc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	78 15                	js     801ae7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ad2:	be 01 00 00 00       	mov    $0x1,%esi
+  801ad7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801adb:	48 b8 0c 1a 80 00 00 	movabs $0x801a0c,%rax
+  801ae2:	00 00 00 
+  801ae5:	ff d0                	call   *%rax
+}
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+0000000000801ae9 <close_all>:
+
+void
+close_all(void) {
+  801ae9:	55                   	push   %rbp
+  801aea:	48 89 e5             	mov    %rsp,%rbp
+  801aed:	41 54                	push   %r12
+  801aef:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801af0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af5:	49 bc b6 1a 80 00 00 	movabs $0x801ab6,%r12
+  801afc:	00 00 00 
+  801aff:	89 df                	mov    %ebx,%edi
+  801b01:	41 ff d4             	call   *%r12
+  801b04:	83 c3 01             	add    $0x1,%ebx
+  801b07:	83 fb 20             	cmp    $0x20,%ebx
+  801b0a:	75 f3                	jne    801aff <close_all+0x16>
+}
+  801b0c:	5b                   	pop    %rbx
+  801b0d:	41 5c                	pop    %r12
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+
+0000000000801b11 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b11:	55                   	push   %rbp
+  801b12:	48 89 e5             	mov    %rsp,%rbp
+  801b15:	41 57                	push   %r15
+  801b17:	41 56                	push   %r14
+  801b19:	41 55                	push   %r13
+  801b1b:	41 54                	push   %r12
+  801b1d:	53                   	push   %rbx
+  801b1e:	48 83 ec 38          	sub    $0x38,%rsp
+  801b22:	41 89 f7             	mov    %esi,%r15d
+  801b25:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b28:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b2c:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801b33:	00 00 00 
+  801b36:	ff d0                	call   *%rax
+  801b38:	89 c3                	mov    %eax,%ebx
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	0f 88 ec 00 00 00    	js     801c2e <dup+0x11d>
+    close(newfdnum);
+  801b42:	44 89 ff             	mov    %r15d,%edi
+  801b45:	48 b8 b6 1a 80 00 00 	movabs $0x801ab6,%rax
+  801b4c:	00 00 00 
+  801b4f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b51:	49 63 c7             	movslq %r15d,%rax
+  801b54:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801b5a:	48 c1 e0 0c          	shl    $0xc,%rax
+  801b5e:	49 89 c6             	mov    %rax,%r14
+  801b61:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    char *oldva = fd2data(oldfd);
+  801b65:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b69:	4c 89 ff             	mov    %r15,%rdi
+  801b6c:	48 bb d0 18 80 00 00 	movabs $0x8018d0,%rbx
+  801b73:	00 00 00 
+  801b76:	ff d3                	call   *%rbx
+  801b78:	49 89 c4             	mov    %rax,%r12
+    char *newva = fd2data(newfd);
+  801b7b:	4c 89 f7             	mov    %r14,%rdi
+  801b7e:	ff d3                	call   *%rbx
+  801b80:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Data pages are mapped before the fd page, so that
+     * they never have fewer references (see pipeisclosed()) */
+    int prot = get_prot(oldva);
+  801b84:	4c 89 e7             	mov    %r12,%rdi
+  801b87:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  801b8e:	00 00 00 
+  801b91:	ff d0                	call   *%rax
+  801b93:	41 89 c5             	mov    %eax,%r13d
+    size_t size = 0;
+  801b96:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (size < FDDATA_SIZE && get_prot(oldva + size) == prot) size += PAGE_SIZE;
+  801b9b:	49 be 8c 35 80 00 00 	movabs $0x80358c,%r14
+  801ba2:	00 00 00 
+  801ba5:	49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+  801ba9:	41 ff d6             	call   *%r14
+  801bac:	44 39 e8             	cmp    %r13d,%eax
+  801baf:	75 10                	jne    801bc1 <dup+0xb0>
+  801bb1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bb8:	48 81 fb 00 00 04 00 	cmp    $0x40000,%rbx
+  801bbf:	75 e4                	jne    801ba5 <dup+0x94>
+    if (prot & PROT_R) {
+  801bc1:	41 f6 c5 04          	test   $0x4,%r13b
+  801bc5:	74 29                	je     801bf0 <dup+0xdf>
+        if ((res = sys_map_region(0, oldva, 0, newva, size, prot)) < 0) goto err;
+  801bc7:	45 89 e9             	mov    %r13d,%r9d
+  801bca:	49 89 d8             	mov    %rbx,%r8
+  801bcd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd6:	4c 89 e6             	mov    %r12,%rsi
+  801bd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bde:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+  801bea:	89 c3                	mov    %eax,%ebx
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	78 4f                	js     801c3f <dup+0x12e>
+    }
+    prot = get_prot(oldfd);
+  801bf0:	4c 89 ff             	mov    %r15,%rdi
+  801bf3:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  801bfa:	00 00 00 
+  801bfd:	ff d0                	call   *%rax
+  801bff:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c02:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c08:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801c0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c11:	4c 89 fe             	mov    %r15,%rsi
+  801c14:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c19:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+  801c25:	89 c3                	mov    %eax,%ebx
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 14                	js     801c3f <dup+0x12e>
+
+    return newfdnum;
+  801c2b:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+    return res;
+}
+  801c2e:	89 d8                	mov    %ebx,%eax
+  801c30:	48 83 c4 38          	add    $0x38,%rsp
+  801c34:	5b                   	pop    %rbx
+  801c35:	41 5c                	pop    %r12
+  801c37:	41 5d                	pop    %r13
+  801c39:	41 5e                	pop    %r14
+  801c3b:	41 5f                	pop    %r15
+  801c3d:	5d                   	pop    %rbp
+  801c3e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c44:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801c48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c4d:	49 bc b5 12 80 00 00 	movabs $0x8012b5,%r12
+  801c54:	00 00 00 
+  801c57:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, FDDATA_SIZE);
+  801c5a:	ba 00 00 04 00       	mov    $0x40000,%edx
+  801c5f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801c63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c68:	41 ff d4             	call   *%r12
+    return res;
+  801c6b:	eb c1                	jmp    801c2e <dup+0x11d>
+
+0000000000801c6d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c6d:	55                   	push   %rbp
+  801c6e:	48 89 e5             	mov    %rsp,%rbp
+  801c71:	41 56                	push   %r14
+  801c73:	41 55                	push   %r13
+  801c75:	41 54                	push   %r12
+  801c77:	53                   	push   %rbx
+  801c78:	48 83 ec 10          	sub    $0x10,%rsp
+  801c7c:	89 fb                	mov    %edi,%ebx
+  801c7e:	49 89 f4             	mov    %rsi,%r12
+  801c81:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c84:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c88:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801c8f:	00 00 00 
+  801c92:	ff d0                	call   *%rax
+  801c94:	85 c0                	test   %eax,%eax
+  801c96:	78 4c                	js     801ce4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c98:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c9c:	41 8b 3e             	mov    (%r14),%edi
+  801c9f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ca3:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 35                	js     801ce8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cb3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cb7:	83 e0 03             	and    $0x3,%eax
+  801cba:	83 f8 01             	cmp    $0x1,%eax
+  801cbd:	74 2d                	je     801cec <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cc7:	48 85 c0             	test   %rax,%rax
+  801cca:	74 59                	je     801d25 <read+0xb8>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ccc:	4c 89 ea             	mov    %r13,%rdx
+  801ccf:	4c 89 e6             	mov    %r12,%rsi
+  801cd2:	4c 89 f7             	mov    %r14,%rdi
+  801cd5:	ff d0                	call   *%rax
+}
+  801cd7:	48 83 c4 10          	add    $0x10,%rsp
+  801cdb:	5b                   	pop    %rbx
+  801cdc:	41 5c                	pop    %r12
+  801cde:	41 5d                	pop    %r13
+  801ce0:	41 5e                	pop    %r14
+  801ce2:	5d                   	pop    %rbp
+  801ce3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce4:	48 98                	cltq
+  801ce6:	eb ef                	jmp    801cd7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ce8:	48 98                	cltq
+  801cea:	eb eb                	jmp    801cd7 <read+0x6a>
+  801cec:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801cf3:	00 00 
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cf5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cf9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cff:	89 da                	mov    %ebx,%edx
+  801d01:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801d08:	00 00 00 
+  801d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d10:	48 b9 ac 02 80 00 00 	movabs $0x8002ac,%rcx
+  801d17:	00 00 00 
+  801d1a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d1c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d23:	eb b2                	jmp    801cd7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d25:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d2c:	eb a9                	jmp    801cd7 <read+0x6a>
+
+0000000000801d2e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	41 57                	push   %r15
+  801d34:	41 56                	push   %r14
+  801d36:	41 55                	push   %r13
+  801d38:	41 54                	push   %r12
+  801d3a:	53                   	push   %rbx
+  801d3b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d3f:	48 85 d2             	test   %rdx,%rdx
+  801d42:	74 54                	je     801d98 <readn+0x6a>
+  801d44:	41 89 fd             	mov    %edi,%r13d
+  801d47:	49 89 f6             	mov    %rsi,%r14
+  801d4a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d52:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d57:	49 bf 6d 1c 80 00 00 	movabs $0x801c6d,%r15
+  801d5e:	00 00 00 
+  801d61:	4c 89 e2             	mov    %r12,%rdx
+  801d64:	48 29 f2             	sub    %rsi,%rdx
+  801d67:	4c 01 f6             	add    %r14,%rsi
+  801d6a:	44 89 ef             	mov    %r13d,%edi
+  801d6d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 20                	js     801d94 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d74:	01 c3                	add    %eax,%ebx
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	74 08                	je     801d82 <readn+0x54>
+  801d7a:	48 63 f3             	movslq %ebx,%rsi
+  801d7d:	4c 39 e6             	cmp    %r12,%rsi
+  801d80:	72 df                	jb     801d61 <readn+0x33>
+    }
+    return res;
+  801d82:	48 63 c3             	movslq %ebx,%rax
+}
+  801d85:	48 83 c4 08          	add    $0x8,%rsp
+  801d89:	5b                   	pop    %rbx
+  801d8a:	41 5c                	pop    %r12
+  801d8c:	41 5d                	pop    %r13
+  801d8e:	41 5e                	pop    %r14
+  801d90:	41 5f                	pop    %r15
+  801d92:	5d                   	pop    %rbp
+  801d93:	c3                   	ret
+        if (inc < 0) return inc;
+  801d94:	48 98                	cltq
+  801d96:	eb ed                	jmp    801d85 <readn+0x57>
+    int inc = 1, res = 0;
+  801d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9d:	eb e3                	jmp    801d82 <readn+0x54>
+
+0000000000801d9f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d9f:	55                   	push   %rbp
+  801da0:	48 89 e5             	mov    %rsp,%rbp
+  801da3:	41 56                	push   %r14
+  801da5:	41 55                	push   %r13
+  801da7:	41 54                	push   %r12
+  801da9:	53                   	push   %rbx
+  801daa:	48 83 ec 10          	sub    $0x10,%rsp
+  801dae:	89 fb                	mov    %edi,%ebx
+  801db0:	49 89 f4             	mov    %rsi,%r12
+  801db3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801db6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dba:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801dc1:	00 00 00 
+  801dc4:	ff d0                	call   *%rax
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 47                	js     801e11 <write+0x72>
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dca:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dce:	41 8b 3e             	mov    (%r14),%edi
+  801dd1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dd5:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  801ddc:	00 00 00 
+  801ddf:	ff d0                	call   *%rax
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 30                	js     801e15 <write+0x76>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801de5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dea:	74 2d                	je     801e19 <write+0x7a>
+    }
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801df4:	48 85 c0             	test   %rax,%rax
+  801df7:	74 59                	je     801e52 <write+0xb3>
+    return (*dev->dev_write)(fd, buf, n);
+  801df9:	4c 89 ea             	mov    %r13,%rdx
+  801dfc:	4c 89 e6             	mov    %r12,%rsi
+  801dff:	4c 89 f7             	mov    %r14,%rdi
+  801e02:	ff d0                	call   *%rax
+}
+  801e04:	48 83 c4 10          	add    $0x10,%rsp
+  801e08:	5b                   	pop    %rbx
+  801e09:	41 5c                	pop    %r12
+  801e0b:	41 5d                	pop    %r13
+  801e0d:	41 5e                	pop    %r14
+  801e0f:	5d                   	pop    %rbp
+  801e10:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e11:	48 98                	cltq
+  801e13:	eb ef                	jmp    801e04 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e15:	48 98                	cltq
+  801e17:	eb eb                	jmp    801e04 <write+0x65>
+  801e19:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801e20:	00 00 
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e22:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e26:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e2c:	89 da                	mov    %ebx,%edx
+  801e2e:	48 bf 9d 56 80 00 00 	movabs $0x80569d,%rdi
+  801e35:	00 00 00 
+  801e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3d:	48 b9 ac 02 80 00 00 	movabs $0x8002ac,%rcx
+  801e44:	00 00 00 
+  801e47:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e49:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e50:	eb b2                	jmp    801e04 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e52:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e59:	eb a9                	jmp    801e04 <write+0x65>
+
+0000000000801e5b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e5b:	55                   	push   %rbp
+  801e5c:	48 89 e5             	mov    %rsp,%rbp
+  801e5f:	53                   	push   %rbx
+  801e60:	48 83 ec 18          	sub    $0x18,%rsp
+  801e64:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e6a:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801e71:	00 00 00 
+  801e74:	ff d0                	call   *%rax
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 0c                	js     801e86 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e7e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+
+0000000000801e8c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e8c:	55                   	push   %rbp
+  801e8d:	48 89 e5             	mov    %rsp,%rbp
+  801e90:	41 55                	push   %r13
+  801e92:	41 54                	push   %r12
+  801e94:	53                   	push   %rbx
+  801e95:	48 83 ec 18          	sub    $0x18,%rsp
+  801e99:	89 fb                	mov    %edi,%ebx
+  801e9b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ea2:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801ea9:	00 00 00 
+  801eac:	ff d0                	call   *%rax
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 38                	js     801eea <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb2:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eb6:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801eba:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ebe:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 1c                	js     801eea <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ece:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ed3:	74 20                	je     801ef5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801edd:	48 85 c0             	test   %rax,%rax
+  801ee0:	74 4a                	je     801f2c <ftruncate+0xa0>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ee2:	44 89 e6             	mov    %r12d,%esi
+  801ee5:	4c 89 ef             	mov    %r13,%rdi
+  801ee8:	ff d0                	call   *%rax
+}
+  801eea:	48 83 c4 18          	add    $0x18,%rsp
+  801eee:	5b                   	pop    %rbx
+  801eef:	41 5c                	pop    %r12
+  801ef1:	41 5d                	pop    %r13
+  801ef3:	5d                   	pop    %rbp
+  801ef4:	c3                   	ret
+  801ef5:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  801efc:	00 00 
+                thisenv->env_id, fdnum);
+  801efe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f02:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f08:	89 da                	mov    %ebx,%edx
+  801f0a:	48 bf 60 56 80 00 00 	movabs $0x805660,%rdi
+  801f11:	00 00 00 
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	48 b9 ac 02 80 00 00 	movabs $0x8002ac,%rcx
+  801f20:	00 00 00 
+  801f23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2a:	eb be                	jmp    801eea <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f2c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f31:	eb b7                	jmp    801eea <ftruncate+0x5e>
+
+0000000000801f33 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	41 54                	push   %r12
+  801f39:	53                   	push   %rbx
+  801f3a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f45:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	78 4e                	js     801fa3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f55:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f59:	41 8b 3c 24          	mov    (%r12),%edi
+  801f5d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f61:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  801f68:	00 00 00 
+  801f6b:	ff d0                	call   *%rax
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 32                	js     801fa3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f75:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f7a:	74 30                	je     801fac <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f7c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f7f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f86:	00 00 00 
+    stat->st_isdir = 0;
+  801f89:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f90:	00 00 00 
+    stat->st_dev = dev;
+  801f93:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f9a:	48 89 de             	mov    %rbx,%rsi
+  801f9d:	4c 89 e7             	mov    %r12,%rdi
+  801fa0:	ff 50 28             	call   *0x28(%rax)
+}
+  801fa3:	48 83 c4 10          	add    $0x10,%rsp
+  801fa7:	5b                   	pop    %rbx
+  801fa8:	41 5c                	pop    %r12
+  801faa:	5d                   	pop    %rbp
+  801fab:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fac:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb1:	eb f0                	jmp    801fa3 <fstat+0x70>
+
+0000000000801fb3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fb3:	55                   	push   %rbp
+  801fb4:	48 89 e5             	mov    %rsp,%rbp
+  801fb7:	41 54                	push   %r12
+  801fb9:	53                   	push   %rbx
+  801fba:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc2:	48 b8 b6 25 80 00 00 	movabs $0x8025b6,%rax
+  801fc9:	00 00 00 
+  801fcc:	ff d0                	call   *%rax
+  801fce:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 25                	js     801ff9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fd4:	4c 89 e6             	mov    %r12,%rsi
+  801fd7:	89 c7                	mov    %eax,%edi
+  801fd9:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+  801fe5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fe8:	89 df                	mov    %ebx,%edi
+  801fea:	48 b8 b6 1a 80 00 00 	movabs $0x801ab6,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+
+    return res;
+  801ff6:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ff9:	89 d8                	mov    %ebx,%eax
+  801ffb:	5b                   	pop    %rbx
+  801ffc:	41 5c                	pop    %r12
+  801ffe:	5d                   	pop    %rbp
+  801fff:	c3                   	ret
+
+0000000000802000 <mmap_lookup>:
+    return start + size <= MMAP_END ? start : 0;
+}
+
+static struct Mapping *
+mmap_lookup(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802000:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802007:	00 00 00 
+  80200a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200f:	eb 0e                	jmp    80201f <mmap_lookup+0x1f>
+  802011:	48 83 c2 01          	add    $0x1,%rdx
+  802015:	48 83 c0 20          	add    $0x20,%rax
+  802019:	48 83 fa 40          	cmp    $0x40,%rdx
+  80201d:	74 2b                	je     80204a <mmap_lookup+0x4a>
+        struct Mapping *m = &mappings[i];
+        if (m->m_size && m->m_start <= va && va < m->m_start + m->m_size) return m;
+  80201f:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  802023:	48 85 c9             	test   %rcx,%rcx
+  802026:	74 e9                	je     802011 <mmap_lookup+0x11>
+  802028:	48 8b 30             	mov    (%rax),%rsi
+  80202b:	48 39 f7             	cmp    %rsi,%rdi
+  80202e:	72 e1                	jb     802011 <mmap_lookup+0x11>
+  802030:	48 01 f1             	add    %rsi,%rcx
+  802033:	48 39 cf             	cmp    %rcx,%rdi
+  802036:	73 d9                	jae    802011 <mmap_lookup+0x11>
+        struct Mapping *m = &mappings[i];
+  802038:	48 c1 e2 05          	shl    $0x5,%rdx
+  80203c:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802043:	00 00 00 
+  802046:	48 01 d0             	add    %rdx,%rax
+    }
+    return NULL;
+}
+  802049:	c3                   	ret
+    return NULL;
+  80204a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204f:	c3                   	ret
+
+0000000000802050 <fsipc_words>:
+fsipc_words(unsigned type, uint64_t words[IPC_NWORDS]) {
+  802050:	55                   	push   %rbp
+  802051:	48 89 e5             	mov    %rsp,%rbp
+  802054:	41 54                	push   %r12
+  802056:	53                   	push   %rbx
+  802057:	89 fb                	mov    %edi,%ebx
+  802059:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80205c:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  802063:	00 00 00 
+  802066:	83 38 00             	cmpl   $0x0,(%rax)
+  802069:	74 3d                	je     8020a8 <fsipc_words+0x58>
+    return ipc_call(fsenv, type, NULL, 0, 0, NULL, NULL, words);
+  80206b:	41 54                	push   %r12
+  80206d:	6a 00                	push   $0x0
+  80206f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802075:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80207b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802080:	ba 00 00 00 00       	mov    $0x0,%edx
+  802085:	89 de                	mov    %ebx,%esi
+  802087:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80208e:	00 00 00 
+  802091:	8b 38                	mov    (%rax),%edi
+  802093:	48 b8 93 3c 80 00 00 	movabs $0x803c93,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+}
+  80209f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	5d                   	pop    %rbp
+  8020a7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020ad:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	a3 10 80 80 00 00 00 	movabs %eax,0x808010
+  8020c0:	00 00 
+  8020c2:	eb a7                	jmp    80206b <fsipc_words+0x1b>
+
+00000000008020c4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id, newsize};
+  8020cc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020d3:	00 
+  8020d4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8020db:	00 
+  8020dc:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  8020e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8020e4:	48 63 f6             	movslq %esi,%rsi
+  8020e7:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    return fsipc_words(FSREQ_SET_SIZE, words);
+  8020eb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020ef:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020f4:	48 b8 50 20 80 00 00 	movabs $0x802050,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+}
+  802100:	c9                   	leave
+  802101:	c3                   	ret
+
+0000000000802102 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+  802106:	48 83 ec 20          	sub    $0x20,%rsp
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  80210a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802111:	00 
+  802112:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802119:	00 
+  80211a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802121:	00 
+  802122:	48 63 47 0c          	movslq 0xc(%rdi),%rax
+  802126:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    return fsipc_words(FSREQ_FLUSH, words);
+  80212a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80212e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802133:	48 b8 50 20 80 00 00 	movabs $0x802050,%rax
+  80213a:	00 00 00 
+  80213d:	ff d0                	call   *%rax
+}
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+
+0000000000802141 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802141:	55                   	push   %rbp
+  802142:	48 89 e5             	mov    %rsp,%rbp
+  802145:	41 54                	push   %r12
+  802147:	53                   	push   %rbx
+  802148:	89 fb                	mov    %edi,%ebx
+  80214a:	49 89 f4             	mov    %rsi,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80214d:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802154:	00 00 00 
+  802157:	83 38 00             	cmpl   $0x0,(%rax)
+  80215a:	74 3f                	je     80219b <fsipc+0x5a>
+    return ipc_call(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, NULL, NULL);
+  80215c:	6a 00                	push   $0x0
+  80215e:	6a 00                	push   $0x0
+  802160:	4d 89 e1             	mov    %r12,%r9
+  802163:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802169:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80216e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802175:	00 00 00 
+  802178:	89 de                	mov    %ebx,%esi
+  80217a:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  802181:	00 00 00 
+  802184:	8b 38                	mov    (%rax),%edi
+  802186:	48 b8 93 3c 80 00 00 	movabs $0x803c93,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+}
+  802192:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802196:	5b                   	pop    %rbx
+  802197:	41 5c                	pop    %r12
+  802199:	5d                   	pop    %rbp
+  80219a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80219b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021a0:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  8021a7:	00 00 00 
+  8021aa:	ff d0                	call   *%rax
+  8021ac:	a3 0c 80 80 00 00 00 	movabs %eax,0x80800c
+  8021b3:	00 00 
+  8021b5:	eb a5                	jmp    80215c <fsipc+0x1b>
+
+00000000008021b7 <fsipcv>:
+fsipcv(unsigned type, size_t npages) {
+  8021b7:	55                   	push   %rbp
+  8021b8:	48 89 e5             	mov    %rsp,%rbp
+  8021bb:	41 54                	push   %r12
+  8021bd:	53                   	push   %rbx
+  8021be:	41 89 fc             	mov    %edi,%r12d
+  8021c1:	48 89 f3             	mov    %rsi,%rbx
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021c4:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8021cb:	00 00 00 
+  8021ce:	83 38 00             	cmpl   $0x0,(%rax)
+  8021d1:	74 46                	je     802219 <fsipcv+0x62>
+    return ipc_call(fsenv, type, FSIPCV, (npages + 1) * PAGE_SIZE, PROT_RW, NULL, NULL, NULL);
+  8021d3:	48 8d 4b 01          	lea    0x1(%rbx),%rcx
+  8021d7:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8021db:	6a 00                	push   $0x0
+  8021dd:	6a 00                	push   $0x0
+  8021df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021eb:	48 ba 00 f0 fb ff 02 	movabs $0x2fffbf000,%rdx
+  8021f2:	00 00 00 
+  8021f5:	44 89 e6             	mov    %r12d,%esi
+  8021f8:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  8021ff:	00 00 00 
+  802202:	8b 38                	mov    (%rax),%edi
+  802204:	48 b8 93 3c 80 00 00 	movabs $0x803c93,%rax
+  80220b:	00 00 00 
+  80220e:	ff d0                	call   *%rax
+}
+  802210:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  802214:	5b                   	pop    %rbx
+  802215:	41 5c                	pop    %r12
+  802217:	5d                   	pop    %rbp
+  802218:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802219:	bf 03 00 00 00       	mov    $0x3,%edi
+  80221e:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+  80222a:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  802231:	00 00 
+  802233:	eb 9e                	jmp    8021d3 <fsipcv+0x1c>
+
+0000000000802235 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	41 54                	push   %r12
+  80223b:	53                   	push   %rbx
+  80223c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80223f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802242:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802249:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80224b:	be 00 00 00 00       	mov    $0x0,%esi
+  802250:	bf 05 00 00 00       	mov    $0x5,%edi
+  802255:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802261:	85 c0                	test   %eax,%eax
+  802263:	78 3d                	js     8022a2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802265:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80226c:	00 00 00 
+  80226f:	4c 89 e6             	mov    %r12,%rsi
+  802272:	48 89 df             	mov    %rbx,%rdi
+  802275:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802281:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802288:	00 
+  802289:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80228f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802296:	00 
+  802297:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80229d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a2:	5b                   	pop    %rbx
+  8022a3:	41 5c                	pop    %r12
+  8022a5:	5d                   	pop    %rbp
+  8022a6:	c3                   	ret
+
+00000000008022a7 <fsipcv_buf>:
+    return FSIPCV;
+  8022a7:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8022ae:	00 00 00 
+    if (!allocated) {
+  8022b1:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8022b8:	00 00 00 
+  8022bb:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8022be:	74 01                	je     8022c1 <fsipcv_buf+0x1a>
+}
+  8022c0:	c3                   	ret
+fsipcv_buf(void) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  8022c5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8022ca:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8022cf:	48 89 c6             	mov    %rax,%rsi
+  8022d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d7:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+  8022e3:	85 c0                	test   %eax,%eax
+  8022e5:	78 19                	js     802300 <fsipcv_buf+0x59>
+        allocated = 1;
+  8022e7:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8022ee:	00 00 00 
+  8022f1:	c6 00 01             	movb   $0x1,(%rax)
+    return FSIPCV;
+  8022f4:	48 b8 00 f0 fb ff 02 	movabs $0x2fffbf000,%rax
+  8022fb:	00 00 00 
+}
+  8022fe:	5d                   	pop    %rbp
+  8022ff:	c3                   	ret
+        if (sys_alloc_region(0, FSIPCV, sizeof(struct Fsipcv), PROT_RW) < 0) return NULL;
+  802300:	b8 00 00 00 00       	mov    $0x0,%eax
+  802305:	eb f7                	jmp    8022fe <fsipcv_buf+0x57>
+
+0000000000802307 <devfile_write>:
+    if (!fd || !buf) {
+  802307:	48 85 ff             	test   %rdi,%rdi
+  80230a:	0f 84 46 01 00 00    	je     802456 <devfile_write+0x14f>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802310:	55                   	push   %rbp
+  802311:	48 89 e5             	mov    %rsp,%rbp
+  802314:	41 57                	push   %r15
+  802316:	41 56                	push   %r14
+  802318:	41 55                	push   %r13
+  80231a:	41 54                	push   %r12
+  80231c:	53                   	push   %rbx
+  80231d:	48 83 ec 18          	sub    $0x18,%rsp
+  802321:	49 89 ff             	mov    %rdi,%r15
+  802324:	49 89 f5             	mov    %rsi,%r13
+  802327:	48 89 d3             	mov    %rdx,%rbx
+    if (!fd || !buf) {
+  80232a:	48 85 f6             	test   %rsi,%rsi
+  80232d:	0f 84 1a 01 00 00    	je     80244d <devfile_write+0x146>
+    while (n) {
+  802333:	48 85 d2             	test   %rdx,%rdx
+  802336:	0f 84 fc 00 00 00    	je     802438 <devfile_write+0x131>
+    size_t i = 0;
+  80233c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802342:	eb 6c                	jmp    8023b0 <devfile_write+0xa9>
+            size_t next = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802344:	41 bc f0 0f 00 00    	mov    $0xff0,%r12d
+  80234a:	4c 39 e3             	cmp    %r12,%rbx
+  80234d:	4c 0f 46 e3          	cmovbe %rbx,%r12
+            memcpy(fsipcbuf.write.req_buf, buf, next);
+  802351:	4c 89 e2             	mov    %r12,%rdx
+  802354:	4c 89 ee             	mov    %r13,%rsi
+  802357:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80235e:	00 00 00 
+  802361:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+            fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80236d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802371:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802378:	00 00 00 
+  80237b:	89 01                	mov    %eax,(%rcx)
+            fsipcbuf.write.req_n = next;
+  80237d:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+            if ((ret = fsipc(FSREQ_WRITE, NULL)) < 0) {
+  802381:	be 00 00 00 00       	mov    $0x0,%esi
+  802386:	bf 04 00 00 00       	mov    $0x4,%edi
+  80238b:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+  802397:	85 c0                	test   %eax,%eax
+  802399:	0f 88 95 00 00 00    	js     802434 <devfile_write+0x12d>
+        buf += ret;
+  80239f:	48 98                	cltq
+  8023a1:	49 01 c5             	add    %rax,%r13
+        i += ret;
+  8023a4:	49 01 c6             	add    %rax,%r14
+    while (n) {
+  8023a7:	48 29 c3             	sub    %rax,%rbx
+  8023aa:	0f 84 8b 00 00 00    	je     80243b <devfile_write+0x134>
+        if (n > sizeof(fsipcbuf.write.req_buf) && (v = fsipcv_buf())) {
+  8023b0:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8023b7:	76 8b                	jbe    802344 <devfile_write+0x3d>
+  8023b9:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+  8023c5:	49 89 c4             	mov    %rax,%r12
+  8023c8:	48 85 c0             	test   %rax,%rax
+  8023cb:	0f 84 73 ff ff ff    	je     802344 <devfile_write+0x3d>
+            size_t next = MIN(n, sizeof(v->data));
+  8023d1:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8023d6:	48 39 c3             	cmp    %rax,%rbx
+  8023d9:	48 0f 46 c3          	cmovbe %rbx,%rax
+            memcpy(v->data, buf, next);
+  8023dd:	49 8d bc 24 00 10 00 	lea    0x1000(%r12),%rdi
+  8023e4:	00 
+  8023e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8023e9:	48 89 c2             	mov    %rax,%rdx
+  8023ec:	4c 89 ee             	mov    %r13,%rsi
+  8023ef:	48 b9 32 0e 80 00 00 	movabs $0x800e32,%rcx
+  8023f6:	00 00 00 
+  8023f9:	ff d1                	call   *%rcx
+            v->req.writev.req_fileid = fd->fd_file.id;
+  8023fb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8023ff:	41 89 04 24          	mov    %eax,(%r12)
+            v->req.writev.req_n = next;
+  802403:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802407:	49 89 44 24 08       	mov    %rax,0x8(%r12)
+            if ((ret = fsipcv(FSREQ_WRITEV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) < 0) {
+  80240c:	48 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%rsi
+  802413:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802417:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80241c:	48 b8 b7 21 80 00 00 	movabs $0x8021b7,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	0f 89 6f ff ff ff    	jns    80239f <devfile_write+0x98>
+                return ret;
+  802430:	48 98                	cltq
+  802432:	eb 0a                	jmp    80243e <devfile_write+0x137>
+                return ret;
+  802434:	48 98                	cltq
+  802436:	eb 06                	jmp    80243e <devfile_write+0x137>
+    size_t i = 0;
+  802438:	49 89 d6             	mov    %rdx,%r14
+    return i;
+  80243b:	4c 89 f0             	mov    %r14,%rax
+}
+  80243e:	48 83 c4 18          	add    $0x18,%rsp
+  802442:	5b                   	pop    %rbx
+  802443:	41 5c                	pop    %r12
+  802445:	41 5d                	pop    %r13
+  802447:	41 5e                	pop    %r14
+  802449:	41 5f                	pop    %r15
+  80244b:	5d                   	pop    %rbp
+  80244c:	c3                   	ret
+        return -E_INVAL;
+  80244d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802454:	eb e8                	jmp    80243e <devfile_write+0x137>
+  802456:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  80245d:	c3                   	ret
+
+000000000080245e <devfile_read>:
+    if (!fd || !buf) {
+  80245e:	48 85 ff             	test   %rdi,%rdi
+  802461:	0f 84 47 01 00 00    	je     8025ae <devfile_read+0x150>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	41 57                	push   %r15
+  80246d:	41 56                	push   %r14
+  80246f:	41 55                	push   %r13
+  802471:	41 54                	push   %r12
+  802473:	53                   	push   %rbx
+  802474:	48 83 ec 18          	sub    $0x18,%rsp
+  802478:	49 89 ff             	mov    %rdi,%r15
+  80247b:	49 89 f5             	mov    %rsi,%r13
+  80247e:	49 89 d4             	mov    %rdx,%r12
+    if (!fd || !buf) {
+  802481:	48 85 f6             	test   %rsi,%rsi
+  802484:	0f 84 1b 01 00 00    	je     8025a5 <devfile_read+0x147>
+    while (n) {
+  80248a:	48 85 d2             	test   %rdx,%rdx
+  80248d:	0f 84 fb 00 00 00    	je     80258e <devfile_read+0x130>
+    size_t i = 0;
+  802493:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80249a:	00 
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80249b:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  8024a2:	00 00 00 
+  8024a5:	eb 5f                	jmp    802506 <devfile_read+0xa8>
+                return ret ? ret : i;
+  8024a7:	48 98                	cltq
+  8024a9:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  8024ae:	e9 e3 00 00 00       	jmp    802596 <devfile_read+0x138>
+            fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024b3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024b7:	41 89 06             	mov    %eax,(%r14)
+            fsipcbuf.read.req_n = n;
+  8024ba:	4d 89 66 08          	mov    %r12,0x8(%r14)
+            if ((ret = fsipc(FSREQ_READ, NULL)) <= 0) {
+  8024be:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024c8:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	89 c3                	mov    %eax,%ebx
+  8024d6:	85 c0                	test   %eax,%eax
+  8024d8:	0f 8e a7 00 00 00    	jle    802585 <devfile_read+0x127>
+            memcpy(buf, fsipcbuf.readRet.ret_buf, ret);
+  8024de:	48 63 d0             	movslq %eax,%rdx
+  8024e1:	4c 89 f6             	mov    %r14,%rsi
+  8024e4:	4c 89 ef             	mov    %r13,%rdi
+  8024e7:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+        buf += ret;
+  8024f3:	48 63 db             	movslq %ebx,%rbx
+  8024f6:	49 01 dd             	add    %rbx,%r13
+        i += ret;
+  8024f9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+    while (n) {
+  8024fd:	49 29 dc             	sub    %rbx,%r12
+  802500:	0f 84 8c 00 00 00    	je     802592 <devfile_read+0x134>
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802506:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80250d:	76 a4                	jbe    8024b3 <devfile_read+0x55>
+  80250f:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  802516:	00 00 00 
+  802519:	ff d0                	call   *%rax
+  80251b:	48 89 c1             	mov    %rax,%rcx
+  80251e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802522:	48 85 c0             	test   %rax,%rax
+  802525:	74 8c                	je     8024b3 <devfile_read+0x55>
+            size_t next = MIN(n, sizeof(v->data));
+  802527:	be 00 00 04 00       	mov    $0x40000,%esi
+  80252c:	49 39 f4             	cmp    %rsi,%r12
+  80252f:	49 0f 46 f4          	cmovbe %r12,%rsi
+            v->req.readv.req_fileid = fd->fd_file.id;
+  802533:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802537:	89 01                	mov    %eax,(%rcx)
+            v->req.readv.req_n = next;
+  802539:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+            if ((ret = fsipcv(FSREQ_READV, ROUNDUP(next, PAGE_SIZE) / PAGE_SIZE)) <= 0) {
+  80253d:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  802544:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802548:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80254d:	48 b8 b7 21 80 00 00 	movabs $0x8021b7,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	89 c3                	mov    %eax,%ebx
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	0f 8e 44 ff ff ff    	jle    8024a7 <devfile_read+0x49>
+            memcpy(buf, v->data, ret);
+  802563:	48 63 d0             	movslq %eax,%rdx
+  802566:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80256a:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+  802571:	4c 89 ef             	mov    %r13,%rdi
+  802574:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  80257b:	00 00 00 
+  80257e:	ff d0                	call   *%rax
+        if (n > sizeof(fsipcbuf.readRet.ret_buf) && (v = fsipcv_buf())) {
+  802580:	e9 6e ff ff ff       	jmp    8024f3 <devfile_read+0x95>
+                return ret ? ret : i;
+  802585:	48 98                	cltq
+  802587:	48 0f 44 45 c8       	cmove  -0x38(%rbp),%rax
+  80258c:	eb 08                	jmp    802596 <devfile_read+0x138>
+    size_t i = 0;
+  80258e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return i;
+  802592:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802596:	48 83 c4 18          	add    $0x18,%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	41 5d                	pop    %r13
+  80259f:	41 5e                	pop    %r14
+  8025a1:	41 5f                	pop    %r15
+  8025a3:	5d                   	pop    %rbp
+  8025a4:	c3                   	ret
+        return -E_INVAL;
+  8025a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025ac:	eb e8                	jmp    802596 <devfile_read+0x138>
+  8025ae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+}
+  8025b5:	c3                   	ret
+
+00000000008025b6 <open>:
+open(const char *path, int mode) {
+  8025b6:	55                   	push   %rbp
+  8025b7:	48 89 e5             	mov    %rsp,%rbp
+  8025ba:	41 55                	push   %r13
+  8025bc:	41 54                	push   %r12
+  8025be:	53                   	push   %rbx
+  8025bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c3:	49 89 fc             	mov    %rdi,%r12
+  8025c6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8025c9:	48 b8 93 0b 80 00 00 	movabs $0x800b93,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+  8025d5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025db:	0f 87 8a 00 00 00    	ja     80266b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8025e1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8025e5:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+  8025f1:	89 c3                	mov    %eax,%ebx
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	78 50                	js     802647 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8025f7:	4c 89 e6             	mov    %r12,%rsi
+  8025fa:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802601:	00 00 00 
+  802604:	48 89 df             	mov    %rbx,%rdi
+  802607:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  80260e:	00 00 00 
+  802611:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802613:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80261a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80261e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802623:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+  80262f:	89 c3                	mov    %eax,%ebx
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 1f                	js     802654 <open+0x9e>
+    return fd2num(fd);
+  802635:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802639:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+  802645:	89 c3                	mov    %eax,%ebx
+}
+  802647:	89 d8                	mov    %ebx,%eax
+  802649:	48 83 c4 18          	add    $0x18,%rsp
+  80264d:	5b                   	pop    %rbx
+  80264e:	41 5c                	pop    %r12
+  802650:	41 5d                	pop    %r13
+  802652:	5d                   	pop    %rbp
+  802653:	c3                   	ret
+        fd_close(fd, 0);
+  802654:	be 00 00 00 00       	mov    $0x0,%esi
+  802659:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80265d:	48 b8 0c 1a 80 00 00 	movabs $0x801a0c,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+        return res;
+  802669:	eb dc                	jmp    802647 <open+0x91>
+        return -E_BAD_PATH;
+  80266b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802670:	eb d5                	jmp    802647 <open+0x91>
+
+0000000000802672 <sync>:
+sync(void) {
+  802672:	55                   	push   %rbp
+  802673:	48 89 e5             	mov    %rsp,%rbp
+    return fsipc(FSREQ_SYNC, NULL);
+  802676:	be 00 00 00 00       	mov    $0x0,%esi
+  80267b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802680:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+}
+  80268c:	5d                   	pop    %rbp
+  80268d:	c3                   	ret
+
+000000000080268e <drop_cache>:
+drop_cache(int fdnum) {
+  80268e:	55                   	push   %rbp
+  80268f:	48 89 e5             	mov    %rsp,%rbp
+  802692:	48 83 ec 30          	sub    $0x30,%rsp
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802696:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80269a:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	78 51                	js     8026fb <drop_cache+0x6d>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026ae:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8026b5:	00 00 00 
+  8026b8:	8b 0a                	mov    (%rdx),%ecx
+  8026ba:	39 08                	cmp    %ecx,(%rax)
+  8026bc:	75 3f                	jne    8026fd <drop_cache+0x6f>
+    uint64_t words[IPC_NWORDS] = {fd->fd_file.id};
+  8026be:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8026c5:	00 
+  8026c6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8026cd:	00 
+  8026ce:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8026d5:	00 
+  8026d6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8026dd:	00 
+  8026de:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8026e2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return fsipc_words(FSREQ_DROP_CACHE, words);
+  8026e6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026ea:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026ef:	48 b8 50 20 80 00 00 	movabs $0x802050,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802702:	eb f7                	jmp    8026fb <drop_cache+0x6d>
+
+0000000000802704 <read_map>:
+read_map(int fdnum, off_t offset, void *dstva, size_t n, int perm) {
+  802704:	55                   	push   %rbp
+  802705:	48 89 e5             	mov    %rsp,%rbp
+  802708:	41 57                	push   %r15
+  80270a:	41 56                	push   %r14
+  80270c:	41 55                	push   %r13
+  80270e:	41 54                	push   %r12
+  802710:	53                   	push   %rbx
+  802711:	48 83 ec 58          	sub    $0x58,%rsp
+  802715:	41 89 f4             	mov    %esi,%r12d
+  802718:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80271c:	49 89 cd             	mov    %rcx,%r13
+  80271f:	44 89 c3             	mov    %r8d,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802722:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802726:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+  802732:	48 63 d0             	movslq %eax,%rdx
+  802735:	85 c0                	test   %eax,%eax
+  802737:	0f 88 36 01 00 00    	js     802873 <read_map+0x16f>
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  80273d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802741:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802748:	00 00 00 
+  80274b:	8b 32                	mov    (%rdx),%esi
+  80274d:	39 31                	cmp    %esi,(%rcx)
+  80274f:	0f 85 30 01 00 00    	jne    802885 <read_map+0x181>
+  802755:	45 85 e4             	test   %r12d,%r12d
+  802758:	0f 88 27 01 00 00    	js     802885 <read_map+0x181>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80275e:	49 63 cc             	movslq %r12d,%rcx
+  802761:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+    if (fd->fd_dev_id != devfile.dev_id || offset < 0 ||
+  802765:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80276c:	0f 85 1c 01 00 00    	jne    80288e <read_map+0x18a>
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802772:	4c 8b 65 98          	mov    -0x68(%rbp),%r12
+  802776:	41 81 e4 ff 0f 00 00 	and    $0xfff,%r12d
+  80277d:	0f 85 14 01 00 00    	jne    802897 <read_map+0x193>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  802783:	48 63 cb             	movslq %ebx,%rcx
+  802786:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80278a:	49 be 00 80 80 00 00 	movabs $0x808000,%r14
+  802791:	00 00 00 
+    while (i < n) {
+  802794:	4d 85 ed             	test   %r13,%r13
+  802797:	75 5c                	jne    8027f5 <read_map+0xf1>
+  802799:	e9 d2 00 00 00       	jmp    802870 <read_map+0x16c>
+    return ipc_call(fsenv, type, NULL, size, 0, dstva, perm_store, words);
+  80279e:	41 8b 3e             	mov    (%r14),%edi
+  8027a1:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+  8027a5:	50                   	push   %rax
+  8027a6:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+  8027aa:	50                   	push   %rax
+  8027ab:	4d 89 f9             	mov    %r15,%r9
+  8027ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b4:	48 89 d9             	mov    %rbx,%rcx
+  8027b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bc:	be 09 00 00 00       	mov    $0x9,%esi
+  8027c1:	48 b8 93 3c 80 00 00 	movabs $0x803c93,%rax
+  8027c8:	00 00 00 
+  8027cb:	ff d0                	call   *%rax
+        if (res <= 0) break;
+  8027cd:	48 83 c4 10          	add    $0x10,%rsp
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	0f 8e 8f 00 00 00    	jle    802868 <read_map+0x164>
+        if (!mapped_perm) {
+  8027d9:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  8027dd:	0f 84 80 00 00 00    	je     802863 <read_map+0x15f>
+        i += res;
+  8027e3:	48 63 d0             	movslq %eax,%rdx
+  8027e6:	49 01 d4             	add    %rdx,%r12
+        if (PAGE_OFFSET(res)) break;
+  8027e9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8027ee:	75 78                	jne    802868 <read_map+0x164>
+    while (i < n) {
+  8027f0:	4d 39 ec             	cmp    %r13,%r12
+  8027f3:	73 73                	jae    802868 <read_map+0x164>
+        uint64_t words[IPC_NWORDS] = {fd->fd_file.id, offset + i, n - i, perm};
+  8027f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027f9:	48 63 40 0c          	movslq 0xc(%rax),%rax
+  8027fd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  802801:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802805:	4c 01 e0             	add    %r12,%rax
+  802808:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80280c:	4c 89 eb             	mov    %r13,%rbx
+  80280f:	4c 29 e3             	sub    %r12,%rbx
+  802812:	48 89 5d b8          	mov    %rbx,-0x48(%rbp)
+  802816:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80281a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        size_t size = MIN(ROUNDUP(n - i, PAGE_SIZE), READ_MAP_MAX);
+  80281e:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  802825:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80282c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802831:	48 39 c3             	cmp    %rax,%rbx
+  802834:	48 0f 47 d8          	cmova  %rax,%rbx
+        res = fsipc_map(FSREQ_READ_MAP, words, (uint8_t *)dstva + i, size, &mapped_perm);
+  802838:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80283c:	4e 8d 3c 20          	lea    (%rax,%r12,1),%r15
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802840:	41 83 3e 00          	cmpl   $0x0,(%r14)
+  802844:	0f 85 54 ff ff ff    	jne    80279e <read_map+0x9a>
+  80284a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80284f:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  802856:	00 00 00 
+  802859:	ff d0                	call   *%rax
+  80285b:	41 89 06             	mov    %eax,(%r14)
+  80285e:	e9 3b ff ff ff       	jmp    80279e <read_map+0x9a>
+            res = -E_INVAL;
+  802863:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    return i ? (ssize_t)i : res;
+  802868:	4c 89 e2             	mov    %r12,%rdx
+  80286b:	4d 85 e4             	test   %r12,%r12
+  80286e:	75 03                	jne    802873 <read_map+0x16f>
+  802870:	48 63 d0             	movslq %eax,%rdx
+}
+  802873:	48 89 d0             	mov    %rdx,%rax
+  802876:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80287a:	5b                   	pop    %rbx
+  80287b:	41 5c                	pop    %r12
+  80287d:	41 5d                	pop    %r13
+  80287f:	41 5e                	pop    %r14
+  802881:	41 5f                	pop    %r15
+  802883:	5d                   	pop    %rbp
+  802884:	c3                   	ret
+        PAGE_OFFSET(offset) || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802885:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80288c:	eb e5                	jmp    802873 <read_map+0x16f>
+  80288e:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  802895:	eb dc                	jmp    802873 <read_map+0x16f>
+  802897:	48 c7 c2 fd ff ff ff 	mov    $0xfffffffffffffffd,%rdx
+  80289e:	eb d3                	jmp    802873 <read_map+0x16f>
+
+00000000008028a0 <mmap>:
+ * and are not written back, contents of the last page of the file
+ * after its end are unspecified.
+ *
+ * Returns the address of the mapping, or NULL on error. */
+void *
+mmap(int fdnum, off_t offset, size_t len, int prot, int flags) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	41 57                	push   %r15
+  8028a6:	41 56                	push   %r14
+  8028a8:	41 55                	push   %r13
+  8028aa:	41 54                	push   %r12
+  8028ac:	53                   	push   %rbx
+  8028ad:	48 83 ec 38          	sub    $0x38,%rsp
+  8028b1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8028b4:	41 89 f6             	mov    %esi,%r14d
+  8028b7:	49 89 d5             	mov    %rdx,%r13
+  8028ba:	89 cb                	mov    %ecx,%ebx
+  8028bc:	45 89 c4             	mov    %r8d,%r12d
+    struct Fd *fd;
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8028bf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028c3:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	0f 88 33 02 00 00    	js     802b0a <mmap+0x26a>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  8028d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id ||
+  8028dc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8028e0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8028e7:	00 00 00 
+  8028ea:	8b 3a                	mov    (%rdx),%edi
+  8028ec:	39 39                	cmp    %edi,(%rcx)
+  8028ee:	0f 85 1b 02 00 00    	jne    802b0f <mmap+0x26f>
+        !len || offset < 0 || PAGE_OFFSET(offset) ||
+  8028f4:	4d 85 ed             	test   %r13,%r13
+  8028f7:	41 0f 94 c0          	sete   %r8b
+  8028fb:	44 89 f0             	mov    %r14d,%eax
+  8028fe:	c1 e8 1f             	shr    $0x1f,%eax
+  802901:	41 08 c0             	or     %al,%r8b
+  802904:	0f 85 14 02 00 00    	jne    802b1e <mmap+0x27e>
+  80290a:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802911:	0f 85 0e 02 00 00    	jne    802b25 <mmap+0x285>
+  802917:	83 fb 07             	cmp    $0x7,%ebx
+  80291a:	0f 87 0c 02 00 00    	ja     802b2c <mmap+0x28c>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802920:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  802925:	b8 00 00 00 00       	mov    $0x0,%eax
+        prot & ~(PROT_R | PROT_W | PROT_X) ||
+  80292a:	83 fa 01             	cmp    $0x1,%edx
+  80292d:	0f 87 dc 01 00 00    	ja     802b0f <mmap+0x26f>
+  802933:	48 ba 28 80 80 00 00 	movabs $0x808028,%rdx
+  80293a:	00 00 00 
+  80293d:	eb 0e                	jmp    80294d <mmap+0xad>
+
+    struct Mapping *m = NULL;
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  80293f:	48 83 c0 01          	add    $0x1,%rax
+  802943:	48 83 c2 20          	add    $0x20,%rdx
+  802947:	48 83 f8 40          	cmp    $0x40,%rax
+  80294b:	74 44                	je     802991 <mmap+0xf1>
+        if (!mappings[i].m_size) m = &mappings[i];
+  80294d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802951:	75 ec                	jne    80293f <mmap+0x9f>
+  802953:	48 c1 e0 05          	shl    $0x5,%rax
+  802957:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  80295e:	00 00 00 
+  802961:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+
+    size_t size = ROUNDUP(len, PAGE_SIZE);
+  802965:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80296c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802973:	49 89 d7             	mov    %rdx,%r15
+    uintptr_t start = MMAP_BASE;
+  802976:	48 be 00 00 00 00 03 	movabs $0x300000000,%rsi
+  80297d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802980:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  802985:	49 b9 20 80 80 00 00 	movabs $0x808020,%r9
+  80298c:	00 00 00 
+  80298f:	eb 17                	jmp    8029a8 <mmap+0x108>
+  802991:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (size_t i = 0; i < MMAP_MAX && !m; i++)
+  802996:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80299c:	eb c7                	jmp    802965 <mmap+0xc5>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80299e:	48 83 c0 01          	add    $0x1,%rax
+  8029a2:	48 83 f8 3f          	cmp    $0x3f,%rax
+  8029a6:	77 37                	ja     8029df <mmap+0x13f>
+        if (m->m_size && start < m->m_start + m->m_size && m->m_start < start + size) {
+  8029a8:	48 89 c2             	mov    %rax,%rdx
+  8029ab:	48 c1 e2 05          	shl    $0x5,%rdx
+  8029af:	49 8b 54 11 08       	mov    0x8(%r9,%rdx,1),%rdx
+  8029b4:	48 85 d2             	test   %rdx,%rdx
+  8029b7:	74 e5                	je     80299e <mmap+0xfe>
+  8029b9:	48 89 c7             	mov    %rax,%rdi
+  8029bc:	48 c1 e7 05          	shl    $0x5,%rdi
+  8029c0:	49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+  8029c4:	48 01 fa             	add    %rdi,%rdx
+  8029c7:	48 39 d6             	cmp    %rdx,%rsi
+  8029ca:	73 d2                	jae    80299e <mmap+0xfe>
+  8029cc:	4d 8d 14 37          	lea    (%r15,%rsi,1),%r10
+  8029d0:	4c 39 d7             	cmp    %r10,%rdi
+  8029d3:	73 c9                	jae    80299e <mmap+0xfe>
+            start = m->m_start + m->m_size;
+  8029d5:	48 89 d6             	mov    %rdx,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8029d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029dd:	eb c9                	jmp    8029a8 <mmap+0x108>
+    return start + size <= MMAP_END ? start : 0;
+  8029df:	49 8d 3c 37          	lea    (%r15,%rsi,1),%rdi
+    uintptr_t start = mmap_find(size);
+    if (!m || !start) return NULL;
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return start + size <= MMAP_END ? start : 0;
+  8029e8:	49 b9 00 00 00 00 04 	movabs $0x400000000,%r9
+  8029ef:	00 00 00 
+  8029f2:	49 39 f9             	cmp    %rdi,%r9
+  8029f5:	0f 82 14 01 00 00    	jb     802b0f <mmap+0x26f>
+    if (!m || !start) return NULL;
+  8029fb:	48 85 f6             	test   %rsi,%rsi
+  8029fe:	0f 84 2f 01 00 00    	je     802b33 <mmap+0x293>
+  802a04:	45 84 c0             	test   %r8b,%r8b
+  802a07:	0f 85 26 01 00 00    	jne    802b33 <mmap+0x293>
+
+    int perm = prot | PROT_R | (flags == MAP_SHARED ? PROT_SHARE : 0);
+  802a0d:	41 83 fc 01          	cmp    $0x1,%r12d
+  802a11:	0f 94 c0             	sete   %al
+  802a14:	0f b6 c0             	movzbl %al,%eax
+  802a17:	c1 e0 06             	shl    $0x6,%eax
+  802a1a:	09 d8                	or     %ebx,%eax
+  802a1c:	89 c3                	mov    %eax,%ebx
+  802a1e:	83 cb 04             	or     $0x4,%ebx
+  802a21:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+    for (size_t i = 0; i < size;) {
+  802a24:	4d 85 ff             	test   %r15,%r15
+  802a27:	0f 84 bd 00 00 00    	je     802aea <mmap+0x24a>
+  802a2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        }
+
+        /* Holes and the rest after the end of file */
+        if (res && res != -E_NOT_FOUND) goto error;
+        size_t n = res ? PAGE_SIZE : size - i;
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802a32:	83 e0 bf             	and    $0xffffffbf,%eax
+  802a35:	83 c8 04             	or     $0x4,%eax
+  802a38:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  802a3b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802a3f:	44 89 75 b4          	mov    %r14d,-0x4c(%rbp)
+  802a43:	49 89 f6             	mov    %rsi,%r14
+  802a46:	eb 43                	jmp    802a8b <mmap+0x1eb>
+            i += ROUNDUP(res, PAGE_SIZE);
+  802a48:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802a4e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a54:	48 01 c3             	add    %rax,%rbx
+            continue;
+  802a57:	eb 2d                	jmp    802a86 <mmap+0x1e6>
+        size_t n = res ? PAGE_SIZE : size - i;
+  802a59:	48 85 c0             	test   %rax,%rax
+  802a5c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a61:	4c 0f 45 e0          	cmovne %rax,%r12
+        if (sys_alloc_region(0, (void *)(start + i), n, perm & ~PROT_SHARE) < 0) goto error;
+  802a65:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  802a68:	4c 89 e2             	mov    %r12,%rdx
+  802a6b:	4c 89 ee             	mov    %r13,%rsi
+  802a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a73:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  802a7a:	00 00 00 
+  802a7d:	ff d0                	call   *%rax
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	78 3e                	js     802ac1 <mmap+0x221>
+        i += n;
+  802a83:	4c 01 e3             	add    %r12,%rbx
+    for (size_t i = 0; i < size;) {
+  802a86:	4c 39 fb             	cmp    %r15,%rbx
+  802a89:	73 54                	jae    802adf <mmap+0x23f>
+        ssize_t res = read_map(fdnum, offset + i, (void *)(start + i), size - i, perm);
+  802a8b:	4d 89 fc             	mov    %r15,%r12
+  802a8e:	49 29 dc             	sub    %rbx,%r12
+  802a91:	4e 8d 2c 33          	lea    (%rbx,%r14,1),%r13
+  802a95:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802a98:	8d 34 18             	lea    (%rax,%rbx,1),%esi
+  802a9b:	44 8b 45 b8          	mov    -0x48(%rbp),%r8d
+  802a9f:	4c 89 e1             	mov    %r12,%rcx
+  802aa2:	4c 89 ea             	mov    %r13,%rdx
+  802aa5:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  802aa8:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+        if (res > 0) {
+  802ab4:	48 85 c0             	test   %rax,%rax
+  802ab7:	7f 8f                	jg     802a48 <mmap+0x1a8>
+        if (res && res != -E_NOT_FOUND) goto error;
+  802ab9:	74 9e                	je     802a59 <mmap+0x1b9>
+  802abb:	48 83 f8 f1          	cmp    $0xfffffffffffffff1,%rax
+  802abf:	74 98                	je     802a59 <mmap+0x1b9>
+
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+    return (void *)start;
+
+error:
+    sys_unmap_region(0, (void *)start, size);
+  802ac1:	4c 89 f6             	mov    %r14,%rsi
+  802ac4:	4c 89 fa             	mov    %r15,%rdx
+  802ac7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802acc:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+    return NULL;
+  802ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802add:	eb 30                	jmp    802b0f <mmap+0x26f>
+  802adf:	4c 89 f6             	mov    %r14,%rsi
+  802ae2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802ae6:	44 8b 75 b4          	mov    -0x4c(%rbp),%r14d
+    *m = (struct Mapping){start, size, fd->fd_file.id, offset, perm};
+  802aea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802aee:	8b 40 0c             	mov    0xc(%rax),%eax
+  802af1:	48 89 31             	mov    %rsi,(%rcx)
+  802af4:	4c 89 79 08          	mov    %r15,0x8(%rcx)
+  802af8:	89 41 10             	mov    %eax,0x10(%rcx)
+  802afb:	44 89 71 14          	mov    %r14d,0x14(%rcx)
+  802aff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b02:	89 41 18             	mov    %eax,0x18(%rcx)
+    return (void *)start;
+  802b05:	48 89 f0             	mov    %rsi,%rax
+  802b08:	eb 05                	jmp    802b0f <mmap+0x26f>
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b0f:	48 83 c4 38          	add    $0x38,%rsp
+  802b13:	5b                   	pop    %rbx
+  802b14:	41 5c                	pop    %r12
+  802b16:	41 5d                	pop    %r13
+  802b18:	41 5e                	pop    %r14
+  802b1a:	41 5f                	pop    %r15
+  802b1c:	5d                   	pop    %rbp
+  802b1d:	c3                   	ret
+        (flags != MAP_SHARED && flags != MAP_PRIVATE)) return NULL;
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b23:	eb ea                	jmp    802b0f <mmap+0x26f>
+  802b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2a:	eb e3                	jmp    802b0f <mmap+0x26f>
+  802b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b31:	eb dc                	jmp    802b0f <mmap+0x26f>
+    if (!m || !start) return NULL;
+  802b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b38:	eb d5                	jmp    802b0f <mmap+0x26f>
+
+0000000000802b3a <msync>:
+/* Write pages changed through the MAP_SHARED mapping containing
+ * [addr, addr + len) to disk.  Does nothing for MAP_PRIVATE.
+ * Needs the file to be still open.
+ * Returns 0 on success, < 0 on error. */
+int
+msync(void *addr, size_t len) {
+  802b3a:	55                   	push   %rbp
+  802b3b:	48 89 e5             	mov    %rsp,%rbp
+  802b3e:	41 57                	push   %r15
+  802b40:	41 56                	push   %r14
+  802b42:	41 55                	push   %r13
+  802b44:	41 54                	push   %r12
+  802b46:	53                   	push   %rbx
+  802b47:	48 83 ec 38          	sub    $0x38,%rsp
+  802b4b:	49 89 fc             	mov    %rdi,%r12
+  802b4e:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802b51:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  802b58:	00 00 00 
+  802b5b:	ff d0                	call   *%rax
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802b5d:	48 85 c0             	test   %rax,%rax
+  802b60:	0f 84 2f 01 00 00    	je     802c95 <msync+0x15b>
+  802b66:	49 89 c7             	mov    %rax,%r15
+  802b69:	4d 01 e5             	add    %r12,%r13
+  802b6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b70:	49 03 07             	add    (%r15),%rax
+  802b73:	4c 39 e8             	cmp    %r13,%rax
+  802b76:	0f 82 20 01 00 00    	jb     802c9c <msync+0x162>
+    if (!(m->m_perm & PROT_SHARE)) return 0;
+  802b7c:	41 8b 47 18          	mov    0x18(%r15),%eax
+  802b80:	83 e0 40             	and    $0x40,%eax
+  802b83:	0f 84 fd 00 00 00    	je     802c86 <msync+0x14c>
+
+    uintptr_t va = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  802b89:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  802b90:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802b97:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    while (va < end) {
+  802b9e:	4d 39 ec             	cmp    %r13,%r12
+  802ba1:	0f 83 fc 00 00 00    	jae    802ca3 <msync+0x169>
+        if (!is_page_dirty((void *)va)) {
+  802ba7:	49 be d2 35 80 00 00 	movabs $0x8035d2,%r14
+  802bae:	00 00 00 
+  802bb1:	e9 b0 00 00 00       	jmp    802c66 <msync+0x12c>
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  802bb6:	4c 89 e3             	mov    %r12,%rbx
+  802bb9:	4d 39 ec             	cmp    %r13,%r12
+  802bbc:	73 16                	jae    802bd4 <msync+0x9a>
+  802bbe:	48 89 df             	mov    %rbx,%rdi
+  802bc1:	41 ff d6             	call   *%r14
+  802bc4:	84 c0                	test   %al,%al
+  802bc6:	74 0c                	je     802bd4 <msync+0x9a>
+  802bc8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bcf:	4c 39 eb             	cmp    %r13,%rbx
+  802bd2:	72 ea                	jb     802bbe <msync+0x84>
+
+        /* Clear dirty bits before the server writes the blocks,
+         * so that changes made after that are not lost */
+        int res = sys_map_region(0, (void *)run, 0, (void *)run, va - run, m->m_perm);
+  802bd4:	48 89 d8             	mov    %rbx,%rax
+  802bd7:	4c 29 e0             	sub    %r12,%rax
+  802bda:	45 8b 4f 18          	mov    0x18(%r15),%r9d
+  802bde:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802be2:	49 89 c0             	mov    %rax,%r8
+  802be5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bee:	48 89 ce             	mov    %rcx,%rsi
+  802bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf6:	49 ba e8 11 80 00 00 	movabs $0x8011e8,%r10
+  802bfd:	00 00 00 
+  802c00:	41 ff d2             	call   *%r10
+        if (res < 0) return res;
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	78 7f                	js     802c86 <msync+0x14c>
+
+        uint64_t words[IPC_NWORDS] = {m->m_fileid, m->m_offset + (run - m->m_start), va - run};
+  802c07:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c0e:	00 
+  802c0f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802c16:	00 
+  802c17:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c1e:	00 
+  802c1f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c26:	00 
+  802c27:	49 63 47 10          	movslq 0x10(%r15),%rax
+  802c2b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802c2f:	49 63 47 14          	movslq 0x14(%r15),%rax
+  802c33:	49 2b 07             	sub    (%r15),%rax
+  802c36:	4c 01 e0             	add    %r12,%rax
+  802c39:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c3d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802c41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((res = fsipc_words(FSREQ_MSYNC, words)) < 0) return res;
+  802c45:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  802c49:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c4e:	48 b8 50 20 80 00 00 	movabs $0x802050,%rax
+  802c55:	00 00 00 
+  802c58:	ff d0                	call   *%rax
+  802c5a:	85 c0                	test   %eax,%eax
+  802c5c:	78 28                	js     802c86 <msync+0x14c>
+  802c5e:	49 89 dc             	mov    %rbx,%r12
+    while (va < end) {
+  802c61:	4d 39 ec             	cmp    %r13,%r12
+  802c64:	73 1b                	jae    802c81 <msync+0x147>
+        if (!is_page_dirty((void *)va)) {
+  802c66:	4c 89 65 a8          	mov    %r12,-0x58(%rbp)
+  802c6a:	4c 89 e7             	mov    %r12,%rdi
+  802c6d:	41 ff d6             	call   *%r14
+  802c70:	84 c0                	test   %al,%al
+  802c72:	0f 85 3e ff ff ff    	jne    802bb6 <msync+0x7c>
+            va += PAGE_SIZE;
+  802c78:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+            continue;
+  802c7f:	eb e0                	jmp    802c61 <msync+0x127>
+    }
+
+    return 0;
+  802c81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c86:	48 83 c4 38          	add    $0x38,%rsp
+  802c8a:	5b                   	pop    %rbx
+  802c8b:	41 5c                	pop    %r12
+  802c8d:	41 5d                	pop    %r13
+  802c8f:	41 5e                	pop    %r14
+  802c91:	41 5f                	pop    %r15
+  802c93:	5d                   	pop    %rbp
+  802c94:	c3                   	ret
+    if (!m || (uintptr_t)addr + len > m->m_start + m->m_size) return -E_INVAL;
+  802c95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c9a:	eb ea                	jmp    802c86 <msync+0x14c>
+  802c9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca1:	eb e3                	jmp    802c86 <msync+0x14c>
+    return 0;
+  802ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca8:	eb dc                	jmp    802c86 <msync+0x14c>
+
+0000000000802caa <munmap>:
+
+/* Remove mapping made by mmap() at 'addr' of 'len' bytes,
+ * writing changed pages to disk first if it is MAP_SHARED.
+ * Returns 0 on success, < 0 on error. */
+int
+munmap(void *addr, size_t len) {
+  802caa:	55                   	push   %rbp
+  802cab:	48 89 e5             	mov    %rsp,%rbp
+  802cae:	41 55                	push   %r13
+  802cb0:	41 54                	push   %r12
+  802cb2:	53                   	push   %rbx
+  802cb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb7:	49 89 fc             	mov    %rdi,%r12
+  802cba:	49 89 f5             	mov    %rsi,%r13
+    struct Mapping *m = mmap_lookup((uintptr_t)addr);
+  802cbd:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802cc9:	48 85 c0             	test   %rax,%rax
+  802ccc:	74 58                	je     802d26 <munmap+0x7c>
+  802cce:	48 89 c3             	mov    %rax,%rbx
+  802cd1:	4c 3b 20             	cmp    (%rax),%r12
+  802cd4:	75 57                	jne    802d2d <munmap+0x83>
+  802cd6:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  802cdd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ce3:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  802ce7:	75 4b                	jne    802d34 <munmap+0x8a>
+
+    /* File might be closed already, so keep going */
+    USED(msync(addr, len));
+  802ce9:	4c 89 ee             	mov    %r13,%rsi
+  802cec:	4c 89 e7             	mov    %r12,%rdi
+  802cef:	48 b8 3a 2b 80 00 00 	movabs $0x802b3a,%rax
+  802cf6:	00 00 00 
+  802cf9:	ff d0                	call   *%rax
+
+    int res = sys_unmap_region(0, addr, m->m_size);
+  802cfb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802cff:	4c 89 e6             	mov    %r12,%rsi
+  802d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d07:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+    m->m_size = 0;
+  802d13:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  802d1a:	00 
+    return res;
+}
+  802d1b:	48 83 c4 08          	add    $0x8,%rsp
+  802d1f:	5b                   	pop    %rbx
+  802d20:	41 5c                	pop    %r12
+  802d22:	41 5d                	pop    %r13
+  802d24:	5d                   	pop    %rbp
+  802d25:	c3                   	ret
+    if (!m || m->m_start != (uintptr_t)addr || ROUNDUP(len, PAGE_SIZE) != m->m_size) return -E_INVAL;
+  802d26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d2b:	eb ee                	jmp    802d1b <munmap+0x71>
+  802d2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d32:	eb e7                	jmp    802d1b <munmap+0x71>
+  802d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d39:	eb e0                	jmp    802d1b <munmap+0x71>
+
+0000000000802d3b <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802d3b:	55                   	push   %rbp
+  802d3c:	48 89 e5             	mov    %rsp,%rbp
+  802d3f:	41 54                	push   %r12
+  802d41:	53                   	push   %rbx
+  802d42:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d45:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+  802d51:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802d54:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  802d5b:	00 00 00 
+  802d5e:	48 89 df             	mov    %rbx,%rdi
+  802d61:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  802d68:	00 00 00 
+  802d6b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802d6d:	41 8b 44 24 40       	mov    0x40(%r12),%eax
+  802d72:	41 8b 14 24          	mov    (%r12),%edx
+  802d76:	29 d0                	sub    %edx,%eax
+  802d78:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d7e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d85:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d88:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802d8f:	00 00 00 
+  802d92:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	5d                   	pop    %rbp
+  802da2:	c3                   	ret
+
+0000000000802da3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802da3:	55                   	push   %rbp
+  802da4:	48 89 e5             	mov    %rsp,%rbp
+  802da7:	41 55                	push   %r13
+  802da9:	41 54                	push   %r12
+  802dab:	53                   	push   %rbx
+  802dac:	48 83 ec 08          	sub    $0x8,%rsp
+  802db0:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802db3:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+  802dbf:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802dc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dc7:	4c 89 e6             	mov    %r12,%rsi
+  802dca:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dcf:	49 bc b5 12 80 00 00 	movabs $0x8012b5,%r12
+  802dd6:	00 00 00 
+  802dd9:	41 ff d4             	call   *%r12
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802ddc:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+    return (uint8_t *)p + PAGE_SIZE;
+  802de2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    USED(sys_unmap_region(0, pipebuf(p), p->p_size));
+  802de9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dee:	41 ff d4             	call   *%r12
+
+    /* The other end sees that we are gone once it wakes up */
+    sys_futex_wake(&p->p_rpos, NENV);
+  802df1:	be 00 04 00 00       	mov    $0x400,%esi
+  802df6:	48 89 df             	mov    %rbx,%rdi
+  802df9:	49 bd 2f 18 80 00 00 	movabs $0x80182f,%r13
+  802e00:	00 00 00 
+  802e03:	41 ff d5             	call   *%r13
+    sys_futex_wake(&p->p_wpos, NENV);
+  802e06:	48 8d 7b 40          	lea    0x40(%rbx),%rdi
+  802e0a:	be 00 04 00 00       	mov    $0x400,%esi
+  802e0f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802e12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e17:	48 89 de             	mov    %rbx,%rsi
+  802e1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1f:	41 ff d4             	call   *%r12
+}
+  802e22:	48 83 c4 08          	add    $0x8,%rsp
+  802e26:	5b                   	pop    %rbx
+  802e27:	41 5c                	pop    %r12
+  802e29:	41 5d                	pop    %r13
+  802e2b:	5d                   	pop    %rbp
+  802e2c:	c3                   	ret
+
+0000000000802e2d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802e2d:	55                   	push   %rbp
+  802e2e:	48 89 e5             	mov    %rsp,%rbp
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802e31:	8b 8e 80 00 00 00    	mov    0x80(%rsi),%ecx
+    return (uint8_t *)p + PAGE_SIZE;
+  802e37:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, pipebuf(p), p->p_size);
+  802e3e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e43:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	0f 94 c0             	sete   %al
+  802e54:	0f b6 c0             	movzbl %al,%eax
+}
+  802e57:	5d                   	pop    %rbp
+  802e58:	c3                   	ret
+
+0000000000802e59 <pipe_wait>:
+    __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+  802e59:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e5e:	87 02                	xchg   %eax,(%rdx)
+    if (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+  802e60:	8b 07                	mov    (%rdi),%eax
+  802e62:	39 f0                	cmp    %esi,%eax
+  802e64:	74 01                	je     802e67 <pipe_wait+0xe>
+  802e66:	c3                   	ret
+pipe_wait(volatile uint32_t *pos, uint32_t seen, volatile uint32_t *flag) {
+  802e67:	55                   	push   %rbp
+  802e68:	48 89 e5             	mov    %rsp,%rbp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802e6b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802e6d:	48 c1 e2 20          	shl    $0x20,%rdx
+  802e71:	89 c0                	mov    %eax,%eax
+  802e73:	48 09 c2             	or     %rax,%rdx
+        sys_futex_wait(pos, seen, read_tsc() + PIPE_POLL);
+  802e76:	48 81 c2 00 00 00 01 	add    $0x1000000,%rdx
+  802e7d:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  802e84:	00 00 00 
+  802e87:	ff d0                	call   *%rax
+}
+  802e89:	5d                   	pop    %rbp
+  802e8a:	c3                   	ret
+
+0000000000802e8b <pipe_wake>:
+    if (__atomic_exchange_n(flag, 0, __ATOMIC_SEQ_CST))
+  802e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e90:	87 06                	xchg   %eax,(%rsi)
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	75 01                	jne    802e97 <pipe_wake+0xc>
+  802e96:	c3                   	ret
+pipe_wake(volatile uint32_t *pos, volatile uint32_t *flag) {
+  802e97:	55                   	push   %rbp
+  802e98:	48 89 e5             	mov    %rsp,%rbp
+        sys_futex_wake(pos, NENV);
+  802e9b:	be 00 04 00 00       	mov    $0x400,%esi
+  802ea0:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+}
+  802eac:	5d                   	pop    %rbp
+  802ead:	c3                   	ret
+
+0000000000802eae <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802eae:	55                   	push   %rbp
+  802eaf:	48 89 e5             	mov    %rsp,%rbp
+  802eb2:	41 57                	push   %r15
+  802eb4:	41 56                	push   %r14
+  802eb6:	41 55                	push   %r13
+  802eb8:	41 54                	push   %r12
+  802eba:	53                   	push   %rbx
+  802ebb:	48 83 ec 28          	sub    $0x28,%rsp
+  802ebf:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  802ec3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802ec7:	48 89 d3             	mov    %rdx,%rbx
+  802eca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ece:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  802ed5:	00 00 00 
+  802ed8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802eda:	48 85 db             	test   %rbx,%rbx
+  802edd:	0f 84 0f 01 00 00    	je     802ff2 <devpipe_write+0x144>
+  802ee3:	49 89 c4             	mov    %rax,%r12
+  802ee6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return (uint8_t *)p + PAGE_SIZE;
+  802eec:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802ef3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ef7:	eb 4f                	jmp    802f48 <devpipe_write+0x9a>
+            if (_pipeisclosed(fd, p)) return 0;
+  802ef9:	4c 89 e6             	mov    %r12,%rsi
+  802efc:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802f00:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+  802f0c:	85 c0                	test   %eax,%eax
+  802f0e:	74 14                	je     802f24 <devpipe_write+0x76>
+  802f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f15:	48 83 c4 28          	add    $0x28,%rsp
+  802f19:	5b                   	pop    %rbx
+  802f1a:	41 5c                	pop    %r12
+  802f1c:	41 5d                	pop    %r13
+  802f1e:	41 5e                	pop    %r14
+  802f20:	41 5f                	pop    %r15
+  802f22:	5d                   	pop    %rbp
+  802f23:	c3                   	ret
+            pipe_wait(&p->p_rpos, rpos, &p->p_wwait);
+  802f24:	49 8d 54 24 44       	lea    0x44(%r12),%rdx
+  802f29:	44 89 ee             	mov    %r13d,%esi
+  802f2c:	4c 89 e7             	mov    %r12,%rdi
+  802f2f:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n;) {
+  802f3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f3f:	49 39 c7             	cmp    %rax,%r15
+  802f42:	0f 83 aa 00 00 00    	jae    802ff2 <devpipe_write+0x144>
+        uint32_t wpos = p->p_wpos;
+  802f48:	45 8b 74 24 40       	mov    0x40(%r12),%r14d
+        uint32_t rpos = __atomic_load_n(&p->p_rpos, __ATOMIC_ACQUIRE);
+  802f4d:	45 8b 2c 24          	mov    (%r12),%r13d
+        if (wpos - rpos == p->p_size) /* pipe is full */ {
+  802f51:	41 8b 9c 24 80 00 00 	mov    0x80(%r12),%ebx
+  802f58:	00 
+  802f59:	44 89 f0             	mov    %r14d,%eax
+  802f5c:	44 29 e8             	sub    %r13d,%eax
+  802f5f:	39 d8                	cmp    %ebx,%eax
+  802f61:	74 96                	je     802ef9 <devpipe_write+0x4b>
+        size_t chunk = MIN(n - i, p->p_size - (wpos - rpos));
+  802f63:	89 d8                	mov    %ebx,%eax
+  802f65:	44 29 f0             	sub    %r14d,%eax
+  802f68:	46 8d 2c 28          	lea    (%rax,%r13,1),%r13d
+  802f6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f70:	4c 29 f8             	sub    %r15,%rax
+  802f73:	49 39 c5             	cmp    %rax,%r13
+  802f76:	4c 0f 47 e8          	cmova  %rax,%r13
+        size_t off = wpos & (p->p_size - 1);
+  802f7a:	8d 43 ff             	lea    -0x1(%rbx),%eax
+  802f7d:	44 21 f0             	and    %r14d,%eax
+        size_t first = MIN(chunk, p->p_size - off);
+  802f80:	89 db                	mov    %ebx,%ebx
+  802f82:	48 29 c3             	sub    %rax,%rbx
+  802f85:	4c 39 eb             	cmp    %r13,%rbx
+  802f88:	49 0f 47 dd          	cmova  %r13,%rbx
+        memcpy(pipebuf(p) + off, buf + i, first);
+  802f8c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f90:	4a 8d 34 39          	lea    (%rcx,%r15,1),%rsi
+  802f94:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f9b:	00 
+  802f9c:	48 89 da             	mov    %rbx,%rdx
+  802f9f:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  802fa6:	00 00 00 
+  802fa9:	ff d0                	call   *%rax
+        memcpy(pipebuf(p), buf + i + first, chunk - first);
+  802fab:	4c 89 ea             	mov    %r13,%rdx
+  802fae:	48 29 da             	sub    %rbx,%rdx
+  802fb1:	4a 8d 34 3b          	lea    (%rbx,%r15,1),%rsi
+  802fb5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802fb9:	48 01 ce             	add    %rcx,%rsi
+  802fbc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802fc0:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+        __atomic_store_n(&p->p_wpos, wpos + chunk, __ATOMIC_RELEASE);
+  802fcc:	49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+  802fd1:	45 01 ee             	add    %r13d,%r14d
+  802fd4:	45 89 74 24 40       	mov    %r14d,0x40(%r12)
+        pipe_wake(&p->p_wpos, &p->p_rwait);
+  802fd9:	49 8d 74 24 04       	lea    0x4(%r12),%rsi
+  802fde:	48 b8 8b 2e 80 00 00 	movabs $0x802e8b,%rax
+  802fe5:	00 00 00 
+  802fe8:	ff d0                	call   *%rax
+        i += chunk;
+  802fea:	4d 01 ef             	add    %r13,%r15
+  802fed:	e9 49 ff ff ff       	jmp    802f3b <devpipe_write+0x8d>
+    return n;
+  802ff2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ff6:	e9 1a ff ff ff       	jmp    802f15 <devpipe_write+0x67>
+
+0000000000802ffb <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	41 57                	push   %r15
+  803001:	41 56                	push   %r14
+  803003:	41 55                	push   %r13
+  803005:	41 54                	push   %r12
+  803007:	53                   	push   %rbx
+  803008:	48 83 ec 28          	sub    $0x28,%rsp
+  80300c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803010:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803014:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803018:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+  803024:	49 89 c4             	mov    %rax,%r12
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803027:	4c 8d 70 40          	lea    0x40(%rax),%r14
+        if (_pipeisclosed(fd, p)) return 0;
+  80302b:	49 bf 2d 2e 80 00 00 	movabs $0x802e2d,%r15
+  803032:	00 00 00 
+        pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803035:	48 8d 40 04          	lea    0x4(%rax),%rax
+  803039:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80303d:	eb 15                	jmp    803054 <devpipe_read+0x59>
+  80303f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803043:	89 de                	mov    %ebx,%esi
+  803045:	4c 89 f7             	mov    %r14,%rdi
+  803048:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+        rpos = p->p_rpos;
+  803054:	45 8b 2c 24          	mov    (%r12),%r13d
+        wpos = __atomic_load_n(&p->p_wpos, __ATOMIC_ACQUIRE);
+  803058:	41 8b 1e             	mov    (%r14),%ebx
+        if (rpos != wpos) break;
+  80305b:	41 39 dd             	cmp    %ebx,%r13d
+  80305e:	75 15                	jne    803075 <devpipe_read+0x7a>
+        if (_pipeisclosed(fd, p)) return 0;
+  803060:	4c 89 e6             	mov    %r12,%rsi
+  803063:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803067:	41 ff d7             	call   *%r15
+  80306a:	85 c0                	test   %eax,%eax
+  80306c:	74 d1                	je     80303f <devpipe_read+0x44>
+  80306e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803073:	eb 7c                	jmp    8030f1 <devpipe_read+0xf6>
+    n = MIN(n, wpos - rpos);
+  803075:	44 29 eb             	sub    %r13d,%ebx
+  803078:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80307c:	48 39 c3             	cmp    %rax,%rbx
+  80307f:	48 0f 47 d8          	cmova  %rax,%rbx
+    size_t off = rpos & (p->p_size - 1);
+  803083:	45 8b b4 24 80 00 00 	mov    0x80(%r12),%r14d
+  80308a:	00 
+  80308b:	41 8d 46 ff          	lea    -0x1(%r14),%eax
+  80308f:	44 21 e8             	and    %r13d,%eax
+    size_t first = MIN(n, p->p_size - off);
+  803092:	45 89 f6             	mov    %r14d,%r14d
+  803095:	49 29 c6             	sub    %rax,%r14
+  803098:	49 39 de             	cmp    %rbx,%r14
+  80309b:	4c 0f 47 f3          	cmova  %rbx,%r14
+    memcpy(vbuf, pipebuf(p) + off, first);
+  80309f:	49 8d b4 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rsi
+  8030a6:	00 
+  8030a7:	4c 89 f2             	mov    %r14,%rdx
+  8030aa:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8030ae:	49 bf 32 0e 80 00 00 	movabs $0x800e32,%r15
+  8030b5:	00 00 00 
+  8030b8:	41 ff d7             	call   *%r15
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8030bb:	48 89 da             	mov    %rbx,%rdx
+  8030be:	4c 29 f2             	sub    %r14,%rdx
+    return (uint8_t *)p + PAGE_SIZE;
+  8030c1:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8030c8:	00 
+    memcpy((uint8_t *)vbuf + first, pipebuf(p), n - first);
+  8030c9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8030cd:	4c 01 f7             	add    %r14,%rdi
+  8030d0:	41 ff d7             	call   *%r15
+    __atomic_store_n(&p->p_rpos, rpos + n, __ATOMIC_RELEASE);
+  8030d3:	41 01 dd             	add    %ebx,%r13d
+  8030d6:	45 89 2c 24          	mov    %r13d,(%r12)
+    pipe_wake(&p->p_rpos, &p->p_wwait);
+  8030da:	49 8d 74 24 44       	lea    0x44(%r12),%rsi
+  8030df:	4c 89 e7             	mov    %r12,%rdi
+  8030e2:	48 b8 8b 2e 80 00 00 	movabs $0x802e8b,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+    return n;
+  8030ee:	48 89 d8             	mov    %rbx,%rax
+}
+  8030f1:	48 83 c4 28          	add    $0x28,%rsp
+  8030f5:	5b                   	pop    %rbx
+  8030f6:	41 5c                	pop    %r12
+  8030f8:	41 5d                	pop    %r13
+  8030fa:	41 5e                	pop    %r14
+  8030fc:	41 5f                	pop    %r15
+  8030fe:	5d                   	pop    %rbp
+  8030ff:	c3                   	ret
+
+0000000000803100 <pipe_sized>:
+pipe_sized(int pfd[2], size_t size) {
+  803100:	55                   	push   %rbp
+  803101:	48 89 e5             	mov    %rsp,%rbp
+  803104:	41 57                	push   %r15
+  803106:	41 56                	push   %r14
+  803108:	41 55                	push   %r13
+  80310a:	41 54                	push   %r12
+  80310c:	53                   	push   %rbx
+  80310d:	48 83 ec 18          	sub    $0x18,%rsp
+  803111:	49 89 fd             	mov    %rdi,%r13
+    while (bufsize < size) bufsize *= 2;
+  803114:	48 81 fe 00 10 00 00 	cmp    $0x1000,%rsi
+  80311b:	0f 86 96 01 00 00    	jbe    8032b7 <pipe_sized+0x1b7>
+    size_t bufsize = PAGE_SIZE;
+  803121:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    while (bufsize < size) bufsize *= 2;
+  803126:	48 01 db             	add    %rbx,%rbx
+  803129:	48 39 f3             	cmp    %rsi,%rbx
+  80312c:	72 f8                	jb     803126 <pipe_sized+0x26>
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  80312e:	48 81 fb 00 00 02 00 	cmp    $0x20000,%rbx
+  803135:	0f 87 18 02 00 00    	ja     803353 <pipe_sized+0x253>
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80313b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80313f:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	41 89 c4             	mov    %eax,%r12d
+  80314e:	85 c0                	test   %eax,%eax
+  803150:	0f 88 b6 01 00 00    	js     80330c <pipe_sized+0x20c>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803156:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80315b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803160:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803164:	bf 00 00 00 00       	mov    $0x0,%edi
+  803169:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803178:	85 c0                	test   %eax,%eax
+  80317a:	0f 88 8c 01 00 00    	js     80330c <pipe_sized+0x20c>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803180:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  803184:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  80318b:	00 00 00 
+  80318e:	ff d0                	call   *%rax
+  803190:	41 89 c4             	mov    %eax,%r12d
+  803193:	85 c0                	test   %eax,%eax
+  803195:	0f 88 57 01 00 00    	js     8032f2 <pipe_sized+0x1f2>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80319b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031a5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ae:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+  8031ba:	41 89 c4             	mov    %eax,%r12d
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	0f 88 2d 01 00 00    	js     8032f2 <pipe_sized+0x1f2>
+    va = fd2data(fd0);
+  8031c5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031c9:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+  8031d5:	49 89 c6             	mov    %rax,%r14
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8031d8:	4c 8d bb 00 10 00 00 	lea    0x1000(%rbx),%r15
+  8031df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8031e4:	4c 89 fa             	mov    %r15,%rdx
+  8031e7:	48 89 c6             	mov    %rax,%rsi
+  8031ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ef:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	41 89 c4             	mov    %eax,%r12d
+  8031fe:	85 c0                	test   %eax,%eax
+  803200:	0f 88 d2 00 00 00    	js     8032d8 <pipe_sized+0x1d8>
+    ((struct Pipe *)va)->p_size = bufsize;
+  803206:	41 89 9e 80 00 00 00 	mov    %ebx,0x80(%r14)
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE + bufsize, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80320d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803211:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  803218:	00 00 00 
+  80321b:	ff d0                	call   *%rax
+  80321d:	48 89 c1             	mov    %rax,%rcx
+  803220:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803226:	4d 89 f8             	mov    %r15,%r8
+  803229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322e:	4c 89 f6             	mov    %r14,%rsi
+  803231:	bf 00 00 00 00       	mov    $0x0,%edi
+  803236:	48 b8 e8 11 80 00 00 	movabs $0x8011e8,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	41 89 c4             	mov    %eax,%r12d
+  803245:	85 c0                	test   %eax,%eax
+  803247:	78 78                	js     8032c1 <pipe_sized+0x1c1>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803249:	be 00 10 00 00       	mov    $0x1000,%esi
+  80324e:	4c 89 f7             	mov    %r14,%rdi
+  803251:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+  80325d:	83 f8 02             	cmp    $0x2,%eax
+  803260:	0f 85 b8 00 00 00    	jne    80331e <pipe_sized+0x21e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803266:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80326d:	00 00 
+  80326f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803273:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803275:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803279:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803280:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803284:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803286:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80328a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803291:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803295:	48 bb be 18 80 00 00 	movabs $0x8018be,%rbx
+  80329c:	00 00 00 
+  80329f:	ff d3                	call   *%rbx
+  8032a1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    pfd[1] = fd2num(fd1);
+  8032a5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8032a9:	ff d3                	call   *%rbx
+  8032ab:	41 89 45 04          	mov    %eax,0x4(%r13)
+    return 0;
+  8032af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032b5:	eb 55                	jmp    80330c <pipe_sized+0x20c>
+    size_t bufsize = PAGE_SIZE;
+  8032b7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8032bc:	e9 7a fe ff ff       	jmp    80313b <pipe_sized+0x3b>
+    sys_unmap_region(0, va, PAGE_SIZE + bufsize);
+  8032c1:	4c 89 fa             	mov    %r15,%rdx
+  8032c4:	4c 89 f6             	mov    %r14,%rsi
+  8032c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cc:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  8032d3:	00 00 00 
+  8032d6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8032d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032dd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e6:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  8032ed:	00 00 00 
+  8032f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8032f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032f7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8032fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803300:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  803307:	00 00 00 
+  80330a:	ff d0                	call   *%rax
+}
+  80330c:	44 89 e0             	mov    %r12d,%eax
+  80330f:	48 83 c4 18          	add    $0x18,%rsp
+  803313:	5b                   	pop    %rbx
+  803314:	41 5c                	pop    %r12
+  803316:	41 5d                	pop    %r13
+  803318:	41 5e                	pop    %r14
+  80331a:	41 5f                	pop    %r15
+  80331c:	5d                   	pop    %rbp
+  80331d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80331e:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  803325:	00 00 00 
+  803328:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  80332f:	00 00 00 
+  803332:	be 4c 00 00 00       	mov    $0x4c,%esi
+  803337:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80333e:	00 00 00 
+  803341:	b8 00 00 00 00       	mov    $0x0,%eax
+  803346:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  80334d:	00 00 00 
+  803350:	41 ff d0             	call   *%r8
+    if (bufsize > PIPE_MAX_SIZE) return -E_INVAL;
+  803353:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  803359:	eb b1                	jmp    80330c <pipe_sized+0x20c>
+
+000000000080335b <pipe>:
+pipe(int pfd[2]) {
+  80335b:	55                   	push   %rbp
+  80335c:	48 89 e5             	mov    %rsp,%rbp
+    return pipe_sized(pfd, PIPE_DEFAULT_SIZE);
+  80335f:	be 00 00 01 00       	mov    $0x10000,%esi
+  803364:	48 b8 00 31 80 00 00 	movabs $0x803100,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+}
+  803370:	5d                   	pop    %rbp
+  803371:	c3                   	ret
+
+0000000000803372 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80337a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80337e:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  803385:	00 00 00 
+  803388:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80338a:	85 c0                	test   %eax,%eax
+  80338c:	78 23                	js     8033b1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80338e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803392:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8033a1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033a5:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+}
+  8033b1:	c9                   	leave
+  8033b2:	c3                   	ret
+
+00000000008033b3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033b3:	48 89 f8             	mov    %rdi,%rax
+  8033b6:	48 c1 e8 27          	shr    $0x27,%rax
+  8033ba:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8033c1:	7f 00 00 
+  8033c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033c8:	f6 c2 01             	test   $0x1,%dl
+  8033cb:	74 6d                	je     80343a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8033cd:	48 89 f8             	mov    %rdi,%rax
+  8033d0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033d4:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033db:	7f 00 00 
+  8033de:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033e2:	f6 c2 01             	test   $0x1,%dl
+  8033e5:	74 62                	je     803449 <get_uvpt_entry+0x96>
+  8033e7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8033ee:	7f 00 00 
+  8033f1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033f5:	f6 c2 80             	test   $0x80,%dl
+  8033f8:	75 4f                	jne    803449 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8033fa:	48 89 f8             	mov    %rdi,%rax
+  8033fd:	48 c1 e8 15          	shr    $0x15,%rax
+  803401:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803408:	7f 00 00 
+  80340b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80340f:	f6 c2 01             	test   $0x1,%dl
+  803412:	74 44                	je     803458 <get_uvpt_entry+0xa5>
+  803414:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80341b:	7f 00 00 
+  80341e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803422:	f6 c2 80             	test   $0x80,%dl
+  803425:	75 31                	jne    803458 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803427:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80342b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803432:	7f 00 00 
+  803435:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803439:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80343a:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803441:	7f 00 00 
+  803444:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803448:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803449:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803450:	7f 00 00 
+  803453:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803457:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803458:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80345f:	7f 00 00 
+  803462:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803466:	c3                   	ret
+
+0000000000803467 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803467:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80346a:	48 89 f9             	mov    %rdi,%rcx
+  80346d:	48 c1 e9 27          	shr    $0x27,%rcx
+  803471:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803478:	7f 00 00 
+  80347b:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80347f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803486:	f6 c1 01             	test   $0x1,%cl
+  803489:	0f 84 b2 00 00 00    	je     803541 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80348f:	48 89 f9             	mov    %rdi,%rcx
+  803492:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803496:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80349d:	7f 00 00 
+  8034a0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8034a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8034ab:	40 f6 c6 01          	test   $0x1,%sil
+  8034af:	0f 84 8c 00 00 00    	je     803541 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8034b5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8034bc:	7f 00 00 
+  8034bf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034c3:	a8 80                	test   $0x80,%al
+  8034c5:	75 7b                	jne    803542 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8034c7:	48 89 f9             	mov    %rdi,%rcx
+  8034ca:	48 c1 e9 15          	shr    $0x15,%rcx
+  8034ce:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034d5:	7f 00 00 
+  8034d8:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8034dc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8034e3:	40 f6 c6 01          	test   $0x1,%sil
+  8034e7:	74 58                	je     803541 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8034e9:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8034f0:	7f 00 00 
+  8034f3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8034f7:	a8 80                	test   $0x80,%al
+  8034f9:	75 6c                	jne    803567 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8034fb:	48 89 f9             	mov    %rdi,%rcx
+  8034fe:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803502:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803509:	7f 00 00 
+  80350c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803510:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803517:	40 f6 c6 01          	test   $0x1,%sil
+  80351b:	74 24                	je     803541 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80351d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803524:	7f 00 00 
+  803527:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80352b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803532:	ff ff 7f 
+  803535:	48 21 c8             	and    %rcx,%rax
+  803538:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80353e:	48 09 d0             	or     %rdx,%rax
+}
+  803541:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803542:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803549:	7f 00 00 
+  80354c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803550:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803557:	ff ff 7f 
+  80355a:	48 21 c8             	and    %rcx,%rax
+  80355d:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803563:	48 01 d0             	add    %rdx,%rax
+  803566:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803567:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80356e:	7f 00 00 
+  803571:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803575:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80357c:	ff ff 7f 
+  80357f:	48 21 c8             	and    %rcx,%rax
+  803582:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803588:	48 01 d0             	add    %rdx,%rax
+  80358b:	c3                   	ret
+
+000000000080358c <get_prot>:
+
+int
+get_prot(void *va) {
+  80358c:	55                   	push   %rbp
+  80358d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803590:	48 b8 b3 33 80 00 00 	movabs $0x8033b3,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+  80359c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80359f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8035a4:	89 c1                	mov    %eax,%ecx
+  8035a6:	83 c9 04             	or     $0x4,%ecx
+  8035a9:	f6 c2 01             	test   $0x1,%dl
+  8035ac:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8035af:	89 c1                	mov    %eax,%ecx
+  8035b1:	83 c9 02             	or     $0x2,%ecx
+  8035b4:	f6 c2 02             	test   $0x2,%dl
+  8035b7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8035ba:	89 c1                	mov    %eax,%ecx
+  8035bc:	83 c9 01             	or     $0x1,%ecx
+  8035bf:	48 85 d2             	test   %rdx,%rdx
+  8035c2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8035c5:	89 c1                	mov    %eax,%ecx
+  8035c7:	83 c9 40             	or     $0x40,%ecx
+  8035ca:	f6 c6 04             	test   $0x4,%dh
+  8035cd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8035d0:	5d                   	pop    %rbp
+  8035d1:	c3                   	ret
+
+00000000008035d2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8035d2:	55                   	push   %rbp
+  8035d3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8035d6:	48 b8 b3 33 80 00 00 	movabs $0x8033b3,%rax
+  8035dd:	00 00 00 
+  8035e0:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8035e2:	48 c1 e8 06          	shr    $0x6,%rax
+  8035e6:	83 e0 01             	and    $0x1,%eax
+}
+  8035e9:	5d                   	pop    %rbp
+  8035ea:	c3                   	ret
+
+00000000008035eb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8035eb:	55                   	push   %rbp
+  8035ec:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8035ef:	48 b8 b3 33 80 00 00 	movabs $0x8033b3,%rax
+  8035f6:	00 00 00 
+  8035f9:	ff d0                	call   *%rax
+  8035fb:	83 e0 01             	and    $0x1,%eax
+}
+  8035fe:	5d                   	pop    %rbp
+  8035ff:	c3                   	ret
+
+0000000000803600 <foreach_present_page>:
+
+/* Calls fun() for every present page in [start, end)
+ * until it fails.  Returns the error or 0. */
+int
+foreach_present_page(void *start, void *end, int (*fun)(void *va, void *arg), void *arg) {
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	41 57                	push   %r15
+  803606:	41 56                	push   %r14
+  803608:	41 55                	push   %r13
+  80360a:	41 54                	push   %r12
+  80360c:	53                   	push   %rbx
+  80360d:	48 83 ec 18          	sub    $0x18,%rsp
+  803611:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803615:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+#define NEXT(va, shift) (ROUNDDOWN((va), 1ULL << (shift)) + (1ULL << (shift)))
+    uintptr_t va = (uintptr_t)start;
+    while (va < (uintptr_t)end) {
+  803619:	48 39 f7             	cmp    %rsi,%rdi
+  80361c:	0f 83 e4 00 00 00    	jae    803706 <foreach_present_page+0x106>
+  803622:	49 89 f4             	mov    %rsi,%r12
+  803625:	48 89 fb             	mov    %rdi,%rbx
+        /* Skip over unmapped page tables */
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  803628:	49 bd 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%r13
+  80362f:	7f 00 00 
+            va = NEXT(va, PML4_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803632:	49 be 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%r14
+  803639:	7f 00 00 
+            va = NEXT(va, PDP_SHIFT);
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80363c:	49 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r15
+  803643:	7f 00 00 
+  803646:	eb 27                	jmp    80366f <foreach_present_page+0x6f>
+        } else if (!(uvpdp[VPDP(va)] & PTE_P)) {
+  803648:	48 89 d8             	mov    %rbx,%rax
+  80364b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80364f:	49 8b 14 c6          	mov    (%r14,%rax,8),%rdx
+  803653:	f6 c2 01             	test   $0x1,%dl
+  803656:	75 43                	jne    80369b <foreach_present_page+0x9b>
+            va = NEXT(va, PDP_SHIFT);
+  803658:	48 81 e3 00 00 00 c0 	and    $0xffffffffc0000000,%rbx
+  80365f:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+    while (va < (uintptr_t)end) {
+  803666:	4c 39 e3             	cmp    %r12,%rbx
+  803669:	0f 83 83 00 00 00    	jae    8036f2 <foreach_present_page+0xf2>
+        if (!(uvpml4[VPML4(va)] & PTE_P)) {
+  80366f:	48 89 d8             	mov    %rbx,%rax
+  803672:	48 c1 e8 27          	shr    $0x27,%rax
+  803676:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80367b:	a8 01                	test   $0x1,%al
+  80367d:	75 c9                	jne    803648 <foreach_present_page+0x48>
+            va = NEXT(va, PML4_SHIFT);
+  80367f:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  803686:	ff ff ff 
+  803689:	48 21 d8             	and    %rbx,%rax
+  80368c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803693:	00 00 00 
+  803696:	48 01 c3             	add    %rax,%rbx
+  803699:	eb cb                	jmp    803666 <foreach_present_page+0x66>
+        } else if (!(uvpdp[VPDP(va)] & PTE_PS) && !(uvpd[VPD(va)] & PTE_P)) {
+  80369b:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+  80369f:	a8 80                	test   $0x80,%al
+  8036a1:	75 1f                	jne    8036c2 <foreach_present_page+0xc2>
+  8036a3:	48 89 d8             	mov    %rbx,%rax
+  8036a6:	48 c1 e8 15          	shr    $0x15,%rax
+  8036aa:	49 8b 04 c7          	mov    (%r15,%rax,8),%rax
+  8036ae:	a8 01                	test   $0x1,%al
+  8036b0:	75 10                	jne    8036c2 <foreach_present_page+0xc2>
+            va = NEXT(va, PD_SHIFT);
+  8036b2:	48 81 e3 00 00 e0 ff 	and    $0xffffffffffe00000,%rbx
+  8036b9:	48 81 c3 00 00 20 00 	add    $0x200000,%rbx
+  8036c0:	eb a4                	jmp    803666 <foreach_present_page+0x66>
+        } else {
+            if (get_uvpt_entry((void *)va) & PTE_P) {
+  8036c2:	48 89 df             	mov    %rbx,%rdi
+  8036c5:	48 b8 b3 33 80 00 00 	movabs $0x8033b3,%rax
+  8036cc:	00 00 00 
+  8036cf:	ff d0                	call   *%rax
+  8036d1:	a8 01                	test   $0x1,%al
+  8036d3:	74 11                	je     8036e6 <foreach_present_page+0xe6>
+                int res = fun((void *)va, arg);
+  8036d5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8036d9:	48 89 df             	mov    %rbx,%rdi
+  8036dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036e0:	ff d0                	call   *%rax
+                if (res < 0) return res;
+  8036e2:	85 c0                	test   %eax,%eax
+  8036e4:	78 11                	js     8036f7 <foreach_present_page+0xf7>
+            }
+            va += PAGE_SIZE;
+  8036e6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036ed:	e9 74 ff ff ff       	jmp    803666 <foreach_present_page+0x66>
+        }
+    }
+#undef NEXT
+    return 0;
+  8036f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f7:	48 83 c4 18          	add    $0x18,%rsp
+  8036fb:	5b                   	pop    %rbx
+  8036fc:	41 5c                	pop    %r12
+  8036fe:	41 5d                	pop    %r13
+  803700:	41 5e                	pop    %r14
+  803702:	41 5f                	pop    %r15
+  803704:	5d                   	pop    %rbp
+  803705:	c3                   	ret
+    return 0;
+  803706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370b:	eb ea                	jmp    8036f7 <foreach_present_page+0xf7>
+
+000000000080370d <foreach_shared_region>:
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    // LAB 11: Your code here:
+
+    int res = 0;
+    for (uintptr_t pml4i = 0; pml4i < MAX_USER_ADDRESS; pml4i += (1LL << PML4_SHIFT)) {
+        if (!(uvpml4[VPML4(pml4i)] & PTE_P)) continue;
+  80370d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803714:	7f 00 00 
+  803717:	a8 01                	test   $0x1,%al
+  803719:	75 06                	jne    803721 <foreach_shared_region+0x14>
+            }
+        }
+    }
+
+    return res;
+}
+  80371b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803720:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803721:	55                   	push   %rbp
+  803722:	48 89 e5             	mov    %rsp,%rbp
+  803725:	41 57                	push   %r15
+  803727:	41 56                	push   %r14
+  803729:	41 55                	push   %r13
+  80372b:	41 54                	push   %r12
+  80372d:	53                   	push   %rbx
+  80372e:	48 83 ec 28          	sub    $0x28,%rsp
+  803732:	49 89 fe             	mov    %rdi,%r14
+  803735:	49 89 f7             	mov    %rsi,%r15
+  803738:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80373f:	00 
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  803740:	49 bd 00 00 00 00 80 	movabs $0x7f8000000000,%r13
+  803747:	7f 00 00 
+  80374a:	e9 b0 00 00 00       	jmp    8037ff <foreach_shared_region+0xf2>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  80374f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803756:	49 83 ec 01          	sub    $0x1,%r12
+  80375a:	74 2d                	je     803789 <foreach_shared_region+0x7c>
+                    if (!(uvpt[VPT(pti)] & PTE_P && uvpt[VPT(pti)] & PTE_SHARE)) continue;
+  80375c:	48 89 d8             	mov    %rbx,%rax
+  80375f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803763:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803768:	f6 c2 01             	test   $0x1,%dl
+  80376b:	74 e2                	je     80374f <foreach_shared_region+0x42>
+  80376d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803772:	f6 c4 04             	test   $0x4,%ah
+  803775:	74 d8                	je     80374f <foreach_shared_region+0x42>
+                    fun((void*)pti, (void *)(pti + PAGE_SIZE), arg);
+  803777:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80377e:	4c 89 fa             	mov    %r15,%rdx
+  803781:	48 89 df             	mov    %rbx,%rdi
+  803784:	41 ff d6             	call   *%r14
+  803787:	eb c6                	jmp    80374f <foreach_shared_region+0x42>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  803789:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803790:	00 
+  803791:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803796:	74 4c                	je     8037e4 <foreach_shared_region+0xd7>
+                if (!(uvpd[VPD(pdi)] & PTE_P)) continue;
+  803798:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80379c:	48 89 c8             	mov    %rcx,%rax
+  80379f:	48 c1 e8 15          	shr    $0x15,%rax
+  8037a3:	48 bf 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdi
+  8037aa:	7f 00 00 
+  8037ad:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8037b1:	a8 01                	test   $0x1,%al
+  8037b3:	74 d4                	je     803789 <foreach_shared_region+0x7c>
+                for (uintptr_t pti = pdi; pti < pdi + (1LL << PD_SHIFT); pti += (1LL << PT_SHIFT)) {
+  8037b5:	48 8d 81 00 00 20 00 	lea    0x200000(%rcx),%rax
+  8037bc:	48 39 c1             	cmp    %rax,%rcx
+  8037bf:	73 c8                	jae    803789 <foreach_shared_region+0x7c>
+  8037c1:	48 89 cb             	mov    %rcx,%rbx
+  8037c4:	48 8d 91 00 10 00 00 	lea    0x1000(%rcx),%rdx
+  8037cb:	48 39 d0             	cmp    %rdx,%rax
+  8037ce:	4d 19 e4             	sbb    %r12,%r12
+  8037d1:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8037d8:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8037df:	e9 78 ff ff ff       	jmp    80375c <foreach_shared_region+0x4f>
+        for (uintptr_t pdpi = pml4i; pdpi < pml4i + (1LL << PML4_SHIFT); pdpi += (1LL << PDP_SHIFT)) {
+  8037e4:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8037eb:	40 
+  8037ec:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8037f0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037f7:	00 00 00 
+  8037fa:	48 39 c1             	cmp    %rax,%rcx
+  8037fd:	74 4f                	je     80384e <foreach_shared_region+0x141>
+            if (!(uvpdp[VPDP(pdpi)] & PTE_P)) continue;
+  8037ff:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803803:	48 89 c8             	mov    %rcx,%rax
+  803806:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80380a:	48 bf 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdi
+  803811:	7f 00 00 
+  803814:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  803818:	a8 01                	test   $0x1,%al
+  80381a:	74 c8                	je     8037e4 <foreach_shared_region+0xd7>
+            for (uintptr_t pdi = pdpi; pdi < pdpi + (1LL << PDP_SHIFT); pdi += (1LL << PD_SHIFT)) {
+  80381c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803823:	48 39 c1             	cmp    %rax,%rcx
+  803826:	73 bc                	jae    8037e4 <foreach_shared_region+0xd7>
+  803828:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80382f:	48 39 d0             	cmp    %rdx,%rax
+  803832:	48 19 c0             	sbb    %rax,%rax
+  803835:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80383b:	48 05 00 02 00 00    	add    $0x200,%rax
+  803841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803845:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803849:	e9 4a ff ff ff       	jmp    803798 <foreach_shared_region+0x8b>
+}
+  80384e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803853:	48 83 c4 28          	add    $0x28,%rsp
+  803857:	5b                   	pop    %rbx
+  803858:	41 5c                	pop    %r12
+  80385a:	41 5d                	pop    %r13
+  80385c:	41 5e                	pop    %r14
+  80385e:	41 5f                	pop    %r15
+  803860:	5d                   	pop    %rbp
+  803861:	c3                   	ret
+
+0000000000803862 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803862:	b8 00 00 00 00       	mov    $0x0,%eax
+  803867:	c3                   	ret
+
+0000000000803868 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803868:	55                   	push   %rbp
+  803869:	48 89 e5             	mov    %rsp,%rbp
+  80386c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80386f:	48 be 34 57 80 00 00 	movabs $0x805734,%rsi
+  803876:	00 00 00 
+  803879:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  803880:	00 00 00 
+  803883:	ff d0                	call   *%rax
+    return 0;
+}
+  803885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388a:	5d                   	pop    %rbp
+  80388b:	c3                   	ret
+
+000000000080388c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80388c:	55                   	push   %rbp
+  80388d:	48 89 e5             	mov    %rsp,%rbp
+  803890:	41 57                	push   %r15
+  803892:	41 56                	push   %r14
+  803894:	41 55                	push   %r13
+  803896:	41 54                	push   %r12
+  803898:	53                   	push   %rbx
+  803899:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8038a0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8038a7:	48 85 d2             	test   %rdx,%rdx
+  8038aa:	74 7a                	je     803926 <devcons_write+0x9a>
+  8038ac:	49 89 d6             	mov    %rdx,%r14
+  8038af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038b5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8038ba:	49 bf cb 0d 80 00 00 	movabs $0x800dcb,%r15
+  8038c1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8038c4:	4c 89 f3             	mov    %r14,%rbx
+  8038c7:	48 29 f3             	sub    %rsi,%rbx
+  8038ca:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8038cf:	48 39 c3             	cmp    %rax,%rbx
+  8038d2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8038d6:	4c 63 eb             	movslq %ebx,%r13
+  8038d9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8038e0:	48 01 c6             	add    %rax,%rsi
+  8038e3:	4c 89 ea             	mov    %r13,%rdx
+  8038e6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8038ed:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8038f0:	4c 89 ee             	mov    %r13,%rsi
+  8038f3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8038fa:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803906:	41 01 dc             	add    %ebx,%r12d
+  803909:	49 63 f4             	movslq %r12d,%rsi
+  80390c:	4c 39 f6             	cmp    %r14,%rsi
+  80390f:	72 b3                	jb     8038c4 <devcons_write+0x38>
+    return res;
+  803911:	49 63 c4             	movslq %r12d,%rax
+}
+  803914:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80391b:	5b                   	pop    %rbx
+  80391c:	41 5c                	pop    %r12
+  80391e:	41 5d                	pop    %r13
+  803920:	41 5e                	pop    %r14
+  803922:	41 5f                	pop    %r15
+  803924:	5d                   	pop    %rbp
+  803925:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803926:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80392c:	eb e3                	jmp    803911 <devcons_write+0x85>
+
+000000000080392e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80392e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803931:	ba 00 00 00 00       	mov    $0x0,%edx
+  803936:	48 85 c0             	test   %rax,%rax
+  803939:	74 60                	je     80399b <devcons_read+0x6d>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80393b:	55                   	push   %rbp
+  80393c:	48 89 e5             	mov    %rsp,%rbp
+  80393f:	41 55                	push   %r13
+  803941:	41 54                	push   %r12
+  803943:	53                   	push   %rbx
+  803944:	48 83 ec 18          	sub    $0x18,%rsp
+  803948:	49 89 f5             	mov    %rsi,%r13
+    unsigned attempt = 0;
+  80394b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    while (!(c = sys_cgetc())) backoff(&attempt);
+  803952:	48 bb 25 10 80 00 00 	movabs $0x801025,%rbx
+  803959:	00 00 00 
+  80395c:	49 bc 4a 3f 80 00 00 	movabs $0x803f4a,%r12
+  803963:	00 00 00 
+  803966:	eb 07                	jmp    80396f <devcons_read+0x41>
+  803968:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80396c:	41 ff d4             	call   *%r12
+  80396f:	ff d3                	call   *%rbx
+  803971:	85 c0                	test   %eax,%eax
+  803973:	74 f3                	je     803968 <devcons_read+0x3a>
+    if (c < 0) return c;
+  803975:	48 63 d0             	movslq %eax,%rdx
+  803978:	78 13                	js     80398d <devcons_read+0x5f>
+    if (c == 0x04) return 0;
+  80397a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80397f:	83 f8 04             	cmp    $0x4,%eax
+  803982:	74 09                	je     80398d <devcons_read+0x5f>
+    *(char *)vbuf = (char)c;
+  803984:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803988:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80398d:	48 89 d0             	mov    %rdx,%rax
+  803990:	48 83 c4 18          	add    $0x18,%rsp
+  803994:	5b                   	pop    %rbx
+  803995:	41 5c                	pop    %r12
+  803997:	41 5d                	pop    %r13
+  803999:	5d                   	pop    %rbp
+  80399a:	c3                   	ret
+  80399b:	48 89 d0             	mov    %rdx,%rax
+  80399e:	c3                   	ret
+
+000000000080399f <cputchar>:
+cputchar(int ch) {
+  80399f:	55                   	push   %rbp
+  8039a0:	48 89 e5             	mov    %rsp,%rbp
+  8039a3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8039a7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8039ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8039b0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8039b4:	48 b8 f8 0f 80 00 00 	movabs $0x800ff8,%rax
+  8039bb:	00 00 00 
+  8039be:	ff d0                	call   *%rax
+}
+  8039c0:	c9                   	leave
+  8039c1:	c3                   	ret
+
+00000000008039c2 <getchar>:
+getchar(void) {
+  8039c2:	55                   	push   %rbp
+  8039c3:	48 89 e5             	mov    %rsp,%rbp
+  8039c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8039ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  8039cf:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8039d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d8:	48 b8 6d 1c 80 00 00 	movabs $0x801c6d,%rax
+  8039df:	00 00 00 
+  8039e2:	ff d0                	call   *%rax
+  8039e4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8039e6:	85 c0                	test   %eax,%eax
+  8039e8:	78 06                	js     8039f0 <getchar+0x2e>
+  8039ea:	74 08                	je     8039f4 <getchar+0x32>
+  8039ec:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8039f0:	89 d0                	mov    %edx,%eax
+  8039f2:	c9                   	leave
+  8039f3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8039f4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8039f9:	eb f5                	jmp    8039f0 <getchar+0x2e>
+
+00000000008039fb <iscons>:
+iscons(int fdnum) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a03:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a07:	48 b8 4e 19 80 00 00 	movabs $0x80194e,%rax
+  803a0e:	00 00 00 
+  803a11:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a13:	85 c0                	test   %eax,%eax
+  803a15:	78 18                	js     803a2f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803a17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a1b:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803a22:	00 00 00 
+  803a25:	8b 00                	mov    (%rax),%eax
+  803a27:	39 02                	cmp    %eax,(%rdx)
+  803a29:	0f 94 c0             	sete   %al
+  803a2c:	0f b6 c0             	movzbl %al,%eax
+}
+  803a2f:	c9                   	leave
+  803a30:	c3                   	ret
+
+0000000000803a31 <opencons>:
+opencons(void) {
+  803a31:	55                   	push   %rbp
+  803a32:	48 89 e5             	mov    %rsp,%rbp
+  803a35:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a39:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803a3d:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+  803a49:	85 c0                	test   %eax,%eax
+  803a4b:	78 49                	js     803a96 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803a4d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a57:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803a5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a60:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  803a67:	00 00 00 
+  803a6a:	ff d0                	call   *%rax
+  803a6c:	85 c0                	test   %eax,%eax
+  803a6e:	78 26                	js     803a96 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803a70:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a74:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803a7b:	00 00 
+  803a7d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803a7f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a83:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803a8a:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+}
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+
+0000000000803a98 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803a98:	55                   	push   %rbp
+  803a99:	48 89 e5             	mov    %rsp,%rbp
+  803a9c:	41 56                	push   %r14
+  803a9e:	41 55                	push   %r13
+  803aa0:	41 54                	push   %r12
+  803aa2:	53                   	push   %rbx
+  803aa3:	48 83 ec 50          	sub    $0x50,%rsp
+  803aa7:	49 89 fc             	mov    %rdi,%r12
+  803aaa:	41 89 f5             	mov    %esi,%r13d
+  803aad:	48 89 d3             	mov    %rdx,%rbx
+  803ab0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803ab4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803ab8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803abc:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803ac3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ac7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803acb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803acf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803ad3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803ada:	00 00 00 
+  803add:	4c 8b 30             	mov    (%rax),%r14
+  803ae0:	48 b8 c1 10 80 00 00 	movabs $0x8010c1,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+  803aec:	89 c6                	mov    %eax,%esi
+  803aee:	45 89 e8             	mov    %r13d,%r8d
+  803af1:	4c 89 e1             	mov    %r12,%rcx
+  803af4:	4c 89 f2             	mov    %r14,%rdx
+  803af7:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  803afe:	00 00 00 
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b06:	49 bc ac 02 80 00 00 	movabs $0x8002ac,%r12
+  803b0d:	00 00 00 
+  803b10:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803b13:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803b17:	48 89 df             	mov    %rbx,%rdi
+  803b1a:	48 b8 48 02 80 00 00 	movabs $0x800248,%rax
+  803b21:	00 00 00 
+  803b24:	ff d0                	call   *%rax
+    cprintf("\n");
+  803b26:	48 bf 9b 56 80 00 00 	movabs $0x80569b,%rdi
+  803b2d:	00 00 00 
+  803b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b35:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803b38:	cc                   	int3
+  803b39:	eb fd                	jmp    803b38 <_panic+0xa0>
+
+0000000000803b3b <ipc_recv_timeout>:
+}
+
+/* Same as ipc_recv() but gives up and returns -E_TIMEOUT
+ * when TSC reaches 'deadline' (0 means no deadline) */
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, size_t *size, int *perm_store, uint64_t deadline) {
+  803b3b:	55                   	push   %rbp
+  803b3c:	48 89 e5             	mov    %rsp,%rbp
+  803b3f:	41 55                	push   %r13
+  803b41:	41 54                	push   %r12
+  803b43:	53                   	push   %rbx
+  803b44:	48 83 ec 08          	sub    $0x8,%rsp
+  803b48:	49 89 fc             	mov    %rdi,%r12
+  803b4b:	48 89 f7             	mov    %rsi,%rdi
+  803b4e:	48 89 d3             	mov    %rdx,%rbx
+  803b51:	49 89 cd             	mov    %rcx,%r13
+  803b54:	4c 89 c2             	mov    %r8,%rdx
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803b57:	48 85 f6             	test   %rsi,%rsi
+  803b5a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b61:	00 00 00 
+  803b64:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv_timeout(pg, size ? *size : 0, deadline);
+  803b68:	be 00 00 00 00       	mov    $0x0,%esi
+  803b6d:	48 85 db             	test   %rbx,%rbx
+  803b70:	74 03                	je     803b75 <ipc_recv_timeout+0x3a>
+  803b72:	48 8b 33             	mov    (%rbx),%rsi
+  803b75:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  803b7c:	00 00 00 
+  803b7f:	ff d0                	call   *%rax
+    if (res == 0) {
+  803b81:	85 c0                	test   %eax,%eax
+  803b83:	75 72                	jne    803bf7 <ipc_recv_timeout+0xbc>
+        if (from_env_store) {
+  803b85:	4d 85 e4             	test   %r12,%r12
+  803b88:	74 17                	je     803ba1 <ipc_recv_timeout+0x66>
+  803b8a:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803b91:	00 00 
+            *from_env_store = thisenv->env_ipc_from;
+  803b93:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b97:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803b9d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+
+        if (perm_store) {
+  803ba1:	4d 85 ed             	test   %r13,%r13
+  803ba4:	74 17                	je     803bbd <ipc_recv_timeout+0x82>
+  803ba6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803bad:	00 00 
+            *perm_store = thisenv->env_ipc_perm;
+  803baf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803bb3:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803bb9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (size) {
+  803bbd:	48 85 db             	test   %rbx,%rbx
+  803bc0:	74 17                	je     803bd9 <ipc_recv_timeout+0x9e>
+  803bc2:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803bc9:	00 00 
+            *size = thisenv->env_ipc_maxsz;
+  803bcb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803bcf:	48 8b 80 60 01 00 00 	mov    0x160(%rax),%rax
+  803bd6:	48 89 03             	mov    %rax,(%rbx)
+  803bd9:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803be0:	00 00 
+        }
+
+        return thisenv->env_ipc_value;
+  803be2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803be6:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+            *size = 0;
+        }
+
+        return res;
+    }
+}
+  803bec:	48 83 c4 08          	add    $0x8,%rsp
+  803bf0:	5b                   	pop    %rbx
+  803bf1:	41 5c                	pop    %r12
+  803bf3:	41 5d                	pop    %r13
+  803bf5:	5d                   	pop    %rbp
+  803bf6:	c3                   	ret
+        if (from_env_store) {
+  803bf7:	4d 85 e4             	test   %r12,%r12
+  803bfa:	74 08                	je     803c04 <ipc_recv_timeout+0xc9>
+            *from_env_store = 0;
+  803bfc:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c03:	00 
+        if (perm_store) {
+  803c04:	4d 85 ed             	test   %r13,%r13
+  803c07:	74 08                	je     803c11 <ipc_recv_timeout+0xd6>
+            *perm_store = 0;
+  803c09:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803c10:	00 
+        if (size) {
+  803c11:	48 85 db             	test   %rbx,%rbx
+  803c14:	74 d6                	je     803bec <ipc_recv_timeout+0xb1>
+            *size = 0;
+  803c16:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803c1d:	eb cd                	jmp    803bec <ipc_recv_timeout+0xb1>
+
+0000000000803c1f <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803c1f:	55                   	push   %rbp
+  803c20:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_timeout(from_env_store, pg, size, perm_store, 0);
+  803c23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c29:	48 b8 3b 3b 80 00 00 	movabs $0x803b3b,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+}
+  803c35:	5d                   	pop    %rbp
+  803c36:	c3                   	ret
+
+0000000000803c37 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803c37:	55                   	push   %rbp
+  803c38:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803c3b:	48 85 d2             	test   %rdx,%rdx
+  803c3e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c45:	00 00 00 
+  803c48:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm, NULL);
+  803c4c:	89 f6                	mov    %esi,%esi
+  803c4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803c54:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803c60:	85 c0                	test   %eax,%eax
+  803c62:	78 02                	js     803c66 <ipc_send+0x2f>
+}
+  803c64:	5d                   	pop    %rbp
+  803c65:	c3                   	ret
+    if (res < 0) panic("Error in ipc_send: %i\n", res);
+  803c66:	89 c1                	mov    %eax,%ecx
+  803c68:	48 ba 63 57 80 00 00 	movabs $0x805763,%rdx
+  803c6f:	00 00 00 
+  803c72:	be 51 00 00 00       	mov    $0x51,%esi
+  803c77:	48 bf 7a 57 80 00 00 	movabs $0x80577a,%rdi
+  803c7e:	00 00 00 
+  803c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c86:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  803c8d:	00 00 00 
+  803c90:	41 ff d0             	call   *%r8
+
+0000000000803c93 <ipc_call>:
+ * If 'perm_store' is nonnull, the permission of the received page
+ * is stored there.  If 'words' is nonnull, its IPC_NWORDS words
+ * are sent with the request and replaced by those of the reply.
+ * Panics if the request cannot be sent. */
+int32_t
+ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803c93:	55                   	push   %rbp
+  803c94:	48 89 e5             	mov    %rsp,%rbp
+  803c97:	41 54                	push   %r12
+  803c99:	53                   	push   %rbx
+  803c9a:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803c9e:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803ca2:	48 85 d2             	test   %rdx,%rdx
+  803ca5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cac:	00 00 00 
+  803caf:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803cb3:	4d 85 c9             	test   %r9,%r9
+  803cb6:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, value, pg, size, perm, rcv_pg, words);
+  803cba:	89 f6                	mov    %esi,%esi
+  803cbc:	48 83 ec 08          	sub    $0x8,%rsp
+  803cc0:	53                   	push   %rbx
+  803cc1:	48 b8 6c 16 80 00 00 	movabs $0x80166c,%rax
+  803cc8:	00 00 00 
+  803ccb:	ff d0                	call   *%rax
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803ccd:	48 83 c4 10          	add    $0x10,%rsp
+  803cd1:	85 c0                	test   %eax,%eax
+  803cd3:	78 65                	js     803d3a <ipc_call+0xa7>
+
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803cd5:	4d 85 e4             	test   %r12,%r12
+  803cd8:	74 17                	je     803cf1 <ipc_call+0x5e>
+  803cda:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803ce1:	00 00 
+  803ce3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ce7:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803ced:	41 89 04 24          	mov    %eax,(%r12)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803cf1:	48 85 db             	test   %rbx,%rbx
+  803cf4:	74 28                	je     803d1e <ipc_call+0x8b>
+  803cf6:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803cfd:	00 00 
+  803cff:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803d03:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803d0a:	ba 20 00 00 00       	mov    $0x20,%edx
+  803d0f:	48 89 df             	mov    %rbx,%rdi
+  803d12:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  803d19:	00 00 00 
+  803d1c:	ff d0                	call   *%rax
+  803d1e:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803d25:	00 00 
+    return thisenv->env_ipc_value;
+  803d27:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803d2b:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803d31:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803d35:	5b                   	pop    %rbx
+  803d36:	41 5c                	pop    %r12
+  803d38:	5d                   	pop    %rbp
+  803d39:	c3                   	ret
+    if (res < 0) panic("Error in ipc_call: %i\n", res);
+  803d3a:	89 c1                	mov    %eax,%ecx
+  803d3c:	48 ba 84 57 80 00 00 	movabs $0x805784,%rdx
+  803d43:	00 00 00 
+  803d46:	be 62 00 00 00       	mov    $0x62,%esi
+  803d4b:	48 bf 7a 57 80 00 00 	movabs $0x80577a,%rdi
+  803d52:	00 00 00 
+  803d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5a:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  803d61:	00 00 00 
+  803d64:	41 ff d0             	call   *%r8
+
+0000000000803d67 <ipc_reply_wait>:
+ * If 'words' is nonnull, its words are sent with the reply
+ * and replaced by those of the request, like ipc_call() does.
+ * Panics if the reply cannot be sent. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store, uint64_t *words) {
+  803d67:	55                   	push   %rbp
+  803d68:	48 89 e5             	mov    %rsp,%rbp
+  803d6b:	41 57                	push   %r15
+  803d6d:	41 56                	push   %r14
+  803d6f:	41 55                	push   %r13
+  803d71:	41 54                	push   %r12
+  803d73:	53                   	push   %rbx
+  803d74:	48 83 ec 20          	sub    $0x20,%rsp
+  803d78:	89 7d c4             	mov    %edi,-0x3c(%rbp)
+  803d7b:	48 89 d3             	mov    %rdx,%rbx
+  803d7e:	49 89 ce             	mov    %rcx,%r14
+  803d81:	44 89 45 c0          	mov    %r8d,-0x40(%rbp)
+  803d85:	4d 89 cd             	mov    %r9,%r13
+  803d88:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  803d8c:	4c 8b 7d 20          	mov    0x20(%rbp),%r15
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803d90:	48 85 d2             	test   %rdx,%rdx
+  803d93:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d9a:	00 00 00 
+  803d9d:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803da1:	4d 85 e4             	test   %r12,%r12
+  803da4:	4c 0f 44 e0          	cmove  %rax,%r12
+
+    int res = sys_ipc_reply_wait(to_env, value, pg, size, perm, rcv_pg, words);
+  803da8:	89 f0                	mov    %esi,%eax
+  803daa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803dae:	41 57                	push   %r15
+  803db0:	4d 89 e1             	mov    %r12,%r9
+  803db3:	48 89 da             	mov    %rbx,%rdx
+  803db6:	48 89 c6             	mov    %rax,%rsi
+  803db9:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  803dc0:	00 00 00 
+  803dc3:	ff d0                	call   *%rax
+    if (res == -E_IPC_NOT_RECV) {
+  803dc5:	48 83 c4 10          	add    $0x10,%rsp
+  803dc9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803dcc:	0f 84 93 00 00 00    	je     803e65 <ipc_reply_wait+0xfe>
+        /* The caller used ipc_send() and has not called ipc_recv() yet */
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+            panic("Error in ipc_send: %i\n", res);
+        res = sys_ipc_recv(rcv_pg, size);
+    }
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803dd2:	85 c0                	test   %eax,%eax
+  803dd4:	0f 88 f3 00 00 00    	js     803ecd <ipc_reply_wait+0x166>
+
+    if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803dda:	4d 85 ed             	test   %r13,%r13
+  803ddd:	74 17                	je     803df6 <ipc_reply_wait+0x8f>
+  803ddf:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803de6:	00 00 
+  803de8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803dec:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  803df2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803df6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803dfb:	74 19                	je     803e16 <ipc_reply_wait+0xaf>
+  803dfd:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e04:	00 00 
+  803e06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e0a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803e10:	48 8b 5d 18          	mov    0x18(%rbp),%rbx
+  803e14:	89 03                	mov    %eax,(%rbx)
+    if (words) memcpy(words, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  803e16:	4d 85 ff             	test   %r15,%r15
+  803e19:	74 28                	je     803e43 <ipc_reply_wait+0xdc>
+  803e1b:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e22:	00 00 
+  803e24:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  803e28:	48 81 c6 70 01 00 00 	add    $0x170,%rsi
+  803e2f:	ba 20 00 00 00       	mov    $0x20,%edx
+  803e34:	4c 89 ff             	mov    %r15,%rdi
+  803e37:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  803e3e:	00 00 00 
+  803e41:	ff d0                	call   *%rax
+  803e43:	64 48 8b 04 25 00 00 	mov    %fs:0x0,%rax
+  803e4a:	00 00 
+    return thisenv->env_ipc_value;
+  803e4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e50:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803e56:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803e5a:	5b                   	pop    %rbx
+  803e5b:	41 5c                	pop    %r12
+  803e5d:	41 5d                	pop    %r13
+  803e5f:	41 5e                	pop    %r14
+  803e61:	41 5f                	pop    %r15
+  803e63:	5d                   	pop    %rbp
+  803e64:	c3                   	ret
+        if ((res = sys_ipc_send(to_env, value, pg, size, perm, words)) < 0)
+  803e65:	4d 89 f9             	mov    %r15,%r9
+  803e68:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  803e6c:	4c 89 f1             	mov    %r14,%rcx
+  803e6f:	48 89 da             	mov    %rbx,%rdx
+  803e72:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803e76:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  803e79:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  803e80:	00 00 00 
+  803e83:	ff d0                	call   *%rax
+  803e85:	85 c0                	test   %eax,%eax
+  803e87:	78 17                	js     803ea0 <ipc_reply_wait+0x139>
+        res = sys_ipc_recv(rcv_pg, size);
+  803e89:	4c 89 f6             	mov    %r14,%rsi
+  803e8c:	4c 89 e7             	mov    %r12,%rdi
+  803e8f:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+  803e9b:	e9 32 ff ff ff       	jmp    803dd2 <ipc_reply_wait+0x6b>
+            panic("Error in ipc_send: %i\n", res);
+  803ea0:	89 c1                	mov    %eax,%ecx
+  803ea2:	48 ba 63 57 80 00 00 	movabs $0x805763,%rdx
+  803ea9:	00 00 00 
+  803eac:	be 7a 00 00 00       	mov    $0x7a,%esi
+  803eb1:	48 bf 7a 57 80 00 00 	movabs $0x80577a,%rdi
+  803eb8:	00 00 00 
+  803ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec0:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  803ec7:	00 00 00 
+  803eca:	41 ff d0             	call   *%r8
+    if (res < 0) panic("Error in ipc_reply_wait: %i\n", res);
+  803ecd:	89 c1                	mov    %eax,%ecx
+  803ecf:	48 ba 9b 57 80 00 00 	movabs $0x80579b,%rdx
+  803ed6:	00 00 00 
+  803ed9:	be 7d 00 00 00       	mov    $0x7d,%esi
+  803ede:	48 bf 7a 57 80 00 00 	movabs $0x80577a,%rdi
+  803ee5:	00 00 00 
+  803ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eed:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  803ef4:	00 00 00 
+  803ef7:	41 ff d0             	call   *%r8
+
+0000000000803efa <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803efa:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803eff:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803f06:	00 00 00 
+  803f09:	48 69 d0 98 01 00 00 	imul   $0x198,%rax,%rdx
+  803f10:	48 01 ca             	add    %rcx,%rdx
+  803f13:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803f19:	39 fa                	cmp    %edi,%edx
+  803f1b:	74 12                	je     803f2f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803f1d:	48 83 c0 01          	add    $0x1,%rax
+  803f21:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803f27:	75 e0                	jne    803f09 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803f29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f2e:	c3                   	ret
+            return envs[i].env_id;
+  803f2f:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803f36:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f3d:	00 00 00 
+  803f40:	48 01 d0             	add    %rdx,%rax
+  803f43:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803f49:	c3                   	ret
+
+0000000000803f4a <backoff>:
+ * A few first calls just yield, which is the cheapest way to wait
+ * for an environment on the same CPU, then the caller sleeps
+ * for exponentially growing time so that a long wait
+ * does not keep the CPU busy. */
+void
+backoff(unsigned *attempt) {
+  803f4a:	55                   	push   %rbp
+  803f4b:	48 89 e5             	mov    %rsp,%rbp
+    unsigned n = (*attempt)++;
+  803f4e:	8b 0f                	mov    (%rdi),%ecx
+  803f50:	8d 41 01             	lea    0x1(%rcx),%eax
+  803f53:	89 07                	mov    %eax,(%rdi)
+
+    if (n < BACKOFF_YIELDS) {
+  803f55:	83 f9 07             	cmp    $0x7,%ecx
+  803f58:	76 31                	jbe    803f8b <backoff+0x41>
+    asm volatile("rdtsc"
+  803f5a:	0f 31                	rdtsc
+        sys_yield();
+        return;
+    }
+
+    unsigned shift = MIN(BACKOFF_MIN_SHIFT + n - BACKOFF_YIELDS, BACKOFF_MAX_SHIFT);
+  803f5c:	83 c1 06             	add    $0x6,%ecx
+  803f5f:	be 15 00 00 00       	mov    $0x15,%esi
+  803f64:	39 f1                	cmp    %esi,%ecx
+  803f66:	0f 47 ce             	cmova  %esi,%ecx
+    sys_sleep_until(read_tsc() + (1ULL << shift));
+  803f69:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f6e:	48 d3 e7             	shl    %cl,%rdi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803f71:	48 c1 e2 20          	shl    $0x20,%rdx
+  803f75:	89 c0                	mov    %eax,%eax
+  803f77:	48 09 c2             	or     %rax,%rdx
+  803f7a:	48 01 d7             	add    %rdx,%rdi
+  803f7d:	48 b8 7d 17 80 00 00 	movabs $0x80177d,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+}
+  803f89:	5d                   	pop    %rbp
+  803f8a:	c3                   	ret
+        sys_yield();
+  803f8b:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803f92:	00 00 00 
+  803f95:	ff d0                	call   *%rax
+        return;
+  803f97:	eb f0                	jmp    803f89 <backoff+0x3f>
+
+0000000000803f99 <wait>:
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803f99:	55                   	push   %rbp
+  803f9a:	48 89 e5             	mov    %rsp,%rbp
+  803f9d:	41 55                	push   %r13
+  803f9f:	41 54                	push   %r12
+  803fa1:	53                   	push   %rbx
+  803fa2:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(envid != 0);
+  803fa6:	85 ff                	test   %edi,%edi
+  803fa8:	74 7e                	je     804028 <wait+0x8f>
+  803faa:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803fad:	89 f8                	mov    %edi,%eax
+  803faf:	25 ff 03 00 00       	and    $0x3ff,%eax
+    unsigned attempt = 0;
+  803fb4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    while (env->env_id == envid &&
+  803fbb:	89 f9                	mov    %edi,%ecx
+  803fbd:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803fc3:	48 69 c9 98 01 00 00 	imul   $0x198,%rcx,%rcx
+  803fca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803fd1:	00 00 00 
+  803fd4:	48 01 ca             	add    %rcx,%rdx
+  803fd7:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803fdd:	39 d7                	cmp    %edx,%edi
+  803fdf:	75 3c                	jne    80401d <wait+0x84>
+           env->env_status != ENV_FREE) {
+  803fe1:	48 98                	cltq
+  803fe3:	48 69 c0 98 01 00 00 	imul   $0x198,%rax,%rax
+  803fea:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803ff1:	00 00 00 
+  803ff4:	48 01 c3             	add    %rax,%rbx
+        backoff(&attempt);
+  803ff7:	49 bd 4a 3f 80 00 00 	movabs $0x803f4a,%r13
+  803ffe:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804001:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804007:	85 c0                	test   %eax,%eax
+  804009:	74 12                	je     80401d <wait+0x84>
+        backoff(&attempt);
+  80400b:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80400f:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804012:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804018:	44 39 e0             	cmp    %r12d,%eax
+  80401b:	74 e4                	je     804001 <wait+0x68>
+    }
+}
+  80401d:	48 83 c4 18          	add    $0x18,%rsp
+  804021:	5b                   	pop    %rbx
+  804022:	41 5c                	pop    %r12
+  804024:	41 5d                	pop    %r13
+  804026:	5d                   	pop    %rbp
+  804027:	c3                   	ret
+    assert(envid != 0);
+  804028:	48 b9 b8 57 80 00 00 	movabs $0x8057b8,%rcx
+  80402f:	00 00 00 
+  804032:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  804039:	00 00 00 
+  80403c:	be 22 00 00 00       	mov    $0x22,%esi
+  804041:	48 bf c3 57 80 00 00 	movabs $0x8057c3,%rdi
+  804048:	00 00 00 
+  80404b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804050:	49 b8 98 3a 80 00 00 	movabs $0x803a98,%r8
+  804057:	00 00 00 
+  80405a:	41 ff d0             	call   *%r8
+
+000000000080405d <__text_end>:
+  80405d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804064:	00 00 00 
+  804067:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80406e:	00 00 00 
+  804071:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804078:	00 00 00 
+  80407b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804082:	00 00 00 
+  804085:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80408c:	00 00 00 
+  80408f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804096:	00 00 00 
+  804099:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040a0:	00 00 00 
+  8040a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040aa:	00 00 00 
+  8040ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040b4:	00 00 00 
+  8040b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040be:	00 00 00 
+  8040c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040c8:	00 00 00 
+  8040cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040d2:	00 00 00 
+  8040d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040dc:	00 00 00 
+  8040df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040e6:	00 00 00 
+  8040e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040f0:	00 00 00 
+  8040f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8040fa:	00 00 00 
+  8040fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804104:	00 00 00 
+  804107:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80410e:	00 00 00 
+  804111:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804118:	00 00 00 
+  80411b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804122:	00 00 00 
+  804125:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80412c:	00 00 00 
+  80412f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804136:	00 00 00 
+  804139:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804140:	00 00 00 
+  804143:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80414a:	00 00 00 
+  80414d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804154:	00 00 00 
+  804157:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80415e:	00 00 00 
+  804161:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804168:	00 00 00 
+  80416b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804172:	00 00 00 
+  804175:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80417c:	00 00 00 
+  80417f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804186:	00 00 00 
+  804189:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804190:	00 00 00 
+  804193:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80419a:	00 00 00 
+  80419d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041a4:	00 00 00 
+  8041a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ae:	00 00 00 
+  8041b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041b8:	00 00 00 
+  8041bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041c2:	00 00 00 
+  8041c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041cc:	00 00 00 
+  8041cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041d6:	00 00 00 
+  8041d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041e0:	00 00 00 
+  8041e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041ea:	00 00 00 
+  8041ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041f4:	00 00 00 
+  8041f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8041fe:	00 00 00 
+  804201:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804208:	00 00 00 
+  80420b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804212:	00 00 00 
+  804215:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80421c:	00 00 00 
+  80421f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804226:	00 00 00 
+  804229:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804230:	00 00 00 
+  804233:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80423a:	00 00 00 
+  80423d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804244:	00 00 00 
+  804247:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80424e:	00 00 00 
+  804251:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804258:	00 00 00 
+  80425b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804262:	00 00 00 
+  804265:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426c:	00 00 00 
+  80426f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804276:	00 00 00 
+  804279:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804280:	00 00 00 
+  804283:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428a:	00 00 00 
+  80428d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804294:	00 00 00 
+  804297:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429e:	00 00 00 
+  8042a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a8:	00 00 00 
+  8042ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b2:	00 00 00 
+  8042b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bc:	00 00 00 
+  8042bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c6:	00 00 00 
+  8042c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d0:	00 00 00 
+  8042d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042da:	00 00 00 
+  8042dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e4:	00 00 00 
+  8042e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ee:	00 00 00 
+  8042f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f8:	00 00 00 
+  8042fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804302:	00 00 00 
+  804305:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430c:	00 00 00 
+  80430f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804316:	00 00 00 
+  804319:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804320:	00 00 00 
+  804323:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432a:	00 00 00 
+  80432d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804334:	00 00 00 
+  804337:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433e:	00 00 00 
+  804341:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804348:	00 00 00 
+  80434b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804352:	00 00 00 
+  804355:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435c:	00 00 00 
+  80435f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804366:	00 00 00 
+  804369:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804370:	00 00 00 
+  804373:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437a:	00 00 00 
+  80437d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804384:	00 00 00 
+  804387:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438e:	00 00 00 
+  804391:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804398:	00 00 00 
+  80439b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a2:	00 00 00 
+  8043a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ac:	00 00 00 
+  8043af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b6:	00 00 00 
+  8043b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c0:	00 00 00 
+  8043c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ca:	00 00 00 
+  8043cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d4:	00 00 00 
+  8043d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043de:	00 00 00 
+  8043e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e8:	00 00 00 
+  8043eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f2:	00 00 00 
+  8043f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fc:	00 00 00 
+  8043ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804406:	00 00 00 
+  804409:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804410:	00 00 00 
+  804413:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441a:	00 00 00 
+  80441d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804424:	00 00 00 
+  804427:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442e:	00 00 00 
+  804431:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804438:	00 00 00 
+  80443b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804442:	00 00 00 
+  804445:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444c:	00 00 00 
+  80444f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804456:	00 00 00 
+  804459:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804460:	00 00 00 
+  804463:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446a:	00 00 00 
+  80446d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804474:	00 00 00 
+  804477:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447e:	00 00 00 
+  804481:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804488:	00 00 00 
+  80448b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804492:	00 00 00 
+  804495:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449c:	00 00 00 
+  80449f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a6:	00 00 00 
+  8044a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b0:	00 00 00 
+  8044b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ba:	00 00 00 
+  8044bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c4:	00 00 00 
+  8044c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ce:	00 00 00 
+  8044d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d8:	00 00 00 
+  8044db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e2:	00 00 00 
+  8044e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ec:	00 00 00 
+  8044ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f6:	00 00 00 
+  8044f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804500:	00 00 00 
+  804503:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450a:	00 00 00 
+  80450d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804514:	00 00 00 
+  804517:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451e:	00 00 00 
+  804521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804528:	00 00 00 
+  80452b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804532:	00 00 00 
+  804535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453c:	00 00 00 
+  80453f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804546:	00 00 00 
+  804549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804550:	00 00 00 
+  804553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455a:	00 00 00 
+  80455d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804564:	00 00 00 
+  804567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456e:	00 00 00 
+  804571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804578:	00 00 00 
+  80457b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804582:	00 00 00 
+  804585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458c:	00 00 00 
+  80458f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804596:	00 00 00 
+  804599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a0:	00 00 00 
+  8045a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045aa:	00 00 00 
+  8045ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b4:	00 00 00 
+  8045b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045be:	00 00 00 
+  8045c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c8:	00 00 00 
+  8045cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d2:	00 00 00 
+  8045d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dc:	00 00 00 
+  8045df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e6:	00 00 00 
+  8045e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f0:	00 00 00 
+  8045f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fa:	00 00 00 
+  8045fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804604:	00 00 00 
+  804607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460e:	00 00 00 
+  804611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804618:	00 00 00 
+  80461b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804622:	00 00 00 
+  804625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462c:	00 00 00 
+  80462f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804636:	00 00 00 
+  804639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804640:	00 00 00 
+  804643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464a:	00 00 00 
+  80464d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804654:	00 00 00 
+  804657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465e:	00 00 00 
+  804661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804668:	00 00 00 
+  80466b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804672:	00 00 00 
+  804675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467c:	00 00 00 
+  80467f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804686:	00 00 00 
+  804689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804690:	00 00 00 
+  804693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469a:	00 00 00 
+  80469d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a4:	00 00 00 
+  8046a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ae:	00 00 00 
+  8046b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b8:	00 00 00 
+  8046bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c2:	00 00 00 
+  8046c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cc:	00 00 00 
+  8046cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d6:	00 00 00 
+  8046d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e0:	00 00 00 
+  8046e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ea:	00 00 00 
+  8046ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f4:	00 00 00 
+  8046f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fe:	00 00 00 
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,52 @@
+/* Measure the cost of allocating and freeing physical pages:
+ * eagerly allocated 4 KiB and 2 MiB shared pages mapped and unmapped
+ * with sys_alloc_region() and sys_unmap_region(), and 4 KiB pages
+ * allocated by write faults on a lazily allocated region. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS  2000
+#define NHUGE    50
+#define NFAULTS  256
+#define HUGE_VA  ((void *)0x40000000)
+#define FAULT_VA ((char *)0x50000000)
+
+static void
+report(const char *what, uint64_t cycles, size_t n) {
+    cprintf("allocbench: %s: %lu cycles/page\n", what, (unsigned long)(cycles / n));
+}
+
+void
+umain(int argc, char **argv) {
+    int res;
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NROUNDS; i++) {
+        if ((res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+            panic("sys_alloc_region: %i", res);
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+    }
+    report("4K alloc+free", read_tsc() - start, NROUNDS);
+
+    start = read_tsc();
+    for (int i = 0; i < NHUGE; i++) {
+        if ((res = sys_alloc_region(0, HUGE_VA, HUGE_PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+            panic("sys_alloc_region: %i", res);
+        sys_unmap_region(0, HUGE_VA, HUGE_PAGE_SIZE);
+    }
+    report("2M alloc+free", read_tsc() - start, NHUGE);
+
+    uint64_t total = 0;
+    for (int i = 0; i < NROUNDS / NFAULTS; i++) {
+        if ((res = sys_alloc_region(0, FAULT_VA, NFAULTS * PAGE_SIZE, PROT_RW)) < 0)
+            panic("sys_alloc_region: %i", res);
+        start = read_tsc();
+        for (size_t j = 0; j < NFAULTS; j++) FAULT_VA[j * PAGE_SIZE] = 1;
+        total += read_tsc() - start;
+        sys_unmap_region(0, FAULT_VA, NFAULTS * PAGE_SIZE);
+    }
+    report("4K write fault", total, NROUNDS / NFAULTS * NFAULTS);
+
+    cprintf("allocbench: OK\n");
+}
@@ -0,0 +1,90 @@
+/* Compare throughput of shared-memory channels with page IPC.
+ * The parent sends NMSGS messages of each size to a child, first
+ * with ipc_send() of a page holding the payload, then through
+ * a channel.  The child copies every payload out and reports
+ * back when it has got them all. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NMSGS     10000
+#define CHAN_SIZE (16 * PAGE_SIZE)
+
+#define CHANVA ((struct Chan *)0xB0000000)
+#define SNDVA  ((uint8_t *)0xC0000000)
+#define RCVVA  ((uint8_t *)0xC0001000)
+
+static const size_t sizes[] = {64, 512, 4096};
+
+static uint8_t buf[PAGE_SIZE];
+
+static void
+ipc_receiver(envid_t parent, size_t size) {
+    for (int i = 0; i < NMSGS; i++) {
+        size_t sz = PAGE_SIZE;
+        ipc_recv(NULL, RCVVA, &sz, NULL);
+        memcpy(buf, RCVVA, size);
+    }
+    ipc_send(parent, 0, NULL, 0, 0);
+}
+
+static void
+chan_receiver(envid_t parent, size_t size) {
+    for (int i = 0; i < NMSGS; i++) {
+        ssize_t res = chan_recv(CHANVA, buf, size);
+        if (res != (ssize_t)size) panic("chan_recv: %zd", res);
+    }
+    ipc_send(parent, 0, NULL, 0, 0);
+}
+
+/* Run receiver in a child and time sending to it */
+static uint64_t
+run(bool use_chan, size_t size) {
+    envid_t parent = thisenv->env_id;
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        if (use_chan) chan_receiver(parent, size);
+        else ipc_receiver(parent, size);
+        exit();
+    }
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NMSGS; i++) {
+        buf[0] = (uint8_t)i;
+        if (use_chan) {
+            ssize_t res = chan_send(CHANVA, buf, size);
+            if (res < 0) panic("chan_send: %zd", res);
+        } else {
+            memcpy(SNDVA, buf, size);
+            ipc_send(child, size, SNDVA, PAGE_SIZE, PROT_R);
+        }
+    }
+    ipc_recv(NULL, NULL, NULL, NULL);
+    uint64_t cycles = read_tsc() - start;
+
+    wait(child);
+    return cycles;
+}
+
+void
+umain(int argc, char **argv) {
+    uint64_t khz = vsys_tsc_khz();
+    int res;
+
+    if ((res = sys_alloc_region(0, SNDVA, PAGE_SIZE, PROT_RW)) < 0)
+        panic("sys_alloc_region: %i", res);
+    if ((res = chan_create(CHANVA, CHAN_SIZE)) < 0)
+        panic("chan_create: %i", res);
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+        uint64_t ipc = run(0, sizes[i]);
+        uint64_t chan = run(1, sizes[i]);
+
+        cprintf("chanbench: %4zu bytes: ipc %lu msg/s, chan %lu msg/s\n", sizes[i],
+                (unsigned long)(NMSGS * khz * 1000 / ipc),
+                (unsigned long)(NMSGS * khz * 1000 / chan));
+    }
+
+    chan_destroy(CHANVA);
+}
@@ -1,23 +1,69 @@
-/* Demonstrate lack of fairness in IPC.
- * Start three instances of this program as envs 1, 2, and 3.
- * (user/idle is env 0). */
+/* Measure how CPU time is shared between environments
+ * of different nice values.  NCHILD children spin until the first
+ * one has run for DURATION TSC cycles, then every child's share of
+ * the consumed CPU time is compared to its share of the total weight.
+ * Run with CPUS=1, otherwise every child may get a CPU of its own. */
 
 #include <inc/lib.h>
 
+#define NCHILD   3
+#define DURATION 1000000000ULL
+
+static const int nices[NCHILD] = {0, 5, 10};
+
+static void
+child(envid_t parent, int nice, bool report) {
+    /* Only system environments may change others' priorities */
+    int res = sys_env_set_priority(0, ENV_SCHED_FAIR, nice);
+    if (res < 0) panic("sys_env_set_priority: %i", res);
+
+    /* Wait until every child is ready */
+    ipc_recv(NULL, NULL, NULL, NULL);
+
+    uint64_t start = thisenv->env_runtime;
+    for (;;) {
+        if (report && thisenv->env_runtime - start > DURATION) {
+            ipc_send(parent, 0, NULL, 0, 0);
+            report = 0;
+        }
+    }
+}
+
 void
 umain(int argc, char **argv) {
-    envid_t who, id;
+    envid_t parent = sys_getenvid(), children[NCHILD];
+    uint64_t start[NCHILD], runtime[NCHILD];
+    uint64_t total_runtime = 0, total_weight = 0;
 
-    id = sys_getenvid();
+    for (int i = 0; i < NCHILD; i++) {
+        if ((children[i] = fork()) < 0)
+            panic("fork: %i", children[i]);
+        if (!children[i]) child(parent, nices[i], i == 0);
+    }
 
-    if (thisenv == &envs[1]) {
-        while (1) {
-            ipc_recv(&who, NULL, NULL, NULL);
-            cprintf("%x recv from %x\n", id, who);
-        }
-    } else {
-        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
-        while (1)
-            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+    /* Children set their nice values before they start receiving */
+    for (int i = 0; i < NCHILD; i++) {
+        start[i] = envs[ENVX(children[i])].env_runtime;
+        ipc_send(children[i], 0, NULL, 0, 0);
+    }
+
+    ipc_recv(NULL, NULL, NULL, NULL);
+
+    for (int i = 0; i < NCHILD; i++) {
+        runtime[i] = envs[ENVX(children[i])].env_runtime - start[i];
+        total_runtime += runtime[i];
+        total_weight += envs[ENVX(children[i])].env_weight;
+    }
+
+    for (int i = 0; i < NCHILD; i++) {
+        const volatile struct Env *env = &envs[ENVX(children[i])];
+        unsigned long share = runtime[i] * 1000 / total_runtime;
+        unsigned long expected = env->env_weight * 1000 / total_weight;
+        cprintf("fairness: env %08x nice %3d weight %5u: share %2lu.%lu%%, expected %2lu.%lu%%\n",
+                children[i], env->env_nice, env->env_weight,
+                share / 10, share % 10, expected / 10, expected % 10);
     }
+
+    for (int i = 0; i < NCHILD; i++)
+        sys_env_destroy(children[i]);
 }
@@ -0,0 +1,130 @@
+/* Measure latency of file reads when many clients use the FS
+ * server at once.  NCLIENTS environments read the beginning of
+ * /lorem NREADS times each, every read is an IPC round trip to
+ * the server.  Every client reports its median, 99th percentile
+ * and worst read latency and the CPU time it has consumed,
+ * which includes time spent waiting for the server to receive.
+ *
+ * With -t it measures instead how fast 1 MiB is written and read
+ * back with single calls, which use vectored requests, and with
+ * calls small enough to take one page-sized request each. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCLIENTS 8
+#define NREADS   500
+#define READSIZE 512
+
+/* Size of the file used by -t and of its small transfers */
+#define BIGSIZE   (1024 * 1024)
+#define SMALLSIZE 4000
+
+static uint64_t latency[NREADS];
+static uint8_t bigbuf[BIGSIZE];
+
+static void
+sort(uint64_t *arr, int n) {
+    for (int gap = n / 2; gap > 0; gap /= 2) {
+        for (int i = gap; i < n; i++) {
+            uint64_t val = arr[i];
+            int j = i;
+            for (; j >= gap && arr[j - gap] > val; j -= gap)
+                arr[j] = arr[j - gap];
+            arr[j] = val;
+        }
+    }
+}
+
+static void
+client(int id) {
+    static char buf[READSIZE];
+
+    int fd = open("/lorem", O_RDONLY);
+    if (fd < 0) panic("open /lorem: %i", fd);
+
+    uint64_t runtime = thisenv->env_runtime;
+    for (int i = 0; i < NREADS; i++) {
+        uint64_t start = read_tsc();
+        int res = seek(fd, 0);
+        if (res >= 0) res = read(fd, buf, sizeof(buf));
+        if (res < 0) panic("read /lorem: %i", res);
+        latency[i] = read_tsc() - start;
+    }
+    runtime = thisenv->env_runtime - runtime;
+    close(fd);
+
+    sort(latency, NREADS);
+    cprintf("fsbench: client %d: median %lu, p99 %lu, max %lu cycles per read, %lu cycles of CPU\n",
+            id, (unsigned long)latency[NREADS / 2], (unsigned long)latency[NREADS * 99 / 100],
+            (unsigned long)latency[NREADS - 1], (unsigned long)runtime);
+}
+
+/* Write BIGSIZE bytes to /fsbench and read them back
+ * in 'chunk' byte calls.  Returns cycles spent */
+static uint64_t
+transfer(size_t chunk) {
+    uint64_t start = read_tsc();
+
+    int fd = open("/fsbench", O_RDWR | O_CREAT | O_TRUNC);
+    if (fd < 0) panic("open /fsbench: %i", fd);
+
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+        int res = write(fd, bigbuf + i, MIN(chunk, BIGSIZE - i));
+        if (res < 0) panic("write /fsbench: %i", res);
+    }
+
+    int res = seek(fd, 0);
+    if (res < 0) panic("seek /fsbench: %i", res);
+    for (size_t i = 0; i < BIGSIZE; i += chunk) {
+        if ((res = readn(fd, bigbuf + i, MIN(chunk, BIGSIZE - i))) < 0)
+            panic("read /fsbench: %i", res);
+    }
+
+    close(fd);
+    return read_tsc() - start;
+}
+
+static void
+throughput(void) {
+    for (size_t i = 0; i < BIGSIZE; i++) bigbuf[i] = i * 13;
+
+    uint64_t small = transfer(SMALLSIZE);
+    uint64_t big = transfer(BIGSIZE);
+
+    for (size_t i = 0; i < BIGSIZE; i++)
+        if (bigbuf[i] != (uint8_t)(i * 13)) panic("/fsbench has bad data at %lu", (unsigned long)i);
+
+    /* Give the disk space back */
+    int fd = open("/fsbench", O_WRONLY | O_TRUNC);
+    if (fd >= 0) close(fd);
+
+    cprintf("fsbench: 1 MiB written and read in %d byte calls: %lu cycles, in single calls: %lu cycles (%lux)\n",
+            SMALLSIZE, (unsigned long)small, (unsigned long)big, (unsigned long)(small / MAX(big, 1)));
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t clients[NCLIENTS];
+    uint64_t start = read_tsc();
+
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+        throughput();
+        return;
+    }
+
+    for (int i = 0; i < NCLIENTS; i++) {
+        if ((clients[i] = fork()) < 0)
+            panic("fork: %i", clients[i]);
+        if (!clients[i]) {
+            client(i);
+            return;
+        }
+    }
+
+    for (int i = 0; i < NCLIENTS; i++)
+        wait(clients[i]);
+
+    cprintf("fsbench: %d clients, %d reads each, %lu cycles total\n",
+            NCLIENTS, NREADS, (unsigned long)(read_tsc() - start));
+}
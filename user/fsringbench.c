@@ -0,0 +1,107 @@
+/* Measure random 4 KiB reads through a file server ring at
+ * different queue depths.  A file of NBLOCKS blocks is created
+ * and, for every depth, dropped from the file server's cache and
+ * read whole in random order with 'depth' reads kept in flight,
+ * so that many disk reads can be in flight at once.  Every block
+ * starts with its number, which is checked. */
+
+#include <inc/lib.h>
+#include <inc/fs.h>
+#include <inc/x86.h>
+
+#define NBLOCKS 1024
+#define BENCHFILE "/fsringbench"
+
+static uint32_t order[NBLOCKS];
+static uint8_t buf[BLKSIZE];
+
+static void
+make_file(void) {
+    int fd = open(BENCHFILE, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0) panic("creat %s: %i", BENCHFILE, fd);
+
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+        memset(buf, i, sizeof(buf));
+        memcpy(buf, &i, sizeof(i));
+        int res = write(fd, buf, sizeof(buf));
+        if (res != sizeof(buf)) panic("write %s: %i", BENCHFILE, res);
+    }
+    close(fd);
+}
+
+static void
+shuffle(void) {
+    static uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = 0; i < NBLOCKS; i++) order[i] = i;
+    for (uint32_t i = NBLOCKS - 1; i > 0; i--) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint32_t j = (seed >> 33) % (i + 1);
+        uint32_t tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+}
+
+static void
+bench(struct FsRing *ring, int fd, int depth) {
+    char *data = fsring_data(ring);
+    /* Free data pages, tags of requests are their indexes */
+    int freepages[FSRING_ENTRIES], nfree = 0;
+    for (int i = 0; i < depth; i++) freepages[nfree++] = i;
+
+    int res = drop_cache(fd);
+    if (res < 0) panic("drop_cache: %i", res);
+    shuffle();
+
+    uint64_t start = read_tsc();
+    size_t submitted = 0, completed = 0;
+    while (completed < NBLOCKS) {
+        while (submitted < NBLOCKS && nfree) {
+            int page = freepages[--nfree];
+            res = fsring_submit(ring, FSRING_READ, page, fd, (off_t)order[submitted] * BLKSIZE,
+                                data + page * PAGE_SIZE, BLKSIZE);
+            if (res < 0) panic("fsring_submit: %i", res);
+            submitted++;
+        }
+        if ((res = fsring_enter(ring)) < 0) panic("fsring_enter: %i", res);
+
+        struct FsRingCqe cqe;
+        for (bool wait = 1; fsring_reap(ring, &cqe, wait); wait = 0) {
+            if (cqe.fc_res != BLKSIZE) panic("ring read: %ld", (long)cqe.fc_res);
+            uint32_t blockno;
+            memcpy(&blockno, data + cqe.fc_tag * PAGE_SIZE, sizeof(blockno));
+            if (blockno >= NBLOCKS || data[cqe.fc_tag * PAGE_SIZE + BLKSIZE - 1] != (char)blockno)
+                panic("ring read returned wrong data");
+            freepages[nfree++] = cqe.fc_tag;
+            completed++;
+        }
+    }
+    uint64_t cycles = read_tsc() - start;
+
+    uint64_t khz = vsys_tsc_khz();
+    cprintf("fsringbench: depth %2d: %lu cycles/read", depth, (unsigned long)(cycles / NBLOCKS));
+    if (khz) cprintf(", %lu IOPS", (unsigned long)(NBLOCKS * khz * 1000 / MAX(cycles, 1)));
+    cprintf("\n");
+}
+
+void
+umain(int argc, char **argv) {
+    make_file();
+
+    int fd = open(BENCHFILE, O_RDONLY);
+    if (fd < 0) panic("open %s: %i", BENCHFILE, fd);
+
+    struct FsRing *ring;
+    int res = fsring_create(&ring);
+    if (res < 0) panic("fsring_create: %i", res);
+
+    for (int depth = 1; depth <= FSRING_ENTRIES / 2; depth *= 2)
+        bench(ring, fd, depth);
+
+    fsring_destroy(ring);
+    close(fd);
+
+    /* Give the disk space back */
+    if ((fd = open(BENCHFILE, O_WRONLY | O_TRUNC)) >= 0) close(fd);
+    cprintf("fsringbench: OK\n");
+}
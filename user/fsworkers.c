@@ -0,0 +1,96 @@
+/* Check that requests hitting the file server's block cache are not
+ * stuck behind ones waiting for the disk.  A child keeps reading a
+ * file of NBLOCKS blocks that is dropped from the cache every time,
+ * while the parent measures reads of small cached /lorem, first
+ * alone and then alongside the child. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NBLOCKS 512
+#define NHITS   2000
+#define BIGFILE "/fsworkers"
+
+static uint8_t buf[BLKSIZE];
+
+static void
+make_big(void) {
+    int fd = open(BIGFILE, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+
+    for (uint32_t i = 0; i < NBLOCKS; i++) {
+        memset(buf, i, sizeof(buf));
+        int res = write(fd, buf, sizeof(buf));
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+    }
+    close(fd);
+}
+
+/* Read BIGFILE from the disk until 'stop' is set */
+static void
+read_misses(volatile uint32_t *stop) {
+    static uint8_t data[BLKSIZE];
+    int fd = open(BIGFILE, O_RDONLY);
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+
+    while (!*stop) {
+        int res = drop_cache(fd);
+        if (res < 0) panic("drop_cache: %i", res);
+        seek(fd, 0);
+        for (uint32_t i = 0; i < NBLOCKS && !*stop; i++) {
+            if ((res = readn(fd, data, sizeof(data))) != sizeof(data)) panic("read %s: %i", BIGFILE, res);
+            if (data[BLKSIZE - 1] != (uint8_t)i) panic("read %s returned wrong data", BIGFILE);
+        }
+    }
+    close(fd);
+}
+
+/* Average cycles of reading /lorem whole */
+static uint64_t
+read_hits(void) {
+    int fd = open("/lorem", O_RDONLY);
+    if (fd < 0) panic("open /lorem: %i", fd);
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NHITS; i++) {
+        seek(fd, 0);
+        int res = read(fd, buf, sizeof(buf));
+        if (res <= 0) panic("read /lorem: %i", res);
+    }
+    uint64_t cycles = read_tsc() - start;
+
+    close(fd);
+    return cycles / NHITS;
+}
+
+void
+umain(int argc, char **argv) {
+    make_big();
+
+    /* Warm up the cache */
+    read_hits();
+    uint64_t alone = read_hits();
+
+    volatile uint32_t *stop = (volatile uint32_t *)UTEMP;
+    int res = sys_alloc_region(0, (void *)stop, PAGE_SIZE, PROT_RW | PROT_SHARE);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        read_misses(stop);
+        exit();
+    }
+
+    uint64_t busy = read_hits();
+    *stop = 1;
+    wait(child);
+
+    cprintf("fsworkers: cached read %lu cycles alone, %lu cycles with disk reads\n",
+            (unsigned long)alone, (unsigned long)busy);
+
+    /* Give the disk space back */
+    int fd = open(BIGFILE, O_WRONLY | O_TRUNC);
+    if (fd >= 0) close(fd);
+    cprintf("fsworkers: OK\n");
+}
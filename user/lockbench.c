@@ -0,0 +1,76 @@
+/* Measure kernel throughput under a mix of system calls
+ * that take different kernel locks: sys_alloc_region()
+ * (address space and pmap locks), fork() (env table, pmap) and
+ * ipc_send() (env and scheduler locks).
+ * NWORKERS environments are split into ping-pong pairs.
+ * Compare results of running with CPUS=1 and more CPUs. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NWORKERS   4
+#define NROUNDS    2000
+#define FORK_EVERY 100
+#define REGION     (4 * PAGE_SIZE)
+
+static void
+worker(envid_t parent, int id, envid_t partner) {
+    uint8_t *va = (uint8_t *)UTEMP + id * REGION;
+    int res;
+
+    for (int i = 0; i < NROUNDS; i++) {
+        if ((res = sys_alloc_region(0, va, REGION, PROT_RW)) < 0)
+            panic("sys_alloc_region: %i", res);
+        va[0] = (uint8_t)i;
+        if ((res = sys_unmap_region(0, va, REGION)) < 0)
+            panic("sys_unmap_region: %i", res);
+
+        if (i % FORK_EVERY == 0) {
+            envid_t child = fork();
+            if (child < 0) panic("fork: %i", child);
+            if (!child) exit();
+        }
+
+        if (id & 1) {
+            ipc_recv(NULL, NULL, NULL, NULL);
+            ipc_send(partner, i, NULL, 0, 0);
+        } else {
+            ipc_send(partner, i, NULL, 0, 0);
+            ipc_recv(NULL, NULL, NULL, NULL);
+        }
+    }
+
+    ipc_send(parent, id, NULL, 0, 0);
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t parent = sys_getenvid();
+    envid_t workers[NWORKERS];
+
+    for (int i = 0; i < NWORKERS; i++) {
+        if ((workers[i] = fork()) < 0)
+            panic("fork: %i", workers[i]);
+        if (!workers[i]) {
+            /* Odd workers are forked after their partners and
+             * wait for the first ping, even ones are told
+             * who their partner is before they send it */
+            envid_t partner = i & 1 ? workers[i - 1] : (envid_t)ipc_recv(NULL, NULL, NULL, NULL);
+            worker(parent, i, partner);
+            return;
+        }
+    }
+
+    uint64_t start = read_tsc();
+
+    for (int i = 0; i < NWORKERS; i += 2)
+        ipc_send(workers[i], workers[i + 1], NULL, 0, 0);
+
+    for (int i = 0; i < NWORKERS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("lockbench: %d workers, %d rounds, %lu cycles per round\n",
+            NWORKERS, NROUNDS, (unsigned long)(cycles / NROUNDS));
+}
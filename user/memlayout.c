@@ -16,7 +16,7 @@ memlayout(void) {
     size_t total_cow = 0;
 
     cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
-    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+    cprintf("space=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space,
             (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
 
     for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
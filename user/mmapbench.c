@@ -0,0 +1,136 @@
+/* Compare scanning files with read() and with mmap().
+ * Small /lorem is opened, scanned and closed many times,
+ * then a file of BIGSIZE bytes is created and scanned whole
+ * a few times.  Both ways must produce the same checksum.
+ * Finally a shared mapping is written and synced back. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSMALL  1000
+#define NBIG    4
+#define BIGSIZE (4 * 1024 * 1024)
+#define BIGFILE "/mmapbench"
+
+static uint8_t buf[8 * PAGE_SIZE];
+
+static uint64_t
+sum(const uint8_t *data, size_t n) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < n; i++) res += data[i] * (i | 1);
+    return res;
+}
+
+static uint64_t
+scan_read(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) panic("open %s: %i", path, fd);
+
+    uint64_t res = 0;
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) res += sum(buf, n);
+    if (n < 0) panic("read %s: %i", path, (int)n);
+
+    close(fd);
+    return res;
+}
+
+static uint64_t
+scan_mmap(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) panic("open %s: %i", path, fd);
+
+    struct Stat st;
+    int res = fstat(fd, &st);
+    if (res < 0) panic("stat %s: %i", path, res);
+
+    uint8_t *data = mmap(fd, 0, st.st_size, PROT_R, MAP_PRIVATE);
+    if (!data) panic("mmap %s failed", path);
+
+    /* Same chunks as scan_read() so the checksums match */
+    uint64_t sm = 0;
+    for (off_t i = 0; i < st.st_size; i += sizeof(buf))
+        sm += sum(data + i, MIN(sizeof(buf), (size_t)(st.st_size - i)));
+
+    munmap(data, st.st_size);
+    close(fd);
+    return sm;
+}
+
+static void
+bench(const char *path, int rounds, size_t size) {
+    uint64_t start = read_tsc();
+    uint64_t sr = 0;
+    for (int i = 0; i < rounds; i++) sr = scan_read(path);
+    uint64_t tread = read_tsc() - start;
+
+    start = read_tsc();
+    uint64_t sm = 0;
+    for (int i = 0; i < rounds; i++) sm = scan_mmap(path);
+    uint64_t tmmap = read_tsc() - start;
+
+    if (sr != sm) panic("%s checksums differ: read %lx, mmap %lx", path, (long)sr, (long)sm);
+
+    uint64_t khz = vsys_tsc_khz();
+    uint64_t bytes = (uint64_t)size * rounds;
+    cprintf("mmapbench: %s, %d x %lu bytes: read %lu cycles/scan",
+            path, rounds, (unsigned long)size, (unsigned long)(tread / rounds));
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tread / 1000, 1)));
+    cprintf(", mmap %lu cycles/scan", (unsigned long)(tmmap / rounds));
+    if (khz) cprintf(" (%lu MB/s)", (unsigned long)(bytes * khz / 1000 / MAX(tmmap / 1000, 1)));
+    cprintf("\n");
+}
+
+static void
+make_big(void) {
+    int fd = open(BIGFILE, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0) panic("creat %s: %i", BIGFILE, fd);
+
+    for (size_t off = 0; off < BIGSIZE; off += sizeof(buf)) {
+        for (size_t i = 0; i < sizeof(buf); i++) buf[i] = (off + i) * 7 + (off >> 12);
+        int res = write(fd, buf, sizeof(buf));
+        if (res != sizeof(buf)) panic("write %s: %i", BIGFILE, res);
+    }
+    close(fd);
+}
+
+static void
+check_shared(void) {
+    int fd = open(BIGFILE, O_RDWR);
+    if (fd < 0) panic("open %s: %i", BIGFILE, fd);
+
+    uint8_t *data = mmap(fd, PAGE_SIZE, 2 * PAGE_SIZE, PROT_RW, MAP_SHARED);
+    if (!data) panic("mmap %s shared failed", BIGFILE);
+
+    uint8_t old = data[PAGE_SIZE + 1];
+    data[PAGE_SIZE + 1] = ~old;
+    int res = msync(data, 2 * PAGE_SIZE);
+    if (res < 0) panic("msync: %i", res);
+
+    uint8_t val;
+    if ((res = seek(fd, 2 * PAGE_SIZE + 1)) < 0 || (res = readn(fd, &val, 1)) != 1)
+        panic("read %s: %i", BIGFILE, res);
+    if (val != (uint8_t)~old) panic("write to shared mapping is not seen by read()");
+
+    data[PAGE_SIZE + 1] = old;
+    if ((res = munmap(data, 2 * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+    close(fd);
+}
+
+void
+umain(int argc, char **argv) {
+    struct Stat st;
+    int res = stat("/lorem", &st);
+    if (res < 0) panic("stat /lorem: %i", res);
+
+    bench("/lorem", NSMALL, st.st_size);
+
+    make_big();
+    bench(BIGFILE, NBIG, BIGSIZE);
+
+    check_shared();
+    /* Give the disk space back */
+    int fd = open(BIGFILE, O_WRONLY | O_TRUNC);
+    if (fd >= 0) close(fd);
+    cprintf("mmapbench: OK\n");
+}
@@ -0,0 +1,40 @@
+/* Run a program with a smaller share of CPU time:
+ *     nice [-n increment] program [args...]
+ * The increment is added to the nice value of the current
+ * environment (10 by default).  Negative increments fail,
+ * only system environments may raise priorities.
+ * Without a program prints the current nice value. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    int increment = 10, res;
+
+    if (argc > 2 && !strcmp(argv[1], "-n")) {
+        increment = strtol(argv[2], NULL, 10);
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 2) {
+        printf("%d\n", thisenv->env_nice);
+        return;
+    }
+
+    int nice = thisenv->env_nice + increment;
+    nice = MAX(ENV_NICE_MIN, MIN(nice, ENV_NICE_MAX));
+
+    /* Spawned program inherits scheduling class and priority */
+    if ((res = sys_env_set_priority(0, ENV_SCHED_FAIR, nice)) < 0) {
+        printf("nice: cannot set nice value %d: %i\n", nice, res);
+        return;
+    }
+
+    envid_t child = spawn(argv[1], (const char **)argv + 1);
+    if (child < 0) {
+        printf("nice: cannot spawn %s: %i\n", argv[1], child);
+        return;
+    }
+    wait(child);
+}
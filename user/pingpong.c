@@ -1,13 +1,17 @@
-/* Ping-pong a counter between two processes.
+/* Ping-pong a counter between two processes,
+ * then measure the cost of an IPC round trip.
  * Only need to start one of these -- splits into two with fork. */
 
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS 1000
 
 void
 umain(int argc, char **argv) {
-    envid_t who;
+    envid_t who, child;
 
-    if ((who = fork()) != 0) {
+    if ((who = child = fork()) != 0) {
         /* get the ball rolling */
         cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
         ipc_send(who, 0, 0, 0, 0);
@@ -16,9 +20,26 @@ umain(int argc, char **argv) {
     while (1) {
         uint32_t i = ipc_recv(&who, 0, 0, 0);
         cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
-        if (i == 10) return;
+        if (i == 10) break;
         i++;
         ipc_send(who, i, 0, 0, 0);
-        if (i == 10) return;
+        if (i == 10) break;
+    }
+
+    if (!child) {
+        /* Echo requests back with register-only replies */
+        uint32_t i = ipc_reply_wait(0, 0, 0, 0, 0, &who, 0, 0, NULL);
+        for (int n = 1; n < NROUNDS; n++)
+            i = ipc_reply_wait(who, i, 0, 0, 0, &who, 0, 0, NULL);
+        ipc_send(who, i, 0, 0, 0);
+        return;
+    }
+
+    uint64_t start = read_tsc();
+    for (uint32_t i = 0; i < NROUNDS; i++) {
+        if (ipc_call(child, i, 0, 0, 0, 0, 0, NULL) != i)
+            panic("round trip %d returned wrong value", i);
     }
+    cprintf("pingpong: %lu cycles per round trip\n",
+            (unsigned long)((read_tsc() - start) / NROUNDS));
 }
@@ -1,15 +1,19 @@
-/* Ping-pong a counter between two shared-memory processes.
+/* Ping-pong a counter between two shared-memory processes,
+ * then measure the cost of an IPC round trip.
  * Only need to start one of these -- splits into two with sfork. */
 
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS 1000
 
 uint32_t val;
 
 void
 umain(int argc, char **argv) {
-    envid_t who;
+    envid_t who, child;
 
-    if ((who = sfork()) != 0) {
+    if ((who = child = sfork()) != 0) {
         cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
         /* Get the ball rolling */
         cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
@@ -19,9 +23,32 @@ umain(int argc, char **argv) {
     while (1) {
         ipc_recv(&who, 0, 0, 0);
         cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
-        if (val == 10) return;
+        if (val == 10) break;
+        ++val;
+        ipc_send(who, 0, 0, 0, 0);
+        if (val == 10) break;
+    }
+
+    if (!child) {
+        /* Requests only say that val has changed */
+        ipc_reply_wait(0, 0, 0, 0, 0, &who, 0, 0, NULL);
+        for (int n = 1; n < NROUNDS; n++) {
+            ++val;
+            ipc_reply_wait(who, 0, 0, 0, 0, &who, 0, 0, NULL);
+        }
         ++val;
         ipc_send(who, 0, 0, 0, 0);
-        if (val == 10) return;
+        return;
+    }
+
+    uint32_t expected = val;
+    uint64_t start = read_tsc();
+    for (int n = 0; n < NROUNDS; n++) {
+        ++val;
+        ipc_call(child, 0, 0, 0, 0, 0, 0, NULL);
+        if (val != (expected += 2))
+            panic("round trip %d: val is %d instead of %d", n, val, expected);
     }
+    cprintf("pingpongs: %lu cycles per round trip\n",
+            (unsigned long)((read_tsc() - start) / NROUNDS));
 }
@@ -0,0 +1,51 @@
+/* Measure the cost of a scheduling decision when
+ * there are lots of blocked environments in the system.
+ * Two environments keep yielding to each other while
+ * NBLOCKED others sleep in ipc_recv(). */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NBLOCKED 512
+#define NROUNDS  10000
+
+static envid_t blocked[NBLOCKED];
+
+void
+umain(int argc, char **argv) {
+    envid_t peer;
+    int i, nblocked;
+
+    for (nblocked = 0; nblocked < NBLOCKED; nblocked++) {
+        envid_t id = fork();
+        if (id < 0) break;
+        if (!id) {
+            ipc_recv(NULL, NULL, NULL, NULL);
+            return;
+        }
+        blocked[nblocked] = id;
+    }
+
+    /* Let every child reach ipc_recv() */
+    for (i = 0; i < nblocked; i++)
+        while (envs[ENVX(blocked[i])].env_status != ENV_NOT_RUNNABLE)
+            sys_yield();
+
+    if ((peer = fork()) < 0)
+        panic("fork: %i", peer);
+    if (!peer) {
+        for (;;) sys_yield();
+    }
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NROUNDS; i++)
+        sys_yield();
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("schedbench: %d blocked envs, %lu cycles per yield round trip\n",
+            nblocked, (unsigned long)(cycles / NROUNDS));
+
+    sys_env_destroy(peer);
+    for (i = 0; i < nblocked; i++)
+        sys_env_destroy(blocked[i]);
+}
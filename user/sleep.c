@@ -0,0 +1,42 @@
+/* Test sys_sleep_until() and ipc_recv_timeout() */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSLEEPS 5
+/* About a few milliseconds on any reasonable CPU */
+#define DELAY (1ULL << 24)
+
+void
+umain(int argc, char **argv) {
+    for (int i = 0; i < NSLEEPS; i++) {
+        uint64_t deadline = read_tsc() + DELAY;
+        int res = sys_sleep_until(deadline);
+        if (res < 0) panic("sys_sleep_until: %i", res);
+        if (read_tsc() < deadline) panic("woke up too early");
+    }
+    cprintf("sleep: woke up on time\n");
+
+    int res = ipc_recv_timeout(NULL, NULL, NULL, NULL, read_tsc() - 1);
+    if (res != -E_TIMEOUT) panic("past deadline: got %i instead of timeout", res);
+
+    uint64_t deadline = read_tsc() + DELAY;
+    res = ipc_recv_timeout(NULL, NULL, NULL, NULL, deadline);
+    if (res != -E_TIMEOUT) panic("got %i instead of timeout", res);
+    if (read_tsc() < deadline) panic("timed out too early");
+    cprintf("sleep: receive timed out\n");
+
+    envid_t parent = sys_getenvid();
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        sys_sleep_until(read_tsc() + DELAY);
+        ipc_send(parent, 42, NULL, 0, 0);
+        return;
+    }
+
+    envid_t from;
+    res = ipc_recv_timeout(&from, NULL, NULL, NULL, read_tsc() + 100 * DELAY);
+    if (res != 42 || from != child) panic("got %i from %08x instead of 42", res, from);
+    cprintf("sleep: received %d before deadline\n", res);
+}
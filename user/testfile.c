@@ -121,6 +121,20 @@ umain(int argc, char **argv) {
             panic("read /big from %ld returned bad data %d",
                   (long)i, *(int *)buf);
     }
+
+    /* Same data mapped from the block cache, private to us */
+    char *map = (char *)0xB000000;
+    if ((r = read_map(f, 0, map, (NDIRECT * 3) * BLKSIZE, PROT_RW)) != (NDIRECT * 3) * BLKSIZE)
+        panic("read_map /big: %ld", (long)r);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+        if (*(int *)(map + i) != i)
+            panic("read_map /big from %ld returned bad data %d",
+                  (long)i, *(int *)(map + i));
+    }
+    *(int *)map = -1;
+    if ((r = seek(f, 0)) < 0 || (r = readn(f, buf, sizeof(buf))) != sizeof(buf) || *(int *)buf != 0)
+        panic("writing read_map pages changed /big: %ld", (long)r);
+    sys_unmap_region(0, map, (NDIRECT * 3) * BLKSIZE);
     close(f);
     cprintf("large file is good\n");
 }
@@ -0,0 +1,84 @@
+/* Test futexes and mutexes and condition variables built on them
+ * in a page shared between environments */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCHILDREN 4
+#define NITERS    200
+/* About a few milliseconds on any reasonable CPU */
+#define DELAY (1ULL << 24)
+
+struct Shared {
+    struct Mutex lock;
+    struct Cond cond;
+    uint32_t counter;
+    uint32_t started;
+    uint32_t go;
+};
+
+#define SHARED ((struct Shared *)0xA000000)
+
+static void
+child(void) {
+    struct Shared *sh = SHARED;
+
+    mutex_lock(&sh->lock);
+    sh->started++;
+    cond_broadcast(&sh->cond);
+    while (!sh->go) cond_wait(&sh->cond, &sh->lock);
+    mutex_unlock(&sh->lock);
+
+    for (int i = 0; i < NITERS; i++) {
+        mutex_lock(&sh->lock);
+        uint32_t val = sh->counter;
+        /* Let others run into the locked mutex */
+        if (!(i % 16)) sys_yield();
+        sh->counter = val + 1;
+        mutex_unlock(&sh->lock);
+    }
+}
+
+void
+umain(int argc, char **argv) {
+    struct Shared *sh = SHARED;
+    int res;
+
+    if ((res = sys_alloc_region(0, sh, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+        panic("sys_alloc_region: %i", res);
+
+    res = sys_futex_wait(&sh->counter, 1, 0);
+    if (res != -E_AGAIN) panic("futex_wait of changed value: %i", res);
+
+    uint64_t deadline = read_tsc() + DELAY;
+    res = sys_futex_wait(&sh->counter, 0, deadline);
+    if (res != -E_TIMEOUT) panic("futex_wait with timeout: %i", res);
+    if (read_tsc() < deadline) panic("futex_wait timed out too early");
+
+    res = sys_futex_wake(&sh->counter, 1);
+    if (res) panic("futex_wake without waiters: %i", res);
+
+    envid_t children[NCHILDREN];
+    for (int i = 0; i < NCHILDREN; i++) {
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+        if (!children[i]) {
+            child();
+            return;
+        }
+    }
+
+    /* Start all children at once */
+    mutex_lock(&sh->lock);
+    while (sh->started < NCHILDREN) cond_wait(&sh->cond, &sh->lock);
+    sh->go = 1;
+    cond_broadcast(&sh->cond);
+    mutex_unlock(&sh->lock);
+
+    for (int i = 0; i < NCHILDREN; i++)
+        wait(children[i]);
+
+    if (sh->counter != NCHILDREN * NITERS)
+        panic("counter is %u instead of %u", sh->counter, NCHILDREN * NITERS);
+
+    cprintf("testfutex: OK\n");
+}
@@ -1,12 +1,61 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+/* Data moved through the pipe by "testpipe -t" */
+#define THROUGHPUT_BYTES (16 * 1024 * 1024)
+#define THROUGHPUT_CHUNK (16 * 1024)
 
 char *msg = "Now is the time for all good men to come to the aid of their party.";
 
+/* Measure how fast a child can read what we write */
+static void
+throughput(void) {
+    static char buf[THROUGHPUT_CHUNK];
+    int i, pid, p[2];
+
+    binaryname = "pipethroughput";
+    if ((i = pipe(p)) < 0)
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+        panic("fork: %i", pid);
+
+    if (pid == 0) {
+        close(p[1]);
+        size_t total = 0;
+        while ((i = read(p[0], buf, sizeof(buf))) > 0)
+            total += i;
+        if (i < 0) panic("read: %i", i);
+        if (total != THROUGHPUT_BYTES)
+            panic("read %zu bytes instead of %d", total, THROUGHPUT_BYTES);
+        exit();
+    }
+
+    close(p[0]);
+    memset(buf, 'x', sizeof(buf));
+    uint64_t start = read_tsc();
+    for (size_t total = 0; total < THROUGHPUT_BYTES; total += sizeof(buf))
+        if ((i = write(p[1], buf, sizeof(buf))) != sizeof(buf))
+            panic("write: %i", i);
+    close(p[1]);
+    wait(pid);
+    uint64_t cycles = read_tsc() - start;
+
+    uint64_t bytes_per_ms = (uint64_t)THROUGHPUT_BYTES * vsys_tsc_khz() / cycles;
+    cprintf("pipe throughput: %d MB in %lu cycles, %lu MB/s\n",
+            THROUGHPUT_BYTES >> 20, (unsigned long)cycles, (unsigned long)(bytes_per_ms / 1000));
+}
+
 void
 umain(int argc, char **argv) {
     char buf[100];
     int i, pid, p[2];
 
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+        throughput();
+        return;
+    }
+
     binaryname = "pipereadeof";
 
     if ((i = pipe(p)) < 0)
@@ -0,0 +1,95 @@
+/* Measure random access over 64 MiB of anonymous memory backed by
+ * 2 MiB pages and by 4 KiB pages, and check that a window populated
+ * with 4 KiB pages is collapsed into a huge page in the background. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define REGION_SIZE (64 * 1024 * 1024)
+#define NPAGES      (REGION_SIZE / PAGE_SIZE)
+#define NACCESS     (1 << 22)
+#define REGION_VA   ((char *)0x40000000)
+#define WINDOW_VA   ((char *)0x48000000)
+/* Different available bits keep neighbouring pages from being merged */
+#define SMALL_MARK 0x200
+/* Give up waiting for the collapse after this many TSC cycles */
+#define MAXWAIT (1ULL << 34)
+
+static uint64_t rng = 88172645463325252ULL;
+
+static inline uint64_t
+xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+static void
+report(const char *what, uint64_t cycles, size_t n) {
+    cprintf("thpbench: %s: %lu cycles\n", what, (unsigned long)(cycles / n));
+}
+
+static bool
+is_huge(void *va) {
+    return get_uvpt_entry(va) & PTE_PS;
+}
+
+static void
+touch(const char *what, char *va) {
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < NPAGES; i++) va[i * PAGE_SIZE] = (char)i;
+    report(what, read_tsc() - start, NPAGES);
+}
+
+static void
+sweep(const char *what, char *va) {
+    volatile uint64_t *words = (volatile uint64_t *)va;
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < NACCESS; i++) words[xorshift() % (REGION_SIZE / sizeof(uint64_t))]++;
+    report(what, read_tsc() - start, NACCESS);
+}
+
+void
+umain(int argc, char **argv) {
+    int res;
+
+    if ((res = sys_alloc_region(0, REGION_VA, REGION_SIZE, PROT_RW)) < 0)
+        panic("sys_alloc_region: %i", res);
+    touch("2M first touch/page", REGION_VA);
+    for (size_t i = 0; i < REGION_SIZE; i += HUGE_PAGE_SIZE)
+        if (!is_huge(REGION_VA + i)) panic("%p is not in a huge page", REGION_VA + i);
+    sweep("2M random access", REGION_VA);
+    sys_unmap_region(0, REGION_VA, REGION_SIZE);
+
+    for (size_t i = 0; i < NPAGES; i++) {
+        int mark = i & 1 ? SMALL_MARK : 0;
+        if ((res = sys_alloc_region(0, REGION_VA + i * PAGE_SIZE, PAGE_SIZE, PROT_RW | mark)) < 0)
+            panic("sys_alloc_region: %i", res);
+    }
+    touch("4K first touch/page", REGION_VA);
+    if (is_huge(REGION_VA)) panic("%p is in a huge page", REGION_VA);
+    sweep("4K random access", REGION_VA);
+    sys_unmap_region(0, REGION_VA, REGION_SIZE);
+
+    /* Every page is written before the next one is mapped,
+     * so the window is never covered by lazy mappings */
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++) {
+        if ((res = sys_alloc_region(0, WINDOW_VA + i * PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+            panic("sys_alloc_region: %i", res);
+        WINDOW_VA[i * PAGE_SIZE] = (char)i;
+    }
+    if (is_huge(WINDOW_VA)) panic("%p is in a huge page before collapse", WINDOW_VA);
+
+    uint64_t start = read_tsc();
+    while (!is_huge(WINDOW_VA)) {
+        if (read_tsc() - start > MAXWAIT) panic("%p was not collapsed", WINDOW_VA);
+        asm volatile("pause");
+    }
+    report("collapse wait", read_tsc() - start, 1);
+    for (size_t i = 0; i < HUGE_PAGE_SIZE / PAGE_SIZE; i++)
+        if (WINDOW_VA[i * PAGE_SIZE] != (char)i) panic("page %lu changed by collapse", (unsigned long)i);
+    sys_unmap_region(0, WINDOW_VA, HUGE_PAGE_SIZE);
+
+    cprintf("thpbench: OK\n");
+}
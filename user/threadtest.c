@@ -0,0 +1,86 @@
+/* Check threads made by thread_create().  They count together under
+ * a mutex, each must see its own thisenv, and a page replaced by the
+ * main thread must not stay visible to threads through stale TLB
+ * entries on other CPUs. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NTHREADS 4
+#define NITER    10000
+/* Give up waiting for the new page after this many TSC cycles */
+#define MAXWAIT (1ULL << 32)
+
+static struct Mutex lock;
+static uint32_t counter;
+static volatile uint32_t ready;
+
+static void *
+count(void *arg) {
+    uintptr_t i = (uintptr_t)arg;
+    if (thisenv->env_id != sys_getenvid())
+        panic("thread %lu: thisenv is %08x, not %08x", (unsigned long)i, thisenv->env_id, sys_getenvid());
+
+    for (int n = 0; n < NITER; n++) {
+        mutex_lock(&lock);
+        counter++;
+        mutex_unlock(&lock);
+    }
+    return (void *)(i * 2);
+}
+
+/* Keep reading UTEMP until the main thread replaces its page */
+static void *
+watch(void *arg) {
+    volatile uint32_t *val = (volatile uint32_t *)UTEMP;
+    __atomic_add_fetch(&ready, 1, __ATOMIC_SEQ_CST);
+
+    uint64_t start = read_tsc();
+    while (*val != 2) {
+        if (read_tsc() - start > MAXWAIT) return (void *)0;
+        asm volatile("pause");
+    }
+    return (void *)1;
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t ids[NTHREADS];
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+        ids[i] = thread_create(count, (void *)i);
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+    }
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+        void *res;
+        int err = thread_join(ids[i], &res);
+        if (err < 0) panic("thread_join: %i", err);
+        if (res != (void *)(i * 2)) panic("thread %lu returned %p", (unsigned long)i, res);
+    }
+    if (counter != NTHREADS * NITER) panic("counter is %u instead of %u", counter, NTHREADS * NITER);
+    if (thisenv->env_id != sys_getenvid()) panic("thisenv of the main thread changed");
+    cprintf("threadtest: counting OK\n");
+
+    uint32_t *val = (uint32_t *)UTEMP;
+    int res = sys_alloc_region(0, val, PAGE_SIZE, PROT_RW);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+    *val = 1;
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+        ids[i] = thread_create(watch, NULL);
+        if (ids[i] < 0) panic("thread_create: %i", ids[i]);
+    }
+    while (ready != NTHREADS) sys_yield();
+
+    /* Threads see the new page only once their TLBs are flushed */
+    if ((res = sys_alloc_region(0, val, PAGE_SIZE, PROT_RW)) < 0) panic("sys_alloc_region: %i", res);
+    *val = 2;
+
+    for (uintptr_t i = 0; i < NTHREADS; i++) {
+        void *seen;
+        thread_join(ids[i], &seen);
+        if (!seen) panic("thread %lu kept seeing the old page", (unsigned long)i);
+    }
+    sys_unmap_region(0, val, PAGE_SIZE);
+    cprintf("threadtest: OK\n");
+}